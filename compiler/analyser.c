@@ -65,6 +65,7 @@ static struct node * new_node(struct analyser * a, int type) {
     p->left = 0;
     p->right = 0;
     p->aux = 0;
+    p->among = 0;
     p->AE = 0;
     p->name = 0;
     p->literalstring = 0;
@@ -675,6 +676,9 @@ static void make_among(struct analyser * a, struct node * p, struct node * subst
     x->starter = 0;
     x->nocommand_count = 0;
     x->amongvar_needed = false;
+    x->packed = false;
+    x->hashed = false;
+    x->translated = false;
 
     if (q->type == c_bra) { x->starter = q; q = q->right; }
 
@@ -1232,6 +1236,7 @@ static void read_define_grouping(struct analyser * a, struct name * q) {
         p->next = 0;
         p->name = q;
         p->line_number = a->tokeniser->line_number;
+        p->scan_written = false;
         p->b = create_b(0);
         while (true) {
             switch (read_token(t)) {
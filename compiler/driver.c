@@ -42,6 +42,9 @@ static void print_arglist(int exit_code) {
                "  -cs[harp]\n"
 #endif
                "  -c++\n"
+#ifndef DISABLE_BYTECODE
+               "  -bytecode     bytecode for the interpreter in the C runtime\n"
+#endif
 #ifndef DISABLE_PASCAL
                "  -pascal\n"
 #endif
@@ -67,6 +70,8 @@ static void print_arglist(int exit_code) {
                "  -vp[refix] string\n"
                "  -i[nclude] directory\n"
                "  -r[untime] path to runtime headers\n"
+               "  -among table|trie|packed  how C code matches among strings\n"
+               "  -profile      make C code count calls and among results\n"
                "  -p[arentclassname] fully qualified parent class name\n"
 #if !defined(DISABLE_JAVA) || !defined(DISABLE_CSHARP)
                "  -P[ackage] package name for stemmers\n"
@@ -90,9 +95,9 @@ static void check_lim(int i, int argc) {
     }
 }
 
-static FILE * get_output(symbol * b) {
+static FILE * open_output(symbol * b, const char * mode) {
     char * s = b_to_s(b);
-    FILE * output = fopen(s, "w");
+    FILE * output = fopen(s, mode);
     if (output == 0) {
         fprintf(stderr, "Can't open output %s\n", s);
         exit(1);
@@ -101,6 +106,10 @@ static FILE * get_output(symbol * b) {
     return output;
 }
 
+static FILE * get_output(symbol * b) {
+    return open_output(b, "w");
+}
+
 static int read_options(struct options * o, int argc, char * argv[]) {
     char * s;
     int i = 1;
@@ -121,6 +130,8 @@ static int read_options(struct options * o, int argc, char * argv[]) {
     o->parent_class_name = NULL;
     o->string_class = NULL;
     o->among_class = NULL;
+    o->among_style = AMONG_TABLE;
+    o->profile = false;
     o->package = NULL;
     o->go_snowball_runtime = DEFAULT_GO_SNOWBALL_RUNTIME;
     o->name = NULL;
@@ -193,6 +204,12 @@ static int read_options(struct options * o, int argc, char * argv[]) {
                 o->make_lang = LANG_CPLUSPLUS;
                 continue;
             }
+#ifndef DISABLE_BYTECODE
+            if (eq(s, "-bytecode")) {
+                o->make_lang = LANG_BYTECODE;
+                continue;
+            }
+#endif
 #ifndef DISABLE_PASCAL
             if (eq(s, "-pascal")) {
                 o->make_lang = LANG_PASCAL;
@@ -254,6 +271,25 @@ static int read_options(struct options * o, int argc, char * argv[]) {
                 o->runtime_path = argv[i++];
                 continue;
             }
+            if (eq(s, "-among")) {
+                check_lim(i, argc);
+                s = argv[i++];
+                if (eq(s, "table")) {
+                    o->among_style = AMONG_TABLE;
+                } else if (eq(s, "trie")) {
+                    o->among_style = AMONG_TRIE;
+                } else if (eq(s, "packed")) {
+                    o->among_style = AMONG_PACKED;
+                } else {
+                    fprintf(stderr, "unknown among style '%s'\n", s);
+                    print_arglist(1);
+                }
+                continue;
+            }
+            if (eq(s, "-profile")) {
+                o->profile = true;
+                continue;
+            }
             if (eq(s, "-u") || eq(s, "-utf8")) {
                 encoding_opt = s;
                 o->encoding = ENC_UTF8;
@@ -316,6 +352,7 @@ static int read_options(struct options * o, int argc, char * argv[]) {
     switch (o->make_lang) {
         case LANG_C:
         case LANG_CPLUSPLUS:
+        case LANG_BYTECODE:
             encoding_opt = NULL;
             break;
         case LANG_CSHARP:
@@ -379,6 +416,12 @@ static int read_options(struct options * o, int argc, char * argv[]) {
         if (o->externals_prefix) {
             fprintf(stderr, "warning: -ep/-eprefix only meaningful for C and C++\n");
         }
+        if (o->among_style != AMONG_TABLE) {
+            fprintf(stderr, "warning: -among only meaningful for C and C++\n");
+        }
+        if (o->profile) {
+            fprintf(stderr, "warning: -profile only meaningful for C and C++\n");
+        }
     }
     if (!o->externals_prefix) o->externals_prefix = "";
 
@@ -485,7 +528,15 @@ extern int main(int argc, char * argv[]) {
             *next_input_ptr = NULL;
             read_program(a);
             if (t->error_count > 0) exit(1);
-            if (o->syntax_tree) print_program(a);
+            if (o->syntax_tree) {
+                print_program(a);
+            } else {
+                /* With -profile, keep each routine separate so it has its own
+                 * counters. */
+                int profiling = o->profile && (o->make_lang == LANG_C ||
+                                               o->make_lang == LANG_CPLUSPLUS);
+                optimise_program(a, !profiling);
+            }
             close_tokeniser(t);
             if (!o->syntax_tree) {
                 struct generator * g;
@@ -581,6 +632,16 @@ extern int main(int argc, char * argv[]) {
                     fclose(o->output_src);
                 }
 #endif
+#ifndef DISABLE_BYTECODE
+                if (o->make_lang == LANG_BYTECODE) {
+                    symbol * b = add_s_to_b(0, s);
+                    b = add_s_to_b(b, ".sbc");
+                    o->output_src = open_output(b, "wb");
+                    lose_b(b);
+                    generate_program_bytecode(g);
+                    fclose(o->output_src);
+                }
+#endif
 #ifndef DISABLE_ADA
                 if (o->make_lang == LANG_ADA) {
                     symbol * b = add_s_to_b(0, s);
@@ -372,7 +372,7 @@ static void generate_AE(struct generator * g, struct node * p) {
             w(g, p->mode == m_forward ? "z->l" : "z->lb"); break;
         case c_len:
             if (g->options->encoding == ENC_UTF8) {
-                w(g, "len_utf8(z->p)");
+                w(g, "lenof_utf8(z, z->p)");
                 break;
             }
             /* FALLTHRU */
@@ -382,7 +382,7 @@ static void generate_AE(struct generator * g, struct node * p) {
         case c_lenof:
             if (g->options->encoding == ENC_UTF8) {
                 g->V[0] = p->name;
-                w(g, "len_utf8(~V0)");
+                w(g, "lenof_utf8(z, ~V0)");
                 break;
             }
             /* FALLTHRU */
@@ -732,20 +732,97 @@ static void generate_next(struct generator * g, struct node * p) {
               "~M~i~C", p);
 }
 
-static void generate_GO_grouping(struct generator * g, struct node * p, int is_goto, int complement) {
+/* Write the nibble tables for the runtime in_class_scan() functions etc to
+ * the declarations, if that hasn't been done yet. */
+static void generate_grouping_scan_table(struct generator * g, struct grouping * q) {
+
+    struct str * s = g->outbuf;
+    symbol * b = q->b;
+    byte t[32];
+    int i;
+    if (q->scan_written) return;
+    q->scan_written = true;
+
+    for (i = 0; i < 32; i++) t[i] = 0;
+    for (i = 0; i < SIZE(b); i++) {
+        int ch = b[i];
+        /* For UTF-8 only ASCII characters are scanned for this way. */
+        if (g->options->encoding == ENC_UTF8 && ch >= 0x80) continue;
+        t[(ch & 0x80) >> 3 | (ch & 0xF)] |= 1 << (ch >> 4 & 7);
+    }
+
+    g->outbuf = g->declarations;
+    g->V[0] = q->name;
+    w(g, "static const unsigned char ~V0_scan[32] = { ");
+    for (i = 0; i < 32; i++) {
+        write_int(g, t[i]);
+        if (i < 31) w(g, ", ");
+    }
+    w(g, " };~N~N");
+    g->outbuf = s;
+}
+
+/* Scanning is worthwhile forwards over a grouping with ASCII characters
+ * (or any grouping for a single byte encoding). */
+static int use_grouping_scan(struct generator * g, struct node * p) {
 
     struct grouping * q = p->name->grouping;
-    g->S[0] = p->mode == m_forward ? "" : "_b";
-    g->S[1] = complement ? "in" : "out";
-    g->S[2] = g->options->encoding == ENC_UTF8 ? "_U" : "";
+    if (p->mode != m_forward) return false;
+    switch (g->options->encoding) {
+        case ENC_SINGLEBYTE:
+            return true;
+        case ENC_UTF8:
+            return q->smallest_ch < 0x80;
+        default:
+            return false;
+    }
+}
+
+/* Write a call to the runtime function testing for grouping p->name (or
+ * for characters not in it if kind is "out"). */
+static void write_grouping_call(struct generator * g, struct node * p, const char * kind, int repeat) {
+
+    struct grouping * q = p->name->grouping;
+    g->S[0] = kind;
+    g->S[1] = p->mode == m_forward ? "" : "_b";
     g->V[0] = p->name;
     g->I[0] = q->smallest_ch;
     g->I[1] = q->largest_ch;
+    g->I[2] = repeat;
+    if (repeat && use_grouping_scan(g, p)) {
+        generate_grouping_scan_table(g, q);
+        if (g->options->encoding == ENC_UTF8) {
+            w(g, "~S0_class_scan_U(z, ~V0_class, ~V0_scan, ~V0, ~I0, ~I1)");
+        } else {
+            w(g, "~S0_class_scan(z, ~V0_class, ~V0_scan)");
+        }
+        return;
+    }
+    switch (g->options->encoding) {
+        case ENC_SINGLEBYTE:
+            w(g, "~S0_class~S1(z, ~V0_class, ~I2)");
+            break;
+        case ENC_UTF8:
+            w(g, "~S0_class~S1_U(z, ~V0_class, ~V0, ~I0, ~I1, ~I2)");
+            break;
+        default:
+            w(g, "~S0_grouping~S1(z, ~V0, ~I0, ~I1, ~I2)");
+            break;
+    }
+}
+
+static void generate_GO_grouping(struct generator * g, struct node * p, int is_goto, int complement) {
+
+    const char * kind = complement ? "in" : "out";
     if (is_goto) {
-        writef(g, "~Mif (~S1_grouping~S0~S2(z, ~V0, ~I0, ~I1, 1) < 0) ~f~C", p);
+        w(g, "~Mif (");
+        write_grouping_call(g, p, kind, 1);
+        writef(g, " < 0) ~f~C", p);
     } else {
         writef(g, "~{~C"
-              "~Mint ret = ~S1_grouping~S0~S2(z, ~V0, ~I0, ~I1, 1);~N"
+              "~Mint ret = ", p);
+        write_grouping_call(g, p, kind, 1);
+        writef(g, ";~N"
               "~Mif (ret < 0) ~f~N", p);
         if (p->mode == m_forward)
             w(g, "~Mz->c += ret;~N");
@@ -850,6 +927,17 @@ static void generate_repeat_or_atleast(struct generator * g, struct node * p, in
 }
 
 static void generate_repeat(struct generator * g, struct node * p) {
+    if (p->among) {
+        /* A loop of single character substitutions (see
+         * mark_translations()). */
+        g->I[0] = p->among->number;
+        g->S[0] = p->mode == m_forward ? "" : "_b";
+        g->S[1] = g->options->encoding == ENC_UTF8 ? "_U" : "";
+        writef(g, "~{int ret = translate~S0~S1(z, &a_~I0_translation);~C", p);
+        writef(g, "~Mif (ret < 0) return ret;~N"
+              "~}", p);
+        return;
+    }
     generate_repeat_or_atleast(g, p, false);
 }
 
@@ -891,7 +979,7 @@ static void generate_hop(struct generator * g, struct node * p) {
     if (g->options->encoding == ENC_UTF8) {
         g->S[0] = p->mode == m_forward ? "" : "_b";
         g->S[1] = p->mode == m_forward ? "z->l" : "z->lb";
-        w(g, "~{int ret = skip~S0_utf8(z->p, z->c, ~S1, ");
+        w(g, "~{int ret = hop~S0_utf8(z, z->c, ~S1, ");
         generate_AE(g, p->AE);
         writef(g, ");~C", p);
         writef(g, "~Mif (ret < 0) ~f~N", p);
@@ -1125,14 +1213,9 @@ static void generate_call(struct generator * g, struct node * p) {
 
 static void generate_grouping(struct generator * g, struct node * p, int complement) {
 
-    struct grouping * q = p->name->grouping;
-    g->S[0] = p->mode == m_forward ? "" : "_b";
-    g->S[1] = complement ? "out" : "in";
-    g->S[2] = g->options->encoding == ENC_UTF8 ? "_U" : "";
-    g->V[0] = p->name;
-    g->I[0] = q->smallest_ch;
-    g->I[1] = q->largest_ch;
-    writef(g, "~Mif (~S1_grouping~S0~S2(z, ~V0, ~I0, ~I1, 0)) ~f~C", p);
+    w(g, "~Mif (");
+    write_grouping_call(g, p, complement ? "out" : "in", 0);
+    writef(g, ") ~f~C", p);
 }
 
 static void generate_namedstring(struct generator * g, struct node * p) {
@@ -1171,6 +1254,13 @@ static void generate_literalstring(struct generator * g, struct node * p) {
     }
 }
 
+/* The index of routine or external q in p_routines[] (see
+ * generate_profile_tables()). */
+static int profile_index(struct generator * g, struct name * q) {
+    if (q->type == t_routine) return q->count;
+    return g->analyser->name_count[t_routine] + q->count;
+}
+
 static void generate_define(struct generator * g, struct node * p) {
     struct name * q = p->name;
     g->next_label = 0;
@@ -1178,7 +1268,13 @@ static void generate_define(struct generator * g, struct node * p) {
     g->S[0] = q->type == t_routine ? "static" : "extern";
     g->V[0] = q;
 
-    w(g, "~N~S0 int ~V0(struct SN_env * z) {");
+    if (g->options->profile) {
+        /* The definition goes in p_<name>(), and is called by a wrapper
+         * which counts the calls (see the end of this function). */
+        w(g, "~Nstatic int p_~V0(struct SN_env * z) {");
+    } else {
+        w(g, "~N~S0 int ~V0(struct SN_env * z) {");
+    }
     if (g->options->comments) {
         write_string(g, p->mode == m_forward ? " /* forwardmode */" : " /* backwardmode */");
     }
@@ -1190,133 +1286,454 @@ static void generate_define(struct generator * g, struct node * p) {
     g->keep_count = 0;
     generate(g, p->left);
     w(g, "~Mreturn 1;~N~}");
+    if (g->options->profile) {
+        g->S[0] = q->type == t_routine ? "static" : "extern";
+        g->V[0] = q;
+        g->I[0] = profile_index(g, q);
+        w(g, "~N~S0 int ~V0(struct SN_env * z) {~N~+"
+             "~MSN_cycles start = SN_profile_clock();~N"
+             "~Mreturn SN_profile_routine(p_routines + ~I0, p_~V0(z), start);~N"
+             "~}");
+    }
 }
 
-static void generate_substring(struct generator * g, struct node * p) {
+/* The symbol at the given depth into among string v - counting from the end
+ * of the string in backward mode. */
+static int trie_ch(struct amongvec * v, int depth, int backward) {
+    return backward ? v->b[v->size - 1 - depth] : v->b[depth];
+}
+
+/* Write code to match the among strings x->b[idx[0]], ..., x->b[idx[n - 1]],
+ * which all share their first (or in backward mode, last) depth symbols.
+ * On entry z->p has at least depth symbols left to match, and the code sets
+ * i to the index of the longest matching string.  It's inside a switch or
+ * loop so that "break" abandons the search.
+ */
+static void generate_among_trie_node(struct generator * g, struct among * x,
+                                     int * idx, int n, int depth,
+                                     int backward) {
+    struct amongvec * v = x->b;
+    int i, j;
+
+    /* A string which ends here - there can only be one. */
+    for (i = 0; i < n; i++) {
+        if (v[idx[i]].size == depth) {
+            int t = idx[i];
+            idx[i] = idx[0];
+            idx[0] = t;
+            g->I[0] = t;
+            w(g, "~Mi = ~I0;~N");
+            idx++;
+            n--;
+            break;
+        }
+    }
+    if (n == 0) return;
+
+    /* Group the longer strings by their next symbol. */
+    for (i = 0; i < n; i = j) {
+        int ch = trie_ch(&v[idx[i]], depth, backward);
+        for (j = i + 1; j < n; j++) {
+            int k;
+            for (k = j; k < n; k++) {
+                if (trie_ch(&v[idx[k]], depth, backward) == ch) break;
+            }
+            if (k == n) break;
+            if (k != j) {
+                int t = idx[k];
+                idx[k] = idx[j];
+                idx[j] = t;
+            }
+        }
+    }
+
+    g->I[0] = depth;
+    w(g, "~Mif (n <= ~I0) break;~N");
+    g->I[0] = backward ? -(depth + 1) : depth;
+    if (trie_ch(&v[idx[0]], depth, backward) ==
+        trie_ch(&v[idx[n - 1]], depth, backward)) {
+        /* Only one possible next symbol. */
+        g->I[1] = trie_ch(&v[idx[0]], depth, backward);
+        w(g, "~Mif (q[~I0] != ~c1) break;~N");
+        generate_among_trie_node(g, x, idx, n, depth + 1, backward);
+        return;
+    }
+
+    w(g, "~Mswitch (q[~I0]) {~N~+");
+    for (i = 0; i < n; i = j) {
+        int ch = trie_ch(&v[idx[i]], depth, backward);
+        for (j = i + 1; j < n; j++) {
+            if (trie_ch(&v[idx[j]], depth, backward) != ch) break;
+        }
+        g->I[1] = ch;
+        w(g, "~Mcase ~c1:~N~+");
+        generate_among_trie_node(g, x, idx + i, j - i, depth + 1, backward);
+        w(g, "~Mbreak;~N~-");
+    }
+    w(g, "~}");
+}
+
+/* Write a function which does the same as find_among() (or find_among_b())
+ * on among x's table, but by following a trie of its strings written out as
+ * nested switch statements.  This avoids the binary search, and the
+ * comparisons of symbols already known to match.
+ */
+static void generate_among_trie(struct generator * g, struct among * x,
+                                int backward) {
+    struct str * saved_outbuf = g->outbuf;
+    int saved_margin = g->margin;
+    int saved_line_count = g->line_count;
+    int * idx = (int *) malloc(x->literalstring_count * sizeof(int));
+    int i;
+
+    if (idx == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (i = 0; i < x->literalstring_count; i++) idx[i] = i;
+
+    g->outbuf = g->declarations;
+    g->margin = 0;
+    g->I[0] = x->number;
+    g->S[0] = backward ? "_b" : "";
+    w(g, "~Nstatic int find_among~S0_~I0(struct SN_env * z) {~N~+");
+    if (backward) {
+        w(g, "~Mconst symbol * q = z->p + z->c;~N"
+             "~Mint n = z->c - z->lb;~N");
+    } else {
+        w(g, "~Mconst symbol * q = z->p + z->c;~N"
+             "~Mint n = z->l - z->c;~N");
+    }
+    w(g, "~Mint c = z->c;~N"
+         "~Mint i = -1;~N"
+         "~Mdo {~N~+");
+    generate_among_trie_node(g, x, idx, x->literalstring_count, 0, backward);
+    w(g, "~-~M} while (0);~N");
+
+    g->I[0] = x->number;
+    g->S[0] = backward ? "-" : "+";
+    if (x->function_count == 0) {
+        w(g, "~Mif (i < 0) return 0;~N"
+             "~Mz->c = c ~S0 a_~I0[i].s_size;~N"
+             "~Mreturn a_~I0[i].result;~N");
+    } else {
+        /* If a string's routine fails, try the longest shorter string which
+         * matched, as find_among() does. */
+        w(g, "~Mwhile (i >= 0) {~N~+"
+             "~Mconst struct among * w = a_~I0 + i;~N"
+             "~Mz->c = c ~S0 w->s_size;~N"
+             "~Mif (a_~I0_functions[i] == 0) return w->result;~N"
+             "~M{   int res = a_~I0_functions[i](z);~N~+"
+             "~Mz->c = c ~S0 w->s_size;~N"
+             "~Mif (res) return w->result;~N"
+             "~-~M}~N"
+             "~Mi = w->substring_i;~N"
+             "~-~M}~N"
+             "~Mreturn 0;~N");
+    }
+    w(g, "~-~M}~N");
 
+    free(idx);
+    g->outbuf = saved_outbuf;
+    g->margin = saved_margin;
+    g->line_count = saved_line_count;
+}
+
+/* Write the tables for find_among_b_packed() for among x, if all its strings
+ * fit in a 32 symbol lane.  Returns 0 if they don't.
+ */
+static int generate_among_packed(struct generator * g, struct among * x) {
+    struct str * saved_outbuf = g->outbuf;
+    int saved_line_count = g->line_count;
+    struct amongvec * v = x->b;
+    int n = x->literalstring_count;
+    int * lane = (int *) malloc(n * sizeof(int));
+    int n_lanes = 0;
+    int empty = -1;
+    int max_size = 0;
+    int min_ch = 255, max_ch = 0;
+    int width, i, j, ch;
+
+    if (lane == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (i = 0; i < n; i++) {
+        if (v[i].size > max_size) max_size = v[i].size;
+    }
+    if (max_size > 32) {
+        free(lane);
+        return 0;
+    }
+    width = max_size > 16 ? 32 : 16;
+
+    /* Order the lanes by last symbol, and longest first for each. */
+    for (i = 0; i < n; i++) {
+        int size = v[i].size;
+        if (size == 0) {
+            empty = i;
+            continue;
+        }
+        ch = v[i].b[size - 1];
+        if (ch < min_ch) min_ch = ch;
+        if (ch > max_ch) max_ch = ch;
+        for (j = n_lanes; j > 0; j--) {
+            struct amongvec * prev = &v[lane[j - 1]];
+            int prev_ch = prev->b[prev->size - 1];
+            if (prev_ch < ch || (prev_ch == ch && prev->size >= size)) break;
+            lane[j] = lane[j - 1];
+        }
+        lane[j] = i;
+        n_lanes++;
+    }
+    if (n_lanes == 0) min_ch = max_ch = 0;
+
+    g->outbuf = g->declarations;
+    g->I[0] = x->number;
+    w(g, "~Nstatic const unsigned short a_~I0_bucket[] = {");
+    j = 0;
+    for (ch = min_ch; ch <= max_ch + 1; ch++) {
+        struct amongvec * a;
+        while (j < n_lanes && (a = &v[lane[j]], a->b[a->size - 1] < ch)) j++;
+        g->I[1] = j;
+        w(g, ch % 16 == min_ch % 16 ? "~N    ~I1" : " ~I1");
+        if (ch <= max_ch) write_char(g, ',');
+    }
+    w(g, "~N};~N");
+
+    w(g, "static const symbol a_~I0_lanes[] = {~N");
+    for (i = 0; i < n_lanes; i++) {
+        struct amongvec * a = &v[lane[i]];
+        w(g, "   ");
+        for (j = 0; j < width; j++) {
+            int k = j - (width - a->size);
+            write_char(g, ' ');
+            if (k < 0) {
+                write_char(g, '0');
+            } else {
+                wlitch(g, a->b[k]);
+            }
+            if (i < n_lanes - 1 || j < width - 1) write_char(g, ',');
+        }
+        w(g, "~N");
+    }
+    if (n_lanes == 0) w(g, "    0~N");
+    w(g, "};~N");
+
+    w(g, "static const unsigned short a_~I0_index[] = {");
+    for (i = 0; i < n_lanes; i++) {
+        g->I[1] = lane[i];
+        w(g, i % 16 == 0 ? "~N    ~I1" : " ~I1");
+        if (i < n_lanes - 1) write_char(g, ',');
+    }
+    if (n_lanes == 0) w(g, "~N    0");
+    w(g, "~N};~N");
+
+    g->I[1] = width;
+    g->I[2] = min_ch;
+    g->I[3] = max_ch;
+    g->I[4] = empty;
+    w(g, "static const struct among_packed a_~I0_packed = {~N"
+         "    ~I1, ~I2, ~I3, ~I4, a_~I0_bucket, a_~I0_lanes, a_~I0_index~N"
+         "};~N");
+
+    free(lane);
+    g->outbuf = saved_outbuf;
+    g->line_count = saved_line_count;
+    return 1;
+}
+
+static void write_find_among(struct generator * g, struct node * p) {
     struct among * x = p->among;
-    int block = -1;
+    g->S[0] = p->mode == m_forward ? "" : "_b";
+    g->I[0] = x->number;
+    g->I[1] = x->literalstring_count;
+    if (x->hashed) {
+        w(g, "find_among_hash~S0(z, &a_~I0_table, &a_~I0_hash)");
+    } else if (g->options->among_style == AMONG_TRIE) {
+        w(g, "find_among~S0_~I0(z)");
+    } else if (x->packed) {
+        w(g, "find_among_b_packed(z, &a_~I0_table, &a_~I0_packed)");
+    } else {
+        w(g, "find_among~S0(z, &a_~I0_table)");
+    }
+}
+
+/* Write " || test" where test is true if subject (a C expression for a
+ * symbol) isn't one of the n symbols cases[0] < ... < cases[n - 1], or
+ * nothing if there's no cheap test.  Symbols below 0x100 which don't fall
+ * in a single block of 32 are looked up in a 256 bit table, which is
+ * written out as a_<among number>_filter<filter>. */
+static void write_among_filter(struct generator * g, struct node * p,
+                               const char * subject, const int * cases, int n,
+                               int filter) {
+    int block = cases[0] >> 5;
     unsigned int bitmap = 0;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        if (cases[i] >> 5 != block) block = -1;
+        bitmap |= 1u << (cases[i] & 0x1f);
+    }
+    g->S[1] = subject;
+    if (n == 1) {
+        g->I[4] = cases[0];
+        writef(g, " || ~S1 != ~I4", p);
+    } else if (n == 2) {
+        g->I[4] = cases[0];
+        g->I[5] = cases[1];
+        writef(g, " || (~S1 != ~I4 && ~S1 != ~I5)", p);
+    } else if (block != -1) {
+        g->I[2] = block;
+        g->I[3] = bitmap;
+        writef(g, " || ~S1 >> 5 != ~I2 || !((~I3 >> (~S1 & 0x1f)) & 1)", p);
+    } else if (cases[n - 1] < 0x100) {
+        struct str * saved_outbuf = g->outbuf;
+        int saved_line_count = g->line_count;
+        byte t[32];
+        for (i = 0; i < 32; i++) t[i] = 0;
+        for (i = 0; i < n; i++) t[cases[i] >> 3] |= 1 << (cases[i] & 7);
+
+        g->outbuf = g->declarations;
+        g->I[5] = filter;
+        w(g, "~Nstatic const unsigned char a_~I0_filter~I5[32] = {");
+        for (i = 0; i < 32; i++) {
+            w(g, i % 16 == 0 ? "~N    0x" : " 0x");
+            write_hex(g, t[i]);
+            if (i < 31) write_char(g, ',');
+        }
+        w(g, "~N};~N");
+        g->outbuf = saved_outbuf;
+        g->line_count = saved_line_count;
+
+        if (g->options->encoding == ENC_WIDECHARS) {
+            writef(g, " || ~S1 >= 0x100", p);
+        }
+        writef(g, " || !((a_~I0_filter~I5[~S1 >> 3] >> (~S1 & 7)) & 1)", p);
+    }
+}
+
+static void generate_substring(struct generator * g, struct node * p) {
+
+    struct among * x = p->among;
     struct amongvec * among_cases = x->b;
     int c;
     int empty_case = -1;
-    int n_cases = 0;
-    symbol cases[2];
+    int * cases = (int *) malloc(x->literalstring_count * sizeof(int));
     int shortest_size = INT_MAX;
     int shown_comment = 0;
+    int filter;
 
+    if (cases == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
     g->S[0] = p->mode == m_forward ? "" : "_b";
     g->I[0] = x->number;
     g->I[1] = x->literalstring_count;
 
-    /* In forward mode with non-ASCII UTF-8 characters, the first byte
-     * of the string will often be the same, so instead look at the last
-     * common byte position.
+    /* Before calling find_among() etc, check there are enough symbols left
+     * for the shortest (non-empty) string, and that the symbols at one or
+     * two positions could be those of a string there.
      *
-     * In backward mode, we can't match if there are fewer characters before
-     * the current position than the minimum length.
+     * In backward mode, these are the last and penultimate symbols.  In
+     * forward mode with non-ASCII UTF-8 characters, the first byte of the
+     * string will often be the same, so instead look at the last common
+     * byte position.
      */
     for (c = 0; c < x->literalstring_count; ++c) {
         int size = among_cases[c].size;
-        if (size != 0 && size < shortest_size) {
+        if (size == 0) {
+            empty_case = c;
+        } else if (size < shortest_size) {
             shortest_size = size;
         }
     }
 
-    for (c = 0; c < x->literalstring_count; ++c) {
-        symbol ch;
-        if (among_cases[c].size == 0) {
-            empty_case = c;
-            continue;
-        }
-        if (p->mode == m_forward) {
-            ch = among_cases[c].b[shortest_size - 1];
+    if (p->mode == m_forward) {
+        g->I[4] = shortest_size - 1;
+        if (shortest_size == 1) {
+            writef(g, "~Mif (z->c >= z->l", p);
         } else {
-            ch = among_cases[c].b[among_cases[c].size - 1];
+            writef(g, "~Mif (z->c + ~I4 >= z->l", p);
         }
-        if (n_cases == 0) {
-            block = ch >> 5;
-        } else if (ch >> 5 != block) {
-            block = -1;
-            if (n_cases > 2) break;
-        }
-        if (block == -1) {
-            if (n_cases > 0 && ch == cases[0]) continue;
-            if (n_cases < 2) {
-                cases[n_cases++] = ch;
-            } else if (ch != cases[1]) {
-                ++n_cases;
-                break;
-            }
+    } else {
+        g->I[4] = shortest_size - 1;
+        if (shortest_size == 1) {
+            writef(g, "~Mif (z->c <= z->lb", p);
         } else {
-            if ((bitmap & (1u << (ch & 0x1f))) == 0) {
-                bitmap |= 1u << (ch & 0x1f);
-                if (n_cases < 2)
-                    cases[n_cases] = ch;
-                ++n_cases;
-            }
+            writef(g, "~Mif (z->c - ~I4 <= z->lb", p);
         }
     }
 
-    if (block != -1 || n_cases <= 2) {
+    for (filter = 0; filter < (p->mode == m_forward ? 1 : 2); filter++) {
         char buf[64];
-        g->I[2] = block;
-        g->I[3] = bitmap;
-        g->I[4] = shortest_size - 1;
-        if (p->mode == m_forward) {
-            sprintf(buf, "z->p[z->c + %d]", shortest_size - 1);
-            g->S[1] = buf;
-            if (shortest_size == 1) {
-                writef(g, "~Mif (z->c >= z->l", p);
-            } else {
-                writef(g, "~Mif (z->c + ~I4 >= z->l", p);
-            }
-        } else {
-            g->S[1] = "z->p[z->c - 1]";
-            if (shortest_size == 1) {
-                writef(g, "~Mif (z->c <= z->lb", p);
+        int n_cases = 0;
+        if (shortest_size == INT_MAX || filter >= shortest_size) break;
+        for (c = 0; c < x->literalstring_count; ++c) {
+            struct amongvec * v = &among_cases[c];
+            int ch, i, j;
+            if (v->size == 0) continue;
+            if (p->mode == m_forward) {
+                ch = v->b[shortest_size - 1];
             } else {
-                writef(g, "~Mif (z->c - ~I4 <= z->lb", p);
+                ch = v->b[v->size - 1 - filter];
             }
+            for (i = 0; i < n_cases && cases[i] < ch; i++) { }
+            if (i < n_cases && cases[i] == ch) continue;
+            for (j = n_cases; j > i; j--) cases[j] = cases[j - 1];
+            cases[i] = ch;
+            n_cases++;
         }
-        if (n_cases == 0) {
-            /* We get this for the degenerate case: among ( '' )
-             * This doesn't seem to be a useful construct, but it is
-             * syntactically valid.
-             */
-        } else if (n_cases == 1) {
-            g->I[4] = cases[0];
-            writef(g, " || ~S1 != ~I4", p);
-        } else if (n_cases == 2) {
-            g->I[4] = cases[0];
-            g->I[5] = cases[1];
-            writef(g, " || (~S1 != ~I4 && ~S1 != ~I5)", p);
-        } else {
-            writef(g, " || ~S1 >> 5 != ~I2 || !((~I3 >> (~S1 & 0x1f)) & 1)", p);
-        }
-        write_string(g, ") ");
-        if (empty_case != -1) {
-            /* If the among includes the empty string, it can never fail
-             * so not matching the bitmap means we match the empty string.
-             */
-            g->I[4] = among_cases[empty_case].result;
-            writef(g, "among_var = ~I4; else~C", p);
+        if (p->mode == m_forward) {
+            sprintf(buf, "z->p[z->c + %d]", shortest_size - 1);
         } else {
-            writef(g, "~f~C", p);
+            sprintf(buf, "z->p[z->c - %d]", filter + 1);
         }
-        shown_comment = 1;
+        write_among_filter(g, p, buf, cases, n_cases, filter);
+    }
+    free(cases);
+
+    write_string(g, ") ");
+    if (empty_case != -1) {
+        /* If the among includes the empty string, it can never fail
+         * so not matching the filter means we match the empty string.
+         */
+        g->I[4] = among_cases[empty_case].result;
+        writef(g, "among_var = ~I4; else~C", p);
+    } else if (g->options->profile) {
+        /* Count the miss before failing. */
+        writef(g, "among_var = 0; else~C", p);
     } else {
-#ifdef OPTIMISATION_WARNINGS
-        printf("Couldn't shortcut among %d\n", x->number);
-#endif
+        writef(g, "~f~C", p);
+    }
+    shown_comment = 1;
+
+    if (x->hashed) {
+        /* Looked up by find_among_hash(). */
+    } else if (g->options->among_style == AMONG_TRIE) {
+        generate_among_trie(g, x, p->mode == m_backward);
+    } else if (g->options->among_style == AMONG_PACKED &&
+               p->mode == m_backward &&
+               g->options->encoding != ENC_WIDECHARS) {
+        /* The lanes are compared a byte at a time. */
+        x->packed = generate_among_packed(g, x);
     }
 
     if (!x->amongvar_needed) {
-        writef(g, "~Mif (!(find_among~S0(z, a_~I0, ~I1))) ~f", p);
+        w(g, "~Mif (!(");
+        write_find_among(g, p);
+        writef(g, ")) ~f", p);
         writef(g, shown_comment ? "~N" : "~C", p);
     } else {
-        writef(g, "~Mamong_var = find_among~S0(z, a_~I0, ~I1);", p);
+        w(g, "~Mamong_var = ");
+        write_find_among(g, p);
+        w(g, ";");
         writef(g, shown_comment ? "~N" : "~C", p);
+        if (g->options->profile) {
+            g->I[0] = x->number;
+            w(g, "~MSN_profile_among(p_amongs + ~I0, among_var);~N");
+        }
         writef(g, "~Mif (!(among_var)) ~f~N", p);
     }
 }
@@ -1490,56 +1907,539 @@ static void generate_routine_headers(struct generator * g) {
     }
 }
 
-static void generate_among_table(struct generator * g, struct among * x) {
+/* Put the strings of among x into a single pool, setting offset[i] to the
+ * offset of string i.  Each string is looked for in the pool before it's
+ * added, longest first, and it's added overlapping the end of the pool as
+ * far as possible.  Returns the pool, whose size is set in *pool_size. */
+extern symbol * among_string_pool(struct among * x, int * offset, int * pool_size) {
+    struct amongvec * v = x->b;
+    int n = x->literalstring_count;
+    int * order = (int *) malloc(n * sizeof(int));
+    symbol * pool;
+    int size = 0;
+    int i, j;
+
+    for (i = 0; i < n; i++) size += v[i].size;
+    pool = (symbol *) malloc((size + 1) * sizeof(symbol));
+    if (order == NULL || pool == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (i = 0; i < n; i++) {
+        for (j = i; j > 0 && v[order[j - 1]].size < v[i].size; j--) {
+            order[j] = order[j - 1];
+        }
+        order[j] = i;
+    }
 
+    size = 0;
+    for (i = 0; i < n; i++) {
+        struct amongvec * a = &v[order[i]];
+        int k;
+        for (k = 0; k + a->size <= size; k++) {
+            if (memcmp(pool + k, a->b, a->size * sizeof(symbol)) == 0) break;
+        }
+        if (k + a->size > size) {
+            for (k = size - a->size + 1; k < size; k++) {
+                if (k >= 0 &&
+                    memcmp(pool + k, a->b, (size - k) * sizeof(symbol)) == 0) break;
+            }
+            memmove(pool + k, a->b, a->size * sizeof(symbol));
+            size = k + a->size;
+        }
+        offset[order[i]] = k;
+    }
+    free(order);
+    *pool_size = size;
+    return pool;
+}
+
+/* True if among x is only used as "substring atlimit among(...)", so it only
+ * matches if one of its strings is the whole of the rest of the string.
+ * With "]" between substring and atlimit, a shorter string which matches
+ * sets the end of the slice even though atlimit then fails, which a hash
+ * lookup wouldn't do. */
+static int among_matches_whole(struct among * x) {
+    struct node * p = x->substring;
+    if (p == NULL || x->function_count > 0) return false;
+    p = p->right;
+    return p && p->type == c_atlimit;
+}
+
+/* The runtime's hash of a string (see find_among_hash()). */
+static unsigned int among_hash(const symbol * s, int n, unsigned int d) {
+    unsigned int h = 2166136261U;
+    int i;
+    for (i = 0; i < n; i++) {
+        h = (h ^ s[i]) * 16777619U;
+    }
+    h ^= d;
+    h ^= h >> 16;
+    h *= 0x85EBCA6BU;
+    h ^= h >> 13;
+    return h;
+}
+
+/* Write a minimal perfect hash of the strings of among x for
+ * find_among_hash(), if one can be found and none of the strings has more
+ * than 30 symbols.  Returns 0 if not.
+ *
+ * Strings are put into buckets by their hash, and then for each bucket,
+ * largest first, a displacement is searched for which rehashes all its
+ * strings to distinct free slots. */
+static int generate_among_hash(struct generator * g, struct among * x) {
     struct amongvec * v = x->b;
+    int n = x->literalstring_count;
+    int buckets = n / 2 + 1;
+    int * bucket = (int *) malloc(n * sizeof(int));
+    int * order = (int *) malloc(buckets * sizeof(int));
+    int * size = (int *) calloc(buckets, sizeof(int));
+    int * displacement = (int *) calloc(buckets, sizeof(int));
+    int * slot = (int *) malloc(n * sizeof(int));
+    unsigned int lengths = 0;
+    int ok = n > 0;
+    int i, j, k;
+
+    if (bucket == NULL || order == NULL || size == NULL ||
+        displacement == NULL || slot == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (i = 0; i < n; i++) {
+        if (v[i].size > 30) ok = false;
+        lengths |= 1U << (v[i].size & 31);
+        bucket[i] = among_hash(v[i].b, v[i].size, 0) % buckets;
+        size[bucket[i]]++;
+        slot[i] = -1;
+    }
+    for (i = 0; i < buckets; i++) {
+        for (j = i; j > 0 && size[order[j - 1]] < size[i]; j--) {
+            order[j] = order[j - 1];
+        }
+        order[j] = i;
+    }
+    for (k = 0; ok && k < buckets && size[order[k]] > 0; k++) {
+        int b = order[k];
+        int d;
+        for (d = 1; d <= 0xFFFF; d++) {
+            for (i = 0; i < n; i++) {
+                if (bucket[i] != b) continue;
+                slot[i] = among_hash(v[i].b, v[i].size, d) % n;
+                for (j = 0; j < n; j++) {
+                    if (j != i && slot[j] == slot[i]) break;
+                }
+                if (j < n) break;
+            }
+            if (i == n) break;
+            for (i = 0; i < n; i++) {
+                if (bucket[i] == b) slot[i] = -1;
+            }
+        }
+        if (d > 0xFFFF) ok = false;
+        displacement[b] = d;
+    }
 
-    g->I[0] = x->number;
-    {
-        int i;
-        for (i = 0; i < x->literalstring_count; i++) {
+    if (ok) {
+        g->I[0] = x->number;
+        w(g, "static const unsigned short a_~I0_displacement[] = {");
+        for (i = 0; i < buckets; i++) {
+            g->I[1] = displacement[i];
+            w(g, i % 8 == 0 ? "~N    ~I1" : " ~I1");
+            if (i < buckets - 1) write_char(g, ',');
+        }
+        w(g, "~N};~N");
+        w(g, "static const short a_~I0_slot[] = {");
+        for (j = 0; j < n; j++) {
+            for (i = 0; slot[i] != j; i++) { }
             g->I[1] = i;
-            g->I[2] = v->size;
-            g->L[0] = v->b;
-            if (v->size)
-                w(g, "static const symbol s_~I0_~I1[~I2] = ~A0;~N");
-            v++;
+            w(g, j % 8 == 0 ? "~N    ~I1" : " ~I1");
+            if (j < n - 1) write_char(g, ',');
         }
+        w(g, "~N};~N");
+        g->I[1] = (int)lengths;
+        g->I[2] = buckets;
+        w(g, "static const struct among_hash a_~I0_hash = {~N"
+             "    ~I1, ~I2, a_~I0_displacement, a_~I0_slot~N"
+             "};~N~N");
     }
 
-    g->I[1] = x->literalstring_count;
-    w(g, "~N~Mstatic const struct among a_~I0[~I1] =~N{~N");
+    free(bucket);
+    free(order);
+    free(size);
+    free(displacement);
+    free(slot);
+    return ok;
+}
+
+/* Return the character which is the whole of b, or -1 if b isn't a single
+ * character. */
+static int single_character(struct generator * g, const symbol * b, int size) {
+    int ch, i;
+    if (g->options->encoding != ENC_UTF8) return size == 1 ? b[0] : -1;
+    if (size == 0 || (b[0] >= 0x80 && b[0] < 0xC0) || b[0] >= 0xF0) return -1;
+    if (get_utf8(b, &ch) != size) return -1;
+    for (i = 1; i < size; i++) {
+        if (b[i] < 0x80 || b[i] >= 0xC0) return -1;
+    }
+    return ch;
+}
+
+/* If command p is just "next" return true. */
+static int is_just_next(struct node * p) {
+    if (p && p->type == c_bra && p->right == NULL) p = p->left;
+    return p && p->type == c_next && p->right == NULL;
+}
+
+/* If repeat p is one of
+ *
+ *     repeat ( [substring] among ( ... '' (next) ) )
+ *     repeat ( ( [substring] among ( ... ) ) or next )
+ *
+ * in either direction, where every other string of the among is a single
+ * character, replaced by a literal string, deleted or left alone, return
+ * the among.  Such a loop is done in a single pass by translate() in the
+ * runtime.
+ */
+static struct among * translation_among(struct generator * g, struct node * p) {
+    struct node * q = p->left;
+    struct node * among_node;
+    struct among * x;
+    struct amongvec * v;
+    int with_empty;
+    int empty_count = 0;
+    int pages = 0;
+    int i, j;
+
+    if (q == NULL || q->right != NULL) return NULL;
+    if (q->type == c_or) {
+        q = q->left;
+        if (q->type != c_bra || !is_just_next(q->right)) return NULL;
+        with_empty = false;
+    } else if (q->type == c_bra) {
+        with_empty = true;
+    } else {
+        return NULL;
+    }
+    q = q->left;
+    if (q == NULL || q->type != c_leftslice) return NULL;
+    q = q->right;
+    if (q == NULL || q->type != c_substring) return NULL;
+    x = q->among;
+    q = q->right;
+    if (q == NULL || q->type != c_rightslice) return NULL;
+    among_node = q->right;
+    if (among_node == NULL || among_node->type != c_among ||
+        among_node->right != NULL || among_node->among != x) return NULL;
+    if (x->starter != NULL || x->function_count > 0) return NULL;
 
     v = x->b;
-    {
-        int i;
-        for (i = 0; i < x->literalstring_count; i++) {
-            g->I[1] = i;
-            g->I[2] = v->size;
-            g->I[3] = v->i;
-            g->I[4] = v->result;
-            g->S[0] = i < x->literalstring_count - 1 ? "," : "";
-
-            if (g->options->comments) {
-                w(g, "/*~J1 */ ");
+    for (i = 0; i < x->literalstring_count; i++) {
+        struct node * c = v[i].action;
+        int ch;
+        if (v[i].size == 0) {
+            if (!with_empty || !is_just_next(c)) return NULL;
+            empty_count++;
+            continue;
+        }
+        ch = single_character(g, v[i].b, v[i].size);
+        if (ch < 0) return NULL;
+        if (c) {
+            if (c->type != c_bra || c->left == NULL || c->left->right != NULL)
+                return NULL;
+            c = c->left;
+            if (c->type == c_slicefrom) {
+                if (c->literalstring == NULL) return NULL;
+            } else if (c->type != c_delete) {
+                return NULL;
             }
-            w(g, "{ ~I2, ");
-            if (v->size == 0) {
-                w(g, "0,");
-            } else {
-                w(g, "s_~I0_~I1,");
+        }
+        for (j = 0; j < i; j++) {
+            if (v[j].size > 0 &&
+                single_character(g, v[j].b, v[j].size) >> 8 == ch >> 8) break;
+        }
+        if (j == i) pages++;
+    }
+    if (empty_count != with_empty || pages == 0) return NULL;
+    /* The page offsets are 16 bits. */
+    if ((pages + 1) * 256 > 0xFFFF) return NULL;
+    return x;
+}
+
+/* True if among_var is set by some code in p which isn't done by
+ * translate(). */
+static int among_var_used(struct node * p) {
+    for (; p; p = p->right) {
+        if (p->type == c_repeat && p->among) continue;
+        if ((p->type == c_among || p->type == c_substring) &&
+            p->among->amongvar_needed) return true;
+        if (among_var_used(p->left) || among_var_used(p->aux)) return true;
+    }
+    return false;
+}
+
+/* Find the loops which translate() can do. */
+static void mark_translations(struct generator * g, struct node * p) {
+    for (; p; p = p->right) {
+        if (p->type == c_repeat) {
+            struct among * x = translation_among(g, p);
+            if (x) {
+                p->among = x;
+                x->translated = true;
+                continue;
             }
-            w(g, " ~I3, ~I4, ");
-            if (v->function == 0) {
+        }
+        mark_translations(g, p->left);
+        mark_translations(g, p->aux);
+        if (p->type == c_define && p->amongvar_needed) {
+            p->amongvar_needed = among_var_used(p->left);
+        }
+    }
+}
+
+/* Add b to the pool, reusing any copy already there, and return where. */
+static int pool_add(symbol * pool, int * size, const symbol * b, int n) {
+    int k;
+    for (k = 0; k + n <= *size; k++) {
+        if (memcmp(pool + k, b, n * sizeof(symbol)) == 0) return k;
+    }
+    k = *size;
+    memmove(pool + k, b, n * sizeof(symbol));
+    *size += n;
+    return k;
+}
+
+/* Write the struct translation for among x, in place of its other tables. */
+static void generate_among_translation(struct generator * g, struct among * x) {
+    struct amongvec * v = x->b;
+    int n = x->literalstring_count;
+    int * ch = (int *) malloc(n * sizeof(int));
+    int * from = (int *) malloc(n * sizeof(int));
+    int * to = (int *) malloc(n * sizeof(int));
+    int * to_size = (int *) malloc(n * sizeof(int));
+    int * entry = (int *) malloc(n * sizeof(int));
+    int * page_offset;
+    int * index;
+    symbol * pool;
+    int pool_size = 0;
+    int entry_count = 0;
+    int index_size = 256;
+    int min_page = -1;
+    int max_page = -1;
+    int i;
+
+    for (i = 0; i < n; i++) {
+        pool_size += v[i].size;
+        if (v[i].action && v[i].action->left->type == c_slicefrom) {
+            pool_size += SIZE(v[i].action->left->literalstring);
+        }
+    }
+    pool = (symbol *) malloc((pool_size + 1) * sizeof(symbol));
+    if (ch == NULL || from == NULL || to == NULL || to_size == NULL ||
+        entry == NULL || pool == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    pool_size = 0;
+    for (i = 0; i < n; i++) {
+        struct node * c = v[i].action ? v[i].action->left : NULL;
+        if (v[i].size == 0) {
+            /* The empty string, which is the "next" of the loop. */
+            entry[i] = 0;
+            continue;
+        }
+        entry[i] = ++entry_count;
+        ch[i] = single_character(g, v[i].b, v[i].size);
+        if (min_page < 0 || ch[i] >> 8 < min_page) min_page = ch[i] >> 8;
+        if (ch[i] >> 8 > max_page) max_page = ch[i] >> 8;
+        from[i] = pool_add(pool, &pool_size, v[i].b, v[i].size);
+        if (c == NULL) {
+            /* Left alone. */
+            to[i] = from[i];
+            to_size[i] = v[i].size;
+        } else if (c->type == c_delete) {
+            to[i] = 0;
+            to_size[i] = 0;
+        } else {
+            to_size[i] = SIZE(c->literalstring);
+            to[i] = pool_add(pool, &pool_size, c->literalstring, to_size[i]);
+        }
+    }
+    if (pool_size > 0xFFFF) {
+        fprintf(stderr, "among %d is too large\n", x->number);
+        exit(1);
+    }
+
+    /* Index 0 to 255 are all 0, for the pages without an entry, followed by
+     * 256 for each page with one. */
+    page_offset = (int *) calloc(max_page - min_page + 1, sizeof(int));
+    index = (int *) calloc((entry_count + 1) * 256, sizeof(int));
+    if (page_offset == NULL || index == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (i = 0; i < n; i++) {
+        int * o;
+        if (entry[i] == 0) continue;
+        o = &page_offset[(ch[i] >> 8) - min_page];
+        if (*o == 0) {
+            *o = index_size;
+            index_size += 256;
+        }
+        index[*o + (ch[i] & 0xFF)] = entry[i];
+    }
+
+    g->I[0] = x->number;
+    g->I[1] = pool_size > 0 ? pool_size : 1;
+    w(g, "static const symbol a_~I0_pool[~I1] = {");
+    for (i = 0; i < pool_size; i++) {
+        w(g, i % 16 == 0 ? "~N    " : " ");
+        wlitch(g, pool[i]);
+        if (i < pool_size - 1) write_char(g, ',');
+    }
+    if (pool_size == 0) w(g, "~N    0");
+    w(g, "~N};~N~N");
+
+    g->I[1] = entry_count;
+    w(g, "static const struct translation_entry a_~I0_entry[~I1] = {~N");
+    for (i = 0; i < n; i++) {
+        if (entry[i] == 0) continue;
+        g->I[1] = from[i];
+        g->I[2] = v[i].size;
+        g->I[3] = to[i];
+        g->I[4] = to_size[i];
+        g->S[0] = entry[i] < entry_count ? "," : "";
+        w(g, "    { ~I1, ~I2, ~I3, ~I4 }~S0~N");
+    }
+    w(g, "};~N~N");
+
+    g->I[1] = max_page - min_page + 1;
+    w(g, "static const unsigned short a_~I0_page[~I1] = {");
+    for (i = 0; i <= max_page - min_page; i++) {
+        g->I[1] = page_offset[i];
+        w(g, i % 16 == 0 ? "~N    " : " ");
+        w(g, "~I1");
+        if (i < max_page - min_page) write_char(g, ',');
+    }
+    w(g, "~N};~N~N");
+
+    g->I[1] = index_size;
+    w(g, "static const unsigned short a_~I0_index[~I1] = {");
+    for (i = 0; i < index_size; i++) {
+        g->I[1] = index[i];
+        w(g, i % 16 == 0 ? "~N    " : " ");
+        w(g, "~I1");
+        if (i < index_size - 1) write_char(g, ',');
+    }
+    w(g, "~N};~N~N");
+
+    g->I[1] = min_page;
+    g->I[2] = max_page;
+    g->I[3] = entry_count < n;
+    w(g, "static const struct translation a_~I0_translation = {~N"
+         "    ~I1, ~I2, ~I3, a_~I0_page, a_~I0_index, a_~I0_entry, a_~I0_pool~N"
+         "};~N~N");
+
+    free(ch);
+    free(from);
+    free(to);
+    free(to_size);
+    free(entry);
+    free(page_offset);
+    free(index);
+    free(pool);
+}
+
+static void generate_among_table(struct generator * g, struct among * x) {
+
+    struct amongvec * v = x->b;
+    int n = x->literalstring_count;
+    int * offset = (int *) malloc(n * sizeof(int));
+    symbol * pool = NULL;
+    int pool_size = 0;
+    int pool_written;
+    int i;
+
+    if (offset == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    if (x->translated) {
+        generate_among_translation(g, x);
+        free(offset);
+        return;
+    }
+    x->hashed = among_matches_whole(x) && generate_among_hash(g, x);
+    g->I[0] = x->number;
+    if (g->options->among_style == AMONG_TRIE && !x->hashed) {
+        /* The generated code compares the strings itself. */
+        for (i = 0; i < n; i++) offset[i] = 0;
+    } else {
+        pool = among_string_pool(x, offset, &pool_size);
+    }
+    /* The runtime stores offsets, sizes and indices in 16 bits. */
+    if (pool_size > 0xFFFF || n > 0x7FFF) {
+        fprintf(stderr, "among %d is too large\n", x->number);
+        exit(1);
+    }
+    pool_written = pool != NULL;
+    if (pool_written) {
+        g->I[1] = pool_size > 0 ? pool_size : 1;
+        w(g, "static const symbol a_~I0_pool[~I1] = {");
+        for (i = 0; i < pool_size; i++) {
+            w(g, i % 16 == 0 ? "~N    " : " ");
+            wlitch(g, pool[i]);
+            if (i < pool_size - 1) write_char(g, ',');
+        }
+        if (pool_size == 0) w(g, "~N    0");
+        w(g, "~N};~N");
+        free(pool);
+    }
+
+    g->I[1] = n;
+    w(g, "~N~Mstatic const struct among a_~I0[~I1] =~N{~N");
+    for (i = 0; i < n; i++) {
+        g->I[1] = i;
+        g->I[2] = offset[i];
+        g->I[3] = v[i].size;
+        g->I[4] = v[i].i;
+        g->I[5] = v[i].result;
+        g->S[0] = i < n - 1 ? "," : "";
+
+        if (g->options->comments) {
+            w(g, "/*~J1 */ ");
+        }
+        w(g, "{ ~I2, ~I3, ~I4, ~I5 }~S0~N");
+    }
+    w(g, "};~N~N");
+
+    if (x->function_count > 0) {
+        g->I[1] = n;
+        w(g, "static int (* const a_~I0_functions[~I1])(struct SN_env *) = {~N");
+        for (i = 0; i < n; i++) {
+            w(g, "    ");
+            if (v[i].function == 0) {
                 write_char(g, '0');
             } else {
-                write_varname(g, v->function);
+                write_varname(g, v[i].function);
             }
-            w(g, "}~S0~N");
-            v++;
+            if (i < n - 1) write_char(g, ',');
+            w(g, "~N");
         }
+        w(g, "};~N~N");
     }
-    w(g, "};~N~N");
+
+    if (pool_written) {
+        g->I[1] = n;
+        w(g, "static const struct among_table a_~I0_table = {~N"
+             "    a_~I0, ~I1, a_~I0_pool, ");
+        if (x->function_count > 0) {
+            w(g, "a_~I0_functions");
+        } else {
+            write_char(g, '0');
+        }
+        w(g, "~N};~N~N");
+    }
+    free(offset);
 }
 
 static void generate_amongs(struct generator * g) {
@@ -1549,15 +2449,128 @@ static void generate_amongs(struct generator * g) {
     }
 }
 
+/* With -profile, every among sets among_var so its result can be counted. */
+static void mark_profiled_amongs(struct generator * g) {
+    struct among * x;
+    struct node * p;
+    for (x = g->analyser->amongs; x; x = x->next) {
+        x->amongvar_needed = true;
+    }
+    for (p = g->analyser->program; p; p = p->right) {
+        if (p->type == c_define) p->amongvar_needed = among_var_used(p->left);
+    }
+}
+
+/* Write the p_routines[] entries for the names of the given type, in the
+ * order profile_index() gives them. */
+static void generate_profile_routines(struct generator * g, int type) {
+    int i;
+    for (i = 0; i < g->analyser->name_count[type]; i++) {
+        struct name * q = g->analyser->names;
+        while (q->type != type || q->count != i) q = q->next;
+        w(g, "    { \"");
+        write_b(g, q->b);
+        w(g, "\", 0, 0, 0 },~N");
+    }
+}
+
+/* Write the counters for -profile (see struct SN_profile in the runtime's
+ * header.h).  Entry i + 1 of an among's counts is for result i, so entry 0
+ * counts matches of strings without a command and entry 1 counts misses. */
+static void generate_profile_tables(struct generator * g) {
+    struct among * x;
+    int * name_count = g->analyser->name_count;
+
+    for (x = g->analyser->amongs; x; x = x->next) {
+        g->I[0] = x->number;
+        g->I[1] = x->command_count + 2;
+        w(g, "static unsigned long a_~I0_counts[~I1];~N");
+    }
+    if (g->analyser->amongs) {
+        w(g, "~Nstatic struct SN_profile_among p_amongs[] = {~N");
+        for (x = g->analyser->amongs; x; x = x->next) {
+            int line_number = x->b[0].line_number;
+            int i;
+            for (i = 1; i < x->literalstring_count; i++) {
+                if (x->b[i].line_number < line_number) {
+                    line_number = x->b[i].line_number;
+                }
+            }
+            g->I[0] = line_number;
+            g->I[1] = x->command_count + 2;
+            g->I[2] = x->number;
+            w(g, "    { ~I0, ~I1, a_~I2_counts },~N");
+        }
+        w(g, "};~N");
+    }
+
+    w(g, "~Nstatic struct SN_profile_routine p_routines[] = {~N");
+    generate_profile_routines(g, t_routine);
+    generate_profile_routines(g, t_external);
+    w(g, "};~N~N");
+
+    g->I[0] = name_count[t_routine] + name_count[t_external];
+    g->I[1] = g->analyser->among_count;
+    w(g, "static struct SN_profile p_profile = {~N"
+         "    \"");
+    write_string(g, g->options->name);
+    w(g, "\", ~I0, p_routines, ~I1, ");
+    w(g, g->analyser->amongs ? "p_amongs" : "0");
+    w(g, ", 0, 0~N};~N~N");
+}
+
 static void set_bit(symbol * b, int i) { b[i/8] |= 1 << i%8; }
 
+/* Write a table with an entry for each byte value for the runtime
+ * in_class() functions etc.  For UTF-8, a byte of 0x80 or more has a
+ * non-zero entry if in_grouping_U() etc could decode a character in the
+ * grouping starting from that byte. */
+static void generate_grouping_class_table(struct generator * g, struct grouping * q) {
+
+    symbol * b = q->b;
+    byte t[256];
+    int i;
+    for (i = 0; i < 256; i++) t[i] = 0;
+
+    for (i = 0; i < SIZE(b); i++) {
+        int ch = b[i];
+        /* For UTF-8, a stray continuation byte or a lead byte at the end
+         * of the string decodes to itself. */
+        if (ch < 0x100) t[ch] = 1;
+        /* A two byte sequence, which may be an overlong encoding. */
+        if (g->options->encoding == ENC_UTF8 && ch < 0x800) t[0xC0 | ch >> 6] = 1;
+    }
+    if (g->options->encoding == ENC_UTF8) {
+        /* Longer and truncated sequences aren't worth analysing. */
+        for (i = 0xE0; i < 0x100; i++) t[i] = 1;
+    }
+
+    g->V[0] = q->name;
+
+    w(g, "static const unsigned char ~V0_class[256] = {~N");
+    for (i = 0; i < 256; i++) {
+        if (i % 32 == 0) w(g, "    ");
+        write_int(g, t[i]);
+        if (i < 255) w(g, i % 32 == 31 ? ",~N" : ", ");
+    }
+    w(g, "~N};~N~N");
+}
+
 static void generate_grouping_table(struct generator * g, struct grouping * q) {
 
     int range = q->largest_ch - q->smallest_ch + 1;
     int size = (range + 7)/ 8;  /* assume 8 bits per symbol */
     symbol * b = q->b;
-    symbol * map = create_b(size);
+    symbol * map;
     int i;
+
+    if (g->options->encoding != ENC_WIDECHARS) {
+        generate_grouping_class_table(g, q);
+        /* The class table is all that's needed for single byte encodings. */
+        if (g->options->encoding == ENC_SINGLEBYTE) return;
+    }
+
+    map = create_b(size);
     for (i = 0; i < size; i++) map[i] = 0;
 
     for (i = 0; i < SIZE(b); i++) set_bit(map, b[i] - q->smallest_ch);
@@ -1586,6 +2599,14 @@ static void generate_create(struct generator * g) {
     int * p = g->analyser->name_count;
     g->I[0] = p[t_string];
     g->I[1] = p[t_integer] + p[t_boolean];
+    if (g->options->profile) {
+        w(g, "~N"
+             "extern struct SN_env * ~pcreate_env(void) {~N"
+             "    SN_profile_register(&p_profile);~N"
+             "    return SN_create_env(~I0, ~I1);~N"
+             "}~N");
+        return;
+    }
     w(g, "~N"
          "extern struct SN_env * ~pcreate_env(void) { return SN_create_env(~I0, ~I1); }"
          "~N");
@@ -1673,8 +2694,15 @@ extern void generate_program_c(struct generator * g) {
          "#ifdef __cplusplus~N"
          "}~N"
          "#endif~N");
+    if (g->options->profile) {
+        /* Loops done by translate() have no among lookups to count. */
+        mark_profiled_amongs(g);
+    } else {
+        mark_translations(g, g->analyser->program);
+    }
     generate_amongs(g);
     generate_groupings(g);
+    if (g->options->profile) generate_profile_tables(g);
     g->declarations = g->outbuf;
     g->outbuf = str_new();
     g->literalstring_count = 0;
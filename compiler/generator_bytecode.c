@@ -0,0 +1,1000 @@
+#include <limits.h> /* for INT_MAX, INT_MIN */
+#include <stdio.h> /* for fprintf etc */
+#include <stdlib.h> /* for malloc, realloc, free, exit */
+#include <string.h> /* for memcmp */
+#include "header.h"
+#include "../runtime/bytecode.h"
+
+/*  The bytecode generator writes the program for the interpreter in
+    runtime/vm.c, in the format described in runtime/bytecode.h.
+
+    The code for each construct has the same shape as the C the C generator
+    writes for it, and keeps and restores the cursor in the same places, so
+    a stemmer run by the interpreter gives the same results as the compiled
+    one.  Saved cursors, limits and loop counts live in numbered local slots
+    of the routine, which are allocated like the C generator's nested blocks
+    declare variables.
+
+    Failing jumps to the current failure label.  Where the C generator would
+    restore the cursor or limit before going there (see failure_keep_count),
+    the jump goes instead to a stub at the end of the routine which does the
+    restore and then jumps to the label.
+*/
+
+/* A jump to a label whose position isn't known yet. */
+struct fixup {
+    int at;         /* code offset of the operand */
+    int label;
+};
+
+/* Restore slot, then go to label target. */
+struct stub {
+    int label;
+    int op;         /* SN_OP_RESTORE etc */
+    int slot;
+    int target;
+};
+
+struct bytecode_routine {
+    int start;
+    int size;
+    int locals;
+    int envs;
+};
+
+struct bytecode {
+    struct generator * g;
+    int * code;
+    int code_size;
+    int code_capacity;
+    int * labels;               /* code offset of each label, or -1 */
+    int label_count;
+    int label_capacity;
+    struct fixup * fixups;
+    int fixup_count;
+    int fixup_capacity;
+    struct stub * stubs;        /* for the current routine */
+    int stub_count;
+    int stub_capacity;
+    symbol ** literals;
+    int literal_count;
+    int literal_capacity;
+    struct bytecode_routine * routines;
+
+    int failure_label;
+    int failure_op;             /* to restore before failing, or -1 */
+    int failure_slot;
+
+    int slots;                  /* local slots in use */
+    int max_slots;
+    int envs;                   /* envs in use by $ */
+    int max_envs;
+    int depth;                  /* of the arithmetic stack */
+};
+
+#define OP_STACK(NAME, OPERANDS, POPS, PUSHES) { POPS, PUSHES },
+static const struct { int pops; int pushes; } op_stack[] = {
+    SN_BYTECODE_OPS(OP_STACK)
+};
+#undef OP_STACK
+
+static void generate(struct bytecode * b, struct node * p);
+
+static void * grow(void * v, int * capacity, int needed, size_t item_size) {
+    if (needed > *capacity) {
+        int new_capacity = *capacity ? *capacity * 2 : 64;
+        while (new_capacity < needed) new_capacity *= 2;
+        v = realloc(v, new_capacity * item_size);
+        if (v == NULL) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        *capacity = new_capacity;
+    }
+    return v;
+}
+
+static void emit(struct bytecode * b, int word) {
+    b->code = (int *) grow(b->code, &b->code_capacity, b->code_size + 1, sizeof(int));
+    b->code[b->code_size++] = word;
+}
+
+static void emit_op(struct bytecode * b, int op) {
+    b->depth += op_stack[op].pushes - op_stack[op].pops;
+    if (b->depth > SN_BYTECODE_MAX_STACK) {
+        fprintf(stderr, "Arithmetic expression too deep for -bytecode\n");
+        exit(1);
+    }
+    emit(b, op);
+}
+
+static int new_label(struct bytecode * b) {
+    b->labels = (int *) grow(b->labels, &b->label_capacity, b->label_count + 1, sizeof(int));
+    b->labels[b->label_count] = -1;
+    return b->label_count++;
+}
+
+static void set_label(struct bytecode * b, int label) {
+    b->labels[label] = b->code_size;
+}
+
+static void emit_label(struct bytecode * b, int label) {
+    struct fixup * f;
+    b->fixups = (struct fixup *) grow(b->fixups, &b->fixup_capacity, b->fixup_count + 1, sizeof(struct fixup));
+    f = &b->fixups[b->fixup_count++];
+    f->at = b->code_size;
+    f->label = label;
+    emit(b, 0);
+}
+
+/* Emit the operand to go to on failure. */
+static void emit_failure(struct bytecode * b) {
+    int i;
+    struct stub * s;
+    if (b->failure_op < 0) {
+        emit_label(b, b->failure_label);
+        return;
+    }
+    for (i = 0; i < b->stub_count; i++) {
+        s = &b->stubs[i];
+        if (s->op == b->failure_op && s->slot == b->failure_slot &&
+            s->target == b->failure_label) {
+            emit_label(b, s->label);
+            return;
+        }
+    }
+    b->stubs = (struct stub *) grow(b->stubs, &b->stub_capacity, b->stub_count + 1, sizeof(struct stub));
+    s = &b->stubs[b->stub_count++];
+    s->label = new_label(b);
+    s->op = b->failure_op;
+    s->slot = b->failure_slot;
+    s->target = b->failure_label;
+    emit_label(b, s->label);
+}
+
+static void emit_goto_failure(struct bytecode * b) {
+    emit_op(b, SN_OP_GOTO);
+    emit_failure(b);
+}
+
+static void emit_goto(struct bytecode * b, int label) {
+    emit_op(b, SN_OP_GOTO);
+    emit_label(b, label);
+}
+
+/* Emit a test, which fails to the current failure label. */
+static void emit_test(struct bytecode * b, int op) {
+    emit_op(b, op);
+    emit_failure(b);
+}
+
+static int new_slot(struct bytecode * b) {
+    int slot = b->slots++;
+    if (b->slots > b->max_slots) b->max_slots = b->slots;
+    if (b->slots > SN_BYTECODE_MAX_LOCALS) {
+        fprintf(stderr, "Routine too deeply nested for -bytecode\n");
+        exit(1);
+    }
+    return slot;
+}
+
+static void free_slot(struct bytecode * b) {
+    b->slots--;
+}
+
+static int keep_c(struct bytecode * b, struct node * p) {
+    int slot = new_slot(b);
+    emit_op(b, p->mode == m_forward ? SN_OP_KEEP : SN_OP_KEEP_B);
+    emit(b, slot);
+    return slot;
+}
+
+static int restore_op(struct node * p) {
+    return p->mode == m_forward ? SN_OP_RESTORE : SN_OP_RESTORE_B;
+}
+
+static void restore_c(struct bytecode * b, struct node * p, int slot) {
+    emit_op(b, restore_op(p));
+    emit(b, slot);
+}
+
+static int literal_index(struct bytecode * b, symbol * s) {
+    int i;
+    for (i = 0; i < b->literal_count; i++) {
+        symbol * t = b->literals[i];
+        if (SIZE(t) == SIZE(s) && memcmp(t, s, SIZE(s) * sizeof(symbol)) == 0) {
+            return i;
+        }
+    }
+    b->literals = (symbol **) grow(b->literals, &b->literal_capacity, b->literal_count + 1, sizeof(symbol *));
+    b->literals[b->literal_count] = s;
+    return b->literal_count++;
+}
+
+/* The index of variable q in z->S or z->I. */
+static int variable_index(struct bytecode * b, struct name * q) {
+    if (q->count < 0) {
+        fprintf(stderr, "Reference to optimised out variable ");
+        report_b(stderr, q->b);
+        fprintf(stderr, " attempted\n");
+        exit(1);
+    }
+    if (q->type == t_boolean) {
+        return b->g->analyser->name_count[t_integer] + q->count;
+    }
+    return q->count;
+}
+
+static int routine_index(struct bytecode * b, struct name * q) {
+    if (q->type == t_routine) return q->count;
+    return b->g->analyser->name_count[t_routine] + q->count;
+}
+
+static void generate_AE(struct bytecode * b, struct node * p) {
+    int op;
+    enc encoding = b->g->options->encoding;
+    switch (p->type) {
+        case c_name:
+            emit_op(b, SN_OP_PUSH_VAR);
+            emit(b, variable_index(b, p->name));
+            return;
+        case c_number:
+            emit_op(b, SN_OP_PUSH);
+            emit(b, p->number);
+            return;
+        case c_maxint:
+            emit_op(b, SN_OP_PUSH);
+            emit(b, INT_MAX);
+            return;
+        case c_minint:
+            emit_op(b, SN_OP_PUSH);
+            emit(b, INT_MIN);
+            return;
+        case c_neg:
+            generate_AE(b, p->right);
+            emit_op(b, SN_OP_NEG);
+            return;
+        case c_multiply: op = SN_OP_MUL; break;
+        case c_plus: op = SN_OP_ADD; break;
+        case c_minus: op = SN_OP_SUB; break;
+        case c_divide: op = SN_OP_DIV; break;
+        case c_cursor:
+            emit_op(b, SN_OP_PUSH_C);
+            return;
+        case c_limit:
+            emit_op(b, p->mode == m_forward ? SN_OP_PUSH_L : SN_OP_PUSH_LB);
+            return;
+        case c_len:
+            emit_op(b, encoding == ENC_UTF8 ? SN_OP_PUSH_LEN : SN_OP_PUSH_SIZE);
+            return;
+        case c_size:
+            emit_op(b, SN_OP_PUSH_SIZE);
+            return;
+        case c_lenof:
+            emit_op(b, encoding == ENC_UTF8 ? SN_OP_PUSH_LENOF : SN_OP_PUSH_SIZEOF);
+            emit(b, variable_index(b, p->name));
+            return;
+        case c_sizeof:
+            emit_op(b, SN_OP_PUSH_SIZEOF);
+            emit(b, variable_index(b, p->name));
+            return;
+        default:
+            fprintf(stderr, "%d encountered in arithmetic\n", p->type);
+            exit(1);
+    }
+    generate_AE(b, p->left);
+    generate_AE(b, p->right);
+    emit_op(b, op);
+}
+
+static void generate_bra(struct bytecode * b, struct node * p) {
+    for (p = p->left; p; p = p->right) generate(b, p);
+}
+
+static void generate_and(struct bytecode * b, struct node * p) {
+    int keep = K_needed(b->g, p->left) ? keep_c(b, p) : -1;
+    struct node * q;
+    for (q = p->left; q; q = q->right) {
+        generate(b, q);
+        if (keep >= 0 && q->right) restore_c(b, p, keep);
+    }
+    if (keep >= 0) free_slot(b);
+}
+
+static void generate_or(struct bytecode * b, struct node * p) {
+    int keep = K_needed(b->g, p->left) ? keep_c(b, p) : -1;
+    int a0 = b->failure_label;
+    int a1 = b->failure_op;
+    int a2 = b->failure_slot;
+    int out = new_label(b);
+    struct node * q;
+
+    b->failure_op = -1;
+    for (q = p->left; q->right; q = q->right) {
+        b->failure_label = new_label(b);
+        generate(b, q);
+        emit_goto(b, out);
+        set_label(b, b->failure_label);
+        if (keep >= 0) restore_c(b, p, keep);
+    }
+    b->failure_label = a0;
+    b->failure_op = a1;
+    b->failure_slot = a2;
+
+    generate(b, q);
+    if (keep >= 0) free_slot(b);
+    set_label(b, out);
+}
+
+static void generate_backwards(struct bytecode * b, struct node * p) {
+    emit_op(b, SN_OP_BACKWARDS);
+    generate(b, p->left);
+    emit_op(b, SN_OP_END_BACKWARDS);
+}
+
+static void generate_not(struct bytecode * b, struct node * p) {
+    int keep = K_needed(b->g, p->left) ? keep_c(b, p) : -1;
+    int a0 = b->failure_label;
+    int a1 = b->failure_op;
+    int a2 = b->failure_slot;
+    int l = new_label(b);
+
+    b->failure_label = l;
+    b->failure_op = -1;
+    generate(b, p->left);
+
+    b->failure_label = a0;
+    b->failure_op = a1;
+    b->failure_slot = a2;
+    emit_goto_failure(b);
+    set_label(b, l);
+    if (keep >= 0) {
+        restore_c(b, p, keep);
+        free_slot(b);
+    }
+}
+
+static void generate_try(struct bytecode * b, struct node * p) {
+    int keep = K_needed(b->g, p->left) ? keep_c(b, p) : -1;
+    if (keep >= 0) {
+        b->failure_op = restore_op(p);
+        b->failure_slot = keep;
+    } else {
+        b->failure_op = -1;
+    }
+    b->failure_label = new_label(b);
+    generate(b, p->left);
+    set_label(b, b->failure_label);
+    if (keep >= 0) free_slot(b);
+}
+
+static void generate_set(struct bytecode * b, struct node * p, int op) {
+    emit_op(b, op);
+    emit(b, variable_index(b, p->name));
+}
+
+static void generate_fail(struct bytecode * b, struct node * p) {
+    generate(b, p->left);
+    emit_goto_failure(b);
+}
+
+/* generate_test() also implements 'reverse' */
+
+static void generate_test(struct bytecode * b, struct node * p) {
+    int keep = K_needed(b->g, p->left) ? keep_c(b, p) : -1;
+    generate(b, p->left);
+    if (keep >= 0) {
+        restore_c(b, p, keep);
+        free_slot(b);
+    }
+}
+
+static void generate_do(struct bytecode * b, struct node * p) {
+    int keep = K_needed(b->g, p->left) ? keep_c(b, p) : -1;
+    if (p->left->type == c_call) {
+        emit_op(b, SN_OP_CALL_DO);
+        emit(b, routine_index(b, p->left->name));
+    } else {
+        b->failure_label = new_label(b);
+        b->failure_op = -1;
+        generate(b, p->left);
+        set_label(b, b->failure_label);
+    }
+    if (keep >= 0) {
+        restore_c(b, p, keep);
+        free_slot(b);
+    }
+}
+
+static void generate_next(struct bytecode * b, struct node * p) {
+    if (b->g->options->encoding == ENC_UTF8) {
+        emit_test(b, p->mode == m_forward ? SN_OP_NEXT_U : SN_OP_NEXT_B_U);
+    } else {
+        emit_test(b, p->mode == m_forward ? SN_OP_NEXT : SN_OP_NEXT_B);
+    }
+}
+
+static void generate_GO_grouping(struct bytecode * b, struct node * p, int is_goto, int complement) {
+    int op;
+    if (is_goto) {
+        op = complement ? SN_OP_GOTO_NON : SN_OP_GOTO_GROUPING;
+    } else {
+        op = complement ? SN_OP_GOPAST_NON : SN_OP_GOPAST_GROUPING;
+    }
+    /* Each _B op follows the forward one. */
+    if (p->mode == m_backward) op++;
+    emit_test(b, op);
+    emit(b, p->name->count);
+}
+
+static void generate_GO(struct bytecode * b, struct node * p, int style) {
+    int keep = -1;
+    int a0 = b->failure_label;
+    int a1 = b->failure_op;
+    int a2 = b->failure_slot;
+    int top, end;
+
+    if (p->left->type == c_grouping || p->left->type == c_non) {
+        generate_GO_grouping(b, p->left, style, p->left->type == c_non);
+        return;
+    }
+
+    top = new_label(b);
+    end = new_label(b);
+    set_label(b, top);
+    if (style == 1 || repeat_restore(b->g, p->left)) keep = keep_c(b, p);
+
+    b->failure_label = new_label(b);
+    b->failure_op = -1;
+    generate(b, p->left);
+
+    if (style == 1) {
+        /* include for goto; omit for gopast */
+        restore_c(b, p, keep);
+    }
+    emit_goto(b, end);
+    set_label(b, b->failure_label);
+    if (keep >= 0) restore_c(b, p, keep);
+
+    b->failure_label = a0;
+    b->failure_op = a1;
+    b->failure_slot = a2;
+
+    generate_next(b, p);
+    emit_goto(b, top);
+    set_label(b, end);
+    if (keep >= 0) free_slot(b);
+}
+
+static void generate_loop(struct bytecode * b, struct node * p) {
+    int top = new_label(b);
+    int end = new_label(b);
+    int slot;
+    generate_AE(b, p->AE);
+    slot = new_slot(b);
+    emit_op(b, SN_OP_POP_LOCAL);
+    emit(b, slot);
+
+    set_label(b, top);
+    emit_op(b, SN_OP_LOOP);
+    emit(b, slot);
+    emit_label(b, end);
+    generate(b, p->left);
+    emit_goto(b, top);
+    set_label(b, end);
+    free_slot(b);
+}
+
+/* counter is the slot of the count for atleast, or -1 for repeat. */
+static void generate_repeat_or_atleast(struct bytecode * b, struct node * p, int counter) {
+    int top = new_label(b);
+    int keep = -1;
+
+    set_label(b, top);
+    if (repeat_restore(b->g, p->left)) keep = keep_c(b, p);
+
+    b->failure_label = new_label(b);
+    b->failure_op = -1;
+    generate(b, p->left);
+
+    if (counter >= 0) {
+        emit_op(b, SN_OP_DEC_LOCAL);
+        emit(b, counter);
+    }
+    emit_goto(b, top);
+    set_label(b, b->failure_label);
+
+    if (keep >= 0) {
+        restore_c(b, p, keep);
+        free_slot(b);
+    }
+}
+
+static void generate_atleast(struct bytecode * b, struct node * p) {
+    int slot;
+    generate_AE(b, p->AE);
+    slot = new_slot(b);
+    emit_op(b, SN_OP_POP_LOCAL);
+    emit(b, slot);
+    {
+        int a0 = b->failure_label;
+        int a1 = b->failure_op;
+        int a2 = b->failure_slot;
+
+        generate_repeat_or_atleast(b, p, slot);
+
+        b->failure_label = a0;
+        b->failure_op = a1;
+        b->failure_slot = a2;
+    }
+    emit_op(b, SN_OP_PUSH_LOCAL);
+    emit(b, slot);
+    emit_op(b, SN_OP_PUSH);
+    emit(b, 0);
+    emit_test(b, SN_OP_TEST_LE);
+    free_slot(b);
+}
+
+static void generate_hop(struct bytecode * b, struct node * p) {
+    if (b->g->options->encoding == ENC_UTF8) {
+        generate_AE(b, p->AE);
+        emit_test(b, p->mode == m_forward ? SN_OP_HOP_U : SN_OP_HOP_B_U);
+    } else if (p->AE->type == c_number) {
+        /* Constant distance hop, which the analyser knows isn't negative. */
+        emit_test(b, p->mode == m_forward ? SN_OP_HOPN : SN_OP_HOPN_B);
+        emit(b, p->AE->number);
+    } else {
+        generate_AE(b, p->AE);
+        emit_test(b, p->mode == m_forward ? SN_OP_HOP : SN_OP_HOP_B);
+    }
+}
+
+/* Emit op_s or op_v (which follows it) for the string p is given. */
+static void generate_string_op(struct bytecode * b, struct node * p, int op_s) {
+    if (p->literalstring) {
+        emit_op(b, op_s);
+        emit(b, literal_index(b, p->literalstring));
+    } else {
+        emit_op(b, op_s + 1);
+        emit(b, variable_index(b, p->name));
+    }
+}
+
+static void generate_insert(struct bytecode * b, struct node * p, int style) {
+    int keep = style == c_attach;
+    if (p->mode == m_backward) keep = !keep;
+    generate_string_op(b, p, keep ? SN_OP_ATTACH_S : SN_OP_INSERT_S);
+}
+
+static void generate_assignfrom(struct bytecode * b, struct node * p) {
+    generate_string_op(b, p, p->mode == m_forward ? SN_OP_ASSIGN_S : SN_OP_ASSIGN_S_B);
+}
+
+static void generate_setlimit(struct bytecode * b, struct node * p) {
+    int keep = -1;
+    int slot;
+    if (p->left && p->left->type == c_tomark) {
+        /* Special case for "setlimit tomark AE for C", as in the C
+         * generator, which avoids having to save and restore c. */
+        struct node * q = p->left;
+        emit_op(b, SN_OP_PUSH_C);
+        generate_AE(b, q->AE);
+        emit_test(b, q->mode == m_forward ? SN_OP_TEST_LE : SN_OP_TEST_GE);
+        slot = new_slot(b);
+        generate_AE(b, q->AE);
+        emit_op(b, p->mode == m_forward ? SN_OP_SETLIMIT_TO : SN_OP_SETLIMIT_TO_B);
+        emit(b, slot);
+    } else {
+        keep = keep_c(b, p);
+        generate(b, p->left);
+        slot = new_slot(b);
+        emit_op(b, p->mode == m_forward ? SN_OP_SETLIMIT : SN_OP_SETLIMIT_B);
+        emit(b, slot);
+        restore_c(b, p, keep);
+    }
+
+    b->failure_op = p->mode == m_forward ? SN_OP_RESTORE_LIMIT : SN_OP_RESTORE_LIMIT_B;
+    b->failure_slot = slot;
+    generate(b, p->aux);
+    emit_op(b, b->failure_op);
+    emit(b, slot);
+    free_slot(b);
+    if (keep >= 0) free_slot(b);
+}
+
+/* dollar sets snowball up to operate on a string variable as if it were the
+ * current string */
+static void generate_dollar(struct bytecode * b, struct node * p) {
+    int a0 = b->failure_label;
+    int a1 = b->failure_op;
+    int a2 = b->failure_slot;
+    int s = variable_index(b, p->name);
+    int env = b->envs++;
+    int done = new_label(b);
+
+    if (b->envs > b->max_envs) b->max_envs = b->envs;
+    if (b->envs > SN_BYTECODE_MAX_ENVS) {
+        fprintf(stderr, "$ nested too deeply for -bytecode\n");
+        exit(1);
+    }
+
+    emit_op(b, SN_OP_DOLLAR);
+    emit(b, s);
+    emit(b, env);
+    b->failure_label = new_label(b);
+    b->failure_op = -1;
+    generate(b, p->left);
+    emit_op(b, SN_OP_END_DOLLAR);
+    emit(b, s);
+    emit(b, env);
+    emit_goto(b, done);
+
+    set_label(b, b->failure_label);
+    b->failure_label = a0;
+    b->failure_op = a1;
+    b->failure_slot = a2;
+    emit_op(b, SN_OP_END_DOLLAR);
+    emit(b, s);
+    emit(b, env);
+    emit_goto_failure(b);
+    set_label(b, done);
+    b->envs--;
+}
+
+static void generate_integer_assign(struct bytecode * b, struct node * p, int op) {
+    generate_AE(b, p->AE);
+    emit_op(b, op);
+    emit(b, variable_index(b, p->name));
+}
+
+static void generate_integer_test(struct bytecode * b, struct node * p, int op) {
+    generate_AE(b, p->left);
+    generate_AE(b, p->AE);
+    emit_test(b, op);
+}
+
+static void generate_literalstring(struct bytecode * b, struct node * p) {
+    symbol * s = p->literalstring;
+    if (SIZE(s) == 1) {
+        emit_test(b, p->mode == m_forward ? SN_OP_CHAR : SN_OP_CHAR_B);
+        emit(b, s[0]);
+    } else {
+        emit_test(b, p->mode == m_forward ? SN_OP_EQ_S : SN_OP_EQ_S_B);
+        emit(b, literal_index(b, s));
+    }
+}
+
+static void generate_substring(struct bytecode * b, struct node * p) {
+    emit_test(b, p->mode == m_forward ? SN_OP_AMONG : SN_OP_AMONG_B);
+    emit(b, p->among->number);
+}
+
+static void generate_among(struct bytecode * b, struct node * p) {
+    struct among * x = p->among;
+
+    if (x->substring == 0) generate_substring(b, p);
+
+    if (x->starter != 0) generate(b, x->starter);
+
+    if (x->command_count == 1 && x->nocommand_count == 0) {
+        /* Only one outcome ("no match" already handled). */
+        generate(b, x->commands[0]);
+    } else if (x->command_count > 0) {
+        int end = new_label(b);
+        int first = b->label_count;
+        int i;
+        emit_op(b, SN_OP_SWITCH);
+        emit(b, x->command_count);
+        emit_label(b, end);
+        for (i = 0; i < x->command_count; i++) emit_label(b, new_label(b));
+        for (i = 0; i < x->command_count; i++) {
+            set_label(b, first + i);
+            generate(b, x->commands[i]);
+            emit_goto(b, end);
+        }
+        set_label(b, end);
+    }
+}
+
+static void generate_define(struct bytecode * b, struct node * p) {
+    struct bytecode_routine * r = &b->routines[routine_index(b, p->name)];
+    int return_label = new_label(b);
+    int i;
+
+    r->start = b->code_size;
+    b->slots = b->max_slots = 0;
+    b->envs = b->max_envs = 0;
+    b->stub_count = 0;
+    b->failure_label = return_label;
+    b->failure_op = -1;
+
+    generate(b, p->left);
+    emit_op(b, SN_OP_RETURN1);
+    set_label(b, return_label);
+    emit_op(b, SN_OP_RETURN0);
+    for (i = 0; i < b->stub_count; i++) {
+        struct stub * s = &b->stubs[i];
+        set_label(b, s->label);
+        emit_op(b, s->op);
+        emit(b, s->slot);
+        emit_goto(b, s->target);
+    }
+
+    r->size = b->code_size - r->start;
+    r->locals = b->max_slots;
+    r->envs = b->max_envs;
+}
+
+static void generate(struct bytecode * b, struct node * p) {
+
+    int a0 = b->failure_label;
+    int a1 = b->failure_op;
+    int a2 = b->failure_slot;
+    int mode = p->mode;
+
+    switch (p->type) {
+        case c_define:        generate_define(b, p); break;
+        case c_bra:           generate_bra(b, p); break;
+        case c_and:           generate_and(b, p); break;
+        case c_or:            generate_or(b, p); break;
+        case c_backwards:     generate_backwards(b, p); break;
+        case c_not:           generate_not(b, p); break;
+        case c_set:           generate_set(b, p, SN_OP_SET); break;
+        case c_unset:         generate_set(b, p, SN_OP_UNSET); break;
+        case c_try:           generate_try(b, p); break;
+        case c_fail:          generate_fail(b, p); break;
+        case c_reverse:
+        case c_test:          generate_test(b, p); break;
+        case c_do:            generate_do(b, p); break;
+        case c_goto:          generate_GO(b, p, 1); break;
+        case c_gopast:        generate_GO(b, p, 0); break;
+        case c_repeat:        generate_repeat_or_atleast(b, p, -1); break;
+        case c_loop:          generate_loop(b, p); break;
+        case c_atleast:       generate_atleast(b, p); break;
+        case c_setmark:       generate_set(b, p, SN_OP_SETMARK); break;
+        case c_tomark:
+            generate_AE(b, p->AE);
+            emit_test(b, mode == m_forward ? SN_OP_TOMARK : SN_OP_TOMARK_B);
+            break;
+        case c_atmark:
+            generate_AE(b, p->AE);
+            emit_test(b, SN_OP_ATMARK);
+            break;
+        case c_hop:           generate_hop(b, p); break;
+        case c_delete:        emit_op(b, SN_OP_DELETE); break;
+        case c_next:          generate_next(b, p); break;
+        case c_tolimit:
+            emit_op(b, mode == m_forward ? SN_OP_TOLIMIT : SN_OP_TOLIMIT_B);
+            break;
+        case c_atlimit:
+            emit_test(b, mode == m_forward ? SN_OP_ATLIMIT : SN_OP_ATLIMIT_B);
+            break;
+        case c_leftslice:
+            emit_op(b, mode == m_forward ? SN_OP_BRA : SN_OP_KET);
+            break;
+        case c_rightslice:
+            emit_op(b, mode == m_forward ? SN_OP_KET : SN_OP_BRA);
+            break;
+        case c_assignto:      generate_set(b, p, SN_OP_ASSIGNTO); break;
+        case c_sliceto:       generate_set(b, p, SN_OP_SLICETO); break;
+        case c_assign:        generate_assignfrom(b, p); break;
+        case c_insert:
+        case c_attach:        generate_insert(b, p, p->type); break;
+        case c_slicefrom:     generate_string_op(b, p, SN_OP_SLICE_FROM_S); break;
+        case c_setlimit:      generate_setlimit(b, p); break;
+        case c_dollar:        generate_dollar(b, p); break;
+        case c_mathassign:    generate_integer_assign(b, p, SN_OP_SET_VAR); break;
+        case c_plusassign:    generate_integer_assign(b, p, SN_OP_ADD_VAR); break;
+        case c_minusassign:   generate_integer_assign(b, p, SN_OP_SUB_VAR); break;
+        case c_multiplyassign:generate_integer_assign(b, p, SN_OP_MUL_VAR); break;
+        case c_divideassign:  generate_integer_assign(b, p, SN_OP_DIV_VAR); break;
+        case c_eq:            generate_integer_test(b, p, SN_OP_TEST_EQ); break;
+        case c_ne:            generate_integer_test(b, p, SN_OP_TEST_NE); break;
+        case c_gr:            generate_integer_test(b, p, SN_OP_TEST_GT); break;
+        case c_ge:            generate_integer_test(b, p, SN_OP_TEST_GE); break;
+        case c_ls:            generate_integer_test(b, p, SN_OP_TEST_LT); break;
+        case c_le:            generate_integer_test(b, p, SN_OP_TEST_LE); break;
+        case c_call:
+            emit_test(b, SN_OP_CALL);
+            emit(b, routine_index(b, p->name));
+            break;
+        case c_grouping:
+        case c_non:
+            emit_test(b, (p->type == c_grouping ? SN_OP_GROUPING : SN_OP_NON) +
+                         (mode == m_backward));
+            emit(b, p->name->count);
+            break;
+        case c_name:
+            emit_test(b, mode == m_forward ? SN_OP_EQ_V : SN_OP_EQ_V_B);
+            emit(b, variable_index(b, p->name));
+            break;
+        case c_literalstring: generate_literalstring(b, p); break;
+        case c_among:         generate_among(b, p); break;
+        case c_substring:     generate_substring(b, p); break;
+        case c_booltest:
+            emit_test(b, SN_OP_BOOLTEST);
+            emit(b, variable_index(b, p->name));
+            break;
+        case c_false:         emit_goto_failure(b); break;
+        case c_true:          break;
+        case c_debug:         break;
+        default: fprintf(stderr, "%d encountered\n", p->type);
+                 exit(1);
+    }
+
+    b->failure_label = a0;
+    b->failure_op = a1;
+    b->failure_slot = a2;
+}
+
+/* Writing the file. */
+
+static void put_word(struct bytecode * b, int n) {
+    FILE * f = b->g->options->output_src;
+    unsigned int u = (unsigned int) n;
+    putc(u & 0xFF, f);
+    putc(u >> 8 & 0xFF, f);
+    putc(u >> 16 & 0xFF, f);
+    putc(u >> 24 & 0xFF, f);
+}
+
+static void put_short(struct bytecode * b, int n) {
+    FILE * f = b->g->options->output_src;
+    putc(n & 0xFF, f);
+    putc(n >> 8 & 0xFF, f);
+}
+
+static void put_symbols(struct bytecode * b, const symbol * s, int n) {
+    FILE * f = b->g->options->output_src;
+    int i;
+    for (i = 0; i < n; i++) {
+        putc(s[i] & 0xFF, f);
+        if (b->g->options->encoding == ENC_WIDECHARS) putc(s[i] >> 8, f);
+    }
+}
+
+static void write_groupings(struct bytecode * b) {
+    struct analyser * a = b->g->analyser;
+    int n = a->name_count[t_grouping];
+    struct grouping ** v = (struct grouping **) calloc(n + 1, sizeof(struct grouping *));
+    struct grouping * q;
+    int i, j;
+    if (v == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (q = a->groupings; q; q = q->next) v[q->name->count] = q;
+    for (i = 0; i < n; i++) {
+        int min = 0, max = 0;
+        int size;
+        byte * map;
+        q = v[i];
+        if (q && SIZE(q->b) > 0) {
+            min = q->smallest_ch;
+            max = q->largest_ch;
+        }
+        size = (max - min + 8) / 8;
+        map = (byte *) calloc(size, 1);
+        if (map == NULL) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        if (q) {
+            for (j = 0; j < SIZE(q->b); j++) {
+                int ch = q->b[j] - min;
+                map[ch / 8] |= 1 << ch % 8;
+            }
+        }
+        put_word(b, min);
+        put_word(b, max);
+        fwrite(map, 1, size, b->g->options->output_src);
+        free(map);
+    }
+    free(v);
+}
+
+static void write_amongs(struct bytecode * b) {
+    struct among * x;
+    for (x = b->g->analyser->amongs; x; x = x->next) {
+        int n = x->literalstring_count;
+        int * offset = (int *) malloc((n + 1) * sizeof(int));
+        int pool_size;
+        symbol * pool;
+        int i;
+        if (offset == NULL) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        pool = among_string_pool(x, offset, &pool_size);
+        /* The runtime stores offsets, sizes and indices in 16 bits. */
+        if (pool_size > 0xFFFF || n > 0x7FFF) {
+            fprintf(stderr, "among %d is too large\n", x->number);
+            exit(1);
+        }
+        put_word(b, n);
+        put_word(b, pool_size);
+        put_symbols(b, pool, pool_size);
+        for (i = 0; i < n; i++) {
+            struct amongvec * v = &x->b[i];
+            put_short(b, offset[i]);
+            put_short(b, v->size);
+            put_short(b, v->i);
+            put_short(b, v->result);
+            put_short(b, v->function ? routine_index(b, v->function) : -1);
+        }
+        free(pool);
+        free(offset);
+    }
+}
+
+extern void generate_program_bytecode(struct generator * g) {
+    struct analyser * a = g->analyser;
+    int * name_count = a->name_count;
+    int routine_count = name_count[t_routine] + name_count[t_external];
+    struct bytecode bytecode;
+    struct bytecode * b = &bytecode;
+    struct node * p;
+    struct name * q;
+    int encoding;
+    int i;
+
+    memset(b, 0, sizeof(struct bytecode));
+    b->g = g;
+    b->routines = (struct bytecode_routine *) calloc(routine_count + 1, sizeof(struct bytecode_routine));
+    if (b->routines == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    for (p = a->program; p; p = p->right) {
+        if (p->type == c_define) generate(b, p);
+    }
+    for (i = 0; i < b->fixup_count; i++) {
+        b->code[b->fixups[i].at] = b->labels[b->fixups[i].label];
+    }
+
+    switch (g->options->encoding) {
+        case ENC_UTF8: encoding = SN_BYTECODE_UTF8; break;
+        case ENC_WIDECHARS: encoding = SN_BYTECODE_WIDECHARS; break;
+        default: encoding = SN_BYTECODE_SINGLEBYTE; break;
+    }
+    fputs(SN_BYTECODE_MAGIC, g->options->output_src);
+    put_word(b, SN_BYTECODE_VERSION);
+    put_word(b, encoding);
+    put_word(b, name_count[t_string]);
+    put_word(b, name_count[t_integer] + name_count[t_boolean]);
+    put_word(b, routine_count);
+    put_word(b, name_count[t_external]);
+    put_word(b, b->literal_count);
+    put_word(b, name_count[t_grouping]);
+    put_word(b, a->among_count);
+    put_word(b, b->code_size);
+
+    for (i = 0; i < b->literal_count; i++) {
+        put_word(b, SIZE(b->literals[i]));
+        put_symbols(b, b->literals[i], SIZE(b->literals[i]));
+    }
+    write_groupings(b);
+    write_amongs(b);
+    for (i = 0; i < routine_count; i++) {
+        struct bytecode_routine * r = &b->routines[i];
+        put_word(b, r->start);
+        put_word(b, r->size);
+        put_word(b, r->locals);
+        put_word(b, r->envs);
+    }
+    for (q = a->names; q; q = q->next) {
+        if (q->type == t_external) {
+            put_word(b, SIZE(q->b));
+            for (i = 0; i < SIZE(q->b); i++) putc(q->b[i], g->options->output_src);
+            put_word(b, routine_index(b, q));
+        }
+    }
+    for (i = 0; i < b->code_size; i++) put_word(b, b->code[i]);
+
+    free(b->code);
+    free(b->labels);
+    free(b->fixups);
+    free(b->stubs);
+    free(b->literals);
+    free(b->routines);
+}
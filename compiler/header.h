@@ -199,6 +199,9 @@ struct among {
     int nocommand_count;      /* number of "no command" entries in this among */
     int function_count;       /* in this among */
     int amongvar_needed;      /* do we need to set among_var? */
+    int packed;               /* generated packed lanes for lookup? */
+    int hashed;               /* generated a perfect hash for lookup? */
+    int translated;           /* only used in a loop done by translate()? */
     struct node * starter;    /* i.e. among( (starter) 'string' ... ) */
     struct node * substring;  /* i.e. substring ... among ( ... ) */
     struct node ** commands;  /* array with command_count entries */
@@ -212,6 +215,7 @@ struct grouping {
     int smallest_ch;          /* character with min code */
     struct name * name;       /* so g->name->grouping == g */
     int line_number;
+    byte scan_written;        /* C: nibble tables for scanning written? */
 };
 
 struct node {
@@ -219,7 +223,7 @@ struct node {
     struct node * next;
     struct node * left;
     struct node * aux;     /* used in setlimit */
-    struct among * among;  /* used in among */
+    struct among * among;  /* used in among, and repeat (see translate()) */
     struct node * right;
     int type;
     int mode;
@@ -286,6 +290,9 @@ extern void close_analyser(struct analyser * a);
 
 extern void read_program(struct analyser * a);
 
+/* Inlining and removing routines is only done if inline_routines is true. */
+extern void optimise_program(struct analyser * a, int inline_routines);
+
 struct generator {
 
     struct analyser * analyser;
@@ -344,7 +351,7 @@ struct options {
     byte syntax_tree;
     byte comments;
     enc encoding;
-    enum { LANG_JAVA, LANG_C, LANG_CPLUSPLUS, LANG_CSHARP, LANG_PASCAL, LANG_PYTHON, LANG_JAVASCRIPT, LANG_RUST, LANG_GO, LANG_ADA } make_lang;
+    enum { LANG_JAVA, LANG_C, LANG_CPLUSPLUS, LANG_CSHARP, LANG_PASCAL, LANG_PYTHON, LANG_JAVASCRIPT, LANG_RUST, LANG_GO, LANG_ADA, LANG_BYTECODE } make_lang;
     const char * externals_prefix;
     const char * variables_prefix;
     const char * runtime_path;
@@ -353,6 +360,8 @@ struct options {
     const char * go_snowball_runtime;
     const char * string_class;
     const char * among_class;
+    enum { AMONG_TABLE, AMONG_TRIE, AMONG_PACKED } among_style; /* for C and C++ */
+    byte profile;             /* C and C++: count calls and among results */
     struct include * includes;
     struct include * includes_end;
 };
@@ -378,6 +387,7 @@ extern void write_start_comment(struct generator * g,
 
 extern int K_needed(struct generator * g, struct node * p);
 extern int repeat_restore(struct generator * g, struct node * p);
+extern symbol * among_string_pool(struct among * x, int * offset, int * pool_size);
 
 /* Generator for C code. */
 extern void generate_program_c(struct generator * g);
@@ -416,3 +426,8 @@ extern void generate_program_go(struct generator * g);
 #ifndef DISABLE_ADA
 extern void generate_program_ada(struct generator * g);
 #endif
+
+#ifndef DISABLE_BYTECODE
+/* Generator for bytecode run by the interpreter in runtime/vm.c. */
+extern void generate_program_bytecode(struct generator * g);
+#endif
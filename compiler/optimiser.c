@@ -0,0 +1,390 @@
+
+#include <stdio.h>   /* fprintf etc */
+#include <stdlib.h>  /* exit */
+#include "header.h"
+
+/*  The optimiser rewrites the tree built by the analyser before any of the
+    generators see it, so all the target languages benefit.  It:
+
+        - folds integer tests whose result is known at compile time, and the
+          not, try and do of a command which is just true or false;
+        - drops alternatives of an or which can never be tried, or which can
+          never succeed;
+        - inlines routines which are small or only called once, replacing
+          each call with a bracketed copy of the routine's definition.
+
+    An inlined call behaves exactly like the call did: failing inside the
+    definition fails the call, and the cursor is left wherever the
+    definition left it.  K_needed() and repeat_restore() already look
+    through calls to the definition, so the keep and restore decisions made
+    for the code around an inlined call are unchanged, but the routine's
+    own code no longer has to be a separate function with its own
+    prologue.
+
+    A routine whose calls have all been inlined is removed unless an among
+    uses it, as are routines which are no longer called because the only
+    calls to them were in dropped alternatives.
+*/
+
+/* Inline a routine at each of its calls if its definition has at most this
+ * many command nodes. */
+#define SMALL_ROUTINE 10
+
+static struct node * new_copy(struct analyser * a, struct node * p) {
+    NEW(node, q);
+    *q = *p;
+    q->next = a->nodes; a->nodes = q;
+    return q;
+}
+
+static struct node * copy_tree(struct analyser * a, struct node * p) {
+    struct node * q;
+    if (p == 0) return 0;
+    q = new_copy(a, p);
+    q->left = copy_tree(a, p->left);
+    q->aux = copy_tree(a, p->aux);
+    q->right = copy_tree(a, p->right);
+    q->AE = copy_tree(a, p->AE);
+    return q;
+}
+
+/* The number of command nodes in p and its successors. */
+static int tree_size(struct node * p) {
+    int n = 0;
+    while (p) {
+        n += 1 + tree_size(p->left) + tree_size(p->aux);
+        p = p->right;
+    }
+    return n;
+}
+
+/* Does p or any of its successors contain a node of the given type? */
+static int contains_type(struct node * p, int type) {
+    while (p) {
+        if (p->type == type) return true;
+        if (contains_type(p->left, type) || contains_type(p->aux, type))
+            return true;
+        p = p->right;
+    }
+    return false;
+}
+
+static int count_calls(struct node * p, struct name * q) {
+    int n = 0;
+    while (p) {
+        if (p->type == c_call && p->name == q) n++;
+        n += count_calls(p->left, q) + count_calls(p->aux, q);
+        p = p->right;
+    }
+    return n;
+}
+
+/* Is there a call to q between a substring and its among?  The nodes are
+ * visited in the order they're read, which is also the order they run in. */
+static int call_after_substring(struct node * p, struct name * q, int * pending) {
+    while (p) {
+        switch (p->type) {
+            case c_substring:
+                *pending = true;
+                break;
+            case c_among:
+                if (p->among && p->among->substring) *pending = false;
+                break;
+            case c_call:
+                if (p->name == q && *pending) return true;
+                break;
+        }
+        if (call_after_substring(p->left, q, pending) ||
+            call_after_substring(p->aux, q, pending)) return true;
+        p = p->right;
+    }
+    return false;
+}
+
+/* Replace each call to q in p and its successors with (body), using a fresh
+ * copy of body for each call if copy is true. */
+static void inline_calls(struct analyser * a, struct node * p,
+                         struct name * q, struct node * body, int copy) {
+    while (p) {
+        if (p->type == c_call && p->name == q) {
+            p->type = c_bra;
+            p->name = 0;
+            p->left = copy ? copy_tree(a, body) : body;
+        } else {
+            inline_calls(a, p->left, q, body, copy);
+            inline_calls(a, p->aux, q, body, copy);
+        }
+        p = p->right;
+    }
+}
+
+/* Are two arithmetic expressions the same?  They have no side effects, so
+ * the same expression has the same value on either side of a test. */
+static int same_AE(struct node * p, struct node * q) {
+    if (p == 0 || q == 0) return p == q;
+    if (p->type != q->type) return false;
+    switch (p->type) {
+        case c_number:
+            return p->number == q->number;
+        case c_name:
+        case c_lenof:
+        case c_sizeof:
+            return p->name == q->name;
+        case c_limit:
+            return p->mode == q->mode;
+    }
+    return same_AE(p->left, q->left) && same_AE(p->right, q->right);
+}
+
+/* The result of the integer test p if it's known, or -1 if it isn't. */
+static int test_result(struct node * p) {
+    struct node * l = p->left;
+    struct node * r = p->AE;
+    if (l->type == c_number && r->type == c_number) {
+        switch (p->type) {
+            case c_eq: return l->number == r->number;
+            case c_ne: return l->number != r->number;
+            case c_gr: return l->number > r->number;
+            case c_ge: return l->number >= r->number;
+            case c_ls: return l->number < r->number;
+            case c_le: return l->number <= r->number;
+        }
+    }
+    if (same_AE(l, r)) {
+        switch (p->type) {
+            case c_eq: case c_ge: case c_le: return true;
+            case c_ne: case c_gr: case c_ls: return false;
+        }
+    }
+    /* Nothing is above maxint or below minint. */
+    if (r->type == c_maxint || l->type == c_minint) {
+        switch (p->type) {
+            case c_le: return true;
+            case c_gr: return false;
+        }
+    }
+    if (r->type == c_minint || l->type == c_maxint) {
+        switch (p->type) {
+            case c_ge: return true;
+            case c_ls: return false;
+        }
+    }
+    return -1;
+}
+
+static void make_constant(struct node * p, int result) {
+    p->type = result ? c_true : c_false;
+    p->left = 0;
+    p->AE = 0;
+    p->name = 0;
+}
+
+/* Does command p always succeed?  Errors don't count as failing here. */
+static int always_succeeds(struct node * p) {
+    switch (p->type) {
+        case c_true:
+        case c_try:
+        case c_do:
+        case c_repeat:
+        case c_set:
+        case c_unset:
+        case c_leftslice:
+        case c_rightslice:
+        case c_mathassign:
+        case c_plusassign:
+        case c_minusassign:
+        case c_multiplyassign:
+        case c_divideassign:
+        case c_debug:
+            return true;
+        case c_test:
+            return always_succeeds(p->left);
+        case c_bra:
+            for (p = p->left; p; p = p->right) {
+                if (!always_succeeds(p)) return false;
+            }
+            return true;
+        case c_or:
+            for (p = p->left; p; p = p->right) {
+                if (always_succeeds(p)) return true;
+            }
+            return false;
+    }
+    return false;
+}
+
+/* Can alternative p of an or be dropped without changing anything but
+ * whether it's reached?  An among and its substring have to stay together,
+ * and the among tables are written out whether they're used or not. */
+static int droppable(struct node * p) {
+    return !contains_type(p, c_among) && !contains_type(p, c_substring);
+}
+
+static void fold_or(struct node * p) {
+    struct node ** ptr = &p->left;
+    struct node * q;
+    while ((q = *ptr) != 0) {
+        if (q->type == c_false && q->right) {
+            /* Never succeeds, and leaves the cursor alone for the next. */
+            *ptr = q->right;
+            continue;
+        }
+        if (q->right && always_succeeds(q) && droppable(q->right)) {
+            /* All the later alternatives are unreachable. */
+            q->right = 0;
+        }
+        ptr = &q->right;
+    }
+    if (p->left->right == 0) {
+        /* Only one alternative left, which behaves the same on its own. */
+        if (p->left->type == c_false) {
+            make_constant(p, false);
+        } else {
+            p->type = c_bra;
+        }
+    }
+}
+
+static void fold(struct node * p) {
+    while (p) {
+        fold(p->left);
+        fold(p->aux);
+        switch (p->type) {
+            case c_eq:
+            case c_ne:
+            case c_gr:
+            case c_ge:
+            case c_ls:
+            case c_le: {
+                int result = test_result(p);
+                if (result >= 0) make_constant(p, result);
+                break;
+            }
+            case c_not:
+                if (p->left->type == c_true || p->left->type == c_false) {
+                    make_constant(p, p->left->type == c_false);
+                }
+                break;
+            case c_try:
+            case c_do:
+                if (p->left->type == c_true || p->left->type == c_false) {
+                    make_constant(p, true);
+                }
+                break;
+            case c_or:
+                fold_or(p);
+                break;
+        }
+        p = p->right;
+    }
+}
+
+/* Remove routine q, which is defined by c_define node d. */
+static void remove_routine(struct analyser * a, struct name * q, struct node * d) {
+    struct node ** ptr = &a->program;
+    struct name ** qptr = &a->names;
+    struct node * prev = 0;
+    while (*ptr != d) {
+        prev = *ptr;
+        ptr = &(*ptr)->right;
+    }
+    *ptr = d->right;
+    if (a->program_end == d) a->program_end = prev;
+
+    while (*qptr != q) qptr = &(*qptr)->next;
+    *qptr = q->next;
+    lose_b(q->b);
+    FREE(q);
+}
+
+static struct node * find_define(struct analyser * a, struct name * q) {
+    struct node * d;
+    for (d = a->program; d; d = d->right) {
+        if (d->type == c_define && d->name == q) return d;
+    }
+    fprintf(stderr, "No definition found for routine\n");
+    exit(1);
+}
+
+/* The definition which contains the only call to q. */
+static struct node * find_caller(struct analyser * a, struct name * q) {
+    struct node * d;
+    for (d = a->program; d; d = d->right) {
+        if (count_calls(d->left, q)) return d;
+    }
+    fprintf(stderr, "No caller found for routine\n");
+    exit(1);
+}
+
+/* Try to inline or remove routine q, returning true if anything changed. */
+static int optimise_routine(struct analyser * a, struct name * q, int was_used) {
+    struct node * d = find_define(a, q);
+    struct node * body = d->left;
+    int calls = count_calls(a->program, q);
+    int has_among = contains_type(body, c_among) || contains_type(body, c_substring);
+
+    if (calls == 0) {
+        /* Only remove routines which stopped being called because of the
+         * optimiser, as the analyser has already warned about the others.
+         * Removing one with an among would leave its table unused. */
+        if (!was_used || q->used_in_among || has_among) return false;
+        remove_routine(a, q, d);
+        return true;
+    }
+
+    if (calls == 1 && !q->used_in_among) {
+        /* Move the definition to the call, so there's no copy to make. */
+        struct node * caller = find_caller(a, q);
+        if (caller == d) return false; /* Recursive. */
+        if (has_among) {
+            /* An inlined among sets among_var, so mustn't go between a
+             * substring and its among. */
+            int pending = false;
+            if (call_after_substring(caller->left, q, &pending)) return false;
+            if (d->amongvar_needed) caller->amongvar_needed = true;
+        }
+        inline_calls(a, caller->left, q, body, false);
+        remove_routine(a, q, d);
+        return true;
+    }
+
+    /* Copying an among would need a copy of its table too, and copying a
+     * routine which makes calls could go on for ever if it's recursive. */
+    if (has_among || contains_type(body, c_call)) return false;
+    if (tree_size(body) > SMALL_ROUTINE) return false;
+    inline_calls(a, a->program, q, body, true);
+    if (!q->used_in_among) remove_routine(a, q, d);
+    return true;
+}
+
+extern void optimise_program(struct analyser * a, int inline_routines) {
+    struct name * q;
+    int changed;
+    fold(a->program);
+    if (!inline_routines) return;
+
+    /* Inlining a routine can make another one small enough, or leave a
+     * routine with one call, so repeat until nothing changes. */
+    do {
+        changed = false;
+        q = a->names;
+        while (q) {
+            struct name * q_next = q->next;
+            if (q->type == t_routine && q->definition &&
+                optimise_routine(a, q, q->used != 0)) {
+                changed = true;
+            }
+            q = q_next;
+        }
+    } while (changed);
+
+    {
+        /* Renumber now some routines may have gone. */
+        int * name_count = a->name_count;
+        int i;
+        for (i = 0; i < t_size; i++) name_count[i] = 0;
+        for (q = a->names; q; q = q->next) {
+            q->count = name_count[q->type]++;
+        }
+    }
+}
@@ -0,0 +1,232 @@
+/* This program compares the speed of a stemmer compiled to C with the same
+ * stemmer compiled with "snowball -bytecode" and run by the interpreter in
+ * the C runtime.  It stems every word of the input with both, checks they
+ * agree, and reports how long each took.
+ */
+
+#include <stdio.h>
+#include <stdlib.h> /* for malloc, free, exit */
+#include <string.h> /* for strcmp, memcmp */
+#include <time.h>   /* for clock */
+
+#include "libstemmer.h"
+
+const char * progname;
+
+struct words {
+    sb_symbol * text;   /* the words, each followed by '\n' */
+    int * starts;       /* where each word starts in text */
+    int * lengths;
+    int count;
+};
+
+static void *
+check_alloc(void * p)
+{
+    if (p == NULL) {
+        fprintf(stderr, "Out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+static char *
+read_file(const char * name, FILE * f, size_t * size_p)
+{
+    char * data = NULL;
+    size_t size = 0;
+    size_t capacity = 0;
+    size_t n;
+    if (f == 0) {
+        fprintf(stderr, "file %s not found\n", name);
+        exit(1);
+    }
+    do {
+        if (size == capacity) {
+            capacity = capacity ? capacity * 2 : 4096;
+            data = (char *) check_alloc(realloc(data, capacity));
+        }
+        n = fread(data + size, 1, capacity - size, f);
+        size += n;
+    } while (n > 0);
+    *size_p = size;
+    return data;
+}
+
+/* Split the input into lines, dropping any '\r' and empty lines. */
+static void
+split_words(struct words * w, char * text, size_t size)
+{
+    size_t i = 0;
+    int capacity = 1024;
+    w->text = (sb_symbol *) text;
+    w->count = 0;
+    w->starts = (int *) check_alloc(malloc(capacity * sizeof(int)));
+    w->lengths = (int *) check_alloc(malloc(capacity * sizeof(int)));
+    while (i < size) {
+        size_t start = i;
+        size_t end;
+        while (i < size && text[i] != '\n') i++;
+        end = i++;
+        if (end > start && text[end - 1] == '\r') end--;
+        if (end == start) continue;
+        if (w->count == capacity) {
+            capacity *= 2;
+            w->starts = (int *) check_alloc(realloc(w->starts, capacity * sizeof(int)));
+            w->lengths = (int *) check_alloc(realloc(w->lengths, capacity * sizeof(int)));
+        }
+        w->starts[w->count] = (int) start;
+        w->lengths[w->count] = (int) (end - start);
+        w->count++;
+    }
+}
+
+/* Stem all the words repeats times, returning the seconds taken. */
+static double
+time_stemmer(struct sb_stemmer * stemmer, const struct words * w, int repeats)
+{
+    clock_t start = clock();
+    int r, i;
+    for (r = 0; r < repeats; r++) {
+        for (i = 0; i < w->count; i++) {
+            if (sb_stemmer_stem(stemmer, w->text + w->starts[i], w->lengths[i]) == NULL) {
+                fprintf(stderr, "Out of memory\n");
+                exit(1);
+            }
+        }
+    }
+    return (double) (clock() - start) / CLOCKS_PER_SEC;
+}
+
+/* Check both stemmers give the same stem for every word. */
+static int
+compare_stemmers(struct sb_stemmer * a, struct sb_stemmer * b, const struct words * w)
+{
+    int differences = 0;
+    int i;
+    for (i = 0; i < w->count; i++) {
+        const sb_symbol * word = w->text + w->starts[i];
+        const sb_symbol * stem_a = sb_stemmer_stem(a, word, w->lengths[i]);
+        int len_a = sb_stemmer_length(a);
+        const sb_symbol * stem_b = sb_stemmer_stem(b, word, w->lengths[i]);
+        int len_b = sb_stemmer_length(b);
+        if (stem_a == NULL || stem_b == NULL) {
+            fprintf(stderr, "Out of memory\n");
+            exit(1);
+        }
+        /* sb_stemmer_stem() returns a buffer owned by the stemmer, so
+         * stem_a is still valid after stemming with b. */
+        if (len_a != len_b || memcmp(stem_a, stem_b, len_a) != 0) {
+            if (differences++ < 10) {
+                fprintf(stderr, "stems differ for `%.*s': `%.*s' and `%.*s'\n",
+                        w->lengths[i], (const char *) word,
+                        len_a, (const char *) stem_a,
+                        len_b, (const char *) stem_b);
+            }
+        }
+    }
+    return differences;
+}
+
+/** Display the command line syntax, and then exit.
+ *  @param n The value to exit with.
+ */
+static void
+usage(int n)
+{
+    printf("usage: %s -l <language> -b <bytecode file> [-i <input file>] [-c <character encoding>] [-r <repeats>] [-h]\n"
+          "\n"
+          "Stem each word of the input (one per line) with both the compiled\n"
+          "stemmer for the language and the bytecode stemmer, check the stems\n"
+          "are the same, and report the time each took.\n"
+          "\n"
+          "The input file defaults to stdin, and the character encoding to\n"
+          "UTF-8.  The words are stemmed <repeats> times (default 10) by each\n"
+          "stemmer, after one pass to compare them.\n"
+          , progname);
+    exit(n);
+}
+
+int
+main(int argc, char * argv[])
+{
+    const char * language = NULL;
+    const char * bytecode = NULL;
+    const char * in = NULL;
+    const char * charenc = NULL;
+    int repeats = 10;
+    struct sb_stemmer * compiled;
+    struct sb_stemmer * interpreted;
+    struct words w;
+    char * data;
+    size_t size;
+    double t_compiled, t_interpreted;
+    int i;
+
+    progname = argv[0];
+    for (i = 1; i < argc; i++) {
+        const char * s = argv[i];
+        if (s[0] != '-') usage(1);
+        if (strcmp(s, "-h") == 0) usage(0);
+        if (i + 1 >= argc || s[1] == 0 || s[2] != 0) usage(1);
+        switch (s[1]) {
+            case 'l': language = argv[++i]; break;
+            case 'b': bytecode = argv[++i]; break;
+            case 'i': in = argv[++i]; break;
+            case 'c': charenc = argv[++i]; break;
+            case 'r':
+                repeats = atoi(argv[++i]);
+                if (repeats <= 0) usage(1);
+                break;
+            default: usage(1);
+        }
+    }
+    if (language == NULL || bytecode == NULL) usage(1);
+
+    compiled = sb_stemmer_new(language, charenc);
+    if (compiled == 0) {
+        fprintf(stderr, "language `%s' not available for stemming\n", language);
+        exit(1);
+    }
+    {
+        FILE * f = fopen(bytecode, "rb");
+        data = read_file(bytecode, f, &size);
+        (void) fclose(f);
+        interpreted = sb_stemmer_new_from_bytecode(data, size);
+        free(data);
+        if (interpreted == 0) {
+            fprintf(stderr, "%s isn't a stemmer this library can run\n", bytecode);
+            exit(1);
+        }
+    }
+
+    if (in == NULL) {
+        data = read_file("stdin", stdin, &size);
+    } else {
+        FILE * f = fopen(in, "rb");
+        data = read_file(in, f, &size);
+        (void) fclose(f);
+    }
+    split_words(&w, data, size);
+
+    if (compare_stemmers(compiled, interpreted, &w) != 0) {
+        fprintf(stderr, "%s doesn't stem the same as the compiled %s stemmer\n",
+                bytecode, language);
+        exit(1);
+    }
+
+    t_compiled = time_stemmer(compiled, &w, repeats);
+    t_interpreted = time_stemmer(interpreted, &w, repeats);
+    printf("%d words, %d times\n", w.count, repeats);
+    printf("compiled:    %.3fs\n", t_compiled);
+    printf("interpreted: %.3fs", t_interpreted);
+    if (t_compiled > 0) printf(" (%.2f times as long)", t_interpreted / t_compiled);
+    printf("\n");
+
+    sb_stemmer_delete(compiled);
+    sb_stemmer_delete(interpreted);
+    free(w.starts);
+    free(w.lengths);
+    free(data);
+    return 0;
+}
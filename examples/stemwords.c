@@ -11,6 +11,60 @@
 
 const char * progname;
 static int pretty = 1;
+static int utf8 = 1;
+static int casefold = 0;
+
+static void
+write_stem(FILE * f_out, const sb_symbol * b, int len, int inlen,
+           const sb_symbol * stemmed, int stemmed_len)
+{
+    if (pretty == 1) {
+        fwrite(b, len, 1, f_out);
+        fputs(" -> ", f_out);
+    } else if (pretty == 2) {
+        fwrite(b, len, 1, f_out);
+        if (stemmed_len > 0) {
+            int j;
+            if (inlen < 30) {
+                for (j = 30 - inlen; j > 0; j--)
+                    fputs(" ", f_out);
+            } else {
+                fputs("\n", f_out);
+                for (j = 30; j > 0; j--)
+                    fputs(" ", f_out);
+            }
+        }
+    }
+
+    fwrite(stemmed, stemmed_len, 1, f_out);
+    putc('\n', f_out);
+}
+
+/* Count the utf-8 characters in a word. */
+static int
+utf8_length(const sb_symbol * b, int len)
+{
+    int i, n = 0;
+    for (i = 0; i < len; i++) {
+        if (b[i] < 0x80 || b[i] > 0xBF) n += 1;
+    }
+    return n;
+}
+
+/* Write the word b[0..len) forced to lower case to out, which must have
+ * room for len + len / 2 symbols, and return the length written. */
+static int
+lower_case(const sb_symbol * b, int len, sb_symbol * out)
+{
+    int i;
+    if (casefold && utf8) {
+        int n = sb_casefold_utf8(b, len, out, len + len / 2);
+        if (n >= 0) return n;
+        /* Not valid UTF-8, so just map A-Z to a-z. */
+    }
+    for (i = 0; i < len; i++) out[i] = tolower(b[i]);
+    return len;
+}
 
 static void
 stem_file(struct sb_stemmer * stemmer, FILE * f_in, FILE * f_out)
@@ -18,15 +72,16 @@ stem_file(struct sb_stemmer * stemmer, FILE * f_in, FILE * f_out)
 #define INC 10
     int lim = INC;
     sb_symbol * b = (sb_symbol *) malloc(lim * sizeof(sb_symbol));
+    int lower_lim = INC;
+    sb_symbol * lower = (sb_symbol *) malloc(lower_lim * sizeof(sb_symbol));
 
     while (1) {
         int ch = getc(f_in);
         if (ch == EOF) {
-            free(b); return;
+            free(b); free(lower); return;
         }
         {
             int i = 0;
-            int inlen = 0;
             while (ch != '\n' && ch != EOF) {
                 if (i == lim) {
                     sb_symbol * newb;
@@ -36,50 +91,158 @@ stem_file(struct sb_stemmer * stemmer, FILE * f_in, FILE * f_out)
                     b = newb;
                     lim = lim + INC;
                 }
-                /* Update count of utf-8 characters. */
-                if (ch < 0x80 || ch > 0xBF) inlen += 1;
-                /* force lower case: */
-                ch = tolower(ch);
-
                 b[i] = ch;
                 i++;
                 ch = getc(f_in);
             }
 
+            if (i + i / 2 > lower_lim) {
+                sb_symbol * newlower;
+                newlower = (sb_symbol *)
+                        realloc(lower, (i + i / 2 + INC) * sizeof(sb_symbol));
+                if (newlower == 0) goto error;
+                lower = newlower;
+                lower_lim = i + i / 2 + INC;
+            }
+            /* force lower case: */
+            i = lower_case(b, i, lower);
+
             {
-                const sb_symbol * stemmed = sb_stemmer_stem(stemmer, b, i);
+                const sb_symbol * stemmed = sb_stemmer_stem(stemmer, lower, i);
                 if (stemmed == NULL)
                 {
                     fprintf(stderr, "Out of memory");
                     exit(1);
                 }
 
-                if (pretty == 1) {
-                    fwrite(b, i, 1, f_out);
-                    fputs(" -> ", f_out);
-                } else if (pretty == 2) {
-                    fwrite(b, i, 1, f_out);
-                    if (sb_stemmer_length(stemmer) > 0) {
-                        int j;
-                        if (inlen < 30) {
-                            for (j = 30 - inlen; j > 0; j--)
-                                fputs(" ", f_out);
-                        } else {
-                            fputs("\n", f_out);
-                            for (j = 30; j > 0; j--)
-                                fputs(" ", f_out);
-                        }
-                    }
-                }
-
-                fputs((const char *)stemmed, f_out);
-                putc('\n', f_out);
+                write_stem(f_out, lower, i, utf8_length(lower, i),
+                           stemmed, sb_stemmer_length(stemmer));
             }
         }
     }
 error:
     if (b != 0) free(b);
+    if (lower != 0) free(lower);
+    return;
+}
+
+/* Read the whole input, and stem it using several threads. */
+static void
+stem_file_parallel(const struct sb_algorithm * algorithm, int threads,
+                   FILE * f_in, FILE * f_out)
+{
+    int words_lim = 4096, words_len = 0;
+    int count_lim = 1024, count = 0;
+    sb_symbol * words = (sb_symbol *) malloc(words_lim);
+    int line_lim = 64, line_len = 0;
+    sb_symbol * line = (sb_symbol *) malloc(line_lim);
+    int * offsets = (int *) malloc(count_lim * sizeof(int));
+    sb_symbol * out = NULL;
+    int * out_offsets = NULL;
+    int out_size;
+    int i;
+    int ch;
+
+    if (words == NULL || offsets == NULL || line == NULL) goto oom;
+    offsets[0] = 0;
+    while (1) {
+        ch = getc(f_in);
+        if (ch != '\n' && ch != EOF) {
+            if (line_len == line_lim) {
+                sb_symbol * p = (sb_symbol *) realloc(line, line_lim * 2);
+                if (p == NULL) goto oom;
+                line = p;
+                line_lim *= 2;
+            }
+            line[line_len++] = ch;
+            continue;
+        }
+        if (ch == EOF && line_len == 0) break;
+        while (words_len + line_len + line_len / 2 > words_lim) {
+            sb_symbol * p = (sb_symbol *) realloc(words, words_lim * 2);
+            if (p == NULL) goto oom;
+            words = p;
+            words_lim *= 2;
+        }
+        if (count + 2 > count_lim) {
+            int * p = (int *) realloc(offsets, count_lim * 2 * sizeof(int));
+            if (p == NULL) goto oom;
+            offsets = p;
+            count_lim *= 2;
+        }
+        /* force lower case: */
+        words_len += lower_case(line, line_len, words + words_len);
+        line_len = 0;
+        offsets[++count] = words_len;
+        if (ch == EOF) break;
+    }
+
+    out_size = words_len + words_len / 2 + 64;
+    out_offsets = (int *) malloc((count + 1) * sizeof(int));
+    if (out_offsets == NULL) goto oom;
+    while (1) {
+        int n;
+        out = (sb_symbol *) malloc(out_size);
+        if (out == NULL) goto oom;
+        n = sb_stemmer_stem_parallel(algorithm, threads, words, offsets, count,
+                                     out, out_size, out_offsets);
+        if (n < 0) goto oom;
+        if (n <= out_size) break;
+        free(out);
+        out_size = n;
+    }
+
+    for (i = 0; i < count; i++) {
+        const sb_symbol * b = words + offsets[i];
+        int len = offsets[i + 1] - offsets[i];
+        write_stem(f_out, b, len, utf8_length(b, len),
+                   out + out_offsets[i], out_offsets[i + 1] - out_offsets[i]);
+    }
+    free(words);
+    free(line);
+    free(offsets);
+    free(out);
+    free(out_offsets);
     return;
+oom:
+    fprintf(stderr, "Out of memory");
+    exit(1);
+}
+
+/* Load a stemmer from the bytecode in the named file. */
+static struct sb_stemmer *
+load_bytecode(const char * name)
+{
+    struct sb_stemmer * stemmer;
+    FILE * f = fopen(name, "rb");
+    char * data = NULL;
+    size_t size = 0;
+    size_t capacity = 0;
+    size_t n;
+    if (f == 0) {
+        fprintf(stderr, "file %s not found\n", name);
+        exit(1);
+    }
+    do {
+        if (size == capacity) {
+            capacity = capacity ? capacity * 2 : 4096;
+            data = (char *) realloc(data, capacity);
+            if (data == NULL) {
+                fprintf(stderr, "Out of memory\n");
+                exit(1);
+            }
+        }
+        n = fread(data + size, 1, capacity - size, f);
+        size += n;
+    } while (n > 0);
+    (void) fclose(f);
+    stemmer = sb_stemmer_new_from_bytecode(data, size);
+    free(data);
+    if (stemmer == 0) {
+        fprintf(stderr, "%s isn't a stemmer this library can run\n", name);
+        exit(1);
+    }
+    return stemmer;
 }
 
 /** Display the command line syntax, and then exit.
@@ -88,13 +251,16 @@ error:
 static void
 usage(int n)
 {
-    printf("usage: %s [-l <language>] [-i <input file>] [-o <output file>] [-c <character encoding>] [-p[2]] [-h]\n"
+    printf("usage: %s [-l <language>] [-i <input file>] [-o <output file>] [-c <character encoding>] [-b <bytecode file>] [-f] [-p[2]] [-t <threads>] [-h]\n"
           "\n"
           "The input file consists of a list of words to be stemmed, one per\n"
           "line. Words should be in lower case, but (for English) A-Z letters\n"
           "are mapped to their a-z equivalents anyway. If omitted, stdin is\n"
           "used.\n"
           "\n"
+          "If -f is given, UTF-8 words are case folded using Unicode case\n"
+          "folding instead.\n"
+          "\n"
           "If -c is given, the argument is the character encoding of the input\n"
           "and output files.  If it is omitted, the UTF-8 encoding is used.\n"
           "\n"
@@ -106,6 +272,12 @@ usage(int n)
           "Otherwise, the output file consists of the stemmed words, one per\n"
           "line.\n"
           "\n"
+          "If -b is given, the stemmer is loaded from a file written by\n"
+          "\"snowball -bytecode\" instead of using -l.\n"
+          "\n"
+          "If -t is given, the whole input is read and then stemmed using the\n"
+          "specified number of threads.\n"
+          "\n"
           "-h displays this help\n",
           progname);
     exit(n);
@@ -118,10 +290,13 @@ main(int argc, char * argv[])
     const char * out = 0;
     FILE * f_in;
     FILE * f_out;
+    const struct sb_algorithm * algorithm;
     struct sb_stemmer * stemmer;
 
     const char * language = "english";
     const char * charenc = NULL;
+    const char * bytecode = NULL;
+    int threads = 0;
 
     int i = 1;
     pretty = 0;
@@ -155,6 +330,20 @@ main(int argc, char * argv[])
                     exit(1);
                 }
                 charenc = argv[i++];
+            } else if (strcmp(s, "-b") == 0) {
+                if (i >= argc) {
+                    fprintf(stderr, "%s requires an argument\n", s);
+                    exit(1);
+                }
+                bytecode = argv[i++];
+            } else if (strcmp(s, "-t") == 0) {
+                if (i >= argc) {
+                    fprintf(stderr, "%s requires an argument\n", s);
+                    exit(1);
+                }
+                threads = atoi(argv[i++]);
+            } else if (strcmp(s, "-f") == 0) {
+                casefold = 1;
             } else if (strcmp(s, "-p2") == 0) {
                 pretty = 2;
             } else if (strcmp(s, "-p") == 0) {
@@ -183,8 +372,20 @@ main(int argc, char * argv[])
         exit(1);
     }
 
+    if (charenc != NULL && strcmp(charenc, "UTF_8") != 0) utf8 = 0;
+
     /* do the stemming process: */
-    stemmer = sb_stemmer_new(language, charenc);
+    if (bytecode != NULL) {
+        if (threads > 0) {
+            fprintf(stderr, "-t can't be used with -b\n");
+            exit(1);
+        }
+        algorithm = NULL;
+        stemmer = load_bytecode(bytecode);
+    } else {
+        algorithm = sb_algorithm_find(language, charenc);
+        stemmer = sb_stemmer_new_from_algorithm(algorithm);
+    }
     if (stemmer == 0) {
         if (charenc == NULL) {
             fprintf(stderr, "language `%s' not available for stemming\n", language);
@@ -194,7 +395,11 @@ main(int argc, char * argv[])
             exit(1);
         }
     }
-    stem_file(stemmer, f_in, f_out);
+    if (threads > 0) {
+        stem_file_parallel(algorithm, threads, f_in, f_out);
+    } else {
+        stem_file(stemmer, f_in, f_out);
+    }
     sb_stemmer_delete(stemmer);
 
     if (in != 0) (void) fclose(f_in);
@@ -0,0 +1,1283 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package arabic
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "\u0640", A: -1, B: 1, F: nil},
+	{Str: "\u064B", A: -1, B: 1, F: nil},
+	{Str: "\u064C", A: -1, B: 1, F: nil},
+	{Str: "\u064D", A: -1, B: 1, F: nil},
+	{Str: "\u064E", A: -1, B: 1, F: nil},
+	{Str: "\u064F", A: -1, B: 1, F: nil},
+	{Str: "\u0650", A: -1, B: 1, F: nil},
+	{Str: "\u0651", A: -1, B: 1, F: nil},
+	{Str: "\u0652", A: -1, B: 1, F: nil},
+	{Str: "\u0660", A: -1, B: 2, F: nil},
+	{Str: "\u0661", A: -1, B: 3, F: nil},
+	{Str: "\u0662", A: -1, B: 4, F: nil},
+	{Str: "\u0663", A: -1, B: 5, F: nil},
+	{Str: "\u0664", A: -1, B: 6, F: nil},
+	{Str: "\u0665", A: -1, B: 7, F: nil},
+	{Str: "\u0666", A: -1, B: 8, F: nil},
+	{Str: "\u0667", A: -1, B: 9, F: nil},
+	{Str: "\u0668", A: -1, B: 10, F: nil},
+	{Str: "\u0669", A: -1, B: 11, F: nil},
+	{Str: "\uFE80", A: -1, B: 12, F: nil},
+	{Str: "\uFE81", A: -1, B: 16, F: nil},
+	{Str: "\uFE82", A: -1, B: 16, F: nil},
+	{Str: "\uFE83", A: -1, B: 13, F: nil},
+	{Str: "\uFE84", A: -1, B: 13, F: nil},
+	{Str: "\uFE85", A: -1, B: 17, F: nil},
+	{Str: "\uFE86", A: -1, B: 17, F: nil},
+	{Str: "\uFE87", A: -1, B: 14, F: nil},
+	{Str: "\uFE88", A: -1, B: 14, F: nil},
+	{Str: "\uFE89", A: -1, B: 15, F: nil},
+	{Str: "\uFE8A", A: -1, B: 15, F: nil},
+	{Str: "\uFE8B", A: -1, B: 15, F: nil},
+	{Str: "\uFE8C", A: -1, B: 15, F: nil},
+	{Str: "\uFE8D", A: -1, B: 18, F: nil},
+	{Str: "\uFE8E", A: -1, B: 18, F: nil},
+	{Str: "\uFE8F", A: -1, B: 19, F: nil},
+	{Str: "\uFE90", A: -1, B: 19, F: nil},
+	{Str: "\uFE91", A: -1, B: 19, F: nil},
+	{Str: "\uFE92", A: -1, B: 19, F: nil},
+	{Str: "\uFE93", A: -1, B: 20, F: nil},
+	{Str: "\uFE94", A: -1, B: 20, F: nil},
+	{Str: "\uFE95", A: -1, B: 21, F: nil},
+	{Str: "\uFE96", A: -1, B: 21, F: nil},
+	{Str: "\uFE97", A: -1, B: 21, F: nil},
+	{Str: "\uFE98", A: -1, B: 21, F: nil},
+	{Str: "\uFE99", A: -1, B: 22, F: nil},
+	{Str: "\uFE9A", A: -1, B: 22, F: nil},
+	{Str: "\uFE9B", A: -1, B: 22, F: nil},
+	{Str: "\uFE9C", A: -1, B: 22, F: nil},
+	{Str: "\uFE9D", A: -1, B: 23, F: nil},
+	{Str: "\uFE9E", A: -1, B: 23, F: nil},
+	{Str: "\uFE9F", A: -1, B: 23, F: nil},
+	{Str: "\uFEA0", A: -1, B: 23, F: nil},
+	{Str: "\uFEA1", A: -1, B: 24, F: nil},
+	{Str: "\uFEA2", A: -1, B: 24, F: nil},
+	{Str: "\uFEA3", A: -1, B: 24, F: nil},
+	{Str: "\uFEA4", A: -1, B: 24, F: nil},
+	{Str: "\uFEA5", A: -1, B: 25, F: nil},
+	{Str: "\uFEA6", A: -1, B: 25, F: nil},
+	{Str: "\uFEA7", A: -1, B: 25, F: nil},
+	{Str: "\uFEA8", A: -1, B: 25, F: nil},
+	{Str: "\uFEA9", A: -1, B: 26, F: nil},
+	{Str: "\uFEAA", A: -1, B: 26, F: nil},
+	{Str: "\uFEAB", A: -1, B: 27, F: nil},
+	{Str: "\uFEAC", A: -1, B: 27, F: nil},
+	{Str: "\uFEAD", A: -1, B: 28, F: nil},
+	{Str: "\uFEAE", A: -1, B: 28, F: nil},
+	{Str: "\uFEAF", A: -1, B: 29, F: nil},
+	{Str: "\uFEB0", A: -1, B: 29, F: nil},
+	{Str: "\uFEB1", A: -1, B: 30, F: nil},
+	{Str: "\uFEB2", A: -1, B: 30, F: nil},
+	{Str: "\uFEB3", A: -1, B: 30, F: nil},
+	{Str: "\uFEB4", A: -1, B: 30, F: nil},
+	{Str: "\uFEB5", A: -1, B: 31, F: nil},
+	{Str: "\uFEB6", A: -1, B: 31, F: nil},
+	{Str: "\uFEB7", A: -1, B: 31, F: nil},
+	{Str: "\uFEB8", A: -1, B: 31, F: nil},
+	{Str: "\uFEB9", A: -1, B: 32, F: nil},
+	{Str: "\uFEBA", A: -1, B: 32, F: nil},
+	{Str: "\uFEBB", A: -1, B: 32, F: nil},
+	{Str: "\uFEBC", A: -1, B: 32, F: nil},
+	{Str: "\uFEBD", A: -1, B: 33, F: nil},
+	{Str: "\uFEBE", A: -1, B: 33, F: nil},
+	{Str: "\uFEBF", A: -1, B: 33, F: nil},
+	{Str: "\uFEC0", A: -1, B: 33, F: nil},
+	{Str: "\uFEC1", A: -1, B: 34, F: nil},
+	{Str: "\uFEC2", A: -1, B: 34, F: nil},
+	{Str: "\uFEC3", A: -1, B: 34, F: nil},
+	{Str: "\uFEC4", A: -1, B: 34, F: nil},
+	{Str: "\uFEC5", A: -1, B: 35, F: nil},
+	{Str: "\uFEC6", A: -1, B: 35, F: nil},
+	{Str: "\uFEC7", A: -1, B: 35, F: nil},
+	{Str: "\uFEC8", A: -1, B: 35, F: nil},
+	{Str: "\uFEC9", A: -1, B: 36, F: nil},
+	{Str: "\uFECA", A: -1, B: 36, F: nil},
+	{Str: "\uFECB", A: -1, B: 36, F: nil},
+	{Str: "\uFECC", A: -1, B: 36, F: nil},
+	{Str: "\uFECD", A: -1, B: 37, F: nil},
+	{Str: "\uFECE", A: -1, B: 37, F: nil},
+	{Str: "\uFECF", A: -1, B: 37, F: nil},
+	{Str: "\uFED0", A: -1, B: 37, F: nil},
+	{Str: "\uFED1", A: -1, B: 38, F: nil},
+	{Str: "\uFED2", A: -1, B: 38, F: nil},
+	{Str: "\uFED3", A: -1, B: 38, F: nil},
+	{Str: "\uFED4", A: -1, B: 38, F: nil},
+	{Str: "\uFED5", A: -1, B: 39, F: nil},
+	{Str: "\uFED6", A: -1, B: 39, F: nil},
+	{Str: "\uFED7", A: -1, B: 39, F: nil},
+	{Str: "\uFED8", A: -1, B: 39, F: nil},
+	{Str: "\uFED9", A: -1, B: 40, F: nil},
+	{Str: "\uFEDA", A: -1, B: 40, F: nil},
+	{Str: "\uFEDB", A: -1, B: 40, F: nil},
+	{Str: "\uFEDC", A: -1, B: 40, F: nil},
+	{Str: "\uFEDD", A: -1, B: 41, F: nil},
+	{Str: "\uFEDE", A: -1, B: 41, F: nil},
+	{Str: "\uFEDF", A: -1, B: 41, F: nil},
+	{Str: "\uFEE0", A: -1, B: 41, F: nil},
+	{Str: "\uFEE1", A: -1, B: 42, F: nil},
+	{Str: "\uFEE2", A: -1, B: 42, F: nil},
+	{Str: "\uFEE3", A: -1, B: 42, F: nil},
+	{Str: "\uFEE4", A: -1, B: 42, F: nil},
+	{Str: "\uFEE5", A: -1, B: 43, F: nil},
+	{Str: "\uFEE6", A: -1, B: 43, F: nil},
+	{Str: "\uFEE7", A: -1, B: 43, F: nil},
+	{Str: "\uFEE8", A: -1, B: 43, F: nil},
+	{Str: "\uFEE9", A: -1, B: 44, F: nil},
+	{Str: "\uFEEA", A: -1, B: 44, F: nil},
+	{Str: "\uFEEB", A: -1, B: 44, F: nil},
+	{Str: "\uFEEC", A: -1, B: 44, F: nil},
+	{Str: "\uFEED", A: -1, B: 45, F: nil},
+	{Str: "\uFEEE", A: -1, B: 45, F: nil},
+	{Str: "\uFEEF", A: -1, B: 46, F: nil},
+	{Str: "\uFEF0", A: -1, B: 46, F: nil},
+	{Str: "\uFEF1", A: -1, B: 47, F: nil},
+	{Str: "\uFEF2", A: -1, B: 47, F: nil},
+	{Str: "\uFEF3", A: -1, B: 47, F: nil},
+	{Str: "\uFEF4", A: -1, B: 47, F: nil},
+	{Str: "\uFEF5", A: -1, B: 51, F: nil},
+	{Str: "\uFEF6", A: -1, B: 51, F: nil},
+	{Str: "\uFEF7", A: -1, B: 49, F: nil},
+	{Str: "\uFEF8", A: -1, B: 49, F: nil},
+	{Str: "\uFEF9", A: -1, B: 50, F: nil},
+	{Str: "\uFEFA", A: -1, B: 50, F: nil},
+	{Str: "\uFEFB", A: -1, B: 48, F: nil},
+	{Str: "\uFEFC", A: -1, B: 48, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "\u0622", A: -1, B: 1, F: nil},
+	{Str: "\u0623", A: -1, B: 1, F: nil},
+	{Str: "\u0624", A: -1, B: 1, F: nil},
+	{Str: "\u0625", A: -1, B: 1, F: nil},
+	{Str: "\u0626", A: -1, B: 1, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "\u0622", A: -1, B: 1, F: nil},
+	{Str: "\u0623", A: -1, B: 1, F: nil},
+	{Str: "\u0624", A: -1, B: 2, F: nil},
+	{Str: "\u0625", A: -1, B: 1, F: nil},
+	{Str: "\u0626", A: -1, B: 3, F: nil},
+}
+
+var A_3 = []*snowballRuntime.Among{
+	{Str: "\u0627\u0644", A: -1, B: 2, F: nil},
+	{Str: "\u0628\u0627\u0644", A: -1, B: 1, F: nil},
+	{Str: "\u0643\u0627\u0644", A: -1, B: 1, F: nil},
+	{Str: "\u0644\u0644", A: -1, B: 2, F: nil},
+}
+
+var A_4 = []*snowballRuntime.Among{
+	{Str: "\u0623\u0622", A: -1, B: 2, F: nil},
+	{Str: "\u0623\u0623", A: -1, B: 1, F: nil},
+	{Str: "\u0623\u0624", A: -1, B: 1, F: nil},
+	{Str: "\u0623\u0625", A: -1, B: 4, F: nil},
+	{Str: "\u0623\u0627", A: -1, B: 3, F: nil},
+}
+
+var A_5 = []*snowballRuntime.Among{
+	{Str: "\u0641", A: -1, B: 1, F: nil},
+	{Str: "\u0648", A: -1, B: 1, F: nil},
+}
+
+var A_6 = []*snowballRuntime.Among{
+	{Str: "\u0627\u0644", A: -1, B: 2, F: nil},
+	{Str: "\u0628\u0627\u0644", A: -1, B: 1, F: nil},
+	{Str: "\u0643\u0627\u0644", A: -1, B: 1, F: nil},
+	{Str: "\u0644\u0644", A: -1, B: 2, F: nil},
+}
+
+var A_7 = []*snowballRuntime.Among{
+	{Str: "\u0628", A: -1, B: 1, F: nil},
+	{Str: "\u0628\u0627", A: 0, B: -1, F: nil},
+	{Str: "\u0628\u0628", A: 0, B: 2, F: nil},
+	{Str: "\u0643\u0643", A: -1, B: 3, F: nil},
+}
+
+var A_8 = []*snowballRuntime.Among{
+	{Str: "\u0633\u0623", A: -1, B: 4, F: nil},
+	{Str: "\u0633\u062A", A: -1, B: 2, F: nil},
+	{Str: "\u0633\u0646", A: -1, B: 3, F: nil},
+	{Str: "\u0633\u064A", A: -1, B: 1, F: nil},
+}
+
+var A_9 = []*snowballRuntime.Among{
+	{Str: "\u062A\u0633\u062A", A: -1, B: 1, F: nil},
+	{Str: "\u0646\u0633\u062A", A: -1, B: 1, F: nil},
+	{Str: "\u064A\u0633\u062A", A: -1, B: 1, F: nil},
+}
+
+var A_10 = []*snowballRuntime.Among{
+	{Str: "\u0643", A: -1, B: 1, F: nil},
+	{Str: "\u0643\u0645", A: -1, B: 2, F: nil},
+	{Str: "\u0647\u0645", A: -1, B: 2, F: nil},
+	{Str: "\u0647\u0646", A: -1, B: 2, F: nil},
+	{Str: "\u0647", A: -1, B: 1, F: nil},
+	{Str: "\u064A", A: -1, B: 1, F: nil},
+	{Str: "\u0643\u0645\u0627", A: -1, B: 3, F: nil},
+	{Str: "\u0647\u0645\u0627", A: -1, B: 3, F: nil},
+	{Str: "\u0646\u0627", A: -1, B: 2, F: nil},
+	{Str: "\u0647\u0627", A: -1, B: 2, F: nil},
+}
+
+var A_11 = []*snowballRuntime.Among{
+	{Str: "\u0646", A: -1, B: 1, F: nil},
+}
+
+var A_12 = []*snowballRuntime.Among{
+	{Str: "\u0648", A: -1, B: 1, F: nil},
+	{Str: "\u064A", A: -1, B: 1, F: nil},
+	{Str: "\u0627", A: -1, B: 1, F: nil},
+}
+
+var A_13 = []*snowballRuntime.Among{
+	{Str: "\u0627\u062A", A: -1, B: 1, F: nil},
+}
+
+var A_14 = []*snowballRuntime.Among{
+	{Str: "\u062A", A: -1, B: 1, F: nil},
+}
+
+var A_15 = []*snowballRuntime.Among{
+	{Str: "\u0629", A: -1, B: 1, F: nil},
+}
+
+var A_16 = []*snowballRuntime.Among{
+	{Str: "\u064A", A: -1, B: 1, F: nil},
+}
+
+var A_17 = []*snowballRuntime.Among{
+	{Str: "\u0643", A: -1, B: 1, F: nil},
+	{Str: "\u0643\u0645", A: -1, B: 2, F: nil},
+	{Str: "\u0647\u0645", A: -1, B: 2, F: nil},
+	{Str: "\u0643\u0646", A: -1, B: 2, F: nil},
+	{Str: "\u0647\u0646", A: -1, B: 2, F: nil},
+	{Str: "\u0647", A: -1, B: 1, F: nil},
+	{Str: "\u0643\u0645\u0648", A: -1, B: 3, F: nil},
+	{Str: "\u0646\u064A", A: -1, B: 2, F: nil},
+	{Str: "\u0643\u0645\u0627", A: -1, B: 3, F: nil},
+	{Str: "\u0647\u0645\u0627", A: -1, B: 3, F: nil},
+	{Str: "\u0646\u0627", A: -1, B: 2, F: nil},
+	{Str: "\u0647\u0627", A: -1, B: 2, F: nil},
+}
+
+var A_18 = []*snowballRuntime.Among{
+	{Str: "\u0646", A: -1, B: 1, F: nil},
+	{Str: "\u0648\u0646", A: 0, B: 3, F: nil},
+	{Str: "\u064A\u0646", A: 0, B: 3, F: nil},
+	{Str: "\u0627\u0646", A: 0, B: 3, F: nil},
+	{Str: "\u062A\u0646", A: 0, B: 2, F: nil},
+	{Str: "\u064A", A: -1, B: 1, F: nil},
+	{Str: "\u0627", A: -1, B: 1, F: nil},
+	{Str: "\u062A\u0645\u0627", A: 6, B: 4, F: nil},
+	{Str: "\u0646\u0627", A: 6, B: 2, F: nil},
+	{Str: "\u062A\u0627", A: 6, B: 2, F: nil},
+	{Str: "\u062A", A: -1, B: 1, F: nil},
+}
+
+var A_19 = []*snowballRuntime.Among{
+	{Str: "\u062A\u0645", A: -1, B: 1, F: nil},
+	{Str: "\u0648\u0627", A: -1, B: 1, F: nil},
+}
+
+var A_20 = []*snowballRuntime.Among{
+	{Str: "\u0648", A: -1, B: 1, F: nil},
+	{Str: "\u062A\u0645\u0648", A: 0, B: 2, F: nil},
+}
+
+var A_21 = []*snowballRuntime.Among{
+	{Str: "\u0649", A: -1, B: 1, F: nil},
+}
+
+type Context struct {
+	b_is_defined bool
+	b_is_verb    bool
+	b_is_noun    bool
+}
+
+func r_Suffix_Noun_Step2a(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	env.Ket = env.Cursor
+	if env.FindAmongB(A_12, context) == 0 {
+		return false
+	}
+	env.Bra = env.Cursor
+	if !(snowballRuntime.RuneCountInString(env.Current()) > 4) {
+		return false
+	}
+	if !env.SliceDel() {
+		return false
+	}
+	return true
+}
+
+func r_Suffix_Noun_Step2b(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	env.Ket = env.Cursor
+	if env.FindAmongB(A_13, context) == 0 {
+		return false
+	}
+	env.Bra = env.Cursor
+	if !(snowballRuntime.RuneCountInString(env.Current()) >= 5) {
+		return false
+	}
+	if !env.SliceDel() {
+		return false
+	}
+	return true
+}
+
+func r_Suffix_Noun_Step2c1(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	env.Ket = env.Cursor
+	if env.FindAmongB(A_14, context) == 0 {
+		return false
+	}
+	env.Bra = env.Cursor
+	if !(snowballRuntime.RuneCountInString(env.Current()) >= 4) {
+		return false
+	}
+	if !env.SliceDel() {
+		return false
+	}
+	return true
+}
+
+func r_Suffix_Verb_Step2a(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	var among_var int32
+	env.Ket = env.Cursor
+	among_var = env.FindAmongB(A_18, context)
+	if among_var == 0 {
+		return false
+	}
+	env.Bra = env.Cursor
+	if among_var == 1 {
+		if !(snowballRuntime.RuneCountInString(env.Current()) >= 4) {
+			return false
+		}
+		if !env.SliceDel() {
+			return false
+		}
+	} else if among_var == 2 {
+		if !(snowballRuntime.RuneCountInString(env.Current()) >= 5) {
+			return false
+		}
+		if !env.SliceDel() {
+			return false
+		}
+	} else if among_var == 3 {
+		if !(snowballRuntime.RuneCountInString(env.Current()) > 5) {
+			return false
+		}
+		if !env.SliceDel() {
+			return false
+		}
+	} else if among_var == 4 {
+		if !(snowballRuntime.RuneCountInString(env.Current()) >= 6) {
+			return false
+		}
+		if !env.SliceDel() {
+			return false
+		}
+	}
+	return true
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		b_is_defined: false,
+		b_is_verb:    false,
+		b_is_noun:    false,
+	}
+	_ = context
+	var among_var int32
+	context.b_is_noun = true
+	context.b_is_verb = true
+	context.b_is_defined = false
+	var v_1 = env.Cursor
+lab0:
+	for {
+		env.Bra = env.Cursor
+		among_var = env.FindAmong(A_3, context)
+		if among_var == 0 {
+			break lab0
+		}
+		env.Ket = env.Cursor
+		if among_var == 1 {
+			if !(snowballRuntime.RuneCountInString(env.Current()) > 4) {
+				break lab0
+			}
+			context.b_is_noun = true
+			context.b_is_verb = false
+			context.b_is_defined = true
+		} else if among_var == 2 {
+			if !(snowballRuntime.RuneCountInString(env.Current()) > 3) {
+				break lab0
+			}
+			context.b_is_noun = true
+			context.b_is_verb = false
+			context.b_is_defined = true
+		}
+		break lab0
+	}
+	env.Cursor = v_1
+lab1:
+	for {
+		var v_3 = env.Cursor
+	lab2:
+		for {
+		replab3:
+			for {
+				var v_4 = env.Cursor
+			lab4:
+				for range [2]struct{}{} {
+				lab5:
+					for {
+						var v_5 = env.Cursor
+					lab6:
+						for {
+							env.Bra = env.Cursor
+							among_var = env.FindAmong(A_0, context)
+							if among_var == 0 {
+								break lab6
+							}
+							env.Ket = env.Cursor
+							if among_var == 1 {
+								if !env.SliceDel() {
+									return false
+								}
+							} else if among_var == 2 {
+								if !env.SliceFrom("0") {
+									return false
+								}
+							} else if among_var == 3 {
+								if !env.SliceFrom("1") {
+									return false
+								}
+							} else if among_var == 4 {
+								if !env.SliceFrom("2") {
+									return false
+								}
+							} else if among_var == 5 {
+								if !env.SliceFrom("3") {
+									return false
+								}
+							} else if among_var == 6 {
+								if !env.SliceFrom("4") {
+									return false
+								}
+							} else if among_var == 7 {
+								if !env.SliceFrom("5") {
+									return false
+								}
+							} else if among_var == 8 {
+								if !env.SliceFrom("6") {
+									return false
+								}
+							} else if among_var == 9 {
+								if !env.SliceFrom("7") {
+									return false
+								}
+							} else if among_var == 10 {
+								if !env.SliceFrom("8") {
+									return false
+								}
+							} else if among_var == 11 {
+								if !env.SliceFrom("9") {
+									return false
+								}
+							} else if among_var == 12 {
+								if !env.SliceFrom("\u0621") {
+									return false
+								}
+							} else if among_var == 13 {
+								if !env.SliceFrom("\u0623") {
+									return false
+								}
+							} else if among_var == 14 {
+								if !env.SliceFrom("\u0625") {
+									return false
+								}
+							} else if among_var == 15 {
+								if !env.SliceFrom("\u0626") {
+									return false
+								}
+							} else if among_var == 16 {
+								if !env.SliceFrom("\u0622") {
+									return false
+								}
+							} else if among_var == 17 {
+								if !env.SliceFrom("\u0624") {
+									return false
+								}
+							} else if among_var == 18 {
+								if !env.SliceFrom("\u0627") {
+									return false
+								}
+							} else if among_var == 19 {
+								if !env.SliceFrom("\u0628") {
+									return false
+								}
+							} else if among_var == 20 {
+								if !env.SliceFrom("\u0629") {
+									return false
+								}
+							} else if among_var == 21 {
+								if !env.SliceFrom("\u062A") {
+									return false
+								}
+							} else if among_var == 22 {
+								if !env.SliceFrom("\u062B") {
+									return false
+								}
+							} else if among_var == 23 {
+								if !env.SliceFrom("\u062C") {
+									return false
+								}
+							} else if among_var == 24 {
+								if !env.SliceFrom("\u062D") {
+									return false
+								}
+							} else if among_var == 25 {
+								if !env.SliceFrom("\u062E") {
+									return false
+								}
+							} else if among_var == 26 {
+								if !env.SliceFrom("\u062F") {
+									return false
+								}
+							} else if among_var == 27 {
+								if !env.SliceFrom("\u0630") {
+									return false
+								}
+							} else if among_var == 28 {
+								if !env.SliceFrom("\u0631") {
+									return false
+								}
+							} else if among_var == 29 {
+								if !env.SliceFrom("\u0632") {
+									return false
+								}
+							} else if among_var == 30 {
+								if !env.SliceFrom("\u0633") {
+									return false
+								}
+							} else if among_var == 31 {
+								if !env.SliceFrom("\u0634") {
+									return false
+								}
+							} else if among_var == 32 {
+								if !env.SliceFrom("\u0635") {
+									return false
+								}
+							} else if among_var == 33 {
+								if !env.SliceFrom("\u0636") {
+									return false
+								}
+							} else if among_var == 34 {
+								if !env.SliceFrom("\u0637") {
+									return false
+								}
+							} else if among_var == 35 {
+								if !env.SliceFrom("\u0638") {
+									return false
+								}
+							} else if among_var == 36 {
+								if !env.SliceFrom("\u0639") {
+									return false
+								}
+							} else if among_var == 37 {
+								if !env.SliceFrom("\u063A") {
+									return false
+								}
+							} else if among_var == 38 {
+								if !env.SliceFrom("\u0641") {
+									return false
+								}
+							} else if among_var == 39 {
+								if !env.SliceFrom("\u0642") {
+									return false
+								}
+							} else if among_var == 40 {
+								if !env.SliceFrom("\u0643") {
+									return false
+								}
+							} else if among_var == 41 {
+								if !env.SliceFrom("\u0644") {
+									return false
+								}
+							} else if among_var == 42 {
+								if !env.SliceFrom("\u0645") {
+									return false
+								}
+							} else if among_var == 43 {
+								if !env.SliceFrom("\u0646") {
+									return false
+								}
+							} else if among_var == 44 {
+								if !env.SliceFrom("\u0647") {
+									return false
+								}
+							} else if among_var == 45 {
+								if !env.SliceFrom("\u0648") {
+									return false
+								}
+							} else if among_var == 46 {
+								if !env.SliceFrom("\u0649") {
+									return false
+								}
+							} else if among_var == 47 {
+								if !env.SliceFrom("\u064A") {
+									return false
+								}
+							} else if among_var == 48 {
+								if !env.SliceFrom("\u0644\u0627") {
+									return false
+								}
+							} else if among_var == 49 {
+								if !env.SliceFrom("\u0644\u0623") {
+									return false
+								}
+							} else if among_var == 50 {
+								if !env.SliceFrom("\u0644\u0625") {
+									return false
+								}
+							} else if among_var == 51 {
+								if !env.SliceFrom("\u0644\u0622") {
+									return false
+								}
+							}
+							break lab5
+						}
+						env.Cursor = v_5
+						if env.Cursor >= env.Limit {
+							break lab4
+						}
+						env.NextChar()
+						break lab5
+					}
+					continue replab3
+				}
+				env.Cursor = v_4
+				break replab3
+			}
+			break lab2
+		}
+		env.Cursor = v_3
+		break lab1
+	}
+	env.LimitBackward = env.Cursor
+	env.Cursor = env.Limit
+	var v_6 = env.Limit - env.Cursor
+lab7:
+	for {
+	lab8:
+		for {
+			var v_7 = env.Limit - env.Cursor
+		lab9:
+			for {
+				if !context.b_is_verb {
+					break lab9
+				}
+			lab10:
+				for {
+					var v_8 = env.Limit - env.Cursor
+				lab11:
+					for {
+						var v_9 = 1
+					replab12:
+						for {
+							var v_10 = env.Limit - env.Cursor
+						lab13:
+							for range [2]struct{}{} {
+								env.Ket = env.Cursor
+								among_var = env.FindAmongB(A_17, context)
+								if among_var == 0 {
+									break lab13
+								}
+								env.Bra = env.Cursor
+								if among_var == 1 {
+									if !(snowballRuntime.RuneCountInString(env.Current()) >= 4) {
+										break lab13
+									}
+									if !env.SliceDel() {
+										return false
+									}
+								} else if among_var == 2 {
+									if !(snowballRuntime.RuneCountInString(env.Current()) >= 5) {
+										break lab13
+									}
+									if !env.SliceDel() {
+										return false
+									}
+								} else if among_var == 3 {
+									if !(snowballRuntime.RuneCountInString(env.Current()) >= 6) {
+										break lab13
+									}
+									if !env.SliceDel() {
+										return false
+									}
+								}
+								v_9--
+								continue replab12
+							}
+							env.Cursor = env.Limit - v_10
+							break replab12
+						}
+						if v_9 > 0 {
+							break lab11
+						}
+					lab14:
+						for {
+							var v_11 = env.Limit - env.Cursor
+						lab15:
+							for {
+								if !r_Suffix_Verb_Step2a(env, context) {
+									break lab15
+								}
+								break lab14
+							}
+							env.Cursor = env.Limit - v_11
+						lab16:
+							for {
+								env.Ket = env.Cursor
+								among_var = env.FindAmongB(A_20, context)
+								if among_var == 0 {
+									break lab16
+								}
+								env.Bra = env.Cursor
+								if among_var == 1 {
+									if !(snowballRuntime.RuneCountInString(env.Current()) >= 4) {
+										break lab16
+									}
+									if !env.SliceDel() {
+										return false
+									}
+								} else if among_var == 2 {
+									if !(snowballRuntime.RuneCountInString(env.Current()) >= 6) {
+										break lab16
+									}
+									if !env.SliceDel() {
+										return false
+									}
+								}
+								break lab14
+							}
+							env.Cursor = env.Limit - v_11
+							if env.Cursor <= env.LimitBackward {
+								break lab11
+							}
+							env.PrevChar()
+							break lab14
+						}
+						break lab10
+					}
+					env.Cursor = env.Limit - v_8
+				lab17:
+					for {
+						env.Ket = env.Cursor
+						if env.FindAmongB(A_19, context) == 0 {
+							break lab17
+						}
+						env.Bra = env.Cursor
+						if !(snowballRuntime.RuneCountInString(env.Current()) >= 5) {
+							break lab17
+						}
+						if !env.SliceDel() {
+							return false
+						}
+						break lab10
+					}
+					env.Cursor = env.Limit - v_8
+					if !r_Suffix_Verb_Step2a(env, context) {
+						break lab9
+					}
+					break lab10
+				}
+				break lab8
+			}
+			env.Cursor = env.Limit - v_7
+		lab18:
+			for {
+				if !context.b_is_noun {
+					break lab18
+				}
+				var v_12 = env.Limit - env.Cursor
+			lab19:
+				for {
+				lab20:
+					for {
+						var v_13 = env.Limit - env.Cursor
+					lab21:
+						for {
+							env.Ket = env.Cursor
+							if env.FindAmongB(A_15, context) == 0 {
+								break lab21
+							}
+							env.Bra = env.Cursor
+							if !(snowballRuntime.RuneCountInString(env.Current()) >= 4) {
+								break lab21
+							}
+							if !env.SliceDel() {
+								return false
+							}
+							break lab20
+						}
+						env.Cursor = env.Limit - v_13
+					lab22:
+						for {
+						lab23:
+							for {
+								if !context.b_is_defined {
+									break lab23
+								}
+								break lab22
+							}
+							env.Ket = env.Cursor
+							among_var = env.FindAmongB(A_10, context)
+							if among_var == 0 {
+								break lab22
+							}
+							env.Bra = env.Cursor
+							if among_var == 1 {
+								if !(snowballRuntime.RuneCountInString(env.Current()) >= 4) {
+									break lab22
+								}
+								if !env.SliceDel() {
+									return false
+								}
+							} else if among_var == 2 {
+								if !(snowballRuntime.RuneCountInString(env.Current()) >= 5) {
+									break lab22
+								}
+								if !env.SliceDel() {
+									return false
+								}
+							} else if among_var == 3 {
+								if !(snowballRuntime.RuneCountInString(env.Current()) >= 6) {
+									break lab22
+								}
+								if !env.SliceDel() {
+									return false
+								}
+							}
+						lab24:
+							for {
+								var v_15 = env.Limit - env.Cursor
+							lab25:
+								for {
+									if !r_Suffix_Noun_Step2a(env, context) {
+										break lab25
+									}
+									break lab24
+								}
+								env.Cursor = env.Limit - v_15
+							lab26:
+								for {
+									if !r_Suffix_Noun_Step2b(env, context) {
+										break lab26
+									}
+									break lab24
+								}
+								env.Cursor = env.Limit - v_15
+							lab27:
+								for {
+									if !r_Suffix_Noun_Step2c1(env, context) {
+										break lab27
+									}
+									break lab24
+								}
+								env.Cursor = env.Limit - v_15
+								if env.Cursor <= env.LimitBackward {
+									break lab22
+								}
+								env.PrevChar()
+								break lab24
+							}
+							break lab20
+						}
+						env.Cursor = env.Limit - v_13
+					lab28:
+						for {
+							env.Ket = env.Cursor
+							if env.FindAmongB(A_11, context) == 0 {
+								break lab28
+							}
+							env.Bra = env.Cursor
+							if !(snowballRuntime.RuneCountInString(env.Current()) > 5) {
+								break lab28
+							}
+							if !env.SliceDel() {
+								return false
+							}
+						lab29:
+							for {
+								var v_16 = env.Limit - env.Cursor
+							lab30:
+								for {
+									if !r_Suffix_Noun_Step2a(env, context) {
+										break lab30
+									}
+									break lab29
+								}
+								env.Cursor = env.Limit - v_16
+							lab31:
+								for {
+									if !r_Suffix_Noun_Step2b(env, context) {
+										break lab31
+									}
+									break lab29
+								}
+								env.Cursor = env.Limit - v_16
+								if !r_Suffix_Noun_Step2c1(env, context) {
+									break lab28
+								}
+								break lab29
+							}
+							break lab20
+						}
+						env.Cursor = env.Limit - v_13
+					lab32:
+						for {
+						lab33:
+							for {
+								if !context.b_is_defined {
+									break lab33
+								}
+								break lab32
+							}
+							if !r_Suffix_Noun_Step2a(env, context) {
+								break lab32
+							}
+							break lab20
+						}
+						env.Cursor = env.Limit - v_13
+						if !r_Suffix_Noun_Step2b(env, context) {
+							env.Cursor = env.Limit - v_12
+							break lab19
+						}
+						break lab20
+					}
+					break lab19
+				}
+				env.Ket = env.Cursor
+				if env.FindAmongB(A_16, context) == 0 {
+					break lab18
+				}
+				env.Bra = env.Cursor
+				if !(snowballRuntime.RuneCountInString(env.Current()) >= 3) {
+					break lab18
+				}
+				if !env.SliceDel() {
+					return false
+				}
+				break lab8
+			}
+			env.Cursor = env.Limit - v_7
+			env.Ket = env.Cursor
+			if env.FindAmongB(A_21, context) == 0 {
+				break lab7
+			}
+			env.Bra = env.Cursor
+			if !env.SliceFrom("\u064A") {
+				return false
+			}
+			break lab8
+		}
+		break lab7
+	}
+	env.Cursor = env.Limit - v_6
+	env.Cursor = env.LimitBackward
+	var v_18 = env.Cursor
+lab34:
+	for {
+		var v_19 = env.Cursor
+	lab35:
+		for {
+			env.Bra = env.Cursor
+			among_var = env.FindAmong(A_4, context)
+			if among_var == 0 {
+				env.Cursor = v_19
+				break lab35
+			}
+			env.Ket = env.Cursor
+			if among_var == 1 {
+				if !(snowballRuntime.RuneCountInString(env.Current()) > 3) {
+					env.Cursor = v_19
+					break lab35
+				}
+				if !env.SliceFrom("\u0623") {
+					return false
+				}
+			} else if among_var == 2 {
+				if !(snowballRuntime.RuneCountInString(env.Current()) > 3) {
+					env.Cursor = v_19
+					break lab35
+				}
+				if !env.SliceFrom("\u0622") {
+					return false
+				}
+			} else if among_var == 3 {
+				if !(snowballRuntime.RuneCountInString(env.Current()) > 3) {
+					env.Cursor = v_19
+					break lab35
+				}
+				if !env.SliceFrom("\u0627") {
+					return false
+				}
+			} else if among_var == 4 {
+				if !(snowballRuntime.RuneCountInString(env.Current()) > 3) {
+					env.Cursor = v_19
+					break lab35
+				}
+				if !env.SliceFrom("\u0625") {
+					return false
+				}
+			}
+			break lab35
+		}
+		var v_20 = env.Cursor
+	lab36:
+		for {
+			env.Bra = env.Cursor
+			if env.FindAmong(A_5, context) == 0 {
+				env.Cursor = v_20
+				break lab36
+			}
+			env.Ket = env.Cursor
+			if !(snowballRuntime.RuneCountInString(env.Current()) > 3) {
+				env.Cursor = v_20
+				break lab36
+			}
+			var v_21 = env.Cursor
+		lab37:
+			for {
+				if !env.EqS("\u0627") {
+					break lab37
+				}
+				env.Cursor = v_20
+				break lab36
+			}
+			env.Cursor = v_21
+			if !env.SliceDel() {
+				return false
+			}
+			break lab36
+		}
+	lab38:
+		for {
+			var v_22 = env.Cursor
+		lab39:
+			for {
+				env.Bra = env.Cursor
+				among_var = env.FindAmong(A_6, context)
+				if among_var == 0 {
+					break lab39
+				}
+				env.Ket = env.Cursor
+				if among_var == 1 {
+					if !(snowballRuntime.RuneCountInString(env.Current()) > 5) {
+						break lab39
+					}
+					if !env.SliceDel() {
+						return false
+					}
+				} else if among_var == 2 {
+					if !(snowballRuntime.RuneCountInString(env.Current()) > 4) {
+						break lab39
+					}
+					if !env.SliceDel() {
+						return false
+					}
+				}
+				break lab38
+			}
+			env.Cursor = v_22
+		lab40:
+			for {
+				if !context.b_is_noun {
+					break lab40
+				}
+				env.Bra = env.Cursor
+				among_var = env.FindAmong(A_7, context)
+				if among_var == 0 {
+					break lab40
+				}
+				env.Ket = env.Cursor
+				if among_var == 1 {
+					if !(snowballRuntime.RuneCountInString(env.Current()) > 3) {
+						break lab40
+					}
+					if !env.SliceDel() {
+						return false
+					}
+				} else if among_var == 2 {
+					if !(snowballRuntime.RuneCountInString(env.Current()) > 3) {
+						break lab40
+					}
+					if !env.SliceFrom("\u0628") {
+						return false
+					}
+				} else if among_var == 3 {
+					if !(snowballRuntime.RuneCountInString(env.Current()) > 3) {
+						break lab40
+					}
+					if !env.SliceFrom("\u0643") {
+						return false
+					}
+				}
+				break lab38
+			}
+			env.Cursor = v_22
+			if !context.b_is_verb {
+				break lab34
+			}
+			var v_23 = env.Cursor
+		lab41:
+			for {
+				env.Bra = env.Cursor
+				among_var = env.FindAmong(A_8, context)
+				if among_var == 0 {
+					env.Cursor = v_23
+					break lab41
+				}
+				env.Ket = env.Cursor
+				if among_var == 1 {
+					if !(snowballRuntime.RuneCountInString(env.Current()) > 4) {
+						env.Cursor = v_23
+						break lab41
+					}
+					if !env.SliceFrom("\u064A") {
+						return false
+					}
+				} else if among_var == 2 {
+					if !(snowballRuntime.RuneCountInString(env.Current()) > 4) {
+						env.Cursor = v_23
+						break lab41
+					}
+					if !env.SliceFrom("\u062A") {
+						return false
+					}
+				} else if among_var == 3 {
+					if !(snowballRuntime.RuneCountInString(env.Current()) > 4) {
+						env.Cursor = v_23
+						break lab41
+					}
+					if !env.SliceFrom("\u0646") {
+						return false
+					}
+				} else if among_var == 4 {
+					if !(snowballRuntime.RuneCountInString(env.Current()) > 4) {
+						env.Cursor = v_23
+						break lab41
+					}
+					if !env.SliceFrom("\u0623") {
+						return false
+					}
+				}
+				break lab41
+			}
+			env.Bra = env.Cursor
+			if env.FindAmong(A_9, context) == 0 {
+				break lab34
+			}
+			env.Ket = env.Cursor
+			if !(snowballRuntime.RuneCountInString(env.Current()) > 4) {
+				break lab34
+			}
+			context.b_is_verb = true
+			context.b_is_noun = false
+			if !env.SliceFrom("\u0627\u0633\u062A") {
+				return false
+			}
+			break lab38
+		}
+		break lab34
+	}
+	env.Cursor = v_18
+lab42:
+	for {
+		var v_25 = env.Cursor
+	lab43:
+		for {
+			env.LimitBackward = env.Cursor
+			env.Cursor = env.Limit
+			env.Ket = env.Cursor
+			if env.FindAmongB(A_1, context) == 0 {
+				break lab43
+			}
+			env.Bra = env.Cursor
+			if !env.SliceFrom("\u0621") {
+				return false
+			}
+			env.Cursor = env.LimitBackward
+			break lab43
+		}
+		env.Cursor = v_25
+		var v_26 = env.Cursor
+	lab44:
+		for {
+		replab45:
+			for {
+				var v_27 = env.Cursor
+			lab46:
+				for range [2]struct{}{} {
+				lab47:
+					for {
+						var v_28 = env.Cursor
+					lab48:
+						for {
+							env.Bra = env.Cursor
+							among_var = env.FindAmong(A_2, context)
+							if among_var == 0 {
+								break lab48
+							}
+							env.Ket = env.Cursor
+							if among_var == 1 {
+								if !env.SliceFrom("\u0627") {
+									return false
+								}
+							} else if among_var == 2 {
+								if !env.SliceFrom("\u0648") {
+									return false
+								}
+							} else if among_var == 3 {
+								if !env.SliceFrom("\u064A") {
+									return false
+								}
+							}
+							break lab47
+						}
+						env.Cursor = v_28
+						if env.Cursor >= env.Limit {
+							break lab46
+						}
+						env.NextChar()
+						break lab47
+					}
+					continue replab45
+				}
+				env.Cursor = v_27
+				break replab45
+			}
+			break lab44
+		}
+		env.Cursor = v_26
+		break lab42
+	}
+	return true
+}
@@ -0,0 +1,364 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package armenian
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "\u0562\u0561\u0580", A: -1, B: 1, F: nil},
+	{Str: "\u0580\u0578\u0580\u0564", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u0580\u0578\u0580\u0564", A: 1, B: 1, F: nil},
+	{Str: "\u0561\u056C\u056B", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u056F\u056B", A: -1, B: 1, F: nil},
+	{Str: "\u0578\u0580\u0561\u056F", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u0572", A: -1, B: 1, F: nil},
+	{Str: "\u057E\u0578\u0582\u0576", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u0580\u0561\u0576", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u056F\u0561\u0576", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u0576", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u0580\u0565\u0576", A: 10, B: 1, F: nil},
+	{Str: "\u0565\u056F\u0565\u0576", A: 10, B: 1, F: nil},
+	{Str: "\u0578\u0580\u0567\u0576", A: -1, B: 1, F: nil},
+	{Str: "\u056B\u0576", A: -1, B: 1, F: nil},
+	{Str: "\u0563\u056B\u0576", A: 14, B: 1, F: nil},
+	{Str: "\u0578\u057E\u056B\u0576", A: 14, B: 1, F: nil},
+	{Str: "\u056C\u0561\u0575\u0576", A: -1, B: 1, F: nil},
+	{Str: "\u057A\u0565\u057D", A: -1, B: 1, F: nil},
+	{Str: "\u056B\u057E", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u057F", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u057E\u0565\u057F", A: -1, B: 1, F: nil},
+	{Str: "\u056F\u0578\u057F", A: -1, B: 1, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "\u0561\u0580", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u0581\u0561\u0580", A: 0, B: 1, F: nil},
+	{Str: "\u0565\u0581\u0561\u0580", A: 0, B: 1, F: nil},
+	{Str: "\u0561\u0581\u0580\u056B\u0580", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u0581\u056B\u0580", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u0581\u056B\u0580", A: -1, B: 1, F: nil},
+	{Str: "\u057E\u0565\u0581\u056B\u0580", A: 5, B: 1, F: nil},
+	{Str: "\u0561\u056C\u0578\u0582\u0581", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u056C\u0578\u0582\u0581", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u0581", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u0581", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u0581\u0580\u0565\u0581", A: 10, B: 1, F: nil},
+	{Str: "\u0561\u056C\u0578\u0582", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u056C\u0578\u0582", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u0584", A: -1, B: 1, F: nil},
+	{Str: "\u0581\u0561\u0584", A: 14, B: 1, F: nil},
+	{Str: "\u0561\u0581\u0561\u0584", A: 15, B: 1, F: nil},
+	{Str: "\u0561\u0581\u0580\u056B\u0584", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u0581\u056B\u0584", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u0581\u056B\u0584", A: -1, B: 1, F: nil},
+	{Str: "\u057E\u0565\u0581\u056B\u0584", A: 19, B: 1, F: nil},
+	{Str: "\u0561\u0576\u0584", A: -1, B: 1, F: nil},
+	{Str: "\u0581\u0561\u0576\u0584", A: 21, B: 1, F: nil},
+	{Str: "\u0561\u0581\u0561\u0576\u0584", A: 22, B: 1, F: nil},
+	{Str: "\u0561\u0581\u0580\u056B\u0576\u0584", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u0581\u056B\u0576\u0584", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u0581\u056B\u0576\u0584", A: -1, B: 1, F: nil},
+	{Str: "\u057E\u0565\u0581\u056B\u0576\u0584", A: 26, B: 1, F: nil},
+	{Str: "\u0561", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u0581\u0561", A: 28, B: 1, F: nil},
+	{Str: "\u0565\u0581\u0561", A: 28, B: 1, F: nil},
+	{Str: "\u057E\u0565", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u0581\u0580\u056B", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u0581\u056B", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u0581\u056B", A: -1, B: 1, F: nil},
+	{Str: "\u057E\u0565\u0581\u056B", A: 34, B: 1, F: nil},
+	{Str: "\u0561\u056C", A: -1, B: 1, F: nil},
+	{Str: "\u0568\u0561\u056C", A: 36, B: 1, F: nil},
+	{Str: "\u0561\u0581\u0576\u0561\u056C", A: 36, B: 1, F: nil},
+	{Str: "\u0561\u0576\u0561\u056C", A: 36, B: 1, F: nil},
+	{Str: "\u0565\u0576\u0561\u056C", A: 36, B: 1, F: nil},
+	{Str: "\u0565\u056C", A: -1, B: 1, F: nil},
+	{Str: "\u0568\u0565\u056C", A: 41, B: 1, F: nil},
+	{Str: "\u0576\u0565\u056C", A: 41, B: 1, F: nil},
+	{Str: "\u0581\u0576\u0565\u056C", A: 43, B: 1, F: nil},
+	{Str: "\u0565\u0581\u0576\u0565\u056C", A: 44, B: 1, F: nil},
+	{Str: "\u0579\u0565\u056C", A: 41, B: 1, F: nil},
+	{Str: "\u057E\u0565\u056C", A: 41, B: 1, F: nil},
+	{Str: "\u0561\u0581\u057E\u0565\u056C", A: 47, B: 1, F: nil},
+	{Str: "\u0565\u0581\u057E\u0565\u056C", A: 47, B: 1, F: nil},
+	{Str: "\u057F\u0565\u056C", A: 41, B: 1, F: nil},
+	{Str: "\u0561\u057F\u0565\u056C", A: 50, B: 1, F: nil},
+	{Str: "\u0578\u057F\u0565\u056C", A: 50, B: 1, F: nil},
+	{Str: "\u056F\u0578\u057F\u0565\u056C", A: 52, B: 1, F: nil},
+	{Str: "\u057E\u0561\u056E", A: -1, B: 1, F: nil},
+	{Str: "\u0578\u0582\u0574", A: -1, B: 1, F: nil},
+	{Str: "\u057E\u0578\u0582\u0574", A: 55, B: 1, F: nil},
+	{Str: "\u0561\u0576", A: -1, B: 1, F: nil},
+	{Str: "\u0581\u0561\u0576", A: 57, B: 1, F: nil},
+	{Str: "\u0561\u0581\u0561\u0576", A: 58, B: 1, F: nil},
+	{Str: "\u0561\u0581\u0580\u056B\u0576", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u0581\u056B\u0576", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u0581\u056B\u0576", A: -1, B: 1, F: nil},
+	{Str: "\u057E\u0565\u0581\u056B\u0576", A: 62, B: 1, F: nil},
+	{Str: "\u0561\u056C\u056B\u057D", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u056C\u056B\u057D", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u057E", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u0581\u0561\u057E", A: 66, B: 1, F: nil},
+	{Str: "\u0565\u0581\u0561\u057E", A: 66, B: 1, F: nil},
+	{Str: "\u0561\u056C\u0578\u057E", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u056C\u0578\u057E", A: -1, B: 1, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "\u0563\u0561\u0580", A: -1, B: 1, F: nil},
+	{Str: "\u057E\u0578\u0580", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u057E\u0578\u0580", A: 1, B: 1, F: nil},
+	{Str: "\u0561\u0576\u0585\u0581", A: -1, B: 1, F: nil},
+	{Str: "\u0578\u0581", A: -1, B: 1, F: nil},
+	{Str: "\u0578\u0582", A: -1, B: 1, F: nil},
+	{Str: "\u0584", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u0580\u0584", A: 6, B: 1, F: nil},
+	{Str: "\u0579\u0565\u0584", A: 6, B: 1, F: nil},
+	{Str: "\u056B\u0584", A: 6, B: 1, F: nil},
+	{Str: "\u0561\u056C\u056B\u0584", A: 9, B: 1, F: nil},
+	{Str: "\u0561\u0576\u056B\u0584", A: 9, B: 1, F: nil},
+	{Str: "\u057E\u0561\u056E\u0584", A: 6, B: 1, F: nil},
+	{Str: "\u0578\u0582\u0575\u0584", A: 6, B: 1, F: nil},
+	{Str: "\u0578\u0582\u0576\u0584", A: 6, B: 1, F: nil},
+	{Str: "\u0574\u0578\u0582\u0576\u0584", A: 14, B: 1, F: nil},
+	{Str: "\u0565\u0576\u0584", A: 6, B: 1, F: nil},
+	{Str: "\u0578\u0576\u0584", A: 6, B: 1, F: nil},
+	{Str: "\u056B\u0579\u0584", A: 6, B: 1, F: nil},
+	{Str: "\u0578\u0580\u0564", A: -1, B: 1, F: nil},
+	{Str: "\u0578\u0582\u0575\u0569", A: -1, B: 1, F: nil},
+	{Str: "\u0581\u056B", A: -1, B: 1, F: nil},
+	{Str: "\u0578\u0582\u0570\u056B", A: -1, B: 1, F: nil},
+	{Str: "\u056B\u056C", A: -1, B: 1, F: nil},
+	{Str: "\u0578\u0582\u056F", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u056F", A: -1, B: 1, F: nil},
+	{Str: "\u0575\u0561\u056F", A: 25, B: 1, F: nil},
+	{Str: "\u0561\u0576\u0561\u056F", A: 25, B: 1, F: nil},
+	{Str: "\u056B\u056F", A: -1, B: 1, F: nil},
+	{Str: "\u0575\u0578\u0582\u0576", A: -1, B: 1, F: nil},
+	{Str: "\u0578\u0582\u0569\u0575\u0578\u0582\u0576", A: 29, B: 1, F: nil},
+	{Str: "\u0561\u0576", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u0580\u0561\u0576", A: 31, B: 1, F: nil},
+	{Str: "\u057A\u0561\u0576", A: 31, B: 1, F: nil},
+	{Str: "\u057D\u057F\u0561\u0576", A: 31, B: 1, F: nil},
+	{Str: "\u0565\u0572\u0567\u0576", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u056E\u0578", A: -1, B: 1, F: nil},
+	{Str: "\u056B\u0579", A: -1, B: 1, F: nil},
+	{Str: "\u0578\u0582\u057D", A: -1, B: 1, F: nil},
+	{Str: "\u0578\u0582\u057D\u057F", A: -1, B: 1, F: nil},
+}
+
+var A_3 = []*snowballRuntime.Among{
+	{Str: "\u0565\u0580", A: -1, B: 1, F: nil},
+	{Str: "\u0576\u0565\u0580", A: 0, B: 1, F: nil},
+	{Str: "\u0581", A: -1, B: 1, F: nil},
+	{Str: "\u0578\u0582\u0581", A: 2, B: 1, F: nil},
+	{Str: "\u056B\u0581", A: 2, B: 1, F: nil},
+	{Str: "\u0565\u0580\u056B\u0581", A: 4, B: 1, F: nil},
+	{Str: "\u0576\u0565\u0580\u056B\u0581", A: 5, B: 1, F: nil},
+	{Str: "\u0581\u056B\u0581", A: 4, B: 1, F: nil},
+	{Str: "\u057E\u0561\u0576\u056B\u0581", A: 4, B: 1, F: nil},
+	{Str: "\u0578\u057B\u056B\u0581", A: 4, B: 1, F: nil},
+	{Str: "\u057E\u056B\u0581", A: 4, B: 1, F: nil},
+	{Str: "\u0578\u0581", A: 2, B: 1, F: nil},
+	{Str: "\u057D\u0561", A: -1, B: 1, F: nil},
+	{Str: "\u057E\u0561", A: -1, B: 1, F: nil},
+	{Str: "\u0561\u0574\u0562", A: -1, B: 1, F: nil},
+	{Str: "\u0564", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u0580\u0564", A: 15, B: 1, F: nil},
+	{Str: "\u0576\u0565\u0580\u0564", A: 16, B: 1, F: nil},
+	{Str: "\u0578\u0582\u0564", A: 15, B: 1, F: nil},
+	{Str: "\u0561\u0576\u0564", A: 15, B: 1, F: nil},
+	{Str: "\u0578\u0582\u0569\u0575\u0561\u0576\u0564", A: 19, B: 1, F: nil},
+	{Str: "\u057E\u0561\u0576\u0564", A: 19, B: 1, F: nil},
+	{Str: "\u0578\u057B\u0564", A: 15, B: 1, F: nil},
+	{Str: "\u0568", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u0580\u0568", A: 23, B: 1, F: nil},
+	{Str: "\u0576\u0565\u0580\u0568", A: 24, B: 1, F: nil},
+	{Str: "\u0561\u0576\u0568", A: 23, B: 1, F: nil},
+	{Str: "\u0578\u0582\u0569\u0575\u0561\u0576\u0568", A: 26, B: 1, F: nil},
+	{Str: "\u057E\u0561\u0576\u0568", A: 26, B: 1, F: nil},
+	{Str: "\u0578\u057B\u0568", A: 23, B: 1, F: nil},
+	{Str: "\u056B", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u0580\u056B", A: 30, B: 1, F: nil},
+	{Str: "\u0576\u0565\u0580\u056B", A: 31, B: 1, F: nil},
+	{Str: "\u057E\u056B", A: 30, B: 1, F: nil},
+	{Str: "\u0565\u0580\u0578\u0582\u0574", A: -1, B: 1, F: nil},
+	{Str: "\u0576\u0565\u0580\u0578\u0582\u0574", A: 34, B: 1, F: nil},
+	{Str: "\u0561\u0576\u0578\u0582\u0574", A: -1, B: 1, F: nil},
+	{Str: "\u0576", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u0580\u0576", A: 37, B: 1, F: nil},
+	{Str: "\u0576\u0565\u0580\u0576", A: 38, B: 1, F: nil},
+	{Str: "\u0578\u0582\u0576", A: 37, B: 1, F: nil},
+	{Str: "\u0561\u0576", A: 37, B: 1, F: nil},
+	{Str: "\u0578\u0582\u0569\u0575\u0561\u0576", A: 41, B: 1, F: nil},
+	{Str: "\u057E\u0561\u0576", A: 41, B: 1, F: nil},
+	{Str: "\u056B\u0576", A: 37, B: 1, F: nil},
+	{Str: "\u0565\u0580\u056B\u0576", A: 44, B: 1, F: nil},
+	{Str: "\u0576\u0565\u0580\u056B\u0576", A: 45, B: 1, F: nil},
+	{Str: "\u0578\u0582\u0569\u0575\u0561\u0576\u0576", A: 37, B: 1, F: nil},
+	{Str: "\u0578\u057B", A: -1, B: 1, F: nil},
+	{Str: "\u0578\u0582\u0569\u0575\u0561\u0576\u057D", A: -1, B: 1, F: nil},
+	{Str: "\u057E\u0561\u0576\u057D", A: -1, B: 1, F: nil},
+	{Str: "\u0578\u057B\u057D", A: -1, B: 1, F: nil},
+	{Str: "\u0578\u057E", A: -1, B: 1, F: nil},
+	{Str: "\u0565\u0580\u0578\u057E", A: 52, B: 1, F: nil},
+	{Str: "\u0576\u0565\u0580\u0578\u057E", A: 53, B: 1, F: nil},
+	{Str: "\u0561\u0576\u0578\u057E", A: 52, B: 1, F: nil},
+	{Str: "\u057E\u0578\u057E", A: 52, B: 1, F: nil},
+}
+
+var G_v = []byte{209, 4, 128, 0, 18}
+
+type Context struct {
+	i_p2 int
+	i_pV int
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		i_p2: 0,
+		i_pV: 0,
+	}
+	_ = context
+lab0:
+	for {
+		context.i_pV = env.Limit
+		context.i_p2 = env.Limit
+		var v_2 = env.Cursor
+	lab1:
+		for {
+		golab2:
+			for {
+			lab3:
+				for {
+					if !env.InGrouping(G_v, 1377, 1413) {
+						break lab3
+					}
+					break golab2
+				}
+				if env.Cursor >= env.Limit {
+					break lab1
+				}
+				env.NextChar()
+			}
+			context.i_pV = env.Cursor
+		golab4:
+			for {
+			lab5:
+				for {
+					if !env.OutGrouping(G_v, 1377, 1413) {
+						break lab5
+					}
+					break golab4
+				}
+				if env.Cursor >= env.Limit {
+					break lab1
+				}
+				env.NextChar()
+			}
+		golab6:
+			for {
+			lab7:
+				for {
+					if !env.InGrouping(G_v, 1377, 1413) {
+						break lab7
+					}
+					break golab6
+				}
+				if env.Cursor >= env.Limit {
+					break lab1
+				}
+				env.NextChar()
+			}
+		golab8:
+			for {
+			lab9:
+				for {
+					if !env.OutGrouping(G_v, 1377, 1413) {
+						break lab9
+					}
+					break golab8
+				}
+				if env.Cursor >= env.Limit {
+					break lab1
+				}
+				env.NextChar()
+			}
+			context.i_p2 = env.Cursor
+			break lab1
+		}
+		env.Cursor = v_2
+		break lab0
+	}
+	env.LimitBackward = env.Cursor
+	env.Cursor = env.Limit
+	if env.Cursor < context.i_pV {
+		return false
+	}
+	var v_8 = env.LimitBackward
+	env.LimitBackward = context.i_pV
+	var v_9 = env.Limit - env.Cursor
+lab10:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_3, context) == 0 {
+			break lab10
+		}
+		env.Bra = env.Cursor
+		if !(context.i_p2 <= env.Cursor) {
+			break lab10
+		}
+		if !env.SliceDel() {
+			return false
+		}
+		break lab10
+	}
+	env.Cursor = env.Limit - v_9
+	var v_10 = env.Limit - env.Cursor
+lab11:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_1, context) == 0 {
+			break lab11
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		break lab11
+	}
+	env.Cursor = env.Limit - v_10
+	var v_11 = env.Limit - env.Cursor
+lab12:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_0, context) == 0 {
+			break lab12
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		break lab12
+	}
+	env.Cursor = env.Limit - v_11
+	var v_12 = env.Limit - env.Cursor
+lab13:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_2, context) == 0 {
+			break lab13
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		break lab13
+	}
+	env.Cursor = env.Limit - v_12
+	env.LimitBackward = v_8
+	env.Cursor = env.LimitBackward
+	return true
+}
@@ -0,0 +1,585 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package dutch
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "", A: -1, B: 6, F: nil},
+	{Str: "\u00E1", A: 0, B: 1, F: nil},
+	{Str: "\u00E4", A: 0, B: 1, F: nil},
+	{Str: "\u00E9", A: 0, B: 2, F: nil},
+	{Str: "\u00EB", A: 0, B: 2, F: nil},
+	{Str: "\u00ED", A: 0, B: 3, F: nil},
+	{Str: "\u00EF", A: 0, B: 3, F: nil},
+	{Str: "\u00F3", A: 0, B: 4, F: nil},
+	{Str: "\u00F6", A: 0, B: 4, F: nil},
+	{Str: "\u00FA", A: 0, B: 5, F: nil},
+	{Str: "\u00FC", A: 0, B: 5, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "", A: -1, B: 3, F: nil},
+	{Str: "I", A: 0, B: 2, F: nil},
+	{Str: "Y", A: 0, B: 1, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "dd", A: -1, B: -1, F: nil},
+	{Str: "kk", A: -1, B: -1, F: nil},
+	{Str: "tt", A: -1, B: -1, F: nil},
+}
+
+var A_3 = []*snowballRuntime.Among{
+	{Str: "ene", A: -1, B: 2, F: nil},
+	{Str: "se", A: -1, B: 3, F: nil},
+	{Str: "en", A: -1, B: 2, F: nil},
+	{Str: "heden", A: 2, B: 1, F: nil},
+	{Str: "s", A: -1, B: 3, F: nil},
+}
+
+var A_4 = []*snowballRuntime.Among{
+	{Str: "end", A: -1, B: 1, F: nil},
+	{Str: "ig", A: -1, B: 2, F: nil},
+	{Str: "ing", A: -1, B: 1, F: nil},
+	{Str: "lijk", A: -1, B: 3, F: nil},
+	{Str: "baar", A: -1, B: 4, F: nil},
+	{Str: "bar", A: -1, B: 5, F: nil},
+}
+
+var A_5 = []*snowballRuntime.Among{
+	{Str: "aa", A: -1, B: -1, F: nil},
+	{Str: "ee", A: -1, B: -1, F: nil},
+	{Str: "oo", A: -1, B: -1, F: nil},
+	{Str: "uu", A: -1, B: -1, F: nil},
+}
+
+var G_v = []byte{17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128}
+
+var G_v_I = []byte{1, 0, 0, 17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128}
+
+var G_v_j = []byte{17, 67, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128}
+
+type Context struct {
+	i_p2      int
+	i_p1      int
+	b_e_found bool
+}
+
+func r_undouble(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	var v_1 = env.Limit - env.Cursor
+	if env.FindAmongB(A_2, context) == 0 {
+		return false
+	}
+	env.Cursor = env.Limit - v_1
+	env.Ket = env.Cursor
+	if env.Cursor <= env.LimitBackward {
+		return false
+	}
+	env.PrevChar()
+	env.Bra = env.Cursor
+	if !env.SliceDel() {
+		return false
+	}
+	return true
+}
+
+func r_e_ending(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	context.b_e_found = false
+	env.Ket = env.Cursor
+	if !env.EqSB("e") {
+		return false
+	}
+	env.Bra = env.Cursor
+	if !(context.i_p1 <= env.Cursor) {
+		return false
+	}
+	var v_1 = env.Limit - env.Cursor
+	if !env.OutGroupingB(G_v, 97, 232) {
+		return false
+	}
+	env.Cursor = env.Limit - v_1
+	if !env.SliceDel() {
+		return false
+	}
+	context.b_e_found = true
+	if !r_undouble(env, context) {
+		return false
+	}
+	return true
+}
+
+func r_en_ending(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if !(context.i_p1 <= env.Cursor) {
+		return false
+	}
+	var v_1 = env.Limit - env.Cursor
+	if !env.OutGroupingB(G_v, 97, 232) {
+		return false
+	}
+	env.Cursor = env.Limit - v_1
+	var v_2 = env.Limit - env.Cursor
+lab0:
+	for {
+		if !env.EqSB("gem") {
+			break lab0
+		}
+		return false
+	}
+	env.Cursor = env.Limit - v_2
+	if !env.SliceDel() {
+		return false
+	}
+	if !r_undouble(env, context) {
+		return false
+	}
+	return true
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		i_p2:      0,
+		i_p1:      0,
+		b_e_found: false,
+	}
+	_ = context
+	var among_var int32
+	var v_1 = env.Cursor
+lab0:
+	for {
+		var v_2 = env.Cursor
+	replab1:
+		for {
+			var v_3 = env.Cursor
+		lab2:
+			for range [2]struct{}{} {
+				env.Bra = env.Cursor
+				among_var = env.FindAmong(A_0, context)
+				if among_var == 0 {
+					break lab2
+				}
+				env.Ket = env.Cursor
+				if among_var == 1 {
+					if !env.SliceFrom("a") {
+						return false
+					}
+				} else if among_var == 2 {
+					if !env.SliceFrom("e") {
+						return false
+					}
+				} else if among_var == 3 {
+					if !env.SliceFrom("i") {
+						return false
+					}
+				} else if among_var == 4 {
+					if !env.SliceFrom("o") {
+						return false
+					}
+				} else if among_var == 5 {
+					if !env.SliceFrom("u") {
+						return false
+					}
+				} else if among_var == 6 {
+					if env.Cursor >= env.Limit {
+						break lab2
+					}
+					env.NextChar()
+				}
+				continue replab1
+			}
+			env.Cursor = v_3
+			break replab1
+		}
+		env.Cursor = v_2
+		var v_4 = env.Cursor
+	lab3:
+		for {
+			env.Bra = env.Cursor
+			if !env.EqS("y") {
+				env.Cursor = v_4
+				break lab3
+			}
+			env.Ket = env.Cursor
+			if !env.SliceFrom("Y") {
+				return false
+			}
+			break lab3
+		}
+	replab4:
+		for {
+			var v_5 = env.Cursor
+		lab5:
+			for range [2]struct{}{} {
+			golab6:
+				for {
+					var v_6 = env.Cursor
+				lab7:
+					for {
+						if !env.InGrouping(G_v, 97, 232) {
+							break lab7
+						}
+						env.Bra = env.Cursor
+					lab8:
+						for {
+							var v_7 = env.Cursor
+						lab9:
+							for {
+								if !env.EqS("i") {
+									break lab9
+								}
+								env.Ket = env.Cursor
+								if !env.InGrouping(G_v, 97, 232) {
+									break lab9
+								}
+								if !env.SliceFrom("I") {
+									return false
+								}
+								break lab8
+							}
+							env.Cursor = v_7
+							if !env.EqS("y") {
+								break lab7
+							}
+							env.Ket = env.Cursor
+							if !env.SliceFrom("Y") {
+								return false
+							}
+							break lab8
+						}
+						env.Cursor = v_6
+						break golab6
+					}
+					env.Cursor = v_6
+					if env.Cursor >= env.Limit {
+						break lab5
+					}
+					env.NextChar()
+				}
+				continue replab4
+			}
+			env.Cursor = v_5
+			break replab4
+		}
+		break lab0
+	}
+	env.Cursor = v_1
+	var v_8 = env.Cursor
+lab10:
+	for {
+		context.i_p1 = env.Limit
+		context.i_p2 = env.Limit
+	golab11:
+		for {
+		lab12:
+			for {
+				if !env.InGrouping(G_v, 97, 232) {
+					break lab12
+				}
+				break golab11
+			}
+			if env.Cursor >= env.Limit {
+				break lab10
+			}
+			env.NextChar()
+		}
+	golab13:
+		for {
+		lab14:
+			for {
+				if !env.OutGrouping(G_v, 97, 232) {
+					break lab14
+				}
+				break golab13
+			}
+			if env.Cursor >= env.Limit {
+				break lab10
+			}
+			env.NextChar()
+		}
+		context.i_p1 = env.Cursor
+	lab15:
+		for {
+			if !(context.i_p1 < 3) {
+				break lab15
+			}
+			context.i_p1 = 3
+			break lab15
+		}
+	golab16:
+		for {
+		lab17:
+			for {
+				if !env.InGrouping(G_v, 97, 232) {
+					break lab17
+				}
+				break golab16
+			}
+			if env.Cursor >= env.Limit {
+				break lab10
+			}
+			env.NextChar()
+		}
+	golab18:
+		for {
+		lab19:
+			for {
+				if !env.OutGrouping(G_v, 97, 232) {
+					break lab19
+				}
+				break golab18
+			}
+			if env.Cursor >= env.Limit {
+				break lab10
+			}
+			env.NextChar()
+		}
+		context.i_p2 = env.Cursor
+		break lab10
+	}
+	env.Cursor = v_8
+	env.LimitBackward = env.Cursor
+	env.Cursor = env.Limit
+lab20:
+	for {
+		var v_15 = env.Limit - env.Cursor
+	lab21:
+		for {
+			env.Ket = env.Cursor
+			among_var = env.FindAmongB(A_3, context)
+			if among_var == 0 {
+				break lab21
+			}
+			env.Bra = env.Cursor
+			if among_var == 1 {
+				if !(context.i_p1 <= env.Cursor) {
+					break lab21
+				}
+				if !env.SliceFrom("heid") {
+					return false
+				}
+			} else if among_var == 2 {
+				if !r_en_ending(env, context) {
+					break lab21
+				}
+			} else if among_var == 3 {
+				if !(context.i_p1 <= env.Cursor) {
+					break lab21
+				}
+				if !env.OutGroupingB(G_v_j, 97, 232) {
+					break lab21
+				}
+				if !env.SliceDel() {
+					return false
+				}
+			}
+			break lab21
+		}
+		env.Cursor = env.Limit - v_15
+		var v_16 = env.Limit - env.Cursor
+		r_e_ending(env, context)
+		env.Cursor = env.Limit - v_16
+		var v_17 = env.Limit - env.Cursor
+	lab22:
+		for {
+			env.Ket = env.Cursor
+			if !env.EqSB("heid") {
+				break lab22
+			}
+			env.Bra = env.Cursor
+			if !(context.i_p2 <= env.Cursor) {
+				break lab22
+			}
+			var v_18 = env.Limit - env.Cursor
+		lab23:
+			for {
+				if !env.EqSB("c") {
+					break lab23
+				}
+				break lab22
+			}
+			env.Cursor = env.Limit - v_18
+			if !env.SliceDel() {
+				return false
+			}
+			env.Ket = env.Cursor
+			if !env.EqSB("en") {
+				break lab22
+			}
+			env.Bra = env.Cursor
+			if !r_en_ending(env, context) {
+				break lab22
+			}
+			break lab22
+		}
+		env.Cursor = env.Limit - v_17
+		var v_19 = env.Limit - env.Cursor
+	lab24:
+		for {
+			env.Ket = env.Cursor
+			among_var = env.FindAmongB(A_4, context)
+			if among_var == 0 {
+				break lab24
+			}
+			env.Bra = env.Cursor
+			if among_var == 1 {
+				if !(context.i_p2 <= env.Cursor) {
+					break lab24
+				}
+				if !env.SliceDel() {
+					return false
+				}
+			lab25:
+				for {
+					var v_20 = env.Limit - env.Cursor
+				lab26:
+					for {
+						env.Ket = env.Cursor
+						if !env.EqSB("ig") {
+							break lab26
+						}
+						env.Bra = env.Cursor
+						if !(context.i_p2 <= env.Cursor) {
+							break lab26
+						}
+						var v_21 = env.Limit - env.Cursor
+					lab27:
+						for {
+							if !env.EqSB("e") {
+								break lab27
+							}
+							break lab26
+						}
+						env.Cursor = env.Limit - v_21
+						if !env.SliceDel() {
+							return false
+						}
+						break lab25
+					}
+					env.Cursor = env.Limit - v_20
+					if !r_undouble(env, context) {
+						break lab24
+					}
+					break lab25
+				}
+			} else if among_var == 2 {
+				if !(context.i_p2 <= env.Cursor) {
+					break lab24
+				}
+				var v_22 = env.Limit - env.Cursor
+			lab28:
+				for {
+					if !env.EqSB("e") {
+						break lab28
+					}
+					break lab24
+				}
+				env.Cursor = env.Limit - v_22
+				if !env.SliceDel() {
+					return false
+				}
+			} else if among_var == 3 {
+				if !(context.i_p2 <= env.Cursor) {
+					break lab24
+				}
+				if !env.SliceDel() {
+					return false
+				}
+				if !r_e_ending(env, context) {
+					break lab24
+				}
+			} else if among_var == 4 {
+				if !(context.i_p2 <= env.Cursor) {
+					break lab24
+				}
+				if !env.SliceDel() {
+					return false
+				}
+			} else if among_var == 5 {
+				if !(context.i_p2 <= env.Cursor) {
+					break lab24
+				}
+				if !context.b_e_found {
+					break lab24
+				}
+				if !env.SliceDel() {
+					return false
+				}
+			}
+			break lab24
+		}
+		env.Cursor = env.Limit - v_19
+		var v_23 = env.Limit - env.Cursor
+	lab29:
+		for {
+			if !env.OutGroupingB(G_v_I, 73, 232) {
+				break lab29
+			}
+			var v_24 = env.Limit - env.Cursor
+			if env.FindAmongB(A_5, context) == 0 {
+				break lab29
+			}
+			if !env.OutGroupingB(G_v, 97, 232) {
+				break lab29
+			}
+			env.Cursor = env.Limit - v_24
+			env.Ket = env.Cursor
+			if env.Cursor <= env.LimitBackward {
+				break lab29
+			}
+			env.PrevChar()
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			break lab29
+		}
+		env.Cursor = env.Limit - v_23
+		break lab20
+	}
+	env.Cursor = env.LimitBackward
+	var v_25 = env.Cursor
+lab30:
+	for {
+	replab31:
+		for {
+			var v_26 = env.Cursor
+		lab32:
+			for range [2]struct{}{} {
+				env.Bra = env.Cursor
+				among_var = env.FindAmong(A_1, context)
+				if among_var == 0 {
+					break lab32
+				}
+				env.Ket = env.Cursor
+				if among_var == 1 {
+					if !env.SliceFrom("y") {
+						return false
+					}
+				} else if among_var == 2 {
+					if !env.SliceFrom("i") {
+						return false
+					}
+				} else if among_var == 3 {
+					if env.Cursor >= env.Limit {
+						break lab32
+					}
+					env.NextChar()
+				}
+				continue replab31
+			}
+			env.Cursor = v_26
+			break replab31
+		}
+		break lab30
+	}
+	env.Cursor = v_25
+	return true
+}
@@ -0,0 +1,928 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package english
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "arsen", A: -1, B: -1, F: nil},
+	{Str: "commun", A: -1, B: -1, F: nil},
+	{Str: "gener", A: -1, B: -1, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "'", A: -1, B: 1, F: nil},
+	{Str: "'s'", A: 0, B: 1, F: nil},
+	{Str: "'s", A: -1, B: 1, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "ied", A: -1, B: 2, F: nil},
+	{Str: "s", A: -1, B: 3, F: nil},
+	{Str: "ies", A: 1, B: 2, F: nil},
+	{Str: "sses", A: 1, B: 1, F: nil},
+	{Str: "ss", A: 1, B: -1, F: nil},
+	{Str: "us", A: 1, B: -1, F: nil},
+}
+
+var A_3 = []*snowballRuntime.Among{
+	{Str: "", A: -1, B: 3, F: nil},
+	{Str: "bb", A: 0, B: 2, F: nil},
+	{Str: "dd", A: 0, B: 2, F: nil},
+	{Str: "ff", A: 0, B: 2, F: nil},
+	{Str: "gg", A: 0, B: 2, F: nil},
+	{Str: "bl", A: 0, B: 1, F: nil},
+	{Str: "mm", A: 0, B: 2, F: nil},
+	{Str: "nn", A: 0, B: 2, F: nil},
+	{Str: "pp", A: 0, B: 2, F: nil},
+	{Str: "rr", A: 0, B: 2, F: nil},
+	{Str: "at", A: 0, B: 1, F: nil},
+	{Str: "tt", A: 0, B: 2, F: nil},
+	{Str: "iz", A: 0, B: 1, F: nil},
+}
+
+var A_4 = []*snowballRuntime.Among{
+	{Str: "ed", A: -1, B: 2, F: nil},
+	{Str: "eed", A: 0, B: 1, F: nil},
+	{Str: "ing", A: -1, B: 2, F: nil},
+	{Str: "edly", A: -1, B: 2, F: nil},
+	{Str: "eedly", A: 3, B: 1, F: nil},
+	{Str: "ingly", A: -1, B: 2, F: nil},
+}
+
+var A_5 = []*snowballRuntime.Among{
+	{Str: "anci", A: -1, B: 3, F: nil},
+	{Str: "enci", A: -1, B: 2, F: nil},
+	{Str: "ogi", A: -1, B: 13, F: nil},
+	{Str: "li", A: -1, B: 15, F: nil},
+	{Str: "bli", A: 3, B: 12, F: nil},
+	{Str: "abli", A: 4, B: 4, F: nil},
+	{Str: "alli", A: 3, B: 8, F: nil},
+	{Str: "fulli", A: 3, B: 9, F: nil},
+	{Str: "lessli", A: 3, B: 14, F: nil},
+	{Str: "ousli", A: 3, B: 10, F: nil},
+	{Str: "entli", A: 3, B: 5, F: nil},
+	{Str: "aliti", A: -1, B: 8, F: nil},
+	{Str: "biliti", A: -1, B: 12, F: nil},
+	{Str: "iviti", A: -1, B: 11, F: nil},
+	{Str: "tional", A: -1, B: 1, F: nil},
+	{Str: "ational", A: 14, B: 7, F: nil},
+	{Str: "alism", A: -1, B: 8, F: nil},
+	{Str: "ation", A: -1, B: 7, F: nil},
+	{Str: "ization", A: 17, B: 6, F: nil},
+	{Str: "izer", A: -1, B: 6, F: nil},
+	{Str: "ator", A: -1, B: 7, F: nil},
+	{Str: "iveness", A: -1, B: 11, F: nil},
+	{Str: "fulness", A: -1, B: 9, F: nil},
+	{Str: "ousness", A: -1, B: 10, F: nil},
+}
+
+var A_6 = []*snowballRuntime.Among{
+	{Str: "icate", A: -1, B: 4, F: nil},
+	{Str: "ative", A: -1, B: 6, F: nil},
+	{Str: "alize", A: -1, B: 3, F: nil},
+	{Str: "iciti", A: -1, B: 4, F: nil},
+	{Str: "ical", A: -1, B: 4, F: nil},
+	{Str: "tional", A: -1, B: 1, F: nil},
+	{Str: "ational", A: 5, B: 2, F: nil},
+	{Str: "ful", A: -1, B: 5, F: nil},
+	{Str: "ness", A: -1, B: 5, F: nil},
+}
+
+var A_7 = []*snowballRuntime.Among{
+	{Str: "ic", A: -1, B: 1, F: nil},
+	{Str: "ance", A: -1, B: 1, F: nil},
+	{Str: "ence", A: -1, B: 1, F: nil},
+	{Str: "able", A: -1, B: 1, F: nil},
+	{Str: "ible", A: -1, B: 1, F: nil},
+	{Str: "ate", A: -1, B: 1, F: nil},
+	{Str: "ive", A: -1, B: 1, F: nil},
+	{Str: "ize", A: -1, B: 1, F: nil},
+	{Str: "iti", A: -1, B: 1, F: nil},
+	{Str: "al", A: -1, B: 1, F: nil},
+	{Str: "ism", A: -1, B: 1, F: nil},
+	{Str: "ion", A: -1, B: 2, F: nil},
+	{Str: "er", A: -1, B: 1, F: nil},
+	{Str: "ous", A: -1, B: 1, F: nil},
+	{Str: "ant", A: -1, B: 1, F: nil},
+	{Str: "ent", A: -1, B: 1, F: nil},
+	{Str: "ment", A: 15, B: 1, F: nil},
+	{Str: "ement", A: 16, B: 1, F: nil},
+}
+
+var A_8 = []*snowballRuntime.Among{
+	{Str: "e", A: -1, B: 1, F: nil},
+	{Str: "l", A: -1, B: 2, F: nil},
+}
+
+var A_9 = []*snowballRuntime.Among{
+	{Str: "succeed", A: -1, B: -1, F: nil},
+	{Str: "proceed", A: -1, B: -1, F: nil},
+	{Str: "exceed", A: -1, B: -1, F: nil},
+	{Str: "canning", A: -1, B: -1, F: nil},
+	{Str: "inning", A: -1, B: -1, F: nil},
+	{Str: "earring", A: -1, B: -1, F: nil},
+	{Str: "herring", A: -1, B: -1, F: nil},
+	{Str: "outing", A: -1, B: -1, F: nil},
+}
+
+var A_10 = []*snowballRuntime.Among{
+	{Str: "andes", A: -1, B: -1, F: nil},
+	{Str: "atlas", A: -1, B: -1, F: nil},
+	{Str: "bias", A: -1, B: -1, F: nil},
+	{Str: "cosmos", A: -1, B: -1, F: nil},
+	{Str: "dying", A: -1, B: 3, F: nil},
+	{Str: "early", A: -1, B: 9, F: nil},
+	{Str: "gently", A: -1, B: 7, F: nil},
+	{Str: "howe", A: -1, B: -1, F: nil},
+	{Str: "idly", A: -1, B: 6, F: nil},
+	{Str: "lying", A: -1, B: 4, F: nil},
+	{Str: "news", A: -1, B: -1, F: nil},
+	{Str: "only", A: -1, B: 10, F: nil},
+	{Str: "singly", A: -1, B: 11, F: nil},
+	{Str: "skies", A: -1, B: 2, F: nil},
+	{Str: "skis", A: -1, B: 1, F: nil},
+	{Str: "sky", A: -1, B: -1, F: nil},
+	{Str: "tying", A: -1, B: 5, F: nil},
+	{Str: "ugly", A: -1, B: 8, F: nil},
+}
+
+var G_v = []byte{17, 65, 16, 1}
+
+var G_v_WXY = []byte{1, 17, 65, 208, 1}
+
+var G_valid_LI = []byte{55, 141, 2}
+
+type Context struct {
+	b_Y_found bool
+	i_p2      int
+	i_p1      int
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		b_Y_found: false,
+		i_p2:      0,
+		i_p1:      0,
+	}
+	_ = context
+	var among_var int32
+lab0:
+	for {
+		var v_1 = env.Cursor
+	lab1:
+		for {
+			env.Bra = env.Cursor
+			among_var = env.FindAmong(A_10, context)
+			if among_var == 0 {
+				break lab1
+			}
+			env.Ket = env.Cursor
+			if env.Cursor < env.Limit {
+				break lab1
+			}
+			if among_var == 1 {
+				if !env.SliceFrom("ski") {
+					return false
+				}
+			} else if among_var == 2 {
+				if !env.SliceFrom("sky") {
+					return false
+				}
+			} else if among_var == 3 {
+				if !env.SliceFrom("die") {
+					return false
+				}
+			} else if among_var == 4 {
+				if !env.SliceFrom("lie") {
+					return false
+				}
+			} else if among_var == 5 {
+				if !env.SliceFrom("tie") {
+					return false
+				}
+			} else if among_var == 6 {
+				if !env.SliceFrom("idl") {
+					return false
+				}
+			} else if among_var == 7 {
+				if !env.SliceFrom("gentl") {
+					return false
+				}
+			} else if among_var == 8 {
+				if !env.SliceFrom("ugli") {
+					return false
+				}
+			} else if among_var == 9 {
+				if !env.SliceFrom("earli") {
+					return false
+				}
+			} else if among_var == 10 {
+				if !env.SliceFrom("onli") {
+					return false
+				}
+			} else if among_var == 11 {
+				if !env.SliceFrom("singl") {
+					return false
+				}
+			}
+			break lab0
+		}
+		env.Cursor = v_1
+	lab2:
+		for {
+			var v_2 = env.Cursor
+		lab3:
+			for {
+				if !env.Hop(3) {
+					break lab3
+				}
+				break lab2
+			}
+			env.Cursor = v_2
+			break lab0
+		}
+		env.Cursor = v_1
+	lab4:
+		for {
+			context.b_Y_found = false
+			var v_4 = env.Cursor
+		lab5:
+			for {
+				env.Bra = env.Cursor
+				if !env.EqS("'") {
+					break lab5
+				}
+				env.Ket = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				break lab5
+			}
+			env.Cursor = v_4
+			var v_5 = env.Cursor
+		lab6:
+			for {
+				env.Bra = env.Cursor
+				if !env.EqS("y") {
+					break lab6
+				}
+				env.Ket = env.Cursor
+				if !env.SliceFrom("Y") {
+					return false
+				}
+				context.b_Y_found = true
+				break lab6
+			}
+			env.Cursor = v_5
+			var v_6 = env.Cursor
+		lab7:
+			for {
+			replab8:
+				for {
+					var v_7 = env.Cursor
+				lab9:
+					for range [2]struct{}{} {
+					golab10:
+						for {
+							var v_8 = env.Cursor
+						lab11:
+							for {
+								if !env.InGrouping(G_v, 97, 121) {
+									break lab11
+								}
+								env.Bra = env.Cursor
+								if !env.EqS("y") {
+									break lab11
+								}
+								env.Ket = env.Cursor
+								env.Cursor = v_8
+								break golab10
+							}
+							env.Cursor = v_8
+							if env.Cursor >= env.Limit {
+								break lab9
+							}
+							env.NextChar()
+						}
+						if !env.SliceFrom("Y") {
+							return false
+						}
+						context.b_Y_found = true
+						continue replab8
+					}
+					env.Cursor = v_7
+					break replab8
+				}
+				break lab7
+			}
+			env.Cursor = v_6
+			break lab4
+		}
+	lab12:
+		for {
+			context.i_p1 = env.Limit
+			context.i_p2 = env.Limit
+			var v_10 = env.Cursor
+		lab13:
+			for {
+			lab14:
+				for {
+					var v_11 = env.Cursor
+				lab15:
+					for {
+						if env.FindAmong(A_0, context) == 0 {
+							break lab15
+						}
+						break lab14
+					}
+					env.Cursor = v_11
+				golab16:
+					for {
+					lab17:
+						for {
+							if !env.InGrouping(G_v, 97, 121) {
+								break lab17
+							}
+							break golab16
+						}
+						if env.Cursor >= env.Limit {
+							break lab13
+						}
+						env.NextChar()
+					}
+				golab18:
+					for {
+					lab19:
+						for {
+							if !env.OutGrouping(G_v, 97, 121) {
+								break lab19
+							}
+							break golab18
+						}
+						if env.Cursor >= env.Limit {
+							break lab13
+						}
+						env.NextChar()
+					}
+					break lab14
+				}
+				context.i_p1 = env.Cursor
+			golab20:
+				for {
+				lab21:
+					for {
+						if !env.InGrouping(G_v, 97, 121) {
+							break lab21
+						}
+						break golab20
+					}
+					if env.Cursor >= env.Limit {
+						break lab13
+					}
+					env.NextChar()
+				}
+			golab22:
+				for {
+				lab23:
+					for {
+						if !env.OutGrouping(G_v, 97, 121) {
+							break lab23
+						}
+						break golab22
+					}
+					if env.Cursor >= env.Limit {
+						break lab13
+					}
+					env.NextChar()
+				}
+				context.i_p2 = env.Cursor
+				break lab13
+			}
+			env.Cursor = v_10
+			break lab12
+		}
+		env.LimitBackward = env.Cursor
+		env.Cursor = env.Limit
+		var v_16 = env.Limit - env.Cursor
+	lab24:
+		for {
+			var v_17 = env.Limit - env.Cursor
+		lab25:
+			for {
+				env.Ket = env.Cursor
+				if env.FindAmongB(A_1, context) == 0 {
+					env.Cursor = env.Limit - v_17
+					break lab25
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				break lab25
+			}
+			env.Ket = env.Cursor
+			among_var = env.FindAmongB(A_2, context)
+			if among_var == 0 {
+				break lab24
+			}
+			env.Bra = env.Cursor
+			if among_var == 1 {
+				if !env.SliceFrom("ss") {
+					return false
+				}
+			} else if among_var == 2 {
+			lab26:
+				for {
+					var v_18 = env.Limit - env.Cursor
+				lab27:
+					for {
+						if !env.HopBack(2) {
+							break lab27
+						}
+						if !env.SliceFrom("i") {
+							return false
+						}
+						break lab26
+					}
+					env.Cursor = env.Limit - v_18
+					if !env.SliceFrom("ie") {
+						return false
+					}
+					break lab26
+				}
+			} else if among_var == 3 {
+				if env.Cursor <= env.LimitBackward {
+					break lab24
+				}
+				env.PrevChar()
+			golab28:
+				for {
+				lab29:
+					for {
+						if !env.InGroupingB(G_v, 97, 121) {
+							break lab29
+						}
+						break golab28
+					}
+					if env.Cursor <= env.LimitBackward {
+						break lab24
+					}
+					env.PrevChar()
+				}
+				if !env.SliceDel() {
+					return false
+				}
+			}
+			break lab24
+		}
+		env.Cursor = env.Limit - v_16
+	lab30:
+		for {
+			var v_20 = env.Limit - env.Cursor
+		lab31:
+			for {
+				env.Ket = env.Cursor
+				if env.FindAmongB(A_9, context) == 0 {
+					break lab31
+				}
+				env.Bra = env.Cursor
+				if env.Cursor > env.LimitBackward {
+					break lab31
+				}
+				break lab30
+			}
+			env.Cursor = env.Limit - v_20
+			var v_21 = env.Limit - env.Cursor
+		lab32:
+			for {
+				env.Ket = env.Cursor
+				among_var = env.FindAmongB(A_4, context)
+				if among_var == 0 {
+					break lab32
+				}
+				env.Bra = env.Cursor
+				if among_var == 1 {
+					if !(context.i_p1 <= env.Cursor) {
+						break lab32
+					}
+					if !env.SliceFrom("ee") {
+						return false
+					}
+				} else if among_var == 2 {
+					var v_22 = env.Limit - env.Cursor
+				golab33:
+					for {
+					lab34:
+						for {
+							if !env.InGroupingB(G_v, 97, 121) {
+								break lab34
+							}
+							break golab33
+						}
+						if env.Cursor <= env.LimitBackward {
+							break lab32
+						}
+						env.PrevChar()
+					}
+					env.Cursor = env.Limit - v_22
+					if !env.SliceDel() {
+						return false
+					}
+					var v_24 = env.Limit - env.Cursor
+					among_var = env.FindAmongB(A_3, context)
+					if among_var == 0 {
+						break lab32
+					}
+					env.Cursor = env.Limit - v_24
+					if among_var == 1 {
+						{
+							var c = env.Cursor
+							bra, ket := env.Cursor, env.Cursor
+							env.Insert(bra, ket, "e")
+							env.Cursor = c
+						}
+					} else if among_var == 2 {
+						env.Ket = env.Cursor
+						if env.Cursor <= env.LimitBackward {
+							break lab32
+						}
+						env.PrevChar()
+						env.Bra = env.Cursor
+						if !env.SliceDel() {
+							return false
+						}
+					} else if among_var == 3 {
+						if env.Cursor != context.i_p1 {
+							break lab32
+						}
+						var v_25 = env.Limit - env.Cursor
+					lab35:
+						for {
+							var v_26 = env.Limit - env.Cursor
+						lab36:
+							for {
+								if !env.OutGroupingB(G_v_WXY, 89, 121) {
+									break lab36
+								}
+								if !env.InGroupingB(G_v, 97, 121) {
+									break lab36
+								}
+								if !env.OutGroupingB(G_v, 97, 121) {
+									break lab36
+								}
+								break lab35
+							}
+							env.Cursor = env.Limit - v_26
+							if !env.OutGroupingB(G_v, 97, 121) {
+								break lab32
+							}
+							if !env.InGroupingB(G_v, 97, 121) {
+								break lab32
+							}
+							if env.Cursor > env.LimitBackward {
+								break lab32
+							}
+							break lab35
+						}
+						env.Cursor = env.Limit - v_25
+						{
+							var c = env.Cursor
+							bra, ket := env.Cursor, env.Cursor
+							env.Insert(bra, ket, "e")
+							env.Cursor = c
+						}
+					}
+				}
+				break lab32
+			}
+			env.Cursor = env.Limit - v_21
+			var v_27 = env.Limit - env.Cursor
+		lab37:
+			for {
+				env.Ket = env.Cursor
+			lab38:
+				for {
+					var v_28 = env.Limit - env.Cursor
+				lab39:
+					for {
+						if !env.EqSB("y") {
+							break lab39
+						}
+						break lab38
+					}
+					env.Cursor = env.Limit - v_28
+					if !env.EqSB("Y") {
+						break lab37
+					}
+					break lab38
+				}
+				env.Bra = env.Cursor
+				if !env.OutGroupingB(G_v, 97, 121) {
+					break lab37
+				}
+			lab40:
+				for {
+					if env.Cursor > env.LimitBackward {
+						break lab40
+					}
+					break lab37
+				}
+				if !env.SliceFrom("i") {
+					return false
+				}
+				break lab37
+			}
+			env.Cursor = env.Limit - v_27
+			var v_30 = env.Limit - env.Cursor
+		lab41:
+			for {
+				env.Ket = env.Cursor
+				among_var = env.FindAmongB(A_5, context)
+				if among_var == 0 {
+					break lab41
+				}
+				env.Bra = env.Cursor
+				if !(context.i_p1 <= env.Cursor) {
+					break lab41
+				}
+				if among_var == 1 {
+					if !env.SliceFrom("tion") {
+						return false
+					}
+				} else if among_var == 2 {
+					if !env.SliceFrom("ence") {
+						return false
+					}
+				} else if among_var == 3 {
+					if !env.SliceFrom("ance") {
+						return false
+					}
+				} else if among_var == 4 {
+					if !env.SliceFrom("able") {
+						return false
+					}
+				} else if among_var == 5 {
+					if !env.SliceFrom("ent") {
+						return false
+					}
+				} else if among_var == 6 {
+					if !env.SliceFrom("ize") {
+						return false
+					}
+				} else if among_var == 7 {
+					if !env.SliceFrom("ate") {
+						return false
+					}
+				} else if among_var == 8 {
+					if !env.SliceFrom("al") {
+						return false
+					}
+				} else if among_var == 9 {
+					if !env.SliceFrom("ful") {
+						return false
+					}
+				} else if among_var == 10 {
+					if !env.SliceFrom("ous") {
+						return false
+					}
+				} else if among_var == 11 {
+					if !env.SliceFrom("ive") {
+						return false
+					}
+				} else if among_var == 12 {
+					if !env.SliceFrom("ble") {
+						return false
+					}
+				} else if among_var == 13 {
+					if !env.EqSB("l") {
+						break lab41
+					}
+					if !env.SliceFrom("og") {
+						return false
+					}
+				} else if among_var == 14 {
+					if !env.SliceFrom("less") {
+						return false
+					}
+				} else if among_var == 15 {
+					if !env.InGroupingB(G_valid_LI, 99, 116) {
+						break lab41
+					}
+					if !env.SliceDel() {
+						return false
+					}
+				}
+				break lab41
+			}
+			env.Cursor = env.Limit - v_30
+			var v_31 = env.Limit - env.Cursor
+		lab42:
+			for {
+				env.Ket = env.Cursor
+				among_var = env.FindAmongB(A_6, context)
+				if among_var == 0 {
+					break lab42
+				}
+				env.Bra = env.Cursor
+				if !(context.i_p1 <= env.Cursor) {
+					break lab42
+				}
+				if among_var == 1 {
+					if !env.SliceFrom("tion") {
+						return false
+					}
+				} else if among_var == 2 {
+					if !env.SliceFrom("ate") {
+						return false
+					}
+				} else if among_var == 3 {
+					if !env.SliceFrom("al") {
+						return false
+					}
+				} else if among_var == 4 {
+					if !env.SliceFrom("ic") {
+						return false
+					}
+				} else if among_var == 5 {
+					if !env.SliceDel() {
+						return false
+					}
+				} else if among_var == 6 {
+					if !(context.i_p2 <= env.Cursor) {
+						break lab42
+					}
+					if !env.SliceDel() {
+						return false
+					}
+				}
+				break lab42
+			}
+			env.Cursor = env.Limit - v_31
+			var v_32 = env.Limit - env.Cursor
+		lab43:
+			for {
+				env.Ket = env.Cursor
+				among_var = env.FindAmongB(A_7, context)
+				if among_var == 0 {
+					break lab43
+				}
+				env.Bra = env.Cursor
+				if !(context.i_p2 <= env.Cursor) {
+					break lab43
+				}
+				if among_var == 1 {
+					if !env.SliceDel() {
+						return false
+					}
+				} else if among_var == 2 {
+				lab44:
+					for {
+						var v_33 = env.Limit - env.Cursor
+					lab45:
+						for {
+							if !env.EqSB("s") {
+								break lab45
+							}
+							break lab44
+						}
+						env.Cursor = env.Limit - v_33
+						if !env.EqSB("t") {
+							break lab43
+						}
+						break lab44
+					}
+					if !env.SliceDel() {
+						return false
+					}
+				}
+				break lab43
+			}
+			env.Cursor = env.Limit - v_32
+			var v_34 = env.Limit - env.Cursor
+		lab46:
+			for {
+				env.Ket = env.Cursor
+				among_var = env.FindAmongB(A_8, context)
+				if among_var == 0 {
+					break lab46
+				}
+				env.Bra = env.Cursor
+				if among_var == 1 {
+				lab47:
+					for {
+						var v_35 = env.Limit - env.Cursor
+					lab48:
+						for {
+							if !(context.i_p2 <= env.Cursor) {
+								break lab48
+							}
+							break lab47
+						}
+						env.Cursor = env.Limit - v_35
+						if !(context.i_p1 <= env.Cursor) {
+							break lab46
+						}
+						var v_36 = env.Limit - env.Cursor
+					lab49:
+						for {
+						lab50:
+							for {
+								var v_37 = env.Limit - env.Cursor
+							lab51:
+								for {
+									if !env.OutGroupingB(G_v_WXY, 89, 121) {
+										break lab51
+									}
+									if !env.InGroupingB(G_v, 97, 121) {
+										break lab51
+									}
+									if !env.OutGroupingB(G_v, 97, 121) {
+										break lab51
+									}
+									break lab50
+								}
+								env.Cursor = env.Limit - v_37
+								if !env.OutGroupingB(G_v, 97, 121) {
+									break lab49
+								}
+								if !env.InGroupingB(G_v, 97, 121) {
+									break lab49
+								}
+								if env.Cursor > env.LimitBackward {
+									break lab49
+								}
+								break lab50
+							}
+							break lab46
+						}
+						env.Cursor = env.Limit - v_36
+						break lab47
+					}
+					if !env.SliceDel() {
+						return false
+					}
+				} else if among_var == 2 {
+					if !(context.i_p2 <= env.Cursor) {
+						break lab46
+					}
+					if !env.EqSB("l") {
+						break lab46
+					}
+					if !env.SliceDel() {
+						return false
+					}
+				}
+				break lab46
+			}
+			env.Cursor = env.Limit - v_34
+			break lab30
+		}
+		env.Cursor = env.LimitBackward
+		var v_38 = env.Cursor
+	lab52:
+		for {
+			if !context.b_Y_found {
+				break lab52
+			}
+		replab53:
+			for {
+				var v_39 = env.Cursor
+			lab54:
+				for range [2]struct{}{} {
+				golab55:
+					for {
+						var v_40 = env.Cursor
+					lab56:
+						for {
+							env.Bra = env.Cursor
+							if !env.EqS("Y") {
+								break lab56
+							}
+							env.Ket = env.Cursor
+							env.Cursor = v_40
+							break golab55
+						}
+						env.Cursor = v_40
+						if env.Cursor >= env.Limit {
+							break lab54
+						}
+						env.NextChar()
+					}
+					if !env.SliceFrom("y") {
+						return false
+					}
+					continue replab53
+				}
+				env.Cursor = v_39
+				break replab53
+			}
+			break lab52
+		}
+		env.Cursor = v_38
+		break lab0
+	}
+	return true
+}
@@ -0,0 +1,685 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package finnish
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "pa", A: -1, B: 1, F: nil},
+	{Str: "sti", A: -1, B: 2, F: nil},
+	{Str: "kaan", A: -1, B: 1, F: nil},
+	{Str: "han", A: -1, B: 1, F: nil},
+	{Str: "kin", A: -1, B: 1, F: nil},
+	{Str: "h\u00E4n", A: -1, B: 1, F: nil},
+	{Str: "k\u00E4\u00E4n", A: -1, B: 1, F: nil},
+	{Str: "ko", A: -1, B: 1, F: nil},
+	{Str: "p\u00E4", A: -1, B: 1, F: nil},
+	{Str: "k\u00F6", A: -1, B: 1, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "lla", A: -1, B: -1, F: nil},
+	{Str: "na", A: -1, B: -1, F: nil},
+	{Str: "ssa", A: -1, B: -1, F: nil},
+	{Str: "ta", A: -1, B: -1, F: nil},
+	{Str: "lta", A: 3, B: -1, F: nil},
+	{Str: "sta", A: 3, B: -1, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "ll\u00E4", A: -1, B: -1, F: nil},
+	{Str: "n\u00E4", A: -1, B: -1, F: nil},
+	{Str: "ss\u00E4", A: -1, B: -1, F: nil},
+	{Str: "t\u00E4", A: -1, B: -1, F: nil},
+	{Str: "lt\u00E4", A: 3, B: -1, F: nil},
+	{Str: "st\u00E4", A: 3, B: -1, F: nil},
+}
+
+var A_3 = []*snowballRuntime.Among{
+	{Str: "lle", A: -1, B: -1, F: nil},
+	{Str: "ine", A: -1, B: -1, F: nil},
+}
+
+var A_4 = []*snowballRuntime.Among{
+	{Str: "nsa", A: -1, B: 3, F: nil},
+	{Str: "mme", A: -1, B: 3, F: nil},
+	{Str: "nne", A: -1, B: 3, F: nil},
+	{Str: "ni", A: -1, B: 2, F: nil},
+	{Str: "si", A: -1, B: 1, F: nil},
+	{Str: "an", A: -1, B: 4, F: nil},
+	{Str: "en", A: -1, B: 6, F: nil},
+	{Str: "\u00E4n", A: -1, B: 5, F: nil},
+	{Str: "ns\u00E4", A: -1, B: 3, F: nil},
+}
+
+var A_5 = []*snowballRuntime.Among{
+	{Str: "aa", A: -1, B: -1, F: nil},
+	{Str: "ee", A: -1, B: -1, F: nil},
+	{Str: "ii", A: -1, B: -1, F: nil},
+	{Str: "oo", A: -1, B: -1, F: nil},
+	{Str: "uu", A: -1, B: -1, F: nil},
+	{Str: "\u00E4\u00E4", A: -1, B: -1, F: nil},
+	{Str: "\u00F6\u00F6", A: -1, B: -1, F: nil},
+}
+
+var A_6 = []*snowballRuntime.Among{
+	{Str: "a", A: -1, B: 8, F: nil},
+	{Str: "lla", A: 0, B: -1, F: nil},
+	{Str: "na", A: 0, B: -1, F: nil},
+	{Str: "ssa", A: 0, B: -1, F: nil},
+	{Str: "ta", A: 0, B: -1, F: nil},
+	{Str: "lta", A: 4, B: -1, F: nil},
+	{Str: "sta", A: 4, B: -1, F: nil},
+	{Str: "tta", A: 4, B: 2, F: nil},
+	{Str: "lle", A: -1, B: -1, F: nil},
+	{Str: "ine", A: -1, B: -1, F: nil},
+	{Str: "ksi", A: -1, B: -1, F: nil},
+	{Str: "n", A: -1, B: 7, F: nil},
+	{Str: "han", A: 11, B: 1, F: nil},
+	{Str: "den", A: 11, B: -1, F: r_VI},
+	{Str: "seen", A: 11, B: -1, F: r_LONG},
+	{Str: "hen", A: 11, B: 2, F: nil},
+	{Str: "tten", A: 11, B: -1, F: r_VI},
+	{Str: "hin", A: 11, B: 3, F: nil},
+	{Str: "siin", A: 11, B: -1, F: r_VI},
+	{Str: "hon", A: 11, B: 4, F: nil},
+	{Str: "h\u00E4n", A: 11, B: 5, F: nil},
+	{Str: "h\u00F6n", A: 11, B: 6, F: nil},
+	{Str: "\u00E4", A: -1, B: 8, F: nil},
+	{Str: "ll\u00E4", A: 22, B: -1, F: nil},
+	{Str: "n\u00E4", A: 22, B: -1, F: nil},
+	{Str: "ss\u00E4", A: 22, B: -1, F: nil},
+	{Str: "t\u00E4", A: 22, B: -1, F: nil},
+	{Str: "lt\u00E4", A: 26, B: -1, F: nil},
+	{Str: "st\u00E4", A: 26, B: -1, F: nil},
+	{Str: "tt\u00E4", A: 26, B: 2, F: nil},
+}
+
+var A_7 = []*snowballRuntime.Among{
+	{Str: "eja", A: -1, B: -1, F: nil},
+	{Str: "mma", A: -1, B: 1, F: nil},
+	{Str: "imma", A: 1, B: -1, F: nil},
+	{Str: "mpa", A: -1, B: 1, F: nil},
+	{Str: "impa", A: 3, B: -1, F: nil},
+	{Str: "mmi", A: -1, B: 1, F: nil},
+	{Str: "immi", A: 5, B: -1, F: nil},
+	{Str: "mpi", A: -1, B: 1, F: nil},
+	{Str: "impi", A: 7, B: -1, F: nil},
+	{Str: "ej\u00E4", A: -1, B: -1, F: nil},
+	{Str: "mm\u00E4", A: -1, B: 1, F: nil},
+	{Str: "imm\u00E4", A: 10, B: -1, F: nil},
+	{Str: "mp\u00E4", A: -1, B: 1, F: nil},
+	{Str: "imp\u00E4", A: 12, B: -1, F: nil},
+}
+
+var A_8 = []*snowballRuntime.Among{
+	{Str: "i", A: -1, B: -1, F: nil},
+	{Str: "j", A: -1, B: -1, F: nil},
+}
+
+var A_9 = []*snowballRuntime.Among{
+	{Str: "mma", A: -1, B: 1, F: nil},
+	{Str: "imma", A: 0, B: -1, F: nil},
+}
+
+var G_AEI = []byte{17, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8}
+
+var G_C = []byte{119, 223, 119, 1}
+
+var G_V1 = []byte{17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32}
+
+var G_V2 = []byte{17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32}
+
+var G_particle_end = []byte{17, 97, 24, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32}
+
+type Context struct {
+	b_ending_removed bool
+	S_x              string
+	i_p2             int
+	i_p1             int
+}
+
+func r_LONG(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if env.FindAmongB(A_5, context) == 0 {
+		return false
+	}
+	return true
+}
+
+func r_VI(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if !env.EqSB("i") {
+		return false
+	}
+	if !env.InGroupingB(G_V2, 97, 246) {
+		return false
+	}
+	return true
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		b_ending_removed: false,
+		S_x:              "",
+		i_p2:             0,
+		i_p1:             0,
+	}
+	_ = context
+	var among_var int32
+	var v_1 = env.Cursor
+lab0:
+	for {
+		context.i_p1 = env.Limit
+		context.i_p2 = env.Limit
+	golab1:
+		for {
+			var v_2 = env.Cursor
+		lab2:
+			for {
+				if !env.InGrouping(G_V1, 97, 246) {
+					break lab2
+				}
+				env.Cursor = v_2
+				break golab1
+			}
+			env.Cursor = v_2
+			if env.Cursor >= env.Limit {
+				break lab0
+			}
+			env.NextChar()
+		}
+	golab3:
+		for {
+		lab4:
+			for {
+				if !env.OutGrouping(G_V1, 97, 246) {
+					break lab4
+				}
+				break golab3
+			}
+			if env.Cursor >= env.Limit {
+				break lab0
+			}
+			env.NextChar()
+		}
+		context.i_p1 = env.Cursor
+	golab5:
+		for {
+			var v_4 = env.Cursor
+		lab6:
+			for {
+				if !env.InGrouping(G_V1, 97, 246) {
+					break lab6
+				}
+				env.Cursor = v_4
+				break golab5
+			}
+			env.Cursor = v_4
+			if env.Cursor >= env.Limit {
+				break lab0
+			}
+			env.NextChar()
+		}
+	golab7:
+		for {
+		lab8:
+			for {
+				if !env.OutGrouping(G_V1, 97, 246) {
+					break lab8
+				}
+				break golab7
+			}
+			if env.Cursor >= env.Limit {
+				break lab0
+			}
+			env.NextChar()
+		}
+		context.i_p2 = env.Cursor
+		break lab0
+	}
+	env.Cursor = v_1
+	context.b_ending_removed = false
+	env.LimitBackward = env.Cursor
+	env.Cursor = env.Limit
+	var v_6 = env.Limit - env.Cursor
+lab9:
+	for {
+		if env.Cursor < context.i_p1 {
+			break lab9
+		}
+		var v_8 = env.LimitBackward
+		env.LimitBackward = context.i_p1
+		env.Ket = env.Cursor
+		among_var = env.FindAmongB(A_0, context)
+		if among_var == 0 {
+			env.LimitBackward = v_8
+			break lab9
+		}
+		env.Bra = env.Cursor
+		env.LimitBackward = v_8
+		if among_var == 1 {
+			if !env.InGroupingB(G_particle_end, 97, 246) {
+				break lab9
+			}
+		} else if among_var == 2 {
+			if !(context.i_p2 <= env.Cursor) {
+				break lab9
+			}
+		}
+		if !env.SliceDel() {
+			return false
+		}
+		break lab9
+	}
+	env.Cursor = env.Limit - v_6
+	var v_9 = env.Limit - env.Cursor
+lab10:
+	for {
+		if env.Cursor < context.i_p1 {
+			break lab10
+		}
+		var v_11 = env.LimitBackward
+		env.LimitBackward = context.i_p1
+		env.Ket = env.Cursor
+		among_var = env.FindAmongB(A_4, context)
+		if among_var == 0 {
+			env.LimitBackward = v_11
+			break lab10
+		}
+		env.Bra = env.Cursor
+		env.LimitBackward = v_11
+		if among_var == 1 {
+			var v_12 = env.Limit - env.Cursor
+		lab11:
+			for {
+				if !env.EqSB("k") {
+					break lab11
+				}
+				break lab10
+			}
+			env.Cursor = env.Limit - v_12
+			if !env.SliceDel() {
+				return false
+			}
+		} else if among_var == 2 {
+			if !env.SliceDel() {
+				return false
+			}
+			env.Ket = env.Cursor
+			if !env.EqSB("kse") {
+				break lab10
+			}
+			env.Bra = env.Cursor
+			if !env.SliceFrom("ksi") {
+				return false
+			}
+		} else if among_var == 3 {
+			if !env.SliceDel() {
+				return false
+			}
+		} else if among_var == 4 {
+			if env.FindAmongB(A_1, context) == 0 {
+				break lab10
+			}
+			if !env.SliceDel() {
+				return false
+			}
+		} else if among_var == 5 {
+			if env.FindAmongB(A_2, context) == 0 {
+				break lab10
+			}
+			if !env.SliceDel() {
+				return false
+			}
+		} else if among_var == 6 {
+			if env.FindAmongB(A_3, context) == 0 {
+				break lab10
+			}
+			if !env.SliceDel() {
+				return false
+			}
+		}
+		break lab10
+	}
+	env.Cursor = env.Limit - v_9
+	var v_13 = env.Limit - env.Cursor
+lab12:
+	for {
+		if env.Cursor < context.i_p1 {
+			break lab12
+		}
+		var v_15 = env.LimitBackward
+		env.LimitBackward = context.i_p1
+		env.Ket = env.Cursor
+		among_var = env.FindAmongB(A_6, context)
+		if among_var == 0 {
+			env.LimitBackward = v_15
+			break lab12
+		}
+		env.Bra = env.Cursor
+		env.LimitBackward = v_15
+		if among_var == 1 {
+			if !env.EqSB("a") {
+				break lab12
+			}
+		} else if among_var == 2 {
+			if !env.EqSB("e") {
+				break lab12
+			}
+		} else if among_var == 3 {
+			if !env.EqSB("i") {
+				break lab12
+			}
+		} else if among_var == 4 {
+			if !env.EqSB("o") {
+				break lab12
+			}
+		} else if among_var == 5 {
+			if !env.EqSB("\u00E4") {
+				break lab12
+			}
+		} else if among_var == 6 {
+			if !env.EqSB("\u00F6") {
+				break lab12
+			}
+		} else if among_var == 7 {
+			var v_16 = env.Limit - env.Cursor
+		lab13:
+			for {
+				var v_17 = env.Limit - env.Cursor
+			lab14:
+				for {
+					var v_18 = env.Limit - env.Cursor
+				lab15:
+					for {
+						if !r_LONG(env, context) {
+							break lab15
+						}
+						break lab14
+					}
+					env.Cursor = env.Limit - v_18
+					if !env.EqSB("ie") {
+						env.Cursor = env.Limit - v_16
+						break lab13
+					}
+					break lab14
+				}
+				env.Cursor = env.Limit - v_17
+				if env.Cursor <= env.LimitBackward {
+					env.Cursor = env.Limit - v_16
+					break lab13
+				}
+				env.PrevChar()
+				env.Bra = env.Cursor
+				break lab13
+			}
+		} else if among_var == 8 {
+			if !env.InGroupingB(G_V1, 97, 246) {
+				break lab12
+			}
+			if !env.InGroupingB(G_C, 98, 122) {
+				break lab12
+			}
+		}
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_ending_removed = true
+		break lab12
+	}
+	env.Cursor = env.Limit - v_13
+	var v_19 = env.Limit - env.Cursor
+lab16:
+	for {
+		if env.Cursor < context.i_p2 {
+			break lab16
+		}
+		var v_21 = env.LimitBackward
+		env.LimitBackward = context.i_p2
+		env.Ket = env.Cursor
+		among_var = env.FindAmongB(A_7, context)
+		if among_var == 0 {
+			env.LimitBackward = v_21
+			break lab16
+		}
+		env.Bra = env.Cursor
+		env.LimitBackward = v_21
+		if among_var == 1 {
+			var v_22 = env.Limit - env.Cursor
+		lab17:
+			for {
+				if !env.EqSB("po") {
+					break lab17
+				}
+				break lab16
+			}
+			env.Cursor = env.Limit - v_22
+		}
+		if !env.SliceDel() {
+			return false
+		}
+		break lab16
+	}
+	env.Cursor = env.Limit - v_19
+lab18:
+	for {
+	lab19:
+		for {
+			if !context.b_ending_removed {
+				break lab19
+			}
+			var v_24 = env.Limit - env.Cursor
+		lab20:
+			for {
+				if env.Cursor < context.i_p1 {
+					break lab20
+				}
+				var v_26 = env.LimitBackward
+				env.LimitBackward = context.i_p1
+				env.Ket = env.Cursor
+				if env.FindAmongB(A_8, context) == 0 {
+					env.LimitBackward = v_26
+					break lab20
+				}
+				env.Bra = env.Cursor
+				env.LimitBackward = v_26
+				if !env.SliceDel() {
+					return false
+				}
+				break lab20
+			}
+			env.Cursor = env.Limit - v_24
+			break lab18
+		}
+		var v_27 = env.Limit - env.Cursor
+	lab21:
+		for {
+			if env.Cursor < context.i_p1 {
+				break lab21
+			}
+			var v_29 = env.LimitBackward
+			env.LimitBackward = context.i_p1
+			env.Ket = env.Cursor
+			if !env.EqSB("t") {
+				env.LimitBackward = v_29
+				break lab21
+			}
+			env.Bra = env.Cursor
+			var v_30 = env.Limit - env.Cursor
+			if !env.InGroupingB(G_V1, 97, 246) {
+				env.LimitBackward = v_29
+				break lab21
+			}
+			env.Cursor = env.Limit - v_30
+			if !env.SliceDel() {
+				return false
+			}
+			env.LimitBackward = v_29
+			if env.Cursor < context.i_p2 {
+				break lab21
+			}
+			var v_32 = env.LimitBackward
+			env.LimitBackward = context.i_p2
+			env.Ket = env.Cursor
+			among_var = env.FindAmongB(A_9, context)
+			if among_var == 0 {
+				env.LimitBackward = v_32
+				break lab21
+			}
+			env.Bra = env.Cursor
+			env.LimitBackward = v_32
+			if among_var == 1 {
+				var v_33 = env.Limit - env.Cursor
+			lab22:
+				for {
+					if !env.EqSB("po") {
+						break lab22
+					}
+					break lab21
+				}
+				env.Cursor = env.Limit - v_33
+			}
+			if !env.SliceDel() {
+				return false
+			}
+			break lab21
+		}
+		env.Cursor = env.Limit - v_27
+		break lab18
+	}
+	var v_34 = env.Limit - env.Cursor
+lab23:
+	for {
+		if env.Cursor < context.i_p1 {
+			break lab23
+		}
+		var v_36 = env.LimitBackward
+		env.LimitBackward = context.i_p1
+		var v_37 = env.Limit - env.Cursor
+	lab24:
+		for {
+			var v_38 = env.Limit - env.Cursor
+			if !r_LONG(env, context) {
+				break lab24
+			}
+			env.Cursor = env.Limit - v_38
+			env.Ket = env.Cursor
+			if env.Cursor <= env.LimitBackward {
+				break lab24
+			}
+			env.PrevChar()
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			break lab24
+		}
+		env.Cursor = env.Limit - v_37
+		var v_39 = env.Limit - env.Cursor
+	lab25:
+		for {
+			env.Ket = env.Cursor
+			if !env.InGroupingB(G_AEI, 97, 228) {
+				break lab25
+			}
+			env.Bra = env.Cursor
+			if !env.InGroupingB(G_C, 98, 122) {
+				break lab25
+			}
+			if !env.SliceDel() {
+				return false
+			}
+			break lab25
+		}
+		env.Cursor = env.Limit - v_39
+		var v_40 = env.Limit - env.Cursor
+	lab26:
+		for {
+			env.Ket = env.Cursor
+			if !env.EqSB("j") {
+				break lab26
+			}
+			env.Bra = env.Cursor
+		lab27:
+			for {
+				var v_41 = env.Limit - env.Cursor
+			lab28:
+				for {
+					if !env.EqSB("o") {
+						break lab28
+					}
+					break lab27
+				}
+				env.Cursor = env.Limit - v_41
+				if !env.EqSB("u") {
+					break lab26
+				}
+				break lab27
+			}
+			if !env.SliceDel() {
+				return false
+			}
+			break lab26
+		}
+		env.Cursor = env.Limit - v_40
+		var v_42 = env.Limit - env.Cursor
+	lab29:
+		for {
+			env.Ket = env.Cursor
+			if !env.EqSB("o") {
+				break lab29
+			}
+			env.Bra = env.Cursor
+			if !env.EqSB("j") {
+				break lab29
+			}
+			if !env.SliceDel() {
+				return false
+			}
+			break lab29
+		}
+		env.Cursor = env.Limit - v_42
+		env.LimitBackward = v_36
+	golab30:
+		for {
+			var v_43 = env.Limit - env.Cursor
+		lab31:
+			for {
+				if !env.OutGroupingB(G_V1, 97, 246) {
+					break lab31
+				}
+				env.Cursor = env.Limit - v_43
+				break golab30
+			}
+			env.Cursor = env.Limit - v_43
+			if env.Cursor <= env.LimitBackward {
+				break lab23
+			}
+			env.PrevChar()
+		}
+		env.Ket = env.Cursor
+		if !env.InGroupingB(G_C, 98, 122) {
+			break lab23
+		}
+		env.Bra = env.Cursor
+		context.S_x = env.SliceTo()
+		if context.S_x == "" {
+			return false
+		}
+		if !env.EqSB(context.S_x) {
+			break lab23
+		}
+		if !env.SliceDel() {
+			return false
+		}
+		break lab23
+	}
+	env.Cursor = env.Limit - v_34
+	env.Cursor = env.LimitBackward
+	return true
+}
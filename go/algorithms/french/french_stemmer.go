@@ -0,0 +1,1143 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package french
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "col", A: -1, B: -1, F: nil},
+	{Str: "par", A: -1, B: -1, F: nil},
+	{Str: "tap", A: -1, B: -1, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "", A: -1, B: 7, F: nil},
+	{Str: "H", A: 0, B: 6, F: nil},
+	{Str: "He", A: 1, B: 4, F: nil},
+	{Str: "Hi", A: 1, B: 5, F: nil},
+	{Str: "I", A: 0, B: 1, F: nil},
+	{Str: "U", A: 0, B: 2, F: nil},
+	{Str: "Y", A: 0, B: 3, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "iqU", A: -1, B: 3, F: nil},
+	{Str: "abl", A: -1, B: 3, F: nil},
+	{Str: "I\u00E8r", A: -1, B: 4, F: nil},
+	{Str: "i\u00E8r", A: -1, B: 4, F: nil},
+	{Str: "eus", A: -1, B: 2, F: nil},
+	{Str: "iv", A: -1, B: 1, F: nil},
+}
+
+var A_3 = []*snowballRuntime.Among{
+	{Str: "ic", A: -1, B: 2, F: nil},
+	{Str: "abil", A: -1, B: 1, F: nil},
+	{Str: "iv", A: -1, B: 3, F: nil},
+}
+
+var A_4 = []*snowballRuntime.Among{
+	{Str: "iqUe", A: -1, B: 1, F: nil},
+	{Str: "atrice", A: -1, B: 2, F: nil},
+	{Str: "ance", A: -1, B: 1, F: nil},
+	{Str: "ence", A: -1, B: 5, F: nil},
+	{Str: "logie", A: -1, B: 3, F: nil},
+	{Str: "able", A: -1, B: 1, F: nil},
+	{Str: "isme", A: -1, B: 1, F: nil},
+	{Str: "euse", A: -1, B: 11, F: nil},
+	{Str: "iste", A: -1, B: 1, F: nil},
+	{Str: "ive", A: -1, B: 8, F: nil},
+	{Str: "if", A: -1, B: 8, F: nil},
+	{Str: "usion", A: -1, B: 4, F: nil},
+	{Str: "ation", A: -1, B: 2, F: nil},
+	{Str: "ution", A: -1, B: 4, F: nil},
+	{Str: "ateur", A: -1, B: 2, F: nil},
+	{Str: "iqUes", A: -1, B: 1, F: nil},
+	{Str: "atrices", A: -1, B: 2, F: nil},
+	{Str: "ances", A: -1, B: 1, F: nil},
+	{Str: "ences", A: -1, B: 5, F: nil},
+	{Str: "logies", A: -1, B: 3, F: nil},
+	{Str: "ables", A: -1, B: 1, F: nil},
+	{Str: "ismes", A: -1, B: 1, F: nil},
+	{Str: "euses", A: -1, B: 11, F: nil},
+	{Str: "istes", A: -1, B: 1, F: nil},
+	{Str: "ives", A: -1, B: 8, F: nil},
+	{Str: "ifs", A: -1, B: 8, F: nil},
+	{Str: "usions", A: -1, B: 4, F: nil},
+	{Str: "ations", A: -1, B: 2, F: nil},
+	{Str: "utions", A: -1, B: 4, F: nil},
+	{Str: "ateurs", A: -1, B: 2, F: nil},
+	{Str: "ments", A: -1, B: 15, F: nil},
+	{Str: "ements", A: 30, B: 6, F: nil},
+	{Str: "issements", A: 31, B: 12, F: nil},
+	{Str: "it\u00E9s", A: -1, B: 7, F: nil},
+	{Str: "ment", A: -1, B: 15, F: nil},
+	{Str: "ement", A: 34, B: 6, F: nil},
+	{Str: "issement", A: 35, B: 12, F: nil},
+	{Str: "amment", A: 34, B: 13, F: nil},
+	{Str: "emment", A: 34, B: 14, F: nil},
+	{Str: "aux", A: -1, B: 10, F: nil},
+	{Str: "eaux", A: 39, B: 9, F: nil},
+	{Str: "eux", A: -1, B: 1, F: nil},
+	{Str: "it\u00E9", A: -1, B: 7, F: nil},
+}
+
+var A_5 = []*snowballRuntime.Among{
+	{Str: "ira", A: -1, B: 1, F: nil},
+	{Str: "ie", A: -1, B: 1, F: nil},
+	{Str: "isse", A: -1, B: 1, F: nil},
+	{Str: "issante", A: -1, B: 1, F: nil},
+	{Str: "i", A: -1, B: 1, F: nil},
+	{Str: "irai", A: 4, B: 1, F: nil},
+	{Str: "ir", A: -1, B: 1, F: nil},
+	{Str: "iras", A: -1, B: 1, F: nil},
+	{Str: "ies", A: -1, B: 1, F: nil},
+	{Str: "\u00EEmes", A: -1, B: 1, F: nil},
+	{Str: "isses", A: -1, B: 1, F: nil},
+	{Str: "issantes", A: -1, B: 1, F: nil},
+	{Str: "\u00EEtes", A: -1, B: 1, F: nil},
+	{Str: "is", A: -1, B: 1, F: nil},
+	{Str: "irais", A: 13, B: 1, F: nil},
+	{Str: "issais", A: 13, B: 1, F: nil},
+	{Str: "irions", A: -1, B: 1, F: nil},
+	{Str: "issions", A: -1, B: 1, F: nil},
+	{Str: "irons", A: -1, B: 1, F: nil},
+	{Str: "issons", A: -1, B: 1, F: nil},
+	{Str: "issants", A: -1, B: 1, F: nil},
+	{Str: "it", A: -1, B: 1, F: nil},
+	{Str: "irait", A: 21, B: 1, F: nil},
+	{Str: "issait", A: 21, B: 1, F: nil},
+	{Str: "issant", A: -1, B: 1, F: nil},
+	{Str: "iraIent", A: -1, B: 1, F: nil},
+	{Str: "issaIent", A: -1, B: 1, F: nil},
+	{Str: "irent", A: -1, B: 1, F: nil},
+	{Str: "issent", A: -1, B: 1, F: nil},
+	{Str: "iront", A: -1, B: 1, F: nil},
+	{Str: "\u00EEt", A: -1, B: 1, F: nil},
+	{Str: "iriez", A: -1, B: 1, F: nil},
+	{Str: "issiez", A: -1, B: 1, F: nil},
+	{Str: "irez", A: -1, B: 1, F: nil},
+	{Str: "issez", A: -1, B: 1, F: nil},
+}
+
+var A_6 = []*snowballRuntime.Among{
+	{Str: "a", A: -1, B: 3, F: nil},
+	{Str: "era", A: 0, B: 2, F: nil},
+	{Str: "asse", A: -1, B: 3, F: nil},
+	{Str: "ante", A: -1, B: 3, F: nil},
+	{Str: "\u00E9e", A: -1, B: 2, F: nil},
+	{Str: "ai", A: -1, B: 3, F: nil},
+	{Str: "erai", A: 5, B: 2, F: nil},
+	{Str: "er", A: -1, B: 2, F: nil},
+	{Str: "as", A: -1, B: 3, F: nil},
+	{Str: "eras", A: 8, B: 2, F: nil},
+	{Str: "\u00E2mes", A: -1, B: 3, F: nil},
+	{Str: "asses", A: -1, B: 3, F: nil},
+	{Str: "antes", A: -1, B: 3, F: nil},
+	{Str: "\u00E2tes", A: -1, B: 3, F: nil},
+	{Str: "\u00E9es", A: -1, B: 2, F: nil},
+	{Str: "ais", A: -1, B: 3, F: nil},
+	{Str: "erais", A: 15, B: 2, F: nil},
+	{Str: "ions", A: -1, B: 1, F: nil},
+	{Str: "erions", A: 17, B: 2, F: nil},
+	{Str: "assions", A: 17, B: 3, F: nil},
+	{Str: "erons", A: -1, B: 2, F: nil},
+	{Str: "ants", A: -1, B: 3, F: nil},
+	{Str: "\u00E9s", A: -1, B: 2, F: nil},
+	{Str: "ait", A: -1, B: 3, F: nil},
+	{Str: "erait", A: 23, B: 2, F: nil},
+	{Str: "ant", A: -1, B: 3, F: nil},
+	{Str: "aIent", A: -1, B: 3, F: nil},
+	{Str: "eraIent", A: 26, B: 2, F: nil},
+	{Str: "\u00E8rent", A: -1, B: 2, F: nil},
+	{Str: "assent", A: -1, B: 3, F: nil},
+	{Str: "eront", A: -1, B: 2, F: nil},
+	{Str: "\u00E2t", A: -1, B: 3, F: nil},
+	{Str: "ez", A: -1, B: 2, F: nil},
+	{Str: "iez", A: 32, B: 2, F: nil},
+	{Str: "eriez", A: 33, B: 2, F: nil},
+	{Str: "assiez", A: 33, B: 3, F: nil},
+	{Str: "erez", A: 32, B: 2, F: nil},
+	{Str: "\u00E9", A: -1, B: 2, F: nil},
+}
+
+var A_7 = []*snowballRuntime.Among{
+	{Str: "e", A: -1, B: 3, F: nil},
+	{Str: "I\u00E8re", A: 0, B: 2, F: nil},
+	{Str: "i\u00E8re", A: 0, B: 2, F: nil},
+	{Str: "ion", A: -1, B: 1, F: nil},
+	{Str: "Ier", A: -1, B: 2, F: nil},
+	{Str: "ier", A: -1, B: 2, F: nil},
+}
+
+var A_8 = []*snowballRuntime.Among{
+	{Str: "ell", A: -1, B: -1, F: nil},
+	{Str: "eill", A: -1, B: -1, F: nil},
+	{Str: "enn", A: -1, B: -1, F: nil},
+	{Str: "onn", A: -1, B: -1, F: nil},
+	{Str: "ett", A: -1, B: -1, F: nil},
+}
+
+var G_v = []byte{17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 130, 103, 8, 5}
+
+var G_keep_with_s = []byte{1, 65, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128}
+
+type Context struct {
+	i_p2 int
+	i_p1 int
+	i_pV int
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		i_p2: 0,
+		i_p1: 0,
+		i_pV: 0,
+	}
+	_ = context
+	var among_var int32
+	var v_1 = env.Cursor
+lab0:
+	for {
+	replab1:
+		for {
+			var v_2 = env.Cursor
+		lab2:
+			for range [2]struct{}{} {
+			golab3:
+				for {
+					var v_3 = env.Cursor
+				lab4:
+					for {
+					lab5:
+						for {
+							var v_4 = env.Cursor
+						lab6:
+							for {
+								if !env.InGrouping(G_v, 97, 251) {
+									break lab6
+								}
+								env.Bra = env.Cursor
+							lab7:
+								for {
+									var v_5 = env.Cursor
+								lab8:
+									for {
+										if !env.EqS("u") {
+											break lab8
+										}
+										env.Ket = env.Cursor
+										if !env.InGrouping(G_v, 97, 251) {
+											break lab8
+										}
+										if !env.SliceFrom("U") {
+											return false
+										}
+										break lab7
+									}
+									env.Cursor = v_5
+								lab9:
+									for {
+										if !env.EqS("i") {
+											break lab9
+										}
+										env.Ket = env.Cursor
+										if !env.InGrouping(G_v, 97, 251) {
+											break lab9
+										}
+										if !env.SliceFrom("I") {
+											return false
+										}
+										break lab7
+									}
+									env.Cursor = v_5
+									if !env.EqS("y") {
+										break lab6
+									}
+									env.Ket = env.Cursor
+									if !env.SliceFrom("Y") {
+										return false
+									}
+									break lab7
+								}
+								break lab5
+							}
+							env.Cursor = v_4
+						lab10:
+							for {
+								env.Bra = env.Cursor
+								if !env.EqS("\u00EB") {
+									break lab10
+								}
+								env.Ket = env.Cursor
+								if !env.SliceFrom("He") {
+									return false
+								}
+								break lab5
+							}
+							env.Cursor = v_4
+						lab11:
+							for {
+								env.Bra = env.Cursor
+								if !env.EqS("\u00EF") {
+									break lab11
+								}
+								env.Ket = env.Cursor
+								if !env.SliceFrom("Hi") {
+									return false
+								}
+								break lab5
+							}
+							env.Cursor = v_4
+						lab12:
+							for {
+								env.Bra = env.Cursor
+								if !env.EqS("y") {
+									break lab12
+								}
+								env.Ket = env.Cursor
+								if !env.InGrouping(G_v, 97, 251) {
+									break lab12
+								}
+								if !env.SliceFrom("Y") {
+									return false
+								}
+								break lab5
+							}
+							env.Cursor = v_4
+							if !env.EqS("q") {
+								break lab4
+							}
+							env.Bra = env.Cursor
+							if !env.EqS("u") {
+								break lab4
+							}
+							env.Ket = env.Cursor
+							if !env.SliceFrom("U") {
+								return false
+							}
+							break lab5
+						}
+						env.Cursor = v_3
+						break golab3
+					}
+					env.Cursor = v_3
+					if env.Cursor >= env.Limit {
+						break lab2
+					}
+					env.NextChar()
+				}
+				continue replab1
+			}
+			env.Cursor = v_2
+			break replab1
+		}
+		break lab0
+	}
+	env.Cursor = v_1
+lab13:
+	for {
+		context.i_pV = env.Limit
+		context.i_p1 = env.Limit
+		context.i_p2 = env.Limit
+		var v_7 = env.Cursor
+	lab14:
+		for {
+		lab15:
+			for {
+				var v_8 = env.Cursor
+			lab16:
+				for {
+					if !env.InGrouping(G_v, 97, 251) {
+						break lab16
+					}
+					if !env.InGrouping(G_v, 97, 251) {
+						break lab16
+					}
+					if env.Cursor >= env.Limit {
+						break lab16
+					}
+					env.NextChar()
+					break lab15
+				}
+				env.Cursor = v_8
+			lab17:
+				for {
+					if env.FindAmong(A_0, context) == 0 {
+						break lab17
+					}
+					break lab15
+				}
+				env.Cursor = v_8
+				if env.Cursor >= env.Limit {
+					break lab14
+				}
+				env.NextChar()
+			golab18:
+				for {
+				lab19:
+					for {
+						if !env.InGrouping(G_v, 97, 251) {
+							break lab19
+						}
+						break golab18
+					}
+					if env.Cursor >= env.Limit {
+						break lab14
+					}
+					env.NextChar()
+				}
+				break lab15
+			}
+			context.i_pV = env.Cursor
+			break lab14
+		}
+		env.Cursor = v_7
+		var v_10 = env.Cursor
+	lab20:
+		for {
+		golab21:
+			for {
+			lab22:
+				for {
+					if !env.InGrouping(G_v, 97, 251) {
+						break lab22
+					}
+					break golab21
+				}
+				if env.Cursor >= env.Limit {
+					break lab20
+				}
+				env.NextChar()
+			}
+		golab23:
+			for {
+			lab24:
+				for {
+					if !env.OutGrouping(G_v, 97, 251) {
+						break lab24
+					}
+					break golab23
+				}
+				if env.Cursor >= env.Limit {
+					break lab20
+				}
+				env.NextChar()
+			}
+			context.i_p1 = env.Cursor
+		golab25:
+			for {
+			lab26:
+				for {
+					if !env.InGrouping(G_v, 97, 251) {
+						break lab26
+					}
+					break golab25
+				}
+				if env.Cursor >= env.Limit {
+					break lab20
+				}
+				env.NextChar()
+			}
+		golab27:
+			for {
+			lab28:
+				for {
+					if !env.OutGrouping(G_v, 97, 251) {
+						break lab28
+					}
+					break golab27
+				}
+				if env.Cursor >= env.Limit {
+					break lab20
+				}
+				env.NextChar()
+			}
+			context.i_p2 = env.Cursor
+			break lab20
+		}
+		env.Cursor = v_10
+		break lab13
+	}
+	env.LimitBackward = env.Cursor
+	env.Cursor = env.Limit
+	var v_15 = env.Limit - env.Cursor
+lab29:
+	for {
+	lab30:
+		for {
+			var v_16 = env.Limit - env.Cursor
+		lab31:
+			for {
+				var v_17 = env.Limit - env.Cursor
+			lab32:
+				for {
+					var v_18 = env.Limit - env.Cursor
+				lab33:
+					for {
+						env.Ket = env.Cursor
+						among_var = env.FindAmongB(A_4, context)
+						if among_var == 0 {
+							break lab33
+						}
+						env.Bra = env.Cursor
+						if among_var == 1 {
+							if !(context.i_p2 <= env.Cursor) {
+								break lab33
+							}
+							if !env.SliceDel() {
+								return false
+							}
+						} else if among_var == 2 {
+							if !(context.i_p2 <= env.Cursor) {
+								break lab33
+							}
+							if !env.SliceDel() {
+								return false
+							}
+							var v_19 = env.Limit - env.Cursor
+						lab34:
+							for {
+								env.Ket = env.Cursor
+								if !env.EqSB("ic") {
+									env.Cursor = env.Limit - v_19
+									break lab34
+								}
+								env.Bra = env.Cursor
+							lab35:
+								for {
+									var v_20 = env.Limit - env.Cursor
+								lab36:
+									for {
+										if !(context.i_p2 <= env.Cursor) {
+											break lab36
+										}
+										if !env.SliceDel() {
+											return false
+										}
+										break lab35
+									}
+									env.Cursor = env.Limit - v_20
+									if !env.SliceFrom("iqU") {
+										return false
+									}
+									break lab35
+								}
+								break lab34
+							}
+						} else if among_var == 3 {
+							if !(context.i_p2 <= env.Cursor) {
+								break lab33
+							}
+							if !env.SliceFrom("log") {
+								return false
+							}
+						} else if among_var == 4 {
+							if !(context.i_p2 <= env.Cursor) {
+								break lab33
+							}
+							if !env.SliceFrom("u") {
+								return false
+							}
+						} else if among_var == 5 {
+							if !(context.i_p2 <= env.Cursor) {
+								break lab33
+							}
+							if !env.SliceFrom("ent") {
+								return false
+							}
+						} else if among_var == 6 {
+							if !(context.i_pV <= env.Cursor) {
+								break lab33
+							}
+							if !env.SliceDel() {
+								return false
+							}
+							var v_21 = env.Limit - env.Cursor
+						lab37:
+							for {
+								env.Ket = env.Cursor
+								among_var = env.FindAmongB(A_2, context)
+								if among_var == 0 {
+									env.Cursor = env.Limit - v_21
+									break lab37
+								}
+								env.Bra = env.Cursor
+								if among_var == 1 {
+									if !(context.i_p2 <= env.Cursor) {
+										env.Cursor = env.Limit - v_21
+										break lab37
+									}
+									if !env.SliceDel() {
+										return false
+									}
+									env.Ket = env.Cursor
+									if !env.EqSB("at") {
+										env.Cursor = env.Limit - v_21
+										break lab37
+									}
+									env.Bra = env.Cursor
+									if !(context.i_p2 <= env.Cursor) {
+										env.Cursor = env.Limit - v_21
+										break lab37
+									}
+									if !env.SliceDel() {
+										return false
+									}
+								} else if among_var == 2 {
+								lab38:
+									for {
+										var v_22 = env.Limit - env.Cursor
+									lab39:
+										for {
+											if !(context.i_p2 <= env.Cursor) {
+												break lab39
+											}
+											if !env.SliceDel() {
+												return false
+											}
+											break lab38
+										}
+										env.Cursor = env.Limit - v_22
+										if !(context.i_p1 <= env.Cursor) {
+											env.Cursor = env.Limit - v_21
+											break lab37
+										}
+										if !env.SliceFrom("eux") {
+											return false
+										}
+										break lab38
+									}
+								} else if among_var == 3 {
+									if !(context.i_p2 <= env.Cursor) {
+										env.Cursor = env.Limit - v_21
+										break lab37
+									}
+									if !env.SliceDel() {
+										return false
+									}
+								} else if among_var == 4 {
+									if !(context.i_pV <= env.Cursor) {
+										env.Cursor = env.Limit - v_21
+										break lab37
+									}
+									if !env.SliceFrom("i") {
+										return false
+									}
+								}
+								break lab37
+							}
+						} else if among_var == 7 {
+							if !(context.i_p2 <= env.Cursor) {
+								break lab33
+							}
+							if !env.SliceDel() {
+								return false
+							}
+							var v_23 = env.Limit - env.Cursor
+						lab40:
+							for {
+								env.Ket = env.Cursor
+								among_var = env.FindAmongB(A_3, context)
+								if among_var == 0 {
+									env.Cursor = env.Limit - v_23
+									break lab40
+								}
+								env.Bra = env.Cursor
+								if among_var == 1 {
+								lab41:
+									for {
+										var v_24 = env.Limit - env.Cursor
+									lab42:
+										for {
+											if !(context.i_p2 <= env.Cursor) {
+												break lab42
+											}
+											if !env.SliceDel() {
+												return false
+											}
+											break lab41
+										}
+										env.Cursor = env.Limit - v_24
+										if !env.SliceFrom("abl") {
+											return false
+										}
+										break lab41
+									}
+								} else if among_var == 2 {
+								lab43:
+									for {
+										var v_25 = env.Limit - env.Cursor
+									lab44:
+										for {
+											if !(context.i_p2 <= env.Cursor) {
+												break lab44
+											}
+											if !env.SliceDel() {
+												return false
+											}
+											break lab43
+										}
+										env.Cursor = env.Limit - v_25
+										if !env.SliceFrom("iqU") {
+											return false
+										}
+										break lab43
+									}
+								} else if among_var == 3 {
+									if !(context.i_p2 <= env.Cursor) {
+										env.Cursor = env.Limit - v_23
+										break lab40
+									}
+									if !env.SliceDel() {
+										return false
+									}
+								}
+								break lab40
+							}
+						} else if among_var == 8 {
+							if !(context.i_p2 <= env.Cursor) {
+								break lab33
+							}
+							if !env.SliceDel() {
+								return false
+							}
+							var v_26 = env.Limit - env.Cursor
+						lab45:
+							for {
+								env.Ket = env.Cursor
+								if !env.EqSB("at") {
+									env.Cursor = env.Limit - v_26
+									break lab45
+								}
+								env.Bra = env.Cursor
+								if !(context.i_p2 <= env.Cursor) {
+									env.Cursor = env.Limit - v_26
+									break lab45
+								}
+								if !env.SliceDel() {
+									return false
+								}
+								env.Ket = env.Cursor
+								if !env.EqSB("ic") {
+									env.Cursor = env.Limit - v_26
+									break lab45
+								}
+								env.Bra = env.Cursor
+							lab46:
+								for {
+									var v_27 = env.Limit - env.Cursor
+								lab47:
+									for {
+										if !(context.i_p2 <= env.Cursor) {
+											break lab47
+										}
+										if !env.SliceDel() {
+											return false
+										}
+										break lab46
+									}
+									env.Cursor = env.Limit - v_27
+									if !env.SliceFrom("iqU") {
+										return false
+									}
+									break lab46
+								}
+								break lab45
+							}
+						} else if among_var == 9 {
+							if !env.SliceFrom("eau") {
+								return false
+							}
+						} else if among_var == 10 {
+							if !(context.i_p1 <= env.Cursor) {
+								break lab33
+							}
+							if !env.SliceFrom("al") {
+								return false
+							}
+						} else if among_var == 11 {
+						lab48:
+							for {
+								var v_28 = env.Limit - env.Cursor
+							lab49:
+								for {
+									if !(context.i_p2 <= env.Cursor) {
+										break lab49
+									}
+									if !env.SliceDel() {
+										return false
+									}
+									break lab48
+								}
+								env.Cursor = env.Limit - v_28
+								if !(context.i_p1 <= env.Cursor) {
+									break lab33
+								}
+								if !env.SliceFrom("eux") {
+									return false
+								}
+								break lab48
+							}
+						} else if among_var == 12 {
+							if !(context.i_p1 <= env.Cursor) {
+								break lab33
+							}
+							if !env.OutGroupingB(G_v, 97, 251) {
+								break lab33
+							}
+							if !env.SliceDel() {
+								return false
+							}
+						} else if among_var == 13 {
+							if !(context.i_pV <= env.Cursor) {
+								break lab33
+							}
+							if !env.SliceFrom("ant") {
+								return false
+							}
+							break lab33
+						} else if among_var == 14 {
+							if !(context.i_pV <= env.Cursor) {
+								break lab33
+							}
+							if !env.SliceFrom("ent") {
+								return false
+							}
+							break lab33
+						} else if among_var == 15 {
+							var v_29 = env.Limit - env.Cursor
+							if !env.InGroupingB(G_v, 97, 251) {
+								break lab33
+							}
+							if !(context.i_pV <= env.Cursor) {
+								break lab33
+							}
+							env.Cursor = env.Limit - v_29
+							if !env.SliceDel() {
+								return false
+							}
+							break lab33
+						}
+						break lab32
+					}
+					env.Cursor = env.Limit - v_18
+				lab50:
+					for {
+						if env.Cursor < context.i_pV {
+							break lab50
+						}
+						var v_31 = env.LimitBackward
+						env.LimitBackward = context.i_pV
+						env.Ket = env.Cursor
+						if env.FindAmongB(A_5, context) == 0 {
+							env.LimitBackward = v_31
+							break lab50
+						}
+						env.Bra = env.Cursor
+						var v_32 = env.Limit - env.Cursor
+					lab51:
+						for {
+							if !env.EqSB("H") {
+								break lab51
+							}
+							env.LimitBackward = v_31
+							break lab50
+						}
+						env.Cursor = env.Limit - v_32
+						if !env.OutGroupingB(G_v, 97, 251) {
+							env.LimitBackward = v_31
+							break lab50
+						}
+						if !env.SliceDel() {
+							return false
+						}
+						env.LimitBackward = v_31
+						break lab32
+					}
+					env.Cursor = env.Limit - v_18
+					if env.Cursor < context.i_pV {
+						break lab31
+					}
+					var v_34 = env.LimitBackward
+					env.LimitBackward = context.i_pV
+					env.Ket = env.Cursor
+					among_var = env.FindAmongB(A_6, context)
+					if among_var == 0 {
+						env.LimitBackward = v_34
+						break lab31
+					}
+					env.Bra = env.Cursor
+					if among_var == 1 {
+						if !(context.i_p2 <= env.Cursor) {
+							env.LimitBackward = v_34
+							break lab31
+						}
+						if !env.SliceDel() {
+							return false
+						}
+					} else if among_var == 2 {
+						if !env.SliceDel() {
+							return false
+						}
+					} else if among_var == 3 {
+						if !env.SliceDel() {
+							return false
+						}
+						var v_35 = env.Limit - env.Cursor
+					lab52:
+						for {
+							env.Ket = env.Cursor
+							if !env.EqSB("e") {
+								env.Cursor = env.Limit - v_35
+								break lab52
+							}
+							env.Bra = env.Cursor
+							if !env.SliceDel() {
+								return false
+							}
+							break lab52
+						}
+					}
+					env.LimitBackward = v_34
+					break lab32
+				}
+				env.Cursor = env.Limit - v_17
+				var v_36 = env.Limit - env.Cursor
+			lab53:
+				for {
+					env.Ket = env.Cursor
+				lab54:
+					for {
+						var v_37 = env.Limit - env.Cursor
+					lab55:
+						for {
+							if !env.EqSB("Y") {
+								break lab55
+							}
+							env.Bra = env.Cursor
+							if !env.SliceFrom("i") {
+								return false
+							}
+							break lab54
+						}
+						env.Cursor = env.Limit - v_37
+						if !env.EqSB("\u00E7") {
+							env.Cursor = env.Limit - v_36
+							break lab53
+						}
+						env.Bra = env.Cursor
+						if !env.SliceFrom("c") {
+							return false
+						}
+						break lab54
+					}
+					break lab53
+				}
+				break lab30
+			}
+			env.Cursor = env.Limit - v_16
+			var v_38 = env.Limit - env.Cursor
+		lab56:
+			for {
+				env.Ket = env.Cursor
+				if !env.EqSB("s") {
+					env.Cursor = env.Limit - v_38
+					break lab56
+				}
+				env.Bra = env.Cursor
+				var v_39 = env.Limit - env.Cursor
+			lab57:
+				for {
+					var v_40 = env.Limit - env.Cursor
+				lab58:
+					for {
+						if !env.EqSB("Hi") {
+							break lab58
+						}
+						break lab57
+					}
+					env.Cursor = env.Limit - v_40
+					if !env.OutGroupingB(G_keep_with_s, 97, 232) {
+						env.Cursor = env.Limit - v_38
+						break lab56
+					}
+					break lab57
+				}
+				env.Cursor = env.Limit - v_39
+				if !env.SliceDel() {
+					return false
+				}
+				break lab56
+			}
+			if env.Cursor < context.i_pV {
+				break lab29
+			}
+			var v_42 = env.LimitBackward
+			env.LimitBackward = context.i_pV
+			env.Ket = env.Cursor
+			among_var = env.FindAmongB(A_7, context)
+			if among_var == 0 {
+				env.LimitBackward = v_42
+				break lab29
+			}
+			env.Bra = env.Cursor
+			if among_var == 1 {
+				if !(context.i_p2 <= env.Cursor) {
+					env.LimitBackward = v_42
+					break lab29
+				}
+			lab59:
+				for {
+					var v_43 = env.Limit - env.Cursor
+				lab60:
+					for {
+						if !env.EqSB("s") {
+							break lab60
+						}
+						break lab59
+					}
+					env.Cursor = env.Limit - v_43
+					if !env.EqSB("t") {
+						env.LimitBackward = v_42
+						break lab29
+					}
+					break lab59
+				}
+				if !env.SliceDel() {
+					return false
+				}
+			} else if among_var == 2 {
+				if !env.SliceFrom("i") {
+					return false
+				}
+			} else if among_var == 3 {
+				if !env.SliceDel() {
+					return false
+				}
+			}
+			env.LimitBackward = v_42
+			break lab30
+		}
+		break lab29
+	}
+	env.Cursor = env.Limit - v_15
+	var v_44 = env.Limit - env.Cursor
+lab61:
+	for {
+		var v_45 = env.Limit - env.Cursor
+		if env.FindAmongB(A_8, context) == 0 {
+			break lab61
+		}
+		env.Cursor = env.Limit - v_45
+		env.Ket = env.Cursor
+		if env.Cursor <= env.LimitBackward {
+			break lab61
+		}
+		env.PrevChar()
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		break lab61
+	}
+	env.Cursor = env.Limit - v_44
+	var v_46 = env.Limit - env.Cursor
+lab62:
+	for {
+		var v_47 = 1
+	replab63:
+		for {
+		lab64:
+			for range [2]struct{}{} {
+				if !env.OutGroupingB(G_v, 97, 251) {
+					break lab64
+				}
+				v_47--
+				continue replab63
+			}
+			break replab63
+		}
+		if v_47 > 0 {
+			break lab62
+		}
+		env.Ket = env.Cursor
+	lab65:
+		for {
+			var v_49 = env.Limit - env.Cursor
+		lab66:
+			for {
+				if !env.EqSB("\u00E9") {
+					break lab66
+				}
+				break lab65
+			}
+			env.Cursor = env.Limit - v_49
+			if !env.EqSB("\u00E8") {
+				break lab62
+			}
+			break lab65
+		}
+		env.Bra = env.Cursor
+		if !env.SliceFrom("e") {
+			return false
+		}
+		break lab62
+	}
+	env.Cursor = env.Limit - v_46
+	env.Cursor = env.LimitBackward
+	var v_50 = env.Cursor
+lab67:
+	for {
+	replab68:
+		for {
+			var v_51 = env.Cursor
+		lab69:
+			for range [2]struct{}{} {
+				env.Bra = env.Cursor
+				among_var = env.FindAmong(A_1, context)
+				if among_var == 0 {
+					break lab69
+				}
+				env.Ket = env.Cursor
+				if among_var == 1 {
+					if !env.SliceFrom("i") {
+						return false
+					}
+				} else if among_var == 2 {
+					if !env.SliceFrom("u") {
+						return false
+					}
+				} else if among_var == 3 {
+					if !env.SliceFrom("y") {
+						return false
+					}
+				} else if among_var == 4 {
+					if !env.SliceFrom("\u00EB") {
+						return false
+					}
+				} else if among_var == 5 {
+					if !env.SliceFrom("\u00EF") {
+						return false
+					}
+				} else if among_var == 6 {
+					if !env.SliceDel() {
+						return false
+					}
+				} else if among_var == 7 {
+					if env.Cursor >= env.Limit {
+						break lab69
+					}
+					env.NextChar()
+				}
+				continue replab68
+			}
+			env.Cursor = v_51
+			break replab68
+		}
+		break lab67
+	}
+	env.Cursor = v_50
+	return true
+}
@@ -0,0 +1,498 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package german
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "", A: -1, B: 5, F: nil},
+	{Str: "U", A: 0, B: 2, F: nil},
+	{Str: "Y", A: 0, B: 1, F: nil},
+	{Str: "\u00E4", A: 0, B: 3, F: nil},
+	{Str: "\u00F6", A: 0, B: 4, F: nil},
+	{Str: "\u00FC", A: 0, B: 2, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "e", A: -1, B: 2, F: nil},
+	{Str: "em", A: -1, B: 1, F: nil},
+	{Str: "en", A: -1, B: 2, F: nil},
+	{Str: "ern", A: -1, B: 1, F: nil},
+	{Str: "er", A: -1, B: 1, F: nil},
+	{Str: "s", A: -1, B: 3, F: nil},
+	{Str: "es", A: 5, B: 2, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "en", A: -1, B: 1, F: nil},
+	{Str: "er", A: -1, B: 1, F: nil},
+	{Str: "st", A: -1, B: 2, F: nil},
+	{Str: "est", A: 2, B: 1, F: nil},
+}
+
+var A_3 = []*snowballRuntime.Among{
+	{Str: "ig", A: -1, B: 1, F: nil},
+	{Str: "lich", A: -1, B: 1, F: nil},
+}
+
+var A_4 = []*snowballRuntime.Among{
+	{Str: "end", A: -1, B: 1, F: nil},
+	{Str: "ig", A: -1, B: 2, F: nil},
+	{Str: "ung", A: -1, B: 1, F: nil},
+	{Str: "lich", A: -1, B: 3, F: nil},
+	{Str: "isch", A: -1, B: 2, F: nil},
+	{Str: "ik", A: -1, B: 2, F: nil},
+	{Str: "heit", A: -1, B: 3, F: nil},
+	{Str: "keit", A: -1, B: 4, F: nil},
+}
+
+var G_v = []byte{17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32, 8}
+
+var G_s_ending = []byte{117, 30, 5}
+
+var G_st_ending = []byte{117, 30, 4}
+
+type Context struct {
+	i_x  int
+	i_p2 int
+	i_p1 int
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		i_x:  0,
+		i_p2: 0,
+		i_p1: 0,
+	}
+	_ = context
+	var among_var int32
+	var v_1 = env.Cursor
+lab0:
+	for {
+		var v_2 = env.Cursor
+	replab1:
+		for {
+			var v_3 = env.Cursor
+		lab2:
+			for range [2]struct{}{} {
+			lab3:
+				for {
+					var v_4 = env.Cursor
+				lab4:
+					for {
+						env.Bra = env.Cursor
+						if !env.EqS("\u00DF") {
+							break lab4
+						}
+						env.Ket = env.Cursor
+						if !env.SliceFrom("ss") {
+							return false
+						}
+						break lab3
+					}
+					env.Cursor = v_4
+					if env.Cursor >= env.Limit {
+						break lab2
+					}
+					env.NextChar()
+					break lab3
+				}
+				continue replab1
+			}
+			env.Cursor = v_3
+			break replab1
+		}
+		env.Cursor = v_2
+	replab5:
+		for {
+			var v_5 = env.Cursor
+		lab6:
+			for range [2]struct{}{} {
+			golab7:
+				for {
+					var v_6 = env.Cursor
+				lab8:
+					for {
+						if !env.InGrouping(G_v, 97, 252) {
+							break lab8
+						}
+						env.Bra = env.Cursor
+					lab9:
+						for {
+							var v_7 = env.Cursor
+						lab10:
+							for {
+								if !env.EqS("u") {
+									break lab10
+								}
+								env.Ket = env.Cursor
+								if !env.InGrouping(G_v, 97, 252) {
+									break lab10
+								}
+								if !env.SliceFrom("U") {
+									return false
+								}
+								break lab9
+							}
+							env.Cursor = v_7
+							if !env.EqS("y") {
+								break lab8
+							}
+							env.Ket = env.Cursor
+							if !env.InGrouping(G_v, 97, 252) {
+								break lab8
+							}
+							if !env.SliceFrom("Y") {
+								return false
+							}
+							break lab9
+						}
+						env.Cursor = v_6
+						break golab7
+					}
+					env.Cursor = v_6
+					if env.Cursor >= env.Limit {
+						break lab6
+					}
+					env.NextChar()
+				}
+				continue replab5
+			}
+			env.Cursor = v_5
+			break replab5
+		}
+		break lab0
+	}
+	env.Cursor = v_1
+	var v_8 = env.Cursor
+lab11:
+	for {
+		context.i_p1 = env.Limit
+		context.i_p2 = env.Limit
+		var v_9 = env.Cursor
+		if !env.Hop(3) {
+			break lab11
+		}
+		context.i_x = env.Cursor
+		env.Cursor = v_9
+	golab12:
+		for {
+		lab13:
+			for {
+				if !env.InGrouping(G_v, 97, 252) {
+					break lab13
+				}
+				break golab12
+			}
+			if env.Cursor >= env.Limit {
+				break lab11
+			}
+			env.NextChar()
+		}
+	golab14:
+		for {
+		lab15:
+			for {
+				if !env.OutGrouping(G_v, 97, 252) {
+					break lab15
+				}
+				break golab14
+			}
+			if env.Cursor >= env.Limit {
+				break lab11
+			}
+			env.NextChar()
+		}
+		context.i_p1 = env.Cursor
+	lab16:
+		for {
+			if !(context.i_p1 < context.i_x) {
+				break lab16
+			}
+			context.i_p1 = context.i_x
+			break lab16
+		}
+	golab17:
+		for {
+		lab18:
+			for {
+				if !env.InGrouping(G_v, 97, 252) {
+					break lab18
+				}
+				break golab17
+			}
+			if env.Cursor >= env.Limit {
+				break lab11
+			}
+			env.NextChar()
+		}
+	golab19:
+		for {
+		lab20:
+			for {
+				if !env.OutGrouping(G_v, 97, 252) {
+					break lab20
+				}
+				break golab19
+			}
+			if env.Cursor >= env.Limit {
+				break lab11
+			}
+			env.NextChar()
+		}
+		context.i_p2 = env.Cursor
+		break lab11
+	}
+	env.Cursor = v_8
+	env.LimitBackward = env.Cursor
+	env.Cursor = env.Limit
+lab21:
+	for {
+		var v_16 = env.Limit - env.Cursor
+	lab22:
+		for {
+			env.Ket = env.Cursor
+			among_var = env.FindAmongB(A_1, context)
+			if among_var == 0 {
+				break lab22
+			}
+			env.Bra = env.Cursor
+			if !(context.i_p1 <= env.Cursor) {
+				break lab22
+			}
+			if among_var == 1 {
+				if !env.SliceDel() {
+					return false
+				}
+			} else if among_var == 2 {
+				if !env.SliceDel() {
+					return false
+				}
+				var v_17 = env.Limit - env.Cursor
+			lab23:
+				for {
+					env.Ket = env.Cursor
+					if !env.EqSB("s") {
+						env.Cursor = env.Limit - v_17
+						break lab23
+					}
+					env.Bra = env.Cursor
+					if !env.EqSB("nis") {
+						env.Cursor = env.Limit - v_17
+						break lab23
+					}
+					if !env.SliceDel() {
+						return false
+					}
+					break lab23
+				}
+			} else if among_var == 3 {
+				if !env.InGroupingB(G_s_ending, 98, 116) {
+					break lab22
+				}
+				if !env.SliceDel() {
+					return false
+				}
+			}
+			break lab22
+		}
+		env.Cursor = env.Limit - v_16
+		var v_18 = env.Limit - env.Cursor
+	lab24:
+		for {
+			env.Ket = env.Cursor
+			among_var = env.FindAmongB(A_2, context)
+			if among_var == 0 {
+				break lab24
+			}
+			env.Bra = env.Cursor
+			if !(context.i_p1 <= env.Cursor) {
+				break lab24
+			}
+			if among_var == 1 {
+				if !env.SliceDel() {
+					return false
+				}
+			} else if among_var == 2 {
+				if !env.InGroupingB(G_st_ending, 98, 116) {
+					break lab24
+				}
+				if !env.HopBack(3) {
+					break lab24
+				}
+				if !env.SliceDel() {
+					return false
+				}
+			}
+			break lab24
+		}
+		env.Cursor = env.Limit - v_18
+		var v_19 = env.Limit - env.Cursor
+	lab25:
+		for {
+			env.Ket = env.Cursor
+			among_var = env.FindAmongB(A_4, context)
+			if among_var == 0 {
+				break lab25
+			}
+			env.Bra = env.Cursor
+			if !(context.i_p2 <= env.Cursor) {
+				break lab25
+			}
+			if among_var == 1 {
+				if !env.SliceDel() {
+					return false
+				}
+				var v_20 = env.Limit - env.Cursor
+			lab26:
+				for {
+					env.Ket = env.Cursor
+					if !env.EqSB("ig") {
+						env.Cursor = env.Limit - v_20
+						break lab26
+					}
+					env.Bra = env.Cursor
+					var v_21 = env.Limit - env.Cursor
+				lab27:
+					for {
+						if !env.EqSB("e") {
+							break lab27
+						}
+						env.Cursor = env.Limit - v_20
+						break lab26
+					}
+					env.Cursor = env.Limit - v_21
+					if !(context.i_p2 <= env.Cursor) {
+						env.Cursor = env.Limit - v_20
+						break lab26
+					}
+					if !env.SliceDel() {
+						return false
+					}
+					break lab26
+				}
+			} else if among_var == 2 {
+				var v_22 = env.Limit - env.Cursor
+			lab28:
+				for {
+					if !env.EqSB("e") {
+						break lab28
+					}
+					break lab25
+				}
+				env.Cursor = env.Limit - v_22
+				if !env.SliceDel() {
+					return false
+				}
+			} else if among_var == 3 {
+				if !env.SliceDel() {
+					return false
+				}
+				var v_23 = env.Limit - env.Cursor
+			lab29:
+				for {
+					env.Ket = env.Cursor
+				lab30:
+					for {
+						var v_24 = env.Limit - env.Cursor
+					lab31:
+						for {
+							if !env.EqSB("er") {
+								break lab31
+							}
+							break lab30
+						}
+						env.Cursor = env.Limit - v_24
+						if !env.EqSB("en") {
+							env.Cursor = env.Limit - v_23
+							break lab29
+						}
+						break lab30
+					}
+					env.Bra = env.Cursor
+					if !(context.i_p1 <= env.Cursor) {
+						env.Cursor = env.Limit - v_23
+						break lab29
+					}
+					if !env.SliceDel() {
+						return false
+					}
+					break lab29
+				}
+			} else if among_var == 4 {
+				if !env.SliceDel() {
+					return false
+				}
+				var v_25 = env.Limit - env.Cursor
+			lab32:
+				for {
+					env.Ket = env.Cursor
+					if env.FindAmongB(A_3, context) == 0 {
+						env.Cursor = env.Limit - v_25
+						break lab32
+					}
+					env.Bra = env.Cursor
+					if !(context.i_p2 <= env.Cursor) {
+						env.Cursor = env.Limit - v_25
+						break lab32
+					}
+					if !env.SliceDel() {
+						return false
+					}
+					break lab32
+				}
+			}
+			break lab25
+		}
+		env.Cursor = env.Limit - v_19
+		break lab21
+	}
+	env.Cursor = env.LimitBackward
+	var v_26 = env.Cursor
+lab33:
+	for {
+	replab34:
+		for {
+			var v_27 = env.Cursor
+		lab35:
+			for range [2]struct{}{} {
+				env.Bra = env.Cursor
+				among_var = env.FindAmong(A_0, context)
+				if among_var == 0 {
+					break lab35
+				}
+				env.Ket = env.Cursor
+				if among_var == 1 {
+					if !env.SliceFrom("y") {
+						return false
+					}
+				} else if among_var == 2 {
+					if !env.SliceFrom("u") {
+						return false
+					}
+				} else if among_var == 3 {
+					if !env.SliceFrom("a") {
+						return false
+					}
+				} else if among_var == 4 {
+					if !env.SliceFrom("o") {
+						return false
+					}
+				} else if among_var == 5 {
+					if env.Cursor >= env.Limit {
+						break lab35
+					}
+					env.NextChar()
+				}
+				continue replab34
+			}
+			env.Cursor = v_27
+			break replab34
+		}
+		break lab33
+	}
+	env.Cursor = v_26
+	return true
+}
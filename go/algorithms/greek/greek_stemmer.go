@@ -0,0 +1,2535 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package greek
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "", A: -1, B: 25, F: nil},
+	{Str: "\u03C2", A: 0, B: 18, F: nil},
+	{Str: "\u0386", A: 0, B: 1, F: nil},
+	{Str: "\u0388", A: 0, B: 5, F: nil},
+	{Str: "\u0389", A: 0, B: 7, F: nil},
+	{Str: "\u038A", A: 0, B: 9, F: nil},
+	{Str: "\u03CA", A: 0, B: 7, F: nil},
+	{Str: "\u03CB", A: 0, B: 20, F: nil},
+	{Str: "\u038C", A: 0, B: 15, F: nil},
+	{Str: "\u03CC", A: 0, B: 15, F: nil},
+	{Str: "\u03CD", A: 0, B: 20, F: nil},
+	{Str: "\u038E", A: 0, B: 20, F: nil},
+	{Str: "\u03CE", A: 0, B: 24, F: nil},
+	{Str: "\u038F", A: 0, B: 24, F: nil},
+	{Str: "\u0390", A: 0, B: 7, F: nil},
+	{Str: "\u0391", A: 0, B: 1, F: nil},
+	{Str: "\u0392", A: 0, B: 2, F: nil},
+	{Str: "\u0393", A: 0, B: 3, F: nil},
+	{Str: "\u0394", A: 0, B: 4, F: nil},
+	{Str: "\u0395", A: 0, B: 5, F: nil},
+	{Str: "\u0396", A: 0, B: 6, F: nil},
+	{Str: "\u0397", A: 0, B: 7, F: nil},
+	{Str: "\u0398", A: 0, B: 8, F: nil},
+	{Str: "\u0399", A: 0, B: 9, F: nil},
+	{Str: "\u039A", A: 0, B: 10, F: nil},
+	{Str: "\u039B", A: 0, B: 11, F: nil},
+	{Str: "\u039C", A: 0, B: 12, F: nil},
+	{Str: "\u039D", A: 0, B: 13, F: nil},
+	{Str: "\u039E", A: 0, B: 14, F: nil},
+	{Str: "\u039F", A: 0, B: 15, F: nil},
+	{Str: "\u03A0", A: 0, B: 16, F: nil},
+	{Str: "\u03A1", A: 0, B: 17, F: nil},
+	{Str: "\u03A3", A: 0, B: 18, F: nil},
+	{Str: "\u03A4", A: 0, B: 19, F: nil},
+	{Str: "\u03A5", A: 0, B: 20, F: nil},
+	{Str: "\u03A6", A: 0, B: 21, F: nil},
+	{Str: "\u03A7", A: 0, B: 22, F: nil},
+	{Str: "\u03A8", A: 0, B: 23, F: nil},
+	{Str: "\u03A9", A: 0, B: 24, F: nil},
+	{Str: "\u03AA", A: 0, B: 9, F: nil},
+	{Str: "\u03AB", A: 0, B: 20, F: nil},
+	{Str: "\u03AC", A: 0, B: 1, F: nil},
+	{Str: "\u03AD", A: 0, B: 5, F: nil},
+	{Str: "\u03AE", A: 0, B: 7, F: nil},
+	{Str: "\u03AF", A: 0, B: 9, F: nil},
+	{Str: "\u03B0", A: 0, B: 20, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "\u03BA\u03B1\u03B8\u03B5\u03C3\u03C4\u03C9\u03C3", A: -1, B: 10, F: nil},
+	{Str: "\u03C6\u03C9\u03C3", A: -1, B: 9, F: nil},
+	{Str: "\u03C0\u03B5\u03C1\u03B1\u03C3", A: -1, B: 7, F: nil},
+	{Str: "\u03C4\u03B5\u03C1\u03B1\u03C3", A: -1, B: 8, F: nil},
+	{Str: "\u03BA\u03C1\u03B5\u03B1\u03C3", A: -1, B: 6, F: nil},
+	{Str: "\u03BA\u03B1\u03B8\u03B5\u03C3\u03C4\u03C9\u03C4\u03BF\u03C3", A: -1, B: 10, F: nil},
+	{Str: "\u03C6\u03C9\u03C4\u03BF\u03C3", A: -1, B: 9, F: nil},
+	{Str: "\u03C0\u03B5\u03C1\u03B1\u03C4\u03BF\u03C3", A: -1, B: 7, F: nil},
+	{Str: "\u03C4\u03B5\u03C1\u03B1\u03C4\u03BF\u03C3", A: -1, B: 8, F: nil},
+	{Str: "\u03BA\u03C1\u03B5\u03B1\u03C4\u03BF\u03C3", A: -1, B: 6, F: nil},
+	{Str: "\u03B3\u03B5\u03B3\u03BF\u03BD\u03BF\u03C4\u03BF\u03C3", A: -1, B: 11, F: nil},
+	{Str: "\u03B3\u03B5\u03B3\u03BF\u03BD\u03BF\u03C3", A: -1, B: 11, F: nil},
+	{Str: "\u03C6\u03B1\u03B3\u03B9\u03BF\u03C5", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03BA\u03B1\u03B3\u03B9\u03BF\u03C5", A: -1, B: 2, F: nil},
+	{Str: "\u03C3\u03BF\u03B3\u03B9\u03BF\u03C5", A: -1, B: 4, F: nil},
+	{Str: "\u03C4\u03B1\u03C4\u03BF\u03B3\u03B9\u03BF\u03C5", A: -1, B: 5, F: nil},
+	{Str: "\u03BF\u03BB\u03BF\u03B3\u03B9\u03BF\u03C5", A: -1, B: 3, F: nil},
+	{Str: "\u03BA\u03B1\u03B8\u03B5\u03C3\u03C4\u03C9\u03C4\u03B1", A: -1, B: 10, F: nil},
+	{Str: "\u03C6\u03C9\u03C4\u03B1", A: -1, B: 9, F: nil},
+	{Str: "\u03C0\u03B5\u03C1\u03B1\u03C4\u03B1", A: -1, B: 7, F: nil},
+	{Str: "\u03C4\u03B5\u03C1\u03B1\u03C4\u03B1", A: -1, B: 8, F: nil},
+	{Str: "\u03BA\u03C1\u03B5\u03B1\u03C4\u03B1", A: -1, B: 6, F: nil},
+	{Str: "\u03B3\u03B5\u03B3\u03BF\u03BD\u03BF\u03C4\u03B1", A: -1, B: 11, F: nil},
+	{Str: "\u03C6\u03B1\u03B3\u03B9\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03BA\u03B1\u03B3\u03B9\u03B1", A: -1, B: 2, F: nil},
+	{Str: "\u03C3\u03BF\u03B3\u03B9\u03B1", A: -1, B: 4, F: nil},
+	{Str: "\u03C4\u03B1\u03C4\u03BF\u03B3\u03B9\u03B1", A: -1, B: 5, F: nil},
+	{Str: "\u03BF\u03BB\u03BF\u03B3\u03B9\u03B1", A: -1, B: 3, F: nil},
+	{Str: "\u03C0\u03B5\u03C1\u03B1\u03C4\u03B7", A: -1, B: 7, F: nil},
+	{Str: "\u03BA\u03B1\u03B8\u03B5\u03C3\u03C4\u03C9\u03C4\u03C9\u03BD", A: -1, B: 10, F: nil},
+	{Str: "\u03C6\u03C9\u03C4\u03C9\u03BD", A: -1, B: 9, F: nil},
+	{Str: "\u03C0\u03B5\u03C1\u03B1\u03C4\u03C9\u03BD", A: -1, B: 7, F: nil},
+	{Str: "\u03C4\u03B5\u03C1\u03B1\u03C4\u03C9\u03BD", A: -1, B: 8, F: nil},
+	{Str: "\u03BA\u03C1\u03B5\u03B1\u03C4\u03C9\u03BD", A: -1, B: 6, F: nil},
+	{Str: "\u03B3\u03B5\u03B3\u03BF\u03BD\u03BF\u03C4\u03C9\u03BD", A: -1, B: 11, F: nil},
+	{Str: "\u03C6\u03B1\u03B3\u03B9\u03C9\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03BA\u03B1\u03B3\u03B9\u03C9\u03BD", A: -1, B: 2, F: nil},
+	{Str: "\u03C3\u03BF\u03B3\u03B9\u03C9\u03BD", A: -1, B: 4, F: nil},
+	{Str: "\u03C4\u03B1\u03C4\u03BF\u03B3\u03B9\u03C9\u03BD", A: -1, B: 5, F: nil},
+	{Str: "\u03BF\u03BB\u03BF\u03B3\u03B9\u03C9\u03BD", A: -1, B: 3, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "\u03C0", A: -1, B: 2, F: nil},
+	{Str: "\u03B9\u03BC\u03C0", A: 0, B: 2, F: nil},
+	{Str: "\u03C1", A: -1, B: 2, F: nil},
+	{Str: "\u03C0\u03C1", A: 2, B: 2, F: nil},
+	{Str: "\u03BC\u03C0\u03C1", A: 3, B: 2, F: nil},
+	{Str: "\u03B1\u03C1\u03C1", A: 2, B: 2, F: nil},
+	{Str: "\u03B3\u03BB\u03C5\u03BA\u03C5\u03C1", A: 2, B: 2, F: nil},
+	{Str: "\u03C0\u03BF\u03BB\u03C5\u03C1", A: 2, B: 2, F: nil},
+	{Str: "\u03B1\u03BC\u03C0\u03B1\u03C1", A: 2, B: 2, F: nil},
+	{Str: "\u03BC\u03B1\u03C1", A: 2, B: 2, F: nil},
+	{Str: "\u03B3\u03BA\u03C1", A: 2, B: 2, F: nil},
+	{Str: "\u03C0\u03B9\u03C0\u03B5\u03C1\u03BF\u03C1", A: 2, B: 2, F: nil},
+	{Str: "\u03B2\u03BF\u03BB\u03B2\u03BF\u03C1", A: 2, B: 2, F: nil},
+	{Str: "\u03B3\u03BB\u03C5\u03BA\u03BF\u03C1", A: 2, B: 2, F: nil},
+	{Str: "\u03BB\u03BF\u03C5", A: -1, B: 2, F: nil},
+	{Str: "\u03C0\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03BE\u03B1\u03BD\u03B1\u03C0\u03B1", A: 15, B: 1, F: nil},
+	{Str: "\u03B5\u03C0\u03B1", A: 15, B: 1, F: nil},
+	{Str: "\u03C0\u03B5\u03C1\u03B9\u03C0\u03B1", A: 15, B: 1, F: nil},
+	{Str: "\u03B1\u03BD\u03B1\u03BC\u03C0\u03B1", A: 15, B: 1, F: nil},
+	{Str: "\u03B5\u03BC\u03C0\u03B1", A: 15, B: 1, F: nil},
+	{Str: "\u03B2", A: -1, B: 2, F: nil},
+	{Str: "\u03B4\u03B1\u03BD\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B2\u03B1\u03B8\u03C5\u03C1\u03B9", A: -1, B: 2, F: nil},
+	{Str: "\u03B2\u03B1\u03C1\u03BA", A: -1, B: 2, F: nil},
+	{Str: "\u03BC\u03B1\u03C1\u03BA", A: -1, B: 2, F: nil},
+	{Str: "\u03BB", A: -1, B: 2, F: nil},
+	{Str: "\u03BC", A: -1, B: 2, F: nil},
+	{Str: "\u03BA\u03BF\u03C1\u03BD", A: -1, B: 2, F: nil},
+	{Str: "\u03B1\u03B8\u03C1\u03BF", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03C5\u03BD\u03B1\u03B8\u03C1\u03BF", A: 29, B: 1, F: nil},
+}
+
+var A_3 = []*snowballRuntime.Among{
+	{Str: "\u03B9\u03B6\u03B5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B6\u03B5\u03B9\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B6\u03C9", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B6\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B6\u03B1\u03C4\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B6\u03B5\u03C4\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B6\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B6\u03BF\u03C5\u03BC\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B6\u03B1\u03BC\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B6\u03BF\u03C5\u03BD\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B6\u03B1\u03BD\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B6\u03B5\u03B9", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B6\u03BF\u03C5\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B6\u03B1\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_4 = []*snowballRuntime.Among{
+	{Str: "\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03C7", A: -1, B: 1, F: nil},
+	{Str: "\u03C5\u03C8", A: -1, B: 1, F: nil},
+	{Str: "\u03B6\u03C9", A: -1, B: 1, F: nil},
+	{Str: "\u03B2\u03B9", A: -1, B: 1, F: nil},
+	{Str: "\u03BB\u03B9", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_5 = []*snowballRuntime.Among{
+	{Str: "\u03C9\u03B8\u03B7\u03BA\u03B5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03C9\u03B8\u03B7\u03BA\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03C9\u03B8\u03B7\u03BA\u03B1\u03C4\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03C9\u03B8\u03B7\u03BA\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03C9\u03B8\u03B7\u03BA\u03B1\u03BC\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03C9\u03B8\u03B7\u03BA\u03B1\u03BD\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03C9\u03B8\u03B7\u03BA\u03B1\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_6 = []*snowballRuntime.Among{
+	{Str: "\u03C0", A: -1, B: 2, F: nil},
+	{Str: "\u03BB\u03B1\u03C1", A: -1, B: 2, F: nil},
+	{Str: "\u03B4\u03B7\u03BC\u03BF\u03BA\u03C1\u03B1\u03C4", A: -1, B: 2, F: nil},
+	{Str: "\u03B1\u03C6", A: -1, B: 2, F: nil},
+	{Str: "\u03B3\u03B9\u03B3\u03B1\u03BD\u03C4\u03BF\u03B1\u03C6", A: 3, B: 2, F: nil},
+	{Str: "\u03BE\u03B1\u03BD\u03B1\u03C0\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03C0\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B5\u03C1\u03B9\u03C0\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BD\u03B1\u03BC\u03C0\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03BC\u03C0\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03C7\u03B1\u03C1\u03C4\u03BF\u03C0\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03BE\u03B1\u03C1\u03C7\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03C0\u03B5", A: 12, B: 1, F: nil},
+	{Str: "\u03BC\u03B5\u03C4\u03B5\u03C0\u03B5", A: 13, B: 1, F: nil},
+	{Str: "\u03B5\u03C3\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B3\u03B5", A: -1, B: 2, F: nil},
+	{Str: "\u03B3\u03BA\u03B5", A: -1, B: 2, F: nil},
+	{Str: "\u03BA\u03BB\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03C3\u03C9\u03BA\u03BB\u03B5", A: 18, B: 1, F: nil},
+	{Str: "\u03B5\u03BA\u03BB\u03B5", A: 18, B: 1, F: nil},
+	{Str: "\u03B1\u03C0\u03B5\u03BA\u03BB\u03B5", A: 20, B: 1, F: nil},
+	{Str: "\u03B1\u03C0\u03BF\u03BA\u03BB\u03B5", A: 18, B: 1, F: nil},
+	{Str: "\u03B4\u03B1\u03BD\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B3\u03BA", A: -1, B: 2, F: nil},
+	{Str: "\u03BC", A: -1, B: 2, F: nil},
+	{Str: "\u03C0\u03BF\u03C5\u03BA\u03B1\u03BC", A: 25, B: 2, F: nil},
+	{Str: "\u03BA\u03BF\u03BC", A: 25, B: 2, F: nil},
+	{Str: "\u03B1\u03BD", A: -1, B: 2, F: nil},
+	{Str: "\u03B1\u03B8\u03C1\u03BF", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03C5\u03BD\u03B1\u03B8\u03C1\u03BF", A: 29, B: 1, F: nil},
+	{Str: "\u03BF\u03BB\u03BF", A: -1, B: 2, F: nil},
+}
+
+var A_7 = []*snowballRuntime.Among{
+	{Str: "\u03B9\u03C3\u03B5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03B1\u03C4\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03B1\u03BC\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03B1\u03BD\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03B1\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_8 = []*snowballRuntime.Among{
+	{Str: "\u03BE\u03B1\u03BD\u03B1\u03C0\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03C0\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B5\u03C1\u03B9\u03C0\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BD\u03B1\u03BC\u03C0\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03BC\u03C0\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03C7\u03B1\u03C1\u03C4\u03BF\u03C0\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03BE\u03B1\u03C1\u03C7\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03C0\u03B5", A: 7, B: 1, F: nil},
+	{Str: "\u03BC\u03B5\u03C4\u03B5\u03C0\u03B5", A: 8, B: 1, F: nil},
+	{Str: "\u03B5\u03C3\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03BA\u03BB\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03C3\u03C9\u03BA\u03BB\u03B5", A: 11, B: 1, F: nil},
+	{Str: "\u03B5\u03BA\u03BB\u03B5", A: 11, B: 1, F: nil},
+	{Str: "\u03B1\u03C0\u03B5\u03BA\u03BB\u03B5", A: 13, B: 1, F: nil},
+	{Str: "\u03B1\u03C0\u03BF\u03BA\u03BB\u03B5", A: 11, B: 1, F: nil},
+	{Str: "\u03B4\u03B1\u03BD\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B8\u03C1\u03BF", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03C5\u03BD\u03B1\u03B8\u03C1\u03BF", A: 17, B: 1, F: nil},
+}
+
+var A_9 = []*snowballRuntime.Among{
+	{Str: "\u03B9\u03C3\u03B5\u03B9\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03C9", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03B5\u03C4\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03BF\u03C5\u03BC\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03BF\u03C5\u03BD\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03B5\u03B9", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03BF\u03C5\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_10 = []*snowballRuntime.Among{
+	{Str: "\u03C0", A: -1, B: 2, F: nil},
+	{Str: "\u03B5\u03C5\u03C0", A: 0, B: 2, F: nil},
+	{Str: "\u03B1\u03C0", A: 0, B: 2, F: nil},
+	{Str: "\u03B5\u03BC\u03C0", A: 0, B: 2, F: nil},
+	{Str: "\u03B3\u03C5\u03C1", A: -1, B: 2, F: nil},
+	{Str: "\u03C7\u03C1", A: -1, B: 2, F: nil},
+	{Str: "\u03C7\u03C9\u03C1", A: -1, B: 2, F: nil},
+	{Str: "\u03B1\u03C1", A: -1, B: 2, F: nil},
+	{Str: "\u03B1\u03BF\u03C1", A: -1, B: 2, F: nil},
+	{Str: "\u03C7\u03C4", A: -1, B: 2, F: nil},
+	{Str: "\u03B1\u03C7\u03C4", A: 9, B: 2, F: nil},
+	{Str: "\u03BA\u03C4", A: -1, B: 2, F: nil},
+	{Str: "\u03B1\u03BA\u03C4", A: 11, B: 2, F: nil},
+	{Str: "\u03C3\u03C7", A: -1, B: 2, F: nil},
+	{Str: "\u03B1\u03C3\u03C7", A: 13, B: 2, F: nil},
+	{Str: "\u03C4\u03B1\u03C7", A: -1, B: 2, F: nil},
+	{Str: "\u03C5\u03C8", A: -1, B: 2, F: nil},
+	{Str: "\u03B1\u03C4\u03B1", A: -1, B: 2, F: nil},
+	{Str: "\u03C6\u03B1", A: -1, B: 2, F: nil},
+	{Str: "\u03B7\u03C6\u03B1", A: 18, B: 2, F: nil},
+	{Str: "\u03BB\u03C5\u03B3", A: -1, B: 2, F: nil},
+	{Str: "\u03BC\u03B5\u03B3", A: -1, B: 2, F: nil},
+	{Str: "\u03B7\u03B4", A: -1, B: 2, F: nil},
+	{Str: "\u03C3\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03C3\u03B5", A: 23, B: 1, F: nil},
+	{Str: "\u03C0\u03BB\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03BA\u03BB\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03C3\u03C9\u03BA\u03BB\u03B5", A: 26, B: 1, F: nil},
+	{Str: "\u03B4\u03B1\u03BD\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03C7\u03B8", A: -1, B: 2, F: nil},
+	{Str: "\u03BA\u03B1\u03B8", A: -1, B: 2, F: nil},
+	{Str: "\u03C3\u03BA", A: -1, B: 2, F: nil},
+	{Str: "\u03BA\u03B1\u03BA", A: -1, B: 2, F: nil},
+	{Str: "\u03BC\u03B1\u03BA", A: -1, B: 2, F: nil},
+	{Str: "\u03BA\u03C5\u03BB", A: -1, B: 2, F: nil},
+	{Str: "\u03C6\u03B9\u03BB", A: -1, B: 2, F: nil},
+	{Str: "\u03BC", A: -1, B: 2, F: nil},
+	{Str: "\u03B3\u03B5\u03BC", A: 36, B: 2, F: nil},
+	{Str: "\u03B1\u03C7\u03BD", A: -1, B: 2, F: nil},
+	{Str: "\u03C3\u03C5\u03BD\u03B1\u03B8\u03C1\u03BF", A: -1, B: 1, F: nil},
+}
+
+var A_11 = []*snowballRuntime.Among{
+	{Str: "\u03B9\u03C3\u03C4\u03BF\u03C5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03C4\u03B5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03C4\u03B7\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03C4\u03BF\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03C4\u03BF\u03C5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03C4\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03C4\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03C4\u03B7", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03C4\u03BF\u03B9", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03C4\u03C9\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03C4\u03BF", A: -1, B: 1, F: nil},
+}
+
+var A_12 = []*snowballRuntime.Among{
+	{Str: "\u03C3\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03B5\u03C4\u03B1\u03C3\u03B5", A: 0, B: 1, F: nil},
+	{Str: "\u03BC\u03B9\u03BA\u03C1\u03BF\u03C3\u03B5", A: 0, B: 1, F: nil},
+	{Str: "\u03B5\u03B3\u03BA\u03BB\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03C0\u03BF\u03BA\u03BB\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B4\u03B1\u03BD\u03B5", A: -1, B: 2, F: nil},
+	{Str: "\u03B1\u03BD\u03C4\u03B9\u03B4\u03B1\u03BD\u03B5", A: 5, B: 2, F: nil},
+}
+
+var A_13 = []*snowballRuntime.Among{
+	{Str: "\u03C4\u03BF\u03C0\u03B9\u03BA", A: -1, B: 7, F: nil},
+	{Str: "\u03C3\u03BA\u03B5\u03C0\u03C4\u03B9\u03BA", A: -1, B: 6, F: nil},
+	{Str: "\u03B3\u03BD\u03C9\u03C3\u03C4\u03B9\u03BA", A: -1, B: 3, F: nil},
+	{Str: "\u03B1\u03B3\u03BD\u03C9\u03C3\u03C4\u03B9\u03BA", A: 2, B: 1, F: nil},
+	{Str: "\u03B5\u03BA\u03BB\u03B5\u03BA\u03C4\u03B9\u03BA", A: -1, B: 5, F: nil},
+	{Str: "\u03B1\u03C4\u03BF\u03BC\u03B9\u03BA", A: -1, B: 2, F: nil},
+	{Str: "\u03B5\u03B8\u03BD\u03B9\u03BA", A: -1, B: 4, F: nil},
+	{Str: "\u03B8\u03B5\u03B1\u03C4\u03C1\u03B9\u03BD", A: -1, B: 10, F: nil},
+	{Str: "\u03B1\u03BB\u03B5\u03BE\u03B1\u03BD\u03B4\u03C1\u03B9\u03BD", A: -1, B: 8, F: nil},
+	{Str: "\u03B2\u03C5\u03B6\u03B1\u03BD\u03C4\u03B9\u03BD", A: -1, B: 9, F: nil},
+}
+
+var A_14 = []*snowballRuntime.Among{
+	{Str: "\u03B9\u03C3\u03BC\u03BF\u03C5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03BC\u03BF\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03BC\u03BF\u03C5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03BC\u03BF\u03B9", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03BC\u03C9\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03BC\u03BF", A: -1, B: 1, F: nil},
+}
+
+var A_15 = []*snowballRuntime.Among{
+	{Str: "\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03C7", A: -1, B: 1, F: nil},
+}
+
+var A_16 = []*snowballRuntime.Among{
+	{Str: "\u03B1\u03C1\u03B1\u03BA\u03B9\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03B4\u03B1\u03BA\u03B9\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03C1\u03B1\u03BA\u03B9", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03B4\u03B1\u03BA\u03B9", A: -1, B: 1, F: nil},
+}
+
+var A_17 = []*snowballRuntime.Among{
+	{Str: "\u03C0", A: -1, B: 2, F: nil},
+	{Str: "\u03BA\u03B1\u03C4\u03C1\u03B1\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03B2\u03C1", A: 2, B: 1, F: nil},
+	{Str: "\u03BB\u03B1\u03B2\u03C1", A: 3, B: 1, F: nil},
+	{Str: "\u03B1\u03BC\u03B2\u03C1", A: 3, B: 1, F: nil},
+	{Str: "\u03C0\u03B1\u03C4\u03B5\u03C1", A: 2, B: 2, F: nil},
+	{Str: "\u03BC\u03B5\u03C1", A: 2, B: 1, F: nil},
+	{Str: "\u03B1\u03BD\u03B8\u03C1", A: 2, B: 1, F: nil},
+	{Str: "\u03BA\u03BF\u03C1", A: 2, B: 1, F: nil},
+	{Str: "\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03BD\u03B1\u03B3\u03BA\u03B1\u03C3", A: 10, B: 1, F: nil},
+	{Str: "\u03C4\u03BF\u03C3", A: 10, B: 2, F: nil},
+	{Str: "\u03BC\u03BF\u03C5\u03C3\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03C1\u03C5", A: -1, B: 1, F: nil},
+	{Str: "\u03C6", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03C6", A: 15, B: 1, F: nil},
+	{Str: "\u03B1\u03BB\u03B9\u03C3\u03C6", A: 16, B: 1, F: nil},
+	{Str: "\u03BD\u03C5\u03C6", A: 15, B: 2, F: nil},
+	{Str: "\u03C7", A: -1, B: 1, F: nil},
+	{Str: "\u03B2", A: -1, B: 2, F: nil},
+	{Str: "\u03B2\u03B1\u03BC\u03B2", A: 20, B: 1, F: nil},
+	{Str: "\u03C3\u03BB\u03BF\u03B2", A: 20, B: 1, F: nil},
+	{Str: "\u03C4\u03C3\u03B5\u03C7\u03BF\u03C3\u03BB\u03BF\u03B2", A: 22, B: 1, F: nil},
+	{Str: "\u03BA\u03B1\u03C1\u03B4", A: -1, B: 2, F: nil},
+	{Str: "\u03B6", A: -1, B: 2, F: nil},
+	{Str: "\u03C4\u03B6", A: 25, B: 1, F: nil},
+	{Str: "\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03BA", A: 27, B: 1, F: nil},
+	{Str: "\u03BA\u03B1\u03C0\u03B1\u03BA", A: 27, B: 1, F: nil},
+	{Str: "\u03C3\u03BF\u03BA", A: 27, B: 1, F: nil},
+	{Str: "\u03C0\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03C6\u03C5\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03BB\u03BF\u03C5\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03B2\u03B1\u03BB", A: -1, B: 2, F: nil},
+	{Str: "\u03BC\u03B1\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03B3\u03BB", A: -1, B: 2, F: nil},
+	{Str: "\u03C4\u03C1\u03B9\u03C0\u03BF\u03BB", A: -1, B: 2, F: nil},
+	{Str: "\u03C6\u03B1\u03C1\u03BC", A: -1, B: 1, F: nil},
+	{Str: "\u03BA\u03B1\u03B9\u03BC", A: -1, B: 1, F: nil},
+	{Str: "\u03BA\u03BB\u03B9\u03BC", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03B1\u03BA\u03C1\u03C5\u03BD", A: -1, B: 2, F: nil},
+	{Str: "\u03C3\u03C0\u03B1\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03B3\u03B9\u03B1\u03BD", A: -1, B: 2, F: nil},
+	{Str: "\u03B7\u03B3\u03BF\u03C5\u03BC\u03B5\u03BD", A: -1, B: 2, F: nil},
+	{Str: "\u03BA\u03BF\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_18 = []*snowballRuntime.Among{
+	{Str: "\u03B9\u03C4\u03C3\u03B1\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C4\u03C3\u03B5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C4\u03C3\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BA\u03B9\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03C1\u03B1\u03BA\u03B9\u03B1", A: 3, B: 1, F: nil},
+	{Str: "\u03B1\u03BA\u03B9", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03C1\u03B1\u03BA\u03B9", A: 5, B: 1, F: nil},
+	{Str: "\u03B9\u03C4\u03C3\u03C9\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_19 = []*snowballRuntime.Among{
+	{Str: "\u03B9\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03C8\u03B1\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B9\u03C6\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03BB\u03BF", A: -1, B: 1, F: nil},
+}
+
+var A_20 = []*snowballRuntime.Among{
+	{Str: "\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B1\u03B9\u03C7\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_21 = []*snowballRuntime.Among{
+	{Str: "\u03B9\u03B4\u03B9\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B4\u03B9\u03C9\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B4\u03B9\u03BF", A: -1, B: 1, F: nil},
+}
+
+var A_22 = []*snowballRuntime.Among{
+	{Str: "\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B2", A: -1, B: 1, F: nil},
+	{Str: "\u03B4", A: -1, B: 1, F: nil},
+	{Str: "\u03BB\u03C5\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03C6\u03C1\u03B1\u03B3\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03B2\u03B5\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03B7\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_23 = []*snowballRuntime.Among{
+	{Str: "\u03B9\u03C3\u03BA\u03BF\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03BA\u03BF\u03C5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03BA\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C3\u03BA\u03BF", A: -1, B: 1, F: nil},
+}
+
+var A_24 = []*snowballRuntime.Among{
+	{Str: "\u03B1\u03B4\u03B5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B4\u03C9\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_25 = []*snowballRuntime.Among{
+	{Str: "\u03BC\u03C0\u03B1\u03BC\u03C0", A: -1, B: -1, F: nil},
+	{Str: "\u03BA\u03C5\u03C1", A: -1, B: -1, F: nil},
+	{Str: "\u03C0\u03B1\u03C4\u03B5\u03C1", A: -1, B: -1, F: nil},
+	{Str: "\u03C0\u03B5\u03B8\u03B5\u03C1", A: -1, B: -1, F: nil},
+	{Str: "\u03BD\u03C4\u03B1\u03BD\u03C4", A: -1, B: -1, F: nil},
+	{Str: "\u03B3\u03B9\u03B1\u03B3\u03B9", A: -1, B: -1, F: nil},
+	{Str: "\u03B8\u03B5\u03B9", A: -1, B: -1, F: nil},
+	{Str: "\u03BF\u03BA", A: -1, B: -1, F: nil},
+	{Str: "\u03BC\u03B1\u03BC", A: -1, B: -1, F: nil},
+	{Str: "\u03BC\u03B1\u03BD", A: -1, B: -1, F: nil},
+}
+
+var A_26 = []*snowballRuntime.Among{
+	{Str: "\u03B5\u03B4\u03B5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03B4\u03C9\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_27 = []*snowballRuntime.Among{
+	{Str: "\u03BA\u03C1\u03B1\u03C3\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03C5\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03B4\u03B1\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03B3\u03B7\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03BC\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03B9\u03BB", A: -1, B: 1, F: nil},
+}
+
+var A_28 = []*snowballRuntime.Among{
+	{Str: "\u03BF\u03C5\u03B4\u03B5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03B4\u03C9\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_29 = []*snowballRuntime.Among{
+	{Str: "\u03C3\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03C6\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03BB\u03B9\u03C7", A: -1, B: 1, F: nil},
+	{Str: "\u03C4\u03C1\u03B1\u03B3", A: -1, B: 1, F: nil},
+	{Str: "\u03C6\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03C1\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03BA\u03B1\u03BB\u03B9\u03B1\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03BB\u03BF\u03C5\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03C6\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B5\u03C4\u03B1\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03B2\u03B5\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03C7\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03BB\u03B5\u03BE", A: -1, B: 1, F: nil},
+}
+
+var A_30 = []*snowballRuntime.Among{
+	{Str: "\u03B5\u03C9\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03C9\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_31 = []*snowballRuntime.Among{
+	{Str: "\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B1\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03B4", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B4", A: 2, B: 1, F: nil},
+	{Str: "\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03B3\u03B1\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_32 = []*snowballRuntime.Among{
+	{Str: "\u03B9\u03BF\u03C5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03C9\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_33 = []*snowballRuntime.Among{
+	{Str: "\u03B9\u03BA\u03BF\u03C5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03BA\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03BA\u03C9\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03BA\u03BF", A: -1, B: 1, F: nil},
+}
+
+var A_34 = []*snowballRuntime.Among{
+	{Str: "\u03BA\u03B1\u03BB\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03B3\u03B5\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03BB\u03B9\u03B1\u03C4\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B5\u03C4\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B9\u03C4\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03C6\u03C5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03C7\u03B1\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03C0\u03BF\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03B5\u03C1\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03C0\u03B1\u03B3\u03B9\u03B1\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03BD\u03B9\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B9\u03BA\u03B1\u03BD\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03BE\u03C9\u03B4", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B4", A: -1, B: 1, F: nil},
+	{Str: "\u03BA\u03B1\u03C4\u03B1\u03B4", A: 13, B: 1, F: nil},
+	{Str: "\u03C3\u03C5\u03BD\u03B1\u03B4", A: 13, B: 1, F: nil},
+	{Str: "\u03B1\u03BD\u03C4\u03B9\u03B4", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03BD\u03B4", A: -1, B: 1, F: nil},
+	{Str: "\u03C5\u03C0\u03BF\u03B4", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03C1\u03C9\u03C4\u03BF\u03B4", A: -1, B: 1, F: nil},
+	{Str: "\u03C6\u03C5\u03BB\u03BF\u03B4", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BD\u03B7\u03B8", A: 21, B: 1, F: nil},
+	{Str: "\u03BE\u03B9\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03BF\u03C5\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BC\u03BC\u03BF\u03C7\u03B1\u03BB", A: 25, B: 1, F: nil},
+	{Str: "\u03C3\u03C5\u03BD\u03BF\u03BC\u03B7\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03C0\u03BF\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03B2\u03C1\u03C9\u03BC", A: -1, B: 1, F: nil},
+	{Str: "\u03C4\u03C3\u03B1\u03BC", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03C0\u03B1\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BC\u03B1\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03BA\u03B1\u03BB\u03BB\u03B9\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03BF\u03C3\u03C4\u03B5\u03BB\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03C6\u03B9\u03BB\u03BF\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_35 = []*snowballRuntime.Among{
+	{Str: "\u03BF\u03C5\u03C3\u03B1\u03BC\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03C3\u03B1\u03BC\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B3\u03B1\u03BC\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03BA\u03B1\u03BC\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03B8\u03B7\u03BA\u03B1\u03BC\u03B5", A: 3, B: 1, F: nil},
+}
+
+var A_36 = []*snowballRuntime.Among{
+	{Str: "\u03B1\u03BD\u03B1\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B9\u03BA\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03C0\u03BF\u03C3\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03BF\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03C7", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03B9\u03C7", A: 4, B: 1, F: nil},
+	{Str: "\u03B2\u03BF\u03C5\u03B2", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B5\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03BE\u03B5\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03C0\u03BF\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03C0\u03BF\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03BB", A: -1, B: 1, F: nil},
+}
+
+var A_37 = []*snowballRuntime.Among{
+	{Str: "\u03C4\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03C4\u03C3", A: -1, B: 1, F: nil},
+}
+
+var A_38 = []*snowballRuntime.Among{
+	{Str: "\u03BF\u03C5\u03C3\u03B1\u03BD\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03C3\u03B1\u03BD\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03BD\u03C4\u03B1\u03BD\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03C5\u03BD\u03C4\u03B1\u03BD\u03B5", A: 2, B: 1, F: nil},
+	{Str: "\u03BF\u03BD\u03C4\u03B1\u03BD\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03BD\u03C4\u03B1\u03BD\u03B5", A: 4, B: 1, F: nil},
+	{Str: "\u03BF\u03C4\u03B1\u03BD\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03C4\u03B1\u03BD\u03B5", A: 6, B: 1, F: nil},
+	{Str: "\u03B1\u03B3\u03B1\u03BD\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03BA\u03B1\u03BD\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03B8\u03B7\u03BA\u03B1\u03BD\u03B5", A: 9, B: 1, F: nil},
+}
+
+var A_39 = []*snowballRuntime.Among{
+	{Str: "\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03C0\u03BF\u03BB\u03C5\u03B4\u03B1\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03B1\u03B4\u03B1\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03C7\u03B1\u03BC\u03B7\u03BB\u03BF\u03B4\u03B1\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03C4\u03C3\u03BF\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03BA\u03BF\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03C5\u03C0\u03BF\u03BA\u03BF\u03C0", A: 6, B: 1, F: nil},
+	{Str: "\u03C0\u03B5\u03C1\u03B9\u03C4\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03B2\u03B5\u03C4\u03B5\u03C1", A: 10, B: 1, F: nil},
+	{Str: "\u03B3\u03B5\u03C1", A: 10, B: 1, F: nil},
+	{Str: "\u03BB\u03BF\u03C5\u03B8\u03B7\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03BA\u03BF\u03C1\u03BC\u03BF\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03B1\u03C1\u03B1\u03BA\u03B1\u03C4\u03C3", A: 15, B: 1, F: nil},
+	{Str: "\u03B8\u03C5\u03C3", A: 15, B: 1, F: nil},
+	{Str: "\u03B2\u03B1\u03C3", A: 15, B: 1, F: nil},
+	{Str: "\u03C0\u03BF\u03BB\u03B9\u03C3", A: 15, B: 1, F: nil},
+	{Str: "\u03BA\u03B1\u03C3\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03B4\u03B9\u03B1\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03BB\u03B1\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03C4\u03C3\u03B1\u03C1\u03BB\u03B1\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03C4\u03B5\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03BF\u03C5\u03C1\u03B9\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03BF\u03C5\u03BB\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03B6\u03C9\u03BD\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03B1\u03B9\u03BD\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03C6", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B5\u03BD\u03C4\u03B1\u03C1\u03C6", A: 29, B: 1, F: nil},
+	{Str: "\u03BA\u03BF\u03B9\u03BB\u03B1\u03C1\u03C6", A: 29, B: 1, F: nil},
+	{Str: "\u03BF\u03C1\u03C6", A: 29, B: 1, F: nil},
+	{Str: "\u03B4\u03B9\u03B1\u03C6", A: 29, B: 1, F: nil},
+	{Str: "\u03C3\u03C4\u03B5\u03C6", A: 29, B: 1, F: nil},
+	{Str: "\u03C6\u03C9\u03C4\u03BF\u03C3\u03C4\u03B5\u03C6", A: 34, B: 1, F: nil},
+	{Str: "\u03C0\u03B5\u03C1\u03B7\u03C6", A: 29, B: 1, F: nil},
+	{Str: "\u03C5\u03C0\u03B5\u03C1\u03B7\u03C6", A: 36, B: 1, F: nil},
+	{Str: "\u03C7", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03BF\u03BB\u03C5\u03BC\u03B7\u03C7", A: 38, B: 1, F: nil},
+	{Str: "\u03B1\u03BC\u03B7\u03C7", A: 38, B: 1, F: nil},
+	{Str: "\u03B2\u03B9\u03BF\u03BC\u03B7\u03C7", A: 38, B: 1, F: nil},
+	{Str: "\u03BC\u03B9\u03BA\u03C1\u03BF\u03B2\u03B9\u03BF\u03BC\u03B7\u03C7", A: 41, B: 1, F: nil},
+	{Str: "\u03BC\u03B5\u03B3\u03BB\u03BF\u03B2\u03B9\u03BF\u03BC\u03B7\u03C7", A: 41, B: 1, F: nil},
+	{Str: "\u03BA\u03B1\u03C0\u03BD\u03BF\u03B2\u03B9\u03BF\u03BC\u03B7\u03C7", A: 41, B: 1, F: nil},
+	{Str: "\u03BB\u03B9\u03C7", A: 38, B: 1, F: nil},
+	{Str: "\u03C4\u03B1\u03B2", A: -1, B: 1, F: nil},
+	{Str: "\u03BD\u03C4\u03B1\u03B2", A: 46, B: 1, F: nil},
+	{Str: "\u03C8\u03B7\u03BB\u03BF\u03C4\u03B1\u03B2", A: 46, B: 1, F: nil},
+	{Str: "\u03BB\u03B9\u03B2", A: -1, B: 1, F: nil},
+	{Str: "\u03BA\u03BB\u03B9\u03B2", A: 49, B: 1, F: nil},
+	{Str: "\u03BE\u03B7\u03C1\u03BF\u03BA\u03BB\u03B9\u03B2", A: 50, B: 1, F: nil},
+	{Str: "\u03B3", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BD\u03BF\u03C1\u03B3", A: 52, B: 1, F: nil},
+	{Str: "\u03B5\u03BD\u03BF\u03C1\u03B3", A: 52, B: 1, F: nil},
+	{Str: "\u03B1\u03B3", A: 52, B: 1, F: nil},
+	{Str: "\u03C4\u03C1\u03B1\u03B3", A: 55, B: 1, F: nil},
+	{Str: "\u03C4\u03C3\u03B1\u03B3", A: 55, B: 1, F: nil},
+	{Str: "\u03C4\u03C3\u03B9\u03B3\u03B3", A: 52, B: 1, F: nil},
+	{Str: "\u03B1\u03C4\u03C3\u03B9\u03B3\u03B3", A: 58, B: 1, F: nil},
+	{Str: "\u03B1\u03B8\u03B9\u03B3\u03B3", A: 52, B: 1, F: nil},
+	{Str: "\u03C3\u03C4\u03B5\u03B3", A: 52, B: 1, F: nil},
+	{Str: "\u03B1\u03C0\u03B7\u03B3", A: 52, B: 1, F: nil},
+	{Str: "\u03C3\u03B9\u03B3", A: 52, B: 1, F: nil},
+	{Str: "\u03BA\u03B1\u03BB\u03C0\u03BF\u03C5\u03B6", A: -1, B: 1, F: nil},
+	{Str: "\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03C9\u03B1\u03BC\u03B5\u03B8", A: 65, B: 1, F: nil},
+	{Str: "\u03C0\u03B9\u03B8", A: 65, B: 1, F: nil},
+	{Str: "\u03B1\u03C0\u03B9\u03B8", A: 67, B: 1, F: nil},
+	{Str: "\u03B2\u03B1\u03C3\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03B2\u03C1\u03B1\u03C7\u03C5\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03B4\u03B5\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B5\u03BB\u03B5\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BD\u03B9\u03BA", A: 73, B: 1, F: nil},
+	{Str: "\u03B2\u03BF\u03C5\u03BB\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03B4\u03B9\u03C0\u03BB", A: 76, B: 1, F: nil},
+	{Str: "\u03C8\u03C5\u03C7\u03BF\u03C0\u03BB", A: 76, B: 1, F: nil},
+	{Str: "\u03BB\u03B1\u03BF\u03C0\u03BB", A: 76, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03B3\u03B1\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03B2\u03B1\u03B8\u03C5\u03B3\u03B1\u03BB", A: 81, B: 1, F: nil},
+	{Str: "\u03BA\u03B1\u03C4\u03B1\u03B3\u03B1\u03BB", A: 81, B: 1, F: nil},
+	{Str: "\u03BF\u03BB\u03BF\u03B3\u03B1\u03BB", A: 81, B: 1, F: nil},
+	{Str: "\u03BA\u03B1\u03C3\u03C4\u03B5\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03B5\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03BF\u03C1\u03C4\u03BF\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03BC", A: -1, B: 1, F: nil},
+	{Str: "\u03B4\u03C1\u03B1\u03B4\u03BF\u03C5\u03BC", A: 88, B: 1, F: nil},
+	{Str: "\u03B2\u03C1\u03B1\u03C7\u03BC", A: 88, B: 1, F: nil},
+	{Str: "\u03BF\u03BB\u03B9\u03B3\u03BF\u03B4\u03B1\u03BC", A: 88, B: 1, F: nil},
+	{Str: "\u03BC\u03BF\u03C5\u03C3\u03BF\u03C5\u03BB\u03BC", A: 88, B: 1, F: nil},
+	{Str: "\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BC\u03B5\u03C1\u03B9\u03BA\u03B1\u03BD", A: 93, B: 1, F: nil},
+}
+
+var A_40 = []*snowballRuntime.Among{
+	{Str: "\u03B7\u03C3\u03B5\u03C4\u03B5", A: -1, B: 1, F: nil},
+}
+
+var A_41 = []*snowballRuntime.Among{
+	{Str: "\u03C0\u03C5\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03C5\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03C7\u03C9\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03B2\u03B1\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03B2\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B9\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03C6\u03BF\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03BD\u03B5\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03C7", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03C5\u03BD\u03B4", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03BD\u03B4", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03B4", A: -1, B: 1, F: nil},
+	{Str: "\u03C5\u03C0\u03B5\u03C1\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03C5\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03C1\u03B1\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03C4\u03B1\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03B4\u03B9\u03B1\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03BA\u03B1\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03C4\u03B9\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03BA\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03C5\u03BD\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03BD\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03C1\u03BF\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03C1\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03C9\u03C6\u03B5\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03B2\u03BF\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03C5\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B9\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03BF\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03C1\u03BF\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_42 = []*snowballRuntime.Among{
+	{Str: "\u03C3\u03B5\u03C1\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03BA\u03BF\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03B8\u03B1\u03C1\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03BD\u03C4\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B2\u03B1\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03BD\u03B1\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B2\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03C0\u03BF\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03C5", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03C5\u03C1\u03C6", A: -1, B: 1, F: nil},
+	{Str: "\u03BD\u03B9\u03C6", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B1\u03B3", A: -1, B: 1, F: nil},
+	{Str: "\u03B4", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B4", A: 12, B: 1, F: nil},
+	{Str: "\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B8", A: 14, B: 1, F: nil},
+	{Str: "\u03C3\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03C4\u03BF\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03C0\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B1\u03C1\u03B1\u03BA\u03B1\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03BA\u03B5\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03BC", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03B2\u03B5\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03B2\u03B1\u03C1\u03BF\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_43 = []*snowballRuntime.Among{
+	{Str: "\u03C9\u03BD\u03C4\u03B1\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03BD\u03C4\u03B1\u03C3", A: -1, B: 1, F: nil},
+}
+
+var A_44 = []*snowballRuntime.Among{
+	{Str: "\u03BF\u03BC\u03B1\u03C3\u03C4\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03BC\u03B1\u03C3\u03C4\u03B5", A: 0, B: 1, F: nil},
+}
+
+var A_45 = []*snowballRuntime.Among{
+	{Str: "\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03B1\u03BA\u03B1\u03C4\u03B1\u03C0", A: 1, B: 1, F: nil},
+	{Str: "\u03C3\u03C5\u03BC\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03B1\u03C3\u03C5\u03BC\u03C0", A: 3, B: 1, F: nil},
+	{Str: "\u03B1\u03BC\u03B5\u03C4\u03B1\u03BC\u03C6", A: -1, B: 1, F: nil},
+}
+
+var A_46 = []*snowballRuntime.Among{
+	{Str: "\u03B1\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03BD\u03B9\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B6", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B1\u03C1\u03B1\u03BA\u03B1\u03BB", A: 3, B: 1, F: nil},
+	{Str: "\u03B5\u03BA\u03C4\u03B5\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03BC", A: -1, B: 1, F: nil},
+	{Str: "\u03BE", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03C1\u03BF", A: -1, B: 1, F: nil},
+}
+
+var A_47 = []*snowballRuntime.Among{
+	{Str: "\u03B7\u03B8\u03B7\u03BA\u03B5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03B8\u03B7\u03BA\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03B8\u03B7\u03BA\u03B5", A: -1, B: 1, F: nil},
+}
+
+var A_48 = []*snowballRuntime.Among{
+	{Str: "\u03C3\u03C6", A: -1, B: 1, F: nil},
+	{Str: "\u03BD\u03B1\u03C1\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B9\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03BA\u03BF\u03C5\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03BA\u03C9\u03BB", A: -1, B: 1, F: nil},
+}
+
+var A_49 = []*snowballRuntime.Among{
+	{Str: "\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03C1\u03BF\u03C3\u03B8", A: 0, B: 1, F: nil},
+	{Str: "\u03C0\u03B1\u03C1\u03B1\u03BA\u03B1\u03C4\u03B1\u03B8", A: 0, B: 1, F: nil},
+	{Str: "\u03B4\u03B9\u03B1\u03B8", A: 0, B: 1, F: nil},
+	{Str: "\u03C3\u03C5\u03BD\u03B8", A: 0, B: 1, F: nil},
+}
+
+var A_50 = []*snowballRuntime.Among{
+	{Str: "\u03B7\u03BA\u03B5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03BA\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03BA\u03B5", A: -1, B: 1, F: nil},
+}
+
+var A_51 = []*snowballRuntime.Among{
+	{Str: "\u03B2\u03BB\u03B5\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03BF\u03B4\u03B1\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03C1\u03C9\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03BA\u03C5\u03BC\u03B1\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B1\u03BD\u03C4\u03B1\u03C7", A: -1, B: 1, F: nil},
+	{Str: "\u03BB\u03B1\u03C7", A: -1, B: 1, F: nil},
+	{Str: "\u03C6\u03B1\u03B3", A: -1, B: 1, F: nil},
+	{Str: "\u03BB\u03B7\u03B3", A: -1, B: 1, F: nil},
+	{Str: "\u03C6\u03C1\u03C5\u03B4", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03B1\u03BD\u03C4\u03B9\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03B1\u03BB\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03BC", A: -1, B: 1, F: nil},
+}
+
+var A_52 = []*snowballRuntime.Among{
+	{Str: "\u03B5\u03BA\u03BB\u03B9\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BD\u03B1\u03C1\u03C1", A: 1, B: 1, F: nil},
+	{Str: "\u03B5\u03BD\u03B4\u03B9\u03B1\u03C6\u03B5\u03C1", A: 1, B: 1, F: nil},
+	{Str: "\u03C0\u03B1\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03BA\u03B1\u03B8\u03B1\u03C1\u03B5\u03C5", A: -1, B: 1, F: nil},
+	{Str: "\u03B4\u03B5\u03C5\u03C4\u03B5\u03C1\u03B5\u03C5", A: -1, B: 1, F: nil},
+	{Str: "\u03BB\u03B5\u03C7", A: -1, B: 1, F: nil},
+	{Str: "\u03C4\u03C3\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03C7\u03B1\u03B4", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03B5\u03B4", A: -1, B: 1, F: nil},
+	{Str: "\u03BB\u03B1\u03BC\u03C0\u03B9\u03B4", A: -1, B: 1, F: nil},
+	{Str: "\u03B4\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03BB\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03B5\u03C3\u03B1\u03B6", A: -1, B: 1, F: nil},
+	{Str: "\u03B4\u03B5\u03C3\u03C0\u03BF\u03B6", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B9\u03B8", A: -1, B: 1, F: nil},
+	{Str: "\u03C6\u03B1\u03C1\u03BC\u03B1\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B3\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BD\u03B7\u03BA", A: -1, B: 1, F: nil},
+	{Str: "\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03BC", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BC", A: 21, B: 1, F: nil},
+	{Str: "\u03B2\u03C1\u03BF\u03BC", A: 21, B: 1, F: nil},
+	{Str: "\u03C5\u03C0\u03BF\u03C4\u03B5\u03B9\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_53 = []*snowballRuntime.Among{
+	{Str: "\u03BF\u03C5\u03C3\u03B5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03C3\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03C3\u03B5", A: -1, B: 1, F: nil},
+}
+
+var A_54 = []*snowballRuntime.Among{
+	{Str: "\u03C1\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03C6\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03C7\u03BF\u03C1\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03C6", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03C6", A: -1, B: 1, F: nil},
+	{Str: "\u03C8\u03BF\u03C6", A: 5, B: -1, F: nil},
+	{Str: "\u03BB\u03BF\u03C7", A: -1, B: 1, F: nil},
+	{Str: "\u03BD\u03B1\u03C5\u03BB\u03BF\u03C7", A: 7, B: -1, F: nil},
+	{Str: "\u03C0\u03B5\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03BB\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03BC\u03B7\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_55 = []*snowballRuntime.Among{
+	{Str: "\u03C0", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03C3\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03B1\u03BD\u03C5\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03B1\u03C1\u03C4\u03B9\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03B1\u03B5\u03B9\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03C3\u03C5\u03BC\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03C0\u03C1\u03BF\u03C3\u03C9\u03C0\u03BF\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03C3\u03B9\u03B4\u03B7\u03C1\u03BF\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03B4\u03C1\u03BF\u03C3\u03BF\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03BD\u03B5\u03BF\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03BA\u03C1\u03BF\u03BA\u03B1\u03BB\u03BF\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03BF\u03BB\u03BF\u03C0", A: 0, B: 1, F: nil},
+	{Str: "\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03C4\u03C1", A: 12, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03C1", A: 12, B: 1, F: nil},
+	{Str: "\u03B1\u03C3\u03C0\u03B1\u03C1", A: 12, B: 1, F: nil},
+	{Str: "\u03C7\u03B1\u03C1", A: 12, B: 1, F: nil},
+	{Str: "\u03B1\u03C7\u03B1\u03C1", A: 16, B: 1, F: nil},
+	{Str: "\u03B1\u03C0\u03B5\u03C1", A: 12, B: 1, F: nil},
+	{Str: "\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BD\u03C5\u03C3\u03C4", A: 19, B: 1, F: nil},
+	{Str: "\u03B1\u03B2\u03B1\u03C3\u03C4", A: 19, B: 1, F: nil},
+	{Str: "\u03C0\u03C1\u03BF\u03C3\u03C4", A: 19, B: 1, F: nil},
+	{Str: "\u03B1\u03B9\u03BC\u03BF\u03C3\u03C4", A: 19, B: 1, F: nil},
+	{Str: "\u03B4\u03B9\u03B1\u03C4", A: 19, B: 1, F: nil},
+	{Str: "\u03B5\u03C0\u03B9\u03C4", A: 19, B: 1, F: nil},
+	{Str: "\u03C3\u03C5\u03BD\u03C4", A: 19, B: 1, F: nil},
+	{Str: "\u03C5\u03C0\u03BF\u03C4", A: 19, B: 1, F: nil},
+	{Str: "\u03B1\u03C0\u03BF\u03C4", A: 19, B: 1, F: nil},
+	{Str: "\u03BF\u03BC\u03BF\u03C4", A: 19, B: 1, F: nil},
+	{Str: "\u03BD\u03BF\u03BC\u03BF\u03C4", A: 29, B: 1, F: nil},
+	{Str: "\u03BD\u03B1\u03C5", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03BF\u03BB\u03C5\u03C6", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03C6", A: -1, B: 1, F: nil},
+	{Str: "\u03BE\u03B5\u03C6", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B4\u03B7\u03C6", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B1\u03BC\u03C6", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BC\u03B1\u03BB\u03BB\u03B9", A: -1, B: 1, F: nil},
+	{Str: "\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03BC\u03B1\u03BB", A: 38, B: 1, F: nil},
+	{Str: "\u03BC", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03BB\u03B1\u03BC", A: 40, B: 1, F: nil},
+	{Str: "\u03B5\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03B4\u03B5\u03C1\u03B2\u03B5\u03BD", A: 42, B: 1, F: nil},
+}
+
+var A_56 = []*snowballRuntime.Among{
+	{Str: "\u03B1\u03B3\u03B5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B3\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B3\u03B5", A: -1, B: 1, F: nil},
+}
+
+var A_57 = []*snowballRuntime.Among{
+	{Str: "\u03B7\u03C3\u03BF\u03C5", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03C3\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03C3\u03B5", A: -1, B: 1, F: nil},
+}
+
+var A_58 = []*snowballRuntime.Among{
+	{Str: "\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03C0\u03C4\u03B1\u03BD", A: 0, B: 1, F: nil},
+	{Str: "\u03B4\u03C9\u03B4\u03B5\u03BA\u03B1\u03BD", A: 0, B: 1, F: nil},
+	{Str: "\u03C7\u03B5\u03C1\u03C3\u03BF\u03BD", A: 0, B: 1, F: nil},
+	{Str: "\u03BC\u03B5\u03B3\u03B1\u03BB\u03BF\u03BD", A: 0, B: 1, F: nil},
+	{Str: "\u03B5\u03C1\u03B7\u03BC\u03BF\u03BD", A: 0, B: 1, F: nil},
+}
+
+var A_59 = []*snowballRuntime.Among{
+	{Str: "\u03B7\u03C3\u03C4\u03B5", A: -1, B: 1, F: nil},
+}
+
+var A_60 = []*snowballRuntime.Among{
+	{Str: "\u03C7\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03B4\u03C5\u03C3\u03C7\u03C1", A: 0, B: 1, F: nil},
+	{Str: "\u03B5\u03C5\u03C7\u03C1", A: 0, B: 1, F: nil},
+	{Str: "\u03B1\u03C7\u03C1", A: 0, B: 1, F: nil},
+	{Str: "\u03BA\u03BF\u03B9\u03BD\u03BF\u03C7\u03C1", A: 0, B: 1, F: nil},
+	{Str: "\u03C0\u03B1\u03BB\u03B9\u03BC\u03C8", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03B2", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03C3\u03B2", A: 6, B: 1, F: nil},
+	{Str: "\u03B1\u03C0\u03BB", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B5\u03B9\u03BC\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_61 = []*snowballRuntime.Among{
+	{Str: "\u03BF\u03C5\u03BD\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03C3\u03BF\u03C5\u03BD\u03B5", A: 0, B: 1, F: nil},
+	{Str: "\u03B7\u03B8\u03BF\u03C5\u03BD\u03B5", A: 0, B: 1, F: nil},
+}
+
+var A_62 = []*snowballRuntime.Among{
+	{Str: "\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03C4\u03C1\u03B1\u03B2\u03BF\u03BC\u03BF\u03C5\u03C4\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03BA\u03B1\u03BA\u03BF\u03BC\u03BF\u03C5\u03C4\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03C3\u03C0\u03B9", A: -1, B: 1, F: nil},
+	{Str: "\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03BE\u03C9\u03BD", A: 4, B: 1, F: nil},
+}
+
+var A_63 = []*snowballRuntime.Among{
+	{Str: "\u03BF\u03C5\u03BC\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03C3\u03BF\u03C5\u03BC\u03B5", A: 0, B: 1, F: nil},
+	{Str: "\u03B7\u03B8\u03BF\u03C5\u03BC\u03B5", A: 0, B: 1, F: nil},
+}
+
+var A_64 = []*snowballRuntime.Among{
+	{Str: "\u03B1\u03C3\u03BF\u03C5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03C0\u03B1\u03C1\u03B1\u03C3\u03BF\u03C5\u03C3", A: 0, B: 1, F: nil},
+	{Str: "\u03B1\u03BB\u03BB\u03BF\u03C3\u03BF\u03C5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03C6", A: -1, B: 1, F: nil},
+	{Str: "\u03C7", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03B6", A: -1, B: 1, F: nil},
+	{Str: "\u03C9\u03C1\u03B9\u03BF\u03C0\u03BB", A: -1, B: 1, F: nil},
+}
+
+var A_65 = []*snowballRuntime.Among{
+	{Str: "\u03BC\u03B1\u03C4\u03BF\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03B1\u03C4\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03BC\u03B1\u03C4\u03C9\u03BD", A: -1, B: 1, F: nil},
+}
+
+var A_66 = []*snowballRuntime.Among{
+	{Str: "\u03C5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03C3", A: 0, B: 1, F: nil},
+	{Str: "\u03B1\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03C3\u03B5\u03C3", A: 3, B: 1, F: nil},
+	{Str: "\u03B7\u03B4\u03B5\u03C3", A: 3, B: 1, F: nil},
+	{Str: "\u03B7\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03B9\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03B8\u03B5\u03B9\u03C3", A: 7, B: 1, F: nil},
+	{Str: "\u03BF\u03C3", A: -1, B: 1, F: nil},
+	{Str: "\u03C5", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03C5", A: 10, B: 1, F: nil},
+	{Str: "\u03C9", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03C3\u03C9", A: 12, B: 1, F: nil},
+	{Str: "\u03B1\u03C9", A: 12, B: 1, F: nil},
+	{Str: "\u03B7\u03B8\u03C9", A: 12, B: 1, F: nil},
+	{Str: "\u03B1", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03C5\u03BC\u03B1", A: 16, B: 1, F: nil},
+	{Str: "\u03BF\u03C3\u03BF\u03C5\u03BD\u03B1", A: 16, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03C3\u03BF\u03C5\u03BD\u03B1", A: 18, B: 1, F: nil},
+	{Str: "\u03BF\u03BC\u03BF\u03C5\u03BD\u03B1", A: 16, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03BC\u03BF\u03C5\u03BD\u03B1", A: 20, B: 1, F: nil},
+	{Str: "\u03B5", A: -1, B: 1, F: nil},
+	{Str: "\u03B9\u03B5\u03C3\u03B1\u03C3\u03C4\u03B5", A: 22, B: 1, F: nil},
+	{Str: "\u03BF\u03C3\u03B1\u03C3\u03C4\u03B5", A: 22, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03C3\u03B1\u03C3\u03C4\u03B5", A: 24, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03BC\u03B1\u03C3\u03C4\u03B5", A: 22, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03C5\u03BC\u03B1\u03C3\u03C4\u03B5", A: 26, B: 1, F: nil},
+	{Str: "\u03B9\u03B5\u03BC\u03B1\u03C3\u03C4\u03B5", A: 22, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03C3\u03B1\u03C4\u03B5", A: 22, B: 1, F: nil},
+	{Str: "\u03B7\u03C3\u03B1\u03C4\u03B5", A: 22, B: 1, F: nil},
+	{Str: "\u03B1\u03B3\u03B1\u03C4\u03B5", A: 22, B: 1, F: nil},
+	{Str: "\u03B7\u03BA\u03B1\u03C4\u03B5", A: 22, B: 1, F: nil},
+	{Str: "\u03B7\u03B8\u03B7\u03BA\u03B1\u03C4\u03B5", A: 32, B: 1, F: nil},
+	{Str: "\u03B5\u03B9\u03C4\u03B5", A: 22, B: 1, F: nil},
+	{Str: "\u03B7\u03B8\u03B5\u03B9\u03C4\u03B5", A: 34, B: 1, F: nil},
+	{Str: "\u03B7", A: -1, B: 1, F: nil},
+	{Str: "\u03B9", A: -1, B: 1, F: nil},
+	{Str: "\u03B1\u03C3\u03B1\u03B9", A: 37, B: 1, F: nil},
+	{Str: "\u03B5\u03C3\u03B1\u03B9", A: 37, B: 1, F: nil},
+	{Str: "\u03B9\u03B5\u03C3\u03B1\u03B9", A: 39, B: 1, F: nil},
+	{Str: "\u03B1\u03C4\u03B1\u03B9", A: 37, B: 1, F: nil},
+	{Str: "\u03B5\u03C4\u03B1\u03B9", A: 37, B: 1, F: nil},
+	{Str: "\u03B9\u03B5\u03C4\u03B1\u03B9", A: 42, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03BD\u03C4\u03B1\u03B9", A: 37, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03C5\u03BD\u03C4\u03B1\u03B9", A: 44, B: 1, F: nil},
+	{Str: "\u03BF\u03BD\u03C4\u03B1\u03B9", A: 37, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03BC\u03B1\u03B9", A: 37, B: 1, F: nil},
+	{Str: "\u03B1\u03BC\u03B1\u03B9", A: 37, B: 1, F: nil},
+	{Str: "\u03B9\u03B5\u03BC\u03B1\u03B9", A: 37, B: 1, F: nil},
+	{Str: "\u03BF\u03BC\u03B1\u03B9", A: 37, B: 1, F: nil},
+	{Str: "\u03B5\u03B9", A: 37, B: 1, F: nil},
+	{Str: "\u03B7\u03C3\u03B5\u03B9", A: 51, B: 1, F: nil},
+	{Str: "\u03B1\u03B5\u03B9", A: 51, B: 1, F: nil},
+	{Str: "\u03B7\u03B8\u03B5\u03B9", A: 51, B: 1, F: nil},
+	{Str: "\u03BF\u03B9", A: 37, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03C3\u03BF\u03C5\u03BD", A: 56, B: 1, F: nil},
+	{Str: "\u03BF\u03C3\u03BF\u03C5\u03BD", A: 56, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03C3\u03BF\u03C5\u03BD", A: 58, B: 1, F: nil},
+	{Str: "\u03B7\u03B8\u03BF\u03C5\u03BD", A: 56, B: 1, F: nil},
+	{Str: "\u03BF\u03BC\u03BF\u03C5\u03BD", A: 56, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03BC\u03BF\u03C5\u03BD", A: 61, B: 1, F: nil},
+	{Str: "\u03C9\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03B7\u03B4\u03C9\u03BD", A: 63, B: 1, F: nil},
+	{Str: "\u03B1\u03BD", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03C3\u03B1\u03BD", A: 65, B: 1, F: nil},
+	{Str: "\u03BF\u03BD\u03C4\u03BF\u03C5\u03C3\u03B1\u03BD", A: 66, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03BD\u03C4\u03BF\u03C5\u03C3\u03B1\u03BD", A: 67, B: 1, F: nil},
+	{Str: "\u03B7\u03C3\u03B1\u03BD", A: 65, B: 1, F: nil},
+	{Str: "\u03BF\u03C3\u03B1\u03C3\u03C4\u03B1\u03BD", A: 65, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03C3\u03B1\u03C3\u03C4\u03B1\u03BD", A: 70, B: 1, F: nil},
+	{Str: "\u03BF\u03BC\u03B1\u03C3\u03C4\u03B1\u03BD", A: 65, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03BC\u03B1\u03C3\u03C4\u03B1\u03BD", A: 72, B: 1, F: nil},
+	{Str: "\u03BF\u03C5\u03BD\u03C4\u03B1\u03BD", A: 65, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03C5\u03BD\u03C4\u03B1\u03BD", A: 74, B: 1, F: nil},
+	{Str: "\u03BF\u03BD\u03C4\u03B1\u03BD", A: 65, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03BD\u03C4\u03B1\u03BD", A: 76, B: 1, F: nil},
+	{Str: "\u03BF\u03C4\u03B1\u03BD", A: 65, B: 1, F: nil},
+	{Str: "\u03B9\u03BF\u03C4\u03B1\u03BD", A: 78, B: 1, F: nil},
+	{Str: "\u03B1\u03B3\u03B1\u03BD", A: 65, B: 1, F: nil},
+	{Str: "\u03B7\u03BA\u03B1\u03BD", A: 65, B: 1, F: nil},
+	{Str: "\u03B7\u03B8\u03B7\u03BA\u03B1\u03BD", A: 81, B: 1, F: nil},
+	{Str: "\u03BF", A: -1, B: 1, F: nil},
+}
+
+var A_67 = []*snowballRuntime.Among{
+	{Str: "\u03B5\u03C3\u03C4\u03B5\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03C5\u03C4\u03B5\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03C9\u03C4\u03B5\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03C4\u03B5\u03C1", A: -1, B: 1, F: nil},
+	{Str: "\u03B5\u03C3\u03C4\u03B1\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03C5\u03C4\u03B1\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03C9\u03C4\u03B1\u03C4", A: -1, B: 1, F: nil},
+	{Str: "\u03BF\u03C4\u03B1\u03C4", A: -1, B: 1, F: nil},
+}
+
+var G_v = []byte{81, 65, 16, 1}
+
+var G_v2 = []byte{81, 65, 0, 1}
+
+type Context struct {
+	b_test1 bool
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		b_test1: false,
+	}
+	_ = context
+	var among_var int32
+	env.LimitBackward = env.Cursor
+	env.Cursor = env.Limit
+	var v_1 = env.Limit - env.Cursor
+lab0:
+	for {
+	replab1:
+		for {
+			var v_2 = env.Limit - env.Cursor
+		lab2:
+			for range [2]struct{}{} {
+				env.Ket = env.Cursor
+				among_var = env.FindAmongB(A_0, context)
+				if among_var == 0 {
+					break lab2
+				}
+				env.Bra = env.Cursor
+				if among_var == 1 {
+					if !env.SliceFrom("\u03B1") {
+						return false
+					}
+				} else if among_var == 2 {
+					if !env.SliceFrom("\u03B2") {
+						return false
+					}
+				} else if among_var == 3 {
+					if !env.SliceFrom("\u03B3") {
+						return false
+					}
+				} else if among_var == 4 {
+					if !env.SliceFrom("\u03B4") {
+						return false
+					}
+				} else if among_var == 5 {
+					if !env.SliceFrom("\u03B5") {
+						return false
+					}
+				} else if among_var == 6 {
+					if !env.SliceFrom("\u03B6") {
+						return false
+					}
+				} else if among_var == 7 {
+					if !env.SliceFrom("\u03B7") {
+						return false
+					}
+				} else if among_var == 8 {
+					if !env.SliceFrom("\u03B8") {
+						return false
+					}
+				} else if among_var == 9 {
+					if !env.SliceFrom("\u03B9") {
+						return false
+					}
+				} else if among_var == 10 {
+					if !env.SliceFrom("\u03BA") {
+						return false
+					}
+				} else if among_var == 11 {
+					if !env.SliceFrom("\u03BB") {
+						return false
+					}
+				} else if among_var == 12 {
+					if !env.SliceFrom("\u03BC") {
+						return false
+					}
+				} else if among_var == 13 {
+					if !env.SliceFrom("\u03BD") {
+						return false
+					}
+				} else if among_var == 14 {
+					if !env.SliceFrom("\u03BE") {
+						return false
+					}
+				} else if among_var == 15 {
+					if !env.SliceFrom("\u03BF") {
+						return false
+					}
+				} else if among_var == 16 {
+					if !env.SliceFrom("\u03C0") {
+						return false
+					}
+				} else if among_var == 17 {
+					if !env.SliceFrom("\u03C1") {
+						return false
+					}
+				} else if among_var == 18 {
+					if !env.SliceFrom("\u03C3") {
+						return false
+					}
+				} else if among_var == 19 {
+					if !env.SliceFrom("\u03C4") {
+						return false
+					}
+				} else if among_var == 20 {
+					if !env.SliceFrom("\u03C5") {
+						return false
+					}
+				} else if among_var == 21 {
+					if !env.SliceFrom("\u03C6") {
+						return false
+					}
+				} else if among_var == 22 {
+					if !env.SliceFrom("\u03C7") {
+						return false
+					}
+				} else if among_var == 23 {
+					if !env.SliceFrom("\u03C8") {
+						return false
+					}
+				} else if among_var == 24 {
+					if !env.SliceFrom("\u03C9") {
+						return false
+					}
+				} else if among_var == 25 {
+					if env.Cursor <= env.LimitBackward {
+						break lab2
+					}
+					env.PrevChar()
+				}
+				continue replab1
+			}
+			env.Cursor = env.Limit - v_2
+			break replab1
+		}
+		break lab0
+	}
+	env.Cursor = env.Limit - v_1
+	if !(snowballRuntime.RuneCountInString(env.Current()) >= 3) {
+		return false
+	}
+	context.b_test1 = true
+	var v_3 = env.Limit - env.Cursor
+lab3:
+	for {
+		env.Ket = env.Cursor
+		among_var = env.FindAmongB(A_1, context)
+		if among_var == 0 {
+			break lab3
+		}
+		env.Bra = env.Cursor
+		if among_var == 1 {
+			if !env.SliceFrom("\u03C6\u03B1") {
+				return false
+			}
+		} else if among_var == 2 {
+			if !env.SliceFrom("\u03C3\u03BA\u03B1") {
+				return false
+			}
+		} else if among_var == 3 {
+			if !env.SliceFrom("\u03BF\u03BB\u03BF") {
+				return false
+			}
+		} else if among_var == 4 {
+			if !env.SliceFrom("\u03C3\u03BF") {
+				return false
+			}
+		} else if among_var == 5 {
+			if !env.SliceFrom("\u03C4\u03B1\u03C4\u03BF") {
+				return false
+			}
+		} else if among_var == 6 {
+			if !env.SliceFrom("\u03BA\u03C1\u03B5") {
+				return false
+			}
+		} else if among_var == 7 {
+			if !env.SliceFrom("\u03C0\u03B5\u03C1") {
+				return false
+			}
+		} else if among_var == 8 {
+			if !env.SliceFrom("\u03C4\u03B5\u03C1") {
+				return false
+			}
+		} else if among_var == 9 {
+			if !env.SliceFrom("\u03C6\u03C9") {
+				return false
+			}
+		} else if among_var == 10 {
+			if !env.SliceFrom("\u03BA\u03B1\u03B8\u03B5\u03C3\u03C4") {
+				return false
+			}
+		} else if among_var == 11 {
+			if !env.SliceFrom("\u03B3\u03B5\u03B3\u03BF\u03BD") {
+				return false
+			}
+		}
+		context.b_test1 = false
+		break lab3
+	}
+	env.Cursor = env.Limit - v_3
+	var v_4 = env.Limit - env.Cursor
+lab4:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_3, context) == 0 {
+			break lab4
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+		env.Ket = env.Cursor
+		env.Bra = env.Cursor
+		among_var = env.FindAmongB(A_2, context)
+		if among_var == 0 {
+			break lab4
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab4
+		}
+		if among_var == 1 {
+			if !env.SliceFrom("\u03B9") {
+				return false
+			}
+		} else if among_var == 2 {
+			if !env.SliceFrom("\u03B9\u03B6") {
+				return false
+			}
+		}
+		break lab4
+	}
+	env.Cursor = env.Limit - v_4
+	var v_5 = env.Limit - env.Cursor
+lab5:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_5, context) == 0 {
+			break lab5
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+		env.Ket = env.Cursor
+		env.Bra = env.Cursor
+		if env.FindAmongB(A_4, context) == 0 {
+			break lab5
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab5
+		}
+		if !env.SliceFrom("\u03C9\u03BD") {
+			return false
+		}
+		break lab5
+	}
+	env.Cursor = env.Limit - v_5
+	var v_6 = env.Limit - env.Cursor
+lab6:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_7, context) == 0 {
+			break lab6
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+	lab7:
+		for {
+			var v_7 = env.Limit - env.Cursor
+		lab8:
+			for {
+				if !env.EqSB("\u03B9\u03C3\u03B1") {
+					break lab8
+				}
+				if env.Cursor > env.LimitBackward {
+					break lab8
+				}
+				if !env.SliceFrom("\u03B9\u03C3") {
+					return false
+				}
+				break lab7
+			}
+			env.Cursor = env.Limit - v_7
+			env.Ket = env.Cursor
+			env.Bra = env.Cursor
+			among_var = env.FindAmongB(A_6, context)
+			if among_var == 0 {
+				break lab6
+			}
+			if env.Cursor > env.LimitBackward {
+				break lab6
+			}
+			if among_var == 1 {
+				if !env.SliceFrom("\u03B9") {
+					return false
+				}
+			} else if among_var == 2 {
+				if !env.SliceFrom("\u03B9\u03C3") {
+					return false
+				}
+			}
+			break lab7
+		}
+		break lab6
+	}
+	env.Cursor = env.Limit - v_6
+	var v_8 = env.Limit - env.Cursor
+lab9:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_9, context) == 0 {
+			break lab9
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+		env.Ket = env.Cursor
+		env.Bra = env.Cursor
+		if env.FindAmongB(A_8, context) == 0 {
+			break lab9
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab9
+		}
+		if !env.SliceFrom("\u03B9") {
+			return false
+		}
+		break lab9
+	}
+	env.Cursor = env.Limit - v_8
+	var v_9 = env.Limit - env.Cursor
+lab10:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_11, context) == 0 {
+			break lab10
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+		env.Ket = env.Cursor
+		env.Bra = env.Cursor
+		among_var = env.FindAmongB(A_10, context)
+		if among_var == 0 {
+			break lab10
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab10
+		}
+		if among_var == 1 {
+			if !env.SliceFrom("\u03B9") {
+				return false
+			}
+		} else if among_var == 2 {
+			if !env.SliceFrom("\u03B9\u03C3\u03C4") {
+				return false
+			}
+		}
+		break lab10
+	}
+	env.Cursor = env.Limit - v_9
+	var v_10 = env.Limit - env.Cursor
+lab11:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_14, context) == 0 {
+			break lab11
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+	lab12:
+		for {
+			var v_11 = env.Limit - env.Cursor
+		lab13:
+			for {
+				env.Ket = env.Cursor
+				env.Bra = env.Cursor
+				among_var = env.FindAmongB(A_12, context)
+				if among_var == 0 {
+					break lab13
+				}
+				if env.Cursor > env.LimitBackward {
+					break lab13
+				}
+				if among_var == 1 {
+					if !env.SliceFrom("\u03B9\u03C3\u03BC") {
+						return false
+					}
+				} else if among_var == 2 {
+					if !env.SliceFrom("\u03B9") {
+						return false
+					}
+				}
+				break lab12
+			}
+			env.Cursor = env.Limit - v_11
+			env.Ket = env.Cursor
+			among_var = env.FindAmongB(A_13, context)
+			if among_var == 0 {
+				break lab11
+			}
+			env.Bra = env.Cursor
+			if among_var == 1 {
+				if !env.SliceFrom("\u03B1\u03B3\u03BD\u03C9\u03C3\u03C4") {
+					return false
+				}
+			} else if among_var == 2 {
+				if !env.SliceFrom("\u03B1\u03C4\u03BF\u03BC") {
+					return false
+				}
+			} else if among_var == 3 {
+				if !env.SliceFrom("\u03B3\u03BD\u03C9\u03C3\u03C4") {
+					return false
+				}
+			} else if among_var == 4 {
+				if !env.SliceFrom("\u03B5\u03B8\u03BD") {
+					return false
+				}
+			} else if among_var == 5 {
+				if !env.SliceFrom("\u03B5\u03BA\u03BB\u03B5\u03BA\u03C4") {
+					return false
+				}
+			} else if among_var == 6 {
+				if !env.SliceFrom("\u03C3\u03BA\u03B5\u03C0\u03C4") {
+					return false
+				}
+			} else if among_var == 7 {
+				if !env.SliceFrom("\u03C4\u03BF\u03C0") {
+					return false
+				}
+			} else if among_var == 8 {
+				if !env.SliceFrom("\u03B1\u03BB\u03B5\u03BE\u03B1\u03BD\u03B4\u03C1") {
+					return false
+				}
+			} else if among_var == 9 {
+				if !env.SliceFrom("\u03B2\u03C5\u03B6\u03B1\u03BD\u03C4") {
+					return false
+				}
+			} else if among_var == 10 {
+				if !env.SliceFrom("\u03B8\u03B5\u03B1\u03C4\u03C1") {
+					return false
+				}
+			}
+			break lab12
+		}
+		break lab11
+	}
+	env.Cursor = env.Limit - v_10
+	var v_12 = env.Limit - env.Cursor
+lab14:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_16, context) == 0 {
+			break lab14
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+		env.Ket = env.Cursor
+		env.Bra = env.Cursor
+		if env.FindAmongB(A_15, context) == 0 {
+			break lab14
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab14
+		}
+		if !env.SliceFrom("\u03B1\u03C1\u03B1\u03BA") {
+			return false
+		}
+		break lab14
+	}
+	env.Cursor = env.Limit - v_12
+	var v_13 = env.Limit - env.Cursor
+lab15:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_18, context) == 0 {
+			break lab15
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+	lab16:
+		for {
+			var v_14 = env.Limit - env.Cursor
+		lab17:
+			for {
+				env.Ket = env.Cursor
+				env.Bra = env.Cursor
+				among_var = env.FindAmongB(A_17, context)
+				if among_var == 0 {
+					break lab17
+				}
+				if env.Cursor > env.LimitBackward {
+					break lab17
+				}
+				if among_var == 1 {
+					if !env.SliceFrom("\u03B1\u03BA") {
+						return false
+					}
+				} else if among_var == 2 {
+					if !env.SliceFrom("\u03B9\u03C4\u03C3") {
+						return false
+					}
+				}
+				break lab16
+			}
+			env.Cursor = env.Limit - v_14
+			env.Ket = env.Cursor
+			env.Bra = env.Cursor
+			if !env.EqSB("\u03BA\u03BF\u03C1") {
+				break lab15
+			}
+			if !env.SliceFrom("\u03B9\u03C4\u03C3") {
+				return false
+			}
+			break lab16
+		}
+		break lab15
+	}
+	env.Cursor = env.Limit - v_13
+	var v_15 = env.Limit - env.Cursor
+lab18:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_21, context) == 0 {
+			break lab18
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+	lab19:
+		for {
+			var v_16 = env.Limit - env.Cursor
+		lab20:
+			for {
+				env.Ket = env.Cursor
+				env.Bra = env.Cursor
+				if env.FindAmongB(A_19, context) == 0 {
+					break lab20
+				}
+				if env.Cursor > env.LimitBackward {
+					break lab20
+				}
+				if !env.SliceFrom("\u03B9\u03B4") {
+					return false
+				}
+				break lab19
+			}
+			env.Cursor = env.Limit - v_16
+			env.Ket = env.Cursor
+			env.Bra = env.Cursor
+			if env.FindAmongB(A_20, context) == 0 {
+				break lab18
+			}
+			if !env.SliceFrom("\u03B9\u03B4") {
+				return false
+			}
+			break lab19
+		}
+		break lab18
+	}
+	env.Cursor = env.Limit - v_15
+	var v_17 = env.Limit - env.Cursor
+lab21:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_23, context) == 0 {
+			break lab21
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+		env.Ket = env.Cursor
+		env.Bra = env.Cursor
+		if env.FindAmongB(A_22, context) == 0 {
+			break lab21
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab21
+		}
+		if !env.SliceFrom("\u03B9\u03C3\u03BA") {
+			return false
+		}
+		break lab21
+	}
+	env.Cursor = env.Limit - v_17
+	var v_18 = env.Limit - env.Cursor
+lab22:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_24, context) == 0 {
+			break lab22
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		var v_19 = env.Limit - env.Cursor
+	lab23:
+		for {
+			if env.FindAmongB(A_25, context) == 0 {
+				break lab23
+			}
+			break lab22
+		}
+		env.Cursor = env.Limit - v_19
+		{
+			var c = env.Cursor
+			bra, ket := env.Cursor, env.Cursor
+			env.Insert(bra, ket, "\u03B1\u03B4")
+			env.Cursor = c
+		}
+		break lab22
+	}
+	env.Cursor = env.Limit - v_18
+	var v_20 = env.Limit - env.Cursor
+lab24:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_26, context) == 0 {
+			break lab24
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		env.Ket = env.Cursor
+		env.Bra = env.Cursor
+		if env.FindAmongB(A_27, context) == 0 {
+			break lab24
+		}
+		if !env.SliceFrom("\u03B5\u03B4") {
+			return false
+		}
+		break lab24
+	}
+	env.Cursor = env.Limit - v_20
+	var v_21 = env.Limit - env.Cursor
+lab25:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_28, context) == 0 {
+			break lab25
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		env.Ket = env.Cursor
+		env.Bra = env.Cursor
+		if env.FindAmongB(A_29, context) == 0 {
+			break lab25
+		}
+		if !env.SliceFrom("\u03BF\u03C5\u03B4") {
+			return false
+		}
+		break lab25
+	}
+	env.Cursor = env.Limit - v_21
+	var v_22 = env.Limit - env.Cursor
+lab26:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_30, context) == 0 {
+			break lab26
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+		env.Ket = env.Cursor
+		env.Bra = env.Cursor
+		if env.FindAmongB(A_31, context) == 0 {
+			break lab26
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab26
+		}
+		if !env.SliceFrom("\u03B5") {
+			return false
+		}
+		break lab26
+	}
+	env.Cursor = env.Limit - v_22
+	var v_23 = env.Limit - env.Cursor
+lab27:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_32, context) == 0 {
+			break lab27
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+		env.Ket = env.Cursor
+		env.Bra = env.Cursor
+		if !env.InGroupingB(G_v, 945, 969) {
+			break lab27
+		}
+		if !env.SliceFrom("\u03B9") {
+			return false
+		}
+		break lab27
+	}
+	env.Cursor = env.Limit - v_23
+	var v_24 = env.Limit - env.Cursor
+lab28:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_33, context) == 0 {
+			break lab28
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+	lab29:
+		for {
+			var v_25 = env.Limit - env.Cursor
+		lab30:
+			for {
+				env.Ket = env.Cursor
+				env.Bra = env.Cursor
+				if !env.InGroupingB(G_v, 945, 969) {
+					break lab30
+				}
+				if !env.SliceFrom("\u03B9\u03BA") {
+					return false
+				}
+				break lab29
+			}
+			env.Cursor = env.Limit - v_25
+			env.Ket = env.Cursor
+			break lab29
+		}
+		env.Bra = env.Cursor
+		if env.FindAmongB(A_34, context) == 0 {
+			break lab28
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab28
+		}
+		if !env.SliceFrom("\u03B9\u03BA") {
+			return false
+		}
+		break lab28
+	}
+	env.Cursor = env.Limit - v_24
+	var v_26 = env.Limit - env.Cursor
+lab31:
+	for {
+		var v_27 = env.Limit - env.Cursor
+	lab32:
+		for {
+			if !env.EqSB("\u03B1\u03B3\u03B1\u03BC\u03B5") {
+				break lab32
+			}
+			if env.Cursor > env.LimitBackward {
+				break lab32
+			}
+			if !env.SliceFrom("\u03B1\u03B3\u03B1\u03BC") {
+				return false
+			}
+			break lab32
+		}
+		env.Cursor = env.Limit - v_27
+		var v_28 = env.Limit - env.Cursor
+	lab33:
+		for {
+			env.Ket = env.Cursor
+			if env.FindAmongB(A_35, context) == 0 {
+				break lab33
+			}
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			context.b_test1 = false
+			break lab33
+		}
+		env.Cursor = env.Limit - v_28
+		env.Ket = env.Cursor
+		if !env.EqSB("\u03B1\u03BC\u03B5") {
+			break lab31
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+		env.Ket = env.Cursor
+		env.Bra = env.Cursor
+		if env.FindAmongB(A_36, context) == 0 {
+			break lab31
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab31
+		}
+		if !env.SliceFrom("\u03B1\u03BC") {
+			return false
+		}
+		break lab31
+	}
+	env.Cursor = env.Limit - v_26
+	var v_29 = env.Limit - env.Cursor
+lab34:
+	for {
+		var v_30 = env.Limit - env.Cursor
+	lab35:
+		for {
+			env.Ket = env.Cursor
+			if env.FindAmongB(A_38, context) == 0 {
+				break lab35
+			}
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			context.b_test1 = false
+			env.Ket = env.Cursor
+			env.Bra = env.Cursor
+			if env.FindAmongB(A_37, context) == 0 {
+				break lab35
+			}
+			if env.Cursor > env.LimitBackward {
+				break lab35
+			}
+			if !env.SliceFrom("\u03B1\u03B3\u03B1\u03BD") {
+				return false
+			}
+			break lab35
+		}
+		env.Cursor = env.Limit - v_30
+		env.Ket = env.Cursor
+		if !env.EqSB("\u03B1\u03BD\u03B5") {
+			break lab34
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+	lab36:
+		for {
+			var v_31 = env.Limit - env.Cursor
+		lab37:
+			for {
+				env.Ket = env.Cursor
+				env.Bra = env.Cursor
+				if !env.InGroupingB(G_v2, 945, 969) {
+					break lab37
+				}
+				if !env.SliceFrom("\u03B1\u03BD") {
+					return false
+				}
+				break lab36
+			}
+			env.Cursor = env.Limit - v_31
+			env.Ket = env.Cursor
+			break lab36
+		}
+		env.Bra = env.Cursor
+		if env.FindAmongB(A_39, context) == 0 {
+			break lab34
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab34
+		}
+		if !env.SliceFrom("\u03B1\u03BD") {
+			return false
+		}
+		break lab34
+	}
+	env.Cursor = env.Limit - v_29
+	var v_32 = env.Limit - env.Cursor
+lab38:
+	for {
+		var v_33 = env.Limit - env.Cursor
+	lab39:
+		for {
+			env.Ket = env.Cursor
+			if env.FindAmongB(A_40, context) == 0 {
+				break lab39
+			}
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			context.b_test1 = false
+			break lab39
+		}
+		env.Cursor = env.Limit - v_33
+		env.Ket = env.Cursor
+		if !env.EqSB("\u03B5\u03C4\u03B5") {
+			break lab38
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+	lab40:
+		for {
+			var v_34 = env.Limit - env.Cursor
+		lab41:
+			for {
+				env.Ket = env.Cursor
+				env.Bra = env.Cursor
+				if !env.InGroupingB(G_v2, 945, 969) {
+					break lab41
+				}
+				if !env.SliceFrom("\u03B5\u03C4") {
+					return false
+				}
+				break lab40
+			}
+			env.Cursor = env.Limit - v_34
+		lab42:
+			for {
+				env.Ket = env.Cursor
+				env.Bra = env.Cursor
+				if env.FindAmongB(A_41, context) == 0 {
+					break lab42
+				}
+				if !env.SliceFrom("\u03B5\u03C4") {
+					return false
+				}
+				break lab40
+			}
+			env.Cursor = env.Limit - v_34
+			env.Ket = env.Cursor
+			break lab40
+		}
+		env.Bra = env.Cursor
+		if env.FindAmongB(A_42, context) == 0 {
+			break lab38
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab38
+		}
+		if !env.SliceFrom("\u03B5\u03C4") {
+			return false
+		}
+		break lab38
+	}
+	env.Cursor = env.Limit - v_32
+	var v_35 = env.Limit - env.Cursor
+lab43:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_43, context) == 0 {
+			break lab43
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+	lab44:
+		for {
+			var v_36 = env.Limit - env.Cursor
+		lab45:
+			for {
+				env.Ket = env.Cursor
+				env.Bra = env.Cursor
+				if !env.EqSB("\u03B1\u03C1\u03C7") {
+					break lab45
+				}
+				if env.Cursor > env.LimitBackward {
+					break lab45
+				}
+				if !env.SliceFrom("\u03BF\u03BD\u03C4") {
+					return false
+				}
+				break lab44
+			}
+			env.Cursor = env.Limit - v_36
+			env.Ket = env.Cursor
+			env.Bra = env.Cursor
+			if !env.EqSB("\u03BA\u03C1\u03B5") {
+				break lab43
+			}
+			if !env.SliceFrom("\u03C9\u03BD\u03C4") {
+				return false
+			}
+			break lab44
+		}
+		break lab43
+	}
+	env.Cursor = env.Limit - v_35
+	var v_37 = env.Limit - env.Cursor
+lab46:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_44, context) == 0 {
+			break lab46
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+		env.Ket = env.Cursor
+		env.Bra = env.Cursor
+		if !env.EqSB("\u03BF\u03BD") {
+			break lab46
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab46
+		}
+		if !env.SliceFrom("\u03BF\u03BC\u03B1\u03C3\u03C4") {
+			return false
+		}
+		break lab46
+	}
+	env.Cursor = env.Limit - v_37
+	var v_38 = env.Limit - env.Cursor
+lab47:
+	for {
+		var v_39 = env.Limit - env.Cursor
+	lab48:
+		for {
+			env.Ket = env.Cursor
+			if !env.EqSB("\u03B9\u03B5\u03C3\u03C4\u03B5") {
+				break lab48
+			}
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			context.b_test1 = false
+			env.Ket = env.Cursor
+			env.Bra = env.Cursor
+			if env.FindAmongB(A_45, context) == 0 {
+				break lab48
+			}
+			if env.Cursor > env.LimitBackward {
+				break lab48
+			}
+			if !env.SliceFrom("\u03B9\u03B5\u03C3\u03C4") {
+				return false
+			}
+			break lab48
+		}
+		env.Cursor = env.Limit - v_39
+		env.Ket = env.Cursor
+		if !env.EqSB("\u03B5\u03C3\u03C4\u03B5") {
+			break lab47
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+		env.Ket = env.Cursor
+		env.Bra = env.Cursor
+		if env.FindAmongB(A_46, context) == 0 {
+			break lab47
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab47
+		}
+		if !env.SliceFrom("\u03B9\u03B5\u03C3\u03C4") {
+			return false
+		}
+		break lab47
+	}
+	env.Cursor = env.Limit - v_38
+	var v_40 = env.Limit - env.Cursor
+lab49:
+	for {
+		var v_41 = env.Limit - env.Cursor
+	lab50:
+		for {
+			env.Ket = env.Cursor
+			if env.FindAmongB(A_47, context) == 0 {
+				break lab50
+			}
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			context.b_test1 = false
+			break lab50
+		}
+		env.Cursor = env.Limit - v_41
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_50, context) == 0 {
+			break lab49
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+	lab51:
+		for {
+			var v_42 = env.Limit - env.Cursor
+		lab52:
+			for {
+				env.Ket = env.Cursor
+				env.Bra = env.Cursor
+				if env.FindAmongB(A_48, context) == 0 {
+					break lab52
+				}
+				if !env.SliceFrom("\u03B7\u03BA") {
+					return false
+				}
+				break lab51
+			}
+			env.Cursor = env.Limit - v_42
+			env.Ket = env.Cursor
+			env.Bra = env.Cursor
+			if env.FindAmongB(A_49, context) == 0 {
+				break lab49
+			}
+			if env.Cursor > env.LimitBackward {
+				break lab49
+			}
+			if !env.SliceFrom("\u03B7\u03BA") {
+				return false
+			}
+			break lab51
+		}
+		break lab49
+	}
+	env.Cursor = env.Limit - v_40
+	var v_43 = env.Limit - env.Cursor
+lab53:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_53, context) == 0 {
+			break lab53
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+	lab54:
+		for {
+			var v_44 = env.Limit - env.Cursor
+		lab55:
+			for {
+				env.Ket = env.Cursor
+				env.Bra = env.Cursor
+				if env.FindAmongB(A_51, context) == 0 {
+					break lab55
+				}
+				if !env.SliceFrom("\u03BF\u03C5\u03C3") {
+					return false
+				}
+				break lab54
+			}
+			env.Cursor = env.Limit - v_44
+			env.Ket = env.Cursor
+			env.Bra = env.Cursor
+			if env.FindAmongB(A_52, context) == 0 {
+				break lab53
+			}
+			if env.Cursor > env.LimitBackward {
+				break lab53
+			}
+			if !env.SliceFrom("\u03BF\u03C5\u03C3") {
+				return false
+			}
+			break lab54
+		}
+		break lab53
+	}
+	env.Cursor = env.Limit - v_43
+	var v_45 = env.Limit - env.Cursor
+lab56:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_57, context) == 0 {
+			break lab56
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+		env.Ket = env.Cursor
+		env.Bra = env.Cursor
+		if env.FindAmongB(A_58, context) == 0 {
+			break lab56
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab56
+		}
+		if !env.SliceFrom("\u03B7\u03C3") {
+			return false
+		}
+		break lab56
+	}
+	env.Cursor = env.Limit - v_45
+	var v_46 = env.Limit - env.Cursor
+lab57:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_56, context) == 0 {
+			break lab57
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+	lab58:
+		for {
+			var v_47 = env.Limit - env.Cursor
+		lab59:
+			for {
+				env.Ket = env.Cursor
+				env.Bra = env.Cursor
+				if !env.EqSB("\u03BA\u03BF\u03BB\u03BB") {
+					break lab59
+				}
+				if !env.SliceFrom("\u03B1\u03B3") {
+					return false
+				}
+				break lab58
+			}
+			env.Cursor = env.Limit - v_47
+		lab60:
+			for {
+				var v_48 = env.Limit - env.Cursor
+			lab61:
+				for {
+					env.Ket = env.Cursor
+					env.Bra = env.Cursor
+					among_var = env.FindAmongB(A_54, context)
+					if among_var == 0 {
+						break lab61
+					}
+					if among_var == 1 {
+						if !env.SliceFrom("\u03B1\u03B3") {
+							return false
+						}
+					}
+					break lab60
+				}
+				env.Cursor = env.Limit - v_48
+				env.Ket = env.Cursor
+				env.Bra = env.Cursor
+				if env.FindAmongB(A_55, context) == 0 {
+					break lab57
+				}
+				if env.Cursor > env.LimitBackward {
+					break lab57
+				}
+				if !env.SliceFrom("\u03B1\u03B3") {
+					return false
+				}
+				break lab60
+			}
+			break lab58
+		}
+		break lab57
+	}
+	env.Cursor = env.Limit - v_46
+	var v_49 = env.Limit - env.Cursor
+lab62:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_59, context) == 0 {
+			break lab62
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+		env.Ket = env.Cursor
+		env.Bra = env.Cursor
+		if env.FindAmongB(A_60, context) == 0 {
+			break lab62
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab62
+		}
+		if !env.SliceFrom("\u03B7\u03C3\u03C4") {
+			return false
+		}
+		break lab62
+	}
+	env.Cursor = env.Limit - v_49
+	var v_50 = env.Limit - env.Cursor
+lab63:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_61, context) == 0 {
+			break lab63
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+		env.Ket = env.Cursor
+		env.Bra = env.Cursor
+		if env.FindAmongB(A_62, context) == 0 {
+			break lab63
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab63
+		}
+		if !env.SliceFrom("\u03BF\u03C5\u03BD") {
+			return false
+		}
+		break lab63
+	}
+	env.Cursor = env.Limit - v_50
+	var v_51 = env.Limit - env.Cursor
+lab64:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_63, context) == 0 {
+			break lab64
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_test1 = false
+		env.Ket = env.Cursor
+		env.Bra = env.Cursor
+		if env.FindAmongB(A_64, context) == 0 {
+			break lab64
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab64
+		}
+		if !env.SliceFrom("\u03BF\u03C5\u03BC") {
+			return false
+		}
+		break lab64
+	}
+	env.Cursor = env.Limit - v_51
+	var v_52 = env.Limit - env.Cursor
+lab65:
+	for {
+		var v_53 = env.Limit - env.Cursor
+	lab66:
+		for {
+			env.Ket = env.Cursor
+			if env.FindAmongB(A_65, context) == 0 {
+				break lab66
+			}
+			env.Bra = env.Cursor
+			if !env.SliceFrom("\u03BC\u03B1") {
+				return false
+			}
+			break lab66
+		}
+		env.Cursor = env.Limit - v_53
+		if !context.b_test1 {
+			break lab65
+		}
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_66, context) == 0 {
+			break lab65
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		break lab65
+	}
+	env.Cursor = env.Limit - v_52
+	var v_54 = env.Limit - env.Cursor
+lab67:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_67, context) == 0 {
+			break lab67
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		break lab67
+	}
+	env.Cursor = env.Limit - v_54
+	env.Cursor = env.LimitBackward
+	return true
+}
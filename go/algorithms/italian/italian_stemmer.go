@@ -0,0 +1,883 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package italian
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "", A: -1, B: 7, F: nil},
+	{Str: "qu", A: 0, B: 6, F: nil},
+	{Str: "\u00E1", A: 0, B: 1, F: nil},
+	{Str: "\u00E9", A: 0, B: 2, F: nil},
+	{Str: "\u00ED", A: 0, B: 3, F: nil},
+	{Str: "\u00F3", A: 0, B: 4, F: nil},
+	{Str: "\u00FA", A: 0, B: 5, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "", A: -1, B: 3, F: nil},
+	{Str: "I", A: 0, B: 1, F: nil},
+	{Str: "U", A: 0, B: 2, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "la", A: -1, B: -1, F: nil},
+	{Str: "cela", A: 0, B: -1, F: nil},
+	{Str: "gliela", A: 0, B: -1, F: nil},
+	{Str: "mela", A: 0, B: -1, F: nil},
+	{Str: "tela", A: 0, B: -1, F: nil},
+	{Str: "vela", A: 0, B: -1, F: nil},
+	{Str: "le", A: -1, B: -1, F: nil},
+	{Str: "cele", A: 6, B: -1, F: nil},
+	{Str: "gliele", A: 6, B: -1, F: nil},
+	{Str: "mele", A: 6, B: -1, F: nil},
+	{Str: "tele", A: 6, B: -1, F: nil},
+	{Str: "vele", A: 6, B: -1, F: nil},
+	{Str: "ne", A: -1, B: -1, F: nil},
+	{Str: "cene", A: 12, B: -1, F: nil},
+	{Str: "gliene", A: 12, B: -1, F: nil},
+	{Str: "mene", A: 12, B: -1, F: nil},
+	{Str: "sene", A: 12, B: -1, F: nil},
+	{Str: "tene", A: 12, B: -1, F: nil},
+	{Str: "vene", A: 12, B: -1, F: nil},
+	{Str: "ci", A: -1, B: -1, F: nil},
+	{Str: "li", A: -1, B: -1, F: nil},
+	{Str: "celi", A: 20, B: -1, F: nil},
+	{Str: "glieli", A: 20, B: -1, F: nil},
+	{Str: "meli", A: 20, B: -1, F: nil},
+	{Str: "teli", A: 20, B: -1, F: nil},
+	{Str: "veli", A: 20, B: -1, F: nil},
+	{Str: "gli", A: 20, B: -1, F: nil},
+	{Str: "mi", A: -1, B: -1, F: nil},
+	{Str: "si", A: -1, B: -1, F: nil},
+	{Str: "ti", A: -1, B: -1, F: nil},
+	{Str: "vi", A: -1, B: -1, F: nil},
+	{Str: "lo", A: -1, B: -1, F: nil},
+	{Str: "celo", A: 31, B: -1, F: nil},
+	{Str: "glielo", A: 31, B: -1, F: nil},
+	{Str: "melo", A: 31, B: -1, F: nil},
+	{Str: "telo", A: 31, B: -1, F: nil},
+	{Str: "velo", A: 31, B: -1, F: nil},
+}
+
+var A_3 = []*snowballRuntime.Among{
+	{Str: "ando", A: -1, B: 1, F: nil},
+	{Str: "endo", A: -1, B: 1, F: nil},
+	{Str: "ar", A: -1, B: 2, F: nil},
+	{Str: "er", A: -1, B: 2, F: nil},
+	{Str: "ir", A: -1, B: 2, F: nil},
+}
+
+var A_4 = []*snowballRuntime.Among{
+	{Str: "ic", A: -1, B: -1, F: nil},
+	{Str: "abil", A: -1, B: -1, F: nil},
+	{Str: "os", A: -1, B: -1, F: nil},
+	{Str: "iv", A: -1, B: 1, F: nil},
+}
+
+var A_5 = []*snowballRuntime.Among{
+	{Str: "ic", A: -1, B: 1, F: nil},
+	{Str: "abil", A: -1, B: 1, F: nil},
+	{Str: "iv", A: -1, B: 1, F: nil},
+}
+
+var A_6 = []*snowballRuntime.Among{
+	{Str: "ica", A: -1, B: 1, F: nil},
+	{Str: "logia", A: -1, B: 3, F: nil},
+	{Str: "osa", A: -1, B: 1, F: nil},
+	{Str: "ista", A: -1, B: 1, F: nil},
+	{Str: "iva", A: -1, B: 9, F: nil},
+	{Str: "anza", A: -1, B: 1, F: nil},
+	{Str: "enza", A: -1, B: 5, F: nil},
+	{Str: "ice", A: -1, B: 1, F: nil},
+	{Str: "atrice", A: 7, B: 1, F: nil},
+	{Str: "iche", A: -1, B: 1, F: nil},
+	{Str: "logie", A: -1, B: 3, F: nil},
+	{Str: "abile", A: -1, B: 1, F: nil},
+	{Str: "ibile", A: -1, B: 1, F: nil},
+	{Str: "usione", A: -1, B: 4, F: nil},
+	{Str: "azione", A: -1, B: 2, F: nil},
+	{Str: "uzione", A: -1, B: 4, F: nil},
+	{Str: "atore", A: -1, B: 2, F: nil},
+	{Str: "ose", A: -1, B: 1, F: nil},
+	{Str: "ante", A: -1, B: 1, F: nil},
+	{Str: "mente", A: -1, B: 1, F: nil},
+	{Str: "amente", A: 19, B: 7, F: nil},
+	{Str: "iste", A: -1, B: 1, F: nil},
+	{Str: "ive", A: -1, B: 9, F: nil},
+	{Str: "anze", A: -1, B: 1, F: nil},
+	{Str: "enze", A: -1, B: 5, F: nil},
+	{Str: "ici", A: -1, B: 1, F: nil},
+	{Str: "atrici", A: 25, B: 1, F: nil},
+	{Str: "ichi", A: -1, B: 1, F: nil},
+	{Str: "abili", A: -1, B: 1, F: nil},
+	{Str: "ibili", A: -1, B: 1, F: nil},
+	{Str: "ismi", A: -1, B: 1, F: nil},
+	{Str: "usioni", A: -1, B: 4, F: nil},
+	{Str: "azioni", A: -1, B: 2, F: nil},
+	{Str: "uzioni", A: -1, B: 4, F: nil},
+	{Str: "atori", A: -1, B: 2, F: nil},
+	{Str: "osi", A: -1, B: 1, F: nil},
+	{Str: "anti", A: -1, B: 1, F: nil},
+	{Str: "amenti", A: -1, B: 6, F: nil},
+	{Str: "imenti", A: -1, B: 6, F: nil},
+	{Str: "isti", A: -1, B: 1, F: nil},
+	{Str: "ivi", A: -1, B: 9, F: nil},
+	{Str: "ico", A: -1, B: 1, F: nil},
+	{Str: "ismo", A: -1, B: 1, F: nil},
+	{Str: "oso", A: -1, B: 1, F: nil},
+	{Str: "amento", A: -1, B: 6, F: nil},
+	{Str: "imento", A: -1, B: 6, F: nil},
+	{Str: "ivo", A: -1, B: 9, F: nil},
+	{Str: "it\u00E0", A: -1, B: 8, F: nil},
+	{Str: "ist\u00E0", A: -1, B: 1, F: nil},
+	{Str: "ist\u00E8", A: -1, B: 1, F: nil},
+	{Str: "ist\u00EC", A: -1, B: 1, F: nil},
+}
+
+var A_7 = []*snowballRuntime.Among{
+	{Str: "isca", A: -1, B: 1, F: nil},
+	{Str: "enda", A: -1, B: 1, F: nil},
+	{Str: "ata", A: -1, B: 1, F: nil},
+	{Str: "ita", A: -1, B: 1, F: nil},
+	{Str: "uta", A: -1, B: 1, F: nil},
+	{Str: "ava", A: -1, B: 1, F: nil},
+	{Str: "eva", A: -1, B: 1, F: nil},
+	{Str: "iva", A: -1, B: 1, F: nil},
+	{Str: "erebbe", A: -1, B: 1, F: nil},
+	{Str: "irebbe", A: -1, B: 1, F: nil},
+	{Str: "isce", A: -1, B: 1, F: nil},
+	{Str: "ende", A: -1, B: 1, F: nil},
+	{Str: "are", A: -1, B: 1, F: nil},
+	{Str: "ere", A: -1, B: 1, F: nil},
+	{Str: "ire", A: -1, B: 1, F: nil},
+	{Str: "asse", A: -1, B: 1, F: nil},
+	{Str: "ate", A: -1, B: 1, F: nil},
+	{Str: "avate", A: 16, B: 1, F: nil},
+	{Str: "evate", A: 16, B: 1, F: nil},
+	{Str: "ivate", A: 16, B: 1, F: nil},
+	{Str: "ete", A: -1, B: 1, F: nil},
+	{Str: "erete", A: 20, B: 1, F: nil},
+	{Str: "irete", A: 20, B: 1, F: nil},
+	{Str: "ite", A: -1, B: 1, F: nil},
+	{Str: "ereste", A: -1, B: 1, F: nil},
+	{Str: "ireste", A: -1, B: 1, F: nil},
+	{Str: "ute", A: -1, B: 1, F: nil},
+	{Str: "erai", A: -1, B: 1, F: nil},
+	{Str: "irai", A: -1, B: 1, F: nil},
+	{Str: "isci", A: -1, B: 1, F: nil},
+	{Str: "endi", A: -1, B: 1, F: nil},
+	{Str: "erei", A: -1, B: 1, F: nil},
+	{Str: "irei", A: -1, B: 1, F: nil},
+	{Str: "assi", A: -1, B: 1, F: nil},
+	{Str: "ati", A: -1, B: 1, F: nil},
+	{Str: "iti", A: -1, B: 1, F: nil},
+	{Str: "eresti", A: -1, B: 1, F: nil},
+	{Str: "iresti", A: -1, B: 1, F: nil},
+	{Str: "uti", A: -1, B: 1, F: nil},
+	{Str: "avi", A: -1, B: 1, F: nil},
+	{Str: "evi", A: -1, B: 1, F: nil},
+	{Str: "ivi", A: -1, B: 1, F: nil},
+	{Str: "isco", A: -1, B: 1, F: nil},
+	{Str: "ando", A: -1, B: 1, F: nil},
+	{Str: "endo", A: -1, B: 1, F: nil},
+	{Str: "Yamo", A: -1, B: 1, F: nil},
+	{Str: "iamo", A: -1, B: 1, F: nil},
+	{Str: "avamo", A: -1, B: 1, F: nil},
+	{Str: "evamo", A: -1, B: 1, F: nil},
+	{Str: "ivamo", A: -1, B: 1, F: nil},
+	{Str: "eremo", A: -1, B: 1, F: nil},
+	{Str: "iremo", A: -1, B: 1, F: nil},
+	{Str: "assimo", A: -1, B: 1, F: nil},
+	{Str: "ammo", A: -1, B: 1, F: nil},
+	{Str: "emmo", A: -1, B: 1, F: nil},
+	{Str: "eremmo", A: 54, B: 1, F: nil},
+	{Str: "iremmo", A: 54, B: 1, F: nil},
+	{Str: "immo", A: -1, B: 1, F: nil},
+	{Str: "ano", A: -1, B: 1, F: nil},
+	{Str: "iscano", A: 58, B: 1, F: nil},
+	{Str: "avano", A: 58, B: 1, F: nil},
+	{Str: "evano", A: 58, B: 1, F: nil},
+	{Str: "ivano", A: 58, B: 1, F: nil},
+	{Str: "eranno", A: -1, B: 1, F: nil},
+	{Str: "iranno", A: -1, B: 1, F: nil},
+	{Str: "ono", A: -1, B: 1, F: nil},
+	{Str: "iscono", A: 65, B: 1, F: nil},
+	{Str: "arono", A: 65, B: 1, F: nil},
+	{Str: "erono", A: 65, B: 1, F: nil},
+	{Str: "irono", A: 65, B: 1, F: nil},
+	{Str: "erebbero", A: -1, B: 1, F: nil},
+	{Str: "irebbero", A: -1, B: 1, F: nil},
+	{Str: "assero", A: -1, B: 1, F: nil},
+	{Str: "essero", A: -1, B: 1, F: nil},
+	{Str: "issero", A: -1, B: 1, F: nil},
+	{Str: "ato", A: -1, B: 1, F: nil},
+	{Str: "ito", A: -1, B: 1, F: nil},
+	{Str: "uto", A: -1, B: 1, F: nil},
+	{Str: "avo", A: -1, B: 1, F: nil},
+	{Str: "evo", A: -1, B: 1, F: nil},
+	{Str: "ivo", A: -1, B: 1, F: nil},
+	{Str: "ar", A: -1, B: 1, F: nil},
+	{Str: "ir", A: -1, B: 1, F: nil},
+	{Str: "er\u00E0", A: -1, B: 1, F: nil},
+	{Str: "ir\u00E0", A: -1, B: 1, F: nil},
+	{Str: "er\u00F2", A: -1, B: 1, F: nil},
+	{Str: "ir\u00F2", A: -1, B: 1, F: nil},
+}
+
+var G_v = []byte{17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 8, 2, 1}
+
+var G_AEIO = []byte{17, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 8, 2}
+
+var G_CG = []byte{17}
+
+type Context struct {
+	i_p2 int
+	i_p1 int
+	i_pV int
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		i_p2: 0,
+		i_p1: 0,
+		i_pV: 0,
+	}
+	_ = context
+	var among_var int32
+lab0:
+	for {
+		var v_1 = env.Cursor
+	lab1:
+		for {
+			env.Bra = env.Cursor
+			if !env.EqS("divano") {
+				break lab1
+			}
+			if env.Cursor < env.Limit {
+				break lab1
+			}
+			env.Ket = env.Cursor
+			if !env.SliceFrom("divan") {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = v_1
+		var v_2 = env.Cursor
+	lab2:
+		for {
+			var v_3 = env.Cursor
+		replab3:
+			for {
+				var v_4 = env.Cursor
+			lab4:
+				for range [2]struct{}{} {
+					env.Bra = env.Cursor
+					among_var = env.FindAmong(A_0, context)
+					if among_var == 0 {
+						break lab4
+					}
+					env.Ket = env.Cursor
+					if among_var == 1 {
+						if !env.SliceFrom("\u00E0") {
+							return false
+						}
+					} else if among_var == 2 {
+						if !env.SliceFrom("\u00E8") {
+							return false
+						}
+					} else if among_var == 3 {
+						if !env.SliceFrom("\u00EC") {
+							return false
+						}
+					} else if among_var == 4 {
+						if !env.SliceFrom("\u00F2") {
+							return false
+						}
+					} else if among_var == 5 {
+						if !env.SliceFrom("\u00F9") {
+							return false
+						}
+					} else if among_var == 6 {
+						if !env.SliceFrom("qU") {
+							return false
+						}
+					} else if among_var == 7 {
+						if env.Cursor >= env.Limit {
+							break lab4
+						}
+						env.NextChar()
+					}
+					continue replab3
+				}
+				env.Cursor = v_4
+				break replab3
+			}
+			env.Cursor = v_3
+		replab5:
+			for {
+				var v_5 = env.Cursor
+			lab6:
+				for range [2]struct{}{} {
+				golab7:
+					for {
+						var v_6 = env.Cursor
+					lab8:
+						for {
+							if !env.InGrouping(G_v, 97, 249) {
+								break lab8
+							}
+							env.Bra = env.Cursor
+						lab9:
+							for {
+								var v_7 = env.Cursor
+							lab10:
+								for {
+									if !env.EqS("u") {
+										break lab10
+									}
+									env.Ket = env.Cursor
+									if !env.InGrouping(G_v, 97, 249) {
+										break lab10
+									}
+									if !env.SliceFrom("U") {
+										return false
+									}
+									break lab9
+								}
+								env.Cursor = v_7
+								if !env.EqS("i") {
+									break lab8
+								}
+								env.Ket = env.Cursor
+								if !env.InGrouping(G_v, 97, 249) {
+									break lab8
+								}
+								if !env.SliceFrom("I") {
+									return false
+								}
+								break lab9
+							}
+							env.Cursor = v_6
+							break golab7
+						}
+						env.Cursor = v_6
+						if env.Cursor >= env.Limit {
+							break lab6
+						}
+						env.NextChar()
+					}
+					continue replab5
+				}
+				env.Cursor = v_5
+				break replab5
+			}
+			break lab2
+		}
+		env.Cursor = v_2
+	lab11:
+		for {
+			context.i_pV = env.Limit
+			context.i_p1 = env.Limit
+			context.i_p2 = env.Limit
+			var v_9 = env.Cursor
+		lab12:
+			for {
+			lab13:
+				for {
+					var v_10 = env.Cursor
+				lab14:
+					for {
+						if !env.InGrouping(G_v, 97, 249) {
+							break lab14
+						}
+					lab15:
+						for {
+							var v_11 = env.Cursor
+						lab16:
+							for {
+								if !env.OutGrouping(G_v, 97, 249) {
+									break lab16
+								}
+							golab17:
+								for {
+								lab18:
+									for {
+										if !env.InGrouping(G_v, 97, 249) {
+											break lab18
+										}
+										break golab17
+									}
+									if env.Cursor >= env.Limit {
+										break lab16
+									}
+									env.NextChar()
+								}
+								break lab15
+							}
+							env.Cursor = v_11
+							if !env.InGrouping(G_v, 97, 249) {
+								break lab14
+							}
+						golab19:
+							for {
+							lab20:
+								for {
+									if !env.OutGrouping(G_v, 97, 249) {
+										break lab20
+									}
+									break golab19
+								}
+								if env.Cursor >= env.Limit {
+									break lab14
+								}
+								env.NextChar()
+							}
+							break lab15
+						}
+						break lab13
+					}
+					env.Cursor = v_10
+					if !env.OutGrouping(G_v, 97, 249) {
+						break lab12
+					}
+				lab21:
+					for {
+						var v_14 = env.Cursor
+					lab22:
+						for {
+							if !env.OutGrouping(G_v, 97, 249) {
+								break lab22
+							}
+						golab23:
+							for {
+							lab24:
+								for {
+									if !env.InGrouping(G_v, 97, 249) {
+										break lab24
+									}
+									break golab23
+								}
+								if env.Cursor >= env.Limit {
+									break lab22
+								}
+								env.NextChar()
+							}
+							break lab21
+						}
+						env.Cursor = v_14
+						if !env.InGrouping(G_v, 97, 249) {
+							break lab12
+						}
+						if env.Cursor >= env.Limit {
+							break lab12
+						}
+						env.NextChar()
+						break lab21
+					}
+					break lab13
+				}
+				context.i_pV = env.Cursor
+				break lab12
+			}
+			env.Cursor = v_9
+			var v_16 = env.Cursor
+		lab25:
+			for {
+			golab26:
+				for {
+				lab27:
+					for {
+						if !env.InGrouping(G_v, 97, 249) {
+							break lab27
+						}
+						break golab26
+					}
+					if env.Cursor >= env.Limit {
+						break lab25
+					}
+					env.NextChar()
+				}
+			golab28:
+				for {
+				lab29:
+					for {
+						if !env.OutGrouping(G_v, 97, 249) {
+							break lab29
+						}
+						break golab28
+					}
+					if env.Cursor >= env.Limit {
+						break lab25
+					}
+					env.NextChar()
+				}
+				context.i_p1 = env.Cursor
+			golab30:
+				for {
+				lab31:
+					for {
+						if !env.InGrouping(G_v, 97, 249) {
+							break lab31
+						}
+						break golab30
+					}
+					if env.Cursor >= env.Limit {
+						break lab25
+					}
+					env.NextChar()
+				}
+			golab32:
+				for {
+				lab33:
+					for {
+						if !env.OutGrouping(G_v, 97, 249) {
+							break lab33
+						}
+						break golab32
+					}
+					if env.Cursor >= env.Limit {
+						break lab25
+					}
+					env.NextChar()
+				}
+				context.i_p2 = env.Cursor
+				break lab25
+			}
+			env.Cursor = v_16
+			break lab11
+		}
+		env.LimitBackward = env.Cursor
+		env.Cursor = env.Limit
+		var v_21 = env.Limit - env.Cursor
+	lab34:
+		for {
+			env.Ket = env.Cursor
+			if env.FindAmongB(A_2, context) == 0 {
+				break lab34
+			}
+			env.Bra = env.Cursor
+			among_var = env.FindAmongB(A_3, context)
+			if among_var == 0 {
+				break lab34
+			}
+			if !(context.i_pV <= env.Cursor) {
+				break lab34
+			}
+			if among_var == 1 {
+				if !env.SliceDel() {
+					return false
+				}
+			} else if among_var == 2 {
+				if !env.SliceFrom("e") {
+					return false
+				}
+			}
+			break lab34
+		}
+		env.Cursor = env.Limit - v_21
+		var v_22 = env.Limit - env.Cursor
+	lab35:
+		for {
+		lab36:
+			for {
+				var v_23 = env.Limit - env.Cursor
+			lab37:
+				for {
+					env.Ket = env.Cursor
+					among_var = env.FindAmongB(A_6, context)
+					if among_var == 0 {
+						break lab37
+					}
+					env.Bra = env.Cursor
+					if among_var == 1 {
+						if !(context.i_p2 <= env.Cursor) {
+							break lab37
+						}
+						if !env.SliceDel() {
+							return false
+						}
+					} else if among_var == 2 {
+						if !(context.i_p2 <= env.Cursor) {
+							break lab37
+						}
+						if !env.SliceDel() {
+							return false
+						}
+						var v_24 = env.Limit - env.Cursor
+					lab38:
+						for {
+							env.Ket = env.Cursor
+							if !env.EqSB("ic") {
+								env.Cursor = env.Limit - v_24
+								break lab38
+							}
+							env.Bra = env.Cursor
+							if !(context.i_p2 <= env.Cursor) {
+								env.Cursor = env.Limit - v_24
+								break lab38
+							}
+							if !env.SliceDel() {
+								return false
+							}
+							break lab38
+						}
+					} else if among_var == 3 {
+						if !(context.i_p2 <= env.Cursor) {
+							break lab37
+						}
+						if !env.SliceFrom("log") {
+							return false
+						}
+					} else if among_var == 4 {
+						if !(context.i_p2 <= env.Cursor) {
+							break lab37
+						}
+						if !env.SliceFrom("u") {
+							return false
+						}
+					} else if among_var == 5 {
+						if !(context.i_p2 <= env.Cursor) {
+							break lab37
+						}
+						if !env.SliceFrom("ente") {
+							return false
+						}
+					} else if among_var == 6 {
+						if !(context.i_pV <= env.Cursor) {
+							break lab37
+						}
+						if !env.SliceDel() {
+							return false
+						}
+					} else if among_var == 7 {
+						if !(context.i_p1 <= env.Cursor) {
+							break lab37
+						}
+						if !env.SliceDel() {
+							return false
+						}
+						var v_25 = env.Limit - env.Cursor
+					lab39:
+						for {
+							env.Ket = env.Cursor
+							among_var = env.FindAmongB(A_4, context)
+							if among_var == 0 {
+								env.Cursor = env.Limit - v_25
+								break lab39
+							}
+							env.Bra = env.Cursor
+							if !(context.i_p2 <= env.Cursor) {
+								env.Cursor = env.Limit - v_25
+								break lab39
+							}
+							if !env.SliceDel() {
+								return false
+							}
+							if among_var == 1 {
+								env.Ket = env.Cursor
+								if !env.EqSB("at") {
+									env.Cursor = env.Limit - v_25
+									break lab39
+								}
+								env.Bra = env.Cursor
+								if !(context.i_p2 <= env.Cursor) {
+									env.Cursor = env.Limit - v_25
+									break lab39
+								}
+								if !env.SliceDel() {
+									return false
+								}
+							}
+							break lab39
+						}
+					} else if among_var == 8 {
+						if !(context.i_p2 <= env.Cursor) {
+							break lab37
+						}
+						if !env.SliceDel() {
+							return false
+						}
+						var v_26 = env.Limit - env.Cursor
+					lab40:
+						for {
+							env.Ket = env.Cursor
+							if env.FindAmongB(A_5, context) == 0 {
+								env.Cursor = env.Limit - v_26
+								break lab40
+							}
+							env.Bra = env.Cursor
+							if !(context.i_p2 <= env.Cursor) {
+								env.Cursor = env.Limit - v_26
+								break lab40
+							}
+							if !env.SliceDel() {
+								return false
+							}
+							break lab40
+						}
+					} else if among_var == 9 {
+						if !(context.i_p2 <= env.Cursor) {
+							break lab37
+						}
+						if !env.SliceDel() {
+							return false
+						}
+						var v_27 = env.Limit - env.Cursor
+					lab41:
+						for {
+							env.Ket = env.Cursor
+							if !env.EqSB("at") {
+								env.Cursor = env.Limit - v_27
+								break lab41
+							}
+							env.Bra = env.Cursor
+							if !(context.i_p2 <= env.Cursor) {
+								env.Cursor = env.Limit - v_27
+								break lab41
+							}
+							if !env.SliceDel() {
+								return false
+							}
+							env.Ket = env.Cursor
+							if !env.EqSB("ic") {
+								env.Cursor = env.Limit - v_27
+								break lab41
+							}
+							env.Bra = env.Cursor
+							if !(context.i_p2 <= env.Cursor) {
+								env.Cursor = env.Limit - v_27
+								break lab41
+							}
+							if !env.SliceDel() {
+								return false
+							}
+							break lab41
+						}
+					}
+					break lab36
+				}
+				env.Cursor = env.Limit - v_23
+				if env.Cursor < context.i_pV {
+					break lab35
+				}
+				var v_29 = env.LimitBackward
+				env.LimitBackward = context.i_pV
+				env.Ket = env.Cursor
+				if env.FindAmongB(A_7, context) == 0 {
+					env.LimitBackward = v_29
+					break lab35
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				env.LimitBackward = v_29
+				break lab36
+			}
+			break lab35
+		}
+		env.Cursor = env.Limit - v_22
+		var v_30 = env.Limit - env.Cursor
+	lab42:
+		for {
+			var v_31 = env.Limit - env.Cursor
+		lab43:
+			for {
+				env.Ket = env.Cursor
+				if !env.InGroupingB(G_AEIO, 97, 242) {
+					env.Cursor = env.Limit - v_31
+					break lab43
+				}
+				env.Bra = env.Cursor
+				if !(context.i_pV <= env.Cursor) {
+					env.Cursor = env.Limit - v_31
+					break lab43
+				}
+				if !env.SliceDel() {
+					return false
+				}
+				env.Ket = env.Cursor
+				if !env.EqSB("i") {
+					env.Cursor = env.Limit - v_31
+					break lab43
+				}
+				env.Bra = env.Cursor
+				if !(context.i_pV <= env.Cursor) {
+					env.Cursor = env.Limit - v_31
+					break lab43
+				}
+				if !env.SliceDel() {
+					return false
+				}
+				break lab43
+			}
+			var v_32 = env.Limit - env.Cursor
+		lab44:
+			for {
+				env.Ket = env.Cursor
+				if !env.EqSB("h") {
+					env.Cursor = env.Limit - v_32
+					break lab44
+				}
+				env.Bra = env.Cursor
+				if !env.InGroupingB(G_CG, 99, 103) {
+					env.Cursor = env.Limit - v_32
+					break lab44
+				}
+				if !(context.i_pV <= env.Cursor) {
+					env.Cursor = env.Limit - v_32
+					break lab44
+				}
+				if !env.SliceDel() {
+					return false
+				}
+				break lab44
+			}
+			break lab42
+		}
+		env.Cursor = env.Limit - v_30
+		env.Cursor = env.LimitBackward
+		var v_33 = env.Cursor
+	lab45:
+		for {
+		replab46:
+			for {
+				var v_34 = env.Cursor
+			lab47:
+				for range [2]struct{}{} {
+					env.Bra = env.Cursor
+					among_var = env.FindAmong(A_1, context)
+					if among_var == 0 {
+						break lab47
+					}
+					env.Ket = env.Cursor
+					if among_var == 1 {
+						if !env.SliceFrom("i") {
+							return false
+						}
+					} else if among_var == 2 {
+						if !env.SliceFrom("u") {
+							return false
+						}
+					} else if among_var == 3 {
+						if env.Cursor >= env.Limit {
+							break lab47
+						}
+						env.NextChar()
+					}
+					continue replab46
+				}
+				env.Cursor = v_34
+				break replab46
+			}
+			break lab45
+		}
+		env.Cursor = v_33
+		break lab0
+	}
+	return true
+}
@@ -0,0 +1,233 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package norwegian
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "a", A: -1, B: 1, F: nil},
+	{Str: "e", A: -1, B: 1, F: nil},
+	{Str: "ede", A: 1, B: 1, F: nil},
+	{Str: "ande", A: 1, B: 1, F: nil},
+	{Str: "ende", A: 1, B: 1, F: nil},
+	{Str: "ane", A: 1, B: 1, F: nil},
+	{Str: "ene", A: 1, B: 1, F: nil},
+	{Str: "hetene", A: 6, B: 1, F: nil},
+	{Str: "erte", A: 1, B: 3, F: nil},
+	{Str: "en", A: -1, B: 1, F: nil},
+	{Str: "heten", A: 9, B: 1, F: nil},
+	{Str: "ar", A: -1, B: 1, F: nil},
+	{Str: "er", A: -1, B: 1, F: nil},
+	{Str: "heter", A: 12, B: 1, F: nil},
+	{Str: "s", A: -1, B: 2, F: nil},
+	{Str: "as", A: 14, B: 1, F: nil},
+	{Str: "es", A: 14, B: 1, F: nil},
+	{Str: "edes", A: 16, B: 1, F: nil},
+	{Str: "endes", A: 16, B: 1, F: nil},
+	{Str: "enes", A: 16, B: 1, F: nil},
+	{Str: "hetenes", A: 19, B: 1, F: nil},
+	{Str: "ens", A: 14, B: 1, F: nil},
+	{Str: "hetens", A: 21, B: 1, F: nil},
+	{Str: "ers", A: 14, B: 1, F: nil},
+	{Str: "ets", A: 14, B: 1, F: nil},
+	{Str: "et", A: -1, B: 1, F: nil},
+	{Str: "het", A: 25, B: 1, F: nil},
+	{Str: "ert", A: -1, B: 3, F: nil},
+	{Str: "ast", A: -1, B: 1, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "dt", A: -1, B: -1, F: nil},
+	{Str: "vt", A: -1, B: -1, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "leg", A: -1, B: 1, F: nil},
+	{Str: "eleg", A: 0, B: 1, F: nil},
+	{Str: "ig", A: -1, B: 1, F: nil},
+	{Str: "eig", A: 2, B: 1, F: nil},
+	{Str: "lig", A: 2, B: 1, F: nil},
+	{Str: "elig", A: 4, B: 1, F: nil},
+	{Str: "els", A: -1, B: 1, F: nil},
+	{Str: "lov", A: -1, B: 1, F: nil},
+	{Str: "elov", A: 7, B: 1, F: nil},
+	{Str: "slov", A: 7, B: 1, F: nil},
+	{Str: "hetslov", A: 9, B: 1, F: nil},
+}
+
+var G_v = []byte{17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 128}
+
+var G_s_ending = []byte{119, 125, 149, 1}
+
+type Context struct {
+	i_x  int
+	i_p1 int
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		i_x:  0,
+		i_p1: 0,
+	}
+	_ = context
+	var among_var int32
+	var v_1 = env.Cursor
+lab0:
+	for {
+		context.i_p1 = env.Limit
+		var v_2 = env.Cursor
+		if !env.Hop(3) {
+			break lab0
+		}
+		context.i_x = env.Cursor
+		env.Cursor = v_2
+	golab1:
+		for {
+			var v_3 = env.Cursor
+		lab2:
+			for {
+				if !env.InGrouping(G_v, 97, 248) {
+					break lab2
+				}
+				env.Cursor = v_3
+				break golab1
+			}
+			env.Cursor = v_3
+			if env.Cursor >= env.Limit {
+				break lab0
+			}
+			env.NextChar()
+		}
+	golab3:
+		for {
+		lab4:
+			for {
+				if !env.OutGrouping(G_v, 97, 248) {
+					break lab4
+				}
+				break golab3
+			}
+			if env.Cursor >= env.Limit {
+				break lab0
+			}
+			env.NextChar()
+		}
+		context.i_p1 = env.Cursor
+	lab5:
+		for {
+			if !(context.i_p1 < context.i_x) {
+				break lab5
+			}
+			context.i_p1 = context.i_x
+			break lab5
+		}
+		break lab0
+	}
+	env.Cursor = v_1
+	env.LimitBackward = env.Cursor
+	env.Cursor = env.Limit
+	var v_6 = env.Limit - env.Cursor
+lab6:
+	for {
+		if env.Cursor < context.i_p1 {
+			break lab6
+		}
+		var v_8 = env.LimitBackward
+		env.LimitBackward = context.i_p1
+		env.Ket = env.Cursor
+		among_var = env.FindAmongB(A_0, context)
+		if among_var == 0 {
+			env.LimitBackward = v_8
+			break lab6
+		}
+		env.Bra = env.Cursor
+		env.LimitBackward = v_8
+		if among_var == 1 {
+			if !env.SliceDel() {
+				return false
+			}
+		} else if among_var == 2 {
+		lab7:
+			for {
+				var v_9 = env.Limit - env.Cursor
+			lab8:
+				for {
+					if !env.InGroupingB(G_s_ending, 98, 122) {
+						break lab8
+					}
+					break lab7
+				}
+				env.Cursor = env.Limit - v_9
+				if !env.EqSB("k") {
+					break lab6
+				}
+				if !env.OutGroupingB(G_v, 97, 248) {
+					break lab6
+				}
+				break lab7
+			}
+			if !env.SliceDel() {
+				return false
+			}
+		} else if among_var == 3 {
+			if !env.SliceFrom("er") {
+				return false
+			}
+		}
+		break lab6
+	}
+	env.Cursor = env.Limit - v_6
+	var v_10 = env.Limit - env.Cursor
+lab9:
+	for {
+		var v_11 = env.Limit - env.Cursor
+		if env.Cursor < context.i_p1 {
+			break lab9
+		}
+		var v_13 = env.LimitBackward
+		env.LimitBackward = context.i_p1
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_1, context) == 0 {
+			env.LimitBackward = v_13
+			break lab9
+		}
+		env.Bra = env.Cursor
+		env.LimitBackward = v_13
+		env.Cursor = env.Limit - v_11
+		if env.Cursor <= env.LimitBackward {
+			break lab9
+		}
+		env.PrevChar()
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		break lab9
+	}
+	env.Cursor = env.Limit - v_10
+	var v_14 = env.Limit - env.Cursor
+lab10:
+	for {
+		if env.Cursor < context.i_p1 {
+			break lab10
+		}
+		var v_16 = env.LimitBackward
+		env.LimitBackward = context.i_p1
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_2, context) == 0 {
+			env.LimitBackward = v_16
+			break lab10
+		}
+		env.Bra = env.Cursor
+		env.LimitBackward = v_16
+		if !env.SliceDel() {
+			return false
+		}
+		break lab10
+	}
+	env.Cursor = env.Limit - v_14
+	env.Cursor = env.LimitBackward
+	return true
+}
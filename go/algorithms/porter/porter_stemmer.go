@@ -0,0 +1,632 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package porter
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "s", A: -1, B: 3, F: nil},
+	{Str: "ies", A: 0, B: 2, F: nil},
+	{Str: "sses", A: 0, B: 1, F: nil},
+	{Str: "ss", A: 0, B: -1, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "", A: -1, B: 3, F: nil},
+	{Str: "bb", A: 0, B: 2, F: nil},
+	{Str: "dd", A: 0, B: 2, F: nil},
+	{Str: "ff", A: 0, B: 2, F: nil},
+	{Str: "gg", A: 0, B: 2, F: nil},
+	{Str: "bl", A: 0, B: 1, F: nil},
+	{Str: "mm", A: 0, B: 2, F: nil},
+	{Str: "nn", A: 0, B: 2, F: nil},
+	{Str: "pp", A: 0, B: 2, F: nil},
+	{Str: "rr", A: 0, B: 2, F: nil},
+	{Str: "at", A: 0, B: 1, F: nil},
+	{Str: "tt", A: 0, B: 2, F: nil},
+	{Str: "iz", A: 0, B: 1, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "ed", A: -1, B: 2, F: nil},
+	{Str: "eed", A: 0, B: 1, F: nil},
+	{Str: "ing", A: -1, B: 2, F: nil},
+}
+
+var A_3 = []*snowballRuntime.Among{
+	{Str: "anci", A: -1, B: 3, F: nil},
+	{Str: "enci", A: -1, B: 2, F: nil},
+	{Str: "abli", A: -1, B: 4, F: nil},
+	{Str: "eli", A: -1, B: 6, F: nil},
+	{Str: "alli", A: -1, B: 9, F: nil},
+	{Str: "ousli", A: -1, B: 11, F: nil},
+	{Str: "entli", A: -1, B: 5, F: nil},
+	{Str: "aliti", A: -1, B: 9, F: nil},
+	{Str: "biliti", A: -1, B: 13, F: nil},
+	{Str: "iviti", A: -1, B: 12, F: nil},
+	{Str: "tional", A: -1, B: 1, F: nil},
+	{Str: "ational", A: 10, B: 8, F: nil},
+	{Str: "alism", A: -1, B: 9, F: nil},
+	{Str: "ation", A: -1, B: 8, F: nil},
+	{Str: "ization", A: 13, B: 7, F: nil},
+	{Str: "izer", A: -1, B: 7, F: nil},
+	{Str: "ator", A: -1, B: 8, F: nil},
+	{Str: "iveness", A: -1, B: 12, F: nil},
+	{Str: "fulness", A: -1, B: 10, F: nil},
+	{Str: "ousness", A: -1, B: 11, F: nil},
+}
+
+var A_4 = []*snowballRuntime.Among{
+	{Str: "icate", A: -1, B: 2, F: nil},
+	{Str: "ative", A: -1, B: 3, F: nil},
+	{Str: "alize", A: -1, B: 1, F: nil},
+	{Str: "iciti", A: -1, B: 2, F: nil},
+	{Str: "ical", A: -1, B: 2, F: nil},
+	{Str: "ful", A: -1, B: 3, F: nil},
+	{Str: "ness", A: -1, B: 3, F: nil},
+}
+
+var A_5 = []*snowballRuntime.Among{
+	{Str: "ic", A: -1, B: 1, F: nil},
+	{Str: "ance", A: -1, B: 1, F: nil},
+	{Str: "ence", A: -1, B: 1, F: nil},
+	{Str: "able", A: -1, B: 1, F: nil},
+	{Str: "ible", A: -1, B: 1, F: nil},
+	{Str: "ate", A: -1, B: 1, F: nil},
+	{Str: "ive", A: -1, B: 1, F: nil},
+	{Str: "ize", A: -1, B: 1, F: nil},
+	{Str: "iti", A: -1, B: 1, F: nil},
+	{Str: "al", A: -1, B: 1, F: nil},
+	{Str: "ism", A: -1, B: 1, F: nil},
+	{Str: "ion", A: -1, B: 2, F: nil},
+	{Str: "er", A: -1, B: 1, F: nil},
+	{Str: "ous", A: -1, B: 1, F: nil},
+	{Str: "ant", A: -1, B: 1, F: nil},
+	{Str: "ent", A: -1, B: 1, F: nil},
+	{Str: "ment", A: 15, B: 1, F: nil},
+	{Str: "ement", A: 16, B: 1, F: nil},
+	{Str: "ou", A: -1, B: 1, F: nil},
+}
+
+var G_v = []byte{17, 65, 16, 1}
+
+var G_v_WXY = []byte{1, 17, 65, 208, 1}
+
+type Context struct {
+	b_Y_found bool
+	i_p2      int
+	i_p1      int
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		b_Y_found: false,
+		i_p2:      0,
+		i_p1:      0,
+	}
+	_ = context
+	var among_var int32
+	context.b_Y_found = false
+	var v_1 = env.Cursor
+lab0:
+	for {
+		env.Bra = env.Cursor
+		if !env.EqS("y") {
+			break lab0
+		}
+		env.Ket = env.Cursor
+		if !env.SliceFrom("Y") {
+			return false
+		}
+		context.b_Y_found = true
+		break lab0
+	}
+	env.Cursor = v_1
+	var v_2 = env.Cursor
+lab1:
+	for {
+	replab2:
+		for {
+			var v_3 = env.Cursor
+		lab3:
+			for range [2]struct{}{} {
+			golab4:
+				for {
+					var v_4 = env.Cursor
+				lab5:
+					for {
+						if !env.InGrouping(G_v, 97, 121) {
+							break lab5
+						}
+						env.Bra = env.Cursor
+						if !env.EqS("y") {
+							break lab5
+						}
+						env.Ket = env.Cursor
+						env.Cursor = v_4
+						break golab4
+					}
+					env.Cursor = v_4
+					if env.Cursor >= env.Limit {
+						break lab3
+					}
+					env.NextChar()
+				}
+				if !env.SliceFrom("Y") {
+					return false
+				}
+				context.b_Y_found = true
+				continue replab2
+			}
+			env.Cursor = v_3
+			break replab2
+		}
+		break lab1
+	}
+	env.Cursor = v_2
+	context.i_p1 = env.Limit
+	context.i_p2 = env.Limit
+	var v_5 = env.Cursor
+lab6:
+	for {
+	golab7:
+		for {
+		lab8:
+			for {
+				if !env.InGrouping(G_v, 97, 121) {
+					break lab8
+				}
+				break golab7
+			}
+			if env.Cursor >= env.Limit {
+				break lab6
+			}
+			env.NextChar()
+		}
+	golab9:
+		for {
+		lab10:
+			for {
+				if !env.OutGrouping(G_v, 97, 121) {
+					break lab10
+				}
+				break golab9
+			}
+			if env.Cursor >= env.Limit {
+				break lab6
+			}
+			env.NextChar()
+		}
+		context.i_p1 = env.Cursor
+	golab11:
+		for {
+		lab12:
+			for {
+				if !env.InGrouping(G_v, 97, 121) {
+					break lab12
+				}
+				break golab11
+			}
+			if env.Cursor >= env.Limit {
+				break lab6
+			}
+			env.NextChar()
+		}
+	golab13:
+		for {
+		lab14:
+			for {
+				if !env.OutGrouping(G_v, 97, 121) {
+					break lab14
+				}
+				break golab13
+			}
+			if env.Cursor >= env.Limit {
+				break lab6
+			}
+			env.NextChar()
+		}
+		context.i_p2 = env.Cursor
+		break lab6
+	}
+	env.Cursor = v_5
+	env.LimitBackward = env.Cursor
+	env.Cursor = env.Limit
+	var v_10 = env.Limit - env.Cursor
+lab15:
+	for {
+		env.Ket = env.Cursor
+		among_var = env.FindAmongB(A_0, context)
+		if among_var == 0 {
+			break lab15
+		}
+		env.Bra = env.Cursor
+		if among_var == 1 {
+			if !env.SliceFrom("ss") {
+				return false
+			}
+		} else if among_var == 2 {
+			if !env.SliceFrom("i") {
+				return false
+			}
+		} else if among_var == 3 {
+			if !env.SliceDel() {
+				return false
+			}
+		}
+		break lab15
+	}
+	env.Cursor = env.Limit - v_10
+	var v_11 = env.Limit - env.Cursor
+lab16:
+	for {
+		env.Ket = env.Cursor
+		among_var = env.FindAmongB(A_2, context)
+		if among_var == 0 {
+			break lab16
+		}
+		env.Bra = env.Cursor
+		if among_var == 1 {
+			if !(context.i_p1 <= env.Cursor) {
+				break lab16
+			}
+			if !env.SliceFrom("ee") {
+				return false
+			}
+		} else if among_var == 2 {
+			var v_12 = env.Limit - env.Cursor
+		golab17:
+			for {
+			lab18:
+				for {
+					if !env.InGroupingB(G_v, 97, 121) {
+						break lab18
+					}
+					break golab17
+				}
+				if env.Cursor <= env.LimitBackward {
+					break lab16
+				}
+				env.PrevChar()
+			}
+			env.Cursor = env.Limit - v_12
+			if !env.SliceDel() {
+				return false
+			}
+			var v_14 = env.Limit - env.Cursor
+			among_var = env.FindAmongB(A_1, context)
+			if among_var == 0 {
+				break lab16
+			}
+			env.Cursor = env.Limit - v_14
+			if among_var == 1 {
+				{
+					var c = env.Cursor
+					bra, ket := env.Cursor, env.Cursor
+					env.Insert(bra, ket, "e")
+					env.Cursor = c
+				}
+			} else if among_var == 2 {
+				env.Ket = env.Cursor
+				if env.Cursor <= env.LimitBackward {
+					break lab16
+				}
+				env.PrevChar()
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+			} else if among_var == 3 {
+				if env.Cursor != context.i_p1 {
+					break lab16
+				}
+				var v_15 = env.Limit - env.Cursor
+				if !env.OutGroupingB(G_v_WXY, 89, 121) {
+					break lab16
+				}
+				if !env.InGroupingB(G_v, 97, 121) {
+					break lab16
+				}
+				if !env.OutGroupingB(G_v, 97, 121) {
+					break lab16
+				}
+				env.Cursor = env.Limit - v_15
+				{
+					var c = env.Cursor
+					bra, ket := env.Cursor, env.Cursor
+					env.Insert(bra, ket, "e")
+					env.Cursor = c
+				}
+			}
+		}
+		break lab16
+	}
+	env.Cursor = env.Limit - v_11
+	var v_16 = env.Limit - env.Cursor
+lab19:
+	for {
+		env.Ket = env.Cursor
+	lab20:
+		for {
+			var v_17 = env.Limit - env.Cursor
+		lab21:
+			for {
+				if !env.EqSB("y") {
+					break lab21
+				}
+				break lab20
+			}
+			env.Cursor = env.Limit - v_17
+			if !env.EqSB("Y") {
+				break lab19
+			}
+			break lab20
+		}
+		env.Bra = env.Cursor
+	golab22:
+		for {
+		lab23:
+			for {
+				if !env.InGroupingB(G_v, 97, 121) {
+					break lab23
+				}
+				break golab22
+			}
+			if env.Cursor <= env.LimitBackward {
+				break lab19
+			}
+			env.PrevChar()
+		}
+		if !env.SliceFrom("i") {
+			return false
+		}
+		break lab19
+	}
+	env.Cursor = env.Limit - v_16
+	var v_19 = env.Limit - env.Cursor
+lab24:
+	for {
+		env.Ket = env.Cursor
+		among_var = env.FindAmongB(A_3, context)
+		if among_var == 0 {
+			break lab24
+		}
+		env.Bra = env.Cursor
+		if !(context.i_p1 <= env.Cursor) {
+			break lab24
+		}
+		if among_var == 1 {
+			if !env.SliceFrom("tion") {
+				return false
+			}
+		} else if among_var == 2 {
+			if !env.SliceFrom("ence") {
+				return false
+			}
+		} else if among_var == 3 {
+			if !env.SliceFrom("ance") {
+				return false
+			}
+		} else if among_var == 4 {
+			if !env.SliceFrom("able") {
+				return false
+			}
+		} else if among_var == 5 {
+			if !env.SliceFrom("ent") {
+				return false
+			}
+		} else if among_var == 6 {
+			if !env.SliceFrom("e") {
+				return false
+			}
+		} else if among_var == 7 {
+			if !env.SliceFrom("ize") {
+				return false
+			}
+		} else if among_var == 8 {
+			if !env.SliceFrom("ate") {
+				return false
+			}
+		} else if among_var == 9 {
+			if !env.SliceFrom("al") {
+				return false
+			}
+		} else if among_var == 10 {
+			if !env.SliceFrom("ful") {
+				return false
+			}
+		} else if among_var == 11 {
+			if !env.SliceFrom("ous") {
+				return false
+			}
+		} else if among_var == 12 {
+			if !env.SliceFrom("ive") {
+				return false
+			}
+		} else if among_var == 13 {
+			if !env.SliceFrom("ble") {
+				return false
+			}
+		}
+		break lab24
+	}
+	env.Cursor = env.Limit - v_19
+	var v_20 = env.Limit - env.Cursor
+lab25:
+	for {
+		env.Ket = env.Cursor
+		among_var = env.FindAmongB(A_4, context)
+		if among_var == 0 {
+			break lab25
+		}
+		env.Bra = env.Cursor
+		if !(context.i_p1 <= env.Cursor) {
+			break lab25
+		}
+		if among_var == 1 {
+			if !env.SliceFrom("al") {
+				return false
+			}
+		} else if among_var == 2 {
+			if !env.SliceFrom("ic") {
+				return false
+			}
+		} else if among_var == 3 {
+			if !env.SliceDel() {
+				return false
+			}
+		}
+		break lab25
+	}
+	env.Cursor = env.Limit - v_20
+	var v_21 = env.Limit - env.Cursor
+lab26:
+	for {
+		env.Ket = env.Cursor
+		among_var = env.FindAmongB(A_5, context)
+		if among_var == 0 {
+			break lab26
+		}
+		env.Bra = env.Cursor
+		if !(context.i_p2 <= env.Cursor) {
+			break lab26
+		}
+		if among_var == 1 {
+			if !env.SliceDel() {
+				return false
+			}
+		} else if among_var == 2 {
+		lab27:
+			for {
+				var v_22 = env.Limit - env.Cursor
+			lab28:
+				for {
+					if !env.EqSB("s") {
+						break lab28
+					}
+					break lab27
+				}
+				env.Cursor = env.Limit - v_22
+				if !env.EqSB("t") {
+					break lab26
+				}
+				break lab27
+			}
+			if !env.SliceDel() {
+				return false
+			}
+		}
+		break lab26
+	}
+	env.Cursor = env.Limit - v_21
+	var v_23 = env.Limit - env.Cursor
+lab29:
+	for {
+		env.Ket = env.Cursor
+		if !env.EqSB("e") {
+			break lab29
+		}
+		env.Bra = env.Cursor
+	lab30:
+		for {
+			var v_24 = env.Limit - env.Cursor
+		lab31:
+			for {
+				if !(context.i_p2 <= env.Cursor) {
+					break lab31
+				}
+				break lab30
+			}
+			env.Cursor = env.Limit - v_24
+			if !(context.i_p1 <= env.Cursor) {
+				break lab29
+			}
+			var v_25 = env.Limit - env.Cursor
+		lab32:
+			for {
+				if !env.OutGroupingB(G_v_WXY, 89, 121) {
+					break lab32
+				}
+				if !env.InGroupingB(G_v, 97, 121) {
+					break lab32
+				}
+				if !env.OutGroupingB(G_v, 97, 121) {
+					break lab32
+				}
+				break lab29
+			}
+			env.Cursor = env.Limit - v_25
+			break lab30
+		}
+		if !env.SliceDel() {
+			return false
+		}
+		break lab29
+	}
+	env.Cursor = env.Limit - v_23
+	var v_26 = env.Limit - env.Cursor
+lab33:
+	for {
+		env.Ket = env.Cursor
+		if !env.EqSB("l") {
+			break lab33
+		}
+		env.Bra = env.Cursor
+		if !(context.i_p2 <= env.Cursor) {
+			break lab33
+		}
+		if !env.EqSB("l") {
+			break lab33
+		}
+		if !env.SliceDel() {
+			return false
+		}
+		break lab33
+	}
+	env.Cursor = env.Limit - v_26
+	env.Cursor = env.LimitBackward
+	var v_27 = env.Cursor
+lab34:
+	for {
+		if !context.b_Y_found {
+			break lab34
+		}
+	replab35:
+		for {
+			var v_28 = env.Cursor
+		lab36:
+			for range [2]struct{}{} {
+			golab37:
+				for {
+					var v_29 = env.Cursor
+				lab38:
+					for {
+						env.Bra = env.Cursor
+						if !env.EqS("Y") {
+							break lab38
+						}
+						env.Ket = env.Cursor
+						env.Cursor = v_29
+						break golab37
+					}
+					env.Cursor = v_29
+					if env.Cursor >= env.Limit {
+						break lab36
+					}
+					env.NextChar()
+				}
+				if !env.SliceFrom("y") {
+					return false
+				}
+				continue replab35
+			}
+			env.Cursor = v_28
+			break replab35
+		}
+		break lab34
+	}
+	env.Cursor = v_27
+	return true
+}
@@ -0,0 +1,788 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package portuguese
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "", A: -1, B: 3, F: nil},
+	{Str: "\u00E3", A: 0, B: 1, F: nil},
+	{Str: "\u00F5", A: 0, B: 2, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "", A: -1, B: 3, F: nil},
+	{Str: "a~", A: 0, B: 1, F: nil},
+	{Str: "o~", A: 0, B: 2, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "ic", A: -1, B: -1, F: nil},
+	{Str: "ad", A: -1, B: -1, F: nil},
+	{Str: "os", A: -1, B: -1, F: nil},
+	{Str: "iv", A: -1, B: 1, F: nil},
+}
+
+var A_3 = []*snowballRuntime.Among{
+	{Str: "ante", A: -1, B: 1, F: nil},
+	{Str: "avel", A: -1, B: 1, F: nil},
+	{Str: "\u00EDvel", A: -1, B: 1, F: nil},
+}
+
+var A_4 = []*snowballRuntime.Among{
+	{Str: "ic", A: -1, B: 1, F: nil},
+	{Str: "abil", A: -1, B: 1, F: nil},
+	{Str: "iv", A: -1, B: 1, F: nil},
+}
+
+var A_5 = []*snowballRuntime.Among{
+	{Str: "ica", A: -1, B: 1, F: nil},
+	{Str: "\u00E2ncia", A: -1, B: 1, F: nil},
+	{Str: "\u00EAncia", A: -1, B: 4, F: nil},
+	{Str: "logia", A: -1, B: 2, F: nil},
+	{Str: "ira", A: -1, B: 9, F: nil},
+	{Str: "adora", A: -1, B: 1, F: nil},
+	{Str: "osa", A: -1, B: 1, F: nil},
+	{Str: "ista", A: -1, B: 1, F: nil},
+	{Str: "iva", A: -1, B: 8, F: nil},
+	{Str: "eza", A: -1, B: 1, F: nil},
+	{Str: "idade", A: -1, B: 7, F: nil},
+	{Str: "ante", A: -1, B: 1, F: nil},
+	{Str: "mente", A: -1, B: 6, F: nil},
+	{Str: "amente", A: 12, B: 5, F: nil},
+	{Str: "\u00E1vel", A: -1, B: 1, F: nil},
+	{Str: "\u00EDvel", A: -1, B: 1, F: nil},
+	{Str: "ico", A: -1, B: 1, F: nil},
+	{Str: "ismo", A: -1, B: 1, F: nil},
+	{Str: "oso", A: -1, B: 1, F: nil},
+	{Str: "amento", A: -1, B: 1, F: nil},
+	{Str: "imento", A: -1, B: 1, F: nil},
+	{Str: "ivo", A: -1, B: 8, F: nil},
+	{Str: "a\u00E7a~o", A: -1, B: 1, F: nil},
+	{Str: "u\u00E7a~o", A: -1, B: 3, F: nil},
+	{Str: "ador", A: -1, B: 1, F: nil},
+	{Str: "icas", A: -1, B: 1, F: nil},
+	{Str: "\u00EAncias", A: -1, B: 4, F: nil},
+	{Str: "logias", A: -1, B: 2, F: nil},
+	{Str: "iras", A: -1, B: 9, F: nil},
+	{Str: "adoras", A: -1, B: 1, F: nil},
+	{Str: "osas", A: -1, B: 1, F: nil},
+	{Str: "istas", A: -1, B: 1, F: nil},
+	{Str: "ivas", A: -1, B: 8, F: nil},
+	{Str: "ezas", A: -1, B: 1, F: nil},
+	{Str: "idades", A: -1, B: 7, F: nil},
+	{Str: "adores", A: -1, B: 1, F: nil},
+	{Str: "antes", A: -1, B: 1, F: nil},
+	{Str: "a\u00E7o~es", A: -1, B: 1, F: nil},
+	{Str: "u\u00E7o~es", A: -1, B: 3, F: nil},
+	{Str: "icos", A: -1, B: 1, F: nil},
+	{Str: "ismos", A: -1, B: 1, F: nil},
+	{Str: "osos", A: -1, B: 1, F: nil},
+	{Str: "amentos", A: -1, B: 1, F: nil},
+	{Str: "imentos", A: -1, B: 1, F: nil},
+	{Str: "ivos", A: -1, B: 8, F: nil},
+}
+
+var A_6 = []*snowballRuntime.Among{
+	{Str: "ada", A: -1, B: 1, F: nil},
+	{Str: "ida", A: -1, B: 1, F: nil},
+	{Str: "ia", A: -1, B: 1, F: nil},
+	{Str: "aria", A: 2, B: 1, F: nil},
+	{Str: "eria", A: 2, B: 1, F: nil},
+	{Str: "iria", A: 2, B: 1, F: nil},
+	{Str: "ara", A: -1, B: 1, F: nil},
+	{Str: "era", A: -1, B: 1, F: nil},
+	{Str: "ira", A: -1, B: 1, F: nil},
+	{Str: "ava", A: -1, B: 1, F: nil},
+	{Str: "asse", A: -1, B: 1, F: nil},
+	{Str: "esse", A: -1, B: 1, F: nil},
+	{Str: "isse", A: -1, B: 1, F: nil},
+	{Str: "aste", A: -1, B: 1, F: nil},
+	{Str: "este", A: -1, B: 1, F: nil},
+	{Str: "iste", A: -1, B: 1, F: nil},
+	{Str: "ei", A: -1, B: 1, F: nil},
+	{Str: "arei", A: 16, B: 1, F: nil},
+	{Str: "erei", A: 16, B: 1, F: nil},
+	{Str: "irei", A: 16, B: 1, F: nil},
+	{Str: "am", A: -1, B: 1, F: nil},
+	{Str: "iam", A: 20, B: 1, F: nil},
+	{Str: "ariam", A: 21, B: 1, F: nil},
+	{Str: "eriam", A: 21, B: 1, F: nil},
+	{Str: "iriam", A: 21, B: 1, F: nil},
+	{Str: "aram", A: 20, B: 1, F: nil},
+	{Str: "eram", A: 20, B: 1, F: nil},
+	{Str: "iram", A: 20, B: 1, F: nil},
+	{Str: "avam", A: 20, B: 1, F: nil},
+	{Str: "em", A: -1, B: 1, F: nil},
+	{Str: "arem", A: 29, B: 1, F: nil},
+	{Str: "erem", A: 29, B: 1, F: nil},
+	{Str: "irem", A: 29, B: 1, F: nil},
+	{Str: "assem", A: 29, B: 1, F: nil},
+	{Str: "essem", A: 29, B: 1, F: nil},
+	{Str: "issem", A: 29, B: 1, F: nil},
+	{Str: "ado", A: -1, B: 1, F: nil},
+	{Str: "ido", A: -1, B: 1, F: nil},
+	{Str: "ando", A: -1, B: 1, F: nil},
+	{Str: "endo", A: -1, B: 1, F: nil},
+	{Str: "indo", A: -1, B: 1, F: nil},
+	{Str: "ara~o", A: -1, B: 1, F: nil},
+	{Str: "era~o", A: -1, B: 1, F: nil},
+	{Str: "ira~o", A: -1, B: 1, F: nil},
+	{Str: "ar", A: -1, B: 1, F: nil},
+	{Str: "er", A: -1, B: 1, F: nil},
+	{Str: "ir", A: -1, B: 1, F: nil},
+	{Str: "as", A: -1, B: 1, F: nil},
+	{Str: "adas", A: 47, B: 1, F: nil},
+	{Str: "idas", A: 47, B: 1, F: nil},
+	{Str: "ias", A: 47, B: 1, F: nil},
+	{Str: "arias", A: 50, B: 1, F: nil},
+	{Str: "erias", A: 50, B: 1, F: nil},
+	{Str: "irias", A: 50, B: 1, F: nil},
+	{Str: "aras", A: 47, B: 1, F: nil},
+	{Str: "eras", A: 47, B: 1, F: nil},
+	{Str: "iras", A: 47, B: 1, F: nil},
+	{Str: "avas", A: 47, B: 1, F: nil},
+	{Str: "es", A: -1, B: 1, F: nil},
+	{Str: "ardes", A: 58, B: 1, F: nil},
+	{Str: "erdes", A: 58, B: 1, F: nil},
+	{Str: "irdes", A: 58, B: 1, F: nil},
+	{Str: "ares", A: 58, B: 1, F: nil},
+	{Str: "eres", A: 58, B: 1, F: nil},
+	{Str: "ires", A: 58, B: 1, F: nil},
+	{Str: "asses", A: 58, B: 1, F: nil},
+	{Str: "esses", A: 58, B: 1, F: nil},
+	{Str: "isses", A: 58, B: 1, F: nil},
+	{Str: "astes", A: 58, B: 1, F: nil},
+	{Str: "estes", A: 58, B: 1, F: nil},
+	{Str: "istes", A: 58, B: 1, F: nil},
+	{Str: "is", A: -1, B: 1, F: nil},
+	{Str: "ais", A: 71, B: 1, F: nil},
+	{Str: "eis", A: 71, B: 1, F: nil},
+	{Str: "areis", A: 73, B: 1, F: nil},
+	{Str: "ereis", A: 73, B: 1, F: nil},
+	{Str: "ireis", A: 73, B: 1, F: nil},
+	{Str: "\u00E1reis", A: 73, B: 1, F: nil},
+	{Str: "\u00E9reis", A: 73, B: 1, F: nil},
+	{Str: "\u00EDreis", A: 73, B: 1, F: nil},
+	{Str: "\u00E1sseis", A: 73, B: 1, F: nil},
+	{Str: "\u00E9sseis", A: 73, B: 1, F: nil},
+	{Str: "\u00EDsseis", A: 73, B: 1, F: nil},
+	{Str: "\u00E1veis", A: 73, B: 1, F: nil},
+	{Str: "\u00EDeis", A: 73, B: 1, F: nil},
+	{Str: "ar\u00EDeis", A: 84, B: 1, F: nil},
+	{Str: "er\u00EDeis", A: 84, B: 1, F: nil},
+	{Str: "ir\u00EDeis", A: 84, B: 1, F: nil},
+	{Str: "ados", A: -1, B: 1, F: nil},
+	{Str: "idos", A: -1, B: 1, F: nil},
+	{Str: "amos", A: -1, B: 1, F: nil},
+	{Str: "\u00E1ramos", A: 90, B: 1, F: nil},
+	{Str: "\u00E9ramos", A: 90, B: 1, F: nil},
+	{Str: "\u00EDramos", A: 90, B: 1, F: nil},
+	{Str: "\u00E1vamos", A: 90, B: 1, F: nil},
+	{Str: "\u00EDamos", A: 90, B: 1, F: nil},
+	{Str: "ar\u00EDamos", A: 95, B: 1, F: nil},
+	{Str: "er\u00EDamos", A: 95, B: 1, F: nil},
+	{Str: "ir\u00EDamos", A: 95, B: 1, F: nil},
+	{Str: "emos", A: -1, B: 1, F: nil},
+	{Str: "aremos", A: 99, B: 1, F: nil},
+	{Str: "eremos", A: 99, B: 1, F: nil},
+	{Str: "iremos", A: 99, B: 1, F: nil},
+	{Str: "\u00E1ssemos", A: 99, B: 1, F: nil},
+	{Str: "\u00EAssemos", A: 99, B: 1, F: nil},
+	{Str: "\u00EDssemos", A: 99, B: 1, F: nil},
+	{Str: "imos", A: -1, B: 1, F: nil},
+	{Str: "armos", A: -1, B: 1, F: nil},
+	{Str: "ermos", A: -1, B: 1, F: nil},
+	{Str: "irmos", A: -1, B: 1, F: nil},
+	{Str: "\u00E1mos", A: -1, B: 1, F: nil},
+	{Str: "ar\u00E1s", A: -1, B: 1, F: nil},
+	{Str: "er\u00E1s", A: -1, B: 1, F: nil},
+	{Str: "ir\u00E1s", A: -1, B: 1, F: nil},
+	{Str: "eu", A: -1, B: 1, F: nil},
+	{Str: "iu", A: -1, B: 1, F: nil},
+	{Str: "ou", A: -1, B: 1, F: nil},
+	{Str: "ar\u00E1", A: -1, B: 1, F: nil},
+	{Str: "er\u00E1", A: -1, B: 1, F: nil},
+	{Str: "ir\u00E1", A: -1, B: 1, F: nil},
+}
+
+var A_7 = []*snowballRuntime.Among{
+	{Str: "a", A: -1, B: 1, F: nil},
+	{Str: "i", A: -1, B: 1, F: nil},
+	{Str: "o", A: -1, B: 1, F: nil},
+	{Str: "os", A: -1, B: 1, F: nil},
+	{Str: "\u00E1", A: -1, B: 1, F: nil},
+	{Str: "\u00ED", A: -1, B: 1, F: nil},
+	{Str: "\u00F3", A: -1, B: 1, F: nil},
+}
+
+var A_8 = []*snowballRuntime.Among{
+	{Str: "e", A: -1, B: 1, F: nil},
+	{Str: "\u00E7", A: -1, B: 2, F: nil},
+	{Str: "\u00E9", A: -1, B: 1, F: nil},
+	{Str: "\u00EA", A: -1, B: 1, F: nil},
+}
+
+var G_v = []byte{17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 19, 12, 2}
+
+type Context struct {
+	i_p2 int
+	i_p1 int
+	i_pV int
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		i_p2: 0,
+		i_p1: 0,
+		i_pV: 0,
+	}
+	_ = context
+	var among_var int32
+	var v_1 = env.Cursor
+lab0:
+	for {
+	replab1:
+		for {
+			var v_2 = env.Cursor
+		lab2:
+			for range [2]struct{}{} {
+				env.Bra = env.Cursor
+				among_var = env.FindAmong(A_0, context)
+				if among_var == 0 {
+					break lab2
+				}
+				env.Ket = env.Cursor
+				if among_var == 1 {
+					if !env.SliceFrom("a~") {
+						return false
+					}
+				} else if among_var == 2 {
+					if !env.SliceFrom("o~") {
+						return false
+					}
+				} else if among_var == 3 {
+					if env.Cursor >= env.Limit {
+						break lab2
+					}
+					env.NextChar()
+				}
+				continue replab1
+			}
+			env.Cursor = v_2
+			break replab1
+		}
+		break lab0
+	}
+	env.Cursor = v_1
+lab3:
+	for {
+		context.i_pV = env.Limit
+		context.i_p1 = env.Limit
+		context.i_p2 = env.Limit
+		var v_4 = env.Cursor
+	lab4:
+		for {
+		lab5:
+			for {
+				var v_5 = env.Cursor
+			lab6:
+				for {
+					if !env.InGrouping(G_v, 97, 250) {
+						break lab6
+					}
+				lab7:
+					for {
+						var v_6 = env.Cursor
+					lab8:
+						for {
+							if !env.OutGrouping(G_v, 97, 250) {
+								break lab8
+							}
+						golab9:
+							for {
+							lab10:
+								for {
+									if !env.InGrouping(G_v, 97, 250) {
+										break lab10
+									}
+									break golab9
+								}
+								if env.Cursor >= env.Limit {
+									break lab8
+								}
+								env.NextChar()
+							}
+							break lab7
+						}
+						env.Cursor = v_6
+						if !env.InGrouping(G_v, 97, 250) {
+							break lab6
+						}
+					golab11:
+						for {
+						lab12:
+							for {
+								if !env.OutGrouping(G_v, 97, 250) {
+									break lab12
+								}
+								break golab11
+							}
+							if env.Cursor >= env.Limit {
+								break lab6
+							}
+							env.NextChar()
+						}
+						break lab7
+					}
+					break lab5
+				}
+				env.Cursor = v_5
+				if !env.OutGrouping(G_v, 97, 250) {
+					break lab4
+				}
+			lab13:
+				for {
+					var v_9 = env.Cursor
+				lab14:
+					for {
+						if !env.OutGrouping(G_v, 97, 250) {
+							break lab14
+						}
+					golab15:
+						for {
+						lab16:
+							for {
+								if !env.InGrouping(G_v, 97, 250) {
+									break lab16
+								}
+								break golab15
+							}
+							if env.Cursor >= env.Limit {
+								break lab14
+							}
+							env.NextChar()
+						}
+						break lab13
+					}
+					env.Cursor = v_9
+					if !env.InGrouping(G_v, 97, 250) {
+						break lab4
+					}
+					if env.Cursor >= env.Limit {
+						break lab4
+					}
+					env.NextChar()
+					break lab13
+				}
+				break lab5
+			}
+			context.i_pV = env.Cursor
+			break lab4
+		}
+		env.Cursor = v_4
+		var v_11 = env.Cursor
+	lab17:
+		for {
+		golab18:
+			for {
+			lab19:
+				for {
+					if !env.InGrouping(G_v, 97, 250) {
+						break lab19
+					}
+					break golab18
+				}
+				if env.Cursor >= env.Limit {
+					break lab17
+				}
+				env.NextChar()
+			}
+		golab20:
+			for {
+			lab21:
+				for {
+					if !env.OutGrouping(G_v, 97, 250) {
+						break lab21
+					}
+					break golab20
+				}
+				if env.Cursor >= env.Limit {
+					break lab17
+				}
+				env.NextChar()
+			}
+			context.i_p1 = env.Cursor
+		golab22:
+			for {
+			lab23:
+				for {
+					if !env.InGrouping(G_v, 97, 250) {
+						break lab23
+					}
+					break golab22
+				}
+				if env.Cursor >= env.Limit {
+					break lab17
+				}
+				env.NextChar()
+			}
+		golab24:
+			for {
+			lab25:
+				for {
+					if !env.OutGrouping(G_v, 97, 250) {
+						break lab25
+					}
+					break golab24
+				}
+				if env.Cursor >= env.Limit {
+					break lab17
+				}
+				env.NextChar()
+			}
+			context.i_p2 = env.Cursor
+			break lab17
+		}
+		env.Cursor = v_11
+		break lab3
+	}
+	env.LimitBackward = env.Cursor
+	env.Cursor = env.Limit
+	var v_16 = env.Limit - env.Cursor
+lab26:
+	for {
+	lab27:
+		for {
+			var v_17 = env.Limit - env.Cursor
+		lab28:
+			for {
+				var v_18 = env.Limit - env.Cursor
+			lab29:
+				for {
+					var v_19 = env.Limit - env.Cursor
+				lab30:
+					for {
+						env.Ket = env.Cursor
+						among_var = env.FindAmongB(A_5, context)
+						if among_var == 0 {
+							break lab30
+						}
+						env.Bra = env.Cursor
+						if among_var == 1 {
+							if !(context.i_p2 <= env.Cursor) {
+								break lab30
+							}
+							if !env.SliceDel() {
+								return false
+							}
+						} else if among_var == 2 {
+							if !(context.i_p2 <= env.Cursor) {
+								break lab30
+							}
+							if !env.SliceFrom("log") {
+								return false
+							}
+						} else if among_var == 3 {
+							if !(context.i_p2 <= env.Cursor) {
+								break lab30
+							}
+							if !env.SliceFrom("u") {
+								return false
+							}
+						} else if among_var == 4 {
+							if !(context.i_p2 <= env.Cursor) {
+								break lab30
+							}
+							if !env.SliceFrom("ente") {
+								return false
+							}
+						} else if among_var == 5 {
+							if !(context.i_p1 <= env.Cursor) {
+								break lab30
+							}
+							if !env.SliceDel() {
+								return false
+							}
+							var v_20 = env.Limit - env.Cursor
+						lab31:
+							for {
+								env.Ket = env.Cursor
+								among_var = env.FindAmongB(A_2, context)
+								if among_var == 0 {
+									env.Cursor = env.Limit - v_20
+									break lab31
+								}
+								env.Bra = env.Cursor
+								if !(context.i_p2 <= env.Cursor) {
+									env.Cursor = env.Limit - v_20
+									break lab31
+								}
+								if !env.SliceDel() {
+									return false
+								}
+								if among_var == 1 {
+									env.Ket = env.Cursor
+									if !env.EqSB("at") {
+										env.Cursor = env.Limit - v_20
+										break lab31
+									}
+									env.Bra = env.Cursor
+									if !(context.i_p2 <= env.Cursor) {
+										env.Cursor = env.Limit - v_20
+										break lab31
+									}
+									if !env.SliceDel() {
+										return false
+									}
+								}
+								break lab31
+							}
+						} else if among_var == 6 {
+							if !(context.i_p2 <= env.Cursor) {
+								break lab30
+							}
+							if !env.SliceDel() {
+								return false
+							}
+							var v_21 = env.Limit - env.Cursor
+						lab32:
+							for {
+								env.Ket = env.Cursor
+								if env.FindAmongB(A_3, context) == 0 {
+									env.Cursor = env.Limit - v_21
+									break lab32
+								}
+								env.Bra = env.Cursor
+								if !(context.i_p2 <= env.Cursor) {
+									env.Cursor = env.Limit - v_21
+									break lab32
+								}
+								if !env.SliceDel() {
+									return false
+								}
+								break lab32
+							}
+						} else if among_var == 7 {
+							if !(context.i_p2 <= env.Cursor) {
+								break lab30
+							}
+							if !env.SliceDel() {
+								return false
+							}
+							var v_22 = env.Limit - env.Cursor
+						lab33:
+							for {
+								env.Ket = env.Cursor
+								if env.FindAmongB(A_4, context) == 0 {
+									env.Cursor = env.Limit - v_22
+									break lab33
+								}
+								env.Bra = env.Cursor
+								if !(context.i_p2 <= env.Cursor) {
+									env.Cursor = env.Limit - v_22
+									break lab33
+								}
+								if !env.SliceDel() {
+									return false
+								}
+								break lab33
+							}
+						} else if among_var == 8 {
+							if !(context.i_p2 <= env.Cursor) {
+								break lab30
+							}
+							if !env.SliceDel() {
+								return false
+							}
+							var v_23 = env.Limit - env.Cursor
+						lab34:
+							for {
+								env.Ket = env.Cursor
+								if !env.EqSB("at") {
+									env.Cursor = env.Limit - v_23
+									break lab34
+								}
+								env.Bra = env.Cursor
+								if !(context.i_p2 <= env.Cursor) {
+									env.Cursor = env.Limit - v_23
+									break lab34
+								}
+								if !env.SliceDel() {
+									return false
+								}
+								break lab34
+							}
+						} else if among_var == 9 {
+							if !(context.i_pV <= env.Cursor) {
+								break lab30
+							}
+							if !env.EqSB("e") {
+								break lab30
+							}
+							if !env.SliceFrom("ir") {
+								return false
+							}
+						}
+						break lab29
+					}
+					env.Cursor = env.Limit - v_19
+					if env.Cursor < context.i_pV {
+						break lab28
+					}
+					var v_25 = env.LimitBackward
+					env.LimitBackward = context.i_pV
+					env.Ket = env.Cursor
+					if env.FindAmongB(A_6, context) == 0 {
+						env.LimitBackward = v_25
+						break lab28
+					}
+					env.Bra = env.Cursor
+					if !env.SliceDel() {
+						return false
+					}
+					env.LimitBackward = v_25
+					break lab29
+				}
+				env.Cursor = env.Limit - v_18
+				var v_26 = env.Limit - env.Cursor
+			lab35:
+				for {
+					env.Ket = env.Cursor
+					if !env.EqSB("i") {
+						break lab35
+					}
+					env.Bra = env.Cursor
+					var v_27 = env.Limit - env.Cursor
+					if !env.EqSB("c") {
+						break lab35
+					}
+					env.Cursor = env.Limit - v_27
+					if !(context.i_pV <= env.Cursor) {
+						break lab35
+					}
+					if !env.SliceDel() {
+						return false
+					}
+					break lab35
+				}
+				env.Cursor = env.Limit - v_26
+				break lab27
+			}
+			env.Cursor = env.Limit - v_17
+			env.Ket = env.Cursor
+			if env.FindAmongB(A_7, context) == 0 {
+				break lab26
+			}
+			env.Bra = env.Cursor
+			if !(context.i_pV <= env.Cursor) {
+				break lab26
+			}
+			if !env.SliceDel() {
+				return false
+			}
+			break lab27
+		}
+		break lab26
+	}
+	env.Cursor = env.Limit - v_16
+	var v_28 = env.Limit - env.Cursor
+lab36:
+	for {
+		env.Ket = env.Cursor
+		among_var = env.FindAmongB(A_8, context)
+		if among_var == 0 {
+			break lab36
+		}
+		env.Bra = env.Cursor
+		if among_var == 1 {
+			if !(context.i_pV <= env.Cursor) {
+				break lab36
+			}
+			if !env.SliceDel() {
+				return false
+			}
+			env.Ket = env.Cursor
+		lab37:
+			for {
+				var v_29 = env.Limit - env.Cursor
+			lab38:
+				for {
+					if !env.EqSB("u") {
+						break lab38
+					}
+					env.Bra = env.Cursor
+					var v_30 = env.Limit - env.Cursor
+					if !env.EqSB("g") {
+						break lab38
+					}
+					env.Cursor = env.Limit - v_30
+					break lab37
+				}
+				env.Cursor = env.Limit - v_29
+				if !env.EqSB("i") {
+					break lab36
+				}
+				env.Bra = env.Cursor
+				var v_31 = env.Limit - env.Cursor
+				if !env.EqSB("c") {
+					break lab36
+				}
+				env.Cursor = env.Limit - v_31
+				break lab37
+			}
+			if !(context.i_pV <= env.Cursor) {
+				break lab36
+			}
+			if !env.SliceDel() {
+				return false
+			}
+		} else if among_var == 2 {
+			if !env.SliceFrom("c") {
+				return false
+			}
+		}
+		break lab36
+	}
+	env.Cursor = env.Limit - v_28
+	env.Cursor = env.LimitBackward
+	var v_32 = env.Cursor
+lab39:
+	for {
+	replab40:
+		for {
+			var v_33 = env.Cursor
+		lab41:
+			for range [2]struct{}{} {
+				env.Bra = env.Cursor
+				among_var = env.FindAmong(A_1, context)
+				if among_var == 0 {
+					break lab41
+				}
+				env.Ket = env.Cursor
+				if among_var == 1 {
+					if !env.SliceFrom("\u00E3") {
+						return false
+					}
+				} else if among_var == 2 {
+					if !env.SliceFrom("\u00F5") {
+						return false
+					}
+				} else if among_var == 3 {
+					if env.Cursor >= env.Limit {
+						break lab41
+					}
+					env.NextChar()
+				}
+				continue replab40
+			}
+			env.Cursor = v_33
+			break replab40
+		}
+		break lab39
+	}
+	env.Cursor = v_32
+	return true
+}
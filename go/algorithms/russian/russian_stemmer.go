@@ -0,0 +1,529 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package russian
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "\u0432\u0448\u0438\u0441\u044C", A: -1, B: 1, F: nil},
+	{Str: "\u044B\u0432\u0448\u0438\u0441\u044C", A: 0, B: 2, F: nil},
+	{Str: "\u0438\u0432\u0448\u0438\u0441\u044C", A: 0, B: 2, F: nil},
+	{Str: "\u0432", A: -1, B: 1, F: nil},
+	{Str: "\u044B\u0432", A: 3, B: 2, F: nil},
+	{Str: "\u0438\u0432", A: 3, B: 2, F: nil},
+	{Str: "\u0432\u0448\u0438", A: -1, B: 1, F: nil},
+	{Str: "\u044B\u0432\u0448\u0438", A: 6, B: 2, F: nil},
+	{Str: "\u0438\u0432\u0448\u0438", A: 6, B: 2, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "\u0435\u043C\u0443", A: -1, B: 1, F: nil},
+	{Str: "\u043E\u043C\u0443", A: -1, B: 1, F: nil},
+	{Str: "\u044B\u0445", A: -1, B: 1, F: nil},
+	{Str: "\u0438\u0445", A: -1, B: 1, F: nil},
+	{Str: "\u0443\u044E", A: -1, B: 1, F: nil},
+	{Str: "\u044E\u044E", A: -1, B: 1, F: nil},
+	{Str: "\u0435\u044E", A: -1, B: 1, F: nil},
+	{Str: "\u043E\u044E", A: -1, B: 1, F: nil},
+	{Str: "\u044F\u044F", A: -1, B: 1, F: nil},
+	{Str: "\u0430\u044F", A: -1, B: 1, F: nil},
+	{Str: "\u044B\u0435", A: -1, B: 1, F: nil},
+	{Str: "\u0435\u0435", A: -1, B: 1, F: nil},
+	{Str: "\u0438\u0435", A: -1, B: 1, F: nil},
+	{Str: "\u043E\u0435", A: -1, B: 1, F: nil},
+	{Str: "\u044B\u043C\u0438", A: -1, B: 1, F: nil},
+	{Str: "\u0438\u043C\u0438", A: -1, B: 1, F: nil},
+	{Str: "\u044B\u0439", A: -1, B: 1, F: nil},
+	{Str: "\u0435\u0439", A: -1, B: 1, F: nil},
+	{Str: "\u0438\u0439", A: -1, B: 1, F: nil},
+	{Str: "\u043E\u0439", A: -1, B: 1, F: nil},
+	{Str: "\u044B\u043C", A: -1, B: 1, F: nil},
+	{Str: "\u0435\u043C", A: -1, B: 1, F: nil},
+	{Str: "\u0438\u043C", A: -1, B: 1, F: nil},
+	{Str: "\u043E\u043C", A: -1, B: 1, F: nil},
+	{Str: "\u0435\u0433\u043E", A: -1, B: 1, F: nil},
+	{Str: "\u043E\u0433\u043E", A: -1, B: 1, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "\u0432\u0448", A: -1, B: 1, F: nil},
+	{Str: "\u044B\u0432\u0448", A: 0, B: 2, F: nil},
+	{Str: "\u0438\u0432\u0448", A: 0, B: 2, F: nil},
+	{Str: "\u0449", A: -1, B: 1, F: nil},
+	{Str: "\u044E\u0449", A: 3, B: 1, F: nil},
+	{Str: "\u0443\u044E\u0449", A: 4, B: 2, F: nil},
+	{Str: "\u0435\u043C", A: -1, B: 1, F: nil},
+	{Str: "\u043D\u043D", A: -1, B: 1, F: nil},
+}
+
+var A_3 = []*snowballRuntime.Among{
+	{Str: "\u0441\u044C", A: -1, B: 1, F: nil},
+	{Str: "\u0441\u044F", A: -1, B: 1, F: nil},
+}
+
+var A_4 = []*snowballRuntime.Among{
+	{Str: "\u044B\u0442", A: -1, B: 2, F: nil},
+	{Str: "\u044E\u0442", A: -1, B: 1, F: nil},
+	{Str: "\u0443\u044E\u0442", A: 1, B: 2, F: nil},
+	{Str: "\u044F\u0442", A: -1, B: 2, F: nil},
+	{Str: "\u0435\u0442", A: -1, B: 1, F: nil},
+	{Str: "\u0443\u0435\u0442", A: 4, B: 2, F: nil},
+	{Str: "\u0438\u0442", A: -1, B: 2, F: nil},
+	{Str: "\u043D\u044B", A: -1, B: 1, F: nil},
+	{Str: "\u0435\u043D\u044B", A: 7, B: 2, F: nil},
+	{Str: "\u0442\u044C", A: -1, B: 1, F: nil},
+	{Str: "\u044B\u0442\u044C", A: 9, B: 2, F: nil},
+	{Str: "\u0438\u0442\u044C", A: 9, B: 2, F: nil},
+	{Str: "\u0435\u0448\u044C", A: -1, B: 1, F: nil},
+	{Str: "\u0438\u0448\u044C", A: -1, B: 2, F: nil},
+	{Str: "\u044E", A: -1, B: 2, F: nil},
+	{Str: "\u0443\u044E", A: 14, B: 2, F: nil},
+	{Str: "\u043B\u0430", A: -1, B: 1, F: nil},
+	{Str: "\u044B\u043B\u0430", A: 16, B: 2, F: nil},
+	{Str: "\u0438\u043B\u0430", A: 16, B: 2, F: nil},
+	{Str: "\u043D\u0430", A: -1, B: 1, F: nil},
+	{Str: "\u0435\u043D\u0430", A: 19, B: 2, F: nil},
+	{Str: "\u0435\u0442\u0435", A: -1, B: 1, F: nil},
+	{Str: "\u0438\u0442\u0435", A: -1, B: 2, F: nil},
+	{Str: "\u0439\u0442\u0435", A: -1, B: 1, F: nil},
+	{Str: "\u0443\u0439\u0442\u0435", A: 23, B: 2, F: nil},
+	{Str: "\u0435\u0439\u0442\u0435", A: 23, B: 2, F: nil},
+	{Str: "\u043B\u0438", A: -1, B: 1, F: nil},
+	{Str: "\u044B\u043B\u0438", A: 26, B: 2, F: nil},
+	{Str: "\u0438\u043B\u0438", A: 26, B: 2, F: nil},
+	{Str: "\u0439", A: -1, B: 1, F: nil},
+	{Str: "\u0443\u0439", A: 29, B: 2, F: nil},
+	{Str: "\u0435\u0439", A: 29, B: 2, F: nil},
+	{Str: "\u043B", A: -1, B: 1, F: nil},
+	{Str: "\u044B\u043B", A: 32, B: 2, F: nil},
+	{Str: "\u0438\u043B", A: 32, B: 2, F: nil},
+	{Str: "\u044B\u043C", A: -1, B: 2, F: nil},
+	{Str: "\u0435\u043C", A: -1, B: 1, F: nil},
+	{Str: "\u0438\u043C", A: -1, B: 2, F: nil},
+	{Str: "\u043D", A: -1, B: 1, F: nil},
+	{Str: "\u0435\u043D", A: 38, B: 2, F: nil},
+	{Str: "\u043B\u043E", A: -1, B: 1, F: nil},
+	{Str: "\u044B\u043B\u043E", A: 40, B: 2, F: nil},
+	{Str: "\u0438\u043B\u043E", A: 40, B: 2, F: nil},
+	{Str: "\u043D\u043E", A: -1, B: 1, F: nil},
+	{Str: "\u0435\u043D\u043E", A: 43, B: 2, F: nil},
+	{Str: "\u043D\u043D\u043E", A: 43, B: 1, F: nil},
+}
+
+var A_5 = []*snowballRuntime.Among{
+	{Str: "\u0443", A: -1, B: 1, F: nil},
+	{Str: "\u044F\u0445", A: -1, B: 1, F: nil},
+	{Str: "\u0438\u044F\u0445", A: 1, B: 1, F: nil},
+	{Str: "\u0430\u0445", A: -1, B: 1, F: nil},
+	{Str: "\u044B", A: -1, B: 1, F: nil},
+	{Str: "\u044C", A: -1, B: 1, F: nil},
+	{Str: "\u044E", A: -1, B: 1, F: nil},
+	{Str: "\u044C\u044E", A: 6, B: 1, F: nil},
+	{Str: "\u0438\u044E", A: 6, B: 1, F: nil},
+	{Str: "\u044F", A: -1, B: 1, F: nil},
+	{Str: "\u044C\u044F", A: 9, B: 1, F: nil},
+	{Str: "\u0438\u044F", A: 9, B: 1, F: nil},
+	{Str: "\u0430", A: -1, B: 1, F: nil},
+	{Str: "\u0435\u0432", A: -1, B: 1, F: nil},
+	{Str: "\u043E\u0432", A: -1, B: 1, F: nil},
+	{Str: "\u0435", A: -1, B: 1, F: nil},
+	{Str: "\u044C\u0435", A: 15, B: 1, F: nil},
+	{Str: "\u0438\u0435", A: 15, B: 1, F: nil},
+	{Str: "\u0438", A: -1, B: 1, F: nil},
+	{Str: "\u0435\u0438", A: 18, B: 1, F: nil},
+	{Str: "\u0438\u0438", A: 18, B: 1, F: nil},
+	{Str: "\u044F\u043C\u0438", A: 18, B: 1, F: nil},
+	{Str: "\u0438\u044F\u043C\u0438", A: 21, B: 1, F: nil},
+	{Str: "\u0430\u043C\u0438", A: 18, B: 1, F: nil},
+	{Str: "\u0439", A: -1, B: 1, F: nil},
+	{Str: "\u0435\u0439", A: 24, B: 1, F: nil},
+	{Str: "\u0438\u0435\u0439", A: 25, B: 1, F: nil},
+	{Str: "\u0438\u0439", A: 24, B: 1, F: nil},
+	{Str: "\u043E\u0439", A: 24, B: 1, F: nil},
+	{Str: "\u044F\u043C", A: -1, B: 1, F: nil},
+	{Str: "\u0438\u044F\u043C", A: 29, B: 1, F: nil},
+	{Str: "\u0430\u043C", A: -1, B: 1, F: nil},
+	{Str: "\u0435\u043C", A: -1, B: 1, F: nil},
+	{Str: "\u0438\u0435\u043C", A: 32, B: 1, F: nil},
+	{Str: "\u043E\u043C", A: -1, B: 1, F: nil},
+	{Str: "\u043E", A: -1, B: 1, F: nil},
+}
+
+var A_6 = []*snowballRuntime.Among{
+	{Str: "\u043E\u0441\u0442", A: -1, B: 1, F: nil},
+	{Str: "\u043E\u0441\u0442\u044C", A: -1, B: 1, F: nil},
+}
+
+var A_7 = []*snowballRuntime.Among{
+	{Str: "\u0435\u0439\u0448", A: -1, B: 1, F: nil},
+	{Str: "\u044C", A: -1, B: 3, F: nil},
+	{Str: "\u0435\u0439\u0448\u0435", A: -1, B: 1, F: nil},
+	{Str: "\u043D", A: -1, B: 2, F: nil},
+}
+
+var G_v = []byte{33, 65, 8, 232}
+
+type Context struct {
+	i_p2 int
+	i_pV int
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		i_p2: 0,
+		i_pV: 0,
+	}
+	_ = context
+	var among_var int32
+	var v_1 = env.Cursor
+lab0:
+	for {
+	replab1:
+		for {
+			var v_2 = env.Cursor
+		lab2:
+			for range [2]struct{}{} {
+			golab3:
+				for {
+					var v_3 = env.Cursor
+				lab4:
+					for {
+						env.Bra = env.Cursor
+						if !env.EqS("\u0451") {
+							break lab4
+						}
+						env.Ket = env.Cursor
+						env.Cursor = v_3
+						break golab3
+					}
+					env.Cursor = v_3
+					if env.Cursor >= env.Limit {
+						break lab2
+					}
+					env.NextChar()
+				}
+				if !env.SliceFrom("\u0435") {
+					return false
+				}
+				continue replab1
+			}
+			env.Cursor = v_2
+			break replab1
+		}
+		break lab0
+	}
+	env.Cursor = v_1
+lab5:
+	for {
+		context.i_pV = env.Limit
+		context.i_p2 = env.Limit
+		var v_5 = env.Cursor
+	lab6:
+		for {
+		golab7:
+			for {
+			lab8:
+				for {
+					if !env.InGrouping(G_v, 1072, 1103) {
+						break lab8
+					}
+					break golab7
+				}
+				if env.Cursor >= env.Limit {
+					break lab6
+				}
+				env.NextChar()
+			}
+			context.i_pV = env.Cursor
+		golab9:
+			for {
+			lab10:
+				for {
+					if !env.OutGrouping(G_v, 1072, 1103) {
+						break lab10
+					}
+					break golab9
+				}
+				if env.Cursor >= env.Limit {
+					break lab6
+				}
+				env.NextChar()
+			}
+		golab11:
+			for {
+			lab12:
+				for {
+					if !env.InGrouping(G_v, 1072, 1103) {
+						break lab12
+					}
+					break golab11
+				}
+				if env.Cursor >= env.Limit {
+					break lab6
+				}
+				env.NextChar()
+			}
+		golab13:
+			for {
+			lab14:
+				for {
+					if !env.OutGrouping(G_v, 1072, 1103) {
+						break lab14
+					}
+					break golab13
+				}
+				if env.Cursor >= env.Limit {
+					break lab6
+				}
+				env.NextChar()
+			}
+			context.i_p2 = env.Cursor
+			break lab6
+		}
+		env.Cursor = v_5
+		break lab5
+	}
+	env.LimitBackward = env.Cursor
+	env.Cursor = env.Limit
+	if env.Cursor < context.i_pV {
+		return false
+	}
+	var v_11 = env.LimitBackward
+	env.LimitBackward = context.i_pV
+	var v_12 = env.Limit - env.Cursor
+lab15:
+	for {
+	lab16:
+		for {
+			var v_13 = env.Limit - env.Cursor
+		lab17:
+			for {
+				env.Ket = env.Cursor
+				among_var = env.FindAmongB(A_0, context)
+				if among_var == 0 {
+					break lab17
+				}
+				env.Bra = env.Cursor
+				if among_var == 1 {
+				lab18:
+					for {
+						var v_14 = env.Limit - env.Cursor
+					lab19:
+						for {
+							if !env.EqSB("\u0430") {
+								break lab19
+							}
+							break lab18
+						}
+						env.Cursor = env.Limit - v_14
+						if !env.EqSB("\u044F") {
+							break lab17
+						}
+						break lab18
+					}
+					if !env.SliceDel() {
+						return false
+					}
+				} else if among_var == 2 {
+					if !env.SliceDel() {
+						return false
+					}
+				}
+				break lab16
+			}
+			env.Cursor = env.Limit - v_13
+			var v_15 = env.Limit - env.Cursor
+		lab20:
+			for {
+				env.Ket = env.Cursor
+				if env.FindAmongB(A_3, context) == 0 {
+					env.Cursor = env.Limit - v_15
+					break lab20
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				break lab20
+			}
+		lab21:
+			for {
+				var v_16 = env.Limit - env.Cursor
+			lab22:
+				for {
+					env.Ket = env.Cursor
+					if env.FindAmongB(A_1, context) == 0 {
+						break lab22
+					}
+					env.Bra = env.Cursor
+					if !env.SliceDel() {
+						return false
+					}
+					var v_17 = env.Limit - env.Cursor
+				lab23:
+					for {
+						env.Ket = env.Cursor
+						among_var = env.FindAmongB(A_2, context)
+						if among_var == 0 {
+							env.Cursor = env.Limit - v_17
+							break lab23
+						}
+						env.Bra = env.Cursor
+						if among_var == 1 {
+						lab24:
+							for {
+								var v_18 = env.Limit - env.Cursor
+							lab25:
+								for {
+									if !env.EqSB("\u0430") {
+										break lab25
+									}
+									break lab24
+								}
+								env.Cursor = env.Limit - v_18
+								if !env.EqSB("\u044F") {
+									env.Cursor = env.Limit - v_17
+									break lab23
+								}
+								break lab24
+							}
+							if !env.SliceDel() {
+								return false
+							}
+						} else if among_var == 2 {
+							if !env.SliceDel() {
+								return false
+							}
+						}
+						break lab23
+					}
+					break lab21
+				}
+				env.Cursor = env.Limit - v_16
+			lab26:
+				for {
+					env.Ket = env.Cursor
+					among_var = env.FindAmongB(A_4, context)
+					if among_var == 0 {
+						break lab26
+					}
+					env.Bra = env.Cursor
+					if among_var == 1 {
+					lab27:
+						for {
+							var v_19 = env.Limit - env.Cursor
+						lab28:
+							for {
+								if !env.EqSB("\u0430") {
+									break lab28
+								}
+								break lab27
+							}
+							env.Cursor = env.Limit - v_19
+							if !env.EqSB("\u044F") {
+								break lab26
+							}
+							break lab27
+						}
+						if !env.SliceDel() {
+							return false
+						}
+					} else if among_var == 2 {
+						if !env.SliceDel() {
+							return false
+						}
+					}
+					break lab21
+				}
+				env.Cursor = env.Limit - v_16
+				env.Ket = env.Cursor
+				if env.FindAmongB(A_5, context) == 0 {
+					break lab15
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				break lab21
+			}
+			break lab16
+		}
+		break lab15
+	}
+	env.Cursor = env.Limit - v_12
+	var v_20 = env.Limit - env.Cursor
+lab29:
+	for {
+		env.Ket = env.Cursor
+		if !env.EqSB("\u0438") {
+			env.Cursor = env.Limit - v_20
+			break lab29
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		break lab29
+	}
+	var v_21 = env.Limit - env.Cursor
+lab30:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_6, context) == 0 {
+			break lab30
+		}
+		env.Bra = env.Cursor
+		if !(context.i_p2 <= env.Cursor) {
+			break lab30
+		}
+		if !env.SliceDel() {
+			return false
+		}
+		break lab30
+	}
+	env.Cursor = env.Limit - v_21
+	var v_22 = env.Limit - env.Cursor
+lab31:
+	for {
+		env.Ket = env.Cursor
+		among_var = env.FindAmongB(A_7, context)
+		if among_var == 0 {
+			break lab31
+		}
+		env.Bra = env.Cursor
+		if among_var == 1 {
+			if !env.SliceDel() {
+				return false
+			}
+			env.Ket = env.Cursor
+			if !env.EqSB("\u043D") {
+				break lab31
+			}
+			env.Bra = env.Cursor
+			if !env.EqSB("\u043D") {
+				break lab31
+			}
+			if !env.SliceDel() {
+				return false
+			}
+		} else if among_var == 2 {
+			if !env.EqSB("\u043D") {
+				break lab31
+			}
+			if !env.SliceDel() {
+				return false
+			}
+		} else if among_var == 3 {
+			if !env.SliceDel() {
+				return false
+			}
+		}
+		break lab31
+	}
+	env.Cursor = env.Limit - v_22
+	env.LimitBackward = v_11
+	env.Cursor = env.LimitBackward
+	return true
+}
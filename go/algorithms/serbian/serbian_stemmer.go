@@ -0,0 +1,3900 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package serbian
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "\u0430", A: -1, B: 1, F: nil},
+	{Str: "\u0431", A: -1, B: 2, F: nil},
+	{Str: "\u0432", A: -1, B: 3, F: nil},
+	{Str: "\u0433", A: -1, B: 4, F: nil},
+	{Str: "\u0434", A: -1, B: 5, F: nil},
+	{Str: "\u0435", A: -1, B: 7, F: nil},
+	{Str: "\u0436", A: -1, B: 8, F: nil},
+	{Str: "\u0437", A: -1, B: 9, F: nil},
+	{Str: "\u0438", A: -1, B: 10, F: nil},
+	{Str: "\u043A", A: -1, B: 12, F: nil},
+	{Str: "\u043B", A: -1, B: 13, F: nil},
+	{Str: "\u043C", A: -1, B: 15, F: nil},
+	{Str: "\u043D", A: -1, B: 16, F: nil},
+	{Str: "\u043E", A: -1, B: 18, F: nil},
+	{Str: "\u043F", A: -1, B: 19, F: nil},
+	{Str: "\u0440", A: -1, B: 20, F: nil},
+	{Str: "\u0441", A: -1, B: 21, F: nil},
+	{Str: "\u0442", A: -1, B: 22, F: nil},
+	{Str: "\u0443", A: -1, B: 24, F: nil},
+	{Str: "\u0444", A: -1, B: 25, F: nil},
+	{Str: "\u0445", A: -1, B: 26, F: nil},
+	{Str: "\u0446", A: -1, B: 27, F: nil},
+	{Str: "\u0447", A: -1, B: 28, F: nil},
+	{Str: "\u0448", A: -1, B: 30, F: nil},
+	{Str: "\u0452", A: -1, B: 6, F: nil},
+	{Str: "\u0458", A: -1, B: 11, F: nil},
+	{Str: "\u0459", A: -1, B: 14, F: nil},
+	{Str: "\u045A", A: -1, B: 17, F: nil},
+	{Str: "\u045B", A: -1, B: 23, F: nil},
+	{Str: "\u045F", A: -1, B: 29, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "daba", A: -1, B: 73, F: nil},
+	{Str: "ajaca", A: -1, B: 12, F: nil},
+	{Str: "ejaca", A: -1, B: 14, F: nil},
+	{Str: "ljaca", A: -1, B: 13, F: nil},
+	{Str: "njaca", A: -1, B: 85, F: nil},
+	{Str: "ojaca", A: -1, B: 15, F: nil},
+	{Str: "alaca", A: -1, B: 82, F: nil},
+	{Str: "elaca", A: -1, B: 83, F: nil},
+	{Str: "olaca", A: -1, B: 84, F: nil},
+	{Str: "maca", A: -1, B: 75, F: nil},
+	{Str: "naca", A: -1, B: 76, F: nil},
+	{Str: "raca", A: -1, B: 81, F: nil},
+	{Str: "saca", A: -1, B: 80, F: nil},
+	{Str: "vaca", A: -1, B: 79, F: nil},
+	{Str: "\u0161aca", A: -1, B: 18, F: nil},
+	{Str: "aoca", A: -1, B: 82, F: nil},
+	{Str: "acaka", A: -1, B: 55, F: nil},
+	{Str: "ajaka", A: -1, B: 16, F: nil},
+	{Str: "ojaka", A: -1, B: 17, F: nil},
+	{Str: "anaka", A: -1, B: 78, F: nil},
+	{Str: "ataka", A: -1, B: 58, F: nil},
+	{Str: "etaka", A: -1, B: 59, F: nil},
+	{Str: "itaka", A: -1, B: 60, F: nil},
+	{Str: "otaka", A: -1, B: 61, F: nil},
+	{Str: "utaka", A: -1, B: 62, F: nil},
+	{Str: "a\u010Daka", A: -1, B: 54, F: nil},
+	{Str: "esama", A: -1, B: 67, F: nil},
+	{Str: "izama", A: -1, B: 87, F: nil},
+	{Str: "jacima", A: -1, B: 5, F: nil},
+	{Str: "nicima", A: -1, B: 23, F: nil},
+	{Str: "ticima", A: -1, B: 24, F: nil},
+	{Str: "teticima", A: 30, B: 21, F: nil},
+	{Str: "zicima", A: -1, B: 25, F: nil},
+	{Str: "atcima", A: -1, B: 58, F: nil},
+	{Str: "utcima", A: -1, B: 62, F: nil},
+	{Str: "\u010Dcima", A: -1, B: 74, F: nil},
+	{Str: "pesima", A: -1, B: 2, F: nil},
+	{Str: "inzima", A: -1, B: 19, F: nil},
+	{Str: "lozima", A: -1, B: 1, F: nil},
+	{Str: "metara", A: -1, B: 68, F: nil},
+	{Str: "centara", A: -1, B: 69, F: nil},
+	{Str: "istara", A: -1, B: 70, F: nil},
+	{Str: "ekata", A: -1, B: 86, F: nil},
+	{Str: "anata", A: -1, B: 53, F: nil},
+	{Str: "nstava", A: -1, B: 22, F: nil},
+	{Str: "kustava", A: -1, B: 29, F: nil},
+	{Str: "ajac", A: -1, B: 12, F: nil},
+	{Str: "ejac", A: -1, B: 14, F: nil},
+	{Str: "ljac", A: -1, B: 13, F: nil},
+	{Str: "njac", A: -1, B: 85, F: nil},
+	{Str: "anjac", A: 49, B: 11, F: nil},
+	{Str: "ojac", A: -1, B: 15, F: nil},
+	{Str: "alac", A: -1, B: 82, F: nil},
+	{Str: "elac", A: -1, B: 83, F: nil},
+	{Str: "olac", A: -1, B: 84, F: nil},
+	{Str: "mac", A: -1, B: 75, F: nil},
+	{Str: "nac", A: -1, B: 76, F: nil},
+	{Str: "rac", A: -1, B: 81, F: nil},
+	{Str: "sac", A: -1, B: 80, F: nil},
+	{Str: "vac", A: -1, B: 79, F: nil},
+	{Str: "\u0161ac", A: -1, B: 18, F: nil},
+	{Str: "jebe", A: -1, B: 88, F: nil},
+	{Str: "olce", A: -1, B: 84, F: nil},
+	{Str: "kuse", A: -1, B: 27, F: nil},
+	{Str: "rave", A: -1, B: 42, F: nil},
+	{Str: "save", A: -1, B: 52, F: nil},
+	{Str: "\u0161ave", A: -1, B: 51, F: nil},
+	{Str: "baci", A: -1, B: 89, F: nil},
+	{Str: "jaci", A: -1, B: 5, F: nil},
+	{Str: "tvenici", A: -1, B: 20, F: nil},
+	{Str: "snici", A: -1, B: 26, F: nil},
+	{Str: "tetici", A: -1, B: 21, F: nil},
+	{Str: "bojci", A: -1, B: 4, F: nil},
+	{Str: "vojci", A: -1, B: 3, F: nil},
+	{Str: "ojsci", A: -1, B: 66, F: nil},
+	{Str: "atci", A: -1, B: 58, F: nil},
+	{Str: "itci", A: -1, B: 60, F: nil},
+	{Str: "utci", A: -1, B: 62, F: nil},
+	{Str: "\u010Dci", A: -1, B: 74, F: nil},
+	{Str: "pesi", A: -1, B: 2, F: nil},
+	{Str: "inzi", A: -1, B: 19, F: nil},
+	{Str: "lozi", A: -1, B: 1, F: nil},
+	{Str: "acak", A: -1, B: 55, F: nil},
+	{Str: "usak", A: -1, B: 57, F: nil},
+	{Str: "atak", A: -1, B: 58, F: nil},
+	{Str: "etak", A: -1, B: 59, F: nil},
+	{Str: "itak", A: -1, B: 60, F: nil},
+	{Str: "otak", A: -1, B: 61, F: nil},
+	{Str: "utak", A: -1, B: 62, F: nil},
+	{Str: "a\u010Dak", A: -1, B: 54, F: nil},
+	{Str: "u\u0161ak", A: -1, B: 56, F: nil},
+	{Str: "izam", A: -1, B: 87, F: nil},
+	{Str: "tican", A: -1, B: 65, F: nil},
+	{Str: "cajan", A: -1, B: 7, F: nil},
+	{Str: "\u010Dajan", A: -1, B: 6, F: nil},
+	{Str: "voljan", A: -1, B: 77, F: nil},
+	{Str: "eskan", A: -1, B: 63, F: nil},
+	{Str: "alan", A: -1, B: 40, F: nil},
+	{Str: "bilan", A: -1, B: 33, F: nil},
+	{Str: "gilan", A: -1, B: 37, F: nil},
+	{Str: "nilan", A: -1, B: 39, F: nil},
+	{Str: "rilan", A: -1, B: 38, F: nil},
+	{Str: "silan", A: -1, B: 36, F: nil},
+	{Str: "tilan", A: -1, B: 34, F: nil},
+	{Str: "avilan", A: -1, B: 35, F: nil},
+	{Str: "laran", A: -1, B: 9, F: nil},
+	{Str: "eran", A: -1, B: 8, F: nil},
+	{Str: "asan", A: -1, B: 91, F: nil},
+	{Str: "esan", A: -1, B: 10, F: nil},
+	{Str: "dusan", A: -1, B: 31, F: nil},
+	{Str: "kusan", A: -1, B: 28, F: nil},
+	{Str: "atan", A: -1, B: 47, F: nil},
+	{Str: "pletan", A: -1, B: 50, F: nil},
+	{Str: "tetan", A: -1, B: 49, F: nil},
+	{Str: "antan", A: -1, B: 32, F: nil},
+	{Str: "pravan", A: -1, B: 44, F: nil},
+	{Str: "stavan", A: -1, B: 43, F: nil},
+	{Str: "sivan", A: -1, B: 46, F: nil},
+	{Str: "tivan", A: -1, B: 45, F: nil},
+	{Str: "ozan", A: -1, B: 41, F: nil},
+	{Str: "ti\u010Dan", A: -1, B: 64, F: nil},
+	{Str: "a\u0161an", A: -1, B: 90, F: nil},
+	{Str: "du\u0161an", A: -1, B: 30, F: nil},
+	{Str: "metar", A: -1, B: 68, F: nil},
+	{Str: "centar", A: -1, B: 69, F: nil},
+	{Str: "istar", A: -1, B: 70, F: nil},
+	{Str: "ekat", A: -1, B: 86, F: nil},
+	{Str: "enat", A: -1, B: 48, F: nil},
+	{Str: "oscu", A: -1, B: 72, F: nil},
+	{Str: "o\u0161\u0107u", A: -1, B: 71, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "aca", A: -1, B: 124, F: nil},
+	{Str: "eca", A: -1, B: 125, F: nil},
+	{Str: "uca", A: -1, B: 126, F: nil},
+	{Str: "ga", A: -1, B: 20, F: nil},
+	{Str: "acega", A: 3, B: 124, F: nil},
+	{Str: "ecega", A: 3, B: 125, F: nil},
+	{Str: "ucega", A: 3, B: 126, F: nil},
+	{Str: "anjijega", A: 3, B: 84, F: nil},
+	{Str: "enjijega", A: 3, B: 85, F: nil},
+	{Str: "snjijega", A: 3, B: 122, F: nil},
+	{Str: "\u0161njijega", A: 3, B: 86, F: nil},
+	{Str: "kijega", A: 3, B: 95, F: nil},
+	{Str: "skijega", A: 11, B: 1, F: nil},
+	{Str: "\u0161kijega", A: 11, B: 2, F: nil},
+	{Str: "elijega", A: 3, B: 83, F: nil},
+	{Str: "nijega", A: 3, B: 13, F: nil},
+	{Str: "osijega", A: 3, B: 123, F: nil},
+	{Str: "atijega", A: 3, B: 120, F: nil},
+	{Str: "evitijega", A: 3, B: 92, F: nil},
+	{Str: "ovitijega", A: 3, B: 93, F: nil},
+	{Str: "astijega", A: 3, B: 94, F: nil},
+	{Str: "avijega", A: 3, B: 77, F: nil},
+	{Str: "evijega", A: 3, B: 78, F: nil},
+	{Str: "ivijega", A: 3, B: 79, F: nil},
+	{Str: "ovijega", A: 3, B: 80, F: nil},
+	{Str: "o\u0161ijega", A: 3, B: 91, F: nil},
+	{Str: "anjega", A: 3, B: 84, F: nil},
+	{Str: "enjega", A: 3, B: 85, F: nil},
+	{Str: "snjega", A: 3, B: 122, F: nil},
+	{Str: "\u0161njega", A: 3, B: 86, F: nil},
+	{Str: "kega", A: 3, B: 95, F: nil},
+	{Str: "skega", A: 30, B: 1, F: nil},
+	{Str: "\u0161kega", A: 30, B: 2, F: nil},
+	{Str: "elega", A: 3, B: 83, F: nil},
+	{Str: "nega", A: 3, B: 13, F: nil},
+	{Str: "anega", A: 34, B: 10, F: nil},
+	{Str: "enega", A: 34, B: 87, F: nil},
+	{Str: "snega", A: 34, B: 159, F: nil},
+	{Str: "\u0161nega", A: 34, B: 88, F: nil},
+	{Str: "osega", A: 3, B: 123, F: nil},
+	{Str: "atega", A: 3, B: 120, F: nil},
+	{Str: "evitega", A: 3, B: 92, F: nil},
+	{Str: "ovitega", A: 3, B: 93, F: nil},
+	{Str: "astega", A: 3, B: 94, F: nil},
+	{Str: "avega", A: 3, B: 77, F: nil},
+	{Str: "evega", A: 3, B: 78, F: nil},
+	{Str: "ivega", A: 3, B: 79, F: nil},
+	{Str: "ovega", A: 3, B: 80, F: nil},
+	{Str: "a\u0107ega", A: 3, B: 14, F: nil},
+	{Str: "e\u0107ega", A: 3, B: 15, F: nil},
+	{Str: "u\u0107ega", A: 3, B: 16, F: nil},
+	{Str: "o\u0161ega", A: 3, B: 91, F: nil},
+	{Str: "acoga", A: 3, B: 124, F: nil},
+	{Str: "ecoga", A: 3, B: 125, F: nil},
+	{Str: "ucoga", A: 3, B: 126, F: nil},
+	{Str: "anjoga", A: 3, B: 84, F: nil},
+	{Str: "enjoga", A: 3, B: 85, F: nil},
+	{Str: "snjoga", A: 3, B: 122, F: nil},
+	{Str: "\u0161njoga", A: 3, B: 86, F: nil},
+	{Str: "koga", A: 3, B: 95, F: nil},
+	{Str: "skoga", A: 59, B: 1, F: nil},
+	{Str: "\u0161koga", A: 59, B: 2, F: nil},
+	{Str: "loga", A: 3, B: 19, F: nil},
+	{Str: "eloga", A: 62, B: 83, F: nil},
+	{Str: "noga", A: 3, B: 13, F: nil},
+	{Str: "cinoga", A: 64, B: 137, F: nil},
+	{Str: "\u010Dinoga", A: 64, B: 89, F: nil},
+	{Str: "osoga", A: 3, B: 123, F: nil},
+	{Str: "atoga", A: 3, B: 120, F: nil},
+	{Str: "evitoga", A: 3, B: 92, F: nil},
+	{Str: "ovitoga", A: 3, B: 93, F: nil},
+	{Str: "astoga", A: 3, B: 94, F: nil},
+	{Str: "avoga", A: 3, B: 77, F: nil},
+	{Str: "evoga", A: 3, B: 78, F: nil},
+	{Str: "ivoga", A: 3, B: 79, F: nil},
+	{Str: "ovoga", A: 3, B: 80, F: nil},
+	{Str: "a\u0107oga", A: 3, B: 14, F: nil},
+	{Str: "e\u0107oga", A: 3, B: 15, F: nil},
+	{Str: "u\u0107oga", A: 3, B: 16, F: nil},
+	{Str: "o\u0161oga", A: 3, B: 91, F: nil},
+	{Str: "uga", A: 3, B: 18, F: nil},
+	{Str: "aja", A: -1, B: 109, F: nil},
+	{Str: "caja", A: 81, B: 26, F: nil},
+	{Str: "laja", A: 81, B: 30, F: nil},
+	{Str: "raja", A: 81, B: 31, F: nil},
+	{Str: "\u0107aja", A: 81, B: 28, F: nil},
+	{Str: "\u010Daja", A: 81, B: 27, F: nil},
+	{Str: "\u0111aja", A: 81, B: 29, F: nil},
+	{Str: "bija", A: -1, B: 32, F: nil},
+	{Str: "cija", A: -1, B: 33, F: nil},
+	{Str: "dija", A: -1, B: 34, F: nil},
+	{Str: "fija", A: -1, B: 40, F: nil},
+	{Str: "gija", A: -1, B: 39, F: nil},
+	{Str: "anjija", A: -1, B: 84, F: nil},
+	{Str: "enjija", A: -1, B: 85, F: nil},
+	{Str: "snjija", A: -1, B: 122, F: nil},
+	{Str: "\u0161njija", A: -1, B: 86, F: nil},
+	{Str: "kija", A: -1, B: 95, F: nil},
+	{Str: "skija", A: 97, B: 1, F: nil},
+	{Str: "\u0161kija", A: 97, B: 2, F: nil},
+	{Str: "lija", A: -1, B: 24, F: nil},
+	{Str: "elija", A: 100, B: 83, F: nil},
+	{Str: "mija", A: -1, B: 37, F: nil},
+	{Str: "nija", A: -1, B: 13, F: nil},
+	{Str: "ganija", A: 103, B: 9, F: nil},
+	{Str: "manija", A: 103, B: 6, F: nil},
+	{Str: "panija", A: 103, B: 7, F: nil},
+	{Str: "ranija", A: 103, B: 8, F: nil},
+	{Str: "tanija", A: 103, B: 5, F: nil},
+	{Str: "pija", A: -1, B: 41, F: nil},
+	{Str: "rija", A: -1, B: 42, F: nil},
+	{Str: "rarija", A: 110, B: 21, F: nil},
+	{Str: "sija", A: -1, B: 23, F: nil},
+	{Str: "osija", A: 112, B: 123, F: nil},
+	{Str: "tija", A: -1, B: 44, F: nil},
+	{Str: "atija", A: 114, B: 120, F: nil},
+	{Str: "evitija", A: 114, B: 92, F: nil},
+	{Str: "ovitija", A: 114, B: 93, F: nil},
+	{Str: "otija", A: 114, B: 22, F: nil},
+	{Str: "astija", A: 114, B: 94, F: nil},
+	{Str: "avija", A: -1, B: 77, F: nil},
+	{Str: "evija", A: -1, B: 78, F: nil},
+	{Str: "ivija", A: -1, B: 79, F: nil},
+	{Str: "ovija", A: -1, B: 80, F: nil},
+	{Str: "zija", A: -1, B: 45, F: nil},
+	{Str: "o\u0161ija", A: -1, B: 91, F: nil},
+	{Str: "\u017Eija", A: -1, B: 38, F: nil},
+	{Str: "anja", A: -1, B: 84, F: nil},
+	{Str: "enja", A: -1, B: 85, F: nil},
+	{Str: "snja", A: -1, B: 122, F: nil},
+	{Str: "\u0161nja", A: -1, B: 86, F: nil},
+	{Str: "ka", A: -1, B: 95, F: nil},
+	{Str: "ska", A: 131, B: 1, F: nil},
+	{Str: "\u0161ka", A: 131, B: 2, F: nil},
+	{Str: "ala", A: -1, B: 104, F: nil},
+	{Str: "acala", A: 134, B: 128, F: nil},
+	{Str: "astajala", A: 134, B: 106, F: nil},
+	{Str: "istajala", A: 134, B: 107, F: nil},
+	{Str: "ostajala", A: 134, B: 108, F: nil},
+	{Str: "ijala", A: 134, B: 47, F: nil},
+	{Str: "injala", A: 134, B: 114, F: nil},
+	{Str: "nala", A: 134, B: 46, F: nil},
+	{Str: "irala", A: 134, B: 100, F: nil},
+	{Str: "urala", A: 134, B: 105, F: nil},
+	{Str: "tala", A: 134, B: 113, F: nil},
+	{Str: "astala", A: 144, B: 110, F: nil},
+	{Str: "istala", A: 144, B: 111, F: nil},
+	{Str: "ostala", A: 144, B: 112, F: nil},
+	{Str: "avala", A: 134, B: 97, F: nil},
+	{Str: "evala", A: 134, B: 96, F: nil},
+	{Str: "ivala", A: 134, B: 98, F: nil},
+	{Str: "ovala", A: 134, B: 76, F: nil},
+	{Str: "uvala", A: 134, B: 99, F: nil},
+	{Str: "a\u010Dala", A: 134, B: 102, F: nil},
+	{Str: "ela", A: -1, B: 83, F: nil},
+	{Str: "ila", A: -1, B: 116, F: nil},
+	{Str: "acila", A: 155, B: 124, F: nil},
+	{Str: "lucila", A: 155, B: 121, F: nil},
+	{Str: "nila", A: 155, B: 103, F: nil},
+	{Str: "astanila", A: 158, B: 110, F: nil},
+	{Str: "istanila", A: 158, B: 111, F: nil},
+	{Str: "ostanila", A: 158, B: 112, F: nil},
+	{Str: "rosila", A: 155, B: 127, F: nil},
+	{Str: "jetila", A: 155, B: 118, F: nil},
+	{Str: "ozila", A: 155, B: 48, F: nil},
+	{Str: "a\u010Dila", A: 155, B: 101, F: nil},
+	{Str: "lu\u010Dila", A: 155, B: 117, F: nil},
+	{Str: "ro\u0161ila", A: 155, B: 90, F: nil},
+	{Str: "ola", A: -1, B: 50, F: nil},
+	{Str: "asla", A: -1, B: 115, F: nil},
+	{Str: "nula", A: -1, B: 13, F: nil},
+	{Str: "gama", A: -1, B: 20, F: nil},
+	{Str: "logama", A: 171, B: 19, F: nil},
+	{Str: "ugama", A: 171, B: 18, F: nil},
+	{Str: "ajama", A: -1, B: 109, F: nil},
+	{Str: "cajama", A: 174, B: 26, F: nil},
+	{Str: "lajama", A: 174, B: 30, F: nil},
+	{Str: "rajama", A: 174, B: 31, F: nil},
+	{Str: "\u0107ajama", A: 174, B: 28, F: nil},
+	{Str: "\u010Dajama", A: 174, B: 27, F: nil},
+	{Str: "\u0111ajama", A: 174, B: 29, F: nil},
+	{Str: "bijama", A: -1, B: 32, F: nil},
+	{Str: "cijama", A: -1, B: 33, F: nil},
+	{Str: "dijama", A: -1, B: 34, F: nil},
+	{Str: "fijama", A: -1, B: 40, F: nil},
+	{Str: "gijama", A: -1, B: 39, F: nil},
+	{Str: "lijama", A: -1, B: 35, F: nil},
+	{Str: "mijama", A: -1, B: 37, F: nil},
+	{Str: "nijama", A: -1, B: 36, F: nil},
+	{Str: "ganijama", A: 188, B: 9, F: nil},
+	{Str: "manijama", A: 188, B: 6, F: nil},
+	{Str: "panijama", A: 188, B: 7, F: nil},
+	{Str: "ranijama", A: 188, B: 8, F: nil},
+	{Str: "tanijama", A: 188, B: 5, F: nil},
+	{Str: "pijama", A: -1, B: 41, F: nil},
+	{Str: "rijama", A: -1, B: 42, F: nil},
+	{Str: "sijama", A: -1, B: 43, F: nil},
+	{Str: "tijama", A: -1, B: 44, F: nil},
+	{Str: "zijama", A: -1, B: 45, F: nil},
+	{Str: "\u017Eijama", A: -1, B: 38, F: nil},
+	{Str: "alama", A: -1, B: 104, F: nil},
+	{Str: "ijalama", A: 200, B: 47, F: nil},
+	{Str: "nalama", A: 200, B: 46, F: nil},
+	{Str: "elama", A: -1, B: 119, F: nil},
+	{Str: "ilama", A: -1, B: 116, F: nil},
+	{Str: "ramama", A: -1, B: 52, F: nil},
+	{Str: "lemama", A: -1, B: 51, F: nil},
+	{Str: "inama", A: -1, B: 11, F: nil},
+	{Str: "cinama", A: 207, B: 137, F: nil},
+	{Str: "\u010Dinama", A: 207, B: 89, F: nil},
+	{Str: "rama", A: -1, B: 52, F: nil},
+	{Str: "arama", A: 210, B: 53, F: nil},
+	{Str: "drama", A: 210, B: 54, F: nil},
+	{Str: "erama", A: 210, B: 55, F: nil},
+	{Str: "orama", A: 210, B: 56, F: nil},
+	{Str: "basama", A: -1, B: 135, F: nil},
+	{Str: "gasama", A: -1, B: 131, F: nil},
+	{Str: "jasama", A: -1, B: 129, F: nil},
+	{Str: "kasama", A: -1, B: 133, F: nil},
+	{Str: "nasama", A: -1, B: 132, F: nil},
+	{Str: "tasama", A: -1, B: 130, F: nil},
+	{Str: "vasama", A: -1, B: 134, F: nil},
+	{Str: "esama", A: -1, B: 152, F: nil},
+	{Str: "isama", A: -1, B: 154, F: nil},
+	{Str: "etama", A: -1, B: 70, F: nil},
+	{Str: "estama", A: -1, B: 71, F: nil},
+	{Str: "istama", A: -1, B: 72, F: nil},
+	{Str: "kstama", A: -1, B: 73, F: nil},
+	{Str: "ostama", A: -1, B: 74, F: nil},
+	{Str: "avama", A: -1, B: 77, F: nil},
+	{Str: "evama", A: -1, B: 78, F: nil},
+	{Str: "ivama", A: -1, B: 79, F: nil},
+	{Str: "ba\u0161ama", A: -1, B: 63, F: nil},
+	{Str: "ga\u0161ama", A: -1, B: 64, F: nil},
+	{Str: "ja\u0161ama", A: -1, B: 61, F: nil},
+	{Str: "ka\u0161ama", A: -1, B: 62, F: nil},
+	{Str: "na\u0161ama", A: -1, B: 60, F: nil},
+	{Str: "ta\u0161ama", A: -1, B: 59, F: nil},
+	{Str: "va\u0161ama", A: -1, B: 65, F: nil},
+	{Str: "e\u0161ama", A: -1, B: 66, F: nil},
+	{Str: "i\u0161ama", A: -1, B: 67, F: nil},
+	{Str: "lema", A: -1, B: 51, F: nil},
+	{Str: "acima", A: -1, B: 124, F: nil},
+	{Str: "ecima", A: -1, B: 125, F: nil},
+	{Str: "ucima", A: -1, B: 126, F: nil},
+	{Str: "ajima", A: -1, B: 109, F: nil},
+	{Str: "cajima", A: 245, B: 26, F: nil},
+	{Str: "lajima", A: 245, B: 30, F: nil},
+	{Str: "rajima", A: 245, B: 31, F: nil},
+	{Str: "\u0107ajima", A: 245, B: 28, F: nil},
+	{Str: "\u010Dajima", A: 245, B: 27, F: nil},
+	{Str: "\u0111ajima", A: 245, B: 29, F: nil},
+	{Str: "bijima", A: -1, B: 32, F: nil},
+	{Str: "cijima", A: -1, B: 33, F: nil},
+	{Str: "dijima", A: -1, B: 34, F: nil},
+	{Str: "fijima", A: -1, B: 40, F: nil},
+	{Str: "gijima", A: -1, B: 39, F: nil},
+	{Str: "anjijima", A: -1, B: 84, F: nil},
+	{Str: "enjijima", A: -1, B: 85, F: nil},
+	{Str: "snjijima", A: -1, B: 122, F: nil},
+	{Str: "\u0161njijima", A: -1, B: 86, F: nil},
+	{Str: "kijima", A: -1, B: 95, F: nil},
+	{Str: "skijima", A: 261, B: 1, F: nil},
+	{Str: "\u0161kijima", A: 261, B: 2, F: nil},
+	{Str: "lijima", A: -1, B: 35, F: nil},
+	{Str: "elijima", A: 264, B: 83, F: nil},
+	{Str: "mijima", A: -1, B: 37, F: nil},
+	{Str: "nijima", A: -1, B: 13, F: nil},
+	{Str: "ganijima", A: 267, B: 9, F: nil},
+	{Str: "manijima", A: 267, B: 6, F: nil},
+	{Str: "panijima", A: 267, B: 7, F: nil},
+	{Str: "ranijima", A: 267, B: 8, F: nil},
+	{Str: "tanijima", A: 267, B: 5, F: nil},
+	{Str: "pijima", A: -1, B: 41, F: nil},
+	{Str: "rijima", A: -1, B: 42, F: nil},
+	{Str: "sijima", A: -1, B: 43, F: nil},
+	{Str: "osijima", A: 275, B: 123, F: nil},
+	{Str: "tijima", A: -1, B: 44, F: nil},
+	{Str: "atijima", A: 277, B: 120, F: nil},
+	{Str: "evitijima", A: 277, B: 92, F: nil},
+	{Str: "ovitijima", A: 277, B: 93, F: nil},
+	{Str: "astijima", A: 277, B: 94, F: nil},
+	{Str: "avijima", A: -1, B: 77, F: nil},
+	{Str: "evijima", A: -1, B: 78, F: nil},
+	{Str: "ivijima", A: -1, B: 79, F: nil},
+	{Str: "ovijima", A: -1, B: 80, F: nil},
+	{Str: "zijima", A: -1, B: 45, F: nil},
+	{Str: "o\u0161ijima", A: -1, B: 91, F: nil},
+	{Str: "\u017Eijima", A: -1, B: 38, F: nil},
+	{Str: "anjima", A: -1, B: 84, F: nil},
+	{Str: "enjima", A: -1, B: 85, F: nil},
+	{Str: "snjima", A: -1, B: 122, F: nil},
+	{Str: "\u0161njima", A: -1, B: 86, F: nil},
+	{Str: "kima", A: -1, B: 95, F: nil},
+	{Str: "skima", A: 293, B: 1, F: nil},
+	{Str: "\u0161kima", A: 293, B: 2, F: nil},
+	{Str: "alima", A: -1, B: 104, F: nil},
+	{Str: "ijalima", A: 296, B: 47, F: nil},
+	{Str: "nalima", A: 296, B: 46, F: nil},
+	{Str: "elima", A: -1, B: 83, F: nil},
+	{Str: "ilima", A: -1, B: 116, F: nil},
+	{Str: "ozilima", A: 300, B: 48, F: nil},
+	{Str: "olima", A: -1, B: 50, F: nil},
+	{Str: "lemima", A: -1, B: 51, F: nil},
+	{Str: "nima", A: -1, B: 13, F: nil},
+	{Str: "anima", A: 304, B: 10, F: nil},
+	{Str: "inima", A: 304, B: 11, F: nil},
+	{Str: "cinima", A: 306, B: 137, F: nil},
+	{Str: "\u010Dinima", A: 306, B: 89, F: nil},
+	{Str: "onima", A: 304, B: 12, F: nil},
+	{Str: "arima", A: -1, B: 53, F: nil},
+	{Str: "drima", A: -1, B: 54, F: nil},
+	{Str: "erima", A: -1, B: 55, F: nil},
+	{Str: "orima", A: -1, B: 56, F: nil},
+	{Str: "basima", A: -1, B: 135, F: nil},
+	{Str: "gasima", A: -1, B: 131, F: nil},
+	{Str: "jasima", A: -1, B: 129, F: nil},
+	{Str: "kasima", A: -1, B: 133, F: nil},
+	{Str: "nasima", A: -1, B: 132, F: nil},
+	{Str: "tasima", A: -1, B: 130, F: nil},
+	{Str: "vasima", A: -1, B: 134, F: nil},
+	{Str: "esima", A: -1, B: 57, F: nil},
+	{Str: "isima", A: -1, B: 58, F: nil},
+	{Str: "osima", A: -1, B: 123, F: nil},
+	{Str: "atima", A: -1, B: 120, F: nil},
+	{Str: "ikatima", A: 324, B: 68, F: nil},
+	{Str: "latima", A: 324, B: 69, F: nil},
+	{Str: "etima", A: -1, B: 70, F: nil},
+	{Str: "evitima", A: -1, B: 92, F: nil},
+	{Str: "ovitima", A: -1, B: 93, F: nil},
+	{Str: "astima", A: -1, B: 94, F: nil},
+	{Str: "estima", A: -1, B: 71, F: nil},
+	{Str: "istima", A: -1, B: 72, F: nil},
+	{Str: "kstima", A: -1, B: 73, F: nil},
+	{Str: "ostima", A: -1, B: 74, F: nil},
+	{Str: "i\u0161tima", A: -1, B: 75, F: nil},
+	{Str: "avima", A: -1, B: 77, F: nil},
+	{Str: "evima", A: -1, B: 78, F: nil},
+	{Str: "ajevima", A: 337, B: 109, F: nil},
+	{Str: "cajevima", A: 338, B: 26, F: nil},
+	{Str: "lajevima", A: 338, B: 30, F: nil},
+	{Str: "rajevima", A: 338, B: 31, F: nil},
+	{Str: "\u0107ajevima", A: 338, B: 28, F: nil},
+	{Str: "\u010Dajevima", A: 338, B: 27, F: nil},
+	{Str: "\u0111ajevima", A: 338, B: 29, F: nil},
+	{Str: "ivima", A: -1, B: 79, F: nil},
+	{Str: "ovima", A: -1, B: 80, F: nil},
+	{Str: "govima", A: 346, B: 20, F: nil},
+	{Str: "ugovima", A: 347, B: 17, F: nil},
+	{Str: "lovima", A: 346, B: 82, F: nil},
+	{Str: "olovima", A: 349, B: 49, F: nil},
+	{Str: "movima", A: 346, B: 81, F: nil},
+	{Str: "onovima", A: 346, B: 12, F: nil},
+	{Str: "stvima", A: -1, B: 3, F: nil},
+	{Str: "\u0161tvima", A: -1, B: 4, F: nil},
+	{Str: "a\u0107ima", A: -1, B: 14, F: nil},
+	{Str: "e\u0107ima", A: -1, B: 15, F: nil},
+	{Str: "u\u0107ima", A: -1, B: 16, F: nil},
+	{Str: "ba\u0161ima", A: -1, B: 63, F: nil},
+	{Str: "ga\u0161ima", A: -1, B: 64, F: nil},
+	{Str: "ja\u0161ima", A: -1, B: 61, F: nil},
+	{Str: "ka\u0161ima", A: -1, B: 62, F: nil},
+	{Str: "na\u0161ima", A: -1, B: 60, F: nil},
+	{Str: "ta\u0161ima", A: -1, B: 59, F: nil},
+	{Str: "va\u0161ima", A: -1, B: 65, F: nil},
+	{Str: "e\u0161ima", A: -1, B: 66, F: nil},
+	{Str: "i\u0161ima", A: -1, B: 67, F: nil},
+	{Str: "o\u0161ima", A: -1, B: 91, F: nil},
+	{Str: "na", A: -1, B: 13, F: nil},
+	{Str: "ana", A: 368, B: 10, F: nil},
+	{Str: "acana", A: 369, B: 128, F: nil},
+	{Str: "urana", A: 369, B: 105, F: nil},
+	{Str: "tana", A: 369, B: 113, F: nil},
+	{Str: "avana", A: 369, B: 97, F: nil},
+	{Str: "evana", A: 369, B: 96, F: nil},
+	{Str: "ivana", A: 369, B: 98, F: nil},
+	{Str: "uvana", A: 369, B: 99, F: nil},
+	{Str: "a\u010Dana", A: 369, B: 102, F: nil},
+	{Str: "acena", A: 368, B: 124, F: nil},
+	{Str: "lucena", A: 368, B: 121, F: nil},
+	{Str: "a\u010Dena", A: 368, B: 101, F: nil},
+	{Str: "lu\u010Dena", A: 368, B: 117, F: nil},
+	{Str: "ina", A: 368, B: 11, F: nil},
+	{Str: "cina", A: 382, B: 137, F: nil},
+	{Str: "anina", A: 382, B: 10, F: nil},
+	{Str: "\u010Dina", A: 382, B: 89, F: nil},
+	{Str: "ona", A: 368, B: 12, F: nil},
+	{Str: "ara", A: -1, B: 53, F: nil},
+	{Str: "dra", A: -1, B: 54, F: nil},
+	{Str: "era", A: -1, B: 55, F: nil},
+	{Str: "ora", A: -1, B: 56, F: nil},
+	{Str: "basa", A: -1, B: 135, F: nil},
+	{Str: "gasa", A: -1, B: 131, F: nil},
+	{Str: "jasa", A: -1, B: 129, F: nil},
+	{Str: "kasa", A: -1, B: 133, F: nil},
+	{Str: "nasa", A: -1, B: 132, F: nil},
+	{Str: "tasa", A: -1, B: 130, F: nil},
+	{Str: "vasa", A: -1, B: 134, F: nil},
+	{Str: "esa", A: -1, B: 57, F: nil},
+	{Str: "isa", A: -1, B: 58, F: nil},
+	{Str: "osa", A: -1, B: 123, F: nil},
+	{Str: "ata", A: -1, B: 120, F: nil},
+	{Str: "ikata", A: 401, B: 68, F: nil},
+	{Str: "lata", A: 401, B: 69, F: nil},
+	{Str: "eta", A: -1, B: 70, F: nil},
+	{Str: "evita", A: -1, B: 92, F: nil},
+	{Str: "ovita", A: -1, B: 93, F: nil},
+	{Str: "asta", A: -1, B: 94, F: nil},
+	{Str: "esta", A: -1, B: 71, F: nil},
+	{Str: "ista", A: -1, B: 72, F: nil},
+	{Str: "ksta", A: -1, B: 73, F: nil},
+	{Str: "osta", A: -1, B: 74, F: nil},
+	{Str: "nuta", A: -1, B: 13, F: nil},
+	{Str: "i\u0161ta", A: -1, B: 75, F: nil},
+	{Str: "ava", A: -1, B: 77, F: nil},
+	{Str: "eva", A: -1, B: 78, F: nil},
+	{Str: "ajeva", A: 415, B: 109, F: nil},
+	{Str: "cajeva", A: 416, B: 26, F: nil},
+	{Str: "lajeva", A: 416, B: 30, F: nil},
+	{Str: "rajeva", A: 416, B: 31, F: nil},
+	{Str: "\u0107ajeva", A: 416, B: 28, F: nil},
+	{Str: "\u010Dajeva", A: 416, B: 27, F: nil},
+	{Str: "\u0111ajeva", A: 416, B: 29, F: nil},
+	{Str: "iva", A: -1, B: 79, F: nil},
+	{Str: "ova", A: -1, B: 80, F: nil},
+	{Str: "gova", A: 424, B: 20, F: nil},
+	{Str: "ugova", A: 425, B: 17, F: nil},
+	{Str: "lova", A: 424, B: 82, F: nil},
+	{Str: "olova", A: 427, B: 49, F: nil},
+	{Str: "mova", A: 424, B: 81, F: nil},
+	{Str: "onova", A: 424, B: 12, F: nil},
+	{Str: "stva", A: -1, B: 3, F: nil},
+	{Str: "\u0161tva", A: -1, B: 4, F: nil},
+	{Str: "a\u0107a", A: -1, B: 14, F: nil},
+	{Str: "e\u0107a", A: -1, B: 15, F: nil},
+	{Str: "u\u0107a", A: -1, B: 16, F: nil},
+	{Str: "ba\u0161a", A: -1, B: 63, F: nil},
+	{Str: "ga\u0161a", A: -1, B: 64, F: nil},
+	{Str: "ja\u0161a", A: -1, B: 61, F: nil},
+	{Str: "ka\u0161a", A: -1, B: 62, F: nil},
+	{Str: "na\u0161a", A: -1, B: 60, F: nil},
+	{Str: "ta\u0161a", A: -1, B: 59, F: nil},
+	{Str: "va\u0161a", A: -1, B: 65, F: nil},
+	{Str: "e\u0161a", A: -1, B: 66, F: nil},
+	{Str: "i\u0161a", A: -1, B: 67, F: nil},
+	{Str: "o\u0161a", A: -1, B: 91, F: nil},
+	{Str: "ace", A: -1, B: 124, F: nil},
+	{Str: "ece", A: -1, B: 125, F: nil},
+	{Str: "uce", A: -1, B: 126, F: nil},
+	{Str: "luce", A: 448, B: 121, F: nil},
+	{Str: "astade", A: -1, B: 110, F: nil},
+	{Str: "istade", A: -1, B: 111, F: nil},
+	{Str: "ostade", A: -1, B: 112, F: nil},
+	{Str: "ge", A: -1, B: 20, F: nil},
+	{Str: "loge", A: 453, B: 19, F: nil},
+	{Str: "uge", A: 453, B: 18, F: nil},
+	{Str: "aje", A: -1, B: 104, F: nil},
+	{Str: "caje", A: 456, B: 26, F: nil},
+	{Str: "laje", A: 456, B: 30, F: nil},
+	{Str: "raje", A: 456, B: 31, F: nil},
+	{Str: "astaje", A: 456, B: 106, F: nil},
+	{Str: "istaje", A: 456, B: 107, F: nil},
+	{Str: "ostaje", A: 456, B: 108, F: nil},
+	{Str: "\u0107aje", A: 456, B: 28, F: nil},
+	{Str: "\u010Daje", A: 456, B: 27, F: nil},
+	{Str: "\u0111aje", A: 456, B: 29, F: nil},
+	{Str: "ije", A: -1, B: 116, F: nil},
+	{Str: "bije", A: 466, B: 32, F: nil},
+	{Str: "cije", A: 466, B: 33, F: nil},
+	{Str: "dije", A: 466, B: 34, F: nil},
+	{Str: "fije", A: 466, B: 40, F: nil},
+	{Str: "gije", A: 466, B: 39, F: nil},
+	{Str: "anjije", A: 466, B: 84, F: nil},
+	{Str: "enjije", A: 466, B: 85, F: nil},
+	{Str: "snjije", A: 466, B: 122, F: nil},
+	{Str: "\u0161njije", A: 466, B: 86, F: nil},
+	{Str: "kije", A: 466, B: 95, F: nil},
+	{Str: "skije", A: 476, B: 1, F: nil},
+	{Str: "\u0161kije", A: 476, B: 2, F: nil},
+	{Str: "lije", A: 466, B: 35, F: nil},
+	{Str: "elije", A: 479, B: 83, F: nil},
+	{Str: "mije", A: 466, B: 37, F: nil},
+	{Str: "nije", A: 466, B: 13, F: nil},
+	{Str: "ganije", A: 482, B: 9, F: nil},
+	{Str: "manije", A: 482, B: 6, F: nil},
+	{Str: "panije", A: 482, B: 7, F: nil},
+	{Str: "ranije", A: 482, B: 8, F: nil},
+	{Str: "tanije", A: 482, B: 5, F: nil},
+	{Str: "pije", A: 466, B: 41, F: nil},
+	{Str: "rije", A: 466, B: 42, F: nil},
+	{Str: "sije", A: 466, B: 43, F: nil},
+	{Str: "osije", A: 490, B: 123, F: nil},
+	{Str: "tije", A: 466, B: 44, F: nil},
+	{Str: "atije", A: 492, B: 120, F: nil},
+	{Str: "evitije", A: 492, B: 92, F: nil},
+	{Str: "ovitije", A: 492, B: 93, F: nil},
+	{Str: "astije", A: 492, B: 94, F: nil},
+	{Str: "avije", A: 466, B: 77, F: nil},
+	{Str: "evije", A: 466, B: 78, F: nil},
+	{Str: "ivije", A: 466, B: 79, F: nil},
+	{Str: "ovije", A: 466, B: 80, F: nil},
+	{Str: "zije", A: 466, B: 45, F: nil},
+	{Str: "o\u0161ije", A: 466, B: 91, F: nil},
+	{Str: "\u017Eije", A: 466, B: 38, F: nil},
+	{Str: "anje", A: -1, B: 84, F: nil},
+	{Str: "enje", A: -1, B: 85, F: nil},
+	{Str: "snje", A: -1, B: 122, F: nil},
+	{Str: "\u0161nje", A: -1, B: 86, F: nil},
+	{Str: "uje", A: -1, B: 25, F: nil},
+	{Str: "lucuje", A: 508, B: 121, F: nil},
+	{Str: "iruje", A: 508, B: 100, F: nil},
+	{Str: "lu\u010Duje", A: 508, B: 117, F: nil},
+	{Str: "ke", A: -1, B: 95, F: nil},
+	{Str: "ske", A: 512, B: 1, F: nil},
+	{Str: "\u0161ke", A: 512, B: 2, F: nil},
+	{Str: "ale", A: -1, B: 104, F: nil},
+	{Str: "acale", A: 515, B: 128, F: nil},
+	{Str: "astajale", A: 515, B: 106, F: nil},
+	{Str: "istajale", A: 515, B: 107, F: nil},
+	{Str: "ostajale", A: 515, B: 108, F: nil},
+	{Str: "ijale", A: 515, B: 47, F: nil},
+	{Str: "injale", A: 515, B: 114, F: nil},
+	{Str: "nale", A: 515, B: 46, F: nil},
+	{Str: "irale", A: 515, B: 100, F: nil},
+	{Str: "urale", A: 515, B: 105, F: nil},
+	{Str: "tale", A: 515, B: 113, F: nil},
+	{Str: "astale", A: 525, B: 110, F: nil},
+	{Str: "istale", A: 525, B: 111, F: nil},
+	{Str: "ostale", A: 525, B: 112, F: nil},
+	{Str: "avale", A: 515, B: 97, F: nil},
+	{Str: "evale", A: 515, B: 96, F: nil},
+	{Str: "ivale", A: 515, B: 98, F: nil},
+	{Str: "ovale", A: 515, B: 76, F: nil},
+	{Str: "uvale", A: 515, B: 99, F: nil},
+	{Str: "a\u010Dale", A: 515, B: 102, F: nil},
+	{Str: "ele", A: -1, B: 83, F: nil},
+	{Str: "ile", A: -1, B: 116, F: nil},
+	{Str: "acile", A: 536, B: 124, F: nil},
+	{Str: "lucile", A: 536, B: 121, F: nil},
+	{Str: "nile", A: 536, B: 103, F: nil},
+	{Str: "rosile", A: 536, B: 127, F: nil},
+	{Str: "jetile", A: 536, B: 118, F: nil},
+	{Str: "ozile", A: 536, B: 48, F: nil},
+	{Str: "a\u010Dile", A: 536, B: 101, F: nil},
+	{Str: "lu\u010Dile", A: 536, B: 117, F: nil},
+	{Str: "ro\u0161ile", A: 536, B: 90, F: nil},
+	{Str: "ole", A: -1, B: 50, F: nil},
+	{Str: "asle", A: -1, B: 115, F: nil},
+	{Str: "nule", A: -1, B: 13, F: nil},
+	{Str: "rame", A: -1, B: 52, F: nil},
+	{Str: "leme", A: -1, B: 51, F: nil},
+	{Str: "acome", A: -1, B: 124, F: nil},
+	{Str: "ecome", A: -1, B: 125, F: nil},
+	{Str: "ucome", A: -1, B: 126, F: nil},
+	{Str: "anjome", A: -1, B: 84, F: nil},
+	{Str: "enjome", A: -1, B: 85, F: nil},
+	{Str: "snjome", A: -1, B: 122, F: nil},
+	{Str: "\u0161njome", A: -1, B: 86, F: nil},
+	{Str: "kome", A: -1, B: 95, F: nil},
+	{Str: "skome", A: 558, B: 1, F: nil},
+	{Str: "\u0161kome", A: 558, B: 2, F: nil},
+	{Str: "elome", A: -1, B: 83, F: nil},
+	{Str: "nome", A: -1, B: 13, F: nil},
+	{Str: "cinome", A: 562, B: 137, F: nil},
+	{Str: "\u010Dinome", A: 562, B: 89, F: nil},
+	{Str: "osome", A: -1, B: 123, F: nil},
+	{Str: "atome", A: -1, B: 120, F: nil},
+	{Str: "evitome", A: -1, B: 92, F: nil},
+	{Str: "ovitome", A: -1, B: 93, F: nil},
+	{Str: "astome", A: -1, B: 94, F: nil},
+	{Str: "avome", A: -1, B: 77, F: nil},
+	{Str: "evome", A: -1, B: 78, F: nil},
+	{Str: "ivome", A: -1, B: 79, F: nil},
+	{Str: "ovome", A: -1, B: 80, F: nil},
+	{Str: "a\u0107ome", A: -1, B: 14, F: nil},
+	{Str: "e\u0107ome", A: -1, B: 15, F: nil},
+	{Str: "u\u0107ome", A: -1, B: 16, F: nil},
+	{Str: "o\u0161ome", A: -1, B: 91, F: nil},
+	{Str: "ne", A: -1, B: 13, F: nil},
+	{Str: "ane", A: 578, B: 10, F: nil},
+	{Str: "acane", A: 579, B: 128, F: nil},
+	{Str: "urane", A: 579, B: 105, F: nil},
+	{Str: "tane", A: 579, B: 113, F: nil},
+	{Str: "astane", A: 582, B: 110, F: nil},
+	{Str: "istane", A: 582, B: 111, F: nil},
+	{Str: "ostane", A: 582, B: 112, F: nil},
+	{Str: "avane", A: 579, B: 97, F: nil},
+	{Str: "evane", A: 579, B: 96, F: nil},
+	{Str: "ivane", A: 579, B: 98, F: nil},
+	{Str: "uvane", A: 579, B: 99, F: nil},
+	{Str: "a\u010Dane", A: 579, B: 102, F: nil},
+	{Str: "acene", A: 578, B: 124, F: nil},
+	{Str: "lucene", A: 578, B: 121, F: nil},
+	{Str: "a\u010Dene", A: 578, B: 101, F: nil},
+	{Str: "lu\u010Dene", A: 578, B: 117, F: nil},
+	{Str: "ine", A: 578, B: 11, F: nil},
+	{Str: "cine", A: 595, B: 137, F: nil},
+	{Str: "anine", A: 595, B: 10, F: nil},
+	{Str: "\u010Dine", A: 595, B: 89, F: nil},
+	{Str: "one", A: 578, B: 12, F: nil},
+	{Str: "are", A: -1, B: 53, F: nil},
+	{Str: "dre", A: -1, B: 54, F: nil},
+	{Str: "ere", A: -1, B: 55, F: nil},
+	{Str: "ore", A: -1, B: 56, F: nil},
+	{Str: "ase", A: -1, B: 161, F: nil},
+	{Str: "base", A: 604, B: 135, F: nil},
+	{Str: "acase", A: 604, B: 128, F: nil},
+	{Str: "gase", A: 604, B: 131, F: nil},
+	{Str: "jase", A: 604, B: 129, F: nil},
+	{Str: "astajase", A: 608, B: 138, F: nil},
+	{Str: "istajase", A: 608, B: 139, F: nil},
+	{Str: "ostajase", A: 608, B: 140, F: nil},
+	{Str: "injase", A: 608, B: 150, F: nil},
+	{Str: "kase", A: 604, B: 133, F: nil},
+	{Str: "nase", A: 604, B: 132, F: nil},
+	{Str: "irase", A: 604, B: 155, F: nil},
+	{Str: "urase", A: 604, B: 156, F: nil},
+	{Str: "tase", A: 604, B: 130, F: nil},
+	{Str: "vase", A: 604, B: 134, F: nil},
+	{Str: "avase", A: 618, B: 144, F: nil},
+	{Str: "evase", A: 618, B: 145, F: nil},
+	{Str: "ivase", A: 618, B: 146, F: nil},
+	{Str: "ovase", A: 618, B: 148, F: nil},
+	{Str: "uvase", A: 618, B: 147, F: nil},
+	{Str: "ese", A: -1, B: 57, F: nil},
+	{Str: "ise", A: -1, B: 58, F: nil},
+	{Str: "acise", A: 625, B: 124, F: nil},
+	{Str: "lucise", A: 625, B: 121, F: nil},
+	{Str: "rosise", A: 625, B: 127, F: nil},
+	{Str: "jetise", A: 625, B: 149, F: nil},
+	{Str: "ose", A: -1, B: 123, F: nil},
+	{Str: "astadose", A: 630, B: 141, F: nil},
+	{Str: "istadose", A: 630, B: 142, F: nil},
+	{Str: "ostadose", A: 630, B: 143, F: nil},
+	{Str: "ate", A: -1, B: 104, F: nil},
+	{Str: "acate", A: 634, B: 128, F: nil},
+	{Str: "ikate", A: 634, B: 68, F: nil},
+	{Str: "late", A: 634, B: 69, F: nil},
+	{Str: "irate", A: 634, B: 100, F: nil},
+	{Str: "urate", A: 634, B: 105, F: nil},
+	{Str: "tate", A: 634, B: 113, F: nil},
+	{Str: "avate", A: 634, B: 97, F: nil},
+	{Str: "evate", A: 634, B: 96, F: nil},
+	{Str: "ivate", A: 634, B: 98, F: nil},
+	{Str: "uvate", A: 634, B: 99, F: nil},
+	{Str: "a\u010Date", A: 634, B: 102, F: nil},
+	{Str: "ete", A: -1, B: 70, F: nil},
+	{Str: "astadete", A: 646, B: 110, F: nil},
+	{Str: "istadete", A: 646, B: 111, F: nil},
+	{Str: "ostadete", A: 646, B: 112, F: nil},
+	{Str: "astajete", A: 646, B: 106, F: nil},
+	{Str: "istajete", A: 646, B: 107, F: nil},
+	{Str: "ostajete", A: 646, B: 108, F: nil},
+	{Str: "ijete", A: 646, B: 116, F: nil},
+	{Str: "injete", A: 646, B: 114, F: nil},
+	{Str: "ujete", A: 646, B: 25, F: nil},
+	{Str: "lucujete", A: 655, B: 121, F: nil},
+	{Str: "irujete", A: 655, B: 100, F: nil},
+	{Str: "lu\u010Dujete", A: 655, B: 117, F: nil},
+	{Str: "nete", A: 646, B: 13, F: nil},
+	{Str: "astanete", A: 659, B: 110, F: nil},
+	{Str: "istanete", A: 659, B: 111, F: nil},
+	{Str: "ostanete", A: 659, B: 112, F: nil},
+	{Str: "astete", A: 646, B: 115, F: nil},
+	{Str: "ite", A: -1, B: 116, F: nil},
+	{Str: "acite", A: 664, B: 124, F: nil},
+	{Str: "lucite", A: 664, B: 121, F: nil},
+	{Str: "nite", A: 664, B: 13, F: nil},
+	{Str: "astanite", A: 667, B: 110, F: nil},
+	{Str: "istanite", A: 667, B: 111, F: nil},
+	{Str: "ostanite", A: 667, B: 112, F: nil},
+	{Str: "rosite", A: 664, B: 127, F: nil},
+	{Str: "jetite", A: 664, B: 118, F: nil},
+	{Str: "astite", A: 664, B: 115, F: nil},
+	{Str: "evite", A: 664, B: 92, F: nil},
+	{Str: "ovite", A: 664, B: 93, F: nil},
+	{Str: "a\u010Dite", A: 664, B: 101, F: nil},
+	{Str: "lu\u010Dite", A: 664, B: 117, F: nil},
+	{Str: "ro\u0161ite", A: 664, B: 90, F: nil},
+	{Str: "ajte", A: -1, B: 104, F: nil},
+	{Str: "urajte", A: 679, B: 105, F: nil},
+	{Str: "tajte", A: 679, B: 113, F: nil},
+	{Str: "astajte", A: 681, B: 106, F: nil},
+	{Str: "istajte", A: 681, B: 107, F: nil},
+	{Str: "ostajte", A: 681, B: 108, F: nil},
+	{Str: "avajte", A: 679, B: 97, F: nil},
+	{Str: "evajte", A: 679, B: 96, F: nil},
+	{Str: "ivajte", A: 679, B: 98, F: nil},
+	{Str: "uvajte", A: 679, B: 99, F: nil},
+	{Str: "ijte", A: -1, B: 116, F: nil},
+	{Str: "lucujte", A: -1, B: 121, F: nil},
+	{Str: "irujte", A: -1, B: 100, F: nil},
+	{Str: "lu\u010Dujte", A: -1, B: 117, F: nil},
+	{Str: "aste", A: -1, B: 94, F: nil},
+	{Str: "acaste", A: 693, B: 128, F: nil},
+	{Str: "astajaste", A: 693, B: 106, F: nil},
+	{Str: "istajaste", A: 693, B: 107, F: nil},
+	{Str: "ostajaste", A: 693, B: 108, F: nil},
+	{Str: "injaste", A: 693, B: 114, F: nil},
+	{Str: "iraste", A: 693, B: 100, F: nil},
+	{Str: "uraste", A: 693, B: 105, F: nil},
+	{Str: "taste", A: 693, B: 113, F: nil},
+	{Str: "avaste", A: 693, B: 97, F: nil},
+	{Str: "evaste", A: 693, B: 96, F: nil},
+	{Str: "ivaste", A: 693, B: 98, F: nil},
+	{Str: "ovaste", A: 693, B: 76, F: nil},
+	{Str: "uvaste", A: 693, B: 99, F: nil},
+	{Str: "a\u010Daste", A: 693, B: 102, F: nil},
+	{Str: "este", A: -1, B: 71, F: nil},
+	{Str: "iste", A: -1, B: 72, F: nil},
+	{Str: "aciste", A: 709, B: 124, F: nil},
+	{Str: "luciste", A: 709, B: 121, F: nil},
+	{Str: "niste", A: 709, B: 103, F: nil},
+	{Str: "rosiste", A: 709, B: 127, F: nil},
+	{Str: "jetiste", A: 709, B: 118, F: nil},
+	{Str: "a\u010Diste", A: 709, B: 101, F: nil},
+	{Str: "lu\u010Diste", A: 709, B: 117, F: nil},
+	{Str: "ro\u0161iste", A: 709, B: 90, F: nil},
+	{Str: "kste", A: -1, B: 73, F: nil},
+	{Str: "oste", A: -1, B: 74, F: nil},
+	{Str: "astadoste", A: 719, B: 110, F: nil},
+	{Str: "istadoste", A: 719, B: 111, F: nil},
+	{Str: "ostadoste", A: 719, B: 112, F: nil},
+	{Str: "nuste", A: -1, B: 13, F: nil},
+	{Str: "i\u0161te", A: -1, B: 75, F: nil},
+	{Str: "ave", A: -1, B: 77, F: nil},
+	{Str: "eve", A: -1, B: 78, F: nil},
+	{Str: "ajeve", A: 726, B: 109, F: nil},
+	{Str: "cajeve", A: 727, B: 26, F: nil},
+	{Str: "lajeve", A: 727, B: 30, F: nil},
+	{Str: "rajeve", A: 727, B: 31, F: nil},
+	{Str: "\u0107ajeve", A: 727, B: 28, F: nil},
+	{Str: "\u010Dajeve", A: 727, B: 27, F: nil},
+	{Str: "\u0111ajeve", A: 727, B: 29, F: nil},
+	{Str: "ive", A: -1, B: 79, F: nil},
+	{Str: "ove", A: -1, B: 80, F: nil},
+	{Str: "gove", A: 735, B: 20, F: nil},
+	{Str: "ugove", A: 736, B: 17, F: nil},
+	{Str: "love", A: 735, B: 82, F: nil},
+	{Str: "olove", A: 738, B: 49, F: nil},
+	{Str: "move", A: 735, B: 81, F: nil},
+	{Str: "onove", A: 735, B: 12, F: nil},
+	{Str: "a\u0107e", A: -1, B: 14, F: nil},
+	{Str: "e\u0107e", A: -1, B: 15, F: nil},
+	{Str: "u\u0107e", A: -1, B: 16, F: nil},
+	{Str: "a\u010De", A: -1, B: 101, F: nil},
+	{Str: "lu\u010De", A: -1, B: 117, F: nil},
+	{Str: "a\u0161e", A: -1, B: 104, F: nil},
+	{Str: "ba\u0161e", A: 747, B: 63, F: nil},
+	{Str: "ga\u0161e", A: 747, B: 64, F: nil},
+	{Str: "ja\u0161e", A: 747, B: 61, F: nil},
+	{Str: "astaja\u0161e", A: 750, B: 106, F: nil},
+	{Str: "istaja\u0161e", A: 750, B: 107, F: nil},
+	{Str: "ostaja\u0161e", A: 750, B: 108, F: nil},
+	{Str: "inja\u0161e", A: 750, B: 114, F: nil},
+	{Str: "ka\u0161e", A: 747, B: 62, F: nil},
+	{Str: "na\u0161e", A: 747, B: 60, F: nil},
+	{Str: "ira\u0161e", A: 747, B: 100, F: nil},
+	{Str: "ura\u0161e", A: 747, B: 105, F: nil},
+	{Str: "ta\u0161e", A: 747, B: 59, F: nil},
+	{Str: "va\u0161e", A: 747, B: 65, F: nil},
+	{Str: "ava\u0161e", A: 760, B: 97, F: nil},
+	{Str: "eva\u0161e", A: 760, B: 96, F: nil},
+	{Str: "iva\u0161e", A: 760, B: 98, F: nil},
+	{Str: "ova\u0161e", A: 760, B: 76, F: nil},
+	{Str: "uva\u0161e", A: 760, B: 99, F: nil},
+	{Str: "a\u010Da\u0161e", A: 747, B: 102, F: nil},
+	{Str: "e\u0161e", A: -1, B: 66, F: nil},
+	{Str: "i\u0161e", A: -1, B: 67, F: nil},
+	{Str: "jeti\u0161e", A: 768, B: 118, F: nil},
+	{Str: "a\u010Di\u0161e", A: 768, B: 101, F: nil},
+	{Str: "lu\u010Di\u0161e", A: 768, B: 117, F: nil},
+	{Str: "ro\u0161i\u0161e", A: 768, B: 90, F: nil},
+	{Str: "o\u0161e", A: -1, B: 91, F: nil},
+	{Str: "astado\u0161e", A: 773, B: 110, F: nil},
+	{Str: "istado\u0161e", A: 773, B: 111, F: nil},
+	{Str: "ostado\u0161e", A: 773, B: 112, F: nil},
+	{Str: "aceg", A: -1, B: 124, F: nil},
+	{Str: "eceg", A: -1, B: 125, F: nil},
+	{Str: "uceg", A: -1, B: 126, F: nil},
+	{Str: "anjijeg", A: -1, B: 84, F: nil},
+	{Str: "enjijeg", A: -1, B: 85, F: nil},
+	{Str: "snjijeg", A: -1, B: 122, F: nil},
+	{Str: "\u0161njijeg", A: -1, B: 86, F: nil},
+	{Str: "kijeg", A: -1, B: 95, F: nil},
+	{Str: "skijeg", A: 784, B: 1, F: nil},
+	{Str: "\u0161kijeg", A: 784, B: 2, F: nil},
+	{Str: "elijeg", A: -1, B: 83, F: nil},
+	{Str: "nijeg", A: -1, B: 13, F: nil},
+	{Str: "osijeg", A: -1, B: 123, F: nil},
+	{Str: "atijeg", A: -1, B: 120, F: nil},
+	{Str: "evitijeg", A: -1, B: 92, F: nil},
+	{Str: "ovitijeg", A: -1, B: 93, F: nil},
+	{Str: "astijeg", A: -1, B: 94, F: nil},
+	{Str: "avijeg", A: -1, B: 77, F: nil},
+	{Str: "evijeg", A: -1, B: 78, F: nil},
+	{Str: "ivijeg", A: -1, B: 79, F: nil},
+	{Str: "ovijeg", A: -1, B: 80, F: nil},
+	{Str: "o\u0161ijeg", A: -1, B: 91, F: nil},
+	{Str: "anjeg", A: -1, B: 84, F: nil},
+	{Str: "enjeg", A: -1, B: 85, F: nil},
+	{Str: "snjeg", A: -1, B: 122, F: nil},
+	{Str: "\u0161njeg", A: -1, B: 86, F: nil},
+	{Str: "keg", A: -1, B: 95, F: nil},
+	{Str: "eleg", A: -1, B: 83, F: nil},
+	{Str: "neg", A: -1, B: 13, F: nil},
+	{Str: "aneg", A: 805, B: 10, F: nil},
+	{Str: "eneg", A: 805, B: 87, F: nil},
+	{Str: "sneg", A: 805, B: 159, F: nil},
+	{Str: "\u0161neg", A: 805, B: 88, F: nil},
+	{Str: "oseg", A: -1, B: 123, F: nil},
+	{Str: "ateg", A: -1, B: 120, F: nil},
+	{Str: "aveg", A: -1, B: 77, F: nil},
+	{Str: "eveg", A: -1, B: 78, F: nil},
+	{Str: "iveg", A: -1, B: 79, F: nil},
+	{Str: "oveg", A: -1, B: 80, F: nil},
+	{Str: "a\u0107eg", A: -1, B: 14, F: nil},
+	{Str: "e\u0107eg", A: -1, B: 15, F: nil},
+	{Str: "u\u0107eg", A: -1, B: 16, F: nil},
+	{Str: "o\u0161eg", A: -1, B: 91, F: nil},
+	{Str: "acog", A: -1, B: 124, F: nil},
+	{Str: "ecog", A: -1, B: 125, F: nil},
+	{Str: "ucog", A: -1, B: 126, F: nil},
+	{Str: "anjog", A: -1, B: 84, F: nil},
+	{Str: "enjog", A: -1, B: 85, F: nil},
+	{Str: "snjog", A: -1, B: 122, F: nil},
+	{Str: "\u0161njog", A: -1, B: 86, F: nil},
+	{Str: "kog", A: -1, B: 95, F: nil},
+	{Str: "skog", A: 827, B: 1, F: nil},
+	{Str: "\u0161kog", A: 827, B: 2, F: nil},
+	{Str: "elog", A: -1, B: 83, F: nil},
+	{Str: "nog", A: -1, B: 13, F: nil},
+	{Str: "cinog", A: 831, B: 137, F: nil},
+	{Str: "\u010Dinog", A: 831, B: 89, F: nil},
+	{Str: "osog", A: -1, B: 123, F: nil},
+	{Str: "atog", A: -1, B: 120, F: nil},
+	{Str: "evitog", A: -1, B: 92, F: nil},
+	{Str: "ovitog", A: -1, B: 93, F: nil},
+	{Str: "astog", A: -1, B: 94, F: nil},
+	{Str: "avog", A: -1, B: 77, F: nil},
+	{Str: "evog", A: -1, B: 78, F: nil},
+	{Str: "ivog", A: -1, B: 79, F: nil},
+	{Str: "ovog", A: -1, B: 80, F: nil},
+	{Str: "a\u0107og", A: -1, B: 14, F: nil},
+	{Str: "e\u0107og", A: -1, B: 15, F: nil},
+	{Str: "u\u0107og", A: -1, B: 16, F: nil},
+	{Str: "o\u0161og", A: -1, B: 91, F: nil},
+	{Str: "ah", A: -1, B: 104, F: nil},
+	{Str: "acah", A: 847, B: 128, F: nil},
+	{Str: "astajah", A: 847, B: 106, F: nil},
+	{Str: "istajah", A: 847, B: 107, F: nil},
+	{Str: "ostajah", A: 847, B: 108, F: nil},
+	{Str: "injah", A: 847, B: 114, F: nil},
+	{Str: "irah", A: 847, B: 100, F: nil},
+	{Str: "urah", A: 847, B: 105, F: nil},
+	{Str: "tah", A: 847, B: 113, F: nil},
+	{Str: "avah", A: 847, B: 97, F: nil},
+	{Str: "evah", A: 847, B: 96, F: nil},
+	{Str: "ivah", A: 847, B: 98, F: nil},
+	{Str: "ovah", A: 847, B: 76, F: nil},
+	{Str: "uvah", A: 847, B: 99, F: nil},
+	{Str: "a\u010Dah", A: 847, B: 102, F: nil},
+	{Str: "ih", A: -1, B: 116, F: nil},
+	{Str: "acih", A: 862, B: 124, F: nil},
+	{Str: "ecih", A: 862, B: 125, F: nil},
+	{Str: "ucih", A: 862, B: 126, F: nil},
+	{Str: "lucih", A: 865, B: 121, F: nil},
+	{Str: "anjijih", A: 862, B: 84, F: nil},
+	{Str: "enjijih", A: 862, B: 85, F: nil},
+	{Str: "snjijih", A: 862, B: 122, F: nil},
+	{Str: "\u0161njijih", A: 862, B: 86, F: nil},
+	{Str: "kijih", A: 862, B: 95, F: nil},
+	{Str: "skijih", A: 871, B: 1, F: nil},
+	{Str: "\u0161kijih", A: 871, B: 2, F: nil},
+	{Str: "elijih", A: 862, B: 83, F: nil},
+	{Str: "nijih", A: 862, B: 13, F: nil},
+	{Str: "osijih", A: 862, B: 123, F: nil},
+	{Str: "atijih", A: 862, B: 120, F: nil},
+	{Str: "evitijih", A: 862, B: 92, F: nil},
+	{Str: "ovitijih", A: 862, B: 93, F: nil},
+	{Str: "astijih", A: 862, B: 94, F: nil},
+	{Str: "avijih", A: 862, B: 77, F: nil},
+	{Str: "evijih", A: 862, B: 78, F: nil},
+	{Str: "ivijih", A: 862, B: 79, F: nil},
+	{Str: "ovijih", A: 862, B: 80, F: nil},
+	{Str: "o\u0161ijih", A: 862, B: 91, F: nil},
+	{Str: "anjih", A: 862, B: 84, F: nil},
+	{Str: "enjih", A: 862, B: 85, F: nil},
+	{Str: "snjih", A: 862, B: 122, F: nil},
+	{Str: "\u0161njih", A: 862, B: 86, F: nil},
+	{Str: "kih", A: 862, B: 95, F: nil},
+	{Str: "skih", A: 890, B: 1, F: nil},
+	{Str: "\u0161kih", A: 890, B: 2, F: nil},
+	{Str: "elih", A: 862, B: 83, F: nil},
+	{Str: "nih", A: 862, B: 13, F: nil},
+	{Str: "cinih", A: 894, B: 137, F: nil},
+	{Str: "\u010Dinih", A: 894, B: 89, F: nil},
+	{Str: "osih", A: 862, B: 123, F: nil},
+	{Str: "rosih", A: 897, B: 127, F: nil},
+	{Str: "atih", A: 862, B: 120, F: nil},
+	{Str: "jetih", A: 862, B: 118, F: nil},
+	{Str: "evitih", A: 862, B: 92, F: nil},
+	{Str: "ovitih", A: 862, B: 93, F: nil},
+	{Str: "astih", A: 862, B: 94, F: nil},
+	{Str: "avih", A: 862, B: 77, F: nil},
+	{Str: "evih", A: 862, B: 78, F: nil},
+	{Str: "ivih", A: 862, B: 79, F: nil},
+	{Str: "ovih", A: 862, B: 80, F: nil},
+	{Str: "a\u0107ih", A: 862, B: 14, F: nil},
+	{Str: "e\u0107ih", A: 862, B: 15, F: nil},
+	{Str: "u\u0107ih", A: 862, B: 16, F: nil},
+	{Str: "a\u010Dih", A: 862, B: 101, F: nil},
+	{Str: "lu\u010Dih", A: 862, B: 117, F: nil},
+	{Str: "o\u0161ih", A: 862, B: 91, F: nil},
+	{Str: "ro\u0161ih", A: 913, B: 90, F: nil},
+	{Str: "astadoh", A: -1, B: 110, F: nil},
+	{Str: "istadoh", A: -1, B: 111, F: nil},
+	{Str: "ostadoh", A: -1, B: 112, F: nil},
+	{Str: "acuh", A: -1, B: 124, F: nil},
+	{Str: "ecuh", A: -1, B: 125, F: nil},
+	{Str: "ucuh", A: -1, B: 126, F: nil},
+	{Str: "a\u0107uh", A: -1, B: 14, F: nil},
+	{Str: "e\u0107uh", A: -1, B: 15, F: nil},
+	{Str: "u\u0107uh", A: -1, B: 16, F: nil},
+	{Str: "aci", A: -1, B: 124, F: nil},
+	{Str: "aceci", A: -1, B: 124, F: nil},
+	{Str: "ieci", A: -1, B: 162, F: nil},
+	{Str: "ajuci", A: -1, B: 161, F: nil},
+	{Str: "irajuci", A: 927, B: 155, F: nil},
+	{Str: "urajuci", A: 927, B: 156, F: nil},
+	{Str: "astajuci", A: 927, B: 138, F: nil},
+	{Str: "istajuci", A: 927, B: 139, F: nil},
+	{Str: "ostajuci", A: 927, B: 140, F: nil},
+	{Str: "avajuci", A: 927, B: 144, F: nil},
+	{Str: "evajuci", A: 927, B: 145, F: nil},
+	{Str: "ivajuci", A: 927, B: 146, F: nil},
+	{Str: "uvajuci", A: 927, B: 147, F: nil},
+	{Str: "ujuci", A: -1, B: 157, F: nil},
+	{Str: "lucujuci", A: 937, B: 121, F: nil},
+	{Str: "irujuci", A: 937, B: 155, F: nil},
+	{Str: "luci", A: -1, B: 121, F: nil},
+	{Str: "nuci", A: -1, B: 164, F: nil},
+	{Str: "etuci", A: -1, B: 153, F: nil},
+	{Str: "astuci", A: -1, B: 136, F: nil},
+	{Str: "gi", A: -1, B: 20, F: nil},
+	{Str: "ugi", A: 944, B: 18, F: nil},
+	{Str: "aji", A: -1, B: 109, F: nil},
+	{Str: "caji", A: 946, B: 26, F: nil},
+	{Str: "laji", A: 946, B: 30, F: nil},
+	{Str: "raji", A: 946, B: 31, F: nil},
+	{Str: "\u0107aji", A: 946, B: 28, F: nil},
+	{Str: "\u010Daji", A: 946, B: 27, F: nil},
+	{Str: "\u0111aji", A: 946, B: 29, F: nil},
+	{Str: "biji", A: -1, B: 32, F: nil},
+	{Str: "ciji", A: -1, B: 33, F: nil},
+	{Str: "diji", A: -1, B: 34, F: nil},
+	{Str: "fiji", A: -1, B: 40, F: nil},
+	{Str: "giji", A: -1, B: 39, F: nil},
+	{Str: "anjiji", A: -1, B: 84, F: nil},
+	{Str: "enjiji", A: -1, B: 85, F: nil},
+	{Str: "snjiji", A: -1, B: 122, F: nil},
+	{Str: "\u0161njiji", A: -1, B: 86, F: nil},
+	{Str: "kiji", A: -1, B: 95, F: nil},
+	{Str: "skiji", A: 962, B: 1, F: nil},
+	{Str: "\u0161kiji", A: 962, B: 2, F: nil},
+	{Str: "liji", A: -1, B: 35, F: nil},
+	{Str: "eliji", A: 965, B: 83, F: nil},
+	{Str: "miji", A: -1, B: 37, F: nil},
+	{Str: "niji", A: -1, B: 13, F: nil},
+	{Str: "ganiji", A: 968, B: 9, F: nil},
+	{Str: "maniji", A: 968, B: 6, F: nil},
+	{Str: "paniji", A: 968, B: 7, F: nil},
+	{Str: "raniji", A: 968, B: 8, F: nil},
+	{Str: "taniji", A: 968, B: 5, F: nil},
+	{Str: "piji", A: -1, B: 41, F: nil},
+	{Str: "riji", A: -1, B: 42, F: nil},
+	{Str: "siji", A: -1, B: 43, F: nil},
+	{Str: "osiji", A: 976, B: 123, F: nil},
+	{Str: "tiji", A: -1, B: 44, F: nil},
+	{Str: "atiji", A: 978, B: 120, F: nil},
+	{Str: "evitiji", A: 978, B: 92, F: nil},
+	{Str: "ovitiji", A: 978, B: 93, F: nil},
+	{Str: "astiji", A: 978, B: 94, F: nil},
+	{Str: "aviji", A: -1, B: 77, F: nil},
+	{Str: "eviji", A: -1, B: 78, F: nil},
+	{Str: "iviji", A: -1, B: 79, F: nil},
+	{Str: "oviji", A: -1, B: 80, F: nil},
+	{Str: "ziji", A: -1, B: 45, F: nil},
+	{Str: "o\u0161iji", A: -1, B: 91, F: nil},
+	{Str: "\u017Eiji", A: -1, B: 38, F: nil},
+	{Str: "anji", A: -1, B: 84, F: nil},
+	{Str: "enji", A: -1, B: 85, F: nil},
+	{Str: "snji", A: -1, B: 122, F: nil},
+	{Str: "\u0161nji", A: -1, B: 86, F: nil},
+	{Str: "ki", A: -1, B: 95, F: nil},
+	{Str: "ski", A: 994, B: 1, F: nil},
+	{Str: "\u0161ki", A: 994, B: 2, F: nil},
+	{Str: "ali", A: -1, B: 104, F: nil},
+	{Str: "acali", A: 997, B: 128, F: nil},
+	{Str: "astajali", A: 997, B: 106, F: nil},
+	{Str: "istajali", A: 997, B: 107, F: nil},
+	{Str: "ostajali", A: 997, B: 108, F: nil},
+	{Str: "ijali", A: 997, B: 47, F: nil},
+	{Str: "injali", A: 997, B: 114, F: nil},
+	{Str: "nali", A: 997, B: 46, F: nil},
+	{Str: "irali", A: 997, B: 100, F: nil},
+	{Str: "urali", A: 997, B: 105, F: nil},
+	{Str: "tali", A: 997, B: 113, F: nil},
+	{Str: "astali", A: 1007, B: 110, F: nil},
+	{Str: "istali", A: 1007, B: 111, F: nil},
+	{Str: "ostali", A: 1007, B: 112, F: nil},
+	{Str: "avali", A: 997, B: 97, F: nil},
+	{Str: "evali", A: 997, B: 96, F: nil},
+	{Str: "ivali", A: 997, B: 98, F: nil},
+	{Str: "ovali", A: 997, B: 76, F: nil},
+	{Str: "uvali", A: 997, B: 99, F: nil},
+	{Str: "a\u010Dali", A: 997, B: 102, F: nil},
+	{Str: "eli", A: -1, B: 83, F: nil},
+	{Str: "ili", A: -1, B: 116, F: nil},
+	{Str: "acili", A: 1018, B: 124, F: nil},
+	{Str: "lucili", A: 1018, B: 121, F: nil},
+	{Str: "nili", A: 1018, B: 103, F: nil},
+	{Str: "rosili", A: 1018, B: 127, F: nil},
+	{Str: "jetili", A: 1018, B: 118, F: nil},
+	{Str: "ozili", A: 1018, B: 48, F: nil},
+	{Str: "a\u010Dili", A: 1018, B: 101, F: nil},
+	{Str: "lu\u010Dili", A: 1018, B: 117, F: nil},
+	{Str: "ro\u0161ili", A: 1018, B: 90, F: nil},
+	{Str: "oli", A: -1, B: 50, F: nil},
+	{Str: "asli", A: -1, B: 115, F: nil},
+	{Str: "nuli", A: -1, B: 13, F: nil},
+	{Str: "rami", A: -1, B: 52, F: nil},
+	{Str: "lemi", A: -1, B: 51, F: nil},
+	{Str: "ni", A: -1, B: 13, F: nil},
+	{Str: "ani", A: 1033, B: 10, F: nil},
+	{Str: "acani", A: 1034, B: 128, F: nil},
+	{Str: "urani", A: 1034, B: 105, F: nil},
+	{Str: "tani", A: 1034, B: 113, F: nil},
+	{Str: "avani", A: 1034, B: 97, F: nil},
+	{Str: "evani", A: 1034, B: 96, F: nil},
+	{Str: "ivani", A: 1034, B: 98, F: nil},
+	{Str: "uvani", A: 1034, B: 99, F: nil},
+	{Str: "a\u010Dani", A: 1034, B: 102, F: nil},
+	{Str: "aceni", A: 1033, B: 124, F: nil},
+	{Str: "luceni", A: 1033, B: 121, F: nil},
+	{Str: "a\u010Deni", A: 1033, B: 101, F: nil},
+	{Str: "lu\u010Deni", A: 1033, B: 117, F: nil},
+	{Str: "ini", A: 1033, B: 11, F: nil},
+	{Str: "cini", A: 1047, B: 137, F: nil},
+	{Str: "\u010Dini", A: 1047, B: 89, F: nil},
+	{Str: "oni", A: 1033, B: 12, F: nil},
+	{Str: "ari", A: -1, B: 53, F: nil},
+	{Str: "dri", A: -1, B: 54, F: nil},
+	{Str: "eri", A: -1, B: 55, F: nil},
+	{Str: "ori", A: -1, B: 56, F: nil},
+	{Str: "basi", A: -1, B: 135, F: nil},
+	{Str: "gasi", A: -1, B: 131, F: nil},
+	{Str: "jasi", A: -1, B: 129, F: nil},
+	{Str: "kasi", A: -1, B: 133, F: nil},
+	{Str: "nasi", A: -1, B: 132, F: nil},
+	{Str: "tasi", A: -1, B: 130, F: nil},
+	{Str: "vasi", A: -1, B: 134, F: nil},
+	{Str: "esi", A: -1, B: 152, F: nil},
+	{Str: "isi", A: -1, B: 154, F: nil},
+	{Str: "osi", A: -1, B: 123, F: nil},
+	{Str: "avsi", A: -1, B: 161, F: nil},
+	{Str: "acavsi", A: 1065, B: 128, F: nil},
+	{Str: "iravsi", A: 1065, B: 155, F: nil},
+	{Str: "tavsi", A: 1065, B: 160, F: nil},
+	{Str: "etavsi", A: 1068, B: 153, F: nil},
+	{Str: "astavsi", A: 1068, B: 141, F: nil},
+	{Str: "istavsi", A: 1068, B: 142, F: nil},
+	{Str: "ostavsi", A: 1068, B: 143, F: nil},
+	{Str: "ivsi", A: -1, B: 162, F: nil},
+	{Str: "nivsi", A: 1073, B: 158, F: nil},
+	{Str: "rosivsi", A: 1073, B: 127, F: nil},
+	{Str: "nuvsi", A: -1, B: 164, F: nil},
+	{Str: "ati", A: -1, B: 104, F: nil},
+	{Str: "acati", A: 1077, B: 128, F: nil},
+	{Str: "astajati", A: 1077, B: 106, F: nil},
+	{Str: "istajati", A: 1077, B: 107, F: nil},
+	{Str: "ostajati", A: 1077, B: 108, F: nil},
+	{Str: "injati", A: 1077, B: 114, F: nil},
+	{Str: "ikati", A: 1077, B: 68, F: nil},
+	{Str: "lati", A: 1077, B: 69, F: nil},
+	{Str: "irati", A: 1077, B: 100, F: nil},
+	{Str: "urati", A: 1077, B: 105, F: nil},
+	{Str: "tati", A: 1077, B: 113, F: nil},
+	{Str: "astati", A: 1087, B: 110, F: nil},
+	{Str: "istati", A: 1087, B: 111, F: nil},
+	{Str: "ostati", A: 1087, B: 112, F: nil},
+	{Str: "avati", A: 1077, B: 97, F: nil},
+	{Str: "evati", A: 1077, B: 96, F: nil},
+	{Str: "ivati", A: 1077, B: 98, F: nil},
+	{Str: "ovati", A: 1077, B: 76, F: nil},
+	{Str: "uvati", A: 1077, B: 99, F: nil},
+	{Str: "a\u010Dati", A: 1077, B: 102, F: nil},
+	{Str: "eti", A: -1, B: 70, F: nil},
+	{Str: "iti", A: -1, B: 116, F: nil},
+	{Str: "aciti", A: 1098, B: 124, F: nil},
+	{Str: "luciti", A: 1098, B: 121, F: nil},
+	{Str: "niti", A: 1098, B: 103, F: nil},
+	{Str: "rositi", A: 1098, B: 127, F: nil},
+	{Str: "jetiti", A: 1098, B: 118, F: nil},
+	{Str: "eviti", A: 1098, B: 92, F: nil},
+	{Str: "oviti", A: 1098, B: 93, F: nil},
+	{Str: "a\u010Diti", A: 1098, B: 101, F: nil},
+	{Str: "lu\u010Diti", A: 1098, B: 117, F: nil},
+	{Str: "ro\u0161iti", A: 1098, B: 90, F: nil},
+	{Str: "asti", A: -1, B: 94, F: nil},
+	{Str: "esti", A: -1, B: 71, F: nil},
+	{Str: "isti", A: -1, B: 72, F: nil},
+	{Str: "ksti", A: -1, B: 73, F: nil},
+	{Str: "osti", A: -1, B: 74, F: nil},
+	{Str: "nuti", A: -1, B: 13, F: nil},
+	{Str: "avi", A: -1, B: 77, F: nil},
+	{Str: "evi", A: -1, B: 78, F: nil},
+	{Str: "ajevi", A: 1116, B: 109, F: nil},
+	{Str: "cajevi", A: 1117, B: 26, F: nil},
+	{Str: "lajevi", A: 1117, B: 30, F: nil},
+	{Str: "rajevi", A: 1117, B: 31, F: nil},
+	{Str: "\u0107ajevi", A: 1117, B: 28, F: nil},
+	{Str: "\u010Dajevi", A: 1117, B: 27, F: nil},
+	{Str: "\u0111ajevi", A: 1117, B: 29, F: nil},
+	{Str: "ivi", A: -1, B: 79, F: nil},
+	{Str: "ovi", A: -1, B: 80, F: nil},
+	{Str: "govi", A: 1125, B: 20, F: nil},
+	{Str: "ugovi", A: 1126, B: 17, F: nil},
+	{Str: "lovi", A: 1125, B: 82, F: nil},
+	{Str: "olovi", A: 1128, B: 49, F: nil},
+	{Str: "movi", A: 1125, B: 81, F: nil},
+	{Str: "onovi", A: 1125, B: 12, F: nil},
+	{Str: "ie\u0107i", A: -1, B: 116, F: nil},
+	{Str: "a\u010De\u0107i", A: -1, B: 101, F: nil},
+	{Str: "aju\u0107i", A: -1, B: 104, F: nil},
+	{Str: "iraju\u0107i", A: 1134, B: 100, F: nil},
+	{Str: "uraju\u0107i", A: 1134, B: 105, F: nil},
+	{Str: "astaju\u0107i", A: 1134, B: 106, F: nil},
+	{Str: "istaju\u0107i", A: 1134, B: 107, F: nil},
+	{Str: "ostaju\u0107i", A: 1134, B: 108, F: nil},
+	{Str: "avaju\u0107i", A: 1134, B: 97, F: nil},
+	{Str: "evaju\u0107i", A: 1134, B: 96, F: nil},
+	{Str: "ivaju\u0107i", A: 1134, B: 98, F: nil},
+	{Str: "uvaju\u0107i", A: 1134, B: 99, F: nil},
+	{Str: "uju\u0107i", A: -1, B: 25, F: nil},
+	{Str: "iruju\u0107i", A: 1144, B: 100, F: nil},
+	{Str: "lu\u010Duju\u0107i", A: 1144, B: 117, F: nil},
+	{Str: "nu\u0107i", A: -1, B: 13, F: nil},
+	{Str: "etu\u0107i", A: -1, B: 70, F: nil},
+	{Str: "astu\u0107i", A: -1, B: 115, F: nil},
+	{Str: "a\u010Di", A: -1, B: 101, F: nil},
+	{Str: "lu\u010Di", A: -1, B: 117, F: nil},
+	{Str: "ba\u0161i", A: -1, B: 63, F: nil},
+	{Str: "ga\u0161i", A: -1, B: 64, F: nil},
+	{Str: "ja\u0161i", A: -1, B: 61, F: nil},
+	{Str: "ka\u0161i", A: -1, B: 62, F: nil},
+	{Str: "na\u0161i", A: -1, B: 60, F: nil},
+	{Str: "ta\u0161i", A: -1, B: 59, F: nil},
+	{Str: "va\u0161i", A: -1, B: 65, F: nil},
+	{Str: "e\u0161i", A: -1, B: 66, F: nil},
+	{Str: "i\u0161i", A: -1, B: 67, F: nil},
+	{Str: "o\u0161i", A: -1, B: 91, F: nil},
+	{Str: "av\u0161i", A: -1, B: 104, F: nil},
+	{Str: "irav\u0161i", A: 1162, B: 100, F: nil},
+	{Str: "tav\u0161i", A: 1162, B: 113, F: nil},
+	{Str: "etav\u0161i", A: 1164, B: 70, F: nil},
+	{Str: "astav\u0161i", A: 1164, B: 110, F: nil},
+	{Str: "istav\u0161i", A: 1164, B: 111, F: nil},
+	{Str: "ostav\u0161i", A: 1164, B: 112, F: nil},
+	{Str: "a\u010Dav\u0161i", A: 1162, B: 102, F: nil},
+	{Str: "iv\u0161i", A: -1, B: 116, F: nil},
+	{Str: "niv\u0161i", A: 1170, B: 103, F: nil},
+	{Str: "ro\u0161iv\u0161i", A: 1170, B: 90, F: nil},
+	{Str: "nuv\u0161i", A: -1, B: 13, F: nil},
+	{Str: "aj", A: -1, B: 104, F: nil},
+	{Str: "uraj", A: 1174, B: 105, F: nil},
+	{Str: "taj", A: 1174, B: 113, F: nil},
+	{Str: "avaj", A: 1174, B: 97, F: nil},
+	{Str: "evaj", A: 1174, B: 96, F: nil},
+	{Str: "ivaj", A: 1174, B: 98, F: nil},
+	{Str: "uvaj", A: 1174, B: 99, F: nil},
+	{Str: "ij", A: -1, B: 116, F: nil},
+	{Str: "acoj", A: -1, B: 124, F: nil},
+	{Str: "ecoj", A: -1, B: 125, F: nil},
+	{Str: "ucoj", A: -1, B: 126, F: nil},
+	{Str: "anjijoj", A: -1, B: 84, F: nil},
+	{Str: "enjijoj", A: -1, B: 85, F: nil},
+	{Str: "snjijoj", A: -1, B: 122, F: nil},
+	{Str: "\u0161njijoj", A: -1, B: 86, F: nil},
+	{Str: "kijoj", A: -1, B: 95, F: nil},
+	{Str: "skijoj", A: 1189, B: 1, F: nil},
+	{Str: "\u0161kijoj", A: 1189, B: 2, F: nil},
+	{Str: "elijoj", A: -1, B: 83, F: nil},
+	{Str: "nijoj", A: -1, B: 13, F: nil},
+	{Str: "osijoj", A: -1, B: 123, F: nil},
+	{Str: "evitijoj", A: -1, B: 92, F: nil},
+	{Str: "ovitijoj", A: -1, B: 93, F: nil},
+	{Str: "astijoj", A: -1, B: 94, F: nil},
+	{Str: "avijoj", A: -1, B: 77, F: nil},
+	{Str: "evijoj", A: -1, B: 78, F: nil},
+	{Str: "ivijoj", A: -1, B: 79, F: nil},
+	{Str: "ovijoj", A: -1, B: 80, F: nil},
+	{Str: "o\u0161ijoj", A: -1, B: 91, F: nil},
+	{Str: "anjoj", A: -1, B: 84, F: nil},
+	{Str: "enjoj", A: -1, B: 85, F: nil},
+	{Str: "snjoj", A: -1, B: 122, F: nil},
+	{Str: "\u0161njoj", A: -1, B: 86, F: nil},
+	{Str: "koj", A: -1, B: 95, F: nil},
+	{Str: "skoj", A: 1207, B: 1, F: nil},
+	{Str: "\u0161koj", A: 1207, B: 2, F: nil},
+	{Str: "aloj", A: -1, B: 104, F: nil},
+	{Str: "eloj", A: -1, B: 83, F: nil},
+	{Str: "noj", A: -1, B: 13, F: nil},
+	{Str: "cinoj", A: 1212, B: 137, F: nil},
+	{Str: "\u010Dinoj", A: 1212, B: 89, F: nil},
+	{Str: "osoj", A: -1, B: 123, F: nil},
+	{Str: "atoj", A: -1, B: 120, F: nil},
+	{Str: "evitoj", A: -1, B: 92, F: nil},
+	{Str: "ovitoj", A: -1, B: 93, F: nil},
+	{Str: "astoj", A: -1, B: 94, F: nil},
+	{Str: "avoj", A: -1, B: 77, F: nil},
+	{Str: "evoj", A: -1, B: 78, F: nil},
+	{Str: "ivoj", A: -1, B: 79, F: nil},
+	{Str: "ovoj", A: -1, B: 80, F: nil},
+	{Str: "a\u0107oj", A: -1, B: 14, F: nil},
+	{Str: "e\u0107oj", A: -1, B: 15, F: nil},
+	{Str: "u\u0107oj", A: -1, B: 16, F: nil},
+	{Str: "o\u0161oj", A: -1, B: 91, F: nil},
+	{Str: "lucuj", A: -1, B: 121, F: nil},
+	{Str: "iruj", A: -1, B: 100, F: nil},
+	{Str: "lu\u010Duj", A: -1, B: 117, F: nil},
+	{Str: "al", A: -1, B: 104, F: nil},
+	{Str: "iral", A: 1231, B: 100, F: nil},
+	{Str: "ural", A: 1231, B: 105, F: nil},
+	{Str: "el", A: -1, B: 119, F: nil},
+	{Str: "il", A: -1, B: 116, F: nil},
+	{Str: "am", A: -1, B: 104, F: nil},
+	{Str: "acam", A: 1236, B: 128, F: nil},
+	{Str: "iram", A: 1236, B: 100, F: nil},
+	{Str: "uram", A: 1236, B: 105, F: nil},
+	{Str: "tam", A: 1236, B: 113, F: nil},
+	{Str: "avam", A: 1236, B: 97, F: nil},
+	{Str: "evam", A: 1236, B: 96, F: nil},
+	{Str: "ivam", A: 1236, B: 98, F: nil},
+	{Str: "uvam", A: 1236, B: 99, F: nil},
+	{Str: "a\u010Dam", A: 1236, B: 102, F: nil},
+	{Str: "em", A: -1, B: 119, F: nil},
+	{Str: "acem", A: 1246, B: 124, F: nil},
+	{Str: "ecem", A: 1246, B: 125, F: nil},
+	{Str: "ucem", A: 1246, B: 126, F: nil},
+	{Str: "astadem", A: 1246, B: 110, F: nil},
+	{Str: "istadem", A: 1246, B: 111, F: nil},
+	{Str: "ostadem", A: 1246, B: 112, F: nil},
+	{Str: "ajem", A: 1246, B: 104, F: nil},
+	{Str: "cajem", A: 1253, B: 26, F: nil},
+	{Str: "lajem", A: 1253, B: 30, F: nil},
+	{Str: "rajem", A: 1253, B: 31, F: nil},
+	{Str: "astajem", A: 1253, B: 106, F: nil},
+	{Str: "istajem", A: 1253, B: 107, F: nil},
+	{Str: "ostajem", A: 1253, B: 108, F: nil},
+	{Str: "\u0107ajem", A: 1253, B: 28, F: nil},
+	{Str: "\u010Dajem", A: 1253, B: 27, F: nil},
+	{Str: "\u0111ajem", A: 1253, B: 29, F: nil},
+	{Str: "ijem", A: 1246, B: 116, F: nil},
+	{Str: "anjijem", A: 1263, B: 84, F: nil},
+	{Str: "enjijem", A: 1263, B: 85, F: nil},
+	{Str: "snjijem", A: 1263, B: 123, F: nil},
+	{Str: "\u0161njijem", A: 1263, B: 86, F: nil},
+	{Str: "kijem", A: 1263, B: 95, F: nil},
+	{Str: "skijem", A: 1268, B: 1, F: nil},
+	{Str: "\u0161kijem", A: 1268, B: 2, F: nil},
+	{Str: "lijem", A: 1263, B: 24, F: nil},
+	{Str: "elijem", A: 1271, B: 83, F: nil},
+	{Str: "nijem", A: 1263, B: 13, F: nil},
+	{Str: "rarijem", A: 1263, B: 21, F: nil},
+	{Str: "sijem", A: 1263, B: 23, F: nil},
+	{Str: "osijem", A: 1275, B: 123, F: nil},
+	{Str: "atijem", A: 1263, B: 120, F: nil},
+	{Str: "evitijem", A: 1263, B: 92, F: nil},
+	{Str: "ovitijem", A: 1263, B: 93, F: nil},
+	{Str: "otijem", A: 1263, B: 22, F: nil},
+	{Str: "astijem", A: 1263, B: 94, F: nil},
+	{Str: "avijem", A: 1263, B: 77, F: nil},
+	{Str: "evijem", A: 1263, B: 78, F: nil},
+	{Str: "ivijem", A: 1263, B: 79, F: nil},
+	{Str: "ovijem", A: 1263, B: 80, F: nil},
+	{Str: "o\u0161ijem", A: 1263, B: 91, F: nil},
+	{Str: "anjem", A: 1246, B: 84, F: nil},
+	{Str: "enjem", A: 1246, B: 85, F: nil},
+	{Str: "injem", A: 1246, B: 114, F: nil},
+	{Str: "snjem", A: 1246, B: 122, F: nil},
+	{Str: "\u0161njem", A: 1246, B: 86, F: nil},
+	{Str: "ujem", A: 1246, B: 25, F: nil},
+	{Str: "lucujem", A: 1292, B: 121, F: nil},
+	{Str: "irujem", A: 1292, B: 100, F: nil},
+	{Str: "lu\u010Dujem", A: 1292, B: 117, F: nil},
+	{Str: "kem", A: 1246, B: 95, F: nil},
+	{Str: "skem", A: 1296, B: 1, F: nil},
+	{Str: "\u0161kem", A: 1296, B: 2, F: nil},
+	{Str: "elem", A: 1246, B: 83, F: nil},
+	{Str: "nem", A: 1246, B: 13, F: nil},
+	{Str: "anem", A: 1300, B: 10, F: nil},
+	{Str: "astanem", A: 1301, B: 110, F: nil},
+	{Str: "istanem", A: 1301, B: 111, F: nil},
+	{Str: "ostanem", A: 1301, B: 112, F: nil},
+	{Str: "enem", A: 1300, B: 87, F: nil},
+	{Str: "snem", A: 1300, B: 159, F: nil},
+	{Str: "\u0161nem", A: 1300, B: 88, F: nil},
+	{Str: "basem", A: 1246, B: 135, F: nil},
+	{Str: "gasem", A: 1246, B: 131, F: nil},
+	{Str: "jasem", A: 1246, B: 129, F: nil},
+	{Str: "kasem", A: 1246, B: 133, F: nil},
+	{Str: "nasem", A: 1246, B: 132, F: nil},
+	{Str: "tasem", A: 1246, B: 130, F: nil},
+	{Str: "vasem", A: 1246, B: 134, F: nil},
+	{Str: "esem", A: 1246, B: 152, F: nil},
+	{Str: "isem", A: 1246, B: 154, F: nil},
+	{Str: "osem", A: 1246, B: 123, F: nil},
+	{Str: "atem", A: 1246, B: 120, F: nil},
+	{Str: "etem", A: 1246, B: 70, F: nil},
+	{Str: "evitem", A: 1246, B: 92, F: nil},
+	{Str: "ovitem", A: 1246, B: 93, F: nil},
+	{Str: "astem", A: 1246, B: 94, F: nil},
+	{Str: "istem", A: 1246, B: 151, F: nil},
+	{Str: "i\u0161tem", A: 1246, B: 75, F: nil},
+	{Str: "avem", A: 1246, B: 77, F: nil},
+	{Str: "evem", A: 1246, B: 78, F: nil},
+	{Str: "ivem", A: 1246, B: 79, F: nil},
+	{Str: "a\u0107em", A: 1246, B: 14, F: nil},
+	{Str: "e\u0107em", A: 1246, B: 15, F: nil},
+	{Str: "u\u0107em", A: 1246, B: 16, F: nil},
+	{Str: "ba\u0161em", A: 1246, B: 63, F: nil},
+	{Str: "ga\u0161em", A: 1246, B: 64, F: nil},
+	{Str: "ja\u0161em", A: 1246, B: 61, F: nil},
+	{Str: "ka\u0161em", A: 1246, B: 62, F: nil},
+	{Str: "na\u0161em", A: 1246, B: 60, F: nil},
+	{Str: "ta\u0161em", A: 1246, B: 59, F: nil},
+	{Str: "va\u0161em", A: 1246, B: 65, F: nil},
+	{Str: "e\u0161em", A: 1246, B: 66, F: nil},
+	{Str: "i\u0161em", A: 1246, B: 67, F: nil},
+	{Str: "o\u0161em", A: 1246, B: 91, F: nil},
+	{Str: "im", A: -1, B: 116, F: nil},
+	{Str: "acim", A: 1341, B: 124, F: nil},
+	{Str: "ecim", A: 1341, B: 125, F: nil},
+	{Str: "ucim", A: 1341, B: 126, F: nil},
+	{Str: "lucim", A: 1344, B: 121, F: nil},
+	{Str: "anjijim", A: 1341, B: 84, F: nil},
+	{Str: "enjijim", A: 1341, B: 85, F: nil},
+	{Str: "snjijim", A: 1341, B: 122, F: nil},
+	{Str: "\u0161njijim", A: 1341, B: 86, F: nil},
+	{Str: "kijim", A: 1341, B: 95, F: nil},
+	{Str: "skijim", A: 1350, B: 1, F: nil},
+	{Str: "\u0161kijim", A: 1350, B: 2, F: nil},
+	{Str: "elijim", A: 1341, B: 83, F: nil},
+	{Str: "nijim", A: 1341, B: 13, F: nil},
+	{Str: "osijim", A: 1341, B: 123, F: nil},
+	{Str: "atijim", A: 1341, B: 120, F: nil},
+	{Str: "evitijim", A: 1341, B: 92, F: nil},
+	{Str: "ovitijim", A: 1341, B: 93, F: nil},
+	{Str: "astijim", A: 1341, B: 94, F: nil},
+	{Str: "avijim", A: 1341, B: 77, F: nil},
+	{Str: "evijim", A: 1341, B: 78, F: nil},
+	{Str: "ivijim", A: 1341, B: 79, F: nil},
+	{Str: "ovijim", A: 1341, B: 80, F: nil},
+	{Str: "o\u0161ijim", A: 1341, B: 91, F: nil},
+	{Str: "anjim", A: 1341, B: 84, F: nil},
+	{Str: "enjim", A: 1341, B: 85, F: nil},
+	{Str: "snjim", A: 1341, B: 122, F: nil},
+	{Str: "\u0161njim", A: 1341, B: 86, F: nil},
+	{Str: "kim", A: 1341, B: 95, F: nil},
+	{Str: "skim", A: 1369, B: 1, F: nil},
+	{Str: "\u0161kim", A: 1369, B: 2, F: nil},
+	{Str: "elim", A: 1341, B: 83, F: nil},
+	{Str: "nim", A: 1341, B: 13, F: nil},
+	{Str: "cinim", A: 1373, B: 137, F: nil},
+	{Str: "\u010Dinim", A: 1373, B: 89, F: nil},
+	{Str: "osim", A: 1341, B: 123, F: nil},
+	{Str: "rosim", A: 1376, B: 127, F: nil},
+	{Str: "atim", A: 1341, B: 120, F: nil},
+	{Str: "jetim", A: 1341, B: 118, F: nil},
+	{Str: "evitim", A: 1341, B: 92, F: nil},
+	{Str: "ovitim", A: 1341, B: 93, F: nil},
+	{Str: "astim", A: 1341, B: 94, F: nil},
+	{Str: "avim", A: 1341, B: 77, F: nil},
+	{Str: "evim", A: 1341, B: 78, F: nil},
+	{Str: "ivim", A: 1341, B: 79, F: nil},
+	{Str: "ovim", A: 1341, B: 80, F: nil},
+	{Str: "a\u0107im", A: 1341, B: 14, F: nil},
+	{Str: "e\u0107im", A: 1341, B: 15, F: nil},
+	{Str: "u\u0107im", A: 1341, B: 16, F: nil},
+	{Str: "a\u010Dim", A: 1341, B: 101, F: nil},
+	{Str: "lu\u010Dim", A: 1341, B: 117, F: nil},
+	{Str: "o\u0161im", A: 1341, B: 91, F: nil},
+	{Str: "ro\u0161im", A: 1392, B: 90, F: nil},
+	{Str: "acom", A: -1, B: 124, F: nil},
+	{Str: "ecom", A: -1, B: 125, F: nil},
+	{Str: "ucom", A: -1, B: 126, F: nil},
+	{Str: "gom", A: -1, B: 20, F: nil},
+	{Str: "logom", A: 1397, B: 19, F: nil},
+	{Str: "ugom", A: 1397, B: 18, F: nil},
+	{Str: "bijom", A: -1, B: 32, F: nil},
+	{Str: "cijom", A: -1, B: 33, F: nil},
+	{Str: "dijom", A: -1, B: 34, F: nil},
+	{Str: "fijom", A: -1, B: 40, F: nil},
+	{Str: "gijom", A: -1, B: 39, F: nil},
+	{Str: "lijom", A: -1, B: 35, F: nil},
+	{Str: "mijom", A: -1, B: 37, F: nil},
+	{Str: "nijom", A: -1, B: 36, F: nil},
+	{Str: "ganijom", A: 1407, B: 9, F: nil},
+	{Str: "manijom", A: 1407, B: 6, F: nil},
+	{Str: "panijom", A: 1407, B: 7, F: nil},
+	{Str: "ranijom", A: 1407, B: 8, F: nil},
+	{Str: "tanijom", A: 1407, B: 5, F: nil},
+	{Str: "pijom", A: -1, B: 41, F: nil},
+	{Str: "rijom", A: -1, B: 42, F: nil},
+	{Str: "sijom", A: -1, B: 43, F: nil},
+	{Str: "tijom", A: -1, B: 44, F: nil},
+	{Str: "zijom", A: -1, B: 45, F: nil},
+	{Str: "\u017Eijom", A: -1, B: 38, F: nil},
+	{Str: "anjom", A: -1, B: 84, F: nil},
+	{Str: "enjom", A: -1, B: 85, F: nil},
+	{Str: "snjom", A: -1, B: 122, F: nil},
+	{Str: "\u0161njom", A: -1, B: 86, F: nil},
+	{Str: "kom", A: -1, B: 95, F: nil},
+	{Str: "skom", A: 1423, B: 1, F: nil},
+	{Str: "\u0161kom", A: 1423, B: 2, F: nil},
+	{Str: "alom", A: -1, B: 104, F: nil},
+	{Str: "ijalom", A: 1426, B: 47, F: nil},
+	{Str: "nalom", A: 1426, B: 46, F: nil},
+	{Str: "elom", A: -1, B: 83, F: nil},
+	{Str: "ilom", A: -1, B: 116, F: nil},
+	{Str: "ozilom", A: 1430, B: 48, F: nil},
+	{Str: "olom", A: -1, B: 50, F: nil},
+	{Str: "ramom", A: -1, B: 52, F: nil},
+	{Str: "lemom", A: -1, B: 51, F: nil},
+	{Str: "nom", A: -1, B: 13, F: nil},
+	{Str: "anom", A: 1435, B: 10, F: nil},
+	{Str: "inom", A: 1435, B: 11, F: nil},
+	{Str: "cinom", A: 1437, B: 137, F: nil},
+	{Str: "aninom", A: 1437, B: 10, F: nil},
+	{Str: "\u010Dinom", A: 1437, B: 89, F: nil},
+	{Str: "onom", A: 1435, B: 12, F: nil},
+	{Str: "arom", A: -1, B: 53, F: nil},
+	{Str: "drom", A: -1, B: 54, F: nil},
+	{Str: "erom", A: -1, B: 55, F: nil},
+	{Str: "orom", A: -1, B: 56, F: nil},
+	{Str: "basom", A: -1, B: 135, F: nil},
+	{Str: "gasom", A: -1, B: 131, F: nil},
+	{Str: "jasom", A: -1, B: 129, F: nil},
+	{Str: "kasom", A: -1, B: 133, F: nil},
+	{Str: "nasom", A: -1, B: 132, F: nil},
+	{Str: "tasom", A: -1, B: 130, F: nil},
+	{Str: "vasom", A: -1, B: 134, F: nil},
+	{Str: "esom", A: -1, B: 57, F: nil},
+	{Str: "isom", A: -1, B: 58, F: nil},
+	{Str: "osom", A: -1, B: 123, F: nil},
+	{Str: "atom", A: -1, B: 120, F: nil},
+	{Str: "ikatom", A: 1456, B: 68, F: nil},
+	{Str: "latom", A: 1456, B: 69, F: nil},
+	{Str: "etom", A: -1, B: 70, F: nil},
+	{Str: "evitom", A: -1, B: 92, F: nil},
+	{Str: "ovitom", A: -1, B: 93, F: nil},
+	{Str: "astom", A: -1, B: 94, F: nil},
+	{Str: "estom", A: -1, B: 71, F: nil},
+	{Str: "istom", A: -1, B: 72, F: nil},
+	{Str: "kstom", A: -1, B: 73, F: nil},
+	{Str: "ostom", A: -1, B: 74, F: nil},
+	{Str: "avom", A: -1, B: 77, F: nil},
+	{Str: "evom", A: -1, B: 78, F: nil},
+	{Str: "ivom", A: -1, B: 79, F: nil},
+	{Str: "ovom", A: -1, B: 80, F: nil},
+	{Str: "lovom", A: 1470, B: 82, F: nil},
+	{Str: "movom", A: 1470, B: 81, F: nil},
+	{Str: "stvom", A: -1, B: 3, F: nil},
+	{Str: "\u0161tvom", A: -1, B: 4, F: nil},
+	{Str: "a\u0107om", A: -1, B: 14, F: nil},
+	{Str: "e\u0107om", A: -1, B: 15, F: nil},
+	{Str: "u\u0107om", A: -1, B: 16, F: nil},
+	{Str: "ba\u0161om", A: -1, B: 63, F: nil},
+	{Str: "ga\u0161om", A: -1, B: 64, F: nil},
+	{Str: "ja\u0161om", A: -1, B: 61, F: nil},
+	{Str: "ka\u0161om", A: -1, B: 62, F: nil},
+	{Str: "na\u0161om", A: -1, B: 60, F: nil},
+	{Str: "ta\u0161om", A: -1, B: 59, F: nil},
+	{Str: "va\u0161om", A: -1, B: 65, F: nil},
+	{Str: "e\u0161om", A: -1, B: 66, F: nil},
+	{Str: "i\u0161om", A: -1, B: 67, F: nil},
+	{Str: "o\u0161om", A: -1, B: 91, F: nil},
+	{Str: "an", A: -1, B: 104, F: nil},
+	{Str: "acan", A: 1488, B: 128, F: nil},
+	{Str: "iran", A: 1488, B: 100, F: nil},
+	{Str: "uran", A: 1488, B: 105, F: nil},
+	{Str: "tan", A: 1488, B: 113, F: nil},
+	{Str: "avan", A: 1488, B: 97, F: nil},
+	{Str: "evan", A: 1488, B: 96, F: nil},
+	{Str: "ivan", A: 1488, B: 98, F: nil},
+	{Str: "uvan", A: 1488, B: 99, F: nil},
+	{Str: "a\u010Dan", A: 1488, B: 102, F: nil},
+	{Str: "acen", A: -1, B: 124, F: nil},
+	{Str: "lucen", A: -1, B: 121, F: nil},
+	{Str: "a\u010Den", A: -1, B: 101, F: nil},
+	{Str: "lu\u010Den", A: -1, B: 117, F: nil},
+	{Str: "anin", A: -1, B: 10, F: nil},
+	{Str: "ao", A: -1, B: 104, F: nil},
+	{Str: "acao", A: 1503, B: 128, F: nil},
+	{Str: "astajao", A: 1503, B: 106, F: nil},
+	{Str: "istajao", A: 1503, B: 107, F: nil},
+	{Str: "ostajao", A: 1503, B: 108, F: nil},
+	{Str: "injao", A: 1503, B: 114, F: nil},
+	{Str: "irao", A: 1503, B: 100, F: nil},
+	{Str: "urao", A: 1503, B: 105, F: nil},
+	{Str: "tao", A: 1503, B: 113, F: nil},
+	{Str: "astao", A: 1511, B: 110, F: nil},
+	{Str: "istao", A: 1511, B: 111, F: nil},
+	{Str: "ostao", A: 1511, B: 112, F: nil},
+	{Str: "avao", A: 1503, B: 97, F: nil},
+	{Str: "evao", A: 1503, B: 96, F: nil},
+	{Str: "ivao", A: 1503, B: 98, F: nil},
+	{Str: "ovao", A: 1503, B: 76, F: nil},
+	{Str: "uvao", A: 1503, B: 99, F: nil},
+	{Str: "a\u010Dao", A: 1503, B: 102, F: nil},
+	{Str: "go", A: -1, B: 20, F: nil},
+	{Str: "ugo", A: 1521, B: 18, F: nil},
+	{Str: "io", A: -1, B: 116, F: nil},
+	{Str: "acio", A: 1523, B: 124, F: nil},
+	{Str: "lucio", A: 1523, B: 121, F: nil},
+	{Str: "lio", A: 1523, B: 24, F: nil},
+	{Str: "nio", A: 1523, B: 103, F: nil},
+	{Str: "rario", A: 1523, B: 21, F: nil},
+	{Str: "sio", A: 1523, B: 23, F: nil},
+	{Str: "rosio", A: 1529, B: 127, F: nil},
+	{Str: "jetio", A: 1523, B: 118, F: nil},
+	{Str: "otio", A: 1523, B: 22, F: nil},
+	{Str: "a\u010Dio", A: 1523, B: 101, F: nil},
+	{Str: "lu\u010Dio", A: 1523, B: 117, F: nil},
+	{Str: "ro\u0161io", A: 1523, B: 90, F: nil},
+	{Str: "bijo", A: -1, B: 32, F: nil},
+	{Str: "cijo", A: -1, B: 33, F: nil},
+	{Str: "dijo", A: -1, B: 34, F: nil},
+	{Str: "fijo", A: -1, B: 40, F: nil},
+	{Str: "gijo", A: -1, B: 39, F: nil},
+	{Str: "lijo", A: -1, B: 35, F: nil},
+	{Str: "mijo", A: -1, B: 37, F: nil},
+	{Str: "nijo", A: -1, B: 36, F: nil},
+	{Str: "pijo", A: -1, B: 41, F: nil},
+	{Str: "rijo", A: -1, B: 42, F: nil},
+	{Str: "sijo", A: -1, B: 43, F: nil},
+	{Str: "tijo", A: -1, B: 44, F: nil},
+	{Str: "zijo", A: -1, B: 45, F: nil},
+	{Str: "\u017Eijo", A: -1, B: 38, F: nil},
+	{Str: "anjo", A: -1, B: 84, F: nil},
+	{Str: "enjo", A: -1, B: 85, F: nil},
+	{Str: "snjo", A: -1, B: 122, F: nil},
+	{Str: "\u0161njo", A: -1, B: 86, F: nil},
+	{Str: "ko", A: -1, B: 95, F: nil},
+	{Str: "sko", A: 1554, B: 1, F: nil},
+	{Str: "\u0161ko", A: 1554, B: 2, F: nil},
+	{Str: "alo", A: -1, B: 104, F: nil},
+	{Str: "acalo", A: 1557, B: 128, F: nil},
+	{Str: "astajalo", A: 1557, B: 106, F: nil},
+	{Str: "istajalo", A: 1557, B: 107, F: nil},
+	{Str: "ostajalo", A: 1557, B: 108, F: nil},
+	{Str: "ijalo", A: 1557, B: 47, F: nil},
+	{Str: "injalo", A: 1557, B: 114, F: nil},
+	{Str: "nalo", A: 1557, B: 46, F: nil},
+	{Str: "iralo", A: 1557, B: 100, F: nil},
+	{Str: "uralo", A: 1557, B: 105, F: nil},
+	{Str: "talo", A: 1557, B: 113, F: nil},
+	{Str: "astalo", A: 1567, B: 110, F: nil},
+	{Str: "istalo", A: 1567, B: 111, F: nil},
+	{Str: "ostalo", A: 1567, B: 112, F: nil},
+	{Str: "avalo", A: 1557, B: 97, F: nil},
+	{Str: "evalo", A: 1557, B: 96, F: nil},
+	{Str: "ivalo", A: 1557, B: 98, F: nil},
+	{Str: "ovalo", A: 1557, B: 76, F: nil},
+	{Str: "uvalo", A: 1557, B: 99, F: nil},
+	{Str: "a\u010Dalo", A: 1557, B: 102, F: nil},
+	{Str: "elo", A: -1, B: 83, F: nil},
+	{Str: "ilo", A: -1, B: 116, F: nil},
+	{Str: "acilo", A: 1578, B: 124, F: nil},
+	{Str: "lucilo", A: 1578, B: 121, F: nil},
+	{Str: "nilo", A: 1578, B: 103, F: nil},
+	{Str: "rosilo", A: 1578, B: 127, F: nil},
+	{Str: "jetilo", A: 1578, B: 118, F: nil},
+	{Str: "a\u010Dilo", A: 1578, B: 101, F: nil},
+	{Str: "lu\u010Dilo", A: 1578, B: 117, F: nil},
+	{Str: "ro\u0161ilo", A: 1578, B: 90, F: nil},
+	{Str: "aslo", A: -1, B: 115, F: nil},
+	{Str: "nulo", A: -1, B: 13, F: nil},
+	{Str: "amo", A: -1, B: 104, F: nil},
+	{Str: "acamo", A: 1589, B: 128, F: nil},
+	{Str: "ramo", A: 1589, B: 52, F: nil},
+	{Str: "iramo", A: 1591, B: 100, F: nil},
+	{Str: "uramo", A: 1591, B: 105, F: nil},
+	{Str: "tamo", A: 1589, B: 113, F: nil},
+	{Str: "avamo", A: 1589, B: 97, F: nil},
+	{Str: "evamo", A: 1589, B: 96, F: nil},
+	{Str: "ivamo", A: 1589, B: 98, F: nil},
+	{Str: "uvamo", A: 1589, B: 99, F: nil},
+	{Str: "a\u010Damo", A: 1589, B: 102, F: nil},
+	{Str: "emo", A: -1, B: 119, F: nil},
+	{Str: "astademo", A: 1600, B: 110, F: nil},
+	{Str: "istademo", A: 1600, B: 111, F: nil},
+	{Str: "ostademo", A: 1600, B: 112, F: nil},
+	{Str: "astajemo", A: 1600, B: 106, F: nil},
+	{Str: "istajemo", A: 1600, B: 107, F: nil},
+	{Str: "ostajemo", A: 1600, B: 108, F: nil},
+	{Str: "ijemo", A: 1600, B: 116, F: nil},
+	{Str: "injemo", A: 1600, B: 114, F: nil},
+	{Str: "ujemo", A: 1600, B: 25, F: nil},
+	{Str: "lucujemo", A: 1609, B: 121, F: nil},
+	{Str: "irujemo", A: 1609, B: 100, F: nil},
+	{Str: "lu\u010Dujemo", A: 1609, B: 117, F: nil},
+	{Str: "lemo", A: 1600, B: 51, F: nil},
+	{Str: "nemo", A: 1600, B: 13, F: nil},
+	{Str: "astanemo", A: 1614, B: 110, F: nil},
+	{Str: "istanemo", A: 1614, B: 111, F: nil},
+	{Str: "ostanemo", A: 1614, B: 112, F: nil},
+	{Str: "etemo", A: 1600, B: 70, F: nil},
+	{Str: "astemo", A: 1600, B: 115, F: nil},
+	{Str: "imo", A: -1, B: 116, F: nil},
+	{Str: "acimo", A: 1620, B: 124, F: nil},
+	{Str: "lucimo", A: 1620, B: 121, F: nil},
+	{Str: "nimo", A: 1620, B: 13, F: nil},
+	{Str: "astanimo", A: 1623, B: 110, F: nil},
+	{Str: "istanimo", A: 1623, B: 111, F: nil},
+	{Str: "ostanimo", A: 1623, B: 112, F: nil},
+	{Str: "rosimo", A: 1620, B: 127, F: nil},
+	{Str: "etimo", A: 1620, B: 70, F: nil},
+	{Str: "jetimo", A: 1628, B: 118, F: nil},
+	{Str: "astimo", A: 1620, B: 115, F: nil},
+	{Str: "a\u010Dimo", A: 1620, B: 101, F: nil},
+	{Str: "lu\u010Dimo", A: 1620, B: 117, F: nil},
+	{Str: "ro\u0161imo", A: 1620, B: 90, F: nil},
+	{Str: "ajmo", A: -1, B: 104, F: nil},
+	{Str: "urajmo", A: 1634, B: 105, F: nil},
+	{Str: "tajmo", A: 1634, B: 113, F: nil},
+	{Str: "astajmo", A: 1636, B: 106, F: nil},
+	{Str: "istajmo", A: 1636, B: 107, F: nil},
+	{Str: "ostajmo", A: 1636, B: 108, F: nil},
+	{Str: "avajmo", A: 1634, B: 97, F: nil},
+	{Str: "evajmo", A: 1634, B: 96, F: nil},
+	{Str: "ivajmo", A: 1634, B: 98, F: nil},
+	{Str: "uvajmo", A: 1634, B: 99, F: nil},
+	{Str: "ijmo", A: -1, B: 116, F: nil},
+	{Str: "ujmo", A: -1, B: 25, F: nil},
+	{Str: "lucujmo", A: 1645, B: 121, F: nil},
+	{Str: "irujmo", A: 1645, B: 100, F: nil},
+	{Str: "lu\u010Dujmo", A: 1645, B: 117, F: nil},
+	{Str: "asmo", A: -1, B: 104, F: nil},
+	{Str: "acasmo", A: 1649, B: 128, F: nil},
+	{Str: "astajasmo", A: 1649, B: 106, F: nil},
+	{Str: "istajasmo", A: 1649, B: 107, F: nil},
+	{Str: "ostajasmo", A: 1649, B: 108, F: nil},
+	{Str: "injasmo", A: 1649, B: 114, F: nil},
+	{Str: "irasmo", A: 1649, B: 100, F: nil},
+	{Str: "urasmo", A: 1649, B: 105, F: nil},
+	{Str: "tasmo", A: 1649, B: 113, F: nil},
+	{Str: "avasmo", A: 1649, B: 97, F: nil},
+	{Str: "evasmo", A: 1649, B: 96, F: nil},
+	{Str: "ivasmo", A: 1649, B: 98, F: nil},
+	{Str: "ovasmo", A: 1649, B: 76, F: nil},
+	{Str: "uvasmo", A: 1649, B: 99, F: nil},
+	{Str: "a\u010Dasmo", A: 1649, B: 102, F: nil},
+	{Str: "ismo", A: -1, B: 116, F: nil},
+	{Str: "acismo", A: 1664, B: 124, F: nil},
+	{Str: "lucismo", A: 1664, B: 121, F: nil},
+	{Str: "nismo", A: 1664, B: 103, F: nil},
+	{Str: "rosismo", A: 1664, B: 127, F: nil},
+	{Str: "jetismo", A: 1664, B: 118, F: nil},
+	{Str: "a\u010Dismo", A: 1664, B: 101, F: nil},
+	{Str: "lu\u010Dismo", A: 1664, B: 117, F: nil},
+	{Str: "ro\u0161ismo", A: 1664, B: 90, F: nil},
+	{Str: "astadosmo", A: -1, B: 110, F: nil},
+	{Str: "istadosmo", A: -1, B: 111, F: nil},
+	{Str: "ostadosmo", A: -1, B: 112, F: nil},
+	{Str: "nusmo", A: -1, B: 13, F: nil},
+	{Str: "no", A: -1, B: 13, F: nil},
+	{Str: "ano", A: 1677, B: 104, F: nil},
+	{Str: "acano", A: 1678, B: 128, F: nil},
+	{Str: "urano", A: 1678, B: 105, F: nil},
+	{Str: "tano", A: 1678, B: 113, F: nil},
+	{Str: "avano", A: 1678, B: 97, F: nil},
+	{Str: "evano", A: 1678, B: 96, F: nil},
+	{Str: "ivano", A: 1678, B: 98, F: nil},
+	{Str: "uvano", A: 1678, B: 99, F: nil},
+	{Str: "a\u010Dano", A: 1678, B: 102, F: nil},
+	{Str: "aceno", A: 1677, B: 124, F: nil},
+	{Str: "luceno", A: 1677, B: 121, F: nil},
+	{Str: "a\u010Deno", A: 1677, B: 101, F: nil},
+	{Str: "lu\u010Deno", A: 1677, B: 117, F: nil},
+	{Str: "ino", A: 1677, B: 11, F: nil},
+	{Str: "cino", A: 1691, B: 137, F: nil},
+	{Str: "\u010Dino", A: 1691, B: 89, F: nil},
+	{Str: "ato", A: -1, B: 120, F: nil},
+	{Str: "ikato", A: 1694, B: 68, F: nil},
+	{Str: "lato", A: 1694, B: 69, F: nil},
+	{Str: "eto", A: -1, B: 70, F: nil},
+	{Str: "evito", A: -1, B: 92, F: nil},
+	{Str: "ovito", A: -1, B: 93, F: nil},
+	{Str: "asto", A: -1, B: 94, F: nil},
+	{Str: "esto", A: -1, B: 71, F: nil},
+	{Str: "isto", A: -1, B: 72, F: nil},
+	{Str: "ksto", A: -1, B: 73, F: nil},
+	{Str: "osto", A: -1, B: 74, F: nil},
+	{Str: "nuto", A: -1, B: 13, F: nil},
+	{Str: "nuo", A: -1, B: 13, F: nil},
+	{Str: "avo", A: -1, B: 77, F: nil},
+	{Str: "evo", A: -1, B: 78, F: nil},
+	{Str: "ivo", A: -1, B: 79, F: nil},
+	{Str: "ovo", A: -1, B: 80, F: nil},
+	{Str: "stvo", A: -1, B: 3, F: nil},
+	{Str: "\u0161tvo", A: -1, B: 4, F: nil},
+	{Str: "as", A: -1, B: 161, F: nil},
+	{Str: "acas", A: 1713, B: 128, F: nil},
+	{Str: "iras", A: 1713, B: 155, F: nil},
+	{Str: "uras", A: 1713, B: 156, F: nil},
+	{Str: "tas", A: 1713, B: 160, F: nil},
+	{Str: "avas", A: 1713, B: 144, F: nil},
+	{Str: "evas", A: 1713, B: 145, F: nil},
+	{Str: "ivas", A: 1713, B: 146, F: nil},
+	{Str: "uvas", A: 1713, B: 147, F: nil},
+	{Str: "es", A: -1, B: 163, F: nil},
+	{Str: "astades", A: 1722, B: 141, F: nil},
+	{Str: "istades", A: 1722, B: 142, F: nil},
+	{Str: "ostades", A: 1722, B: 143, F: nil},
+	{Str: "astajes", A: 1722, B: 138, F: nil},
+	{Str: "istajes", A: 1722, B: 139, F: nil},
+	{Str: "ostajes", A: 1722, B: 140, F: nil},
+	{Str: "ijes", A: 1722, B: 162, F: nil},
+	{Str: "injes", A: 1722, B: 150, F: nil},
+	{Str: "ujes", A: 1722, B: 157, F: nil},
+	{Str: "lucujes", A: 1731, B: 121, F: nil},
+	{Str: "irujes", A: 1731, B: 155, F: nil},
+	{Str: "nes", A: 1722, B: 164, F: nil},
+	{Str: "astanes", A: 1734, B: 141, F: nil},
+	{Str: "istanes", A: 1734, B: 142, F: nil},
+	{Str: "ostanes", A: 1734, B: 143, F: nil},
+	{Str: "etes", A: 1722, B: 153, F: nil},
+	{Str: "astes", A: 1722, B: 136, F: nil},
+	{Str: "is", A: -1, B: 162, F: nil},
+	{Str: "acis", A: 1740, B: 124, F: nil},
+	{Str: "lucis", A: 1740, B: 121, F: nil},
+	{Str: "nis", A: 1740, B: 158, F: nil},
+	{Str: "rosis", A: 1740, B: 127, F: nil},
+	{Str: "jetis", A: 1740, B: 149, F: nil},
+	{Str: "at", A: -1, B: 104, F: nil},
+	{Str: "acat", A: 1746, B: 128, F: nil},
+	{Str: "astajat", A: 1746, B: 106, F: nil},
+	{Str: "istajat", A: 1746, B: 107, F: nil},
+	{Str: "ostajat", A: 1746, B: 108, F: nil},
+	{Str: "injat", A: 1746, B: 114, F: nil},
+	{Str: "irat", A: 1746, B: 100, F: nil},
+	{Str: "urat", A: 1746, B: 105, F: nil},
+	{Str: "tat", A: 1746, B: 113, F: nil},
+	{Str: "astat", A: 1754, B: 110, F: nil},
+	{Str: "istat", A: 1754, B: 111, F: nil},
+	{Str: "ostat", A: 1754, B: 112, F: nil},
+	{Str: "avat", A: 1746, B: 97, F: nil},
+	{Str: "evat", A: 1746, B: 96, F: nil},
+	{Str: "ivat", A: 1746, B: 98, F: nil},
+	{Str: "irivat", A: 1760, B: 100, F: nil},
+	{Str: "ovat", A: 1746, B: 76, F: nil},
+	{Str: "uvat", A: 1746, B: 99, F: nil},
+	{Str: "a\u010Dat", A: 1746, B: 102, F: nil},
+	{Str: "it", A: -1, B: 116, F: nil},
+	{Str: "acit", A: 1765, B: 124, F: nil},
+	{Str: "lucit", A: 1765, B: 121, F: nil},
+	{Str: "rosit", A: 1765, B: 127, F: nil},
+	{Str: "jetit", A: 1765, B: 118, F: nil},
+	{Str: "a\u010Dit", A: 1765, B: 101, F: nil},
+	{Str: "lu\u010Dit", A: 1765, B: 117, F: nil},
+	{Str: "ro\u0161it", A: 1765, B: 90, F: nil},
+	{Str: "nut", A: -1, B: 13, F: nil},
+	{Str: "astadu", A: -1, B: 110, F: nil},
+	{Str: "istadu", A: -1, B: 111, F: nil},
+	{Str: "ostadu", A: -1, B: 112, F: nil},
+	{Str: "gu", A: -1, B: 20, F: nil},
+	{Str: "logu", A: 1777, B: 19, F: nil},
+	{Str: "ugu", A: 1777, B: 18, F: nil},
+	{Str: "ahu", A: -1, B: 104, F: nil},
+	{Str: "acahu", A: 1780, B: 128, F: nil},
+	{Str: "astajahu", A: 1780, B: 106, F: nil},
+	{Str: "istajahu", A: 1780, B: 107, F: nil},
+	{Str: "ostajahu", A: 1780, B: 108, F: nil},
+	{Str: "injahu", A: 1780, B: 114, F: nil},
+	{Str: "irahu", A: 1780, B: 100, F: nil},
+	{Str: "urahu", A: 1780, B: 105, F: nil},
+	{Str: "avahu", A: 1780, B: 97, F: nil},
+	{Str: "evahu", A: 1780, B: 96, F: nil},
+	{Str: "ivahu", A: 1780, B: 98, F: nil},
+	{Str: "ovahu", A: 1780, B: 76, F: nil},
+	{Str: "uvahu", A: 1780, B: 99, F: nil},
+	{Str: "a\u010Dahu", A: 1780, B: 102, F: nil},
+	{Str: "aju", A: -1, B: 104, F: nil},
+	{Str: "caju", A: 1794, B: 26, F: nil},
+	{Str: "acaju", A: 1795, B: 128, F: nil},
+	{Str: "laju", A: 1794, B: 30, F: nil},
+	{Str: "raju", A: 1794, B: 31, F: nil},
+	{Str: "iraju", A: 1798, B: 100, F: nil},
+	{Str: "uraju", A: 1798, B: 105, F: nil},
+	{Str: "taju", A: 1794, B: 113, F: nil},
+	{Str: "astaju", A: 1801, B: 106, F: nil},
+	{Str: "istaju", A: 1801, B: 107, F: nil},
+	{Str: "ostaju", A: 1801, B: 108, F: nil},
+	{Str: "avaju", A: 1794, B: 97, F: nil},
+	{Str: "evaju", A: 1794, B: 96, F: nil},
+	{Str: "ivaju", A: 1794, B: 98, F: nil},
+	{Str: "uvaju", A: 1794, B: 99, F: nil},
+	{Str: "\u0107aju", A: 1794, B: 28, F: nil},
+	{Str: "\u010Daju", A: 1794, B: 27, F: nil},
+	{Str: "a\u010Daju", A: 1810, B: 102, F: nil},
+	{Str: "\u0111aju", A: 1794, B: 29, F: nil},
+	{Str: "iju", A: -1, B: 116, F: nil},
+	{Str: "biju", A: 1813, B: 32, F: nil},
+	{Str: "ciju", A: 1813, B: 33, F: nil},
+	{Str: "diju", A: 1813, B: 34, F: nil},
+	{Str: "fiju", A: 1813, B: 40, F: nil},
+	{Str: "giju", A: 1813, B: 39, F: nil},
+	{Str: "anjiju", A: 1813, B: 84, F: nil},
+	{Str: "enjiju", A: 1813, B: 85, F: nil},
+	{Str: "snjiju", A: 1813, B: 122, F: nil},
+	{Str: "\u0161njiju", A: 1813, B: 86, F: nil},
+	{Str: "kiju", A: 1813, B: 95, F: nil},
+	{Str: "liju", A: 1813, B: 24, F: nil},
+	{Str: "eliju", A: 1824, B: 83, F: nil},
+	{Str: "miju", A: 1813, B: 37, F: nil},
+	{Str: "niju", A: 1813, B: 13, F: nil},
+	{Str: "ganiju", A: 1827, B: 9, F: nil},
+	{Str: "maniju", A: 1827, B: 6, F: nil},
+	{Str: "paniju", A: 1827, B: 7, F: nil},
+	{Str: "raniju", A: 1827, B: 8, F: nil},
+	{Str: "taniju", A: 1827, B: 5, F: nil},
+	{Str: "piju", A: 1813, B: 41, F: nil},
+	{Str: "riju", A: 1813, B: 42, F: nil},
+	{Str: "rariju", A: 1834, B: 21, F: nil},
+	{Str: "siju", A: 1813, B: 23, F: nil},
+	{Str: "osiju", A: 1836, B: 123, F: nil},
+	{Str: "tiju", A: 1813, B: 44, F: nil},
+	{Str: "atiju", A: 1838, B: 120, F: nil},
+	{Str: "otiju", A: 1838, B: 22, F: nil},
+	{Str: "aviju", A: 1813, B: 77, F: nil},
+	{Str: "eviju", A: 1813, B: 78, F: nil},
+	{Str: "iviju", A: 1813, B: 79, F: nil},
+	{Str: "oviju", A: 1813, B: 80, F: nil},
+	{Str: "ziju", A: 1813, B: 45, F: nil},
+	{Str: "o\u0161iju", A: 1813, B: 91, F: nil},
+	{Str: "\u017Eiju", A: 1813, B: 38, F: nil},
+	{Str: "anju", A: -1, B: 84, F: nil},
+	{Str: "enju", A: -1, B: 85, F: nil},
+	{Str: "snju", A: -1, B: 122, F: nil},
+	{Str: "\u0161nju", A: -1, B: 86, F: nil},
+	{Str: "uju", A: -1, B: 25, F: nil},
+	{Str: "lucuju", A: 1852, B: 121, F: nil},
+	{Str: "iruju", A: 1852, B: 100, F: nil},
+	{Str: "lu\u010Duju", A: 1852, B: 117, F: nil},
+	{Str: "ku", A: -1, B: 95, F: nil},
+	{Str: "sku", A: 1856, B: 1, F: nil},
+	{Str: "\u0161ku", A: 1856, B: 2, F: nil},
+	{Str: "alu", A: -1, B: 104, F: nil},
+	{Str: "ijalu", A: 1859, B: 47, F: nil},
+	{Str: "nalu", A: 1859, B: 46, F: nil},
+	{Str: "elu", A: -1, B: 83, F: nil},
+	{Str: "ilu", A: -1, B: 116, F: nil},
+	{Str: "ozilu", A: 1863, B: 48, F: nil},
+	{Str: "olu", A: -1, B: 50, F: nil},
+	{Str: "ramu", A: -1, B: 52, F: nil},
+	{Str: "acemu", A: -1, B: 124, F: nil},
+	{Str: "ecemu", A: -1, B: 125, F: nil},
+	{Str: "ucemu", A: -1, B: 126, F: nil},
+	{Str: "anjijemu", A: -1, B: 84, F: nil},
+	{Str: "enjijemu", A: -1, B: 85, F: nil},
+	{Str: "snjijemu", A: -1, B: 122, F: nil},
+	{Str: "\u0161njijemu", A: -1, B: 86, F: nil},
+	{Str: "kijemu", A: -1, B: 95, F: nil},
+	{Str: "skijemu", A: 1874, B: 1, F: nil},
+	{Str: "\u0161kijemu", A: 1874, B: 2, F: nil},
+	{Str: "elijemu", A: -1, B: 83, F: nil},
+	{Str: "nijemu", A: -1, B: 13, F: nil},
+	{Str: "osijemu", A: -1, B: 123, F: nil},
+	{Str: "atijemu", A: -1, B: 120, F: nil},
+	{Str: "evitijemu", A: -1, B: 92, F: nil},
+	{Str: "ovitijemu", A: -1, B: 93, F: nil},
+	{Str: "astijemu", A: -1, B: 94, F: nil},
+	{Str: "avijemu", A: -1, B: 77, F: nil},
+	{Str: "evijemu", A: -1, B: 78, F: nil},
+	{Str: "ivijemu", A: -1, B: 79, F: nil},
+	{Str: "ovijemu", A: -1, B: 80, F: nil},
+	{Str: "o\u0161ijemu", A: -1, B: 91, F: nil},
+	{Str: "anjemu", A: -1, B: 84, F: nil},
+	{Str: "enjemu", A: -1, B: 85, F: nil},
+	{Str: "snjemu", A: -1, B: 122, F: nil},
+	{Str: "\u0161njemu", A: -1, B: 86, F: nil},
+	{Str: "kemu", A: -1, B: 95, F: nil},
+	{Str: "skemu", A: 1893, B: 1, F: nil},
+	{Str: "\u0161kemu", A: 1893, B: 2, F: nil},
+	{Str: "lemu", A: -1, B: 51, F: nil},
+	{Str: "elemu", A: 1896, B: 83, F: nil},
+	{Str: "nemu", A: -1, B: 13, F: nil},
+	{Str: "anemu", A: 1898, B: 10, F: nil},
+	{Str: "enemu", A: 1898, B: 87, F: nil},
+	{Str: "snemu", A: 1898, B: 159, F: nil},
+	{Str: "\u0161nemu", A: 1898, B: 88, F: nil},
+	{Str: "osemu", A: -1, B: 123, F: nil},
+	{Str: "atemu", A: -1, B: 120, F: nil},
+	{Str: "evitemu", A: -1, B: 92, F: nil},
+	{Str: "ovitemu", A: -1, B: 93, F: nil},
+	{Str: "astemu", A: -1, B: 94, F: nil},
+	{Str: "avemu", A: -1, B: 77, F: nil},
+	{Str: "evemu", A: -1, B: 78, F: nil},
+	{Str: "ivemu", A: -1, B: 79, F: nil},
+	{Str: "ovemu", A: -1, B: 80, F: nil},
+	{Str: "a\u0107emu", A: -1, B: 14, F: nil},
+	{Str: "e\u0107emu", A: -1, B: 15, F: nil},
+	{Str: "u\u0107emu", A: -1, B: 16, F: nil},
+	{Str: "o\u0161emu", A: -1, B: 91, F: nil},
+	{Str: "acomu", A: -1, B: 124, F: nil},
+	{Str: "ecomu", A: -1, B: 125, F: nil},
+	{Str: "ucomu", A: -1, B: 126, F: nil},
+	{Str: "anjomu", A: -1, B: 84, F: nil},
+	{Str: "enjomu", A: -1, B: 85, F: nil},
+	{Str: "snjomu", A: -1, B: 122, F: nil},
+	{Str: "\u0161njomu", A: -1, B: 86, F: nil},
+	{Str: "komu", A: -1, B: 95, F: nil},
+	{Str: "skomu", A: 1923, B: 1, F: nil},
+	{Str: "\u0161komu", A: 1923, B: 2, F: nil},
+	{Str: "elomu", A: -1, B: 83, F: nil},
+	{Str: "nomu", A: -1, B: 13, F: nil},
+	{Str: "cinomu", A: 1927, B: 137, F: nil},
+	{Str: "\u010Dinomu", A: 1927, B: 89, F: nil},
+	{Str: "osomu", A: -1, B: 123, F: nil},
+	{Str: "atomu", A: -1, B: 120, F: nil},
+	{Str: "evitomu", A: -1, B: 92, F: nil},
+	{Str: "ovitomu", A: -1, B: 93, F: nil},
+	{Str: "astomu", A: -1, B: 94, F: nil},
+	{Str: "avomu", A: -1, B: 77, F: nil},
+	{Str: "evomu", A: -1, B: 78, F: nil},
+	{Str: "ivomu", A: -1, B: 79, F: nil},
+	{Str: "ovomu", A: -1, B: 80, F: nil},
+	{Str: "a\u0107omu", A: -1, B: 14, F: nil},
+	{Str: "e\u0107omu", A: -1, B: 15, F: nil},
+	{Str: "u\u0107omu", A: -1, B: 16, F: nil},
+	{Str: "o\u0161omu", A: -1, B: 91, F: nil},
+	{Str: "nu", A: -1, B: 13, F: nil},
+	{Str: "anu", A: 1943, B: 10, F: nil},
+	{Str: "astanu", A: 1944, B: 110, F: nil},
+	{Str: "istanu", A: 1944, B: 111, F: nil},
+	{Str: "ostanu", A: 1944, B: 112, F: nil},
+	{Str: "inu", A: 1943, B: 11, F: nil},
+	{Str: "cinu", A: 1948, B: 137, F: nil},
+	{Str: "aninu", A: 1948, B: 10, F: nil},
+	{Str: "\u010Dinu", A: 1948, B: 89, F: nil},
+	{Str: "onu", A: 1943, B: 12, F: nil},
+	{Str: "aru", A: -1, B: 53, F: nil},
+	{Str: "dru", A: -1, B: 54, F: nil},
+	{Str: "eru", A: -1, B: 55, F: nil},
+	{Str: "oru", A: -1, B: 56, F: nil},
+	{Str: "basu", A: -1, B: 135, F: nil},
+	{Str: "gasu", A: -1, B: 131, F: nil},
+	{Str: "jasu", A: -1, B: 129, F: nil},
+	{Str: "kasu", A: -1, B: 133, F: nil},
+	{Str: "nasu", A: -1, B: 132, F: nil},
+	{Str: "tasu", A: -1, B: 130, F: nil},
+	{Str: "vasu", A: -1, B: 134, F: nil},
+	{Str: "esu", A: -1, B: 57, F: nil},
+	{Str: "isu", A: -1, B: 58, F: nil},
+	{Str: "osu", A: -1, B: 123, F: nil},
+	{Str: "atu", A: -1, B: 120, F: nil},
+	{Str: "ikatu", A: 1967, B: 68, F: nil},
+	{Str: "latu", A: 1967, B: 69, F: nil},
+	{Str: "etu", A: -1, B: 70, F: nil},
+	{Str: "evitu", A: -1, B: 92, F: nil},
+	{Str: "ovitu", A: -1, B: 93, F: nil},
+	{Str: "astu", A: -1, B: 94, F: nil},
+	{Str: "estu", A: -1, B: 71, F: nil},
+	{Str: "istu", A: -1, B: 72, F: nil},
+	{Str: "kstu", A: -1, B: 73, F: nil},
+	{Str: "ostu", A: -1, B: 74, F: nil},
+	{Str: "i\u0161tu", A: -1, B: 75, F: nil},
+	{Str: "avu", A: -1, B: 77, F: nil},
+	{Str: "evu", A: -1, B: 78, F: nil},
+	{Str: "ivu", A: -1, B: 79, F: nil},
+	{Str: "ovu", A: -1, B: 80, F: nil},
+	{Str: "lovu", A: 1982, B: 82, F: nil},
+	{Str: "movu", A: 1982, B: 81, F: nil},
+	{Str: "stvu", A: -1, B: 3, F: nil},
+	{Str: "\u0161tvu", A: -1, B: 4, F: nil},
+	{Str: "ba\u0161u", A: -1, B: 63, F: nil},
+	{Str: "ga\u0161u", A: -1, B: 64, F: nil},
+	{Str: "ja\u0161u", A: -1, B: 61, F: nil},
+	{Str: "ka\u0161u", A: -1, B: 62, F: nil},
+	{Str: "na\u0161u", A: -1, B: 60, F: nil},
+	{Str: "ta\u0161u", A: -1, B: 59, F: nil},
+	{Str: "va\u0161u", A: -1, B: 65, F: nil},
+	{Str: "e\u0161u", A: -1, B: 66, F: nil},
+	{Str: "i\u0161u", A: -1, B: 67, F: nil},
+	{Str: "o\u0161u", A: -1, B: 91, F: nil},
+	{Str: "avav", A: -1, B: 97, F: nil},
+	{Str: "evav", A: -1, B: 96, F: nil},
+	{Str: "ivav", A: -1, B: 98, F: nil},
+	{Str: "uvav", A: -1, B: 99, F: nil},
+	{Str: "kov", A: -1, B: 95, F: nil},
+	{Str: "a\u0161", A: -1, B: 104, F: nil},
+	{Str: "ira\u0161", A: 2002, B: 100, F: nil},
+	{Str: "ura\u0161", A: 2002, B: 105, F: nil},
+	{Str: "ta\u0161", A: 2002, B: 113, F: nil},
+	{Str: "ava\u0161", A: 2002, B: 97, F: nil},
+	{Str: "eva\u0161", A: 2002, B: 96, F: nil},
+	{Str: "iva\u0161", A: 2002, B: 98, F: nil},
+	{Str: "uva\u0161", A: 2002, B: 99, F: nil},
+	{Str: "a\u010Da\u0161", A: 2002, B: 102, F: nil},
+	{Str: "e\u0161", A: -1, B: 119, F: nil},
+	{Str: "astade\u0161", A: 2011, B: 110, F: nil},
+	{Str: "istade\u0161", A: 2011, B: 111, F: nil},
+	{Str: "ostade\u0161", A: 2011, B: 112, F: nil},
+	{Str: "astaje\u0161", A: 2011, B: 106, F: nil},
+	{Str: "istaje\u0161", A: 2011, B: 107, F: nil},
+	{Str: "ostaje\u0161", A: 2011, B: 108, F: nil},
+	{Str: "ije\u0161", A: 2011, B: 116, F: nil},
+	{Str: "inje\u0161", A: 2011, B: 114, F: nil},
+	{Str: "uje\u0161", A: 2011, B: 25, F: nil},
+	{Str: "iruje\u0161", A: 2020, B: 100, F: nil},
+	{Str: "lu\u010Duje\u0161", A: 2020, B: 117, F: nil},
+	{Str: "ne\u0161", A: 2011, B: 13, F: nil},
+	{Str: "astane\u0161", A: 2023, B: 110, F: nil},
+	{Str: "istane\u0161", A: 2023, B: 111, F: nil},
+	{Str: "ostane\u0161", A: 2023, B: 112, F: nil},
+	{Str: "ete\u0161", A: 2011, B: 70, F: nil},
+	{Str: "aste\u0161", A: 2011, B: 115, F: nil},
+	{Str: "i\u0161", A: -1, B: 116, F: nil},
+	{Str: "ni\u0161", A: 2029, B: 103, F: nil},
+	{Str: "jeti\u0161", A: 2029, B: 118, F: nil},
+	{Str: "a\u010Di\u0161", A: 2029, B: 101, F: nil},
+	{Str: "lu\u010Di\u0161", A: 2029, B: 117, F: nil},
+	{Str: "ro\u0161i\u0161", A: 2029, B: 90, F: nil},
+}
+
+var A_3 = []*snowballRuntime.Among{
+	{Str: "a", A: -1, B: 1, F: nil},
+	{Str: "oga", A: 0, B: 1, F: nil},
+	{Str: "ama", A: 0, B: 1, F: nil},
+	{Str: "ima", A: 0, B: 1, F: nil},
+	{Str: "ena", A: 0, B: 1, F: nil},
+	{Str: "e", A: -1, B: 1, F: nil},
+	{Str: "og", A: -1, B: 1, F: nil},
+	{Str: "anog", A: 6, B: 1, F: nil},
+	{Str: "enog", A: 6, B: 1, F: nil},
+	{Str: "anih", A: -1, B: 1, F: nil},
+	{Str: "enih", A: -1, B: 1, F: nil},
+	{Str: "i", A: -1, B: 1, F: nil},
+	{Str: "ani", A: 11, B: 1, F: nil},
+	{Str: "eni", A: 11, B: 1, F: nil},
+	{Str: "anoj", A: -1, B: 1, F: nil},
+	{Str: "enoj", A: -1, B: 1, F: nil},
+	{Str: "anim", A: -1, B: 1, F: nil},
+	{Str: "enim", A: -1, B: 1, F: nil},
+	{Str: "om", A: -1, B: 1, F: nil},
+	{Str: "enom", A: 18, B: 1, F: nil},
+	{Str: "o", A: -1, B: 1, F: nil},
+	{Str: "ano", A: 20, B: 1, F: nil},
+	{Str: "eno", A: 20, B: 1, F: nil},
+	{Str: "ost", A: -1, B: 1, F: nil},
+	{Str: "u", A: -1, B: 1, F: nil},
+	{Str: "enu", A: 24, B: 1, F: nil},
+}
+
+var G_v = []byte{17, 65, 16}
+
+var G_sa = []byte{65, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 128}
+
+var G_ca = []byte{119, 95, 23, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 16}
+
+var G_rg = []byte{1}
+
+type Context struct {
+	i_p1            int
+	b_no_diacritics bool
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		i_p1:            0,
+		b_no_diacritics: false,
+	}
+	_ = context
+	var among_var int32
+lab0:
+	for {
+		var v_2 = env.Cursor
+	lab1:
+		for {
+		replab2:
+			for {
+				var v_3 = env.Cursor
+			lab3:
+				for range [2]struct{}{} {
+				golab4:
+					for {
+						var v_4 = env.Cursor
+					lab5:
+						for {
+							env.Bra = env.Cursor
+							among_var = env.FindAmong(A_0, context)
+							if among_var == 0 {
+								break lab5
+							}
+							env.Ket = env.Cursor
+							if among_var == 1 {
+								if !env.SliceFrom("a") {
+									return false
+								}
+							} else if among_var == 2 {
+								if !env.SliceFrom("b") {
+									return false
+								}
+							} else if among_var == 3 {
+								if !env.SliceFrom("v") {
+									return false
+								}
+							} else if among_var == 4 {
+								if !env.SliceFrom("g") {
+									return false
+								}
+							} else if among_var == 5 {
+								if !env.SliceFrom("d") {
+									return false
+								}
+							} else if among_var == 6 {
+								if !env.SliceFrom("\u0111") {
+									return false
+								}
+							} else if among_var == 7 {
+								if !env.SliceFrom("e") {
+									return false
+								}
+							} else if among_var == 8 {
+								if !env.SliceFrom("\u017E") {
+									return false
+								}
+							} else if among_var == 9 {
+								if !env.SliceFrom("z") {
+									return false
+								}
+							} else if among_var == 10 {
+								if !env.SliceFrom("i") {
+									return false
+								}
+							} else if among_var == 11 {
+								if !env.SliceFrom("j") {
+									return false
+								}
+							} else if among_var == 12 {
+								if !env.SliceFrom("k") {
+									return false
+								}
+							} else if among_var == 13 {
+								if !env.SliceFrom("l") {
+									return false
+								}
+							} else if among_var == 14 {
+								if !env.SliceFrom("lj") {
+									return false
+								}
+							} else if among_var == 15 {
+								if !env.SliceFrom("m") {
+									return false
+								}
+							} else if among_var == 16 {
+								if !env.SliceFrom("n") {
+									return false
+								}
+							} else if among_var == 17 {
+								if !env.SliceFrom("nj") {
+									return false
+								}
+							} else if among_var == 18 {
+								if !env.SliceFrom("o") {
+									return false
+								}
+							} else if among_var == 19 {
+								if !env.SliceFrom("p") {
+									return false
+								}
+							} else if among_var == 20 {
+								if !env.SliceFrom("r") {
+									return false
+								}
+							} else if among_var == 21 {
+								if !env.SliceFrom("s") {
+									return false
+								}
+							} else if among_var == 22 {
+								if !env.SliceFrom("t") {
+									return false
+								}
+							} else if among_var == 23 {
+								if !env.SliceFrom("\u0107") {
+									return false
+								}
+							} else if among_var == 24 {
+								if !env.SliceFrom("u") {
+									return false
+								}
+							} else if among_var == 25 {
+								if !env.SliceFrom("f") {
+									return false
+								}
+							} else if among_var == 26 {
+								if !env.SliceFrom("h") {
+									return false
+								}
+							} else if among_var == 27 {
+								if !env.SliceFrom("c") {
+									return false
+								}
+							} else if among_var == 28 {
+								if !env.SliceFrom("\u010D") {
+									return false
+								}
+							} else if among_var == 29 {
+								if !env.SliceFrom("d\u017E") {
+									return false
+								}
+							} else if among_var == 30 {
+								if !env.SliceFrom("\u0161") {
+									return false
+								}
+							}
+							env.Cursor = v_4
+							break golab4
+						}
+						env.Cursor = v_4
+						if env.Cursor >= env.Limit {
+							break lab3
+						}
+						env.NextChar()
+					}
+					continue replab2
+				}
+				env.Cursor = v_3
+				break replab2
+			}
+			break lab1
+		}
+		env.Cursor = v_2
+		break lab0
+	}
+lab6:
+	for {
+		var v_6 = env.Cursor
+	lab7:
+		for {
+		replab8:
+			for {
+				var v_7 = env.Cursor
+			lab9:
+				for range [2]struct{}{} {
+				golab10:
+					for {
+						var v_8 = env.Cursor
+					lab11:
+						for {
+							if !env.InGrouping(G_ca, 98, 382) {
+								break lab11
+							}
+							env.Bra = env.Cursor
+							if !env.EqS("ije") {
+								break lab11
+							}
+							env.Ket = env.Cursor
+							if !env.InGrouping(G_ca, 98, 382) {
+								break lab11
+							}
+							if !env.SliceFrom("e") {
+								return false
+							}
+							env.Cursor = v_8
+							break golab10
+						}
+						env.Cursor = v_8
+						if env.Cursor >= env.Limit {
+							break lab9
+						}
+						env.NextChar()
+					}
+					continue replab8
+				}
+				env.Cursor = v_7
+				break replab8
+			}
+			break lab7
+		}
+		env.Cursor = v_6
+		var v_9 = env.Cursor
+	lab12:
+		for {
+		replab13:
+			for {
+				var v_10 = env.Cursor
+			lab14:
+				for range [2]struct{}{} {
+				golab15:
+					for {
+						var v_11 = env.Cursor
+					lab16:
+						for {
+							if !env.InGrouping(G_ca, 98, 382) {
+								break lab16
+							}
+							env.Bra = env.Cursor
+							if !env.EqS("je") {
+								break lab16
+							}
+							env.Ket = env.Cursor
+							if !env.InGrouping(G_ca, 98, 382) {
+								break lab16
+							}
+							if !env.SliceFrom("e") {
+								return false
+							}
+							env.Cursor = v_11
+							break golab15
+						}
+						env.Cursor = v_11
+						if env.Cursor >= env.Limit {
+							break lab14
+						}
+						env.NextChar()
+					}
+					continue replab13
+				}
+				env.Cursor = v_10
+				break replab13
+			}
+			break lab12
+		}
+		env.Cursor = v_9
+		var v_12 = env.Cursor
+	lab17:
+		for {
+		replab18:
+			for {
+				var v_13 = env.Cursor
+			lab19:
+				for range [2]struct{}{} {
+				golab20:
+					for {
+						var v_14 = env.Cursor
+					lab21:
+						for {
+							env.Bra = env.Cursor
+							if !env.EqS("dj") {
+								break lab21
+							}
+							env.Ket = env.Cursor
+							if !env.SliceFrom("\u0111") {
+								return false
+							}
+							env.Cursor = v_14
+							break golab20
+						}
+						env.Cursor = v_14
+						if env.Cursor >= env.Limit {
+							break lab19
+						}
+						env.NextChar()
+					}
+					continue replab18
+				}
+				env.Cursor = v_13
+				break replab18
+			}
+			break lab17
+		}
+		env.Cursor = v_12
+		break lab6
+	}
+lab22:
+	for {
+		context.b_no_diacritics = true
+		var v_16 = env.Cursor
+	lab23:
+		for {
+		golab24:
+			for {
+			lab25:
+				for {
+					if !env.InGrouping(G_sa, 263, 382) {
+						break lab25
+					}
+					break golab24
+				}
+				if env.Cursor >= env.Limit {
+					break lab23
+				}
+				env.NextChar()
+			}
+			context.b_no_diacritics = false
+			break lab23
+		}
+		env.Cursor = v_16
+		context.i_p1 = env.Limit
+		var v_18 = env.Cursor
+	lab26:
+		for {
+		golab27:
+			for {
+			lab28:
+				for {
+					if !env.InGrouping(G_v, 97, 117) {
+						break lab28
+					}
+					break golab27
+				}
+				if env.Cursor >= env.Limit {
+					break lab26
+				}
+				env.NextChar()
+			}
+			context.i_p1 = env.Cursor
+			if !(context.i_p1 < 2) {
+				break lab26
+			}
+		golab29:
+			for {
+			lab30:
+				for {
+					if !env.OutGrouping(G_v, 97, 117) {
+						break lab30
+					}
+					break golab29
+				}
+				if env.Cursor >= env.Limit {
+					break lab26
+				}
+				env.NextChar()
+			}
+			context.i_p1 = env.Cursor
+			break lab26
+		}
+		env.Cursor = v_18
+		var v_21 = env.Cursor
+	lab31:
+		for {
+		golab32:
+			for {
+			lab33:
+				for {
+					if !env.EqS("r") {
+						break lab33
+					}
+					break golab32
+				}
+				if env.Cursor >= env.Limit {
+					break lab31
+				}
+				env.NextChar()
+			}
+		lab34:
+			for {
+				var v_23 = env.Cursor
+			lab35:
+				for {
+					if !(env.Cursor >= 2) {
+						break lab35
+					}
+					break lab34
+				}
+				env.Cursor = v_23
+			golab36:
+				for {
+				lab37:
+					for {
+						if !env.OutGrouping(G_rg, 114, 114) {
+							break lab37
+						}
+						break golab36
+					}
+					if env.Cursor >= env.Limit {
+						break lab31
+					}
+					env.NextChar()
+				}
+				break lab34
+			}
+			if !((context.i_p1 - env.Cursor) > 1) {
+				break lab31
+			}
+			context.i_p1 = env.Cursor
+			break lab31
+		}
+		env.Cursor = v_21
+		break lab22
+	}
+	env.LimitBackward = env.Cursor
+	env.Cursor = env.Limit
+	var v_25 = env.Limit - env.Cursor
+lab38:
+	for {
+		env.Ket = env.Cursor
+		among_var = env.FindAmongB(A_1, context)
+		if among_var == 0 {
+			break lab38
+		}
+		env.Bra = env.Cursor
+		if among_var == 1 {
+			if !env.SliceFrom("loga") {
+				return false
+			}
+		} else if among_var == 2 {
+			if !env.SliceFrom("peh") {
+				return false
+			}
+		} else if among_var == 3 {
+			if !env.SliceFrom("vojka") {
+				return false
+			}
+		} else if among_var == 4 {
+			if !env.SliceFrom("bojka") {
+				return false
+			}
+		} else if among_var == 5 {
+			if !env.SliceFrom("jak") {
+				return false
+			}
+		} else if among_var == 6 {
+			if !env.SliceFrom("\u010Dajni") {
+				return false
+			}
+		} else if among_var == 7 {
+			if !context.b_no_diacritics {
+				break lab38
+			}
+			if !env.SliceFrom("cajni") {
+				return false
+			}
+		} else if among_var == 8 {
+			if !env.SliceFrom("erni") {
+				return false
+			}
+		} else if among_var == 9 {
+			if !env.SliceFrom("larni") {
+				return false
+			}
+		} else if among_var == 10 {
+			if !env.SliceFrom("esni") {
+				return false
+			}
+		} else if among_var == 11 {
+			if !env.SliceFrom("anjca") {
+				return false
+			}
+		} else if among_var == 12 {
+			if !env.SliceFrom("ajca") {
+				return false
+			}
+		} else if among_var == 13 {
+			if !env.SliceFrom("ljca") {
+				return false
+			}
+		} else if among_var == 14 {
+			if !env.SliceFrom("ejca") {
+				return false
+			}
+		} else if among_var == 15 {
+			if !env.SliceFrom("ojca") {
+				return false
+			}
+		} else if among_var == 16 {
+			if !env.SliceFrom("ajka") {
+				return false
+			}
+		} else if among_var == 17 {
+			if !env.SliceFrom("ojka") {
+				return false
+			}
+		} else if among_var == 18 {
+			if !env.SliceFrom("\u0161ca") {
+				return false
+			}
+		} else if among_var == 19 {
+			if !env.SliceFrom("ing") {
+				return false
+			}
+		} else if among_var == 20 {
+			if !env.SliceFrom("tvenik") {
+				return false
+			}
+		} else if among_var == 21 {
+			if !env.SliceFrom("tetika") {
+				return false
+			}
+		} else if among_var == 22 {
+			if !env.SliceFrom("nstva") {
+				return false
+			}
+		} else if among_var == 23 {
+			if !env.SliceFrom("nik") {
+				return false
+			}
+		} else if among_var == 24 {
+			if !env.SliceFrom("tik") {
+				return false
+			}
+		} else if among_var == 25 {
+			if !env.SliceFrom("zik") {
+				return false
+			}
+		} else if among_var == 26 {
+			if !env.SliceFrom("snik") {
+				return false
+			}
+		} else if among_var == 27 {
+			if !env.SliceFrom("kusi") {
+				return false
+			}
+		} else if among_var == 28 {
+			if !env.SliceFrom("kusni") {
+				return false
+			}
+		} else if among_var == 29 {
+			if !env.SliceFrom("kustva") {
+				return false
+			}
+		} else if among_var == 30 {
+			if !env.SliceFrom("du\u0161ni") {
+				return false
+			}
+		} else if among_var == 31 {
+			if !context.b_no_diacritics {
+				break lab38
+			}
+			if !env.SliceFrom("dusni") {
+				return false
+			}
+		} else if among_var == 32 {
+			if !env.SliceFrom("antni") {
+				return false
+			}
+		} else if among_var == 33 {
+			if !env.SliceFrom("bilni") {
+				return false
+			}
+		} else if among_var == 34 {
+			if !env.SliceFrom("tilni") {
+				return false
+			}
+		} else if among_var == 35 {
+			if !env.SliceFrom("avilni") {
+				return false
+			}
+		} else if among_var == 36 {
+			if !env.SliceFrom("silni") {
+				return false
+			}
+		} else if among_var == 37 {
+			if !env.SliceFrom("gilni") {
+				return false
+			}
+		} else if among_var == 38 {
+			if !env.SliceFrom("rilni") {
+				return false
+			}
+		} else if among_var == 39 {
+			if !env.SliceFrom("nilni") {
+				return false
+			}
+		} else if among_var == 40 {
+			if !env.SliceFrom("alni") {
+				return false
+			}
+		} else if among_var == 41 {
+			if !env.SliceFrom("ozni") {
+				return false
+			}
+		} else if among_var == 42 {
+			if !env.SliceFrom("ravi") {
+				return false
+			}
+		} else if among_var == 43 {
+			if !env.SliceFrom("stavni") {
+				return false
+			}
+		} else if among_var == 44 {
+			if !env.SliceFrom("pravni") {
+				return false
+			}
+		} else if among_var == 45 {
+			if !env.SliceFrom("tivni") {
+				return false
+			}
+		} else if among_var == 46 {
+			if !env.SliceFrom("sivni") {
+				return false
+			}
+		} else if among_var == 47 {
+			if !env.SliceFrom("atni") {
+				return false
+			}
+		} else if among_var == 48 {
+			if !env.SliceFrom("enta") {
+				return false
+			}
+		} else if among_var == 49 {
+			if !env.SliceFrom("tetni") {
+				return false
+			}
+		} else if among_var == 50 {
+			if !env.SliceFrom("pletni") {
+				return false
+			}
+		} else if among_var == 51 {
+			if !env.SliceFrom("\u0161avi") {
+				return false
+			}
+		} else if among_var == 52 {
+			if !context.b_no_diacritics {
+				break lab38
+			}
+			if !env.SliceFrom("savi") {
+				return false
+			}
+		} else if among_var == 53 {
+			if !env.SliceFrom("anta") {
+				return false
+			}
+		} else if among_var == 54 {
+			if !env.SliceFrom("a\u010Dka") {
+				return false
+			}
+		} else if among_var == 55 {
+			if !context.b_no_diacritics {
+				break lab38
+			}
+			if !env.SliceFrom("acka") {
+				return false
+			}
+		} else if among_var == 56 {
+			if !env.SliceFrom("u\u0161ka") {
+				return false
+			}
+		} else if among_var == 57 {
+			if !context.b_no_diacritics {
+				break lab38
+			}
+			if !env.SliceFrom("uska") {
+				return false
+			}
+		} else if among_var == 58 {
+			if !env.SliceFrom("atka") {
+				return false
+			}
+		} else if among_var == 59 {
+			if !env.SliceFrom("etka") {
+				return false
+			}
+		} else if among_var == 60 {
+			if !env.SliceFrom("itka") {
+				return false
+			}
+		} else if among_var == 61 {
+			if !env.SliceFrom("otka") {
+				return false
+			}
+		} else if among_var == 62 {
+			if !env.SliceFrom("utka") {
+				return false
+			}
+		} else if among_var == 63 {
+			if !env.SliceFrom("eskna") {
+				return false
+			}
+		} else if among_var == 64 {
+			if !env.SliceFrom("ti\u010Dni") {
+				return false
+			}
+		} else if among_var == 65 {
+			if !context.b_no_diacritics {
+				break lab38
+			}
+			if !env.SliceFrom("ticni") {
+				return false
+			}
+		} else if among_var == 66 {
+			if !env.SliceFrom("ojska") {
+				return false
+			}
+		} else if among_var == 67 {
+			if !env.SliceFrom("esma") {
+				return false
+			}
+		} else if among_var == 68 {
+			if !env.SliceFrom("metra") {
+				return false
+			}
+		} else if among_var == 69 {
+			if !env.SliceFrom("centra") {
+				return false
+			}
+		} else if among_var == 70 {
+			if !env.SliceFrom("istra") {
+				return false
+			}
+		} else if among_var == 71 {
+			if !env.SliceFrom("osti") {
+				return false
+			}
+		} else if among_var == 72 {
+			if !context.b_no_diacritics {
+				break lab38
+			}
+			if !env.SliceFrom("osti") {
+				return false
+			}
+		} else if among_var == 73 {
+			if !env.SliceFrom("dba") {
+				return false
+			}
+		} else if among_var == 74 {
+			if !env.SliceFrom("\u010Dka") {
+				return false
+			}
+		} else if among_var == 75 {
+			if !env.SliceFrom("mca") {
+				return false
+			}
+		} else if among_var == 76 {
+			if !env.SliceFrom("nca") {
+				return false
+			}
+		} else if among_var == 77 {
+			if !env.SliceFrom("voljni") {
+				return false
+			}
+		} else if among_var == 78 {
+			if !env.SliceFrom("anki") {
+				return false
+			}
+		} else if among_var == 79 {
+			if !env.SliceFrom("vca") {
+				return false
+			}
+		} else if among_var == 80 {
+			if !env.SliceFrom("sca") {
+				return false
+			}
+		} else if among_var == 81 {
+			if !env.SliceFrom("rca") {
+				return false
+			}
+		} else if among_var == 82 {
+			if !env.SliceFrom("alca") {
+				return false
+			}
+		} else if among_var == 83 {
+			if !env.SliceFrom("elca") {
+				return false
+			}
+		} else if among_var == 84 {
+			if !env.SliceFrom("olca") {
+				return false
+			}
+		} else if among_var == 85 {
+			if !env.SliceFrom("njca") {
+				return false
+			}
+		} else if among_var == 86 {
+			if !env.SliceFrom("ekta") {
+				return false
+			}
+		} else if among_var == 87 {
+			if !env.SliceFrom("izma") {
+				return false
+			}
+		} else if among_var == 88 {
+			if !env.SliceFrom("jebi") {
+				return false
+			}
+		} else if among_var == 89 {
+			if !env.SliceFrom("baci") {
+				return false
+			}
+		} else if among_var == 90 {
+			if !env.SliceFrom("a\u0161ni") {
+				return false
+			}
+		} else if among_var == 91 {
+			if !context.b_no_diacritics {
+				break lab38
+			}
+			if !env.SliceFrom("asni") {
+				return false
+			}
+		}
+		break lab38
+	}
+	env.Cursor = env.Limit - v_25
+	var v_26 = env.Limit - env.Cursor
+lab39:
+	for {
+	lab40:
+		for {
+			var v_27 = env.Limit - env.Cursor
+		lab41:
+			for {
+				env.Ket = env.Cursor
+				among_var = env.FindAmongB(A_2, context)
+				if among_var == 0 {
+					break lab41
+				}
+				env.Bra = env.Cursor
+				if !(context.i_p1 <= env.Cursor) {
+					break lab41
+				}
+				if among_var == 1 {
+					if !env.SliceFrom("sk") {
+						return false
+					}
+				} else if among_var == 2 {
+					if !env.SliceFrom("\u0161k") {
+						return false
+					}
+				} else if among_var == 3 {
+					if !env.SliceFrom("stv") {
+						return false
+					}
+				} else if among_var == 4 {
+					if !env.SliceFrom("\u0161tv") {
+						return false
+					}
+				} else if among_var == 5 {
+					if !env.SliceFrom("tanij") {
+						return false
+					}
+				} else if among_var == 6 {
+					if !env.SliceFrom("manij") {
+						return false
+					}
+				} else if among_var == 7 {
+					if !env.SliceFrom("panij") {
+						return false
+					}
+				} else if among_var == 8 {
+					if !env.SliceFrom("ranij") {
+						return false
+					}
+				} else if among_var == 9 {
+					if !env.SliceFrom("ganij") {
+						return false
+					}
+				} else if among_var == 10 {
+					if !env.SliceFrom("an") {
+						return false
+					}
+				} else if among_var == 11 {
+					if !env.SliceFrom("in") {
+						return false
+					}
+				} else if among_var == 12 {
+					if !env.SliceFrom("on") {
+						return false
+					}
+				} else if among_var == 13 {
+					if !env.SliceFrom("n") {
+						return false
+					}
+				} else if among_var == 14 {
+					if !env.SliceFrom("a\u0107") {
+						return false
+					}
+				} else if among_var == 15 {
+					if !env.SliceFrom("e\u0107") {
+						return false
+					}
+				} else if among_var == 16 {
+					if !env.SliceFrom("u\u0107") {
+						return false
+					}
+				} else if among_var == 17 {
+					if !env.SliceFrom("ugov") {
+						return false
+					}
+				} else if among_var == 18 {
+					if !env.SliceFrom("ug") {
+						return false
+					}
+				} else if among_var == 19 {
+					if !env.SliceFrom("log") {
+						return false
+					}
+				} else if among_var == 20 {
+					if !env.SliceFrom("g") {
+						return false
+					}
+				} else if among_var == 21 {
+					if !env.SliceFrom("rari") {
+						return false
+					}
+				} else if among_var == 22 {
+					if !env.SliceFrom("oti") {
+						return false
+					}
+				} else if among_var == 23 {
+					if !env.SliceFrom("si") {
+						return false
+					}
+				} else if among_var == 24 {
+					if !env.SliceFrom("li") {
+						return false
+					}
+				} else if among_var == 25 {
+					if !env.SliceFrom("uj") {
+						return false
+					}
+				} else if among_var == 26 {
+					if !env.SliceFrom("caj") {
+						return false
+					}
+				} else if among_var == 27 {
+					if !env.SliceFrom("\u010Daj") {
+						return false
+					}
+				} else if among_var == 28 {
+					if !env.SliceFrom("\u0107aj") {
+						return false
+					}
+				} else if among_var == 29 {
+					if !env.SliceFrom("\u0111aj") {
+						return false
+					}
+				} else if among_var == 30 {
+					if !env.SliceFrom("laj") {
+						return false
+					}
+				} else if among_var == 31 {
+					if !env.SliceFrom("raj") {
+						return false
+					}
+				} else if among_var == 32 {
+					if !env.SliceFrom("bij") {
+						return false
+					}
+				} else if among_var == 33 {
+					if !env.SliceFrom("cij") {
+						return false
+					}
+				} else if among_var == 34 {
+					if !env.SliceFrom("dij") {
+						return false
+					}
+				} else if among_var == 35 {
+					if !env.SliceFrom("lij") {
+						return false
+					}
+				} else if among_var == 36 {
+					if !env.SliceFrom("nij") {
+						return false
+					}
+				} else if among_var == 37 {
+					if !env.SliceFrom("mij") {
+						return false
+					}
+				} else if among_var == 38 {
+					if !env.SliceFrom("\u017Eij") {
+						return false
+					}
+				} else if among_var == 39 {
+					if !env.SliceFrom("gij") {
+						return false
+					}
+				} else if among_var == 40 {
+					if !env.SliceFrom("fij") {
+						return false
+					}
+				} else if among_var == 41 {
+					if !env.SliceFrom("pij") {
+						return false
+					}
+				} else if among_var == 42 {
+					if !env.SliceFrom("rij") {
+						return false
+					}
+				} else if among_var == 43 {
+					if !env.SliceFrom("sij") {
+						return false
+					}
+				} else if among_var == 44 {
+					if !env.SliceFrom("tij") {
+						return false
+					}
+				} else if among_var == 45 {
+					if !env.SliceFrom("zij") {
+						return false
+					}
+				} else if among_var == 46 {
+					if !env.SliceFrom("nal") {
+						return false
+					}
+				} else if among_var == 47 {
+					if !env.SliceFrom("ijal") {
+						return false
+					}
+				} else if among_var == 48 {
+					if !env.SliceFrom("ozil") {
+						return false
+					}
+				} else if among_var == 49 {
+					if !env.SliceFrom("olov") {
+						return false
+					}
+				} else if among_var == 50 {
+					if !env.SliceFrom("ol") {
+						return false
+					}
+				} else if among_var == 51 {
+					if !env.SliceFrom("lem") {
+						return false
+					}
+				} else if among_var == 52 {
+					if !env.SliceFrom("ram") {
+						return false
+					}
+				} else if among_var == 53 {
+					if !env.SliceFrom("ar") {
+						return false
+					}
+				} else if among_var == 54 {
+					if !env.SliceFrom("dr") {
+						return false
+					}
+				} else if among_var == 55 {
+					if !env.SliceFrom("er") {
+						return false
+					}
+				} else if among_var == 56 {
+					if !env.SliceFrom("or") {
+						return false
+					}
+				} else if among_var == 57 {
+					if !env.SliceFrom("es") {
+						return false
+					}
+				} else if among_var == 58 {
+					if !env.SliceFrom("is") {
+						return false
+					}
+				} else if among_var == 59 {
+					if !env.SliceFrom("ta\u0161") {
+						return false
+					}
+				} else if among_var == 60 {
+					if !env.SliceFrom("na\u0161") {
+						return false
+					}
+				} else if among_var == 61 {
+					if !env.SliceFrom("ja\u0161") {
+						return false
+					}
+				} else if among_var == 62 {
+					if !env.SliceFrom("ka\u0161") {
+						return false
+					}
+				} else if among_var == 63 {
+					if !env.SliceFrom("ba\u0161") {
+						return false
+					}
+				} else if among_var == 64 {
+					if !env.SliceFrom("ga\u0161") {
+						return false
+					}
+				} else if among_var == 65 {
+					if !env.SliceFrom("va\u0161") {
+						return false
+					}
+				} else if among_var == 66 {
+					if !env.SliceFrom("e\u0161") {
+						return false
+					}
+				} else if among_var == 67 {
+					if !env.SliceFrom("i\u0161") {
+						return false
+					}
+				} else if among_var == 68 {
+					if !env.SliceFrom("ikat") {
+						return false
+					}
+				} else if among_var == 69 {
+					if !env.SliceFrom("lat") {
+						return false
+					}
+				} else if among_var == 70 {
+					if !env.SliceFrom("et") {
+						return false
+					}
+				} else if among_var == 71 {
+					if !env.SliceFrom("est") {
+						return false
+					}
+				} else if among_var == 72 {
+					if !env.SliceFrom("ist") {
+						return false
+					}
+				} else if among_var == 73 {
+					if !env.SliceFrom("kst") {
+						return false
+					}
+				} else if among_var == 74 {
+					if !env.SliceFrom("ost") {
+						return false
+					}
+				} else if among_var == 75 {
+					if !env.SliceFrom("i\u0161t") {
+						return false
+					}
+				} else if among_var == 76 {
+					if !env.SliceFrom("ova") {
+						return false
+					}
+				} else if among_var == 77 {
+					if !env.SliceFrom("av") {
+						return false
+					}
+				} else if among_var == 78 {
+					if !env.SliceFrom("ev") {
+						return false
+					}
+				} else if among_var == 79 {
+					if !env.SliceFrom("iv") {
+						return false
+					}
+				} else if among_var == 80 {
+					if !env.SliceFrom("ov") {
+						return false
+					}
+				} else if among_var == 81 {
+					if !env.SliceFrom("mov") {
+						return false
+					}
+				} else if among_var == 82 {
+					if !env.SliceFrom("lov") {
+						return false
+					}
+				} else if among_var == 83 {
+					if !env.SliceFrom("el") {
+						return false
+					}
+				} else if among_var == 84 {
+					if !env.SliceFrom("anj") {
+						return false
+					}
+				} else if among_var == 85 {
+					if !env.SliceFrom("enj") {
+						return false
+					}
+				} else if among_var == 86 {
+					if !env.SliceFrom("\u0161nj") {
+						return false
+					}
+				} else if among_var == 87 {
+					if !env.SliceFrom("en") {
+						return false
+					}
+				} else if among_var == 88 {
+					if !env.SliceFrom("\u0161n") {
+						return false
+					}
+				} else if among_var == 89 {
+					if !env.SliceFrom("\u010Din") {
+						return false
+					}
+				} else if among_var == 90 {
+					if !env.SliceFrom("ro\u0161i") {
+						return false
+					}
+				} else if among_var == 91 {
+					if !env.SliceFrom("o\u0161") {
+						return false
+					}
+				} else if among_var == 92 {
+					if !env.SliceFrom("evit") {
+						return false
+					}
+				} else if among_var == 93 {
+					if !env.SliceFrom("ovit") {
+						return false
+					}
+				} else if among_var == 94 {
+					if !env.SliceFrom("ast") {
+						return false
+					}
+				} else if among_var == 95 {
+					if !env.SliceFrom("k") {
+						return false
+					}
+				} else if among_var == 96 {
+					if !env.SliceFrom("eva") {
+						return false
+					}
+				} else if among_var == 97 {
+					if !env.SliceFrom("ava") {
+						return false
+					}
+				} else if among_var == 98 {
+					if !env.SliceFrom("iva") {
+						return false
+					}
+				} else if among_var == 99 {
+					if !env.SliceFrom("uva") {
+						return false
+					}
+				} else if among_var == 100 {
+					if !env.SliceFrom("ir") {
+						return false
+					}
+				} else if among_var == 101 {
+					if !env.SliceFrom("a\u010D") {
+						return false
+					}
+				} else if among_var == 102 {
+					if !env.SliceFrom("a\u010Da") {
+						return false
+					}
+				} else if among_var == 103 {
+					if !env.SliceFrom("ni") {
+						return false
+					}
+				} else if among_var == 104 {
+					if !env.SliceFrom("a") {
+						return false
+					}
+				} else if among_var == 105 {
+					if !env.SliceFrom("ur") {
+						return false
+					}
+				} else if among_var == 106 {
+					if !env.SliceFrom("astaj") {
+						return false
+					}
+				} else if among_var == 107 {
+					if !env.SliceFrom("istaj") {
+						return false
+					}
+				} else if among_var == 108 {
+					if !env.SliceFrom("ostaj") {
+						return false
+					}
+				} else if among_var == 109 {
+					if !env.SliceFrom("aj") {
+						return false
+					}
+				} else if among_var == 110 {
+					if !env.SliceFrom("asta") {
+						return false
+					}
+				} else if among_var == 111 {
+					if !env.SliceFrom("ista") {
+						return false
+					}
+				} else if among_var == 112 {
+					if !env.SliceFrom("osta") {
+						return false
+					}
+				} else if among_var == 113 {
+					if !env.SliceFrom("ta") {
+						return false
+					}
+				} else if among_var == 114 {
+					if !env.SliceFrom("inj") {
+						return false
+					}
+				} else if among_var == 115 {
+					if !env.SliceFrom("as") {
+						return false
+					}
+				} else if among_var == 116 {
+					if !env.SliceFrom("i") {
+						return false
+					}
+				} else if among_var == 117 {
+					if !env.SliceFrom("lu\u010D") {
+						return false
+					}
+				} else if among_var == 118 {
+					if !env.SliceFrom("jeti") {
+						return false
+					}
+				} else if among_var == 119 {
+					if !env.SliceFrom("e") {
+						return false
+					}
+				} else if among_var == 120 {
+					if !env.SliceFrom("at") {
+						return false
+					}
+				} else if among_var == 121 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("luc") {
+						return false
+					}
+				} else if among_var == 122 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("snj") {
+						return false
+					}
+				} else if among_var == 123 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("os") {
+						return false
+					}
+				} else if among_var == 124 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("ac") {
+						return false
+					}
+				} else if among_var == 125 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("ec") {
+						return false
+					}
+				} else if among_var == 126 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("uc") {
+						return false
+					}
+				} else if among_var == 127 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("rosi") {
+						return false
+					}
+				} else if among_var == 128 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("aca") {
+						return false
+					}
+				} else if among_var == 129 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("jas") {
+						return false
+					}
+				} else if among_var == 130 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("tas") {
+						return false
+					}
+				} else if among_var == 131 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("gas") {
+						return false
+					}
+				} else if among_var == 132 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("nas") {
+						return false
+					}
+				} else if among_var == 133 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("kas") {
+						return false
+					}
+				} else if among_var == 134 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("vas") {
+						return false
+					}
+				} else if among_var == 135 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("bas") {
+						return false
+					}
+				} else if among_var == 136 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("as") {
+						return false
+					}
+				} else if among_var == 137 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("cin") {
+						return false
+					}
+				} else if among_var == 138 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("astaj") {
+						return false
+					}
+				} else if among_var == 139 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("istaj") {
+						return false
+					}
+				} else if among_var == 140 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("ostaj") {
+						return false
+					}
+				} else if among_var == 141 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("asta") {
+						return false
+					}
+				} else if among_var == 142 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("ista") {
+						return false
+					}
+				} else if among_var == 143 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("osta") {
+						return false
+					}
+				} else if among_var == 144 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("ava") {
+						return false
+					}
+				} else if among_var == 145 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("eva") {
+						return false
+					}
+				} else if among_var == 146 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("iva") {
+						return false
+					}
+				} else if among_var == 147 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("uva") {
+						return false
+					}
+				} else if among_var == 148 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("ova") {
+						return false
+					}
+				} else if among_var == 149 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("jeti") {
+						return false
+					}
+				} else if among_var == 150 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("inj") {
+						return false
+					}
+				} else if among_var == 151 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("ist") {
+						return false
+					}
+				} else if among_var == 152 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("es") {
+						return false
+					}
+				} else if among_var == 153 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("et") {
+						return false
+					}
+				} else if among_var == 154 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("is") {
+						return false
+					}
+				} else if among_var == 155 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("ir") {
+						return false
+					}
+				} else if among_var == 156 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("ur") {
+						return false
+					}
+				} else if among_var == 157 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("uj") {
+						return false
+					}
+				} else if among_var == 158 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("ni") {
+						return false
+					}
+				} else if among_var == 159 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("sn") {
+						return false
+					}
+				} else if among_var == 160 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("ta") {
+						return false
+					}
+				} else if among_var == 161 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("a") {
+						return false
+					}
+				} else if among_var == 162 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("i") {
+						return false
+					}
+				} else if among_var == 163 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("e") {
+						return false
+					}
+				} else if among_var == 164 {
+					if !context.b_no_diacritics {
+						break lab41
+					}
+					if !env.SliceFrom("n") {
+						return false
+					}
+				}
+				break lab40
+			}
+			env.Cursor = env.Limit - v_27
+			env.Ket = env.Cursor
+			if env.FindAmongB(A_3, context) == 0 {
+				break lab39
+			}
+			env.Bra = env.Cursor
+			if !(context.i_p1 <= env.Cursor) {
+				break lab39
+			}
+			if !env.SliceFrom("") {
+				return false
+			}
+			break lab40
+		}
+		break lab39
+	}
+	env.Cursor = env.Limit - v_26
+	env.Cursor = env.LimitBackward
+	return true
+}
@@ -0,0 +1,840 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package spanish
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "", A: -1, B: 6, F: nil},
+	{Str: "\u00E1", A: 0, B: 1, F: nil},
+	{Str: "\u00E9", A: 0, B: 2, F: nil},
+	{Str: "\u00ED", A: 0, B: 3, F: nil},
+	{Str: "\u00F3", A: 0, B: 4, F: nil},
+	{Str: "\u00FA", A: 0, B: 5, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "la", A: -1, B: -1, F: nil},
+	{Str: "sela", A: 0, B: -1, F: nil},
+	{Str: "le", A: -1, B: -1, F: nil},
+	{Str: "me", A: -1, B: -1, F: nil},
+	{Str: "se", A: -1, B: -1, F: nil},
+	{Str: "lo", A: -1, B: -1, F: nil},
+	{Str: "selo", A: 5, B: -1, F: nil},
+	{Str: "las", A: -1, B: -1, F: nil},
+	{Str: "selas", A: 7, B: -1, F: nil},
+	{Str: "les", A: -1, B: -1, F: nil},
+	{Str: "los", A: -1, B: -1, F: nil},
+	{Str: "selos", A: 10, B: -1, F: nil},
+	{Str: "nos", A: -1, B: -1, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "ando", A: -1, B: 6, F: nil},
+	{Str: "iendo", A: -1, B: 6, F: nil},
+	{Str: "yendo", A: -1, B: 7, F: nil},
+	{Str: "\u00E1ndo", A: -1, B: 2, F: nil},
+	{Str: "i\u00E9ndo", A: -1, B: 1, F: nil},
+	{Str: "ar", A: -1, B: 6, F: nil},
+	{Str: "er", A: -1, B: 6, F: nil},
+	{Str: "ir", A: -1, B: 6, F: nil},
+	{Str: "\u00E1r", A: -1, B: 3, F: nil},
+	{Str: "\u00E9r", A: -1, B: 4, F: nil},
+	{Str: "\u00EDr", A: -1, B: 5, F: nil},
+}
+
+var A_3 = []*snowballRuntime.Among{
+	{Str: "ic", A: -1, B: -1, F: nil},
+	{Str: "ad", A: -1, B: -1, F: nil},
+	{Str: "os", A: -1, B: -1, F: nil},
+	{Str: "iv", A: -1, B: 1, F: nil},
+}
+
+var A_4 = []*snowballRuntime.Among{
+	{Str: "able", A: -1, B: 1, F: nil},
+	{Str: "ible", A: -1, B: 1, F: nil},
+	{Str: "ante", A: -1, B: 1, F: nil},
+}
+
+var A_5 = []*snowballRuntime.Among{
+	{Str: "ic", A: -1, B: 1, F: nil},
+	{Str: "abil", A: -1, B: 1, F: nil},
+	{Str: "iv", A: -1, B: 1, F: nil},
+}
+
+var A_6 = []*snowballRuntime.Among{
+	{Str: "ica", A: -1, B: 1, F: nil},
+	{Str: "ancia", A: -1, B: 2, F: nil},
+	{Str: "encia", A: -1, B: 5, F: nil},
+	{Str: "adora", A: -1, B: 2, F: nil},
+	{Str: "osa", A: -1, B: 1, F: nil},
+	{Str: "ista", A: -1, B: 1, F: nil},
+	{Str: "iva", A: -1, B: 9, F: nil},
+	{Str: "anza", A: -1, B: 1, F: nil},
+	{Str: "log\u00EDa", A: -1, B: 3, F: nil},
+	{Str: "idad", A: -1, B: 8, F: nil},
+	{Str: "able", A: -1, B: 1, F: nil},
+	{Str: "ible", A: -1, B: 1, F: nil},
+	{Str: "ante", A: -1, B: 2, F: nil},
+	{Str: "mente", A: -1, B: 7, F: nil},
+	{Str: "amente", A: 13, B: 6, F: nil},
+	{Str: "aci\u00F3n", A: -1, B: 2, F: nil},
+	{Str: "uci\u00F3n", A: -1, B: 4, F: nil},
+	{Str: "ico", A: -1, B: 1, F: nil},
+	{Str: "ismo", A: -1, B: 1, F: nil},
+	{Str: "oso", A: -1, B: 1, F: nil},
+	{Str: "amiento", A: -1, B: 1, F: nil},
+	{Str: "imiento", A: -1, B: 1, F: nil},
+	{Str: "ivo", A: -1, B: 9, F: nil},
+	{Str: "ador", A: -1, B: 2, F: nil},
+	{Str: "icas", A: -1, B: 1, F: nil},
+	{Str: "ancias", A: -1, B: 2, F: nil},
+	{Str: "encias", A: -1, B: 5, F: nil},
+	{Str: "adoras", A: -1, B: 2, F: nil},
+	{Str: "osas", A: -1, B: 1, F: nil},
+	{Str: "istas", A: -1, B: 1, F: nil},
+	{Str: "ivas", A: -1, B: 9, F: nil},
+	{Str: "anzas", A: -1, B: 1, F: nil},
+	{Str: "log\u00EDas", A: -1, B: 3, F: nil},
+	{Str: "idades", A: -1, B: 8, F: nil},
+	{Str: "ables", A: -1, B: 1, F: nil},
+	{Str: "ibles", A: -1, B: 1, F: nil},
+	{Str: "aciones", A: -1, B: 2, F: nil},
+	{Str: "uciones", A: -1, B: 4, F: nil},
+	{Str: "adores", A: -1, B: 2, F: nil},
+	{Str: "antes", A: -1, B: 2, F: nil},
+	{Str: "icos", A: -1, B: 1, F: nil},
+	{Str: "ismos", A: -1, B: 1, F: nil},
+	{Str: "osos", A: -1, B: 1, F: nil},
+	{Str: "amientos", A: -1, B: 1, F: nil},
+	{Str: "imientos", A: -1, B: 1, F: nil},
+	{Str: "ivos", A: -1, B: 9, F: nil},
+}
+
+var A_7 = []*snowballRuntime.Among{
+	{Str: "ya", A: -1, B: 1, F: nil},
+	{Str: "ye", A: -1, B: 1, F: nil},
+	{Str: "yan", A: -1, B: 1, F: nil},
+	{Str: "yen", A: -1, B: 1, F: nil},
+	{Str: "yeron", A: -1, B: 1, F: nil},
+	{Str: "yendo", A: -1, B: 1, F: nil},
+	{Str: "yo", A: -1, B: 1, F: nil},
+	{Str: "yas", A: -1, B: 1, F: nil},
+	{Str: "yes", A: -1, B: 1, F: nil},
+	{Str: "yais", A: -1, B: 1, F: nil},
+	{Str: "yamos", A: -1, B: 1, F: nil},
+	{Str: "y\u00F3", A: -1, B: 1, F: nil},
+}
+
+var A_8 = []*snowballRuntime.Among{
+	{Str: "aba", A: -1, B: 2, F: nil},
+	{Str: "ada", A: -1, B: 2, F: nil},
+	{Str: "ida", A: -1, B: 2, F: nil},
+	{Str: "ara", A: -1, B: 2, F: nil},
+	{Str: "iera", A: -1, B: 2, F: nil},
+	{Str: "\u00EDa", A: -1, B: 2, F: nil},
+	{Str: "ar\u00EDa", A: 5, B: 2, F: nil},
+	{Str: "er\u00EDa", A: 5, B: 2, F: nil},
+	{Str: "ir\u00EDa", A: 5, B: 2, F: nil},
+	{Str: "ad", A: -1, B: 2, F: nil},
+	{Str: "ed", A: -1, B: 2, F: nil},
+	{Str: "id", A: -1, B: 2, F: nil},
+	{Str: "ase", A: -1, B: 2, F: nil},
+	{Str: "iese", A: -1, B: 2, F: nil},
+	{Str: "aste", A: -1, B: 2, F: nil},
+	{Str: "iste", A: -1, B: 2, F: nil},
+	{Str: "an", A: -1, B: 2, F: nil},
+	{Str: "aban", A: 16, B: 2, F: nil},
+	{Str: "aran", A: 16, B: 2, F: nil},
+	{Str: "ieran", A: 16, B: 2, F: nil},
+	{Str: "\u00EDan", A: 16, B: 2, F: nil},
+	{Str: "ar\u00EDan", A: 20, B: 2, F: nil},
+	{Str: "er\u00EDan", A: 20, B: 2, F: nil},
+	{Str: "ir\u00EDan", A: 20, B: 2, F: nil},
+	{Str: "en", A: -1, B: 1, F: nil},
+	{Str: "asen", A: 24, B: 2, F: nil},
+	{Str: "iesen", A: 24, B: 2, F: nil},
+	{Str: "aron", A: -1, B: 2, F: nil},
+	{Str: "ieron", A: -1, B: 2, F: nil},
+	{Str: "ar\u00E1n", A: -1, B: 2, F: nil},
+	{Str: "er\u00E1n", A: -1, B: 2, F: nil},
+	{Str: "ir\u00E1n", A: -1, B: 2, F: nil},
+	{Str: "ado", A: -1, B: 2, F: nil},
+	{Str: "ido", A: -1, B: 2, F: nil},
+	{Str: "ando", A: -1, B: 2, F: nil},
+	{Str: "iendo", A: -1, B: 2, F: nil},
+	{Str: "ar", A: -1, B: 2, F: nil},
+	{Str: "er", A: -1, B: 2, F: nil},
+	{Str: "ir", A: -1, B: 2, F: nil},
+	{Str: "as", A: -1, B: 2, F: nil},
+	{Str: "abas", A: 39, B: 2, F: nil},
+	{Str: "adas", A: 39, B: 2, F: nil},
+	{Str: "idas", A: 39, B: 2, F: nil},
+	{Str: "aras", A: 39, B: 2, F: nil},
+	{Str: "ieras", A: 39, B: 2, F: nil},
+	{Str: "\u00EDas", A: 39, B: 2, F: nil},
+	{Str: "ar\u00EDas", A: 45, B: 2, F: nil},
+	{Str: "er\u00EDas", A: 45, B: 2, F: nil},
+	{Str: "ir\u00EDas", A: 45, B: 2, F: nil},
+	{Str: "es", A: -1, B: 1, F: nil},
+	{Str: "ases", A: 49, B: 2, F: nil},
+	{Str: "ieses", A: 49, B: 2, F: nil},
+	{Str: "abais", A: -1, B: 2, F: nil},
+	{Str: "arais", A: -1, B: 2, F: nil},
+	{Str: "ierais", A: -1, B: 2, F: nil},
+	{Str: "\u00EDais", A: -1, B: 2, F: nil},
+	{Str: "ar\u00EDais", A: 55, B: 2, F: nil},
+	{Str: "er\u00EDais", A: 55, B: 2, F: nil},
+	{Str: "ir\u00EDais", A: 55, B: 2, F: nil},
+	{Str: "aseis", A: -1, B: 2, F: nil},
+	{Str: "ieseis", A: -1, B: 2, F: nil},
+	{Str: "asteis", A: -1, B: 2, F: nil},
+	{Str: "isteis", A: -1, B: 2, F: nil},
+	{Str: "\u00E1is", A: -1, B: 2, F: nil},
+	{Str: "\u00E9is", A: -1, B: 1, F: nil},
+	{Str: "ar\u00E9is", A: 64, B: 2, F: nil},
+	{Str: "er\u00E9is", A: 64, B: 2, F: nil},
+	{Str: "ir\u00E9is", A: 64, B: 2, F: nil},
+	{Str: "ados", A: -1, B: 2, F: nil},
+	{Str: "idos", A: -1, B: 2, F: nil},
+	{Str: "amos", A: -1, B: 2, F: nil},
+	{Str: "\u00E1bamos", A: 70, B: 2, F: nil},
+	{Str: "\u00E1ramos", A: 70, B: 2, F: nil},
+	{Str: "i\u00E9ramos", A: 70, B: 2, F: nil},
+	{Str: "\u00EDamos", A: 70, B: 2, F: nil},
+	{Str: "ar\u00EDamos", A: 74, B: 2, F: nil},
+	{Str: "er\u00EDamos", A: 74, B: 2, F: nil},
+	{Str: "ir\u00EDamos", A: 74, B: 2, F: nil},
+	{Str: "emos", A: -1, B: 1, F: nil},
+	{Str: "aremos", A: 78, B: 2, F: nil},
+	{Str: "eremos", A: 78, B: 2, F: nil},
+	{Str: "iremos", A: 78, B: 2, F: nil},
+	{Str: "\u00E1semos", A: 78, B: 2, F: nil},
+	{Str: "i\u00E9semos", A: 78, B: 2, F: nil},
+	{Str: "imos", A: -1, B: 2, F: nil},
+	{Str: "ar\u00E1s", A: -1, B: 2, F: nil},
+	{Str: "er\u00E1s", A: -1, B: 2, F: nil},
+	{Str: "ir\u00E1s", A: -1, B: 2, F: nil},
+	{Str: "\u00EDs", A: -1, B: 2, F: nil},
+	{Str: "ar\u00E1", A: -1, B: 2, F: nil},
+	{Str: "er\u00E1", A: -1, B: 2, F: nil},
+	{Str: "ir\u00E1", A: -1, B: 2, F: nil},
+	{Str: "ar\u00E9", A: -1, B: 2, F: nil},
+	{Str: "er\u00E9", A: -1, B: 2, F: nil},
+	{Str: "ir\u00E9", A: -1, B: 2, F: nil},
+	{Str: "i\u00F3", A: -1, B: 2, F: nil},
+}
+
+var A_9 = []*snowballRuntime.Among{
+	{Str: "a", A: -1, B: 1, F: nil},
+	{Str: "e", A: -1, B: 2, F: nil},
+	{Str: "o", A: -1, B: 1, F: nil},
+	{Str: "os", A: -1, B: 1, F: nil},
+	{Str: "\u00E1", A: -1, B: 1, F: nil},
+	{Str: "\u00E9", A: -1, B: 2, F: nil},
+	{Str: "\u00ED", A: -1, B: 1, F: nil},
+	{Str: "\u00F3", A: -1, B: 1, F: nil},
+}
+
+var G_v = []byte{17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 17, 4, 10}
+
+type Context struct {
+	i_p2 int
+	i_p1 int
+	i_pV int
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		i_p2: 0,
+		i_p1: 0,
+		i_pV: 0,
+	}
+	_ = context
+	var among_var int32
+lab0:
+	for {
+		context.i_pV = env.Limit
+		context.i_p1 = env.Limit
+		context.i_p2 = env.Limit
+		var v_2 = env.Cursor
+	lab1:
+		for {
+		lab2:
+			for {
+				var v_3 = env.Cursor
+			lab3:
+				for {
+					if !env.InGrouping(G_v, 97, 252) {
+						break lab3
+					}
+				lab4:
+					for {
+						var v_4 = env.Cursor
+					lab5:
+						for {
+							if !env.OutGrouping(G_v, 97, 252) {
+								break lab5
+							}
+						golab6:
+							for {
+							lab7:
+								for {
+									if !env.InGrouping(G_v, 97, 252) {
+										break lab7
+									}
+									break golab6
+								}
+								if env.Cursor >= env.Limit {
+									break lab5
+								}
+								env.NextChar()
+							}
+							break lab4
+						}
+						env.Cursor = v_4
+						if !env.InGrouping(G_v, 97, 252) {
+							break lab3
+						}
+					golab8:
+						for {
+						lab9:
+							for {
+								if !env.OutGrouping(G_v, 97, 252) {
+									break lab9
+								}
+								break golab8
+							}
+							if env.Cursor >= env.Limit {
+								break lab3
+							}
+							env.NextChar()
+						}
+						break lab4
+					}
+					break lab2
+				}
+				env.Cursor = v_3
+				if !env.OutGrouping(G_v, 97, 252) {
+					break lab1
+				}
+			lab10:
+				for {
+					var v_7 = env.Cursor
+				lab11:
+					for {
+						if !env.OutGrouping(G_v, 97, 252) {
+							break lab11
+						}
+					golab12:
+						for {
+						lab13:
+							for {
+								if !env.InGrouping(G_v, 97, 252) {
+									break lab13
+								}
+								break golab12
+							}
+							if env.Cursor >= env.Limit {
+								break lab11
+							}
+							env.NextChar()
+						}
+						break lab10
+					}
+					env.Cursor = v_7
+					if !env.InGrouping(G_v, 97, 252) {
+						break lab1
+					}
+					if env.Cursor >= env.Limit {
+						break lab1
+					}
+					env.NextChar()
+					break lab10
+				}
+				break lab2
+			}
+			context.i_pV = env.Cursor
+			break lab1
+		}
+		env.Cursor = v_2
+		var v_9 = env.Cursor
+	lab14:
+		for {
+		golab15:
+			for {
+			lab16:
+				for {
+					if !env.InGrouping(G_v, 97, 252) {
+						break lab16
+					}
+					break golab15
+				}
+				if env.Cursor >= env.Limit {
+					break lab14
+				}
+				env.NextChar()
+			}
+		golab17:
+			for {
+			lab18:
+				for {
+					if !env.OutGrouping(G_v, 97, 252) {
+						break lab18
+					}
+					break golab17
+				}
+				if env.Cursor >= env.Limit {
+					break lab14
+				}
+				env.NextChar()
+			}
+			context.i_p1 = env.Cursor
+		golab19:
+			for {
+			lab20:
+				for {
+					if !env.InGrouping(G_v, 97, 252) {
+						break lab20
+					}
+					break golab19
+				}
+				if env.Cursor >= env.Limit {
+					break lab14
+				}
+				env.NextChar()
+			}
+		golab21:
+			for {
+			lab22:
+				for {
+					if !env.OutGrouping(G_v, 97, 252) {
+						break lab22
+					}
+					break golab21
+				}
+				if env.Cursor >= env.Limit {
+					break lab14
+				}
+				env.NextChar()
+			}
+			context.i_p2 = env.Cursor
+			break lab14
+		}
+		env.Cursor = v_9
+		break lab0
+	}
+	env.LimitBackward = env.Cursor
+	env.Cursor = env.Limit
+	var v_14 = env.Limit - env.Cursor
+lab23:
+	for {
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_1, context) == 0 {
+			break lab23
+		}
+		env.Bra = env.Cursor
+		among_var = env.FindAmongB(A_2, context)
+		if among_var == 0 {
+			break lab23
+		}
+		if !(context.i_pV <= env.Cursor) {
+			break lab23
+		}
+		if among_var == 1 {
+			env.Bra = env.Cursor
+			if !env.SliceFrom("iendo") {
+				return false
+			}
+		} else if among_var == 2 {
+			env.Bra = env.Cursor
+			if !env.SliceFrom("ando") {
+				return false
+			}
+		} else if among_var == 3 {
+			env.Bra = env.Cursor
+			if !env.SliceFrom("ar") {
+				return false
+			}
+		} else if among_var == 4 {
+			env.Bra = env.Cursor
+			if !env.SliceFrom("er") {
+				return false
+			}
+		} else if among_var == 5 {
+			env.Bra = env.Cursor
+			if !env.SliceFrom("ir") {
+				return false
+			}
+		} else if among_var == 6 {
+			if !env.SliceDel() {
+				return false
+			}
+		} else if among_var == 7 {
+			if !env.EqSB("u") {
+				break lab23
+			}
+			if !env.SliceDel() {
+				return false
+			}
+		}
+		break lab23
+	}
+	env.Cursor = env.Limit - v_14
+	var v_15 = env.Limit - env.Cursor
+lab24:
+	for {
+	lab25:
+		for {
+			var v_16 = env.Limit - env.Cursor
+		lab26:
+			for {
+				env.Ket = env.Cursor
+				among_var = env.FindAmongB(A_6, context)
+				if among_var == 0 {
+					break lab26
+				}
+				env.Bra = env.Cursor
+				if among_var == 1 {
+					if !(context.i_p2 <= env.Cursor) {
+						break lab26
+					}
+					if !env.SliceDel() {
+						return false
+					}
+				} else if among_var == 2 {
+					if !(context.i_p2 <= env.Cursor) {
+						break lab26
+					}
+					if !env.SliceDel() {
+						return false
+					}
+					var v_17 = env.Limit - env.Cursor
+				lab27:
+					for {
+						env.Ket = env.Cursor
+						if !env.EqSB("ic") {
+							env.Cursor = env.Limit - v_17
+							break lab27
+						}
+						env.Bra = env.Cursor
+						if !(context.i_p2 <= env.Cursor) {
+							env.Cursor = env.Limit - v_17
+							break lab27
+						}
+						if !env.SliceDel() {
+							return false
+						}
+						break lab27
+					}
+				} else if among_var == 3 {
+					if !(context.i_p2 <= env.Cursor) {
+						break lab26
+					}
+					if !env.SliceFrom("log") {
+						return false
+					}
+				} else if among_var == 4 {
+					if !(context.i_p2 <= env.Cursor) {
+						break lab26
+					}
+					if !env.SliceFrom("u") {
+						return false
+					}
+				} else if among_var == 5 {
+					if !(context.i_p2 <= env.Cursor) {
+						break lab26
+					}
+					if !env.SliceFrom("ente") {
+						return false
+					}
+				} else if among_var == 6 {
+					if !(context.i_p1 <= env.Cursor) {
+						break lab26
+					}
+					if !env.SliceDel() {
+						return false
+					}
+					var v_18 = env.Limit - env.Cursor
+				lab28:
+					for {
+						env.Ket = env.Cursor
+						among_var = env.FindAmongB(A_3, context)
+						if among_var == 0 {
+							env.Cursor = env.Limit - v_18
+							break lab28
+						}
+						env.Bra = env.Cursor
+						if !(context.i_p2 <= env.Cursor) {
+							env.Cursor = env.Limit - v_18
+							break lab28
+						}
+						if !env.SliceDel() {
+							return false
+						}
+						if among_var == 1 {
+							env.Ket = env.Cursor
+							if !env.EqSB("at") {
+								env.Cursor = env.Limit - v_18
+								break lab28
+							}
+							env.Bra = env.Cursor
+							if !(context.i_p2 <= env.Cursor) {
+								env.Cursor = env.Limit - v_18
+								break lab28
+							}
+							if !env.SliceDel() {
+								return false
+							}
+						}
+						break lab28
+					}
+				} else if among_var == 7 {
+					if !(context.i_p2 <= env.Cursor) {
+						break lab26
+					}
+					if !env.SliceDel() {
+						return false
+					}
+					var v_19 = env.Limit - env.Cursor
+				lab29:
+					for {
+						env.Ket = env.Cursor
+						if env.FindAmongB(A_4, context) == 0 {
+							env.Cursor = env.Limit - v_19
+							break lab29
+						}
+						env.Bra = env.Cursor
+						if !(context.i_p2 <= env.Cursor) {
+							env.Cursor = env.Limit - v_19
+							break lab29
+						}
+						if !env.SliceDel() {
+							return false
+						}
+						break lab29
+					}
+				} else if among_var == 8 {
+					if !(context.i_p2 <= env.Cursor) {
+						break lab26
+					}
+					if !env.SliceDel() {
+						return false
+					}
+					var v_20 = env.Limit - env.Cursor
+				lab30:
+					for {
+						env.Ket = env.Cursor
+						if env.FindAmongB(A_5, context) == 0 {
+							env.Cursor = env.Limit - v_20
+							break lab30
+						}
+						env.Bra = env.Cursor
+						if !(context.i_p2 <= env.Cursor) {
+							env.Cursor = env.Limit - v_20
+							break lab30
+						}
+						if !env.SliceDel() {
+							return false
+						}
+						break lab30
+					}
+				} else if among_var == 9 {
+					if !(context.i_p2 <= env.Cursor) {
+						break lab26
+					}
+					if !env.SliceDel() {
+						return false
+					}
+					var v_21 = env.Limit - env.Cursor
+				lab31:
+					for {
+						env.Ket = env.Cursor
+						if !env.EqSB("at") {
+							env.Cursor = env.Limit - v_21
+							break lab31
+						}
+						env.Bra = env.Cursor
+						if !(context.i_p2 <= env.Cursor) {
+							env.Cursor = env.Limit - v_21
+							break lab31
+						}
+						if !env.SliceDel() {
+							return false
+						}
+						break lab31
+					}
+				}
+				break lab25
+			}
+			env.Cursor = env.Limit - v_16
+		lab32:
+			for {
+				if env.Cursor < context.i_pV {
+					break lab32
+				}
+				var v_23 = env.LimitBackward
+				env.LimitBackward = context.i_pV
+				env.Ket = env.Cursor
+				if env.FindAmongB(A_7, context) == 0 {
+					env.LimitBackward = v_23
+					break lab32
+				}
+				env.Bra = env.Cursor
+				env.LimitBackward = v_23
+				if !env.EqSB("u") {
+					break lab32
+				}
+				if !env.SliceDel() {
+					return false
+				}
+				break lab25
+			}
+			env.Cursor = env.Limit - v_16
+			if env.Cursor < context.i_pV {
+				break lab24
+			}
+			var v_25 = env.LimitBackward
+			env.LimitBackward = context.i_pV
+			env.Ket = env.Cursor
+			among_var = env.FindAmongB(A_8, context)
+			if among_var == 0 {
+				env.LimitBackward = v_25
+				break lab24
+			}
+			env.Bra = env.Cursor
+			env.LimitBackward = v_25
+			if among_var == 1 {
+				var v_26 = env.Limit - env.Cursor
+			lab33:
+				for {
+					if !env.EqSB("u") {
+						env.Cursor = env.Limit - v_26
+						break lab33
+					}
+					var v_27 = env.Limit - env.Cursor
+					if !env.EqSB("g") {
+						env.Cursor = env.Limit - v_26
+						break lab33
+					}
+					env.Cursor = env.Limit - v_27
+					break lab33
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+			} else if among_var == 2 {
+				if !env.SliceDel() {
+					return false
+				}
+			}
+			break lab25
+		}
+		break lab24
+	}
+	env.Cursor = env.Limit - v_15
+	var v_28 = env.Limit - env.Cursor
+lab34:
+	for {
+		env.Ket = env.Cursor
+		among_var = env.FindAmongB(A_9, context)
+		if among_var == 0 {
+			break lab34
+		}
+		env.Bra = env.Cursor
+		if among_var == 1 {
+			if !(context.i_pV <= env.Cursor) {
+				break lab34
+			}
+			if !env.SliceDel() {
+				return false
+			}
+		} else if among_var == 2 {
+			if !(context.i_pV <= env.Cursor) {
+				break lab34
+			}
+			if !env.SliceDel() {
+				return false
+			}
+			var v_29 = env.Limit - env.Cursor
+		lab35:
+			for {
+				env.Ket = env.Cursor
+				if !env.EqSB("u") {
+					env.Cursor = env.Limit - v_29
+					break lab35
+				}
+				env.Bra = env.Cursor
+				var v_30 = env.Limit - env.Cursor
+				if !env.EqSB("g") {
+					env.Cursor = env.Limit - v_29
+					break lab35
+				}
+				env.Cursor = env.Limit - v_30
+				if !(context.i_pV <= env.Cursor) {
+					env.Cursor = env.Limit - v_29
+					break lab35
+				}
+				if !env.SliceDel() {
+					return false
+				}
+				break lab35
+			}
+		}
+		break lab34
+	}
+	env.Cursor = env.Limit - v_28
+	env.Cursor = env.LimitBackward
+	var v_31 = env.Cursor
+lab36:
+	for {
+	replab37:
+		for {
+			var v_32 = env.Cursor
+		lab38:
+			for range [2]struct{}{} {
+				env.Bra = env.Cursor
+				among_var = env.FindAmong(A_0, context)
+				if among_var == 0 {
+					break lab38
+				}
+				env.Ket = env.Cursor
+				if among_var == 1 {
+					if !env.SliceFrom("a") {
+						return false
+					}
+				} else if among_var == 2 {
+					if !env.SliceFrom("e") {
+						return false
+					}
+				} else if among_var == 3 {
+					if !env.SliceFrom("i") {
+						return false
+					}
+				} else if among_var == 4 {
+					if !env.SliceFrom("o") {
+						return false
+					}
+				} else if among_var == 5 {
+					if !env.SliceFrom("u") {
+						return false
+					}
+				} else if among_var == 6 {
+					if env.Cursor >= env.Limit {
+						break lab38
+					}
+					env.NextChar()
+				}
+				continue replab37
+			}
+			env.Cursor = v_32
+			break replab37
+		}
+		break lab36
+	}
+	env.Cursor = v_31
+	return true
+}
@@ -0,0 +1,2002 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package tamil
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "\u0B95", A: -1, B: -1, F: nil},
+	{Str: "\u0B99", A: -1, B: -1, F: nil},
+	{Str: "\u0B9A", A: -1, B: -1, F: nil},
+	{Str: "\u0B9E", A: -1, B: -1, F: nil},
+	{Str: "\u0BA4", A: -1, B: -1, F: nil},
+	{Str: "\u0BA8", A: -1, B: -1, F: nil},
+	{Str: "\u0BAA", A: -1, B: -1, F: nil},
+	{Str: "\u0BAE", A: -1, B: -1, F: nil},
+	{Str: "\u0BAF", A: -1, B: -1, F: nil},
+	{Str: "\u0BB5", A: -1, B: -1, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "\u0BA8\u0BCD\u0BA4\u0BCD", A: -1, B: -1, F: nil},
+	{Str: "\u0BA8\u0BCD", A: -1, B: -1, F: nil},
+	{Str: "\u0BA8\u0BCD\u0BA4", A: -1, B: -1, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "\u0BC0", A: -1, B: -1, F: nil},
+	{Str: "\u0BC8", A: -1, B: -1, F: nil},
+	{Str: "\u0BBF", A: -1, B: -1, F: nil},
+}
+
+var A_3 = []*snowballRuntime.Among{
+	{Str: "\u0B95", A: -1, B: -1, F: nil},
+	{Str: "\u0B9A", A: -1, B: -1, F: nil},
+	{Str: "\u0B9F", A: -1, B: -1, F: nil},
+	{Str: "\u0BA4", A: -1, B: -1, F: nil},
+	{Str: "\u0BAA", A: -1, B: -1, F: nil},
+	{Str: "\u0BB1", A: -1, B: -1, F: nil},
+}
+
+var A_4 = []*snowballRuntime.Among{
+	{Str: "\u0B95", A: -1, B: -1, F: nil},
+	{Str: "\u0B9A", A: -1, B: -1, F: nil},
+	{Str: "\u0B9F", A: -1, B: -1, F: nil},
+	{Str: "\u0BA4", A: -1, B: -1, F: nil},
+	{Str: "\u0BAA", A: -1, B: -1, F: nil},
+	{Str: "\u0BB1", A: -1, B: -1, F: nil},
+}
+
+var A_5 = []*snowballRuntime.Among{
+	{Str: "\u0B95", A: -1, B: -1, F: nil},
+	{Str: "\u0B9A", A: -1, B: -1, F: nil},
+	{Str: "\u0B9F", A: -1, B: -1, F: nil},
+	{Str: "\u0BA4", A: -1, B: -1, F: nil},
+	{Str: "\u0BAA", A: -1, B: -1, F: nil},
+	{Str: "\u0BB1", A: -1, B: -1, F: nil},
+}
+
+var A_6 = []*snowballRuntime.Among{
+	{Str: "\u0BAF", A: -1, B: -1, F: nil},
+	{Str: "\u0BB0", A: -1, B: -1, F: nil},
+	{Str: "\u0BB2", A: -1, B: -1, F: nil},
+	{Str: "\u0BB3", A: -1, B: -1, F: nil},
+	{Str: "\u0BB4", A: -1, B: -1, F: nil},
+	{Str: "\u0BB5", A: -1, B: -1, F: nil},
+}
+
+var A_7 = []*snowballRuntime.Among{
+	{Str: "\u0B99", A: -1, B: -1, F: nil},
+	{Str: "\u0B9E", A: -1, B: -1, F: nil},
+	{Str: "\u0BA3", A: -1, B: -1, F: nil},
+	{Str: "\u0BA8", A: -1, B: -1, F: nil},
+	{Str: "\u0BA9", A: -1, B: -1, F: nil},
+	{Str: "\u0BAE", A: -1, B: -1, F: nil},
+}
+
+var A_8 = []*snowballRuntime.Among{
+	{Str: "\u0BB5\u0BCD", A: -1, B: -1, F: nil},
+	{Str: "\u0BAF", A: -1, B: -1, F: nil},
+	{Str: "\u0BB5", A: -1, B: -1, F: nil},
+}
+
+var A_9 = []*snowballRuntime.Among{
+	{Str: "\u0BC0", A: -1, B: -1, F: nil},
+	{Str: "\u0BC1", A: -1, B: -1, F: nil},
+	{Str: "\u0BC2", A: -1, B: -1, F: nil},
+	{Str: "\u0BC6", A: -1, B: -1, F: nil},
+	{Str: "\u0BC7", A: -1, B: -1, F: nil},
+	{Str: "\u0BC8", A: -1, B: -1, F: nil},
+	{Str: "\u0BBE", A: -1, B: -1, F: nil},
+	{Str: "\u0BBF", A: -1, B: -1, F: nil},
+}
+
+var A_10 = []*snowballRuntime.Among{
+	{Str: "\u0BC0", A: -1, B: -1, F: nil},
+	{Str: "\u0BC1", A: -1, B: -1, F: nil},
+	{Str: "\u0BC2", A: -1, B: -1, F: nil},
+	{Str: "\u0BC6", A: -1, B: -1, F: nil},
+	{Str: "\u0BC7", A: -1, B: -1, F: nil},
+	{Str: "\u0BC8", A: -1, B: -1, F: nil},
+	{Str: "\u0BBE", A: -1, B: -1, F: nil},
+	{Str: "\u0BBF", A: -1, B: -1, F: nil},
+}
+
+var A_11 = []*snowballRuntime.Among{
+	{Str: "\u0B85", A: -1, B: -1, F: nil},
+	{Str: "\u0B87", A: -1, B: -1, F: nil},
+	{Str: "\u0B89", A: -1, B: -1, F: nil},
+}
+
+var A_12 = []*snowballRuntime.Among{
+	{Str: "\u0B95", A: -1, B: -1, F: nil},
+	{Str: "\u0B99", A: -1, B: -1, F: nil},
+	{Str: "\u0B9A", A: -1, B: -1, F: nil},
+	{Str: "\u0B9E", A: -1, B: -1, F: nil},
+	{Str: "\u0BA4", A: -1, B: -1, F: nil},
+	{Str: "\u0BA8", A: -1, B: -1, F: nil},
+	{Str: "\u0BAA", A: -1, B: -1, F: nil},
+	{Str: "\u0BAE", A: -1, B: -1, F: nil},
+	{Str: "\u0BAF", A: -1, B: -1, F: nil},
+	{Str: "\u0BB5", A: -1, B: -1, F: nil},
+}
+
+var A_13 = []*snowballRuntime.Among{
+	{Str: "\u0B95", A: -1, B: -1, F: nil},
+	{Str: "\u0B9A", A: -1, B: -1, F: nil},
+	{Str: "\u0B9F", A: -1, B: -1, F: nil},
+	{Str: "\u0BA4", A: -1, B: -1, F: nil},
+	{Str: "\u0BAA", A: -1, B: -1, F: nil},
+	{Str: "\u0BB1", A: -1, B: -1, F: nil},
+}
+
+var A_14 = []*snowballRuntime.Among{
+	{Str: "\u0BC7", A: -1, B: -1, F: nil},
+	{Str: "\u0BCB", A: -1, B: -1, F: nil},
+	{Str: "\u0BBE", A: -1, B: -1, F: nil},
+}
+
+var A_15 = []*snowballRuntime.Among{
+	{Str: "\u0BAA\u0BBF", A: -1, B: -1, F: nil},
+	{Str: "\u0BB5\u0BBF", A: -1, B: -1, F: nil},
+}
+
+var A_16 = []*snowballRuntime.Among{
+	{Str: "\u0BC0", A: -1, B: -1, F: nil},
+	{Str: "\u0BC1", A: -1, B: -1, F: nil},
+	{Str: "\u0BC2", A: -1, B: -1, F: nil},
+	{Str: "\u0BC6", A: -1, B: -1, F: nil},
+	{Str: "\u0BC7", A: -1, B: -1, F: nil},
+	{Str: "\u0BC8", A: -1, B: -1, F: nil},
+	{Str: "\u0BBE", A: -1, B: -1, F: nil},
+	{Str: "\u0BBF", A: -1, B: -1, F: nil},
+}
+
+var A_17 = []*snowballRuntime.Among{
+	{Str: "\u0BAA\u0B9F\u0BCD\u0B9F\u0BC1", A: -1, B: -1, F: nil},
+	{Str: "\u0BB5\u0BBF\u0B9F\u0BCD\u0B9F\u0BC1", A: -1, B: -1, F: nil},
+	{Str: "\u0BAA\u0B9F\u0BC1", A: -1, B: -1, F: nil},
+	{Str: "\u0BB5\u0BBF\u0B9F\u0BC1", A: -1, B: -1, F: nil},
+	{Str: "\u0BAA\u0B9F\u0BCD\u0B9F\u0BA4\u0BC1", A: -1, B: -1, F: nil},
+	{Str: "\u0BC6\u0BB2\u0BCD\u0BB2\u0BBE\u0BAE\u0BCD", A: -1, B: -1, F: nil},
+	{Str: "\u0BAA\u0B9F\u0BCD\u0B9F", A: -1, B: -1, F: nil},
+	{Str: "\u0BAA\u0B9F\u0BCD\u0B9F\u0BA3", A: -1, B: -1, F: nil},
+	{Str: "\u0BA4\u0BBE\u0BA9", A: -1, B: -1, F: nil},
+	{Str: "\u0BAA\u0B9F\u0BBF\u0BA4\u0BBE\u0BA9", A: 8, B: -1, F: nil},
+	{Str: "\u0B95\u0BC1\u0BB0\u0BBF\u0BAF", A: -1, B: -1, F: nil},
+	{Str: "\u0BAA\u0B9F\u0BBF", A: -1, B: -1, F: nil},
+	{Str: "\u0BAA\u0BB1\u0BCD\u0BB1\u0BBF", A: -1, B: -1, F: nil},
+}
+
+var A_18 = []*snowballRuntime.Among{
+	{Str: "\u0B95", A: -1, B: -1, F: nil},
+	{Str: "\u0B9A", A: -1, B: -1, F: nil},
+	{Str: "\u0B9F", A: -1, B: -1, F: nil},
+	{Str: "\u0BA4", A: -1, B: -1, F: nil},
+	{Str: "\u0BAA", A: -1, B: -1, F: nil},
+	{Str: "\u0BB1", A: -1, B: -1, F: nil},
+}
+
+var A_19 = []*snowballRuntime.Among{
+	{Str: "\u0B95", A: -1, B: -1, F: nil},
+	{Str: "\u0B9A", A: -1, B: -1, F: nil},
+	{Str: "\u0B9F", A: -1, B: -1, F: nil},
+	{Str: "\u0BA4", A: -1, B: -1, F: nil},
+	{Str: "\u0BAA", A: -1, B: -1, F: nil},
+	{Str: "\u0BB1", A: -1, B: -1, F: nil},
+}
+
+var A_20 = []*snowballRuntime.Among{
+	{Str: "\u0BC0", A: -1, B: -1, F: nil},
+	{Str: "\u0BC1", A: -1, B: -1, F: nil},
+	{Str: "\u0BC2", A: -1, B: -1, F: nil},
+	{Str: "\u0BC6", A: -1, B: -1, F: nil},
+	{Str: "\u0BC7", A: -1, B: -1, F: nil},
+	{Str: "\u0BC8", A: -1, B: -1, F: nil},
+	{Str: "\u0BBE", A: -1, B: -1, F: nil},
+	{Str: "\u0BBF", A: -1, B: -1, F: nil},
+}
+
+var A_21 = []*snowballRuntime.Among{
+	{Str: "\u0BC0", A: -1, B: -1, F: nil},
+	{Str: "\u0BC1", A: -1, B: -1, F: nil},
+	{Str: "\u0BC2", A: -1, B: -1, F: nil},
+	{Str: "\u0BC6", A: -1, B: -1, F: nil},
+	{Str: "\u0BC7", A: -1, B: -1, F: nil},
+	{Str: "\u0BC8", A: -1, B: -1, F: nil},
+	{Str: "\u0BBE", A: -1, B: -1, F: nil},
+	{Str: "\u0BBF", A: -1, B: -1, F: nil},
+}
+
+var A_22 = []*snowballRuntime.Among{
+	{Str: "\u0BAA\u0B9F\u0BC1", A: -1, B: -1, F: nil},
+	{Str: "\u0B95\u0BCA\u0BA3\u0BCD\u0B9F\u0BBF\u0BB0\u0BCD", A: -1, B: -1, F: nil},
+}
+
+var A_23 = []*snowballRuntime.Among{
+	{Str: "\u0B85", A: -1, B: -1, F: nil},
+	{Str: "\u0B86", A: -1, B: -1, F: nil},
+	{Str: "\u0B87", A: -1, B: -1, F: nil},
+	{Str: "\u0B88", A: -1, B: -1, F: nil},
+	{Str: "\u0B89", A: -1, B: -1, F: nil},
+	{Str: "\u0B8A", A: -1, B: -1, F: nil},
+	{Str: "\u0B8E", A: -1, B: -1, F: nil},
+	{Str: "\u0B8F", A: -1, B: -1, F: nil},
+	{Str: "\u0B90", A: -1, B: -1, F: nil},
+	{Str: "\u0B92", A: -1, B: -1, F: nil},
+	{Str: "\u0B93", A: -1, B: -1, F: nil},
+	{Str: "\u0B94", A: -1, B: -1, F: nil},
+}
+
+var A_24 = []*snowballRuntime.Among{
+	{Str: "\u0BC0", A: -1, B: -1, F: nil},
+	{Str: "\u0BC1", A: -1, B: -1, F: nil},
+	{Str: "\u0BC2", A: -1, B: -1, F: nil},
+	{Str: "\u0BC6", A: -1, B: -1, F: nil},
+	{Str: "\u0BC7", A: -1, B: -1, F: nil},
+	{Str: "\u0BC8", A: -1, B: -1, F: nil},
+	{Str: "\u0BBE", A: -1, B: -1, F: nil},
+	{Str: "\u0BBF", A: -1, B: -1, F: nil},
+}
+
+var A_25 = []*snowballRuntime.Among{
+	{Str: "\u0B95\u0BBF\u0BA9\u0BCD\u0BB1\u0BCD", A: -1, B: -1, F: nil},
+	{Str: "\u0BBE\u0BA8\u0BBF\u0BA9\u0BCD\u0BB1\u0BCD", A: -1, B: -1, F: nil},
+	{Str: "\u0B95\u0BBF\u0BB1\u0BCD", A: -1, B: -1, F: nil},
+	{Str: "\u0B95\u0BBF\u0BA9\u0BCD\u0BB1", A: -1, B: -1, F: nil},
+	{Str: "\u0BBE\u0BA8\u0BBF\u0BA9\u0BCD\u0BB1", A: -1, B: -1, F: nil},
+	{Str: "\u0B95\u0BBF\u0BB1", A: -1, B: -1, F: nil},
+}
+
+type Context struct {
+	b_found_vetrumai_urupu bool
+	b_found_a_match        bool
+}
+
+func r_fix_va_start(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+lab0:
+	for {
+		var v_1 = env.Cursor
+	lab1:
+		for {
+			var v_2 = env.Cursor
+			var v_3 = env.Cursor
+		lab2:
+			for {
+				if !env.EqS("\u0BB5\u0BCB") {
+					env.Cursor = v_3
+					break lab2
+				}
+				break lab2
+			}
+			env.Cursor = v_2
+			env.Bra = env.Cursor
+			if !env.EqS("\u0BB5\u0BCB") {
+				break lab1
+			}
+			env.Ket = env.Cursor
+			if !env.SliceFrom("\u0B93") {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = v_1
+	lab3:
+		for {
+			var v_4 = env.Cursor
+			var v_5 = env.Cursor
+		lab4:
+			for {
+				if !env.EqS("\u0BB5\u0BCA") {
+					env.Cursor = v_5
+					break lab4
+				}
+				break lab4
+			}
+			env.Cursor = v_4
+			env.Bra = env.Cursor
+			if !env.EqS("\u0BB5\u0BCA") {
+				break lab3
+			}
+			env.Ket = env.Cursor
+			if !env.SliceFrom("\u0B92") {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = v_1
+	lab5:
+		for {
+			var v_6 = env.Cursor
+			var v_7 = env.Cursor
+		lab6:
+			for {
+				if !env.EqS("\u0BB5\u0BC1") {
+					env.Cursor = v_7
+					break lab6
+				}
+				break lab6
+			}
+			env.Cursor = v_6
+			env.Bra = env.Cursor
+			if !env.EqS("\u0BB5\u0BC1") {
+				break lab5
+			}
+			env.Ket = env.Cursor
+			if !env.SliceFrom("\u0B89") {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = v_1
+		var v_8 = env.Cursor
+		var v_9 = env.Cursor
+	lab7:
+		for {
+			if !env.EqS("\u0BB5\u0BC2") {
+				env.Cursor = v_9
+				break lab7
+			}
+			break lab7
+		}
+		env.Cursor = v_8
+		env.Bra = env.Cursor
+		if !env.EqS("\u0BB5\u0BC2") {
+			return false
+		}
+		env.Ket = env.Cursor
+		if !env.SliceFrom("\u0B8A") {
+			return false
+		}
+		break lab0
+	}
+	return true
+}
+
+func r_fix_endings(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	var v_1 = env.Cursor
+lab0:
+	for {
+	replab1:
+		for {
+			var v_2 = env.Cursor
+		lab2:
+			for range [2]struct{}{} {
+				if !r_fix_ending(env, context) {
+					break lab2
+				}
+				continue replab1
+			}
+			env.Cursor = v_2
+			break replab1
+		}
+		break lab0
+	}
+	env.Cursor = v_1
+	return true
+}
+
+func r_fix_ending(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if !(snowballRuntime.RuneCountInString(env.Current()) > 3) {
+		return false
+	}
+	env.LimitBackward = env.Cursor
+	env.Cursor = env.Limit
+lab0:
+	for {
+		var v_1 = env.Limit - env.Cursor
+	lab1:
+		for {
+			env.Ket = env.Cursor
+			if env.FindAmongB(A_1, context) == 0 {
+				break lab1
+			}
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+	lab2:
+		for {
+			env.Ket = env.Cursor
+			if !env.EqSB("\u0BAF\u0BCD") {
+				break lab2
+			}
+			var v_2 = env.Limit - env.Cursor
+			if env.FindAmongB(A_2, context) == 0 {
+				break lab2
+			}
+			env.Cursor = env.Limit - v_2
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+	lab3:
+		for {
+			env.Ket = env.Cursor
+		lab4:
+			for {
+				var v_3 = env.Limit - env.Cursor
+			lab5:
+				for {
+					if !env.EqSB("\u0B9F\u0BCD\u0BAA\u0BCD") {
+						break lab5
+					}
+					break lab4
+				}
+				env.Cursor = env.Limit - v_3
+				if !env.EqSB("\u0B9F\u0BCD\u0B95\u0BCD") {
+					break lab3
+				}
+				break lab4
+			}
+			env.Bra = env.Cursor
+			if !env.SliceFrom("\u0BB3\u0BCD") {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+	lab6:
+		for {
+			env.Ket = env.Cursor
+			if !env.EqSB("\u0BA9\u0BCD\u0BB1\u0BCD") {
+				break lab6
+			}
+			env.Bra = env.Cursor
+			if !env.SliceFrom("\u0BB2\u0BCD") {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+	lab7:
+		for {
+			env.Ket = env.Cursor
+			if !env.EqSB("\u0BB1\u0BCD\u0B95\u0BCD") {
+				break lab7
+			}
+			env.Bra = env.Cursor
+			if !env.SliceFrom("\u0BB2\u0BCD") {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+	lab8:
+		for {
+			env.Ket = env.Cursor
+			if !env.EqSB("\u0B9F\u0BCD\u0B9F\u0BCD") {
+				break lab8
+			}
+			env.Bra = env.Cursor
+			if !env.SliceFrom("\u0B9F\u0BC1") {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+	lab9:
+		for {
+			if !context.b_found_vetrumai_urupu {
+				break lab9
+			}
+			env.Ket = env.Cursor
+			if !env.EqSB("\u0BA4\u0BCD\u0BA4\u0BCD") {
+				break lab9
+			}
+			var v_4 = env.Limit - env.Cursor
+			var v_5 = env.Limit - env.Cursor
+		lab10:
+			for {
+				if !env.EqSB("\u0BC8") {
+					break lab10
+				}
+				break lab9
+			}
+			env.Cursor = env.Limit - v_5
+			env.Cursor = env.Limit - v_4
+			env.Bra = env.Cursor
+			if !env.SliceFrom("\u0BAE\u0BCD") {
+				return false
+			}
+			env.Bra = env.Cursor
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+	lab11:
+		for {
+			env.Ket = env.Cursor
+		lab12:
+			for {
+				var v_6 = env.Limit - env.Cursor
+			lab13:
+				for {
+					if !env.EqSB("\u0BC1\u0B95\u0BCD") {
+						break lab13
+					}
+					break lab12
+				}
+				env.Cursor = env.Limit - v_6
+				if !env.EqSB("\u0BC1\u0B95\u0BCD\u0B95\u0BCD") {
+					break lab11
+				}
+				break lab12
+			}
+			env.Bra = env.Cursor
+			if !env.SliceFrom("\u0BCD") {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+	lab14:
+		for {
+			env.Ket = env.Cursor
+			if !env.EqSB("\u0BCD") {
+				break lab14
+			}
+			if env.FindAmongB(A_3, context) == 0 {
+				break lab14
+			}
+			if !env.EqSB("\u0BCD") {
+				break lab14
+			}
+			if env.FindAmongB(A_4, context) == 0 {
+				break lab14
+			}
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+	lab15:
+		for {
+			env.Ket = env.Cursor
+			if !env.EqSB("\u0BC1\u0B95\u0BCD") {
+				break lab15
+			}
+			env.Bra = env.Cursor
+			if !env.SliceFrom("\u0BCD") {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+	lab16:
+		for {
+			env.Ket = env.Cursor
+			if !env.EqSB("\u0BCD") {
+				break lab16
+			}
+			if env.FindAmongB(A_5, context) == 0 {
+				break lab16
+			}
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+	lab17:
+		for {
+			env.Ket = env.Cursor
+			if !env.EqSB("\u0BCD") {
+				break lab17
+			}
+		lab18:
+			for {
+				var v_7 = env.Limit - env.Cursor
+			lab19:
+				for {
+					if env.FindAmongB(A_6, context) == 0 {
+						break lab19
+					}
+					break lab18
+				}
+				env.Cursor = env.Limit - v_7
+				if env.FindAmongB(A_7, context) == 0 {
+					break lab17
+				}
+				break lab18
+			}
+			if !env.EqSB("\u0BCD") {
+				break lab17
+			}
+			env.Bra = env.Cursor
+			if !env.SliceFrom("\u0BCD") {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+	lab20:
+		for {
+			env.Ket = env.Cursor
+			if env.FindAmongB(A_8, context) == 0 {
+				break lab20
+			}
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+	lab21:
+		for {
+			env.Ket = env.Cursor
+			if !env.EqSB("\u0BA9\u0BC1") {
+				break lab21
+			}
+			var v_8 = env.Limit - env.Cursor
+			var v_9 = env.Limit - env.Cursor
+		lab22:
+			for {
+				if env.FindAmongB(A_9, context) == 0 {
+					break lab22
+				}
+				break lab21
+			}
+			env.Cursor = env.Limit - v_9
+			env.Cursor = env.Limit - v_8
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+	lab23:
+		for {
+			env.Ket = env.Cursor
+			if !env.EqSB("\u0B99\u0BCD") {
+				break lab23
+			}
+			var v_10 = env.Limit - env.Cursor
+			var v_11 = env.Limit - env.Cursor
+		lab24:
+			for {
+				if !env.EqSB("\u0BC8") {
+					break lab24
+				}
+				break lab23
+			}
+			env.Cursor = env.Limit - v_11
+			env.Cursor = env.Limit - v_10
+			env.Bra = env.Cursor
+			if !env.SliceFrom("\u0BAE\u0BCD") {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+	lab25:
+		for {
+			env.Ket = env.Cursor
+			if !env.EqSB("\u0B99\u0BCD") {
+				break lab25
+			}
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+		env.Ket = env.Cursor
+		if !env.EqSB("\u0BCD") {
+			return false
+		}
+		var v_12 = env.Limit - env.Cursor
+	lab26:
+		for {
+			var v_13 = env.Limit - env.Cursor
+		lab27:
+			for {
+				if env.FindAmongB(A_10, context) == 0 {
+					break lab27
+				}
+				break lab26
+			}
+			env.Cursor = env.Limit - v_13
+			if !env.EqSB("\u0BCD") {
+				return false
+			}
+			break lab26
+		}
+		env.Cursor = env.Limit - v_12
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		break lab0
+	}
+	env.Cursor = env.LimitBackward
+	return true
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		b_found_vetrumai_urupu: false,
+		b_found_a_match:        false,
+	}
+	_ = context
+	context.b_found_vetrumai_urupu = false
+	var v_1 = env.Cursor
+	r_fix_ending(env, context)
+	env.Cursor = v_1
+	if !(snowballRuntime.RuneCountInString(env.Current()) > 4) {
+		return false
+	}
+	var v_2 = env.Cursor
+lab0:
+	for {
+		env.Bra = env.Cursor
+		if !env.EqS("\u0B8E") {
+			break lab0
+		}
+		if env.FindAmong(A_0, context) == 0 {
+			break lab0
+		}
+		if !env.EqS("\u0BCD") {
+			break lab0
+		}
+		env.Ket = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		var v_3 = env.Cursor
+		r_fix_va_start(env, context)
+		env.Cursor = v_3
+		break lab0
+	}
+	env.Cursor = v_2
+	var v_4 = env.Cursor
+lab1:
+	for {
+		context.b_found_a_match = false
+		env.Bra = env.Cursor
+		if env.FindAmong(A_11, context) == 0 {
+			break lab1
+		}
+		if env.FindAmong(A_12, context) == 0 {
+			break lab1
+		}
+		if !env.EqS("\u0BCD") {
+			break lab1
+		}
+		env.Ket = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_found_a_match = true
+		var v_5 = env.Cursor
+		r_fix_va_start(env, context)
+		env.Cursor = v_5
+		break lab1
+	}
+	env.Cursor = v_4
+	var v_6 = env.Cursor
+lab2:
+	for {
+		if !(snowballRuntime.RuneCountInString(env.Current()) > 4) {
+			break lab2
+		}
+		context.b_found_a_match = false
+		env.LimitBackward = env.Cursor
+		env.Cursor = env.Limit
+		var v_7 = env.Limit - env.Cursor
+	lab3:
+		for {
+			env.Ket = env.Cursor
+			if env.FindAmongB(A_14, context) == 0 {
+				break lab3
+			}
+			env.Bra = env.Cursor
+			if !env.SliceFrom("\u0BCD") {
+				return false
+			}
+			context.b_found_a_match = true
+			break lab3
+		}
+		env.Cursor = env.Limit - v_7
+		env.Cursor = env.LimitBackward
+		r_fix_endings(env, context)
+		break lab2
+	}
+	env.Cursor = v_6
+	var v_9 = env.Cursor
+lab4:
+	for {
+		context.b_found_a_match = false
+		if !(snowballRuntime.RuneCountInString(env.Current()) > 4) {
+			break lab4
+		}
+		env.LimitBackward = env.Cursor
+		env.Cursor = env.Limit
+		env.Ket = env.Cursor
+		if !env.EqSB("\u0BC1\u0BAE\u0BCD") {
+			break lab4
+		}
+		env.Bra = env.Cursor
+		if !env.SliceFrom("\u0BCD") {
+			return false
+		}
+		context.b_found_a_match = true
+		env.Cursor = env.LimitBackward
+		var v_10 = env.Cursor
+		r_fix_ending(env, context)
+		env.Cursor = v_10
+		break lab4
+	}
+	env.Cursor = v_9
+	var v_11 = env.Cursor
+lab5:
+	for {
+		context.b_found_a_match = false
+		if !(snowballRuntime.RuneCountInString(env.Current()) > 4) {
+			break lab5
+		}
+		env.LimitBackward = env.Cursor
+		env.Cursor = env.Limit
+	lab6:
+		for {
+			var v_12 = env.Limit - env.Cursor
+		lab7:
+			for {
+				var v_13 = env.Limit - env.Cursor
+				env.Ket = env.Cursor
+			lab8:
+				for {
+					var v_14 = env.Limit - env.Cursor
+				lab9:
+					for {
+						if !env.EqSB("\u0BC1\u0B9F\u0BA9\u0BCD") {
+							break lab9
+						}
+						break lab8
+					}
+					env.Cursor = env.Limit - v_14
+				lab10:
+					for {
+						if !env.EqSB("\u0BBF\u0BB2\u0BCD\u0BB2\u0BC8") {
+							break lab10
+						}
+						break lab8
+					}
+					env.Cursor = env.Limit - v_14
+				lab11:
+					for {
+						if !env.EqSB("\u0BBF\u0B9F\u0BAE\u0BCD") {
+							break lab11
+						}
+						break lab8
+					}
+					env.Cursor = env.Limit - v_14
+				lab12:
+					for {
+						if !env.EqSB("\u0BBF\u0BA9\u0BCD\u0BB1\u0BBF") {
+							break lab12
+						}
+						break lab8
+					}
+					env.Cursor = env.Limit - v_14
+				lab13:
+					for {
+						if !env.EqSB("\u0BBE\u0B95\u0BBF") {
+							break lab13
+						}
+						break lab8
+					}
+					env.Cursor = env.Limit - v_14
+				lab14:
+					for {
+						if !env.EqSB("\u0BBE\u0B95\u0BBF\u0BAF") {
+							break lab14
+						}
+						break lab8
+					}
+					env.Cursor = env.Limit - v_14
+				lab15:
+					for {
+						if !env.EqSB("\u0BC6\u0BA9\u0BCD\u0BB1\u0BC1") {
+							break lab15
+						}
+						break lab8
+					}
+					env.Cursor = env.Limit - v_14
+				lab16:
+					for {
+						if !env.EqSB("\u0BC1\u0BB3\u0BCD\u0BB3") {
+							break lab16
+						}
+						break lab8
+					}
+					env.Cursor = env.Limit - v_14
+				lab17:
+					for {
+						if !env.EqSB("\u0BC1\u0B9F\u0BC8\u0BAF") {
+							break lab17
+						}
+						break lab8
+					}
+					env.Cursor = env.Limit - v_14
+				lab18:
+					for {
+						if !env.EqSB("\u0BC1\u0B9F\u0BC8") {
+							break lab18
+						}
+						break lab8
+					}
+					env.Cursor = env.Limit - v_14
+				lab19:
+					for {
+						if !env.EqSB("\u0BC6\u0BA9\u0BC1\u0BAE\u0BCD") {
+							break lab19
+						}
+						break lab8
+					}
+					env.Cursor = env.Limit - v_14
+				lab20:
+					for {
+						if !env.EqSB("\u0BB2\u0BCD\u0BB2") {
+							break lab20
+						}
+						var v_15 = env.Limit - env.Cursor
+						var v_16 = env.Limit - env.Cursor
+					lab21:
+						for {
+							if env.FindAmongB(A_16, context) == 0 {
+								break lab21
+							}
+							break lab20
+						}
+						env.Cursor = env.Limit - v_16
+						env.Cursor = env.Limit - v_15
+						break lab8
+					}
+					env.Cursor = env.Limit - v_14
+				lab22:
+					for {
+						if !env.EqSB("\u0BC6\u0BA9") {
+							break lab22
+						}
+						break lab8
+					}
+					env.Cursor = env.Limit - v_14
+					if !env.EqSB("\u0BBE\u0B95\u0BBF") {
+						break lab7
+					}
+					break lab8
+				}
+				env.Bra = env.Cursor
+				if !env.SliceFrom("\u0BCD") {
+					return false
+				}
+				context.b_found_a_match = true
+				env.Cursor = env.Limit - v_13
+				break lab6
+			}
+			env.Cursor = env.Limit - v_12
+			var v_17 = env.Limit - env.Cursor
+			env.Ket = env.Cursor
+			if env.FindAmongB(A_17, context) == 0 {
+				break lab5
+			}
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			context.b_found_a_match = true
+			env.Cursor = env.Limit - v_17
+			break lab6
+		}
+		env.Cursor = env.LimitBackward
+		r_fix_endings(env, context)
+		break lab5
+	}
+	env.Cursor = v_11
+	var v_19 = env.Cursor
+lab23:
+	for {
+		context.b_found_a_match = false
+		context.b_found_vetrumai_urupu = false
+		if !(snowballRuntime.RuneCountInString(env.Current()) > 4) {
+			break lab23
+		}
+		env.LimitBackward = env.Cursor
+		env.Cursor = env.Limit
+	lab24:
+		for {
+			var v_20 = env.Limit - env.Cursor
+		lab25:
+			for {
+				var v_21 = env.Limit - env.Cursor
+				env.Ket = env.Cursor
+				if !env.EqSB("\u0BA9\u0BC8") {
+					break lab25
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				env.Cursor = env.Limit - v_21
+				break lab24
+			}
+			env.Cursor = env.Limit - v_20
+		lab26:
+			for {
+				var v_22 = env.Limit - env.Cursor
+				env.Ket = env.Cursor
+			lab27:
+				for {
+					var v_23 = env.Limit - env.Cursor
+				lab28:
+					for {
+					lab29:
+						for {
+							var v_24 = env.Limit - env.Cursor
+						lab30:
+							for {
+								if !env.EqSB("\u0BBF\u0BA9\u0BC8") {
+									break lab30
+								}
+								break lab29
+							}
+							env.Cursor = env.Limit - v_24
+							if !env.EqSB("\u0BC8") {
+								break lab28
+							}
+							break lab29
+						}
+						var v_25 = env.Limit - env.Cursor
+						var v_26 = env.Limit - env.Cursor
+					lab31:
+						for {
+							if env.FindAmongB(A_18, context) == 0 {
+								break lab31
+							}
+							break lab28
+						}
+						env.Cursor = env.Limit - v_26
+						env.Cursor = env.Limit - v_25
+						break lab27
+					}
+					env.Cursor = env.Limit - v_23
+					if !env.EqSB("\u0BC8") {
+						break lab26
+					}
+					var v_27 = env.Limit - env.Cursor
+					if env.FindAmongB(A_19, context) == 0 {
+						break lab26
+					}
+					if !env.EqSB("\u0BCD") {
+						break lab26
+					}
+					env.Cursor = env.Limit - v_27
+					break lab27
+				}
+				env.Bra = env.Cursor
+				if !env.SliceFrom("\u0BCD") {
+					return false
+				}
+				env.Cursor = env.Limit - v_22
+				break lab24
+			}
+			env.Cursor = env.Limit - v_20
+		lab32:
+			for {
+				var v_28 = env.Limit - env.Cursor
+				env.Ket = env.Cursor
+			lab33:
+				for {
+					var v_29 = env.Limit - env.Cursor
+				lab34:
+					for {
+						if !env.EqSB("\u0BCA\u0B9F\u0BC1") {
+							break lab34
+						}
+						break lab33
+					}
+					env.Cursor = env.Limit - v_29
+				lab35:
+					for {
+						if !env.EqSB("\u0BCB\u0B9F\u0BC1") {
+							break lab35
+						}
+						break lab33
+					}
+					env.Cursor = env.Limit - v_29
+				lab36:
+					for {
+						if !env.EqSB("\u0BBF\u0BB2\u0BCD") {
+							break lab36
+						}
+						break lab33
+					}
+					env.Cursor = env.Limit - v_29
+				lab37:
+					for {
+						if !env.EqSB("\u0BBF\u0BB1\u0BCD") {
+							break lab37
+						}
+						break lab33
+					}
+					env.Cursor = env.Limit - v_29
+				lab38:
+					for {
+						if !env.EqSB("\u0BBF\u0BA9\u0BCD") {
+							break lab38
+						}
+						var v_30 = env.Limit - env.Cursor
+						var v_31 = env.Limit - env.Cursor
+					lab39:
+						for {
+							if !env.EqSB("\u0BAE") {
+								break lab39
+							}
+							break lab38
+						}
+						env.Cursor = env.Limit - v_31
+						env.Cursor = env.Limit - v_30
+						break lab33
+					}
+					env.Cursor = env.Limit - v_29
+				lab40:
+					for {
+						if !env.EqSB("\u0BBF\u0BA9\u0BCD\u0BB1\u0BC1") {
+							break lab40
+						}
+						break lab33
+					}
+					env.Cursor = env.Limit - v_29
+				lab41:
+					for {
+						if !env.EqSB("\u0BBF\u0BB0\u0BC1\u0BA8\u0BCD\u0BA4\u0BC1") {
+							break lab41
+						}
+						break lab33
+					}
+					env.Cursor = env.Limit - v_29
+				lab42:
+					for {
+						if !env.EqSB("\u0BB5\u0BBF\u0B9F") {
+							break lab42
+						}
+						break lab33
+					}
+					env.Cursor = env.Limit - v_29
+				lab43:
+					for {
+						if !(snowballRuntime.RuneCountInString(env.Current()) >= 7) {
+							break lab43
+						}
+						if !env.EqSB("\u0BBF\u0B9F\u0BAE\u0BCD") {
+							break lab43
+						}
+						break lab33
+					}
+					env.Cursor = env.Limit - v_29
+				lab44:
+					for {
+						if !env.EqSB("\u0BBE\u0BB2\u0BCD") {
+							break lab44
+						}
+						break lab33
+					}
+					env.Cursor = env.Limit - v_29
+				lab45:
+					for {
+						if !env.EqSB("\u0BC1\u0B9F\u0BC8") {
+							break lab45
+						}
+						break lab33
+					}
+					env.Cursor = env.Limit - v_29
+				lab46:
+					for {
+						if !env.EqSB("\u0BBE\u0BAE\u0BB2\u0BCD") {
+							break lab46
+						}
+						break lab33
+					}
+					env.Cursor = env.Limit - v_29
+				lab47:
+					for {
+						if !env.EqSB("\u0BB2\u0BCD") {
+							break lab47
+						}
+						var v_32 = env.Limit - env.Cursor
+						var v_33 = env.Limit - env.Cursor
+					lab48:
+						for {
+							if env.FindAmongB(A_20, context) == 0 {
+								break lab48
+							}
+							break lab47
+						}
+						env.Cursor = env.Limit - v_33
+						env.Cursor = env.Limit - v_32
+						break lab33
+					}
+					env.Cursor = env.Limit - v_29
+					if !env.EqSB("\u0BC1\u0BB3\u0BCD") {
+						break lab32
+					}
+					break lab33
+				}
+				env.Bra = env.Cursor
+				if !env.SliceFrom("\u0BCD") {
+					return false
+				}
+				env.Cursor = env.Limit - v_28
+				break lab24
+			}
+			env.Cursor = env.Limit - v_20
+		lab49:
+			for {
+				var v_34 = env.Limit - env.Cursor
+				env.Ket = env.Cursor
+			lab50:
+				for {
+					var v_35 = env.Limit - env.Cursor
+				lab51:
+					for {
+						if !env.EqSB("\u0B95\u0BA3\u0BCD") {
+							break lab51
+						}
+						break lab50
+					}
+					env.Cursor = env.Limit - v_35
+				lab52:
+					for {
+						if !env.EqSB("\u0BAE\u0BC1\u0BA9\u0BCD") {
+							break lab52
+						}
+						break lab50
+					}
+					env.Cursor = env.Limit - v_35
+				lab53:
+					for {
+						if !env.EqSB("\u0BAE\u0BC7\u0BB2\u0BCD") {
+							break lab53
+						}
+						break lab50
+					}
+					env.Cursor = env.Limit - v_35
+				lab54:
+					for {
+						if !env.EqSB("\u0BAE\u0BC7\u0BB1\u0BCD") {
+							break lab54
+						}
+						break lab50
+					}
+					env.Cursor = env.Limit - v_35
+				lab55:
+					for {
+						if !env.EqSB("\u0B95\u0BC0\u0BB4\u0BCD") {
+							break lab55
+						}
+						break lab50
+					}
+					env.Cursor = env.Limit - v_35
+				lab56:
+					for {
+						if !env.EqSB("\u0BAA\u0BBF\u0BA9\u0BCD") {
+							break lab56
+						}
+						break lab50
+					}
+					env.Cursor = env.Limit - v_35
+					if !env.EqSB("\u0BA4\u0BC1") {
+						break lab49
+					}
+					var v_36 = env.Limit - env.Cursor
+					var v_37 = env.Limit - env.Cursor
+				lab57:
+					for {
+						if env.FindAmongB(A_21, context) == 0 {
+							break lab57
+						}
+						break lab49
+					}
+					env.Cursor = env.Limit - v_37
+					env.Cursor = env.Limit - v_36
+					break lab50
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				env.Cursor = env.Limit - v_34
+				break lab24
+			}
+			env.Cursor = env.Limit - v_20
+			var v_38 = env.Limit - env.Cursor
+			env.Ket = env.Cursor
+			if !env.EqSB("\u0BC0") {
+				break lab23
+			}
+			env.Bra = env.Cursor
+			if !env.SliceFrom("\u0BBF") {
+				return false
+			}
+			env.Cursor = env.Limit - v_38
+			break lab24
+		}
+		context.b_found_a_match = true
+		context.b_found_vetrumai_urupu = true
+		var v_39 = env.Limit - env.Cursor
+	lab58:
+		for {
+			env.Ket = env.Cursor
+			if !env.EqSB("\u0BBF\u0BA9\u0BCD") {
+				break lab58
+			}
+			env.Bra = env.Cursor
+			if !env.SliceFrom("\u0BCD") {
+				return false
+			}
+			break lab58
+		}
+		env.Cursor = env.Limit - v_39
+		env.Cursor = env.LimitBackward
+		r_fix_endings(env, context)
+		break lab23
+	}
+	env.Cursor = v_19
+	var v_41 = env.Cursor
+lab59:
+	for {
+		context.b_found_a_match = false
+		env.LimitBackward = env.Cursor
+		env.Cursor = env.Limit
+	lab60:
+		for {
+			var v_42 = env.Limit - env.Cursor
+		lab61:
+			for {
+				env.Ket = env.Cursor
+				if !env.EqSB("\u0BC1\u0B99\u0BCD\u0B95\u0BB3\u0BCD") {
+					break lab61
+				}
+				var v_43 = env.Limit - env.Cursor
+				var v_44 = env.Limit - env.Cursor
+			lab62:
+				for {
+					if env.FindAmongB(A_13, context) == 0 {
+						break lab62
+					}
+					break lab61
+				}
+				env.Cursor = env.Limit - v_44
+				env.Cursor = env.Limit - v_43
+				env.Bra = env.Cursor
+				if !env.SliceFrom("\u0BCD") {
+					return false
+				}
+				break lab60
+			}
+			env.Cursor = env.Limit - v_42
+		lab63:
+			for {
+				env.Ket = env.Cursor
+				if !env.EqSB("\u0BB1\u0BCD\u0B95\u0BB3\u0BCD") {
+					break lab63
+				}
+				env.Bra = env.Cursor
+				if !env.SliceFrom("\u0BB2\u0BCD") {
+					return false
+				}
+				break lab60
+			}
+			env.Cursor = env.Limit - v_42
+		lab64:
+			for {
+				env.Ket = env.Cursor
+				if !env.EqSB("\u0B9F\u0BCD\u0B95\u0BB3\u0BCD") {
+					break lab64
+				}
+				env.Bra = env.Cursor
+				if !env.SliceFrom("\u0BB3\u0BCD") {
+					return false
+				}
+				break lab60
+			}
+			env.Cursor = env.Limit - v_42
+			env.Ket = env.Cursor
+			if !env.EqSB("\u0B95\u0BB3\u0BCD") {
+				break lab59
+			}
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			break lab60
+		}
+		context.b_found_a_match = true
+		env.Cursor = env.LimitBackward
+		break lab59
+	}
+	env.Cursor = v_41
+	var v_45 = env.Cursor
+lab65:
+	for {
+		if !(snowballRuntime.RuneCountInString(env.Current()) > 4) {
+			break lab65
+		}
+		context.b_found_a_match = false
+		env.LimitBackward = env.Cursor
+		env.Cursor = env.Limit
+		env.Ket = env.Cursor
+		if env.FindAmongB(A_15, context) == 0 {
+			break lab65
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		context.b_found_a_match = true
+		env.Cursor = env.LimitBackward
+		break lab65
+	}
+	env.Cursor = v_45
+	var v_46 = env.Cursor
+lab66:
+	for {
+		context.b_found_a_match = true
+	replab67:
+		for {
+			var v_47 = env.Cursor
+		lab68:
+			for range [2]struct{}{} {
+				if !context.b_found_a_match {
+					break lab68
+				}
+				var v_48 = env.Cursor
+			lab69:
+				for {
+					context.b_found_a_match = false
+					if !(snowballRuntime.RuneCountInString(env.Current()) > 4) {
+						break lab69
+					}
+					env.LimitBackward = env.Cursor
+					env.Cursor = env.Limit
+					var v_49 = env.Limit - env.Cursor
+				lab70:
+					for {
+					lab71:
+						for {
+							var v_50 = env.Limit - env.Cursor
+						lab72:
+							for {
+								var v_51 = env.Limit - env.Cursor
+								env.Ket = env.Cursor
+								if env.FindAmongB(A_22, context) == 0 {
+									break lab72
+								}
+								env.Bra = env.Cursor
+								if !env.SliceDel() {
+									return false
+								}
+								context.b_found_a_match = true
+								env.Cursor = env.Limit - v_51
+								break lab71
+							}
+							env.Cursor = env.Limit - v_50
+						lab73:
+							for {
+								var v_52 = env.Limit - env.Cursor
+								env.Ket = env.Cursor
+							lab74:
+								for {
+									var v_53 = env.Limit - env.Cursor
+								lab75:
+									for {
+										if !env.EqSB("\u0BAE\u0BBE\u0BB0\u0BCD") {
+											break lab75
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab76:
+									for {
+										if !env.EqSB("\u0BAE\u0BBF\u0BA9\u0BCD") {
+											break lab76
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab77:
+									for {
+										if !env.EqSB("\u0BA9\u0BA9\u0BCD") {
+											break lab77
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab78:
+									for {
+										if !env.EqSB("\u0BA9\u0BBE\u0BA9\u0BCD") {
+											break lab78
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab79:
+									for {
+										if !env.EqSB("\u0BA9\u0BBE\u0BB3\u0BCD") {
+											break lab79
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab80:
+									for {
+										if !env.EqSB("\u0BA9\u0BBE\u0BB0\u0BCD") {
+											break lab80
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab81:
+									for {
+										if !env.EqSB("\u0BB5\u0BA9\u0BCD") {
+											break lab81
+										}
+										var v_54 = env.Limit - env.Cursor
+										var v_55 = env.Limit - env.Cursor
+									lab82:
+										for {
+											if env.FindAmongB(A_23, context) == 0 {
+												break lab82
+											}
+											break lab81
+										}
+										env.Cursor = env.Limit - v_55
+										env.Cursor = env.Limit - v_54
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab83:
+									for {
+										if !env.EqSB("\u0BA9\u0BB3\u0BCD") {
+											break lab83
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab84:
+									for {
+										if !env.EqSB("\u0BB5\u0BB3\u0BCD") {
+											break lab84
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab85:
+									for {
+										if !env.EqSB("\u0BA9\u0BB0\u0BCD") {
+											break lab85
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab86:
+									for {
+										if !env.EqSB("\u0BB5\u0BB0\u0BCD") {
+											break lab86
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab87:
+									for {
+										if !env.EqSB("\u0BA9") {
+											break lab87
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab88:
+									for {
+										if !env.EqSB("\u0BAA") {
+											break lab88
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab89:
+									for {
+										if !env.EqSB("\u0B95") {
+											break lab89
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab90:
+									for {
+										if !env.EqSB("\u0BA4") {
+											break lab90
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab91:
+									for {
+										if !env.EqSB("\u0BAF") {
+											break lab91
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab92:
+									for {
+										if !env.EqSB("\u0BAA\u0BA9\u0BCD") {
+											break lab92
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab93:
+									for {
+										if !env.EqSB("\u0BAA\u0BB3\u0BCD") {
+											break lab93
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab94:
+									for {
+										if !env.EqSB("\u0BAA\u0BB0\u0BCD") {
+											break lab94
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab95:
+									for {
+										if !env.EqSB("\u0BA4\u0BC1") {
+											break lab95
+										}
+										var v_56 = env.Limit - env.Cursor
+										var v_57 = env.Limit - env.Cursor
+									lab96:
+										for {
+											if env.FindAmongB(A_24, context) == 0 {
+												break lab96
+											}
+											break lab95
+										}
+										env.Cursor = env.Limit - v_57
+										env.Cursor = env.Limit - v_56
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab97:
+									for {
+										if !env.EqSB("\u0BBF\u0BB1\u0BCD\u0BB1\u0BC1") {
+											break lab97
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab98:
+									for {
+										if !env.EqSB("\u0BAA\u0BAE\u0BCD") {
+											break lab98
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab99:
+									for {
+										if !env.EqSB("\u0BA9\u0BAE\u0BCD") {
+											break lab99
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab100:
+									for {
+										if !env.EqSB("\u0BA4\u0BC1\u0BAE\u0BCD") {
+											break lab100
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab101:
+									for {
+										if !env.EqSB("\u0BB1\u0BC1\u0BAE\u0BCD") {
+											break lab101
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab102:
+									for {
+										if !env.EqSB("\u0B95\u0BC1\u0BAE\u0BCD") {
+											break lab102
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab103:
+									for {
+										if !env.EqSB("\u0BA9\u0BC6\u0BA9\u0BCD") {
+											break lab103
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+								lab104:
+									for {
+										if !env.EqSB("\u0BA9\u0BC8") {
+											break lab104
+										}
+										break lab74
+									}
+									env.Cursor = env.Limit - v_53
+									if !env.EqSB("\u0BB5\u0BC8") {
+										break lab73
+									}
+									break lab74
+								}
+								env.Bra = env.Cursor
+								if !env.SliceDel() {
+									return false
+								}
+								context.b_found_a_match = true
+								env.Cursor = env.Limit - v_52
+								break lab71
+							}
+							env.Cursor = env.Limit - v_50
+						lab105:
+							for {
+								var v_58 = env.Limit - env.Cursor
+								env.Ket = env.Cursor
+							lab106:
+								for {
+									var v_59 = env.Limit - env.Cursor
+								lab107:
+									for {
+										if !env.EqSB("\u0BBE\u0BA9\u0BCD") {
+											break lab107
+										}
+										var v_60 = env.Limit - env.Cursor
+										var v_61 = env.Limit - env.Cursor
+									lab108:
+										for {
+											if !env.EqSB("\u0B9A") {
+												break lab108
+											}
+											break lab107
+										}
+										env.Cursor = env.Limit - v_61
+										env.Cursor = env.Limit - v_60
+										break lab106
+									}
+									env.Cursor = env.Limit - v_59
+								lab109:
+									for {
+										if !env.EqSB("\u0BBE\u0BB3\u0BCD") {
+											break lab109
+										}
+										break lab106
+									}
+									env.Cursor = env.Limit - v_59
+								lab110:
+									for {
+										if !env.EqSB("\u0BBE\u0BB0\u0BCD") {
+											break lab110
+										}
+										break lab106
+									}
+									env.Cursor = env.Limit - v_59
+								lab111:
+									for {
+										if !env.EqSB("\u0BC7\u0BA9\u0BCD") {
+											break lab111
+										}
+										break lab106
+									}
+									env.Cursor = env.Limit - v_59
+								lab112:
+									for {
+										if !env.EqSB("\u0BBE") {
+											break lab112
+										}
+										break lab106
+									}
+									env.Cursor = env.Limit - v_59
+								lab113:
+									for {
+										if !env.EqSB("\u0BBE\u0BAE\u0BCD") {
+											break lab113
+										}
+										break lab106
+									}
+									env.Cursor = env.Limit - v_59
+								lab114:
+									for {
+										if !env.EqSB("\u0BC6\u0BAE\u0BCD") {
+											break lab114
+										}
+										break lab106
+									}
+									env.Cursor = env.Limit - v_59
+								lab115:
+									for {
+										if !env.EqSB("\u0BC7\u0BAE\u0BCD") {
+											break lab115
+										}
+										break lab106
+									}
+									env.Cursor = env.Limit - v_59
+								lab116:
+									for {
+										if !env.EqSB("\u0BCB\u0BAE\u0BCD") {
+											break lab116
+										}
+										break lab106
+									}
+									env.Cursor = env.Limit - v_59
+								lab117:
+									for {
+										if !env.EqSB("\u0B95\u0BC1\u0BAE\u0BCD") {
+											break lab117
+										}
+										break lab106
+									}
+									env.Cursor = env.Limit - v_59
+								lab118:
+									for {
+										if !env.EqSB("\u0BA4\u0BC1\u0BAE\u0BCD") {
+											break lab118
+										}
+										break lab106
+									}
+									env.Cursor = env.Limit - v_59
+								lab119:
+									for {
+										if !env.EqSB("\u0B9F\u0BC1\u0BAE\u0BCD") {
+											break lab119
+										}
+										break lab106
+									}
+									env.Cursor = env.Limit - v_59
+								lab120:
+									for {
+										if !env.EqSB("\u0BB1\u0BC1\u0BAE\u0BCD") {
+											break lab120
+										}
+										break lab106
+									}
+									env.Cursor = env.Limit - v_59
+								lab121:
+									for {
+										if !env.EqSB("\u0BBE\u0BAF\u0BCD") {
+											break lab121
+										}
+										break lab106
+									}
+									env.Cursor = env.Limit - v_59
+								lab122:
+									for {
+										if !env.EqSB("\u0BA9\u0BC6\u0BA9\u0BCD") {
+											break lab122
+										}
+										break lab106
+									}
+									env.Cursor = env.Limit - v_59
+								lab123:
+									for {
+										if !env.EqSB("\u0BA9\u0BBF\u0BB0\u0BCD") {
+											break lab123
+										}
+										break lab106
+									}
+									env.Cursor = env.Limit - v_59
+								lab124:
+									for {
+										if !env.EqSB("\u0BC0\u0BB0\u0BCD") {
+											break lab124
+										}
+										break lab106
+									}
+									env.Cursor = env.Limit - v_59
+									if !env.EqSB("\u0BC0\u0BAF\u0BB0\u0BCD") {
+										break lab105
+									}
+									break lab106
+								}
+								env.Bra = env.Cursor
+								if !env.SliceFrom("\u0BCD") {
+									return false
+								}
+								context.b_found_a_match = true
+								env.Cursor = env.Limit - v_58
+								break lab71
+							}
+							env.Cursor = env.Limit - v_50
+							var v_62 = env.Limit - env.Cursor
+							env.Ket = env.Cursor
+						lab125:
+							for {
+								var v_63 = env.Limit - env.Cursor
+							lab126:
+								for {
+									if !env.EqSB("\u0B95\u0BC1") {
+										break lab126
+									}
+									break lab125
+								}
+								env.Cursor = env.Limit - v_63
+								if !env.EqSB("\u0BA4\u0BC1") {
+									break lab70
+								}
+								break lab125
+							}
+							var v_64 = env.Limit - env.Cursor
+							if !env.EqSB("\u0BCD") {
+								break lab70
+							}
+							env.Cursor = env.Limit - v_64
+							env.Bra = env.Cursor
+							if !env.SliceDel() {
+								return false
+							}
+							context.b_found_a_match = true
+							env.Cursor = env.Limit - v_62
+							break lab71
+						}
+						break lab70
+					}
+					env.Cursor = env.Limit - v_49
+					var v_65 = env.Limit - env.Cursor
+				lab127:
+					for {
+						env.Ket = env.Cursor
+						if env.FindAmongB(A_25, context) == 0 {
+							break lab127
+						}
+						env.Bra = env.Cursor
+						if !env.SliceDel() {
+							return false
+						}
+						context.b_found_a_match = true
+						break lab127
+					}
+					env.Cursor = env.Limit - v_65
+					env.Cursor = env.LimitBackward
+					r_fix_endings(env, context)
+					break lab69
+				}
+				env.Cursor = v_48
+				continue replab67
+			}
+			env.Cursor = v_47
+			break replab67
+		}
+		break lab66
+	}
+	env.Cursor = v_46
+	return true
+}
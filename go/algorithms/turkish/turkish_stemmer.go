@@ -0,0 +1,2227 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package turkish
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "m", A: -1, B: -1, F: nil},
+	{Str: "n", A: -1, B: -1, F: nil},
+	{Str: "miz", A: -1, B: -1, F: nil},
+	{Str: "niz", A: -1, B: -1, F: nil},
+	{Str: "muz", A: -1, B: -1, F: nil},
+	{Str: "nuz", A: -1, B: -1, F: nil},
+	{Str: "m\u0131z", A: -1, B: -1, F: nil},
+	{Str: "n\u0131z", A: -1, B: -1, F: nil},
+	{Str: "m\u00FCz", A: -1, B: -1, F: nil},
+	{Str: "n\u00FCz", A: -1, B: -1, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "leri", A: -1, B: -1, F: nil},
+	{Str: "lar\u0131", A: -1, B: -1, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "ni", A: -1, B: -1, F: nil},
+	{Str: "nu", A: -1, B: -1, F: nil},
+	{Str: "n\u0131", A: -1, B: -1, F: nil},
+	{Str: "n\u00FC", A: -1, B: -1, F: nil},
+}
+
+var A_3 = []*snowballRuntime.Among{
+	{Str: "in", A: -1, B: -1, F: nil},
+	{Str: "un", A: -1, B: -1, F: nil},
+	{Str: "\u0131n", A: -1, B: -1, F: nil},
+	{Str: "\u00FCn", A: -1, B: -1, F: nil},
+}
+
+var A_4 = []*snowballRuntime.Among{
+	{Str: "a", A: -1, B: -1, F: nil},
+	{Str: "e", A: -1, B: -1, F: nil},
+}
+
+var A_5 = []*snowballRuntime.Among{
+	{Str: "na", A: -1, B: -1, F: nil},
+	{Str: "ne", A: -1, B: -1, F: nil},
+}
+
+var A_6 = []*snowballRuntime.Among{
+	{Str: "da", A: -1, B: -1, F: nil},
+	{Str: "ta", A: -1, B: -1, F: nil},
+	{Str: "de", A: -1, B: -1, F: nil},
+	{Str: "te", A: -1, B: -1, F: nil},
+}
+
+var A_7 = []*snowballRuntime.Among{
+	{Str: "nda", A: -1, B: -1, F: nil},
+	{Str: "nde", A: -1, B: -1, F: nil},
+}
+
+var A_8 = []*snowballRuntime.Among{
+	{Str: "dan", A: -1, B: -1, F: nil},
+	{Str: "tan", A: -1, B: -1, F: nil},
+	{Str: "den", A: -1, B: -1, F: nil},
+	{Str: "ten", A: -1, B: -1, F: nil},
+}
+
+var A_9 = []*snowballRuntime.Among{
+	{Str: "ndan", A: -1, B: -1, F: nil},
+	{Str: "nden", A: -1, B: -1, F: nil},
+}
+
+var A_10 = []*snowballRuntime.Among{
+	{Str: "la", A: -1, B: -1, F: nil},
+	{Str: "le", A: -1, B: -1, F: nil},
+}
+
+var A_11 = []*snowballRuntime.Among{
+	{Str: "ca", A: -1, B: -1, F: nil},
+	{Str: "ce", A: -1, B: -1, F: nil},
+}
+
+var A_12 = []*snowballRuntime.Among{
+	{Str: "im", A: -1, B: -1, F: nil},
+	{Str: "um", A: -1, B: -1, F: nil},
+	{Str: "\u0131m", A: -1, B: -1, F: nil},
+	{Str: "\u00FCm", A: -1, B: -1, F: nil},
+}
+
+var A_13 = []*snowballRuntime.Among{
+	{Str: "sin", A: -1, B: -1, F: nil},
+	{Str: "sun", A: -1, B: -1, F: nil},
+	{Str: "s\u0131n", A: -1, B: -1, F: nil},
+	{Str: "s\u00FCn", A: -1, B: -1, F: nil},
+}
+
+var A_14 = []*snowballRuntime.Among{
+	{Str: "iz", A: -1, B: -1, F: nil},
+	{Str: "uz", A: -1, B: -1, F: nil},
+	{Str: "\u0131z", A: -1, B: -1, F: nil},
+	{Str: "\u00FCz", A: -1, B: -1, F: nil},
+}
+
+var A_15 = []*snowballRuntime.Among{
+	{Str: "siniz", A: -1, B: -1, F: nil},
+	{Str: "sunuz", A: -1, B: -1, F: nil},
+	{Str: "s\u0131n\u0131z", A: -1, B: -1, F: nil},
+	{Str: "s\u00FCn\u00FCz", A: -1, B: -1, F: nil},
+}
+
+var A_16 = []*snowballRuntime.Among{
+	{Str: "lar", A: -1, B: -1, F: nil},
+	{Str: "ler", A: -1, B: -1, F: nil},
+}
+
+var A_17 = []*snowballRuntime.Among{
+	{Str: "niz", A: -1, B: -1, F: nil},
+	{Str: "nuz", A: -1, B: -1, F: nil},
+	{Str: "n\u0131z", A: -1, B: -1, F: nil},
+	{Str: "n\u00FCz", A: -1, B: -1, F: nil},
+}
+
+var A_18 = []*snowballRuntime.Among{
+	{Str: "dir", A: -1, B: -1, F: nil},
+	{Str: "tir", A: -1, B: -1, F: nil},
+	{Str: "dur", A: -1, B: -1, F: nil},
+	{Str: "tur", A: -1, B: -1, F: nil},
+	{Str: "d\u0131r", A: -1, B: -1, F: nil},
+	{Str: "t\u0131r", A: -1, B: -1, F: nil},
+	{Str: "d\u00FCr", A: -1, B: -1, F: nil},
+	{Str: "t\u00FCr", A: -1, B: -1, F: nil},
+}
+
+var A_19 = []*snowballRuntime.Among{
+	{Str: "cas\u0131na", A: -1, B: -1, F: nil},
+	{Str: "cesine", A: -1, B: -1, F: nil},
+}
+
+var A_20 = []*snowballRuntime.Among{
+	{Str: "di", A: -1, B: -1, F: nil},
+	{Str: "ti", A: -1, B: -1, F: nil},
+	{Str: "dik", A: -1, B: -1, F: nil},
+	{Str: "tik", A: -1, B: -1, F: nil},
+	{Str: "duk", A: -1, B: -1, F: nil},
+	{Str: "tuk", A: -1, B: -1, F: nil},
+	{Str: "d\u0131k", A: -1, B: -1, F: nil},
+	{Str: "t\u0131k", A: -1, B: -1, F: nil},
+	{Str: "d\u00FCk", A: -1, B: -1, F: nil},
+	{Str: "t\u00FCk", A: -1, B: -1, F: nil},
+	{Str: "dim", A: -1, B: -1, F: nil},
+	{Str: "tim", A: -1, B: -1, F: nil},
+	{Str: "dum", A: -1, B: -1, F: nil},
+	{Str: "tum", A: -1, B: -1, F: nil},
+	{Str: "d\u0131m", A: -1, B: -1, F: nil},
+	{Str: "t\u0131m", A: -1, B: -1, F: nil},
+	{Str: "d\u00FCm", A: -1, B: -1, F: nil},
+	{Str: "t\u00FCm", A: -1, B: -1, F: nil},
+	{Str: "din", A: -1, B: -1, F: nil},
+	{Str: "tin", A: -1, B: -1, F: nil},
+	{Str: "dun", A: -1, B: -1, F: nil},
+	{Str: "tun", A: -1, B: -1, F: nil},
+	{Str: "d\u0131n", A: -1, B: -1, F: nil},
+	{Str: "t\u0131n", A: -1, B: -1, F: nil},
+	{Str: "d\u00FCn", A: -1, B: -1, F: nil},
+	{Str: "t\u00FCn", A: -1, B: -1, F: nil},
+	{Str: "du", A: -1, B: -1, F: nil},
+	{Str: "tu", A: -1, B: -1, F: nil},
+	{Str: "d\u0131", A: -1, B: -1, F: nil},
+	{Str: "t\u0131", A: -1, B: -1, F: nil},
+	{Str: "d\u00FC", A: -1, B: -1, F: nil},
+	{Str: "t\u00FC", A: -1, B: -1, F: nil},
+}
+
+var A_21 = []*snowballRuntime.Among{
+	{Str: "sa", A: -1, B: -1, F: nil},
+	{Str: "se", A: -1, B: -1, F: nil},
+	{Str: "sak", A: -1, B: -1, F: nil},
+	{Str: "sek", A: -1, B: -1, F: nil},
+	{Str: "sam", A: -1, B: -1, F: nil},
+	{Str: "sem", A: -1, B: -1, F: nil},
+	{Str: "san", A: -1, B: -1, F: nil},
+	{Str: "sen", A: -1, B: -1, F: nil},
+}
+
+var A_22 = []*snowballRuntime.Among{
+	{Str: "mi\u015F", A: -1, B: -1, F: nil},
+	{Str: "mu\u015F", A: -1, B: -1, F: nil},
+	{Str: "m\u0131\u015F", A: -1, B: -1, F: nil},
+	{Str: "m\u00FC\u015F", A: -1, B: -1, F: nil},
+}
+
+var A_23 = []*snowballRuntime.Among{
+	{Str: "b", A: -1, B: 1, F: nil},
+	{Str: "c", A: -1, B: 2, F: nil},
+	{Str: "d", A: -1, B: 3, F: nil},
+	{Str: "\u011F", A: -1, B: 4, F: nil},
+}
+
+var G_vowel = []byte{17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 8, 0, 0, 0, 0, 0, 0, 1}
+
+var G_U = []byte{1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 1}
+
+var G_vowel1 = []byte{1, 64, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}
+
+var G_vowel2 = []byte{17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130}
+
+var G_vowel3 = []byte{1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}
+
+var G_vowel4 = []byte{17}
+
+var G_vowel5 = []byte{65}
+
+var G_vowel6 = []byte{65}
+
+type Context struct {
+	b_continue_stemming_noun_suffixes bool
+}
+
+func r_check_vowel_harmony(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	var v_1 = env.Limit - env.Cursor
+golab0:
+	for {
+		var v_2 = env.Limit - env.Cursor
+	lab1:
+		for {
+			if !env.InGroupingB(G_vowel, 97, 305) {
+				break lab1
+			}
+			env.Cursor = env.Limit - v_2
+			break golab0
+		}
+		env.Cursor = env.Limit - v_2
+		if env.Cursor <= env.LimitBackward {
+			return false
+		}
+		env.PrevChar()
+	}
+lab2:
+	for {
+		var v_3 = env.Limit - env.Cursor
+	lab3:
+		for {
+			if !env.EqSB("a") {
+				break lab3
+			}
+		golab4:
+			for {
+				var v_4 = env.Limit - env.Cursor
+			lab5:
+				for {
+					if !env.InGroupingB(G_vowel1, 97, 305) {
+						break lab5
+					}
+					env.Cursor = env.Limit - v_4
+					break golab4
+				}
+				env.Cursor = env.Limit - v_4
+				if env.Cursor <= env.LimitBackward {
+					break lab3
+				}
+				env.PrevChar()
+			}
+			break lab2
+		}
+		env.Cursor = env.Limit - v_3
+	lab6:
+		for {
+			if !env.EqSB("e") {
+				break lab6
+			}
+		golab7:
+			for {
+				var v_5 = env.Limit - env.Cursor
+			lab8:
+				for {
+					if !env.InGroupingB(G_vowel2, 101, 252) {
+						break lab8
+					}
+					env.Cursor = env.Limit - v_5
+					break golab7
+				}
+				env.Cursor = env.Limit - v_5
+				if env.Cursor <= env.LimitBackward {
+					break lab6
+				}
+				env.PrevChar()
+			}
+			break lab2
+		}
+		env.Cursor = env.Limit - v_3
+	lab9:
+		for {
+			if !env.EqSB("\u0131") {
+				break lab9
+			}
+		golab10:
+			for {
+				var v_6 = env.Limit - env.Cursor
+			lab11:
+				for {
+					if !env.InGroupingB(G_vowel3, 97, 305) {
+						break lab11
+					}
+					env.Cursor = env.Limit - v_6
+					break golab10
+				}
+				env.Cursor = env.Limit - v_6
+				if env.Cursor <= env.LimitBackward {
+					break lab9
+				}
+				env.PrevChar()
+			}
+			break lab2
+		}
+		env.Cursor = env.Limit - v_3
+	lab12:
+		for {
+			if !env.EqSB("i") {
+				break lab12
+			}
+		golab13:
+			for {
+				var v_7 = env.Limit - env.Cursor
+			lab14:
+				for {
+					if !env.InGroupingB(G_vowel4, 101, 105) {
+						break lab14
+					}
+					env.Cursor = env.Limit - v_7
+					break golab13
+				}
+				env.Cursor = env.Limit - v_7
+				if env.Cursor <= env.LimitBackward {
+					break lab12
+				}
+				env.PrevChar()
+			}
+			break lab2
+		}
+		env.Cursor = env.Limit - v_3
+	lab15:
+		for {
+			if !env.EqSB("o") {
+				break lab15
+			}
+		golab16:
+			for {
+				var v_8 = env.Limit - env.Cursor
+			lab17:
+				for {
+					if !env.InGroupingB(G_vowel5, 111, 117) {
+						break lab17
+					}
+					env.Cursor = env.Limit - v_8
+					break golab16
+				}
+				env.Cursor = env.Limit - v_8
+				if env.Cursor <= env.LimitBackward {
+					break lab15
+				}
+				env.PrevChar()
+			}
+			break lab2
+		}
+		env.Cursor = env.Limit - v_3
+	lab18:
+		for {
+			if !env.EqSB("\u00F6") {
+				break lab18
+			}
+		golab19:
+			for {
+				var v_9 = env.Limit - env.Cursor
+			lab20:
+				for {
+					if !env.InGroupingB(G_vowel6, 246, 252) {
+						break lab20
+					}
+					env.Cursor = env.Limit - v_9
+					break golab19
+				}
+				env.Cursor = env.Limit - v_9
+				if env.Cursor <= env.LimitBackward {
+					break lab18
+				}
+				env.PrevChar()
+			}
+			break lab2
+		}
+		env.Cursor = env.Limit - v_3
+	lab21:
+		for {
+			if !env.EqSB("u") {
+				break lab21
+			}
+		golab22:
+			for {
+				var v_10 = env.Limit - env.Cursor
+			lab23:
+				for {
+					if !env.InGroupingB(G_vowel5, 111, 117) {
+						break lab23
+					}
+					env.Cursor = env.Limit - v_10
+					break golab22
+				}
+				env.Cursor = env.Limit - v_10
+				if env.Cursor <= env.LimitBackward {
+					break lab21
+				}
+				env.PrevChar()
+			}
+			break lab2
+		}
+		env.Cursor = env.Limit - v_3
+		if !env.EqSB("\u00FC") {
+			return false
+		}
+	golab24:
+		for {
+			var v_11 = env.Limit - env.Cursor
+		lab25:
+			for {
+				if !env.InGroupingB(G_vowel6, 246, 252) {
+					break lab25
+				}
+				env.Cursor = env.Limit - v_11
+				break golab24
+			}
+			env.Cursor = env.Limit - v_11
+			if env.Cursor <= env.LimitBackward {
+				return false
+			}
+			env.PrevChar()
+		}
+		break lab2
+	}
+	env.Cursor = env.Limit - v_1
+	return true
+}
+
+func r_mark_suffix_with_optional_n_consonant(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+lab0:
+	for {
+		var v_1 = env.Limit - env.Cursor
+	lab1:
+		for {
+			if !env.EqSB("n") {
+				break lab1
+			}
+			var v_2 = env.Limit - env.Cursor
+			if !env.InGroupingB(G_vowel, 97, 305) {
+				break lab1
+			}
+			env.Cursor = env.Limit - v_2
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+		var v_3 = env.Limit - env.Cursor
+	lab2:
+		for {
+			var v_4 = env.Limit - env.Cursor
+			if !env.EqSB("n") {
+				break lab2
+			}
+			env.Cursor = env.Limit - v_4
+			return false
+		}
+		env.Cursor = env.Limit - v_3
+		var v_5 = env.Limit - env.Cursor
+		if env.Cursor <= env.LimitBackward {
+			return false
+		}
+		env.PrevChar()
+		if !env.InGroupingB(G_vowel, 97, 305) {
+			return false
+		}
+		env.Cursor = env.Limit - v_5
+		break lab0
+	}
+	return true
+}
+
+func r_mark_suffix_with_optional_y_consonant(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+lab0:
+	for {
+		var v_1 = env.Limit - env.Cursor
+	lab1:
+		for {
+			if !env.EqSB("y") {
+				break lab1
+			}
+			var v_2 = env.Limit - env.Cursor
+			if !env.InGroupingB(G_vowel, 97, 305) {
+				break lab1
+			}
+			env.Cursor = env.Limit - v_2
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+		var v_3 = env.Limit - env.Cursor
+	lab2:
+		for {
+			var v_4 = env.Limit - env.Cursor
+			if !env.EqSB("y") {
+				break lab2
+			}
+			env.Cursor = env.Limit - v_4
+			return false
+		}
+		env.Cursor = env.Limit - v_3
+		var v_5 = env.Limit - env.Cursor
+		if env.Cursor <= env.LimitBackward {
+			return false
+		}
+		env.PrevChar()
+		if !env.InGroupingB(G_vowel, 97, 305) {
+			return false
+		}
+		env.Cursor = env.Limit - v_5
+		break lab0
+	}
+	return true
+}
+
+func r_mark_possessives(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if env.FindAmongB(A_0, context) == 0 {
+		return false
+	}
+lab0:
+	for {
+		var v_1 = env.Limit - env.Cursor
+	lab1:
+		for {
+			if !env.InGroupingB(G_U, 105, 305) {
+				break lab1
+			}
+			var v_2 = env.Limit - env.Cursor
+			if !env.OutGroupingB(G_vowel, 97, 305) {
+				break lab1
+			}
+			env.Cursor = env.Limit - v_2
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+		var v_3 = env.Limit - env.Cursor
+	lab2:
+		for {
+			var v_4 = env.Limit - env.Cursor
+			if !env.InGroupingB(G_U, 105, 305) {
+				break lab2
+			}
+			env.Cursor = env.Limit - v_4
+			return false
+		}
+		env.Cursor = env.Limit - v_3
+		var v_5 = env.Limit - env.Cursor
+		if env.Cursor <= env.LimitBackward {
+			return false
+		}
+		env.PrevChar()
+		if !env.OutGroupingB(G_vowel, 97, 305) {
+			return false
+		}
+		env.Cursor = env.Limit - v_5
+		break lab0
+	}
+	return true
+}
+
+func r_mark_sU(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if !r_check_vowel_harmony(env, context) {
+		return false
+	}
+	if !env.InGroupingB(G_U, 105, 305) {
+		return false
+	}
+lab0:
+	for {
+		var v_1 = env.Limit - env.Cursor
+	lab1:
+		for {
+			if !env.EqSB("s") {
+				break lab1
+			}
+			var v_2 = env.Limit - env.Cursor
+			if !env.InGroupingB(G_vowel, 97, 305) {
+				break lab1
+			}
+			env.Cursor = env.Limit - v_2
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+		var v_3 = env.Limit - env.Cursor
+	lab2:
+		for {
+			var v_4 = env.Limit - env.Cursor
+			if !env.EqSB("s") {
+				break lab2
+			}
+			env.Cursor = env.Limit - v_4
+			return false
+		}
+		env.Cursor = env.Limit - v_3
+		var v_5 = env.Limit - env.Cursor
+		if env.Cursor <= env.LimitBackward {
+			return false
+		}
+		env.PrevChar()
+		if !env.InGroupingB(G_vowel, 97, 305) {
+			return false
+		}
+		env.Cursor = env.Limit - v_5
+		break lab0
+	}
+	return true
+}
+
+func r_mark_lArI(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if env.FindAmongB(A_1, context) == 0 {
+		return false
+	}
+	return true
+}
+
+func r_mark_nUn(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if !r_check_vowel_harmony(env, context) {
+		return false
+	}
+	if env.FindAmongB(A_3, context) == 0 {
+		return false
+	}
+	if !r_mark_suffix_with_optional_n_consonant(env, context) {
+		return false
+	}
+	return true
+}
+
+func r_mark_DA(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if !r_check_vowel_harmony(env, context) {
+		return false
+	}
+	if env.FindAmongB(A_6, context) == 0 {
+		return false
+	}
+	return true
+}
+
+func r_mark_ndA(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if !r_check_vowel_harmony(env, context) {
+		return false
+	}
+	if env.FindAmongB(A_7, context) == 0 {
+		return false
+	}
+	return true
+}
+
+func r_mark_yUm(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if !r_check_vowel_harmony(env, context) {
+		return false
+	}
+	if env.FindAmongB(A_12, context) == 0 {
+		return false
+	}
+	if !r_mark_suffix_with_optional_y_consonant(env, context) {
+		return false
+	}
+	return true
+}
+
+func r_mark_sUn(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if !r_check_vowel_harmony(env, context) {
+		return false
+	}
+	if env.FindAmongB(A_13, context) == 0 {
+		return false
+	}
+	return true
+}
+
+func r_mark_yUz(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if !r_check_vowel_harmony(env, context) {
+		return false
+	}
+	if env.FindAmongB(A_14, context) == 0 {
+		return false
+	}
+	if !r_mark_suffix_with_optional_y_consonant(env, context) {
+		return false
+	}
+	return true
+}
+
+func r_mark_sUnUz(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if env.FindAmongB(A_15, context) == 0 {
+		return false
+	}
+	return true
+}
+
+func r_mark_lAr(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if !r_check_vowel_harmony(env, context) {
+		return false
+	}
+	if env.FindAmongB(A_16, context) == 0 {
+		return false
+	}
+	return true
+}
+
+func r_mark_DUr(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if !r_check_vowel_harmony(env, context) {
+		return false
+	}
+	if env.FindAmongB(A_18, context) == 0 {
+		return false
+	}
+	return true
+}
+
+func r_mark_yDU(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if !r_check_vowel_harmony(env, context) {
+		return false
+	}
+	if env.FindAmongB(A_20, context) == 0 {
+		return false
+	}
+	if !r_mark_suffix_with_optional_y_consonant(env, context) {
+		return false
+	}
+	return true
+}
+
+func r_mark_ysA(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if env.FindAmongB(A_21, context) == 0 {
+		return false
+	}
+	if !r_mark_suffix_with_optional_y_consonant(env, context) {
+		return false
+	}
+	return true
+}
+
+func r_mark_ymUs_(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	if !r_check_vowel_harmony(env, context) {
+		return false
+	}
+	if env.FindAmongB(A_22, context) == 0 {
+		return false
+	}
+	if !r_mark_suffix_with_optional_y_consonant(env, context) {
+		return false
+	}
+	return true
+}
+
+func r_stem_suffix_chain_before_ki(env *snowballRuntime.Env, ctx interface{}) bool {
+	context := ctx.(*Context)
+	_ = context
+	env.Ket = env.Cursor
+	if !env.EqSB("ki") {
+		return false
+	}
+lab0:
+	for {
+		var v_1 = env.Limit - env.Cursor
+	lab1:
+		for {
+			if !r_mark_DA(env, context) {
+				break lab1
+			}
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			var v_2 = env.Limit - env.Cursor
+		lab2:
+			for {
+				env.Ket = env.Cursor
+			lab3:
+				for {
+					var v_3 = env.Limit - env.Cursor
+				lab4:
+					for {
+						if !r_mark_lAr(env, context) {
+							break lab4
+						}
+						env.Bra = env.Cursor
+						if !env.SliceDel() {
+							return false
+						}
+						var v_4 = env.Limit - env.Cursor
+					lab5:
+						for {
+							if !r_stem_suffix_chain_before_ki(env, context) {
+								env.Cursor = env.Limit - v_4
+								break lab5
+							}
+							break lab5
+						}
+						break lab3
+					}
+					env.Cursor = env.Limit - v_3
+					if !r_mark_possessives(env, context) {
+						env.Cursor = env.Limit - v_2
+						break lab2
+					}
+					env.Bra = env.Cursor
+					if !env.SliceDel() {
+						return false
+					}
+					var v_5 = env.Limit - env.Cursor
+				lab6:
+					for {
+						env.Ket = env.Cursor
+						if !r_mark_lAr(env, context) {
+							env.Cursor = env.Limit - v_5
+							break lab6
+						}
+						env.Bra = env.Cursor
+						if !env.SliceDel() {
+							return false
+						}
+						if !r_stem_suffix_chain_before_ki(env, context) {
+							env.Cursor = env.Limit - v_5
+							break lab6
+						}
+						break lab6
+					}
+					break lab3
+				}
+				break lab2
+			}
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+	lab7:
+		for {
+			if !r_mark_nUn(env, context) {
+				break lab7
+			}
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			var v_6 = env.Limit - env.Cursor
+		lab8:
+			for {
+				env.Ket = env.Cursor
+			lab9:
+				for {
+					var v_7 = env.Limit - env.Cursor
+				lab10:
+					for {
+						if !r_mark_lArI(env, context) {
+							break lab10
+						}
+						env.Bra = env.Cursor
+						if !env.SliceDel() {
+							return false
+						}
+						break lab9
+					}
+					env.Cursor = env.Limit - v_7
+				lab11:
+					for {
+						env.Ket = env.Cursor
+					lab12:
+						for {
+							var v_8 = env.Limit - env.Cursor
+						lab13:
+							for {
+								if !r_mark_possessives(env, context) {
+									break lab13
+								}
+								break lab12
+							}
+							env.Cursor = env.Limit - v_8
+							if !r_mark_sU(env, context) {
+								break lab11
+							}
+							break lab12
+						}
+						env.Bra = env.Cursor
+						if !env.SliceDel() {
+							return false
+						}
+						var v_9 = env.Limit - env.Cursor
+					lab14:
+						for {
+							env.Ket = env.Cursor
+							if !r_mark_lAr(env, context) {
+								env.Cursor = env.Limit - v_9
+								break lab14
+							}
+							env.Bra = env.Cursor
+							if !env.SliceDel() {
+								return false
+							}
+							if !r_stem_suffix_chain_before_ki(env, context) {
+								env.Cursor = env.Limit - v_9
+								break lab14
+							}
+							break lab14
+						}
+						break lab9
+					}
+					env.Cursor = env.Limit - v_7
+					if !r_stem_suffix_chain_before_ki(env, context) {
+						env.Cursor = env.Limit - v_6
+						break lab8
+					}
+					break lab9
+				}
+				break lab8
+			}
+			break lab0
+		}
+		env.Cursor = env.Limit - v_1
+		if !r_mark_ndA(env, context) {
+			return false
+		}
+	lab15:
+		for {
+			var v_10 = env.Limit - env.Cursor
+		lab16:
+			for {
+				if !r_mark_lArI(env, context) {
+					break lab16
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				break lab15
+			}
+			env.Cursor = env.Limit - v_10
+		lab17:
+			for {
+				if !r_mark_sU(env, context) {
+					break lab17
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				var v_11 = env.Limit - env.Cursor
+			lab18:
+				for {
+					env.Ket = env.Cursor
+					if !r_mark_lAr(env, context) {
+						env.Cursor = env.Limit - v_11
+						break lab18
+					}
+					env.Bra = env.Cursor
+					if !env.SliceDel() {
+						return false
+					}
+					if !r_stem_suffix_chain_before_ki(env, context) {
+						env.Cursor = env.Limit - v_11
+						break lab18
+					}
+					break lab18
+				}
+				break lab15
+			}
+			env.Cursor = env.Limit - v_10
+			if !r_stem_suffix_chain_before_ki(env, context) {
+				return false
+			}
+			break lab15
+		}
+		break lab0
+	}
+	return true
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		b_continue_stemming_noun_suffixes: false,
+	}
+	_ = context
+	var among_var int32
+	var v_1 = env.Cursor
+	for range make([]struct{}, 2) {
+	golab0:
+		for {
+		lab1:
+			for {
+				if !env.InGrouping(G_vowel, 97, 305) {
+					break lab1
+				}
+				break golab0
+			}
+			if env.Cursor >= env.Limit {
+				return false
+			}
+			env.NextChar()
+		}
+	}
+	env.Cursor = v_1
+	env.LimitBackward = env.Cursor
+	env.Cursor = env.Limit
+	var v_4 = env.Limit - env.Cursor
+lab2:
+	for {
+		env.Ket = env.Cursor
+		context.b_continue_stemming_noun_suffixes = true
+	lab3:
+		for {
+			var v_5 = env.Limit - env.Cursor
+		lab4:
+			for {
+			lab5:
+				for {
+					var v_6 = env.Limit - env.Cursor
+				lab6:
+					for {
+						if !r_mark_ymUs_(env, context) {
+							break lab6
+						}
+						break lab5
+					}
+					env.Cursor = env.Limit - v_6
+				lab7:
+					for {
+						if !r_mark_yDU(env, context) {
+							break lab7
+						}
+						break lab5
+					}
+					env.Cursor = env.Limit - v_6
+				lab8:
+					for {
+						if !r_mark_ysA(env, context) {
+							break lab8
+						}
+						break lab5
+					}
+					env.Cursor = env.Limit - v_6
+					if !env.EqSB("ken") {
+						break lab4
+					}
+					if !r_mark_suffix_with_optional_y_consonant(env, context) {
+						break lab4
+					}
+					break lab5
+				}
+				break lab3
+			}
+			env.Cursor = env.Limit - v_5
+		lab9:
+			for {
+				if env.FindAmongB(A_19, context) == 0 {
+					break lab9
+				}
+			lab10:
+				for {
+					var v_7 = env.Limit - env.Cursor
+				lab11:
+					for {
+						if !r_mark_sUnUz(env, context) {
+							break lab11
+						}
+						break lab10
+					}
+					env.Cursor = env.Limit - v_7
+				lab12:
+					for {
+						if !r_mark_lAr(env, context) {
+							break lab12
+						}
+						break lab10
+					}
+					env.Cursor = env.Limit - v_7
+				lab13:
+					for {
+						if !r_mark_yUm(env, context) {
+							break lab13
+						}
+						break lab10
+					}
+					env.Cursor = env.Limit - v_7
+				lab14:
+					for {
+						if !r_mark_sUn(env, context) {
+							break lab14
+						}
+						break lab10
+					}
+					env.Cursor = env.Limit - v_7
+				lab15:
+					for {
+						if !r_mark_yUz(env, context) {
+							break lab15
+						}
+						break lab10
+					}
+					env.Cursor = env.Limit - v_7
+					break lab10
+				}
+				if !r_mark_ymUs_(env, context) {
+					break lab9
+				}
+				break lab3
+			}
+			env.Cursor = env.Limit - v_5
+		lab16:
+			for {
+				if !r_mark_lAr(env, context) {
+					break lab16
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				var v_8 = env.Limit - env.Cursor
+			lab17:
+				for {
+					env.Ket = env.Cursor
+				lab18:
+					for {
+						var v_9 = env.Limit - env.Cursor
+					lab19:
+						for {
+							if !r_mark_DUr(env, context) {
+								break lab19
+							}
+							break lab18
+						}
+						env.Cursor = env.Limit - v_9
+					lab20:
+						for {
+							if !r_mark_yDU(env, context) {
+								break lab20
+							}
+							break lab18
+						}
+						env.Cursor = env.Limit - v_9
+					lab21:
+						for {
+							if !r_mark_ysA(env, context) {
+								break lab21
+							}
+							break lab18
+						}
+						env.Cursor = env.Limit - v_9
+						if !r_mark_ymUs_(env, context) {
+							env.Cursor = env.Limit - v_8
+							break lab17
+						}
+						break lab18
+					}
+					break lab17
+				}
+				context.b_continue_stemming_noun_suffixes = false
+				break lab3
+			}
+			env.Cursor = env.Limit - v_5
+		lab22:
+			for {
+				if !r_check_vowel_harmony(env, context) {
+					break lab22
+				}
+				if env.FindAmongB(A_17, context) == 0 {
+					break lab22
+				}
+			lab23:
+				for {
+					var v_10 = env.Limit - env.Cursor
+				lab24:
+					for {
+						if !r_mark_yDU(env, context) {
+							break lab24
+						}
+						break lab23
+					}
+					env.Cursor = env.Limit - v_10
+					if !r_mark_ysA(env, context) {
+						break lab22
+					}
+					break lab23
+				}
+				break lab3
+			}
+			env.Cursor = env.Limit - v_5
+		lab25:
+			for {
+			lab26:
+				for {
+					var v_11 = env.Limit - env.Cursor
+				lab27:
+					for {
+						if !r_mark_sUnUz(env, context) {
+							break lab27
+						}
+						break lab26
+					}
+					env.Cursor = env.Limit - v_11
+				lab28:
+					for {
+						if !r_mark_yUz(env, context) {
+							break lab28
+						}
+						break lab26
+					}
+					env.Cursor = env.Limit - v_11
+				lab29:
+					for {
+						if !r_mark_sUn(env, context) {
+							break lab29
+						}
+						break lab26
+					}
+					env.Cursor = env.Limit - v_11
+					if !r_mark_yUm(env, context) {
+						break lab25
+					}
+					break lab26
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				var v_12 = env.Limit - env.Cursor
+			lab30:
+				for {
+					env.Ket = env.Cursor
+					if !r_mark_ymUs_(env, context) {
+						env.Cursor = env.Limit - v_12
+						break lab30
+					}
+					break lab30
+				}
+				break lab3
+			}
+			env.Cursor = env.Limit - v_5
+			if !r_mark_DUr(env, context) {
+				break lab2
+			}
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			var v_13 = env.Limit - env.Cursor
+		lab31:
+			for {
+				env.Ket = env.Cursor
+			lab32:
+				for {
+					var v_14 = env.Limit - env.Cursor
+				lab33:
+					for {
+						if !r_mark_sUnUz(env, context) {
+							break lab33
+						}
+						break lab32
+					}
+					env.Cursor = env.Limit - v_14
+				lab34:
+					for {
+						if !r_mark_lAr(env, context) {
+							break lab34
+						}
+						break lab32
+					}
+					env.Cursor = env.Limit - v_14
+				lab35:
+					for {
+						if !r_mark_yUm(env, context) {
+							break lab35
+						}
+						break lab32
+					}
+					env.Cursor = env.Limit - v_14
+				lab36:
+					for {
+						if !r_mark_sUn(env, context) {
+							break lab36
+						}
+						break lab32
+					}
+					env.Cursor = env.Limit - v_14
+				lab37:
+					for {
+						if !r_mark_yUz(env, context) {
+							break lab37
+						}
+						break lab32
+					}
+					env.Cursor = env.Limit - v_14
+					break lab32
+				}
+				if !r_mark_ymUs_(env, context) {
+					env.Cursor = env.Limit - v_13
+					break lab31
+				}
+				break lab31
+			}
+			break lab3
+		}
+		env.Bra = env.Cursor
+		if !env.SliceDel() {
+			return false
+		}
+		break lab2
+	}
+	env.Cursor = env.Limit - v_4
+	if !context.b_continue_stemming_noun_suffixes {
+		return false
+	}
+	var v_15 = env.Limit - env.Cursor
+lab38:
+	for {
+	lab39:
+		for {
+			var v_16 = env.Limit - env.Cursor
+		lab40:
+			for {
+				env.Ket = env.Cursor
+				if !r_mark_lAr(env, context) {
+					break lab40
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				var v_17 = env.Limit - env.Cursor
+			lab41:
+				for {
+					if !r_stem_suffix_chain_before_ki(env, context) {
+						env.Cursor = env.Limit - v_17
+						break lab41
+					}
+					break lab41
+				}
+				break lab39
+			}
+			env.Cursor = env.Limit - v_16
+		lab42:
+			for {
+				env.Ket = env.Cursor
+				if !r_check_vowel_harmony(env, context) {
+					break lab42
+				}
+				if env.FindAmongB(A_11, context) == 0 {
+					break lab42
+				}
+				if !r_mark_suffix_with_optional_n_consonant(env, context) {
+					break lab42
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				var v_18 = env.Limit - env.Cursor
+			lab43:
+				for {
+				lab44:
+					for {
+						var v_19 = env.Limit - env.Cursor
+					lab45:
+						for {
+							env.Ket = env.Cursor
+							if !r_mark_lArI(env, context) {
+								break lab45
+							}
+							env.Bra = env.Cursor
+							if !env.SliceDel() {
+								return false
+							}
+							break lab44
+						}
+						env.Cursor = env.Limit - v_19
+					lab46:
+						for {
+							env.Ket = env.Cursor
+						lab47:
+							for {
+								var v_20 = env.Limit - env.Cursor
+							lab48:
+								for {
+									if !r_mark_possessives(env, context) {
+										break lab48
+									}
+									break lab47
+								}
+								env.Cursor = env.Limit - v_20
+								if !r_mark_sU(env, context) {
+									break lab46
+								}
+								break lab47
+							}
+							env.Bra = env.Cursor
+							if !env.SliceDel() {
+								return false
+							}
+							var v_21 = env.Limit - env.Cursor
+						lab49:
+							for {
+								env.Ket = env.Cursor
+								if !r_mark_lAr(env, context) {
+									env.Cursor = env.Limit - v_21
+									break lab49
+								}
+								env.Bra = env.Cursor
+								if !env.SliceDel() {
+									return false
+								}
+								if !r_stem_suffix_chain_before_ki(env, context) {
+									env.Cursor = env.Limit - v_21
+									break lab49
+								}
+								break lab49
+							}
+							break lab44
+						}
+						env.Cursor = env.Limit - v_19
+						env.Ket = env.Cursor
+						if !r_mark_lAr(env, context) {
+							env.Cursor = env.Limit - v_18
+							break lab43
+						}
+						env.Bra = env.Cursor
+						if !env.SliceDel() {
+							return false
+						}
+						if !r_stem_suffix_chain_before_ki(env, context) {
+							env.Cursor = env.Limit - v_18
+							break lab43
+						}
+						break lab44
+					}
+					break lab43
+				}
+				break lab39
+			}
+			env.Cursor = env.Limit - v_16
+		lab50:
+			for {
+				env.Ket = env.Cursor
+			lab51:
+				for {
+					var v_22 = env.Limit - env.Cursor
+				lab52:
+					for {
+						if !r_mark_ndA(env, context) {
+							break lab52
+						}
+						break lab51
+					}
+					env.Cursor = env.Limit - v_22
+					if !r_check_vowel_harmony(env, context) {
+						break lab50
+					}
+					if env.FindAmongB(A_5, context) == 0 {
+						break lab50
+					}
+					break lab51
+				}
+			lab53:
+				for {
+					var v_23 = env.Limit - env.Cursor
+				lab54:
+					for {
+						if !r_mark_lArI(env, context) {
+							break lab54
+						}
+						env.Bra = env.Cursor
+						if !env.SliceDel() {
+							return false
+						}
+						break lab53
+					}
+					env.Cursor = env.Limit - v_23
+				lab55:
+					for {
+						if !r_mark_sU(env, context) {
+							break lab55
+						}
+						env.Bra = env.Cursor
+						if !env.SliceDel() {
+							return false
+						}
+						var v_24 = env.Limit - env.Cursor
+					lab56:
+						for {
+							env.Ket = env.Cursor
+							if !r_mark_lAr(env, context) {
+								env.Cursor = env.Limit - v_24
+								break lab56
+							}
+							env.Bra = env.Cursor
+							if !env.SliceDel() {
+								return false
+							}
+							if !r_stem_suffix_chain_before_ki(env, context) {
+								env.Cursor = env.Limit - v_24
+								break lab56
+							}
+							break lab56
+						}
+						break lab53
+					}
+					env.Cursor = env.Limit - v_23
+					if !r_stem_suffix_chain_before_ki(env, context) {
+						break lab50
+					}
+					break lab53
+				}
+				break lab39
+			}
+			env.Cursor = env.Limit - v_16
+		lab57:
+			for {
+				env.Ket = env.Cursor
+			lab58:
+				for {
+					var v_25 = env.Limit - env.Cursor
+				lab59:
+					for {
+						if !r_check_vowel_harmony(env, context) {
+							break lab59
+						}
+						if env.FindAmongB(A_9, context) == 0 {
+							break lab59
+						}
+						break lab58
+					}
+					env.Cursor = env.Limit - v_25
+					if !r_check_vowel_harmony(env, context) {
+						break lab57
+					}
+					if env.FindAmongB(A_2, context) == 0 {
+						break lab57
+					}
+					break lab58
+				}
+			lab60:
+				for {
+					var v_26 = env.Limit - env.Cursor
+				lab61:
+					for {
+						if !r_mark_sU(env, context) {
+							break lab61
+						}
+						env.Bra = env.Cursor
+						if !env.SliceDel() {
+							return false
+						}
+						var v_27 = env.Limit - env.Cursor
+					lab62:
+						for {
+							env.Ket = env.Cursor
+							if !r_mark_lAr(env, context) {
+								env.Cursor = env.Limit - v_27
+								break lab62
+							}
+							env.Bra = env.Cursor
+							if !env.SliceDel() {
+								return false
+							}
+							if !r_stem_suffix_chain_before_ki(env, context) {
+								env.Cursor = env.Limit - v_27
+								break lab62
+							}
+							break lab62
+						}
+						break lab60
+					}
+					env.Cursor = env.Limit - v_26
+					if !r_mark_lArI(env, context) {
+						break lab57
+					}
+					break lab60
+				}
+				break lab39
+			}
+			env.Cursor = env.Limit - v_16
+		lab63:
+			for {
+				env.Ket = env.Cursor
+				if !r_check_vowel_harmony(env, context) {
+					break lab63
+				}
+				if env.FindAmongB(A_8, context) == 0 {
+					break lab63
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				var v_28 = env.Limit - env.Cursor
+			lab64:
+				for {
+					env.Ket = env.Cursor
+				lab65:
+					for {
+						var v_29 = env.Limit - env.Cursor
+					lab66:
+						for {
+							if !r_mark_possessives(env, context) {
+								break lab66
+							}
+							env.Bra = env.Cursor
+							if !env.SliceDel() {
+								return false
+							}
+							var v_30 = env.Limit - env.Cursor
+						lab67:
+							for {
+								env.Ket = env.Cursor
+								if !r_mark_lAr(env, context) {
+									env.Cursor = env.Limit - v_30
+									break lab67
+								}
+								env.Bra = env.Cursor
+								if !env.SliceDel() {
+									return false
+								}
+								if !r_stem_suffix_chain_before_ki(env, context) {
+									env.Cursor = env.Limit - v_30
+									break lab67
+								}
+								break lab67
+							}
+							break lab65
+						}
+						env.Cursor = env.Limit - v_29
+					lab68:
+						for {
+							if !r_mark_lAr(env, context) {
+								break lab68
+							}
+							env.Bra = env.Cursor
+							if !env.SliceDel() {
+								return false
+							}
+							var v_31 = env.Limit - env.Cursor
+						lab69:
+							for {
+								if !r_stem_suffix_chain_before_ki(env, context) {
+									env.Cursor = env.Limit - v_31
+									break lab69
+								}
+								break lab69
+							}
+							break lab65
+						}
+						env.Cursor = env.Limit - v_29
+						if !r_stem_suffix_chain_before_ki(env, context) {
+							env.Cursor = env.Limit - v_28
+							break lab64
+						}
+						break lab65
+					}
+					break lab64
+				}
+				break lab39
+			}
+			env.Cursor = env.Limit - v_16
+		lab70:
+			for {
+				env.Ket = env.Cursor
+			lab71:
+				for {
+					var v_32 = env.Limit - env.Cursor
+				lab72:
+					for {
+						if !r_mark_nUn(env, context) {
+							break lab72
+						}
+						break lab71
+					}
+					env.Cursor = env.Limit - v_32
+					if !r_check_vowel_harmony(env, context) {
+						break lab70
+					}
+					if env.FindAmongB(A_10, context) == 0 {
+						break lab70
+					}
+					if !r_mark_suffix_with_optional_y_consonant(env, context) {
+						break lab70
+					}
+					break lab71
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				var v_33 = env.Limit - env.Cursor
+			lab73:
+				for {
+				lab74:
+					for {
+						var v_34 = env.Limit - env.Cursor
+					lab75:
+						for {
+							env.Ket = env.Cursor
+							if !r_mark_lAr(env, context) {
+								break lab75
+							}
+							env.Bra = env.Cursor
+							if !env.SliceDel() {
+								return false
+							}
+							if !r_stem_suffix_chain_before_ki(env, context) {
+								break lab75
+							}
+							break lab74
+						}
+						env.Cursor = env.Limit - v_34
+					lab76:
+						for {
+							env.Ket = env.Cursor
+						lab77:
+							for {
+								var v_35 = env.Limit - env.Cursor
+							lab78:
+								for {
+									if !r_mark_possessives(env, context) {
+										break lab78
+									}
+									break lab77
+								}
+								env.Cursor = env.Limit - v_35
+								if !r_mark_sU(env, context) {
+									break lab76
+								}
+								break lab77
+							}
+							env.Bra = env.Cursor
+							if !env.SliceDel() {
+								return false
+							}
+							var v_36 = env.Limit - env.Cursor
+						lab79:
+							for {
+								env.Ket = env.Cursor
+								if !r_mark_lAr(env, context) {
+									env.Cursor = env.Limit - v_36
+									break lab79
+								}
+								env.Bra = env.Cursor
+								if !env.SliceDel() {
+									return false
+								}
+								if !r_stem_suffix_chain_before_ki(env, context) {
+									env.Cursor = env.Limit - v_36
+									break lab79
+								}
+								break lab79
+							}
+							break lab74
+						}
+						env.Cursor = env.Limit - v_34
+						if !r_stem_suffix_chain_before_ki(env, context) {
+							env.Cursor = env.Limit - v_33
+							break lab73
+						}
+						break lab74
+					}
+					break lab73
+				}
+				break lab39
+			}
+			env.Cursor = env.Limit - v_16
+		lab80:
+			for {
+				env.Ket = env.Cursor
+				if !r_mark_lArI(env, context) {
+					break lab80
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				break lab39
+			}
+			env.Cursor = env.Limit - v_16
+		lab81:
+			for {
+				if !r_stem_suffix_chain_before_ki(env, context) {
+					break lab81
+				}
+				break lab39
+			}
+			env.Cursor = env.Limit - v_16
+		lab82:
+			for {
+				env.Ket = env.Cursor
+			lab83:
+				for {
+					var v_37 = env.Limit - env.Cursor
+				lab84:
+					for {
+						if !r_mark_DA(env, context) {
+							break lab84
+						}
+						break lab83
+					}
+					env.Cursor = env.Limit - v_37
+				lab85:
+					for {
+						if !r_check_vowel_harmony(env, context) {
+							break lab85
+						}
+						if !env.InGroupingB(G_U, 105, 305) {
+							break lab85
+						}
+						if !r_mark_suffix_with_optional_y_consonant(env, context) {
+							break lab85
+						}
+						break lab83
+					}
+					env.Cursor = env.Limit - v_37
+					if !r_check_vowel_harmony(env, context) {
+						break lab82
+					}
+					if env.FindAmongB(A_4, context) == 0 {
+						break lab82
+					}
+					if !r_mark_suffix_with_optional_y_consonant(env, context) {
+						break lab82
+					}
+					break lab83
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				var v_38 = env.Limit - env.Cursor
+			lab86:
+				for {
+					env.Ket = env.Cursor
+				lab87:
+					for {
+						var v_39 = env.Limit - env.Cursor
+					lab88:
+						for {
+							if !r_mark_possessives(env, context) {
+								break lab88
+							}
+							env.Bra = env.Cursor
+							if !env.SliceDel() {
+								return false
+							}
+							var v_40 = env.Limit - env.Cursor
+						lab89:
+							for {
+								env.Ket = env.Cursor
+								if !r_mark_lAr(env, context) {
+									env.Cursor = env.Limit - v_40
+									break lab89
+								}
+								break lab89
+							}
+							break lab87
+						}
+						env.Cursor = env.Limit - v_39
+						if !r_mark_lAr(env, context) {
+							env.Cursor = env.Limit - v_38
+							break lab86
+						}
+						break lab87
+					}
+					env.Bra = env.Cursor
+					if !env.SliceDel() {
+						return false
+					}
+					env.Ket = env.Cursor
+					if !r_stem_suffix_chain_before_ki(env, context) {
+						env.Cursor = env.Limit - v_38
+						break lab86
+					}
+					break lab86
+				}
+				break lab39
+			}
+			env.Cursor = env.Limit - v_16
+			env.Ket = env.Cursor
+		lab90:
+			for {
+				var v_41 = env.Limit - env.Cursor
+			lab91:
+				for {
+					if !r_mark_possessives(env, context) {
+						break lab91
+					}
+					break lab90
+				}
+				env.Cursor = env.Limit - v_41
+				if !r_mark_sU(env, context) {
+					break lab38
+				}
+				break lab90
+			}
+			env.Bra = env.Cursor
+			if !env.SliceDel() {
+				return false
+			}
+			var v_42 = env.Limit - env.Cursor
+		lab92:
+			for {
+				env.Ket = env.Cursor
+				if !r_mark_lAr(env, context) {
+					env.Cursor = env.Limit - v_42
+					break lab92
+				}
+				env.Bra = env.Cursor
+				if !env.SliceDel() {
+					return false
+				}
+				if !r_stem_suffix_chain_before_ki(env, context) {
+					env.Cursor = env.Limit - v_42
+					break lab92
+				}
+				break lab92
+			}
+			break lab39
+		}
+		break lab38
+	}
+	env.Cursor = env.Limit - v_15
+	env.Cursor = env.LimitBackward
+	env.LimitBackward = env.Cursor
+	env.Cursor = env.Limit
+	var v_43 = env.Limit - env.Cursor
+lab93:
+	for {
+		if !env.EqSB("ad") {
+			break lab93
+		}
+		var v_44 = env.Limit - env.Cursor
+	lab94:
+		for {
+			if !env.EqSB("soy") {
+				env.Cursor = env.Limit - v_44
+				break lab94
+			}
+			break lab94
+		}
+		if env.Cursor > env.LimitBackward {
+			break lab93
+		}
+		return false
+	}
+	env.Cursor = env.Limit - v_43
+	var v_45 = env.Limit - env.Cursor
+lab95:
+	for {
+		var v_46 = env.Limit - env.Cursor
+	lab96:
+		for {
+			var v_47 = env.Limit - env.Cursor
+		lab97:
+			for {
+				if !env.EqSB("d") {
+					break lab97
+				}
+				break lab96
+			}
+			env.Cursor = env.Limit - v_47
+			if !env.EqSB("g") {
+				break lab95
+			}
+			break lab96
+		}
+		env.Cursor = env.Limit - v_46
+	lab98:
+		for {
+			var v_48 = env.Limit - env.Cursor
+		lab99:
+			for {
+				var v_49 = env.Limit - env.Cursor
+			golab100:
+				for {
+					var v_50 = env.Limit - env.Cursor
+				lab101:
+					for {
+						if !env.InGroupingB(G_vowel, 97, 305) {
+							break lab101
+						}
+						env.Cursor = env.Limit - v_50
+						break golab100
+					}
+					env.Cursor = env.Limit - v_50
+					if env.Cursor <= env.LimitBackward {
+						break lab99
+					}
+					env.PrevChar()
+				}
+			lab102:
+				for {
+					var v_51 = env.Limit - env.Cursor
+				lab103:
+					for {
+						if !env.EqSB("a") {
+							break lab103
+						}
+						break lab102
+					}
+					env.Cursor = env.Limit - v_51
+					if !env.EqSB("\u0131") {
+						break lab99
+					}
+					break lab102
+				}
+				env.Cursor = env.Limit - v_49
+				{
+					var c = env.Cursor
+					bra, ket := env.Cursor, env.Cursor
+					env.Insert(bra, ket, "\u0131")
+					env.Cursor = c
+				}
+				break lab98
+			}
+			env.Cursor = env.Limit - v_48
+		lab104:
+			for {
+				var v_52 = env.Limit - env.Cursor
+			golab105:
+				for {
+					var v_53 = env.Limit - env.Cursor
+				lab106:
+					for {
+						if !env.InGroupingB(G_vowel, 97, 305) {
+							break lab106
+						}
+						env.Cursor = env.Limit - v_53
+						break golab105
+					}
+					env.Cursor = env.Limit - v_53
+					if env.Cursor <= env.LimitBackward {
+						break lab104
+					}
+					env.PrevChar()
+				}
+			lab107:
+				for {
+					var v_54 = env.Limit - env.Cursor
+				lab108:
+					for {
+						if !env.EqSB("e") {
+							break lab108
+						}
+						break lab107
+					}
+					env.Cursor = env.Limit - v_54
+					if !env.EqSB("i") {
+						break lab104
+					}
+					break lab107
+				}
+				env.Cursor = env.Limit - v_52
+				{
+					var c = env.Cursor
+					bra, ket := env.Cursor, env.Cursor
+					env.Insert(bra, ket, "i")
+					env.Cursor = c
+				}
+				break lab98
+			}
+			env.Cursor = env.Limit - v_48
+		lab109:
+			for {
+				var v_55 = env.Limit - env.Cursor
+			golab110:
+				for {
+					var v_56 = env.Limit - env.Cursor
+				lab111:
+					for {
+						if !env.InGroupingB(G_vowel, 97, 305) {
+							break lab111
+						}
+						env.Cursor = env.Limit - v_56
+						break golab110
+					}
+					env.Cursor = env.Limit - v_56
+					if env.Cursor <= env.LimitBackward {
+						break lab109
+					}
+					env.PrevChar()
+				}
+			lab112:
+				for {
+					var v_57 = env.Limit - env.Cursor
+				lab113:
+					for {
+						if !env.EqSB("o") {
+							break lab113
+						}
+						break lab112
+					}
+					env.Cursor = env.Limit - v_57
+					if !env.EqSB("u") {
+						break lab109
+					}
+					break lab112
+				}
+				env.Cursor = env.Limit - v_55
+				{
+					var c = env.Cursor
+					bra, ket := env.Cursor, env.Cursor
+					env.Insert(bra, ket, "u")
+					env.Cursor = c
+				}
+				break lab98
+			}
+			env.Cursor = env.Limit - v_48
+			var v_58 = env.Limit - env.Cursor
+		golab114:
+			for {
+				var v_59 = env.Limit - env.Cursor
+			lab115:
+				for {
+					if !env.InGroupingB(G_vowel, 97, 305) {
+						break lab115
+					}
+					env.Cursor = env.Limit - v_59
+					break golab114
+				}
+				env.Cursor = env.Limit - v_59
+				if env.Cursor <= env.LimitBackward {
+					break lab95
+				}
+				env.PrevChar()
+			}
+		lab116:
+			for {
+				var v_60 = env.Limit - env.Cursor
+			lab117:
+				for {
+					if !env.EqSB("\u00F6") {
+						break lab117
+					}
+					break lab116
+				}
+				env.Cursor = env.Limit - v_60
+				if !env.EqSB("\u00FC") {
+					break lab95
+				}
+				break lab116
+			}
+			env.Cursor = env.Limit - v_58
+			{
+				var c = env.Cursor
+				bra, ket := env.Cursor, env.Cursor
+				env.Insert(bra, ket, "\u00FC")
+				env.Cursor = c
+			}
+			break lab98
+		}
+		break lab95
+	}
+	env.Cursor = env.Limit - v_45
+	var v_61 = env.Limit - env.Cursor
+lab118:
+	for {
+		env.Ket = env.Cursor
+		among_var = env.FindAmongB(A_23, context)
+		if among_var == 0 {
+			break lab118
+		}
+		env.Bra = env.Cursor
+		if among_var == 1 {
+			if !env.SliceFrom("p") {
+				return false
+			}
+		} else if among_var == 2 {
+			if !env.SliceFrom("\u00E7") {
+				return false
+			}
+		} else if among_var == 3 {
+			if !env.SliceFrom("t") {
+				return false
+			}
+		} else if among_var == 4 {
+			if !env.SliceFrom("k") {
+				return false
+			}
+		}
+		break lab118
+	}
+	env.Cursor = env.Limit - v_61
+	env.Cursor = env.LimitBackward
+	return true
+}
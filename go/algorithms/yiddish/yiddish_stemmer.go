@@ -0,0 +1,1001 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+package yiddish
+
+import (
+	snowballRuntime "github.com/snowballstem/snowball/go"
+)
+
+var A_0 = []*snowballRuntime.Among{
+	{Str: "\u05D5\u05D5", A: -1, B: 1, F: nil},
+	{Str: "\u05D5\u05D9", A: -1, B: 2, F: nil},
+	{Str: "\u05D9\u05D9", A: -1, B: 3, F: nil},
+	{Str: "\u05DA", A: -1, B: 4, F: nil},
+	{Str: "\u05DD", A: -1, B: 5, F: nil},
+	{Str: "\u05DF", A: -1, B: 6, F: nil},
+	{Str: "\u05E3", A: -1, B: 7, F: nil},
+	{Str: "\u05E5", A: -1, B: 8, F: nil},
+}
+
+var A_1 = []*snowballRuntime.Among{
+	{Str: "\u05D0\u05D3\u05D5\u05E8\u05DB", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05D4\u05D9\u05E0", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05D4\u05E2\u05E8", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05D4\u05F2\u05DE", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05D5\u05DE", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05D5\u05E0\u05D8\u05E2\u05E8", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05D9\u05D1\u05E2\u05E8", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05E0", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05E0\u05D8", A: 7, B: 1, F: nil},
+	{Str: "\u05D0\u05E0\u05D8\u05E7\u05E2\u05D2\u05E0", A: 8, B: 1, F: nil},
+	{Str: "\u05D0\u05E0\u05D9\u05D3\u05E2\u05E8", A: 7, B: 1, F: nil},
+	{Str: "\u05D0\u05E4", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05E4\u05D9\u05E8", A: 11, B: 1, F: nil},
+	{Str: "\u05D0\u05E7\u05E2\u05D2\u05E0", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05E8\u05D0\u05E4", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05E8\u05D5\u05DE", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05E8\u05D5\u05E0\u05D8\u05E2\u05E8", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05E8\u05D9\u05D1\u05E2\u05E8", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05E8\u05F1\u05E1", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05E8\u05F1\u05E4", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05E8\u05F2\u05E0", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05F0\u05E2\u05E7", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05F1\u05E1", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05F1\u05E4", A: -1, B: 1, F: nil},
+	{Str: "\u05D0\u05F2\u05E0", A: -1, B: 1, F: nil},
+	{Str: "\u05D1\u05D0", A: -1, B: 1, F: nil},
+	{Str: "\u05D1\u05F2", A: -1, B: 1, F: nil},
+	{Str: "\u05D3\u05D5\u05E8\u05DB", A: -1, B: 1, F: nil},
+	{Str: "\u05D3\u05E2\u05E8", A: -1, B: 1, F: nil},
+	{Str: "\u05DE\u05D9\u05D8", A: -1, B: 1, F: nil},
+	{Str: "\u05E0\u05D0\u05DB", A: -1, B: 1, F: nil},
+	{Str: "\u05E4\u05D0\u05E8", A: -1, B: 1, F: nil},
+	{Str: "\u05E4\u05D0\u05E8\u05D1\u05F2", A: 31, B: 1, F: nil},
+	{Str: "\u05E4\u05D0\u05E8\u05F1\u05E1", A: 31, B: 1, F: nil},
+	{Str: "\u05E4\u05D5\u05E0\u05D0\u05E0\u05D3\u05E2\u05E8", A: -1, B: 1, F: nil},
+	{Str: "\u05E6\u05D5", A: -1, B: 1, F: nil},
+	{Str: "\u05E6\u05D5\u05D6\u05D0\u05DE\u05E2\u05E0", A: 35, B: 1, F: nil},
+	{Str: "\u05E6\u05D5\u05E0\u05F1\u05E4", A: 35, B: 1, F: nil},
+	{Str: "\u05E6\u05D5\u05E8\u05D9\u05E7", A: 35, B: 1, F: nil},
+	{Str: "\u05E6\u05E2", A: -1, B: 1, F: nil},
+}
+
+var A_2 = []*snowballRuntime.Among{
+	{Str: "\u05D3\u05D6\u05E9", A: -1, B: -1, F: nil},
+	{Str: "\u05E9\u05D8\u05E8", A: -1, B: -1, F: nil},
+	{Str: "\u05E9\u05D8\u05E9", A: -1, B: -1, F: nil},
+	{Str: "\u05E9\u05E4\u05E8", A: -1, B: -1, F: nil},
+}
+
+var A_3 = []*snowballRuntime.Among{
+	{Str: "\u05E7\u05DC\u05D9\u05D1", A: -1, B: 9, F: nil},
+	{Str: "\u05E8\u05D9\u05D1", A: -1, B: 10, F: nil},
+	{Str: "\u05D8\u05E8\u05D9\u05D1", A: 1, B: 7, F: nil},
+	{Str: "\u05E9\u05E8\u05D9\u05D1", A: 1, B: 15, F: nil},
+	{Str: "\u05D4\u05F1\u05D1", A: -1, B: 23, F: nil},
+	{Str: "\u05E9\u05F0\u05D9\u05D2", A: -1, B: 12, F: nil},
+	{Str: "\u05D2\u05D0\u05E0\u05D2", A: -1, B: 1, F: nil},
+	{Str: "\u05D6\u05D5\u05E0\u05D2", A: -1, B: 18, F: nil},
+	{Str: "\u05E9\u05DC\u05D5\u05E0\u05D2", A: -1, B: 21, F: nil},
+	{Str: "\u05E6\u05F0\u05D5\u05E0\u05D2", A: -1, B: 20, F: nil},
+	{Str: "\u05D1\u05F1\u05D2", A: -1, B: 22, F: nil},
+	{Str: "\u05D1\u05D5\u05E0\u05D3", A: -1, B: 16, F: nil},
+	{Str: "\u05F0\u05D9\u05D6", A: -1, B: 6, F: nil},
+	{Str: "\u05D1\u05D9\u05D8", A: -1, B: 4, F: nil},
+	{Str: "\u05DC\u05D9\u05D8", A: -1, B: 8, F: nil},
+	{Str: "\u05DE\u05D9\u05D8", A: -1, B: 3, F: nil},
+	{Str: "\u05E9\u05E0\u05D9\u05D8", A: -1, B: 14, F: nil},
+	{Str: "\u05E0\u05D5\u05DE", A: -1, B: 2, F: nil},
+	{Str: "\u05E9\u05D8\u05D0\u05E0", A: -1, B: 25, F: nil},
+	{Str: "\u05D1\u05D9\u05E1", A: -1, B: 5, F: nil},
+	{Str: "\u05E9\u05DE\u05D9\u05E1", A: -1, B: 13, F: nil},
+	{Str: "\u05E8\u05D9\u05E1", A: -1, B: 11, F: nil},
+	{Str: "\u05D8\u05E8\u05D5\u05E0\u05E7", A: -1, B: 19, F: nil},
+	{Str: "\u05E4\u05D0\u05E8\u05DC\u05F1\u05E8", A: -1, B: 24, F: nil},
+	{Str: "\u05E9\u05F0\u05F1\u05E8", A: -1, B: 26, F: nil},
+	{Str: "\u05F0\u05D5\u05D8\u05E9", A: -1, B: 17, F: nil},
+}
+
+var A_4 = []*snowballRuntime.Among{
+	{Str: "\u05D5\u05E0\u05D2", A: -1, B: 1, F: nil},
+	{Str: "\u05E1\u05D8\u05D5", A: -1, B: 1, F: nil},
+	{Str: "\u05D8", A: -1, B: 1, F: nil},
+	{Str: "\u05D1\u05E8\u05D0\u05DB\u05D8", A: 2, B: 31, F: nil},
+	{Str: "\u05E1\u05D8", A: 2, B: 1, F: nil},
+	{Str: "\u05D9\u05E1\u05D8", A: 4, B: 33, F: nil},
+	{Str: "\u05E2\u05D8", A: 2, B: 1, F: nil},
+	{Str: "\u05E9\u05D0\u05E4\u05D8", A: 2, B: 1, F: nil},
+	{Str: "\u05D4\u05F2\u05D8", A: 2, B: 1, F: nil},
+	{Str: "\u05E7\u05F2\u05D8", A: 2, B: 1, F: nil},
+	{Str: "\u05D9\u05E7\u05F2\u05D8", A: 9, B: 1, F: nil},
+	{Str: "\u05DC\u05E2\u05DB", A: -1, B: 1, F: nil},
+	{Str: "\u05E2\u05DC\u05E2\u05DB", A: 11, B: 1, F: nil},
+	{Str: "\u05D9\u05D6\u05DE", A: -1, B: 1, F: nil},
+	{Str: "\u05D9\u05DE", A: -1, B: 1, F: nil},
+	{Str: "\u05E2\u05DE", A: -1, B: 1, F: nil},
+	{Str: "\u05E2\u05E0\u05E2\u05DE", A: 15, B: 3, F: nil},
+	{Str: "\u05D8\u05E2\u05E0\u05E2\u05DE", A: 16, B: 4, F: nil},
+	{Str: "\u05E0", A: -1, B: 1, F: nil},
+	{Str: "\u05E7\u05DC\u05D9\u05D1\u05E0", A: 18, B: 14, F: nil},
+	{Str: "\u05E8\u05D9\u05D1\u05E0", A: 18, B: 15, F: nil},
+	{Str: "\u05D8\u05E8\u05D9\u05D1\u05E0", A: 20, B: 12, F: nil},
+	{Str: "\u05E9\u05E8\u05D9\u05D1\u05E0", A: 20, B: 7, F: nil},
+	{Str: "\u05D4\u05F1\u05D1\u05E0", A: 18, B: 27, F: nil},
+	{Str: "\u05E9\u05F0\u05D9\u05D2\u05E0", A: 18, B: 17, F: nil},
+	{Str: "\u05D6\u05D5\u05E0\u05D2\u05E0", A: 18, B: 22, F: nil},
+	{Str: "\u05E9\u05DC\u05D5\u05E0\u05D2\u05E0", A: 18, B: 25, F: nil},
+	{Str: "\u05E6\u05F0\u05D5\u05E0\u05D2\u05E0", A: 18, B: 24, F: nil},
+	{Str: "\u05D1\u05F1\u05D2\u05E0", A: 18, B: 26, F: nil},
+	{Str: "\u05D1\u05D5\u05E0\u05D3\u05E0", A: 18, B: 20, F: nil},
+	{Str: "\u05F0\u05D9\u05D6\u05E0", A: 18, B: 11, F: nil},
+	{Str: "\u05D8\u05E0", A: 18, B: 4, F: nil},
+	{Str: "GE\u05D1\u05D9\u05D8\u05E0", A: 31, B: 9, F: nil},
+	{Str: "GE\u05DC\u05D9\u05D8\u05E0", A: 31, B: 13, F: nil},
+	{Str: "GE\u05DE\u05D9\u05D8\u05E0", A: 31, B: 8, F: nil},
+	{Str: "\u05E9\u05E0\u05D9\u05D8\u05E0", A: 31, B: 19, F: nil},
+	{Str: "\u05E1\u05D8\u05E0", A: 31, B: 1, F: nil},
+	{Str: "\u05D9\u05E1\u05D8\u05E0", A: 36, B: 1, F: nil},
+	{Str: "\u05E2\u05D8\u05E0", A: 31, B: 1, F: nil},
+	{Str: "GE\u05D1\u05D9\u05E1\u05E0", A: 18, B: 10, F: nil},
+	{Str: "\u05E9\u05DE\u05D9\u05E1\u05E0", A: 18, B: 18, F: nil},
+	{Str: "GE\u05E8\u05D9\u05E1\u05E0", A: 18, B: 16, F: nil},
+	{Str: "\u05E2\u05E0", A: 18, B: 1, F: nil},
+	{Str: "\u05D2\u05D0\u05E0\u05D2\u05E2\u05E0", A: 42, B: 5, F: nil},
+	{Str: "\u05E2\u05DC\u05E2\u05E0", A: 42, B: 1, F: nil},
+	{Str: "\u05E0\u05D5\u05DE\u05E2\u05E0", A: 42, B: 6, F: nil},
+	{Str: "\u05D9\u05D6\u05DE\u05E2\u05E0", A: 42, B: 1, F: nil},
+	{Str: "\u05E9\u05D8\u05D0\u05E0\u05E2\u05E0", A: 42, B: 29, F: nil},
+	{Str: "\u05D8\u05E8\u05D5\u05E0\u05E7\u05E0", A: 18, B: 23, F: nil},
+	{Str: "\u05E4\u05D0\u05E8\u05DC\u05F1\u05E8\u05E0", A: 18, B: 28, F: nil},
+	{Str: "\u05E9\u05F0\u05F1\u05E8\u05E0", A: 18, B: 30, F: nil},
+	{Str: "\u05F0\u05D5\u05D8\u05E9\u05E0", A: 18, B: 21, F: nil},
+	{Str: "\u05D2\u05F2\u05E0", A: 18, B: 5, F: nil},
+	{Str: "\u05E1", A: -1, B: 1, F: nil},
+	{Str: "\u05D8\u05E1", A: 53, B: 4, F: nil},
+	{Str: "\u05E2\u05D8\u05E1", A: 54, B: 1, F: nil},
+	{Str: "\u05E0\u05E1", A: 53, B: 1, F: nil},
+	{Str: "\u05D8\u05E0\u05E1", A: 56, B: 4, F: nil},
+	{Str: "\u05E2\u05E0\u05E1", A: 56, B: 3, F: nil},
+	{Str: "\u05E2\u05E1", A: 53, B: 1, F: nil},
+	{Str: "\u05D9\u05E2\u05E1", A: 59, B: 2, F: nil},
+	{Str: "\u05E2\u05DC\u05E2\u05E1", A: 59, B: 1, F: nil},
+	{Str: "\u05E2\u05E8\u05E1", A: 53, B: 1, F: nil},
+	{Str: "\u05E2\u05E0\u05E2\u05E8\u05E1", A: 62, B: 1, F: nil},
+	{Str: "\u05E2", A: -1, B: 1, F: nil},
+	{Str: "\u05D8\u05E2", A: 64, B: 4, F: nil},
+	{Str: "\u05E1\u05D8\u05E2", A: 65, B: 1, F: nil},
+	{Str: "\u05E2\u05D8\u05E2", A: 65, B: 1, F: nil},
+	{Str: "\u05D9\u05E2", A: 64, B: -1, F: nil},
+	{Str: "\u05E2\u05DC\u05E2", A: 64, B: 1, F: nil},
+	{Str: "\u05E2\u05E0\u05E2", A: 64, B: 3, F: nil},
+	{Str: "\u05D8\u05E2\u05E0\u05E2", A: 70, B: 4, F: nil},
+	{Str: "\u05E2\u05E8", A: -1, B: 1, F: nil},
+	{Str: "\u05D8\u05E2\u05E8", A: 72, B: 4, F: nil},
+	{Str: "\u05E1\u05D8\u05E2\u05E8", A: 73, B: 1, F: nil},
+	{Str: "\u05E2\u05D8\u05E2\u05E8", A: 73, B: 1, F: nil},
+	{Str: "\u05E2\u05E0\u05E2\u05E8", A: 72, B: 3, F: nil},
+	{Str: "\u05D8\u05E2\u05E0\u05E2\u05E8", A: 76, B: 4, F: nil},
+	{Str: "\u05D5\u05EA", A: -1, B: 32, F: nil},
+}
+
+var A_5 = []*snowballRuntime.Among{
+	{Str: "\u05D5\u05E0\u05D2", A: -1, B: 1, F: nil},
+	{Str: "\u05E9\u05D0\u05E4\u05D8", A: -1, B: 1, F: nil},
+	{Str: "\u05D4\u05F2\u05D8", A: -1, B: 1, F: nil},
+	{Str: "\u05E7\u05F2\u05D8", A: -1, B: 1, F: nil},
+	{Str: "\u05D9\u05E7\u05F2\u05D8", A: 3, B: 1, F: nil},
+	{Str: "\u05DC", A: -1, B: 2, F: nil},
+}
+
+var A_6 = []*snowballRuntime.Among{
+	{Str: "\u05D9\u05D2", A: -1, B: 1, F: nil},
+	{Str: "\u05D9\u05E7", A: -1, B: 1, F: nil},
+	{Str: "\u05D3\u05D9\u05E7", A: 1, B: 1, F: nil},
+	{Str: "\u05E0\u05D3\u05D9\u05E7", A: 2, B: 1, F: nil},
+	{Str: "\u05E2\u05E0\u05D3\u05D9\u05E7", A: 3, B: 1, F: nil},
+	{Str: "\u05D1\u05DC\u05D9\u05E7", A: 1, B: -1, F: nil},
+	{Str: "\u05D2\u05DC\u05D9\u05E7", A: 1, B: -1, F: nil},
+	{Str: "\u05E0\u05D9\u05E7", A: 1, B: 1, F: nil},
+	{Str: "\u05D9\u05E9", A: -1, B: 1, F: nil},
+}
+
+var G_niked = []byte{255, 155, 6}
+
+var G_vowel = []byte{33, 2, 4, 0, 6}
+
+var G_consonant = []byte{239, 254, 253, 131}
+
+type Context struct {
+	i_x  int
+	i_p1 int
+}
+
+func Stem(env *snowballRuntime.Env) bool {
+	var context = &Context{
+		i_x:  0,
+		i_p1: 0,
+	}
+	_ = context
+	var among_var int32
+lab0:
+	for {
+		var v_2 = env.Cursor
+	lab1:
+		for {
+		replab2:
+			for {
+				var v_3 = env.Cursor
+			lab3:
+				for range [2]struct{}{} {
+				golab4:
+					for {
+						var v_4 = env.Cursor
+					lab5:
+						for {
+							env.Bra = env.Cursor
+							among_var = env.FindAmong(A_0, context)
+							if among_var == 0 {
+								break lab5
+							}
+							env.Ket = env.Cursor
+							if among_var == 1 {
+								var v_5 = env.Cursor
+							lab6:
+								for {
+									if !env.EqS("\u05BC") {
+										break lab6
+									}
+									break lab5
+								}
+								env.Cursor = v_5
+								if !env.SliceFrom("\u05F0") {
+									return false
+								}
+							} else if among_var == 2 {
+								var v_6 = env.Cursor
+							lab7:
+								for {
+									if !env.EqS("\u05B4") {
+										break lab7
+									}
+									break lab5
+								}
+								env.Cursor = v_6
+								if !env.SliceFrom("\u05F1") {
+									return false
+								}
+							} else if among_var == 3 {
+								var v_7 = env.Cursor
+							lab8:
+								for {
+									if !env.EqS("\u05B4") {
+										break lab8
+									}
+									break lab5
+								}
+								env.Cursor = v_7
+								if !env.SliceFrom("\u05F2") {
+									return false
+								}
+							} else if among_var == 4 {
+								if !env.SliceFrom("\u05DB") {
+									return false
+								}
+							} else if among_var == 5 {
+								if !env.SliceFrom("\u05DE") {
+									return false
+								}
+							} else if among_var == 6 {
+								if !env.SliceFrom("\u05E0") {
+									return false
+								}
+							} else if among_var == 7 {
+								if !env.SliceFrom("\u05E4") {
+									return false
+								}
+							} else if among_var == 8 {
+								if !env.SliceFrom("\u05E6") {
+									return false
+								}
+							}
+							env.Cursor = v_4
+							break golab4
+						}
+						env.Cursor = v_4
+						if env.Cursor >= env.Limit {
+							break lab3
+						}
+						env.NextChar()
+					}
+					continue replab2
+				}
+				env.Cursor = v_3
+				break replab2
+			}
+			break lab1
+		}
+		env.Cursor = v_2
+		var v_8 = env.Cursor
+	lab9:
+		for {
+		replab10:
+			for {
+				var v_9 = env.Cursor
+			lab11:
+				for range [2]struct{}{} {
+				golab12:
+					for {
+						var v_10 = env.Cursor
+					lab13:
+						for {
+							env.Bra = env.Cursor
+							if !env.InGrouping(G_niked, 1456, 1474) {
+								break lab13
+							}
+							env.Ket = env.Cursor
+							if !env.SliceDel() {
+								return false
+							}
+							env.Cursor = v_10
+							break golab12
+						}
+						env.Cursor = v_10
+						if env.Cursor >= env.Limit {
+							break lab11
+						}
+						env.NextChar()
+					}
+					continue replab10
+				}
+				env.Cursor = v_9
+				break replab10
+			}
+			break lab9
+		}
+		env.Cursor = v_8
+		break lab0
+	}
+	var v_11 = env.Cursor
+lab14:
+	for {
+		context.i_p1 = env.Limit
+		var v_12 = env.Cursor
+	lab15:
+		for {
+			env.Bra = env.Cursor
+			if !env.EqS("\u05D2\u05E2") {
+				env.Cursor = v_12
+				break lab15
+			}
+			env.Ket = env.Cursor
+			var v_13 = env.Cursor
+		lab16:
+			for {
+			lab17:
+				for {
+					var v_14 = env.Cursor
+				lab18:
+					for {
+						if !env.EqS("\u05DC\u05D8") {
+							break lab18
+						}
+						break lab17
+					}
+					env.Cursor = v_14
+					if !env.EqS("\u05D1\u05E0") {
+						break lab16
+					}
+					break lab17
+				}
+				env.Cursor = v_12
+				break lab15
+			}
+			env.Cursor = v_13
+			if !env.SliceFrom("GE") {
+				return false
+			}
+			break lab15
+		}
+		var v_15 = env.Cursor
+	lab19:
+		for {
+			if env.FindAmong(A_1, context) == 0 {
+				env.Cursor = v_15
+				break lab19
+			}
+		lab20:
+			for {
+				var v_16 = env.Cursor
+			lab21:
+				for {
+					var v_17 = env.Cursor
+				lab22:
+					for {
+						var v_18 = env.Cursor
+					lab23:
+						for {
+							if !env.EqS("\u05E6\u05D5\u05D2\u05E0") {
+								break lab23
+							}
+							break lab22
+						}
+						env.Cursor = v_18
+					lab24:
+						for {
+							if !env.EqS("\u05E6\u05D5\u05E7\u05D8") {
+								break lab24
+							}
+							break lab22
+						}
+						env.Cursor = v_18
+						if !env.EqS("\u05E6\u05D5\u05E7\u05E0") {
+							break lab21
+						}
+						break lab22
+					}
+					if env.Cursor < env.Limit {
+						break lab21
+					}
+					env.Cursor = v_17
+					break lab20
+				}
+				env.Cursor = v_16
+			lab25:
+				for {
+					var v_19 = env.Cursor
+					if !env.EqS("\u05D2\u05E2\u05D1\u05E0") {
+						break lab25
+					}
+					env.Cursor = v_19
+					break lab20
+				}
+				env.Cursor = v_16
+			lab26:
+				for {
+					env.Bra = env.Cursor
+					if !env.EqS("\u05D2\u05E2") {
+						break lab26
+					}
+					env.Ket = env.Cursor
+					if !env.SliceFrom("GE") {
+						return false
+					}
+					break lab20
+				}
+				env.Cursor = v_16
+				env.Bra = env.Cursor
+				if !env.EqS("\u05E6\u05D5") {
+					env.Cursor = v_15
+					break lab19
+				}
+				env.Ket = env.Cursor
+				if !env.SliceFrom("TSU") {
+					return false
+				}
+				break lab20
+			}
+			break lab19
+		}
+		var v_20 = env.Cursor
+		if !env.Hop(3) {
+			break lab14
+		}
+		context.i_x = env.Cursor
+		env.Cursor = v_20
+		var v_21 = env.Cursor
+	lab27:
+		for {
+			if env.FindAmong(A_2, context) == 0 {
+				env.Cursor = v_21
+				break lab27
+			}
+			break lab27
+		}
+		var v_22 = env.Cursor
+	lab28:
+		for {
+			if !env.InGrouping(G_consonant, 1489, 1520) {
+				break lab28
+			}
+			if !env.InGrouping(G_consonant, 1489, 1520) {
+				break lab28
+			}
+			if !env.InGrouping(G_consonant, 1489, 1520) {
+				break lab28
+			}
+			context.i_p1 = env.Cursor
+			break lab14
+		}
+		env.Cursor = v_22
+	golab29:
+		for {
+			var v_23 = env.Cursor
+		lab30:
+			for {
+				if !env.InGrouping(G_vowel, 1488, 1522) {
+					break lab30
+				}
+				env.Cursor = v_23
+				break golab29
+			}
+			env.Cursor = v_23
+			if env.Cursor >= env.Limit {
+				break lab14
+			}
+			env.NextChar()
+		}
+	replab31:
+		for {
+		lab32:
+			for range [2]struct{}{} {
+				if !env.InGrouping(G_vowel, 1488, 1522) {
+					break lab32
+				}
+				continue replab31
+			}
+			break replab31
+		}
+		context.i_p1 = env.Cursor
+	lab33:
+		for {
+			if !(context.i_p1 < context.i_x) {
+				break lab33
+			}
+			context.i_p1 = context.i_x
+			break lab33
+		}
+		break lab14
+	}
+	env.Cursor = v_11
+	env.LimitBackward = env.Cursor
+	env.Cursor = env.Limit
+lab34:
+	for {
+		var v_27 = env.Limit - env.Cursor
+	lab35:
+		for {
+			env.Ket = env.Cursor
+			among_var = env.FindAmongB(A_4, context)
+			if among_var == 0 {
+				break lab35
+			}
+			env.Bra = env.Cursor
+			if among_var == 1 {
+				if !(context.i_p1 <= env.Cursor) {
+					break lab35
+				}
+				if !env.SliceDel() {
+					return false
+				}
+			} else if among_var == 2 {
+				if !(context.i_p1 <= env.Cursor) {
+					break lab35
+				}
+				if !env.SliceFrom("\u05D9\u05E2") {
+					return false
+				}
+			} else if among_var == 3 {
+				if !(context.i_p1 <= env.Cursor) {
+					break lab35
+				}
+				if !env.SliceDel() {
+					return false
+				}
+				env.Ket = env.Cursor
+				among_var = env.FindAmongB(A_3, context)
+				if among_var == 0 {
+					break lab35
+				}
+				env.Bra = env.Cursor
+				if among_var == 1 {
+					if !env.SliceFrom("\u05D2\u05F2") {
+						return false
+					}
+				} else if among_var == 2 {
+					if !env.SliceFrom("\u05E0\u05E2\u05DE") {
+						return false
+					}
+				} else if among_var == 3 {
+					if !env.SliceFrom("\u05DE\u05F2\u05D3") {
+						return false
+					}
+				} else if among_var == 4 {
+					if !env.SliceFrom("\u05D1\u05F2\u05D8") {
+						return false
+					}
+				} else if among_var == 5 {
+					if !env.SliceFrom("\u05D1\u05F2\u05E1") {
+						return false
+					}
+				} else if among_var == 6 {
+					if !env.SliceFrom("\u05F0\u05F2\u05D6") {
+						return false
+					}
+				} else if among_var == 7 {
+					if !env.SliceFrom("\u05D8\u05E8\u05F2\u05D1") {
+						return false
+					}
+				} else if among_var == 8 {
+					if !env.SliceFrom("\u05DC\u05F2\u05D8") {
+						return false
+					}
+				} else if among_var == 9 {
+					if !env.SliceFrom("\u05E7\u05DC\u05F2\u05D1") {
+						return false
+					}
+				} else if among_var == 10 {
+					if !env.SliceFrom("\u05E8\u05F2\u05D1") {
+						return false
+					}
+				} else if among_var == 11 {
+					if !env.SliceFrom("\u05E8\u05F2\u05E1") {
+						return false
+					}
+				} else if among_var == 12 {
+					if !env.SliceFrom("\u05E9\u05F0\u05F2\u05D2") {
+						return false
+					}
+				} else if among_var == 13 {
+					if !env.SliceFrom("\u05E9\u05DE\u05F2\u05E1") {
+						return false
+					}
+				} else if among_var == 14 {
+					if !env.SliceFrom("\u05E9\u05E0\u05F2\u05D3") {
+						return false
+					}
+				} else if among_var == 15 {
+					if !env.SliceFrom("\u05E9\u05E8\u05F2\u05D1") {
+						return false
+					}
+				} else if among_var == 16 {
+					if !env.SliceFrom("\u05D1\u05D9\u05E0\u05D3") {
+						return false
+					}
+				} else if among_var == 17 {
+					if !env.SliceFrom("\u05F0\u05D9\u05D8\u05E9") {
+						return false
+					}
+				} else if among_var == 18 {
+					if !env.SliceFrom("\u05D6\u05D9\u05E0\u05D2") {
+						return false
+					}
+				} else if among_var == 19 {
+					if !env.SliceFrom("\u05D8\u05E8\u05D9\u05E0\u05E7") {
+						return false
+					}
+				} else if among_var == 20 {
+					if !env.SliceFrom("\u05E6\u05F0\u05D9\u05E0\u05D2") {
+						return false
+					}
+				} else if among_var == 21 {
+					if !env.SliceFrom("\u05E9\u05DC\u05D9\u05E0\u05D2") {
+						return false
+					}
+				} else if among_var == 22 {
+					if !env.SliceFrom("\u05D1\u05F2\u05D2") {
+						return false
+					}
+				} else if among_var == 23 {
+					if !env.SliceFrom("\u05D4\u05F2\u05D1") {
+						return false
+					}
+				} else if among_var == 24 {
+					if !env.SliceFrom("\u05E4\u05D0\u05E8\u05DC\u05D9\u05E8") {
+						return false
+					}
+				} else if among_var == 25 {
+					if !env.SliceFrom("\u05E9\u05D8\u05F2") {
+						return false
+					}
+				} else if among_var == 26 {
+					if !env.SliceFrom("\u05E9\u05F0\u05E2\u05E8") {
+						return false
+					}
+				}
+			} else if among_var == 4 {
+			lab36:
+				for {
+					var v_28 = env.Limit - env.Cursor
+				lab37:
+					for {
+						if !(context.i_p1 <= env.Cursor) {
+							break lab37
+						}
+						if !env.SliceDel() {
+							return false
+						}
+						break lab36
+					}
+					env.Cursor = env.Limit - v_28
+					if !env.SliceFrom("\u05D8") {
+						return false
+					}
+					break lab36
+				}
+				env.Ket = env.Cursor
+				if !env.EqSB("\u05D1\u05E8\u05D0\u05DB") {
+					break lab35
+				}
+				var v_29 = env.Limit - env.Cursor
+			lab38:
+				for {
+					if !env.EqSB("\u05D2\u05E2") {
+						env.Cursor = env.Limit - v_29
+						break lab38
+					}
+					break lab38
+				}
+				env.Bra = env.Cursor
+				if !env.SliceFrom("\u05D1\u05E8\u05E2\u05E0\u05D2") {
+					return false
+				}
+			} else if among_var == 5 {
+				if !env.SliceFrom("\u05D2\u05F2") {
+					return false
+				}
+			} else if among_var == 6 {
+				if !env.SliceFrom("\u05E0\u05E2\u05DE") {
+					return false
+				}
+			} else if among_var == 7 {
+				if !env.SliceFrom("\u05E9\u05E8\u05F2\u05D1") {
+					return false
+				}
+			} else if among_var == 8 {
+				if !env.SliceFrom("\u05DE\u05F2\u05D3") {
+					return false
+				}
+			} else if among_var == 9 {
+				if !env.SliceFrom("\u05D1\u05F2\u05D8") {
+					return false
+				}
+			} else if among_var == 10 {
+				if !env.SliceFrom("\u05D1\u05F2\u05E1") {
+					return false
+				}
+			} else if among_var == 11 {
+				if !env.SliceFrom("\u05F0\u05F2\u05D6") {
+					return false
+				}
+			} else if among_var == 12 {
+				if !env.SliceFrom("\u05D8\u05E8\u05F2\u05D1") {
+					return false
+				}
+			} else if among_var == 13 {
+				if !env.SliceFrom("\u05DC\u05F2\u05D8") {
+					return false
+				}
+			} else if among_var == 14 {
+				if !env.SliceFrom("\u05E7\u05DC\u05F2\u05D1") {
+					return false
+				}
+			} else if among_var == 15 {
+				if !env.SliceFrom("\u05E8\u05F2\u05D1") {
+					return false
+				}
+			} else if among_var == 16 {
+				if !env.SliceFrom("\u05E8\u05F2\u05E1") {
+					return false
+				}
+			} else if among_var == 17 {
+				if !env.SliceFrom("\u05E9\u05F0\u05F2\u05D2") {
+					return false
+				}
+			} else if among_var == 18 {
+				if !env.SliceFrom("\u05E9\u05DE\u05F2\u05E1") {
+					return false
+				}
+			} else if among_var == 19 {
+				if !env.SliceFrom("\u05E9\u05E0\u05F2\u05D3") {
+					return false
+				}
+			} else if among_var == 20 {
+				if !env.SliceFrom("\u05D1\u05D9\u05E0\u05D3") {
+					return false
+				}
+			} else if among_var == 21 {
+				if !env.SliceFrom("\u05F0\u05D9\u05D8\u05E9") {
+					return false
+				}
+			} else if among_var == 22 {
+				if !env.SliceFrom("\u05D6\u05D9\u05E0\u05D2") {
+					return false
+				}
+			} else if among_var == 23 {
+				if !env.SliceFrom("\u05D8\u05E8\u05D9\u05E0\u05E7") {
+					return false
+				}
+			} else if among_var == 24 {
+				if !env.SliceFrom("\u05E6\u05F0\u05D9\u05E0\u05D2") {
+					return false
+				}
+			} else if among_var == 25 {
+				if !env.SliceFrom("\u05E9\u05DC\u05D9\u05E0\u05D2") {
+					return false
+				}
+			} else if among_var == 26 {
+				if !env.SliceFrom("\u05D1\u05F2\u05D2") {
+					return false
+				}
+			} else if among_var == 27 {
+				if !env.SliceFrom("\u05D4\u05F2\u05D1") {
+					return false
+				}
+			} else if among_var == 28 {
+				if !env.SliceFrom("\u05E4\u05D0\u05E8\u05DC\u05D9\u05E8") {
+					return false
+				}
+			} else if among_var == 29 {
+				if !env.SliceFrom("\u05E9\u05D8\u05F2") {
+					return false
+				}
+			} else if among_var == 30 {
+				if !env.SliceFrom("\u05E9\u05F0\u05E2\u05E8") {
+					return false
+				}
+			} else if among_var == 31 {
+				if !env.SliceFrom("\u05D1\u05E8\u05E2\u05E0\u05D2") {
+					return false
+				}
+			} else if among_var == 32 {
+				if !(context.i_p1 <= env.Cursor) {
+					break lab35
+				}
+				if !env.SliceFrom("\u05D4") {
+					return false
+				}
+			} else if among_var == 33 {
+			lab39:
+				for {
+					var v_30 = env.Limit - env.Cursor
+				lab40:
+					for {
+					lab41:
+						for {
+							var v_31 = env.Limit - env.Cursor
+						lab42:
+							for {
+								if !env.EqSB("\u05D2") {
+									break lab42
+								}
+								break lab41
+							}
+							env.Cursor = env.Limit - v_31
+							if !env.EqSB("\u05E9") {
+								break lab40
+							}
+							break lab41
+						}
+						var v_32 = env.Limit - env.Cursor
+					lab43:
+						for {
+							if !(context.i_p1 <= (env.Cursor + 6)) {
+								env.Cursor = env.Limit - v_32
+								break lab43
+							}
+							if !env.SliceFrom("\u05D9\u05E1") {
+								return false
+							}
+							break lab43
+						}
+						break lab39
+					}
+					env.Cursor = env.Limit - v_30
+					if !(context.i_p1 <= env.Cursor) {
+						break lab35
+					}
+					if !env.SliceDel() {
+						return false
+					}
+					break lab39
+				}
+			}
+			break lab35
+		}
+		env.Cursor = env.Limit - v_27
+		var v_33 = env.Limit - env.Cursor
+	lab44:
+		for {
+			env.Ket = env.Cursor
+			among_var = env.FindAmongB(A_5, context)
+			if among_var == 0 {
+				break lab44
+			}
+			env.Bra = env.Cursor
+			if among_var == 1 {
+				if !(context.i_p1 <= env.Cursor) {
+					break lab44
+				}
+				if !env.SliceDel() {
+					return false
+				}
+			} else if among_var == 2 {
+				if !(context.i_p1 <= env.Cursor) {
+					break lab44
+				}
+				if !env.InGroupingB(G_consonant, 1489, 1520) {
+					break lab44
+				}
+				if !env.SliceDel() {
+					return false
+				}
+			}
+			break lab44
+		}
+		env.Cursor = env.Limit - v_33
+		var v_34 = env.Limit - env.Cursor
+	lab45:
+		for {
+			env.Ket = env.Cursor
+			among_var = env.FindAmongB(A_6, context)
+			if among_var == 0 {
+				break lab45
+			}
+			env.Bra = env.Cursor
+			if among_var == 1 {
+				if !(context.i_p1 <= env.Cursor) {
+					break lab45
+				}
+				if !env.SliceDel() {
+					return false
+				}
+			}
+			break lab45
+		}
+		env.Cursor = env.Limit - v_34
+		var v_35 = env.Limit - env.Cursor
+	lab46:
+		for {
+		replab47:
+			for {
+				var v_36 = env.Limit - env.Cursor
+			lab48:
+				for range [2]struct{}{} {
+				golab49:
+					for {
+						var v_37 = env.Limit - env.Cursor
+					lab50:
+						for {
+							env.Ket = env.Cursor
+						lab51:
+							for {
+								var v_38 = env.Limit - env.Cursor
+							lab52:
+								for {
+									if !env.EqSB("GE") {
+										break lab52
+									}
+									break lab51
+								}
+								env.Cursor = env.Limit - v_38
+								if !env.EqSB("TSU") {
+									break lab50
+								}
+								break lab51
+							}
+							env.Bra = env.Cursor
+							if !env.SliceDel() {
+								return false
+							}
+							env.Cursor = env.Limit - v_37
+							break golab49
+						}
+						env.Cursor = env.Limit - v_37
+						if env.Cursor <= env.LimitBackward {
+							break lab48
+						}
+						env.PrevChar()
+					}
+					continue replab47
+				}
+				env.Cursor = env.Limit - v_36
+				break replab47
+			}
+			break lab46
+		}
+		env.Cursor = env.Limit - v_35
+		break lab34
+	}
+	env.Cursor = env.LimitBackward
+	return true
+}
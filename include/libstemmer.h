@@ -4,9 +4,34 @@
 extern "C" {
 #endif
 
+#include <stddef.h> /* for size_t */
+
 struct sb_stemmer;
+struct sb_algorithm;
 typedef unsigned char sb_symbol;
 
+/** Memory allocation functions for libstemmer to use, as set by
+ *  sb_set_allocator().
+ *
+ *  Each function is passed @a context as its first argument, and otherwise
+ *  behaves like the standard C function of the same name.
+ */
+struct sb_allocator {
+    void * (*malloc)(void * context, size_t size);
+    void * (*realloc)(void * context, void * p, size_t size);
+    void (*free)(void * context, void * p);
+    void * context;
+};
+
+/** Counts of calls made to the allocator, as returned by
+ *  sb_get_allocator_stats().
+ */
+struct sb_allocator_stats {
+    unsigned long mallocs;
+    unsigned long reallocs;
+    unsigned long frees;
+};
+
 /* FIXME - should be able to get a version number for each stemming
  * algorithm (which will be incremented each time the output changes). */
 
@@ -19,6 +44,42 @@ typedef unsigned char sb_symbol;
  */
 const char ** sb_stemmer_list(void);
 
+/** Set the functions used to allocate and free all memory used by
+ *  libstemmer.
+ *
+ *  Passing NULL restores the default allocator (malloc, realloc and free).
+ *  The allocator applies process-wide and must not be changed while any
+ *  stemmer objects exist, as memory must be freed by the allocator which
+ *  allocated it.  The functions may be called from several threads at
+ *  once if stemmer objects are used in several threads.
+ *
+ *  This also resets the counts returned by sb_get_allocator_stats().
+ */
+void sb_set_allocator(const struct sb_allocator * allocator);
+
+/** Get counts of calls made to the allocator since it was last set.
+ */
+void sb_get_allocator_stats(struct sb_allocator_stats * stats);
+
+/** Write the counters of the stemmers which were compiled with the snowball
+ *  -profile option as JSON to @a out, which has room for @a out_size bytes.
+ *
+ *  For each such stemmer which has been created, this gives the calls,
+ *  successful calls and cycles (including those of any routines called)
+ *  of each routine, and for each among the number of lookups which missed,
+ *  which matched a string with no command, and which chose each of its
+ *  commands.  If no stemmers were compiled with -profile, the JSON is an
+ *  empty list.
+ *
+ *  Returns the length of the JSON.  If this is @a out_size or more the JSON
+ *  was truncated, otherwise it is terminated by a zero byte.
+ */
+int sb_profile_dump(char * out, int out_size);
+
+/** Set all the counters reported by sb_profile_dump() to zero.
+ */
+void sb_profile_reset(void);
+
 /** Create a new stemmer object, using the specified algorithm, for the
  *  specified character encoding.
  *
@@ -45,6 +106,53 @@ const char ** sb_stemmer_list(void);
  */
 struct sb_stemmer * sb_stemmer_new(const char * algorithm, const char * charenc);
 
+/** Look up a stemming algorithm for the specified character encoding.
+ *
+ *  The parameters are interpreted exactly as for sb_stemmer_new().
+ *
+ *  The returned handle refers to static, read-only data: it needs no
+ *  freeing and may be shared freely between threads.  It can be passed to
+ *  sb_stemmer_new_from_algorithm() to create stemmer objects without
+ *  repeating the name and encoding lookup.
+ *
+ *  @return NULL if the specified algorithm is not recognised, or the
+ *  algorithm is not available for the requested encoding.
+ */
+const struct sb_algorithm * sb_algorithm_find(const char * algorithm,
+                                              const char * charenc);
+
+/** Create a new stemmer object for an algorithm found with
+ *  sb_algorithm_find().
+ *
+ *  The stemmer object holds only the mutable state needed to stem words,
+ *  so a cheap way to stem in several threads is to look up the algorithm
+ *  once and create one stemmer object from it for each thread.
+ *
+ *  @return NULL if @a algorithm is NULL or an out of memory error occurs.
+ *  Otherwise, returns a pointer to a newly created stemmer which must be
+ *  deleted by calling sb_stemmer_delete().
+ */
+struct sb_stemmer * sb_stemmer_new_from_algorithm(const struct sb_algorithm * algorithm);
+
+/** Create a new stemmer object from a stemmer compiled with
+ *  "snowball -bytecode", which is run by an interpreter rather than being
+ *  compiled into the library, so stemmers can be added or updated without
+ *  rebuilding it.
+ *
+ *  @a data is the contents of the .sbc file, which is copied, so needn't be
+ *  kept.  Use "-u" when compiling the stemmer for UTF-8, and "-widechars"
+ *  for the SNOWBALL_UTF32 build of the library.  Each stemmer object loads
+ *  its own copy of the program, and these stemmers can't be used with
+ *  sb_stemmer_pool_new() or sb_stemmer_stem_parallel(), which take an
+ *  algorithm.
+ *
+ *  @return NULL if @a data isn't a valid stemmer for this build of the
+ *  library or an out of memory error occurs.  Otherwise, returns a pointer
+ *  to a newly created stemmer which must be deleted by calling
+ *  sb_stemmer_delete().
+ */
+struct sb_stemmer * sb_stemmer_new_from_bytecode(const void * data, size_t size);
+
 /** Delete a stemmer object.
  *
  *  This frees all resources allocated for the stemmer.  After calling
@@ -55,6 +163,44 @@ struct sb_stemmer * sb_stemmer_new(const char * algorithm, const char * charenc)
  */
 void                sb_stemmer_delete(struct sb_stemmer * stemmer);
 
+/** Statistics about a stemmer's cache, as returned by sb_stemmer_get_stats().
+ */
+struct sb_stemmer_stats {
+    /** Number of words whose stem was found in the cache. */
+    unsigned long hits;
+    /** Number of words which had to be stemmed (including words too long
+     *  to be cached). */
+    unsigned long misses;
+    /** Number of cached stems discarded to make room for others. */
+    unsigned long evictions;
+};
+
+/** Enable, resize or disable the stem cache for a stemmer object.
+ *
+ *  Natural language text tends to repeat a small number of words a lot, so
+ *  remembering recent stems can avoid running the stemming algorithm for
+ *  most words.  The cache is bounded: it holds at most (roughly) @a size
+ *  words, discarding the least recently hit when it fills up.  Only short
+ *  words are cached, as long words are rare and so unlikely to be repeated.
+ *
+ *  Any existing cache contents and statistics are discarded.  By default a
+ *  stemmer object has no cache.
+ *
+ *  @param size The number of words to cache, or 0 to disable the cache.
+ *
+ *  @return 0 on success, or -1 if an out of memory error occurs (in which
+ *  case the stemmer's existing cache is left unchanged).
+ */
+int                 sb_stemmer_set_cache(struct sb_stemmer * stemmer, int size);
+
+/** Get the cache statistics for a stemmer object.
+ *
+ *  The counters are reset by sb_stemmer_set_cache(), and are all zero if
+ *  the stemmer has no cache.
+ */
+void                sb_stemmer_get_stats(struct sb_stemmer * stemmer,
+                                         struct sb_stemmer_stats * stats);
+
 /** Stem a word.
  *
  *  The return value is owned by the stemmer - it must not be freed or
@@ -68,11 +214,211 @@ void                sb_stemmer_delete(struct sb_stemmer * stemmer);
 const sb_symbol *   sb_stemmer_stem(struct sb_stemmer * stemmer,
                                     const sb_symbol * word, int size);
 
+/** Stem a word, writing the result into a buffer supplied by the caller.
+ *
+ *  This is like sb_stemmer_stem(), but the stem is written to @a out
+ *  (which has room for @a out_size symbols) and is not NUL-terminated.
+ *
+ *  @return the length of the stem.  If this is greater than @a out_size
+ *  then the stem didn't fit and nothing was written to @a out, so the
+ *  return value is the capacity needed.  If an out-of-memory error occurs,
+ *  -1 is returned.
+ */
+int                 sb_stemmer_stem_into(struct sb_stemmer * stemmer,
+                                         const sb_symbol * word, int size,
+                                         sb_symbol * out, int out_size);
+
 /** Get the length of the result of the last stemmed word.
- *  This should not be called before sb_stemmer_stem() has been called.
+ *  This should not be called before sb_stemmer_stem() or
+ *  sb_stemmer_stem_into() has been called.
  */
 int                 sb_stemmer_length(struct sb_stemmer * stemmer);
 
+/** Stem a batch of words in one call.
+ *
+ *  The words are packed one after another into @a words, word i being the
+ *  symbols from words[offsets[i]] up to (but not including)
+ *  words[offsets[i + 1]], so @a offsets must hold count + 1 entries.
+ *
+ *  The stems are written one after another into the caller-supplied
+ *  buffer @a out, which has room for @a out_size symbols, and are
+ *  described by @a out_offsets in the same way, so @a out_offsets must also
+ *  have room for count + 1 entries.  The stems are not NUL-terminated and
+ *  no memory is allocated per word.
+ *
+ *  @return the number of words stemmed.  This is less than @a count if
+ *  @a out filled up, in which case the remaining words can be stemmed by
+ *  calling again with @a offsets advanced past those already handled.
+ *  If an out-of-memory error occurs, -1 is returned.
+ *
+ *  sb_stemmer_length() is not meaningful after this call.
+ */
+int                 sb_stemmer_stem_batch(struct sb_stemmer * stemmer,
+                                          const sb_symbol * words,
+                                          const int * offsets, int count,
+                                          sb_symbol * out, int out_size,
+                                          int * out_offsets);
+
+/** Case fold a UTF-8 string.
+ *
+ *  Unicode simple case folding is applied to the @a size symbols at @a s,
+ *  checking that they are valid UTF-8, and the result is written to the
+ *  caller-supplied buffer @a out, which has room for @a out_size symbols.
+ *  The result is not NUL-terminated.  Runs of ASCII characters are folded
+ *  using SIMD instructions where the CPU supports them.
+ *
+ *  @return the length of the folded string, or -1 if @a s isn't valid
+ *  UTF-8.  This may be more than @a size (a few characters fold to a
+ *  character with a longer encoding), but is never more than
+ *  3 * @a size / 2.  If it's more than @a out_size then @a out is only
+ *  partly written.
+ */
+int                 sb_casefold_utf8(const sb_symbol * s, int size,
+                                     sb_symbol * out, int out_size);
+
+/** A word found by sb_stemmer_stem_text().
+ *
+ *  The word is text[start] up to (but not including) text[end], and its
+ *  stem is out[stem_start] up to (but not including) out[stem_end].
+ */
+struct sb_token {
+    int start;
+    int end;
+    int stem_start;
+    int stem_end;
+};
+
+/** Split UTF-8 text into words, and case fold and stem each one.
+ *
+ *  A word is a maximal run of Unicode letters, marks and numbers, which
+ *  may also contain apostrophes (U+0027 or U+2019) with a word character
+ *  either side.  Anything else, including invalid UTF-8, separates words.
+ *  Each word has Unicode simple case folding applied (and U+2019 becomes
+ *  U+0027) before it is stemmed, so the text needn't be lowercased first.
+ *
+ *  The stems are written one after another into the caller-supplied
+ *  buffer @a out, which has room for @a out_size symbols, and a token
+ *  describing each word is written to @a tokens, which has room for
+ *  @a max_tokens entries.  The stems are not NUL-terminated.
+ *
+ *  This may only be used with a stemmer for the UTF_8 encoding.
+ *
+ *  @param used is set to the number of symbols of @a text which have been
+ *  dealt with.  If @a tokens or @a out filled up, the rest of the text can
+ *  be handled by calling again starting at @a text + *used.
+ *
+ *  @return the number of tokens written, or -1 if the stemmer isn't for
+ *  UTF_8 or an out-of-memory error occurs.
+ *
+ *  sb_stemmer_length() is not meaningful after this call.
+ */
+int                 sb_stemmer_stem_text(struct sb_stemmer * stemmer,
+                                         const sb_symbol * text, int size,
+                                         int * used,
+                                         struct sb_token * tokens,
+                                         int max_tokens,
+                                         sb_symbol * out, int out_size);
+
+/** Stem a batch of words using several threads.
+ *
+ *  The words are packed into @a words and described by @a offsets as for
+ *  sb_stemmer_stem_batch(), and are split into chunks which are stemmed
+ *  by @a threads threads (including the calling thread), each with its own
+ *  stemmer object.  Threads which finish their share of the chunks early
+ *  take chunks from the others, so the work stays balanced even if some
+ *  parts of the input are slower to stem than others.
+ *
+ *  The stems are written into @a out in the same order as the input words,
+ *  and described by @a out_offsets as for sb_stemmer_stem_batch().
+ *
+ *  @return the total length of the stems.  If this is greater than
+ *  @a out_size then the stems didn't fit, and nothing was written to
+ *  @a out or @a out_offsets beyond out_offsets[0], so the return value is
+ *  the size needed.  If @a algorithm is NULL or an out-of-memory error
+ *  occurs, -1 is returned.
+ *
+ *  The stems found are discarded if they don't fit, so calling again with
+ *  a bigger @a out stems all the words again.  Stems are rarely much longer
+ *  than the words, so making @a out somewhat bigger than @a words (as
+ *  stemwords does, with half as much again) means this is rarely needed.
+ */
+int sb_stemmer_stem_parallel(const struct sb_algorithm * algorithm,
+                             int threads,
+                             const sb_symbol * words,
+                             const int * offsets, int count,
+                             sb_symbol * out, int out_size,
+                             int * out_offsets);
+
+/** A pool of reusable stemmer objects for one algorithm.
+ *
+ *  Stemmer objects can be taken from and returned to a pool concurrently
+ *  from any number of threads without locking, which avoids the cost of
+ *  creating a stemmer object for each request in a server where threads
+ *  come and go.
+ */
+struct sb_stemmer_pool;
+
+/** Statistics about a pool, as returned by sb_stemmer_pool_get_stats().
+ */
+struct sb_stemmer_pool_stats {
+    /** Number of stemmer objects created because the pool was empty. */
+    unsigned long created;
+    /** Number of requests satisfied with a stemmer object from the pool. */
+    unsigned long reused;
+    /** Number of stemmer objects deleted because the pool was full. */
+    unsigned long discarded;
+    /** Number of times an operation had to be retried because another
+     *  thread was updating the pool at the same time. */
+    unsigned long contention;
+};
+
+/** Create a pool of stemmer objects for an algorithm found with
+ *  sb_algorithm_find().
+ *
+ *  @param size The maximum number of idle stemmer objects to keep.
+ *
+ *  @return NULL if @a algorithm is NULL, @a size isn't positive, an out of
+ *  memory error occurs, or the library was built with a compiler for which
+ *  it doesn't know how to perform atomic operations.  Otherwise, returns a
+ *  pointer to a new, empty pool which must be deleted by calling
+ *  sb_stemmer_pool_delete().
+ */
+struct sb_stemmer_pool * sb_stemmer_pool_new(const struct sb_algorithm * algorithm,
+                                             int size);
+
+/** Delete a pool and the idle stemmer objects in it.
+ *
+ *  This must not be called while other threads are using the pool.  Any
+ *  stemmer objects taken from the pool and not returned must be deleted
+ *  with sb_stemmer_delete().
+ *
+ *  It is safe to pass a null pointer to this function - this will have
+ *  no effect.
+ */
+void sb_stemmer_pool_delete(struct sb_stemmer_pool * pool);
+
+/** Take a stemmer object from a pool, creating one if the pool is empty.
+ *
+ *  The stemmer object should be returned with sb_stemmer_pool_put() once
+ *  it is no longer needed.
+ *
+ *  @return NULL if an out of memory error occurs.
+ */
+struct sb_stemmer * sb_stemmer_pool_get(struct sb_stemmer_pool * pool);
+
+/** Return a stemmer object to a pool.
+ *
+ *  If the pool is full, the stemmer object is deleted instead.  The stemmer
+ *  object must have been created for the pool's algorithm.
+ */
+void sb_stemmer_pool_put(struct sb_stemmer_pool * pool,
+                         struct sb_stemmer * stemmer);
+
+/** Get the statistics for a pool.
+ */
+void sb_stemmer_pool_get_stats(struct sb_stemmer_pool * pool,
+                               struct sb_stemmer_pool_stats * stats);
+
 #ifdef __cplusplus
 }
 #endif
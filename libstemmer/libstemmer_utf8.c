@@ -0,0 +1,731 @@
+
+#include <string.h>
+#include "../include/libstemmer.h"
+#include "../runtime/api.h"
+#include "../runtime/bytecode.h"
+#include "modules_utf8.h"
+
+/* Words (and stems) longer than this many symbols are never cached.  The
+ * value is chosen so that a cache entry fills a 64 byte cache line. */
+#define CACHE_WORD_MAX 28
+
+/* Number of entries in each set of the cache. */
+#define CACHE_WAYS 4
+
+struct sb_cache_entry {
+    unsigned int hash;
+    unsigned char used;
+    unsigned char referenced;
+    unsigned char word_len;
+    unsigned char stem_len;
+    sb_symbol word[CACHE_WORD_MAX];
+    sb_symbol stem[CACHE_WORD_MAX];
+};
+
+/* A set-associative cache of recent stems.  Each word hashes to a set of
+ * CACHE_WAYS entries, and within a set entries are replaced using the CLOCK
+ * algorithm (entries which have been hit since the hand last passed get a
+ * second chance). */
+struct sb_cache {
+    unsigned int set_mask;
+    unsigned char * hands;
+    struct sb_cache_entry * entries;
+    struct sb_stemmer_stats stats;
+};
+
+struct sb_stemmer {
+    const struct sb_algorithm * algorithm;
+    /* Set instead of algorithm for a stemmer loaded from bytecode. */
+    struct SN_program * program;
+
+    struct SN_env * env;
+    struct sb_cache * cache;
+#ifdef SNOWBALL_UTF32
+    /* The stem, converted from code points to UTF-8. */
+    sb_symbol * stem;
+    int stem_len;
+    int stem_size;
+#endif
+};
+
+#ifdef SNOWBALL_UTF32
+/* The stemmers work on code points, so each word is decoded from UTF-8, and
+ * the stem is encoded back to UTF-8 in stemmer->stem. */
+# define STEM(S) ((S)->stem)
+# define STEM_LEN(S) ((S)->stem_len)
+# define STEM_INITIAL_SIZE 256
+
+static int
+reserve_stem(struct sb_stemmer * stemmer, int size)
+{
+    if (size > stemmer->stem_size) {
+        sb_symbol * p = (sb_symbol *) (stemmer->stem == NULL ?
+                                       SN_malloc(size) :
+                                       SN_realloc(stemmer->stem, size));
+        if (p == NULL) return -1;
+        stemmer->stem = p;
+        stemmer->stem_size = size;
+    }
+    return 0;
+}
+
+static int
+set_word(struct sb_stemmer * stemmer, const sb_symbol * word, int size)
+{
+    return SN_set_current_utf8(stemmer->env, size, word);
+}
+
+static int
+set_stem(struct sb_stemmer * stemmer, const sb_symbol * stem, int len)
+{
+    /* Leave room for sb_stemmer_stem() to add a zero. */
+    if (reserve_stem(stemmer, len + 1) < 0) return -1;
+    memcpy(stemmer->stem, stem, len);
+    stemmer->stem_len = len;
+    return 0;
+}
+
+static int
+get_stem(struct sb_stemmer * stemmer)
+{
+    struct SN_env * z = stemmer->env;
+    if (reserve_stem(stemmer, 4 * z->l + 1) < 0) return -1;
+    stemmer->stem_len = SN_get_current_utf8(z, stemmer->stem, stemmer->stem_size);
+    return 0;
+}
+#else
+/* The stem is left in the stemmer's buffer. */
+# define STEM(S) ((sb_symbol *)(S)->env->p)
+# define STEM_LEN(S) ((S)->env->l)
+# define set_word(S, W, N) SN_set_current((S)->env, (N), (const symbol *)(W))
+# define set_stem(S, W, N) set_word((S), (W), (N))
+# define get_stem(S) 0
+#endif
+
+extern const char **
+sb_stemmer_list(void)
+{
+    return algorithm_names;
+}
+
+extern void
+sb_set_allocator(const struct sb_allocator * allocator)
+{
+    struct SN_allocator a;
+    if (allocator == NULL) {
+        SN_set_allocator(NULL);
+        return;
+    }
+    a.malloc = allocator->malloc;
+    a.realloc = allocator->realloc;
+    a.free = allocator->free;
+    a.context = allocator->context;
+    SN_set_allocator(&a);
+}
+
+extern void
+sb_get_allocator_stats(struct sb_allocator_stats * stats)
+{
+    struct SN_alloc_stats s;
+    SN_get_alloc_stats(&s);
+    stats->mallocs = s.mallocs;
+    stats->reallocs = s.reallocs;
+    stats->frees = s.frees;
+}
+
+extern int
+sb_profile_dump(char * out, int out_size)
+{
+    return SN_profile_dump(out, out_size);
+}
+
+extern void
+sb_profile_reset(void)
+{
+    SN_profile_reset();
+}
+
+static stemmer_encoding_t
+sb_getenc(const char * charenc)
+{
+    const struct stemmer_encoding * encoding;
+    if (charenc == NULL) return ENC_UTF_8;
+    for (encoding = encodings; encoding->name != 0; encoding++) {
+        if (strcmp(encoding->name, charenc) == 0) break;
+    }
+    if (encoding->name == NULL) return ENC_UNKNOWN;
+    return encoding->enc;
+}
+
+extern const struct sb_algorithm *
+sb_algorithm_find(const char * algorithm, const char * charenc)
+{
+    stemmer_encoding_t enc;
+    const struct sb_algorithm * module;
+
+    enc = sb_getenc(charenc);
+    if (enc == ENC_UNKNOWN) return NULL;
+
+    for (module = modules; module->name != 0; module++) {
+        if (strcmp(module->name, algorithm) == 0 && module->enc == enc) break;
+    }
+    if (module->name == NULL) return NULL;
+    return module;
+}
+
+extern struct sb_stemmer *
+sb_stemmer_new_from_algorithm(const struct sb_algorithm * algorithm)
+{
+    struct sb_stemmer * stemmer;
+
+    if (algorithm == NULL) return NULL;
+
+    stemmer = (struct sb_stemmer *) SN_malloc(sizeof(struct sb_stemmer));
+    if (stemmer == NULL) return NULL;
+
+    stemmer->algorithm = algorithm;
+    stemmer->program = NULL;
+    stemmer->cache = NULL;
+#ifdef SNOWBALL_UTF32
+    stemmer->stem = NULL;
+    stemmer->stem_len = 0;
+    stemmer->stem_size = 0;
+#endif
+
+    stemmer->env = algorithm->create();
+    if (stemmer->env == NULL)
+    {
+        sb_stemmer_delete(stemmer);
+        return NULL;
+    }
+#ifdef SNOWBALL_UTF32
+    /* Enough that typical words need no further allocation. */
+    if (reserve_stem(stemmer, STEM_INITIAL_SIZE) < 0)
+    {
+        sb_stemmer_delete(stemmer);
+        return NULL;
+    }
+#endif
+
+    return stemmer;
+}
+
+extern struct sb_stemmer *
+sb_stemmer_new_from_bytecode(const void * data, size_t size)
+{
+    struct sb_stemmer * stemmer;
+
+    stemmer = (struct sb_stemmer *) SN_malloc(sizeof(struct sb_stemmer));
+    if (stemmer == NULL) return NULL;
+
+    stemmer->algorithm = NULL;
+    stemmer->env = NULL;
+    stemmer->cache = NULL;
+#ifdef SNOWBALL_UTF32
+    stemmer->stem = NULL;
+    stemmer->stem_len = 0;
+    stemmer->stem_size = 0;
+#endif
+
+    stemmer->program = SN_load_program(data, size);
+    if (stemmer->program == NULL)
+    {
+        sb_stemmer_delete(stemmer);
+        return NULL;
+    }
+    stemmer->env = SN_program_create_env(stemmer->program);
+    if (stemmer->env == NULL)
+    {
+        sb_stemmer_delete(stemmer);
+        return NULL;
+    }
+#ifdef SNOWBALL_UTF32
+    if (reserve_stem(stemmer, STEM_INITIAL_SIZE) < 0)
+    {
+        sb_stemmer_delete(stemmer);
+        return NULL;
+    }
+#endif
+
+    return stemmer;
+}
+
+extern struct sb_stemmer *
+sb_stemmer_new(const char * algorithm, const char * charenc)
+{
+    return sb_stemmer_new_from_algorithm(sb_algorithm_find(algorithm, charenc));
+}
+
+static void
+cache_delete(struct sb_cache * cache)
+{
+    if (cache == NULL) return;
+    SN_free(cache->hands);
+    SN_free(cache->entries);
+    SN_free(cache);
+}
+
+void
+sb_stemmer_delete(struct sb_stemmer * stemmer)
+{
+    if (stemmer == 0) return;
+    if (stemmer->env) {
+        if (stemmer->program) {
+            SN_program_close_env(stemmer->program, stemmer->env);
+        } else {
+            stemmer->algorithm->close(stemmer->env);
+        }
+        stemmer->env = 0;
+    }
+    SN_free_program(stemmer->program);
+    cache_delete(stemmer->cache);
+#ifdef SNOWBALL_UTF32
+    SN_free(stemmer->stem);
+#endif
+    SN_free(stemmer);
+}
+
+int
+sb_stemmer_set_cache(struct sb_stemmer * stemmer, int size)
+{
+    struct sb_cache * cache = NULL;
+    if (size > 0) {
+        unsigned int sets = 1;
+        size_t entries_size;
+        while (sets * CACHE_WAYS < (unsigned int)size) sets <<= 1;
+        entries_size = sets * CACHE_WAYS * sizeof(struct sb_cache_entry);
+        cache = (struct sb_cache *) SN_malloc(sizeof(struct sb_cache));
+        if (cache == NULL) return -1;
+        memset(cache, 0, sizeof(struct sb_cache));
+        cache->set_mask = sets - 1;
+        cache->hands = (unsigned char *) SN_malloc(sets);
+        cache->entries = (struct sb_cache_entry *) SN_malloc(entries_size);
+        if (cache->hands == NULL || cache->entries == NULL) {
+            cache_delete(cache);
+            return -1;
+        }
+        memset(cache->hands, 0, sets);
+        memset(cache->entries, 0, entries_size);
+    }
+    cache_delete(stemmer->cache);
+    stemmer->cache = cache;
+    return 0;
+}
+
+void
+sb_stemmer_get_stats(struct sb_stemmer * stemmer, struct sb_stemmer_stats * stats)
+{
+    if (stemmer->cache) {
+        *stats = stemmer->cache->stats;
+    } else {
+        memset(stats, 0, sizeof(*stats));
+    }
+}
+
+/* FNV-1a. */
+static unsigned int
+cache_hash(const sb_symbol * word, int size)
+{
+    unsigned int h = 2166136261U;
+    int i;
+    for (i = 0; i < size; i++) {
+        h = (h ^ word[i]) * 16777619U;
+    }
+    return h;
+}
+
+/* Stem a word, leaving the result in stemmer->env.
+ * Returns 0 on success, -1 on error.
+ */
+static int
+stem_word(struct sb_stemmer * stemmer, const sb_symbol * word, int size)
+{
+    struct SN_env * z = stemmer->env;
+    struct sb_cache * cache = stemmer->cache;
+    struct sb_cache_entry * set = NULL;
+    unsigned int hash = 0;
+
+    if (cache) {
+        if (size <= CACHE_WORD_MAX) {
+            int i;
+            hash = cache_hash(word, size);
+            set = cache->entries + (hash & cache->set_mask) * CACHE_WAYS;
+            for (i = 0; i < CACHE_WAYS; i++) {
+                struct sb_cache_entry * e = set + i;
+                if (e->used && e->hash == hash && e->word_len == size &&
+                    memcmp(e->word, word, size) == 0) {
+                    ++cache->stats.hits;
+                    e->referenced = 1;
+                    if (set_stem(stemmer, e->stem, e->stem_len)) {
+                        z->l = 0;
+                        return -1;
+                    }
+                    return 0;
+                }
+            }
+        }
+        ++cache->stats.misses;
+    }
+
+    if (set_word(stemmer, word, size))
+    {
+        z->l = 0;
+        return -1;
+    }
+    if (stemmer->program) {
+        if (SN_run_program(stemmer->program, z) < 0) return -1;
+    } else {
+        if (stemmer->algorithm->stem(z) < 0) return -1;
+    }
+    if (get_stem(stemmer) < 0) return -1;
+
+    if (set && STEM_LEN(stemmer) <= CACHE_WORD_MAX) {
+        unsigned char * hand = cache->hands + (hash & cache->set_mask);
+        struct sb_cache_entry * e;
+        while (1) {
+            e = set + *hand;
+            *hand = (*hand + 1) % CACHE_WAYS;
+            if (!e->used) break;
+            if (!e->referenced) {
+                ++cache->stats.evictions;
+                break;
+            }
+            e->referenced = 0;
+        }
+        e->hash = hash;
+        e->used = 1;
+        e->referenced = 0;
+        e->word_len = size;
+        e->stem_len = STEM_LEN(stemmer);
+        memcpy(e->word, word, size);
+        memcpy(e->stem, STEM(stemmer), STEM_LEN(stemmer));
+    }
+    return 0;
+}
+
+const sb_symbol *
+sb_stemmer_stem(struct sb_stemmer * stemmer, const sb_symbol * word, int size)
+{
+    if (stem_word(stemmer, word, size) < 0) return NULL;
+    STEM(stemmer)[STEM_LEN(stemmer)] = 0;
+    return STEM(stemmer);
+}
+
+int
+sb_stemmer_stem_into(struct sb_stemmer * stemmer, const sb_symbol * word,
+                     int size, sb_symbol * out, int out_size)
+{
+    if (stem_word(stemmer, word, size) < 0) return -1;
+    if (STEM_LEN(stemmer) <= out_size) memcpy(out, STEM(stemmer), STEM_LEN(stemmer));
+    return STEM_LEN(stemmer);
+}
+
+int
+sb_stemmer_length(struct sb_stemmer * stemmer)
+{
+    return STEM_LEN(stemmer);
+}
+
+int
+sb_stemmer_stem_batch(struct sb_stemmer * stemmer, const sb_symbol * words,
+                      const int * offsets, int count,
+                      sb_symbol * out, int out_size, int * out_offsets)
+{
+    int used = 0;
+    int i;
+
+    out_offsets[0] = 0;
+    for (i = 0; i < count; i++) {
+        int size = offsets[i + 1] - offsets[i];
+        if (stem_word(stemmer, words + offsets[i], size) < 0) return -1;
+        /* Stop before a stem which doesn't fit - the caller can resume. */
+        if (STEM_LEN(stemmer) > out_size - used) break;
+        memcpy(out + used, STEM(stemmer), STEM_LEN(stemmer));
+        used += STEM_LEN(stemmer);
+        out_offsets[i + 1] = used;
+    }
+    return i;
+}
+
+int
+sb_casefold_utf8(const sb_symbol * s, int size, sb_symbol * out, int out_size)
+{
+    return SN_fold_utf8(s, size, out, out_size);
+}
+
+/* An apostrophe is part of a word if it has word characters either side. */
+#define IS_APOSTROPHE(CH) ((CH) == 0x27 || (CH) == 0x2019)
+
+int
+sb_stemmer_stem_text(struct sb_stemmer * stemmer, const sb_symbol * text,
+                     int size, int * used, struct sb_token * tokens,
+                     int max_tokens, sb_symbol * out, int out_size)
+{
+    int pos = 0;
+    int out_used = 0;
+    int n = 0;
+
+    *used = 0;
+    if (stemmer->program ?
+            SN_program_encoding(stemmer->program) == SN_BYTECODE_SINGLEBYTE :
+            stemmer->algorithm->enc != ENC_UTF_8) return -1;
+
+    while (n < max_tokens) {
+        int start, end, ch, len, stem_len, fold_len;
+        int quotes = 0;
+
+        /* Skip to the start of the next word. */
+        while (pos < size) {
+            len = SN_decode_utf8(text + pos, size - pos, &ch);
+            if (ch >= 0 && SN_is_word_char(ch)) break;
+            pos += len;
+        }
+        *used = pos;
+        if (pos == size) break;
+
+        /* Find the end of the word. */
+        start = pos;
+        while (pos < size) {
+            len = SN_decode_utf8(text + pos, size - pos, &ch);
+            if (ch < 0) break;
+            if (IS_APOSTROPHE(ch)) {
+                int next;
+                if (pos + len == size) break;
+                SN_decode_utf8(text + pos + len, size - pos - len, &next);
+                if (next < 0 || !SN_is_word_char(next)) break;
+                if (ch != 0x27) quotes = 1;
+            } else if (!SN_is_word_char(ch)) {
+                break;
+            }
+            pos += len;
+        }
+        end = pos;
+
+        /* Case fold it into out - stop if out is full, and the caller can
+         * resume from *used. */
+        fold_len = SN_fold_utf8(text + start, end - start,
+                                out + out_used, out_size - out_used);
+        if (fold_len < 0) return -1;
+        if (fold_len > out_size - out_used) return n;
+        if (quotes) {
+            /* Replace each U+2019 with U+0027. */
+            sb_symbol * p = out + out_used;
+            int i, k = 0;
+            for (i = 0; i < fold_len; i++) {
+                if (p[i] == 0xE2 && i + 2 < fold_len &&
+                    p[i + 1] == 0x80 && p[i + 2] == 0x99) {
+                    p[k++] = 0x27;
+                    i += 2;
+                } else {
+                    p[k++] = p[i];
+                }
+            }
+            fold_len = k;
+        }
+
+        /* The word is copied into the stemmer's buffer before the stem is
+         * written, so stemming in place is safe. */
+        stem_len = sb_stemmer_stem_into(stemmer, out + out_used, fold_len,
+                                        out + out_used, out_size - out_used);
+        if (stem_len < 0) return -1;
+        if (stem_len > out_size - out_used) return n;
+
+        tokens[n].start = start;
+        tokens[n].end = end;
+        tokens[n].stem_start = out_used;
+        tokens[n].stem_end = out_used + stem_len;
+        out_used += stem_len;
+        ++n;
+        *used = end;
+    }
+    return n;
+}
+
+/* Pools of stemmer objects.
+ *
+ * A pool has a fixed number of slots, each of which can hold an idle
+ * stemmer.  The slots are linked into two lock-free stacks - one of slots
+ * holding an idle stemmer, and one of empty slots.  Each stack head packs
+ * the index of the top slot into the low 32 bits and a counter which is
+ * incremented on every update into the high 32 bits, so a compare-and-swap
+ * can't succeed if the head was popped and pushed back meanwhile (the ABA
+ * problem).
+ */
+
+#if defined __GNUC__
+# define POOL_SUPPORTED 1
+typedef unsigned long long pool_head_t;
+# define ATOMIC_LOAD(P) __atomic_load_n((P), __ATOMIC_ACQUIRE)
+# define ATOMIC_LOAD_RELAXED(P) __atomic_load_n((P), __ATOMIC_RELAXED)
+# define ATOMIC_STORE_RELAXED(P, V) __atomic_store_n((P), (V), __ATOMIC_RELAXED)
+# define ATOMIC_CAS(P, E, D) \
+    __atomic_compare_exchange_n((P), (E), (D), 1, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+# define ATOMIC_INC(X) __atomic_fetch_add(&(X), 1, __ATOMIC_RELAXED)
+#elif defined _MSC_VER
+# include <intrin.h>
+# define POOL_SUPPORTED 1
+typedef unsigned __int64 pool_head_t;
+# define ATOMIC_LOAD(P) (*(volatile pool_head_t *)(P))
+# define ATOMIC_LOAD_RELAXED(P) (*(volatile unsigned int *)(P))
+# define ATOMIC_STORE_RELAXED(P, V) (*(volatile unsigned int *)(P) = (V))
+static int
+msvc_cas(pool_head_t * p, pool_head_t * expected, pool_head_t desired)
+{
+    pool_head_t old = (pool_head_t)
+        _InterlockedCompareExchange64((volatile __int64 *)p, (__int64)desired,
+                                      (__int64)*expected);
+    if (old == *expected) return 1;
+    *expected = old;
+    return 0;
+}
+# define ATOMIC_CAS(P, E, D) msvc_cas((P), (E), (D))
+# define ATOMIC_INC(X) _InterlockedIncrement((volatile long *)&(X))
+#else
+# define POOL_SUPPORTED 0
+typedef unsigned long pool_head_t;
+#endif
+
+#define NO_SLOT 0xffffffffU
+
+struct sb_stemmer_pool {
+    const struct sb_algorithm * algorithm;
+    unsigned int size;
+    pool_head_t idle;
+    pool_head_t spare;
+    unsigned int * next;
+    struct sb_stemmer ** slots;
+    struct sb_stemmer_pool_stats stats;
+};
+
+#if POOL_SUPPORTED
+static unsigned int
+pool_pop(struct sb_stemmer_pool * pool, pool_head_t * head)
+{
+    pool_head_t old = ATOMIC_LOAD(head);
+    while (1) {
+        unsigned int i = (unsigned int)(old & NO_SLOT);
+        pool_head_t new_head;
+        if (i == NO_SLOT) return NO_SLOT;
+        /* If another thread changes next[i] this CAS will fail, as it must
+         * also have changed the head. */
+        new_head = (((old >> 32) + 1) << 32) |
+                   ATOMIC_LOAD_RELAXED(&pool->next[i]);
+        if (ATOMIC_CAS(head, &old, new_head)) return i;
+        ATOMIC_INC(pool->stats.contention);
+    }
+}
+
+static void
+pool_push(struct sb_stemmer_pool * pool, pool_head_t * head, unsigned int i)
+{
+    pool_head_t old = ATOMIC_LOAD(head);
+    while (1) {
+        pool_head_t new_head = (((old >> 32) + 1) << 32) | i;
+        ATOMIC_STORE_RELAXED(&pool->next[i], (unsigned int)(old & NO_SLOT));
+        if (ATOMIC_CAS(head, &old, new_head)) return;
+        ATOMIC_INC(pool->stats.contention);
+    }
+}
+#endif
+
+extern struct sb_stemmer_pool *
+sb_stemmer_pool_new(const struct sb_algorithm * algorithm, int size)
+{
+#if POOL_SUPPORTED
+    struct sb_stemmer_pool * pool;
+    int i;
+
+    if (algorithm == NULL || size <= 0) return NULL;
+    pool = (struct sb_stemmer_pool *) SN_malloc(sizeof(struct sb_stemmer_pool));
+    if (pool == NULL) return NULL;
+    memset(pool, 0, sizeof(struct sb_stemmer_pool));
+    pool->algorithm = algorithm;
+    pool->size = size;
+    pool->next = (unsigned int *) SN_malloc(size * sizeof(unsigned int));
+    pool->slots = (struct sb_stemmer **) SN_malloc(size * sizeof(struct sb_stemmer *));
+    if (pool->next == NULL || pool->slots == NULL) {
+        SN_free(pool->next);
+        SN_free(pool->slots);
+        SN_free(pool);
+        return NULL;
+    }
+    /* All slots start off empty. */
+    pool->idle = NO_SLOT;
+    pool->spare = 0;
+    for (i = 0; i < size; i++) {
+        pool->next[i] = (i + 1 < size) ? (unsigned int)(i + 1) : NO_SLOT;
+        pool->slots[i] = NULL;
+    }
+    return pool;
+#else
+    (void)algorithm;
+    (void)size;
+    return NULL;
+#endif
+}
+
+extern void
+sb_stemmer_pool_delete(struct sb_stemmer_pool * pool)
+{
+#if POOL_SUPPORTED
+    unsigned int i;
+    if (pool == NULL) return;
+    while ((i = pool_pop(pool, &pool->idle)) != NO_SLOT) {
+        sb_stemmer_delete(pool->slots[i]);
+    }
+    SN_free(pool->next);
+    SN_free(pool->slots);
+    SN_free(pool);
+#else
+    (void)pool;
+#endif
+}
+
+extern struct sb_stemmer *
+sb_stemmer_pool_get(struct sb_stemmer_pool * pool)
+{
+#if POOL_SUPPORTED
+    struct sb_stemmer * stemmer;
+    unsigned int i = pool_pop(pool, &pool->idle);
+    if (i == NO_SLOT) {
+        ATOMIC_INC(pool->stats.created);
+        return sb_stemmer_new_from_algorithm(pool->algorithm);
+    }
+    stemmer = pool->slots[i];
+    pool->slots[i] = NULL;
+    pool_push(pool, &pool->spare, i);
+    ATOMIC_INC(pool->stats.reused);
+    return stemmer;
+#else
+    (void)pool;
+    return NULL;
+#endif
+}
+
+extern void
+sb_stemmer_pool_put(struct sb_stemmer_pool * pool, struct sb_stemmer * stemmer)
+{
+#if POOL_SUPPORTED
+    unsigned int i;
+    if (stemmer == NULL) return;
+    i = pool_pop(pool, &pool->spare);
+    if (i == NO_SLOT) {
+        /* The pool is full. */
+        ATOMIC_INC(pool->stats.discarded);
+        sb_stemmer_delete(stemmer);
+        return;
+    }
+    pool->slots[i] = stemmer;
+    pool_push(pool, &pool->idle, i);
+#else
+    (void)pool;
+    sb_stemmer_delete(stemmer);
+#endif
+}
+
+extern void
+sb_stemmer_pool_get_stats(struct sb_stemmer_pool * pool,
+                          struct sb_stemmer_pool_stats * stats)
+{
+    *stats = pool->stats;
+}
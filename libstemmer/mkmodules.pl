@@ -5,8 +5,8 @@ use warnings;
 
 my $progname = $0;
 
-if (scalar @ARGV < 4 || scalar @ARGV > 5) {
-  print "Usage: $progname <outfile> <C source directory> <modules description file> <source list file> [<enc>]\n";
+if (scalar @ARGV < 4 || scalar @ARGV > 6) {
+  print "Usage: $progname <outfile> <C source directory> <modules description file> <source list file> [<enc> [<extn>]]\n";
   exit 1;
 }
 
@@ -20,6 +20,9 @@ if (@ARGV) {
   $enc_only = shift(@ARGV);
   $extn = '_'.$enc_only;
 }
+if (@ARGV) {
+  $extn = '_'.shift(@ARGV);
+}
 
 my %aliases = ();
 my %algorithms = ();
@@ -144,14 +147,14 @@ EOS
   {0,ENC_UNKNOWN}
 };
 
-struct stemmer_modules {
+struct sb_algorithm {
   const char * name;
   stemmer_encoding_t enc; 
   struct SN_env * (*create)(void);
   void (*close)(struct SN_env *);
   int (*stem)(struct SN_env *);
 };
-static const struct stemmer_modules modules[] = {
+static const struct sb_algorithm modules[] = {
 EOS
 
     for $lang (sort keys %aliases) {
@@ -225,14 +228,20 @@ EOS
         my $hashref = $algorithm_encs{$lang};
         my $enc;
         foreach $enc (sort keys (%$hashref)) {
-            print OUT "  src_c/stem_${enc}_${lang}.c \\\n";
+            print OUT "  $c_src_dir/stem_${enc}_${lang}.c \\\n";
         }
     }
 
     $need_sep = 0;
-    for $srcfile ('runtime/api.c',
+    for $srcfile ('runtime/among.c',
+                  'runtime/api.c',
+                  'runtime/fold.c',
+                  'runtime/scan.c',
+                  'runtime/unicode.c',
                   'runtime/utilities.c',
-                  "libstemmer/libstemmer${extn}.c") {
+                  'runtime/vm.c',
+                  "libstemmer/libstemmer${extn}.c",
+                  'libstemmer/parallel.c') {
         print OUT " \\\n" if $need_sep;
         print OUT "  $srcfile";
         $need_sep = 1;
@@ -244,7 +253,7 @@ EOS
         my $enc;
         foreach $enc (sort keys (%$hashref)) {
             my $p = "${lang}_${enc}";
-            print OUT "  src_c/stem_${enc}_${lang}.h \\\n";
+            print OUT "  $c_src_dir/stem_${enc}_${lang}.h \\\n";
         }
     }
 
@@ -252,7 +261,9 @@ EOS
     for $srcfile ('include/libstemmer.h',
                   "libstemmer/modules${extn}.h",
                   'runtime/api.h',
-                  'runtime/header.h') {
+                  'runtime/bytecode.h',
+                  'runtime/header.h',
+                  'runtime/unicode_tables.h') {
         print OUT " \\\n" if $need_sep;
         print OUT "  $srcfile";
         $need_sep = 1;
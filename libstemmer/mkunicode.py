@@ -0,0 +1,102 @@
+#!/usr/bin/env python3
+# Generate runtime/unicode_tables.h from the Unicode character database
+# included with Python.
+#
+# Usage: mkunicode.py OUTPUT_FILE
+
+import sys
+import unicodedata
+
+MAX_CODE_POINT = 0x10FFFF
+
+
+def simple_fold(cp):
+    """Return the Unicode simple case folding of code point cp.
+
+    Python provides full case folding (str.casefold()), which agrees with
+    simple case folding except where the full folding is more than one
+    character - in those cases the simple folding, if any, is the same as
+    the lowercase mapping when that's a single character.
+    """
+    ch = chr(cp)
+    f = ch.casefold()
+    if len(f) == 1:
+        return ord(f)
+    f = ch.lower()
+    if len(f) == 1:
+        return ord(f)
+    return cp
+
+
+def fold_ranges():
+    """Return a list of (first, last, delta, stride) tuples, meaning that the
+    code points first, first + stride, ..., last fold to themselves plus
+    delta (and any code points in between which aren't in the list fold to
+    themselves)."""
+    mapped = {}
+    for cp in range(MAX_CODE_POINT + 1):
+        f = simple_fold(cp)
+        if f != cp:
+            mapped[cp] = f - cp
+    ranges = []
+    for cp in sorted(mapped):
+        delta = mapped[cp]
+        if ranges:
+            first, last, d, stride = ranges[-1]
+            if d == delta:
+                if stride == 0 and cp - last in (1, 2) and \
+                        (cp - last == 1 or last + 1 not in mapped):
+                    ranges[-1] = (first, cp, d, cp - last)
+                    continue
+                if stride and cp - last == stride:
+                    ranges[-1] = (first, cp, d, stride)
+                    continue
+        ranges.append((cp, cp, delta, 0))
+    return [(f, l, d, s or 1) for (f, l, d, s) in ranges]
+
+
+def word_ranges():
+    """Return a list of (first, last) ranges of letters, marks and
+    numbers."""
+    ranges = []
+    for cp in range(MAX_CODE_POINT + 1):
+        if unicodedata.category(chr(cp))[0] not in 'LMN':
+            continue
+        if ranges and ranges[-1][1] == cp - 1:
+            ranges[-1][1] = cp
+        else:
+            ranges.append([cp, cp])
+    return ranges
+
+
+def main():
+    out = open(sys.argv[1], 'w')
+    out.write('/* Generated by libstemmer/mkunicode.py from Unicode %s data.\n'
+              ' * Do not edit manually. */\n\n' % unicodedata.unidata_version)
+
+    out.write('/* Simple case folding: { first, last, delta, stride } */\n')
+    out.write('static const struct fold_range fold_ranges[] = {\n')
+    for r in fold_ranges():
+        out.write('    { 0x%X, 0x%X, %d, %d },\n' % r)
+    out.write('};\n\n')
+
+    # Code points below 0x800 are encoded in one or two bytes in UTF-8, and
+    # cover the Latin, Greek, Cyrillic, Armenian and Hebrew scripts, so have
+    # a direct lookup table.
+    out.write('/* Simple case folding of U+0000 to U+07FF */\n')
+    out.write('static const unsigned short fold_table[0x800] = {\n')
+    for cp in range(0, 0x800, 8):
+        out.write('   ')
+        for c in range(cp, cp + 8):
+            out.write(' 0x%04X,' % simple_fold(c))
+        out.write('\n')
+    out.write('};\n\n')
+
+    out.write('/* Letters, marks and numbers: { first, last } */\n')
+    out.write('static const struct char_range word_ranges[] = {\n')
+    for r in word_ranges():
+        out.write('    { 0x%X, 0x%X },\n' % tuple(r))
+    out.write('};\n')
+
+
+main()
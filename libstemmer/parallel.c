@@ -0,0 +1,254 @@
+
+/* Stemming of a batch of words using several threads.
+ *
+ * The words are split into fixed-size chunks, and the chunks are shared out
+ * between the workers as contiguous ranges.  Each worker takes chunks from
+ * the front of its own range, and when that's empty steals chunks from the
+ * back of another worker's range, so a worker which gets chunks of long or
+ * slow words doesn't hold everyone else up.
+ *
+ * Each chunk's stems go into a buffer of its own, and once all the workers
+ * have finished the buffers are copied into the caller's output buffer in
+ * order.
+ */
+
+#include <string.h>
+#include "../include/libstemmer.h"
+#include "../runtime/api.h"
+
+#ifdef _WIN32
+# include <windows.h>
+typedef CRITICAL_SECTION lock_t;
+typedef HANDLE thread_t;
+# define LOCK_INIT(L) InitializeCriticalSection(L)
+# define LOCK_DESTROY(L) DeleteCriticalSection(L)
+# define LOCK(L) EnterCriticalSection(L)
+# define UNLOCK(L) LeaveCriticalSection(L)
+#else
+# include <pthread.h>
+typedef pthread_mutex_t lock_t;
+typedef pthread_t thread_t;
+# define LOCK_INIT(L) pthread_mutex_init((L), NULL)
+# define LOCK_DESTROY(L) pthread_mutex_destroy(L)
+# define LOCK(L) pthread_mutex_lock(L)
+# define UNLOCK(L) pthread_mutex_unlock(L)
+#endif
+
+/* Number of words in each chunk. */
+#define CHUNK_WORDS 512
+
+struct chunk {
+    sb_symbol * buf;
+    int len;
+};
+
+/* The chunks still to be stemmed by one worker are lo, ..., hi - 1. */
+struct deque {
+    lock_t lock;
+    int lo;
+    int hi;
+};
+
+struct job {
+    const struct sb_algorithm * algorithm;
+    const sb_symbol * words;
+    const int * offsets;
+    int count;
+    int * lengths;
+    struct chunk * chunks;
+    struct deque * deques;
+    int n_workers;
+};
+
+struct worker {
+    struct job * job;
+    int number;
+    int failed;
+};
+
+static int take_chunk(struct job * job, int w) {
+    int i;
+    for (i = 0; i < job->n_workers; i++) {
+        struct deque * d = job->deques + (w + i) % job->n_workers;
+        int c = -1;
+        LOCK(&d->lock);
+        if (d->lo < d->hi) {
+            /* Take from the front of our own range, or steal from the back
+             * of another worker's. */
+            c = (i == 0) ? d->lo++ : --d->hi;
+        }
+        UNLOCK(&d->lock);
+        if (c >= 0) return c;
+    }
+    return -1;
+}
+
+static int stem_chunk(struct job * job, struct sb_stemmer * stemmer, int c) {
+    struct chunk * chunk = job->chunks + c;
+    int first = c * CHUNK_WORDS;
+    int last = first + CHUNK_WORDS;
+    int cap = 0;
+    int i;
+    if (last > job->count) last = job->count;
+    for (i = first; i < last; i++) {
+        const sb_symbol * stemmed;
+        int len;
+        stemmed = sb_stemmer_stem(stemmer, job->words + job->offsets[i],
+                                  job->offsets[i + 1] - job->offsets[i]);
+        if (stemmed == NULL) return -1;
+        len = sb_stemmer_length(stemmer);
+        if (chunk->len + len > cap) {
+            int new_cap = 2 * cap + len + 64;
+            sb_symbol * buf = (sb_symbol *) SN_realloc(chunk->buf, new_cap);
+            if (buf == NULL) return -1;
+            chunk->buf = buf;
+            cap = new_cap;
+        }
+        memcpy(chunk->buf + chunk->len, stemmed, len);
+        chunk->len += len;
+        job->lengths[i] = len;
+    }
+    return 0;
+}
+
+static void run_worker(struct worker * w) {
+    struct job * job = w->job;
+    struct sb_stemmer * stemmer = sb_stemmer_new_from_algorithm(job->algorithm);
+    int c;
+    if (stemmer == NULL) {
+        w->failed = 1;
+        return;
+    }
+    while ((c = take_chunk(job, w->number)) >= 0) {
+        if (stem_chunk(job, stemmer, c) < 0) {
+            w->failed = 1;
+            break;
+        }
+    }
+    sb_stemmer_delete(stemmer);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI worker_main(LPVOID arg) {
+    run_worker((struct worker *)arg);
+    return 0;
+}
+
+static int start_thread(thread_t * t, struct worker * w) {
+    *t = CreateThread(NULL, 0, worker_main, w, 0, NULL);
+    return *t == NULL ? -1 : 0;
+}
+
+static void join_thread(thread_t t) {
+    WaitForSingleObject(t, INFINITE);
+    CloseHandle(t);
+}
+#else
+static void * worker_main(void * arg) {
+    run_worker((struct worker *)arg);
+    return NULL;
+}
+
+static int start_thread(thread_t * t, struct worker * w) {
+    return pthread_create(t, NULL, worker_main, w) == 0 ? 0 : -1;
+}
+
+static void join_thread(thread_t t) {
+    pthread_join(t, NULL);
+}
+#endif
+
+extern int
+sb_stemmer_stem_parallel(const struct sb_algorithm * algorithm, int threads,
+                         const sb_symbol * words, const int * offsets,
+                         int count, sb_symbol * out, int out_size,
+                         int * out_offsets)
+{
+    struct job job;
+    struct worker * workers;
+    thread_t * thread_ids;
+    int n_chunks = (count + CHUNK_WORDS - 1) / CHUNK_WORDS;
+    int started = 1;
+    int failed = 0;
+    int total;
+    int i;
+
+    if (algorithm == NULL || count < 0) return -1;
+    out_offsets[0] = 0;
+    if (count == 0) return 0;
+    if (threads < 1) threads = 1;
+    if (threads > n_chunks) threads = n_chunks;
+
+    job.algorithm = algorithm;
+    job.words = words;
+    job.offsets = offsets;
+    job.count = count;
+    /* The lengths aren't stored in out_offsets, which mustn't be changed
+     * if the stems don't fit. */
+    job.lengths = (int *) SN_malloc(count * sizeof(int));
+    job.n_workers = threads;
+    job.chunks = (struct chunk *) SN_malloc(n_chunks * sizeof(struct chunk));
+    job.deques = (struct deque *) SN_malloc(threads * sizeof(struct deque));
+    workers = (struct worker *) SN_malloc(threads * sizeof(struct worker));
+    thread_ids = (thread_t *) SN_malloc(threads * sizeof(thread_t));
+    if (job.lengths == NULL || job.chunks == NULL || job.deques == NULL ||
+        workers == NULL || thread_ids == NULL) {
+        SN_free(job.lengths);
+        SN_free(job.chunks);
+        SN_free(job.deques);
+        SN_free(workers);
+        SN_free(thread_ids);
+        return -1;
+    }
+    for (i = 0; i < n_chunks; i++) {
+        job.chunks[i].buf = NULL;
+        job.chunks[i].len = 0;
+    }
+    for (i = 0; i < threads; i++) {
+        LOCK_INIT(&job.deques[i].lock);
+        job.deques[i].lo = (int)((long)n_chunks * i / threads);
+        job.deques[i].hi = (int)((long)n_chunks * (i + 1) / threads);
+        workers[i].job = &job;
+        workers[i].number = i;
+        workers[i].failed = 0;
+    }
+
+    /* This thread acts as worker 0.  If a thread can't be started, the
+     * other workers will steal its chunks. */
+    while (started < threads) {
+        if (start_thread(&thread_ids[started], &workers[started]) < 0) break;
+        ++started;
+    }
+    run_worker(&workers[0]);
+    for (i = 1; i < started; i++) join_thread(thread_ids[i]);
+
+    for (i = 0; i < threads; i++) {
+        if (workers[i].failed) failed = 1;
+        LOCK_DESTROY(&job.deques[i].lock);
+    }
+
+    total = 0;
+    if (!failed) {
+        for (i = 0; i < n_chunks; i++) total += job.chunks[i].len;
+        if (total <= out_size) {
+            int pos = 0;
+            for (i = 0; i < n_chunks; i++) {
+                if (job.chunks[i].len) {
+                    memcpy(out + pos, job.chunks[i].buf, job.chunks[i].len);
+                    pos += job.chunks[i].len;
+                }
+            }
+            for (i = 0; i < count; i++) {
+                out_offsets[i + 1] = out_offsets[i] + job.lengths[i];
+            }
+        }
+    }
+
+    for (i = 0; i < n_chunks; i++) SN_free(job.chunks[i].buf);
+    SN_free(job.lengths);
+    SN_free(job.chunks);
+    SN_free(job.deques);
+    SN_free(workers);
+    SN_free(thread_ids);
+    return failed ? -1 : total;
+}
@@ -0,0 +1,1045 @@
+# Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+from .basestemmer import BaseStemmer
+from .among import Among
+
+
+class FrenchStemmer(BaseStemmer):
+    '''
+    This class implements the stemming algorithm defined by a snowball script.
+    Generated by Snowball 2.2.0 - https://snowballstem.org/
+    '''
+
+    a_0 = [
+        Among(u"col", -1, -1),
+        Among(u"par", -1, -1),
+        Among(u"tap", -1, -1)
+    ]
+
+    a_1 = [
+        Among(u"", -1, 7),
+        Among(u"H", 0, 6),
+        Among(u"He", 1, 4),
+        Among(u"Hi", 1, 5),
+        Among(u"I", 0, 1),
+        Among(u"U", 0, 2),
+        Among(u"Y", 0, 3)
+    ]
+
+    a_2 = [
+        Among(u"iqU", -1, 3),
+        Among(u"abl", -1, 3),
+        Among(u"I\u00E8r", -1, 4),
+        Among(u"i\u00E8r", -1, 4),
+        Among(u"eus", -1, 2),
+        Among(u"iv", -1, 1)
+    ]
+
+    a_3 = [
+        Among(u"ic", -1, 2),
+        Among(u"abil", -1, 1),
+        Among(u"iv", -1, 3)
+    ]
+
+    a_4 = [
+        Among(u"iqUe", -1, 1),
+        Among(u"atrice", -1, 2),
+        Among(u"ance", -1, 1),
+        Among(u"ence", -1, 5),
+        Among(u"logie", -1, 3),
+        Among(u"able", -1, 1),
+        Among(u"isme", -1, 1),
+        Among(u"euse", -1, 11),
+        Among(u"iste", -1, 1),
+        Among(u"ive", -1, 8),
+        Among(u"if", -1, 8),
+        Among(u"usion", -1, 4),
+        Among(u"ation", -1, 2),
+        Among(u"ution", -1, 4),
+        Among(u"ateur", -1, 2),
+        Among(u"iqUes", -1, 1),
+        Among(u"atrices", -1, 2),
+        Among(u"ances", -1, 1),
+        Among(u"ences", -1, 5),
+        Among(u"logies", -1, 3),
+        Among(u"ables", -1, 1),
+        Among(u"ismes", -1, 1),
+        Among(u"euses", -1, 11),
+        Among(u"istes", -1, 1),
+        Among(u"ives", -1, 8),
+        Among(u"ifs", -1, 8),
+        Among(u"usions", -1, 4),
+        Among(u"ations", -1, 2),
+        Among(u"utions", -1, 4),
+        Among(u"ateurs", -1, 2),
+        Among(u"ments", -1, 15),
+        Among(u"ements", 30, 6),
+        Among(u"issements", 31, 12),
+        Among(u"it\u00E9s", -1, 7),
+        Among(u"ment", -1, 15),
+        Among(u"ement", 34, 6),
+        Among(u"issement", 35, 12),
+        Among(u"amment", 34, 13),
+        Among(u"emment", 34, 14),
+        Among(u"aux", -1, 10),
+        Among(u"eaux", 39, 9),
+        Among(u"eux", -1, 1),
+        Among(u"it\u00E9", -1, 7)
+    ]
+
+    a_5 = [
+        Among(u"ira", -1, 1),
+        Among(u"ie", -1, 1),
+        Among(u"isse", -1, 1),
+        Among(u"issante", -1, 1),
+        Among(u"i", -1, 1),
+        Among(u"irai", 4, 1),
+        Among(u"ir", -1, 1),
+        Among(u"iras", -1, 1),
+        Among(u"ies", -1, 1),
+        Among(u"\u00EEmes", -1, 1),
+        Among(u"isses", -1, 1),
+        Among(u"issantes", -1, 1),
+        Among(u"\u00EEtes", -1, 1),
+        Among(u"is", -1, 1),
+        Among(u"irais", 13, 1),
+        Among(u"issais", 13, 1),
+        Among(u"irions", -1, 1),
+        Among(u"issions", -1, 1),
+        Among(u"irons", -1, 1),
+        Among(u"issons", -1, 1),
+        Among(u"issants", -1, 1),
+        Among(u"it", -1, 1),
+        Among(u"irait", 21, 1),
+        Among(u"issait", 21, 1),
+        Among(u"issant", -1, 1),
+        Among(u"iraIent", -1, 1),
+        Among(u"issaIent", -1, 1),
+        Among(u"irent", -1, 1),
+        Among(u"issent", -1, 1),
+        Among(u"iront", -1, 1),
+        Among(u"\u00EEt", -1, 1),
+        Among(u"iriez", -1, 1),
+        Among(u"issiez", -1, 1),
+        Among(u"irez", -1, 1),
+        Among(u"issez", -1, 1)
+    ]
+
+    a_6 = [
+        Among(u"a", -1, 3),
+        Among(u"era", 0, 2),
+        Among(u"asse", -1, 3),
+        Among(u"ante", -1, 3),
+        Among(u"\u00E9e", -1, 2),
+        Among(u"ai", -1, 3),
+        Among(u"erai", 5, 2),
+        Among(u"er", -1, 2),
+        Among(u"as", -1, 3),
+        Among(u"eras", 8, 2),
+        Among(u"\u00E2mes", -1, 3),
+        Among(u"asses", -1, 3),
+        Among(u"antes", -1, 3),
+        Among(u"\u00E2tes", -1, 3),
+        Among(u"\u00E9es", -1, 2),
+        Among(u"ais", -1, 3),
+        Among(u"erais", 15, 2),
+        Among(u"ions", -1, 1),
+        Among(u"erions", 17, 2),
+        Among(u"assions", 17, 3),
+        Among(u"erons", -1, 2),
+        Among(u"ants", -1, 3),
+        Among(u"\u00E9s", -1, 2),
+        Among(u"ait", -1, 3),
+        Among(u"erait", 23, 2),
+        Among(u"ant", -1, 3),
+        Among(u"aIent", -1, 3),
+        Among(u"eraIent", 26, 2),
+        Among(u"\u00E8rent", -1, 2),
+        Among(u"assent", -1, 3),
+        Among(u"eront", -1, 2),
+        Among(u"\u00E2t", -1, 3),
+        Among(u"ez", -1, 2),
+        Among(u"iez", 32, 2),
+        Among(u"eriez", 33, 2),
+        Among(u"assiez", 33, 3),
+        Among(u"erez", 32, 2),
+        Among(u"\u00E9", -1, 2)
+    ]
+
+    a_7 = [
+        Among(u"e", -1, 3),
+        Among(u"I\u00E8re", 0, 2),
+        Among(u"i\u00E8re", 0, 2),
+        Among(u"ion", -1, 1),
+        Among(u"Ier", -1, 2),
+        Among(u"ier", -1, 2)
+    ]
+
+    a_8 = [
+        Among(u"ell", -1, -1),
+        Among(u"eill", -1, -1),
+        Among(u"enn", -1, -1),
+        Among(u"onn", -1, -1),
+        Among(u"ett", -1, -1)
+    ]
+
+    g_v = [17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 130, 103, 8, 5]
+
+    g_keep_with_s = [1, 65, 20, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128]
+
+    I_p2 = 0
+    I_p1 = 0
+    I_pV = 0
+
+    def _stem(self):
+        v_1 = self.cursor
+        try:
+            while True:
+                v_2 = self.cursor
+                try:
+                    try:
+                        while True:
+                            v_3 = self.cursor
+                            try:
+                                try:
+                                    v_4 = self.cursor
+                                    try:
+                                        if not self.in_grouping(FrenchStemmer.g_v, 97, 251):
+                                            raise lab5()
+                                        self.bra = self.cursor
+                                        try:
+                                            v_5 = self.cursor
+                                            try:
+                                                if not self.eq_s(u"u"):
+                                                    raise lab7()
+                                                self.ket = self.cursor
+                                                if not self.in_grouping(FrenchStemmer.g_v, 97, 251):
+                                                    raise lab7()
+                                                if not self.slice_from(u"U"):
+                                                    return False
+                                                raise lab6()
+                                            except lab7: pass
+                                            self.cursor = v_5
+                                            try:
+                                                if not self.eq_s(u"i"):
+                                                    raise lab8()
+                                                self.ket = self.cursor
+                                                if not self.in_grouping(FrenchStemmer.g_v, 97, 251):
+                                                    raise lab8()
+                                                if not self.slice_from(u"I"):
+                                                    return False
+                                                raise lab6()
+                                            except lab8: pass
+                                            self.cursor = v_5
+                                            if not self.eq_s(u"y"):
+                                                raise lab5()
+                                            self.ket = self.cursor
+                                            if not self.slice_from(u"Y"):
+                                                return False
+                                        except lab6: pass
+                                        raise lab4()
+                                    except lab5: pass
+                                    self.cursor = v_4
+                                    try:
+                                        self.bra = self.cursor
+                                        if not self.eq_s(u"\u00EB"):
+                                            raise lab9()
+                                        self.ket = self.cursor
+                                        if not self.slice_from(u"He"):
+                                            return False
+                                        raise lab4()
+                                    except lab9: pass
+                                    self.cursor = v_4
+                                    try:
+                                        self.bra = self.cursor
+                                        if not self.eq_s(u"\u00EF"):
+                                            raise lab10()
+                                        self.ket = self.cursor
+                                        if not self.slice_from(u"Hi"):
+                                            return False
+                                        raise lab4()
+                                    except lab10: pass
+                                    self.cursor = v_4
+                                    try:
+                                        self.bra = self.cursor
+                                        if not self.eq_s(u"y"):
+                                            raise lab11()
+                                        self.ket = self.cursor
+                                        if not self.in_grouping(FrenchStemmer.g_v, 97, 251):
+                                            raise lab11()
+                                        if not self.slice_from(u"Y"):
+                                            return False
+                                        raise lab4()
+                                    except lab11: pass
+                                    self.cursor = v_4
+                                    if not self.eq_s(u"q"):
+                                        raise lab3()
+                                    self.bra = self.cursor
+                                    if not self.eq_s(u"u"):
+                                        raise lab3()
+                                    self.ket = self.cursor
+                                    if not self.slice_from(u"U"):
+                                        return False
+                                except lab4: pass
+                                self.cursor = v_3
+                                raise lab2()
+                            except lab3: pass
+                            self.cursor = v_3
+                            if self.cursor >= self.limit:
+                                raise lab1()
+                            self.cursor += 1
+                    except lab2: pass
+                    continue
+                except lab1: pass
+                self.cursor = v_2
+                break
+        except lab0: pass
+        self.cursor = v_1
+        try:
+            self.I_pV = self.limit
+            self.I_p1 = self.limit
+            self.I_p2 = self.limit
+            v_7 = self.cursor
+            try:
+                try:
+                    v_8 = self.cursor
+                    try:
+                        if not self.in_grouping(FrenchStemmer.g_v, 97, 251):
+                            raise lab15()
+                        if not self.in_grouping(FrenchStemmer.g_v, 97, 251):
+                            raise lab15()
+                        if self.cursor >= self.limit:
+                            raise lab15()
+                        self.cursor += 1
+                        raise lab14()
+                    except lab15: pass
+                    self.cursor = v_8
+                    try:
+                        if self.find_among(FrenchStemmer.a_0) == 0:
+                            raise lab16()
+                        raise lab14()
+                    except lab16: pass
+                    self.cursor = v_8
+                    if self.cursor >= self.limit:
+                        raise lab13()
+                    self.cursor += 1
+                    if not self.go_out_grouping(FrenchStemmer.g_v, 97, 251):
+                        raise lab13()
+                    self.cursor += 1
+                except lab14: pass
+                self.I_pV = self.cursor
+            except lab13: pass
+            self.cursor = v_7
+            v_9 = self.cursor
+            try:
+                if not self.go_out_grouping(FrenchStemmer.g_v, 97, 251):
+                    raise lab17()
+                self.cursor += 1
+                if not self.go_in_grouping(FrenchStemmer.g_v, 97, 251):
+                    raise lab17()
+                self.cursor += 1
+                self.I_p1 = self.cursor
+                if not self.go_out_grouping(FrenchStemmer.g_v, 97, 251):
+                    raise lab17()
+                self.cursor += 1
+                if not self.go_in_grouping(FrenchStemmer.g_v, 97, 251):
+                    raise lab17()
+                self.cursor += 1
+                self.I_p2 = self.cursor
+            except lab17: pass
+            self.cursor = v_9
+        except lab12: pass
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        v_10 = self.limit - self.cursor
+        try:
+            try:
+                v_11 = self.limit - self.cursor
+                try:
+                    v_12 = self.limit - self.cursor
+                    try:
+                        v_13 = self.limit - self.cursor
+                        try:
+                            self.ket = self.cursor
+                            among_var = self.find_among_b(FrenchStemmer.a_4)
+                            if among_var == 0:
+                                raise lab22()
+                            self.bra = self.cursor
+                            if among_var == 1:
+                                if not self.I_p2 <= self.cursor:
+                                    raise lab22()
+                                if not self.slice_del():
+                                    return False
+
+                            elif among_var == 2:
+                                if not self.I_p2 <= self.cursor:
+                                    raise lab22()
+                                if not self.slice_del():
+                                    return False
+
+                                v_14 = self.limit - self.cursor
+                                try:
+                                    self.ket = self.cursor
+                                    if not self.eq_s_b(u"ic"):
+                                        self.cursor = self.limit - v_14
+                                        raise lab23()
+                                    self.bra = self.cursor
+                                    try:
+                                        v_15 = self.limit - self.cursor
+                                        try:
+                                            if not self.I_p2 <= self.cursor:
+                                                raise lab25()
+                                            if not self.slice_del():
+                                                return False
+
+                                            raise lab24()
+                                        except lab25: pass
+                                        self.cursor = self.limit - v_15
+                                        if not self.slice_from(u"iqU"):
+                                            return False
+                                    except lab24: pass
+                                except lab23: pass
+                            elif among_var == 3:
+                                if not self.I_p2 <= self.cursor:
+                                    raise lab22()
+                                if not self.slice_from(u"log"):
+                                    return False
+                            elif among_var == 4:
+                                if not self.I_p2 <= self.cursor:
+                                    raise lab22()
+                                if not self.slice_from(u"u"):
+                                    return False
+                            elif among_var == 5:
+                                if not self.I_p2 <= self.cursor:
+                                    raise lab22()
+                                if not self.slice_from(u"ent"):
+                                    return False
+                            elif among_var == 6:
+                                if not self.I_pV <= self.cursor:
+                                    raise lab22()
+                                if not self.slice_del():
+                                    return False
+
+                                v_16 = self.limit - self.cursor
+                                try:
+                                    self.ket = self.cursor
+                                    among_var = self.find_among_b(FrenchStemmer.a_2)
+                                    if among_var == 0:
+                                        self.cursor = self.limit - v_16
+                                        raise lab26()
+                                    self.bra = self.cursor
+                                    if among_var == 1:
+                                        if not self.I_p2 <= self.cursor:
+                                            self.cursor = self.limit - v_16
+                                            raise lab26()
+                                        if not self.slice_del():
+                                            return False
+
+                                        self.ket = self.cursor
+                                        if not self.eq_s_b(u"at"):
+                                            self.cursor = self.limit - v_16
+                                            raise lab26()
+                                        self.bra = self.cursor
+                                        if not self.I_p2 <= self.cursor:
+                                            self.cursor = self.limit - v_16
+                                            raise lab26()
+                                        if not self.slice_del():
+                                            return False
+
+                                    elif among_var == 2:
+                                        try:
+                                            v_17 = self.limit - self.cursor
+                                            try:
+                                                if not self.I_p2 <= self.cursor:
+                                                    raise lab28()
+                                                if not self.slice_del():
+                                                    return False
+
+                                                raise lab27()
+                                            except lab28: pass
+                                            self.cursor = self.limit - v_17
+                                            if not self.I_p1 <= self.cursor:
+                                                self.cursor = self.limit - v_16
+                                                raise lab26()
+                                            if not self.slice_from(u"eux"):
+                                                return False
+                                        except lab27: pass
+                                    elif among_var == 3:
+                                        if not self.I_p2 <= self.cursor:
+                                            self.cursor = self.limit - v_16
+                                            raise lab26()
+                                        if not self.slice_del():
+                                            return False
+
+                                    else:
+                                        if not self.I_pV <= self.cursor:
+                                            self.cursor = self.limit - v_16
+                                            raise lab26()
+                                        if not self.slice_from(u"i"):
+                                            return False
+                                except lab26: pass
+                            elif among_var == 7:
+                                if not self.I_p2 <= self.cursor:
+                                    raise lab22()
+                                if not self.slice_del():
+                                    return False
+
+                                v_18 = self.limit - self.cursor
+                                try:
+                                    self.ket = self.cursor
+                                    among_var = self.find_among_b(FrenchStemmer.a_3)
+                                    if among_var == 0:
+                                        self.cursor = self.limit - v_18
+                                        raise lab29()
+                                    self.bra = self.cursor
+                                    if among_var == 1:
+                                        try:
+                                            v_19 = self.limit - self.cursor
+                                            try:
+                                                if not self.I_p2 <= self.cursor:
+                                                    raise lab31()
+                                                if not self.slice_del():
+                                                    return False
+
+                                                raise lab30()
+                                            except lab31: pass
+                                            self.cursor = self.limit - v_19
+                                            if not self.slice_from(u"abl"):
+                                                return False
+                                        except lab30: pass
+                                    elif among_var == 2:
+                                        try:
+                                            v_20 = self.limit - self.cursor
+                                            try:
+                                                if not self.I_p2 <= self.cursor:
+                                                    raise lab33()
+                                                if not self.slice_del():
+                                                    return False
+
+                                                raise lab32()
+                                            except lab33: pass
+                                            self.cursor = self.limit - v_20
+                                            if not self.slice_from(u"iqU"):
+                                                return False
+                                        except lab32: pass
+                                    else:
+                                        if not self.I_p2 <= self.cursor:
+                                            self.cursor = self.limit - v_18
+                                            raise lab29()
+                                        if not self.slice_del():
+                                            return False
+
+                                except lab29: pass
+                            elif among_var == 8:
+                                if not self.I_p2 <= self.cursor:
+                                    raise lab22()
+                                if not self.slice_del():
+                                    return False
+
+                                v_21 = self.limit - self.cursor
+                                try:
+                                    self.ket = self.cursor
+                                    if not self.eq_s_b(u"at"):
+                                        self.cursor = self.limit - v_21
+                                        raise lab34()
+                                    self.bra = self.cursor
+                                    if not self.I_p2 <= self.cursor:
+                                        self.cursor = self.limit - v_21
+                                        raise lab34()
+                                    if not self.slice_del():
+                                        return False
+
+                                    self.ket = self.cursor
+                                    if not self.eq_s_b(u"ic"):
+                                        self.cursor = self.limit - v_21
+                                        raise lab34()
+                                    self.bra = self.cursor
+                                    try:
+                                        v_22 = self.limit - self.cursor
+                                        try:
+                                            if not self.I_p2 <= self.cursor:
+                                                raise lab36()
+                                            if not self.slice_del():
+                                                return False
+
+                                            raise lab35()
+                                        except lab36: pass
+                                        self.cursor = self.limit - v_22
+                                        if not self.slice_from(u"iqU"):
+                                            return False
+                                    except lab35: pass
+                                except lab34: pass
+                            elif among_var == 9:
+                                if not self.slice_from(u"eau"):
+                                    return False
+                            elif among_var == 10:
+                                if not self.I_p1 <= self.cursor:
+                                    raise lab22()
+                                if not self.slice_from(u"al"):
+                                    return False
+                            elif among_var == 11:
+                                try:
+                                    v_23 = self.limit - self.cursor
+                                    try:
+                                        if not self.I_p2 <= self.cursor:
+                                            raise lab38()
+                                        if not self.slice_del():
+                                            return False
+
+                                        raise lab37()
+                                    except lab38: pass
+                                    self.cursor = self.limit - v_23
+                                    if not self.I_p1 <= self.cursor:
+                                        raise lab22()
+                                    if not self.slice_from(u"eux"):
+                                        return False
+                                except lab37: pass
+                            elif among_var == 12:
+                                if not self.I_p1 <= self.cursor:
+                                    raise lab22()
+                                if not self.out_grouping_b(FrenchStemmer.g_v, 97, 251):
+                                    raise lab22()
+                                if not self.slice_del():
+                                    return False
+
+                            elif among_var == 13:
+                                if not self.I_pV <= self.cursor:
+                                    raise lab22()
+                                if not self.slice_from(u"ant"):
+                                    return False
+                                raise lab22()
+                            elif among_var == 14:
+                                if not self.I_pV <= self.cursor:
+                                    raise lab22()
+                                if not self.slice_from(u"ent"):
+                                    return False
+                                raise lab22()
+                            else:
+                                v_24 = self.limit - self.cursor
+                                if not self.in_grouping_b(FrenchStemmer.g_v, 97, 251):
+                                    raise lab22()
+                                if not self.I_pV <= self.cursor:
+                                    raise lab22()
+                                self.cursor = self.limit - v_24
+                                if not self.slice_del():
+                                    return False
+
+                                raise lab22()
+                            raise lab21()
+                        except lab22: pass
+                        self.cursor = self.limit - v_13
+                        try:
+                            if self.cursor < self.I_pV:
+                                raise lab39()
+                            v_26 = self.limit_backward
+                            self.limit_backward = self.I_pV
+                            self.ket = self.cursor
+                            if self.find_among_b(FrenchStemmer.a_5) == 0:
+                                self.limit_backward = v_26
+                                raise lab39()
+                            self.bra = self.cursor
+                            v_27 = self.limit - self.cursor
+                            try:
+                                if not self.eq_s_b(u"H"):
+                                    raise lab40()
+                                self.limit_backward = v_26
+                                raise lab39()
+                            except lab40: pass
+                            self.cursor = self.limit - v_27
+                            if not self.out_grouping_b(FrenchStemmer.g_v, 97, 251):
+                                self.limit_backward = v_26
+                                raise lab39()
+                            if not self.slice_del():
+                                return False
+
+                            self.limit_backward = v_26
+                            raise lab21()
+                        except lab39: pass
+                        self.cursor = self.limit - v_13
+                        if self.cursor < self.I_pV:
+                            raise lab20()
+                        v_29 = self.limit_backward
+                        self.limit_backward = self.I_pV
+                        self.ket = self.cursor
+                        among_var = self.find_among_b(FrenchStemmer.a_6)
+                        if among_var == 0:
+                            self.limit_backward = v_29
+                            raise lab20()
+                        self.bra = self.cursor
+                        if among_var == 1:
+                            if not self.I_p2 <= self.cursor:
+                                self.limit_backward = v_29
+                                raise lab20()
+                            if not self.slice_del():
+                                return False
+
+                        elif among_var == 2:
+                            if not self.slice_del():
+                                return False
+
+                        else:
+                            if not self.slice_del():
+                                return False
+
+                            v_30 = self.limit - self.cursor
+                            try:
+                                self.ket = self.cursor
+                                if not self.eq_s_b(u"e"):
+                                    self.cursor = self.limit - v_30
+                                    raise lab41()
+                                self.bra = self.cursor
+                                if not self.slice_del():
+                                    return False
+
+                            except lab41: pass
+                        self.limit_backward = v_29
+                    except lab21: pass
+                    self.cursor = self.limit - v_12
+                    v_31 = self.limit - self.cursor
+                    try:
+                        self.ket = self.cursor
+                        try:
+                            v_32 = self.limit - self.cursor
+                            try:
+                                if not self.eq_s_b(u"Y"):
+                                    raise lab44()
+                                self.bra = self.cursor
+                                if not self.slice_from(u"i"):
+                                    return False
+                                raise lab43()
+                            except lab44: pass
+                            self.cursor = self.limit - v_32
+                            if not self.eq_s_b(u"\u00E7"):
+                                self.cursor = self.limit - v_31
+                                raise lab42()
+                            self.bra = self.cursor
+                            if not self.slice_from(u"c"):
+                                return False
+                        except lab43: pass
+                    except lab42: pass
+                    raise lab19()
+                except lab20: pass
+                self.cursor = self.limit - v_11
+                v_33 = self.limit - self.cursor
+                try:
+                    self.ket = self.cursor
+                    if not self.eq_s_b(u"s"):
+                        self.cursor = self.limit - v_33
+                        raise lab45()
+                    self.bra = self.cursor
+                    v_34 = self.limit - self.cursor
+                    try:
+                        v_35 = self.limit - self.cursor
+                        try:
+                            if not self.eq_s_b(u"Hi"):
+                                raise lab47()
+                            raise lab46()
+                        except lab47: pass
+                        self.cursor = self.limit - v_35
+                        if not self.out_grouping_b(FrenchStemmer.g_keep_with_s, 97, 232):
+                            self.cursor = self.limit - v_33
+                            raise lab45()
+                    except lab46: pass
+                    self.cursor = self.limit - v_34
+                    if not self.slice_del():
+                        return False
+
+                except lab45: pass
+                if self.cursor < self.I_pV:
+                    raise lab18()
+                v_37 = self.limit_backward
+                self.limit_backward = self.I_pV
+                self.ket = self.cursor
+                among_var = self.find_among_b(FrenchStemmer.a_7)
+                if among_var == 0:
+                    self.limit_backward = v_37
+                    raise lab18()
+                self.bra = self.cursor
+                if among_var == 1:
+                    if not self.I_p2 <= self.cursor:
+                        self.limit_backward = v_37
+                        raise lab18()
+                    try:
+                        v_38 = self.limit - self.cursor
+                        try:
+                            if not self.eq_s_b(u"s"):
+                                raise lab49()
+                            raise lab48()
+                        except lab49: pass
+                        self.cursor = self.limit - v_38
+                        if not self.eq_s_b(u"t"):
+                            self.limit_backward = v_37
+                            raise lab18()
+                    except lab48: pass
+                    if not self.slice_del():
+                        return False
+
+                elif among_var == 2:
+                    if not self.slice_from(u"i"):
+                        return False
+                else:
+                    if not self.slice_del():
+                        return False
+
+                self.limit_backward = v_37
+            except lab19: pass
+        except lab18: pass
+        self.cursor = self.limit - v_10
+        v_39 = self.limit - self.cursor
+        try:
+            v_40 = self.limit - self.cursor
+            if self.find_among_b(FrenchStemmer.a_8) == 0:
+                raise lab50()
+            self.cursor = self.limit - v_40
+            self.ket = self.cursor
+            if self.cursor <= self.limit_backward:
+                raise lab50()
+            self.cursor -= 1
+            self.bra = self.cursor
+            if not self.slice_del():
+                return False
+
+        except lab50: pass
+        self.cursor = self.limit - v_39
+        v_41 = self.limit - self.cursor
+        try:
+            v_42 = 1
+            while True:
+                try:
+                    if not self.out_grouping_b(FrenchStemmer.g_v, 97, 251):
+                        raise lab52()
+                    v_42 -= 1
+                    continue
+                except lab52: pass
+                break
+            if v_42 > 0:
+                raise lab51()
+            self.ket = self.cursor
+            try:
+                v_44 = self.limit - self.cursor
+                try:
+                    if not self.eq_s_b(u"\u00E9"):
+                        raise lab54()
+                    raise lab53()
+                except lab54: pass
+                self.cursor = self.limit - v_44
+                if not self.eq_s_b(u"\u00E8"):
+                    raise lab51()
+            except lab53: pass
+            self.bra = self.cursor
+            if not self.slice_from(u"e"):
+                return False
+        except lab51: pass
+        self.cursor = self.limit - v_41
+        self.cursor = self.limit_backward
+        v_45 = self.cursor
+        try:
+            while True:
+                v_46 = self.cursor
+                try:
+                    self.bra = self.cursor
+                    among_var = self.find_among(FrenchStemmer.a_1)
+                    if among_var == 0:
+                        raise lab56()
+                    self.ket = self.cursor
+                    if among_var == 1:
+                        if not self.slice_from(u"i"):
+                            return False
+                    elif among_var == 2:
+                        if not self.slice_from(u"u"):
+                            return False
+                    elif among_var == 3:
+                        if not self.slice_from(u"y"):
+                            return False
+                    elif among_var == 4:
+                        if not self.slice_from(u"\u00EB"):
+                            return False
+                    elif among_var == 5:
+                        if not self.slice_from(u"\u00EF"):
+                            return False
+                    elif among_var == 6:
+                        if not self.slice_del():
+                            return False
+
+                    else:
+                        if self.cursor >= self.limit:
+                            raise lab56()
+                        self.cursor += 1
+                    continue
+                except lab56: pass
+                self.cursor = v_46
+                break
+        except lab55: pass
+        self.cursor = v_45
+        return True
+
+
+class lab0(BaseException): pass
+
+
+class lab1(BaseException): pass
+
+
+class lab2(BaseException): pass
+
+
+class lab3(BaseException): pass
+
+
+class lab4(BaseException): pass
+
+
+class lab5(BaseException): pass
+
+
+class lab6(BaseException): pass
+
+
+class lab7(BaseException): pass
+
+
+class lab8(BaseException): pass
+
+
+class lab9(BaseException): pass
+
+
+class lab10(BaseException): pass
+
+
+class lab11(BaseException): pass
+
+
+class lab12(BaseException): pass
+
+
+class lab13(BaseException): pass
+
+
+class lab14(BaseException): pass
+
+
+class lab15(BaseException): pass
+
+
+class lab16(BaseException): pass
+
+
+class lab17(BaseException): pass
+
+
+class lab18(BaseException): pass
+
+
+class lab19(BaseException): pass
+
+
+class lab20(BaseException): pass
+
+
+class lab21(BaseException): pass
+
+
+class lab22(BaseException): pass
+
+
+class lab23(BaseException): pass
+
+
+class lab24(BaseException): pass
+
+
+class lab25(BaseException): pass
+
+
+class lab26(BaseException): pass
+
+
+class lab27(BaseException): pass
+
+
+class lab28(BaseException): pass
+
+
+class lab29(BaseException): pass
+
+
+class lab30(BaseException): pass
+
+
+class lab31(BaseException): pass
+
+
+class lab32(BaseException): pass
+
+
+class lab33(BaseException): pass
+
+
+class lab34(BaseException): pass
+
+
+class lab35(BaseException): pass
+
+
+class lab36(BaseException): pass
+
+
+class lab37(BaseException): pass
+
+
+class lab38(BaseException): pass
+
+
+class lab39(BaseException): pass
+
+
+class lab40(BaseException): pass
+
+
+class lab41(BaseException): pass
+
+
+class lab42(BaseException): pass
+
+
+class lab43(BaseException): pass
+
+
+class lab44(BaseException): pass
+
+
+class lab45(BaseException): pass
+
+
+class lab46(BaseException): pass
+
+
+class lab47(BaseException): pass
+
+
+class lab48(BaseException): pass
+
+
+class lab49(BaseException): pass
+
+
+class lab50(BaseException): pass
+
+
+class lab51(BaseException): pass
+
+
+class lab52(BaseException): pass
+
+
+class lab53(BaseException): pass
+
+
+class lab54(BaseException): pass
+
+
+class lab55(BaseException): pass
+
+
+class lab56(BaseException): pass
@@ -0,0 +1,439 @@
+# Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+from .basestemmer import BaseStemmer
+from .among import Among
+
+
+class GermanStemmer(BaseStemmer):
+    '''
+    This class implements the stemming algorithm defined by a snowball script.
+    Generated by Snowball 2.2.0 - https://snowballstem.org/
+    '''
+
+    a_0 = [
+        Among(u"", -1, 5),
+        Among(u"U", 0, 2),
+        Among(u"Y", 0, 1),
+        Among(u"\u00E4", 0, 3),
+        Among(u"\u00F6", 0, 4),
+        Among(u"\u00FC", 0, 2)
+    ]
+
+    a_1 = [
+        Among(u"e", -1, 2),
+        Among(u"em", -1, 1),
+        Among(u"en", -1, 2),
+        Among(u"ern", -1, 1),
+        Among(u"er", -1, 1),
+        Among(u"s", -1, 3),
+        Among(u"es", 5, 2)
+    ]
+
+    a_2 = [
+        Among(u"en", -1, 1),
+        Among(u"er", -1, 1),
+        Among(u"st", -1, 2),
+        Among(u"est", 2, 1)
+    ]
+
+    a_3 = [
+        Among(u"ig", -1, 1),
+        Among(u"lich", -1, 1)
+    ]
+
+    a_4 = [
+        Among(u"end", -1, 1),
+        Among(u"ig", -1, 2),
+        Among(u"ung", -1, 1),
+        Among(u"lich", -1, 3),
+        Among(u"isch", -1, 2),
+        Among(u"ik", -1, 2),
+        Among(u"heit", -1, 3),
+        Among(u"keit", -1, 4)
+    ]
+
+    g_v = [17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32, 8]
+
+    g_s_ending = [117, 30, 5]
+
+    g_st_ending = [117, 30, 4]
+
+    I_x = 0
+    I_p2 = 0
+    I_p1 = 0
+
+    def _stem(self):
+        v_1 = self.cursor
+        try:
+            v_2 = self.cursor
+            while True:
+                v_3 = self.cursor
+                try:
+                    try:
+                        v_4 = self.cursor
+                        try:
+                            self.bra = self.cursor
+                            if not self.eq_s(u"\u00DF"):
+                                raise lab3()
+                            self.ket = self.cursor
+                            if not self.slice_from(u"ss"):
+                                return False
+                            raise lab2()
+                        except lab3: pass
+                        self.cursor = v_4
+                        if self.cursor >= self.limit:
+                            raise lab1()
+                        self.cursor += 1
+                    except lab2: pass
+                    continue
+                except lab1: pass
+                self.cursor = v_3
+                break
+            self.cursor = v_2
+            while True:
+                v_5 = self.cursor
+                try:
+                    try:
+                        while True:
+                            v_6 = self.cursor
+                            try:
+                                if not self.in_grouping(GermanStemmer.g_v, 97, 252):
+                                    raise lab6()
+                                self.bra = self.cursor
+                                try:
+                                    v_7 = self.cursor
+                                    try:
+                                        if not self.eq_s(u"u"):
+                                            raise lab8()
+                                        self.ket = self.cursor
+                                        if not self.in_grouping(GermanStemmer.g_v, 97, 252):
+                                            raise lab8()
+                                        if not self.slice_from(u"U"):
+                                            return False
+                                        raise lab7()
+                                    except lab8: pass
+                                    self.cursor = v_7
+                                    if not self.eq_s(u"y"):
+                                        raise lab6()
+                                    self.ket = self.cursor
+                                    if not self.in_grouping(GermanStemmer.g_v, 97, 252):
+                                        raise lab6()
+                                    if not self.slice_from(u"Y"):
+                                        return False
+                                except lab7: pass
+                                self.cursor = v_6
+                                raise lab5()
+                            except lab6: pass
+                            self.cursor = v_6
+                            if self.cursor >= self.limit:
+                                raise lab4()
+                            self.cursor += 1
+                    except lab5: pass
+                    continue
+                except lab4: pass
+                self.cursor = v_5
+                break
+        except lab0: pass
+        self.cursor = v_1
+        v_8 = self.cursor
+        try:
+            self.I_p1 = self.limit
+            self.I_p2 = self.limit
+            v_9 = self.cursor
+            c = self.cursor + 3
+            if c > self.limit:
+                raise lab9()
+            self.cursor = c
+            self.I_x = self.cursor
+            self.cursor = v_9
+            if not self.go_out_grouping(GermanStemmer.g_v, 97, 252):
+                raise lab9()
+            self.cursor += 1
+            if not self.go_in_grouping(GermanStemmer.g_v, 97, 252):
+                raise lab9()
+            self.cursor += 1
+            self.I_p1 = self.cursor
+            try:
+                if not self.I_p1 < self.I_x:
+                    raise lab10()
+                self.I_p1 = self.I_x
+            except lab10: pass
+            if not self.go_out_grouping(GermanStemmer.g_v, 97, 252):
+                raise lab9()
+            self.cursor += 1
+            if not self.go_in_grouping(GermanStemmer.g_v, 97, 252):
+                raise lab9()
+            self.cursor += 1
+            self.I_p2 = self.cursor
+        except lab9: pass
+        self.cursor = v_8
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        try:
+            v_12 = self.limit - self.cursor
+            try:
+                self.ket = self.cursor
+                among_var = self.find_among_b(GermanStemmer.a_1)
+                if among_var == 0:
+                    raise lab12()
+                self.bra = self.cursor
+                if not self.I_p1 <= self.cursor:
+                    raise lab12()
+                if among_var == 1:
+                    if not self.slice_del():
+                        return False
+
+                elif among_var == 2:
+                    if not self.slice_del():
+                        return False
+
+                    v_13 = self.limit - self.cursor
+                    try:
+                        self.ket = self.cursor
+                        if not self.eq_s_b(u"s"):
+                            self.cursor = self.limit - v_13
+                            raise lab13()
+                        self.bra = self.cursor
+                        if not self.eq_s_b(u"nis"):
+                            self.cursor = self.limit - v_13
+                            raise lab13()
+                        if not self.slice_del():
+                            return False
+
+                    except lab13: pass
+                else:
+                    if not self.in_grouping_b(GermanStemmer.g_s_ending, 98, 116):
+                        raise lab12()
+                    if not self.slice_del():
+                        return False
+
+            except lab12: pass
+            self.cursor = self.limit - v_12
+            v_14 = self.limit - self.cursor
+            try:
+                self.ket = self.cursor
+                among_var = self.find_among_b(GermanStemmer.a_2)
+                if among_var == 0:
+                    raise lab14()
+                self.bra = self.cursor
+                if not self.I_p1 <= self.cursor:
+                    raise lab14()
+                if among_var == 1:
+                    if not self.slice_del():
+                        return False
+
+                else:
+                    if not self.in_grouping_b(GermanStemmer.g_st_ending, 98, 116):
+                        raise lab14()
+                    c = self.cursor - 3
+                    if c < self.limit_backward:
+                        raise lab14()
+                    self.cursor = c
+                    if not self.slice_del():
+                        return False
+
+            except lab14: pass
+            self.cursor = self.limit - v_14
+            v_15 = self.limit - self.cursor
+            try:
+                self.ket = self.cursor
+                among_var = self.find_among_b(GermanStemmer.a_4)
+                if among_var == 0:
+                    raise lab15()
+                self.bra = self.cursor
+                if not self.I_p2 <= self.cursor:
+                    raise lab15()
+                if among_var == 1:
+                    if not self.slice_del():
+                        return False
+
+                    v_16 = self.limit - self.cursor
+                    try:
+                        self.ket = self.cursor
+                        if not self.eq_s_b(u"ig"):
+                            self.cursor = self.limit - v_16
+                            raise lab16()
+                        self.bra = self.cursor
+                        v_17 = self.limit - self.cursor
+                        try:
+                            if not self.eq_s_b(u"e"):
+                                raise lab17()
+                            self.cursor = self.limit - v_16
+                            raise lab16()
+                        except lab17: pass
+                        self.cursor = self.limit - v_17
+                        if not self.I_p2 <= self.cursor:
+                            self.cursor = self.limit - v_16
+                            raise lab16()
+                        if not self.slice_del():
+                            return False
+
+                    except lab16: pass
+                elif among_var == 2:
+                    v_18 = self.limit - self.cursor
+                    try:
+                        if not self.eq_s_b(u"e"):
+                            raise lab18()
+                        raise lab15()
+                    except lab18: pass
+                    self.cursor = self.limit - v_18
+                    if not self.slice_del():
+                        return False
+
+                elif among_var == 3:
+                    if not self.slice_del():
+                        return False
+
+                    v_19 = self.limit - self.cursor
+                    try:
+                        self.ket = self.cursor
+                        try:
+                            v_20 = self.limit - self.cursor
+                            try:
+                                if not self.eq_s_b(u"er"):
+                                    raise lab21()
+                                raise lab20()
+                            except lab21: pass
+                            self.cursor = self.limit - v_20
+                            if not self.eq_s_b(u"en"):
+                                self.cursor = self.limit - v_19
+                                raise lab19()
+                        except lab20: pass
+                        self.bra = self.cursor
+                        if not self.I_p1 <= self.cursor:
+                            self.cursor = self.limit - v_19
+                            raise lab19()
+                        if not self.slice_del():
+                            return False
+
+                    except lab19: pass
+                else:
+                    if not self.slice_del():
+                        return False
+
+                    v_21 = self.limit - self.cursor
+                    try:
+                        self.ket = self.cursor
+                        if self.find_among_b(GermanStemmer.a_3) == 0:
+                            self.cursor = self.limit - v_21
+                            raise lab22()
+                        self.bra = self.cursor
+                        if not self.I_p2 <= self.cursor:
+                            self.cursor = self.limit - v_21
+                            raise lab22()
+                        if not self.slice_del():
+                            return False
+
+                    except lab22: pass
+            except lab15: pass
+            self.cursor = self.limit - v_15
+        except lab11: pass
+        self.cursor = self.limit_backward
+        v_22 = self.cursor
+        try:
+            while True:
+                v_23 = self.cursor
+                try:
+                    self.bra = self.cursor
+                    among_var = self.find_among(GermanStemmer.a_0)
+                    if among_var == 0:
+                        raise lab24()
+                    self.ket = self.cursor
+                    if among_var == 1:
+                        if not self.slice_from(u"y"):
+                            return False
+                    elif among_var == 2:
+                        if not self.slice_from(u"u"):
+                            return False
+                    elif among_var == 3:
+                        if not self.slice_from(u"a"):
+                            return False
+                    elif among_var == 4:
+                        if not self.slice_from(u"o"):
+                            return False
+                    else:
+                        if self.cursor >= self.limit:
+                            raise lab24()
+                        self.cursor += 1
+                    continue
+                except lab24: pass
+                self.cursor = v_23
+                break
+        except lab23: pass
+        self.cursor = v_22
+        return True
+
+
+class lab0(BaseException): pass
+
+
+class lab1(BaseException): pass
+
+
+class lab2(BaseException): pass
+
+
+class lab3(BaseException): pass
+
+
+class lab4(BaseException): pass
+
+
+class lab5(BaseException): pass
+
+
+class lab6(BaseException): pass
+
+
+class lab7(BaseException): pass
+
+
+class lab8(BaseException): pass
+
+
+class lab9(BaseException): pass
+
+
+class lab10(BaseException): pass
+
+
+class lab11(BaseException): pass
+
+
+class lab12(BaseException): pass
+
+
+class lab13(BaseException): pass
+
+
+class lab14(BaseException): pass
+
+
+class lab15(BaseException): pass
+
+
+class lab16(BaseException): pass
+
+
+class lab17(BaseException): pass
+
+
+class lab18(BaseException): pass
+
+
+class lab19(BaseException): pass
+
+
+class lab20(BaseException): pass
+
+
+class lab21(BaseException): pass
+
+
+class lab22(BaseException): pass
+
+
+class lab23(BaseException): pass
+
+
+class lab24(BaseException): pass
@@ -0,0 +1,198 @@
+# Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+from .basestemmer import BaseStemmer
+from .among import Among
+
+
+class NorwegianStemmer(BaseStemmer):
+    '''
+    This class implements the stemming algorithm defined by a snowball script.
+    Generated by Snowball 2.2.0 - https://snowballstem.org/
+    '''
+
+    a_0 = [
+        Among(u"a", -1, 1),
+        Among(u"e", -1, 1),
+        Among(u"ede", 1, 1),
+        Among(u"ande", 1, 1),
+        Among(u"ende", 1, 1),
+        Among(u"ane", 1, 1),
+        Among(u"ene", 1, 1),
+        Among(u"hetene", 6, 1),
+        Among(u"erte", 1, 3),
+        Among(u"en", -1, 1),
+        Among(u"heten", 9, 1),
+        Among(u"ar", -1, 1),
+        Among(u"er", -1, 1),
+        Among(u"heter", 12, 1),
+        Among(u"s", -1, 2),
+        Among(u"as", 14, 1),
+        Among(u"es", 14, 1),
+        Among(u"edes", 16, 1),
+        Among(u"endes", 16, 1),
+        Among(u"enes", 16, 1),
+        Among(u"hetenes", 19, 1),
+        Among(u"ens", 14, 1),
+        Among(u"hetens", 21, 1),
+        Among(u"ers", 14, 1),
+        Among(u"ets", 14, 1),
+        Among(u"et", -1, 1),
+        Among(u"het", 25, 1),
+        Among(u"ert", -1, 3),
+        Among(u"ast", -1, 1)
+    ]
+
+    a_1 = [
+        Among(u"dt", -1, -1),
+        Among(u"vt", -1, -1)
+    ]
+
+    a_2 = [
+        Among(u"leg", -1, 1),
+        Among(u"eleg", 0, 1),
+        Among(u"ig", -1, 1),
+        Among(u"eig", 2, 1),
+        Among(u"lig", 2, 1),
+        Among(u"elig", 4, 1),
+        Among(u"els", -1, 1),
+        Among(u"lov", -1, 1),
+        Among(u"elov", 7, 1),
+        Among(u"slov", 7, 1),
+        Among(u"hetslov", 9, 1)
+    ]
+
+    g_v = [17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 128]
+
+    g_s_ending = [119, 125, 149, 1]
+
+    I_x = 0
+    I_p1 = 0
+
+    def _stem(self):
+        v_1 = self.cursor
+        try:
+            self.I_p1 = self.limit
+            v_2 = self.cursor
+            c = self.cursor + 3
+            if c > self.limit:
+                raise lab0()
+            self.cursor = c
+            self.I_x = self.cursor
+            self.cursor = v_2
+            if not self.go_out_grouping(NorwegianStemmer.g_v, 97, 248):
+                raise lab0()
+            if not self.go_in_grouping(NorwegianStemmer.g_v, 97, 248):
+                raise lab0()
+            self.cursor += 1
+            self.I_p1 = self.cursor
+            try:
+                if not self.I_p1 < self.I_x:
+                    raise lab1()
+                self.I_p1 = self.I_x
+            except lab1: pass
+        except lab0: pass
+        self.cursor = v_1
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        v_4 = self.limit - self.cursor
+        try:
+            if self.cursor < self.I_p1:
+                raise lab2()
+            v_6 = self.limit_backward
+            self.limit_backward = self.I_p1
+            self.ket = self.cursor
+            among_var = self.find_among_b(NorwegianStemmer.a_0)
+            if among_var == 0:
+                self.limit_backward = v_6
+                raise lab2()
+            self.bra = self.cursor
+            self.limit_backward = v_6
+            if among_var == 1:
+                if not self.slice_del():
+                    return False
+
+            elif among_var == 2:
+                try:
+                    v_7 = self.limit - self.cursor
+                    try:
+                        if not self.in_grouping_b(NorwegianStemmer.g_s_ending, 98, 122):
+                            raise lab4()
+                        raise lab3()
+                    except lab4: pass
+                    self.cursor = self.limit - v_7
+                    if not self.eq_s_b(u"k"):
+                        raise lab2()
+                    if not self.out_grouping_b(NorwegianStemmer.g_v, 97, 248):
+                        raise lab2()
+                except lab3: pass
+                if not self.slice_del():
+                    return False
+
+            else:
+                if not self.slice_from(u"er"):
+                    return False
+        except lab2: pass
+        self.cursor = self.limit - v_4
+        v_8 = self.limit - self.cursor
+        try:
+            v_9 = self.limit - self.cursor
+            if self.cursor < self.I_p1:
+                raise lab5()
+            v_11 = self.limit_backward
+            self.limit_backward = self.I_p1
+            self.ket = self.cursor
+            if self.find_among_b(NorwegianStemmer.a_1) == 0:
+                self.limit_backward = v_11
+                raise lab5()
+            self.bra = self.cursor
+            self.limit_backward = v_11
+            self.cursor = self.limit - v_9
+            if self.cursor <= self.limit_backward:
+                raise lab5()
+            self.cursor -= 1
+            self.bra = self.cursor
+            if not self.slice_del():
+                return False
+
+        except lab5: pass
+        self.cursor = self.limit - v_8
+        v_12 = self.limit - self.cursor
+        try:
+            if self.cursor < self.I_p1:
+                raise lab6()
+            v_14 = self.limit_backward
+            self.limit_backward = self.I_p1
+            self.ket = self.cursor
+            if self.find_among_b(NorwegianStemmer.a_2) == 0:
+                self.limit_backward = v_14
+                raise lab6()
+            self.bra = self.cursor
+            self.limit_backward = v_14
+            if not self.slice_del():
+                return False
+
+        except lab6: pass
+        self.cursor = self.limit - v_12
+        self.cursor = self.limit_backward
+        return True
+
+
+class lab0(BaseException): pass
+
+
+class lab1(BaseException): pass
+
+
+class lab2(BaseException): pass
+
+
+class lab3(BaseException): pass
+
+
+class lab4(BaseException): pass
+
+
+class lab5(BaseException): pass
+
+
+class lab6(BaseException): pass
@@ -0,0 +1,1970 @@
+# Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+from .basestemmer import BaseStemmer
+from .among import Among
+
+
+class TamilStemmer(BaseStemmer):
+    '''
+    This class implements the stemming algorithm defined by a snowball script.
+    Generated by Snowball 2.2.0 - https://snowballstem.org/
+    '''
+
+    a_0 = [
+        Among(u"\u0B95", -1, -1),
+        Among(u"\u0B99", -1, -1),
+        Among(u"\u0B9A", -1, -1),
+        Among(u"\u0B9E", -1, -1),
+        Among(u"\u0BA4", -1, -1),
+        Among(u"\u0BA8", -1, -1),
+        Among(u"\u0BAA", -1, -1),
+        Among(u"\u0BAE", -1, -1),
+        Among(u"\u0BAF", -1, -1),
+        Among(u"\u0BB5", -1, -1)
+    ]
+
+    a_1 = [
+        Among(u"\u0BA8\u0BCD\u0BA4", -1, -1),
+        Among(u"\u0BA8\u0BCD\u0BA4\u0BCD", -1, -1),
+        Among(u"\u0BA8\u0BCD", -1, -1)
+    ]
+
+    a_2 = [
+        Among(u"\u0BBF", -1, -1),
+        Among(u"\u0BC0", -1, -1),
+        Among(u"\u0BC8", -1, -1)
+    ]
+
+    a_3 = [
+        Among(u"\u0B95", -1, -1),
+        Among(u"\u0B9A", -1, -1),
+        Among(u"\u0B9F", -1, -1),
+        Among(u"\u0BA4", -1, -1),
+        Among(u"\u0BAA", -1, -1),
+        Among(u"\u0BB1", -1, -1)
+    ]
+
+    a_4 = [
+        Among(u"\u0B95", -1, -1),
+        Among(u"\u0B9A", -1, -1),
+        Among(u"\u0B9F", -1, -1),
+        Among(u"\u0BA4", -1, -1),
+        Among(u"\u0BAA", -1, -1),
+        Among(u"\u0BB1", -1, -1)
+    ]
+
+    a_5 = [
+        Among(u"\u0B95", -1, -1),
+        Among(u"\u0B9A", -1, -1),
+        Among(u"\u0B9F", -1, -1),
+        Among(u"\u0BA4", -1, -1),
+        Among(u"\u0BAA", -1, -1),
+        Among(u"\u0BB1", -1, -1)
+    ]
+
+    a_6 = [
+        Among(u"\u0BAF", -1, -1),
+        Among(u"\u0BB0", -1, -1),
+        Among(u"\u0BB2", -1, -1),
+        Among(u"\u0BB3", -1, -1),
+        Among(u"\u0BB4", -1, -1),
+        Among(u"\u0BB5", -1, -1)
+    ]
+
+    a_7 = [
+        Among(u"\u0B99", -1, -1),
+        Among(u"\u0B9E", -1, -1),
+        Among(u"\u0BA3", -1, -1),
+        Among(u"\u0BA8", -1, -1),
+        Among(u"\u0BA9", -1, -1),
+        Among(u"\u0BAE", -1, -1)
+    ]
+
+    a_8 = [
+        Among(u"\u0BAF", -1, -1),
+        Among(u"\u0BB5", -1, -1),
+        Among(u"\u0BB5\u0BCD", -1, -1)
+    ]
+
+    a_9 = [
+        Among(u"\u0BBE", -1, -1),
+        Among(u"\u0BBF", -1, -1),
+        Among(u"\u0BC0", -1, -1),
+        Among(u"\u0BC1", -1, -1),
+        Among(u"\u0BC2", -1, -1),
+        Among(u"\u0BC6", -1, -1),
+        Among(u"\u0BC7", -1, -1),
+        Among(u"\u0BC8", -1, -1)
+    ]
+
+    a_10 = [
+        Among(u"\u0BBE", -1, -1),
+        Among(u"\u0BBF", -1, -1),
+        Among(u"\u0BC0", -1, -1),
+        Among(u"\u0BC1", -1, -1),
+        Among(u"\u0BC2", -1, -1),
+        Among(u"\u0BC6", -1, -1),
+        Among(u"\u0BC7", -1, -1),
+        Among(u"\u0BC8", -1, -1)
+    ]
+
+    a_11 = [
+        Among(u"\u0B85", -1, -1),
+        Among(u"\u0B87", -1, -1),
+        Among(u"\u0B89", -1, -1)
+    ]
+
+    a_12 = [
+        Among(u"\u0B95", -1, -1),
+        Among(u"\u0B99", -1, -1),
+        Among(u"\u0B9A", -1, -1),
+        Among(u"\u0B9E", -1, -1),
+        Among(u"\u0BA4", -1, -1),
+        Among(u"\u0BA8", -1, -1),
+        Among(u"\u0BAA", -1, -1),
+        Among(u"\u0BAE", -1, -1),
+        Among(u"\u0BAF", -1, -1),
+        Among(u"\u0BB5", -1, -1)
+    ]
+
+    a_13 = [
+        Among(u"\u0B95", -1, -1),
+        Among(u"\u0B9A", -1, -1),
+        Among(u"\u0B9F", -1, -1),
+        Among(u"\u0BA4", -1, -1),
+        Among(u"\u0BAA", -1, -1),
+        Among(u"\u0BB1", -1, -1)
+    ]
+
+    a_14 = [
+        Among(u"\u0BBE", -1, -1),
+        Among(u"\u0BC7", -1, -1),
+        Among(u"\u0BCB", -1, -1)
+    ]
+
+    a_15 = [
+        Among(u"\u0BAA\u0BBF", -1, -1),
+        Among(u"\u0BB5\u0BBF", -1, -1)
+    ]
+
+    a_16 = [
+        Among(u"\u0BBE", -1, -1),
+        Among(u"\u0BBF", -1, -1),
+        Among(u"\u0BC0", -1, -1),
+        Among(u"\u0BC1", -1, -1),
+        Among(u"\u0BC2", -1, -1),
+        Among(u"\u0BC6", -1, -1),
+        Among(u"\u0BC7", -1, -1),
+        Among(u"\u0BC8", -1, -1)
+    ]
+
+    a_17 = [
+        Among(u"\u0BAA\u0B9F\u0BCD\u0B9F", -1, -1),
+        Among(u"\u0BAA\u0B9F\u0BCD\u0B9F\u0BA3", -1, -1),
+        Among(u"\u0BA4\u0BBE\u0BA9", -1, -1),
+        Among(u"\u0BAA\u0B9F\u0BBF\u0BA4\u0BBE\u0BA9", 2, -1),
+        Among(u"\u0B95\u0BC1\u0BB0\u0BBF\u0BAF", -1, -1),
+        Among(u"\u0BAA\u0B9F\u0BBF", -1, -1),
+        Among(u"\u0BAA\u0BB1\u0BCD\u0BB1\u0BBF", -1, -1),
+        Among(u"\u0BAA\u0B9F\u0BC1", -1, -1),
+        Among(u"\u0BB5\u0BBF\u0B9F\u0BC1", -1, -1),
+        Among(u"\u0BAA\u0B9F\u0BCD\u0B9F\u0BC1", -1, -1),
+        Among(u"\u0BB5\u0BBF\u0B9F\u0BCD\u0B9F\u0BC1", -1, -1),
+        Among(u"\u0BAA\u0B9F\u0BCD\u0B9F\u0BA4\u0BC1", -1, -1),
+        Among(u"\u0BC6\u0BB2\u0BCD\u0BB2\u0BBE\u0BAE\u0BCD", -1, -1)
+    ]
+
+    a_18 = [
+        Among(u"\u0B95", -1, -1),
+        Among(u"\u0B9A", -1, -1),
+        Among(u"\u0B9F", -1, -1),
+        Among(u"\u0BA4", -1, -1),
+        Among(u"\u0BAA", -1, -1),
+        Among(u"\u0BB1", -1, -1)
+    ]
+
+    a_19 = [
+        Among(u"\u0B95", -1, -1),
+        Among(u"\u0B9A", -1, -1),
+        Among(u"\u0B9F", -1, -1),
+        Among(u"\u0BA4", -1, -1),
+        Among(u"\u0BAA", -1, -1),
+        Among(u"\u0BB1", -1, -1)
+    ]
+
+    a_20 = [
+        Among(u"\u0BBE", -1, -1),
+        Among(u"\u0BBF", -1, -1),
+        Among(u"\u0BC0", -1, -1),
+        Among(u"\u0BC1", -1, -1),
+        Among(u"\u0BC2", -1, -1),
+        Among(u"\u0BC6", -1, -1),
+        Among(u"\u0BC7", -1, -1),
+        Among(u"\u0BC8", -1, -1)
+    ]
+
+    a_21 = [
+        Among(u"\u0BBE", -1, -1),
+        Among(u"\u0BBF", -1, -1),
+        Among(u"\u0BC0", -1, -1),
+        Among(u"\u0BC1", -1, -1),
+        Among(u"\u0BC2", -1, -1),
+        Among(u"\u0BC6", -1, -1),
+        Among(u"\u0BC7", -1, -1),
+        Among(u"\u0BC8", -1, -1)
+    ]
+
+    a_22 = [
+        Among(u"\u0BAA\u0B9F\u0BC1", -1, -1),
+        Among(u"\u0B95\u0BCA\u0BA3\u0BCD\u0B9F\u0BBF\u0BB0\u0BCD", -1, -1)
+    ]
+
+    a_23 = [
+        Among(u"\u0B85", -1, -1),
+        Among(u"\u0B86", -1, -1),
+        Among(u"\u0B87", -1, -1),
+        Among(u"\u0B88", -1, -1),
+        Among(u"\u0B89", -1, -1),
+        Among(u"\u0B8A", -1, -1),
+        Among(u"\u0B8E", -1, -1),
+        Among(u"\u0B8F", -1, -1),
+        Among(u"\u0B90", -1, -1),
+        Among(u"\u0B92", -1, -1),
+        Among(u"\u0B93", -1, -1),
+        Among(u"\u0B94", -1, -1)
+    ]
+
+    a_24 = [
+        Among(u"\u0BBE", -1, -1),
+        Among(u"\u0BBF", -1, -1),
+        Among(u"\u0BC0", -1, -1),
+        Among(u"\u0BC1", -1, -1),
+        Among(u"\u0BC2", -1, -1),
+        Among(u"\u0BC6", -1, -1),
+        Among(u"\u0BC7", -1, -1),
+        Among(u"\u0BC8", -1, -1)
+    ]
+
+    a_25 = [
+        Among(u"\u0B95\u0BBF\u0BB1", -1, -1),
+        Among(u"\u0B95\u0BBF\u0BA9\u0BCD\u0BB1", -1, -1),
+        Among(u"\u0BBE\u0BA8\u0BBF\u0BA9\u0BCD\u0BB1", -1, -1),
+        Among(u"\u0B95\u0BBF\u0BB1\u0BCD", -1, -1),
+        Among(u"\u0B95\u0BBF\u0BA9\u0BCD\u0BB1\u0BCD", -1, -1),
+        Among(u"\u0BBE\u0BA8\u0BBF\u0BA9\u0BCD\u0BB1\u0BCD", -1, -1)
+    ]
+
+    B_found_vetrumai_urupu = False
+    B_found_a_match = False
+
+    def __r_fix_va_start(self):
+        try:
+            v_1 = self.cursor
+            try:
+                v_2 = self.cursor
+                v_3 = self.cursor
+                try:
+                    if not self.eq_s(u"\u0BB5\u0BCB"):
+                        self.cursor = v_3
+                        raise lab2()
+                except lab2: pass
+                self.cursor = v_2
+                self.bra = self.cursor
+                if not self.eq_s(u"\u0BB5\u0BCB"):
+                    raise lab1()
+                self.ket = self.cursor
+                if not self.slice_from(u"\u0B93"):
+                    return False
+                raise lab0()
+            except lab1: pass
+            self.cursor = v_1
+            try:
+                v_4 = self.cursor
+                v_5 = self.cursor
+                try:
+                    if not self.eq_s(u"\u0BB5\u0BCA"):
+                        self.cursor = v_5
+                        raise lab4()
+                except lab4: pass
+                self.cursor = v_4
+                self.bra = self.cursor
+                if not self.eq_s(u"\u0BB5\u0BCA"):
+                    raise lab3()
+                self.ket = self.cursor
+                if not self.slice_from(u"\u0B92"):
+                    return False
+                raise lab0()
+            except lab3: pass
+            self.cursor = v_1
+            try:
+                v_6 = self.cursor
+                v_7 = self.cursor
+                try:
+                    if not self.eq_s(u"\u0BB5\u0BC1"):
+                        self.cursor = v_7
+                        raise lab6()
+                except lab6: pass
+                self.cursor = v_6
+                self.bra = self.cursor
+                if not self.eq_s(u"\u0BB5\u0BC1"):
+                    raise lab5()
+                self.ket = self.cursor
+                if not self.slice_from(u"\u0B89"):
+                    return False
+                raise lab0()
+            except lab5: pass
+            self.cursor = v_1
+            v_8 = self.cursor
+            v_9 = self.cursor
+            try:
+                if not self.eq_s(u"\u0BB5\u0BC2"):
+                    self.cursor = v_9
+                    raise lab7()
+            except lab7: pass
+            self.cursor = v_8
+            self.bra = self.cursor
+            if not self.eq_s(u"\u0BB5\u0BC2"):
+                return False
+            self.ket = self.cursor
+            if not self.slice_from(u"\u0B8A"):
+                return False
+        except lab0: pass
+        return True
+
+    def __r_fix_endings(self):
+        v_1 = self.cursor
+        try:
+            while True:
+                v_2 = self.cursor
+                try:
+                    if not self.__r_fix_ending():
+                        raise lab1()
+                    continue
+                except lab1: pass
+                self.cursor = v_2
+                break
+        except lab0: pass
+        self.cursor = v_1
+        return True
+
+    def __r_fix_ending(self):
+        if not len(self.current) > 3:
+            return False
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        try:
+            v_1 = self.limit - self.cursor
+            try:
+                self.ket = self.cursor
+                if self.find_among_b(TamilStemmer.a_1) == 0:
+                    raise lab1()
+                self.bra = self.cursor
+                if not self.slice_del():
+                    return False
+
+                raise lab0()
+            except lab1: pass
+            self.cursor = self.limit - v_1
+            try:
+                self.ket = self.cursor
+                if not self.eq_s_b(u"\u0BAF\u0BCD"):
+                    raise lab2()
+                v_2 = self.limit - self.cursor
+                if self.find_among_b(TamilStemmer.a_2) == 0:
+                    raise lab2()
+                self.cursor = self.limit - v_2
+                self.bra = self.cursor
+                if not self.slice_del():
+                    return False
+
+                raise lab0()
+            except lab2: pass
+            self.cursor = self.limit - v_1
+            try:
+                self.ket = self.cursor
+                try:
+                    v_3 = self.limit - self.cursor
+                    try:
+                        if not self.eq_s_b(u"\u0B9F\u0BCD\u0BAA\u0BCD"):
+                            raise lab5()
+                        raise lab4()
+                    except lab5: pass
+                    self.cursor = self.limit - v_3
+                    if not self.eq_s_b(u"\u0B9F\u0BCD\u0B95\u0BCD"):
+                        raise lab3()
+                except lab4: pass
+                self.bra = self.cursor
+                if not self.slice_from(u"\u0BB3\u0BCD"):
+                    return False
+                raise lab0()
+            except lab3: pass
+            self.cursor = self.limit - v_1
+            try:
+                self.ket = self.cursor
+                if not self.eq_s_b(u"\u0BA9\u0BCD\u0BB1\u0BCD"):
+                    raise lab6()
+                self.bra = self.cursor
+                if not self.slice_from(u"\u0BB2\u0BCD"):
+                    return False
+                raise lab0()
+            except lab6: pass
+            self.cursor = self.limit - v_1
+            try:
+                self.ket = self.cursor
+                if not self.eq_s_b(u"\u0BB1\u0BCD\u0B95\u0BCD"):
+                    raise lab7()
+                self.bra = self.cursor
+                if not self.slice_from(u"\u0BB2\u0BCD"):
+                    return False
+                raise lab0()
+            except lab7: pass
+            self.cursor = self.limit - v_1
+            try:
+                self.ket = self.cursor
+                if not self.eq_s_b(u"\u0B9F\u0BCD\u0B9F\u0BCD"):
+                    raise lab8()
+                self.bra = self.cursor
+                if not self.slice_from(u"\u0B9F\u0BC1"):
+                    return False
+                raise lab0()
+            except lab8: pass
+            self.cursor = self.limit - v_1
+            try:
+                if not self.B_found_vetrumai_urupu:
+                    raise lab9()
+                self.ket = self.cursor
+                if not self.eq_s_b(u"\u0BA4\u0BCD\u0BA4\u0BCD"):
+                    raise lab9()
+                v_4 = self.limit - self.cursor
+                v_5 = self.limit - self.cursor
+                try:
+                    if not self.eq_s_b(u"\u0BC8"):
+                        raise lab10()
+                    raise lab9()
+                except lab10: pass
+                self.cursor = self.limit - v_5
+                self.cursor = self.limit - v_4
+                self.bra = self.cursor
+                if not self.slice_from(u"\u0BAE\u0BCD"):
+                    return False
+                self.bra = self.cursor
+                raise lab0()
+            except lab9: pass
+            self.cursor = self.limit - v_1
+            try:
+                self.ket = self.cursor
+                try:
+                    v_6 = self.limit - self.cursor
+                    try:
+                        if not self.eq_s_b(u"\u0BC1\u0B95\u0BCD"):
+                            raise lab13()
+                        raise lab12()
+                    except lab13: pass
+                    self.cursor = self.limit - v_6
+                    if not self.eq_s_b(u"\u0BC1\u0B95\u0BCD\u0B95\u0BCD"):
+                        raise lab11()
+                except lab12: pass
+                self.bra = self.cursor
+                if not self.slice_from(u"\u0BCD"):
+                    return False
+                raise lab0()
+            except lab11: pass
+            self.cursor = self.limit - v_1
+            try:
+                self.ket = self.cursor
+                if not self.eq_s_b(u"\u0BCD"):
+                    raise lab14()
+                if self.find_among_b(TamilStemmer.a_3) == 0:
+                    raise lab14()
+                if not self.eq_s_b(u"\u0BCD"):
+                    raise lab14()
+                if self.find_among_b(TamilStemmer.a_4) == 0:
+                    raise lab14()
+                self.bra = self.cursor
+                if not self.slice_del():
+                    return False
+
+                raise lab0()
+            except lab14: pass
+            self.cursor = self.limit - v_1
+            try:
+                self.ket = self.cursor
+                if not self.eq_s_b(u"\u0BC1\u0B95\u0BCD"):
+                    raise lab15()
+                self.bra = self.cursor
+                if not self.slice_from(u"\u0BCD"):
+                    return False
+                raise lab0()
+            except lab15: pass
+            self.cursor = self.limit - v_1
+            try:
+                self.ket = self.cursor
+                if not self.eq_s_b(u"\u0BCD"):
+                    raise lab16()
+                if self.find_among_b(TamilStemmer.a_5) == 0:
+                    raise lab16()
+                self.bra = self.cursor
+                if not self.slice_del():
+                    return False
+
+                raise lab0()
+            except lab16: pass
+            self.cursor = self.limit - v_1
+            try:
+                self.ket = self.cursor
+                if not self.eq_s_b(u"\u0BCD"):
+                    raise lab17()
+                try:
+                    v_7 = self.limit - self.cursor
+                    try:
+                        if self.find_among_b(TamilStemmer.a_6) == 0:
+                            raise lab19()
+                        raise lab18()
+                    except lab19: pass
+                    self.cursor = self.limit - v_7
+                    if self.find_among_b(TamilStemmer.a_7) == 0:
+                        raise lab17()
+                except lab18: pass
+                if not self.eq_s_b(u"\u0BCD"):
+                    raise lab17()
+                self.bra = self.cursor
+                if not self.slice_from(u"\u0BCD"):
+                    return False
+                raise lab0()
+            except lab17: pass
+            self.cursor = self.limit - v_1
+            try:
+                self.ket = self.cursor
+                if self.find_among_b(TamilStemmer.a_8) == 0:
+                    raise lab20()
+                self.bra = self.cursor
+                if not self.slice_del():
+                    return False
+
+                raise lab0()
+            except lab20: pass
+            self.cursor = self.limit - v_1
+            try:
+                self.ket = self.cursor
+                if not self.eq_s_b(u"\u0BA9\u0BC1"):
+                    raise lab21()
+                v_8 = self.limit - self.cursor
+                v_9 = self.limit - self.cursor
+                try:
+                    if self.find_among_b(TamilStemmer.a_9) == 0:
+                        raise lab22()
+                    raise lab21()
+                except lab22: pass
+                self.cursor = self.limit - v_9
+                self.cursor = self.limit - v_8
+                self.bra = self.cursor
+                if not self.slice_del():
+                    return False
+
+                raise lab0()
+            except lab21: pass
+            self.cursor = self.limit - v_1
+            try:
+                self.ket = self.cursor
+                if not self.eq_s_b(u"\u0B99\u0BCD"):
+                    raise lab23()
+                v_10 = self.limit - self.cursor
+                v_11 = self.limit - self.cursor
+                try:
+                    if not self.eq_s_b(u"\u0BC8"):
+                        raise lab24()
+                    raise lab23()
+                except lab24: pass
+                self.cursor = self.limit - v_11
+                self.cursor = self.limit - v_10
+                self.bra = self.cursor
+                if not self.slice_from(u"\u0BAE\u0BCD"):
+                    return False
+                raise lab0()
+            except lab23: pass
+            self.cursor = self.limit - v_1
+            try:
+                self.ket = self.cursor
+                if not self.eq_s_b(u"\u0B99\u0BCD"):
+                    raise lab25()
+                self.bra = self.cursor
+                if not self.slice_del():
+                    return False
+
+                raise lab0()
+            except lab25: pass
+            self.cursor = self.limit - v_1
+            self.ket = self.cursor
+            if not self.eq_s_b(u"\u0BCD"):
+                return False
+            v_12 = self.limit - self.cursor
+            try:
+                v_13 = self.limit - self.cursor
+                try:
+                    if self.find_among_b(TamilStemmer.a_10) == 0:
+                        raise lab27()
+                    raise lab26()
+                except lab27: pass
+                self.cursor = self.limit - v_13
+                if not self.eq_s_b(u"\u0BCD"):
+                    return False
+            except lab26: pass
+            self.cursor = self.limit - v_12
+            self.bra = self.cursor
+            if not self.slice_del():
+                return False
+
+        except lab0: pass
+        self.cursor = self.limit_backward
+        return True
+
+    def _stem(self):
+        self.B_found_vetrumai_urupu = False
+        v_1 = self.cursor
+        self.__r_fix_ending()
+        self.cursor = v_1
+        if not len(self.current) > 4:
+            return False
+        v_2 = self.cursor
+        try:
+            self.bra = self.cursor
+            if not self.eq_s(u"\u0B8E"):
+                raise lab0()
+            if self.find_among(TamilStemmer.a_0) == 0:
+                raise lab0()
+            if not self.eq_s(u"\u0BCD"):
+                raise lab0()
+            self.ket = self.cursor
+            if not self.slice_del():
+                return False
+
+            v_3 = self.cursor
+            self.__r_fix_va_start()
+            self.cursor = v_3
+        except lab0: pass
+        self.cursor = v_2
+        v_4 = self.cursor
+        try:
+            self.B_found_a_match = False
+            self.bra = self.cursor
+            if self.find_among(TamilStemmer.a_11) == 0:
+                raise lab1()
+            if self.find_among(TamilStemmer.a_12) == 0:
+                raise lab1()
+            if not self.eq_s(u"\u0BCD"):
+                raise lab1()
+            self.ket = self.cursor
+            if not self.slice_del():
+                return False
+
+            self.B_found_a_match = True
+            v_5 = self.cursor
+            self.__r_fix_va_start()
+            self.cursor = v_5
+        except lab1: pass
+        self.cursor = v_4
+        v_6 = self.cursor
+        try:
+            if not len(self.current) > 4:
+                raise lab2()
+            self.B_found_a_match = False
+            self.limit_backward = self.cursor
+            self.cursor = self.limit
+            v_7 = self.limit - self.cursor
+            try:
+                self.ket = self.cursor
+                if self.find_among_b(TamilStemmer.a_14) == 0:
+                    raise lab3()
+                self.bra = self.cursor
+                if not self.slice_from(u"\u0BCD"):
+                    return False
+                self.B_found_a_match = True
+            except lab3: pass
+            self.cursor = self.limit - v_7
+            self.cursor = self.limit_backward
+            self.__r_fix_endings()
+        except lab2: pass
+        self.cursor = v_6
+        v_9 = self.cursor
+        try:
+            self.B_found_a_match = False
+            if not len(self.current) > 4:
+                raise lab4()
+            self.limit_backward = self.cursor
+            self.cursor = self.limit
+            self.ket = self.cursor
+            if not self.eq_s_b(u"\u0BC1\u0BAE\u0BCD"):
+                raise lab4()
+            self.bra = self.cursor
+            if not self.slice_from(u"\u0BCD"):
+                return False
+            self.B_found_a_match = True
+            self.cursor = self.limit_backward
+            v_10 = self.cursor
+            self.__r_fix_ending()
+            self.cursor = v_10
+        except lab4: pass
+        self.cursor = v_9
+        v_11 = self.cursor
+        try:
+            self.B_found_a_match = False
+            if not len(self.current) > 4:
+                raise lab5()
+            self.limit_backward = self.cursor
+            self.cursor = self.limit
+            try:
+                v_12 = self.limit - self.cursor
+                try:
+                    v_13 = self.limit - self.cursor
+                    self.ket = self.cursor
+                    try:
+                        v_14 = self.limit - self.cursor
+                        try:
+                            if not self.eq_s_b(u"\u0BC1\u0B9F\u0BA9\u0BCD"):
+                                raise lab9()
+                            raise lab8()
+                        except lab9: pass
+                        self.cursor = self.limit - v_14
+                        try:
+                            if not self.eq_s_b(u"\u0BBF\u0BB2\u0BCD\u0BB2\u0BC8"):
+                                raise lab10()
+                            raise lab8()
+                        except lab10: pass
+                        self.cursor = self.limit - v_14
+                        try:
+                            if not self.eq_s_b(u"\u0BBF\u0B9F\u0BAE\u0BCD"):
+                                raise lab11()
+                            raise lab8()
+                        except lab11: pass
+                        self.cursor = self.limit - v_14
+                        try:
+                            if not self.eq_s_b(u"\u0BBF\u0BA9\u0BCD\u0BB1\u0BBF"):
+                                raise lab12()
+                            raise lab8()
+                        except lab12: pass
+                        self.cursor = self.limit - v_14
+                        try:
+                            if not self.eq_s_b(u"\u0BBE\u0B95\u0BBF"):
+                                raise lab13()
+                            raise lab8()
+                        except lab13: pass
+                        self.cursor = self.limit - v_14
+                        try:
+                            if not self.eq_s_b(u"\u0BBE\u0B95\u0BBF\u0BAF"):
+                                raise lab14()
+                            raise lab8()
+                        except lab14: pass
+                        self.cursor = self.limit - v_14
+                        try:
+                            if not self.eq_s_b(u"\u0BC6\u0BA9\u0BCD\u0BB1\u0BC1"):
+                                raise lab15()
+                            raise lab8()
+                        except lab15: pass
+                        self.cursor = self.limit - v_14
+                        try:
+                            if not self.eq_s_b(u"\u0BC1\u0BB3\u0BCD\u0BB3"):
+                                raise lab16()
+                            raise lab8()
+                        except lab16: pass
+                        self.cursor = self.limit - v_14
+                        try:
+                            if not self.eq_s_b(u"\u0BC1\u0B9F\u0BC8\u0BAF"):
+                                raise lab17()
+                            raise lab8()
+                        except lab17: pass
+                        self.cursor = self.limit - v_14
+                        try:
+                            if not self.eq_s_b(u"\u0BC1\u0B9F\u0BC8"):
+                                raise lab18()
+                            raise lab8()
+                        except lab18: pass
+                        self.cursor = self.limit - v_14
+                        try:
+                            if not self.eq_s_b(u"\u0BC6\u0BA9\u0BC1\u0BAE\u0BCD"):
+                                raise lab19()
+                            raise lab8()
+                        except lab19: pass
+                        self.cursor = self.limit - v_14
+                        try:
+                            if not self.eq_s_b(u"\u0BB2\u0BCD\u0BB2"):
+                                raise lab20()
+                            v_15 = self.limit - self.cursor
+                            v_16 = self.limit - self.cursor
+                            try:
+                                if self.find_among_b(TamilStemmer.a_16) == 0:
+                                    raise lab21()
+                                raise lab20()
+                            except lab21: pass
+                            self.cursor = self.limit - v_16
+                            self.cursor = self.limit - v_15
+                            raise lab8()
+                        except lab20: pass
+                        self.cursor = self.limit - v_14
+                        try:
+                            if not self.eq_s_b(u"\u0BC6\u0BA9"):
+                                raise lab22()
+                            raise lab8()
+                        except lab22: pass
+                        self.cursor = self.limit - v_14
+                        if not self.eq_s_b(u"\u0BBE\u0B95\u0BBF"):
+                            raise lab7()
+                    except lab8: pass
+                    self.bra = self.cursor
+                    if not self.slice_from(u"\u0BCD"):
+                        return False
+                    self.B_found_a_match = True
+                    self.cursor = self.limit - v_13
+                    raise lab6()
+                except lab7: pass
+                self.cursor = self.limit - v_12
+                v_17 = self.limit - self.cursor
+                self.ket = self.cursor
+                if self.find_among_b(TamilStemmer.a_17) == 0:
+                    raise lab5()
+                self.bra = self.cursor
+                if not self.slice_del():
+                    return False
+
+                self.B_found_a_match = True
+                self.cursor = self.limit - v_17
+            except lab6: pass
+            self.cursor = self.limit_backward
+            self.__r_fix_endings()
+        except lab5: pass
+        self.cursor = v_11
+        v_19 = self.cursor
+        try:
+            self.B_found_a_match = False
+            self.B_found_vetrumai_urupu = False
+            if not len(self.current) > 4:
+                raise lab23()
+            self.limit_backward = self.cursor
+            self.cursor = self.limit
+            try:
+                v_20 = self.limit - self.cursor
+                try:
+                    v_21 = self.limit - self.cursor
+                    self.ket = self.cursor
+                    if not self.eq_s_b(u"\u0BA9\u0BC8"):
+                        raise lab25()
+                    self.bra = self.cursor
+                    if not self.slice_del():
+                        return False
+
+                    self.cursor = self.limit - v_21
+                    raise lab24()
+                except lab25: pass
+                self.cursor = self.limit - v_20
+                try:
+                    v_22 = self.limit - self.cursor
+                    self.ket = self.cursor
+                    try:
+                        v_23 = self.limit - self.cursor
+                        try:
+                            try:
+                                v_24 = self.limit - self.cursor
+                                try:
+                                    if not self.eq_s_b(u"\u0BBF\u0BA9\u0BC8"):
+                                        raise lab30()
+                                    raise lab29()
+                                except lab30: pass
+                                self.cursor = self.limit - v_24
+                                if not self.eq_s_b(u"\u0BC8"):
+                                    raise lab28()
+                            except lab29: pass
+                            v_25 = self.limit - self.cursor
+                            v_26 = self.limit - self.cursor
+                            try:
+                                if self.find_among_b(TamilStemmer.a_18) == 0:
+                                    raise lab31()
+                                raise lab28()
+                            except lab31: pass
+                            self.cursor = self.limit - v_26
+                            self.cursor = self.limit - v_25
+                            raise lab27()
+                        except lab28: pass
+                        self.cursor = self.limit - v_23
+                        if not self.eq_s_b(u"\u0BC8"):
+                            raise lab26()
+                        v_27 = self.limit - self.cursor
+                        if self.find_among_b(TamilStemmer.a_19) == 0:
+                            raise lab26()
+                        if not self.eq_s_b(u"\u0BCD"):
+                            raise lab26()
+                        self.cursor = self.limit - v_27
+                    except lab27: pass
+                    self.bra = self.cursor
+                    if not self.slice_from(u"\u0BCD"):
+                        return False
+                    self.cursor = self.limit - v_22
+                    raise lab24()
+                except lab26: pass
+                self.cursor = self.limit - v_20
+                try:
+                    v_28 = self.limit - self.cursor
+                    self.ket = self.cursor
+                    try:
+                        v_29 = self.limit - self.cursor
+                        try:
+                            if not self.eq_s_b(u"\u0BCA\u0B9F\u0BC1"):
+                                raise lab34()
+                            raise lab33()
+                        except lab34: pass
+                        self.cursor = self.limit - v_29
+                        try:
+                            if not self.eq_s_b(u"\u0BCB\u0B9F\u0BC1"):
+                                raise lab35()
+                            raise lab33()
+                        except lab35: pass
+                        self.cursor = self.limit - v_29
+                        try:
+                            if not self.eq_s_b(u"\u0BBF\u0BB2\u0BCD"):
+                                raise lab36()
+                            raise lab33()
+                        except lab36: pass
+                        self.cursor = self.limit - v_29
+                        try:
+                            if not self.eq_s_b(u"\u0BBF\u0BB1\u0BCD"):
+                                raise lab37()
+                            raise lab33()
+                        except lab37: pass
+                        self.cursor = self.limit - v_29
+                        try:
+                            if not self.eq_s_b(u"\u0BBF\u0BA9\u0BCD"):
+                                raise lab38()
+                            v_30 = self.limit - self.cursor
+                            v_31 = self.limit - self.cursor
+                            try:
+                                if not self.eq_s_b(u"\u0BAE"):
+                                    raise lab39()
+                                raise lab38()
+                            except lab39: pass
+                            self.cursor = self.limit - v_31
+                            self.cursor = self.limit - v_30
+                            raise lab33()
+                        except lab38: pass
+                        self.cursor = self.limit - v_29
+                        try:
+                            if not self.eq_s_b(u"\u0BBF\u0BA9\u0BCD\u0BB1\u0BC1"):
+                                raise lab40()
+                            raise lab33()
+                        except lab40: pass
+                        self.cursor = self.limit - v_29
+                        try:
+                            if not self.eq_s_b(u"\u0BBF\u0BB0\u0BC1\u0BA8\u0BCD\u0BA4\u0BC1"):
+                                raise lab41()
+                            raise lab33()
+                        except lab41: pass
+                        self.cursor = self.limit - v_29
+                        try:
+                            if not self.eq_s_b(u"\u0BB5\u0BBF\u0B9F"):
+                                raise lab42()
+                            raise lab33()
+                        except lab42: pass
+                        self.cursor = self.limit - v_29
+                        try:
+                            if not len(self.current) >= 7:
+                                raise lab43()
+                            if not self.eq_s_b(u"\u0BBF\u0B9F\u0BAE\u0BCD"):
+                                raise lab43()
+                            raise lab33()
+                        except lab43: pass
+                        self.cursor = self.limit - v_29
+                        try:
+                            if not self.eq_s_b(u"\u0BBE\u0BB2\u0BCD"):
+                                raise lab44()
+                            raise lab33()
+                        except lab44: pass
+                        self.cursor = self.limit - v_29
+                        try:
+                            if not self.eq_s_b(u"\u0BC1\u0B9F\u0BC8"):
+                                raise lab45()
+                            raise lab33()
+                        except lab45: pass
+                        self.cursor = self.limit - v_29
+                        try:
+                            if not self.eq_s_b(u"\u0BBE\u0BAE\u0BB2\u0BCD"):
+                                raise lab46()
+                            raise lab33()
+                        except lab46: pass
+                        self.cursor = self.limit - v_29
+                        try:
+                            if not self.eq_s_b(u"\u0BB2\u0BCD"):
+                                raise lab47()
+                            v_32 = self.limit - self.cursor
+                            v_33 = self.limit - self.cursor
+                            try:
+                                if self.find_among_b(TamilStemmer.a_20) == 0:
+                                    raise lab48()
+                                raise lab47()
+                            except lab48: pass
+                            self.cursor = self.limit - v_33
+                            self.cursor = self.limit - v_32
+                            raise lab33()
+                        except lab47: pass
+                        self.cursor = self.limit - v_29
+                        if not self.eq_s_b(u"\u0BC1\u0BB3\u0BCD"):
+                            raise lab32()
+                    except lab33: pass
+                    self.bra = self.cursor
+                    if not self.slice_from(u"\u0BCD"):
+                        return False
+                    self.cursor = self.limit - v_28
+                    raise lab24()
+                except lab32: pass
+                self.cursor = self.limit - v_20
+                try:
+                    v_34 = self.limit - self.cursor
+                    self.ket = self.cursor
+                    try:
+                        v_35 = self.limit - self.cursor
+                        try:
+                            if not self.eq_s_b(u"\u0B95\u0BA3\u0BCD"):
+                                raise lab51()
+                            raise lab50()
+                        except lab51: pass
+                        self.cursor = self.limit - v_35
+                        try:
+                            if not self.eq_s_b(u"\u0BAE\u0BC1\u0BA9\u0BCD"):
+                                raise lab52()
+                            raise lab50()
+                        except lab52: pass
+                        self.cursor = self.limit - v_35
+                        try:
+                            if not self.eq_s_b(u"\u0BAE\u0BC7\u0BB2\u0BCD"):
+                                raise lab53()
+                            raise lab50()
+                        except lab53: pass
+                        self.cursor = self.limit - v_35
+                        try:
+                            if not self.eq_s_b(u"\u0BAE\u0BC7\u0BB1\u0BCD"):
+                                raise lab54()
+                            raise lab50()
+                        except lab54: pass
+                        self.cursor = self.limit - v_35
+                        try:
+                            if not self.eq_s_b(u"\u0B95\u0BC0\u0BB4\u0BCD"):
+                                raise lab55()
+                            raise lab50()
+                        except lab55: pass
+                        self.cursor = self.limit - v_35
+                        try:
+                            if not self.eq_s_b(u"\u0BAA\u0BBF\u0BA9\u0BCD"):
+                                raise lab56()
+                            raise lab50()
+                        except lab56: pass
+                        self.cursor = self.limit - v_35
+                        if not self.eq_s_b(u"\u0BA4\u0BC1"):
+                            raise lab49()
+                        v_36 = self.limit - self.cursor
+                        v_37 = self.limit - self.cursor
+                        try:
+                            if self.find_among_b(TamilStemmer.a_21) == 0:
+                                raise lab57()
+                            raise lab49()
+                        except lab57: pass
+                        self.cursor = self.limit - v_37
+                        self.cursor = self.limit - v_36
+                    except lab50: pass
+                    self.bra = self.cursor
+                    if not self.slice_del():
+                        return False
+
+                    self.cursor = self.limit - v_34
+                    raise lab24()
+                except lab49: pass
+                self.cursor = self.limit - v_20
+                v_38 = self.limit - self.cursor
+                self.ket = self.cursor
+                if not self.eq_s_b(u"\u0BC0"):
+                    raise lab23()
+                self.bra = self.cursor
+                if not self.slice_from(u"\u0BBF"):
+                    return False
+                self.cursor = self.limit - v_38
+            except lab24: pass
+            self.B_found_a_match = True
+            self.B_found_vetrumai_urupu = True
+            v_39 = self.limit - self.cursor
+            try:
+                self.ket = self.cursor
+                if not self.eq_s_b(u"\u0BBF\u0BA9\u0BCD"):
+                    raise lab58()
+                self.bra = self.cursor
+                if not self.slice_from(u"\u0BCD"):
+                    return False
+            except lab58: pass
+            self.cursor = self.limit - v_39
+            self.cursor = self.limit_backward
+            self.__r_fix_endings()
+        except lab23: pass
+        self.cursor = v_19
+        v_41 = self.cursor
+        try:
+            self.B_found_a_match = False
+            self.limit_backward = self.cursor
+            self.cursor = self.limit
+            try:
+                v_42 = self.limit - self.cursor
+                try:
+                    self.ket = self.cursor
+                    if not self.eq_s_b(u"\u0BC1\u0B99\u0BCD\u0B95\u0BB3\u0BCD"):
+                        raise lab61()
+                    v_43 = self.limit - self.cursor
+                    v_44 = self.limit - self.cursor
+                    try:
+                        if self.find_among_b(TamilStemmer.a_13) == 0:
+                            raise lab62()
+                        raise lab61()
+                    except lab62: pass
+                    self.cursor = self.limit - v_44
+                    self.cursor = self.limit - v_43
+                    self.bra = self.cursor
+                    if not self.slice_from(u"\u0BCD"):
+                        return False
+                    raise lab60()
+                except lab61: pass
+                self.cursor = self.limit - v_42
+                try:
+                    self.ket = self.cursor
+                    if not self.eq_s_b(u"\u0BB1\u0BCD\u0B95\u0BB3\u0BCD"):
+                        raise lab63()
+                    self.bra = self.cursor
+                    if not self.slice_from(u"\u0BB2\u0BCD"):
+                        return False
+                    raise lab60()
+                except lab63: pass
+                self.cursor = self.limit - v_42
+                try:
+                    self.ket = self.cursor
+                    if not self.eq_s_b(u"\u0B9F\u0BCD\u0B95\u0BB3\u0BCD"):
+                        raise lab64()
+                    self.bra = self.cursor
+                    if not self.slice_from(u"\u0BB3\u0BCD"):
+                        return False
+                    raise lab60()
+                except lab64: pass
+                self.cursor = self.limit - v_42
+                self.ket = self.cursor
+                if not self.eq_s_b(u"\u0B95\u0BB3\u0BCD"):
+                    raise lab59()
+                self.bra = self.cursor
+                if not self.slice_del():
+                    return False
+
+            except lab60: pass
+            self.B_found_a_match = True
+            self.cursor = self.limit_backward
+        except lab59: pass
+        self.cursor = v_41
+        v_45 = self.cursor
+        try:
+            if not len(self.current) > 4:
+                raise lab65()
+            self.B_found_a_match = False
+            self.limit_backward = self.cursor
+            self.cursor = self.limit
+            self.ket = self.cursor
+            if self.find_among_b(TamilStemmer.a_15) == 0:
+                raise lab65()
+            self.bra = self.cursor
+            if not self.slice_del():
+                return False
+
+            self.B_found_a_match = True
+            self.cursor = self.limit_backward
+        except lab65: pass
+        self.cursor = v_45
+        v_46 = self.cursor
+        try:
+            self.B_found_a_match = True
+            while True:
+                v_47 = self.cursor
+                try:
+                    if not self.B_found_a_match:
+                        raise lab67()
+                    v_48 = self.cursor
+                    try:
+                        self.B_found_a_match = False
+                        if not len(self.current) > 4:
+                            raise lab68()
+                        self.limit_backward = self.cursor
+                        self.cursor = self.limit
+                        v_49 = self.limit - self.cursor
+                        try:
+                            try:
+                                v_50 = self.limit - self.cursor
+                                try:
+                                    v_51 = self.limit - self.cursor
+                                    self.ket = self.cursor
+                                    if self.find_among_b(TamilStemmer.a_22) == 0:
+                                        raise lab71()
+                                    self.bra = self.cursor
+                                    if not self.slice_del():
+                                        return False
+
+                                    self.B_found_a_match = True
+                                    self.cursor = self.limit - v_51
+                                    raise lab70()
+                                except lab71: pass
+                                self.cursor = self.limit - v_50
+                                try:
+                                    v_52 = self.limit - self.cursor
+                                    self.ket = self.cursor
+                                    try:
+                                        v_53 = self.limit - self.cursor
+                                        try:
+                                            if not self.eq_s_b(u"\u0BAE\u0BBE\u0BB0\u0BCD"):
+                                                raise lab74()
+                                            raise lab73()
+                                        except lab74: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BAE\u0BBF\u0BA9\u0BCD"):
+                                                raise lab75()
+                                            raise lab73()
+                                        except lab75: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BA9\u0BA9\u0BCD"):
+                                                raise lab76()
+                                            raise lab73()
+                                        except lab76: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BA9\u0BBE\u0BA9\u0BCD"):
+                                                raise lab77()
+                                            raise lab73()
+                                        except lab77: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BA9\u0BBE\u0BB3\u0BCD"):
+                                                raise lab78()
+                                            raise lab73()
+                                        except lab78: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BA9\u0BBE\u0BB0\u0BCD"):
+                                                raise lab79()
+                                            raise lab73()
+                                        except lab79: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BB5\u0BA9\u0BCD"):
+                                                raise lab80()
+                                            v_54 = self.limit - self.cursor
+                                            v_55 = self.limit - self.cursor
+                                            try:
+                                                if self.find_among_b(TamilStemmer.a_23) == 0:
+                                                    raise lab81()
+                                                raise lab80()
+                                            except lab81: pass
+                                            self.cursor = self.limit - v_55
+                                            self.cursor = self.limit - v_54
+                                            raise lab73()
+                                        except lab80: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BA9\u0BB3\u0BCD"):
+                                                raise lab82()
+                                            raise lab73()
+                                        except lab82: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BB5\u0BB3\u0BCD"):
+                                                raise lab83()
+                                            raise lab73()
+                                        except lab83: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BA9\u0BB0\u0BCD"):
+                                                raise lab84()
+                                            raise lab73()
+                                        except lab84: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BB5\u0BB0\u0BCD"):
+                                                raise lab85()
+                                            raise lab73()
+                                        except lab85: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BA9"):
+                                                raise lab86()
+                                            raise lab73()
+                                        except lab86: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BAA"):
+                                                raise lab87()
+                                            raise lab73()
+                                        except lab87: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0B95"):
+                                                raise lab88()
+                                            raise lab73()
+                                        except lab88: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BA4"):
+                                                raise lab89()
+                                            raise lab73()
+                                        except lab89: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BAF"):
+                                                raise lab90()
+                                            raise lab73()
+                                        except lab90: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BAA\u0BA9\u0BCD"):
+                                                raise lab91()
+                                            raise lab73()
+                                        except lab91: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BAA\u0BB3\u0BCD"):
+                                                raise lab92()
+                                            raise lab73()
+                                        except lab92: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BAA\u0BB0\u0BCD"):
+                                                raise lab93()
+                                            raise lab73()
+                                        except lab93: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BA4\u0BC1"):
+                                                raise lab94()
+                                            v_56 = self.limit - self.cursor
+                                            v_57 = self.limit - self.cursor
+                                            try:
+                                                if self.find_among_b(TamilStemmer.a_24) == 0:
+                                                    raise lab95()
+                                                raise lab94()
+                                            except lab95: pass
+                                            self.cursor = self.limit - v_57
+                                            self.cursor = self.limit - v_56
+                                            raise lab73()
+                                        except lab94: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BBF\u0BB1\u0BCD\u0BB1\u0BC1"):
+                                                raise lab96()
+                                            raise lab73()
+                                        except lab96: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BAA\u0BAE\u0BCD"):
+                                                raise lab97()
+                                            raise lab73()
+                                        except lab97: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BA9\u0BAE\u0BCD"):
+                                                raise lab98()
+                                            raise lab73()
+                                        except lab98: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BA4\u0BC1\u0BAE\u0BCD"):
+                                                raise lab99()
+                                            raise lab73()
+                                        except lab99: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BB1\u0BC1\u0BAE\u0BCD"):
+                                                raise lab100()
+                                            raise lab73()
+                                        except lab100: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0B95\u0BC1\u0BAE\u0BCD"):
+                                                raise lab101()
+                                            raise lab73()
+                                        except lab101: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BA9\u0BC6\u0BA9\u0BCD"):
+                                                raise lab102()
+                                            raise lab73()
+                                        except lab102: pass
+                                        self.cursor = self.limit - v_53
+                                        try:
+                                            if not self.eq_s_b(u"\u0BA9\u0BC8"):
+                                                raise lab103()
+                                            raise lab73()
+                                        except lab103: pass
+                                        self.cursor = self.limit - v_53
+                                        if not self.eq_s_b(u"\u0BB5\u0BC8"):
+                                            raise lab72()
+                                    except lab73: pass
+                                    self.bra = self.cursor
+                                    if not self.slice_del():
+                                        return False
+
+                                    self.B_found_a_match = True
+                                    self.cursor = self.limit - v_52
+                                    raise lab70()
+                                except lab72: pass
+                                self.cursor = self.limit - v_50
+                                try:
+                                    v_58 = self.limit - self.cursor
+                                    self.ket = self.cursor
+                                    try:
+                                        v_59 = self.limit - self.cursor
+                                        try:
+                                            if not self.eq_s_b(u"\u0BBE\u0BA9\u0BCD"):
+                                                raise lab106()
+                                            v_60 = self.limit - self.cursor
+                                            v_61 = self.limit - self.cursor
+                                            try:
+                                                if not self.eq_s_b(u"\u0B9A"):
+                                                    raise lab107()
+                                                raise lab106()
+                                            except lab107: pass
+                                            self.cursor = self.limit - v_61
+                                            self.cursor = self.limit - v_60
+                                            raise lab105()
+                                        except lab106: pass
+                                        self.cursor = self.limit - v_59
+                                        try:
+                                            if not self.eq_s_b(u"\u0BBE\u0BB3\u0BCD"):
+                                                raise lab108()
+                                            raise lab105()
+                                        except lab108: pass
+                                        self.cursor = self.limit - v_59
+                                        try:
+                                            if not self.eq_s_b(u"\u0BBE\u0BB0\u0BCD"):
+                                                raise lab109()
+                                            raise lab105()
+                                        except lab109: pass
+                                        self.cursor = self.limit - v_59
+                                        try:
+                                            if not self.eq_s_b(u"\u0BC7\u0BA9\u0BCD"):
+                                                raise lab110()
+                                            raise lab105()
+                                        except lab110: pass
+                                        self.cursor = self.limit - v_59
+                                        try:
+                                            if not self.eq_s_b(u"\u0BBE"):
+                                                raise lab111()
+                                            raise lab105()
+                                        except lab111: pass
+                                        self.cursor = self.limit - v_59
+                                        try:
+                                            if not self.eq_s_b(u"\u0BBE\u0BAE\u0BCD"):
+                                                raise lab112()
+                                            raise lab105()
+                                        except lab112: pass
+                                        self.cursor = self.limit - v_59
+                                        try:
+                                            if not self.eq_s_b(u"\u0BC6\u0BAE\u0BCD"):
+                                                raise lab113()
+                                            raise lab105()
+                                        except lab113: pass
+                                        self.cursor = self.limit - v_59
+                                        try:
+                                            if not self.eq_s_b(u"\u0BC7\u0BAE\u0BCD"):
+                                                raise lab114()
+                                            raise lab105()
+                                        except lab114: pass
+                                        self.cursor = self.limit - v_59
+                                        try:
+                                            if not self.eq_s_b(u"\u0BCB\u0BAE\u0BCD"):
+                                                raise lab115()
+                                            raise lab105()
+                                        except lab115: pass
+                                        self.cursor = self.limit - v_59
+                                        try:
+                                            if not self.eq_s_b(u"\u0B95\u0BC1\u0BAE\u0BCD"):
+                                                raise lab116()
+                                            raise lab105()
+                                        except lab116: pass
+                                        self.cursor = self.limit - v_59
+                                        try:
+                                            if not self.eq_s_b(u"\u0BA4\u0BC1\u0BAE\u0BCD"):
+                                                raise lab117()
+                                            raise lab105()
+                                        except lab117: pass
+                                        self.cursor = self.limit - v_59
+                                        try:
+                                            if not self.eq_s_b(u"\u0B9F\u0BC1\u0BAE\u0BCD"):
+                                                raise lab118()
+                                            raise lab105()
+                                        except lab118: pass
+                                        self.cursor = self.limit - v_59
+                                        try:
+                                            if not self.eq_s_b(u"\u0BB1\u0BC1\u0BAE\u0BCD"):
+                                                raise lab119()
+                                            raise lab105()
+                                        except lab119: pass
+                                        self.cursor = self.limit - v_59
+                                        try:
+                                            if not self.eq_s_b(u"\u0BBE\u0BAF\u0BCD"):
+                                                raise lab120()
+                                            raise lab105()
+                                        except lab120: pass
+                                        self.cursor = self.limit - v_59
+                                        try:
+                                            if not self.eq_s_b(u"\u0BA9\u0BC6\u0BA9\u0BCD"):
+                                                raise lab121()
+                                            raise lab105()
+                                        except lab121: pass
+                                        self.cursor = self.limit - v_59
+                                        try:
+                                            if not self.eq_s_b(u"\u0BA9\u0BBF\u0BB0\u0BCD"):
+                                                raise lab122()
+                                            raise lab105()
+                                        except lab122: pass
+                                        self.cursor = self.limit - v_59
+                                        try:
+                                            if not self.eq_s_b(u"\u0BC0\u0BB0\u0BCD"):
+                                                raise lab123()
+                                            raise lab105()
+                                        except lab123: pass
+                                        self.cursor = self.limit - v_59
+                                        if not self.eq_s_b(u"\u0BC0\u0BAF\u0BB0\u0BCD"):
+                                            raise lab104()
+                                    except lab105: pass
+                                    self.bra = self.cursor
+                                    if not self.slice_from(u"\u0BCD"):
+                                        return False
+                                    self.B_found_a_match = True
+                                    self.cursor = self.limit - v_58
+                                    raise lab70()
+                                except lab104: pass
+                                self.cursor = self.limit - v_50
+                                v_62 = self.limit - self.cursor
+                                self.ket = self.cursor
+                                try:
+                                    v_63 = self.limit - self.cursor
+                                    try:
+                                        if not self.eq_s_b(u"\u0B95\u0BC1"):
+                                            raise lab125()
+                                        raise lab124()
+                                    except lab125: pass
+                                    self.cursor = self.limit - v_63
+                                    if not self.eq_s_b(u"\u0BA4\u0BC1"):
+                                        raise lab69()
+                                except lab124: pass
+                                v_64 = self.limit - self.cursor
+                                if not self.eq_s_b(u"\u0BCD"):
+                                    raise lab69()
+                                self.cursor = self.limit - v_64
+                                self.bra = self.cursor
+                                if not self.slice_del():
+                                    return False
+
+                                self.B_found_a_match = True
+                                self.cursor = self.limit - v_62
+                            except lab70: pass
+                        except lab69: pass
+                        self.cursor = self.limit - v_49
+                        v_65 = self.limit - self.cursor
+                        try:
+                            self.ket = self.cursor
+                            if self.find_among_b(TamilStemmer.a_25) == 0:
+                                raise lab126()
+                            self.bra = self.cursor
+                            if not self.slice_del():
+                                return False
+
+                            self.B_found_a_match = True
+                        except lab126: pass
+                        self.cursor = self.limit - v_65
+                        self.cursor = self.limit_backward
+                        self.__r_fix_endings()
+                    except lab68: pass
+                    self.cursor = v_48
+                    continue
+                except lab67: pass
+                self.cursor = v_47
+                break
+        except lab66: pass
+        self.cursor = v_46
+        return True
+
+
+class lab0(BaseException): pass
+
+
+class lab1(BaseException): pass
+
+
+class lab2(BaseException): pass
+
+
+class lab3(BaseException): pass
+
+
+class lab4(BaseException): pass
+
+
+class lab5(BaseException): pass
+
+
+class lab6(BaseException): pass
+
+
+class lab7(BaseException): pass
+
+
+class lab8(BaseException): pass
+
+
+class lab9(BaseException): pass
+
+
+class lab10(BaseException): pass
+
+
+class lab11(BaseException): pass
+
+
+class lab12(BaseException): pass
+
+
+class lab13(BaseException): pass
+
+
+class lab14(BaseException): pass
+
+
+class lab15(BaseException): pass
+
+
+class lab16(BaseException): pass
+
+
+class lab17(BaseException): pass
+
+
+class lab18(BaseException): pass
+
+
+class lab19(BaseException): pass
+
+
+class lab20(BaseException): pass
+
+
+class lab21(BaseException): pass
+
+
+class lab22(BaseException): pass
+
+
+class lab23(BaseException): pass
+
+
+class lab24(BaseException): pass
+
+
+class lab25(BaseException): pass
+
+
+class lab26(BaseException): pass
+
+
+class lab27(BaseException): pass
+
+
+class lab28(BaseException): pass
+
+
+class lab29(BaseException): pass
+
+
+class lab30(BaseException): pass
+
+
+class lab31(BaseException): pass
+
+
+class lab32(BaseException): pass
+
+
+class lab33(BaseException): pass
+
+
+class lab34(BaseException): pass
+
+
+class lab35(BaseException): pass
+
+
+class lab36(BaseException): pass
+
+
+class lab37(BaseException): pass
+
+
+class lab38(BaseException): pass
+
+
+class lab39(BaseException): pass
+
+
+class lab40(BaseException): pass
+
+
+class lab41(BaseException): pass
+
+
+class lab42(BaseException): pass
+
+
+class lab43(BaseException): pass
+
+
+class lab44(BaseException): pass
+
+
+class lab45(BaseException): pass
+
+
+class lab46(BaseException): pass
+
+
+class lab47(BaseException): pass
+
+
+class lab48(BaseException): pass
+
+
+class lab49(BaseException): pass
+
+
+class lab50(BaseException): pass
+
+
+class lab51(BaseException): pass
+
+
+class lab52(BaseException): pass
+
+
+class lab53(BaseException): pass
+
+
+class lab54(BaseException): pass
+
+
+class lab55(BaseException): pass
+
+
+class lab56(BaseException): pass
+
+
+class lab57(BaseException): pass
+
+
+class lab58(BaseException): pass
+
+
+class lab59(BaseException): pass
+
+
+class lab60(BaseException): pass
+
+
+class lab61(BaseException): pass
+
+
+class lab62(BaseException): pass
+
+
+class lab63(BaseException): pass
+
+
+class lab64(BaseException): pass
+
+
+class lab65(BaseException): pass
+
+
+class lab66(BaseException): pass
+
+
+class lab67(BaseException): pass
+
+
+class lab68(BaseException): pass
+
+
+class lab69(BaseException): pass
+
+
+class lab70(BaseException): pass
+
+
+class lab71(BaseException): pass
+
+
+class lab72(BaseException): pass
+
+
+class lab73(BaseException): pass
+
+
+class lab74(BaseException): pass
+
+
+class lab75(BaseException): pass
+
+
+class lab76(BaseException): pass
+
+
+class lab77(BaseException): pass
+
+
+class lab78(BaseException): pass
+
+
+class lab79(BaseException): pass
+
+
+class lab80(BaseException): pass
+
+
+class lab81(BaseException): pass
+
+
+class lab82(BaseException): pass
+
+
+class lab83(BaseException): pass
+
+
+class lab84(BaseException): pass
+
+
+class lab85(BaseException): pass
+
+
+class lab86(BaseException): pass
+
+
+class lab87(BaseException): pass
+
+
+class lab88(BaseException): pass
+
+
+class lab89(BaseException): pass
+
+
+class lab90(BaseException): pass
+
+
+class lab91(BaseException): pass
+
+
+class lab92(BaseException): pass
+
+
+class lab93(BaseException): pass
+
+
+class lab94(BaseException): pass
+
+
+class lab95(BaseException): pass
+
+
+class lab96(BaseException): pass
+
+
+class lab97(BaseException): pass
+
+
+class lab98(BaseException): pass
+
+
+class lab99(BaseException): pass
+
+
+class lab100(BaseException): pass
+
+
+class lab101(BaseException): pass
+
+
+class lab102(BaseException): pass
+
+
+class lab103(BaseException): pass
+
+
+class lab104(BaseException): pass
+
+
+class lab105(BaseException): pass
+
+
+class lab106(BaseException): pass
+
+
+class lab107(BaseException): pass
+
+
+class lab108(BaseException): pass
+
+
+class lab109(BaseException): pass
+
+
+class lab110(BaseException): pass
+
+
+class lab111(BaseException): pass
+
+
+class lab112(BaseException): pass
+
+
+class lab113(BaseException): pass
+
+
+class lab114(BaseException): pass
+
+
+class lab115(BaseException): pass
+
+
+class lab116(BaseException): pass
+
+
+class lab117(BaseException): pass
+
+
+class lab118(BaseException): pass
+
+
+class lab119(BaseException): pass
+
+
+class lab120(BaseException): pass
+
+
+class lab121(BaseException): pass
+
+
+class lab122(BaseException): pass
+
+
+class lab123(BaseException): pass
+
+
+class lab124(BaseException): pass
+
+
+class lab125(BaseException): pass
+
+
+class lab126(BaseException): pass
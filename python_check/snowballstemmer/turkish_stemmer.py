@@ -0,0 +1,1866 @@
+# Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+from .basestemmer import BaseStemmer
+from .among import Among
+
+
+class TurkishStemmer(BaseStemmer):
+    '''
+    This class implements the stemming algorithm defined by a snowball script.
+    Generated by Snowball 2.2.0 - https://snowballstem.org/
+    '''
+
+    a_0 = [
+        Among(u"m", -1, -1),
+        Among(u"n", -1, -1),
+        Among(u"miz", -1, -1),
+        Among(u"niz", -1, -1),
+        Among(u"muz", -1, -1),
+        Among(u"nuz", -1, -1),
+        Among(u"m\u00FCz", -1, -1),
+        Among(u"n\u00FCz", -1, -1),
+        Among(u"m\u0131z", -1, -1),
+        Among(u"n\u0131z", -1, -1)
+    ]
+
+    a_1 = [
+        Among(u"leri", -1, -1),
+        Among(u"lar\u0131", -1, -1)
+    ]
+
+    a_2 = [
+        Among(u"ni", -1, -1),
+        Among(u"nu", -1, -1),
+        Among(u"n\u00FC", -1, -1),
+        Among(u"n\u0131", -1, -1)
+    ]
+
+    a_3 = [
+        Among(u"in", -1, -1),
+        Among(u"un", -1, -1),
+        Among(u"\u00FCn", -1, -1),
+        Among(u"\u0131n", -1, -1)
+    ]
+
+    a_4 = [
+        Among(u"a", -1, -1),
+        Among(u"e", -1, -1)
+    ]
+
+    a_5 = [
+        Among(u"na", -1, -1),
+        Among(u"ne", -1, -1)
+    ]
+
+    a_6 = [
+        Among(u"da", -1, -1),
+        Among(u"ta", -1, -1),
+        Among(u"de", -1, -1),
+        Among(u"te", -1, -1)
+    ]
+
+    a_7 = [
+        Among(u"nda", -1, -1),
+        Among(u"nde", -1, -1)
+    ]
+
+    a_8 = [
+        Among(u"dan", -1, -1),
+        Among(u"tan", -1, -1),
+        Among(u"den", -1, -1),
+        Among(u"ten", -1, -1)
+    ]
+
+    a_9 = [
+        Among(u"ndan", -1, -1),
+        Among(u"nden", -1, -1)
+    ]
+
+    a_10 = [
+        Among(u"la", -1, -1),
+        Among(u"le", -1, -1)
+    ]
+
+    a_11 = [
+        Among(u"ca", -1, -1),
+        Among(u"ce", -1, -1)
+    ]
+
+    a_12 = [
+        Among(u"im", -1, -1),
+        Among(u"um", -1, -1),
+        Among(u"\u00FCm", -1, -1),
+        Among(u"\u0131m", -1, -1)
+    ]
+
+    a_13 = [
+        Among(u"sin", -1, -1),
+        Among(u"sun", -1, -1),
+        Among(u"s\u00FCn", -1, -1),
+        Among(u"s\u0131n", -1, -1)
+    ]
+
+    a_14 = [
+        Among(u"iz", -1, -1),
+        Among(u"uz", -1, -1),
+        Among(u"\u00FCz", -1, -1),
+        Among(u"\u0131z", -1, -1)
+    ]
+
+    a_15 = [
+        Among(u"siniz", -1, -1),
+        Among(u"sunuz", -1, -1),
+        Among(u"s\u00FCn\u00FCz", -1, -1),
+        Among(u"s\u0131n\u0131z", -1, -1)
+    ]
+
+    a_16 = [
+        Among(u"lar", -1, -1),
+        Among(u"ler", -1, -1)
+    ]
+
+    a_17 = [
+        Among(u"niz", -1, -1),
+        Among(u"nuz", -1, -1),
+        Among(u"n\u00FCz", -1, -1),
+        Among(u"n\u0131z", -1, -1)
+    ]
+
+    a_18 = [
+        Among(u"dir", -1, -1),
+        Among(u"tir", -1, -1),
+        Among(u"dur", -1, -1),
+        Among(u"tur", -1, -1),
+        Among(u"d\u00FCr", -1, -1),
+        Among(u"t\u00FCr", -1, -1),
+        Among(u"d\u0131r", -1, -1),
+        Among(u"t\u0131r", -1, -1)
+    ]
+
+    a_19 = [
+        Among(u"cas\u0131na", -1, -1),
+        Among(u"cesine", -1, -1)
+    ]
+
+    a_20 = [
+        Among(u"di", -1, -1),
+        Among(u"ti", -1, -1),
+        Among(u"dik", -1, -1),
+        Among(u"tik", -1, -1),
+        Among(u"duk", -1, -1),
+        Among(u"tuk", -1, -1),
+        Among(u"d\u00FCk", -1, -1),
+        Among(u"t\u00FCk", -1, -1),
+        Among(u"d\u0131k", -1, -1),
+        Among(u"t\u0131k", -1, -1),
+        Among(u"dim", -1, -1),
+        Among(u"tim", -1, -1),
+        Among(u"dum", -1, -1),
+        Among(u"tum", -1, -1),
+        Among(u"d\u00FCm", -1, -1),
+        Among(u"t\u00FCm", -1, -1),
+        Among(u"d\u0131m", -1, -1),
+        Among(u"t\u0131m", -1, -1),
+        Among(u"din", -1, -1),
+        Among(u"tin", -1, -1),
+        Among(u"dun", -1, -1),
+        Among(u"tun", -1, -1),
+        Among(u"d\u00FCn", -1, -1),
+        Among(u"t\u00FCn", -1, -1),
+        Among(u"d\u0131n", -1, -1),
+        Among(u"t\u0131n", -1, -1),
+        Among(u"du", -1, -1),
+        Among(u"tu", -1, -1),
+        Among(u"d\u00FC", -1, -1),
+        Among(u"t\u00FC", -1, -1),
+        Among(u"d\u0131", -1, -1),
+        Among(u"t\u0131", -1, -1)
+    ]
+
+    a_21 = [
+        Among(u"sa", -1, -1),
+        Among(u"se", -1, -1),
+        Among(u"sak", -1, -1),
+        Among(u"sek", -1, -1),
+        Among(u"sam", -1, -1),
+        Among(u"sem", -1, -1),
+        Among(u"san", -1, -1),
+        Among(u"sen", -1, -1)
+    ]
+
+    a_22 = [
+        Among(u"mi\u015F", -1, -1),
+        Among(u"mu\u015F", -1, -1),
+        Among(u"m\u00FC\u015F", -1, -1),
+        Among(u"m\u0131\u015F", -1, -1)
+    ]
+
+    a_23 = [
+        Among(u"b", -1, 1),
+        Among(u"c", -1, 2),
+        Among(u"d", -1, 3),
+        Among(u"\u011F", -1, 4)
+    ]
+
+    g_vowel = [17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 8, 0, 0, 0, 0, 0, 0, 1]
+
+    g_U = [1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 1]
+
+    g_vowel1 = [1, 64, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1]
+
+    g_vowel2 = [17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130]
+
+    g_vowel3 = [1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1]
+
+    g_vowel4 = [17]
+
+    g_vowel5 = [65]
+
+    g_vowel6 = [65]
+
+    B_continue_stemming_noun_suffixes = False
+
+    def __r_check_vowel_harmony(self):
+        v_1 = self.limit - self.cursor
+        if not self.go_out_grouping_b(TurkishStemmer.g_vowel, 97, 305):
+            return False
+        try:
+            v_2 = self.limit - self.cursor
+            try:
+                if not self.eq_s_b(u"a"):
+                    raise lab1()
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel1, 97, 305):
+                    raise lab1()
+                raise lab0()
+            except lab1: pass
+            self.cursor = self.limit - v_2
+            try:
+                if not self.eq_s_b(u"e"):
+                    raise lab2()
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel2, 101, 252):
+                    raise lab2()
+                raise lab0()
+            except lab2: pass
+            self.cursor = self.limit - v_2
+            try:
+                if not self.eq_s_b(u"\u0131"):
+                    raise lab3()
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel3, 97, 305):
+                    raise lab3()
+                raise lab0()
+            except lab3: pass
+            self.cursor = self.limit - v_2
+            try:
+                if not self.eq_s_b(u"i"):
+                    raise lab4()
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel4, 101, 105):
+                    raise lab4()
+                raise lab0()
+            except lab4: pass
+            self.cursor = self.limit - v_2
+            try:
+                if not self.eq_s_b(u"o"):
+                    raise lab5()
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel5, 111, 117):
+                    raise lab5()
+                raise lab0()
+            except lab5: pass
+            self.cursor = self.limit - v_2
+            try:
+                if not self.eq_s_b(u"\u00F6"):
+                    raise lab6()
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel6, 246, 252):
+                    raise lab6()
+                raise lab0()
+            except lab6: pass
+            self.cursor = self.limit - v_2
+            try:
+                if not self.eq_s_b(u"u"):
+                    raise lab7()
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel5, 111, 117):
+                    raise lab7()
+                raise lab0()
+            except lab7: pass
+            self.cursor = self.limit - v_2
+            if not self.eq_s_b(u"\u00FC"):
+                return False
+            if not self.go_out_grouping_b(TurkishStemmer.g_vowel6, 246, 252):
+                return False
+        except lab0: pass
+        self.cursor = self.limit - v_1
+        return True
+
+    def __r_mark_suffix_with_optional_n_consonant(self):
+        try:
+            v_1 = self.limit - self.cursor
+            try:
+                if not self.eq_s_b(u"n"):
+                    raise lab1()
+                v_2 = self.limit - self.cursor
+                if not self.in_grouping_b(TurkishStemmer.g_vowel, 97, 305):
+                    raise lab1()
+                self.cursor = self.limit - v_2
+                raise lab0()
+            except lab1: pass
+            self.cursor = self.limit - v_1
+            v_3 = self.limit - self.cursor
+            try:
+                v_4 = self.limit - self.cursor
+                if not self.eq_s_b(u"n"):
+                    raise lab2()
+                self.cursor = self.limit - v_4
+                return False
+            except lab2: pass
+            self.cursor = self.limit - v_3
+            v_5 = self.limit - self.cursor
+            if self.cursor <= self.limit_backward:
+                return False
+            self.cursor -= 1
+            if not self.in_grouping_b(TurkishStemmer.g_vowel, 97, 305):
+                return False
+            self.cursor = self.limit - v_5
+        except lab0: pass
+        return True
+
+    def __r_mark_suffix_with_optional_y_consonant(self):
+        try:
+            v_1 = self.limit - self.cursor
+            try:
+                if not self.eq_s_b(u"y"):
+                    raise lab1()
+                v_2 = self.limit - self.cursor
+                if not self.in_grouping_b(TurkishStemmer.g_vowel, 97, 305):
+                    raise lab1()
+                self.cursor = self.limit - v_2
+                raise lab0()
+            except lab1: pass
+            self.cursor = self.limit - v_1
+            v_3 = self.limit - self.cursor
+            try:
+                v_4 = self.limit - self.cursor
+                if not self.eq_s_b(u"y"):
+                    raise lab2()
+                self.cursor = self.limit - v_4
+                return False
+            except lab2: pass
+            self.cursor = self.limit - v_3
+            v_5 = self.limit - self.cursor
+            if self.cursor <= self.limit_backward:
+                return False
+            self.cursor -= 1
+            if not self.in_grouping_b(TurkishStemmer.g_vowel, 97, 305):
+                return False
+            self.cursor = self.limit - v_5
+        except lab0: pass
+        return True
+
+    def __r_mark_possessives(self):
+        if self.find_among_b(TurkishStemmer.a_0) == 0:
+            return False
+        try:
+            v_1 = self.limit - self.cursor
+            try:
+                if not self.in_grouping_b(TurkishStemmer.g_U, 105, 305):
+                    raise lab1()
+                v_2 = self.limit - self.cursor
+                if not self.out_grouping_b(TurkishStemmer.g_vowel, 97, 305):
+                    raise lab1()
+                self.cursor = self.limit - v_2
+                raise lab0()
+            except lab1: pass
+            self.cursor = self.limit - v_1
+            v_3 = self.limit - self.cursor
+            try:
+                v_4 = self.limit - self.cursor
+                if not self.in_grouping_b(TurkishStemmer.g_U, 105, 305):
+                    raise lab2()
+                self.cursor = self.limit - v_4
+                return False
+            except lab2: pass
+            self.cursor = self.limit - v_3
+            v_5 = self.limit - self.cursor
+            if self.cursor <= self.limit_backward:
+                return False
+            self.cursor -= 1
+            if not self.out_grouping_b(TurkishStemmer.g_vowel, 97, 305):
+                return False
+            self.cursor = self.limit - v_5
+        except lab0: pass
+        return True
+
+    def __r_mark_sU(self):
+        if not self.__r_check_vowel_harmony():
+            return False
+        if not self.in_grouping_b(TurkishStemmer.g_U, 105, 305):
+            return False
+        try:
+            v_1 = self.limit - self.cursor
+            try:
+                if not self.eq_s_b(u"s"):
+                    raise lab1()
+                v_2 = self.limit - self.cursor
+                if not self.in_grouping_b(TurkishStemmer.g_vowel, 97, 305):
+                    raise lab1()
+                self.cursor = self.limit - v_2
+                raise lab0()
+            except lab1: pass
+            self.cursor = self.limit - v_1
+            v_3 = self.limit - self.cursor
+            try:
+                v_4 = self.limit - self.cursor
+                if not self.eq_s_b(u"s"):
+                    raise lab2()
+                self.cursor = self.limit - v_4
+                return False
+            except lab2: pass
+            self.cursor = self.limit - v_3
+            v_5 = self.limit - self.cursor
+            if self.cursor <= self.limit_backward:
+                return False
+            self.cursor -= 1
+            if not self.in_grouping_b(TurkishStemmer.g_vowel, 97, 305):
+                return False
+            self.cursor = self.limit - v_5
+        except lab0: pass
+        return True
+
+    def __r_mark_lArI(self):
+        if self.find_among_b(TurkishStemmer.a_1) == 0:
+            return False
+        return True
+
+    def __r_mark_nUn(self):
+        if not self.__r_check_vowel_harmony():
+            return False
+        if self.find_among_b(TurkishStemmer.a_3) == 0:
+            return False
+        if not self.__r_mark_suffix_with_optional_n_consonant():
+            return False
+        return True
+
+    def __r_mark_DA(self):
+        if not self.__r_check_vowel_harmony():
+            return False
+        if self.find_among_b(TurkishStemmer.a_6) == 0:
+            return False
+        return True
+
+    def __r_mark_ndA(self):
+        if not self.__r_check_vowel_harmony():
+            return False
+        if self.find_among_b(TurkishStemmer.a_7) == 0:
+            return False
+        return True
+
+    def __r_mark_yUm(self):
+        if not self.__r_check_vowel_harmony():
+            return False
+        if self.find_among_b(TurkishStemmer.a_12) == 0:
+            return False
+        if not self.__r_mark_suffix_with_optional_y_consonant():
+            return False
+        return True
+
+    def __r_mark_sUn(self):
+        if not self.__r_check_vowel_harmony():
+            return False
+        if self.find_among_b(TurkishStemmer.a_13) == 0:
+            return False
+        return True
+
+    def __r_mark_yUz(self):
+        if not self.__r_check_vowel_harmony():
+            return False
+        if self.find_among_b(TurkishStemmer.a_14) == 0:
+            return False
+        if not self.__r_mark_suffix_with_optional_y_consonant():
+            return False
+        return True
+
+    def __r_mark_sUnUz(self):
+        if self.find_among_b(TurkishStemmer.a_15) == 0:
+            return False
+        return True
+
+    def __r_mark_lAr(self):
+        if not self.__r_check_vowel_harmony():
+            return False
+        if self.find_among_b(TurkishStemmer.a_16) == 0:
+            return False
+        return True
+
+    def __r_mark_DUr(self):
+        if not self.__r_check_vowel_harmony():
+            return False
+        if self.find_among_b(TurkishStemmer.a_18) == 0:
+            return False
+        return True
+
+    def __r_mark_yDU(self):
+        if not self.__r_check_vowel_harmony():
+            return False
+        if self.find_among_b(TurkishStemmer.a_20) == 0:
+            return False
+        if not self.__r_mark_suffix_with_optional_y_consonant():
+            return False
+        return True
+
+    def __r_mark_ysA(self):
+        if self.find_among_b(TurkishStemmer.a_21) == 0:
+            return False
+        if not self.__r_mark_suffix_with_optional_y_consonant():
+            return False
+        return True
+
+    def __r_mark_ymUs_(self):
+        if not self.__r_check_vowel_harmony():
+            return False
+        if self.find_among_b(TurkishStemmer.a_22) == 0:
+            return False
+        if not self.__r_mark_suffix_with_optional_y_consonant():
+            return False
+        return True
+
+    def __r_stem_suffix_chain_before_ki(self):
+        self.ket = self.cursor
+        if not self.eq_s_b(u"ki"):
+            return False
+        try:
+            v_1 = self.limit - self.cursor
+            try:
+                if not self.__r_mark_DA():
+                    raise lab1()
+                self.bra = self.cursor
+                if not self.slice_del():
+                    return False
+
+                v_2 = self.limit - self.cursor
+                try:
+                    self.ket = self.cursor
+                    try:
+                        v_3 = self.limit - self.cursor
+                        try:
+                            if not self.__r_mark_lAr():
+                                raise lab4()
+                            self.bra = self.cursor
+                            if not self.slice_del():
+                                return False
+
+                            v_4 = self.limit - self.cursor
+                            try:
+                                if not self.__r_stem_suffix_chain_before_ki():
+                                    self.cursor = self.limit - v_4
+                                    raise lab5()
+                            except lab5: pass
+                            raise lab3()
+                        except lab4: pass
+                        self.cursor = self.limit - v_3
+                        if not self.__r_mark_possessives():
+                            self.cursor = self.limit - v_2
+                            raise lab2()
+                        self.bra = self.cursor
+                        if not self.slice_del():
+                            return False
+
+                        v_5 = self.limit - self.cursor
+                        try:
+                            self.ket = self.cursor
+                            if not self.__r_mark_lAr():
+                                self.cursor = self.limit - v_5
+                                raise lab6()
+                            self.bra = self.cursor
+                            if not self.slice_del():
+                                return False
+
+                            if not self.__r_stem_suffix_chain_before_ki():
+                                self.cursor = self.limit - v_5
+                                raise lab6()
+                        except lab6: pass
+                    except lab3: pass
+                except lab2: pass
+                raise lab0()
+            except lab1: pass
+            self.cursor = self.limit - v_1
+            try:
+                if not self.__r_mark_nUn():
+                    raise lab7()
+                self.bra = self.cursor
+                if not self.slice_del():
+                    return False
+
+                v_6 = self.limit - self.cursor
+                try:
+                    self.ket = self.cursor
+                    try:
+                        v_7 = self.limit - self.cursor
+                        try:
+                            if not self.__r_mark_lArI():
+                                raise lab10()
+                            self.bra = self.cursor
+                            if not self.slice_del():
+                                return False
+
+                            raise lab9()
+                        except lab10: pass
+                        self.cursor = self.limit - v_7
+                        try:
+                            self.ket = self.cursor
+                            try:
+                                v_8 = self.limit - self.cursor
+                                try:
+                                    if not self.__r_mark_possessives():
+                                        raise lab13()
+                                    raise lab12()
+                                except lab13: pass
+                                self.cursor = self.limit - v_8
+                                if not self.__r_mark_sU():
+                                    raise lab11()
+                            except lab12: pass
+                            self.bra = self.cursor
+                            if not self.slice_del():
+                                return False
+
+                            v_9 = self.limit - self.cursor
+                            try:
+                                self.ket = self.cursor
+                                if not self.__r_mark_lAr():
+                                    self.cursor = self.limit - v_9
+                                    raise lab14()
+                                self.bra = self.cursor
+                                if not self.slice_del():
+                                    return False
+
+                                if not self.__r_stem_suffix_chain_before_ki():
+                                    self.cursor = self.limit - v_9
+                                    raise lab14()
+                            except lab14: pass
+                            raise lab9()
+                        except lab11: pass
+                        self.cursor = self.limit - v_7
+                        if not self.__r_stem_suffix_chain_before_ki():
+                            self.cursor = self.limit - v_6
+                            raise lab8()
+                    except lab9: pass
+                except lab8: pass
+                raise lab0()
+            except lab7: pass
+            self.cursor = self.limit - v_1
+            if not self.__r_mark_ndA():
+                return False
+            try:
+                v_10 = self.limit - self.cursor
+                try:
+                    if not self.__r_mark_lArI():
+                        raise lab16()
+                    self.bra = self.cursor
+                    if not self.slice_del():
+                        return False
+
+                    raise lab15()
+                except lab16: pass
+                self.cursor = self.limit - v_10
+                try:
+                    if not self.__r_mark_sU():
+                        raise lab17()
+                    self.bra = self.cursor
+                    if not self.slice_del():
+                        return False
+
+                    v_11 = self.limit - self.cursor
+                    try:
+                        self.ket = self.cursor
+                        if not self.__r_mark_lAr():
+                            self.cursor = self.limit - v_11
+                            raise lab18()
+                        self.bra = self.cursor
+                        if not self.slice_del():
+                            return False
+
+                        if not self.__r_stem_suffix_chain_before_ki():
+                            self.cursor = self.limit - v_11
+                            raise lab18()
+                    except lab18: pass
+                    raise lab15()
+                except lab17: pass
+                self.cursor = self.limit - v_10
+                if not self.__r_stem_suffix_chain_before_ki():
+                    return False
+            except lab15: pass
+        except lab0: pass
+        return True
+
+    def _stem(self):
+        v_1 = self.cursor
+        for v_2 in range (2, 0, -1):
+
+            if not self.go_out_grouping(TurkishStemmer.g_vowel, 97, 305):
+                return False
+            self.cursor += 1
+        self.cursor = v_1
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        v_3 = self.limit - self.cursor
+        try:
+            self.ket = self.cursor
+            self.B_continue_stemming_noun_suffixes = True
+            try:
+                v_4 = self.limit - self.cursor
+                try:
+                    try:
+                        v_5 = self.limit - self.cursor
+                        try:
+                            if not self.__r_mark_ymUs_():
+                                raise lab4()
+                            raise lab3()
+                        except lab4: pass
+                        self.cursor = self.limit - v_5
+                        try:
+                            if not self.__r_mark_yDU():
+                                raise lab5()
+                            raise lab3()
+                        except lab5: pass
+                        self.cursor = self.limit - v_5
+                        try:
+                            if not self.__r_mark_ysA():
+                                raise lab6()
+                            raise lab3()
+                        except lab6: pass
+                        self.cursor = self.limit - v_5
+                        if not self.eq_s_b(u"ken"):
+                            raise lab2()
+                        if not self.__r_mark_suffix_with_optional_y_consonant():
+                            raise lab2()
+                    except lab3: pass
+                    raise lab1()
+                except lab2: pass
+                self.cursor = self.limit - v_4
+                try:
+                    if self.find_among_b(TurkishStemmer.a_19) == 0:
+                        raise lab7()
+                    try:
+                        v_6 = self.limit - self.cursor
+                        try:
+                            if not self.__r_mark_sUnUz():
+                                raise lab9()
+                            raise lab8()
+                        except lab9: pass
+                        self.cursor = self.limit - v_6
+                        try:
+                            if not self.__r_mark_lAr():
+                                raise lab10()
+                            raise lab8()
+                        except lab10: pass
+                        self.cursor = self.limit - v_6
+                        try:
+                            if not self.__r_mark_yUm():
+                                raise lab11()
+                            raise lab8()
+                        except lab11: pass
+                        self.cursor = self.limit - v_6
+                        try:
+                            if not self.__r_mark_sUn():
+                                raise lab12()
+                            raise lab8()
+                        except lab12: pass
+                        self.cursor = self.limit - v_6
+                        try:
+                            if not self.__r_mark_yUz():
+                                raise lab13()
+                            raise lab8()
+                        except lab13: pass
+                        self.cursor = self.limit - v_6
+                    except lab8: pass
+                    if not self.__r_mark_ymUs_():
+                        raise lab7()
+                    raise lab1()
+                except lab7: pass
+                self.cursor = self.limit - v_4
+                try:
+                    if not self.__r_mark_lAr():
+                        raise lab14()
+                    self.bra = self.cursor
+                    if not self.slice_del():
+                        return False
+
+                    v_7 = self.limit - self.cursor
+                    try:
+                        self.ket = self.cursor
+                        try:
+                            v_8 = self.limit - self.cursor
+                            try:
+                                if not self.__r_mark_DUr():
+                                    raise lab17()
+                                raise lab16()
+                            except lab17: pass
+                            self.cursor = self.limit - v_8
+                            try:
+                                if not self.__r_mark_yDU():
+                                    raise lab18()
+                                raise lab16()
+                            except lab18: pass
+                            self.cursor = self.limit - v_8
+                            try:
+                                if not self.__r_mark_ysA():
+                                    raise lab19()
+                                raise lab16()
+                            except lab19: pass
+                            self.cursor = self.limit - v_8
+                            if not self.__r_mark_ymUs_():
+                                self.cursor = self.limit - v_7
+                                raise lab15()
+                        except lab16: pass
+                    except lab15: pass
+                    self.B_continue_stemming_noun_suffixes = False
+                    raise lab1()
+                except lab14: pass
+                self.cursor = self.limit - v_4
+                try:
+                    if not self.__r_check_vowel_harmony():
+                        raise lab20()
+                    if self.find_among_b(TurkishStemmer.a_17) == 0:
+                        raise lab20()
+                    try:
+                        v_9 = self.limit - self.cursor
+                        try:
+                            if not self.__r_mark_yDU():
+                                raise lab22()
+                            raise lab21()
+                        except lab22: pass
+                        self.cursor = self.limit - v_9
+                        if not self.__r_mark_ysA():
+                            raise lab20()
+                    except lab21: pass
+                    raise lab1()
+                except lab20: pass
+                self.cursor = self.limit - v_4
+                try:
+                    try:
+                        v_10 = self.limit - self.cursor
+                        try:
+                            if not self.__r_mark_sUnUz():
+                                raise lab25()
+                            raise lab24()
+                        except lab25: pass
+                        self.cursor = self.limit - v_10
+                        try:
+                            if not self.__r_mark_yUz():
+                                raise lab26()
+                            raise lab24()
+                        except lab26: pass
+                        self.cursor = self.limit - v_10
+                        try:
+                            if not self.__r_mark_sUn():
+                                raise lab27()
+                            raise lab24()
+                        except lab27: pass
+                        self.cursor = self.limit - v_10
+                        if not self.__r_mark_yUm():
+                            raise lab23()
+                    except lab24: pass
+                    self.bra = self.cursor
+                    if not self.slice_del():
+                        return False
+
+                    v_11 = self.limit - self.cursor
+                    try:
+                        self.ket = self.cursor
+                        if not self.__r_mark_ymUs_():
+                            self.cursor = self.limit - v_11
+                            raise lab28()
+                    except lab28: pass
+                    raise lab1()
+                except lab23: pass
+                self.cursor = self.limit - v_4
+                if not self.__r_mark_DUr():
+                    raise lab0()
+                self.bra = self.cursor
+                if not self.slice_del():
+                    return False
+
+                v_12 = self.limit - self.cursor
+                try:
+                    self.ket = self.cursor
+                    try:
+                        v_13 = self.limit - self.cursor
+                        try:
+                            if not self.__r_mark_sUnUz():
+                                raise lab31()
+                            raise lab30()
+                        except lab31: pass
+                        self.cursor = self.limit - v_13
+                        try:
+                            if not self.__r_mark_lAr():
+                                raise lab32()
+                            raise lab30()
+                        except lab32: pass
+                        self.cursor = self.limit - v_13
+                        try:
+                            if not self.__r_mark_yUm():
+                                raise lab33()
+                            raise lab30()
+                        except lab33: pass
+                        self.cursor = self.limit - v_13
+                        try:
+                            if not self.__r_mark_sUn():
+                                raise lab34()
+                            raise lab30()
+                        except lab34: pass
+                        self.cursor = self.limit - v_13
+                        try:
+                            if not self.__r_mark_yUz():
+                                raise lab35()
+                            raise lab30()
+                        except lab35: pass
+                        self.cursor = self.limit - v_13
+                    except lab30: pass
+                    if not self.__r_mark_ymUs_():
+                        self.cursor = self.limit - v_12
+                        raise lab29()
+                except lab29: pass
+            except lab1: pass
+            self.bra = self.cursor
+            if not self.slice_del():
+                return False
+
+        except lab0: pass
+        self.cursor = self.limit - v_3
+        if not self.B_continue_stemming_noun_suffixes:
+            return False
+        v_14 = self.limit - self.cursor
+        try:
+            try:
+                v_15 = self.limit - self.cursor
+                try:
+                    self.ket = self.cursor
+                    if not self.__r_mark_lAr():
+                        raise lab38()
+                    self.bra = self.cursor
+                    if not self.slice_del():
+                        return False
+
+                    v_16 = self.limit - self.cursor
+                    try:
+                        if not self.__r_stem_suffix_chain_before_ki():
+                            self.cursor = self.limit - v_16
+                            raise lab39()
+                    except lab39: pass
+                    raise lab37()
+                except lab38: pass
+                self.cursor = self.limit - v_15
+                try:
+                    self.ket = self.cursor
+                    if not self.__r_check_vowel_harmony():
+                        raise lab40()
+                    if self.find_among_b(TurkishStemmer.a_11) == 0:
+                        raise lab40()
+                    if not self.__r_mark_suffix_with_optional_n_consonant():
+                        raise lab40()
+                    self.bra = self.cursor
+                    if not self.slice_del():
+                        return False
+
+                    v_17 = self.limit - self.cursor
+                    try:
+                        try:
+                            v_18 = self.limit - self.cursor
+                            try:
+                                self.ket = self.cursor
+                                if not self.__r_mark_lArI():
+                                    raise lab43()
+                                self.bra = self.cursor
+                                if not self.slice_del():
+                                    return False
+
+                                raise lab42()
+                            except lab43: pass
+                            self.cursor = self.limit - v_18
+                            try:
+                                self.ket = self.cursor
+                                try:
+                                    v_19 = self.limit - self.cursor
+                                    try:
+                                        if not self.__r_mark_possessives():
+                                            raise lab46()
+                                        raise lab45()
+                                    except lab46: pass
+                                    self.cursor = self.limit - v_19
+                                    if not self.__r_mark_sU():
+                                        raise lab44()
+                                except lab45: pass
+                                self.bra = self.cursor
+                                if not self.slice_del():
+                                    return False
+
+                                v_20 = self.limit - self.cursor
+                                try:
+                                    self.ket = self.cursor
+                                    if not self.__r_mark_lAr():
+                                        self.cursor = self.limit - v_20
+                                        raise lab47()
+                                    self.bra = self.cursor
+                                    if not self.slice_del():
+                                        return False
+
+                                    if not self.__r_stem_suffix_chain_before_ki():
+                                        self.cursor = self.limit - v_20
+                                        raise lab47()
+                                except lab47: pass
+                                raise lab42()
+                            except lab44: pass
+                            self.cursor = self.limit - v_18
+                            self.ket = self.cursor
+                            if not self.__r_mark_lAr():
+                                self.cursor = self.limit - v_17
+                                raise lab41()
+                            self.bra = self.cursor
+                            if not self.slice_del():
+                                return False
+
+                            if not self.__r_stem_suffix_chain_before_ki():
+                                self.cursor = self.limit - v_17
+                                raise lab41()
+                        except lab42: pass
+                    except lab41: pass
+                    raise lab37()
+                except lab40: pass
+                self.cursor = self.limit - v_15
+                try:
+                    self.ket = self.cursor
+                    try:
+                        v_21 = self.limit - self.cursor
+                        try:
+                            if not self.__r_mark_ndA():
+                                raise lab50()
+                            raise lab49()
+                        except lab50: pass
+                        self.cursor = self.limit - v_21
+                        if not self.__r_check_vowel_harmony():
+                            raise lab48()
+                        if self.find_among_b(TurkishStemmer.a_5) == 0:
+                            raise lab48()
+                    except lab49: pass
+                    try:
+                        v_22 = self.limit - self.cursor
+                        try:
+                            if not self.__r_mark_lArI():
+                                raise lab52()
+                            self.bra = self.cursor
+                            if not self.slice_del():
+                                return False
+
+                            raise lab51()
+                        except lab52: pass
+                        self.cursor = self.limit - v_22
+                        try:
+                            if not self.__r_mark_sU():
+                                raise lab53()
+                            self.bra = self.cursor
+                            if not self.slice_del():
+                                return False
+
+                            v_23 = self.limit - self.cursor
+                            try:
+                                self.ket = self.cursor
+                                if not self.__r_mark_lAr():
+                                    self.cursor = self.limit - v_23
+                                    raise lab54()
+                                self.bra = self.cursor
+                                if not self.slice_del():
+                                    return False
+
+                                if not self.__r_stem_suffix_chain_before_ki():
+                                    self.cursor = self.limit - v_23
+                                    raise lab54()
+                            except lab54: pass
+                            raise lab51()
+                        except lab53: pass
+                        self.cursor = self.limit - v_22
+                        if not self.__r_stem_suffix_chain_before_ki():
+                            raise lab48()
+                    except lab51: pass
+                    raise lab37()
+                except lab48: pass
+                self.cursor = self.limit - v_15
+                try:
+                    self.ket = self.cursor
+                    try:
+                        v_24 = self.limit - self.cursor
+                        try:
+                            if not self.__r_check_vowel_harmony():
+                                raise lab57()
+                            if self.find_among_b(TurkishStemmer.a_9) == 0:
+                                raise lab57()
+                            raise lab56()
+                        except lab57: pass
+                        self.cursor = self.limit - v_24
+                        if not self.__r_check_vowel_harmony():
+                            raise lab55()
+                        if self.find_among_b(TurkishStemmer.a_2) == 0:
+                            raise lab55()
+                    except lab56: pass
+                    try:
+                        v_25 = self.limit - self.cursor
+                        try:
+                            if not self.__r_mark_sU():
+                                raise lab59()
+                            self.bra = self.cursor
+                            if not self.slice_del():
+                                return False
+
+                            v_26 = self.limit - self.cursor
+                            try:
+                                self.ket = self.cursor
+                                if not self.__r_mark_lAr():
+                                    self.cursor = self.limit - v_26
+                                    raise lab60()
+                                self.bra = self.cursor
+                                if not self.slice_del():
+                                    return False
+
+                                if not self.__r_stem_suffix_chain_before_ki():
+                                    self.cursor = self.limit - v_26
+                                    raise lab60()
+                            except lab60: pass
+                            raise lab58()
+                        except lab59: pass
+                        self.cursor = self.limit - v_25
+                        if not self.__r_mark_lArI():
+                            raise lab55()
+                    except lab58: pass
+                    raise lab37()
+                except lab55: pass
+                self.cursor = self.limit - v_15
+                try:
+                    self.ket = self.cursor
+                    if not self.__r_check_vowel_harmony():
+                        raise lab61()
+                    if self.find_among_b(TurkishStemmer.a_8) == 0:
+                        raise lab61()
+                    self.bra = self.cursor
+                    if not self.slice_del():
+                        return False
+
+                    v_27 = self.limit - self.cursor
+                    try:
+                        self.ket = self.cursor
+                        try:
+                            v_28 = self.limit - self.cursor
+                            try:
+                                if not self.__r_mark_possessives():
+                                    raise lab64()
+                                self.bra = self.cursor
+                                if not self.slice_del():
+                                    return False
+
+                                v_29 = self.limit - self.cursor
+                                try:
+                                    self.ket = self.cursor
+                                    if not self.__r_mark_lAr():
+                                        self.cursor = self.limit - v_29
+                                        raise lab65()
+                                    self.bra = self.cursor
+                                    if not self.slice_del():
+                                        return False
+
+                                    if not self.__r_stem_suffix_chain_before_ki():
+                                        self.cursor = self.limit - v_29
+                                        raise lab65()
+                                except lab65: pass
+                                raise lab63()
+                            except lab64: pass
+                            self.cursor = self.limit - v_28
+                            try:
+                                if not self.__r_mark_lAr():
+                                    raise lab66()
+                                self.bra = self.cursor
+                                if not self.slice_del():
+                                    return False
+
+                                v_30 = self.limit - self.cursor
+                                try:
+                                    if not self.__r_stem_suffix_chain_before_ki():
+                                        self.cursor = self.limit - v_30
+                                        raise lab67()
+                                except lab67: pass
+                                raise lab63()
+                            except lab66: pass
+                            self.cursor = self.limit - v_28
+                            if not self.__r_stem_suffix_chain_before_ki():
+                                self.cursor = self.limit - v_27
+                                raise lab62()
+                        except lab63: pass
+                    except lab62: pass
+                    raise lab37()
+                except lab61: pass
+                self.cursor = self.limit - v_15
+                try:
+                    self.ket = self.cursor
+                    try:
+                        v_31 = self.limit - self.cursor
+                        try:
+                            if not self.__r_mark_nUn():
+                                raise lab70()
+                            raise lab69()
+                        except lab70: pass
+                        self.cursor = self.limit - v_31
+                        if not self.__r_check_vowel_harmony():
+                            raise lab68()
+                        if self.find_among_b(TurkishStemmer.a_10) == 0:
+                            raise lab68()
+                        if not self.__r_mark_suffix_with_optional_y_consonant():
+                            raise lab68()
+                    except lab69: pass
+                    self.bra = self.cursor
+                    if not self.slice_del():
+                        return False
+
+                    v_32 = self.limit - self.cursor
+                    try:
+                        try:
+                            v_33 = self.limit - self.cursor
+                            try:
+                                self.ket = self.cursor
+                                if not self.__r_mark_lAr():
+                                    raise lab73()
+                                self.bra = self.cursor
+                                if not self.slice_del():
+                                    return False
+
+                                if not self.__r_stem_suffix_chain_before_ki():
+                                    raise lab73()
+                                raise lab72()
+                            except lab73: pass
+                            self.cursor = self.limit - v_33
+                            try:
+                                self.ket = self.cursor
+                                try:
+                                    v_34 = self.limit - self.cursor
+                                    try:
+                                        if not self.__r_mark_possessives():
+                                            raise lab76()
+                                        raise lab75()
+                                    except lab76: pass
+                                    self.cursor = self.limit - v_34
+                                    if not self.__r_mark_sU():
+                                        raise lab74()
+                                except lab75: pass
+                                self.bra = self.cursor
+                                if not self.slice_del():
+                                    return False
+
+                                v_35 = self.limit - self.cursor
+                                try:
+                                    self.ket = self.cursor
+                                    if not self.__r_mark_lAr():
+                                        self.cursor = self.limit - v_35
+                                        raise lab77()
+                                    self.bra = self.cursor
+                                    if not self.slice_del():
+                                        return False
+
+                                    if not self.__r_stem_suffix_chain_before_ki():
+                                        self.cursor = self.limit - v_35
+                                        raise lab77()
+                                except lab77: pass
+                                raise lab72()
+                            except lab74: pass
+                            self.cursor = self.limit - v_33
+                            if not self.__r_stem_suffix_chain_before_ki():
+                                self.cursor = self.limit - v_32
+                                raise lab71()
+                        except lab72: pass
+                    except lab71: pass
+                    raise lab37()
+                except lab68: pass
+                self.cursor = self.limit - v_15
+                try:
+                    self.ket = self.cursor
+                    if not self.__r_mark_lArI():
+                        raise lab78()
+                    self.bra = self.cursor
+                    if not self.slice_del():
+                        return False
+
+                    raise lab37()
+                except lab78: pass
+                self.cursor = self.limit - v_15
+                try:
+                    if not self.__r_stem_suffix_chain_before_ki():
+                        raise lab79()
+                    raise lab37()
+                except lab79: pass
+                self.cursor = self.limit - v_15
+                try:
+                    self.ket = self.cursor
+                    try:
+                        v_36 = self.limit - self.cursor
+                        try:
+                            if not self.__r_mark_DA():
+                                raise lab82()
+                            raise lab81()
+                        except lab82: pass
+                        self.cursor = self.limit - v_36
+                        try:
+                            if not self.__r_check_vowel_harmony():
+                                raise lab83()
+                            if not self.in_grouping_b(TurkishStemmer.g_U, 105, 305):
+                                raise lab83()
+                            if not self.__r_mark_suffix_with_optional_y_consonant():
+                                raise lab83()
+                            raise lab81()
+                        except lab83: pass
+                        self.cursor = self.limit - v_36
+                        if not self.__r_check_vowel_harmony():
+                            raise lab80()
+                        if self.find_among_b(TurkishStemmer.a_4) == 0:
+                            raise lab80()
+                        if not self.__r_mark_suffix_with_optional_y_consonant():
+                            raise lab80()
+                    except lab81: pass
+                    self.bra = self.cursor
+                    if not self.slice_del():
+                        return False
+
+                    v_37 = self.limit - self.cursor
+                    try:
+                        self.ket = self.cursor
+                        try:
+                            v_38 = self.limit - self.cursor
+                            try:
+                                if not self.__r_mark_possessives():
+                                    raise lab86()
+                                self.bra = self.cursor
+                                if not self.slice_del():
+                                    return False
+
+                                v_39 = self.limit - self.cursor
+                                try:
+                                    self.ket = self.cursor
+                                    if not self.__r_mark_lAr():
+                                        self.cursor = self.limit - v_39
+                                        raise lab87()
+                                except lab87: pass
+                                raise lab85()
+                            except lab86: pass
+                            self.cursor = self.limit - v_38
+                            if not self.__r_mark_lAr():
+                                self.cursor = self.limit - v_37
+                                raise lab84()
+                        except lab85: pass
+                        self.bra = self.cursor
+                        if not self.slice_del():
+                            return False
+
+                        self.ket = self.cursor
+                        if not self.__r_stem_suffix_chain_before_ki():
+                            self.cursor = self.limit - v_37
+                            raise lab84()
+                    except lab84: pass
+                    raise lab37()
+                except lab80: pass
+                self.cursor = self.limit - v_15
+                self.ket = self.cursor
+                try:
+                    v_40 = self.limit - self.cursor
+                    try:
+                        if not self.__r_mark_possessives():
+                            raise lab89()
+                        raise lab88()
+                    except lab89: pass
+                    self.cursor = self.limit - v_40
+                    if not self.__r_mark_sU():
+                        raise lab36()
+                except lab88: pass
+                self.bra = self.cursor
+                if not self.slice_del():
+                    return False
+
+                v_41 = self.limit - self.cursor
+                try:
+                    self.ket = self.cursor
+                    if not self.__r_mark_lAr():
+                        self.cursor = self.limit - v_41
+                        raise lab90()
+                    self.bra = self.cursor
+                    if not self.slice_del():
+                        return False
+
+                    if not self.__r_stem_suffix_chain_before_ki():
+                        self.cursor = self.limit - v_41
+                        raise lab90()
+                except lab90: pass
+            except lab37: pass
+        except lab36: pass
+        self.cursor = self.limit - v_14
+        self.cursor = self.limit_backward
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        v_42 = self.limit - self.cursor
+        try:
+            if not self.eq_s_b(u"ad"):
+                raise lab91()
+            v_43 = self.limit - self.cursor
+            try:
+                if not self.eq_s_b(u"soy"):
+                    self.cursor = self.limit - v_43
+                    raise lab92()
+            except lab92: pass
+            if self.cursor > self.limit_backward:
+                raise lab91()
+            return False
+        except lab91: pass
+        self.cursor = self.limit - v_42
+        v_44 = self.limit - self.cursor
+        try:
+            v_45 = self.limit - self.cursor
+            try:
+                v_46 = self.limit - self.cursor
+                try:
+                    if not self.eq_s_b(u"d"):
+                        raise lab95()
+                    raise lab94()
+                except lab95: pass
+                self.cursor = self.limit - v_46
+                if not self.eq_s_b(u"g"):
+                    raise lab93()
+            except lab94: pass
+            self.cursor = self.limit - v_45
+            try:
+                v_47 = self.limit - self.cursor
+                try:
+                    v_48 = self.limit - self.cursor
+                    if not self.go_out_grouping_b(TurkishStemmer.g_vowel, 97, 305):
+                        raise lab97()
+                    try:
+                        v_49 = self.limit - self.cursor
+                        try:
+                            if not self.eq_s_b(u"a"):
+                                raise lab99()
+                            raise lab98()
+                        except lab99: pass
+                        self.cursor = self.limit - v_49
+                        if not self.eq_s_b(u"\u0131"):
+                            raise lab97()
+                    except lab98: pass
+                    self.cursor = self.limit - v_48
+                    c = self.cursor
+                    self.insert(self.cursor, self.cursor, u"\u0131")
+                    self.cursor = c
+                    raise lab96()
+                except lab97: pass
+                self.cursor = self.limit - v_47
+                try:
+                    v_50 = self.limit - self.cursor
+                    if not self.go_out_grouping_b(TurkishStemmer.g_vowel, 97, 305):
+                        raise lab100()
+                    try:
+                        v_51 = self.limit - self.cursor
+                        try:
+                            if not self.eq_s_b(u"e"):
+                                raise lab102()
+                            raise lab101()
+                        except lab102: pass
+                        self.cursor = self.limit - v_51
+                        if not self.eq_s_b(u"i"):
+                            raise lab100()
+                    except lab101: pass
+                    self.cursor = self.limit - v_50
+                    c = self.cursor
+                    self.insert(self.cursor, self.cursor, u"i")
+                    self.cursor = c
+                    raise lab96()
+                except lab100: pass
+                self.cursor = self.limit - v_47
+                try:
+                    v_52 = self.limit - self.cursor
+                    if not self.go_out_grouping_b(TurkishStemmer.g_vowel, 97, 305):
+                        raise lab103()
+                    try:
+                        v_53 = self.limit - self.cursor
+                        try:
+                            if not self.eq_s_b(u"o"):
+                                raise lab105()
+                            raise lab104()
+                        except lab105: pass
+                        self.cursor = self.limit - v_53
+                        if not self.eq_s_b(u"u"):
+                            raise lab103()
+                    except lab104: pass
+                    self.cursor = self.limit - v_52
+                    c = self.cursor
+                    self.insert(self.cursor, self.cursor, u"u")
+                    self.cursor = c
+                    raise lab96()
+                except lab103: pass
+                self.cursor = self.limit - v_47
+                v_54 = self.limit - self.cursor
+                if not self.go_out_grouping_b(TurkishStemmer.g_vowel, 97, 305):
+                    raise lab93()
+                try:
+                    v_55 = self.limit - self.cursor
+                    try:
+                        if not self.eq_s_b(u"\u00F6"):
+                            raise lab107()
+                        raise lab106()
+                    except lab107: pass
+                    self.cursor = self.limit - v_55
+                    if not self.eq_s_b(u"\u00FC"):
+                        raise lab93()
+                except lab106: pass
+                self.cursor = self.limit - v_54
+                c = self.cursor
+                self.insert(self.cursor, self.cursor, u"\u00FC")
+                self.cursor = c
+            except lab96: pass
+        except lab93: pass
+        self.cursor = self.limit - v_44
+        v_56 = self.limit - self.cursor
+        try:
+            self.ket = self.cursor
+            among_var = self.find_among_b(TurkishStemmer.a_23)
+            if among_var == 0:
+                raise lab108()
+            self.bra = self.cursor
+            if among_var == 1:
+                if not self.slice_from(u"p"):
+                    return False
+            elif among_var == 2:
+                if not self.slice_from(u"\u00E7"):
+                    return False
+            elif among_var == 3:
+                if not self.slice_from(u"t"):
+                    return False
+            else:
+                if not self.slice_from(u"k"):
+                    return False
+        except lab108: pass
+        self.cursor = self.limit - v_56
+        self.cursor = self.limit_backward
+        return True
+
+
+class lab0(BaseException): pass
+
+
+class lab1(BaseException): pass
+
+
+class lab2(BaseException): pass
+
+
+class lab3(BaseException): pass
+
+
+class lab4(BaseException): pass
+
+
+class lab5(BaseException): pass
+
+
+class lab6(BaseException): pass
+
+
+class lab7(BaseException): pass
+
+
+class lab8(BaseException): pass
+
+
+class lab9(BaseException): pass
+
+
+class lab10(BaseException): pass
+
+
+class lab11(BaseException): pass
+
+
+class lab12(BaseException): pass
+
+
+class lab13(BaseException): pass
+
+
+class lab14(BaseException): pass
+
+
+class lab15(BaseException): pass
+
+
+class lab16(BaseException): pass
+
+
+class lab17(BaseException): pass
+
+
+class lab18(BaseException): pass
+
+
+class lab19(BaseException): pass
+
+
+class lab20(BaseException): pass
+
+
+class lab21(BaseException): pass
+
+
+class lab22(BaseException): pass
+
+
+class lab23(BaseException): pass
+
+
+class lab24(BaseException): pass
+
+
+class lab25(BaseException): pass
+
+
+class lab26(BaseException): pass
+
+
+class lab27(BaseException): pass
+
+
+class lab28(BaseException): pass
+
+
+class lab29(BaseException): pass
+
+
+class lab30(BaseException): pass
+
+
+class lab31(BaseException): pass
+
+
+class lab32(BaseException): pass
+
+
+class lab33(BaseException): pass
+
+
+class lab34(BaseException): pass
+
+
+class lab35(BaseException): pass
+
+
+class lab36(BaseException): pass
+
+
+class lab37(BaseException): pass
+
+
+class lab38(BaseException): pass
+
+
+class lab39(BaseException): pass
+
+
+class lab40(BaseException): pass
+
+
+class lab41(BaseException): pass
+
+
+class lab42(BaseException): pass
+
+
+class lab43(BaseException): pass
+
+
+class lab44(BaseException): pass
+
+
+class lab45(BaseException): pass
+
+
+class lab46(BaseException): pass
+
+
+class lab47(BaseException): pass
+
+
+class lab48(BaseException): pass
+
+
+class lab49(BaseException): pass
+
+
+class lab50(BaseException): pass
+
+
+class lab51(BaseException): pass
+
+
+class lab52(BaseException): pass
+
+
+class lab53(BaseException): pass
+
+
+class lab54(BaseException): pass
+
+
+class lab55(BaseException): pass
+
+
+class lab56(BaseException): pass
+
+
+class lab57(BaseException): pass
+
+
+class lab58(BaseException): pass
+
+
+class lab59(BaseException): pass
+
+
+class lab60(BaseException): pass
+
+
+class lab61(BaseException): pass
+
+
+class lab62(BaseException): pass
+
+
+class lab63(BaseException): pass
+
+
+class lab64(BaseException): pass
+
+
+class lab65(BaseException): pass
+
+
+class lab66(BaseException): pass
+
+
+class lab67(BaseException): pass
+
+
+class lab68(BaseException): pass
+
+
+class lab69(BaseException): pass
+
+
+class lab70(BaseException): pass
+
+
+class lab71(BaseException): pass
+
+
+class lab72(BaseException): pass
+
+
+class lab73(BaseException): pass
+
+
+class lab74(BaseException): pass
+
+
+class lab75(BaseException): pass
+
+
+class lab76(BaseException): pass
+
+
+class lab77(BaseException): pass
+
+
+class lab78(BaseException): pass
+
+
+class lab79(BaseException): pass
+
+
+class lab80(BaseException): pass
+
+
+class lab81(BaseException): pass
+
+
+class lab82(BaseException): pass
+
+
+class lab83(BaseException): pass
+
+
+class lab84(BaseException): pass
+
+
+class lab85(BaseException): pass
+
+
+class lab86(BaseException): pass
+
+
+class lab87(BaseException): pass
+
+
+class lab88(BaseException): pass
+
+
+class lab89(BaseException): pass
+
+
+class lab90(BaseException): pass
+
+
+class lab91(BaseException): pass
+
+
+class lab92(BaseException): pass
+
+
+class lab93(BaseException): pass
+
+
+class lab94(BaseException): pass
+
+
+class lab95(BaseException): pass
+
+
+class lab96(BaseException): pass
+
+
+class lab97(BaseException): pass
+
+
+class lab98(BaseException): pass
+
+
+class lab99(BaseException): pass
+
+
+class lab100(BaseException): pass
+
+
+class lab101(BaseException): pass
+
+
+class lab102(BaseException): pass
+
+
+class lab103(BaseException): pass
+
+
+class lab104(BaseException): pass
+
+
+class lab105(BaseException): pass
+
+
+class lab106(BaseException): pass
+
+
+class lab107(BaseException): pass
+
+
+class lab108(BaseException): pass
@@ -0,0 +1,929 @@
+# Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+from .basestemmer import BaseStemmer
+from .among import Among
+
+
+class YiddishStemmer(BaseStemmer):
+    '''
+    This class implements the stemming algorithm defined by a snowball script.
+    Generated by Snowball 2.2.0 - https://snowballstem.org/
+    '''
+
+    a_0 = [
+        Among(u"\u05D5\u05D5", -1, 1),
+        Among(u"\u05D5\u05D9", -1, 2),
+        Among(u"\u05D9\u05D9", -1, 3),
+        Among(u"\u05DA", -1, 4),
+        Among(u"\u05DD", -1, 5),
+        Among(u"\u05DF", -1, 6),
+        Among(u"\u05E3", -1, 7),
+        Among(u"\u05E5", -1, 8)
+    ]
+
+    a_1 = [
+        Among(u"\u05D0\u05D3\u05D5\u05E8\u05DB", -1, 1),
+        Among(u"\u05D0\u05D4\u05D9\u05E0", -1, 1),
+        Among(u"\u05D0\u05D4\u05E2\u05E8", -1, 1),
+        Among(u"\u05D0\u05D4\u05F2\u05DE", -1, 1),
+        Among(u"\u05D0\u05D5\u05DE", -1, 1),
+        Among(u"\u05D0\u05D5\u05E0\u05D8\u05E2\u05E8", -1, 1),
+        Among(u"\u05D0\u05D9\u05D1\u05E2\u05E8", -1, 1),
+        Among(u"\u05D0\u05E0", -1, 1),
+        Among(u"\u05D0\u05E0\u05D8", 7, 1),
+        Among(u"\u05D0\u05E0\u05D8\u05E7\u05E2\u05D2\u05E0", 8, 1),
+        Among(u"\u05D0\u05E0\u05D9\u05D3\u05E2\u05E8", 7, 1),
+        Among(u"\u05D0\u05E4", -1, 1),
+        Among(u"\u05D0\u05E4\u05D9\u05E8", 11, 1),
+        Among(u"\u05D0\u05E7\u05E2\u05D2\u05E0", -1, 1),
+        Among(u"\u05D0\u05E8\u05D0\u05E4", -1, 1),
+        Among(u"\u05D0\u05E8\u05D5\u05DE", -1, 1),
+        Among(u"\u05D0\u05E8\u05D5\u05E0\u05D8\u05E2\u05E8", -1, 1),
+        Among(u"\u05D0\u05E8\u05D9\u05D1\u05E2\u05E8", -1, 1),
+        Among(u"\u05D0\u05E8\u05F1\u05E1", -1, 1),
+        Among(u"\u05D0\u05E8\u05F1\u05E4", -1, 1),
+        Among(u"\u05D0\u05E8\u05F2\u05E0", -1, 1),
+        Among(u"\u05D0\u05F0\u05E2\u05E7", -1, 1),
+        Among(u"\u05D0\u05F1\u05E1", -1, 1),
+        Among(u"\u05D0\u05F1\u05E4", -1, 1),
+        Among(u"\u05D0\u05F2\u05E0", -1, 1),
+        Among(u"\u05D1\u05D0", -1, 1),
+        Among(u"\u05D1\u05F2", -1, 1),
+        Among(u"\u05D3\u05D5\u05E8\u05DB", -1, 1),
+        Among(u"\u05D3\u05E2\u05E8", -1, 1),
+        Among(u"\u05DE\u05D9\u05D8", -1, 1),
+        Among(u"\u05E0\u05D0\u05DB", -1, 1),
+        Among(u"\u05E4\u05D0\u05E8", -1, 1),
+        Among(u"\u05E4\u05D0\u05E8\u05D1\u05F2", 31, 1),
+        Among(u"\u05E4\u05D0\u05E8\u05F1\u05E1", 31, 1),
+        Among(u"\u05E4\u05D5\u05E0\u05D0\u05E0\u05D3\u05E2\u05E8", -1, 1),
+        Among(u"\u05E6\u05D5", -1, 1),
+        Among(u"\u05E6\u05D5\u05D6\u05D0\u05DE\u05E2\u05E0", 35, 1),
+        Among(u"\u05E6\u05D5\u05E0\u05F1\u05E4", 35, 1),
+        Among(u"\u05E6\u05D5\u05E8\u05D9\u05E7", 35, 1),
+        Among(u"\u05E6\u05E2", -1, 1)
+    ]
+
+    a_2 = [
+        Among(u"\u05D3\u05D6\u05E9", -1, -1),
+        Among(u"\u05E9\u05D8\u05E8", -1, -1),
+        Among(u"\u05E9\u05D8\u05E9", -1, -1),
+        Among(u"\u05E9\u05E4\u05E8", -1, -1)
+    ]
+
+    a_3 = [
+        Among(u"\u05E7\u05DC\u05D9\u05D1", -1, 9),
+        Among(u"\u05E8\u05D9\u05D1", -1, 10),
+        Among(u"\u05D8\u05E8\u05D9\u05D1", 1, 7),
+        Among(u"\u05E9\u05E8\u05D9\u05D1", 1, 15),
+        Among(u"\u05D4\u05F1\u05D1", -1, 23),
+        Among(u"\u05E9\u05F0\u05D9\u05D2", -1, 12),
+        Among(u"\u05D2\u05D0\u05E0\u05D2", -1, 1),
+        Among(u"\u05D6\u05D5\u05E0\u05D2", -1, 18),
+        Among(u"\u05E9\u05DC\u05D5\u05E0\u05D2", -1, 21),
+        Among(u"\u05E6\u05F0\u05D5\u05E0\u05D2", -1, 20),
+        Among(u"\u05D1\u05F1\u05D2", -1, 22),
+        Among(u"\u05D1\u05D5\u05E0\u05D3", -1, 16),
+        Among(u"\u05F0\u05D9\u05D6", -1, 6),
+        Among(u"\u05D1\u05D9\u05D8", -1, 4),
+        Among(u"\u05DC\u05D9\u05D8", -1, 8),
+        Among(u"\u05DE\u05D9\u05D8", -1, 3),
+        Among(u"\u05E9\u05E0\u05D9\u05D8", -1, 14),
+        Among(u"\u05E0\u05D5\u05DE", -1, 2),
+        Among(u"\u05E9\u05D8\u05D0\u05E0", -1, 25),
+        Among(u"\u05D1\u05D9\u05E1", -1, 5),
+        Among(u"\u05E9\u05DE\u05D9\u05E1", -1, 13),
+        Among(u"\u05E8\u05D9\u05E1", -1, 11),
+        Among(u"\u05D8\u05E8\u05D5\u05E0\u05E7", -1, 19),
+        Among(u"\u05E4\u05D0\u05E8\u05DC\u05F1\u05E8", -1, 24),
+        Among(u"\u05E9\u05F0\u05F1\u05E8", -1, 26),
+        Among(u"\u05F0\u05D5\u05D8\u05E9", -1, 17)
+    ]
+
+    a_4 = [
+        Among(u"\u05D5\u05E0\u05D2", -1, 1),
+        Among(u"\u05E1\u05D8\u05D5", -1, 1),
+        Among(u"\u05D8", -1, 1),
+        Among(u"\u05D1\u05E8\u05D0\u05DB\u05D8", 2, 31),
+        Among(u"\u05E1\u05D8", 2, 1),
+        Among(u"\u05D9\u05E1\u05D8", 4, 33),
+        Among(u"\u05E2\u05D8", 2, 1),
+        Among(u"\u05E9\u05D0\u05E4\u05D8", 2, 1),
+        Among(u"\u05D4\u05F2\u05D8", 2, 1),
+        Among(u"\u05E7\u05F2\u05D8", 2, 1),
+        Among(u"\u05D9\u05E7\u05F2\u05D8", 9, 1),
+        Among(u"\u05DC\u05E2\u05DB", -1, 1),
+        Among(u"\u05E2\u05DC\u05E2\u05DB", 11, 1),
+        Among(u"\u05D9\u05D6\u05DE", -1, 1),
+        Among(u"\u05D9\u05DE", -1, 1),
+        Among(u"\u05E2\u05DE", -1, 1),
+        Among(u"\u05E2\u05E0\u05E2\u05DE", 15, 3),
+        Among(u"\u05D8\u05E2\u05E0\u05E2\u05DE", 16, 4),
+        Among(u"\u05E0", -1, 1),
+        Among(u"\u05E7\u05DC\u05D9\u05D1\u05E0", 18, 14),
+        Among(u"\u05E8\u05D9\u05D1\u05E0", 18, 15),
+        Among(u"\u05D8\u05E8\u05D9\u05D1\u05E0", 20, 12),
+        Among(u"\u05E9\u05E8\u05D9\u05D1\u05E0", 20, 7),
+        Among(u"\u05D4\u05F1\u05D1\u05E0", 18, 27),
+        Among(u"\u05E9\u05F0\u05D9\u05D2\u05E0", 18, 17),
+        Among(u"\u05D6\u05D5\u05E0\u05D2\u05E0", 18, 22),
+        Among(u"\u05E9\u05DC\u05D5\u05E0\u05D2\u05E0", 18, 25),
+        Among(u"\u05E6\u05F0\u05D5\u05E0\u05D2\u05E0", 18, 24),
+        Among(u"\u05D1\u05F1\u05D2\u05E0", 18, 26),
+        Among(u"\u05D1\u05D5\u05E0\u05D3\u05E0", 18, 20),
+        Among(u"\u05F0\u05D9\u05D6\u05E0", 18, 11),
+        Among(u"\u05D8\u05E0", 18, 4),
+        Among(u"GE\u05D1\u05D9\u05D8\u05E0", 31, 9),
+        Among(u"GE\u05DC\u05D9\u05D8\u05E0", 31, 13),
+        Among(u"GE\u05DE\u05D9\u05D8\u05E0", 31, 8),
+        Among(u"\u05E9\u05E0\u05D9\u05D8\u05E0", 31, 19),
+        Among(u"\u05E1\u05D8\u05E0", 31, 1),
+        Among(u"\u05D9\u05E1\u05D8\u05E0", 36, 1),
+        Among(u"\u05E2\u05D8\u05E0", 31, 1),
+        Among(u"GE\u05D1\u05D9\u05E1\u05E0", 18, 10),
+        Among(u"\u05E9\u05DE\u05D9\u05E1\u05E0", 18, 18),
+        Among(u"GE\u05E8\u05D9\u05E1\u05E0", 18, 16),
+        Among(u"\u05E2\u05E0", 18, 1),
+        Among(u"\u05D2\u05D0\u05E0\u05D2\u05E2\u05E0", 42, 5),
+        Among(u"\u05E2\u05DC\u05E2\u05E0", 42, 1),
+        Among(u"\u05E0\u05D5\u05DE\u05E2\u05E0", 42, 6),
+        Among(u"\u05D9\u05D6\u05DE\u05E2\u05E0", 42, 1),
+        Among(u"\u05E9\u05D8\u05D0\u05E0\u05E2\u05E0", 42, 29),
+        Among(u"\u05D8\u05E8\u05D5\u05E0\u05E7\u05E0", 18, 23),
+        Among(u"\u05E4\u05D0\u05E8\u05DC\u05F1\u05E8\u05E0", 18, 28),
+        Among(u"\u05E9\u05F0\u05F1\u05E8\u05E0", 18, 30),
+        Among(u"\u05F0\u05D5\u05D8\u05E9\u05E0", 18, 21),
+        Among(u"\u05D2\u05F2\u05E0", 18, 5),
+        Among(u"\u05E1", -1, 1),
+        Among(u"\u05D8\u05E1", 53, 4),
+        Among(u"\u05E2\u05D8\u05E1", 54, 1),
+        Among(u"\u05E0\u05E1", 53, 1),
+        Among(u"\u05D8\u05E0\u05E1", 56, 4),
+        Among(u"\u05E2\u05E0\u05E1", 56, 3),
+        Among(u"\u05E2\u05E1", 53, 1),
+        Among(u"\u05D9\u05E2\u05E1", 59, 2),
+        Among(u"\u05E2\u05DC\u05E2\u05E1", 59, 1),
+        Among(u"\u05E2\u05E8\u05E1", 53, 1),
+        Among(u"\u05E2\u05E0\u05E2\u05E8\u05E1", 62, 1),
+        Among(u"\u05E2", -1, 1),
+        Among(u"\u05D8\u05E2", 64, 4),
+        Among(u"\u05E1\u05D8\u05E2", 65, 1),
+        Among(u"\u05E2\u05D8\u05E2", 65, 1),
+        Among(u"\u05D9\u05E2", 64, -1),
+        Among(u"\u05E2\u05DC\u05E2", 64, 1),
+        Among(u"\u05E2\u05E0\u05E2", 64, 3),
+        Among(u"\u05D8\u05E2\u05E0\u05E2", 70, 4),
+        Among(u"\u05E2\u05E8", -1, 1),
+        Among(u"\u05D8\u05E2\u05E8", 72, 4),
+        Among(u"\u05E1\u05D8\u05E2\u05E8", 73, 1),
+        Among(u"\u05E2\u05D8\u05E2\u05E8", 73, 1),
+        Among(u"\u05E2\u05E0\u05E2\u05E8", 72, 3),
+        Among(u"\u05D8\u05E2\u05E0\u05E2\u05E8", 76, 4),
+        Among(u"\u05D5\u05EA", -1, 32)
+    ]
+
+    a_5 = [
+        Among(u"\u05D5\u05E0\u05D2", -1, 1),
+        Among(u"\u05E9\u05D0\u05E4\u05D8", -1, 1),
+        Among(u"\u05D4\u05F2\u05D8", -1, 1),
+        Among(u"\u05E7\u05F2\u05D8", -1, 1),
+        Among(u"\u05D9\u05E7\u05F2\u05D8", 3, 1),
+        Among(u"\u05DC", -1, 2)
+    ]
+
+    a_6 = [
+        Among(u"\u05D9\u05D2", -1, 1),
+        Among(u"\u05D9\u05E7", -1, 1),
+        Among(u"\u05D3\u05D9\u05E7", 1, 1),
+        Among(u"\u05E0\u05D3\u05D9\u05E7", 2, 1),
+        Among(u"\u05E2\u05E0\u05D3\u05D9\u05E7", 3, 1),
+        Among(u"\u05D1\u05DC\u05D9\u05E7", 1, -1),
+        Among(u"\u05D2\u05DC\u05D9\u05E7", 1, -1),
+        Among(u"\u05E0\u05D9\u05E7", 1, 1),
+        Among(u"\u05D9\u05E9", -1, 1)
+    ]
+
+    g_niked = [255, 155, 6]
+
+    g_vowel = [33, 2, 4, 0, 6]
+
+    g_consonant = [239, 254, 253, 131]
+
+    I_x = 0
+    I_p1 = 0
+
+    def _stem(self):
+        try:
+            v_2 = self.cursor
+            try:
+                while True:
+                    v_3 = self.cursor
+                    try:
+                        try:
+                            while True:
+                                v_4 = self.cursor
+                                try:
+                                    self.bra = self.cursor
+                                    among_var = self.find_among(YiddishStemmer.a_0)
+                                    if among_var == 0:
+                                        raise lab4()
+                                    self.ket = self.cursor
+                                    if among_var == 1:
+                                        v_5 = self.cursor
+                                        try:
+                                            if not self.eq_s(u"\u05BC"):
+                                                raise lab5()
+                                            raise lab4()
+                                        except lab5: pass
+                                        self.cursor = v_5
+                                        if not self.slice_from(u"\u05F0"):
+                                            return False
+                                    elif among_var == 2:
+                                        v_6 = self.cursor
+                                        try:
+                                            if not self.eq_s(u"\u05B4"):
+                                                raise lab6()
+                                            raise lab4()
+                                        except lab6: pass
+                                        self.cursor = v_6
+                                        if not self.slice_from(u"\u05F1"):
+                                            return False
+                                    elif among_var == 3:
+                                        v_7 = self.cursor
+                                        try:
+                                            if not self.eq_s(u"\u05B4"):
+                                                raise lab7()
+                                            raise lab4()
+                                        except lab7: pass
+                                        self.cursor = v_7
+                                        if not self.slice_from(u"\u05F2"):
+                                            return False
+                                    elif among_var == 4:
+                                        if not self.slice_from(u"\u05DB"):
+                                            return False
+                                    elif among_var == 5:
+                                        if not self.slice_from(u"\u05DE"):
+                                            return False
+                                    elif among_var == 6:
+                                        if not self.slice_from(u"\u05E0"):
+                                            return False
+                                    elif among_var == 7:
+                                        if not self.slice_from(u"\u05E4"):
+                                            return False
+                                    else:
+                                        if not self.slice_from(u"\u05E6"):
+                                            return False
+                                    self.cursor = v_4
+                                    raise lab3()
+                                except lab4: pass
+                                self.cursor = v_4
+                                if self.cursor >= self.limit:
+                                    raise lab2()
+                                self.cursor += 1
+                        except lab3: pass
+                        continue
+                    except lab2: pass
+                    self.cursor = v_3
+                    break
+            except lab1: pass
+            self.cursor = v_2
+            v_8 = self.cursor
+            try:
+                while True:
+                    v_9 = self.cursor
+                    try:
+                        try:
+                            while True:
+                                v_10 = self.cursor
+                                try:
+                                    self.bra = self.cursor
+                                    if not self.in_grouping(YiddishStemmer.g_niked, 1456, 1474):
+                                        raise lab11()
+                                    self.ket = self.cursor
+                                    if not self.slice_del():
+                                        return False
+
+                                    self.cursor = v_10
+                                    raise lab10()
+                                except lab11: pass
+                                self.cursor = v_10
+                                if self.cursor >= self.limit:
+                                    raise lab9()
+                                self.cursor += 1
+                        except lab10: pass
+                        continue
+                    except lab9: pass
+                    self.cursor = v_9
+                    break
+            except lab8: pass
+            self.cursor = v_8
+        except lab0: pass
+        v_11 = self.cursor
+        try:
+            self.I_p1 = self.limit
+            v_12 = self.cursor
+            try:
+                self.bra = self.cursor
+                if not self.eq_s(u"\u05D2\u05E2"):
+                    self.cursor = v_12
+                    raise lab13()
+                self.ket = self.cursor
+                v_13 = self.cursor
+                try:
+                    try:
+                        v_14 = self.cursor
+                        try:
+                            if not self.eq_s(u"\u05DC\u05D8"):
+                                raise lab16()
+                            raise lab15()
+                        except lab16: pass
+                        self.cursor = v_14
+                        if not self.eq_s(u"\u05D1\u05E0"):
+                            raise lab14()
+                    except lab15: pass
+                    self.cursor = v_12
+                    raise lab13()
+                except lab14: pass
+                self.cursor = v_13
+                if not self.slice_from(u"GE"):
+                    return False
+            except lab13: pass
+            v_15 = self.cursor
+            try:
+                if self.find_among(YiddishStemmer.a_1) == 0:
+                    self.cursor = v_15
+                    raise lab17()
+                try:
+                    v_16 = self.cursor
+                    try:
+                        v_17 = self.cursor
+                        try:
+                            v_18 = self.cursor
+                            try:
+                                if not self.eq_s(u"\u05E6\u05D5\u05D2\u05E0"):
+                                    raise lab21()
+                                raise lab20()
+                            except lab21: pass
+                            self.cursor = v_18
+                            try:
+                                if not self.eq_s(u"\u05E6\u05D5\u05E7\u05D8"):
+                                    raise lab22()
+                                raise lab20()
+                            except lab22: pass
+                            self.cursor = v_18
+                            if not self.eq_s(u"\u05E6\u05D5\u05E7\u05E0"):
+                                raise lab19()
+                        except lab20: pass
+                        if self.cursor < self.limit:
+                            raise lab19()
+                        self.cursor = v_17
+                        raise lab18()
+                    except lab19: pass
+                    self.cursor = v_16
+                    try:
+                        v_19 = self.cursor
+                        if not self.eq_s(u"\u05D2\u05E2\u05D1\u05E0"):
+                            raise lab23()
+                        self.cursor = v_19
+                        raise lab18()
+                    except lab23: pass
+                    self.cursor = v_16
+                    try:
+                        self.bra = self.cursor
+                        if not self.eq_s(u"\u05D2\u05E2"):
+                            raise lab24()
+                        self.ket = self.cursor
+                        if not self.slice_from(u"GE"):
+                            return False
+                        raise lab18()
+                    except lab24: pass
+                    self.cursor = v_16
+                    self.bra = self.cursor
+                    if not self.eq_s(u"\u05E6\u05D5"):
+                        self.cursor = v_15
+                        raise lab17()
+                    self.ket = self.cursor
+                    if not self.slice_from(u"TSU"):
+                        return False
+                except lab18: pass
+            except lab17: pass
+            v_20 = self.cursor
+            c = self.cursor + 3
+            if c > self.limit:
+                raise lab12()
+            self.cursor = c
+            self.I_x = self.cursor
+            self.cursor = v_20
+            v_21 = self.cursor
+            try:
+                if self.find_among(YiddishStemmer.a_2) == 0:
+                    self.cursor = v_21
+                    raise lab25()
+            except lab25: pass
+            v_22 = self.cursor
+            try:
+                if not self.in_grouping(YiddishStemmer.g_consonant, 1489, 1520):
+                    raise lab26()
+                if not self.in_grouping(YiddishStemmer.g_consonant, 1489, 1520):
+                    raise lab26()
+                if not self.in_grouping(YiddishStemmer.g_consonant, 1489, 1520):
+                    raise lab26()
+                self.I_p1 = self.cursor
+                raise lab12()
+            except lab26: pass
+            self.cursor = v_22
+            if not self.go_out_grouping(YiddishStemmer.g_vowel, 1488, 1522):
+                raise lab12()
+            while True:
+                try:
+                    if not self.in_grouping(YiddishStemmer.g_vowel, 1488, 1522):
+                        raise lab27()
+                    continue
+                except lab27: pass
+                break
+            self.I_p1 = self.cursor
+            try:
+                if not self.I_p1 < self.I_x:
+                    raise lab28()
+                self.I_p1 = self.I_x
+            except lab28: pass
+        except lab12: pass
+        self.cursor = v_11
+        self.limit_backward = self.cursor
+        self.cursor = self.limit
+        try:
+            v_26 = self.limit - self.cursor
+            try:
+                self.ket = self.cursor
+                among_var = self.find_among_b(YiddishStemmer.a_4)
+                if among_var == 0:
+                    raise lab30()
+                self.bra = self.cursor
+                if among_var == 1:
+                    if not self.I_p1 <= self.cursor:
+                        raise lab30()
+                    if not self.slice_del():
+                        return False
+
+                elif among_var == 2:
+                    if not self.I_p1 <= self.cursor:
+                        raise lab30()
+                    if not self.slice_from(u"\u05D9\u05E2"):
+                        return False
+                elif among_var == 3:
+                    if not self.I_p1 <= self.cursor:
+                        raise lab30()
+                    if not self.slice_del():
+                        return False
+
+                    self.ket = self.cursor
+                    among_var = self.find_among_b(YiddishStemmer.a_3)
+                    if among_var == 0:
+                        raise lab30()
+                    self.bra = self.cursor
+                    if among_var == 1:
+                        if not self.slice_from(u"\u05D2\u05F2"):
+                            return False
+                    elif among_var == 2:
+                        if not self.slice_from(u"\u05E0\u05E2\u05DE"):
+                            return False
+                    elif among_var == 3:
+                        if not self.slice_from(u"\u05DE\u05F2\u05D3"):
+                            return False
+                    elif among_var == 4:
+                        if not self.slice_from(u"\u05D1\u05F2\u05D8"):
+                            return False
+                    elif among_var == 5:
+                        if not self.slice_from(u"\u05D1\u05F2\u05E1"):
+                            return False
+                    elif among_var == 6:
+                        if not self.slice_from(u"\u05F0\u05F2\u05D6"):
+                            return False
+                    elif among_var == 7:
+                        if not self.slice_from(u"\u05D8\u05E8\u05F2\u05D1"):
+                            return False
+                    elif among_var == 8:
+                        if not self.slice_from(u"\u05DC\u05F2\u05D8"):
+                            return False
+                    elif among_var == 9:
+                        if not self.slice_from(u"\u05E7\u05DC\u05F2\u05D1"):
+                            return False
+                    elif among_var == 10:
+                        if not self.slice_from(u"\u05E8\u05F2\u05D1"):
+                            return False
+                    elif among_var == 11:
+                        if not self.slice_from(u"\u05E8\u05F2\u05E1"):
+                            return False
+                    elif among_var == 12:
+                        if not self.slice_from(u"\u05E9\u05F0\u05F2\u05D2"):
+                            return False
+                    elif among_var == 13:
+                        if not self.slice_from(u"\u05E9\u05DE\u05F2\u05E1"):
+                            return False
+                    elif among_var == 14:
+                        if not self.slice_from(u"\u05E9\u05E0\u05F2\u05D3"):
+                            return False
+                    elif among_var == 15:
+                        if not self.slice_from(u"\u05E9\u05E8\u05F2\u05D1"):
+                            return False
+                    elif among_var == 16:
+                        if not self.slice_from(u"\u05D1\u05D9\u05E0\u05D3"):
+                            return False
+                    elif among_var == 17:
+                        if not self.slice_from(u"\u05F0\u05D9\u05D8\u05E9"):
+                            return False
+                    elif among_var == 18:
+                        if not self.slice_from(u"\u05D6\u05D9\u05E0\u05D2"):
+                            return False
+                    elif among_var == 19:
+                        if not self.slice_from(u"\u05D8\u05E8\u05D9\u05E0\u05E7"):
+                            return False
+                    elif among_var == 20:
+                        if not self.slice_from(u"\u05E6\u05F0\u05D9\u05E0\u05D2"):
+                            return False
+                    elif among_var == 21:
+                        if not self.slice_from(u"\u05E9\u05DC\u05D9\u05E0\u05D2"):
+                            return False
+                    elif among_var == 22:
+                        if not self.slice_from(u"\u05D1\u05F2\u05D2"):
+                            return False
+                    elif among_var == 23:
+                        if not self.slice_from(u"\u05D4\u05F2\u05D1"):
+                            return False
+                    elif among_var == 24:
+                        if not self.slice_from(u"\u05E4\u05D0\u05E8\u05DC\u05D9\u05E8"):
+                            return False
+                    elif among_var == 25:
+                        if not self.slice_from(u"\u05E9\u05D8\u05F2"):
+                            return False
+                    else:
+                        if not self.slice_from(u"\u05E9\u05F0\u05E2\u05E8"):
+                            return False
+                elif among_var == 4:
+                    try:
+                        v_27 = self.limit - self.cursor
+                        try:
+                            if not self.I_p1 <= self.cursor:
+                                raise lab32()
+                            if not self.slice_del():
+                                return False
+
+                            raise lab31()
+                        except lab32: pass
+                        self.cursor = self.limit - v_27
+                        if not self.slice_from(u"\u05D8"):
+                            return False
+                    except lab31: pass
+                    self.ket = self.cursor
+                    if not self.eq_s_b(u"\u05D1\u05E8\u05D0\u05DB"):
+                        raise lab30()
+                    v_28 = self.limit - self.cursor
+                    try:
+                        if not self.eq_s_b(u"\u05D2\u05E2"):
+                            self.cursor = self.limit - v_28
+                            raise lab33()
+                    except lab33: pass
+                    self.bra = self.cursor
+                    if not self.slice_from(u"\u05D1\u05E8\u05E2\u05E0\u05D2"):
+                        return False
+                elif among_var == 5:
+                    if not self.slice_from(u"\u05D2\u05F2"):
+                        return False
+                elif among_var == 6:
+                    if not self.slice_from(u"\u05E0\u05E2\u05DE"):
+                        return False
+                elif among_var == 7:
+                    if not self.slice_from(u"\u05E9\u05E8\u05F2\u05D1"):
+                        return False
+                elif among_var == 8:
+                    if not self.slice_from(u"\u05DE\u05F2\u05D3"):
+                        return False
+                elif among_var == 9:
+                    if not self.slice_from(u"\u05D1\u05F2\u05D8"):
+                        return False
+                elif among_var == 10:
+                    if not self.slice_from(u"\u05D1\u05F2\u05E1"):
+                        return False
+                elif among_var == 11:
+                    if not self.slice_from(u"\u05F0\u05F2\u05D6"):
+                        return False
+                elif among_var == 12:
+                    if not self.slice_from(u"\u05D8\u05E8\u05F2\u05D1"):
+                        return False
+                elif among_var == 13:
+                    if not self.slice_from(u"\u05DC\u05F2\u05D8"):
+                        return False
+                elif among_var == 14:
+                    if not self.slice_from(u"\u05E7\u05DC\u05F2\u05D1"):
+                        return False
+                elif among_var == 15:
+                    if not self.slice_from(u"\u05E8\u05F2\u05D1"):
+                        return False
+                elif among_var == 16:
+                    if not self.slice_from(u"\u05E8\u05F2\u05E1"):
+                        return False
+                elif among_var == 17:
+                    if not self.slice_from(u"\u05E9\u05F0\u05F2\u05D2"):
+                        return False
+                elif among_var == 18:
+                    if not self.slice_from(u"\u05E9\u05DE\u05F2\u05E1"):
+                        return False
+                elif among_var == 19:
+                    if not self.slice_from(u"\u05E9\u05E0\u05F2\u05D3"):
+                        return False
+                elif among_var == 20:
+                    if not self.slice_from(u"\u05D1\u05D9\u05E0\u05D3"):
+                        return False
+                elif among_var == 21:
+                    if not self.slice_from(u"\u05F0\u05D9\u05D8\u05E9"):
+                        return False
+                elif among_var == 22:
+                    if not self.slice_from(u"\u05D6\u05D9\u05E0\u05D2"):
+                        return False
+                elif among_var == 23:
+                    if not self.slice_from(u"\u05D8\u05E8\u05D9\u05E0\u05E7"):
+                        return False
+                elif among_var == 24:
+                    if not self.slice_from(u"\u05E6\u05F0\u05D9\u05E0\u05D2"):
+                        return False
+                elif among_var == 25:
+                    if not self.slice_from(u"\u05E9\u05DC\u05D9\u05E0\u05D2"):
+                        return False
+                elif among_var == 26:
+                    if not self.slice_from(u"\u05D1\u05F2\u05D2"):
+                        return False
+                elif among_var == 27:
+                    if not self.slice_from(u"\u05D4\u05F2\u05D1"):
+                        return False
+                elif among_var == 28:
+                    if not self.slice_from(u"\u05E4\u05D0\u05E8\u05DC\u05D9\u05E8"):
+                        return False
+                elif among_var == 29:
+                    if not self.slice_from(u"\u05E9\u05D8\u05F2"):
+                        return False
+                elif among_var == 30:
+                    if not self.slice_from(u"\u05E9\u05F0\u05E2\u05E8"):
+                        return False
+                elif among_var == 31:
+                    if not self.slice_from(u"\u05D1\u05E8\u05E2\u05E0\u05D2"):
+                        return False
+                elif among_var == 32:
+                    if not self.I_p1 <= self.cursor:
+                        raise lab30()
+                    if not self.slice_from(u"\u05D4"):
+                        return False
+                elif among_var == 33:
+                    try:
+                        v_29 = self.limit - self.cursor
+                        try:
+                            try:
+                                v_30 = self.limit - self.cursor
+                                try:
+                                    if not self.eq_s_b(u"\u05D2"):
+                                        raise lab37()
+                                    raise lab36()
+                                except lab37: pass
+                                self.cursor = self.limit - v_30
+                                if not self.eq_s_b(u"\u05E9"):
+                                    raise lab35()
+                            except lab36: pass
+                            v_31 = self.limit - self.cursor
+                            try:
+                                if not self.I_p1 <= (self.cursor + 3):
+                                    self.cursor = self.limit - v_31
+                                    raise lab38()
+                                if not self.slice_from(u"\u05D9\u05E1"):
+                                    return False
+                            except lab38: pass
+                            raise lab34()
+                        except lab35: pass
+                        self.cursor = self.limit - v_29
+                        if not self.I_p1 <= self.cursor:
+                            raise lab30()
+                        if not self.slice_del():
+                            return False
+
+                    except lab34: pass
+            except lab30: pass
+            self.cursor = self.limit - v_26
+            v_32 = self.limit - self.cursor
+            try:
+                self.ket = self.cursor
+                among_var = self.find_among_b(YiddishStemmer.a_5)
+                if among_var == 0:
+                    raise lab39()
+                self.bra = self.cursor
+                if among_var == 1:
+                    if not self.I_p1 <= self.cursor:
+                        raise lab39()
+                    if not self.slice_del():
+                        return False
+
+                else:
+                    if not self.I_p1 <= self.cursor:
+                        raise lab39()
+                    if not self.in_grouping_b(YiddishStemmer.g_consonant, 1489, 1520):
+                        raise lab39()
+                    if not self.slice_del():
+                        return False
+
+            except lab39: pass
+            self.cursor = self.limit - v_32
+            v_33 = self.limit - self.cursor
+            try:
+                self.ket = self.cursor
+                among_var = self.find_among_b(YiddishStemmer.a_6)
+                if among_var == 0:
+                    raise lab40()
+                self.bra = self.cursor
+                if among_var == 1:
+                    if not self.I_p1 <= self.cursor:
+                        raise lab40()
+                    if not self.slice_del():
+                        return False
+
+            except lab40: pass
+            self.cursor = self.limit - v_33
+            v_34 = self.limit - self.cursor
+            try:
+                while True:
+                    v_35 = self.limit - self.cursor
+                    try:
+                        try:
+                            while True:
+                                v_36 = self.limit - self.cursor
+                                try:
+                                    self.ket = self.cursor
+                                    try:
+                                        v_37 = self.limit - self.cursor
+                                        try:
+                                            if not self.eq_s_b(u"GE"):
+                                                raise lab46()
+                                            raise lab45()
+                                        except lab46: pass
+                                        self.cursor = self.limit - v_37
+                                        if not self.eq_s_b(u"TSU"):
+                                            raise lab44()
+                                    except lab45: pass
+                                    self.bra = self.cursor
+                                    if not self.slice_del():
+                                        return False
+
+                                    self.cursor = self.limit - v_36
+                                    raise lab43()
+                                except lab44: pass
+                                self.cursor = self.limit - v_36
+                                if self.cursor <= self.limit_backward:
+                                    raise lab42()
+                                self.cursor -= 1
+                        except lab43: pass
+                        continue
+                    except lab42: pass
+                    self.cursor = self.limit - v_35
+                    break
+            except lab41: pass
+            self.cursor = self.limit - v_34
+        except lab29: pass
+        self.cursor = self.limit_backward
+        return True
+
+
+class lab0(BaseException): pass
+
+
+class lab1(BaseException): pass
+
+
+class lab2(BaseException): pass
+
+
+class lab3(BaseException): pass
+
+
+class lab4(BaseException): pass
+
+
+class lab5(BaseException): pass
+
+
+class lab6(BaseException): pass
+
+
+class lab7(BaseException): pass
+
+
+class lab8(BaseException): pass
+
+
+class lab9(BaseException): pass
+
+
+class lab10(BaseException): pass
+
+
+class lab11(BaseException): pass
+
+
+class lab12(BaseException): pass
+
+
+class lab13(BaseException): pass
+
+
+class lab14(BaseException): pass
+
+
+class lab15(BaseException): pass
+
+
+class lab16(BaseException): pass
+
+
+class lab17(BaseException): pass
+
+
+class lab18(BaseException): pass
+
+
+class lab19(BaseException): pass
+
+
+class lab20(BaseException): pass
+
+
+class lab21(BaseException): pass
+
+
+class lab22(BaseException): pass
+
+
+class lab23(BaseException): pass
+
+
+class lab24(BaseException): pass
+
+
+class lab25(BaseException): pass
+
+
+class lab26(BaseException): pass
+
+
+class lab27(BaseException): pass
+
+
+class lab28(BaseException): pass
+
+
+class lab29(BaseException): pass
+
+
+class lab30(BaseException): pass
+
+
+class lab31(BaseException): pass
+
+
+class lab32(BaseException): pass
+
+
+class lab33(BaseException): pass
+
+
+class lab34(BaseException): pass
+
+
+class lab35(BaseException): pass
+
+
+class lab36(BaseException): pass
+
+
+class lab37(BaseException): pass
+
+
+class lab38(BaseException): pass
+
+
+class lab39(BaseException): pass
+
+
+class lab40(BaseException): pass
+
+
+class lab41(BaseException): pass
+
+
+class lab42(BaseException): pass
+
+
+class lab43(BaseException): pass
+
+
+class lab44(BaseException): pass
+
+
+class lab45(BaseException): pass
+
+
+class lab46(BaseException): pass
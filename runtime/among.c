@@ -0,0 +1,210 @@
+
+#include <string.h> /* for memcmp, memcpy, memset */
+#include "header.h"
+
+/* Backward among lookup using packed lanes (see struct among_packed).
+ *
+ * The last symbols of the word are loaded into a buffer of the same width
+ * as a lane once, and then each candidate string is compared with a single
+ * SIMD comparison of the whole lane, only looking at the result for the
+ * symbols which are part of the string.  Only strings ending in the same
+ * symbol as the word are candidates, and they're tried longest first, so
+ * the first which matches (and whose routine, if any, succeeds) is the one
+ * find_among_b() would find.
+ */
+
+/* Return the first lane from k up to end - 1 whose string matches the end
+ * of the word, or end if there isn't one.  tail holds the last t->width
+ * symbols before the cursor, of which the last n are part of the word. */
+typedef int (*lane_kernel)(const struct among * v, const struct among_packed * t,
+                           const symbol * tail, int n, int k, int end);
+
+static int match_lanes_scalar(const struct among * v, const struct among_packed * t,
+                              const symbol * tail, int n, int k, int end) {
+    int width = t->width;
+    for (; k < end; k++) {
+        int size = v[t->index[k]].s_size;
+        if (size <= n &&
+            memcmp(tail + width - size, t->lanes + k * width + width - size, size) == 0) {
+            return k;
+        }
+    }
+    return end;
+}
+
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+# define SIMD_KERNELS 1
+# include <immintrin.h>
+
+/* Handles lanes of either width, as two halves for 32. */
+__attribute__((target("sse2")))
+static int match_lanes_sse2(const struct among * v, const struct among_packed * t,
+                            const symbol * tail, int n, int k, int end) {
+    if (t->width == 16) {
+        __m128i word = _mm_loadu_si128((const __m128i *)tail);
+        for (; k < end; k++) {
+            int size = v[t->index[k]].s_size;
+            unsigned int want, eq;
+            if (size > n) continue;
+            want = (0xFFFFu << (16 - size)) & 0xFFFFu;
+            eq = _mm_movemask_epi8(_mm_cmpeq_epi8(word,
+                     _mm_loadu_si128((const __m128i *)(t->lanes + k * 16))));
+            if ((eq & want) == want) return k;
+        }
+    } else {
+        __m128i lo = _mm_loadu_si128((const __m128i *)tail);
+        __m128i hi = _mm_loadu_si128((const __m128i *)(tail + 16));
+        for (; k < end; k++) {
+            const symbol * lane = t->lanes + k * 32;
+            int size = v[t->index[k]].s_size;
+            unsigned int want, eq;
+            if (size > n) continue;
+            want = 0xFFFFFFFFu << (32 - size);
+            eq = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(lo,
+                     _mm_loadu_si128((const __m128i *)lane))) |
+                 (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(hi,
+                     _mm_loadu_si128((const __m128i *)(lane + 16)))) << 16;
+            if ((eq & want) == want) return k;
+        }
+    }
+    return end;
+}
+
+__attribute__((target("avx2")))
+static int match_lanes_avx2(const struct among * v, const struct among_packed * t,
+                            const symbol * tail, int n, int k, int end) {
+    __m256i word;
+    if (t->width == 16) return match_lanes_sse2(v, t, tail, n, k, end);
+    word = _mm256_loadu_si256((const __m256i *)tail);
+    for (; k < end; k++) {
+        int size = v[t->index[k]].s_size;
+        unsigned int want, eq;
+        if (size > n) continue;
+        want = 0xFFFFFFFFu << (32 - size);
+        eq = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(word,
+                 _mm256_loadu_si256((const __m256i *)(t->lanes + k * 32))));
+        if ((eq & want) == want) return k;
+    }
+    return end;
+}
+
+static lane_kernel kernel;
+
+static lane_kernel get_kernel(void) {
+    lane_kernel k = __atomic_load_n(&kernel, __ATOMIC_RELAXED);
+    if (k == NULL) {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            k = match_lanes_avx2;
+        } else if (__builtin_cpu_supports("sse2")) {
+            k = match_lanes_sse2;
+        } else {
+            k = match_lanes_scalar;
+        }
+        __atomic_store_n(&kernel, k, __ATOMIC_RELAXED);
+    }
+    return k;
+}
+#else
+# define get_kernel() match_lanes_scalar
+#endif
+
+/* Try string i of among a, which matches before position c, in the same way
+ * as find_among_b() does. */
+static int try_string(struct SN_env * z, const struct among_table * a, int i, int c) {
+    int (* function)(struct SN_env *) = a->functions ? a->functions[i] : 0;
+    int res;
+    z->c = c - a->v[i].s_size;
+    if (function == 0) return 1;
+    res = function(z);
+    z->c = c - a->v[i].s_size;
+    return res != 0;
+}
+
+extern int find_among_b_packed(struct SN_env * z, const struct among_table * a,
+                               const struct among_packed * t) {
+    const struct among * v = a->v;
+    int c = z->c;
+    int n = c - z->lb;
+    if (n > 0) {
+        int ch = z->p[c - 1];
+        if (ch >= t->min_ch && ch <= t->max_ch) {
+            int k = t->bucket[ch - t->min_ch];
+            int end = t->bucket[ch - t->min_ch + 1];
+            if (k < end) {
+                lane_kernel match_lanes = get_kernel();
+                symbol buf[32];
+                int width = t->width;
+                const symbol * tail = z->p + c - width;
+                if (c < width) {
+                    /* The lane would start before the string. */
+                    memset(buf, 0, width - c);
+                    memcpy(buf + width - c, z->p, c);
+                    tail = buf;
+                }
+                while ((k = match_lanes(v, t, tail, n, k, end)) < end) {
+                    int i = t->index[k];
+                    if (a->functions && a->functions[i] && tail != buf) {
+                        /* The routine could change z->p. */
+                        memcpy(buf, tail, width);
+                        tail = buf;
+                    }
+                    if (try_string(z, a, i, c)) return v[i].result;
+                    k++;
+                }
+            }
+        }
+    }
+    if (t->empty >= 0 && try_string(z, a, t->empty, c)) return v[t->empty].result;
+    return 0;
+}
+
+/* Lookup of an among which can only match the whole of the rest of the
+ * string, using a minimal perfect hash of its strings (see struct
+ * among_hash).  Since a string can only match if it's the same length as
+ * the rest of the string, the lengths of the strings give a quick check
+ * first, and otherwise the only candidate is the string the hash gives.
+ * The hash must be the same as the compiler's among_hash().
+ */
+
+static unsigned int mix(unsigned int h, unsigned int d) {
+    h ^= d;
+    h ^= h >> 16;
+    h *= 0x85EBCA6BU;
+    h ^= h >> 13;
+    return h;
+}
+
+/* Return the index of the string of among a which is q[0] to q[n - 1], or
+ * -1 if there isn't one. */
+static int lookup_hash(const struct among_table * a, const struct among_hash * h,
+                       const symbol * q, int n) {
+    const struct among * w;
+    unsigned int k = 2166136261U;
+    int i;
+    if (n < 0 || n > 30 || !(h->lengths >> n & 1)) return -1;
+    for (i = 0; i < n; i++) {
+        k = (k ^ q[i]) * 16777619U;
+    }
+    i = h->slot[mix(k, h->displacement[mix(k, 0) % h->buckets]) % a->v_size];
+    w = a->v + i;
+    if (w->s_size != n ||
+        memcmp(q, a->pool + w->s_offset, n * sizeof(symbol)) != 0) return -1;
+    return i;
+}
+
+extern int find_among_hash(struct SN_env * z, const struct among_table * a,
+                           const struct among_hash * h) {
+    int i = lookup_hash(a, h, z->p + z->c, z->l - z->c);
+    if (i < 0) return 0;
+    z->c = z->l;
+    return a->v[i].result;
+}
+
+extern int find_among_hash_b(struct SN_env * z, const struct among_table * a,
+                             const struct among_hash * h) {
+    int i = lookup_hash(a, h, z->p + z->lb, z->c - z->lb);
+    if (i < 0) return 0;
+    z->c = z->lb;
+    return a->v[i].result;
+}
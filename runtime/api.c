@@ -1,36 +1,141 @@
 
-#include <stdlib.h> /* for calloc, free */
+#include <stdlib.h> /* for malloc, realloc, free */
+#include <string.h> /* for memset */
 #include "header.h"
 
+/* Counters may be updated from several threads at once. */
+#if defined __GNUC__
+# define COUNT(X) __atomic_fetch_add(&(X), 1, __ATOMIC_RELAXED)
+# define ADD(X, N) __atomic_fetch_add(&(X), (N), __ATOMIC_RELAXED)
+#else
+# define COUNT(X) ((X)++)
+# define ADD(X, N) ((X) += (N))
+#endif
+
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+# include <x86intrin.h>
+# define CLOCK() __rdtsc()
+#else
+# include <time.h>
+# define CLOCK() clock()
+#endif
+
+static void * default_malloc(void * context, size_t size) {
+    (void)context;
+    return malloc(size);
+}
+
+static void * default_realloc(void * context, void * p, size_t size) {
+    (void)context;
+    return realloc(p, size);
+}
+
+static void default_free(void * context, void * p) {
+    (void)context;
+    free(p);
+}
+
+static const struct SN_allocator default_allocator = {
+    default_malloc, default_realloc, default_free, NULL
+};
+
+static struct SN_allocator allocator = {
+    default_malloc, default_realloc, default_free, NULL
+};
+
+static struct SN_alloc_stats alloc_stats;
+
+/* Set the allocator used for all subsequent memory allocation, or restore
+ * the default (malloc, realloc and free) if NULL is passed.  This should be
+ * done before any SN_env is created, as memory must be freed by the
+ * allocator which allocated it.  The counts are reset. */
+extern void SN_set_allocator(const struct SN_allocator * a)
+{
+    allocator = a ? *a : default_allocator;
+    memset(&alloc_stats, 0, sizeof(alloc_stats));
+}
+
+extern void SN_get_alloc_stats(struct SN_alloc_stats * stats)
+{
+    *stats = alloc_stats;
+}
+
+extern void * SN_malloc(size_t size)
+{
+    COUNT(alloc_stats.mallocs);
+    return allocator.malloc(allocator.context, size);
+}
+
+extern void * SN_realloc(void * p, size_t size)
+{
+    COUNT(alloc_stats.reallocs);
+    return allocator.realloc(allocator.context, p, size);
+}
+
+extern void SN_free(void * p)
+{
+    if (p == NULL) return;
+    COUNT(alloc_stats.frees);
+    allocator.free(allocator.context, p);
+}
+
+/* Capacity of the strings stored inline in an SN_env.  Few words are longer
+ * than this, so stemming a typical word needs no further allocation. */
+#define INLINE_SIZE 51
+
+/* Bytes used by each inline string, including its header, rounded up so the
+ * next string's header is suitably aligned. */
+#define INLINE_BYTES \
+    ((HEAD + (INLINE_SIZE + 1) * sizeof(symbol) + sizeof(int) - 1) / \
+     sizeof(int) * sizeof(int))
+
+static symbol * create_inline_s(char * mem) {
+    symbol * p = (symbol *) (HEAD + mem);
+    IS_INLINE(p) = 1;
+    CAPACITY(p) = INLINE_SIZE;
+    SET_SIZE(p, 0);
+    return p;
+}
+
+/* The SN_env, its index, its S and I arrays, and the initial buffers for p and each
+ * string variable are all carved out of a single allocation.  If a string
+ * outgrows its inline buffer, increase_size() moves it to the heap.
+ */
 extern struct SN_env * SN_create_env(int S_size, int I_size)
 {
-    struct SN_env * z = (struct SN_env *) calloc(1, sizeof(struct SN_env));
-    if (z == NULL) return NULL;
-    z->p = create_s();
-    if (z->p == NULL) goto error;
+    size_t index_offset = sizeof(struct SN_env);
+    size_t S_offset = index_offset + sizeof(struct SN_index);
+    size_t I_offset = S_offset + S_size * sizeof(symbol *);
+    size_t p_offset = I_offset + I_size * sizeof(int);
+    char * mem;
+    struct SN_env * z;
+    int i;
+
+    /* Align the first string header (the S array may leave us misaligned
+     * if pointers are smaller than ints). */
+    p_offset = (p_offset + sizeof(int) - 1) / sizeof(int) * sizeof(int);
+    mem = (char *) SN_malloc(p_offset + (1 + S_size) * INLINE_BYTES);
+    if (mem == NULL) return NULL;
+    memset(mem, 0, p_offset + (1 + S_size) * INLINE_BYTES);
+
+    z = (struct SN_env *) mem;
+    z->p = create_inline_s(mem + p_offset);
+    z->index = (struct SN_index *) (mem + index_offset);
     if (S_size)
     {
-        int i;
-        z->S = (symbol * *) calloc(S_size, sizeof(symbol *));
-        if (z->S == NULL) goto error;
-
+        z->S = (symbol * *) (mem + S_offset);
         for (i = 0; i < S_size; i++)
         {
-            z->S[i] = create_s();
-            if (z->S[i] == NULL) goto error;
+            z->S[i] = create_inline_s(mem + p_offset + (1 + i) * INLINE_BYTES);
         }
     }
 
     if (I_size)
     {
-        z->I = (int *) calloc(I_size, sizeof(int));
-        if (z->I == NULL) goto error;
+        z->I = (int *) (mem + I_offset);
     }
 
     return z;
-error:
-    SN_close_env(z, S_size);
-    return NULL;
 }
 
 extern void SN_close_env(struct SN_env * z, int S_size)
@@ -43,11 +148,10 @@ extern void SN_close_env(struct SN_env * z, int S_size)
         {
             lose_s(z->S[i]);
         }
-        free(z->S);
     }
-    free(z->I);
     if (z->p) lose_s(z->p);
-    free(z);
+    SN_free(z->index->start);
+    SN_free(z);
 }
 
 extern int SN_set_current(struct SN_env * z, int size, const symbol * s)
@@ -56,3 +160,159 @@ extern int SN_set_current(struct SN_env * z, int size, const symbol * s)
     z->c = 0;
     return err;
 }
+
+/* The profiles of the stemmers generated with -profile which have created
+ * an SN_env, most recent first. */
+static struct SN_profile * profiles;
+
+extern void SN_profile_register(struct SN_profile * profile)
+{
+#if defined __GNUC__
+    if (__atomic_load_n(&profile->registered, __ATOMIC_ACQUIRE)) return;
+    if (__atomic_exchange_n(&profile->registered, 1, __ATOMIC_ACQ_REL)) return;
+    profile->next = __atomic_load_n(&profiles, __ATOMIC_RELAXED);
+    while (!__atomic_compare_exchange_n(&profiles, &profile->next, profile, 1,
+                                        __ATOMIC_RELEASE, __ATOMIC_RELAXED)) { }
+#else
+    if (profile->registered) return;
+    profile->registered = 1;
+    profile->next = profiles;
+    profiles = profile;
+#endif
+}
+
+extern SN_cycles SN_profile_clock(void)
+{
+    return CLOCK();
+}
+
+extern int SN_profile_routine(struct SN_profile_routine * r, int ret, SN_cycles start)
+{
+    COUNT(r->calls);
+    if (ret > 0) COUNT(r->successes);
+    ADD(r->cycles, CLOCK() - start);
+    return ret;
+}
+
+extern void SN_profile_among(struct SN_profile_among * a, int result)
+{
+    int i = result < 0 ? 0 : result + 1;
+    if (i < a->size) COUNT(a->counts[i]);
+}
+
+static struct SN_profile * first_profile(void)
+{
+#if defined __GNUC__
+    return __atomic_load_n(&profiles, __ATOMIC_ACQUIRE);
+#else
+    return profiles;
+#endif
+}
+
+/* JSON written so far by SN_profile_dump(), of which the first size bytes
+ * go in out. */
+struct json {
+    char * out;
+    int size;
+    int len;
+};
+
+static void put(struct json * j, const char * s)
+{
+    for (; *s; s++) {
+        if (j->len < j->size) j->out[j->len] = *s;
+        j->len++;
+    }
+}
+
+static void put_number(struct json * j, SN_cycles n)
+{
+    char buf[24];
+    int i = sizeof(buf) - 1;
+    buf[i] = '\0';
+    do {
+        buf[--i] = '0' + n % 10;
+        n /= 10;
+    } while (n);
+    put(j, buf + i);
+}
+
+static void put_string(struct json * j, const char * s)
+{
+    char ch[3] = { '\\', 0, 0 };
+    put(j, "\"");
+    for (; *s; s++) {
+        ch[1] = *s;
+        put(j, *s == '"' || *s == '\\' ? ch : ch + 1);
+    }
+    put(j, "\"");
+}
+
+extern int SN_profile_dump(char * out, int out_size)
+{
+    struct json j;
+    struct SN_profile * p;
+    j.out = out;
+    j.size = out_size;
+    j.len = 0;
+    put(&j, "[");
+    for (p = first_profile(); p; p = p->next) {
+        int i, k;
+        put(&j, "\n {\"stemmer\": ");
+        put_string(&j, p->name);
+        put(&j, ",\n  \"routines\": [");
+        for (i = 0; i < p->routine_count; i++) {
+            const struct SN_profile_routine * r = p->routines + i;
+            put(&j, i ? ",\n   {\"name\": " : "\n   {\"name\": ");
+            put_string(&j, r->name);
+            put(&j, ", \"calls\": ");
+            put_number(&j, r->calls);
+            put(&j, ", \"successes\": ");
+            put_number(&j, r->successes);
+            put(&j, ", \"cycles\": ");
+            put_number(&j, r->cycles);
+            put(&j, "}");
+        }
+        put(&j, "],\n  \"amongs\": [");
+        for (i = 0; i < p->among_count; i++) {
+            const struct SN_profile_among * a = p->amongs + i;
+            unsigned long lookups = 0;
+            for (k = 0; k < a->size; k++) lookups += a->counts[k];
+            put(&j, i ? ",\n   {\"line\": " : "\n   {\"line\": ");
+            put_number(&j, a->line_number);
+            put(&j, ", \"lookups\": ");
+            put_number(&j, lookups);
+            put(&j, ", \"misses\": ");
+            put_number(&j, a->counts[1]);
+            put(&j, ", \"no_command\": ");
+            put_number(&j, a->counts[0]);
+            put(&j, ", \"commands\": [");
+            for (k = 2; k < a->size; k++) {
+                if (k > 2) put(&j, ", ");
+                put_number(&j, a->counts[k]);
+            }
+            put(&j, "]}");
+        }
+        put(&j, p->next ? "]}," : "]}\n");
+    }
+    put(&j, "]\n");
+    if (j.len < out_size) out[j.len] = '\0';
+    return j.len;
+}
+
+extern void SN_profile_reset(void)
+{
+    struct SN_profile * p;
+    for (p = first_profile(); p; p = p->next) {
+        int i;
+        for (i = 0; i < p->routine_count; i++) {
+            struct SN_profile_routine * r = p->routines + i;
+            r->calls = 0;
+            r->successes = 0;
+            r->cycles = 0;
+        }
+        for (i = 0; i < p->among_count; i++) {
+            memset(p->amongs[i].counts, 0, p->amongs[i].size * sizeof(unsigned long));
+        }
+    }
+}
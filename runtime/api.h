@@ -1,11 +1,19 @@
 
+#include <stddef.h> /* for size_t */
+
+#ifdef SNOWBALL_UTF32
+/* Each symbol is a Unicode code point, and stemmers must be generated with
+   -widechars.  libstemmer converts to and from UTF-8. */
+typedef unsigned int symbol;
+#else
 typedef unsigned char symbol;
+#endif
 
 /* Or replace 'char' above with 'short' for 16 bit characters.
 
    More precisely, replace 'char' with whatever type guarantees the
    character width you need. Note however that sizeof(symbol) should divide
-   HEAD, defined in header.h as 2*sizeof(int), without remainder, otherwise
+   HEAD, defined in header.h as 3*sizeof(int), without remainder, otherwise
    there is an alignment problem. In the unlikely event of a problem here,
    consult Martin Porter.
 
@@ -16,17 +24,93 @@ struct SN_env {
     int c; int l; int lb; int bra; int ket;
     symbol * * S;
     int * I;
+    struct SN_index * index; /* see header.h */
+};
+
+/* Memory allocation functions used by the runtime.  Each is passed the
+   context pointer, and they have the same semantics as the corresponding
+   standard C functions. */
+struct SN_allocator {
+    void * (*malloc)(void * context, size_t size);
+    void * (*realloc)(void * context, void * p, size_t size);
+    void (*free)(void * context, void * p);
+    void * context;
+};
+
+/* Counts of calls made to the allocator. */
+struct SN_alloc_stats {
+    unsigned long mallocs;
+    unsigned long reallocs;
+    unsigned long frees;
 };
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+extern void SN_set_allocator(const struct SN_allocator * allocator);
+extern void SN_get_alloc_stats(struct SN_alloc_stats * stats);
+extern void * SN_malloc(size_t size);
+extern void * SN_realloc(void * p, size_t size);
+extern void SN_free(void * p);
+
 extern struct SN_env * SN_create_env(int S_size, int I_size);
 extern void SN_close_env(struct SN_env * z, int S_size);
 
 extern int SN_set_current(struct SN_env * z, int size, const symbol * s);
 
+/* Unicode simple case folding of code point ch. */
+extern int SN_fold_case(int ch);
+/* Non-zero if code point ch is a letter, mark or number. */
+extern int SN_is_word_char(int ch);
+/* Decode the UTF-8 sequence at p (with n > 0 bytes available) into *ch,
+   returning its length.  Invalid, overlong or truncated sequences and
+   surrogates decode to -1 with length 1. */
+extern int SN_decode_utf8(const unsigned char * p, int n, int * ch);
+/* Encode code point ch as UTF-8 at p, returning the length (at most 4). */
+extern int SN_encode_utf8(int ch, unsigned char * p);
+/* Validate and case fold the UTF-8 string s of the given size into out,
+   which has room for out_size bytes.  Returns the length of the folded
+   string (if this is more than out_size, out is only partly written), or -1
+   if s isn't valid UTF-8. */
+extern int SN_fold_utf8(const unsigned char * s, int size, unsigned char * out, int out_size);
+
+/* Write the counters of the stemmers generated with -profile which have
+   been used (see struct SN_profile) as JSON to out, which has room for
+   out_size bytes.  Returns the length of the JSON - if this isn't less than
+   out_size, out is only partly written, otherwise it's NUL-terminated. */
+extern int SN_profile_dump(char * out, int out_size);
+/* Zero the counters of all the stemmers generated with -profile. */
+extern void SN_profile_reset(void);
+
+/* A stemmer compiled with "snowball -bytecode", which is run by the
+   interpreter in vm.c (see bytecode.h for the format). */
+struct SN_program;
+
+/* Load the size bytes of bytecode at data, which needn't be kept after this
+   returns.  Returns NULL if the data isn't a valid program for this build of
+   the runtime (programs for -widechars only run in the SNOWBALL_UTF32
+   build, and the others only outside it), or on running out of memory. */
+extern struct SN_program * SN_load_program(const void * data, size_t size);
+extern void SN_free_program(struct SN_program * program);
+/* SN_BYTECODE_SINGLEBYTE, SN_BYTECODE_UTF8 or SN_BYTECODE_WIDECHARS. */
+extern int SN_program_encoding(const struct SN_program * program);
+/* Create and close an SN_env with the variables program needs. */
+extern struct SN_env * SN_program_create_env(const struct SN_program * program);
+extern void SN_program_close_env(const struct SN_program * program, struct SN_env * z);
+/* Run the program's "stem" external on z, returning what it returns. */
+extern int SN_run_program(const struct SN_program * program, struct SN_env * z);
+
+#ifdef SNOWBALL_UTF32
+/* Set the current string to the UTF-8 string s.  Each byte which isn't part
+   of a valid sequence becomes U+DC80 to U+DCFF, so it is written back
+   unchanged by SN_get_current_utf8().  Returns 0 on success, -1 on error. */
+extern int SN_set_current_utf8(struct SN_env * z, int size, const unsigned char * s);
+/* Write the current string to out as UTF-8, returning its length (if this
+   is more than out_size, out is only partly written). */
+extern int SN_get_current_utf8(struct SN_env * z, unsigned char * out, int out_size);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
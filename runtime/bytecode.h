@@ -0,0 +1,193 @@
+/* The bytecode written by "snowball -bytecode" and run by the interpreter
+ * in vm.c.  Both the compiler and the runtime include this file, so it is
+ * the only description of the format they have to agree on.
+ *
+ * A file is a sequence of little-endian unsigned 32-bit words, except that
+ * strings and grouping bitmaps are packed as described below:
+ *
+ *     "SNBC"              magic
+ *     version             SN_BYTECODE_VERSION
+ *     encoding            SN_BYTECODE_SINGLEBYTE, _UTF8 or _WIDECHARS
+ *     S_size              number of string variables
+ *     I_size              number of integer and boolean variables
+ *     routine_count       routines and externals
+ *     external_count
+ *     literal_count
+ *     grouping_count
+ *     among_count
+ *     code_size           in words
+ *
+ * followed by
+ *
+ *     literal_count literals: a size, then that many symbols
+ *     grouping_count groupings: min, max, then (max - min + 8) / 8 bytes
+ *         with bit ch - min set for each character ch of the grouping
+ *     among_count amongs: a string count n and pool size, then the pool of
+ *         symbols, then n entries of 16-bit s_offset, s_size, substring_i,
+ *         result and routine (-1 if none), as in struct among
+ *     routine_count routines: start, size (both in words of code), locals
+ *         and envs
+ *     external_count externals: a name size, the name as bytes, and the
+ *         routine it runs
+ *     code_size words of code
+ *
+ * Symbols take 1 byte for single byte encodings and UTF-8, and 2 bytes for
+ * -widechars.  Strings of an among are in the order find_among() needs.
+ *
+ * Each instruction is an opcode followed by its operands, which are listed
+ * in SN_BYTECODE_OPS as:
+ *
+ *     F   code offset to go to if the instruction fails
+ *     J   code offset to go to
+ *     R   routine
+ *     k   local slot of the routine, for a saved cursor, limit or count
+ *     e   saved SN_env slot of the routine, for $
+ *     i   integer or boolean variable, as an index into z->I
+ *     s   string variable, as an index into z->S
+ *     l   literal
+ *     g   grouping
+ *     a   among
+ *     n   number, or symbol
+ *
+ * and an instruction pops and pushes the numbers given on the stack used
+ * for arithmetic.  The stack is empty at each instruction which can be
+ * jumped to, and after any jump.  Code offsets are from the start of the
+ * code, but must be within the routine.  SWITCH has a variable number of
+ * operands.  Failing goes to F, and returning an error returns it from the
+ * routine straight away.
+ */
+
+#define SN_BYTECODE_MAGIC "SNBC"
+#define SN_BYTECODE_VERSION 1
+
+#define SN_BYTECODE_SINGLEBYTE 0
+#define SN_BYTECODE_UTF8 1
+#define SN_BYTECODE_WIDECHARS 2
+
+/* Limits on what a routine may use. */
+#define SN_BYTECODE_MAX_STACK 32
+#define SN_BYTECODE_MAX_LOCALS 64
+#define SN_BYTECODE_MAX_ENVS 4
+
+#define SN_BYTECODE_OPS(X) \
+    /* Control. */ \
+    X(GOTO, "J", 0, 0)              /* go to J */ \
+    X(RETURN0, "", 0, 0)            /* return 0 (fail) */ \
+    X(RETURN1, "", 0, 0)            /* return 1 (succeed) */ \
+    X(CALL, "FR", 0, 0)             /* call R, failing if it does */ \
+    X(CALL_DO, "R", 0, 0)           /* call R, ignoring failure */ \
+    X(SWITCH, "nJ", 0, 0)           /* n, end, then n targets: go to the \
+                                       target for among_var, or to end */ \
+    X(LOOP, "kJ", 0, 0)             /* if k <= 0 go to J, else k-- */ \
+    /* Saving and restoring the cursor and limits. */ \
+    X(KEEP, "k", 0, 0)              /* k = c */ \
+    X(KEEP_B, "k", 0, 0)            /* k = l - c */ \
+    X(RESTORE, "k", 0, 0)           /* c = k */ \
+    X(RESTORE_B, "k", 0, 0)         /* c = l - k */ \
+    X(SETLIMIT, "k", 0, 0)          /* k = l - c; l = c */ \
+    X(SETLIMIT_B, "k", 0, 0)        /* k = lb; lb = c */ \
+    X(SETLIMIT_TO, "k", 1, 0)       /* k = l - c; l = pop */ \
+    X(SETLIMIT_TO_B, "k", 1, 0)     /* k = lb; lb = pop */ \
+    X(RESTORE_LIMIT, "k", 0, 0)     /* l += k */ \
+    X(RESTORE_LIMIT_B, "k", 0, 0)   /* lb = k */ \
+    X(BACKWARDS, "", 0, 0)          /* lb = c; c = l */ \
+    X(END_BACKWARDS, "", 0, 0)      /* c = lb */ \
+    X(DOLLAR, "se", 0, 0)           /* e = *z, and work on s */ \
+    X(END_DOLLAR, "se", 0, 0)       /* s = z->p; *z = e */ \
+    /* Arithmetic. */ \
+    X(PUSH, "n", 0, 1) \
+    X(PUSH_VAR, "i", 0, 1) \
+    X(PUSH_LOCAL, "k", 0, 1) \
+    X(PUSH_C, "", 0, 1) \
+    X(PUSH_L, "", 0, 1) \
+    X(PUSH_LB, "", 0, 1) \
+    X(PUSH_SIZE, "", 0, 1) \
+    X(PUSH_LEN, "", 0, 1) \
+    X(PUSH_SIZEOF, "s", 0, 1) \
+    X(PUSH_LENOF, "s", 0, 1) \
+    X(NEG, "", 1, 1) \
+    X(ADD, "", 2, 1) \
+    X(SUB, "", 2, 1) \
+    X(MUL, "", 2, 1) \
+    X(DIV, "", 2, 1) \
+    X(POP_LOCAL, "k", 1, 0) \
+    X(DEC_LOCAL, "k", 0, 0) \
+    X(SET_VAR, "i", 1, 0) \
+    X(ADD_VAR, "i", 1, 0) \
+    X(SUB_VAR, "i", 1, 0) \
+    X(MUL_VAR, "i", 1, 0) \
+    X(DIV_VAR, "i", 1, 0) \
+    X(SETMARK, "i", 0, 0) \
+    X(TEST_EQ, "F", 2, 0)           /* fail unless a == b, where b is \
+                                       popped first */ \
+    X(TEST_NE, "F", 2, 0) \
+    X(TEST_GT, "F", 2, 0) \
+    X(TEST_GE, "F", 2, 0) \
+    X(TEST_LT, "F", 2, 0) \
+    X(TEST_LE, "F", 2, 0) \
+    /* Moving the cursor. */ \
+    X(TOMARK, "F", 1, 0) \
+    X(TOMARK_B, "F", 1, 0) \
+    X(ATMARK, "F", 1, 0) \
+    X(HOP, "F", 1, 0) \
+    X(HOP_B, "F", 1, 0) \
+    X(HOP_U, "F", 1, 0)             /* UTF-8 */ \
+    X(HOP_B_U, "F", 1, 0) \
+    X(HOPN, "Fn", 0, 0)             /* c += n, then fail if past l */ \
+    X(HOPN_B, "Fn", 0, 0) \
+    X(NEXT, "F", 0, 0) \
+    X(NEXT_B, "F", 0, 0) \
+    X(NEXT_U, "F", 0, 0) \
+    X(NEXT_B_U, "F", 0, 0) \
+    X(TOLIMIT, "", 0, 0) \
+    X(TOLIMIT_B, "", 0, 0) \
+    X(ATLIMIT, "F", 0, 0) \
+    X(ATLIMIT_B, "F", 0, 0) \
+    X(BRA, "", 0, 0)                /* bra = c */ \
+    X(KET, "", 0, 0)                /* ket = c */ \
+    /* Booleans. */ \
+    X(SET, "i", 0, 0) \
+    X(UNSET, "i", 0, 0) \
+    X(BOOLTEST, "Fi", 0, 0) \
+    /* Tests. */ \
+    X(CHAR, "Fn", 0, 0) \
+    X(CHAR_B, "Fn", 0, 0) \
+    X(EQ_S, "Fl", 0, 0) \
+    X(EQ_S_B, "Fl", 0, 0) \
+    X(EQ_V, "Fs", 0, 0) \
+    X(EQ_V_B, "Fs", 0, 0) \
+    X(GROUPING, "Fg", 0, 0) \
+    X(GROUPING_B, "Fg", 0, 0) \
+    X(NON, "Fg", 0, 0) \
+    X(NON_B, "Fg", 0, 0) \
+    X(GOTO_GROUPING, "Fg", 0, 0) \
+    X(GOTO_GROUPING_B, "Fg", 0, 0) \
+    X(GOTO_NON, "Fg", 0, 0) \
+    X(GOTO_NON_B, "Fg", 0, 0) \
+    X(GOPAST_GROUPING, "Fg", 0, 0) \
+    X(GOPAST_GROUPING_B, "Fg", 0, 0) \
+    X(GOPAST_NON, "Fg", 0, 0) \
+    X(GOPAST_NON_B, "Fg", 0, 0) \
+    X(AMONG, "Fa", 0, 0)            /* set among_var, failing if 0 */ \
+    X(AMONG_B, "Fa", 0, 0) \
+    /* Changing the string. */ \
+    X(DELETE, "", 0, 0) \
+    X(SLICE_FROM_S, "l", 0, 0) \
+    X(SLICE_FROM_V, "s", 0, 0) \
+    X(INSERT_S, "l", 0, 0)          /* insert at c, moving c past it */ \
+    X(INSERT_V, "s", 0, 0) \
+    X(ATTACH_S, "l", 0, 0)          /* insert at c, leaving c */ \
+    X(ATTACH_V, "s", 0, 0) \
+    X(ASSIGN_S, "l", 0, 0)          /* replace c to l, leaving c */ \
+    X(ASSIGN_V, "s", 0, 0) \
+    X(ASSIGN_S_B, "l", 0, 0)        /* replace lb to c */ \
+    X(ASSIGN_V_B, "s", 0, 0) \
+    X(ASSIGNTO, "s", 0, 0) \
+    X(SLICETO, "s", 0, 0)
+
+#define SN_BYTECODE_ENUM(NAME, OPERANDS, POPS, PUSHES) SN_OP_##NAME,
+enum SN_bytecode_op {
+    SN_BYTECODE_OPS(SN_BYTECODE_ENUM)
+    SN_OP_COUNT
+};
+#undef SN_BYTECODE_ENUM
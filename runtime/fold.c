@@ -0,0 +1,130 @@
+
+#include <string.h> /* for memcpy */
+#include "api.h"
+
+/* Case folding and validation of UTF-8 strings.
+ *
+ * Most text is mainly ASCII, so runs of ASCII characters are handled by a
+ * kernel which folds a block at a time using SSE2 or AVX2 where the CPU
+ * supports them, chosen when first used.  Two byte sequences (the Latin,
+ * Greek, Cyrillic and Armenian scripts) are decoded inline and folded by
+ * table lookup, and anything else goes through SN_decode_utf8().  The
+ * result is the same whichever kernel is used.
+ */
+
+/* Fold the ASCII characters at the start of s (which has n > 0 bytes,
+ * the first of which is ASCII) into out, returning how many there were. */
+typedef int (*ascii_kernel)(const unsigned char * s, int n, unsigned char * out);
+
+static int fold_ascii_scalar(const unsigned char * s, int n, unsigned char * out) {
+    int i;
+    for (i = 0; i < n && s[i] < 0x80; i++) {
+        int ch = s[i];
+        out[i] = (ch >= 'A' && ch <= 'Z') ? ch + ('a' - 'A') : ch;
+    }
+    return i;
+}
+
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+# define SIMD_KERNELS 1
+# include <immintrin.h>
+
+/* The bytes are known to be below 0x80, so signed comparisons work. */
+__attribute__((target("sse2")))
+static int fold_ascii_sse2(const unsigned char * s, int n, unsigned char * out) {
+    const __m128i before_a = _mm_set1_epi8('A' - 1);
+    const __m128i after_z = _mm_set1_epi8('Z' + 1);
+    const __m128i lower_bit = _mm_set1_epi8(0x20);
+    int i = 0;
+    while (i + 16 <= n) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(s + i));
+        __m128i upper;
+        if (_mm_movemask_epi8(x)) break;
+        upper = _mm_and_si128(_mm_cmpgt_epi8(x, before_a),
+                              _mm_cmpgt_epi8(after_z, x));
+        x = _mm_or_si128(x, _mm_and_si128(upper, lower_bit));
+        _mm_storeu_si128((__m128i *)(out + i), x);
+        i += 16;
+    }
+    return i + fold_ascii_scalar(s + i, n - i, out + i);
+}
+
+__attribute__((target("avx2")))
+static int fold_ascii_avx2(const unsigned char * s, int n, unsigned char * out) {
+    const __m256i before_a = _mm256_set1_epi8('A' - 1);
+    const __m256i after_z = _mm256_set1_epi8('Z' + 1);
+    const __m256i lower_bit = _mm256_set1_epi8(0x20);
+    int i = 0;
+    while (i + 32 <= n) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(s + i));
+        __m256i upper;
+        if (_mm256_movemask_epi8(x)) break;
+        upper = _mm256_and_si256(_mm256_cmpgt_epi8(x, before_a),
+                                 _mm256_cmpgt_epi8(after_z, x));
+        x = _mm256_or_si256(x, _mm256_and_si256(upper, lower_bit));
+        _mm256_storeu_si256((__m256i *)(out + i), x);
+        i += 32;
+    }
+    return i + fold_ascii_sse2(s + i, n - i, out + i);
+}
+
+static ascii_kernel kernel;
+
+static ascii_kernel get_kernel(void) {
+    ascii_kernel k = __atomic_load_n(&kernel, __ATOMIC_RELAXED);
+    if (k == NULL) {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            k = fold_ascii_avx2;
+        } else if (__builtin_cpu_supports("sse2")) {
+            k = fold_ascii_sse2;
+        } else {
+            k = fold_ascii_scalar;
+        }
+        __atomic_store_n(&kernel, k, __ATOMIC_RELAXED);
+    }
+    return k;
+}
+#else
+# define get_kernel() fold_ascii_scalar
+#endif
+
+extern int SN_fold_utf8(const unsigned char * s, int size, unsigned char * out, int out_size) {
+    ascii_kernel fold_ascii = get_kernel();
+    int i = 0;
+    int j = 0;
+    while (i < size) {
+        int b = s[i];
+        int ch;
+        if (b < 0x80) {
+            int n = size - i;
+            if (n > out_size - j) n = out_size - j;
+            if (n > 0) {
+                n = fold_ascii(s + i, n, out + j);
+            } else {
+                /* out is full, so just count. */
+                n = 1;
+            }
+            i += n;
+            j += n;
+            continue;
+        }
+        if (b >= 0xC2 && b < 0xE0 && i + 1 < size && (s[i + 1] & 0xC0) == 0x80) {
+            ch = SN_fold_case(((b & 0x1F) << 6) | (s[i + 1] & 0x3F));
+            i += 2;
+        } else {
+            i += SN_decode_utf8(s + i, size - i, &ch);
+            if (ch < 0) return -1;
+            ch = SN_fold_case(ch);
+        }
+        if (out_size - j >= 4) {
+            j += SN_encode_utf8(ch, out + j);
+        } else {
+            unsigned char buf[4];
+            int len = SN_encode_utf8(ch, buf);
+            if (len <= out_size - j) memcpy(out + j, buf, len);
+            j += len;
+        }
+    }
+    return j;
+}
@@ -6,20 +6,105 @@
 #define MAXINT INT_MAX
 #define MININT INT_MIN
 
-#define HEAD 2*sizeof(int)
+#define HEAD 3*sizeof(int)
 
 #define SIZE(p)        ((int *)(p))[-1]
 #define SET_SIZE(p, n) ((int *)(p))[-1] = n
 #define CAPACITY(p)    ((int *)(p))[-2]
+/* Non-zero if the string is stored inside the SN_env's own allocation (see
+ * SN_create_env()), so must not be passed to realloc() or free(). */
+#define IS_INLINE(p)   ((int *)(p))[-3]
 
+/* An among string, which is pool[s_offset] to pool[s_offset + s_size - 1]
+ * in its among's string pool. */
 struct among
-{   int s_size;     /* number of chars in string */
-    const symbol * s;       /* search string */
-    int substring_i;/* index to longest matching substring */
-    int result;     /* result of the lookup */
-    int (* function)(struct SN_env *);
+{   unsigned short s_offset;
+    unsigned short s_size;  /* number of chars in string */
+    short substring_i;      /* index to longest matching substring */
+    short result;           /* result of the lookup */
 };
 
+/* The strings of an among for find_among() and find_among_b(), sorted, and
+ * their routines.  functions is 0 if no string has a routine, and otherwise
+ * has the routine (or 0) for each string. */
+struct among_table
+{   const struct among * v;
+    int v_size;
+    const symbol * pool;
+    int (* const * functions)(struct SN_env *);
+};
+
+/* The strings of an among packed for find_among_b_packed().  Each string is
+ * right-aligned in a lane of width symbols, with zeros before it.  Lanes are
+ * grouped by the last symbol of their string, which is between min_ch and
+ * max_ch - the lanes for strings ending in ch are bucket[ch - min_ch] up to
+ * bucket[ch - min_ch + 1] - 1, longest first.  The empty string (if there is
+ * one) has no lane. */
+struct among_packed
+{   int width;      /* 16 or 32 */
+    int min_ch;
+    int max_ch;
+    int empty;      /* index of the empty string in the among, or -1 */
+    const unsigned short * bucket;
+    const symbol * lanes;
+    const unsigned short * index; /* index in the among for each lane */
+};
+
+/* A minimal perfect hash of the strings of an among, for an among which
+ * can only match the whole of the rest of the string.  A string with hash
+ * h (see find_among_hash()) can only be the one in slot[h' % v_size], where
+ * h' is h rehashed with displacement[h % buckets]. */
+struct among_hash
+{   unsigned int lengths;   /* bit n is set if there's a string of n symbols */
+    int buckets;
+    const unsigned short * displacement;
+    const short * slot;     /* index in the among of the string in each slot */
+};
+
+/* A character replaced by translate(): the symbols pool[from] to
+ * pool[from + from_size - 1] are replaced by pool[to] to
+ * pool[to + to_size - 1]. */
+struct translation_entry
+{   unsigned short from;
+    unsigned short from_size;
+    unsigned short to;
+    unsigned short to_size;
+};
+
+/* The characters replaced by a loop of the form
+ *
+ *     repeat ( [substring] among ( ... '' (next) ) )
+ *
+ * or "repeat ( ( [substring] among ( ... ) ) or next )", in either
+ * direction, where each string of the among is a single character which is
+ * replaced by a literal string, deleted or left alone.  Character ch (a code
+ * point for UTF-8) has entry index[page[(ch >> 8) - min_page] + (ch & 0xFF)]
+ * - 1, if ch >> 8 is from min_page to max_page and that isn't -1.  Pages
+ * with no entries start at index 0, where there are 256 zeros. */
+struct translation
+{   int min_page;
+    int max_page;
+    int empty;      /* does the among have the empty string? */
+    const unsigned short * page;
+    const unsigned short * index;
+    const struct translation_entry * entry;
+    const symbol * pool;
+};
+
+/* Character offsets in a UTF-8 string, so len, lenof and hop don't have to
+ * decode it each time (see lenof_utf8() and hop_utf8()).  It's built when
+ * first needed for z->p, if that's long enough, and discarded by replace_s()
+ * etc whenever a string changes. */
+struct SN_index
+{   const symbol * p;   /* the string indexed, or NULL if none */
+    int len;            /* its length in characters, or negative if not built */
+    int capacity;       /* number of entries in start and pos */
+    int * start;        /* start[k] is the offset of character k, and start[len] is SIZE(p) */
+    int * pos;          /* pos[c] is k if start[k] is c, and otherwise -1 */
+};
+
+#define DISCARD_INDEX(z) ((z)->index->p = NULL)
+
 extern symbol * create_s(void);
 extern void lose_s(symbol * p);
 
@@ -37,13 +122,39 @@ extern int in_grouping_b(struct SN_env * z, const unsigned char * s, int min, in
 extern int out_grouping(struct SN_env * z, const unsigned char * s, int min, int max, int repeat);
 extern int out_grouping_b(struct SN_env * z, const unsigned char * s, int min, int max, int repeat);
 
+/* The same tests using a table with an entry for each byte value, which is
+ * non-zero for the characters in the grouping.  For UTF-8 the entries for
+ * bytes 0x80 and above are instead non-zero if a character in the grouping
+ * could start with that byte, and the character is then looked up in s. */
+extern int in_class(struct SN_env * z, const unsigned char * t, int repeat);
+extern int in_class_b(struct SN_env * z, const unsigned char * t, int repeat);
+extern int out_class(struct SN_env * z, const unsigned char * t, int repeat);
+extern int out_class_b(struct SN_env * z, const unsigned char * t, int repeat);
+
+extern int in_class_U(struct SN_env * z, const unsigned char * t, const unsigned char * s, int min, int max, int repeat);
+extern int in_class_b_U(struct SN_env * z, const unsigned char * t, const unsigned char * s, int min, int max, int repeat);
+extern int out_class_U(struct SN_env * z, const unsigned char * t, const unsigned char * s, int min, int max, int repeat);
+extern int out_class_b_U(struct SN_env * z, const unsigned char * t, const unsigned char * s, int min, int max, int repeat);
+
+/* Equivalent to in_class(z, t, 1) etc, but testing many bytes at a time.
+ * scan is 32 bytes, and byte b is in the grouping if bit (b >> 4) & 7 of
+ * scan[b & 0xF] (for b below 0x80) or of scan[16 + (b & 0xF)] (otherwise)
+ * is set.  For UTF-8 only the first 16 are used. */
+extern int in_class_scan(struct SN_env * z, const unsigned char * t, const unsigned char * scan);
+extern int out_class_scan(struct SN_env * z, const unsigned char * t, const unsigned char * scan);
+extern int in_class_scan_U(struct SN_env * z, const unsigned char * t, const unsigned char * scan, const unsigned char * s, int min, int max);
+extern int out_class_scan_U(struct SN_env * z, const unsigned char * t, const unsigned char * scan, const unsigned char * s, int min, int max);
+
 extern int eq_s(struct SN_env * z, int s_size, const symbol * s);
 extern int eq_s_b(struct SN_env * z, int s_size, const symbol * s);
 extern int eq_v(struct SN_env * z, const symbol * p);
 extern int eq_v_b(struct SN_env * z, const symbol * p);
 
-extern int find_among(struct SN_env * z, const struct among * v, int v_size);
-extern int find_among_b(struct SN_env * z, const struct among * v, int v_size);
+extern int find_among(struct SN_env * z, const struct among_table * t);
+extern int find_among_b(struct SN_env * z, const struct among_table * t);
+extern int find_among_b_packed(struct SN_env * z, const struct among_table * a, const struct among_packed * t);
+extern int find_among_hash(struct SN_env * z, const struct among_table * a, const struct among_hash * h);
+extern int find_among_hash_b(struct SN_env * z, const struct among_table * a, const struct among_hash * h);
 
 extern int replace_s(struct SN_env * z, int c_bra, int c_ket, int s_size, const symbol * s, int * adjustment);
 extern int slice_from_s(struct SN_env * z, int s_size, const symbol * s);
@@ -53,9 +164,70 @@ extern int slice_del(struct SN_env * z);
 extern int insert_s(struct SN_env * z, int bra, int ket, int s_size, const symbol * s);
 extern int insert_v(struct SN_env * z, int bra, int ket, const symbol * p);
 
+/* Equivalent to the loop a struct translation describes, in a single pass
+ * from the cursor to the limit. */
+extern int translate(struct SN_env * z, const struct translation * t);
+extern int translate_b(struct SN_env * z, const struct translation * t);
+extern int translate_U(struct SN_env * z, const struct translation * t);
+extern int translate_b_U(struct SN_env * z, const struct translation * t);
+
 extern symbol * slice_to(struct SN_env * z, symbol * p);
 extern symbol * assign_to(struct SN_env * z, symbol * p);
 
 extern int len_utf8(const symbol * p);
 
+/* Equivalent to len_utf8(p) and skip_utf8(z->p, c, limit, n) etc, but
+ * using the index of z->p when there is one. */
+extern int lenof_utf8(struct SN_env * z, const symbol * p);
+extern int hop_utf8(struct SN_env * z, int c, int limit, int n);
+extern int hop_b_utf8(struct SN_env * z, int c, int limit, int n);
+
 extern void debug(struct SN_env * z, int number, int line_count);
+
+/* A count of cycles.  unsigned long long isn't in C90, so it's only used
+ * where the compiler is known to have it. */
+#if (defined __STDC_VERSION__ && __STDC_VERSION__ >= 199901L) || defined _MSC_VER
+typedef unsigned long long SN_cycles;
+#else
+typedef unsigned long SN_cycles;
+#endif
+
+/* Counters kept by a stemmer generated with -profile, which registers them
+ * when it creates its first SN_env so that SN_profile_dump() can find them.
+ * The cycles are those spent in the routine including the routines it
+ * calls, measured with the CPU's cycle counter where there's one we know
+ * how to read, and in clock() ticks otherwise.
+ */
+struct SN_profile_routine {
+    const char * name;
+    unsigned long calls;
+    unsigned long successes;
+    SN_cycles cycles;
+};
+
+/* counts[0] is the number of times an among matched a string with no
+ * command, counts[1] the number of times it didn't match, and counts[i + 1]
+ * the number of times it matched a string for command i. */
+struct SN_profile_among {
+    int line_number;
+    int size;           /* of counts */
+    unsigned long * counts;
+};
+
+struct SN_profile {
+    const char * name;
+    int routine_count;
+    struct SN_profile_routine * routines;
+    int among_count;
+    struct SN_profile_among * amongs;
+    struct SN_profile * next;
+    int registered;
+};
+
+extern void SN_profile_register(struct SN_profile * profile);
+extern SN_cycles SN_profile_clock(void);
+/* Count a call to routine r which returned ret and started at start, and
+ * return ret. */
+extern int SN_profile_routine(struct SN_profile_routine * r, int ret, SN_cycles start);
+/* Count an among lookup which gave result. */
+extern void SN_profile_among(struct SN_profile_among * a, int result);
@@ -0,0 +1,162 @@
+
+#include "header.h"
+
+/* Forward scanning for goto and gopast over a grouping.
+ *
+ * The grouping's class table is also given as a pair of nibble tables (see
+ * in_class_scan() in header.h), which allows 16 or 32 bytes to be tested at
+ * once with SSSE3 or AVX2 byte shuffles, chosen when first used.  For UTF-8
+ * only ASCII characters are tested that way, and anything else stops the
+ * scan and is dealt with a character at a time by in_class_U() etc.
+ *
+ * A block is only loaded if it lies within the capacity of z->p, and
+ * positions at or after z->l are ignored, so nothing outside the string's
+ * allocation is ever read.
+ */
+
+/* What the scan stops at. */
+#define STOP_IN 1       /* bytes in the grouping, otherwise those not in it */
+#define STOP_HIGH 2     /* bytes 0x80 and above */
+
+/* Return the position of the first byte from c up to l - 1 which the scan
+ * should stop at, or l if there isn't one.  cap is the capacity of p. */
+typedef int (*scan_kernel)(const symbol * p, int c, int l, int cap,
+                           const unsigned char * t, const unsigned char * scan,
+                           int stop);
+
+static int scan_scalar(const symbol * p, int c, int l, int cap,
+                       const unsigned char * t, const unsigned char * scan,
+                       int stop) {
+    int in = stop & STOP_IN;
+    (void)cap;
+    (void)scan;
+    for (; c < l; c++) {
+        int b = p[c];
+        if ((stop & STOP_HIGH) && b >= 0x80) break;
+        if ((t[b] != 0) == in) break;
+    }
+    return c;
+}
+
+#if defined __GNUC__ && (defined __x86_64__ || defined __i386__)
+# include <immintrin.h>
+
+/* Byte b is in the grouping if bit (b >> 4) & 7 of scan[b & 0xF] (for b
+ * below 0x80) or of scan[16 + (b & 0xF)] (otherwise) is set. */
+
+__attribute__((target("ssse3")))
+static int scan_ssse3(const symbol * p, int c, int l, int cap,
+                      const unsigned char * t, const unsigned char * scan,
+                      int stop) {
+    const __m128i lut_lo = _mm_loadu_si128((const __m128i *)scan);
+    const __m128i lut_hi = _mm_loadu_si128((const __m128i *)(scan + 16));
+    const __m128i bits = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                       1, 2, 4, 8, 16, 32, 64, -128);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    unsigned int flip = (stop & STOP_IN) ? 0 : 0xFFFF;
+    while (c < l && c + 16 <= cap) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(p + c));
+        __m128i lo = _mm_and_si128(x, nibble);
+        __m128i hi = _mm_and_si128(_mm_srli_epi16(x, 4), nibble);
+        __m128i high = _mm_cmpgt_epi8(_mm_setzero_si128(), x);
+        __m128i row = _mm_or_si128(
+                _mm_andnot_si128(high, _mm_shuffle_epi8(lut_lo, lo)),
+                _mm_and_si128(high, _mm_shuffle_epi8(lut_hi, lo)));
+        __m128i bit = _mm_shuffle_epi8(bits, hi);
+        unsigned int m = (unsigned int)_mm_movemask_epi8(
+                _mm_cmpeq_epi8(_mm_and_si128(row, bit), bit)) ^ flip;
+        if (stop & STOP_HIGH) m |= (unsigned int)_mm_movemask_epi8(x);
+        if (l - c < 16) m |= 0xFFFFu << (l - c);
+        if (m) return c + __builtin_ctz(m);
+        c += 16;
+    }
+    return scan_scalar(p, c, l, cap, t, scan, stop);
+}
+
+__attribute__((target("avx2")))
+static int scan_avx2(const symbol * p, int c, int l, int cap,
+                     const unsigned char * t, const unsigned char * scan,
+                     int stop) {
+    const __m256i lut_lo = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128((const __m128i *)scan));
+    const __m256i lut_hi = _mm256_broadcastsi128_si256(
+            _mm_loadu_si128((const __m128i *)(scan + 16)));
+    const __m256i bits = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                          1, 2, 4, 8, 16, 32, 64, -128,
+                                          1, 2, 4, 8, 16, 32, 64, -128,
+                                          1, 2, 4, 8, 16, 32, 64, -128);
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    unsigned int flip = (stop & STOP_IN) ? 0 : 0xFFFFFFFFu;
+    while (c < l && c + 32 <= cap) {
+        __m256i x = _mm256_loadu_si256((const __m256i *)(p + c));
+        __m256i lo = _mm256_and_si256(x, nibble);
+        __m256i hi = _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble);
+        __m256i row = _mm256_blendv_epi8(_mm256_shuffle_epi8(lut_lo, lo),
+                                         _mm256_shuffle_epi8(lut_hi, lo), x);
+        __m256i bit = _mm256_shuffle_epi8(bits, hi);
+        unsigned int m = (unsigned int)_mm256_movemask_epi8(
+                _mm256_cmpeq_epi8(_mm256_and_si256(row, bit), bit)) ^ flip;
+        if (stop & STOP_HIGH) m |= (unsigned int)_mm256_movemask_epi8(x);
+        if (l - c < 32) m |= 0xFFFFFFFFu << (l - c);
+        if (m) return c + __builtin_ctz(m);
+        c += 32;
+    }
+    return scan_ssse3(p, c, l, cap, t, scan, stop);
+}
+
+static scan_kernel kernel;
+
+static scan_kernel get_kernel(void) {
+    scan_kernel k = __atomic_load_n(&kernel, __ATOMIC_RELAXED);
+    if (k == NULL) {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            k = scan_avx2;
+        } else if (__builtin_cpu_supports("ssse3")) {
+            k = scan_ssse3;
+        } else {
+            k = scan_scalar;
+        }
+        __atomic_store_n(&kernel, k, __ATOMIC_RELAXED);
+    }
+    return k;
+}
+#else
+# define get_kernel() scan_scalar
+#endif
+
+extern int in_class_scan(struct SN_env * z, const unsigned char * t, const unsigned char * scan) {
+    z->c = get_kernel()(z->p, z->c, z->l, CAPACITY(z->p), t, scan, 0);
+    return z->c < z->l ? 1 : -1;
+}
+
+extern int out_class_scan(struct SN_env * z, const unsigned char * t, const unsigned char * scan) {
+    z->c = get_kernel()(z->p, z->c, z->l, CAPACITY(z->p), t, scan, STOP_IN);
+    return z->c < z->l ? 1 : -1;
+}
+
+extern int in_class_scan_U(struct SN_env * z, const unsigned char * t, const unsigned char * scan,
+                           const unsigned char * s, int min, int max) {
+    scan_kernel find_stop = get_kernel();
+    while (1) {
+        int ret;
+        z->c = find_stop(z->p, z->c, z->l, CAPACITY(z->p), t, scan, STOP_HIGH);
+        if (z->c >= z->l) return -1;
+        if (z->p[z->c] < 0x80) return 1;
+        ret = in_class_U(z, t, s, min, max, 0);
+        if (ret) return ret;
+    }
+}
+
+extern int out_class_scan_U(struct SN_env * z, const unsigned char * t, const unsigned char * scan,
+                            const unsigned char * s, int min, int max) {
+    scan_kernel find_stop = get_kernel();
+    while (1) {
+        int ret;
+        z->c = find_stop(z->p, z->c, z->l, CAPACITY(z->p), t, scan, STOP_IN | STOP_HIGH);
+        if (z->c >= z->l) return -1;
+        if (z->p[z->c] < 0x80) return 1;
+        ret = out_class_U(z, t, s, min, max, 0);
+        if (ret) return ret;
+    }
+}
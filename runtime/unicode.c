@@ -0,0 +1,108 @@
+
+#include "api.h"
+
+struct fold_range { int first; int last; int delta; int stride; };
+struct char_range { int first; int last; };
+
+#include "unicode_tables.h"
+
+#define NUM_ELEMS(A) ((int)(sizeof(A) / sizeof((A)[0])))
+
+/* Code point classes for ASCII: 1 for a letter or digit, 0 otherwise. */
+static const unsigned char ascii_word[128] = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,0,
+    0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0,
+    0,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1,1,1,1,0,0,0,0,0
+};
+
+extern int SN_fold_case(int ch) {
+    int lo = 0;
+    int hi = NUM_ELEMS(fold_ranges);
+    if (ch < 0x800) return ch < 0 ? ch : fold_table[ch];
+    while (lo < hi) {
+        int mid = (lo + hi) >> 1;
+        const struct fold_range * r = fold_ranges + mid;
+        if (ch < r->first) {
+            hi = mid;
+        } else if (ch > r->last) {
+            lo = mid + 1;
+        } else {
+            if ((ch - r->first) % r->stride != 0) return ch;
+            return ch + r->delta;
+        }
+    }
+    return ch;
+}
+
+extern int SN_is_word_char(int ch) {
+    int lo = 0;
+    int hi = NUM_ELEMS(word_ranges);
+    if (ch < 0x80) return ch >= 0 && ascii_word[ch];
+    while (lo < hi) {
+        int mid = (lo + hi) >> 1;
+        if (ch < word_ranges[mid].first) {
+            hi = mid;
+        } else if (ch > word_ranges[mid].last) {
+            lo = mid + 1;
+        } else {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+extern int SN_decode_utf8(const unsigned char * p, int n, int * ch) {
+    int b0 = p[0];
+    int len, c, i;
+    *ch = -1;
+    if (b0 < 0x80) {
+        *ch = b0;
+        return 1;
+    }
+    if (b0 < 0xC2) return 1;
+    if (b0 < 0xE0) {
+        len = 2;
+        c = b0 & 0x1F;
+    } else if (b0 < 0xF0) {
+        len = 3;
+        c = b0 & 0x0F;
+    } else if (b0 < 0xF5) {
+        len = 4;
+        c = b0 & 0x07;
+    } else {
+        return 1;
+    }
+    if (n < len) return 1;
+    for (i = 1; i < len; i++) {
+        if ((p[i] & 0xC0) != 0x80) return 1;
+        c = (c << 6) | (p[i] & 0x3F);
+    }
+    if ((len == 3 && (c < 0x800 || (c >= 0xD800 && c <= 0xDFFF))) ||
+        (len == 4 && (c < 0x10000 || c > 0x10FFFF))) return 1;
+    *ch = c;
+    return len;
+}
+
+extern int SN_encode_utf8(int ch, unsigned char * p) {
+    if (ch < 0x80) {
+        p[0] = ch;
+        return 1;
+    }
+    if (ch < 0x800) {
+        p[0] = 0xC0 | (ch >> 6);
+        p[1] = 0x80 | (ch & 0x3F);
+        return 2;
+    }
+    if (ch < 0x10000) {
+        p[0] = 0xE0 | (ch >> 12);
+        p[1] = 0x80 | ((ch >> 6) & 0x3F);
+        p[2] = 0x80 | (ch & 0x3F);
+        return 3;
+    }
+    p[0] = 0xF0 | (ch >> 18);
+    p[1] = 0x80 | ((ch >> 12) & 0x3F);
+    p[2] = 0x80 | ((ch >> 6) & 0x3F);
+    p[3] = 0x80 | (ch & 0x3F);
+    return 4;
+}
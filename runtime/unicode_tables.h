@@ -0,0 +1,1253 @@
+/* Generated by libstemmer/mkunicode.py from Unicode 14.0.0 data.
+ * Do not edit manually. */
+
+/* Simple case folding: { first, last, delta, stride } */
+static const struct fold_range fold_ranges[] = {
+    { 0x41, 0x5A, 32, 1 },
+    { 0xB5, 0xB5, 775, 1 },
+    { 0xC0, 0xD6, 32, 1 },
+    { 0xD8, 0xDE, 32, 1 },
+    { 0x100, 0x12E, 1, 2 },
+    { 0x132, 0x136, 1, 2 },
+    { 0x139, 0x147, 1, 2 },
+    { 0x14A, 0x176, 1, 2 },
+    { 0x178, 0x178, -121, 1 },
+    { 0x179, 0x17D, 1, 2 },
+    { 0x17F, 0x17F, -268, 1 },
+    { 0x181, 0x181, 210, 1 },
+    { 0x182, 0x184, 1, 2 },
+    { 0x186, 0x186, 206, 1 },
+    { 0x187, 0x187, 1, 1 },
+    { 0x189, 0x18A, 205, 1 },
+    { 0x18B, 0x18B, 1, 1 },
+    { 0x18E, 0x18E, 79, 1 },
+    { 0x18F, 0x18F, 202, 1 },
+    { 0x190, 0x190, 203, 1 },
+    { 0x191, 0x191, 1, 1 },
+    { 0x193, 0x193, 205, 1 },
+    { 0x194, 0x194, 207, 1 },
+    { 0x196, 0x196, 211, 1 },
+    { 0x197, 0x197, 209, 1 },
+    { 0x198, 0x198, 1, 1 },
+    { 0x19C, 0x19C, 211, 1 },
+    { 0x19D, 0x19D, 213, 1 },
+    { 0x19F, 0x19F, 214, 1 },
+    { 0x1A0, 0x1A4, 1, 2 },
+    { 0x1A6, 0x1A6, 218, 1 },
+    { 0x1A7, 0x1A7, 1, 1 },
+    { 0x1A9, 0x1A9, 218, 1 },
+    { 0x1AC, 0x1AC, 1, 1 },
+    { 0x1AE, 0x1AE, 218, 1 },
+    { 0x1AF, 0x1AF, 1, 1 },
+    { 0x1B1, 0x1B2, 217, 1 },
+    { 0x1B3, 0x1B5, 1, 2 },
+    { 0x1B7, 0x1B7, 219, 1 },
+    { 0x1B8, 0x1B8, 1, 1 },
+    { 0x1BC, 0x1BC, 1, 1 },
+    { 0x1C4, 0x1C4, 2, 1 },
+    { 0x1C5, 0x1C5, 1, 1 },
+    { 0x1C7, 0x1C7, 2, 1 },
+    { 0x1C8, 0x1C8, 1, 1 },
+    { 0x1CA, 0x1CA, 2, 1 },
+    { 0x1CB, 0x1DB, 1, 2 },
+    { 0x1DE, 0x1EE, 1, 2 },
+    { 0x1F1, 0x1F1, 2, 1 },
+    { 0x1F2, 0x1F4, 1, 2 },
+    { 0x1F6, 0x1F6, -97, 1 },
+    { 0x1F7, 0x1F7, -56, 1 },
+    { 0x1F8, 0x21E, 1, 2 },
+    { 0x220, 0x220, -130, 1 },
+    { 0x222, 0x232, 1, 2 },
+    { 0x23A, 0x23A, 10795, 1 },
+    { 0x23B, 0x23B, 1, 1 },
+    { 0x23D, 0x23D, -163, 1 },
+    { 0x23E, 0x23E, 10792, 1 },
+    { 0x241, 0x241, 1, 1 },
+    { 0x243, 0x243, -195, 1 },
+    { 0x244, 0x244, 69, 1 },
+    { 0x245, 0x245, 71, 1 },
+    { 0x246, 0x24E, 1, 2 },
+    { 0x345, 0x345, 116, 1 },
+    { 0x370, 0x372, 1, 2 },
+    { 0x376, 0x376, 1, 1 },
+    { 0x37F, 0x37F, 116, 1 },
+    { 0x386, 0x386, 38, 1 },
+    { 0x388, 0x38A, 37, 1 },
+    { 0x38C, 0x38C, 64, 1 },
+    { 0x38E, 0x38F, 63, 1 },
+    { 0x391, 0x3A1, 32, 1 },
+    { 0x3A3, 0x3AB, 32, 1 },
+    { 0x3C2, 0x3C2, 1, 1 },
+    { 0x3CF, 0x3CF, 8, 1 },
+    { 0x3D0, 0x3D0, -30, 1 },
+    { 0x3D1, 0x3D1, -25, 1 },
+    { 0x3D5, 0x3D5, -15, 1 },
+    { 0x3D6, 0x3D6, -22, 1 },
+    { 0x3D8, 0x3EE, 1, 2 },
+    { 0x3F0, 0x3F0, -54, 1 },
+    { 0x3F1, 0x3F1, -48, 1 },
+    { 0x3F4, 0x3F4, -60, 1 },
+    { 0x3F5, 0x3F5, -64, 1 },
+    { 0x3F7, 0x3F7, 1, 1 },
+    { 0x3F9, 0x3F9, -7, 1 },
+    { 0x3FA, 0x3FA, 1, 1 },
+    { 0x3FD, 0x3FF, -130, 1 },
+    { 0x400, 0x40F, 80, 1 },
+    { 0x410, 0x42F, 32, 1 },
+    { 0x460, 0x480, 1, 2 },
+    { 0x48A, 0x4BE, 1, 2 },
+    { 0x4C0, 0x4C0, 15, 1 },
+    { 0x4C1, 0x4CD, 1, 2 },
+    { 0x4D0, 0x52E, 1, 2 },
+    { 0x531, 0x556, 48, 1 },
+    { 0x10A0, 0x10C5, 7264, 1 },
+    { 0x10C7, 0x10C7, 7264, 1 },
+    { 0x10CD, 0x10CD, 7264, 1 },
+    { 0x13F8, 0x13FD, -8, 1 },
+    { 0x1C80, 0x1C80, -6222, 1 },
+    { 0x1C81, 0x1C81, -6221, 1 },
+    { 0x1C82, 0x1C82, -6212, 1 },
+    { 0x1C83, 0x1C84, -6210, 1 },
+    { 0x1C85, 0x1C85, -6211, 1 },
+    { 0x1C86, 0x1C86, -6204, 1 },
+    { 0x1C87, 0x1C87, -6180, 1 },
+    { 0x1C88, 0x1C88, 35267, 1 },
+    { 0x1C90, 0x1CBA, -3008, 1 },
+    { 0x1CBD, 0x1CBF, -3008, 1 },
+    { 0x1E00, 0x1E94, 1, 2 },
+    { 0x1E9B, 0x1E9B, -58, 1 },
+    { 0x1E9E, 0x1E9E, -7615, 1 },
+    { 0x1EA0, 0x1EFE, 1, 2 },
+    { 0x1F08, 0x1F0F, -8, 1 },
+    { 0x1F18, 0x1F1D, -8, 1 },
+    { 0x1F28, 0x1F2F, -8, 1 },
+    { 0x1F38, 0x1F3F, -8, 1 },
+    { 0x1F48, 0x1F4D, -8, 1 },
+    { 0x1F59, 0x1F5F, -8, 2 },
+    { 0x1F68, 0x1F6F, -8, 1 },
+    { 0x1F88, 0x1F8F, -8, 1 },
+    { 0x1F98, 0x1F9F, -8, 1 },
+    { 0x1FA8, 0x1FAF, -8, 1 },
+    { 0x1FB8, 0x1FB9, -8, 1 },
+    { 0x1FBA, 0x1FBB, -74, 1 },
+    { 0x1FBC, 0x1FBC, -9, 1 },
+    { 0x1FBE, 0x1FBE, -7173, 1 },
+    { 0x1FC8, 0x1FCB, -86, 1 },
+    { 0x1FCC, 0x1FCC, -9, 1 },
+    { 0x1FD8, 0x1FD9, -8, 1 },
+    { 0x1FDA, 0x1FDB, -100, 1 },
+    { 0x1FE8, 0x1FE9, -8, 1 },
+    { 0x1FEA, 0x1FEB, -112, 1 },
+    { 0x1FEC, 0x1FEC, -7, 1 },
+    { 0x1FF8, 0x1FF9, -128, 1 },
+    { 0x1FFA, 0x1FFB, -126, 1 },
+    { 0x1FFC, 0x1FFC, -9, 1 },
+    { 0x2126, 0x2126, -7517, 1 },
+    { 0x212A, 0x212A, -8383, 1 },
+    { 0x212B, 0x212B, -8262, 1 },
+    { 0x2132, 0x2132, 28, 1 },
+    { 0x2160, 0x216F, 16, 1 },
+    { 0x2183, 0x2183, 1, 1 },
+    { 0x24B6, 0x24CF, 26, 1 },
+    { 0x2C00, 0x2C2F, 48, 1 },
+    { 0x2C60, 0x2C60, 1, 1 },
+    { 0x2C62, 0x2C62, -10743, 1 },
+    { 0x2C63, 0x2C63, -3814, 1 },
+    { 0x2C64, 0x2C64, -10727, 1 },
+    { 0x2C67, 0x2C6B, 1, 2 },
+    { 0x2C6D, 0x2C6D, -10780, 1 },
+    { 0x2C6E, 0x2C6E, -10749, 1 },
+    { 0x2C6F, 0x2C6F, -10783, 1 },
+    { 0x2C70, 0x2C70, -10782, 1 },
+    { 0x2C72, 0x2C72, 1, 1 },
+    { 0x2C75, 0x2C75, 1, 1 },
+    { 0x2C7E, 0x2C7F, -10815, 1 },
+    { 0x2C80, 0x2CE2, 1, 2 },
+    { 0x2CEB, 0x2CED, 1, 2 },
+    { 0x2CF2, 0x2CF2, 1, 1 },
+    { 0xA640, 0xA66C, 1, 2 },
+    { 0xA680, 0xA69A, 1, 2 },
+    { 0xA722, 0xA72E, 1, 2 },
+    { 0xA732, 0xA76E, 1, 2 },
+    { 0xA779, 0xA77B, 1, 2 },
+    { 0xA77D, 0xA77D, -35332, 1 },
+    { 0xA77E, 0xA786, 1, 2 },
+    { 0xA78B, 0xA78B, 1, 1 },
+    { 0xA78D, 0xA78D, -42280, 1 },
+    { 0xA790, 0xA792, 1, 2 },
+    { 0xA796, 0xA7A8, 1, 2 },
+    { 0xA7AA, 0xA7AA, -42308, 1 },
+    { 0xA7AB, 0xA7AB, -42319, 1 },
+    { 0xA7AC, 0xA7AC, -42315, 1 },
+    { 0xA7AD, 0xA7AD, -42305, 1 },
+    { 0xA7AE, 0xA7AE, -42308, 1 },
+    { 0xA7B0, 0xA7B0, -42258, 1 },
+    { 0xA7B1, 0xA7B1, -42282, 1 },
+    { 0xA7B2, 0xA7B2, -42261, 1 },
+    { 0xA7B3, 0xA7B3, 928, 1 },
+    { 0xA7B4, 0xA7C2, 1, 2 },
+    { 0xA7C4, 0xA7C4, -48, 1 },
+    { 0xA7C5, 0xA7C5, -42307, 1 },
+    { 0xA7C6, 0xA7C6, -35384, 1 },
+    { 0xA7C7, 0xA7C9, 1, 2 },
+    { 0xA7D0, 0xA7D0, 1, 1 },
+    { 0xA7D6, 0xA7D8, 1, 2 },
+    { 0xA7F5, 0xA7F5, 1, 1 },
+    { 0xAB70, 0xABBF, -38864, 1 },
+    { 0xFF21, 0xFF3A, 32, 1 },
+    { 0x10400, 0x10427, 40, 1 },
+    { 0x104B0, 0x104D3, 40, 1 },
+    { 0x10570, 0x1057A, 39, 1 },
+    { 0x1057C, 0x1058A, 39, 1 },
+    { 0x1058C, 0x10592, 39, 1 },
+    { 0x10594, 0x10595, 39, 1 },
+    { 0x10C80, 0x10CB2, 64, 1 },
+    { 0x118A0, 0x118BF, 32, 1 },
+    { 0x16E40, 0x16E5F, 32, 1 },
+    { 0x1E900, 0x1E921, 34, 1 },
+};
+
+/* Simple case folding of U+0000 to U+07FF */
+static const unsigned short fold_table[0x800] = {
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007,
+    0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017,
+    0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027,
+    0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037,
+    0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067,
+    0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+    0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087,
+    0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F,
+    0x0090, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097,
+    0x0098, 0x0099, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F,
+    0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+    0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x03BC, 0x00B6, 0x00B7,
+    0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+    0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+    0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+    0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00D7,
+    0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00DF,
+    0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+    0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+    0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+    0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF,
+    0x0101, 0x0101, 0x0103, 0x0103, 0x0105, 0x0105, 0x0107, 0x0107,
+    0x0109, 0x0109, 0x010B, 0x010B, 0x010D, 0x010D, 0x010F, 0x010F,
+    0x0111, 0x0111, 0x0113, 0x0113, 0x0115, 0x0115, 0x0117, 0x0117,
+    0x0119, 0x0119, 0x011B, 0x011B, 0x011D, 0x011D, 0x011F, 0x011F,
+    0x0121, 0x0121, 0x0123, 0x0123, 0x0125, 0x0125, 0x0127, 0x0127,
+    0x0129, 0x0129, 0x012B, 0x012B, 0x012D, 0x012D, 0x012F, 0x012F,
+    0x0130, 0x0131, 0x0133, 0x0133, 0x0135, 0x0135, 0x0137, 0x0137,
+    0x0138, 0x013A, 0x013A, 0x013C, 0x013C, 0x013E, 0x013E, 0x0140,
+    0x0140, 0x0142, 0x0142, 0x0144, 0x0144, 0x0146, 0x0146, 0x0148,
+    0x0148, 0x0149, 0x014B, 0x014B, 0x014D, 0x014D, 0x014F, 0x014F,
+    0x0151, 0x0151, 0x0153, 0x0153, 0x0155, 0x0155, 0x0157, 0x0157,
+    0x0159, 0x0159, 0x015B, 0x015B, 0x015D, 0x015D, 0x015F, 0x015F,
+    0x0161, 0x0161, 0x0163, 0x0163, 0x0165, 0x0165, 0x0167, 0x0167,
+    0x0169, 0x0169, 0x016B, 0x016B, 0x016D, 0x016D, 0x016F, 0x016F,
+    0x0171, 0x0171, 0x0173, 0x0173, 0x0175, 0x0175, 0x0177, 0x0177,
+    0x00FF, 0x017A, 0x017A, 0x017C, 0x017C, 0x017E, 0x017E, 0x0073,
+    0x0180, 0x0253, 0x0183, 0x0183, 0x0185, 0x0185, 0x0254, 0x0188,
+    0x0188, 0x0256, 0x0257, 0x018C, 0x018C, 0x018D, 0x01DD, 0x0259,
+    0x025B, 0x0192, 0x0192, 0x0260, 0x0263, 0x0195, 0x0269, 0x0268,
+    0x0199, 0x0199, 0x019A, 0x019B, 0x026F, 0x0272, 0x019E, 0x0275,
+    0x01A1, 0x01A1, 0x01A3, 0x01A3, 0x01A5, 0x01A5, 0x0280, 0x01A8,
+    0x01A8, 0x0283, 0x01AA, 0x01AB, 0x01AD, 0x01AD, 0x0288, 0x01B0,
+    0x01B0, 0x028A, 0x028B, 0x01B4, 0x01B4, 0x01B6, 0x01B6, 0x0292,
+    0x01B9, 0x01B9, 0x01BA, 0x01BB, 0x01BD, 0x01BD, 0x01BE, 0x01BF,
+    0x01C0, 0x01C1, 0x01C2, 0x01C3, 0x01C6, 0x01C6, 0x01C6, 0x01C9,
+    0x01C9, 0x01C9, 0x01CC, 0x01CC, 0x01CC, 0x01CE, 0x01CE, 0x01D0,
+    0x01D0, 0x01D2, 0x01D2, 0x01D4, 0x01D4, 0x01D6, 0x01D6, 0x01D8,
+    0x01D8, 0x01DA, 0x01DA, 0x01DC, 0x01DC, 0x01DD, 0x01DF, 0x01DF,
+    0x01E1, 0x01E1, 0x01E3, 0x01E3, 0x01E5, 0x01E5, 0x01E7, 0x01E7,
+    0x01E9, 0x01E9, 0x01EB, 0x01EB, 0x01ED, 0x01ED, 0x01EF, 0x01EF,
+    0x01F0, 0x01F3, 0x01F3, 0x01F3, 0x01F5, 0x01F5, 0x0195, 0x01BF,
+    0x01F9, 0x01F9, 0x01FB, 0x01FB, 0x01FD, 0x01FD, 0x01FF, 0x01FF,
+    0x0201, 0x0201, 0x0203, 0x0203, 0x0205, 0x0205, 0x0207, 0x0207,
+    0x0209, 0x0209, 0x020B, 0x020B, 0x020D, 0x020D, 0x020F, 0x020F,
+    0x0211, 0x0211, 0x0213, 0x0213, 0x0215, 0x0215, 0x0217, 0x0217,
+    0x0219, 0x0219, 0x021B, 0x021B, 0x021D, 0x021D, 0x021F, 0x021F,
+    0x019E, 0x0221, 0x0223, 0x0223, 0x0225, 0x0225, 0x0227, 0x0227,
+    0x0229, 0x0229, 0x022B, 0x022B, 0x022D, 0x022D, 0x022F, 0x022F,
+    0x0231, 0x0231, 0x0233, 0x0233, 0x0234, 0x0235, 0x0236, 0x0237,
+    0x0238, 0x0239, 0x2C65, 0x023C, 0x023C, 0x019A, 0x2C66, 0x023F,
+    0x0240, 0x0242, 0x0242, 0x0180, 0x0289, 0x028C, 0x0247, 0x0247,
+    0x0249, 0x0249, 0x024B, 0x024B, 0x024D, 0x024D, 0x024F, 0x024F,
+    0x0250, 0x0251, 0x0252, 0x0253, 0x0254, 0x0255, 0x0256, 0x0257,
+    0x0258, 0x0259, 0x025A, 0x025B, 0x025C, 0x025D, 0x025E, 0x025F,
+    0x0260, 0x0261, 0x0262, 0x0263, 0x0264, 0x0265, 0x0266, 0x0267,
+    0x0268, 0x0269, 0x026A, 0x026B, 0x026C, 0x026D, 0x026E, 0x026F,
+    0x0270, 0x0271, 0x0272, 0x0273, 0x0274, 0x0275, 0x0276, 0x0277,
+    0x0278, 0x0279, 0x027A, 0x027B, 0x027C, 0x027D, 0x027E, 0x027F,
+    0x0280, 0x0281, 0x0282, 0x0283, 0x0284, 0x0285, 0x0286, 0x0287,
+    0x0288, 0x0289, 0x028A, 0x028B, 0x028C, 0x028D, 0x028E, 0x028F,
+    0x0290, 0x0291, 0x0292, 0x0293, 0x0294, 0x0295, 0x0296, 0x0297,
+    0x0298, 0x0299, 0x029A, 0x029B, 0x029C, 0x029D, 0x029E, 0x029F,
+    0x02A0, 0x02A1, 0x02A2, 0x02A3, 0x02A4, 0x02A5, 0x02A6, 0x02A7,
+    0x02A8, 0x02A9, 0x02AA, 0x02AB, 0x02AC, 0x02AD, 0x02AE, 0x02AF,
+    0x02B0, 0x02B1, 0x02B2, 0x02B3, 0x02B4, 0x02B5, 0x02B6, 0x02B7,
+    0x02B8, 0x02B9, 0x02BA, 0x02BB, 0x02BC, 0x02BD, 0x02BE, 0x02BF,
+    0x02C0, 0x02C1, 0x02C2, 0x02C3, 0x02C4, 0x02C5, 0x02C6, 0x02C7,
+    0x02C8, 0x02C9, 0x02CA, 0x02CB, 0x02CC, 0x02CD, 0x02CE, 0x02CF,
+    0x02D0, 0x02D1, 0x02D2, 0x02D3, 0x02D4, 0x02D5, 0x02D6, 0x02D7,
+    0x02D8, 0x02D9, 0x02DA, 0x02DB, 0x02DC, 0x02DD, 0x02DE, 0x02DF,
+    0x02E0, 0x02E1, 0x02E2, 0x02E3, 0x02E4, 0x02E5, 0x02E6, 0x02E7,
+    0x02E8, 0x02E9, 0x02EA, 0x02EB, 0x02EC, 0x02ED, 0x02EE, 0x02EF,
+    0x02F0, 0x02F1, 0x02F2, 0x02F3, 0x02F4, 0x02F5, 0x02F6, 0x02F7,
+    0x02F8, 0x02F9, 0x02FA, 0x02FB, 0x02FC, 0x02FD, 0x02FE, 0x02FF,
+    0x0300, 0x0301, 0x0302, 0x0303, 0x0304, 0x0305, 0x0306, 0x0307,
+    0x0308, 0x0309, 0x030A, 0x030B, 0x030C, 0x030D, 0x030E, 0x030F,
+    0x0310, 0x0311, 0x0312, 0x0313, 0x0314, 0x0315, 0x0316, 0x0317,
+    0x0318, 0x0319, 0x031A, 0x031B, 0x031C, 0x031D, 0x031E, 0x031F,
+    0x0320, 0x0321, 0x0322, 0x0323, 0x0324, 0x0325, 0x0326, 0x0327,
+    0x0328, 0x0329, 0x032A, 0x032B, 0x032C, 0x032D, 0x032E, 0x032F,
+    0x0330, 0x0331, 0x0332, 0x0333, 0x0334, 0x0335, 0x0336, 0x0337,
+    0x0338, 0x0339, 0x033A, 0x033B, 0x033C, 0x033D, 0x033E, 0x033F,
+    0x0340, 0x0341, 0x0342, 0x0343, 0x0344, 0x03B9, 0x0346, 0x0347,
+    0x0348, 0x0349, 0x034A, 0x034B, 0x034C, 0x034D, 0x034E, 0x034F,
+    0x0350, 0x0351, 0x0352, 0x0353, 0x0354, 0x0355, 0x0356, 0x0357,
+    0x0358, 0x0359, 0x035A, 0x035B, 0x035C, 0x035D, 0x035E, 0x035F,
+    0x0360, 0x0361, 0x0362, 0x0363, 0x0364, 0x0365, 0x0366, 0x0367,
+    0x0368, 0x0369, 0x036A, 0x036B, 0x036C, 0x036D, 0x036E, 0x036F,
+    0x0371, 0x0371, 0x0373, 0x0373, 0x0374, 0x0375, 0x0377, 0x0377,
+    0x0378, 0x0379, 0x037A, 0x037B, 0x037C, 0x037D, 0x037E, 0x03F3,
+    0x0380, 0x0381, 0x0382, 0x0383, 0x0384, 0x0385, 0x03AC, 0x0387,
+    0x03AD, 0x03AE, 0x03AF, 0x038B, 0x03CC, 0x038D, 0x03CD, 0x03CE,
+    0x0390, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7,
+    0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF,
+    0x03C0, 0x03C1, 0x03A2, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7,
+    0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x03AC, 0x03AD, 0x03AE, 0x03AF,
+    0x03B0, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7,
+    0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF,
+    0x03C0, 0x03C1, 0x03C3, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7,
+    0x03C8, 0x03C9, 0x03CA, 0x03CB, 0x03CC, 0x03CD, 0x03CE, 0x03D7,
+    0x03B2, 0x03B8, 0x03D2, 0x03D3, 0x03D4, 0x03C6, 0x03C0, 0x03D7,
+    0x03D9, 0x03D9, 0x03DB, 0x03DB, 0x03DD, 0x03DD, 0x03DF, 0x03DF,
+    0x03E1, 0x03E1, 0x03E3, 0x03E3, 0x03E5, 0x03E5, 0x03E7, 0x03E7,
+    0x03E9, 0x03E9, 0x03EB, 0x03EB, 0x03ED, 0x03ED, 0x03EF, 0x03EF,
+    0x03BA, 0x03C1, 0x03F2, 0x03F3, 0x03B8, 0x03B5, 0x03F6, 0x03F8,
+    0x03F8, 0x03F2, 0x03FB, 0x03FB, 0x03FC, 0x037B, 0x037C, 0x037D,
+    0x0450, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457,
+    0x0458, 0x0459, 0x045A, 0x045B, 0x045C, 0x045D, 0x045E, 0x045F,
+    0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+    0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+    0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+    0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F,
+    0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+    0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+    0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+    0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F,
+    0x0450, 0x0451, 0x0452, 0x0453, 0x0454, 0x0455, 0x0456, 0x0457,
+    0x0458, 0x0459, 0x045A, 0x045B, 0x045C, 0x045D, 0x045E, 0x045F,
+    0x0461, 0x0461, 0x0463, 0x0463, 0x0465, 0x0465, 0x0467, 0x0467,
+    0x0469, 0x0469, 0x046B, 0x046B, 0x046D, 0x046D, 0x046F, 0x046F,
+    0x0471, 0x0471, 0x0473, 0x0473, 0x0475, 0x0475, 0x0477, 0x0477,
+    0x0479, 0x0479, 0x047B, 0x047B, 0x047D, 0x047D, 0x047F, 0x047F,
+    0x0481, 0x0481, 0x0482, 0x0483, 0x0484, 0x0485, 0x0486, 0x0487,
+    0x0488, 0x0489, 0x048B, 0x048B, 0x048D, 0x048D, 0x048F, 0x048F,
+    0x0491, 0x0491, 0x0493, 0x0493, 0x0495, 0x0495, 0x0497, 0x0497,
+    0x0499, 0x0499, 0x049B, 0x049B, 0x049D, 0x049D, 0x049F, 0x049F,
+    0x04A1, 0x04A1, 0x04A3, 0x04A3, 0x04A5, 0x04A5, 0x04A7, 0x04A7,
+    0x04A9, 0x04A9, 0x04AB, 0x04AB, 0x04AD, 0x04AD, 0x04AF, 0x04AF,
+    0x04B1, 0x04B1, 0x04B3, 0x04B3, 0x04B5, 0x04B5, 0x04B7, 0x04B7,
+    0x04B9, 0x04B9, 0x04BB, 0x04BB, 0x04BD, 0x04BD, 0x04BF, 0x04BF,
+    0x04CF, 0x04C2, 0x04C2, 0x04C4, 0x04C4, 0x04C6, 0x04C6, 0x04C8,
+    0x04C8, 0x04CA, 0x04CA, 0x04CC, 0x04CC, 0x04CE, 0x04CE, 0x04CF,
+    0x04D1, 0x04D1, 0x04D3, 0x04D3, 0x04D5, 0x04D5, 0x04D7, 0x04D7,
+    0x04D9, 0x04D9, 0x04DB, 0x04DB, 0x04DD, 0x04DD, 0x04DF, 0x04DF,
+    0x04E1, 0x04E1, 0x04E3, 0x04E3, 0x04E5, 0x04E5, 0x04E7, 0x04E7,
+    0x04E9, 0x04E9, 0x04EB, 0x04EB, 0x04ED, 0x04ED, 0x04EF, 0x04EF,
+    0x04F1, 0x04F1, 0x04F3, 0x04F3, 0x04F5, 0x04F5, 0x04F7, 0x04F7,
+    0x04F9, 0x04F9, 0x04FB, 0x04FB, 0x04FD, 0x04FD, 0x04FF, 0x04FF,
+    0x0501, 0x0501, 0x0503, 0x0503, 0x0505, 0x0505, 0x0507, 0x0507,
+    0x0509, 0x0509, 0x050B, 0x050B, 0x050D, 0x050D, 0x050F, 0x050F,
+    0x0511, 0x0511, 0x0513, 0x0513, 0x0515, 0x0515, 0x0517, 0x0517,
+    0x0519, 0x0519, 0x051B, 0x051B, 0x051D, 0x051D, 0x051F, 0x051F,
+    0x0521, 0x0521, 0x0523, 0x0523, 0x0525, 0x0525, 0x0527, 0x0527,
+    0x0529, 0x0529, 0x052B, 0x052B, 0x052D, 0x052D, 0x052F, 0x052F,
+    0x0530, 0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567,
+    0x0568, 0x0569, 0x056A, 0x056B, 0x056C, 0x056D, 0x056E, 0x056F,
+    0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577,
+    0x0578, 0x0579, 0x057A, 0x057B, 0x057C, 0x057D, 0x057E, 0x057F,
+    0x0580, 0x0581, 0x0582, 0x0583, 0x0584, 0x0585, 0x0586, 0x0557,
+    0x0558, 0x0559, 0x055A, 0x055B, 0x055C, 0x055D, 0x055E, 0x055F,
+    0x0560, 0x0561, 0x0562, 0x0563, 0x0564, 0x0565, 0x0566, 0x0567,
+    0x0568, 0x0569, 0x056A, 0x056B, 0x056C, 0x056D, 0x056E, 0x056F,
+    0x0570, 0x0571, 0x0572, 0x0573, 0x0574, 0x0575, 0x0576, 0x0577,
+    0x0578, 0x0579, 0x057A, 0x057B, 0x057C, 0x057D, 0x057E, 0x057F,
+    0x0580, 0x0581, 0x0582, 0x0583, 0x0584, 0x0585, 0x0586, 0x0587,
+    0x0588, 0x0589, 0x058A, 0x058B, 0x058C, 0x058D, 0x058E, 0x058F,
+    0x0590, 0x0591, 0x0592, 0x0593, 0x0594, 0x0595, 0x0596, 0x0597,
+    0x0598, 0x0599, 0x059A, 0x059B, 0x059C, 0x059D, 0x059E, 0x059F,
+    0x05A0, 0x05A1, 0x05A2, 0x05A3, 0x05A4, 0x05A5, 0x05A6, 0x05A7,
+    0x05A8, 0x05A9, 0x05AA, 0x05AB, 0x05AC, 0x05AD, 0x05AE, 0x05AF,
+    0x05B0, 0x05B1, 0x05B2, 0x05B3, 0x05B4, 0x05B5, 0x05B6, 0x05B7,
+    0x05B8, 0x05B9, 0x05BA, 0x05BB, 0x05BC, 0x05BD, 0x05BE, 0x05BF,
+    0x05C0, 0x05C1, 0x05C2, 0x05C3, 0x05C4, 0x05C5, 0x05C6, 0x05C7,
+    0x05C8, 0x05C9, 0x05CA, 0x05CB, 0x05CC, 0x05CD, 0x05CE, 0x05CF,
+    0x05D0, 0x05D1, 0x05D2, 0x05D3, 0x05D4, 0x05D5, 0x05D6, 0x05D7,
+    0x05D8, 0x05D9, 0x05DA, 0x05DB, 0x05DC, 0x05DD, 0x05DE, 0x05DF,
+    0x05E0, 0x05E1, 0x05E2, 0x05E3, 0x05E4, 0x05E5, 0x05E6, 0x05E7,
+    0x05E8, 0x05E9, 0x05EA, 0x05EB, 0x05EC, 0x05ED, 0x05EE, 0x05EF,
+    0x05F0, 0x05F1, 0x05F2, 0x05F3, 0x05F4, 0x05F5, 0x05F6, 0x05F7,
+    0x05F8, 0x05F9, 0x05FA, 0x05FB, 0x05FC, 0x05FD, 0x05FE, 0x05FF,
+    0x0600, 0x0601, 0x0602, 0x0603, 0x0604, 0x0605, 0x0606, 0x0607,
+    0x0608, 0x0609, 0x060A, 0x060B, 0x060C, 0x060D, 0x060E, 0x060F,
+    0x0610, 0x0611, 0x0612, 0x0613, 0x0614, 0x0615, 0x0616, 0x0617,
+    0x0618, 0x0619, 0x061A, 0x061B, 0x061C, 0x061D, 0x061E, 0x061F,
+    0x0620, 0x0621, 0x0622, 0x0623, 0x0624, 0x0625, 0x0626, 0x0627,
+    0x0628, 0x0629, 0x062A, 0x062B, 0x062C, 0x062D, 0x062E, 0x062F,
+    0x0630, 0x0631, 0x0632, 0x0633, 0x0634, 0x0635, 0x0636, 0x0637,
+    0x0638, 0x0639, 0x063A, 0x063B, 0x063C, 0x063D, 0x063E, 0x063F,
+    0x0640, 0x0641, 0x0642, 0x0643, 0x0644, 0x0645, 0x0646, 0x0647,
+    0x0648, 0x0649, 0x064A, 0x064B, 0x064C, 0x064D, 0x064E, 0x064F,
+    0x0650, 0x0651, 0x0652, 0x0653, 0x0654, 0x0655, 0x0656, 0x0657,
+    0x0658, 0x0659, 0x065A, 0x065B, 0x065C, 0x065D, 0x065E, 0x065F,
+    0x0660, 0x0661, 0x0662, 0x0663, 0x0664, 0x0665, 0x0666, 0x0667,
+    0x0668, 0x0669, 0x066A, 0x066B, 0x066C, 0x066D, 0x066E, 0x066F,
+    0x0670, 0x0671, 0x0672, 0x0673, 0x0674, 0x0675, 0x0676, 0x0677,
+    0x0678, 0x0679, 0x067A, 0x067B, 0x067C, 0x067D, 0x067E, 0x067F,
+    0x0680, 0x0681, 0x0682, 0x0683, 0x0684, 0x0685, 0x0686, 0x0687,
+    0x0688, 0x0689, 0x068A, 0x068B, 0x068C, 0x068D, 0x068E, 0x068F,
+    0x0690, 0x0691, 0x0692, 0x0693, 0x0694, 0x0695, 0x0696, 0x0697,
+    0x0698, 0x0699, 0x069A, 0x069B, 0x069C, 0x069D, 0x069E, 0x069F,
+    0x06A0, 0x06A1, 0x06A2, 0x06A3, 0x06A4, 0x06A5, 0x06A6, 0x06A7,
+    0x06A8, 0x06A9, 0x06AA, 0x06AB, 0x06AC, 0x06AD, 0x06AE, 0x06AF,
+    0x06B0, 0x06B1, 0x06B2, 0x06B3, 0x06B4, 0x06B5, 0x06B6, 0x06B7,
+    0x06B8, 0x06B9, 0x06BA, 0x06BB, 0x06BC, 0x06BD, 0x06BE, 0x06BF,
+    0x06C0, 0x06C1, 0x06C2, 0x06C3, 0x06C4, 0x06C5, 0x06C6, 0x06C7,
+    0x06C8, 0x06C9, 0x06CA, 0x06CB, 0x06CC, 0x06CD, 0x06CE, 0x06CF,
+    0x06D0, 0x06D1, 0x06D2, 0x06D3, 0x06D4, 0x06D5, 0x06D6, 0x06D7,
+    0x06D8, 0x06D9, 0x06DA, 0x06DB, 0x06DC, 0x06DD, 0x06DE, 0x06DF,
+    0x06E0, 0x06E1, 0x06E2, 0x06E3, 0x06E4, 0x06E5, 0x06E6, 0x06E7,
+    0x06E8, 0x06E9, 0x06EA, 0x06EB, 0x06EC, 0x06ED, 0x06EE, 0x06EF,
+    0x06F0, 0x06F1, 0x06F2, 0x06F3, 0x06F4, 0x06F5, 0x06F6, 0x06F7,
+    0x06F8, 0x06F9, 0x06FA, 0x06FB, 0x06FC, 0x06FD, 0x06FE, 0x06FF,
+    0x0700, 0x0701, 0x0702, 0x0703, 0x0704, 0x0705, 0x0706, 0x0707,
+    0x0708, 0x0709, 0x070A, 0x070B, 0x070C, 0x070D, 0x070E, 0x070F,
+    0x0710, 0x0711, 0x0712, 0x0713, 0x0714, 0x0715, 0x0716, 0x0717,
+    0x0718, 0x0719, 0x071A, 0x071B, 0x071C, 0x071D, 0x071E, 0x071F,
+    0x0720, 0x0721, 0x0722, 0x0723, 0x0724, 0x0725, 0x0726, 0x0727,
+    0x0728, 0x0729, 0x072A, 0x072B, 0x072C, 0x072D, 0x072E, 0x072F,
+    0x0730, 0x0731, 0x0732, 0x0733, 0x0734, 0x0735, 0x0736, 0x0737,
+    0x0738, 0x0739, 0x073A, 0x073B, 0x073C, 0x073D, 0x073E, 0x073F,
+    0x0740, 0x0741, 0x0742, 0x0743, 0x0744, 0x0745, 0x0746, 0x0747,
+    0x0748, 0x0749, 0x074A, 0x074B, 0x074C, 0x074D, 0x074E, 0x074F,
+    0x0750, 0x0751, 0x0752, 0x0753, 0x0754, 0x0755, 0x0756, 0x0757,
+    0x0758, 0x0759, 0x075A, 0x075B, 0x075C, 0x075D, 0x075E, 0x075F,
+    0x0760, 0x0761, 0x0762, 0x0763, 0x0764, 0x0765, 0x0766, 0x0767,
+    0x0768, 0x0769, 0x076A, 0x076B, 0x076C, 0x076D, 0x076E, 0x076F,
+    0x0770, 0x0771, 0x0772, 0x0773, 0x0774, 0x0775, 0x0776, 0x0777,
+    0x0778, 0x0779, 0x077A, 0x077B, 0x077C, 0x077D, 0x077E, 0x077F,
+    0x0780, 0x0781, 0x0782, 0x0783, 0x0784, 0x0785, 0x0786, 0x0787,
+    0x0788, 0x0789, 0x078A, 0x078B, 0x078C, 0x078D, 0x078E, 0x078F,
+    0x0790, 0x0791, 0x0792, 0x0793, 0x0794, 0x0795, 0x0796, 0x0797,
+    0x0798, 0x0799, 0x079A, 0x079B, 0x079C, 0x079D, 0x079E, 0x079F,
+    0x07A0, 0x07A1, 0x07A2, 0x07A3, 0x07A4, 0x07A5, 0x07A6, 0x07A7,
+    0x07A8, 0x07A9, 0x07AA, 0x07AB, 0x07AC, 0x07AD, 0x07AE, 0x07AF,
+    0x07B0, 0x07B1, 0x07B2, 0x07B3, 0x07B4, 0x07B5, 0x07B6, 0x07B7,
+    0x07B8, 0x07B9, 0x07BA, 0x07BB, 0x07BC, 0x07BD, 0x07BE, 0x07BF,
+    0x07C0, 0x07C1, 0x07C2, 0x07C3, 0x07C4, 0x07C5, 0x07C6, 0x07C7,
+    0x07C8, 0x07C9, 0x07CA, 0x07CB, 0x07CC, 0x07CD, 0x07CE, 0x07CF,
+    0x07D0, 0x07D1, 0x07D2, 0x07D3, 0x07D4, 0x07D5, 0x07D6, 0x07D7,
+    0x07D8, 0x07D9, 0x07DA, 0x07DB, 0x07DC, 0x07DD, 0x07DE, 0x07DF,
+    0x07E0, 0x07E1, 0x07E2, 0x07E3, 0x07E4, 0x07E5, 0x07E6, 0x07E7,
+    0x07E8, 0x07E9, 0x07EA, 0x07EB, 0x07EC, 0x07ED, 0x07EE, 0x07EF,
+    0x07F0, 0x07F1, 0x07F2, 0x07F3, 0x07F4, 0x07F5, 0x07F6, 0x07F7,
+    0x07F8, 0x07F9, 0x07FA, 0x07FB, 0x07FC, 0x07FD, 0x07FE, 0x07FF,
+};
+
+/* Letters, marks and numbers: { first, last } */
+static const struct char_range word_ranges[] = {
+    { 0x30, 0x39 },
+    { 0x41, 0x5A },
+    { 0x61, 0x7A },
+    { 0xAA, 0xAA },
+    { 0xB2, 0xB3 },
+    { 0xB5, 0xB5 },
+    { 0xB9, 0xBA },
+    { 0xBC, 0xBE },
+    { 0xC0, 0xD6 },
+    { 0xD8, 0xF6 },
+    { 0xF8, 0x2C1 },
+    { 0x2C6, 0x2D1 },
+    { 0x2E0, 0x2E4 },
+    { 0x2EC, 0x2EC },
+    { 0x2EE, 0x2EE },
+    { 0x300, 0x374 },
+    { 0x376, 0x377 },
+    { 0x37A, 0x37D },
+    { 0x37F, 0x37F },
+    { 0x386, 0x386 },
+    { 0x388, 0x38A },
+    { 0x38C, 0x38C },
+    { 0x38E, 0x3A1 },
+    { 0x3A3, 0x3F5 },
+    { 0x3F7, 0x481 },
+    { 0x483, 0x52F },
+    { 0x531, 0x556 },
+    { 0x559, 0x559 },
+    { 0x560, 0x588 },
+    { 0x591, 0x5BD },
+    { 0x5BF, 0x5BF },
+    { 0x5C1, 0x5C2 },
+    { 0x5C4, 0x5C5 },
+    { 0x5C7, 0x5C7 },
+    { 0x5D0, 0x5EA },
+    { 0x5EF, 0x5F2 },
+    { 0x610, 0x61A },
+    { 0x620, 0x669 },
+    { 0x66E, 0x6D3 },
+    { 0x6D5, 0x6DC },
+    { 0x6DF, 0x6E8 },
+    { 0x6EA, 0x6FC },
+    { 0x6FF, 0x6FF },
+    { 0x710, 0x74A },
+    { 0x74D, 0x7B1 },
+    { 0x7C0, 0x7F5 },
+    { 0x7FA, 0x7FA },
+    { 0x7FD, 0x7FD },
+    { 0x800, 0x82D },
+    { 0x840, 0x85B },
+    { 0x860, 0x86A },
+    { 0x870, 0x887 },
+    { 0x889, 0x88E },
+    { 0x898, 0x8E1 },
+    { 0x8E3, 0x963 },
+    { 0x966, 0x96F },
+    { 0x971, 0x983 },
+    { 0x985, 0x98C },
+    { 0x98F, 0x990 },
+    { 0x993, 0x9A8 },
+    { 0x9AA, 0x9B0 },
+    { 0x9B2, 0x9B2 },
+    { 0x9B6, 0x9B9 },
+    { 0x9BC, 0x9C4 },
+    { 0x9C7, 0x9C8 },
+    { 0x9CB, 0x9CE },
+    { 0x9D7, 0x9D7 },
+    { 0x9DC, 0x9DD },
+    { 0x9DF, 0x9E3 },
+    { 0x9E6, 0x9F1 },
+    { 0x9F4, 0x9F9 },
+    { 0x9FC, 0x9FC },
+    { 0x9FE, 0x9FE },
+    { 0xA01, 0xA03 },
+    { 0xA05, 0xA0A },
+    { 0xA0F, 0xA10 },
+    { 0xA13, 0xA28 },
+    { 0xA2A, 0xA30 },
+    { 0xA32, 0xA33 },
+    { 0xA35, 0xA36 },
+    { 0xA38, 0xA39 },
+    { 0xA3C, 0xA3C },
+    { 0xA3E, 0xA42 },
+    { 0xA47, 0xA48 },
+    { 0xA4B, 0xA4D },
+    { 0xA51, 0xA51 },
+    { 0xA59, 0xA5C },
+    { 0xA5E, 0xA5E },
+    { 0xA66, 0xA75 },
+    { 0xA81, 0xA83 },
+    { 0xA85, 0xA8D },
+    { 0xA8F, 0xA91 },
+    { 0xA93, 0xAA8 },
+    { 0xAAA, 0xAB0 },
+    { 0xAB2, 0xAB3 },
+    { 0xAB5, 0xAB9 },
+    { 0xABC, 0xAC5 },
+    { 0xAC7, 0xAC9 },
+    { 0xACB, 0xACD },
+    { 0xAD0, 0xAD0 },
+    { 0xAE0, 0xAE3 },
+    { 0xAE6, 0xAEF },
+    { 0xAF9, 0xAFF },
+    { 0xB01, 0xB03 },
+    { 0xB05, 0xB0C },
+    { 0xB0F, 0xB10 },
+    { 0xB13, 0xB28 },
+    { 0xB2A, 0xB30 },
+    { 0xB32, 0xB33 },
+    { 0xB35, 0xB39 },
+    { 0xB3C, 0xB44 },
+    { 0xB47, 0xB48 },
+    { 0xB4B, 0xB4D },
+    { 0xB55, 0xB57 },
+    { 0xB5C, 0xB5D },
+    { 0xB5F, 0xB63 },
+    { 0xB66, 0xB6F },
+    { 0xB71, 0xB77 },
+    { 0xB82, 0xB83 },
+    { 0xB85, 0xB8A },
+    { 0xB8E, 0xB90 },
+    { 0xB92, 0xB95 },
+    { 0xB99, 0xB9A },
+    { 0xB9C, 0xB9C },
+    { 0xB9E, 0xB9F },
+    { 0xBA3, 0xBA4 },
+    { 0xBA8, 0xBAA },
+    { 0xBAE, 0xBB9 },
+    { 0xBBE, 0xBC2 },
+    { 0xBC6, 0xBC8 },
+    { 0xBCA, 0xBCD },
+    { 0xBD0, 0xBD0 },
+    { 0xBD7, 0xBD7 },
+    { 0xBE6, 0xBF2 },
+    { 0xC00, 0xC0C },
+    { 0xC0E, 0xC10 },
+    { 0xC12, 0xC28 },
+    { 0xC2A, 0xC39 },
+    { 0xC3C, 0xC44 },
+    { 0xC46, 0xC48 },
+    { 0xC4A, 0xC4D },
+    { 0xC55, 0xC56 },
+    { 0xC58, 0xC5A },
+    { 0xC5D, 0xC5D },
+    { 0xC60, 0xC63 },
+    { 0xC66, 0xC6F },
+    { 0xC78, 0xC7E },
+    { 0xC80, 0xC83 },
+    { 0xC85, 0xC8C },
+    { 0xC8E, 0xC90 },
+    { 0xC92, 0xCA8 },
+    { 0xCAA, 0xCB3 },
+    { 0xCB5, 0xCB9 },
+    { 0xCBC, 0xCC4 },
+    { 0xCC6, 0xCC8 },
+    { 0xCCA, 0xCCD },
+    { 0xCD5, 0xCD6 },
+    { 0xCDD, 0xCDE },
+    { 0xCE0, 0xCE3 },
+    { 0xCE6, 0xCEF },
+    { 0xCF1, 0xCF2 },
+    { 0xD00, 0xD0C },
+    { 0xD0E, 0xD10 },
+    { 0xD12, 0xD44 },
+    { 0xD46, 0xD48 },
+    { 0xD4A, 0xD4E },
+    { 0xD54, 0xD63 },
+    { 0xD66, 0xD78 },
+    { 0xD7A, 0xD7F },
+    { 0xD81, 0xD83 },
+    { 0xD85, 0xD96 },
+    { 0xD9A, 0xDB1 },
+    { 0xDB3, 0xDBB },
+    { 0xDBD, 0xDBD },
+    { 0xDC0, 0xDC6 },
+    { 0xDCA, 0xDCA },
+    { 0xDCF, 0xDD4 },
+    { 0xDD6, 0xDD6 },
+    { 0xDD8, 0xDDF },
+    { 0xDE6, 0xDEF },
+    { 0xDF2, 0xDF3 },
+    { 0xE01, 0xE3A },
+    { 0xE40, 0xE4E },
+    { 0xE50, 0xE59 },
+    { 0xE81, 0xE82 },
+    { 0xE84, 0xE84 },
+    { 0xE86, 0xE8A },
+    { 0xE8C, 0xEA3 },
+    { 0xEA5, 0xEA5 },
+    { 0xEA7, 0xEBD },
+    { 0xEC0, 0xEC4 },
+    { 0xEC6, 0xEC6 },
+    { 0xEC8, 0xECD },
+    { 0xED0, 0xED9 },
+    { 0xEDC, 0xEDF },
+    { 0xF00, 0xF00 },
+    { 0xF18, 0xF19 },
+    { 0xF20, 0xF33 },
+    { 0xF35, 0xF35 },
+    { 0xF37, 0xF37 },
+    { 0xF39, 0xF39 },
+    { 0xF3E, 0xF47 },
+    { 0xF49, 0xF6C },
+    { 0xF71, 0xF84 },
+    { 0xF86, 0xF97 },
+    { 0xF99, 0xFBC },
+    { 0xFC6, 0xFC6 },
+    { 0x1000, 0x1049 },
+    { 0x1050, 0x109D },
+    { 0x10A0, 0x10C5 },
+    { 0x10C7, 0x10C7 },
+    { 0x10CD, 0x10CD },
+    { 0x10D0, 0x10FA },
+    { 0x10FC, 0x1248 },
+    { 0x124A, 0x124D },
+    { 0x1250, 0x1256 },
+    { 0x1258, 0x1258 },
+    { 0x125A, 0x125D },
+    { 0x1260, 0x1288 },
+    { 0x128A, 0x128D },
+    { 0x1290, 0x12B0 },
+    { 0x12B2, 0x12B5 },
+    { 0x12B8, 0x12BE },
+    { 0x12C0, 0x12C0 },
+    { 0x12C2, 0x12C5 },
+    { 0x12C8, 0x12D6 },
+    { 0x12D8, 0x1310 },
+    { 0x1312, 0x1315 },
+    { 0x1318, 0x135A },
+    { 0x135D, 0x135F },
+    { 0x1369, 0x137C },
+    { 0x1380, 0x138F },
+    { 0x13A0, 0x13F5 },
+    { 0x13F8, 0x13FD },
+    { 0x1401, 0x166C },
+    { 0x166F, 0x167F },
+    { 0x1681, 0x169A },
+    { 0x16A0, 0x16EA },
+    { 0x16EE, 0x16F8 },
+    { 0x1700, 0x1715 },
+    { 0x171F, 0x1734 },
+    { 0x1740, 0x1753 },
+    { 0x1760, 0x176C },
+    { 0x176E, 0x1770 },
+    { 0x1772, 0x1773 },
+    { 0x1780, 0x17D3 },
+    { 0x17D7, 0x17D7 },
+    { 0x17DC, 0x17DD },
+    { 0x17E0, 0x17E9 },
+    { 0x17F0, 0x17F9 },
+    { 0x180B, 0x180D },
+    { 0x180F, 0x1819 },
+    { 0x1820, 0x1878 },
+    { 0x1880, 0x18AA },
+    { 0x18B0, 0x18F5 },
+    { 0x1900, 0x191E },
+    { 0x1920, 0x192B },
+    { 0x1930, 0x193B },
+    { 0x1946, 0x196D },
+    { 0x1970, 0x1974 },
+    { 0x1980, 0x19AB },
+    { 0x19B0, 0x19C9 },
+    { 0x19D0, 0x19DA },
+    { 0x1A00, 0x1A1B },
+    { 0x1A20, 0x1A5E },
+    { 0x1A60, 0x1A7C },
+    { 0x1A7F, 0x1A89 },
+    { 0x1A90, 0x1A99 },
+    { 0x1AA7, 0x1AA7 },
+    { 0x1AB0, 0x1ACE },
+    { 0x1B00, 0x1B4C },
+    { 0x1B50, 0x1B59 },
+    { 0x1B6B, 0x1B73 },
+    { 0x1B80, 0x1BF3 },
+    { 0x1C00, 0x1C37 },
+    { 0x1C40, 0x1C49 },
+    { 0x1C4D, 0x1C7D },
+    { 0x1C80, 0x1C88 },
+    { 0x1C90, 0x1CBA },
+    { 0x1CBD, 0x1CBF },
+    { 0x1CD0, 0x1CD2 },
+    { 0x1CD4, 0x1CFA },
+    { 0x1D00, 0x1F15 },
+    { 0x1F18, 0x1F1D },
+    { 0x1F20, 0x1F45 },
+    { 0x1F48, 0x1F4D },
+    { 0x1F50, 0x1F57 },
+    { 0x1F59, 0x1F59 },
+    { 0x1F5B, 0x1F5B },
+    { 0x1F5D, 0x1F5D },
+    { 0x1F5F, 0x1F7D },
+    { 0x1F80, 0x1FB4 },
+    { 0x1FB6, 0x1FBC },
+    { 0x1FBE, 0x1FBE },
+    { 0x1FC2, 0x1FC4 },
+    { 0x1FC6, 0x1FCC },
+    { 0x1FD0, 0x1FD3 },
+    { 0x1FD6, 0x1FDB },
+    { 0x1FE0, 0x1FEC },
+    { 0x1FF2, 0x1FF4 },
+    { 0x1FF6, 0x1FFC },
+    { 0x2070, 0x2071 },
+    { 0x2074, 0x2079 },
+    { 0x207F, 0x2089 },
+    { 0x2090, 0x209C },
+    { 0x20D0, 0x20F0 },
+    { 0x2102, 0x2102 },
+    { 0x2107, 0x2107 },
+    { 0x210A, 0x2113 },
+    { 0x2115, 0x2115 },
+    { 0x2119, 0x211D },
+    { 0x2124, 0x2124 },
+    { 0x2126, 0x2126 },
+    { 0x2128, 0x2128 },
+    { 0x212A, 0x212D },
+    { 0x212F, 0x2139 },
+    { 0x213C, 0x213F },
+    { 0x2145, 0x2149 },
+    { 0x214E, 0x214E },
+    { 0x2150, 0x2189 },
+    { 0x2460, 0x249B },
+    { 0x24EA, 0x24FF },
+    { 0x2776, 0x2793 },
+    { 0x2C00, 0x2CE4 },
+    { 0x2CEB, 0x2CF3 },
+    { 0x2CFD, 0x2CFD },
+    { 0x2D00, 0x2D25 },
+    { 0x2D27, 0x2D27 },
+    { 0x2D2D, 0x2D2D },
+    { 0x2D30, 0x2D67 },
+    { 0x2D6F, 0x2D6F },
+    { 0x2D7F, 0x2D96 },
+    { 0x2DA0, 0x2DA6 },
+    { 0x2DA8, 0x2DAE },
+    { 0x2DB0, 0x2DB6 },
+    { 0x2DB8, 0x2DBE },
+    { 0x2DC0, 0x2DC6 },
+    { 0x2DC8, 0x2DCE },
+    { 0x2DD0, 0x2DD6 },
+    { 0x2DD8, 0x2DDE },
+    { 0x2DE0, 0x2DFF },
+    { 0x2E2F, 0x2E2F },
+    { 0x3005, 0x3007 },
+    { 0x3021, 0x302F },
+    { 0x3031, 0x3035 },
+    { 0x3038, 0x303C },
+    { 0x3041, 0x3096 },
+    { 0x3099, 0x309A },
+    { 0x309D, 0x309F },
+    { 0x30A1, 0x30FA },
+    { 0x30FC, 0x30FF },
+    { 0x3105, 0x312F },
+    { 0x3131, 0x318E },
+    { 0x3192, 0x3195 },
+    { 0x31A0, 0x31BF },
+    { 0x31F0, 0x31FF },
+    { 0x3220, 0x3229 },
+    { 0x3248, 0x324F },
+    { 0x3251, 0x325F },
+    { 0x3280, 0x3289 },
+    { 0x32B1, 0x32BF },
+    { 0x3400, 0x4DBF },
+    { 0x4E00, 0xA48C },
+    { 0xA4D0, 0xA4FD },
+    { 0xA500, 0xA60C },
+    { 0xA610, 0xA62B },
+    { 0xA640, 0xA672 },
+    { 0xA674, 0xA67D },
+    { 0xA67F, 0xA6F1 },
+    { 0xA717, 0xA71F },
+    { 0xA722, 0xA788 },
+    { 0xA78B, 0xA7CA },
+    { 0xA7D0, 0xA7D1 },
+    { 0xA7D3, 0xA7D3 },
+    { 0xA7D5, 0xA7D9 },
+    { 0xA7F2, 0xA827 },
+    { 0xA82C, 0xA82C },
+    { 0xA830, 0xA835 },
+    { 0xA840, 0xA873 },
+    { 0xA880, 0xA8C5 },
+    { 0xA8D0, 0xA8D9 },
+    { 0xA8E0, 0xA8F7 },
+    { 0xA8FB, 0xA8FB },
+    { 0xA8FD, 0xA92D },
+    { 0xA930, 0xA953 },
+    { 0xA960, 0xA97C },
+    { 0xA980, 0xA9C0 },
+    { 0xA9CF, 0xA9D9 },
+    { 0xA9E0, 0xA9FE },
+    { 0xAA00, 0xAA36 },
+    { 0xAA40, 0xAA4D },
+    { 0xAA50, 0xAA59 },
+    { 0xAA60, 0xAA76 },
+    { 0xAA7A, 0xAAC2 },
+    { 0xAADB, 0xAADD },
+    { 0xAAE0, 0xAAEF },
+    { 0xAAF2, 0xAAF6 },
+    { 0xAB01, 0xAB06 },
+    { 0xAB09, 0xAB0E },
+    { 0xAB11, 0xAB16 },
+    { 0xAB20, 0xAB26 },
+    { 0xAB28, 0xAB2E },
+    { 0xAB30, 0xAB5A },
+    { 0xAB5C, 0xAB69 },
+    { 0xAB70, 0xABEA },
+    { 0xABEC, 0xABED },
+    { 0xABF0, 0xABF9 },
+    { 0xAC00, 0xD7A3 },
+    { 0xD7B0, 0xD7C6 },
+    { 0xD7CB, 0xD7FB },
+    { 0xF900, 0xFA6D },
+    { 0xFA70, 0xFAD9 },
+    { 0xFB00, 0xFB06 },
+    { 0xFB13, 0xFB17 },
+    { 0xFB1D, 0xFB28 },
+    { 0xFB2A, 0xFB36 },
+    { 0xFB38, 0xFB3C },
+    { 0xFB3E, 0xFB3E },
+    { 0xFB40, 0xFB41 },
+    { 0xFB43, 0xFB44 },
+    { 0xFB46, 0xFBB1 },
+    { 0xFBD3, 0xFD3D },
+    { 0xFD50, 0xFD8F },
+    { 0xFD92, 0xFDC7 },
+    { 0xFDF0, 0xFDFB },
+    { 0xFE00, 0xFE0F },
+    { 0xFE20, 0xFE2F },
+    { 0xFE70, 0xFE74 },
+    { 0xFE76, 0xFEFC },
+    { 0xFF10, 0xFF19 },
+    { 0xFF21, 0xFF3A },
+    { 0xFF41, 0xFF5A },
+    { 0xFF66, 0xFFBE },
+    { 0xFFC2, 0xFFC7 },
+    { 0xFFCA, 0xFFCF },
+    { 0xFFD2, 0xFFD7 },
+    { 0xFFDA, 0xFFDC },
+    { 0x10000, 0x1000B },
+    { 0x1000D, 0x10026 },
+    { 0x10028, 0x1003A },
+    { 0x1003C, 0x1003D },
+    { 0x1003F, 0x1004D },
+    { 0x10050, 0x1005D },
+    { 0x10080, 0x100FA },
+    { 0x10107, 0x10133 },
+    { 0x10140, 0x10178 },
+    { 0x1018A, 0x1018B },
+    { 0x101FD, 0x101FD },
+    { 0x10280, 0x1029C },
+    { 0x102A0, 0x102D0 },
+    { 0x102E0, 0x102FB },
+    { 0x10300, 0x10323 },
+    { 0x1032D, 0x1034A },
+    { 0x10350, 0x1037A },
+    { 0x10380, 0x1039D },
+    { 0x103A0, 0x103C3 },
+    { 0x103C8, 0x103CF },
+    { 0x103D1, 0x103D5 },
+    { 0x10400, 0x1049D },
+    { 0x104A0, 0x104A9 },
+    { 0x104B0, 0x104D3 },
+    { 0x104D8, 0x104FB },
+    { 0x10500, 0x10527 },
+    { 0x10530, 0x10563 },
+    { 0x10570, 0x1057A },
+    { 0x1057C, 0x1058A },
+    { 0x1058C, 0x10592 },
+    { 0x10594, 0x10595 },
+    { 0x10597, 0x105A1 },
+    { 0x105A3, 0x105B1 },
+    { 0x105B3, 0x105B9 },
+    { 0x105BB, 0x105BC },
+    { 0x10600, 0x10736 },
+    { 0x10740, 0x10755 },
+    { 0x10760, 0x10767 },
+    { 0x10780, 0x10785 },
+    { 0x10787, 0x107B0 },
+    { 0x107B2, 0x107BA },
+    { 0x10800, 0x10805 },
+    { 0x10808, 0x10808 },
+    { 0x1080A, 0x10835 },
+    { 0x10837, 0x10838 },
+    { 0x1083C, 0x1083C },
+    { 0x1083F, 0x10855 },
+    { 0x10858, 0x10876 },
+    { 0x10879, 0x1089E },
+    { 0x108A7, 0x108AF },
+    { 0x108E0, 0x108F2 },
+    { 0x108F4, 0x108F5 },
+    { 0x108FB, 0x1091B },
+    { 0x10920, 0x10939 },
+    { 0x10980, 0x109B7 },
+    { 0x109BC, 0x109CF },
+    { 0x109D2, 0x10A03 },
+    { 0x10A05, 0x10A06 },
+    { 0x10A0C, 0x10A13 },
+    { 0x10A15, 0x10A17 },
+    { 0x10A19, 0x10A35 },
+    { 0x10A38, 0x10A3A },
+    { 0x10A3F, 0x10A48 },
+    { 0x10A60, 0x10A7E },
+    { 0x10A80, 0x10A9F },
+    { 0x10AC0, 0x10AC7 },
+    { 0x10AC9, 0x10AE6 },
+    { 0x10AEB, 0x10AEF },
+    { 0x10B00, 0x10B35 },
+    { 0x10B40, 0x10B55 },
+    { 0x10B58, 0x10B72 },
+    { 0x10B78, 0x10B91 },
+    { 0x10BA9, 0x10BAF },
+    { 0x10C00, 0x10C48 },
+    { 0x10C80, 0x10CB2 },
+    { 0x10CC0, 0x10CF2 },
+    { 0x10CFA, 0x10D27 },
+    { 0x10D30, 0x10D39 },
+    { 0x10E60, 0x10E7E },
+    { 0x10E80, 0x10EA9 },
+    { 0x10EAB, 0x10EAC },
+    { 0x10EB0, 0x10EB1 },
+    { 0x10F00, 0x10F27 },
+    { 0x10F30, 0x10F54 },
+    { 0x10F70, 0x10F85 },
+    { 0x10FB0, 0x10FCB },
+    { 0x10FE0, 0x10FF6 },
+    { 0x11000, 0x11046 },
+    { 0x11052, 0x11075 },
+    { 0x1107F, 0x110BA },
+    { 0x110C2, 0x110C2 },
+    { 0x110D0, 0x110E8 },
+    { 0x110F0, 0x110F9 },
+    { 0x11100, 0x11134 },
+    { 0x11136, 0x1113F },
+    { 0x11144, 0x11147 },
+    { 0x11150, 0x11173 },
+    { 0x11176, 0x11176 },
+    { 0x11180, 0x111C4 },
+    { 0x111C9, 0x111CC },
+    { 0x111CE, 0x111DA },
+    { 0x111DC, 0x111DC },
+    { 0x111E1, 0x111F4 },
+    { 0x11200, 0x11211 },
+    { 0x11213, 0x11237 },
+    { 0x1123E, 0x1123E },
+    { 0x11280, 0x11286 },
+    { 0x11288, 0x11288 },
+    { 0x1128A, 0x1128D },
+    { 0x1128F, 0x1129D },
+    { 0x1129F, 0x112A8 },
+    { 0x112B0, 0x112EA },
+    { 0x112F0, 0x112F9 },
+    { 0x11300, 0x11303 },
+    { 0x11305, 0x1130C },
+    { 0x1130F, 0x11310 },
+    { 0x11313, 0x11328 },
+    { 0x1132A, 0x11330 },
+    { 0x11332, 0x11333 },
+    { 0x11335, 0x11339 },
+    { 0x1133B, 0x11344 },
+    { 0x11347, 0x11348 },
+    { 0x1134B, 0x1134D },
+    { 0x11350, 0x11350 },
+    { 0x11357, 0x11357 },
+    { 0x1135D, 0x11363 },
+    { 0x11366, 0x1136C },
+    { 0x11370, 0x11374 },
+    { 0x11400, 0x1144A },
+    { 0x11450, 0x11459 },
+    { 0x1145E, 0x11461 },
+    { 0x11480, 0x114C5 },
+    { 0x114C7, 0x114C7 },
+    { 0x114D0, 0x114D9 },
+    { 0x11580, 0x115B5 },
+    { 0x115B8, 0x115C0 },
+    { 0x115D8, 0x115DD },
+    { 0x11600, 0x11640 },
+    { 0x11644, 0x11644 },
+    { 0x11650, 0x11659 },
+    { 0x11680, 0x116B8 },
+    { 0x116C0, 0x116C9 },
+    { 0x11700, 0x1171A },
+    { 0x1171D, 0x1172B },
+    { 0x11730, 0x1173B },
+    { 0x11740, 0x11746 },
+    { 0x11800, 0x1183A },
+    { 0x118A0, 0x118F2 },
+    { 0x118FF, 0x11906 },
+    { 0x11909, 0x11909 },
+    { 0x1190C, 0x11913 },
+    { 0x11915, 0x11916 },
+    { 0x11918, 0x11935 },
+    { 0x11937, 0x11938 },
+    { 0x1193B, 0x11943 },
+    { 0x11950, 0x11959 },
+    { 0x119A0, 0x119A7 },
+    { 0x119AA, 0x119D7 },
+    { 0x119DA, 0x119E1 },
+    { 0x119E3, 0x119E4 },
+    { 0x11A00, 0x11A3E },
+    { 0x11A47, 0x11A47 },
+    { 0x11A50, 0x11A99 },
+    { 0x11A9D, 0x11A9D },
+    { 0x11AB0, 0x11AF8 },
+    { 0x11C00, 0x11C08 },
+    { 0x11C0A, 0x11C36 },
+    { 0x11C38, 0x11C40 },
+    { 0x11C50, 0x11C6C },
+    { 0x11C72, 0x11C8F },
+    { 0x11C92, 0x11CA7 },
+    { 0x11CA9, 0x11CB6 },
+    { 0x11D00, 0x11D06 },
+    { 0x11D08, 0x11D09 },
+    { 0x11D0B, 0x11D36 },
+    { 0x11D3A, 0x11D3A },
+    { 0x11D3C, 0x11D3D },
+    { 0x11D3F, 0x11D47 },
+    { 0x11D50, 0x11D59 },
+    { 0x11D60, 0x11D65 },
+    { 0x11D67, 0x11D68 },
+    { 0x11D6A, 0x11D8E },
+    { 0x11D90, 0x11D91 },
+    { 0x11D93, 0x11D98 },
+    { 0x11DA0, 0x11DA9 },
+    { 0x11EE0, 0x11EF6 },
+    { 0x11FB0, 0x11FB0 },
+    { 0x11FC0, 0x11FD4 },
+    { 0x12000, 0x12399 },
+    { 0x12400, 0x1246E },
+    { 0x12480, 0x12543 },
+    { 0x12F90, 0x12FF0 },
+    { 0x13000, 0x1342E },
+    { 0x14400, 0x14646 },
+    { 0x16800, 0x16A38 },
+    { 0x16A40, 0x16A5E },
+    { 0x16A60, 0x16A69 },
+    { 0x16A70, 0x16ABE },
+    { 0x16AC0, 0x16AC9 },
+    { 0x16AD0, 0x16AED },
+    { 0x16AF0, 0x16AF4 },
+    { 0x16B00, 0x16B36 },
+    { 0x16B40, 0x16B43 },
+    { 0x16B50, 0x16B59 },
+    { 0x16B5B, 0x16B61 },
+    { 0x16B63, 0x16B77 },
+    { 0x16B7D, 0x16B8F },
+    { 0x16E40, 0x16E96 },
+    { 0x16F00, 0x16F4A },
+    { 0x16F4F, 0x16F87 },
+    { 0x16F8F, 0x16F9F },
+    { 0x16FE0, 0x16FE1 },
+    { 0x16FE3, 0x16FE4 },
+    { 0x16FF0, 0x16FF1 },
+    { 0x17000, 0x187F7 },
+    { 0x18800, 0x18CD5 },
+    { 0x18D00, 0x18D08 },
+    { 0x1AFF0, 0x1AFF3 },
+    { 0x1AFF5, 0x1AFFB },
+    { 0x1AFFD, 0x1AFFE },
+    { 0x1B000, 0x1B122 },
+    { 0x1B150, 0x1B152 },
+    { 0x1B164, 0x1B167 },
+    { 0x1B170, 0x1B2FB },
+    { 0x1BC00, 0x1BC6A },
+    { 0x1BC70, 0x1BC7C },
+    { 0x1BC80, 0x1BC88 },
+    { 0x1BC90, 0x1BC99 },
+    { 0x1BC9D, 0x1BC9E },
+    { 0x1CF00, 0x1CF2D },
+    { 0x1CF30, 0x1CF46 },
+    { 0x1D165, 0x1D169 },
+    { 0x1D16D, 0x1D172 },
+    { 0x1D17B, 0x1D182 },
+    { 0x1D185, 0x1D18B },
+    { 0x1D1AA, 0x1D1AD },
+    { 0x1D242, 0x1D244 },
+    { 0x1D2E0, 0x1D2F3 },
+    { 0x1D360, 0x1D378 },
+    { 0x1D400, 0x1D454 },
+    { 0x1D456, 0x1D49C },
+    { 0x1D49E, 0x1D49F },
+    { 0x1D4A2, 0x1D4A2 },
+    { 0x1D4A5, 0x1D4A6 },
+    { 0x1D4A9, 0x1D4AC },
+    { 0x1D4AE, 0x1D4B9 },
+    { 0x1D4BB, 0x1D4BB },
+    { 0x1D4BD, 0x1D4C3 },
+    { 0x1D4C5, 0x1D505 },
+    { 0x1D507, 0x1D50A },
+    { 0x1D50D, 0x1D514 },
+    { 0x1D516, 0x1D51C },
+    { 0x1D51E, 0x1D539 },
+    { 0x1D53B, 0x1D53E },
+    { 0x1D540, 0x1D544 },
+    { 0x1D546, 0x1D546 },
+    { 0x1D54A, 0x1D550 },
+    { 0x1D552, 0x1D6A5 },
+    { 0x1D6A8, 0x1D6C0 },
+    { 0x1D6C2, 0x1D6DA },
+    { 0x1D6DC, 0x1D6FA },
+    { 0x1D6FC, 0x1D714 },
+    { 0x1D716, 0x1D734 },
+    { 0x1D736, 0x1D74E },
+    { 0x1D750, 0x1D76E },
+    { 0x1D770, 0x1D788 },
+    { 0x1D78A, 0x1D7A8 },
+    { 0x1D7AA, 0x1D7C2 },
+    { 0x1D7C4, 0x1D7CB },
+    { 0x1D7CE, 0x1D7FF },
+    { 0x1DA00, 0x1DA36 },
+    { 0x1DA3B, 0x1DA6C },
+    { 0x1DA75, 0x1DA75 },
+    { 0x1DA84, 0x1DA84 },
+    { 0x1DA9B, 0x1DA9F },
+    { 0x1DAA1, 0x1DAAF },
+    { 0x1DF00, 0x1DF1E },
+    { 0x1E000, 0x1E006 },
+    { 0x1E008, 0x1E018 },
+    { 0x1E01B, 0x1E021 },
+    { 0x1E023, 0x1E024 },
+    { 0x1E026, 0x1E02A },
+    { 0x1E100, 0x1E12C },
+    { 0x1E130, 0x1E13D },
+    { 0x1E140, 0x1E149 },
+    { 0x1E14E, 0x1E14E },
+    { 0x1E290, 0x1E2AE },
+    { 0x1E2C0, 0x1E2F9 },
+    { 0x1E7E0, 0x1E7E6 },
+    { 0x1E7E8, 0x1E7EB },
+    { 0x1E7ED, 0x1E7EE },
+    { 0x1E7F0, 0x1E7FE },
+    { 0x1E800, 0x1E8C4 },
+    { 0x1E8C7, 0x1E8D6 },
+    { 0x1E900, 0x1E94B },
+    { 0x1E950, 0x1E959 },
+    { 0x1EC71, 0x1ECAB },
+    { 0x1ECAD, 0x1ECAF },
+    { 0x1ECB1, 0x1ECB4 },
+    { 0x1ED01, 0x1ED2D },
+    { 0x1ED2F, 0x1ED3D },
+    { 0x1EE00, 0x1EE03 },
+    { 0x1EE05, 0x1EE1F },
+    { 0x1EE21, 0x1EE22 },
+    { 0x1EE24, 0x1EE24 },
+    { 0x1EE27, 0x1EE27 },
+    { 0x1EE29, 0x1EE32 },
+    { 0x1EE34, 0x1EE37 },
+    { 0x1EE39, 0x1EE39 },
+    { 0x1EE3B, 0x1EE3B },
+    { 0x1EE42, 0x1EE42 },
+    { 0x1EE47, 0x1EE47 },
+    { 0x1EE49, 0x1EE49 },
+    { 0x1EE4B, 0x1EE4B },
+    { 0x1EE4D, 0x1EE4F },
+    { 0x1EE51, 0x1EE52 },
+    { 0x1EE54, 0x1EE54 },
+    { 0x1EE57, 0x1EE57 },
+    { 0x1EE59, 0x1EE59 },
+    { 0x1EE5B, 0x1EE5B },
+    { 0x1EE5D, 0x1EE5D },
+    { 0x1EE5F, 0x1EE5F },
+    { 0x1EE61, 0x1EE62 },
+    { 0x1EE64, 0x1EE64 },
+    { 0x1EE67, 0x1EE6A },
+    { 0x1EE6C, 0x1EE72 },
+    { 0x1EE74, 0x1EE77 },
+    { 0x1EE79, 0x1EE7C },
+    { 0x1EE7E, 0x1EE7E },
+    { 0x1EE80, 0x1EE89 },
+    { 0x1EE8B, 0x1EE9B },
+    { 0x1EEA1, 0x1EEA3 },
+    { 0x1EEA5, 0x1EEA9 },
+    { 0x1EEAB, 0x1EEBB },
+    { 0x1F100, 0x1F10C },
+    { 0x1FBF0, 0x1FBF9 },
+    { 0x20000, 0x2A6DF },
+    { 0x2A700, 0x2B738 },
+    { 0x2B740, 0x2B81D },
+    { 0x2B820, 0x2CEA1 },
+    { 0x2CEB0, 0x2EBE0 },
+    { 0x2F800, 0x2FA1D },
+    { 0x30000, 0x3134A },
+    { 0xE0100, 0xE01EF },
+};
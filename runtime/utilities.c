@@ -9,17 +9,18 @@
 
 extern symbol * create_s(void) {
     symbol * p;
-    void * mem = malloc(HEAD + (CREATE_SIZE + 1) * sizeof(symbol));
+    void * mem = SN_malloc(HEAD + (CREATE_SIZE + 1) * sizeof(symbol));
     if (mem == NULL) return NULL;
     p = (symbol *) (HEAD + (char *) mem);
+    IS_INLINE(p) = 0;
     CAPACITY(p) = CREATE_SIZE;
     SET_SIZE(p, 0);
     return p;
 }
 
 extern void lose_s(symbol * p) {
-    if (p == NULL) return;
-    free((char *) p - HEAD);
+    if (p == NULL || IS_INLINE(p)) return;
+    SN_free((char *) p - HEAD);
 }
 
 /*
@@ -217,6 +218,136 @@ extern int out_grouping_b(struct SN_env * z, const unsigned char * s, int min, i
     return 0;
 }
 
+/* Code for character groupings: byte class tables */
+
+#define IN_SET(s, ch, min, max) \
+    ((ch) <= (max) && (ch) >= (min) && \
+     (s[((ch) - (min)) >> 3] & (0X1 << (((ch) - (min)) & 0X7))) != 0)
+
+extern int in_class(struct SN_env * z, const unsigned char * t, int repeat) {
+    const symbol * p = z->p;
+    int c = z->c;
+    int l = z->l;
+    do {
+        if (c >= l) { z->c = c; return -1; }
+        if (!t[p[c]]) { z->c = c; return 1; }
+        c++;
+    } while (repeat);
+    z->c = c;
+    return 0;
+}
+
+extern int in_class_b(struct SN_env * z, const unsigned char * t, int repeat) {
+    const symbol * p = z->p;
+    int c = z->c;
+    int lb = z->lb;
+    do {
+        if (c <= lb) { z->c = c; return -1; }
+        if (!t[p[c - 1]]) { z->c = c; return 1; }
+        c--;
+    } while (repeat);
+    z->c = c;
+    return 0;
+}
+
+extern int out_class(struct SN_env * z, const unsigned char * t, int repeat) {
+    const symbol * p = z->p;
+    int c = z->c;
+    int l = z->l;
+    do {
+        if (c >= l) { z->c = c; return -1; }
+        if (t[p[c]]) { z->c = c; return 1; }
+        c++;
+    } while (repeat);
+    z->c = c;
+    return 0;
+}
+
+extern int out_class_b(struct SN_env * z, const unsigned char * t, int repeat) {
+    const symbol * p = z->p;
+    int c = z->c;
+    int lb = z->lb;
+    do {
+        if (c <= lb) { z->c = c; return -1; }
+        if (t[p[c - 1]]) { z->c = c; return 1; }
+        c--;
+    } while (repeat);
+    z->c = c;
+    return 0;
+}
+
+/* ASCII characters are decided by the table alone.  Otherwise the character
+ * is decoded exactly as in_grouping_U() etc do, but that's skipped when the
+ * table shows the character can't be in the grouping. */
+
+extern int in_class_U(struct SN_env * z, const unsigned char * t, const unsigned char * s, int min, int max, int repeat) {
+    do {
+        int b, ch, w;
+        if (z->c >= z->l) return -1;
+        b = z->p[z->c];
+        if (b < 0x80) {
+            if (!t[b]) return 1;
+            w = 1;
+        } else {
+            w = get_utf8(z->p, z->c, z->l, & ch);
+            if (!t[b] || !IN_SET(s, ch, min, max)) return w;
+        }
+        z->c += w;
+    } while (repeat);
+    return 0;
+}
+
+extern int in_class_b_U(struct SN_env * z, const unsigned char * t, const unsigned char * s, int min, int max, int repeat) {
+    do {
+        int b, ch, w;
+        if (z->c <= z->lb) return -1;
+        b = z->p[z->c - 1];
+        if (b < 0x80) {
+            if (!t[b]) return 1;
+            w = 1;
+        } else {
+            w = get_b_utf8(z->p, z->c, z->lb, & ch);
+            if (!IN_SET(s, ch, min, max)) return w;
+        }
+        z->c -= w;
+    } while (repeat);
+    return 0;
+}
+
+extern int out_class_U(struct SN_env * z, const unsigned char * t, const unsigned char * s, int min, int max, int repeat) {
+    do {
+        int b, ch, w;
+        if (z->c >= z->l) return -1;
+        b = z->p[z->c];
+        if (b < 0x80) {
+            if (t[b]) return 1;
+            w = 1;
+        } else {
+            w = get_utf8(z->p, z->c, z->l, & ch);
+            if (t[b] && IN_SET(s, ch, min, max)) return w;
+        }
+        z->c += w;
+    } while (repeat);
+    return 0;
+}
+
+extern int out_class_b_U(struct SN_env * z, const unsigned char * t, const unsigned char * s, int min, int max, int repeat) {
+    do {
+        int b, ch, w;
+        if (z->c <= z->lb) return -1;
+        b = z->p[z->c - 1];
+        if (b < 0x80) {
+            if (t[b]) return 1;
+            w = 1;
+        } else {
+            w = get_b_utf8(z->p, z->c, z->lb, & ch);
+            if (IN_SET(s, ch, min, max)) return w;
+        }
+        z->c -= w;
+    } while (repeat);
+    return 0;
+}
+
 extern int eq_s(struct SN_env * z, int s_size, const symbol * s) {
     if (z->l - z->c < s_size || memcmp(z->p + z->c, s, s_size * sizeof(symbol)) != 0) return 0;
     z->c += s_size; return 1;
@@ -235,10 +366,12 @@ extern int eq_v_b(struct SN_env * z, const symbol * p) {
     return eq_s_b(z, SIZE(p), p);
 }
 
-extern int find_among(struct SN_env * z, const struct among * v, int v_size) {
+extern int find_among(struct SN_env * z, const struct among_table * t) {
 
+    const struct among * v = t->v;
+    const symbol * pool = t->pool;
     int i = 0;
-    int j = v_size;
+    int j = t->v_size;
 
     int c = z->c; int l = z->l;
     const symbol * q = z->p + c;
@@ -258,7 +391,7 @@ extern int find_among(struct SN_env * z, const struct among * v, int v_size) {
         {
             int i2; for (i2 = common; i2 < w->s_size; i2++) {
                 if (c + common == l) { diff = -1; break; }
-                diff = q[common] - w->s[i2];
+                diff = q[common] - pool[w->s_offset + i2];
                 if (diff != 0) break;
                 common++;
             }
@@ -285,10 +418,11 @@ extern int find_among(struct SN_env * z, const struct among * v, int v_size) {
     while (1) {
         w = v + i;
         if (common_i >= w->s_size) {
+            int (* function)(struct SN_env *) = t->functions ? t->functions[i] : 0;
             z->c = c + w->s_size;
-            if (w->function == 0) return w->result;
+            if (function == 0) return w->result;
             {
-                int res = w->function(z);
+                int res = function(z);
                 z->c = c + w->s_size;
                 if (res) return w->result;
             }
@@ -300,10 +434,12 @@ extern int find_among(struct SN_env * z, const struct among * v, int v_size) {
 
 /* find_among_b is for backwards processing. Same comments apply */
 
-extern int find_among_b(struct SN_env * z, const struct among * v, int v_size) {
+extern int find_among_b(struct SN_env * z, const struct among_table * t) {
 
+    const struct among * v = t->v;
+    const symbol * pool = t->pool;
     int i = 0;
-    int j = v_size;
+    int j = t->v_size;
 
     int c = z->c; int lb = z->lb;
     const symbol * q = z->p + c - 1;
@@ -323,7 +459,7 @@ extern int find_among_b(struct SN_env * z, const struct among * v, int v_size) {
         {
             int i2; for (i2 = w->s_size - 1 - common; i2 >= 0; i2--) {
                 if (c - common == lb) { diff = -1; break; }
-                diff = q[- common] - w->s[i2];
+                diff = q[- common] - pool[w->s_offset + i2];
                 if (diff != 0) break;
                 common++;
             }
@@ -340,10 +476,11 @@ extern int find_among_b(struct SN_env * z, const struct among * v, int v_size) {
     while (1) {
         w = v + i;
         if (common_i >= w->s_size) {
+            int (* function)(struct SN_env *) = t->functions ? t->functions[i] : 0;
             z->c = c - w->s_size;
-            if (w->function == 0) return w->result;
+            if (function == 0) return w->result;
             {
-                int res = w->function(z);
+                int res = function(z);
                 z->c = c - w->s_size;
                 if (res) return w->result;
             }
@@ -356,17 +493,28 @@ extern int find_among_b(struct SN_env * z, const struct among * v, int v_size) {
 
 /* Increase the size of the buffer pointed to by p to at least n symbols.
  * If insufficient memory, returns NULL and frees the old buffer.
+ *
+ * The capacity grows geometrically so repeated growth is amortised O(1).
+ * A buffer stored inline in the SN_env is moved to the heap.
  */
 static symbol * increase_size(symbol * p, int n) {
     symbol * q;
-    int new_size = n + 20;
-    void * mem = realloc((char *) p - HEAD,
+    int new_size = n + (n >> 1) + 20;
+    void * mem;
+    if (IS_INLINE(p)) {
+        mem = SN_malloc(HEAD + (new_size + 1) * sizeof(symbol));
+        if (mem == NULL) return NULL;
+        memcpy(mem, (char *) p - HEAD, HEAD + SIZE(p) * sizeof(symbol));
+    } else {
+        mem = SN_realloc((char *) p - HEAD,
                          HEAD + (new_size + 1) * sizeof(symbol));
-    if (mem == NULL) {
-        lose_s(p);
-        return NULL;
+        if (mem == NULL) {
+            lose_s(p);
+            return NULL;
+        }
     }
     q = (symbol *) (HEAD + (char *)mem);
+    IS_INLINE(q) = 0;
     CAPACITY(q) = new_size;
     return q;
 }
@@ -384,8 +532,26 @@ extern int replace_s(struct SN_env * z, int c_bra, int c_ket, int s_size, const
         z->p = create_s();
         if (z->p == NULL) return -1;
     }
-    adjustment = s_size - (c_ket - c_bra);
+    DISCARD_INDEX(z);
     len = SIZE(z->p);
+    if (c_ket == len && c_bra + s_size <= CAPACITY(z->p)) {
+        /* Stemmers mostly replace the end of the word, in which case no
+         * symbols need moving, so it's just a change of length. */
+        adjustment = c_bra + s_size - len;
+        if (adjustment != 0) {
+            SET_SIZE(z->p, c_bra + s_size);
+            z->l += adjustment;
+            if (z->c >= c_ket)
+                z->c += adjustment;
+            else if (z->c > c_bra)
+                z->c = c_bra;
+        }
+        if (s_size) memmove(z->p + c_bra, s, s_size * sizeof(symbol));
+        if (adjptr != NULL)
+            *adjptr = adjustment;
+        return 0;
+    }
+    adjustment = s_size - (c_ket - c_bra);
     if (adjustment != 0) {
         if (adjustment + len > CAPACITY(z->p)) {
             z->p = increase_size(z->p, adjustment + len);
@@ -434,7 +600,19 @@ extern int slice_from_v(struct SN_env * z, const symbol * p) {
 }
 
 extern int slice_del(struct SN_env * z) {
-    return slice_from_s(z, 0, 0);
+    if (slice_check(z)) return -1;
+    if (z->ket == SIZE(z->p)) {
+        /* Deleting the end of the string just shortens it. */
+        DISCARD_INDEX(z);
+        SET_SIZE(z->p, z->bra);
+        z->l -= z->ket - z->bra;
+        if (z->c >= z->ket)
+            z->c -= z->ket - z->bra;
+        else if (z->c > z->bra)
+            z->c = z->bra;
+        return 0;
+    }
+    return replace_s(z, z->bra, z->ket, 0, 0, NULL);
 }
 
 extern int insert_s(struct SN_env * z, int bra, int ket, int s_size, const symbol * s) {
@@ -450,6 +628,178 @@ extern int insert_v(struct SN_env * z, int bra, int ket, const symbol * p) {
     return insert_s(z, bra, ket, SIZE(p), p);
 }
 
+/* The entry of t for character ch, or NULL if there isn't one.  This is a
+ * macro as it's used for most characters. */
+#define TRANSLATION_ENTRY(t, ch) \
+    ((ch) >> 8 < (t)->min_page || (ch) >> 8 > (t)->max_page ? NULL : \
+     (t)->index[(t)->page[((ch) >> 8) - (t)->min_page] + ((ch) & 0xFF)] == 0 ? NULL : \
+     &(t)->entry[(t)->index[(t)->page[((ch) >> 8) - (t)->min_page] + ((ch) & 0xFF)] - 1])
+
+/* Return the entry of t for the UTF-8 character which is the n bytes at q,
+ * or NULL if there isn't one. */
+static const struct translation_entry * translation_lookup_U(const struct translation * t,
+                                                             const symbol * q, int n) {
+    const struct translation_entry * x;
+    int ch = q[0];
+    int i;
+    if (ch < 0xC0 || ch >= 0xF8 || n != (ch < 0xE0 ? 2 : ch < 0xF0 ? 3 : 4)) return NULL;
+    ch &= 0x7F >> n;
+    for (i = 1; i < n; i++) {
+        if (q[i] < 0x80 || q[i] >= 0xC0) return NULL;
+        ch = ch << 6 | (q[i] & 0x3F);
+    }
+    /* A character has only one encoding of that length. */
+    x = TRANSLATION_ENTRY(t, ch);
+    return x && x->from_size == n ? x : NULL;
+}
+
+/* Remove the n symbols at position k of z->p, which are left over from
+ * translating in place. */
+static void close_gap(struct SN_env * z, int k, int n) {
+    if (n == 0) return;
+    memmove(z->p + k, z->p + k + n, (SIZE(z->p) - k - n) * sizeof(symbol));
+    SET_SIZE(z->p, SIZE(z->p) - n);
+    z->l -= n;
+}
+
+/* The string is rewritten in place, each character being looked up in t,
+ * with the output written at w while the input is read from r.  An entry
+ * whose replacement is longer than the gap between them is rare, so for
+ * that the gap is closed and replace_s() makes room.  Otherwise only a few
+ * symbols are copied at a time, which is done without calling memmove().
+ *
+ * Characters are split up as next would, so a character which isn't in t
+ * is copied as it is, even if it isn't valid UTF-8.  The cursor and slice
+ * are left as the loop would leave them: each pass of the loop sets the
+ * slice to the character matched, and the last fails at the limit after
+ * setting one end of the slice (or both, for the empty string).
+ */
+static int translate_string(struct SN_env * z, const struct translation * t0, int utf8) {
+    const struct translation t = *t0;
+    symbol * p = z->p;
+    int l = z->l;
+    int w = z->c;
+    int r = z->c;
+    int ket = -1;
+    int i;
+    DISCARD_INDEX(z);
+    while (r < l) {
+        const struct translation_entry * x = NULL;
+        int b = p[r];
+        int n = 1;
+        if (!utf8 || b < 0x80) {
+            x = TRANSLATION_ENTRY(&t, b);
+        } else if (b >= 0xC0) {
+            /* The among matches a prefix of what next skips. */
+            n = b < 0xE0 ? 2 : b < 0xF0 ? 3 : 4;
+            if (r + n <= l) x = translation_lookup_U(&t, p + r, n);
+            if (x == NULL) {
+                n = 1;
+                while (r + n < l && p[r + n] >= 0x80 && p[r + n] < 0xC0) n++;
+            }
+        }
+        if (x == NULL) {
+            if (w != r) {
+                for (i = 0; i < n; i++) p[w + i] = p[r + i];
+            }
+            w += n;
+            r += n;
+            continue;
+        }
+        if (x->to_size > n + (r - w)) {
+            close_gap(z, w, r - w);
+            if (replace_s(z, w, w + n, x->to_size, t.pool + x->to, NULL) < 0)
+                return -1;
+            p = z->p;
+            l = z->l;
+            r = w + x->to_size;
+        } else {
+            for (i = 0; i < x->to_size; i++) p[w + i] = t.pool[x->to + i];
+            r += n;
+        }
+        ket = w + n;
+        w += x->to_size;
+    }
+    close_gap(z, w, r - w);
+    z->c = z->l;
+    z->bra = z->l;
+    if (t.empty) {
+        z->ket = z->l;
+    } else if (ket >= 0) {
+        z->ket = ket;
+    }
+    return 0;
+}
+
+/* The same going backwards, with the output written before w while the
+ * input is read before r. */
+static int translate_string_b(struct SN_env * z, const struct translation * t0, int utf8) {
+    const struct translation t = *t0;
+    symbol * p = z->p;
+    int lb = z->lb;
+    int w = z->c;
+    int r = z->c;
+    int bra = -1;
+    int i;
+    DISCARD_INDEX(z);
+    while (r > lb) {
+        const struct translation_entry * x;
+        int s = r - 1;
+        if (!utf8 || p[s] < 0x80) {
+            int b = p[s];
+            x = TRANSLATION_ENTRY(&t, b);
+        } else {
+            while (s > lb && p[s] < 0xC0) s--;
+            x = translation_lookup_U(&t, p + s, r - s);
+        }
+        if (x == NULL) {
+            if (w != r) {
+                for (i = 1; i <= r - s; i++) p[w - i] = p[r - i];
+            }
+            w -= r - s;
+            r = s;
+            continue;
+        }
+        if (x->to_size > (r - s) + (w - r)) {
+            close_gap(z, r, w - r);
+            if (replace_s(z, s, r, x->to_size, t.pool + x->to, NULL) < 0)
+                return -1;
+            p = z->p;
+            w = s;
+        } else {
+            w -= x->to_size;
+            for (i = 0; i < x->to_size; i++) p[w + i] = t.pool[x->to + i];
+        }
+        bra = s;
+        r = s;
+    }
+    close_gap(z, lb, w - lb);
+    z->c = lb;
+    z->ket = lb;
+    if (t.empty) {
+        z->bra = lb;
+    } else if (bra >= 0) {
+        z->bra = bra;
+    }
+    return 0;
+}
+
+extern int translate(struct SN_env * z, const struct translation * t) {
+    return translate_string(z, t, 0);
+}
+
+extern int translate_b(struct SN_env * z, const struct translation * t) {
+    return translate_string_b(z, t, 0);
+}
+
+extern int translate_U(struct SN_env * z, const struct translation * t) {
+    return translate_string(z, t, 1);
+}
+
+extern int translate_b_U(struct SN_env * z, const struct translation * t) {
+    return translate_string_b(z, t, 1);
+}
+
 extern symbol * slice_to(struct SN_env * z, symbol * p) {
     if (slice_check(z)) {
         lose_s(p);
@@ -457,6 +807,7 @@ extern symbol * slice_to(struct SN_env * z, symbol * p) {
     }
     {
         int len = z->ket - z->bra;
+        DISCARD_INDEX(z);
         if (CAPACITY(p) < len) {
             p = increase_size(p, len);
             if (p == NULL)
@@ -470,6 +821,7 @@ extern symbol * slice_to(struct SN_env * z, symbol * p) {
 
 extern symbol * assign_to(struct SN_env * z, symbol * p) {
     int len = z->l;
+    DISCARD_INDEX(z);
     if (CAPACITY(p) < len) {
         p = increase_size(p, len);
         if (p == NULL)
@@ -490,6 +842,181 @@ extern int len_utf8(const symbol * p) {
     return len;
 }
 
+/* Strings shorter than this aren't indexed, as decoding them is cheap. */
+#define INDEX_MIN_SIZE 16
+
+/* The value of len when z->p has been asked for once. */
+#define NOT_BUILT -2
+
+/* Build the index of z->p.  A continuation byte which doesn't follow the
+ * first byte of a character would be counted differently by len_utf8(),
+ * skip_utf8() and skip_b_utf8(), so a string with one can't be indexed. */
+static void build_index(struct SN_env * z) {
+    struct SN_index * x = z->index;
+    const symbol * p = z->p;
+    int size = SIZE(p);
+    int c;
+    int k = 0;
+    x->p = p;
+    x->len = -1;
+    if (x->capacity < size + 1) {
+        int capacity = size + 1 + (size >> 1);
+        int * mem = (int *) SN_malloc(2 * capacity * sizeof(int));
+        if (mem == NULL) return;
+        SN_free(x->start);
+        x->start = mem;
+        x->pos = mem + capacity;
+        x->capacity = capacity;
+    }
+    for (c = 0; c < size; c++) {
+        int b = p[c];
+        if (b >= 0x80 && b < 0xC0) {   /* 10------ */
+            if (c == 0 || p[c - 1] < 0x80) return;
+            x->pos[c] = -1;
+        } else {
+            x->pos[c] = k;
+            x->start[k++] = c;
+        }
+    }
+    x->pos[size] = k;
+    x->start[k] = size;
+    x->len = k;
+}
+
+/* Return the index of z->p, or NULL if it doesn't have one.  Building it
+ * costs more than decoding the string once, so that's only done the second
+ * time it's asked for while the string is unchanged. */
+static const struct SN_index * get_index(struct SN_env * z) {
+    struct SN_index * x = z->index;
+    if (x->p != z->p) {
+        if (SIZE(z->p) < INDEX_MIN_SIZE) return NULL;
+        x->p = z->p;
+        x->len = NOT_BUILT;
+        return NULL;
+    }
+    if (x->len == NOT_BUILT) build_index(z);
+    return x->len >= 0 ? x : NULL;
+}
+
+extern int lenof_utf8(struct SN_env * z, const symbol * p) {
+    if (p == z->p) {
+        const struct SN_index * x = get_index(z);
+        if (x) return x->len;
+    }
+    return len_utf8(p);
+}
+
+extern int hop_utf8(struct SN_env * z, int c, int limit, int n) {
+    const struct SN_index * x;
+    if (n > 1 && c >= 0 && limit >= c && limit <= SIZE(z->p) &&
+        (x = get_index(z)) != NULL) {
+        int k = x->pos[c];
+        int k_limit = x->pos[limit];
+        if (k >= 0 && k_limit >= 0) {
+            return k_limit - k < n ? -1 : x->start[k + n];
+        }
+    }
+    return skip_utf8(z->p, c, limit, n);
+}
+
+extern int hop_b_utf8(struct SN_env * z, int c, int limit, int n) {
+    const struct SN_index * x;
+    if (n > 1 && limit >= 0 && c >= limit && c <= SIZE(z->p) &&
+        (x = get_index(z)) != NULL) {
+        int k = x->pos[c];
+        int k_limit = x->pos[limit];
+        if (k >= 0 && k_limit >= 0) {
+            return k - k_limit < n ? -1 : x->start[k - n];
+        }
+    }
+    return skip_b_utf8(z->p, c, limit, n);
+}
+
+#ifdef SNOWBALL_UTF32
+extern int SN_set_current_utf8(struct SN_env * z, int size, const unsigned char * s) {
+    symbol * p;
+    int i = 0;
+    int n = 0;
+    if (z->p == NULL) {
+        z->p = create_s();
+        if (z->p == NULL) return -1;
+    }
+    DISCARD_INDEX(z);
+    /* There's never more than one code point for each byte. */
+    if (CAPACITY(z->p) < size) {
+        z->p = increase_size(z->p, size);
+        if (z->p == NULL) return -1;
+    }
+    p = z->p;
+    while (i < size) {
+        int b = s[i];
+        int ch;
+        if (b < 0x80) {
+            p[n++] = b;
+            i++;
+            continue;
+        }
+        /* Two and three byte sequences (other than surrogates) are checked
+         * inline, and anything else is left to SN_decode_utf8(). */
+        if (b >= 0xC2 && b < 0xE0 && i + 1 < size && (s[i + 1] & 0xC0) == 0x80) {
+            p[n++] = (b & 0x1F) << 6 | (s[i + 1] & 0x3F);
+            i += 2;
+            continue;
+        }
+        if (b >= 0xE0 && b < 0xF0 && i + 2 < size &&
+            (s[i + 1] & 0xC0) == 0x80 && (s[i + 2] & 0xC0) == 0x80) {
+            ch = (b & 0x0F) << 12 | (s[i + 1] & 0x3F) << 6 | (s[i + 2] & 0x3F);
+            if (ch >= 0x800 && (ch < 0xD800 || ch > 0xDFFF)) {
+                p[n++] = ch;
+                i += 3;
+                continue;
+            }
+        }
+        i += SN_decode_utf8(s + i, size - i, &ch);
+        p[n++] = ch >= 0 ? ch : 0xDC00 | s[i - 1];
+    }
+    SET_SIZE(p, n);
+    z->l = n;
+    z->c = 0;
+    return 0;
+}
+
+extern int SN_get_current_utf8(struct SN_env * z, unsigned char * out, int out_size) {
+    int i;
+    int j = 0;
+    for (i = 0; i < z->l; i++) {
+        int ch = z->p[i];
+        if (out_size - j < 4) {
+            /* Near the end of out, so check each character fits. */
+            unsigned char buf[4];
+            int len;
+            if (ch >= 0xDC80 && ch <= 0xDCFF) {
+                buf[0] = ch & 0xFF;
+                len = 1;
+            } else {
+                len = SN_encode_utf8(ch, buf);
+            }
+            if (len <= out_size - j) memcpy(out + j, buf, len);
+            j += len;
+        } else if (ch < 0x80) {
+            out[j++] = ch;
+        } else if (ch < 0x800) {
+            out[j++] = 0xC0 | ch >> 6;
+            out[j++] = 0x80 | (ch & 0x3F);
+        } else if (ch >= 0xDC80 && ch <= 0xDCFF) {
+            out[j++] = ch & 0xFF;
+        } else if (ch < 0x10000) {
+            out[j++] = 0xE0 | ch >> 12;
+            out[j++] = 0x80 | (ch >> 6 & 0x3F);
+            out[j++] = 0x80 | (ch & 0x3F);
+        } else {
+            j += SN_encode_utf8(ch, out + j);
+        }
+    }
+    return j;
+}
+#endif
+
 #if 0
 extern void debug(struct SN_env * z, int number, int line_count) {
     int i;
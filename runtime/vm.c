@@ -0,0 +1,809 @@
+#include <limits.h>
+#include <string.h>
+
+#include "header.h"
+#include "bytecode.h"
+
+/* The interpreter for bytecode written by "snowball -bytecode" (see
+ * bytecode.h), so a stemmer can be loaded at runtime instead of being
+ * compiled in.
+ *
+ * SN_load_program() checks everything in the file before it's used: each
+ * index is in range, each jump is to the start of an instruction in the same
+ * routine, the arithmetic stack is empty wherever a jump goes and can't
+ * overflow, and no routine runs off its end.  So a corrupt file is rejected
+ * rather than making the interpreter read outside the program.  As with a
+ * compiled stemmer, the program itself is trusted to keep the cursor and
+ * limits within the string.
+ *
+ * The instructions do what the C generator's code does, using the same
+ * runtime functions, so a program gives the same stems as the C code
+ * generated from the same source.  With GCC and compatible compilers each
+ * instruction jumps straight to the next one's code through a table of
+ * label addresses, rather than going back round a switch.
+ */
+
+struct SN_routine {
+    int start;
+    int size;
+    int locals;
+    int envs;
+};
+
+struct SN_literal {
+    int size;
+    symbol * s;
+};
+
+struct SN_grouping {
+    int min;
+    int max;
+    int use_scan;                   /* forward goto and gopast can scan */
+    unsigned char * map;            /* bit ch - min set for each ch */
+    unsigned char class_table[256]; /* see in_class() */
+    unsigned char scan[32];         /* see in_class_scan() */
+};
+
+struct SN_among {
+    struct among_table table;
+    struct among * v;
+    symbol * pool;
+    /* If any string has a routine, each string's routine (or -1) and
+     * result, with the result in v set to the string's index + 1 so the
+     * lookup finds the longest string which matches. */
+    int * routine;
+    int * result;
+};
+
+struct SN_program {
+    int encoding;
+    int S_size;
+    int I_size;
+    int stem;                       /* the routine "stem" runs */
+    int routine_count;
+    struct SN_routine * routines;
+    int literal_count;
+    struct SN_literal * literals;
+    int grouping_count;
+    struct SN_grouping * groupings;
+    int among_count;
+    struct SN_among * amongs;
+    int code_size;
+    int * code;
+};
+
+#define OP_OPERANDS(NAME, OPERANDS, POPS, PUSHES) OPERANDS,
+static const char * const op_operands[] = {
+    SN_BYTECODE_OPS(OP_OPERANDS)
+};
+#undef OP_OPERANDS
+
+#define OP_POPS(NAME, OPERANDS, POPS, PUSHES) POPS,
+static const signed char op_pops[] = {
+    SN_BYTECODE_OPS(OP_POPS)
+};
+#undef OP_POPS
+
+#define OP_PUSHES(NAME, OPERANDS, POPS, PUSHES) PUSHES,
+static const signed char op_pushes[] = {
+    SN_BYTECODE_OPS(OP_PUSHES)
+};
+#undef OP_PUSHES
+
+/* Loading. */
+
+struct reader {
+    const unsigned char * p;
+    size_t left;
+    int error;
+};
+
+static const unsigned char * get_bytes(struct reader * r, size_t n) {
+    const unsigned char * p = r->p;
+    if (r->error || n > r->left) {
+        r->error = 1;
+        return NULL;
+    }
+    r->p += n;
+    r->left -= n;
+    return p;
+}
+
+static unsigned int get_u32(struct reader * r) {
+    const unsigned char * p = get_bytes(r, 4);
+    if (p == NULL) return 0;
+    return p[0] | p[1] << 8 | p[2] << 16 | (unsigned int) p[3] << 24;
+}
+
+/* A count or index, which must be from 0 to max. */
+static int get_count(struct reader * r, int max) {
+    unsigned int n = get_u32(r);
+    if (n > (unsigned int) max) {
+        r->error = 1;
+        return 0;
+    }
+    return (int) n;
+}
+
+static int get_short(struct reader * r) {
+    const unsigned char * p = get_bytes(r, 2);
+    if (p == NULL) return 0;
+    return (short) (p[0] | p[1] << 8);
+}
+
+static void get_symbols(struct reader * r, int encoding, symbol * s, int n) {
+    int width = encoding == SN_BYTECODE_WIDECHARS ? 2 : 1;
+    const unsigned char * p = get_bytes(r, (size_t) n * width);
+    int i;
+    if (p == NULL) return;
+    for (i = 0; i < n; i++) {
+        s[i] = width == 2 ? p[2 * i] | p[2 * i + 1] << 8 : p[i];
+    }
+}
+
+/* Allocate n zeroed items of the given size, allowing n to be 0. */
+static void * alloc_array(struct reader * r, int n, size_t size) {
+    void * p;
+    if (r->error) return NULL;
+    p = SN_malloc(n ? (size_t) n * size : 1);
+    if (p == NULL) {
+        r->error = 1;
+        return NULL;
+    }
+    memset(p, 0, n ? (size_t) n * size : 1);
+    return p;
+}
+
+static void load_grouping(struct reader * r, int encoding, struct SN_grouping * g) {
+    const unsigned char * map;
+    int size, ch;
+    g->min = get_count(r, 0x10FFFF);
+    g->max = get_count(r, 0x10FFFF);
+    if (g->max < g->min) r->error = 1;
+    if (encoding == SN_BYTECODE_SINGLEBYTE && g->max > 0xFF) r->error = 1;
+    size = (g->max - g->min + 8) / 8;
+    map = get_bytes(r, size);
+    g->map = (unsigned char *) alloc_array(r, size, 1);
+    if (r->error) return;
+    memcpy(g->map, map, size);
+
+    /* The tables the C generator writes (see generate_grouping_table()). */
+    for (ch = g->min; ch <= g->max; ch++) {
+        int n = ch - g->min;
+        if (!(map[n >> 3] & 1 << (n & 7))) continue;
+        if (ch < 0x100) g->class_table[ch] = 1;
+        if (encoding == SN_BYTECODE_UTF8 && ch < 0x800) g->class_table[0xC0 | ch >> 6] = 1;
+        if (ch < 0x100 && !(encoding == SN_BYTECODE_UTF8 && ch >= 0x80)) {
+            g->scan[(ch & 0x80) >> 3 | (ch & 0xF)] |= 1 << (ch >> 4 & 7);
+        }
+    }
+    if (encoding == SN_BYTECODE_UTF8) {
+        for (ch = 0xE0; ch < 0x100; ch++) g->class_table[ch] = 1;
+    }
+    g->use_scan = encoding == SN_BYTECODE_SINGLEBYTE ||
+                  (encoding == SN_BYTECODE_UTF8 && g->min < 0x80);
+}
+
+static void load_among(struct reader * r, int encoding, int routine_count, struct SN_among * a) {
+    int n = get_count(r, 0x7FFF);
+    int pool_size = get_count(r, 0xFFFF);
+    int i;
+    if (n == 0) r->error = 1;
+    a->pool = (symbol *) alloc_array(r, pool_size, sizeof(symbol));
+    get_symbols(r, encoding, a->pool, pool_size);
+    a->v = (struct among *) alloc_array(r, n, sizeof(struct among));
+    a->routine = (int *) alloc_array(r, n, sizeof(int));
+    a->result = (int *) alloc_array(r, n, sizeof(int));
+    if (r->error) return;
+    for (i = 0; i < n; i++) {
+        struct among * w = &a->v[i];
+        int s_offset = (unsigned short) get_short(r);
+        int s_size = (unsigned short) get_short(r);
+        w->s_offset = s_offset;
+        w->s_size = s_size;
+        w->substring_i = get_short(r);
+        w->result = get_short(r);
+        a->routine[i] = get_short(r);
+        if (s_offset + s_size > pool_size ||
+            w->substring_i < -1 || w->substring_i >= i ||
+            a->routine[i] < -1 || a->routine[i] >= routine_count) {
+            r->error = 1;
+            return;
+        }
+    }
+    for (i = 0; i < n; i++) {
+        if (a->routine[i] >= 0) break;
+    }
+    if (i == n) {
+        SN_free(a->routine);
+        SN_free(a->result);
+        a->routine = a->result = NULL;
+    } else {
+        for (i = 0; i < n; i++) {
+            a->result[i] = a->v[i].result;
+            a->v[i].result = i + 1;
+        }
+    }
+    a->table.v = a->v;
+    a->table.v_size = n;
+    a->table.pool = a->pool;
+    a->table.functions = NULL;
+}
+
+/* Flags for each word of code in verify_routine(). */
+#define INSTRUCTION 1   /* an instruction starts here */
+#define TARGET 2        /* which is jumped to */
+#define EMPTY 4         /* and the stack is empty before it */
+
+static int check_target(const struct SN_routine * r, unsigned char * flags, int x) {
+    if (x < r->start || x >= r->start + r->size || !(flags[x] & INSTRUCTION)) return -1;
+    flags[x] |= TARGET;
+    return 0;
+}
+
+/* Check the code of routine r, returning 0 if it's valid.  flags has an
+ * entry for each word of code, all zero. */
+static int verify_routine(const struct SN_program * prog, const struct SN_routine * r,
+                          unsigned char * flags) {
+    const int * code = prog->code;
+    int end = r->start + r->size;
+    int depth = 0;
+    int pc, next, op = SN_OP_COUNT;
+
+    for (pc = r->start; pc < end; pc = next) {
+        op = code[pc];
+        if (op < 0 || op >= SN_OP_COUNT) return -1;
+        flags[pc] |= INSTRUCTION;
+        next = pc + 1 + (int) strlen(op_operands[op]);
+        if (op == SN_OP_SWITCH) {
+            if (pc + 1 >= end || code[pc + 1] < 0 || code[pc + 1] > end) return -1;
+            next += code[pc + 1];
+        }
+        if (next > end) return -1;
+    }
+    /* Nothing can run off the end. */
+    switch (op) {
+        case SN_OP_GOTO: case SN_OP_RETURN0: case SN_OP_RETURN1: case SN_OP_SWITCH:
+            break;
+        default:
+            return -1;
+    }
+
+    /* The stack depth is followed through the code in order, which is
+     * right as long as it's zero at each jump and each target. */
+    for (pc = r->start; pc < end; pc = next) {
+        const char * operands;
+        int jumps = 0;
+        op = code[pc];
+        if (depth == 0) flags[pc] |= EMPTY;
+        next = pc + 1;
+        for (operands = op_operands[op]; *operands; operands++) {
+            int x = code[next++];
+            int max;
+            switch (*operands) {
+                case 'F': case 'J':
+                    if (check_target(r, flags, x) < 0) return -1;
+                    jumps = 1;
+                    continue;
+                case 'n':
+                    if ((op == SN_OP_HOPN || op == SN_OP_HOPN_B) && x < 0) return -1;
+                    continue;
+                case 'R': max = prog->routine_count; break;
+                case 'k': max = r->locals; break;
+                case 'e': max = r->envs; break;
+                case 'i': max = prog->I_size; break;
+                case 's': max = prog->S_size; break;
+                case 'l': max = prog->literal_count; break;
+                case 'g': max = prog->grouping_count; break;
+                case 'a': max = prog->among_count; break;
+                default: return -1;
+            }
+            if (x < 0 || x >= max) return -1;
+        }
+        if (op == SN_OP_SWITCH) {
+            int n = code[pc + 1];
+            for (; n > 0; n--) {
+                if (check_target(r, flags, code[next++]) < 0) return -1;
+            }
+        }
+        depth -= op_pops[op];
+        if (depth < 0) return -1;
+        depth += op_pushes[op];
+        if (depth > SN_BYTECODE_MAX_STACK) return -1;
+        if (jumps && depth != 0) return -1;
+    }
+    for (pc = r->start; pc < end; pc++) {
+        if ((flags[pc] & TARGET) && !(flags[pc] & EMPTY)) return -1;
+    }
+    return 0;
+}
+
+extern struct SN_program * SN_load_program(const void * data, size_t size) {
+    struct reader reader;
+    struct reader * r = &reader;
+    struct SN_program * prog;
+    int external_count;
+    int i;
+
+    r->p = (const unsigned char *) data;
+    r->left = size;
+    r->error = 0;
+    {
+        const unsigned char * magic = get_bytes(r, 4);
+        if (magic == NULL || memcmp(magic, SN_BYTECODE_MAGIC, 4) != 0) return NULL;
+    }
+    if (get_u32(r) != SN_BYTECODE_VERSION) return NULL;
+
+    prog = (struct SN_program *) alloc_array(r, 1, sizeof(struct SN_program));
+    if (prog == NULL) return NULL;
+    prog->stem = -1;
+    prog->encoding = get_count(r, SN_BYTECODE_WIDECHARS);
+#ifdef SNOWBALL_UTF32
+    if (prog->encoding != SN_BYTECODE_WIDECHARS) r->error = 1;
+#else
+    if (prog->encoding == SN_BYTECODE_WIDECHARS) r->error = 1;
+#endif
+    prog->S_size = get_count(r, 0xFFFF);
+    prog->I_size = get_count(r, 0xFFFF);
+    prog->routine_count = get_count(r, 0xFFFF);
+    external_count = get_count(r, prog->routine_count);
+    prog->literal_count = get_count(r, 0xFFFFF);
+    prog->grouping_count = get_count(r, 0xFFFF);
+    prog->among_count = get_count(r, 0xFFFF);
+    prog->code_size = get_count(r, INT_MAX / 2);
+    /* Each takes at least a byte of the file. */
+    if (prog->code_size > (int) (size / 4) ||
+        prog->literal_count + prog->grouping_count + prog->among_count > (int) size) {
+        r->error = 1;
+    }
+
+    prog->literals = (struct SN_literal *) alloc_array(r, prog->literal_count, sizeof(struct SN_literal));
+    for (i = 0; i < prog->literal_count && !r->error; i++) {
+        struct SN_literal * l = &prog->literals[i];
+        l->size = get_count(r, (int) r->left);
+        l->s = (symbol *) alloc_array(r, l->size, sizeof(symbol));
+        get_symbols(r, prog->encoding, l->s, l->size);
+    }
+
+    prog->groupings = (struct SN_grouping *) alloc_array(r, prog->grouping_count, sizeof(struct SN_grouping));
+    for (i = 0; i < prog->grouping_count && !r->error; i++) {
+        load_grouping(r, prog->encoding, &prog->groupings[i]);
+    }
+
+    prog->amongs = (struct SN_among *) alloc_array(r, prog->among_count, sizeof(struct SN_among));
+    for (i = 0; i < prog->among_count && !r->error; i++) {
+        load_among(r, prog->encoding, prog->routine_count, &prog->amongs[i]);
+    }
+
+    prog->routines = (struct SN_routine *) alloc_array(r, prog->routine_count, sizeof(struct SN_routine));
+    for (i = 0; i < prog->routine_count && !r->error; i++) {
+        struct SN_routine * routine = &prog->routines[i];
+        routine->start = get_count(r, prog->code_size);
+        routine->size = get_count(r, prog->code_size - routine->start);
+        routine->locals = get_count(r, SN_BYTECODE_MAX_LOCALS);
+        routine->envs = get_count(r, SN_BYTECODE_MAX_ENVS);
+    }
+
+    for (i = 0; i < external_count && !r->error; i++) {
+        int name_size = get_count(r, 0xFFFF);
+        const unsigned char * name = get_bytes(r, name_size);
+        int routine = get_count(r, prog->routine_count - 1);
+        if (name != NULL && name_size == 4 && memcmp(name, "stem", 4) == 0) {
+            prog->stem = routine;
+        }
+    }
+    if (prog->stem < 0) r->error = 1;
+
+    prog->code = (int *) alloc_array(r, prog->code_size, sizeof(int));
+    for (i = 0; i < prog->code_size && !r->error; i++) {
+        prog->code[i] = (int) get_u32(r);
+    }
+    if (r->left != 0) r->error = 1;
+
+    if (!r->error) {
+        unsigned char * flags = (unsigned char *) alloc_array(r, prog->code_size, 1);
+        for (i = 0; i < prog->routine_count && !r->error; i++) {
+            memset(flags, 0, prog->code_size);
+            if (verify_routine(prog, &prog->routines[i], flags) < 0) r->error = 1;
+        }
+        SN_free(flags);
+    }
+
+    if (r->error) {
+        SN_free_program(prog);
+        return NULL;
+    }
+    return prog;
+}
+
+extern void SN_free_program(struct SN_program * prog) {
+    int i;
+    if (prog == NULL) return;
+    if (prog->literals) {
+        for (i = 0; i < prog->literal_count; i++) SN_free(prog->literals[i].s);
+        SN_free(prog->literals);
+    }
+    if (prog->groupings) {
+        for (i = 0; i < prog->grouping_count; i++) SN_free(prog->groupings[i].map);
+        SN_free(prog->groupings);
+    }
+    if (prog->amongs) {
+        for (i = 0; i < prog->among_count; i++) {
+            struct SN_among * a = &prog->amongs[i];
+            SN_free(a->pool);
+            SN_free(a->v);
+            SN_free(a->routine);
+            SN_free(a->result);
+        }
+        SN_free(prog->amongs);
+    }
+    SN_free(prog->routines);
+    SN_free(prog->code);
+    SN_free(prog);
+}
+
+extern int SN_program_encoding(const struct SN_program * prog) {
+    return prog->encoding;
+}
+
+extern struct SN_env * SN_program_create_env(const struct SN_program * prog) {
+    return SN_create_env(prog->S_size, prog->I_size);
+}
+
+extern void SN_program_close_env(const struct SN_program * prog, struct SN_env * z) {
+    SN_close_env(z, prog->S_size);
+}
+
+/* Running. */
+
+static int run(const struct SN_program * prog, struct SN_env * z, int r);
+
+/* The runtime function the C generator would call to test z against
+ * grouping g: in_class() for characters in it, or out_class() if out is
+ * set, and so on. */
+static int test_grouping(const struct SN_program * prog, struct SN_env * z,
+                         const struct SN_grouping * g, int out, int backward, int repeat) {
+    switch (prog->encoding) {
+        case SN_BYTECODE_SINGLEBYTE:
+            if (repeat && !backward) {
+                return out ? out_class_scan(z, g->class_table, g->scan) :
+                             in_class_scan(z, g->class_table, g->scan);
+            }
+            if (backward) {
+                return out ? out_class_b(z, g->class_table, repeat) :
+                             in_class_b(z, g->class_table, repeat);
+            }
+            return out ? out_class(z, g->class_table, repeat) :
+                         in_class(z, g->class_table, repeat);
+        case SN_BYTECODE_UTF8:
+            if (repeat && !backward && g->use_scan) {
+                return out ? out_class_scan_U(z, g->class_table, g->scan, g->map, g->min, g->max) :
+                             in_class_scan_U(z, g->class_table, g->scan, g->map, g->min, g->max);
+            }
+            if (backward) {
+                return out ? out_class_b_U(z, g->class_table, g->map, g->min, g->max, repeat) :
+                             in_class_b_U(z, g->class_table, g->map, g->min, g->max, repeat);
+            }
+            return out ? out_class_U(z, g->class_table, g->map, g->min, g->max, repeat) :
+                         in_class_U(z, g->class_table, g->map, g->min, g->max, repeat);
+        default:
+            if (backward) {
+                return out ? out_grouping_b(z, g->map, g->min, g->max, repeat) :
+                             in_grouping_b(z, g->map, g->min, g->max, repeat);
+            }
+            return out ? out_grouping(z, g->map, g->min, g->max, repeat) :
+                         in_grouping(z, g->map, g->min, g->max, repeat);
+    }
+}
+
+/* find_among() or find_among_b() for among a, calling the routines of its
+ * strings as find_among() calls the functions of a compiled among. */
+static int run_among(const struct SN_program * prog, struct SN_env * z,
+                 const struct SN_among * a, int backward) {
+    int c = z->c;
+    int i = backward ? find_among_b(z, &a->table) : find_among(z, &a->table);
+    if (a->routine == NULL || i == 0) return i;
+    i--;
+    while (1) {
+        int size = a->v[i].s_size;
+        z->c = backward ? c - size : c + size;
+        if (a->routine[i] < 0) return a->result[i];
+        {
+            int res = run(prog, z, a->routine[i]);
+            z->c = backward ? c - size : c + size;
+            if (res) return a->result[i];
+        }
+        i = a->v[i].substring_i;
+        if (i < 0) return 0;
+    }
+}
+
+/* Threaded dispatch needs GCC's labels as values, which aren't in ISO C, so
+ * isn't used when compiling with -std=c90 and the like. */
+#if defined __GNUC__ && !defined __STRICT_ANSI__
+# define THREADED_DISPATCH
+#endif
+
+#ifdef THREADED_DISPATCH
+# define DISPATCH goto *labels[*pc++]
+# define CASE(NAME) L_##NAME:
+#else
+# define DISPATCH continue
+# define CASE(NAME) case SN_OP_##NAME:
+#endif
+
+/* Go to the F or J operand, which is the first. */
+#define JUMP { pc = code + pc[0]; DISPATCH; }
+/* Fail unless COND, otherwise go on past N operands. */
+#define TEST(COND, N) { if (!(COND)) JUMP; pc += (N); DISPATCH; }
+#define LOCAL (local[pc[0]])
+#define VAR_I (z->I[pc[0]])
+#define VAR_S (z->S[pc[0]])
+#define LITERAL (&prog->literals[pc[0]])
+#define GROUPING_ARG (&prog->groupings[pc[1]])
+#define CHECK(RET) { int ret_ = (RET); if (ret_ < 0) return ret_; }
+
+static int run(const struct SN_program * prog, struct SN_env * z, int r) {
+    const int * code = prog->code;
+    const int * pc = code + prog->routines[r].start;
+    int local[SN_BYTECODE_MAX_LOCALS];
+    int stack[SN_BYTECODE_MAX_STACK];
+    int * sp = stack;
+    struct SN_env env[SN_BYTECODE_MAX_ENVS];
+    int among_var = 0;
+    int a, b;
+
+#ifdef THREADED_DISPATCH
+# define LABEL(NAME, OPERANDS, POPS, PUSHES) &&L_##NAME,
+    static const void * const labels[] = { SN_BYTECODE_OPS(LABEL) };
+# undef LABEL
+    DISPATCH;
+#else
+    for (;;) switch (*pc++) {
+#endif
+
+    /* Control. */
+    CASE(GOTO) JUMP
+    CASE(RETURN0) return 0;
+    CASE(RETURN1) return 1;
+    CASE(CALL) {
+        int ret = run(prog, z, pc[1]);
+        if (ret < 0) return ret;
+        TEST(ret, 2)
+    }
+    CASE(CALL_DO) CHECK(run(prog, z, pc[0])) pc++; DISPATCH;
+    CASE(SWITCH)
+        if (among_var >= 1 && among_var <= pc[0]) {
+            pc = code + pc[1 + among_var];
+        } else {
+            pc = code + pc[1];
+        }
+        DISPATCH;
+    CASE(LOOP)
+        if (local[pc[0]] <= 0) { pc = code + pc[1]; DISPATCH; }
+        local[pc[0]]--;
+        pc += 2; DISPATCH;
+
+    /* Saving and restoring the cursor and limits. */
+    CASE(KEEP) LOCAL = z->c; pc++; DISPATCH;
+    CASE(KEEP_B) LOCAL = z->l - z->c; pc++; DISPATCH;
+    CASE(RESTORE) z->c = LOCAL; pc++; DISPATCH;
+    CASE(RESTORE_B) z->c = z->l - LOCAL; pc++; DISPATCH;
+    CASE(SETLIMIT) LOCAL = z->l - z->c; z->l = z->c; pc++; DISPATCH;
+    CASE(SETLIMIT_B) LOCAL = z->lb; z->lb = z->c; pc++; DISPATCH;
+    CASE(SETLIMIT_TO) LOCAL = z->l - z->c; z->l = *--sp; pc++; DISPATCH;
+    CASE(SETLIMIT_TO_B) LOCAL = z->lb; z->lb = *--sp; pc++; DISPATCH;
+    CASE(RESTORE_LIMIT) z->l += LOCAL; pc++; DISPATCH;
+    CASE(RESTORE_LIMIT_B) z->lb = LOCAL; pc++; DISPATCH;
+    CASE(BACKWARDS) z->lb = z->c; z->c = z->l; DISPATCH;
+    CASE(END_BACKWARDS) z->c = z->lb; DISPATCH;
+    CASE(DOLLAR)
+        env[pc[1]] = *z;
+        z->p = VAR_S;
+        z->lb = z->c = 0;
+        z->l = SIZE(z->p);
+        pc += 2; DISPATCH;
+    CASE(END_DOLLAR)
+        VAR_S = z->p;
+        *z = env[pc[1]];
+        pc += 2; DISPATCH;
+
+    /* Arithmetic. */
+    CASE(PUSH) *sp++ = pc[0]; pc++; DISPATCH;
+    CASE(PUSH_VAR) *sp++ = VAR_I; pc++; DISPATCH;
+    CASE(PUSH_LOCAL) *sp++ = LOCAL; pc++; DISPATCH;
+    CASE(PUSH_C) *sp++ = z->c; DISPATCH;
+    CASE(PUSH_L) *sp++ = z->l; DISPATCH;
+    CASE(PUSH_LB) *sp++ = z->lb; DISPATCH;
+    CASE(PUSH_SIZE) *sp++ = SIZE(z->p); DISPATCH;
+    CASE(PUSH_LEN) *sp++ = lenof_utf8(z, z->p); DISPATCH;
+    CASE(PUSH_SIZEOF) *sp++ = SIZE(VAR_S); pc++; DISPATCH;
+    CASE(PUSH_LENOF) *sp++ = lenof_utf8(z, VAR_S); pc++; DISPATCH;
+    CASE(NEG) sp[-1] = -sp[-1]; DISPATCH;
+    CASE(ADD) sp--; sp[-1] += sp[0]; DISPATCH;
+    CASE(SUB) sp--; sp[-1] -= sp[0]; DISPATCH;
+    CASE(MUL) sp--; sp[-1] *= sp[0]; DISPATCH;
+    CASE(DIV)
+        /* Dividing by zero is an error rather than a crash. */
+        sp--;
+        if (sp[0] == 0 || (sp[0] == -1 && sp[-1] == INT_MIN)) return -1;
+        sp[-1] /= sp[0];
+        DISPATCH;
+    CASE(POP_LOCAL) LOCAL = *--sp; pc++; DISPATCH;
+    CASE(DEC_LOCAL) LOCAL--; pc++; DISPATCH;
+    CASE(SET_VAR) VAR_I = *--sp; pc++; DISPATCH;
+    CASE(ADD_VAR) VAR_I += *--sp; pc++; DISPATCH;
+    CASE(SUB_VAR) VAR_I -= *--sp; pc++; DISPATCH;
+    CASE(MUL_VAR) VAR_I *= *--sp; pc++; DISPATCH;
+    CASE(DIV_VAR)
+        b = *--sp;
+        if (b == 0 || (b == -1 && VAR_I == INT_MIN)) return -1;
+        VAR_I /= b;
+        pc++; DISPATCH;
+    CASE(SETMARK) VAR_I = z->c; pc++; DISPATCH;
+    CASE(TEST_EQ) sp -= 2; TEST(sp[0] == sp[1], 1)
+    CASE(TEST_NE) sp -= 2; TEST(sp[0] != sp[1], 1)
+    CASE(TEST_GT) sp -= 2; TEST(sp[0] > sp[1], 1)
+    CASE(TEST_GE) sp -= 2; TEST(sp[0] >= sp[1], 1)
+    CASE(TEST_LT) sp -= 2; TEST(sp[0] < sp[1], 1)
+    CASE(TEST_LE) sp -= 2; TEST(sp[0] <= sp[1], 1)
+
+    /* Moving the cursor. */
+    CASE(TOMARK)
+        a = *--sp;
+        if (z->c > a) JUMP
+        z->c = a;
+        pc++; DISPATCH;
+    CASE(TOMARK_B)
+        a = *--sp;
+        if (z->c < a) JUMP
+        z->c = a;
+        pc++; DISPATCH;
+    CASE(ATMARK) a = *--sp; TEST(z->c == a, 1)
+    CASE(HOP)
+        a = z->c + *--sp;
+        if (a > z->l || a < z->c) JUMP
+        z->c = a;
+        pc++; DISPATCH;
+    CASE(HOP_B)
+        a = z->c - *--sp;
+        if (a < z->lb || a > z->c) JUMP
+        z->c = a;
+        pc++; DISPATCH;
+    CASE(HOP_U)
+        a = hop_utf8(z, z->c, z->l, *--sp);
+        if (a < 0) JUMP
+        z->c = a;
+        pc++; DISPATCH;
+    CASE(HOP_B_U)
+        a = hop_b_utf8(z, z->c, z->lb, *--sp);
+        if (a < 0) JUMP
+        z->c = a;
+        pc++; DISPATCH;
+    CASE(HOPN) z->c += pc[1]; TEST(z->c <= z->l, 2)
+    CASE(HOPN_B) z->c -= pc[1]; TEST(z->c >= z->lb, 2)
+    CASE(NEXT)
+        if (z->c >= z->l) JUMP
+        z->c++;
+        pc++; DISPATCH;
+    CASE(NEXT_B)
+        if (z->c <= z->lb) JUMP
+        z->c--;
+        pc++; DISPATCH;
+    CASE(NEXT_U)
+        a = skip_utf8(z->p, z->c, z->l, 1);
+        if (a < 0) JUMP
+        z->c = a;
+        pc++; DISPATCH;
+    CASE(NEXT_B_U)
+        a = skip_b_utf8(z->p, z->c, z->lb, 1);
+        if (a < 0) JUMP
+        z->c = a;
+        pc++; DISPATCH;
+    CASE(TOLIMIT) z->c = z->l; DISPATCH;
+    CASE(TOLIMIT_B) z->c = z->lb; DISPATCH;
+    CASE(ATLIMIT) TEST(z->c >= z->l, 1)
+    CASE(ATLIMIT_B) TEST(z->c <= z->lb, 1)
+    CASE(BRA) z->bra = z->c; DISPATCH;
+    CASE(KET) z->ket = z->c; DISPATCH;
+
+    /* Booleans. */
+    CASE(SET) VAR_I = 1; pc++; DISPATCH;
+    CASE(UNSET) VAR_I = 0; pc++; DISPATCH;
+    CASE(BOOLTEST) TEST(z->I[pc[1]], 2)
+
+    /* Tests. */
+    CASE(CHAR)
+        if (z->c == z->l || z->p[z->c] != (symbol) pc[1]) JUMP
+        z->c++;
+        pc += 2; DISPATCH;
+    CASE(CHAR_B)
+        if (z->c <= z->lb || z->p[z->c - 1] != (symbol) pc[1]) JUMP
+        z->c--;
+        pc += 2; DISPATCH;
+    CASE(EQ_S) TEST(eq_s(z, prog->literals[pc[1]].size, prog->literals[pc[1]].s), 2)
+    CASE(EQ_S_B) TEST(eq_s_b(z, prog->literals[pc[1]].size, prog->literals[pc[1]].s), 2)
+    CASE(EQ_V) TEST(eq_v(z, z->S[pc[1]]), 2)
+    CASE(EQ_V_B) TEST(eq_v_b(z, z->S[pc[1]]), 2)
+    CASE(GROUPING) TEST(!test_grouping(prog, z, GROUPING_ARG, 0, 0, 0), 2)
+    CASE(GROUPING_B) TEST(!test_grouping(prog, z, GROUPING_ARG, 0, 1, 0), 2)
+    CASE(NON) TEST(!test_grouping(prog, z, GROUPING_ARG, 1, 0, 0), 2)
+    CASE(NON_B) TEST(!test_grouping(prog, z, GROUPING_ARG, 1, 1, 0), 2)
+    CASE(GOTO_GROUPING) TEST(test_grouping(prog, z, GROUPING_ARG, 1, 0, 1) >= 0, 2)
+    CASE(GOTO_GROUPING_B) TEST(test_grouping(prog, z, GROUPING_ARG, 1, 1, 1) >= 0, 2)
+    CASE(GOTO_NON) TEST(test_grouping(prog, z, GROUPING_ARG, 0, 0, 1) >= 0, 2)
+    CASE(GOTO_NON_B) TEST(test_grouping(prog, z, GROUPING_ARG, 0, 1, 1) >= 0, 2)
+    CASE(GOPAST_GROUPING)
+        a = test_grouping(prog, z, GROUPING_ARG, 1, 0, 1);
+        if (a < 0) JUMP
+        z->c += a;
+        pc += 2; DISPATCH;
+    CASE(GOPAST_GROUPING_B)
+        a = test_grouping(prog, z, GROUPING_ARG, 1, 1, 1);
+        if (a < 0) JUMP
+        z->c -= a;
+        pc += 2; DISPATCH;
+    CASE(GOPAST_NON)
+        a = test_grouping(prog, z, GROUPING_ARG, 0, 0, 1);
+        if (a < 0) JUMP
+        z->c += a;
+        pc += 2; DISPATCH;
+    CASE(GOPAST_NON_B)
+        a = test_grouping(prog, z, GROUPING_ARG, 0, 1, 1);
+        if (a < 0) JUMP
+        z->c -= a;
+        pc += 2; DISPATCH;
+    CASE(AMONG)
+        among_var = run_among(prog, z, &prog->amongs[pc[1]], 0);
+        TEST(among_var, 2)
+    CASE(AMONG_B)
+        among_var = run_among(prog, z, &prog->amongs[pc[1]], 1);
+        TEST(among_var, 2)
+
+    /* Changing the string. */
+    CASE(DELETE) CHECK(slice_del(z)) DISPATCH;
+    CASE(SLICE_FROM_S) CHECK(slice_from_s(z, LITERAL->size, LITERAL->s)) pc++; DISPATCH;
+    CASE(SLICE_FROM_V) CHECK(slice_from_v(z, VAR_S)) pc++; DISPATCH;
+    CASE(INSERT_S) CHECK(insert_s(z, z->c, z->c, LITERAL->size, LITERAL->s)) pc++; DISPATCH;
+    CASE(INSERT_V) CHECK(insert_v(z, z->c, z->c, VAR_S)) pc++; DISPATCH;
+    CASE(ATTACH_S)
+        a = z->c;
+        b = insert_s(z, z->c, z->c, LITERAL->size, LITERAL->s);
+        z->c = a;
+        CHECK(b) pc++; DISPATCH;
+    CASE(ATTACH_V)
+        a = z->c;
+        b = insert_v(z, z->c, z->c, VAR_S);
+        z->c = a;
+        CHECK(b) pc++; DISPATCH;
+    CASE(ASSIGN_S)
+        a = z->c;
+        b = insert_s(z, z->c, z->l, LITERAL->size, LITERAL->s);
+        z->c = a;
+        CHECK(b) pc++; DISPATCH;
+    CASE(ASSIGN_V)
+        a = z->c;
+        b = insert_v(z, z->c, z->l, VAR_S);
+        z->c = a;
+        CHECK(b) pc++; DISPATCH;
+    CASE(ASSIGN_S_B) CHECK(insert_s(z, z->lb, z->c, LITERAL->size, LITERAL->s)) pc++; DISPATCH;
+    CASE(ASSIGN_V_B) CHECK(insert_v(z, z->lb, z->c, VAR_S)) pc++; DISPATCH;
+    CASE(ASSIGNTO)
+        VAR_S = assign_to(z, VAR_S);
+        if (VAR_S == 0) return -1;
+        pc++; DISPATCH;
+    CASE(SLICETO)
+        VAR_S = slice_to(z, VAR_S);
+        if (VAR_S == 0) return -1;
+        pc++; DISPATCH;
+
+#ifndef THREADED_DISPATCH
+    default:
+        return -1;
+    }
+#endif
+}
+
+extern int SN_run_program(const struct SN_program * prog, struct SN_env * z) {
+    return run(prog, z, prog->stem);
+}
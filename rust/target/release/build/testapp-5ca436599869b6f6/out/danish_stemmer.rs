@@ -0,0 +1,264 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+#![allow(non_snake_case)]
+#![allow(non_upper_case_globals)]
+#![allow(unused_mut)]
+#![allow(unused_parens)]
+#![allow(unused_variables)]
+use snowball::SnowballEnv;
+use snowball::Among;
+
+static A_0: &'static [Among<Context>; 32] = &[
+    Among("hed", -1, 1, None),
+    Among("ethed", 0, 1, None),
+    Among("ered", -1, 1, None),
+    Among("e", -1, 1, None),
+    Among("erede", 3, 1, None),
+    Among("ende", 3, 1, None),
+    Among("erende", 5, 1, None),
+    Among("ene", 3, 1, None),
+    Among("erne", 3, 1, None),
+    Among("ere", 3, 1, None),
+    Among("en", -1, 1, None),
+    Among("heden", 10, 1, None),
+    Among("eren", 10, 1, None),
+    Among("er", -1, 1, None),
+    Among("heder", 13, 1, None),
+    Among("erer", 13, 1, None),
+    Among("s", -1, 2, None),
+    Among("heds", 16, 1, None),
+    Among("es", 16, 1, None),
+    Among("endes", 18, 1, None),
+    Among("erendes", 19, 1, None),
+    Among("enes", 18, 1, None),
+    Among("ernes", 18, 1, None),
+    Among("eres", 18, 1, None),
+    Among("ens", 16, 1, None),
+    Among("hedens", 24, 1, None),
+    Among("erens", 24, 1, None),
+    Among("ers", 16, 1, None),
+    Among("ets", 16, 1, None),
+    Among("erets", 28, 1, None),
+    Among("et", -1, 1, None),
+    Among("eret", 30, 1, None),
+];
+
+static A_1: &'static [Among<Context>; 4] = &[
+    Among("gd", -1, -1, None),
+    Among("dt", -1, -1, None),
+    Among("gt", -1, -1, None),
+    Among("kt", -1, -1, None),
+];
+
+static A_2: &'static [Among<Context>; 5] = &[
+    Among("ig", -1, 1, None),
+    Among("lig", 0, 1, None),
+    Among("elig", 1, 1, None),
+    Among("els", -1, 1, None),
+    Among("l\u{00F8}st", -1, 2, None),
+];
+
+static G_c: &'static [u8; 4] = &[119, 223, 119, 1];
+
+static G_v: &'static [u8; 19] = &[17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 128];
+
+static G_s_ending: &'static [u8; 17] = &[239, 254, 42, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16];
+
+#[derive(Clone)]
+struct Context {
+    i_x: i32,
+    i_p1: i32,
+    S_ch: String,
+}
+
+fn r_consonant_pair(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    let v_1 = env.limit - env.cursor;
+    if env.cursor < context.i_p1 {
+        return false;
+    }
+    let v_3 = env.limit_backward;
+    env.limit_backward = context.i_p1;
+    env.ket = env.cursor;
+    if env.find_among_b(A_1, context) == 0 {
+        env.limit_backward = v_3;
+        return false;
+    }
+    env.bra = env.cursor;
+    env.limit_backward = v_3;
+    env.cursor = env.limit - v_1;
+    if env.cursor <= env.limit_backward {
+        return false;
+    }
+    env.previous_char();
+    env.bra = env.cursor;
+    if !env.slice_del() {
+        return false;
+    }
+    return true;
+}
+
+pub fn stem(env: &mut SnowballEnv) -> bool {
+    let mut context = &mut Context {
+        i_x: 0,
+        i_p1: 0,
+        S_ch: String::new(),
+    };
+    let mut among_var;
+    let v_1 = env.cursor;
+    'lab0: loop {
+        context.i_p1 = env.limit;
+        let v_2 = env.cursor;
+        if !env.hop(3) {
+            break 'lab0;
+        }
+        context.i_x = env.cursor;
+        env.cursor = v_2;
+        'golab1: loop {
+            let v_3 = env.cursor;
+            'lab2: loop {
+                if !env.in_grouping(G_v, 97, 248) {
+                    break 'lab2;
+                }
+                env.cursor = v_3;
+                break 'golab1;
+            }
+            env.cursor = v_3;
+            if env.cursor >= env.limit {
+                break 'lab0;
+            }
+            env.next_char();
+        }
+        'golab3: loop {
+            'lab4: loop {
+                if !env.out_grouping(G_v, 97, 248) {
+                    break 'lab4;
+                }
+                break 'golab3;
+            }
+            if env.cursor >= env.limit {
+                break 'lab0;
+            }
+            env.next_char();
+        }
+        context.i_p1 = env.cursor;
+        'lab5: loop {
+            if !(context.i_p1 < context.i_x){
+                break 'lab5;
+            }
+            context.i_p1 = context.i_x;
+            break 'lab5;
+        }
+        break 'lab0;
+    }
+    env.cursor = v_1;
+    env.limit_backward = env.cursor;
+    env.cursor = env.limit;
+    let v_6 = env.limit - env.cursor;
+    'lab6: loop {
+        if env.cursor < context.i_p1 {
+            break 'lab6;
+        }
+        let v_8 = env.limit_backward;
+        env.limit_backward = context.i_p1;
+        env.ket = env.cursor;
+        among_var = env.find_among_b(A_0, context);
+        if among_var == 0 {
+            env.limit_backward = v_8;
+            break 'lab6;
+        }
+        env.bra = env.cursor;
+        env.limit_backward = v_8;
+        if among_var == 1 {
+            if !env.slice_del() {
+                return false;
+            }
+        } else if among_var == 2 {
+            if !env.in_grouping_b(G_s_ending, 97, 229) {
+                break 'lab6;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+        }
+        break 'lab6;
+    }
+    env.cursor = env.limit - v_6;
+    let v_9 = env.limit - env.cursor;
+    r_consonant_pair(env, context);
+    env.cursor = env.limit - v_9;
+    let v_10 = env.limit - env.cursor;
+    'lab7: loop {
+        let v_11 = env.limit - env.cursor;
+        'lab8: loop {
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"st") {
+                break 'lab8;
+            }
+            env.bra = env.cursor;
+            if !env.eq_s_b(&"ig") {
+                break 'lab8;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+            break 'lab8;
+        }
+        env.cursor = env.limit - v_11;
+        if env.cursor < context.i_p1 {
+            break 'lab7;
+        }
+        let v_13 = env.limit_backward;
+        env.limit_backward = context.i_p1;
+        env.ket = env.cursor;
+        among_var = env.find_among_b(A_2, context);
+        if among_var == 0 {
+            env.limit_backward = v_13;
+            break 'lab7;
+        }
+        env.bra = env.cursor;
+        env.limit_backward = v_13;
+        if among_var == 1 {
+            if !env.slice_del() {
+                return false;
+            }
+            let v_14 = env.limit - env.cursor;
+            r_consonant_pair(env, context);
+            env.cursor = env.limit - v_14;
+        } else if among_var == 2 {
+            if !env.slice_from("l\u{00F8}s") {
+                return false;
+            }
+        }
+        break 'lab7;
+    }
+    env.cursor = env.limit - v_10;
+    let v_15 = env.limit - env.cursor;
+    'lab9: loop {
+        if env.cursor < context.i_p1 {
+            break 'lab9;
+        }
+        let v_17 = env.limit_backward;
+        env.limit_backward = context.i_p1;
+        env.ket = env.cursor;
+        if !env.in_grouping_b(G_c, 98, 122) {
+            env.limit_backward = v_17;
+            break 'lab9;
+        }
+        env.bra = env.cursor;
+        context.S_ch = env.slice_to();
+        if context.S_ch.is_empty() {
+            return false;
+        }
+        env.limit_backward = v_17;
+        if !env.eq_s_b(&context.S_ch) {
+            break 'lab9;
+        }
+        if !env.slice_del() {
+            return false;
+        }
+        break 'lab9;
+    }
+    env.cursor = env.limit - v_15;
+    env.cursor = env.limit_backward;
+    return true;
+}
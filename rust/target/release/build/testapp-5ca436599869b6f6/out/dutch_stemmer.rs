@@ -0,0 +1,547 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+#![allow(non_snake_case)]
+#![allow(non_upper_case_globals)]
+#![allow(unused_mut)]
+#![allow(unused_parens)]
+#![allow(unused_variables)]
+use snowball::SnowballEnv;
+use snowball::Among;
+
+static A_0: &'static [Among<Context>; 11] = &[
+    Among("", -1, 6, None),
+    Among("\u{00E1}", 0, 1, None),
+    Among("\u{00E4}", 0, 1, None),
+    Among("\u{00E9}", 0, 2, None),
+    Among("\u{00EB}", 0, 2, None),
+    Among("\u{00ED}", 0, 3, None),
+    Among("\u{00EF}", 0, 3, None),
+    Among("\u{00F3}", 0, 4, None),
+    Among("\u{00F6}", 0, 4, None),
+    Among("\u{00FA}", 0, 5, None),
+    Among("\u{00FC}", 0, 5, None),
+];
+
+static A_1: &'static [Among<Context>; 3] = &[
+    Among("", -1, 3, None),
+    Among("I", 0, 2, None),
+    Among("Y", 0, 1, None),
+];
+
+static A_2: &'static [Among<Context>; 3] = &[
+    Among("dd", -1, -1, None),
+    Among("kk", -1, -1, None),
+    Among("tt", -1, -1, None),
+];
+
+static A_3: &'static [Among<Context>; 5] = &[
+    Among("ene", -1, 2, None),
+    Among("se", -1, 3, None),
+    Among("en", -1, 2, None),
+    Among("heden", 2, 1, None),
+    Among("s", -1, 3, None),
+];
+
+static A_4: &'static [Among<Context>; 6] = &[
+    Among("end", -1, 1, None),
+    Among("ig", -1, 2, None),
+    Among("ing", -1, 1, None),
+    Among("lijk", -1, 3, None),
+    Among("baar", -1, 4, None),
+    Among("bar", -1, 5, None),
+];
+
+static A_5: &'static [Among<Context>; 4] = &[
+    Among("aa", -1, -1, None),
+    Among("ee", -1, -1, None),
+    Among("oo", -1, -1, None),
+    Among("uu", -1, -1, None),
+];
+
+static G_v: &'static [u8; 17] = &[17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128];
+
+static G_v_I: &'static [u8; 20] = &[1, 0, 0, 17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128];
+
+static G_v_j: &'static [u8; 17] = &[17, 67, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128];
+
+#[derive(Clone)]
+struct Context {
+    i_p2: i32,
+    i_p1: i32,
+    b_e_found: bool,
+}
+
+fn r_undouble(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    let v_1 = env.limit - env.cursor;
+    if env.find_among_b(A_2, context) == 0 {
+        return false;
+    }
+    env.cursor = env.limit - v_1;
+    env.ket = env.cursor;
+    if env.cursor <= env.limit_backward {
+        return false;
+    }
+    env.previous_char();
+    env.bra = env.cursor;
+    if !env.slice_del() {
+        return false;
+    }
+    return true;
+}
+
+fn r_e_ending(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    context.b_e_found = false;
+    env.ket = env.cursor;
+    if !env.eq_s_b(&"e") {
+        return false;
+    }
+    env.bra = env.cursor;
+    if !(context.i_p1 <= env.cursor){
+        return false;
+    }
+    let v_1 = env.limit - env.cursor;
+    if !env.out_grouping_b(G_v, 97, 232) {
+        return false;
+    }
+    env.cursor = env.limit - v_1;
+    if !env.slice_del() {
+        return false;
+    }
+    context.b_e_found = true;
+    if !r_undouble(env, context) {
+        return false;
+    }
+    return true;
+}
+
+fn r_en_ending(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !(context.i_p1 <= env.cursor){
+        return false;
+    }
+    let v_1 = env.limit - env.cursor;
+    if !env.out_grouping_b(G_v, 97, 232) {
+        return false;
+    }
+    env.cursor = env.limit - v_1;
+    let v_2 = env.limit - env.cursor;
+    'lab0: loop {
+        if !env.eq_s_b(&"gem") {
+            break 'lab0;
+        }
+        return false;
+    }
+    env.cursor = env.limit - v_2;
+    if !env.slice_del() {
+        return false;
+    }
+    if !r_undouble(env, context) {
+        return false;
+    }
+    return true;
+}
+
+pub fn stem(env: &mut SnowballEnv) -> bool {
+    let mut context = &mut Context {
+        i_p2: 0,
+        i_p1: 0,
+        b_e_found: false,
+    };
+    let mut among_var;
+    let v_1 = env.cursor;
+    'lab0: loop {
+        let v_2 = env.cursor;
+        'replab1: loop{
+            let v_3 = env.cursor;
+            'lab2: for _ in 0..1 {
+                env.bra = env.cursor;
+                among_var = env.find_among(A_0, context);
+                if among_var == 0 {
+                    break 'lab2;
+                }
+                env.ket = env.cursor;
+                if among_var == 1 {
+                    if !env.slice_from("a") {
+                        return false;
+                    }
+                } else if among_var == 2 {
+                    if !env.slice_from("e") {
+                        return false;
+                    }
+                } else if among_var == 3 {
+                    if !env.slice_from("i") {
+                        return false;
+                    }
+                } else if among_var == 4 {
+                    if !env.slice_from("o") {
+                        return false;
+                    }
+                } else if among_var == 5 {
+                    if !env.slice_from("u") {
+                        return false;
+                    }
+                } else if among_var == 6 {
+                    if env.cursor >= env.limit {
+                        break 'lab2;
+                    }
+                    env.next_char();
+                }
+                continue 'replab1;
+            }
+            env.cursor = v_3;
+            break 'replab1;
+        }
+        env.cursor = v_2;
+        let v_4 = env.cursor;
+        'lab3: loop {
+            env.bra = env.cursor;
+            if !env.eq_s(&"y") {
+                env.cursor = v_4;
+                break 'lab3;
+            }
+            env.ket = env.cursor;
+            if !env.slice_from("Y") {
+                return false;
+            }
+            break 'lab3;
+        }
+        'replab4: loop{
+            let v_5 = env.cursor;
+            'lab5: for _ in 0..1 {
+                'golab6: loop {
+                    let v_6 = env.cursor;
+                    'lab7: loop {
+                        if !env.in_grouping(G_v, 97, 232) {
+                            break 'lab7;
+                        }
+                        env.bra = env.cursor;
+                        'lab8: loop {
+                            let v_7 = env.cursor;
+                            'lab9: loop {
+                                if !env.eq_s(&"i") {
+                                    break 'lab9;
+                                }
+                                env.ket = env.cursor;
+                                if !env.in_grouping(G_v, 97, 232) {
+                                    break 'lab9;
+                                }
+                                if !env.slice_from("I") {
+                                    return false;
+                                }
+                                break 'lab8;
+                            }
+                            env.cursor = v_7;
+                            if !env.eq_s(&"y") {
+                                break 'lab7;
+                            }
+                            env.ket = env.cursor;
+                            if !env.slice_from("Y") {
+                                return false;
+                            }
+                            break 'lab8;
+                        }
+                        env.cursor = v_6;
+                        break 'golab6;
+                    }
+                    env.cursor = v_6;
+                    if env.cursor >= env.limit {
+                        break 'lab5;
+                    }
+                    env.next_char();
+                }
+                continue 'replab4;
+            }
+            env.cursor = v_5;
+            break 'replab4;
+        }
+        break 'lab0;
+    }
+    env.cursor = v_1;
+    let v_8 = env.cursor;
+    'lab10: loop {
+        context.i_p1 = env.limit;
+        context.i_p2 = env.limit;
+        'golab11: loop {
+            'lab12: loop {
+                if !env.in_grouping(G_v, 97, 232) {
+                    break 'lab12;
+                }
+                break 'golab11;
+            }
+            if env.cursor >= env.limit {
+                break 'lab10;
+            }
+            env.next_char();
+        }
+        'golab13: loop {
+            'lab14: loop {
+                if !env.out_grouping(G_v, 97, 232) {
+                    break 'lab14;
+                }
+                break 'golab13;
+            }
+            if env.cursor >= env.limit {
+                break 'lab10;
+            }
+            env.next_char();
+        }
+        context.i_p1 = env.cursor;
+        'lab15: loop {
+            if !(context.i_p1 < 3){
+                break 'lab15;
+            }
+            context.i_p1 = 3;
+            break 'lab15;
+        }
+        'golab16: loop {
+            'lab17: loop {
+                if !env.in_grouping(G_v, 97, 232) {
+                    break 'lab17;
+                }
+                break 'golab16;
+            }
+            if env.cursor >= env.limit {
+                break 'lab10;
+            }
+            env.next_char();
+        }
+        'golab18: loop {
+            'lab19: loop {
+                if !env.out_grouping(G_v, 97, 232) {
+                    break 'lab19;
+                }
+                break 'golab18;
+            }
+            if env.cursor >= env.limit {
+                break 'lab10;
+            }
+            env.next_char();
+        }
+        context.i_p2 = env.cursor;
+        break 'lab10;
+    }
+    env.cursor = v_8;
+    env.limit_backward = env.cursor;
+    env.cursor = env.limit;
+    'lab20: loop {
+        let v_15 = env.limit - env.cursor;
+        'lab21: loop {
+            env.ket = env.cursor;
+            among_var = env.find_among_b(A_3, context);
+            if among_var == 0 {
+                break 'lab21;
+            }
+            env.bra = env.cursor;
+            if among_var == 1 {
+                if !(context.i_p1 <= env.cursor){
+                    break 'lab21;
+                }
+                if !env.slice_from("heid") {
+                    return false;
+                }
+            } else if among_var == 2 {
+                if !r_en_ending(env, context) {
+                    break 'lab21;
+                }
+            } else if among_var == 3 {
+                if !(context.i_p1 <= env.cursor){
+                    break 'lab21;
+                }
+                if !env.out_grouping_b(G_v_j, 97, 232) {
+                    break 'lab21;
+                }
+                if !env.slice_del() {
+                    return false;
+                }
+            }
+            break 'lab21;
+        }
+        env.cursor = env.limit - v_15;
+        let v_16 = env.limit - env.cursor;
+        r_e_ending(env, context);
+        env.cursor = env.limit - v_16;
+        let v_17 = env.limit - env.cursor;
+        'lab22: loop {
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"heid") {
+                break 'lab22;
+            }
+            env.bra = env.cursor;
+            if !(context.i_p2 <= env.cursor){
+                break 'lab22;
+            }
+            let v_18 = env.limit - env.cursor;
+            'lab23: loop {
+                if !env.eq_s_b(&"c") {
+                    break 'lab23;
+                }
+                break 'lab22;
+            }
+            env.cursor = env.limit - v_18;
+            if !env.slice_del() {
+                return false;
+            }
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"en") {
+                break 'lab22;
+            }
+            env.bra = env.cursor;
+            if !r_en_ending(env, context) {
+                break 'lab22;
+            }
+            break 'lab22;
+        }
+        env.cursor = env.limit - v_17;
+        let v_19 = env.limit - env.cursor;
+        'lab24: loop {
+            env.ket = env.cursor;
+            among_var = env.find_among_b(A_4, context);
+            if among_var == 0 {
+                break 'lab24;
+            }
+            env.bra = env.cursor;
+            if among_var == 1 {
+                if !(context.i_p2 <= env.cursor){
+                    break 'lab24;
+                }
+                if !env.slice_del() {
+                    return false;
+                }
+                'lab25: loop {
+                    let v_20 = env.limit - env.cursor;
+                    'lab26: loop {
+                        env.ket = env.cursor;
+                        if !env.eq_s_b(&"ig") {
+                            break 'lab26;
+                        }
+                        env.bra = env.cursor;
+                        if !(context.i_p2 <= env.cursor){
+                            break 'lab26;
+                        }
+                        let v_21 = env.limit - env.cursor;
+                        'lab27: loop {
+                            if !env.eq_s_b(&"e") {
+                                break 'lab27;
+                            }
+                            break 'lab26;
+                        }
+                        env.cursor = env.limit - v_21;
+                        if !env.slice_del() {
+                            return false;
+                        }
+                        break 'lab25;
+                    }
+                    env.cursor = env.limit - v_20;
+                    if !r_undouble(env, context) {
+                        break 'lab24;
+                    }
+                    break 'lab25;
+                }
+            } else if among_var == 2 {
+                if !(context.i_p2 <= env.cursor){
+                    break 'lab24;
+                }
+                let v_22 = env.limit - env.cursor;
+                'lab28: loop {
+                    if !env.eq_s_b(&"e") {
+                        break 'lab28;
+                    }
+                    break 'lab24;
+                }
+                env.cursor = env.limit - v_22;
+                if !env.slice_del() {
+                    return false;
+                }
+            } else if among_var == 3 {
+                if !(context.i_p2 <= env.cursor){
+                    break 'lab24;
+                }
+                if !env.slice_del() {
+                    return false;
+                }
+                if !r_e_ending(env, context) {
+                    break 'lab24;
+                }
+            } else if among_var == 4 {
+                if !(context.i_p2 <= env.cursor){
+                    break 'lab24;
+                }
+                if !env.slice_del() {
+                    return false;
+                }
+            } else if among_var == 5 {
+                if !(context.i_p2 <= env.cursor){
+                    break 'lab24;
+                }
+                if !context.b_e_found {
+                    break 'lab24;
+                }
+                if !env.slice_del() {
+                    return false;
+                }
+            }
+            break 'lab24;
+        }
+        env.cursor = env.limit - v_19;
+        let v_23 = env.limit - env.cursor;
+        'lab29: loop {
+            if !env.out_grouping_b(G_v_I, 73, 232) {
+                break 'lab29;
+            }
+            let v_24 = env.limit - env.cursor;
+            if env.find_among_b(A_5, context) == 0 {
+                break 'lab29;
+            }
+            if !env.out_grouping_b(G_v, 97, 232) {
+                break 'lab29;
+            }
+            env.cursor = env.limit - v_24;
+            env.ket = env.cursor;
+            if env.cursor <= env.limit_backward {
+                break 'lab29;
+            }
+            env.previous_char();
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            break 'lab29;
+        }
+        env.cursor = env.limit - v_23;
+        break 'lab20;
+    }
+    env.cursor = env.limit_backward;
+    let v_25 = env.cursor;
+    'lab30: loop {
+        'replab31: loop{
+            let v_26 = env.cursor;
+            'lab32: for _ in 0..1 {
+                env.bra = env.cursor;
+                among_var = env.find_among(A_1, context);
+                if among_var == 0 {
+                    break 'lab32;
+                }
+                env.ket = env.cursor;
+                if among_var == 1 {
+                    if !env.slice_from("y") {
+                        return false;
+                    }
+                } else if among_var == 2 {
+                    if !env.slice_from("i") {
+                        return false;
+                    }
+                } else if among_var == 3 {
+                    if env.cursor >= env.limit {
+                        break 'lab32;
+                    }
+                    env.next_char();
+                }
+                continue 'replab31;
+            }
+            env.cursor = v_26;
+            break 'replab31;
+        }
+        break 'lab30;
+    }
+    env.cursor = v_25;
+    return true;
+}
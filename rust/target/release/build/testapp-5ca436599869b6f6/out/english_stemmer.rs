@@ -0,0 +1,869 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+#![allow(non_snake_case)]
+#![allow(non_upper_case_globals)]
+#![allow(unused_mut)]
+#![allow(unused_parens)]
+#![allow(unused_variables)]
+use snowball::SnowballEnv;
+use snowball::Among;
+
+static A_0: &'static [Among<Context>; 3] = &[
+    Among("arsen", -1, -1, None),
+    Among("commun", -1, -1, None),
+    Among("gener", -1, -1, None),
+];
+
+static A_1: &'static [Among<Context>; 3] = &[
+    Among("'", -1, 1, None),
+    Among("'s'", 0, 1, None),
+    Among("'s", -1, 1, None),
+];
+
+static A_2: &'static [Among<Context>; 6] = &[
+    Among("ied", -1, 2, None),
+    Among("s", -1, 3, None),
+    Among("ies", 1, 2, None),
+    Among("sses", 1, 1, None),
+    Among("ss", 1, -1, None),
+    Among("us", 1, -1, None),
+];
+
+static A_3: &'static [Among<Context>; 13] = &[
+    Among("", -1, 3, None),
+    Among("bb", 0, 2, None),
+    Among("dd", 0, 2, None),
+    Among("ff", 0, 2, None),
+    Among("gg", 0, 2, None),
+    Among("bl", 0, 1, None),
+    Among("mm", 0, 2, None),
+    Among("nn", 0, 2, None),
+    Among("pp", 0, 2, None),
+    Among("rr", 0, 2, None),
+    Among("at", 0, 1, None),
+    Among("tt", 0, 2, None),
+    Among("iz", 0, 1, None),
+];
+
+static A_4: &'static [Among<Context>; 6] = &[
+    Among("ed", -1, 2, None),
+    Among("eed", 0, 1, None),
+    Among("ing", -1, 2, None),
+    Among("edly", -1, 2, None),
+    Among("eedly", 3, 1, None),
+    Among("ingly", -1, 2, None),
+];
+
+static A_5: &'static [Among<Context>; 24] = &[
+    Among("anci", -1, 3, None),
+    Among("enci", -1, 2, None),
+    Among("ogi", -1, 13, None),
+    Among("li", -1, 15, None),
+    Among("bli", 3, 12, None),
+    Among("abli", 4, 4, None),
+    Among("alli", 3, 8, None),
+    Among("fulli", 3, 9, None),
+    Among("lessli", 3, 14, None),
+    Among("ousli", 3, 10, None),
+    Among("entli", 3, 5, None),
+    Among("aliti", -1, 8, None),
+    Among("biliti", -1, 12, None),
+    Among("iviti", -1, 11, None),
+    Among("tional", -1, 1, None),
+    Among("ational", 14, 7, None),
+    Among("alism", -1, 8, None),
+    Among("ation", -1, 7, None),
+    Among("ization", 17, 6, None),
+    Among("izer", -1, 6, None),
+    Among("ator", -1, 7, None),
+    Among("iveness", -1, 11, None),
+    Among("fulness", -1, 9, None),
+    Among("ousness", -1, 10, None),
+];
+
+static A_6: &'static [Among<Context>; 9] = &[
+    Among("icate", -1, 4, None),
+    Among("ative", -1, 6, None),
+    Among("alize", -1, 3, None),
+    Among("iciti", -1, 4, None),
+    Among("ical", -1, 4, None),
+    Among("tional", -1, 1, None),
+    Among("ational", 5, 2, None),
+    Among("ful", -1, 5, None),
+    Among("ness", -1, 5, None),
+];
+
+static A_7: &'static [Among<Context>; 18] = &[
+    Among("ic", -1, 1, None),
+    Among("ance", -1, 1, None),
+    Among("ence", -1, 1, None),
+    Among("able", -1, 1, None),
+    Among("ible", -1, 1, None),
+    Among("ate", -1, 1, None),
+    Among("ive", -1, 1, None),
+    Among("ize", -1, 1, None),
+    Among("iti", -1, 1, None),
+    Among("al", -1, 1, None),
+    Among("ism", -1, 1, None),
+    Among("ion", -1, 2, None),
+    Among("er", -1, 1, None),
+    Among("ous", -1, 1, None),
+    Among("ant", -1, 1, None),
+    Among("ent", -1, 1, None),
+    Among("ment", 15, 1, None),
+    Among("ement", 16, 1, None),
+];
+
+static A_8: &'static [Among<Context>; 2] = &[
+    Among("e", -1, 1, None),
+    Among("l", -1, 2, None),
+];
+
+static A_9: &'static [Among<Context>; 8] = &[
+    Among("succeed", -1, -1, None),
+    Among("proceed", -1, -1, None),
+    Among("exceed", -1, -1, None),
+    Among("canning", -1, -1, None),
+    Among("inning", -1, -1, None),
+    Among("earring", -1, -1, None),
+    Among("herring", -1, -1, None),
+    Among("outing", -1, -1, None),
+];
+
+static A_10: &'static [Among<Context>; 18] = &[
+    Among("andes", -1, -1, None),
+    Among("atlas", -1, -1, None),
+    Among("bias", -1, -1, None),
+    Among("cosmos", -1, -1, None),
+    Among("dying", -1, 3, None),
+    Among("early", -1, 9, None),
+    Among("gently", -1, 7, None),
+    Among("howe", -1, -1, None),
+    Among("idly", -1, 6, None),
+    Among("lying", -1, 4, None),
+    Among("news", -1, -1, None),
+    Among("only", -1, 10, None),
+    Among("singly", -1, 11, None),
+    Among("skies", -1, 2, None),
+    Among("skis", -1, 1, None),
+    Among("sky", -1, -1, None),
+    Among("tying", -1, 5, None),
+    Among("ugly", -1, 8, None),
+];
+
+static G_v: &'static [u8; 4] = &[17, 65, 16, 1];
+
+static G_v_WXY: &'static [u8; 5] = &[1, 17, 65, 208, 1];
+
+static G_valid_LI: &'static [u8; 3] = &[55, 141, 2];
+
+#[derive(Clone)]
+struct Context {
+    b_Y_found: bool,
+    i_p2: i32,
+    i_p1: i32,
+}
+
+pub fn stem(env: &mut SnowballEnv) -> bool {
+    let mut context = &mut Context {
+        b_Y_found: false,
+        i_p2: 0,
+        i_p1: 0,
+    };
+    let mut among_var;
+    'lab0: loop {
+        let v_1 = env.cursor;
+        'lab1: loop {
+            env.bra = env.cursor;
+            among_var = env.find_among(A_10, context);
+            if among_var == 0 {
+                break 'lab1;
+            }
+            env.ket = env.cursor;
+            if env.cursor < env.limit {
+                break 'lab1;
+            }
+            if among_var == 1 {
+                if !env.slice_from("ski") {
+                    return false;
+                }
+            } else if among_var == 2 {
+                if !env.slice_from("sky") {
+                    return false;
+                }
+            } else if among_var == 3 {
+                if !env.slice_from("die") {
+                    return false;
+                }
+            } else if among_var == 4 {
+                if !env.slice_from("lie") {
+                    return false;
+                }
+            } else if among_var == 5 {
+                if !env.slice_from("tie") {
+                    return false;
+                }
+            } else if among_var == 6 {
+                if !env.slice_from("idl") {
+                    return false;
+                }
+            } else if among_var == 7 {
+                if !env.slice_from("gentl") {
+                    return false;
+                }
+            } else if among_var == 8 {
+                if !env.slice_from("ugli") {
+                    return false;
+                }
+            } else if among_var == 9 {
+                if !env.slice_from("earli") {
+                    return false;
+                }
+            } else if among_var == 10 {
+                if !env.slice_from("onli") {
+                    return false;
+                }
+            } else if among_var == 11 {
+                if !env.slice_from("singl") {
+                    return false;
+                }
+            }
+            break 'lab0;
+        }
+        env.cursor = v_1;
+        'lab2: loop {
+            let v_2 = env.cursor;
+            'lab3: loop {
+                if !env.hop(3) {
+                    break 'lab3;
+                }
+                break 'lab2;
+            }
+            env.cursor = v_2;
+            break 'lab0;
+        }
+        env.cursor = v_1;
+        'lab4: loop {
+            context.b_Y_found = false;
+            let v_4 = env.cursor;
+            'lab5: loop {
+                env.bra = env.cursor;
+                if !env.eq_s(&"'") {
+                    break 'lab5;
+                }
+                env.ket = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+                break 'lab5;
+            }
+            env.cursor = v_4;
+            let v_5 = env.cursor;
+            'lab6: loop {
+                env.bra = env.cursor;
+                if !env.eq_s(&"y") {
+                    break 'lab6;
+                }
+                env.ket = env.cursor;
+                if !env.slice_from("Y") {
+                    return false;
+                }
+                context.b_Y_found = true;
+                break 'lab6;
+            }
+            env.cursor = v_5;
+            let v_6 = env.cursor;
+            'lab7: loop {
+                'replab8: loop{
+                    let v_7 = env.cursor;
+                    'lab9: for _ in 0..1 {
+                        'golab10: loop {
+                            let v_8 = env.cursor;
+                            'lab11: loop {
+                                if !env.in_grouping(G_v, 97, 121) {
+                                    break 'lab11;
+                                }
+                                env.bra = env.cursor;
+                                if !env.eq_s(&"y") {
+                                    break 'lab11;
+                                }
+                                env.ket = env.cursor;
+                                env.cursor = v_8;
+                                break 'golab10;
+                            }
+                            env.cursor = v_8;
+                            if env.cursor >= env.limit {
+                                break 'lab9;
+                            }
+                            env.next_char();
+                        }
+                        if !env.slice_from("Y") {
+                            return false;
+                        }
+                        context.b_Y_found = true;
+                        continue 'replab8;
+                    }
+                    env.cursor = v_7;
+                    break 'replab8;
+                }
+                break 'lab7;
+            }
+            env.cursor = v_6;
+            break 'lab4;
+        }
+        'lab12: loop {
+            context.i_p1 = env.limit;
+            context.i_p2 = env.limit;
+            let v_10 = env.cursor;
+            'lab13: loop {
+                'lab14: loop {
+                    let v_11 = env.cursor;
+                    'lab15: loop {
+                        if env.find_among(A_0, context) == 0 {
+                            break 'lab15;
+                        }
+                        break 'lab14;
+                    }
+                    env.cursor = v_11;
+                    'golab16: loop {
+                        'lab17: loop {
+                            if !env.in_grouping(G_v, 97, 121) {
+                                break 'lab17;
+                            }
+                            break 'golab16;
+                        }
+                        if env.cursor >= env.limit {
+                            break 'lab13;
+                        }
+                        env.next_char();
+                    }
+                    'golab18: loop {
+                        'lab19: loop {
+                            if !env.out_grouping(G_v, 97, 121) {
+                                break 'lab19;
+                            }
+                            break 'golab18;
+                        }
+                        if env.cursor >= env.limit {
+                            break 'lab13;
+                        }
+                        env.next_char();
+                    }
+                    break 'lab14;
+                }
+                context.i_p1 = env.cursor;
+                'golab20: loop {
+                    'lab21: loop {
+                        if !env.in_grouping(G_v, 97, 121) {
+                            break 'lab21;
+                        }
+                        break 'golab20;
+                    }
+                    if env.cursor >= env.limit {
+                        break 'lab13;
+                    }
+                    env.next_char();
+                }
+                'golab22: loop {
+                    'lab23: loop {
+                        if !env.out_grouping(G_v, 97, 121) {
+                            break 'lab23;
+                        }
+                        break 'golab22;
+                    }
+                    if env.cursor >= env.limit {
+                        break 'lab13;
+                    }
+                    env.next_char();
+                }
+                context.i_p2 = env.cursor;
+                break 'lab13;
+            }
+            env.cursor = v_10;
+            break 'lab12;
+        }
+        env.limit_backward = env.cursor;
+        env.cursor = env.limit;
+        let v_16 = env.limit - env.cursor;
+        'lab24: loop {
+            let v_17 = env.limit - env.cursor;
+            'lab25: loop {
+                env.ket = env.cursor;
+                if env.find_among_b(A_1, context) == 0 {
+                    env.cursor = env.limit - v_17;
+                    break 'lab25;
+                }
+                env.bra = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+                break 'lab25;
+            }
+            env.ket = env.cursor;
+            among_var = env.find_among_b(A_2, context);
+            if among_var == 0 {
+                break 'lab24;
+            }
+            env.bra = env.cursor;
+            if among_var == 1 {
+                if !env.slice_from("ss") {
+                    return false;
+                }
+            } else if among_var == 2 {
+                'lab26: loop {
+                    let v_18 = env.limit - env.cursor;
+                    'lab27: loop {
+                        if !env.hop_back(2) {
+                            break 'lab27;
+                        }
+                        if !env.slice_from("i") {
+                            return false;
+                        }
+                        break 'lab26;
+                    }
+                    env.cursor = env.limit - v_18;
+                    if !env.slice_from("ie") {
+                        return false;
+                    }
+                    break 'lab26;
+                }
+            } else if among_var == 3 {
+                if env.cursor <= env.limit_backward {
+                    break 'lab24;
+                }
+                env.previous_char();
+                'golab28: loop {
+                    'lab29: loop {
+                        if !env.in_grouping_b(G_v, 97, 121) {
+                            break 'lab29;
+                        }
+                        break 'golab28;
+                    }
+                    if env.cursor <= env.limit_backward {
+                        break 'lab24;
+                    }
+                    env.previous_char();
+                }
+                if !env.slice_del() {
+                    return false;
+                }
+            }
+            break 'lab24;
+        }
+        env.cursor = env.limit - v_16;
+        'lab30: loop {
+            let v_20 = env.limit - env.cursor;
+            'lab31: loop {
+                env.ket = env.cursor;
+                if env.find_among_b(A_9, context) == 0 {
+                    break 'lab31;
+                }
+                env.bra = env.cursor;
+                if env.cursor > env.limit_backward {
+                    break 'lab31;
+                }
+                break 'lab30;
+            }
+            env.cursor = env.limit - v_20;
+            let v_21 = env.limit - env.cursor;
+            'lab32: loop {
+                env.ket = env.cursor;
+                among_var = env.find_among_b(A_4, context);
+                if among_var == 0 {
+                    break 'lab32;
+                }
+                env.bra = env.cursor;
+                if among_var == 1 {
+                    if !(context.i_p1 <= env.cursor){
+                        break 'lab32;
+                    }
+                    if !env.slice_from("ee") {
+                        return false;
+                    }
+                } else if among_var == 2 {
+                    let v_22 = env.limit - env.cursor;
+                    'golab33: loop {
+                        'lab34: loop {
+                            if !env.in_grouping_b(G_v, 97, 121) {
+                                break 'lab34;
+                            }
+                            break 'golab33;
+                        }
+                        if env.cursor <= env.limit_backward {
+                            break 'lab32;
+                        }
+                        env.previous_char();
+                    }
+                    env.cursor = env.limit - v_22;
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    let v_24 = env.limit - env.cursor;
+                    among_var = env.find_among_b(A_3, context);
+                    if among_var == 0 {
+                        break 'lab32;
+                    }
+                    env.cursor = env.limit - v_24;
+                    if among_var == 1 {
+                        let c = env.cursor;
+                        let (bra, ket) = (env.cursor, env.cursor);
+                        env.insert(bra, ket, "e");
+                        env.cursor = c;
+                    } else if among_var == 2 {
+                        env.ket = env.cursor;
+                        if env.cursor <= env.limit_backward {
+                            break 'lab32;
+                        }
+                        env.previous_char();
+                        env.bra = env.cursor;
+                        if !env.slice_del() {
+                            return false;
+                        }
+                    } else if among_var == 3 {
+                        if env.cursor != context.i_p1 {
+                            break 'lab32;
+                        }
+                        let v_25 = env.limit - env.cursor;
+                        'lab35: loop {
+                            let v_26 = env.limit - env.cursor;
+                            'lab36: loop {
+                                if !env.out_grouping_b(G_v_WXY, 89, 121) {
+                                    break 'lab36;
+                                }
+                                if !env.in_grouping_b(G_v, 97, 121) {
+                                    break 'lab36;
+                                }
+                                if !env.out_grouping_b(G_v, 97, 121) {
+                                    break 'lab36;
+                                }
+                                break 'lab35;
+                            }
+                            env.cursor = env.limit - v_26;
+                            if !env.out_grouping_b(G_v, 97, 121) {
+                                break 'lab32;
+                            }
+                            if !env.in_grouping_b(G_v, 97, 121) {
+                                break 'lab32;
+                            }
+                            if env.cursor > env.limit_backward {
+                                break 'lab32;
+                            }
+                            break 'lab35;
+                        }
+                        env.cursor = env.limit - v_25;
+                        let c = env.cursor;
+                        let (bra, ket) = (env.cursor, env.cursor);
+                        env.insert(bra, ket, "e");
+                        env.cursor = c;
+                    }
+                }
+                break 'lab32;
+            }
+            env.cursor = env.limit - v_21;
+            let v_27 = env.limit - env.cursor;
+            'lab37: loop {
+                env.ket = env.cursor;
+                'lab38: loop {
+                    let v_28 = env.limit - env.cursor;
+                    'lab39: loop {
+                        if !env.eq_s_b(&"y") {
+                            break 'lab39;
+                        }
+                        break 'lab38;
+                    }
+                    env.cursor = env.limit - v_28;
+                    if !env.eq_s_b(&"Y") {
+                        break 'lab37;
+                    }
+                    break 'lab38;
+                }
+                env.bra = env.cursor;
+                if !env.out_grouping_b(G_v, 97, 121) {
+                    break 'lab37;
+                }
+                'lab40: loop {
+                    if env.cursor > env.limit_backward {
+                        break 'lab40;
+                    }
+                    break 'lab37;
+                }
+                if !env.slice_from("i") {
+                    return false;
+                }
+                break 'lab37;
+            }
+            env.cursor = env.limit - v_27;
+            let v_30 = env.limit - env.cursor;
+            'lab41: loop {
+                env.ket = env.cursor;
+                among_var = env.find_among_b(A_5, context);
+                if among_var == 0 {
+                    break 'lab41;
+                }
+                env.bra = env.cursor;
+                if !(context.i_p1 <= env.cursor){
+                    break 'lab41;
+                }
+                if among_var == 1 {
+                    if !env.slice_from("tion") {
+                        return false;
+                    }
+                } else if among_var == 2 {
+                    if !env.slice_from("ence") {
+                        return false;
+                    }
+                } else if among_var == 3 {
+                    if !env.slice_from("ance") {
+                        return false;
+                    }
+                } else if among_var == 4 {
+                    if !env.slice_from("able") {
+                        return false;
+                    }
+                } else if among_var == 5 {
+                    if !env.slice_from("ent") {
+                        return false;
+                    }
+                } else if among_var == 6 {
+                    if !env.slice_from("ize") {
+                        return false;
+                    }
+                } else if among_var == 7 {
+                    if !env.slice_from("ate") {
+                        return false;
+                    }
+                } else if among_var == 8 {
+                    if !env.slice_from("al") {
+                        return false;
+                    }
+                } else if among_var == 9 {
+                    if !env.slice_from("ful") {
+                        return false;
+                    }
+                } else if among_var == 10 {
+                    if !env.slice_from("ous") {
+                        return false;
+                    }
+                } else if among_var == 11 {
+                    if !env.slice_from("ive") {
+                        return false;
+                    }
+                } else if among_var == 12 {
+                    if !env.slice_from("ble") {
+                        return false;
+                    }
+                } else if among_var == 13 {
+                    if !env.eq_s_b(&"l") {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("og") {
+                        return false;
+                    }
+                } else if among_var == 14 {
+                    if !env.slice_from("less") {
+                        return false;
+                    }
+                } else if among_var == 15 {
+                    if !env.in_grouping_b(G_valid_LI, 99, 116) {
+                        break 'lab41;
+                    }
+                    if !env.slice_del() {
+                        return false;
+                    }
+                }
+                break 'lab41;
+            }
+            env.cursor = env.limit - v_30;
+            let v_31 = env.limit - env.cursor;
+            'lab42: loop {
+                env.ket = env.cursor;
+                among_var = env.find_among_b(A_6, context);
+                if among_var == 0 {
+                    break 'lab42;
+                }
+                env.bra = env.cursor;
+                if !(context.i_p1 <= env.cursor){
+                    break 'lab42;
+                }
+                if among_var == 1 {
+                    if !env.slice_from("tion") {
+                        return false;
+                    }
+                } else if among_var == 2 {
+                    if !env.slice_from("ate") {
+                        return false;
+                    }
+                } else if among_var == 3 {
+                    if !env.slice_from("al") {
+                        return false;
+                    }
+                } else if among_var == 4 {
+                    if !env.slice_from("ic") {
+                        return false;
+                    }
+                } else if among_var == 5 {
+                    if !env.slice_del() {
+                        return false;
+                    }
+                } else if among_var == 6 {
+                    if !(context.i_p2 <= env.cursor){
+                        break 'lab42;
+                    }
+                    if !env.slice_del() {
+                        return false;
+                    }
+                }
+                break 'lab42;
+            }
+            env.cursor = env.limit - v_31;
+            let v_32 = env.limit - env.cursor;
+            'lab43: loop {
+                env.ket = env.cursor;
+                among_var = env.find_among_b(A_7, context);
+                if among_var == 0 {
+                    break 'lab43;
+                }
+                env.bra = env.cursor;
+                if !(context.i_p2 <= env.cursor){
+                    break 'lab43;
+                }
+                if among_var == 1 {
+                    if !env.slice_del() {
+                        return false;
+                    }
+                } else if among_var == 2 {
+                    'lab44: loop {
+                        let v_33 = env.limit - env.cursor;
+                        'lab45: loop {
+                            if !env.eq_s_b(&"s") {
+                                break 'lab45;
+                            }
+                            break 'lab44;
+                        }
+                        env.cursor = env.limit - v_33;
+                        if !env.eq_s_b(&"t") {
+                            break 'lab43;
+                        }
+                        break 'lab44;
+                    }
+                    if !env.slice_del() {
+                        return false;
+                    }
+                }
+                break 'lab43;
+            }
+            env.cursor = env.limit - v_32;
+            let v_34 = env.limit - env.cursor;
+            'lab46: loop {
+                env.ket = env.cursor;
+                among_var = env.find_among_b(A_8, context);
+                if among_var == 0 {
+                    break 'lab46;
+                }
+                env.bra = env.cursor;
+                if among_var == 1 {
+                    'lab47: loop {
+                        let v_35 = env.limit - env.cursor;
+                        'lab48: loop {
+                            if !(context.i_p2 <= env.cursor){
+                                break 'lab48;
+                            }
+                            break 'lab47;
+                        }
+                        env.cursor = env.limit - v_35;
+                        if !(context.i_p1 <= env.cursor){
+                            break 'lab46;
+                        }
+                        let v_36 = env.limit - env.cursor;
+                        'lab49: loop {
+                            'lab50: loop {
+                                let v_37 = env.limit - env.cursor;
+                                'lab51: loop {
+                                    if !env.out_grouping_b(G_v_WXY, 89, 121) {
+                                        break 'lab51;
+                                    }
+                                    if !env.in_grouping_b(G_v, 97, 121) {
+                                        break 'lab51;
+                                    }
+                                    if !env.out_grouping_b(G_v, 97, 121) {
+                                        break 'lab51;
+                                    }
+                                    break 'lab50;
+                                }
+                                env.cursor = env.limit - v_37;
+                                if !env.out_grouping_b(G_v, 97, 121) {
+                                    break 'lab49;
+                                }
+                                if !env.in_grouping_b(G_v, 97, 121) {
+                                    break 'lab49;
+                                }
+                                if env.cursor > env.limit_backward {
+                                    break 'lab49;
+                                }
+                                break 'lab50;
+                            }
+                            break 'lab46;
+                        }
+                        env.cursor = env.limit - v_36;
+                        break 'lab47;
+                    }
+                    if !env.slice_del() {
+                        return false;
+                    }
+                } else if among_var == 2 {
+                    if !(context.i_p2 <= env.cursor){
+                        break 'lab46;
+                    }
+                    if !env.eq_s_b(&"l") {
+                        break 'lab46;
+                    }
+                    if !env.slice_del() {
+                        return false;
+                    }
+                }
+                break 'lab46;
+            }
+            env.cursor = env.limit - v_34;
+            break 'lab30;
+        }
+        env.cursor = env.limit_backward;
+        let v_38 = env.cursor;
+        'lab52: loop {
+            if !context.b_Y_found {
+                break 'lab52;
+            }
+            'replab53: loop{
+                let v_39 = env.cursor;
+                'lab54: for _ in 0..1 {
+                    'golab55: loop {
+                        let v_40 = env.cursor;
+                        'lab56: loop {
+                            env.bra = env.cursor;
+                            if !env.eq_s(&"Y") {
+                                break 'lab56;
+                            }
+                            env.ket = env.cursor;
+                            env.cursor = v_40;
+                            break 'golab55;
+                        }
+                        env.cursor = v_40;
+                        if env.cursor >= env.limit {
+                            break 'lab54;
+                        }
+                        env.next_char();
+                    }
+                    if !env.slice_from("y") {
+                        return false;
+                    }
+                    continue 'replab53;
+                }
+                env.cursor = v_39;
+                break 'replab53;
+            }
+            break 'lab52;
+        }
+        env.cursor = v_38;
+        break 'lab0;
+    }
+    return true;
+}
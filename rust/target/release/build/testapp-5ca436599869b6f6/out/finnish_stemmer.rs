@@ -0,0 +1,651 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+#![allow(non_snake_case)]
+#![allow(non_upper_case_globals)]
+#![allow(unused_mut)]
+#![allow(unused_parens)]
+#![allow(unused_variables)]
+use snowball::SnowballEnv;
+use snowball::Among;
+
+static A_0: &'static [Among<Context>; 10] = &[
+    Among("pa", -1, 1, None),
+    Among("sti", -1, 2, None),
+    Among("kaan", -1, 1, None),
+    Among("han", -1, 1, None),
+    Among("kin", -1, 1, None),
+    Among("h\u{00E4}n", -1, 1, None),
+    Among("k\u{00E4}\u{00E4}n", -1, 1, None),
+    Among("ko", -1, 1, None),
+    Among("p\u{00E4}", -1, 1, None),
+    Among("k\u{00F6}", -1, 1, None),
+];
+
+static A_1: &'static [Among<Context>; 6] = &[
+    Among("lla", -1, -1, None),
+    Among("na", -1, -1, None),
+    Among("ssa", -1, -1, None),
+    Among("ta", -1, -1, None),
+    Among("lta", 3, -1, None),
+    Among("sta", 3, -1, None),
+];
+
+static A_2: &'static [Among<Context>; 6] = &[
+    Among("ll\u{00E4}", -1, -1, None),
+    Among("n\u{00E4}", -1, -1, None),
+    Among("ss\u{00E4}", -1, -1, None),
+    Among("t\u{00E4}", -1, -1, None),
+    Among("lt\u{00E4}", 3, -1, None),
+    Among("st\u{00E4}", 3, -1, None),
+];
+
+static A_3: &'static [Among<Context>; 2] = &[
+    Among("lle", -1, -1, None),
+    Among("ine", -1, -1, None),
+];
+
+static A_4: &'static [Among<Context>; 9] = &[
+    Among("nsa", -1, 3, None),
+    Among("mme", -1, 3, None),
+    Among("nne", -1, 3, None),
+    Among("ni", -1, 2, None),
+    Among("si", -1, 1, None),
+    Among("an", -1, 4, None),
+    Among("en", -1, 6, None),
+    Among("\u{00E4}n", -1, 5, None),
+    Among("ns\u{00E4}", -1, 3, None),
+];
+
+static A_5: &'static [Among<Context>; 7] = &[
+    Among("aa", -1, -1, None),
+    Among("ee", -1, -1, None),
+    Among("ii", -1, -1, None),
+    Among("oo", -1, -1, None),
+    Among("uu", -1, -1, None),
+    Among("\u{00E4}\u{00E4}", -1, -1, None),
+    Among("\u{00F6}\u{00F6}", -1, -1, None),
+];
+
+static A_6: &'static [Among<Context>; 30] = &[
+    Among("a", -1, 8, None),
+    Among("lla", 0, -1, None),
+    Among("na", 0, -1, None),
+    Among("ssa", 0, -1, None),
+    Among("ta", 0, -1, None),
+    Among("lta", 4, -1, None),
+    Among("sta", 4, -1, None),
+    Among("tta", 4, 2, None),
+    Among("lle", -1, -1, None),
+    Among("ine", -1, -1, None),
+    Among("ksi", -1, -1, None),
+    Among("n", -1, 7, None),
+    Among("han", 11, 1, None),
+    Among("den", 11, -1, Some(&r_VI)),
+    Among("seen", 11, -1, Some(&r_LONG)),
+    Among("hen", 11, 2, None),
+    Among("tten", 11, -1, Some(&r_VI)),
+    Among("hin", 11, 3, None),
+    Among("siin", 11, -1, Some(&r_VI)),
+    Among("hon", 11, 4, None),
+    Among("h\u{00E4}n", 11, 5, None),
+    Among("h\u{00F6}n", 11, 6, None),
+    Among("\u{00E4}", -1, 8, None),
+    Among("ll\u{00E4}", 22, -1, None),
+    Among("n\u{00E4}", 22, -1, None),
+    Among("ss\u{00E4}", 22, -1, None),
+    Among("t\u{00E4}", 22, -1, None),
+    Among("lt\u{00E4}", 26, -1, None),
+    Among("st\u{00E4}", 26, -1, None),
+    Among("tt\u{00E4}", 26, 2, None),
+];
+
+static A_7: &'static [Among<Context>; 14] = &[
+    Among("eja", -1, -1, None),
+    Among("mma", -1, 1, None),
+    Among("imma", 1, -1, None),
+    Among("mpa", -1, 1, None),
+    Among("impa", 3, -1, None),
+    Among("mmi", -1, 1, None),
+    Among("immi", 5, -1, None),
+    Among("mpi", -1, 1, None),
+    Among("impi", 7, -1, None),
+    Among("ej\u{00E4}", -1, -1, None),
+    Among("mm\u{00E4}", -1, 1, None),
+    Among("imm\u{00E4}", 10, -1, None),
+    Among("mp\u{00E4}", -1, 1, None),
+    Among("imp\u{00E4}", 12, -1, None),
+];
+
+static A_8: &'static [Among<Context>; 2] = &[
+    Among("i", -1, -1, None),
+    Among("j", -1, -1, None),
+];
+
+static A_9: &'static [Among<Context>; 2] = &[
+    Among("mma", -1, 1, None),
+    Among("imma", 0, -1, None),
+];
+
+static G_AEI: &'static [u8; 17] = &[17, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8];
+
+static G_C: &'static [u8; 4] = &[119, 223, 119, 1];
+
+static G_V1: &'static [u8; 19] = &[17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32];
+
+static G_V2: &'static [u8; 19] = &[17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32];
+
+static G_particle_end: &'static [u8; 19] = &[17, 97, 24, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32];
+
+#[derive(Clone)]
+struct Context {
+    b_ending_removed: bool,
+    S_x: String,
+    i_p2: i32,
+    i_p1: i32,
+}
+
+fn r_LONG(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if env.find_among_b(A_5, context) == 0 {
+        return false;
+    }
+    return true;
+}
+
+fn r_VI(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !env.eq_s_b(&"i") {
+        return false;
+    }
+    if !env.in_grouping_b(G_V2, 97, 246) {
+        return false;
+    }
+    return true;
+}
+
+pub fn stem(env: &mut SnowballEnv) -> bool {
+    let mut context = &mut Context {
+        b_ending_removed: false,
+        S_x: String::new(),
+        i_p2: 0,
+        i_p1: 0,
+    };
+    let mut among_var;
+    let v_1 = env.cursor;
+    'lab0: loop {
+        context.i_p1 = env.limit;
+        context.i_p2 = env.limit;
+        'golab1: loop {
+            let v_2 = env.cursor;
+            'lab2: loop {
+                if !env.in_grouping(G_V1, 97, 246) {
+                    break 'lab2;
+                }
+                env.cursor = v_2;
+                break 'golab1;
+            }
+            env.cursor = v_2;
+            if env.cursor >= env.limit {
+                break 'lab0;
+            }
+            env.next_char();
+        }
+        'golab3: loop {
+            'lab4: loop {
+                if !env.out_grouping(G_V1, 97, 246) {
+                    break 'lab4;
+                }
+                break 'golab3;
+            }
+            if env.cursor >= env.limit {
+                break 'lab0;
+            }
+            env.next_char();
+        }
+        context.i_p1 = env.cursor;
+        'golab5: loop {
+            let v_4 = env.cursor;
+            'lab6: loop {
+                if !env.in_grouping(G_V1, 97, 246) {
+                    break 'lab6;
+                }
+                env.cursor = v_4;
+                break 'golab5;
+            }
+            env.cursor = v_4;
+            if env.cursor >= env.limit {
+                break 'lab0;
+            }
+            env.next_char();
+        }
+        'golab7: loop {
+            'lab8: loop {
+                if !env.out_grouping(G_V1, 97, 246) {
+                    break 'lab8;
+                }
+                break 'golab7;
+            }
+            if env.cursor >= env.limit {
+                break 'lab0;
+            }
+            env.next_char();
+        }
+        context.i_p2 = env.cursor;
+        break 'lab0;
+    }
+    env.cursor = v_1;
+    context.b_ending_removed = false;
+    env.limit_backward = env.cursor;
+    env.cursor = env.limit;
+    let v_6 = env.limit - env.cursor;
+    'lab9: loop {
+        if env.cursor < context.i_p1 {
+            break 'lab9;
+        }
+        let v_8 = env.limit_backward;
+        env.limit_backward = context.i_p1;
+        env.ket = env.cursor;
+        among_var = env.find_among_b(A_0, context);
+        if among_var == 0 {
+            env.limit_backward = v_8;
+            break 'lab9;
+        }
+        env.bra = env.cursor;
+        env.limit_backward = v_8;
+        if among_var == 1 {
+            if !env.in_grouping_b(G_particle_end, 97, 246) {
+                break 'lab9;
+            }
+        } else if among_var == 2 {
+            if !(context.i_p2 <= env.cursor){
+                break 'lab9;
+            }
+        }
+        if !env.slice_del() {
+            return false;
+        }
+        break 'lab9;
+    }
+    env.cursor = env.limit - v_6;
+    let v_9 = env.limit - env.cursor;
+    'lab10: loop {
+        if env.cursor < context.i_p1 {
+            break 'lab10;
+        }
+        let v_11 = env.limit_backward;
+        env.limit_backward = context.i_p1;
+        env.ket = env.cursor;
+        among_var = env.find_among_b(A_4, context);
+        if among_var == 0 {
+            env.limit_backward = v_11;
+            break 'lab10;
+        }
+        env.bra = env.cursor;
+        env.limit_backward = v_11;
+        if among_var == 1 {
+            let v_12 = env.limit - env.cursor;
+            'lab11: loop {
+                if !env.eq_s_b(&"k") {
+                    break 'lab11;
+                }
+                break 'lab10;
+            }
+            env.cursor = env.limit - v_12;
+            if !env.slice_del() {
+                return false;
+            }
+        } else if among_var == 2 {
+            if !env.slice_del() {
+                return false;
+            }
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"kse") {
+                break 'lab10;
+            }
+            env.bra = env.cursor;
+            if !env.slice_from("ksi") {
+                return false;
+            }
+        } else if among_var == 3 {
+            if !env.slice_del() {
+                return false;
+            }
+        } else if among_var == 4 {
+            if env.find_among_b(A_1, context) == 0 {
+                break 'lab10;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+        } else if among_var == 5 {
+            if env.find_among_b(A_2, context) == 0 {
+                break 'lab10;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+        } else if among_var == 6 {
+            if env.find_among_b(A_3, context) == 0 {
+                break 'lab10;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+        }
+        break 'lab10;
+    }
+    env.cursor = env.limit - v_9;
+    let v_13 = env.limit - env.cursor;
+    'lab12: loop {
+        if env.cursor < context.i_p1 {
+            break 'lab12;
+        }
+        let v_15 = env.limit_backward;
+        env.limit_backward = context.i_p1;
+        env.ket = env.cursor;
+        among_var = env.find_among_b(A_6, context);
+        if among_var == 0 {
+            env.limit_backward = v_15;
+            break 'lab12;
+        }
+        env.bra = env.cursor;
+        env.limit_backward = v_15;
+        if among_var == 1 {
+            if !env.eq_s_b(&"a") {
+                break 'lab12;
+            }
+        } else if among_var == 2 {
+            if !env.eq_s_b(&"e") {
+                break 'lab12;
+            }
+        } else if among_var == 3 {
+            if !env.eq_s_b(&"i") {
+                break 'lab12;
+            }
+        } else if among_var == 4 {
+            if !env.eq_s_b(&"o") {
+                break 'lab12;
+            }
+        } else if among_var == 5 {
+            if !env.eq_s_b(&"\u{00E4}") {
+                break 'lab12;
+            }
+        } else if among_var == 6 {
+            if !env.eq_s_b(&"\u{00F6}") {
+                break 'lab12;
+            }
+        } else if among_var == 7 {
+            let v_16 = env.limit - env.cursor;
+            'lab13: loop {
+                let v_17 = env.limit - env.cursor;
+                'lab14: loop {
+                    let v_18 = env.limit - env.cursor;
+                    'lab15: loop {
+                        if !r_LONG(env, context) {
+                            break 'lab15;
+                        }
+                        break 'lab14;
+                    }
+                    env.cursor = env.limit - v_18;
+                    if !env.eq_s_b(&"ie") {
+                        env.cursor = env.limit - v_16;
+                        break 'lab13;
+                    }
+                    break 'lab14;
+                }
+                env.cursor = env.limit - v_17;
+                if env.cursor <= env.limit_backward {
+                    env.cursor = env.limit - v_16;
+                    break 'lab13;
+                }
+                env.previous_char();
+                env.bra = env.cursor;
+                break 'lab13;
+            }
+        } else if among_var == 8 {
+            if !env.in_grouping_b(G_V1, 97, 246) {
+                break 'lab12;
+            }
+            if !env.in_grouping_b(G_C, 98, 122) {
+                break 'lab12;
+            }
+        }
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_ending_removed = true;
+        break 'lab12;
+    }
+    env.cursor = env.limit - v_13;
+    let v_19 = env.limit - env.cursor;
+    'lab16: loop {
+        if env.cursor < context.i_p2 {
+            break 'lab16;
+        }
+        let v_21 = env.limit_backward;
+        env.limit_backward = context.i_p2;
+        env.ket = env.cursor;
+        among_var = env.find_among_b(A_7, context);
+        if among_var == 0 {
+            env.limit_backward = v_21;
+            break 'lab16;
+        }
+        env.bra = env.cursor;
+        env.limit_backward = v_21;
+        if among_var == 1 {
+            let v_22 = env.limit - env.cursor;
+            'lab17: loop {
+                if !env.eq_s_b(&"po") {
+                    break 'lab17;
+                }
+                break 'lab16;
+            }
+            env.cursor = env.limit - v_22;
+        }
+        if !env.slice_del() {
+            return false;
+        }
+        break 'lab16;
+    }
+    env.cursor = env.limit - v_19;
+    'lab18: loop {
+        'lab19: loop {
+            if !context.b_ending_removed {
+                break 'lab19;
+            }
+            let v_24 = env.limit - env.cursor;
+            'lab20: loop {
+                if env.cursor < context.i_p1 {
+                    break 'lab20;
+                }
+                let v_26 = env.limit_backward;
+                env.limit_backward = context.i_p1;
+                env.ket = env.cursor;
+                if env.find_among_b(A_8, context) == 0 {
+                    env.limit_backward = v_26;
+                    break 'lab20;
+                }
+                env.bra = env.cursor;
+                env.limit_backward = v_26;
+                if !env.slice_del() {
+                    return false;
+                }
+                break 'lab20;
+            }
+            env.cursor = env.limit - v_24;
+            break 'lab18;
+        }
+        let v_27 = env.limit - env.cursor;
+        'lab21: loop {
+            if env.cursor < context.i_p1 {
+                break 'lab21;
+            }
+            let v_29 = env.limit_backward;
+            env.limit_backward = context.i_p1;
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"t") {
+                env.limit_backward = v_29;
+                break 'lab21;
+            }
+            env.bra = env.cursor;
+            let v_30 = env.limit - env.cursor;
+            if !env.in_grouping_b(G_V1, 97, 246) {
+                env.limit_backward = v_29;
+                break 'lab21;
+            }
+            env.cursor = env.limit - v_30;
+            if !env.slice_del() {
+                return false;
+            }
+            env.limit_backward = v_29;
+            if env.cursor < context.i_p2 {
+                break 'lab21;
+            }
+            let v_32 = env.limit_backward;
+            env.limit_backward = context.i_p2;
+            env.ket = env.cursor;
+            among_var = env.find_among_b(A_9, context);
+            if among_var == 0 {
+                env.limit_backward = v_32;
+                break 'lab21;
+            }
+            env.bra = env.cursor;
+            env.limit_backward = v_32;
+            if among_var == 1 {
+                let v_33 = env.limit - env.cursor;
+                'lab22: loop {
+                    if !env.eq_s_b(&"po") {
+                        break 'lab22;
+                    }
+                    break 'lab21;
+                }
+                env.cursor = env.limit - v_33;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+            break 'lab21;
+        }
+        env.cursor = env.limit - v_27;
+        break 'lab18;
+    }
+    let v_34 = env.limit - env.cursor;
+    'lab23: loop {
+        if env.cursor < context.i_p1 {
+            break 'lab23;
+        }
+        let v_36 = env.limit_backward;
+        env.limit_backward = context.i_p1;
+        let v_37 = env.limit - env.cursor;
+        'lab24: loop {
+            let v_38 = env.limit - env.cursor;
+            if !r_LONG(env, context) {
+                break 'lab24;
+            }
+            env.cursor = env.limit - v_38;
+            env.ket = env.cursor;
+            if env.cursor <= env.limit_backward {
+                break 'lab24;
+            }
+            env.previous_char();
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            break 'lab24;
+        }
+        env.cursor = env.limit - v_37;
+        let v_39 = env.limit - env.cursor;
+        'lab25: loop {
+            env.ket = env.cursor;
+            if !env.in_grouping_b(G_AEI, 97, 228) {
+                break 'lab25;
+            }
+            env.bra = env.cursor;
+            if !env.in_grouping_b(G_C, 98, 122) {
+                break 'lab25;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+            break 'lab25;
+        }
+        env.cursor = env.limit - v_39;
+        let v_40 = env.limit - env.cursor;
+        'lab26: loop {
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"j") {
+                break 'lab26;
+            }
+            env.bra = env.cursor;
+            'lab27: loop {
+                let v_41 = env.limit - env.cursor;
+                'lab28: loop {
+                    if !env.eq_s_b(&"o") {
+                        break 'lab28;
+                    }
+                    break 'lab27;
+                }
+                env.cursor = env.limit - v_41;
+                if !env.eq_s_b(&"u") {
+                    break 'lab26;
+                }
+                break 'lab27;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+            break 'lab26;
+        }
+        env.cursor = env.limit - v_40;
+        let v_42 = env.limit - env.cursor;
+        'lab29: loop {
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"o") {
+                break 'lab29;
+            }
+            env.bra = env.cursor;
+            if !env.eq_s_b(&"j") {
+                break 'lab29;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+            break 'lab29;
+        }
+        env.cursor = env.limit - v_42;
+        env.limit_backward = v_36;
+        'golab30: loop {
+            let v_43 = env.limit - env.cursor;
+            'lab31: loop {
+                if !env.out_grouping_b(G_V1, 97, 246) {
+                    break 'lab31;
+                }
+                env.cursor = env.limit - v_43;
+                break 'golab30;
+            }
+            env.cursor = env.limit - v_43;
+            if env.cursor <= env.limit_backward {
+                break 'lab23;
+            }
+            env.previous_char();
+        }
+        env.ket = env.cursor;
+        if !env.in_grouping_b(G_C, 98, 122) {
+            break 'lab23;
+        }
+        env.bra = env.cursor;
+        context.S_x = env.slice_to();
+        if context.S_x.is_empty() {
+            return false;
+        }
+        if !env.eq_s_b(&context.S_x) {
+            break 'lab23;
+        }
+        if !env.slice_del() {
+            return false;
+        }
+        break 'lab23;
+    }
+    env.cursor = env.limit - v_34;
+    env.cursor = env.limit_backward;
+    return true;
+}
@@ -0,0 +1,464 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+#![allow(non_snake_case)]
+#![allow(non_upper_case_globals)]
+#![allow(unused_mut)]
+#![allow(unused_parens)]
+#![allow(unused_variables)]
+use snowball::SnowballEnv;
+use snowball::Among;
+
+static A_0: &'static [Among<Context>; 6] = &[
+    Among("", -1, 5, None),
+    Among("U", 0, 2, None),
+    Among("Y", 0, 1, None),
+    Among("\u{00E4}", 0, 3, None),
+    Among("\u{00F6}", 0, 4, None),
+    Among("\u{00FC}", 0, 2, None),
+];
+
+static A_1: &'static [Among<Context>; 7] = &[
+    Among("e", -1, 2, None),
+    Among("em", -1, 1, None),
+    Among("en", -1, 2, None),
+    Among("ern", -1, 1, None),
+    Among("er", -1, 1, None),
+    Among("s", -1, 3, None),
+    Among("es", 5, 2, None),
+];
+
+static A_2: &'static [Among<Context>; 4] = &[
+    Among("en", -1, 1, None),
+    Among("er", -1, 1, None),
+    Among("st", -1, 2, None),
+    Among("est", 2, 1, None),
+];
+
+static A_3: &'static [Among<Context>; 2] = &[
+    Among("ig", -1, 1, None),
+    Among("lich", -1, 1, None),
+];
+
+static A_4: &'static [Among<Context>; 8] = &[
+    Among("end", -1, 1, None),
+    Among("ig", -1, 2, None),
+    Among("ung", -1, 1, None),
+    Among("lich", -1, 3, None),
+    Among("isch", -1, 2, None),
+    Among("ik", -1, 2, None),
+    Among("heit", -1, 3, None),
+    Among("keit", -1, 4, None),
+];
+
+static G_v: &'static [u8; 20] = &[17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32, 8];
+
+static G_s_ending: &'static [u8; 3] = &[117, 30, 5];
+
+static G_st_ending: &'static [u8; 3] = &[117, 30, 4];
+
+#[derive(Clone)]
+struct Context {
+    i_x: i32,
+    i_p2: i32,
+    i_p1: i32,
+}
+
+pub fn stem(env: &mut SnowballEnv) -> bool {
+    let mut context = &mut Context {
+        i_x: 0,
+        i_p2: 0,
+        i_p1: 0,
+    };
+    let mut among_var;
+    let v_1 = env.cursor;
+    'lab0: loop {
+        let v_2 = env.cursor;
+        'replab1: loop{
+            let v_3 = env.cursor;
+            'lab2: for _ in 0..1 {
+                'lab3: loop {
+                    let v_4 = env.cursor;
+                    'lab4: loop {
+                        env.bra = env.cursor;
+                        if !env.eq_s(&"\u{00DF}") {
+                            break 'lab4;
+                        }
+                        env.ket = env.cursor;
+                        if !env.slice_from("ss") {
+                            return false;
+                        }
+                        break 'lab3;
+                    }
+                    env.cursor = v_4;
+                    if env.cursor >= env.limit {
+                        break 'lab2;
+                    }
+                    env.next_char();
+                    break 'lab3;
+                }
+                continue 'replab1;
+            }
+            env.cursor = v_3;
+            break 'replab1;
+        }
+        env.cursor = v_2;
+        'replab5: loop{
+            let v_5 = env.cursor;
+            'lab6: for _ in 0..1 {
+                'golab7: loop {
+                    let v_6 = env.cursor;
+                    'lab8: loop {
+                        if !env.in_grouping(G_v, 97, 252) {
+                            break 'lab8;
+                        }
+                        env.bra = env.cursor;
+                        'lab9: loop {
+                            let v_7 = env.cursor;
+                            'lab10: loop {
+                                if !env.eq_s(&"u") {
+                                    break 'lab10;
+                                }
+                                env.ket = env.cursor;
+                                if !env.in_grouping(G_v, 97, 252) {
+                                    break 'lab10;
+                                }
+                                if !env.slice_from("U") {
+                                    return false;
+                                }
+                                break 'lab9;
+                            }
+                            env.cursor = v_7;
+                            if !env.eq_s(&"y") {
+                                break 'lab8;
+                            }
+                            env.ket = env.cursor;
+                            if !env.in_grouping(G_v, 97, 252) {
+                                break 'lab8;
+                            }
+                            if !env.slice_from("Y") {
+                                return false;
+                            }
+                            break 'lab9;
+                        }
+                        env.cursor = v_6;
+                        break 'golab7;
+                    }
+                    env.cursor = v_6;
+                    if env.cursor >= env.limit {
+                        break 'lab6;
+                    }
+                    env.next_char();
+                }
+                continue 'replab5;
+            }
+            env.cursor = v_5;
+            break 'replab5;
+        }
+        break 'lab0;
+    }
+    env.cursor = v_1;
+    let v_8 = env.cursor;
+    'lab11: loop {
+        context.i_p1 = env.limit;
+        context.i_p2 = env.limit;
+        let v_9 = env.cursor;
+        if !env.hop(3) {
+            break 'lab11;
+        }
+        context.i_x = env.cursor;
+        env.cursor = v_9;
+        'golab12: loop {
+            'lab13: loop {
+                if !env.in_grouping(G_v, 97, 252) {
+                    break 'lab13;
+                }
+                break 'golab12;
+            }
+            if env.cursor >= env.limit {
+                break 'lab11;
+            }
+            env.next_char();
+        }
+        'golab14: loop {
+            'lab15: loop {
+                if !env.out_grouping(G_v, 97, 252) {
+                    break 'lab15;
+                }
+                break 'golab14;
+            }
+            if env.cursor >= env.limit {
+                break 'lab11;
+            }
+            env.next_char();
+        }
+        context.i_p1 = env.cursor;
+        'lab16: loop {
+            if !(context.i_p1 < context.i_x){
+                break 'lab16;
+            }
+            context.i_p1 = context.i_x;
+            break 'lab16;
+        }
+        'golab17: loop {
+            'lab18: loop {
+                if !env.in_grouping(G_v, 97, 252) {
+                    break 'lab18;
+                }
+                break 'golab17;
+            }
+            if env.cursor >= env.limit {
+                break 'lab11;
+            }
+            env.next_char();
+        }
+        'golab19: loop {
+            'lab20: loop {
+                if !env.out_grouping(G_v, 97, 252) {
+                    break 'lab20;
+                }
+                break 'golab19;
+            }
+            if env.cursor >= env.limit {
+                break 'lab11;
+            }
+            env.next_char();
+        }
+        context.i_p2 = env.cursor;
+        break 'lab11;
+    }
+    env.cursor = v_8;
+    env.limit_backward = env.cursor;
+    env.cursor = env.limit;
+    'lab21: loop {
+        let v_16 = env.limit - env.cursor;
+        'lab22: loop {
+            env.ket = env.cursor;
+            among_var = env.find_among_b(A_1, context);
+            if among_var == 0 {
+                break 'lab22;
+            }
+            env.bra = env.cursor;
+            if !(context.i_p1 <= env.cursor){
+                break 'lab22;
+            }
+            if among_var == 1 {
+                if !env.slice_del() {
+                    return false;
+                }
+            } else if among_var == 2 {
+                if !env.slice_del() {
+                    return false;
+                }
+                let v_17 = env.limit - env.cursor;
+                'lab23: loop {
+                    env.ket = env.cursor;
+                    if !env.eq_s_b(&"s") {
+                        env.cursor = env.limit - v_17;
+                        break 'lab23;
+                    }
+                    env.bra = env.cursor;
+                    if !env.eq_s_b(&"nis") {
+                        env.cursor = env.limit - v_17;
+                        break 'lab23;
+                    }
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    break 'lab23;
+                }
+            } else if among_var == 3 {
+                if !env.in_grouping_b(G_s_ending, 98, 116) {
+                    break 'lab22;
+                }
+                if !env.slice_del() {
+                    return false;
+                }
+            }
+            break 'lab22;
+        }
+        env.cursor = env.limit - v_16;
+        let v_18 = env.limit - env.cursor;
+        'lab24: loop {
+            env.ket = env.cursor;
+            among_var = env.find_among_b(A_2, context);
+            if among_var == 0 {
+                break 'lab24;
+            }
+            env.bra = env.cursor;
+            if !(context.i_p1 <= env.cursor){
+                break 'lab24;
+            }
+            if among_var == 1 {
+                if !env.slice_del() {
+                    return false;
+                }
+            } else if among_var == 2 {
+                if !env.in_grouping_b(G_st_ending, 98, 116) {
+                    break 'lab24;
+                }
+                if !env.hop_back(3) {
+                    break 'lab24;
+                }
+                if !env.slice_del() {
+                    return false;
+                }
+            }
+            break 'lab24;
+        }
+        env.cursor = env.limit - v_18;
+        let v_19 = env.limit - env.cursor;
+        'lab25: loop {
+            env.ket = env.cursor;
+            among_var = env.find_among_b(A_4, context);
+            if among_var == 0 {
+                break 'lab25;
+            }
+            env.bra = env.cursor;
+            if !(context.i_p2 <= env.cursor){
+                break 'lab25;
+            }
+            if among_var == 1 {
+                if !env.slice_del() {
+                    return false;
+                }
+                let v_20 = env.limit - env.cursor;
+                'lab26: loop {
+                    env.ket = env.cursor;
+                    if !env.eq_s_b(&"ig") {
+                        env.cursor = env.limit - v_20;
+                        break 'lab26;
+                    }
+                    env.bra = env.cursor;
+                    let v_21 = env.limit - env.cursor;
+                    'lab27: loop {
+                        if !env.eq_s_b(&"e") {
+                            break 'lab27;
+                        }
+                        env.cursor = env.limit - v_20;
+                        break 'lab26;
+                    }
+                    env.cursor = env.limit - v_21;
+                    if !(context.i_p2 <= env.cursor){
+                        env.cursor = env.limit - v_20;
+                        break 'lab26;
+                    }
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    break 'lab26;
+                }
+            } else if among_var == 2 {
+                let v_22 = env.limit - env.cursor;
+                'lab28: loop {
+                    if !env.eq_s_b(&"e") {
+                        break 'lab28;
+                    }
+                    break 'lab25;
+                }
+                env.cursor = env.limit - v_22;
+                if !env.slice_del() {
+                    return false;
+                }
+            } else if among_var == 3 {
+                if !env.slice_del() {
+                    return false;
+                }
+                let v_23 = env.limit - env.cursor;
+                'lab29: loop {
+                    env.ket = env.cursor;
+                    'lab30: loop {
+                        let v_24 = env.limit - env.cursor;
+                        'lab31: loop {
+                            if !env.eq_s_b(&"er") {
+                                break 'lab31;
+                            }
+                            break 'lab30;
+                        }
+                        env.cursor = env.limit - v_24;
+                        if !env.eq_s_b(&"en") {
+                            env.cursor = env.limit - v_23;
+                            break 'lab29;
+                        }
+                        break 'lab30;
+                    }
+                    env.bra = env.cursor;
+                    if !(context.i_p1 <= env.cursor){
+                        env.cursor = env.limit - v_23;
+                        break 'lab29;
+                    }
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    break 'lab29;
+                }
+            } else if among_var == 4 {
+                if !env.slice_del() {
+                    return false;
+                }
+                let v_25 = env.limit - env.cursor;
+                'lab32: loop {
+                    env.ket = env.cursor;
+                    if env.find_among_b(A_3, context) == 0 {
+                        env.cursor = env.limit - v_25;
+                        break 'lab32;
+                    }
+                    env.bra = env.cursor;
+                    if !(context.i_p2 <= env.cursor){
+                        env.cursor = env.limit - v_25;
+                        break 'lab32;
+                    }
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    break 'lab32;
+                }
+            }
+            break 'lab25;
+        }
+        env.cursor = env.limit - v_19;
+        break 'lab21;
+    }
+    env.cursor = env.limit_backward;
+    let v_26 = env.cursor;
+    'lab33: loop {
+        'replab34: loop{
+            let v_27 = env.cursor;
+            'lab35: for _ in 0..1 {
+                env.bra = env.cursor;
+                among_var = env.find_among(A_0, context);
+                if among_var == 0 {
+                    break 'lab35;
+                }
+                env.ket = env.cursor;
+                if among_var == 1 {
+                    if !env.slice_from("y") {
+                        return false;
+                    }
+                } else if among_var == 2 {
+                    if !env.slice_from("u") {
+                        return false;
+                    }
+                } else if among_var == 3 {
+                    if !env.slice_from("a") {
+                        return false;
+                    }
+                } else if among_var == 4 {
+                    if !env.slice_from("o") {
+                        return false;
+                    }
+                } else if among_var == 5 {
+                    if env.cursor >= env.limit {
+                        break 'lab35;
+                    }
+                    env.next_char();
+                }
+                continue 'replab34;
+            }
+            env.cursor = v_27;
+            break 'replab34;
+        }
+        break 'lab33;
+    }
+    env.cursor = v_26;
+    return true;
+}
@@ -0,0 +1,2467 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+#![allow(non_snake_case)]
+#![allow(non_upper_case_globals)]
+#![allow(unused_mut)]
+#![allow(unused_parens)]
+#![allow(unused_variables)]
+use snowball::SnowballEnv;
+use snowball::Among;
+
+static A_0: &'static [Among<Context>; 46] = &[
+    Among("", -1, 25, None),
+    Among("\u{03C2}", 0, 18, None),
+    Among("\u{0386}", 0, 1, None),
+    Among("\u{0388}", 0, 5, None),
+    Among("\u{0389}", 0, 7, None),
+    Among("\u{038A}", 0, 9, None),
+    Among("\u{03CA}", 0, 7, None),
+    Among("\u{03CB}", 0, 20, None),
+    Among("\u{038C}", 0, 15, None),
+    Among("\u{03CC}", 0, 15, None),
+    Among("\u{03CD}", 0, 20, None),
+    Among("\u{038E}", 0, 20, None),
+    Among("\u{03CE}", 0, 24, None),
+    Among("\u{038F}", 0, 24, None),
+    Among("\u{0390}", 0, 7, None),
+    Among("\u{0391}", 0, 1, None),
+    Among("\u{0392}", 0, 2, None),
+    Among("\u{0393}", 0, 3, None),
+    Among("\u{0394}", 0, 4, None),
+    Among("\u{0395}", 0, 5, None),
+    Among("\u{0396}", 0, 6, None),
+    Among("\u{0397}", 0, 7, None),
+    Among("\u{0398}", 0, 8, None),
+    Among("\u{0399}", 0, 9, None),
+    Among("\u{039A}", 0, 10, None),
+    Among("\u{039B}", 0, 11, None),
+    Among("\u{039C}", 0, 12, None),
+    Among("\u{039D}", 0, 13, None),
+    Among("\u{039E}", 0, 14, None),
+    Among("\u{039F}", 0, 15, None),
+    Among("\u{03A0}", 0, 16, None),
+    Among("\u{03A1}", 0, 17, None),
+    Among("\u{03A3}", 0, 18, None),
+    Among("\u{03A4}", 0, 19, None),
+    Among("\u{03A5}", 0, 20, None),
+    Among("\u{03A6}", 0, 21, None),
+    Among("\u{03A7}", 0, 22, None),
+    Among("\u{03A8}", 0, 23, None),
+    Among("\u{03A9}", 0, 24, None),
+    Among("\u{03AA}", 0, 9, None),
+    Among("\u{03AB}", 0, 20, None),
+    Among("\u{03AC}", 0, 1, None),
+    Among("\u{03AD}", 0, 5, None),
+    Among("\u{03AE}", 0, 7, None),
+    Among("\u{03AF}", 0, 9, None),
+    Among("\u{03B0}", 0, 20, None),
+];
+
+static A_1: &'static [Among<Context>; 40] = &[
+    Among("\u{03BA}\u{03B1}\u{03B8}\u{03B5}\u{03C3}\u{03C4}\u{03C9}\u{03C3}", -1, 10, None),
+    Among("\u{03C6}\u{03C9}\u{03C3}", -1, 9, None),
+    Among("\u{03C0}\u{03B5}\u{03C1}\u{03B1}\u{03C3}", -1, 7, None),
+    Among("\u{03C4}\u{03B5}\u{03C1}\u{03B1}\u{03C3}", -1, 8, None),
+    Among("\u{03BA}\u{03C1}\u{03B5}\u{03B1}\u{03C3}", -1, 6, None),
+    Among("\u{03BA}\u{03B1}\u{03B8}\u{03B5}\u{03C3}\u{03C4}\u{03C9}\u{03C4}\u{03BF}\u{03C3}", -1, 10, None),
+    Among("\u{03C6}\u{03C9}\u{03C4}\u{03BF}\u{03C3}", -1, 9, None),
+    Among("\u{03C0}\u{03B5}\u{03C1}\u{03B1}\u{03C4}\u{03BF}\u{03C3}", -1, 7, None),
+    Among("\u{03C4}\u{03B5}\u{03C1}\u{03B1}\u{03C4}\u{03BF}\u{03C3}", -1, 8, None),
+    Among("\u{03BA}\u{03C1}\u{03B5}\u{03B1}\u{03C4}\u{03BF}\u{03C3}", -1, 6, None),
+    Among("\u{03B3}\u{03B5}\u{03B3}\u{03BF}\u{03BD}\u{03BF}\u{03C4}\u{03BF}\u{03C3}", -1, 11, None),
+    Among("\u{03B3}\u{03B5}\u{03B3}\u{03BF}\u{03BD}\u{03BF}\u{03C3}", -1, 11, None),
+    Among("\u{03C6}\u{03B1}\u{03B3}\u{03B9}\u{03BF}\u{03C5}", -1, 1, None),
+    Among("\u{03C3}\u{03BA}\u{03B1}\u{03B3}\u{03B9}\u{03BF}\u{03C5}", -1, 2, None),
+    Among("\u{03C3}\u{03BF}\u{03B3}\u{03B9}\u{03BF}\u{03C5}", -1, 4, None),
+    Among("\u{03C4}\u{03B1}\u{03C4}\u{03BF}\u{03B3}\u{03B9}\u{03BF}\u{03C5}", -1, 5, None),
+    Among("\u{03BF}\u{03BB}\u{03BF}\u{03B3}\u{03B9}\u{03BF}\u{03C5}", -1, 3, None),
+    Among("\u{03BA}\u{03B1}\u{03B8}\u{03B5}\u{03C3}\u{03C4}\u{03C9}\u{03C4}\u{03B1}", -1, 10, None),
+    Among("\u{03C6}\u{03C9}\u{03C4}\u{03B1}", -1, 9, None),
+    Among("\u{03C0}\u{03B5}\u{03C1}\u{03B1}\u{03C4}\u{03B1}", -1, 7, None),
+    Among("\u{03C4}\u{03B5}\u{03C1}\u{03B1}\u{03C4}\u{03B1}", -1, 8, None),
+    Among("\u{03BA}\u{03C1}\u{03B5}\u{03B1}\u{03C4}\u{03B1}", -1, 6, None),
+    Among("\u{03B3}\u{03B5}\u{03B3}\u{03BF}\u{03BD}\u{03BF}\u{03C4}\u{03B1}", -1, 11, None),
+    Among("\u{03C6}\u{03B1}\u{03B3}\u{03B9}\u{03B1}", -1, 1, None),
+    Among("\u{03C3}\u{03BA}\u{03B1}\u{03B3}\u{03B9}\u{03B1}", -1, 2, None),
+    Among("\u{03C3}\u{03BF}\u{03B3}\u{03B9}\u{03B1}", -1, 4, None),
+    Among("\u{03C4}\u{03B1}\u{03C4}\u{03BF}\u{03B3}\u{03B9}\u{03B1}", -1, 5, None),
+    Among("\u{03BF}\u{03BB}\u{03BF}\u{03B3}\u{03B9}\u{03B1}", -1, 3, None),
+    Among("\u{03C0}\u{03B5}\u{03C1}\u{03B1}\u{03C4}\u{03B7}", -1, 7, None),
+    Among("\u{03BA}\u{03B1}\u{03B8}\u{03B5}\u{03C3}\u{03C4}\u{03C9}\u{03C4}\u{03C9}\u{03BD}", -1, 10, None),
+    Among("\u{03C6}\u{03C9}\u{03C4}\u{03C9}\u{03BD}", -1, 9, None),
+    Among("\u{03C0}\u{03B5}\u{03C1}\u{03B1}\u{03C4}\u{03C9}\u{03BD}", -1, 7, None),
+    Among("\u{03C4}\u{03B5}\u{03C1}\u{03B1}\u{03C4}\u{03C9}\u{03BD}", -1, 8, None),
+    Among("\u{03BA}\u{03C1}\u{03B5}\u{03B1}\u{03C4}\u{03C9}\u{03BD}", -1, 6, None),
+    Among("\u{03B3}\u{03B5}\u{03B3}\u{03BF}\u{03BD}\u{03BF}\u{03C4}\u{03C9}\u{03BD}", -1, 11, None),
+    Among("\u{03C6}\u{03B1}\u{03B3}\u{03B9}\u{03C9}\u{03BD}", -1, 1, None),
+    Among("\u{03C3}\u{03BA}\u{03B1}\u{03B3}\u{03B9}\u{03C9}\u{03BD}", -1, 2, None),
+    Among("\u{03C3}\u{03BF}\u{03B3}\u{03B9}\u{03C9}\u{03BD}", -1, 4, None),
+    Among("\u{03C4}\u{03B1}\u{03C4}\u{03BF}\u{03B3}\u{03B9}\u{03C9}\u{03BD}", -1, 5, None),
+    Among("\u{03BF}\u{03BB}\u{03BF}\u{03B3}\u{03B9}\u{03C9}\u{03BD}", -1, 3, None),
+];
+
+static A_2: &'static [Among<Context>; 31] = &[
+    Among("\u{03C0}", -1, 2, None),
+    Among("\u{03B9}\u{03BC}\u{03C0}", 0, 2, None),
+    Among("\u{03C1}", -1, 2, None),
+    Among("\u{03C0}\u{03C1}", 2, 2, None),
+    Among("\u{03BC}\u{03C0}\u{03C1}", 3, 2, None),
+    Among("\u{03B1}\u{03C1}\u{03C1}", 2, 2, None),
+    Among("\u{03B3}\u{03BB}\u{03C5}\u{03BA}\u{03C5}\u{03C1}", 2, 2, None),
+    Among("\u{03C0}\u{03BF}\u{03BB}\u{03C5}\u{03C1}", 2, 2, None),
+    Among("\u{03B1}\u{03BC}\u{03C0}\u{03B1}\u{03C1}", 2, 2, None),
+    Among("\u{03BC}\u{03B1}\u{03C1}", 2, 2, None),
+    Among("\u{03B3}\u{03BA}\u{03C1}", 2, 2, None),
+    Among("\u{03C0}\u{03B9}\u{03C0}\u{03B5}\u{03C1}\u{03BF}\u{03C1}", 2, 2, None),
+    Among("\u{03B2}\u{03BF}\u{03BB}\u{03B2}\u{03BF}\u{03C1}", 2, 2, None),
+    Among("\u{03B3}\u{03BB}\u{03C5}\u{03BA}\u{03BF}\u{03C1}", 2, 2, None),
+    Among("\u{03BB}\u{03BF}\u{03C5}", -1, 2, None),
+    Among("\u{03C0}\u{03B1}", -1, 1, None),
+    Among("\u{03BE}\u{03B1}\u{03BD}\u{03B1}\u{03C0}\u{03B1}", 15, 1, None),
+    Among("\u{03B5}\u{03C0}\u{03B1}", 15, 1, None),
+    Among("\u{03C0}\u{03B5}\u{03C1}\u{03B9}\u{03C0}\u{03B1}", 15, 1, None),
+    Among("\u{03B1}\u{03BD}\u{03B1}\u{03BC}\u{03C0}\u{03B1}", 15, 1, None),
+    Among("\u{03B5}\u{03BC}\u{03C0}\u{03B1}", 15, 1, None),
+    Among("\u{03B2}", -1, 2, None),
+    Among("\u{03B4}\u{03B1}\u{03BD}\u{03B5}", -1, 1, None),
+    Among("\u{03B2}\u{03B1}\u{03B8}\u{03C5}\u{03C1}\u{03B9}", -1, 2, None),
+    Among("\u{03B2}\u{03B1}\u{03C1}\u{03BA}", -1, 2, None),
+    Among("\u{03BC}\u{03B1}\u{03C1}\u{03BA}", -1, 2, None),
+    Among("\u{03BB}", -1, 2, None),
+    Among("\u{03BC}", -1, 2, None),
+    Among("\u{03BA}\u{03BF}\u{03C1}\u{03BD}", -1, 2, None),
+    Among("\u{03B1}\u{03B8}\u{03C1}\u{03BF}", -1, 1, None),
+    Among("\u{03C3}\u{03C5}\u{03BD}\u{03B1}\u{03B8}\u{03C1}\u{03BF}", 29, 1, None),
+];
+
+static A_3: &'static [Among<Context>; 14] = &[
+    Among("\u{03B9}\u{03B6}\u{03B5}\u{03C3}", -1, 1, None),
+    Among("\u{03B9}\u{03B6}\u{03B5}\u{03B9}\u{03C3}", -1, 1, None),
+    Among("\u{03B9}\u{03B6}\u{03C9}", -1, 1, None),
+    Among("\u{03B9}\u{03B6}\u{03B1}", -1, 1, None),
+    Among("\u{03B9}\u{03B6}\u{03B1}\u{03C4}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03B6}\u{03B5}\u{03C4}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03B6}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03B6}\u{03BF}\u{03C5}\u{03BC}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03B6}\u{03B1}\u{03BC}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03B6}\u{03BF}\u{03C5}\u{03BD}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03B6}\u{03B1}\u{03BD}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03B6}\u{03B5}\u{03B9}", -1, 1, None),
+    Among("\u{03B9}\u{03B6}\u{03BF}\u{03C5}\u{03BD}", -1, 1, None),
+    Among("\u{03B9}\u{03B6}\u{03B1}\u{03BD}", -1, 1, None),
+];
+
+static A_4: &'static [Among<Context>; 8] = &[
+    Among("\u{03C3}", -1, 1, None),
+    Among("\u{03C7}", -1, 1, None),
+    Among("\u{03C5}\u{03C8}", -1, 1, None),
+    Among("\u{03B6}\u{03C9}", -1, 1, None),
+    Among("\u{03B2}\u{03B9}", -1, 1, None),
+    Among("\u{03BB}\u{03B9}", -1, 1, None),
+    Among("\u{03B1}\u{03BB}", -1, 1, None),
+    Among("\u{03B5}\u{03BD}", -1, 1, None),
+];
+
+static A_5: &'static [Among<Context>; 7] = &[
+    Among("\u{03C9}\u{03B8}\u{03B7}\u{03BA}\u{03B5}\u{03C3}", -1, 1, None),
+    Among("\u{03C9}\u{03B8}\u{03B7}\u{03BA}\u{03B1}", -1, 1, None),
+    Among("\u{03C9}\u{03B8}\u{03B7}\u{03BA}\u{03B1}\u{03C4}\u{03B5}", -1, 1, None),
+    Among("\u{03C9}\u{03B8}\u{03B7}\u{03BA}\u{03B5}", -1, 1, None),
+    Among("\u{03C9}\u{03B8}\u{03B7}\u{03BA}\u{03B1}\u{03BC}\u{03B5}", -1, 1, None),
+    Among("\u{03C9}\u{03B8}\u{03B7}\u{03BA}\u{03B1}\u{03BD}\u{03B5}", -1, 1, None),
+    Among("\u{03C9}\u{03B8}\u{03B7}\u{03BA}\u{03B1}\u{03BD}", -1, 1, None),
+];
+
+static A_6: &'static [Among<Context>; 32] = &[
+    Among("\u{03C0}", -1, 2, None),
+    Among("\u{03BB}\u{03B1}\u{03C1}", -1, 2, None),
+    Among("\u{03B4}\u{03B7}\u{03BC}\u{03BF}\u{03BA}\u{03C1}\u{03B1}\u{03C4}", -1, 2, None),
+    Among("\u{03B1}\u{03C6}", -1, 2, None),
+    Among("\u{03B3}\u{03B9}\u{03B3}\u{03B1}\u{03BD}\u{03C4}\u{03BF}\u{03B1}\u{03C6}", 3, 2, None),
+    Among("\u{03BE}\u{03B1}\u{03BD}\u{03B1}\u{03C0}\u{03B1}", -1, 1, None),
+    Among("\u{03B5}\u{03C0}\u{03B1}", -1, 1, None),
+    Among("\u{03C0}\u{03B5}\u{03C1}\u{03B9}\u{03C0}\u{03B1}", -1, 1, None),
+    Among("\u{03B1}\u{03BD}\u{03B1}\u{03BC}\u{03C0}\u{03B1}", -1, 1, None),
+    Among("\u{03B5}\u{03BC}\u{03C0}\u{03B1}", -1, 1, None),
+    Among("\u{03C7}\u{03B1}\u{03C1}\u{03C4}\u{03BF}\u{03C0}\u{03B1}", -1, 1, None),
+    Among("\u{03B5}\u{03BE}\u{03B1}\u{03C1}\u{03C7}\u{03B1}", -1, 1, None),
+    Among("\u{03C0}\u{03B5}", -1, 1, None),
+    Among("\u{03B5}\u{03C0}\u{03B5}", 12, 1, None),
+    Among("\u{03BC}\u{03B5}\u{03C4}\u{03B5}\u{03C0}\u{03B5}", 13, 1, None),
+    Among("\u{03B5}\u{03C3}\u{03B5}", -1, 1, None),
+    Among("\u{03B3}\u{03B5}", -1, 2, None),
+    Among("\u{03B3}\u{03BA}\u{03B5}", -1, 2, None),
+    Among("\u{03BA}\u{03BB}\u{03B5}", -1, 1, None),
+    Among("\u{03B5}\u{03C3}\u{03C9}\u{03BA}\u{03BB}\u{03B5}", 18, 1, None),
+    Among("\u{03B5}\u{03BA}\u{03BB}\u{03B5}", 18, 1, None),
+    Among("\u{03B1}\u{03C0}\u{03B5}\u{03BA}\u{03BB}\u{03B5}", 20, 1, None),
+    Among("\u{03B1}\u{03C0}\u{03BF}\u{03BA}\u{03BB}\u{03B5}", 18, 1, None),
+    Among("\u{03B4}\u{03B1}\u{03BD}\u{03B5}", -1, 1, None),
+    Among("\u{03B3}\u{03BA}", -1, 2, None),
+    Among("\u{03BC}", -1, 2, None),
+    Among("\u{03C0}\u{03BF}\u{03C5}\u{03BA}\u{03B1}\u{03BC}", 25, 2, None),
+    Among("\u{03BA}\u{03BF}\u{03BC}", 25, 2, None),
+    Among("\u{03B1}\u{03BD}", -1, 2, None),
+    Among("\u{03B1}\u{03B8}\u{03C1}\u{03BF}", -1, 1, None),
+    Among("\u{03C3}\u{03C5}\u{03BD}\u{03B1}\u{03B8}\u{03C1}\u{03BF}", 29, 1, None),
+    Among("\u{03BF}\u{03BB}\u{03BF}", -1, 2, None),
+];
+
+static A_7: &'static [Among<Context>; 7] = &[
+    Among("\u{03B9}\u{03C3}\u{03B5}\u{03C3}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03B1}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03B1}\u{03C4}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03B1}\u{03BC}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03B1}\u{03BD}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03B1}\u{03BD}", -1, 1, None),
+];
+
+static A_8: &'static [Among<Context>; 19] = &[
+    Among("\u{03BE}\u{03B1}\u{03BD}\u{03B1}\u{03C0}\u{03B1}", -1, 1, None),
+    Among("\u{03B5}\u{03C0}\u{03B1}", -1, 1, None),
+    Among("\u{03C0}\u{03B5}\u{03C1}\u{03B9}\u{03C0}\u{03B1}", -1, 1, None),
+    Among("\u{03B1}\u{03BD}\u{03B1}\u{03BC}\u{03C0}\u{03B1}", -1, 1, None),
+    Among("\u{03B5}\u{03BC}\u{03C0}\u{03B1}", -1, 1, None),
+    Among("\u{03C7}\u{03B1}\u{03C1}\u{03C4}\u{03BF}\u{03C0}\u{03B1}", -1, 1, None),
+    Among("\u{03B5}\u{03BE}\u{03B1}\u{03C1}\u{03C7}\u{03B1}", -1, 1, None),
+    Among("\u{03C0}\u{03B5}", -1, 1, None),
+    Among("\u{03B5}\u{03C0}\u{03B5}", 7, 1, None),
+    Among("\u{03BC}\u{03B5}\u{03C4}\u{03B5}\u{03C0}\u{03B5}", 8, 1, None),
+    Among("\u{03B5}\u{03C3}\u{03B5}", -1, 1, None),
+    Among("\u{03BA}\u{03BB}\u{03B5}", -1, 1, None),
+    Among("\u{03B5}\u{03C3}\u{03C9}\u{03BA}\u{03BB}\u{03B5}", 11, 1, None),
+    Among("\u{03B5}\u{03BA}\u{03BB}\u{03B5}", 11, 1, None),
+    Among("\u{03B1}\u{03C0}\u{03B5}\u{03BA}\u{03BB}\u{03B5}", 13, 1, None),
+    Among("\u{03B1}\u{03C0}\u{03BF}\u{03BA}\u{03BB}\u{03B5}", 11, 1, None),
+    Among("\u{03B4}\u{03B1}\u{03BD}\u{03B5}", -1, 1, None),
+    Among("\u{03B1}\u{03B8}\u{03C1}\u{03BF}", -1, 1, None),
+    Among("\u{03C3}\u{03C5}\u{03BD}\u{03B1}\u{03B8}\u{03C1}\u{03BF}", 17, 1, None),
+];
+
+static A_9: &'static [Among<Context>; 7] = &[
+    Among("\u{03B9}\u{03C3}\u{03B5}\u{03B9}\u{03C3}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03C9}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03B5}\u{03C4}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03BF}\u{03C5}\u{03BC}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03BF}\u{03C5}\u{03BD}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03B5}\u{03B9}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03BF}\u{03C5}\u{03BD}", -1, 1, None),
+];
+
+static A_10: &'static [Among<Context>; 40] = &[
+    Among("\u{03C0}", -1, 2, None),
+    Among("\u{03B5}\u{03C5}\u{03C0}", 0, 2, None),
+    Among("\u{03B1}\u{03C0}", 0, 2, None),
+    Among("\u{03B5}\u{03BC}\u{03C0}", 0, 2, None),
+    Among("\u{03B3}\u{03C5}\u{03C1}", -1, 2, None),
+    Among("\u{03C7}\u{03C1}", -1, 2, None),
+    Among("\u{03C7}\u{03C9}\u{03C1}", -1, 2, None),
+    Among("\u{03B1}\u{03C1}", -1, 2, None),
+    Among("\u{03B1}\u{03BF}\u{03C1}", -1, 2, None),
+    Among("\u{03C7}\u{03C4}", -1, 2, None),
+    Among("\u{03B1}\u{03C7}\u{03C4}", 9, 2, None),
+    Among("\u{03BA}\u{03C4}", -1, 2, None),
+    Among("\u{03B1}\u{03BA}\u{03C4}", 11, 2, None),
+    Among("\u{03C3}\u{03C7}", -1, 2, None),
+    Among("\u{03B1}\u{03C3}\u{03C7}", 13, 2, None),
+    Among("\u{03C4}\u{03B1}\u{03C7}", -1, 2, None),
+    Among("\u{03C5}\u{03C8}", -1, 2, None),
+    Among("\u{03B1}\u{03C4}\u{03B1}", -1, 2, None),
+    Among("\u{03C6}\u{03B1}", -1, 2, None),
+    Among("\u{03B7}\u{03C6}\u{03B1}", 18, 2, None),
+    Among("\u{03BB}\u{03C5}\u{03B3}", -1, 2, None),
+    Among("\u{03BC}\u{03B5}\u{03B3}", -1, 2, None),
+    Among("\u{03B7}\u{03B4}", -1, 2, None),
+    Among("\u{03C3}\u{03B5}", -1, 1, None),
+    Among("\u{03B1}\u{03C3}\u{03B5}", 23, 1, None),
+    Among("\u{03C0}\u{03BB}\u{03B5}", -1, 1, None),
+    Among("\u{03BA}\u{03BB}\u{03B5}", -1, 1, None),
+    Among("\u{03B5}\u{03C3}\u{03C9}\u{03BA}\u{03BB}\u{03B5}", 26, 1, None),
+    Among("\u{03B4}\u{03B1}\u{03BD}\u{03B5}", -1, 1, None),
+    Among("\u{03B5}\u{03C7}\u{03B8}", -1, 2, None),
+    Among("\u{03BA}\u{03B1}\u{03B8}", -1, 2, None),
+    Among("\u{03C3}\u{03BA}", -1, 2, None),
+    Among("\u{03BA}\u{03B1}\u{03BA}", -1, 2, None),
+    Among("\u{03BC}\u{03B1}\u{03BA}", -1, 2, None),
+    Among("\u{03BA}\u{03C5}\u{03BB}", -1, 2, None),
+    Among("\u{03C6}\u{03B9}\u{03BB}", -1, 2, None),
+    Among("\u{03BC}", -1, 2, None),
+    Among("\u{03B3}\u{03B5}\u{03BC}", 36, 2, None),
+    Among("\u{03B1}\u{03C7}\u{03BD}", -1, 2, None),
+    Among("\u{03C3}\u{03C5}\u{03BD}\u{03B1}\u{03B8}\u{03C1}\u{03BF}", -1, 1, None),
+];
+
+static A_11: &'static [Among<Context>; 11] = &[
+    Among("\u{03B9}\u{03C3}\u{03C4}\u{03BF}\u{03C5}\u{03C3}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03C4}\u{03B5}\u{03C3}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03C4}\u{03B7}\u{03C3}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03C4}\u{03BF}\u{03C3}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03C4}\u{03BF}\u{03C5}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03C4}\u{03B1}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03C4}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03C4}\u{03B7}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03C4}\u{03BF}\u{03B9}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03C4}\u{03C9}\u{03BD}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03C4}\u{03BF}", -1, 1, None),
+];
+
+static A_12: &'static [Among<Context>; 7] = &[
+    Among("\u{03C3}\u{03B5}", -1, 1, None),
+    Among("\u{03BC}\u{03B5}\u{03C4}\u{03B1}\u{03C3}\u{03B5}", 0, 1, None),
+    Among("\u{03BC}\u{03B9}\u{03BA}\u{03C1}\u{03BF}\u{03C3}\u{03B5}", 0, 1, None),
+    Among("\u{03B5}\u{03B3}\u{03BA}\u{03BB}\u{03B5}", -1, 1, None),
+    Among("\u{03B1}\u{03C0}\u{03BF}\u{03BA}\u{03BB}\u{03B5}", -1, 1, None),
+    Among("\u{03B4}\u{03B1}\u{03BD}\u{03B5}", -1, 2, None),
+    Among("\u{03B1}\u{03BD}\u{03C4}\u{03B9}\u{03B4}\u{03B1}\u{03BD}\u{03B5}", 5, 2, None),
+];
+
+static A_13: &'static [Among<Context>; 10] = &[
+    Among("\u{03C4}\u{03BF}\u{03C0}\u{03B9}\u{03BA}", -1, 7, None),
+    Among("\u{03C3}\u{03BA}\u{03B5}\u{03C0}\u{03C4}\u{03B9}\u{03BA}", -1, 6, None),
+    Among("\u{03B3}\u{03BD}\u{03C9}\u{03C3}\u{03C4}\u{03B9}\u{03BA}", -1, 3, None),
+    Among("\u{03B1}\u{03B3}\u{03BD}\u{03C9}\u{03C3}\u{03C4}\u{03B9}\u{03BA}", 2, 1, None),
+    Among("\u{03B5}\u{03BA}\u{03BB}\u{03B5}\u{03BA}\u{03C4}\u{03B9}\u{03BA}", -1, 5, None),
+    Among("\u{03B1}\u{03C4}\u{03BF}\u{03BC}\u{03B9}\u{03BA}", -1, 2, None),
+    Among("\u{03B5}\u{03B8}\u{03BD}\u{03B9}\u{03BA}", -1, 4, None),
+    Among("\u{03B8}\u{03B5}\u{03B1}\u{03C4}\u{03C1}\u{03B9}\u{03BD}", -1, 10, None),
+    Among("\u{03B1}\u{03BB}\u{03B5}\u{03BE}\u{03B1}\u{03BD}\u{03B4}\u{03C1}\u{03B9}\u{03BD}", -1, 8, None),
+    Among("\u{03B2}\u{03C5}\u{03B6}\u{03B1}\u{03BD}\u{03C4}\u{03B9}\u{03BD}", -1, 9, None),
+];
+
+static A_14: &'static [Among<Context>; 6] = &[
+    Among("\u{03B9}\u{03C3}\u{03BC}\u{03BF}\u{03C5}\u{03C3}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03BC}\u{03BF}\u{03C3}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03BC}\u{03BF}\u{03C5}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03BC}\u{03BF}\u{03B9}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03BC}\u{03C9}\u{03BD}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03BC}\u{03BF}", -1, 1, None),
+];
+
+static A_15: &'static [Among<Context>; 2] = &[
+    Among("\u{03C3}", -1, 1, None),
+    Among("\u{03C7}", -1, 1, None),
+];
+
+static A_16: &'static [Among<Context>; 4] = &[
+    Among("\u{03B1}\u{03C1}\u{03B1}\u{03BA}\u{03B9}\u{03B1}", -1, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03B4}\u{03B1}\u{03BA}\u{03B9}\u{03B1}", -1, 1, None),
+    Among("\u{03B1}\u{03C1}\u{03B1}\u{03BA}\u{03B9}", -1, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03B4}\u{03B1}\u{03BA}\u{03B9}", -1, 1, None),
+];
+
+static A_17: &'static [Among<Context>; 46] = &[
+    Among("\u{03C0}", -1, 2, None),
+    Among("\u{03BA}\u{03B1}\u{03C4}\u{03C1}\u{03B1}\u{03C0}", 0, 1, None),
+    Among("\u{03C1}", -1, 1, None),
+    Among("\u{03B2}\u{03C1}", 2, 1, None),
+    Among("\u{03BB}\u{03B1}\u{03B2}\u{03C1}", 3, 1, None),
+    Among("\u{03B1}\u{03BC}\u{03B2}\u{03C1}", 3, 1, None),
+    Among("\u{03C0}\u{03B1}\u{03C4}\u{03B5}\u{03C1}", 2, 2, None),
+    Among("\u{03BC}\u{03B5}\u{03C1}", 2, 1, None),
+    Among("\u{03B1}\u{03BD}\u{03B8}\u{03C1}", 2, 1, None),
+    Among("\u{03BA}\u{03BF}\u{03C1}", 2, 1, None),
+    Among("\u{03C3}", -1, 1, None),
+    Among("\u{03BD}\u{03B1}\u{03B3}\u{03BA}\u{03B1}\u{03C3}", 10, 1, None),
+    Among("\u{03C4}\u{03BF}\u{03C3}", 10, 2, None),
+    Among("\u{03BC}\u{03BF}\u{03C5}\u{03C3}\u{03C4}", -1, 1, None),
+    Among("\u{03C1}\u{03C5}", -1, 1, None),
+    Among("\u{03C6}", -1, 1, None),
+    Among("\u{03C3}\u{03C6}", 15, 1, None),
+    Among("\u{03B1}\u{03BB}\u{03B9}\u{03C3}\u{03C6}", 16, 1, None),
+    Among("\u{03BD}\u{03C5}\u{03C6}", 15, 2, None),
+    Among("\u{03C7}", -1, 1, None),
+    Among("\u{03B2}", -1, 2, None),
+    Among("\u{03B2}\u{03B1}\u{03BC}\u{03B2}", 20, 1, None),
+    Among("\u{03C3}\u{03BB}\u{03BF}\u{03B2}", 20, 1, None),
+    Among("\u{03C4}\u{03C3}\u{03B5}\u{03C7}\u{03BF}\u{03C3}\u{03BB}\u{03BF}\u{03B2}", 22, 1, None),
+    Among("\u{03BA}\u{03B1}\u{03C1}\u{03B4}", -1, 2, None),
+    Among("\u{03B6}", -1, 2, None),
+    Among("\u{03C4}\u{03B6}", 25, 1, None),
+    Among("\u{03BA}", -1, 1, None),
+    Among("\u{03C3}\u{03BA}", 27, 1, None),
+    Among("\u{03BA}\u{03B1}\u{03C0}\u{03B1}\u{03BA}", 27, 1, None),
+    Among("\u{03C3}\u{03BF}\u{03BA}", 27, 1, None),
+    Among("\u{03C0}\u{03BB}", -1, 1, None),
+    Among("\u{03C6}\u{03C5}\u{03BB}", -1, 1, None),
+    Among("\u{03BB}\u{03BF}\u{03C5}\u{03BB}", -1, 1, None),
+    Among("\u{03B2}\u{03B1}\u{03BB}", -1, 2, None),
+    Among("\u{03BC}\u{03B1}\u{03BB}", -1, 1, None),
+    Among("\u{03B3}\u{03BB}", -1, 2, None),
+    Among("\u{03C4}\u{03C1}\u{03B9}\u{03C0}\u{03BF}\u{03BB}", -1, 2, None),
+    Among("\u{03C6}\u{03B1}\u{03C1}\u{03BC}", -1, 1, None),
+    Among("\u{03BA}\u{03B1}\u{03B9}\u{03BC}", -1, 1, None),
+    Among("\u{03BA}\u{03BB}\u{03B9}\u{03BC}", -1, 1, None),
+    Among("\u{03BC}\u{03B1}\u{03BA}\u{03C1}\u{03C5}\u{03BD}", -1, 2, None),
+    Among("\u{03C3}\u{03C0}\u{03B1}\u{03BD}", -1, 1, None),
+    Among("\u{03B3}\u{03B9}\u{03B1}\u{03BD}", -1, 2, None),
+    Among("\u{03B7}\u{03B3}\u{03BF}\u{03C5}\u{03BC}\u{03B5}\u{03BD}", -1, 2, None),
+    Among("\u{03BA}\u{03BF}\u{03BD}", -1, 1, None),
+];
+
+static A_18: &'static [Among<Context>; 8] = &[
+    Among("\u{03B9}\u{03C4}\u{03C3}\u{03B1}\u{03C3}", -1, 1, None),
+    Among("\u{03B9}\u{03C4}\u{03C3}\u{03B5}\u{03C3}", -1, 1, None),
+    Among("\u{03B9}\u{03C4}\u{03C3}\u{03B1}", -1, 1, None),
+    Among("\u{03B1}\u{03BA}\u{03B9}\u{03B1}", -1, 1, None),
+    Among("\u{03B1}\u{03C1}\u{03B1}\u{03BA}\u{03B9}\u{03B1}", 3, 1, None),
+    Among("\u{03B1}\u{03BA}\u{03B9}", -1, 1, None),
+    Among("\u{03B1}\u{03C1}\u{03B1}\u{03BA}\u{03B9}", 5, 1, None),
+    Among("\u{03B9}\u{03C4}\u{03C3}\u{03C9}\u{03BD}", -1, 1, None),
+];
+
+static A_19: &'static [Among<Context>; 4] = &[
+    Among("\u{03B9}\u{03C1}", -1, 1, None),
+    Among("\u{03C8}\u{03B1}\u{03BB}", -1, 1, None),
+    Among("\u{03B1}\u{03B9}\u{03C6}\u{03BD}", -1, 1, None),
+    Among("\u{03BF}\u{03BB}\u{03BF}", -1, 1, None),
+];
+
+static A_20: &'static [Among<Context>; 2] = &[
+    Among("\u{03B5}", -1, 1, None),
+    Among("\u{03C0}\u{03B1}\u{03B9}\u{03C7}\u{03BD}", -1, 1, None),
+];
+
+static A_21: &'static [Among<Context>; 3] = &[
+    Among("\u{03B9}\u{03B4}\u{03B9}\u{03B1}", -1, 1, None),
+    Among("\u{03B9}\u{03B4}\u{03B9}\u{03C9}\u{03BD}", -1, 1, None),
+    Among("\u{03B9}\u{03B4}\u{03B9}\u{03BF}", -1, 1, None),
+];
+
+static A_22: &'static [Among<Context>; 7] = &[
+    Among("\u{03C1}", -1, 1, None),
+    Among("\u{03B9}\u{03B2}", -1, 1, None),
+    Among("\u{03B4}", -1, 1, None),
+    Among("\u{03BB}\u{03C5}\u{03BA}", -1, 1, None),
+    Among("\u{03C6}\u{03C1}\u{03B1}\u{03B3}\u{03BA}", -1, 1, None),
+    Among("\u{03BF}\u{03B2}\u{03B5}\u{03BB}", -1, 1, None),
+    Among("\u{03BC}\u{03B7}\u{03BD}", -1, 1, None),
+];
+
+static A_23: &'static [Among<Context>; 4] = &[
+    Among("\u{03B9}\u{03C3}\u{03BA}\u{03BF}\u{03C3}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03BA}\u{03BF}\u{03C5}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03BA}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03C3}\u{03BA}\u{03BF}", -1, 1, None),
+];
+
+static A_24: &'static [Among<Context>; 2] = &[
+    Among("\u{03B1}\u{03B4}\u{03B5}\u{03C3}", -1, 1, None),
+    Among("\u{03B1}\u{03B4}\u{03C9}\u{03BD}", -1, 1, None),
+];
+
+static A_25: &'static [Among<Context>; 10] = &[
+    Among("\u{03BC}\u{03C0}\u{03B1}\u{03BC}\u{03C0}", -1, -1, None),
+    Among("\u{03BA}\u{03C5}\u{03C1}", -1, -1, None),
+    Among("\u{03C0}\u{03B1}\u{03C4}\u{03B5}\u{03C1}", -1, -1, None),
+    Among("\u{03C0}\u{03B5}\u{03B8}\u{03B5}\u{03C1}", -1, -1, None),
+    Among("\u{03BD}\u{03C4}\u{03B1}\u{03BD}\u{03C4}", -1, -1, None),
+    Among("\u{03B3}\u{03B9}\u{03B1}\u{03B3}\u{03B9}", -1, -1, None),
+    Among("\u{03B8}\u{03B5}\u{03B9}", -1, -1, None),
+    Among("\u{03BF}\u{03BA}", -1, -1, None),
+    Among("\u{03BC}\u{03B1}\u{03BC}", -1, -1, None),
+    Among("\u{03BC}\u{03B1}\u{03BD}", -1, -1, None),
+];
+
+static A_26: &'static [Among<Context>; 2] = &[
+    Among("\u{03B5}\u{03B4}\u{03B5}\u{03C3}", -1, 1, None),
+    Among("\u{03B5}\u{03B4}\u{03C9}\u{03BD}", -1, 1, None),
+];
+
+static A_27: &'static [Among<Context>; 8] = &[
+    Among("\u{03BA}\u{03C1}\u{03B1}\u{03C3}\u{03C0}", -1, 1, None),
+    Among("\u{03C5}\u{03C0}", -1, 1, None),
+    Among("\u{03B4}\u{03B1}\u{03C0}", -1, 1, None),
+    Among("\u{03B3}\u{03B7}\u{03C0}", -1, 1, None),
+    Among("\u{03B9}\u{03C0}", -1, 1, None),
+    Among("\u{03B5}\u{03BC}\u{03C0}", -1, 1, None),
+    Among("\u{03BF}\u{03C0}", -1, 1, None),
+    Among("\u{03BC}\u{03B9}\u{03BB}", -1, 1, None),
+];
+
+static A_28: &'static [Among<Context>; 2] = &[
+    Among("\u{03BF}\u{03C5}\u{03B4}\u{03B5}\u{03C3}", -1, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03B4}\u{03C9}\u{03BD}", -1, 1, None),
+];
+
+static A_29: &'static [Among<Context>; 15] = &[
+    Among("\u{03C3}\u{03C0}", -1, 1, None),
+    Among("\u{03C6}\u{03C1}", -1, 1, None),
+    Among("\u{03C3}", -1, 1, None),
+    Among("\u{03BB}\u{03B9}\u{03C7}", -1, 1, None),
+    Among("\u{03C4}\u{03C1}\u{03B1}\u{03B3}", -1, 1, None),
+    Among("\u{03C6}\u{03B5}", -1, 1, None),
+    Among("\u{03B1}\u{03C1}\u{03BA}", -1, 1, None),
+    Among("\u{03C3}\u{03BA}", -1, 1, None),
+    Among("\u{03BA}\u{03B1}\u{03BB}\u{03B9}\u{03B1}\u{03BA}", -1, 1, None),
+    Among("\u{03BB}\u{03BF}\u{03C5}\u{03BB}", -1, 1, None),
+    Among("\u{03C6}\u{03BB}", -1, 1, None),
+    Among("\u{03C0}\u{03B5}\u{03C4}\u{03B1}\u{03BB}", -1, 1, None),
+    Among("\u{03B2}\u{03B5}\u{03BB}", -1, 1, None),
+    Among("\u{03C7}\u{03BD}", -1, 1, None),
+    Among("\u{03C0}\u{03BB}\u{03B5}\u{03BE}", -1, 1, None),
+];
+
+static A_30: &'static [Among<Context>; 2] = &[
+    Among("\u{03B5}\u{03C9}\u{03C3}", -1, 1, None),
+    Among("\u{03B5}\u{03C9}\u{03BD}", -1, 1, None),
+];
+
+static A_31: &'static [Among<Context>; 8] = &[
+    Among("\u{03C0}", -1, 1, None),
+    Among("\u{03C0}\u{03B1}\u{03C1}", -1, 1, None),
+    Among("\u{03B4}", -1, 1, None),
+    Among("\u{03B9}\u{03B4}", 2, 1, None),
+    Among("\u{03B8}", -1, 1, None),
+    Among("\u{03B3}\u{03B1}\u{03BB}", -1, 1, None),
+    Among("\u{03B5}\u{03BB}", -1, 1, None),
+    Among("\u{03BD}", -1, 1, None),
+];
+
+static A_32: &'static [Among<Context>; 3] = &[
+    Among("\u{03B9}\u{03BF}\u{03C5}", -1, 1, None),
+    Among("\u{03B9}\u{03B1}", -1, 1, None),
+    Among("\u{03B9}\u{03C9}\u{03BD}", -1, 1, None),
+];
+
+static A_33: &'static [Among<Context>; 4] = &[
+    Among("\u{03B9}\u{03BA}\u{03BF}\u{03C5}", -1, 1, None),
+    Among("\u{03B9}\u{03BA}\u{03B1}", -1, 1, None),
+    Among("\u{03B9}\u{03BA}\u{03C9}\u{03BD}", -1, 1, None),
+    Among("\u{03B9}\u{03BA}\u{03BF}", -1, 1, None),
+];
+
+static A_34: &'static [Among<Context>; 36] = &[
+    Among("\u{03BA}\u{03B1}\u{03BB}\u{03C0}", -1, 1, None),
+    Among("\u{03B3}\u{03B5}\u{03C1}", -1, 1, None),
+    Among("\u{03C0}\u{03BB}\u{03B9}\u{03B1}\u{03C4}\u{03C3}", -1, 1, None),
+    Among("\u{03C0}\u{03B5}\u{03C4}\u{03C3}", -1, 1, None),
+    Among("\u{03C0}\u{03B9}\u{03C4}\u{03C3}", -1, 1, None),
+    Among("\u{03C6}\u{03C5}\u{03C3}", -1, 1, None),
+    Among("\u{03C7}\u{03B1}\u{03C3}", -1, 1, None),
+    Among("\u{03BC}\u{03C0}\u{03BF}\u{03C3}", -1, 1, None),
+    Among("\u{03C3}\u{03B5}\u{03C1}\u{03C4}", -1, 1, None),
+    Among("\u{03BC}\u{03C0}\u{03B1}\u{03B3}\u{03B9}\u{03B1}\u{03C4}", -1, 1, None),
+    Among("\u{03BD}\u{03B9}\u{03C4}", -1, 1, None),
+    Among("\u{03C0}\u{03B9}\u{03BA}\u{03B1}\u{03BD}\u{03C4}", -1, 1, None),
+    Among("\u{03B5}\u{03BE}\u{03C9}\u{03B4}", -1, 1, None),
+    Among("\u{03B1}\u{03B4}", -1, 1, None),
+    Among("\u{03BA}\u{03B1}\u{03C4}\u{03B1}\u{03B4}", 13, 1, None),
+    Among("\u{03C3}\u{03C5}\u{03BD}\u{03B1}\u{03B4}", 13, 1, None),
+    Among("\u{03B1}\u{03BD}\u{03C4}\u{03B9}\u{03B4}", -1, 1, None),
+    Among("\u{03B5}\u{03BD}\u{03B4}", -1, 1, None),
+    Among("\u{03C5}\u{03C0}\u{03BF}\u{03B4}", -1, 1, None),
+    Among("\u{03C0}\u{03C1}\u{03C9}\u{03C4}\u{03BF}\u{03B4}", -1, 1, None),
+    Among("\u{03C6}\u{03C5}\u{03BB}\u{03BF}\u{03B4}", -1, 1, None),
+    Among("\u{03B7}\u{03B8}", -1, 1, None),
+    Among("\u{03B1}\u{03BD}\u{03B7}\u{03B8}", 21, 1, None),
+    Among("\u{03BE}\u{03B9}\u{03BA}", -1, 1, None),
+    Among("\u{03BC}\u{03BF}\u{03C5}\u{03BB}", -1, 1, None),
+    Among("\u{03B1}\u{03BB}", -1, 1, None),
+    Among("\u{03B1}\u{03BC}\u{03BC}\u{03BF}\u{03C7}\u{03B1}\u{03BB}", 25, 1, None),
+    Among("\u{03C3}\u{03C5}\u{03BD}\u{03BF}\u{03BC}\u{03B7}\u{03BB}", -1, 1, None),
+    Among("\u{03BC}\u{03C0}\u{03BF}\u{03BB}", -1, 1, None),
+    Among("\u{03B2}\u{03C1}\u{03C9}\u{03BC}", -1, 1, None),
+    Among("\u{03C4}\u{03C3}\u{03B1}\u{03BC}", -1, 1, None),
+    Among("\u{03BC}\u{03C0}\u{03B1}\u{03BD}", -1, 1, None),
+    Among("\u{03B1}\u{03BC}\u{03B1}\u{03BD}", -1, 1, None),
+    Among("\u{03BA}\u{03B1}\u{03BB}\u{03BB}\u{03B9}\u{03BD}", -1, 1, None),
+    Among("\u{03C0}\u{03BF}\u{03C3}\u{03C4}\u{03B5}\u{03BB}\u{03BD}", -1, 1, None),
+    Among("\u{03C6}\u{03B9}\u{03BB}\u{03BF}\u{03BD}", -1, 1, None),
+];
+
+static A_35: &'static [Among<Context>; 5] = &[
+    Among("\u{03BF}\u{03C5}\u{03C3}\u{03B1}\u{03BC}\u{03B5}", -1, 1, None),
+    Among("\u{03B7}\u{03C3}\u{03B1}\u{03BC}\u{03B5}", -1, 1, None),
+    Among("\u{03B1}\u{03B3}\u{03B1}\u{03BC}\u{03B5}", -1, 1, None),
+    Among("\u{03B7}\u{03BA}\u{03B1}\u{03BC}\u{03B5}", -1, 1, None),
+    Among("\u{03B7}\u{03B8}\u{03B7}\u{03BA}\u{03B1}\u{03BC}\u{03B5}", 3, 1, None),
+];
+
+static A_36: &'static [Among<Context>; 12] = &[
+    Among("\u{03B1}\u{03BD}\u{03B1}\u{03C0}", -1, 1, None),
+    Among("\u{03C0}\u{03B9}\u{03BA}\u{03C1}", -1, 1, None),
+    Among("\u{03B1}\u{03C0}\u{03BF}\u{03C3}\u{03C4}", -1, 1, None),
+    Among("\u{03C0}\u{03BF}\u{03C4}", -1, 1, None),
+    Among("\u{03C7}", -1, 1, None),
+    Among("\u{03C3}\u{03B9}\u{03C7}", 4, 1, None),
+    Among("\u{03B2}\u{03BF}\u{03C5}\u{03B2}", -1, 1, None),
+    Among("\u{03C0}\u{03B5}\u{03B8}", -1, 1, None),
+    Among("\u{03BE}\u{03B5}\u{03B8}", -1, 1, None),
+    Among("\u{03B1}\u{03C0}\u{03BF}\u{03B8}", -1, 1, None),
+    Among("\u{03B1}\u{03C0}\u{03BF}\u{03BA}", -1, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03BB}", -1, 1, None),
+];
+
+static A_37: &'static [Among<Context>; 2] = &[
+    Among("\u{03C4}\u{03C1}", -1, 1, None),
+    Among("\u{03C4}\u{03C3}", -1, 1, None),
+];
+
+static A_38: &'static [Among<Context>; 11] = &[
+    Among("\u{03BF}\u{03C5}\u{03C3}\u{03B1}\u{03BD}\u{03B5}", -1, 1, None),
+    Among("\u{03B7}\u{03C3}\u{03B1}\u{03BD}\u{03B5}", -1, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03BD}\u{03C4}\u{03B1}\u{03BD}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03C5}\u{03BD}\u{03C4}\u{03B1}\u{03BD}\u{03B5}", 2, 1, None),
+    Among("\u{03BF}\u{03BD}\u{03C4}\u{03B1}\u{03BD}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03BD}\u{03C4}\u{03B1}\u{03BD}\u{03B5}", 4, 1, None),
+    Among("\u{03BF}\u{03C4}\u{03B1}\u{03BD}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03C4}\u{03B1}\u{03BD}\u{03B5}", 6, 1, None),
+    Among("\u{03B1}\u{03B3}\u{03B1}\u{03BD}\u{03B5}", -1, 1, None),
+    Among("\u{03B7}\u{03BA}\u{03B1}\u{03BD}\u{03B5}", -1, 1, None),
+    Among("\u{03B7}\u{03B8}\u{03B7}\u{03BA}\u{03B1}\u{03BD}\u{03B5}", 9, 1, None),
+];
+
+static A_39: &'static [Among<Context>; 95] = &[
+    Among("\u{03C0}", -1, 1, None),
+    Among("\u{03C3}\u{03C0}", 0, 1, None),
+    Among("\u{03C0}\u{03BF}\u{03BB}\u{03C5}\u{03B4}\u{03B1}\u{03C0}", 0, 1, None),
+    Among("\u{03B1}\u{03B4}\u{03B1}\u{03C0}", 0, 1, None),
+    Among("\u{03C7}\u{03B1}\u{03BC}\u{03B7}\u{03BB}\u{03BF}\u{03B4}\u{03B1}\u{03C0}", 0, 1, None),
+    Among("\u{03C4}\u{03C3}\u{03BF}\u{03C0}", 0, 1, None),
+    Among("\u{03BA}\u{03BF}\u{03C0}", 0, 1, None),
+    Among("\u{03C5}\u{03C0}\u{03BF}\u{03BA}\u{03BF}\u{03C0}", 6, 1, None),
+    Among("\u{03C0}\u{03B5}\u{03C1}\u{03B9}\u{03C4}\u{03C1}", -1, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03C1}", -1, 1, None),
+    Among("\u{03B5}\u{03C1}", -1, 1, None),
+    Among("\u{03B2}\u{03B5}\u{03C4}\u{03B5}\u{03C1}", 10, 1, None),
+    Among("\u{03B3}\u{03B5}\u{03C1}", 10, 1, None),
+    Among("\u{03BB}\u{03BF}\u{03C5}\u{03B8}\u{03B7}\u{03C1}", -1, 1, None),
+    Among("\u{03BA}\u{03BF}\u{03C1}\u{03BC}\u{03BF}\u{03C1}", -1, 1, None),
+    Among("\u{03C3}", -1, 1, None),
+    Among("\u{03C3}\u{03B1}\u{03C1}\u{03B1}\u{03BA}\u{03B1}\u{03C4}\u{03C3}", 15, 1, None),
+    Among("\u{03B8}\u{03C5}\u{03C3}", 15, 1, None),
+    Among("\u{03B2}\u{03B1}\u{03C3}", 15, 1, None),
+    Among("\u{03C0}\u{03BF}\u{03BB}\u{03B9}\u{03C3}", 15, 1, None),
+    Among("\u{03BA}\u{03B1}\u{03C3}\u{03C4}", -1, 1, None),
+    Among("\u{03B4}\u{03B9}\u{03B1}\u{03C4}", -1, 1, None),
+    Among("\u{03C0}\u{03BB}\u{03B1}\u{03C4}", -1, 1, None),
+    Among("\u{03C4}\u{03C3}\u{03B1}\u{03C1}\u{03BB}\u{03B1}\u{03C4}", -1, 1, None),
+    Among("\u{03C4}\u{03B5}\u{03C4}", -1, 1, None),
+    Among("\u{03C0}\u{03BF}\u{03C5}\u{03C1}\u{03B9}\u{03C4}", -1, 1, None),
+    Among("\u{03C3}\u{03BF}\u{03C5}\u{03BB}\u{03C4}", -1, 1, None),
+    Among("\u{03B6}\u{03C9}\u{03BD}\u{03C4}", -1, 1, None),
+    Among("\u{03BC}\u{03B1}\u{03B9}\u{03BD}\u{03C4}", -1, 1, None),
+    Among("\u{03C6}", -1, 1, None),
+    Among("\u{03C0}\u{03B5}\u{03BD}\u{03C4}\u{03B1}\u{03C1}\u{03C6}", 29, 1, None),
+    Among("\u{03BA}\u{03BF}\u{03B9}\u{03BB}\u{03B1}\u{03C1}\u{03C6}", 29, 1, None),
+    Among("\u{03BF}\u{03C1}\u{03C6}", 29, 1, None),
+    Among("\u{03B4}\u{03B9}\u{03B1}\u{03C6}", 29, 1, None),
+    Among("\u{03C3}\u{03C4}\u{03B5}\u{03C6}", 29, 1, None),
+    Among("\u{03C6}\u{03C9}\u{03C4}\u{03BF}\u{03C3}\u{03C4}\u{03B5}\u{03C6}", 34, 1, None),
+    Among("\u{03C0}\u{03B5}\u{03C1}\u{03B7}\u{03C6}", 29, 1, None),
+    Among("\u{03C5}\u{03C0}\u{03B5}\u{03C1}\u{03B7}\u{03C6}", 36, 1, None),
+    Among("\u{03C7}", -1, 1, None),
+    Among("\u{03C0}\u{03BF}\u{03BB}\u{03C5}\u{03BC}\u{03B7}\u{03C7}", 38, 1, None),
+    Among("\u{03B1}\u{03BC}\u{03B7}\u{03C7}", 38, 1, None),
+    Among("\u{03B2}\u{03B9}\u{03BF}\u{03BC}\u{03B7}\u{03C7}", 38, 1, None),
+    Among("\u{03BC}\u{03B9}\u{03BA}\u{03C1}\u{03BF}\u{03B2}\u{03B9}\u{03BF}\u{03BC}\u{03B7}\u{03C7}", 41, 1, None),
+    Among("\u{03BC}\u{03B5}\u{03B3}\u{03BB}\u{03BF}\u{03B2}\u{03B9}\u{03BF}\u{03BC}\u{03B7}\u{03C7}", 41, 1, None),
+    Among("\u{03BA}\u{03B1}\u{03C0}\u{03BD}\u{03BF}\u{03B2}\u{03B9}\u{03BF}\u{03BC}\u{03B7}\u{03C7}", 41, 1, None),
+    Among("\u{03BB}\u{03B9}\u{03C7}", 38, 1, None),
+    Among("\u{03C4}\u{03B1}\u{03B2}", -1, 1, None),
+    Among("\u{03BD}\u{03C4}\u{03B1}\u{03B2}", 46, 1, None),
+    Among("\u{03C8}\u{03B7}\u{03BB}\u{03BF}\u{03C4}\u{03B1}\u{03B2}", 46, 1, None),
+    Among("\u{03BB}\u{03B9}\u{03B2}", -1, 1, None),
+    Among("\u{03BA}\u{03BB}\u{03B9}\u{03B2}", 49, 1, None),
+    Among("\u{03BE}\u{03B7}\u{03C1}\u{03BF}\u{03BA}\u{03BB}\u{03B9}\u{03B2}", 50, 1, None),
+    Among("\u{03B3}", -1, 1, None),
+    Among("\u{03B1}\u{03BD}\u{03BF}\u{03C1}\u{03B3}", 52, 1, None),
+    Among("\u{03B5}\u{03BD}\u{03BF}\u{03C1}\u{03B3}", 52, 1, None),
+    Among("\u{03B1}\u{03B3}", 52, 1, None),
+    Among("\u{03C4}\u{03C1}\u{03B1}\u{03B3}", 55, 1, None),
+    Among("\u{03C4}\u{03C3}\u{03B1}\u{03B3}", 55, 1, None),
+    Among("\u{03C4}\u{03C3}\u{03B9}\u{03B3}\u{03B3}", 52, 1, None),
+    Among("\u{03B1}\u{03C4}\u{03C3}\u{03B9}\u{03B3}\u{03B3}", 58, 1, None),
+    Among("\u{03B1}\u{03B8}\u{03B9}\u{03B3}\u{03B3}", 52, 1, None),
+    Among("\u{03C3}\u{03C4}\u{03B5}\u{03B3}", 52, 1, None),
+    Among("\u{03B1}\u{03C0}\u{03B7}\u{03B3}", 52, 1, None),
+    Among("\u{03C3}\u{03B9}\u{03B3}", 52, 1, None),
+    Among("\u{03BA}\u{03B1}\u{03BB}\u{03C0}\u{03BF}\u{03C5}\u{03B6}", -1, 1, None),
+    Among("\u{03B8}", -1, 1, None),
+    Among("\u{03BC}\u{03C9}\u{03B1}\u{03BC}\u{03B5}\u{03B8}", 65, 1, None),
+    Among("\u{03C0}\u{03B9}\u{03B8}", 65, 1, None),
+    Among("\u{03B1}\u{03C0}\u{03B9}\u{03B8}", 67, 1, None),
+    Among("\u{03B2}\u{03B1}\u{03C3}\u{03BA}", -1, 1, None),
+    Among("\u{03B2}\u{03C1}\u{03B1}\u{03C7}\u{03C5}\u{03BA}", -1, 1, None),
+    Among("\u{03B4}\u{03B5}\u{03BA}", -1, 1, None),
+    Among("\u{03C0}\u{03B5}\u{03BB}\u{03B5}\u{03BA}", -1, 1, None),
+    Among("\u{03B9}\u{03BA}", -1, 1, None),
+    Among("\u{03B1}\u{03BD}\u{03B9}\u{03BA}", 73, 1, None),
+    Among("\u{03B2}\u{03BF}\u{03C5}\u{03BB}\u{03BA}", -1, 1, None),
+    Among("\u{03C0}\u{03BB}", -1, 1, None),
+    Among("\u{03B4}\u{03B9}\u{03C0}\u{03BB}", 76, 1, None),
+    Among("\u{03C8}\u{03C5}\u{03C7}\u{03BF}\u{03C0}\u{03BB}", 76, 1, None),
+    Among("\u{03BB}\u{03B1}\u{03BF}\u{03C0}\u{03BB}", 76, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03BB}", -1, 1, None),
+    Among("\u{03B3}\u{03B1}\u{03BB}", -1, 1, None),
+    Among("\u{03B2}\u{03B1}\u{03B8}\u{03C5}\u{03B3}\u{03B1}\u{03BB}", 81, 1, None),
+    Among("\u{03BA}\u{03B1}\u{03C4}\u{03B1}\u{03B3}\u{03B1}\u{03BB}", 81, 1, None),
+    Among("\u{03BF}\u{03BB}\u{03BF}\u{03B3}\u{03B1}\u{03BB}", 81, 1, None),
+    Among("\u{03BA}\u{03B1}\u{03C3}\u{03C4}\u{03B5}\u{03BB}", -1, 1, None),
+    Among("\u{03BC}\u{03B5}\u{03BB}", -1, 1, None),
+    Among("\u{03C0}\u{03BF}\u{03C1}\u{03C4}\u{03BF}\u{03BB}", -1, 1, None),
+    Among("\u{03BC}", -1, 1, None),
+    Among("\u{03B4}\u{03C1}\u{03B1}\u{03B4}\u{03BF}\u{03C5}\u{03BC}", 88, 1, None),
+    Among("\u{03B2}\u{03C1}\u{03B1}\u{03C7}\u{03BC}", 88, 1, None),
+    Among("\u{03BF}\u{03BB}\u{03B9}\u{03B3}\u{03BF}\u{03B4}\u{03B1}\u{03BC}", 88, 1, None),
+    Among("\u{03BC}\u{03BF}\u{03C5}\u{03C3}\u{03BF}\u{03C5}\u{03BB}\u{03BC}", 88, 1, None),
+    Among("\u{03BD}", -1, 1, None),
+    Among("\u{03B1}\u{03BC}\u{03B5}\u{03C1}\u{03B9}\u{03BA}\u{03B1}\u{03BD}", 93, 1, None),
+];
+
+static A_40: &'static [Among<Context>; 1] = &[
+    Among("\u{03B7}\u{03C3}\u{03B5}\u{03C4}\u{03B5}", -1, 1, None),
+];
+
+static A_41: &'static [Among<Context>; 31] = &[
+    Among("\u{03C0}\u{03C5}\u{03C1}", -1, 1, None),
+    Among("\u{03B5}\u{03C5}\u{03C1}", -1, 1, None),
+    Among("\u{03C7}\u{03C9}\u{03C1}", -1, 1, None),
+    Among("\u{03B2}\u{03B1}\u{03C1}", -1, 1, None),
+    Among("\u{03B2}\u{03C1}", -1, 1, None),
+    Among("\u{03B1}\u{03B9}\u{03C1}", -1, 1, None),
+    Among("\u{03C6}\u{03BF}\u{03C1}", -1, 1, None),
+    Among("\u{03BD}\u{03B5}\u{03C4}", -1, 1, None),
+    Among("\u{03C3}\u{03C7}", -1, 1, None),
+    Among("\u{03C3}\u{03C5}\u{03BD}\u{03B4}", -1, 1, None),
+    Among("\u{03B5}\u{03BD}\u{03B4}", -1, 1, None),
+    Among("\u{03BF}\u{03B4}", -1, 1, None),
+    Among("\u{03C5}\u{03C0}\u{03B5}\u{03C1}\u{03B8}", -1, 1, None),
+    Among("\u{03C3}\u{03B8}", -1, 1, None),
+    Among("\u{03B5}\u{03C5}\u{03B8}", -1, 1, None),
+    Among("\u{03C1}\u{03B1}\u{03B8}", -1, 1, None),
+    Among("\u{03C4}\u{03B1}\u{03B8}", -1, 1, None),
+    Among("\u{03B4}\u{03B9}\u{03B1}\u{03B8}", -1, 1, None),
+    Among("\u{03BA}\u{03B1}\u{03B8}", -1, 1, None),
+    Among("\u{03C4}\u{03B9}\u{03B8}", -1, 1, None),
+    Among("\u{03B5}\u{03BA}\u{03B8}", -1, 1, None),
+    Among("\u{03C3}\u{03C5}\u{03BD}\u{03B8}", -1, 1, None),
+    Among("\u{03B5}\u{03BD}\u{03B8}", -1, 1, None),
+    Among("\u{03C1}\u{03BF}\u{03B8}", -1, 1, None),
+    Among("\u{03B1}\u{03C1}\u{03BA}", -1, 1, None),
+    Among("\u{03C9}\u{03C6}\u{03B5}\u{03BB}", -1, 1, None),
+    Among("\u{03B2}\u{03BF}\u{03BB}", -1, 1, None),
+    Among("\u{03C3}\u{03C5}\u{03BD}", -1, 1, None),
+    Among("\u{03B1}\u{03B9}\u{03BD}", -1, 1, None),
+    Among("\u{03C0}\u{03BF}\u{03BD}", -1, 1, None),
+    Among("\u{03C1}\u{03BF}\u{03BD}", -1, 1, None),
+];
+
+static A_42: &'static [Among<Context>; 25] = &[
+    Among("\u{03C3}\u{03B5}\u{03C1}\u{03C0}", -1, 1, None),
+    Among("\u{03BA}\u{03BF}\u{03C0}", -1, 1, None),
+    Among("\u{03B8}\u{03B1}\u{03C1}\u{03C1}", -1, 1, None),
+    Among("\u{03BD}\u{03C4}\u{03C1}", -1, 1, None),
+    Among("\u{03B1}\u{03B2}\u{03B1}\u{03C1}", -1, 1, None),
+    Among("\u{03B5}\u{03BD}\u{03B1}\u{03C1}", -1, 1, None),
+    Among("\u{03B1}\u{03B2}\u{03C1}", -1, 1, None),
+    Among("\u{03BC}\u{03C0}\u{03BF}\u{03C1}", -1, 1, None),
+    Among("\u{03C5}", -1, 1, None),
+    Among("\u{03C3}\u{03C5}\u{03C1}\u{03C6}", -1, 1, None),
+    Among("\u{03BD}\u{03B9}\u{03C6}", -1, 1, None),
+    Among("\u{03C0}\u{03B1}\u{03B3}", -1, 1, None),
+    Among("\u{03B4}", -1, 1, None),
+    Among("\u{03B1}\u{03B4}", 12, 1, None),
+    Among("\u{03B8}", -1, 1, None),
+    Among("\u{03B1}\u{03B8}", 14, 1, None),
+    Among("\u{03C3}\u{03BA}", -1, 1, None),
+    Among("\u{03C4}\u{03BF}\u{03BA}", -1, 1, None),
+    Among("\u{03B1}\u{03C0}\u{03BB}", -1, 1, None),
+    Among("\u{03C0}\u{03B1}\u{03C1}\u{03B1}\u{03BA}\u{03B1}\u{03BB}", -1, 1, None),
+    Among("\u{03C3}\u{03BA}\u{03B5}\u{03BB}", -1, 1, None),
+    Among("\u{03B5}\u{03BC}", -1, 1, None),
+    Among("\u{03B1}\u{03BD}", -1, 1, None),
+    Among("\u{03B2}\u{03B5}\u{03BD}", -1, 1, None),
+    Among("\u{03B2}\u{03B1}\u{03C1}\u{03BF}\u{03BD}", -1, 1, None),
+];
+
+static A_43: &'static [Among<Context>; 2] = &[
+    Among("\u{03C9}\u{03BD}\u{03C4}\u{03B1}\u{03C3}", -1, 1, None),
+    Among("\u{03BF}\u{03BD}\u{03C4}\u{03B1}\u{03C3}", -1, 1, None),
+];
+
+static A_44: &'static [Among<Context>; 2] = &[
+    Among("\u{03BF}\u{03BC}\u{03B1}\u{03C3}\u{03C4}\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03BC}\u{03B1}\u{03C3}\u{03C4}\u{03B5}", 0, 1, None),
+];
+
+static A_45: &'static [Among<Context>; 6] = &[
+    Among("\u{03C0}", -1, 1, None),
+    Among("\u{03B1}\u{03C0}", 0, 1, None),
+    Among("\u{03B1}\u{03BA}\u{03B1}\u{03C4}\u{03B1}\u{03C0}", 1, 1, None),
+    Among("\u{03C3}\u{03C5}\u{03BC}\u{03C0}", 0, 1, None),
+    Among("\u{03B1}\u{03C3}\u{03C5}\u{03BC}\u{03C0}", 3, 1, None),
+    Among("\u{03B1}\u{03BC}\u{03B5}\u{03C4}\u{03B1}\u{03BC}\u{03C6}", -1, 1, None),
+];
+
+static A_46: &'static [Among<Context>; 9] = &[
+    Among("\u{03B1}\u{03C1}", -1, 1, None),
+    Among("\u{03BD}\u{03B9}\u{03C3}", -1, 1, None),
+    Among("\u{03B6}", -1, 1, None),
+    Among("\u{03B1}\u{03BB}", -1, 1, None),
+    Among("\u{03C0}\u{03B1}\u{03C1}\u{03B1}\u{03BA}\u{03B1}\u{03BB}", 3, 1, None),
+    Among("\u{03B5}\u{03BA}\u{03C4}\u{03B5}\u{03BB}", -1, 1, None),
+    Among("\u{03BC}", -1, 1, None),
+    Among("\u{03BE}", -1, 1, None),
+    Among("\u{03C0}\u{03C1}\u{03BF}", -1, 1, None),
+];
+
+static A_47: &'static [Among<Context>; 3] = &[
+    Among("\u{03B7}\u{03B8}\u{03B7}\u{03BA}\u{03B5}\u{03C3}", -1, 1, None),
+    Among("\u{03B7}\u{03B8}\u{03B7}\u{03BA}\u{03B1}", -1, 1, None),
+    Among("\u{03B7}\u{03B8}\u{03B7}\u{03BA}\u{03B5}", -1, 1, None),
+];
+
+static A_48: &'static [Among<Context>; 6] = &[
+    Among("\u{03C3}\u{03C6}", -1, 1, None),
+    Among("\u{03BD}\u{03B1}\u{03C1}\u{03B8}", -1, 1, None),
+    Among("\u{03C0}\u{03B9}\u{03B8}", -1, 1, None),
+    Among("\u{03BF}\u{03B8}", -1, 1, None),
+    Among("\u{03C3}\u{03BA}\u{03BF}\u{03C5}\u{03BB}", -1, 1, None),
+    Among("\u{03C3}\u{03BA}\u{03C9}\u{03BB}", -1, 1, None),
+];
+
+static A_49: &'static [Among<Context>; 5] = &[
+    Among("\u{03B8}", -1, 1, None),
+    Among("\u{03C0}\u{03C1}\u{03BF}\u{03C3}\u{03B8}", 0, 1, None),
+    Among("\u{03C0}\u{03B1}\u{03C1}\u{03B1}\u{03BA}\u{03B1}\u{03C4}\u{03B1}\u{03B8}", 0, 1, None),
+    Among("\u{03B4}\u{03B9}\u{03B1}\u{03B8}", 0, 1, None),
+    Among("\u{03C3}\u{03C5}\u{03BD}\u{03B8}", 0, 1, None),
+];
+
+static A_50: &'static [Among<Context>; 3] = &[
+    Among("\u{03B7}\u{03BA}\u{03B5}\u{03C3}", -1, 1, None),
+    Among("\u{03B7}\u{03BA}\u{03B1}", -1, 1, None),
+    Among("\u{03B7}\u{03BA}\u{03B5}", -1, 1, None),
+];
+
+static A_51: &'static [Among<Context>; 12] = &[
+    Among("\u{03B2}\u{03BB}\u{03B5}\u{03C0}", -1, 1, None),
+    Among("\u{03C0}\u{03BF}\u{03B4}\u{03B1}\u{03C1}", -1, 1, None),
+    Among("\u{03C0}\u{03C1}\u{03C9}\u{03C4}", -1, 1, None),
+    Among("\u{03BA}\u{03C5}\u{03BC}\u{03B1}\u{03C4}", -1, 1, None),
+    Among("\u{03C0}\u{03B1}\u{03BD}\u{03C4}\u{03B1}\u{03C7}", -1, 1, None),
+    Among("\u{03BB}\u{03B1}\u{03C7}", -1, 1, None),
+    Among("\u{03C6}\u{03B1}\u{03B3}", -1, 1, None),
+    Among("\u{03BB}\u{03B7}\u{03B3}", -1, 1, None),
+    Among("\u{03C6}\u{03C1}\u{03C5}\u{03B4}", -1, 1, None),
+    Among("\u{03BC}\u{03B1}\u{03BD}\u{03C4}\u{03B9}\u{03BB}", -1, 1, None),
+    Among("\u{03BC}\u{03B1}\u{03BB}\u{03BB}", -1, 1, None),
+    Among("\u{03BF}\u{03BC}", -1, 1, None),
+];
+
+static A_52: &'static [Among<Context>; 25] = &[
+    Among("\u{03B5}\u{03BA}\u{03BB}\u{03B9}\u{03C0}", -1, 1, None),
+    Among("\u{03C1}", -1, 1, None),
+    Among("\u{03B1}\u{03BD}\u{03B1}\u{03C1}\u{03C1}", 1, 1, None),
+    Among("\u{03B5}\u{03BD}\u{03B4}\u{03B9}\u{03B1}\u{03C6}\u{03B5}\u{03C1}", 1, 1, None),
+    Among("\u{03C0}\u{03B1}\u{03C4}", -1, 1, None),
+    Among("\u{03BA}\u{03B1}\u{03B8}\u{03B1}\u{03C1}\u{03B5}\u{03C5}", -1, 1, None),
+    Among("\u{03B4}\u{03B5}\u{03C5}\u{03C4}\u{03B5}\u{03C1}\u{03B5}\u{03C5}", -1, 1, None),
+    Among("\u{03BB}\u{03B5}\u{03C7}", -1, 1, None),
+    Among("\u{03C4}\u{03C3}\u{03B1}", -1, 1, None),
+    Among("\u{03C7}\u{03B1}\u{03B4}", -1, 1, None),
+    Among("\u{03BC}\u{03B5}\u{03B4}", -1, 1, None),
+    Among("\u{03BB}\u{03B1}\u{03BC}\u{03C0}\u{03B9}\u{03B4}", -1, 1, None),
+    Among("\u{03B4}\u{03B5}", -1, 1, None),
+    Among("\u{03C0}\u{03BB}\u{03B5}", -1, 1, None),
+    Among("\u{03BC}\u{03B5}\u{03C3}\u{03B1}\u{03B6}", -1, 1, None),
+    Among("\u{03B4}\u{03B5}\u{03C3}\u{03C0}\u{03BF}\u{03B6}", -1, 1, None),
+    Among("\u{03B1}\u{03B9}\u{03B8}", -1, 1, None),
+    Among("\u{03C6}\u{03B1}\u{03C1}\u{03BC}\u{03B1}\u{03BA}", -1, 1, None),
+    Among("\u{03B1}\u{03B3}\u{03BA}", -1, 1, None),
+    Among("\u{03B1}\u{03BD}\u{03B7}\u{03BA}", -1, 1, None),
+    Among("\u{03BB}", -1, 1, None),
+    Among("\u{03BC}", -1, 1, None),
+    Among("\u{03B1}\u{03BC}", 21, 1, None),
+    Among("\u{03B2}\u{03C1}\u{03BF}\u{03BC}", 21, 1, None),
+    Among("\u{03C5}\u{03C0}\u{03BF}\u{03C4}\u{03B5}\u{03B9}\u{03BD}", -1, 1, None),
+];
+
+static A_53: &'static [Among<Context>; 3] = &[
+    Among("\u{03BF}\u{03C5}\u{03C3}\u{03B5}\u{03C3}", -1, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03C3}\u{03B1}", -1, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03C3}\u{03B5}", -1, 1, None),
+];
+
+static A_54: &'static [Among<Context>; 12] = &[
+    Among("\u{03C1}\u{03C0}", -1, 1, None),
+    Among("\u{03C0}\u{03C1}", -1, 1, None),
+    Among("\u{03C6}\u{03C1}", -1, 1, None),
+    Among("\u{03C7}\u{03BF}\u{03C1}\u{03C4}", -1, 1, None),
+    Among("\u{03C3}\u{03C6}", -1, 1, None),
+    Among("\u{03BF}\u{03C6}", -1, 1, None),
+    Among("\u{03C8}\u{03BF}\u{03C6}", 5, -1, None),
+    Among("\u{03BB}\u{03BF}\u{03C7}", -1, 1, None),
+    Among("\u{03BD}\u{03B1}\u{03C5}\u{03BB}\u{03BF}\u{03C7}", 7, -1, None),
+    Among("\u{03C0}\u{03B5}\u{03BB}", -1, 1, None),
+    Among("\u{03BB}\u{03BB}", -1, 1, None),
+    Among("\u{03C3}\u{03BC}\u{03B7}\u{03BD}", -1, 1, None),
+];
+
+static A_55: &'static [Among<Context>; 44] = &[
+    Among("\u{03C0}", -1, 1, None),
+    Among("\u{03B1}\u{03C3}\u{03C0}", 0, 1, None),
+    Among("\u{03B1}\u{03BD}\u{03C5}\u{03C0}", 0, 1, None),
+    Among("\u{03B1}\u{03C1}\u{03C4}\u{03B9}\u{03C0}", 0, 1, None),
+    Among("\u{03B1}\u{03B5}\u{03B9}\u{03C0}", 0, 1, None),
+    Among("\u{03C3}\u{03C5}\u{03BC}\u{03C0}", 0, 1, None),
+    Among("\u{03C0}\u{03C1}\u{03BF}\u{03C3}\u{03C9}\u{03C0}\u{03BF}\u{03C0}", 0, 1, None),
+    Among("\u{03C3}\u{03B9}\u{03B4}\u{03B7}\u{03C1}\u{03BF}\u{03C0}", 0, 1, None),
+    Among("\u{03B4}\u{03C1}\u{03BF}\u{03C3}\u{03BF}\u{03C0}", 0, 1, None),
+    Among("\u{03BD}\u{03B5}\u{03BF}\u{03C0}", 0, 1, None),
+    Among("\u{03BA}\u{03C1}\u{03BF}\u{03BA}\u{03B1}\u{03BB}\u{03BF}\u{03C0}", 0, 1, None),
+    Among("\u{03BF}\u{03BB}\u{03BF}\u{03C0}", 0, 1, None),
+    Among("\u{03C1}", -1, 1, None),
+    Among("\u{03C4}\u{03C1}", 12, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03C1}", 12, 1, None),
+    Among("\u{03B1}\u{03C3}\u{03C0}\u{03B1}\u{03C1}", 12, 1, None),
+    Among("\u{03C7}\u{03B1}\u{03C1}", 12, 1, None),
+    Among("\u{03B1}\u{03C7}\u{03B1}\u{03C1}", 16, 1, None),
+    Among("\u{03B1}\u{03C0}\u{03B5}\u{03C1}", 12, 1, None),
+    Among("\u{03C4}", -1, 1, None),
+    Among("\u{03B1}\u{03BD}\u{03C5}\u{03C3}\u{03C4}", 19, 1, None),
+    Among("\u{03B1}\u{03B2}\u{03B1}\u{03C3}\u{03C4}", 19, 1, None),
+    Among("\u{03C0}\u{03C1}\u{03BF}\u{03C3}\u{03C4}", 19, 1, None),
+    Among("\u{03B1}\u{03B9}\u{03BC}\u{03BF}\u{03C3}\u{03C4}", 19, 1, None),
+    Among("\u{03B4}\u{03B9}\u{03B1}\u{03C4}", 19, 1, None),
+    Among("\u{03B5}\u{03C0}\u{03B9}\u{03C4}", 19, 1, None),
+    Among("\u{03C3}\u{03C5}\u{03BD}\u{03C4}", 19, 1, None),
+    Among("\u{03C5}\u{03C0}\u{03BF}\u{03C4}", 19, 1, None),
+    Among("\u{03B1}\u{03C0}\u{03BF}\u{03C4}", 19, 1, None),
+    Among("\u{03BF}\u{03BC}\u{03BF}\u{03C4}", 19, 1, None),
+    Among("\u{03BD}\u{03BF}\u{03BC}\u{03BF}\u{03C4}", 29, 1, None),
+    Among("\u{03BD}\u{03B1}\u{03C5}", -1, 1, None),
+    Among("\u{03C0}\u{03BF}\u{03BB}\u{03C5}\u{03C6}", -1, 1, None),
+    Among("\u{03B1}\u{03C6}", -1, 1, None),
+    Among("\u{03BE}\u{03B5}\u{03C6}", -1, 1, None),
+    Among("\u{03B1}\u{03B4}\u{03B7}\u{03C6}", -1, 1, None),
+    Among("\u{03C0}\u{03B1}\u{03BC}\u{03C6}", -1, 1, None),
+    Among("\u{03B1}\u{03BC}\u{03B1}\u{03BB}\u{03BB}\u{03B9}", -1, 1, None),
+    Among("\u{03BB}", -1, 1, None),
+    Among("\u{03B1}\u{03BC}\u{03B1}\u{03BB}", 38, 1, None),
+    Among("\u{03BC}", -1, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03BB}\u{03B1}\u{03BC}", 40, 1, None),
+    Among("\u{03B5}\u{03BD}", -1, 1, None),
+    Among("\u{03B4}\u{03B5}\u{03C1}\u{03B2}\u{03B5}\u{03BD}", 42, 1, None),
+];
+
+static A_56: &'static [Among<Context>; 3] = &[
+    Among("\u{03B1}\u{03B3}\u{03B5}\u{03C3}", -1, 1, None),
+    Among("\u{03B1}\u{03B3}\u{03B1}", -1, 1, None),
+    Among("\u{03B1}\u{03B3}\u{03B5}", -1, 1, None),
+];
+
+static A_57: &'static [Among<Context>; 3] = &[
+    Among("\u{03B7}\u{03C3}\u{03BF}\u{03C5}", -1, 1, None),
+    Among("\u{03B7}\u{03C3}\u{03B1}", -1, 1, None),
+    Among("\u{03B7}\u{03C3}\u{03B5}", -1, 1, None),
+];
+
+static A_58: &'static [Among<Context>; 6] = &[
+    Among("\u{03BD}", -1, 1, None),
+    Among("\u{03B5}\u{03C0}\u{03C4}\u{03B1}\u{03BD}", 0, 1, None),
+    Among("\u{03B4}\u{03C9}\u{03B4}\u{03B5}\u{03BA}\u{03B1}\u{03BD}", 0, 1, None),
+    Among("\u{03C7}\u{03B5}\u{03C1}\u{03C3}\u{03BF}\u{03BD}", 0, 1, None),
+    Among("\u{03BC}\u{03B5}\u{03B3}\u{03B1}\u{03BB}\u{03BF}\u{03BD}", 0, 1, None),
+    Among("\u{03B5}\u{03C1}\u{03B7}\u{03BC}\u{03BF}\u{03BD}", 0, 1, None),
+];
+
+static A_59: &'static [Among<Context>; 1] = &[
+    Among("\u{03B7}\u{03C3}\u{03C4}\u{03B5}", -1, 1, None),
+];
+
+static A_60: &'static [Among<Context>; 10] = &[
+    Among("\u{03C7}\u{03C1}", -1, 1, None),
+    Among("\u{03B4}\u{03C5}\u{03C3}\u{03C7}\u{03C1}", 0, 1, None),
+    Among("\u{03B5}\u{03C5}\u{03C7}\u{03C1}", 0, 1, None),
+    Among("\u{03B1}\u{03C7}\u{03C1}", 0, 1, None),
+    Among("\u{03BA}\u{03BF}\u{03B9}\u{03BD}\u{03BF}\u{03C7}\u{03C1}", 0, 1, None),
+    Among("\u{03C0}\u{03B1}\u{03BB}\u{03B9}\u{03BC}\u{03C8}", -1, 1, None),
+    Among("\u{03C3}\u{03B2}", -1, 1, None),
+    Among("\u{03B1}\u{03C3}\u{03B2}", 6, 1, None),
+    Among("\u{03B1}\u{03C0}\u{03BB}", -1, 1, None),
+    Among("\u{03B1}\u{03B5}\u{03B9}\u{03BC}\u{03BD}", -1, 1, None),
+];
+
+static A_61: &'static [Among<Context>; 3] = &[
+    Among("\u{03BF}\u{03C5}\u{03BD}\u{03B5}", -1, 1, None),
+    Among("\u{03B7}\u{03C3}\u{03BF}\u{03C5}\u{03BD}\u{03B5}", 0, 1, None),
+    Among("\u{03B7}\u{03B8}\u{03BF}\u{03C5}\u{03BD}\u{03B5}", 0, 1, None),
+];
+
+static A_62: &'static [Among<Context>; 6] = &[
+    Among("\u{03C1}", -1, 1, None),
+    Among("\u{03C3}\u{03C4}\u{03C1}\u{03B1}\u{03B2}\u{03BF}\u{03BC}\u{03BF}\u{03C5}\u{03C4}\u{03C3}", -1, 1, None),
+    Among("\u{03BA}\u{03B1}\u{03BA}\u{03BF}\u{03BC}\u{03BF}\u{03C5}\u{03C4}\u{03C3}", -1, 1, None),
+    Among("\u{03C3}\u{03C0}\u{03B9}", -1, 1, None),
+    Among("\u{03BD}", -1, 1, None),
+    Among("\u{03B5}\u{03BE}\u{03C9}\u{03BD}", 4, 1, None),
+];
+
+static A_63: &'static [Among<Context>; 3] = &[
+    Among("\u{03BF}\u{03C5}\u{03BC}\u{03B5}", -1, 1, None),
+    Among("\u{03B7}\u{03C3}\u{03BF}\u{03C5}\u{03BC}\u{03B5}", 0, 1, None),
+    Among("\u{03B7}\u{03B8}\u{03BF}\u{03C5}\u{03BC}\u{03B5}", 0, 1, None),
+];
+
+static A_64: &'static [Among<Context>; 7] = &[
+    Among("\u{03B1}\u{03C3}\u{03BF}\u{03C5}\u{03C3}", -1, 1, None),
+    Among("\u{03C0}\u{03B1}\u{03C1}\u{03B1}\u{03C3}\u{03BF}\u{03C5}\u{03C3}", 0, 1, None),
+    Among("\u{03B1}\u{03BB}\u{03BB}\u{03BF}\u{03C3}\u{03BF}\u{03C5}\u{03C3}", -1, 1, None),
+    Among("\u{03C6}", -1, 1, None),
+    Among("\u{03C7}", -1, 1, None),
+    Among("\u{03B1}\u{03B6}", -1, 1, None),
+    Among("\u{03C9}\u{03C1}\u{03B9}\u{03BF}\u{03C0}\u{03BB}", -1, 1, None),
+];
+
+static A_65: &'static [Among<Context>; 3] = &[
+    Among("\u{03BC}\u{03B1}\u{03C4}\u{03BF}\u{03C3}", -1, 1, None),
+    Among("\u{03BC}\u{03B1}\u{03C4}\u{03B1}", -1, 1, None),
+    Among("\u{03BC}\u{03B1}\u{03C4}\u{03C9}\u{03BD}", -1, 1, None),
+];
+
+static A_66: &'static [Among<Context>; 84] = &[
+    Among("\u{03C5}\u{03C3}", -1, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03C3}", 0, 1, None),
+    Among("\u{03B1}\u{03C3}", -1, 1, None),
+    Among("\u{03B5}\u{03C3}", -1, 1, None),
+    Among("\u{03B7}\u{03C3}\u{03B5}\u{03C3}", 3, 1, None),
+    Among("\u{03B7}\u{03B4}\u{03B5}\u{03C3}", 3, 1, None),
+    Among("\u{03B7}\u{03C3}", -1, 1, None),
+    Among("\u{03B5}\u{03B9}\u{03C3}", -1, 1, None),
+    Among("\u{03B7}\u{03B8}\u{03B5}\u{03B9}\u{03C3}", 7, 1, None),
+    Among("\u{03BF}\u{03C3}", -1, 1, None),
+    Among("\u{03C5}", -1, 1, None),
+    Among("\u{03BF}\u{03C5}", 10, 1, None),
+    Among("\u{03C9}", -1, 1, None),
+    Among("\u{03B7}\u{03C3}\u{03C9}", 12, 1, None),
+    Among("\u{03B1}\u{03C9}", 12, 1, None),
+    Among("\u{03B7}\u{03B8}\u{03C9}", 12, 1, None),
+    Among("\u{03B1}", -1, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03C5}\u{03BC}\u{03B1}", 16, 1, None),
+    Among("\u{03BF}\u{03C3}\u{03BF}\u{03C5}\u{03BD}\u{03B1}", 16, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03C3}\u{03BF}\u{03C5}\u{03BD}\u{03B1}", 18, 1, None),
+    Among("\u{03BF}\u{03BC}\u{03BF}\u{03C5}\u{03BD}\u{03B1}", 16, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03BC}\u{03BF}\u{03C5}\u{03BD}\u{03B1}", 20, 1, None),
+    Among("\u{03B5}", -1, 1, None),
+    Among("\u{03B9}\u{03B5}\u{03C3}\u{03B1}\u{03C3}\u{03C4}\u{03B5}", 22, 1, None),
+    Among("\u{03BF}\u{03C3}\u{03B1}\u{03C3}\u{03C4}\u{03B5}", 22, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03C3}\u{03B1}\u{03C3}\u{03C4}\u{03B5}", 24, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03BC}\u{03B1}\u{03C3}\u{03C4}\u{03B5}", 22, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03C5}\u{03BC}\u{03B1}\u{03C3}\u{03C4}\u{03B5}", 26, 1, None),
+    Among("\u{03B9}\u{03B5}\u{03BC}\u{03B1}\u{03C3}\u{03C4}\u{03B5}", 22, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03C3}\u{03B1}\u{03C4}\u{03B5}", 22, 1, None),
+    Among("\u{03B7}\u{03C3}\u{03B1}\u{03C4}\u{03B5}", 22, 1, None),
+    Among("\u{03B1}\u{03B3}\u{03B1}\u{03C4}\u{03B5}", 22, 1, None),
+    Among("\u{03B7}\u{03BA}\u{03B1}\u{03C4}\u{03B5}", 22, 1, None),
+    Among("\u{03B7}\u{03B8}\u{03B7}\u{03BA}\u{03B1}\u{03C4}\u{03B5}", 32, 1, None),
+    Among("\u{03B5}\u{03B9}\u{03C4}\u{03B5}", 22, 1, None),
+    Among("\u{03B7}\u{03B8}\u{03B5}\u{03B9}\u{03C4}\u{03B5}", 34, 1, None),
+    Among("\u{03B7}", -1, 1, None),
+    Among("\u{03B9}", -1, 1, None),
+    Among("\u{03B1}\u{03C3}\u{03B1}\u{03B9}", 37, 1, None),
+    Among("\u{03B5}\u{03C3}\u{03B1}\u{03B9}", 37, 1, None),
+    Among("\u{03B9}\u{03B5}\u{03C3}\u{03B1}\u{03B9}", 39, 1, None),
+    Among("\u{03B1}\u{03C4}\u{03B1}\u{03B9}", 37, 1, None),
+    Among("\u{03B5}\u{03C4}\u{03B1}\u{03B9}", 37, 1, None),
+    Among("\u{03B9}\u{03B5}\u{03C4}\u{03B1}\u{03B9}", 42, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03BD}\u{03C4}\u{03B1}\u{03B9}", 37, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03C5}\u{03BD}\u{03C4}\u{03B1}\u{03B9}", 44, 1, None),
+    Among("\u{03BF}\u{03BD}\u{03C4}\u{03B1}\u{03B9}", 37, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03BC}\u{03B1}\u{03B9}", 37, 1, None),
+    Among("\u{03B1}\u{03BC}\u{03B1}\u{03B9}", 37, 1, None),
+    Among("\u{03B9}\u{03B5}\u{03BC}\u{03B1}\u{03B9}", 37, 1, None),
+    Among("\u{03BF}\u{03BC}\u{03B1}\u{03B9}", 37, 1, None),
+    Among("\u{03B5}\u{03B9}", 37, 1, None),
+    Among("\u{03B7}\u{03C3}\u{03B5}\u{03B9}", 51, 1, None),
+    Among("\u{03B1}\u{03B5}\u{03B9}", 51, 1, None),
+    Among("\u{03B7}\u{03B8}\u{03B5}\u{03B9}", 51, 1, None),
+    Among("\u{03BF}\u{03B9}", 37, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03BD}", -1, 1, None),
+    Among("\u{03B7}\u{03C3}\u{03BF}\u{03C5}\u{03BD}", 56, 1, None),
+    Among("\u{03BF}\u{03C3}\u{03BF}\u{03C5}\u{03BD}", 56, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03C3}\u{03BF}\u{03C5}\u{03BD}", 58, 1, None),
+    Among("\u{03B7}\u{03B8}\u{03BF}\u{03C5}\u{03BD}", 56, 1, None),
+    Among("\u{03BF}\u{03BC}\u{03BF}\u{03C5}\u{03BD}", 56, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03BC}\u{03BF}\u{03C5}\u{03BD}", 61, 1, None),
+    Among("\u{03C9}\u{03BD}", -1, 1, None),
+    Among("\u{03B7}\u{03B4}\u{03C9}\u{03BD}", 63, 1, None),
+    Among("\u{03B1}\u{03BD}", -1, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03C3}\u{03B1}\u{03BD}", 65, 1, None),
+    Among("\u{03BF}\u{03BD}\u{03C4}\u{03BF}\u{03C5}\u{03C3}\u{03B1}\u{03BD}", 66, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03BD}\u{03C4}\u{03BF}\u{03C5}\u{03C3}\u{03B1}\u{03BD}", 67, 1, None),
+    Among("\u{03B7}\u{03C3}\u{03B1}\u{03BD}", 65, 1, None),
+    Among("\u{03BF}\u{03C3}\u{03B1}\u{03C3}\u{03C4}\u{03B1}\u{03BD}", 65, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03C3}\u{03B1}\u{03C3}\u{03C4}\u{03B1}\u{03BD}", 70, 1, None),
+    Among("\u{03BF}\u{03BC}\u{03B1}\u{03C3}\u{03C4}\u{03B1}\u{03BD}", 65, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03BC}\u{03B1}\u{03C3}\u{03C4}\u{03B1}\u{03BD}", 72, 1, None),
+    Among("\u{03BF}\u{03C5}\u{03BD}\u{03C4}\u{03B1}\u{03BD}", 65, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03C5}\u{03BD}\u{03C4}\u{03B1}\u{03BD}", 74, 1, None),
+    Among("\u{03BF}\u{03BD}\u{03C4}\u{03B1}\u{03BD}", 65, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03BD}\u{03C4}\u{03B1}\u{03BD}", 76, 1, None),
+    Among("\u{03BF}\u{03C4}\u{03B1}\u{03BD}", 65, 1, None),
+    Among("\u{03B9}\u{03BF}\u{03C4}\u{03B1}\u{03BD}", 78, 1, None),
+    Among("\u{03B1}\u{03B3}\u{03B1}\u{03BD}", 65, 1, None),
+    Among("\u{03B7}\u{03BA}\u{03B1}\u{03BD}", 65, 1, None),
+    Among("\u{03B7}\u{03B8}\u{03B7}\u{03BA}\u{03B1}\u{03BD}", 81, 1, None),
+    Among("\u{03BF}", -1, 1, None),
+];
+
+static A_67: &'static [Among<Context>; 8] = &[
+    Among("\u{03B5}\u{03C3}\u{03C4}\u{03B5}\u{03C1}", -1, 1, None),
+    Among("\u{03C5}\u{03C4}\u{03B5}\u{03C1}", -1, 1, None),
+    Among("\u{03C9}\u{03C4}\u{03B5}\u{03C1}", -1, 1, None),
+    Among("\u{03BF}\u{03C4}\u{03B5}\u{03C1}", -1, 1, None),
+    Among("\u{03B5}\u{03C3}\u{03C4}\u{03B1}\u{03C4}", -1, 1, None),
+    Among("\u{03C5}\u{03C4}\u{03B1}\u{03C4}", -1, 1, None),
+    Among("\u{03C9}\u{03C4}\u{03B1}\u{03C4}", -1, 1, None),
+    Among("\u{03BF}\u{03C4}\u{03B1}\u{03C4}", -1, 1, None),
+];
+
+static G_v: &'static [u8; 4] = &[81, 65, 16, 1];
+
+static G_v2: &'static [u8; 4] = &[81, 65, 0, 1];
+
+#[derive(Clone)]
+struct Context {
+    b_test1: bool,
+}
+
+pub fn stem(env: &mut SnowballEnv) -> bool {
+    let mut context = &mut Context {
+        b_test1: false,
+    };
+    let mut among_var;
+    env.limit_backward = env.cursor;
+    env.cursor = env.limit;
+    let v_1 = env.limit - env.cursor;
+    'lab0: loop {
+        'replab1: loop{
+            let v_2 = env.limit - env.cursor;
+            'lab2: for _ in 0..1 {
+                env.ket = env.cursor;
+                among_var = env.find_among_b(A_0, context);
+                if among_var == 0 {
+                    break 'lab2;
+                }
+                env.bra = env.cursor;
+                if among_var == 1 {
+                    if !env.slice_from("\u{03B1}") {
+                        return false;
+                    }
+                } else if among_var == 2 {
+                    if !env.slice_from("\u{03B2}") {
+                        return false;
+                    }
+                } else if among_var == 3 {
+                    if !env.slice_from("\u{03B3}") {
+                        return false;
+                    }
+                } else if among_var == 4 {
+                    if !env.slice_from("\u{03B4}") {
+                        return false;
+                    }
+                } else if among_var == 5 {
+                    if !env.slice_from("\u{03B5}") {
+                        return false;
+                    }
+                } else if among_var == 6 {
+                    if !env.slice_from("\u{03B6}") {
+                        return false;
+                    }
+                } else if among_var == 7 {
+                    if !env.slice_from("\u{03B7}") {
+                        return false;
+                    }
+                } else if among_var == 8 {
+                    if !env.slice_from("\u{03B8}") {
+                        return false;
+                    }
+                } else if among_var == 9 {
+                    if !env.slice_from("\u{03B9}") {
+                        return false;
+                    }
+                } else if among_var == 10 {
+                    if !env.slice_from("\u{03BA}") {
+                        return false;
+                    }
+                } else if among_var == 11 {
+                    if !env.slice_from("\u{03BB}") {
+                        return false;
+                    }
+                } else if among_var == 12 {
+                    if !env.slice_from("\u{03BC}") {
+                        return false;
+                    }
+                } else if among_var == 13 {
+                    if !env.slice_from("\u{03BD}") {
+                        return false;
+                    }
+                } else if among_var == 14 {
+                    if !env.slice_from("\u{03BE}") {
+                        return false;
+                    }
+                } else if among_var == 15 {
+                    if !env.slice_from("\u{03BF}") {
+                        return false;
+                    }
+                } else if among_var == 16 {
+                    if !env.slice_from("\u{03C0}") {
+                        return false;
+                    }
+                } else if among_var == 17 {
+                    if !env.slice_from("\u{03C1}") {
+                        return false;
+                    }
+                } else if among_var == 18 {
+                    if !env.slice_from("\u{03C3}") {
+                        return false;
+                    }
+                } else if among_var == 19 {
+                    if !env.slice_from("\u{03C4}") {
+                        return false;
+                    }
+                } else if among_var == 20 {
+                    if !env.slice_from("\u{03C5}") {
+                        return false;
+                    }
+                } else if among_var == 21 {
+                    if !env.slice_from("\u{03C6}") {
+                        return false;
+                    }
+                } else if among_var == 22 {
+                    if !env.slice_from("\u{03C7}") {
+                        return false;
+                    }
+                } else if among_var == 23 {
+                    if !env.slice_from("\u{03C8}") {
+                        return false;
+                    }
+                } else if among_var == 24 {
+                    if !env.slice_from("\u{03C9}") {
+                        return false;
+                    }
+                } else if among_var == 25 {
+                    if env.cursor <= env.limit_backward {
+                        break 'lab2;
+                    }
+                    env.previous_char();
+                }
+                continue 'replab1;
+            }
+            env.cursor = env.limit - v_2;
+            break 'replab1;
+        }
+        break 'lab0;
+    }
+    env.cursor = env.limit - v_1;
+    if !((env.current.chars().count() as i32) >= 3){
+        return false;
+    }
+    context.b_test1 = true;
+    let v_3 = env.limit - env.cursor;
+    'lab3: loop {
+        env.ket = env.cursor;
+        among_var = env.find_among_b(A_1, context);
+        if among_var == 0 {
+            break 'lab3;
+        }
+        env.bra = env.cursor;
+        if among_var == 1 {
+            if !env.slice_from("\u{03C6}\u{03B1}") {
+                return false;
+            }
+        } else if among_var == 2 {
+            if !env.slice_from("\u{03C3}\u{03BA}\u{03B1}") {
+                return false;
+            }
+        } else if among_var == 3 {
+            if !env.slice_from("\u{03BF}\u{03BB}\u{03BF}") {
+                return false;
+            }
+        } else if among_var == 4 {
+            if !env.slice_from("\u{03C3}\u{03BF}") {
+                return false;
+            }
+        } else if among_var == 5 {
+            if !env.slice_from("\u{03C4}\u{03B1}\u{03C4}\u{03BF}") {
+                return false;
+            }
+        } else if among_var == 6 {
+            if !env.slice_from("\u{03BA}\u{03C1}\u{03B5}") {
+                return false;
+            }
+        } else if among_var == 7 {
+            if !env.slice_from("\u{03C0}\u{03B5}\u{03C1}") {
+                return false;
+            }
+        } else if among_var == 8 {
+            if !env.slice_from("\u{03C4}\u{03B5}\u{03C1}") {
+                return false;
+            }
+        } else if among_var == 9 {
+            if !env.slice_from("\u{03C6}\u{03C9}") {
+                return false;
+            }
+        } else if among_var == 10 {
+            if !env.slice_from("\u{03BA}\u{03B1}\u{03B8}\u{03B5}\u{03C3}\u{03C4}") {
+                return false;
+            }
+        } else if among_var == 11 {
+            if !env.slice_from("\u{03B3}\u{03B5}\u{03B3}\u{03BF}\u{03BD}") {
+                return false;
+            }
+        }
+        context.b_test1 = false;
+        break 'lab3;
+    }
+    env.cursor = env.limit - v_3;
+    let v_4 = env.limit - env.cursor;
+    'lab4: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_3, context) == 0 {
+            break 'lab4;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        env.ket = env.cursor;
+        env.bra = env.cursor;
+        among_var = env.find_among_b(A_2, context);
+        if among_var == 0 {
+            break 'lab4;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab4;
+        }
+        if among_var == 1 {
+            if !env.slice_from("\u{03B9}") {
+                return false;
+            }
+        } else if among_var == 2 {
+            if !env.slice_from("\u{03B9}\u{03B6}") {
+                return false;
+            }
+        }
+        break 'lab4;
+    }
+    env.cursor = env.limit - v_4;
+    let v_5 = env.limit - env.cursor;
+    'lab5: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_5, context) == 0 {
+            break 'lab5;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        env.ket = env.cursor;
+        env.bra = env.cursor;
+        if env.find_among_b(A_4, context) == 0 {
+            break 'lab5;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab5;
+        }
+        if !env.slice_from("\u{03C9}\u{03BD}") {
+            return false;
+        }
+        break 'lab5;
+    }
+    env.cursor = env.limit - v_5;
+    let v_6 = env.limit - env.cursor;
+    'lab6: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_7, context) == 0 {
+            break 'lab6;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        'lab7: loop {
+            let v_7 = env.limit - env.cursor;
+            'lab8: loop {
+                if !env.eq_s_b(&"\u{03B9}\u{03C3}\u{03B1}") {
+                    break 'lab8;
+                }
+                if env.cursor > env.limit_backward {
+                    break 'lab8;
+                }
+                if !env.slice_from("\u{03B9}\u{03C3}") {
+                    return false;
+                }
+                break 'lab7;
+            }
+            env.cursor = env.limit - v_7;
+            env.ket = env.cursor;
+            env.bra = env.cursor;
+            among_var = env.find_among_b(A_6, context);
+            if among_var == 0 {
+                break 'lab6;
+            }
+            if env.cursor > env.limit_backward {
+                break 'lab6;
+            }
+            if among_var == 1 {
+                if !env.slice_from("\u{03B9}") {
+                    return false;
+                }
+            } else if among_var == 2 {
+                if !env.slice_from("\u{03B9}\u{03C3}") {
+                    return false;
+                }
+            }
+            break 'lab7;
+        }
+        break 'lab6;
+    }
+    env.cursor = env.limit - v_6;
+    let v_8 = env.limit - env.cursor;
+    'lab9: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_9, context) == 0 {
+            break 'lab9;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        env.ket = env.cursor;
+        env.bra = env.cursor;
+        if env.find_among_b(A_8, context) == 0 {
+            break 'lab9;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab9;
+        }
+        if !env.slice_from("\u{03B9}") {
+            return false;
+        }
+        break 'lab9;
+    }
+    env.cursor = env.limit - v_8;
+    let v_9 = env.limit - env.cursor;
+    'lab10: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_11, context) == 0 {
+            break 'lab10;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        env.ket = env.cursor;
+        env.bra = env.cursor;
+        among_var = env.find_among_b(A_10, context);
+        if among_var == 0 {
+            break 'lab10;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab10;
+        }
+        if among_var == 1 {
+            if !env.slice_from("\u{03B9}") {
+                return false;
+            }
+        } else if among_var == 2 {
+            if !env.slice_from("\u{03B9}\u{03C3}\u{03C4}") {
+                return false;
+            }
+        }
+        break 'lab10;
+    }
+    env.cursor = env.limit - v_9;
+    let v_10 = env.limit - env.cursor;
+    'lab11: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_14, context) == 0 {
+            break 'lab11;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        'lab12: loop {
+            let v_11 = env.limit - env.cursor;
+            'lab13: loop {
+                env.ket = env.cursor;
+                env.bra = env.cursor;
+                among_var = env.find_among_b(A_12, context);
+                if among_var == 0 {
+                    break 'lab13;
+                }
+                if env.cursor > env.limit_backward {
+                    break 'lab13;
+                }
+                if among_var == 1 {
+                    if !env.slice_from("\u{03B9}\u{03C3}\u{03BC}") {
+                        return false;
+                    }
+                } else if among_var == 2 {
+                    if !env.slice_from("\u{03B9}") {
+                        return false;
+                    }
+                }
+                break 'lab12;
+            }
+            env.cursor = env.limit - v_11;
+            env.ket = env.cursor;
+            among_var = env.find_among_b(A_13, context);
+            if among_var == 0 {
+                break 'lab11;
+            }
+            env.bra = env.cursor;
+            if among_var == 1 {
+                if !env.slice_from("\u{03B1}\u{03B3}\u{03BD}\u{03C9}\u{03C3}\u{03C4}") {
+                    return false;
+                }
+            } else if among_var == 2 {
+                if !env.slice_from("\u{03B1}\u{03C4}\u{03BF}\u{03BC}") {
+                    return false;
+                }
+            } else if among_var == 3 {
+                if !env.slice_from("\u{03B3}\u{03BD}\u{03C9}\u{03C3}\u{03C4}") {
+                    return false;
+                }
+            } else if among_var == 4 {
+                if !env.slice_from("\u{03B5}\u{03B8}\u{03BD}") {
+                    return false;
+                }
+            } else if among_var == 5 {
+                if !env.slice_from("\u{03B5}\u{03BA}\u{03BB}\u{03B5}\u{03BA}\u{03C4}") {
+                    return false;
+                }
+            } else if among_var == 6 {
+                if !env.slice_from("\u{03C3}\u{03BA}\u{03B5}\u{03C0}\u{03C4}") {
+                    return false;
+                }
+            } else if among_var == 7 {
+                if !env.slice_from("\u{03C4}\u{03BF}\u{03C0}") {
+                    return false;
+                }
+            } else if among_var == 8 {
+                if !env.slice_from("\u{03B1}\u{03BB}\u{03B5}\u{03BE}\u{03B1}\u{03BD}\u{03B4}\u{03C1}") {
+                    return false;
+                }
+            } else if among_var == 9 {
+                if !env.slice_from("\u{03B2}\u{03C5}\u{03B6}\u{03B1}\u{03BD}\u{03C4}") {
+                    return false;
+                }
+            } else if among_var == 10 {
+                if !env.slice_from("\u{03B8}\u{03B5}\u{03B1}\u{03C4}\u{03C1}") {
+                    return false;
+                }
+            }
+            break 'lab12;
+        }
+        break 'lab11;
+    }
+    env.cursor = env.limit - v_10;
+    let v_12 = env.limit - env.cursor;
+    'lab14: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_16, context) == 0 {
+            break 'lab14;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        env.ket = env.cursor;
+        env.bra = env.cursor;
+        if env.find_among_b(A_15, context) == 0 {
+            break 'lab14;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab14;
+        }
+        if !env.slice_from("\u{03B1}\u{03C1}\u{03B1}\u{03BA}") {
+            return false;
+        }
+        break 'lab14;
+    }
+    env.cursor = env.limit - v_12;
+    let v_13 = env.limit - env.cursor;
+    'lab15: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_18, context) == 0 {
+            break 'lab15;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        'lab16: loop {
+            let v_14 = env.limit - env.cursor;
+            'lab17: loop {
+                env.ket = env.cursor;
+                env.bra = env.cursor;
+                among_var = env.find_among_b(A_17, context);
+                if among_var == 0 {
+                    break 'lab17;
+                }
+                if env.cursor > env.limit_backward {
+                    break 'lab17;
+                }
+                if among_var == 1 {
+                    if !env.slice_from("\u{03B1}\u{03BA}") {
+                        return false;
+                    }
+                } else if among_var == 2 {
+                    if !env.slice_from("\u{03B9}\u{03C4}\u{03C3}") {
+                        return false;
+                    }
+                }
+                break 'lab16;
+            }
+            env.cursor = env.limit - v_14;
+            env.ket = env.cursor;
+            env.bra = env.cursor;
+            if !env.eq_s_b(&"\u{03BA}\u{03BF}\u{03C1}") {
+                break 'lab15;
+            }
+            if !env.slice_from("\u{03B9}\u{03C4}\u{03C3}") {
+                return false;
+            }
+            break 'lab16;
+        }
+        break 'lab15;
+    }
+    env.cursor = env.limit - v_13;
+    let v_15 = env.limit - env.cursor;
+    'lab18: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_21, context) == 0 {
+            break 'lab18;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        'lab19: loop {
+            let v_16 = env.limit - env.cursor;
+            'lab20: loop {
+                env.ket = env.cursor;
+                env.bra = env.cursor;
+                if env.find_among_b(A_19, context) == 0 {
+                    break 'lab20;
+                }
+                if env.cursor > env.limit_backward {
+                    break 'lab20;
+                }
+                if !env.slice_from("\u{03B9}\u{03B4}") {
+                    return false;
+                }
+                break 'lab19;
+            }
+            env.cursor = env.limit - v_16;
+            env.ket = env.cursor;
+            env.bra = env.cursor;
+            if env.find_among_b(A_20, context) == 0 {
+                break 'lab18;
+            }
+            if !env.slice_from("\u{03B9}\u{03B4}") {
+                return false;
+            }
+            break 'lab19;
+        }
+        break 'lab18;
+    }
+    env.cursor = env.limit - v_15;
+    let v_17 = env.limit - env.cursor;
+    'lab21: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_23, context) == 0 {
+            break 'lab21;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        env.ket = env.cursor;
+        env.bra = env.cursor;
+        if env.find_among_b(A_22, context) == 0 {
+            break 'lab21;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab21;
+        }
+        if !env.slice_from("\u{03B9}\u{03C3}\u{03BA}") {
+            return false;
+        }
+        break 'lab21;
+    }
+    env.cursor = env.limit - v_17;
+    let v_18 = env.limit - env.cursor;
+    'lab22: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_24, context) == 0 {
+            break 'lab22;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        let v_19 = env.limit - env.cursor;
+        'lab23: loop {
+            if env.find_among_b(A_25, context) == 0 {
+                break 'lab23;
+            }
+            break 'lab22;
+        }
+        env.cursor = env.limit - v_19;
+        let c = env.cursor;
+        let (bra, ket) = (env.cursor, env.cursor);
+        env.insert(bra, ket, "\u{03B1}\u{03B4}");
+        env.cursor = c;
+        break 'lab22;
+    }
+    env.cursor = env.limit - v_18;
+    let v_20 = env.limit - env.cursor;
+    'lab24: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_26, context) == 0 {
+            break 'lab24;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        env.ket = env.cursor;
+        env.bra = env.cursor;
+        if env.find_among_b(A_27, context) == 0 {
+            break 'lab24;
+        }
+        if !env.slice_from("\u{03B5}\u{03B4}") {
+            return false;
+        }
+        break 'lab24;
+    }
+    env.cursor = env.limit - v_20;
+    let v_21 = env.limit - env.cursor;
+    'lab25: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_28, context) == 0 {
+            break 'lab25;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        env.ket = env.cursor;
+        env.bra = env.cursor;
+        if env.find_among_b(A_29, context) == 0 {
+            break 'lab25;
+        }
+        if !env.slice_from("\u{03BF}\u{03C5}\u{03B4}") {
+            return false;
+        }
+        break 'lab25;
+    }
+    env.cursor = env.limit - v_21;
+    let v_22 = env.limit - env.cursor;
+    'lab26: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_30, context) == 0 {
+            break 'lab26;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        env.ket = env.cursor;
+        env.bra = env.cursor;
+        if env.find_among_b(A_31, context) == 0 {
+            break 'lab26;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab26;
+        }
+        if !env.slice_from("\u{03B5}") {
+            return false;
+        }
+        break 'lab26;
+    }
+    env.cursor = env.limit - v_22;
+    let v_23 = env.limit - env.cursor;
+    'lab27: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_32, context) == 0 {
+            break 'lab27;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        env.ket = env.cursor;
+        env.bra = env.cursor;
+        if !env.in_grouping_b(G_v, 945, 969) {
+            break 'lab27;
+        }
+        if !env.slice_from("\u{03B9}") {
+            return false;
+        }
+        break 'lab27;
+    }
+    env.cursor = env.limit - v_23;
+    let v_24 = env.limit - env.cursor;
+    'lab28: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_33, context) == 0 {
+            break 'lab28;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        'lab29: loop {
+            let v_25 = env.limit - env.cursor;
+            'lab30: loop {
+                env.ket = env.cursor;
+                env.bra = env.cursor;
+                if !env.in_grouping_b(G_v, 945, 969) {
+                    break 'lab30;
+                }
+                if !env.slice_from("\u{03B9}\u{03BA}") {
+                    return false;
+                }
+                break 'lab29;
+            }
+            env.cursor = env.limit - v_25;
+            env.ket = env.cursor;
+            break 'lab29;
+        }
+        env.bra = env.cursor;
+        if env.find_among_b(A_34, context) == 0 {
+            break 'lab28;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab28;
+        }
+        if !env.slice_from("\u{03B9}\u{03BA}") {
+            return false;
+        }
+        break 'lab28;
+    }
+    env.cursor = env.limit - v_24;
+    let v_26 = env.limit - env.cursor;
+    'lab31: loop {
+        let v_27 = env.limit - env.cursor;
+        'lab32: loop {
+            if !env.eq_s_b(&"\u{03B1}\u{03B3}\u{03B1}\u{03BC}\u{03B5}") {
+                break 'lab32;
+            }
+            if env.cursor > env.limit_backward {
+                break 'lab32;
+            }
+            if !env.slice_from("\u{03B1}\u{03B3}\u{03B1}\u{03BC}") {
+                return false;
+            }
+            break 'lab32;
+        }
+        env.cursor = env.limit - v_27;
+        let v_28 = env.limit - env.cursor;
+        'lab33: loop {
+            env.ket = env.cursor;
+            if env.find_among_b(A_35, context) == 0 {
+                break 'lab33;
+            }
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            context.b_test1 = false;
+            break 'lab33;
+        }
+        env.cursor = env.limit - v_28;
+        env.ket = env.cursor;
+        if !env.eq_s_b(&"\u{03B1}\u{03BC}\u{03B5}") {
+            break 'lab31;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        env.ket = env.cursor;
+        env.bra = env.cursor;
+        if env.find_among_b(A_36, context) == 0 {
+            break 'lab31;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab31;
+        }
+        if !env.slice_from("\u{03B1}\u{03BC}") {
+            return false;
+        }
+        break 'lab31;
+    }
+    env.cursor = env.limit - v_26;
+    let v_29 = env.limit - env.cursor;
+    'lab34: loop {
+        let v_30 = env.limit - env.cursor;
+        'lab35: loop {
+            env.ket = env.cursor;
+            if env.find_among_b(A_38, context) == 0 {
+                break 'lab35;
+            }
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            context.b_test1 = false;
+            env.ket = env.cursor;
+            env.bra = env.cursor;
+            if env.find_among_b(A_37, context) == 0 {
+                break 'lab35;
+            }
+            if env.cursor > env.limit_backward {
+                break 'lab35;
+            }
+            if !env.slice_from("\u{03B1}\u{03B3}\u{03B1}\u{03BD}") {
+                return false;
+            }
+            break 'lab35;
+        }
+        env.cursor = env.limit - v_30;
+        env.ket = env.cursor;
+        if !env.eq_s_b(&"\u{03B1}\u{03BD}\u{03B5}") {
+            break 'lab34;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        'lab36: loop {
+            let v_31 = env.limit - env.cursor;
+            'lab37: loop {
+                env.ket = env.cursor;
+                env.bra = env.cursor;
+                if !env.in_grouping_b(G_v2, 945, 969) {
+                    break 'lab37;
+                }
+                if !env.slice_from("\u{03B1}\u{03BD}") {
+                    return false;
+                }
+                break 'lab36;
+            }
+            env.cursor = env.limit - v_31;
+            env.ket = env.cursor;
+            break 'lab36;
+        }
+        env.bra = env.cursor;
+        if env.find_among_b(A_39, context) == 0 {
+            break 'lab34;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab34;
+        }
+        if !env.slice_from("\u{03B1}\u{03BD}") {
+            return false;
+        }
+        break 'lab34;
+    }
+    env.cursor = env.limit - v_29;
+    let v_32 = env.limit - env.cursor;
+    'lab38: loop {
+        let v_33 = env.limit - env.cursor;
+        'lab39: loop {
+            env.ket = env.cursor;
+            if env.find_among_b(A_40, context) == 0 {
+                break 'lab39;
+            }
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            context.b_test1 = false;
+            break 'lab39;
+        }
+        env.cursor = env.limit - v_33;
+        env.ket = env.cursor;
+        if !env.eq_s_b(&"\u{03B5}\u{03C4}\u{03B5}") {
+            break 'lab38;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        'lab40: loop {
+            let v_34 = env.limit - env.cursor;
+            'lab41: loop {
+                env.ket = env.cursor;
+                env.bra = env.cursor;
+                if !env.in_grouping_b(G_v2, 945, 969) {
+                    break 'lab41;
+                }
+                if !env.slice_from("\u{03B5}\u{03C4}") {
+                    return false;
+                }
+                break 'lab40;
+            }
+            env.cursor = env.limit - v_34;
+            'lab42: loop {
+                env.ket = env.cursor;
+                env.bra = env.cursor;
+                if env.find_among_b(A_41, context) == 0 {
+                    break 'lab42;
+                }
+                if !env.slice_from("\u{03B5}\u{03C4}") {
+                    return false;
+                }
+                break 'lab40;
+            }
+            env.cursor = env.limit - v_34;
+            env.ket = env.cursor;
+            break 'lab40;
+        }
+        env.bra = env.cursor;
+        if env.find_among_b(A_42, context) == 0 {
+            break 'lab38;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab38;
+        }
+        if !env.slice_from("\u{03B5}\u{03C4}") {
+            return false;
+        }
+        break 'lab38;
+    }
+    env.cursor = env.limit - v_32;
+    let v_35 = env.limit - env.cursor;
+    'lab43: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_43, context) == 0 {
+            break 'lab43;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        'lab44: loop {
+            let v_36 = env.limit - env.cursor;
+            'lab45: loop {
+                env.ket = env.cursor;
+                env.bra = env.cursor;
+                if !env.eq_s_b(&"\u{03B1}\u{03C1}\u{03C7}") {
+                    break 'lab45;
+                }
+                if env.cursor > env.limit_backward {
+                    break 'lab45;
+                }
+                if !env.slice_from("\u{03BF}\u{03BD}\u{03C4}") {
+                    return false;
+                }
+                break 'lab44;
+            }
+            env.cursor = env.limit - v_36;
+            env.ket = env.cursor;
+            env.bra = env.cursor;
+            if !env.eq_s_b(&"\u{03BA}\u{03C1}\u{03B5}") {
+                break 'lab43;
+            }
+            if !env.slice_from("\u{03C9}\u{03BD}\u{03C4}") {
+                return false;
+            }
+            break 'lab44;
+        }
+        break 'lab43;
+    }
+    env.cursor = env.limit - v_35;
+    let v_37 = env.limit - env.cursor;
+    'lab46: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_44, context) == 0 {
+            break 'lab46;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        env.ket = env.cursor;
+        env.bra = env.cursor;
+        if !env.eq_s_b(&"\u{03BF}\u{03BD}") {
+            break 'lab46;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab46;
+        }
+        if !env.slice_from("\u{03BF}\u{03BC}\u{03B1}\u{03C3}\u{03C4}") {
+            return false;
+        }
+        break 'lab46;
+    }
+    env.cursor = env.limit - v_37;
+    let v_38 = env.limit - env.cursor;
+    'lab47: loop {
+        let v_39 = env.limit - env.cursor;
+        'lab48: loop {
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"\u{03B9}\u{03B5}\u{03C3}\u{03C4}\u{03B5}") {
+                break 'lab48;
+            }
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            context.b_test1 = false;
+            env.ket = env.cursor;
+            env.bra = env.cursor;
+            if env.find_among_b(A_45, context) == 0 {
+                break 'lab48;
+            }
+            if env.cursor > env.limit_backward {
+                break 'lab48;
+            }
+            if !env.slice_from("\u{03B9}\u{03B5}\u{03C3}\u{03C4}") {
+                return false;
+            }
+            break 'lab48;
+        }
+        env.cursor = env.limit - v_39;
+        env.ket = env.cursor;
+        if !env.eq_s_b(&"\u{03B5}\u{03C3}\u{03C4}\u{03B5}") {
+            break 'lab47;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        env.ket = env.cursor;
+        env.bra = env.cursor;
+        if env.find_among_b(A_46, context) == 0 {
+            break 'lab47;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab47;
+        }
+        if !env.slice_from("\u{03B9}\u{03B5}\u{03C3}\u{03C4}") {
+            return false;
+        }
+        break 'lab47;
+    }
+    env.cursor = env.limit - v_38;
+    let v_40 = env.limit - env.cursor;
+    'lab49: loop {
+        let v_41 = env.limit - env.cursor;
+        'lab50: loop {
+            env.ket = env.cursor;
+            if env.find_among_b(A_47, context) == 0 {
+                break 'lab50;
+            }
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            context.b_test1 = false;
+            break 'lab50;
+        }
+        env.cursor = env.limit - v_41;
+        env.ket = env.cursor;
+        if env.find_among_b(A_50, context) == 0 {
+            break 'lab49;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        'lab51: loop {
+            let v_42 = env.limit - env.cursor;
+            'lab52: loop {
+                env.ket = env.cursor;
+                env.bra = env.cursor;
+                if env.find_among_b(A_48, context) == 0 {
+                    break 'lab52;
+                }
+                if !env.slice_from("\u{03B7}\u{03BA}") {
+                    return false;
+                }
+                break 'lab51;
+            }
+            env.cursor = env.limit - v_42;
+            env.ket = env.cursor;
+            env.bra = env.cursor;
+            if env.find_among_b(A_49, context) == 0 {
+                break 'lab49;
+            }
+            if env.cursor > env.limit_backward {
+                break 'lab49;
+            }
+            if !env.slice_from("\u{03B7}\u{03BA}") {
+                return false;
+            }
+            break 'lab51;
+        }
+        break 'lab49;
+    }
+    env.cursor = env.limit - v_40;
+    let v_43 = env.limit - env.cursor;
+    'lab53: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_53, context) == 0 {
+            break 'lab53;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        'lab54: loop {
+            let v_44 = env.limit - env.cursor;
+            'lab55: loop {
+                env.ket = env.cursor;
+                env.bra = env.cursor;
+                if env.find_among_b(A_51, context) == 0 {
+                    break 'lab55;
+                }
+                if !env.slice_from("\u{03BF}\u{03C5}\u{03C3}") {
+                    return false;
+                }
+                break 'lab54;
+            }
+            env.cursor = env.limit - v_44;
+            env.ket = env.cursor;
+            env.bra = env.cursor;
+            if env.find_among_b(A_52, context) == 0 {
+                break 'lab53;
+            }
+            if env.cursor > env.limit_backward {
+                break 'lab53;
+            }
+            if !env.slice_from("\u{03BF}\u{03C5}\u{03C3}") {
+                return false;
+            }
+            break 'lab54;
+        }
+        break 'lab53;
+    }
+    env.cursor = env.limit - v_43;
+    let v_45 = env.limit - env.cursor;
+    'lab56: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_57, context) == 0 {
+            break 'lab56;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        env.ket = env.cursor;
+        env.bra = env.cursor;
+        if env.find_among_b(A_58, context) == 0 {
+            break 'lab56;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab56;
+        }
+        if !env.slice_from("\u{03B7}\u{03C3}") {
+            return false;
+        }
+        break 'lab56;
+    }
+    env.cursor = env.limit - v_45;
+    let v_46 = env.limit - env.cursor;
+    'lab57: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_56, context) == 0 {
+            break 'lab57;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        'lab58: loop {
+            let v_47 = env.limit - env.cursor;
+            'lab59: loop {
+                env.ket = env.cursor;
+                env.bra = env.cursor;
+                if !env.eq_s_b(&"\u{03BA}\u{03BF}\u{03BB}\u{03BB}") {
+                    break 'lab59;
+                }
+                if !env.slice_from("\u{03B1}\u{03B3}") {
+                    return false;
+                }
+                break 'lab58;
+            }
+            env.cursor = env.limit - v_47;
+            'lab60: loop {
+                let v_48 = env.limit - env.cursor;
+                'lab61: loop {
+                    env.ket = env.cursor;
+                    env.bra = env.cursor;
+                    among_var = env.find_among_b(A_54, context);
+                    if among_var == 0 {
+                        break 'lab61;
+                    }
+                    if among_var == 1 {
+                        if !env.slice_from("\u{03B1}\u{03B3}") {
+                            return false;
+                        }
+                    }
+                    break 'lab60;
+                }
+                env.cursor = env.limit - v_48;
+                env.ket = env.cursor;
+                env.bra = env.cursor;
+                if env.find_among_b(A_55, context) == 0 {
+                    break 'lab57;
+                }
+                if env.cursor > env.limit_backward {
+                    break 'lab57;
+                }
+                if !env.slice_from("\u{03B1}\u{03B3}") {
+                    return false;
+                }
+                break 'lab60;
+            }
+            break 'lab58;
+        }
+        break 'lab57;
+    }
+    env.cursor = env.limit - v_46;
+    let v_49 = env.limit - env.cursor;
+    'lab62: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_59, context) == 0 {
+            break 'lab62;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        env.ket = env.cursor;
+        env.bra = env.cursor;
+        if env.find_among_b(A_60, context) == 0 {
+            break 'lab62;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab62;
+        }
+        if !env.slice_from("\u{03B7}\u{03C3}\u{03C4}") {
+            return false;
+        }
+        break 'lab62;
+    }
+    env.cursor = env.limit - v_49;
+    let v_50 = env.limit - env.cursor;
+    'lab63: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_61, context) == 0 {
+            break 'lab63;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        env.ket = env.cursor;
+        env.bra = env.cursor;
+        if env.find_among_b(A_62, context) == 0 {
+            break 'lab63;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab63;
+        }
+        if !env.slice_from("\u{03BF}\u{03C5}\u{03BD}") {
+            return false;
+        }
+        break 'lab63;
+    }
+    env.cursor = env.limit - v_50;
+    let v_51 = env.limit - env.cursor;
+    'lab64: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_63, context) == 0 {
+            break 'lab64;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_test1 = false;
+        env.ket = env.cursor;
+        env.bra = env.cursor;
+        if env.find_among_b(A_64, context) == 0 {
+            break 'lab64;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab64;
+        }
+        if !env.slice_from("\u{03BF}\u{03C5}\u{03BC}") {
+            return false;
+        }
+        break 'lab64;
+    }
+    env.cursor = env.limit - v_51;
+    let v_52 = env.limit - env.cursor;
+    'lab65: loop {
+        let v_53 = env.limit - env.cursor;
+        'lab66: loop {
+            env.ket = env.cursor;
+            if env.find_among_b(A_65, context) == 0 {
+                break 'lab66;
+            }
+            env.bra = env.cursor;
+            if !env.slice_from("\u{03BC}\u{03B1}") {
+                return false;
+            }
+            break 'lab66;
+        }
+        env.cursor = env.limit - v_53;
+        if !context.b_test1 {
+            break 'lab65;
+        }
+        env.ket = env.cursor;
+        if env.find_among_b(A_66, context) == 0 {
+            break 'lab65;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        break 'lab65;
+    }
+    env.cursor = env.limit - v_52;
+    let v_54 = env.limit - env.cursor;
+    'lab67: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_67, context) == 0 {
+            break 'lab67;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        break 'lab67;
+    }
+    env.cursor = env.limit - v_54;
+    env.cursor = env.limit_backward;
+    return true;
+}
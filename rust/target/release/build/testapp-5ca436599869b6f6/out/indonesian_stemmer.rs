@@ -0,0 +1,357 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+#![allow(non_snake_case)]
+#![allow(non_upper_case_globals)]
+#![allow(unused_mut)]
+#![allow(unused_parens)]
+#![allow(unused_variables)]
+use snowball::SnowballEnv;
+use snowball::Among;
+
+static A_0: &'static [Among<Context>; 3] = &[
+    Among("kah", -1, 1, None),
+    Among("lah", -1, 1, None),
+    Among("pun", -1, 1, None),
+];
+
+static A_1: &'static [Among<Context>; 3] = &[
+    Among("nya", -1, 1, None),
+    Among("ku", -1, 1, None),
+    Among("mu", -1, 1, None),
+];
+
+static A_2: &'static [Among<Context>; 3] = &[
+    Among("i", -1, 1, Some(&r_SUFFIX_I_OK)),
+    Among("an", -1, 1, Some(&r_SUFFIX_AN_OK)),
+    Among("kan", 1, 1, Some(&r_SUFFIX_KAN_OK)),
+];
+
+static A_3: &'static [Among<Context>; 12] = &[
+    Among("di", -1, 1, None),
+    Among("ke", -1, 2, None),
+    Among("me", -1, 1, None),
+    Among("mem", 2, 5, None),
+    Among("men", 2, 1, None),
+    Among("meng", 4, 1, None),
+    Among("meny", 4, 3, Some(&r_VOWEL)),
+    Among("pem", -1, 6, None),
+    Among("pen", -1, 2, None),
+    Among("peng", 8, 2, None),
+    Among("peny", 8, 4, Some(&r_VOWEL)),
+    Among("ter", -1, 1, None),
+];
+
+static A_4: &'static [Among<Context>; 6] = &[
+    Among("be", -1, 3, Some(&r_KER)),
+    Among("belajar", 0, 4, None),
+    Among("ber", 0, 3, None),
+    Among("pe", -1, 1, None),
+    Among("pelajar", 3, 2, None),
+    Among("per", 3, 1, None),
+];
+
+static G_vowel: &'static [u8; 3] = &[17, 65, 16];
+
+#[derive(Clone)]
+struct Context {
+    i_prefix: i32,
+    i_measure: i32,
+}
+
+fn r_SUFFIX_KAN_OK(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !(context.i_prefix != 3){
+        return false;
+    }
+    if !(context.i_prefix != 2){
+        return false;
+    }
+    return true;
+}
+
+fn r_SUFFIX_AN_OK(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !(context.i_prefix != 1){
+        return false;
+    }
+    return true;
+}
+
+fn r_SUFFIX_I_OK(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !(context.i_prefix <= 2){
+        return false;
+    }
+    let v_1 = env.limit - env.cursor;
+    'lab0: loop {
+        if !env.eq_s_b(&"s") {
+            break 'lab0;
+        }
+        return false;
+    }
+    env.cursor = env.limit - v_1;
+    return true;
+}
+
+fn r_remove_suffix(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    env.ket = env.cursor;
+    if env.find_among_b(A_2, context) == 0 {
+        return false;
+    }
+    env.bra = env.cursor;
+    if !env.slice_del() {
+        return false;
+    }
+    context.i_measure -= 1;
+    return true;
+}
+
+fn r_VOWEL(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !env.in_grouping(G_vowel, 97, 117) {
+        return false;
+    }
+    return true;
+}
+
+fn r_KER(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !env.out_grouping(G_vowel, 97, 117) {
+        return false;
+    }
+    if !env.eq_s(&"er") {
+        return false;
+    }
+    return true;
+}
+
+fn r_remove_second_order_prefix(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    let mut among_var;
+    env.bra = env.cursor;
+    among_var = env.find_among(A_4, context);
+    if among_var == 0 {
+        return false;
+    }
+    env.ket = env.cursor;
+    if among_var == 1 {
+        if !env.slice_del() {
+            return false;
+        }
+        context.i_prefix = 2;
+        context.i_measure -= 1;
+    } else if among_var == 2 {
+        if !env.slice_from("ajar") {
+            return false;
+        }
+        context.i_measure -= 1;
+    } else if among_var == 3 {
+        if !env.slice_del() {
+            return false;
+        }
+        context.i_prefix = 4;
+        context.i_measure -= 1;
+    } else if among_var == 4 {
+        if !env.slice_from("ajar") {
+            return false;
+        }
+        context.i_prefix = 4;
+        context.i_measure -= 1;
+    }
+    return true;
+}
+
+pub fn stem(env: &mut SnowballEnv) -> bool {
+    let mut context = &mut Context {
+        i_prefix: 0,
+        i_measure: 0,
+    };
+    let mut among_var;
+    context.i_measure = 0;
+    let v_1 = env.cursor;
+    'lab0: loop {
+        'replab1: loop{
+            let v_2 = env.cursor;
+            'lab2: for _ in 0..1 {
+                'golab3: loop {
+                    'lab4: loop {
+                        if !env.in_grouping(G_vowel, 97, 117) {
+                            break 'lab4;
+                        }
+                        break 'golab3;
+                    }
+                    if env.cursor >= env.limit {
+                        break 'lab2;
+                    }
+                    env.next_char();
+                }
+                context.i_measure += 1;
+                continue 'replab1;
+            }
+            env.cursor = v_2;
+            break 'replab1;
+        }
+        break 'lab0;
+    }
+    env.cursor = v_1;
+    if !(context.i_measure > 2){
+        return false;
+    }
+    context.i_prefix = 0;
+    env.limit_backward = env.cursor;
+    env.cursor = env.limit;
+    let v_4 = env.limit - env.cursor;
+    'lab5: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_0, context) == 0 {
+            break 'lab5;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.i_measure -= 1;
+        break 'lab5;
+    }
+    env.cursor = env.limit - v_4;
+    if !(context.i_measure > 2){
+        return false;
+    }
+    let v_5 = env.limit - env.cursor;
+    'lab6: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_1, context) == 0 {
+            break 'lab6;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.i_measure -= 1;
+        break 'lab6;
+    }
+    env.cursor = env.limit - v_5;
+    env.cursor = env.limit_backward;
+    if !(context.i_measure > 2){
+        return false;
+    }
+    'lab7: loop {
+        let v_6 = env.cursor;
+        'lab8: loop {
+            let v_7 = env.cursor;
+            env.bra = env.cursor;
+            among_var = env.find_among(A_3, context);
+            if among_var == 0 {
+                break 'lab8;
+            }
+            env.ket = env.cursor;
+            if among_var == 1 {
+                if !env.slice_del() {
+                    return false;
+                }
+                context.i_prefix = 1;
+                context.i_measure -= 1;
+            } else if among_var == 2 {
+                if !env.slice_del() {
+                    return false;
+                }
+                context.i_prefix = 3;
+                context.i_measure -= 1;
+            } else if among_var == 3 {
+                context.i_prefix = 1;
+                if !env.slice_from("s") {
+                    return false;
+                }
+                context.i_measure -= 1;
+            } else if among_var == 4 {
+                context.i_prefix = 3;
+                if !env.slice_from("s") {
+                    return false;
+                }
+                context.i_measure -= 1;
+            } else if among_var == 5 {
+                context.i_prefix = 1;
+                context.i_measure -= 1;
+                'lab9: loop {
+                    let v_8 = env.cursor;
+                    'lab10: loop {
+                        let v_9 = env.cursor;
+                        if !env.in_grouping(G_vowel, 97, 117) {
+                            break 'lab10;
+                        }
+                        env.cursor = v_9;
+                        if !env.slice_from("p") {
+                            return false;
+                        }
+                        break 'lab9;
+                    }
+                    env.cursor = v_8;
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    break 'lab9;
+                }
+            } else if among_var == 6 {
+                context.i_prefix = 3;
+                context.i_measure -= 1;
+                'lab11: loop {
+                    let v_10 = env.cursor;
+                    'lab12: loop {
+                        let v_11 = env.cursor;
+                        if !env.in_grouping(G_vowel, 97, 117) {
+                            break 'lab12;
+                        }
+                        env.cursor = v_11;
+                        if !env.slice_from("p") {
+                            return false;
+                        }
+                        break 'lab11;
+                    }
+                    env.cursor = v_10;
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    break 'lab11;
+                }
+            }
+            let v_12 = env.cursor;
+            'lab13: loop {
+                let v_13 = env.cursor;
+                if !(context.i_measure > 2){
+                    break 'lab13;
+                }
+                env.limit_backward = env.cursor;
+                env.cursor = env.limit;
+                if !r_remove_suffix(env, context) {
+                    break 'lab13;
+                }
+                env.cursor = env.limit_backward;
+                env.cursor = v_13;
+                if !(context.i_measure > 2){
+                    break 'lab13;
+                }
+                if !r_remove_second_order_prefix(env, context) {
+                    break 'lab13;
+                }
+                break 'lab13;
+            }
+            env.cursor = v_12;
+            env.cursor = v_7;
+            break 'lab7;
+        }
+        env.cursor = v_6;
+        let v_14 = env.cursor;
+        r_remove_second_order_prefix(env, context);
+        env.cursor = v_14;
+        let v_15 = env.cursor;
+        'lab14: loop {
+            if !(context.i_measure > 2){
+                break 'lab14;
+            }
+            env.limit_backward = env.cursor;
+            env.cursor = env.limit;
+            if !r_remove_suffix(env, context) {
+                break 'lab14;
+            }
+            env.cursor = env.limit_backward;
+            break 'lab14;
+        }
+        env.cursor = v_15;
+        break 'lab7;
+    }
+    return true;
+}
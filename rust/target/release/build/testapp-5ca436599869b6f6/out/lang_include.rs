@@ -0,0 +1,29 @@
+pub mod arabic_stemmer;
+pub mod basque_stemmer;
+pub mod french_stemmer;
+pub mod serbian_stemmer;
+pub mod porter_stemmer;
+pub mod swedish_stemmer;
+pub mod english_stemmer;
+pub mod greek_stemmer;
+pub mod german_stemmer;
+pub mod russian_stemmer;
+pub mod norwegian_stemmer;
+pub mod armenian_stemmer;
+pub mod indonesian_stemmer;
+pub mod yiddish_stemmer;
+pub mod portuguese_stemmer;
+pub mod dutch_stemmer;
+pub mod lithuanian_stemmer;
+pub mod spanish_stemmer;
+pub mod tamil_stemmer;
+pub mod hindi_stemmer;
+pub mod catalan_stemmer;
+pub mod danish_stemmer;
+pub mod finnish_stemmer;
+pub mod irish_stemmer;
+pub mod turkish_stemmer;
+pub mod italian_stemmer;
+pub mod hungarian_stemmer;
+pub mod nepali_stemmer;
+pub mod romanian_stemmer;
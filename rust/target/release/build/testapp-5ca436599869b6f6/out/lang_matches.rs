@@ -0,0 +1,36 @@
+
+         move |lang:String|{
+         match lang.as_str() {"arabic" => Stemmer { stemmer: snowball::algorithms::arabic_stemmer::stem},
+"basque" => Stemmer { stemmer: snowball::algorithms::basque_stemmer::stem},
+"french" => Stemmer { stemmer: snowball::algorithms::french_stemmer::stem},
+"serbian" => Stemmer { stemmer: snowball::algorithms::serbian_stemmer::stem},
+"porter" => Stemmer { stemmer: snowball::algorithms::porter_stemmer::stem},
+"swedish" => Stemmer { stemmer: snowball::algorithms::swedish_stemmer::stem},
+"english" => Stemmer { stemmer: snowball::algorithms::english_stemmer::stem},
+"greek" => Stemmer { stemmer: snowball::algorithms::greek_stemmer::stem},
+"german" => Stemmer { stemmer: snowball::algorithms::german_stemmer::stem},
+"russian" => Stemmer { stemmer: snowball::algorithms::russian_stemmer::stem},
+"norwegian" => Stemmer { stemmer: snowball::algorithms::norwegian_stemmer::stem},
+"armenian" => Stemmer { stemmer: snowball::algorithms::armenian_stemmer::stem},
+"indonesian" => Stemmer { stemmer: snowball::algorithms::indonesian_stemmer::stem},
+"yiddish" => Stemmer { stemmer: snowball::algorithms::yiddish_stemmer::stem},
+"portuguese" => Stemmer { stemmer: snowball::algorithms::portuguese_stemmer::stem},
+"dutch" => Stemmer { stemmer: snowball::algorithms::dutch_stemmer::stem},
+"lithuanian" => Stemmer { stemmer: snowball::algorithms::lithuanian_stemmer::stem},
+"spanish" => Stemmer { stemmer: snowball::algorithms::spanish_stemmer::stem},
+"tamil" => Stemmer { stemmer: snowball::algorithms::tamil_stemmer::stem},
+"hindi" => Stemmer { stemmer: snowball::algorithms::hindi_stemmer::stem},
+"catalan" => Stemmer { stemmer: snowball::algorithms::catalan_stemmer::stem},
+"danish" => Stemmer { stemmer: snowball::algorithms::danish_stemmer::stem},
+"finnish" => Stemmer { stemmer: snowball::algorithms::finnish_stemmer::stem},
+"irish" => Stemmer { stemmer: snowball::algorithms::irish_stemmer::stem},
+"turkish" => Stemmer { stemmer: snowball::algorithms::turkish_stemmer::stem},
+"italian" => Stemmer { stemmer: snowball::algorithms::italian_stemmer::stem},
+"hungarian" => Stemmer { stemmer: snowball::algorithms::hungarian_stemmer::stem},
+"nepali" => Stemmer { stemmer: snowball::algorithms::nepali_stemmer::stem},
+"romanian" => Stemmer { stemmer: snowball::algorithms::romanian_stemmer::stem},
+
+            x => panic!("Unknown algorithm '{}'", x)
+        }
+      }
+    
\ No newline at end of file
@@ -0,0 +1,224 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+#![allow(non_snake_case)]
+#![allow(non_upper_case_globals)]
+#![allow(unused_mut)]
+#![allow(unused_parens)]
+#![allow(unused_variables)]
+use snowball::SnowballEnv;
+use snowball::Among;
+
+static A_0: &'static [Among<Context>; 29] = &[
+    Among("a", -1, 1, None),
+    Among("e", -1, 1, None),
+    Among("ede", 1, 1, None),
+    Among("ande", 1, 1, None),
+    Among("ende", 1, 1, None),
+    Among("ane", 1, 1, None),
+    Among("ene", 1, 1, None),
+    Among("hetene", 6, 1, None),
+    Among("erte", 1, 3, None),
+    Among("en", -1, 1, None),
+    Among("heten", 9, 1, None),
+    Among("ar", -1, 1, None),
+    Among("er", -1, 1, None),
+    Among("heter", 12, 1, None),
+    Among("s", -1, 2, None),
+    Among("as", 14, 1, None),
+    Among("es", 14, 1, None),
+    Among("edes", 16, 1, None),
+    Among("endes", 16, 1, None),
+    Among("enes", 16, 1, None),
+    Among("hetenes", 19, 1, None),
+    Among("ens", 14, 1, None),
+    Among("hetens", 21, 1, None),
+    Among("ers", 14, 1, None),
+    Among("ets", 14, 1, None),
+    Among("et", -1, 1, None),
+    Among("het", 25, 1, None),
+    Among("ert", -1, 3, None),
+    Among("ast", -1, 1, None),
+];
+
+static A_1: &'static [Among<Context>; 2] = &[
+    Among("dt", -1, -1, None),
+    Among("vt", -1, -1, None),
+];
+
+static A_2: &'static [Among<Context>; 11] = &[
+    Among("leg", -1, 1, None),
+    Among("eleg", 0, 1, None),
+    Among("ig", -1, 1, None),
+    Among("eig", 2, 1, None),
+    Among("lig", 2, 1, None),
+    Among("elig", 4, 1, None),
+    Among("els", -1, 1, None),
+    Among("lov", -1, 1, None),
+    Among("elov", 7, 1, None),
+    Among("slov", 7, 1, None),
+    Among("hetslov", 9, 1, None),
+];
+
+static G_v: &'static [u8; 19] = &[17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 128];
+
+static G_s_ending: &'static [u8; 4] = &[119, 125, 149, 1];
+
+#[derive(Clone)]
+struct Context {
+    i_x: i32,
+    i_p1: i32,
+}
+
+pub fn stem(env: &mut SnowballEnv) -> bool {
+    let mut context = &mut Context {
+        i_x: 0,
+        i_p1: 0,
+    };
+    let mut among_var;
+    let v_1 = env.cursor;
+    'lab0: loop {
+        context.i_p1 = env.limit;
+        let v_2 = env.cursor;
+        if !env.hop(3) {
+            break 'lab0;
+        }
+        context.i_x = env.cursor;
+        env.cursor = v_2;
+        'golab1: loop {
+            let v_3 = env.cursor;
+            'lab2: loop {
+                if !env.in_grouping(G_v, 97, 248) {
+                    break 'lab2;
+                }
+                env.cursor = v_3;
+                break 'golab1;
+            }
+            env.cursor = v_3;
+            if env.cursor >= env.limit {
+                break 'lab0;
+            }
+            env.next_char();
+        }
+        'golab3: loop {
+            'lab4: loop {
+                if !env.out_grouping(G_v, 97, 248) {
+                    break 'lab4;
+                }
+                break 'golab3;
+            }
+            if env.cursor >= env.limit {
+                break 'lab0;
+            }
+            env.next_char();
+        }
+        context.i_p1 = env.cursor;
+        'lab5: loop {
+            if !(context.i_p1 < context.i_x){
+                break 'lab5;
+            }
+            context.i_p1 = context.i_x;
+            break 'lab5;
+        }
+        break 'lab0;
+    }
+    env.cursor = v_1;
+    env.limit_backward = env.cursor;
+    env.cursor = env.limit;
+    let v_6 = env.limit - env.cursor;
+    'lab6: loop {
+        if env.cursor < context.i_p1 {
+            break 'lab6;
+        }
+        let v_8 = env.limit_backward;
+        env.limit_backward = context.i_p1;
+        env.ket = env.cursor;
+        among_var = env.find_among_b(A_0, context);
+        if among_var == 0 {
+            env.limit_backward = v_8;
+            break 'lab6;
+        }
+        env.bra = env.cursor;
+        env.limit_backward = v_8;
+        if among_var == 1 {
+            if !env.slice_del() {
+                return false;
+            }
+        } else if among_var == 2 {
+            'lab7: loop {
+                let v_9 = env.limit - env.cursor;
+                'lab8: loop {
+                    if !env.in_grouping_b(G_s_ending, 98, 122) {
+                        break 'lab8;
+                    }
+                    break 'lab7;
+                }
+                env.cursor = env.limit - v_9;
+                if !env.eq_s_b(&"k") {
+                    break 'lab6;
+                }
+                if !env.out_grouping_b(G_v, 97, 248) {
+                    break 'lab6;
+                }
+                break 'lab7;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+        } else if among_var == 3 {
+            if !env.slice_from("er") {
+                return false;
+            }
+        }
+        break 'lab6;
+    }
+    env.cursor = env.limit - v_6;
+    let v_10 = env.limit - env.cursor;
+    'lab9: loop {
+        let v_11 = env.limit - env.cursor;
+        if env.cursor < context.i_p1 {
+            break 'lab9;
+        }
+        let v_13 = env.limit_backward;
+        env.limit_backward = context.i_p1;
+        env.ket = env.cursor;
+        if env.find_among_b(A_1, context) == 0 {
+            env.limit_backward = v_13;
+            break 'lab9;
+        }
+        env.bra = env.cursor;
+        env.limit_backward = v_13;
+        env.cursor = env.limit - v_11;
+        if env.cursor <= env.limit_backward {
+            break 'lab9;
+        }
+        env.previous_char();
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        break 'lab9;
+    }
+    env.cursor = env.limit - v_10;
+    let v_14 = env.limit - env.cursor;
+    'lab10: loop {
+        if env.cursor < context.i_p1 {
+            break 'lab10;
+        }
+        let v_16 = env.limit_backward;
+        env.limit_backward = context.i_p1;
+        env.ket = env.cursor;
+        if env.find_among_b(A_2, context) == 0 {
+            env.limit_backward = v_16;
+            break 'lab10;
+        }
+        env.bra = env.cursor;
+        env.limit_backward = v_16;
+        if !env.slice_del() {
+            return false;
+        }
+        break 'lab10;
+    }
+    env.cursor = env.limit - v_14;
+    env.cursor = env.limit_backward;
+    return true;
+}
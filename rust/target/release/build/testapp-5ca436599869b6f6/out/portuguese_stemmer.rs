@@ -0,0 +1,748 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+#![allow(non_snake_case)]
+#![allow(non_upper_case_globals)]
+#![allow(unused_mut)]
+#![allow(unused_parens)]
+#![allow(unused_variables)]
+use snowball::SnowballEnv;
+use snowball::Among;
+
+static A_0: &'static [Among<Context>; 3] = &[
+    Among("", -1, 3, None),
+    Among("\u{00E3}", 0, 1, None),
+    Among("\u{00F5}", 0, 2, None),
+];
+
+static A_1: &'static [Among<Context>; 3] = &[
+    Among("", -1, 3, None),
+    Among("a~", 0, 1, None),
+    Among("o~", 0, 2, None),
+];
+
+static A_2: &'static [Among<Context>; 4] = &[
+    Among("ic", -1, -1, None),
+    Among("ad", -1, -1, None),
+    Among("os", -1, -1, None),
+    Among("iv", -1, 1, None),
+];
+
+static A_3: &'static [Among<Context>; 3] = &[
+    Among("ante", -1, 1, None),
+    Among("avel", -1, 1, None),
+    Among("\u{00ED}vel", -1, 1, None),
+];
+
+static A_4: &'static [Among<Context>; 3] = &[
+    Among("ic", -1, 1, None),
+    Among("abil", -1, 1, None),
+    Among("iv", -1, 1, None),
+];
+
+static A_5: &'static [Among<Context>; 45] = &[
+    Among("ica", -1, 1, None),
+    Among("\u{00E2}ncia", -1, 1, None),
+    Among("\u{00EA}ncia", -1, 4, None),
+    Among("logia", -1, 2, None),
+    Among("ira", -1, 9, None),
+    Among("adora", -1, 1, None),
+    Among("osa", -1, 1, None),
+    Among("ista", -1, 1, None),
+    Among("iva", -1, 8, None),
+    Among("eza", -1, 1, None),
+    Among("idade", -1, 7, None),
+    Among("ante", -1, 1, None),
+    Among("mente", -1, 6, None),
+    Among("amente", 12, 5, None),
+    Among("\u{00E1}vel", -1, 1, None),
+    Among("\u{00ED}vel", -1, 1, None),
+    Among("ico", -1, 1, None),
+    Among("ismo", -1, 1, None),
+    Among("oso", -1, 1, None),
+    Among("amento", -1, 1, None),
+    Among("imento", -1, 1, None),
+    Among("ivo", -1, 8, None),
+    Among("a\u{00E7}a~o", -1, 1, None),
+    Among("u\u{00E7}a~o", -1, 3, None),
+    Among("ador", -1, 1, None),
+    Among("icas", -1, 1, None),
+    Among("\u{00EA}ncias", -1, 4, None),
+    Among("logias", -1, 2, None),
+    Among("iras", -1, 9, None),
+    Among("adoras", -1, 1, None),
+    Among("osas", -1, 1, None),
+    Among("istas", -1, 1, None),
+    Among("ivas", -1, 8, None),
+    Among("ezas", -1, 1, None),
+    Among("idades", -1, 7, None),
+    Among("adores", -1, 1, None),
+    Among("antes", -1, 1, None),
+    Among("a\u{00E7}o~es", -1, 1, None),
+    Among("u\u{00E7}o~es", -1, 3, None),
+    Among("icos", -1, 1, None),
+    Among("ismos", -1, 1, None),
+    Among("osos", -1, 1, None),
+    Among("amentos", -1, 1, None),
+    Among("imentos", -1, 1, None),
+    Among("ivos", -1, 8, None),
+];
+
+static A_6: &'static [Among<Context>; 120] = &[
+    Among("ada", -1, 1, None),
+    Among("ida", -1, 1, None),
+    Among("ia", -1, 1, None),
+    Among("aria", 2, 1, None),
+    Among("eria", 2, 1, None),
+    Among("iria", 2, 1, None),
+    Among("ara", -1, 1, None),
+    Among("era", -1, 1, None),
+    Among("ira", -1, 1, None),
+    Among("ava", -1, 1, None),
+    Among("asse", -1, 1, None),
+    Among("esse", -1, 1, None),
+    Among("isse", -1, 1, None),
+    Among("aste", -1, 1, None),
+    Among("este", -1, 1, None),
+    Among("iste", -1, 1, None),
+    Among("ei", -1, 1, None),
+    Among("arei", 16, 1, None),
+    Among("erei", 16, 1, None),
+    Among("irei", 16, 1, None),
+    Among("am", -1, 1, None),
+    Among("iam", 20, 1, None),
+    Among("ariam", 21, 1, None),
+    Among("eriam", 21, 1, None),
+    Among("iriam", 21, 1, None),
+    Among("aram", 20, 1, None),
+    Among("eram", 20, 1, None),
+    Among("iram", 20, 1, None),
+    Among("avam", 20, 1, None),
+    Among("em", -1, 1, None),
+    Among("arem", 29, 1, None),
+    Among("erem", 29, 1, None),
+    Among("irem", 29, 1, None),
+    Among("assem", 29, 1, None),
+    Among("essem", 29, 1, None),
+    Among("issem", 29, 1, None),
+    Among("ado", -1, 1, None),
+    Among("ido", -1, 1, None),
+    Among("ando", -1, 1, None),
+    Among("endo", -1, 1, None),
+    Among("indo", -1, 1, None),
+    Among("ara~o", -1, 1, None),
+    Among("era~o", -1, 1, None),
+    Among("ira~o", -1, 1, None),
+    Among("ar", -1, 1, None),
+    Among("er", -1, 1, None),
+    Among("ir", -1, 1, None),
+    Among("as", -1, 1, None),
+    Among("adas", 47, 1, None),
+    Among("idas", 47, 1, None),
+    Among("ias", 47, 1, None),
+    Among("arias", 50, 1, None),
+    Among("erias", 50, 1, None),
+    Among("irias", 50, 1, None),
+    Among("aras", 47, 1, None),
+    Among("eras", 47, 1, None),
+    Among("iras", 47, 1, None),
+    Among("avas", 47, 1, None),
+    Among("es", -1, 1, None),
+    Among("ardes", 58, 1, None),
+    Among("erdes", 58, 1, None),
+    Among("irdes", 58, 1, None),
+    Among("ares", 58, 1, None),
+    Among("eres", 58, 1, None),
+    Among("ires", 58, 1, None),
+    Among("asses", 58, 1, None),
+    Among("esses", 58, 1, None),
+    Among("isses", 58, 1, None),
+    Among("astes", 58, 1, None),
+    Among("estes", 58, 1, None),
+    Among("istes", 58, 1, None),
+    Among("is", -1, 1, None),
+    Among("ais", 71, 1, None),
+    Among("eis", 71, 1, None),
+    Among("areis", 73, 1, None),
+    Among("ereis", 73, 1, None),
+    Among("ireis", 73, 1, None),
+    Among("\u{00E1}reis", 73, 1, None),
+    Among("\u{00E9}reis", 73, 1, None),
+    Among("\u{00ED}reis", 73, 1, None),
+    Among("\u{00E1}sseis", 73, 1, None),
+    Among("\u{00E9}sseis", 73, 1, None),
+    Among("\u{00ED}sseis", 73, 1, None),
+    Among("\u{00E1}veis", 73, 1, None),
+    Among("\u{00ED}eis", 73, 1, None),
+    Among("ar\u{00ED}eis", 84, 1, None),
+    Among("er\u{00ED}eis", 84, 1, None),
+    Among("ir\u{00ED}eis", 84, 1, None),
+    Among("ados", -1, 1, None),
+    Among("idos", -1, 1, None),
+    Among("amos", -1, 1, None),
+    Among("\u{00E1}ramos", 90, 1, None),
+    Among("\u{00E9}ramos", 90, 1, None),
+    Among("\u{00ED}ramos", 90, 1, None),
+    Among("\u{00E1}vamos", 90, 1, None),
+    Among("\u{00ED}amos", 90, 1, None),
+    Among("ar\u{00ED}amos", 95, 1, None),
+    Among("er\u{00ED}amos", 95, 1, None),
+    Among("ir\u{00ED}amos", 95, 1, None),
+    Among("emos", -1, 1, None),
+    Among("aremos", 99, 1, None),
+    Among("eremos", 99, 1, None),
+    Among("iremos", 99, 1, None),
+    Among("\u{00E1}ssemos", 99, 1, None),
+    Among("\u{00EA}ssemos", 99, 1, None),
+    Among("\u{00ED}ssemos", 99, 1, None),
+    Among("imos", -1, 1, None),
+    Among("armos", -1, 1, None),
+    Among("ermos", -1, 1, None),
+    Among("irmos", -1, 1, None),
+    Among("\u{00E1}mos", -1, 1, None),
+    Among("ar\u{00E1}s", -1, 1, None),
+    Among("er\u{00E1}s", -1, 1, None),
+    Among("ir\u{00E1}s", -1, 1, None),
+    Among("eu", -1, 1, None),
+    Among("iu", -1, 1, None),
+    Among("ou", -1, 1, None),
+    Among("ar\u{00E1}", -1, 1, None),
+    Among("er\u{00E1}", -1, 1, None),
+    Among("ir\u{00E1}", -1, 1, None),
+];
+
+static A_7: &'static [Among<Context>; 7] = &[
+    Among("a", -1, 1, None),
+    Among("i", -1, 1, None),
+    Among("o", -1, 1, None),
+    Among("os", -1, 1, None),
+    Among("\u{00E1}", -1, 1, None),
+    Among("\u{00ED}", -1, 1, None),
+    Among("\u{00F3}", -1, 1, None),
+];
+
+static A_8: &'static [Among<Context>; 4] = &[
+    Among("e", -1, 1, None),
+    Among("\u{00E7}", -1, 2, None),
+    Among("\u{00E9}", -1, 1, None),
+    Among("\u{00EA}", -1, 1, None),
+];
+
+static G_v: &'static [u8; 20] = &[17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 19, 12, 2];
+
+#[derive(Clone)]
+struct Context {
+    i_p2: i32,
+    i_p1: i32,
+    i_pV: i32,
+}
+
+pub fn stem(env: &mut SnowballEnv) -> bool {
+    let mut context = &mut Context {
+        i_p2: 0,
+        i_p1: 0,
+        i_pV: 0,
+    };
+    let mut among_var;
+    let v_1 = env.cursor;
+    'lab0: loop {
+        'replab1: loop{
+            let v_2 = env.cursor;
+            'lab2: for _ in 0..1 {
+                env.bra = env.cursor;
+                among_var = env.find_among(A_0, context);
+                if among_var == 0 {
+                    break 'lab2;
+                }
+                env.ket = env.cursor;
+                if among_var == 1 {
+                    if !env.slice_from("a~") {
+                        return false;
+                    }
+                } else if among_var == 2 {
+                    if !env.slice_from("o~") {
+                        return false;
+                    }
+                } else if among_var == 3 {
+                    if env.cursor >= env.limit {
+                        break 'lab2;
+                    }
+                    env.next_char();
+                }
+                continue 'replab1;
+            }
+            env.cursor = v_2;
+            break 'replab1;
+        }
+        break 'lab0;
+    }
+    env.cursor = v_1;
+    'lab3: loop {
+        context.i_pV = env.limit;
+        context.i_p1 = env.limit;
+        context.i_p2 = env.limit;
+        let v_4 = env.cursor;
+        'lab4: loop {
+            'lab5: loop {
+                let v_5 = env.cursor;
+                'lab6: loop {
+                    if !env.in_grouping(G_v, 97, 250) {
+                        break 'lab6;
+                    }
+                    'lab7: loop {
+                        let v_6 = env.cursor;
+                        'lab8: loop {
+                            if !env.out_grouping(G_v, 97, 250) {
+                                break 'lab8;
+                            }
+                            'golab9: loop {
+                                'lab10: loop {
+                                    if !env.in_grouping(G_v, 97, 250) {
+                                        break 'lab10;
+                                    }
+                                    break 'golab9;
+                                }
+                                if env.cursor >= env.limit {
+                                    break 'lab8;
+                                }
+                                env.next_char();
+                            }
+                            break 'lab7;
+                        }
+                        env.cursor = v_6;
+                        if !env.in_grouping(G_v, 97, 250) {
+                            break 'lab6;
+                        }
+                        'golab11: loop {
+                            'lab12: loop {
+                                if !env.out_grouping(G_v, 97, 250) {
+                                    break 'lab12;
+                                }
+                                break 'golab11;
+                            }
+                            if env.cursor >= env.limit {
+                                break 'lab6;
+                            }
+                            env.next_char();
+                        }
+                        break 'lab7;
+                    }
+                    break 'lab5;
+                }
+                env.cursor = v_5;
+                if !env.out_grouping(G_v, 97, 250) {
+                    break 'lab4;
+                }
+                'lab13: loop {
+                    let v_9 = env.cursor;
+                    'lab14: loop {
+                        if !env.out_grouping(G_v, 97, 250) {
+                            break 'lab14;
+                        }
+                        'golab15: loop {
+                            'lab16: loop {
+                                if !env.in_grouping(G_v, 97, 250) {
+                                    break 'lab16;
+                                }
+                                break 'golab15;
+                            }
+                            if env.cursor >= env.limit {
+                                break 'lab14;
+                            }
+                            env.next_char();
+                        }
+                        break 'lab13;
+                    }
+                    env.cursor = v_9;
+                    if !env.in_grouping(G_v, 97, 250) {
+                        break 'lab4;
+                    }
+                    if env.cursor >= env.limit {
+                        break 'lab4;
+                    }
+                    env.next_char();
+                    break 'lab13;
+                }
+                break 'lab5;
+            }
+            context.i_pV = env.cursor;
+            break 'lab4;
+        }
+        env.cursor = v_4;
+        let v_11 = env.cursor;
+        'lab17: loop {
+            'golab18: loop {
+                'lab19: loop {
+                    if !env.in_grouping(G_v, 97, 250) {
+                        break 'lab19;
+                    }
+                    break 'golab18;
+                }
+                if env.cursor >= env.limit {
+                    break 'lab17;
+                }
+                env.next_char();
+            }
+            'golab20: loop {
+                'lab21: loop {
+                    if !env.out_grouping(G_v, 97, 250) {
+                        break 'lab21;
+                    }
+                    break 'golab20;
+                }
+                if env.cursor >= env.limit {
+                    break 'lab17;
+                }
+                env.next_char();
+            }
+            context.i_p1 = env.cursor;
+            'golab22: loop {
+                'lab23: loop {
+                    if !env.in_grouping(G_v, 97, 250) {
+                        break 'lab23;
+                    }
+                    break 'golab22;
+                }
+                if env.cursor >= env.limit {
+                    break 'lab17;
+                }
+                env.next_char();
+            }
+            'golab24: loop {
+                'lab25: loop {
+                    if !env.out_grouping(G_v, 97, 250) {
+                        break 'lab25;
+                    }
+                    break 'golab24;
+                }
+                if env.cursor >= env.limit {
+                    break 'lab17;
+                }
+                env.next_char();
+            }
+            context.i_p2 = env.cursor;
+            break 'lab17;
+        }
+        env.cursor = v_11;
+        break 'lab3;
+    }
+    env.limit_backward = env.cursor;
+    env.cursor = env.limit;
+    let v_16 = env.limit - env.cursor;
+    'lab26: loop {
+        'lab27: loop {
+            let v_17 = env.limit - env.cursor;
+            'lab28: loop {
+                let v_18 = env.limit - env.cursor;
+                'lab29: loop {
+                    let v_19 = env.limit - env.cursor;
+                    'lab30: loop {
+                        env.ket = env.cursor;
+                        among_var = env.find_among_b(A_5, context);
+                        if among_var == 0 {
+                            break 'lab30;
+                        }
+                        env.bra = env.cursor;
+                        if among_var == 1 {
+                            if !(context.i_p2 <= env.cursor){
+                                break 'lab30;
+                            }
+                            if !env.slice_del() {
+                                return false;
+                            }
+                        } else if among_var == 2 {
+                            if !(context.i_p2 <= env.cursor){
+                                break 'lab30;
+                            }
+                            if !env.slice_from("log") {
+                                return false;
+                            }
+                        } else if among_var == 3 {
+                            if !(context.i_p2 <= env.cursor){
+                                break 'lab30;
+                            }
+                            if !env.slice_from("u") {
+                                return false;
+                            }
+                        } else if among_var == 4 {
+                            if !(context.i_p2 <= env.cursor){
+                                break 'lab30;
+                            }
+                            if !env.slice_from("ente") {
+                                return false;
+                            }
+                        } else if among_var == 5 {
+                            if !(context.i_p1 <= env.cursor){
+                                break 'lab30;
+                            }
+                            if !env.slice_del() {
+                                return false;
+                            }
+                            let v_20 = env.limit - env.cursor;
+                            'lab31: loop {
+                                env.ket = env.cursor;
+                                among_var = env.find_among_b(A_2, context);
+                                if among_var == 0 {
+                                    env.cursor = env.limit - v_20;
+                                    break 'lab31;
+                                }
+                                env.bra = env.cursor;
+                                if !(context.i_p2 <= env.cursor){
+                                    env.cursor = env.limit - v_20;
+                                    break 'lab31;
+                                }
+                                if !env.slice_del() {
+                                    return false;
+                                }
+                                if among_var == 1 {
+                                    env.ket = env.cursor;
+                                    if !env.eq_s_b(&"at") {
+                                        env.cursor = env.limit - v_20;
+                                        break 'lab31;
+                                    }
+                                    env.bra = env.cursor;
+                                    if !(context.i_p2 <= env.cursor){
+                                        env.cursor = env.limit - v_20;
+                                        break 'lab31;
+                                    }
+                                    if !env.slice_del() {
+                                        return false;
+                                    }
+                                }
+                                break 'lab31;
+                            }
+                        } else if among_var == 6 {
+                            if !(context.i_p2 <= env.cursor){
+                                break 'lab30;
+                            }
+                            if !env.slice_del() {
+                                return false;
+                            }
+                            let v_21 = env.limit - env.cursor;
+                            'lab32: loop {
+                                env.ket = env.cursor;
+                                if env.find_among_b(A_3, context) == 0 {
+                                    env.cursor = env.limit - v_21;
+                                    break 'lab32;
+                                }
+                                env.bra = env.cursor;
+                                if !(context.i_p2 <= env.cursor){
+                                    env.cursor = env.limit - v_21;
+                                    break 'lab32;
+                                }
+                                if !env.slice_del() {
+                                    return false;
+                                }
+                                break 'lab32;
+                            }
+                        } else if among_var == 7 {
+                            if !(context.i_p2 <= env.cursor){
+                                break 'lab30;
+                            }
+                            if !env.slice_del() {
+                                return false;
+                            }
+                            let v_22 = env.limit - env.cursor;
+                            'lab33: loop {
+                                env.ket = env.cursor;
+                                if env.find_among_b(A_4, context) == 0 {
+                                    env.cursor = env.limit - v_22;
+                                    break 'lab33;
+                                }
+                                env.bra = env.cursor;
+                                if !(context.i_p2 <= env.cursor){
+                                    env.cursor = env.limit - v_22;
+                                    break 'lab33;
+                                }
+                                if !env.slice_del() {
+                                    return false;
+                                }
+                                break 'lab33;
+                            }
+                        } else if among_var == 8 {
+                            if !(context.i_p2 <= env.cursor){
+                                break 'lab30;
+                            }
+                            if !env.slice_del() {
+                                return false;
+                            }
+                            let v_23 = env.limit - env.cursor;
+                            'lab34: loop {
+                                env.ket = env.cursor;
+                                if !env.eq_s_b(&"at") {
+                                    env.cursor = env.limit - v_23;
+                                    break 'lab34;
+                                }
+                                env.bra = env.cursor;
+                                if !(context.i_p2 <= env.cursor){
+                                    env.cursor = env.limit - v_23;
+                                    break 'lab34;
+                                }
+                                if !env.slice_del() {
+                                    return false;
+                                }
+                                break 'lab34;
+                            }
+                        } else if among_var == 9 {
+                            if !(context.i_pV <= env.cursor){
+                                break 'lab30;
+                            }
+                            if !env.eq_s_b(&"e") {
+                                break 'lab30;
+                            }
+                            if !env.slice_from("ir") {
+                                return false;
+                            }
+                        }
+                        break 'lab29;
+                    }
+                    env.cursor = env.limit - v_19;
+                    if env.cursor < context.i_pV {
+                        break 'lab28;
+                    }
+                    let v_25 = env.limit_backward;
+                    env.limit_backward = context.i_pV;
+                    env.ket = env.cursor;
+                    if env.find_among_b(A_6, context) == 0 {
+                        env.limit_backward = v_25;
+                        break 'lab28;
+                    }
+                    env.bra = env.cursor;
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    env.limit_backward = v_25;
+                    break 'lab29;
+                }
+                env.cursor = env.limit - v_18;
+                let v_26 = env.limit - env.cursor;
+                'lab35: loop {
+                    env.ket = env.cursor;
+                    if !env.eq_s_b(&"i") {
+                        break 'lab35;
+                    }
+                    env.bra = env.cursor;
+                    let v_27 = env.limit - env.cursor;
+                    if !env.eq_s_b(&"c") {
+                        break 'lab35;
+                    }
+                    env.cursor = env.limit - v_27;
+                    if !(context.i_pV <= env.cursor){
+                        break 'lab35;
+                    }
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    break 'lab35;
+                }
+                env.cursor = env.limit - v_26;
+                break 'lab27;
+            }
+            env.cursor = env.limit - v_17;
+            env.ket = env.cursor;
+            if env.find_among_b(A_7, context) == 0 {
+                break 'lab26;
+            }
+            env.bra = env.cursor;
+            if !(context.i_pV <= env.cursor){
+                break 'lab26;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+            break 'lab27;
+        }
+        break 'lab26;
+    }
+    env.cursor = env.limit - v_16;
+    let v_28 = env.limit - env.cursor;
+    'lab36: loop {
+        env.ket = env.cursor;
+        among_var = env.find_among_b(A_8, context);
+        if among_var == 0 {
+            break 'lab36;
+        }
+        env.bra = env.cursor;
+        if among_var == 1 {
+            if !(context.i_pV <= env.cursor){
+                break 'lab36;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+            env.ket = env.cursor;
+            'lab37: loop {
+                let v_29 = env.limit - env.cursor;
+                'lab38: loop {
+                    if !env.eq_s_b(&"u") {
+                        break 'lab38;
+                    }
+                    env.bra = env.cursor;
+                    let v_30 = env.limit - env.cursor;
+                    if !env.eq_s_b(&"g") {
+                        break 'lab38;
+                    }
+                    env.cursor = env.limit - v_30;
+                    break 'lab37;
+                }
+                env.cursor = env.limit - v_29;
+                if !env.eq_s_b(&"i") {
+                    break 'lab36;
+                }
+                env.bra = env.cursor;
+                let v_31 = env.limit - env.cursor;
+                if !env.eq_s_b(&"c") {
+                    break 'lab36;
+                }
+                env.cursor = env.limit - v_31;
+                break 'lab37;
+            }
+            if !(context.i_pV <= env.cursor){
+                break 'lab36;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+        } else if among_var == 2 {
+            if !env.slice_from("c") {
+                return false;
+            }
+        }
+        break 'lab36;
+    }
+    env.cursor = env.limit - v_28;
+    env.cursor = env.limit_backward;
+    let v_32 = env.cursor;
+    'lab39: loop {
+        'replab40: loop{
+            let v_33 = env.cursor;
+            'lab41: for _ in 0..1 {
+                env.bra = env.cursor;
+                among_var = env.find_among(A_1, context);
+                if among_var == 0 {
+                    break 'lab41;
+                }
+                env.ket = env.cursor;
+                if among_var == 1 {
+                    if !env.slice_from("\u{00E3}") {
+                        return false;
+                    }
+                } else if among_var == 2 {
+                    if !env.slice_from("\u{00F5}") {
+                        return false;
+                    }
+                } else if among_var == 3 {
+                    if env.cursor >= env.limit {
+                        break 'lab41;
+                    }
+                    env.next_char();
+                }
+                continue 'replab40;
+            }
+            env.cursor = v_33;
+            break 'replab40;
+        }
+        break 'lab39;
+    }
+    env.cursor = v_32;
+    return true;
+}
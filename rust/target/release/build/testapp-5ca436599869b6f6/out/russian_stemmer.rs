@@ -0,0 +1,499 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+#![allow(non_snake_case)]
+#![allow(non_upper_case_globals)]
+#![allow(unused_mut)]
+#![allow(unused_parens)]
+#![allow(unused_variables)]
+use snowball::SnowballEnv;
+use snowball::Among;
+
+static A_0: &'static [Among<Context>; 9] = &[
+    Among("\u{0432}\u{0448}\u{0438}\u{0441}\u{044C}", -1, 1, None),
+    Among("\u{044B}\u{0432}\u{0448}\u{0438}\u{0441}\u{044C}", 0, 2, None),
+    Among("\u{0438}\u{0432}\u{0448}\u{0438}\u{0441}\u{044C}", 0, 2, None),
+    Among("\u{0432}", -1, 1, None),
+    Among("\u{044B}\u{0432}", 3, 2, None),
+    Among("\u{0438}\u{0432}", 3, 2, None),
+    Among("\u{0432}\u{0448}\u{0438}", -1, 1, None),
+    Among("\u{044B}\u{0432}\u{0448}\u{0438}", 6, 2, None),
+    Among("\u{0438}\u{0432}\u{0448}\u{0438}", 6, 2, None),
+];
+
+static A_1: &'static [Among<Context>; 26] = &[
+    Among("\u{0435}\u{043C}\u{0443}", -1, 1, None),
+    Among("\u{043E}\u{043C}\u{0443}", -1, 1, None),
+    Among("\u{044B}\u{0445}", -1, 1, None),
+    Among("\u{0438}\u{0445}", -1, 1, None),
+    Among("\u{0443}\u{044E}", -1, 1, None),
+    Among("\u{044E}\u{044E}", -1, 1, None),
+    Among("\u{0435}\u{044E}", -1, 1, None),
+    Among("\u{043E}\u{044E}", -1, 1, None),
+    Among("\u{044F}\u{044F}", -1, 1, None),
+    Among("\u{0430}\u{044F}", -1, 1, None),
+    Among("\u{044B}\u{0435}", -1, 1, None),
+    Among("\u{0435}\u{0435}", -1, 1, None),
+    Among("\u{0438}\u{0435}", -1, 1, None),
+    Among("\u{043E}\u{0435}", -1, 1, None),
+    Among("\u{044B}\u{043C}\u{0438}", -1, 1, None),
+    Among("\u{0438}\u{043C}\u{0438}", -1, 1, None),
+    Among("\u{044B}\u{0439}", -1, 1, None),
+    Among("\u{0435}\u{0439}", -1, 1, None),
+    Among("\u{0438}\u{0439}", -1, 1, None),
+    Among("\u{043E}\u{0439}", -1, 1, None),
+    Among("\u{044B}\u{043C}", -1, 1, None),
+    Among("\u{0435}\u{043C}", -1, 1, None),
+    Among("\u{0438}\u{043C}", -1, 1, None),
+    Among("\u{043E}\u{043C}", -1, 1, None),
+    Among("\u{0435}\u{0433}\u{043E}", -1, 1, None),
+    Among("\u{043E}\u{0433}\u{043E}", -1, 1, None),
+];
+
+static A_2: &'static [Among<Context>; 8] = &[
+    Among("\u{0432}\u{0448}", -1, 1, None),
+    Among("\u{044B}\u{0432}\u{0448}", 0, 2, None),
+    Among("\u{0438}\u{0432}\u{0448}", 0, 2, None),
+    Among("\u{0449}", -1, 1, None),
+    Among("\u{044E}\u{0449}", 3, 1, None),
+    Among("\u{0443}\u{044E}\u{0449}", 4, 2, None),
+    Among("\u{0435}\u{043C}", -1, 1, None),
+    Among("\u{043D}\u{043D}", -1, 1, None),
+];
+
+static A_3: &'static [Among<Context>; 2] = &[
+    Among("\u{0441}\u{044C}", -1, 1, None),
+    Among("\u{0441}\u{044F}", -1, 1, None),
+];
+
+static A_4: &'static [Among<Context>; 46] = &[
+    Among("\u{044B}\u{0442}", -1, 2, None),
+    Among("\u{044E}\u{0442}", -1, 1, None),
+    Among("\u{0443}\u{044E}\u{0442}", 1, 2, None),
+    Among("\u{044F}\u{0442}", -1, 2, None),
+    Among("\u{0435}\u{0442}", -1, 1, None),
+    Among("\u{0443}\u{0435}\u{0442}", 4, 2, None),
+    Among("\u{0438}\u{0442}", -1, 2, None),
+    Among("\u{043D}\u{044B}", -1, 1, None),
+    Among("\u{0435}\u{043D}\u{044B}", 7, 2, None),
+    Among("\u{0442}\u{044C}", -1, 1, None),
+    Among("\u{044B}\u{0442}\u{044C}", 9, 2, None),
+    Among("\u{0438}\u{0442}\u{044C}", 9, 2, None),
+    Among("\u{0435}\u{0448}\u{044C}", -1, 1, None),
+    Among("\u{0438}\u{0448}\u{044C}", -1, 2, None),
+    Among("\u{044E}", -1, 2, None),
+    Among("\u{0443}\u{044E}", 14, 2, None),
+    Among("\u{043B}\u{0430}", -1, 1, None),
+    Among("\u{044B}\u{043B}\u{0430}", 16, 2, None),
+    Among("\u{0438}\u{043B}\u{0430}", 16, 2, None),
+    Among("\u{043D}\u{0430}", -1, 1, None),
+    Among("\u{0435}\u{043D}\u{0430}", 19, 2, None),
+    Among("\u{0435}\u{0442}\u{0435}", -1, 1, None),
+    Among("\u{0438}\u{0442}\u{0435}", -1, 2, None),
+    Among("\u{0439}\u{0442}\u{0435}", -1, 1, None),
+    Among("\u{0443}\u{0439}\u{0442}\u{0435}", 23, 2, None),
+    Among("\u{0435}\u{0439}\u{0442}\u{0435}", 23, 2, None),
+    Among("\u{043B}\u{0438}", -1, 1, None),
+    Among("\u{044B}\u{043B}\u{0438}", 26, 2, None),
+    Among("\u{0438}\u{043B}\u{0438}", 26, 2, None),
+    Among("\u{0439}", -1, 1, None),
+    Among("\u{0443}\u{0439}", 29, 2, None),
+    Among("\u{0435}\u{0439}", 29, 2, None),
+    Among("\u{043B}", -1, 1, None),
+    Among("\u{044B}\u{043B}", 32, 2, None),
+    Among("\u{0438}\u{043B}", 32, 2, None),
+    Among("\u{044B}\u{043C}", -1, 2, None),
+    Among("\u{0435}\u{043C}", -1, 1, None),
+    Among("\u{0438}\u{043C}", -1, 2, None),
+    Among("\u{043D}", -1, 1, None),
+    Among("\u{0435}\u{043D}", 38, 2, None),
+    Among("\u{043B}\u{043E}", -1, 1, None),
+    Among("\u{044B}\u{043B}\u{043E}", 40, 2, None),
+    Among("\u{0438}\u{043B}\u{043E}", 40, 2, None),
+    Among("\u{043D}\u{043E}", -1, 1, None),
+    Among("\u{0435}\u{043D}\u{043E}", 43, 2, None),
+    Among("\u{043D}\u{043D}\u{043E}", 43, 1, None),
+];
+
+static A_5: &'static [Among<Context>; 36] = &[
+    Among("\u{0443}", -1, 1, None),
+    Among("\u{044F}\u{0445}", -1, 1, None),
+    Among("\u{0438}\u{044F}\u{0445}", 1, 1, None),
+    Among("\u{0430}\u{0445}", -1, 1, None),
+    Among("\u{044B}", -1, 1, None),
+    Among("\u{044C}", -1, 1, None),
+    Among("\u{044E}", -1, 1, None),
+    Among("\u{044C}\u{044E}", 6, 1, None),
+    Among("\u{0438}\u{044E}", 6, 1, None),
+    Among("\u{044F}", -1, 1, None),
+    Among("\u{044C}\u{044F}", 9, 1, None),
+    Among("\u{0438}\u{044F}", 9, 1, None),
+    Among("\u{0430}", -1, 1, None),
+    Among("\u{0435}\u{0432}", -1, 1, None),
+    Among("\u{043E}\u{0432}", -1, 1, None),
+    Among("\u{0435}", -1, 1, None),
+    Among("\u{044C}\u{0435}", 15, 1, None),
+    Among("\u{0438}\u{0435}", 15, 1, None),
+    Among("\u{0438}", -1, 1, None),
+    Among("\u{0435}\u{0438}", 18, 1, None),
+    Among("\u{0438}\u{0438}", 18, 1, None),
+    Among("\u{044F}\u{043C}\u{0438}", 18, 1, None),
+    Among("\u{0438}\u{044F}\u{043C}\u{0438}", 21, 1, None),
+    Among("\u{0430}\u{043C}\u{0438}", 18, 1, None),
+    Among("\u{0439}", -1, 1, None),
+    Among("\u{0435}\u{0439}", 24, 1, None),
+    Among("\u{0438}\u{0435}\u{0439}", 25, 1, None),
+    Among("\u{0438}\u{0439}", 24, 1, None),
+    Among("\u{043E}\u{0439}", 24, 1, None),
+    Among("\u{044F}\u{043C}", -1, 1, None),
+    Among("\u{0438}\u{044F}\u{043C}", 29, 1, None),
+    Among("\u{0430}\u{043C}", -1, 1, None),
+    Among("\u{0435}\u{043C}", -1, 1, None),
+    Among("\u{0438}\u{0435}\u{043C}", 32, 1, None),
+    Among("\u{043E}\u{043C}", -1, 1, None),
+    Among("\u{043E}", -1, 1, None),
+];
+
+static A_6: &'static [Among<Context>; 2] = &[
+    Among("\u{043E}\u{0441}\u{0442}", -1, 1, None),
+    Among("\u{043E}\u{0441}\u{0442}\u{044C}", -1, 1, None),
+];
+
+static A_7: &'static [Among<Context>; 4] = &[
+    Among("\u{0435}\u{0439}\u{0448}", -1, 1, None),
+    Among("\u{044C}", -1, 3, None),
+    Among("\u{0435}\u{0439}\u{0448}\u{0435}", -1, 1, None),
+    Among("\u{043D}", -1, 2, None),
+];
+
+static G_v: &'static [u8; 4] = &[33, 65, 8, 232];
+
+#[derive(Clone)]
+struct Context {
+    i_p2: i32,
+    i_pV: i32,
+}
+
+pub fn stem(env: &mut SnowballEnv) -> bool {
+    let mut context = &mut Context {
+        i_p2: 0,
+        i_pV: 0,
+    };
+    let mut among_var;
+    let v_1 = env.cursor;
+    'lab0: loop {
+        'replab1: loop{
+            let v_2 = env.cursor;
+            'lab2: for _ in 0..1 {
+                'golab3: loop {
+                    let v_3 = env.cursor;
+                    'lab4: loop {
+                        env.bra = env.cursor;
+                        if !env.eq_s(&"\u{0451}") {
+                            break 'lab4;
+                        }
+                        env.ket = env.cursor;
+                        env.cursor = v_3;
+                        break 'golab3;
+                    }
+                    env.cursor = v_3;
+                    if env.cursor >= env.limit {
+                        break 'lab2;
+                    }
+                    env.next_char();
+                }
+                if !env.slice_from("\u{0435}") {
+                    return false;
+                }
+                continue 'replab1;
+            }
+            env.cursor = v_2;
+            break 'replab1;
+        }
+        break 'lab0;
+    }
+    env.cursor = v_1;
+    'lab5: loop {
+        context.i_pV = env.limit;
+        context.i_p2 = env.limit;
+        let v_5 = env.cursor;
+        'lab6: loop {
+            'golab7: loop {
+                'lab8: loop {
+                    if !env.in_grouping(G_v, 1072, 1103) {
+                        break 'lab8;
+                    }
+                    break 'golab7;
+                }
+                if env.cursor >= env.limit {
+                    break 'lab6;
+                }
+                env.next_char();
+            }
+            context.i_pV = env.cursor;
+            'golab9: loop {
+                'lab10: loop {
+                    if !env.out_grouping(G_v, 1072, 1103) {
+                        break 'lab10;
+                    }
+                    break 'golab9;
+                }
+                if env.cursor >= env.limit {
+                    break 'lab6;
+                }
+                env.next_char();
+            }
+            'golab11: loop {
+                'lab12: loop {
+                    if !env.in_grouping(G_v, 1072, 1103) {
+                        break 'lab12;
+                    }
+                    break 'golab11;
+                }
+                if env.cursor >= env.limit {
+                    break 'lab6;
+                }
+                env.next_char();
+            }
+            'golab13: loop {
+                'lab14: loop {
+                    if !env.out_grouping(G_v, 1072, 1103) {
+                        break 'lab14;
+                    }
+                    break 'golab13;
+                }
+                if env.cursor >= env.limit {
+                    break 'lab6;
+                }
+                env.next_char();
+            }
+            context.i_p2 = env.cursor;
+            break 'lab6;
+        }
+        env.cursor = v_5;
+        break 'lab5;
+    }
+    env.limit_backward = env.cursor;
+    env.cursor = env.limit;
+    if env.cursor < context.i_pV {
+        return false;
+    }
+    let v_11 = env.limit_backward;
+    env.limit_backward = context.i_pV;
+    let v_12 = env.limit - env.cursor;
+    'lab15: loop {
+        'lab16: loop {
+            let v_13 = env.limit - env.cursor;
+            'lab17: loop {
+                env.ket = env.cursor;
+                among_var = env.find_among_b(A_0, context);
+                if among_var == 0 {
+                    break 'lab17;
+                }
+                env.bra = env.cursor;
+                if among_var == 1 {
+                    'lab18: loop {
+                        let v_14 = env.limit - env.cursor;
+                        'lab19: loop {
+                            if !env.eq_s_b(&"\u{0430}") {
+                                break 'lab19;
+                            }
+                            break 'lab18;
+                        }
+                        env.cursor = env.limit - v_14;
+                        if !env.eq_s_b(&"\u{044F}") {
+                            break 'lab17;
+                        }
+                        break 'lab18;
+                    }
+                    if !env.slice_del() {
+                        return false;
+                    }
+                } else if among_var == 2 {
+                    if !env.slice_del() {
+                        return false;
+                    }
+                }
+                break 'lab16;
+            }
+            env.cursor = env.limit - v_13;
+            let v_15 = env.limit - env.cursor;
+            'lab20: loop {
+                env.ket = env.cursor;
+                if env.find_among_b(A_3, context) == 0 {
+                    env.cursor = env.limit - v_15;
+                    break 'lab20;
+                }
+                env.bra = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+                break 'lab20;
+            }
+            'lab21: loop {
+                let v_16 = env.limit - env.cursor;
+                'lab22: loop {
+                    env.ket = env.cursor;
+                    if env.find_among_b(A_1, context) == 0 {
+                        break 'lab22;
+                    }
+                    env.bra = env.cursor;
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    let v_17 = env.limit - env.cursor;
+                    'lab23: loop {
+                        env.ket = env.cursor;
+                        among_var = env.find_among_b(A_2, context);
+                        if among_var == 0 {
+                            env.cursor = env.limit - v_17;
+                            break 'lab23;
+                        }
+                        env.bra = env.cursor;
+                        if among_var == 1 {
+                            'lab24: loop {
+                                let v_18 = env.limit - env.cursor;
+                                'lab25: loop {
+                                    if !env.eq_s_b(&"\u{0430}") {
+                                        break 'lab25;
+                                    }
+                                    break 'lab24;
+                                }
+                                env.cursor = env.limit - v_18;
+                                if !env.eq_s_b(&"\u{044F}") {
+                                    env.cursor = env.limit - v_17;
+                                    break 'lab23;
+                                }
+                                break 'lab24;
+                            }
+                            if !env.slice_del() {
+                                return false;
+                            }
+                        } else if among_var == 2 {
+                            if !env.slice_del() {
+                                return false;
+                            }
+                        }
+                        break 'lab23;
+                    }
+                    break 'lab21;
+                }
+                env.cursor = env.limit - v_16;
+                'lab26: loop {
+                    env.ket = env.cursor;
+                    among_var = env.find_among_b(A_4, context);
+                    if among_var == 0 {
+                        break 'lab26;
+                    }
+                    env.bra = env.cursor;
+                    if among_var == 1 {
+                        'lab27: loop {
+                            let v_19 = env.limit - env.cursor;
+                            'lab28: loop {
+                                if !env.eq_s_b(&"\u{0430}") {
+                                    break 'lab28;
+                                }
+                                break 'lab27;
+                            }
+                            env.cursor = env.limit - v_19;
+                            if !env.eq_s_b(&"\u{044F}") {
+                                break 'lab26;
+                            }
+                            break 'lab27;
+                        }
+                        if !env.slice_del() {
+                            return false;
+                        }
+                    } else if among_var == 2 {
+                        if !env.slice_del() {
+                            return false;
+                        }
+                    }
+                    break 'lab21;
+                }
+                env.cursor = env.limit - v_16;
+                env.ket = env.cursor;
+                if env.find_among_b(A_5, context) == 0 {
+                    break 'lab15;
+                }
+                env.bra = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+                break 'lab21;
+            }
+            break 'lab16;
+        }
+        break 'lab15;
+    }
+    env.cursor = env.limit - v_12;
+    let v_20 = env.limit - env.cursor;
+    'lab29: loop {
+        env.ket = env.cursor;
+        if !env.eq_s_b(&"\u{0438}") {
+            env.cursor = env.limit - v_20;
+            break 'lab29;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        break 'lab29;
+    }
+    let v_21 = env.limit - env.cursor;
+    'lab30: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_6, context) == 0 {
+            break 'lab30;
+        }
+        env.bra = env.cursor;
+        if !(context.i_p2 <= env.cursor){
+            break 'lab30;
+        }
+        if !env.slice_del() {
+            return false;
+        }
+        break 'lab30;
+    }
+    env.cursor = env.limit - v_21;
+    let v_22 = env.limit - env.cursor;
+    'lab31: loop {
+        env.ket = env.cursor;
+        among_var = env.find_among_b(A_7, context);
+        if among_var == 0 {
+            break 'lab31;
+        }
+        env.bra = env.cursor;
+        if among_var == 1 {
+            if !env.slice_del() {
+                return false;
+            }
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"\u{043D}") {
+                break 'lab31;
+            }
+            env.bra = env.cursor;
+            if !env.eq_s_b(&"\u{043D}") {
+                break 'lab31;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+        } else if among_var == 2 {
+            if !env.eq_s_b(&"\u{043D}") {
+                break 'lab31;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+        } else if among_var == 3 {
+            if !env.slice_del() {
+                return false;
+            }
+        }
+        break 'lab31;
+    }
+    env.cursor = env.limit - v_22;
+    env.limit_backward = v_11;
+    env.cursor = env.limit_backward;
+    return true;
+}
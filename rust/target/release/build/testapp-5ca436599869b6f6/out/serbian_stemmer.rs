@@ -0,0 +1,3860 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+#![allow(non_snake_case)]
+#![allow(non_upper_case_globals)]
+#![allow(unused_mut)]
+#![allow(unused_parens)]
+#![allow(unused_variables)]
+use snowball::SnowballEnv;
+use snowball::Among;
+
+static A_0: &'static [Among<Context>; 30] = &[
+    Among("\u{0430}", -1, 1, None),
+    Among("\u{0431}", -1, 2, None),
+    Among("\u{0432}", -1, 3, None),
+    Among("\u{0433}", -1, 4, None),
+    Among("\u{0434}", -1, 5, None),
+    Among("\u{0435}", -1, 7, None),
+    Among("\u{0436}", -1, 8, None),
+    Among("\u{0437}", -1, 9, None),
+    Among("\u{0438}", -1, 10, None),
+    Among("\u{043A}", -1, 12, None),
+    Among("\u{043B}", -1, 13, None),
+    Among("\u{043C}", -1, 15, None),
+    Among("\u{043D}", -1, 16, None),
+    Among("\u{043E}", -1, 18, None),
+    Among("\u{043F}", -1, 19, None),
+    Among("\u{0440}", -1, 20, None),
+    Among("\u{0441}", -1, 21, None),
+    Among("\u{0442}", -1, 22, None),
+    Among("\u{0443}", -1, 24, None),
+    Among("\u{0444}", -1, 25, None),
+    Among("\u{0445}", -1, 26, None),
+    Among("\u{0446}", -1, 27, None),
+    Among("\u{0447}", -1, 28, None),
+    Among("\u{0448}", -1, 30, None),
+    Among("\u{0452}", -1, 6, None),
+    Among("\u{0458}", -1, 11, None),
+    Among("\u{0459}", -1, 14, None),
+    Among("\u{045A}", -1, 17, None),
+    Among("\u{045B}", -1, 23, None),
+    Among("\u{045F}", -1, 29, None),
+];
+
+static A_1: &'static [Among<Context>; 130] = &[
+    Among("daba", -1, 73, None),
+    Among("ajaca", -1, 12, None),
+    Among("ejaca", -1, 14, None),
+    Among("ljaca", -1, 13, None),
+    Among("njaca", -1, 85, None),
+    Among("ojaca", -1, 15, None),
+    Among("alaca", -1, 82, None),
+    Among("elaca", -1, 83, None),
+    Among("olaca", -1, 84, None),
+    Among("maca", -1, 75, None),
+    Among("naca", -1, 76, None),
+    Among("raca", -1, 81, None),
+    Among("saca", -1, 80, None),
+    Among("vaca", -1, 79, None),
+    Among("\u{0161}aca", -1, 18, None),
+    Among("aoca", -1, 82, None),
+    Among("acaka", -1, 55, None),
+    Among("ajaka", -1, 16, None),
+    Among("ojaka", -1, 17, None),
+    Among("anaka", -1, 78, None),
+    Among("ataka", -1, 58, None),
+    Among("etaka", -1, 59, None),
+    Among("itaka", -1, 60, None),
+    Among("otaka", -1, 61, None),
+    Among("utaka", -1, 62, None),
+    Among("a\u{010D}aka", -1, 54, None),
+    Among("esama", -1, 67, None),
+    Among("izama", -1, 87, None),
+    Among("jacima", -1, 5, None),
+    Among("nicima", -1, 23, None),
+    Among("ticima", -1, 24, None),
+    Among("teticima", 30, 21, None),
+    Among("zicima", -1, 25, None),
+    Among("atcima", -1, 58, None),
+    Among("utcima", -1, 62, None),
+    Among("\u{010D}cima", -1, 74, None),
+    Among("pesima", -1, 2, None),
+    Among("inzima", -1, 19, None),
+    Among("lozima", -1, 1, None),
+    Among("metara", -1, 68, None),
+    Among("centara", -1, 69, None),
+    Among("istara", -1, 70, None),
+    Among("ekata", -1, 86, None),
+    Among("anata", -1, 53, None),
+    Among("nstava", -1, 22, None),
+    Among("kustava", -1, 29, None),
+    Among("ajac", -1, 12, None),
+    Among("ejac", -1, 14, None),
+    Among("ljac", -1, 13, None),
+    Among("njac", -1, 85, None),
+    Among("anjac", 49, 11, None),
+    Among("ojac", -1, 15, None),
+    Among("alac", -1, 82, None),
+    Among("elac", -1, 83, None),
+    Among("olac", -1, 84, None),
+    Among("mac", -1, 75, None),
+    Among("nac", -1, 76, None),
+    Among("rac", -1, 81, None),
+    Among("sac", -1, 80, None),
+    Among("vac", -1, 79, None),
+    Among("\u{0161}ac", -1, 18, None),
+    Among("jebe", -1, 88, None),
+    Among("olce", -1, 84, None),
+    Among("kuse", -1, 27, None),
+    Among("rave", -1, 42, None),
+    Among("save", -1, 52, None),
+    Among("\u{0161}ave", -1, 51, None),
+    Among("baci", -1, 89, None),
+    Among("jaci", -1, 5, None),
+    Among("tvenici", -1, 20, None),
+    Among("snici", -1, 26, None),
+    Among("tetici", -1, 21, None),
+    Among("bojci", -1, 4, None),
+    Among("vojci", -1, 3, None),
+    Among("ojsci", -1, 66, None),
+    Among("atci", -1, 58, None),
+    Among("itci", -1, 60, None),
+    Among("utci", -1, 62, None),
+    Among("\u{010D}ci", -1, 74, None),
+    Among("pesi", -1, 2, None),
+    Among("inzi", -1, 19, None),
+    Among("lozi", -1, 1, None),
+    Among("acak", -1, 55, None),
+    Among("usak", -1, 57, None),
+    Among("atak", -1, 58, None),
+    Among("etak", -1, 59, None),
+    Among("itak", -1, 60, None),
+    Among("otak", -1, 61, None),
+    Among("utak", -1, 62, None),
+    Among("a\u{010D}ak", -1, 54, None),
+    Among("u\u{0161}ak", -1, 56, None),
+    Among("izam", -1, 87, None),
+    Among("tican", -1, 65, None),
+    Among("cajan", -1, 7, None),
+    Among("\u{010D}ajan", -1, 6, None),
+    Among("voljan", -1, 77, None),
+    Among("eskan", -1, 63, None),
+    Among("alan", -1, 40, None),
+    Among("bilan", -1, 33, None),
+    Among("gilan", -1, 37, None),
+    Among("nilan", -1, 39, None),
+    Among("rilan", -1, 38, None),
+    Among("silan", -1, 36, None),
+    Among("tilan", -1, 34, None),
+    Among("avilan", -1, 35, None),
+    Among("laran", -1, 9, None),
+    Among("eran", -1, 8, None),
+    Among("asan", -1, 91, None),
+    Among("esan", -1, 10, None),
+    Among("dusan", -1, 31, None),
+    Among("kusan", -1, 28, None),
+    Among("atan", -1, 47, None),
+    Among("pletan", -1, 50, None),
+    Among("tetan", -1, 49, None),
+    Among("antan", -1, 32, None),
+    Among("pravan", -1, 44, None),
+    Among("stavan", -1, 43, None),
+    Among("sivan", -1, 46, None),
+    Among("tivan", -1, 45, None),
+    Among("ozan", -1, 41, None),
+    Among("ti\u{010D}an", -1, 64, None),
+    Among("a\u{0161}an", -1, 90, None),
+    Among("du\u{0161}an", -1, 30, None),
+    Among("metar", -1, 68, None),
+    Among("centar", -1, 69, None),
+    Among("istar", -1, 70, None),
+    Among("ekat", -1, 86, None),
+    Among("enat", -1, 48, None),
+    Among("oscu", -1, 72, None),
+    Among("o\u{0161}\u{0107}u", -1, 71, None),
+];
+
+static A_2: &'static [Among<Context>; 2035] = &[
+    Among("aca", -1, 124, None),
+    Among("eca", -1, 125, None),
+    Among("uca", -1, 126, None),
+    Among("ga", -1, 20, None),
+    Among("acega", 3, 124, None),
+    Among("ecega", 3, 125, None),
+    Among("ucega", 3, 126, None),
+    Among("anjijega", 3, 84, None),
+    Among("enjijega", 3, 85, None),
+    Among("snjijega", 3, 122, None),
+    Among("\u{0161}njijega", 3, 86, None),
+    Among("kijega", 3, 95, None),
+    Among("skijega", 11, 1, None),
+    Among("\u{0161}kijega", 11, 2, None),
+    Among("elijega", 3, 83, None),
+    Among("nijega", 3, 13, None),
+    Among("osijega", 3, 123, None),
+    Among("atijega", 3, 120, None),
+    Among("evitijega", 3, 92, None),
+    Among("ovitijega", 3, 93, None),
+    Among("astijega", 3, 94, None),
+    Among("avijega", 3, 77, None),
+    Among("evijega", 3, 78, None),
+    Among("ivijega", 3, 79, None),
+    Among("ovijega", 3, 80, None),
+    Among("o\u{0161}ijega", 3, 91, None),
+    Among("anjega", 3, 84, None),
+    Among("enjega", 3, 85, None),
+    Among("snjega", 3, 122, None),
+    Among("\u{0161}njega", 3, 86, None),
+    Among("kega", 3, 95, None),
+    Among("skega", 30, 1, None),
+    Among("\u{0161}kega", 30, 2, None),
+    Among("elega", 3, 83, None),
+    Among("nega", 3, 13, None),
+    Among("anega", 34, 10, None),
+    Among("enega", 34, 87, None),
+    Among("snega", 34, 159, None),
+    Among("\u{0161}nega", 34, 88, None),
+    Among("osega", 3, 123, None),
+    Among("atega", 3, 120, None),
+    Among("evitega", 3, 92, None),
+    Among("ovitega", 3, 93, None),
+    Among("astega", 3, 94, None),
+    Among("avega", 3, 77, None),
+    Among("evega", 3, 78, None),
+    Among("ivega", 3, 79, None),
+    Among("ovega", 3, 80, None),
+    Among("a\u{0107}ega", 3, 14, None),
+    Among("e\u{0107}ega", 3, 15, None),
+    Among("u\u{0107}ega", 3, 16, None),
+    Among("o\u{0161}ega", 3, 91, None),
+    Among("acoga", 3, 124, None),
+    Among("ecoga", 3, 125, None),
+    Among("ucoga", 3, 126, None),
+    Among("anjoga", 3, 84, None),
+    Among("enjoga", 3, 85, None),
+    Among("snjoga", 3, 122, None),
+    Among("\u{0161}njoga", 3, 86, None),
+    Among("koga", 3, 95, None),
+    Among("skoga", 59, 1, None),
+    Among("\u{0161}koga", 59, 2, None),
+    Among("loga", 3, 19, None),
+    Among("eloga", 62, 83, None),
+    Among("noga", 3, 13, None),
+    Among("cinoga", 64, 137, None),
+    Among("\u{010D}inoga", 64, 89, None),
+    Among("osoga", 3, 123, None),
+    Among("atoga", 3, 120, None),
+    Among("evitoga", 3, 92, None),
+    Among("ovitoga", 3, 93, None),
+    Among("astoga", 3, 94, None),
+    Among("avoga", 3, 77, None),
+    Among("evoga", 3, 78, None),
+    Among("ivoga", 3, 79, None),
+    Among("ovoga", 3, 80, None),
+    Among("a\u{0107}oga", 3, 14, None),
+    Among("e\u{0107}oga", 3, 15, None),
+    Among("u\u{0107}oga", 3, 16, None),
+    Among("o\u{0161}oga", 3, 91, None),
+    Among("uga", 3, 18, None),
+    Among("aja", -1, 109, None),
+    Among("caja", 81, 26, None),
+    Among("laja", 81, 30, None),
+    Among("raja", 81, 31, None),
+    Among("\u{0107}aja", 81, 28, None),
+    Among("\u{010D}aja", 81, 27, None),
+    Among("\u{0111}aja", 81, 29, None),
+    Among("bija", -1, 32, None),
+    Among("cija", -1, 33, None),
+    Among("dija", -1, 34, None),
+    Among("fija", -1, 40, None),
+    Among("gija", -1, 39, None),
+    Among("anjija", -1, 84, None),
+    Among("enjija", -1, 85, None),
+    Among("snjija", -1, 122, None),
+    Among("\u{0161}njija", -1, 86, None),
+    Among("kija", -1, 95, None),
+    Among("skija", 97, 1, None),
+    Among("\u{0161}kija", 97, 2, None),
+    Among("lija", -1, 24, None),
+    Among("elija", 100, 83, None),
+    Among("mija", -1, 37, None),
+    Among("nija", -1, 13, None),
+    Among("ganija", 103, 9, None),
+    Among("manija", 103, 6, None),
+    Among("panija", 103, 7, None),
+    Among("ranija", 103, 8, None),
+    Among("tanija", 103, 5, None),
+    Among("pija", -1, 41, None),
+    Among("rija", -1, 42, None),
+    Among("rarija", 110, 21, None),
+    Among("sija", -1, 23, None),
+    Among("osija", 112, 123, None),
+    Among("tija", -1, 44, None),
+    Among("atija", 114, 120, None),
+    Among("evitija", 114, 92, None),
+    Among("ovitija", 114, 93, None),
+    Among("otija", 114, 22, None),
+    Among("astija", 114, 94, None),
+    Among("avija", -1, 77, None),
+    Among("evija", -1, 78, None),
+    Among("ivija", -1, 79, None),
+    Among("ovija", -1, 80, None),
+    Among("zija", -1, 45, None),
+    Among("o\u{0161}ija", -1, 91, None),
+    Among("\u{017E}ija", -1, 38, None),
+    Among("anja", -1, 84, None),
+    Among("enja", -1, 85, None),
+    Among("snja", -1, 122, None),
+    Among("\u{0161}nja", -1, 86, None),
+    Among("ka", -1, 95, None),
+    Among("ska", 131, 1, None),
+    Among("\u{0161}ka", 131, 2, None),
+    Among("ala", -1, 104, None),
+    Among("acala", 134, 128, None),
+    Among("astajala", 134, 106, None),
+    Among("istajala", 134, 107, None),
+    Among("ostajala", 134, 108, None),
+    Among("ijala", 134, 47, None),
+    Among("injala", 134, 114, None),
+    Among("nala", 134, 46, None),
+    Among("irala", 134, 100, None),
+    Among("urala", 134, 105, None),
+    Among("tala", 134, 113, None),
+    Among("astala", 144, 110, None),
+    Among("istala", 144, 111, None),
+    Among("ostala", 144, 112, None),
+    Among("avala", 134, 97, None),
+    Among("evala", 134, 96, None),
+    Among("ivala", 134, 98, None),
+    Among("ovala", 134, 76, None),
+    Among("uvala", 134, 99, None),
+    Among("a\u{010D}ala", 134, 102, None),
+    Among("ela", -1, 83, None),
+    Among("ila", -1, 116, None),
+    Among("acila", 155, 124, None),
+    Among("lucila", 155, 121, None),
+    Among("nila", 155, 103, None),
+    Among("astanila", 158, 110, None),
+    Among("istanila", 158, 111, None),
+    Among("ostanila", 158, 112, None),
+    Among("rosila", 155, 127, None),
+    Among("jetila", 155, 118, None),
+    Among("ozila", 155, 48, None),
+    Among("a\u{010D}ila", 155, 101, None),
+    Among("lu\u{010D}ila", 155, 117, None),
+    Among("ro\u{0161}ila", 155, 90, None),
+    Among("ola", -1, 50, None),
+    Among("asla", -1, 115, None),
+    Among("nula", -1, 13, None),
+    Among("gama", -1, 20, None),
+    Among("logama", 171, 19, None),
+    Among("ugama", 171, 18, None),
+    Among("ajama", -1, 109, None),
+    Among("cajama", 174, 26, None),
+    Among("lajama", 174, 30, None),
+    Among("rajama", 174, 31, None),
+    Among("\u{0107}ajama", 174, 28, None),
+    Among("\u{010D}ajama", 174, 27, None),
+    Among("\u{0111}ajama", 174, 29, None),
+    Among("bijama", -1, 32, None),
+    Among("cijama", -1, 33, None),
+    Among("dijama", -1, 34, None),
+    Among("fijama", -1, 40, None),
+    Among("gijama", -1, 39, None),
+    Among("lijama", -1, 35, None),
+    Among("mijama", -1, 37, None),
+    Among("nijama", -1, 36, None),
+    Among("ganijama", 188, 9, None),
+    Among("manijama", 188, 6, None),
+    Among("panijama", 188, 7, None),
+    Among("ranijama", 188, 8, None),
+    Among("tanijama", 188, 5, None),
+    Among("pijama", -1, 41, None),
+    Among("rijama", -1, 42, None),
+    Among("sijama", -1, 43, None),
+    Among("tijama", -1, 44, None),
+    Among("zijama", -1, 45, None),
+    Among("\u{017E}ijama", -1, 38, None),
+    Among("alama", -1, 104, None),
+    Among("ijalama", 200, 47, None),
+    Among("nalama", 200, 46, None),
+    Among("elama", -1, 119, None),
+    Among("ilama", -1, 116, None),
+    Among("ramama", -1, 52, None),
+    Among("lemama", -1, 51, None),
+    Among("inama", -1, 11, None),
+    Among("cinama", 207, 137, None),
+    Among("\u{010D}inama", 207, 89, None),
+    Among("rama", -1, 52, None),
+    Among("arama", 210, 53, None),
+    Among("drama", 210, 54, None),
+    Among("erama", 210, 55, None),
+    Among("orama", 210, 56, None),
+    Among("basama", -1, 135, None),
+    Among("gasama", -1, 131, None),
+    Among("jasama", -1, 129, None),
+    Among("kasama", -1, 133, None),
+    Among("nasama", -1, 132, None),
+    Among("tasama", -1, 130, None),
+    Among("vasama", -1, 134, None),
+    Among("esama", -1, 152, None),
+    Among("isama", -1, 154, None),
+    Among("etama", -1, 70, None),
+    Among("estama", -1, 71, None),
+    Among("istama", -1, 72, None),
+    Among("kstama", -1, 73, None),
+    Among("ostama", -1, 74, None),
+    Among("avama", -1, 77, None),
+    Among("evama", -1, 78, None),
+    Among("ivama", -1, 79, None),
+    Among("ba\u{0161}ama", -1, 63, None),
+    Among("ga\u{0161}ama", -1, 64, None),
+    Among("ja\u{0161}ama", -1, 61, None),
+    Among("ka\u{0161}ama", -1, 62, None),
+    Among("na\u{0161}ama", -1, 60, None),
+    Among("ta\u{0161}ama", -1, 59, None),
+    Among("va\u{0161}ama", -1, 65, None),
+    Among("e\u{0161}ama", -1, 66, None),
+    Among("i\u{0161}ama", -1, 67, None),
+    Among("lema", -1, 51, None),
+    Among("acima", -1, 124, None),
+    Among("ecima", -1, 125, None),
+    Among("ucima", -1, 126, None),
+    Among("ajima", -1, 109, None),
+    Among("cajima", 245, 26, None),
+    Among("lajima", 245, 30, None),
+    Among("rajima", 245, 31, None),
+    Among("\u{0107}ajima", 245, 28, None),
+    Among("\u{010D}ajima", 245, 27, None),
+    Among("\u{0111}ajima", 245, 29, None),
+    Among("bijima", -1, 32, None),
+    Among("cijima", -1, 33, None),
+    Among("dijima", -1, 34, None),
+    Among("fijima", -1, 40, None),
+    Among("gijima", -1, 39, None),
+    Among("anjijima", -1, 84, None),
+    Among("enjijima", -1, 85, None),
+    Among("snjijima", -1, 122, None),
+    Among("\u{0161}njijima", -1, 86, None),
+    Among("kijima", -1, 95, None),
+    Among("skijima", 261, 1, None),
+    Among("\u{0161}kijima", 261, 2, None),
+    Among("lijima", -1, 35, None),
+    Among("elijima", 264, 83, None),
+    Among("mijima", -1, 37, None),
+    Among("nijima", -1, 13, None),
+    Among("ganijima", 267, 9, None),
+    Among("manijima", 267, 6, None),
+    Among("panijima", 267, 7, None),
+    Among("ranijima", 267, 8, None),
+    Among("tanijima", 267, 5, None),
+    Among("pijima", -1, 41, None),
+    Among("rijima", -1, 42, None),
+    Among("sijima", -1, 43, None),
+    Among("osijima", 275, 123, None),
+    Among("tijima", -1, 44, None),
+    Among("atijima", 277, 120, None),
+    Among("evitijima", 277, 92, None),
+    Among("ovitijima", 277, 93, None),
+    Among("astijima", 277, 94, None),
+    Among("avijima", -1, 77, None),
+    Among("evijima", -1, 78, None),
+    Among("ivijima", -1, 79, None),
+    Among("ovijima", -1, 80, None),
+    Among("zijima", -1, 45, None),
+    Among("o\u{0161}ijima", -1, 91, None),
+    Among("\u{017E}ijima", -1, 38, None),
+    Among("anjima", -1, 84, None),
+    Among("enjima", -1, 85, None),
+    Among("snjima", -1, 122, None),
+    Among("\u{0161}njima", -1, 86, None),
+    Among("kima", -1, 95, None),
+    Among("skima", 293, 1, None),
+    Among("\u{0161}kima", 293, 2, None),
+    Among("alima", -1, 104, None),
+    Among("ijalima", 296, 47, None),
+    Among("nalima", 296, 46, None),
+    Among("elima", -1, 83, None),
+    Among("ilima", -1, 116, None),
+    Among("ozilima", 300, 48, None),
+    Among("olima", -1, 50, None),
+    Among("lemima", -1, 51, None),
+    Among("nima", -1, 13, None),
+    Among("anima", 304, 10, None),
+    Among("inima", 304, 11, None),
+    Among("cinima", 306, 137, None),
+    Among("\u{010D}inima", 306, 89, None),
+    Among("onima", 304, 12, None),
+    Among("arima", -1, 53, None),
+    Among("drima", -1, 54, None),
+    Among("erima", -1, 55, None),
+    Among("orima", -1, 56, None),
+    Among("basima", -1, 135, None),
+    Among("gasima", -1, 131, None),
+    Among("jasima", -1, 129, None),
+    Among("kasima", -1, 133, None),
+    Among("nasima", -1, 132, None),
+    Among("tasima", -1, 130, None),
+    Among("vasima", -1, 134, None),
+    Among("esima", -1, 57, None),
+    Among("isima", -1, 58, None),
+    Among("osima", -1, 123, None),
+    Among("atima", -1, 120, None),
+    Among("ikatima", 324, 68, None),
+    Among("latima", 324, 69, None),
+    Among("etima", -1, 70, None),
+    Among("evitima", -1, 92, None),
+    Among("ovitima", -1, 93, None),
+    Among("astima", -1, 94, None),
+    Among("estima", -1, 71, None),
+    Among("istima", -1, 72, None),
+    Among("kstima", -1, 73, None),
+    Among("ostima", -1, 74, None),
+    Among("i\u{0161}tima", -1, 75, None),
+    Among("avima", -1, 77, None),
+    Among("evima", -1, 78, None),
+    Among("ajevima", 337, 109, None),
+    Among("cajevima", 338, 26, None),
+    Among("lajevima", 338, 30, None),
+    Among("rajevima", 338, 31, None),
+    Among("\u{0107}ajevima", 338, 28, None),
+    Among("\u{010D}ajevima", 338, 27, None),
+    Among("\u{0111}ajevima", 338, 29, None),
+    Among("ivima", -1, 79, None),
+    Among("ovima", -1, 80, None),
+    Among("govima", 346, 20, None),
+    Among("ugovima", 347, 17, None),
+    Among("lovima", 346, 82, None),
+    Among("olovima", 349, 49, None),
+    Among("movima", 346, 81, None),
+    Among("onovima", 346, 12, None),
+    Among("stvima", -1, 3, None),
+    Among("\u{0161}tvima", -1, 4, None),
+    Among("a\u{0107}ima", -1, 14, None),
+    Among("e\u{0107}ima", -1, 15, None),
+    Among("u\u{0107}ima", -1, 16, None),
+    Among("ba\u{0161}ima", -1, 63, None),
+    Among("ga\u{0161}ima", -1, 64, None),
+    Among("ja\u{0161}ima", -1, 61, None),
+    Among("ka\u{0161}ima", -1, 62, None),
+    Among("na\u{0161}ima", -1, 60, None),
+    Among("ta\u{0161}ima", -1, 59, None),
+    Among("va\u{0161}ima", -1, 65, None),
+    Among("e\u{0161}ima", -1, 66, None),
+    Among("i\u{0161}ima", -1, 67, None),
+    Among("o\u{0161}ima", -1, 91, None),
+    Among("na", -1, 13, None),
+    Among("ana", 368, 10, None),
+    Among("acana", 369, 128, None),
+    Among("urana", 369, 105, None),
+    Among("tana", 369, 113, None),
+    Among("avana", 369, 97, None),
+    Among("evana", 369, 96, None),
+    Among("ivana", 369, 98, None),
+    Among("uvana", 369, 99, None),
+    Among("a\u{010D}ana", 369, 102, None),
+    Among("acena", 368, 124, None),
+    Among("lucena", 368, 121, None),
+    Among("a\u{010D}ena", 368, 101, None),
+    Among("lu\u{010D}ena", 368, 117, None),
+    Among("ina", 368, 11, None),
+    Among("cina", 382, 137, None),
+    Among("anina", 382, 10, None),
+    Among("\u{010D}ina", 382, 89, None),
+    Among("ona", 368, 12, None),
+    Among("ara", -1, 53, None),
+    Among("dra", -1, 54, None),
+    Among("era", -1, 55, None),
+    Among("ora", -1, 56, None),
+    Among("basa", -1, 135, None),
+    Among("gasa", -1, 131, None),
+    Among("jasa", -1, 129, None),
+    Among("kasa", -1, 133, None),
+    Among("nasa", -1, 132, None),
+    Among("tasa", -1, 130, None),
+    Among("vasa", -1, 134, None),
+    Among("esa", -1, 57, None),
+    Among("isa", -1, 58, None),
+    Among("osa", -1, 123, None),
+    Among("ata", -1, 120, None),
+    Among("ikata", 401, 68, None),
+    Among("lata", 401, 69, None),
+    Among("eta", -1, 70, None),
+    Among("evita", -1, 92, None),
+    Among("ovita", -1, 93, None),
+    Among("asta", -1, 94, None),
+    Among("esta", -1, 71, None),
+    Among("ista", -1, 72, None),
+    Among("ksta", -1, 73, None),
+    Among("osta", -1, 74, None),
+    Among("nuta", -1, 13, None),
+    Among("i\u{0161}ta", -1, 75, None),
+    Among("ava", -1, 77, None),
+    Among("eva", -1, 78, None),
+    Among("ajeva", 415, 109, None),
+    Among("cajeva", 416, 26, None),
+    Among("lajeva", 416, 30, None),
+    Among("rajeva", 416, 31, None),
+    Among("\u{0107}ajeva", 416, 28, None),
+    Among("\u{010D}ajeva", 416, 27, None),
+    Among("\u{0111}ajeva", 416, 29, None),
+    Among("iva", -1, 79, None),
+    Among("ova", -1, 80, None),
+    Among("gova", 424, 20, None),
+    Among("ugova", 425, 17, None),
+    Among("lova", 424, 82, None),
+    Among("olova", 427, 49, None),
+    Among("mova", 424, 81, None),
+    Among("onova", 424, 12, None),
+    Among("stva", -1, 3, None),
+    Among("\u{0161}tva", -1, 4, None),
+    Among("a\u{0107}a", -1, 14, None),
+    Among("e\u{0107}a", -1, 15, None),
+    Among("u\u{0107}a", -1, 16, None),
+    Among("ba\u{0161}a", -1, 63, None),
+    Among("ga\u{0161}a", -1, 64, None),
+    Among("ja\u{0161}a", -1, 61, None),
+    Among("ka\u{0161}a", -1, 62, None),
+    Among("na\u{0161}a", -1, 60, None),
+    Among("ta\u{0161}a", -1, 59, None),
+    Among("va\u{0161}a", -1, 65, None),
+    Among("e\u{0161}a", -1, 66, None),
+    Among("i\u{0161}a", -1, 67, None),
+    Among("o\u{0161}a", -1, 91, None),
+    Among("ace", -1, 124, None),
+    Among("ece", -1, 125, None),
+    Among("uce", -1, 126, None),
+    Among("luce", 448, 121, None),
+    Among("astade", -1, 110, None),
+    Among("istade", -1, 111, None),
+    Among("ostade", -1, 112, None),
+    Among("ge", -1, 20, None),
+    Among("loge", 453, 19, None),
+    Among("uge", 453, 18, None),
+    Among("aje", -1, 104, None),
+    Among("caje", 456, 26, None),
+    Among("laje", 456, 30, None),
+    Among("raje", 456, 31, None),
+    Among("astaje", 456, 106, None),
+    Among("istaje", 456, 107, None),
+    Among("ostaje", 456, 108, None),
+    Among("\u{0107}aje", 456, 28, None),
+    Among("\u{010D}aje", 456, 27, None),
+    Among("\u{0111}aje", 456, 29, None),
+    Among("ije", -1, 116, None),
+    Among("bije", 466, 32, None),
+    Among("cije", 466, 33, None),
+    Among("dije", 466, 34, None),
+    Among("fije", 466, 40, None),
+    Among("gije", 466, 39, None),
+    Among("anjije", 466, 84, None),
+    Among("enjije", 466, 85, None),
+    Among("snjije", 466, 122, None),
+    Among("\u{0161}njije", 466, 86, None),
+    Among("kije", 466, 95, None),
+    Among("skije", 476, 1, None),
+    Among("\u{0161}kije", 476, 2, None),
+    Among("lije", 466, 35, None),
+    Among("elije", 479, 83, None),
+    Among("mije", 466, 37, None),
+    Among("nije", 466, 13, None),
+    Among("ganije", 482, 9, None),
+    Among("manije", 482, 6, None),
+    Among("panije", 482, 7, None),
+    Among("ranije", 482, 8, None),
+    Among("tanije", 482, 5, None),
+    Among("pije", 466, 41, None),
+    Among("rije", 466, 42, None),
+    Among("sije", 466, 43, None),
+    Among("osije", 490, 123, None),
+    Among("tije", 466, 44, None),
+    Among("atije", 492, 120, None),
+    Among("evitije", 492, 92, None),
+    Among("ovitije", 492, 93, None),
+    Among("astije", 492, 94, None),
+    Among("avije", 466, 77, None),
+    Among("evije", 466, 78, None),
+    Among("ivije", 466, 79, None),
+    Among("ovije", 466, 80, None),
+    Among("zije", 466, 45, None),
+    Among("o\u{0161}ije", 466, 91, None),
+    Among("\u{017E}ije", 466, 38, None),
+    Among("anje", -1, 84, None),
+    Among("enje", -1, 85, None),
+    Among("snje", -1, 122, None),
+    Among("\u{0161}nje", -1, 86, None),
+    Among("uje", -1, 25, None),
+    Among("lucuje", 508, 121, None),
+    Among("iruje", 508, 100, None),
+    Among("lu\u{010D}uje", 508, 117, None),
+    Among("ke", -1, 95, None),
+    Among("ske", 512, 1, None),
+    Among("\u{0161}ke", 512, 2, None),
+    Among("ale", -1, 104, None),
+    Among("acale", 515, 128, None),
+    Among("astajale", 515, 106, None),
+    Among("istajale", 515, 107, None),
+    Among("ostajale", 515, 108, None),
+    Among("ijale", 515, 47, None),
+    Among("injale", 515, 114, None),
+    Among("nale", 515, 46, None),
+    Among("irale", 515, 100, None),
+    Among("urale", 515, 105, None),
+    Among("tale", 515, 113, None),
+    Among("astale", 525, 110, None),
+    Among("istale", 525, 111, None),
+    Among("ostale", 525, 112, None),
+    Among("avale", 515, 97, None),
+    Among("evale", 515, 96, None),
+    Among("ivale", 515, 98, None),
+    Among("ovale", 515, 76, None),
+    Among("uvale", 515, 99, None),
+    Among("a\u{010D}ale", 515, 102, None),
+    Among("ele", -1, 83, None),
+    Among("ile", -1, 116, None),
+    Among("acile", 536, 124, None),
+    Among("lucile", 536, 121, None),
+    Among("nile", 536, 103, None),
+    Among("rosile", 536, 127, None),
+    Among("jetile", 536, 118, None),
+    Among("ozile", 536, 48, None),
+    Among("a\u{010D}ile", 536, 101, None),
+    Among("lu\u{010D}ile", 536, 117, None),
+    Among("ro\u{0161}ile", 536, 90, None),
+    Among("ole", -1, 50, None),
+    Among("asle", -1, 115, None),
+    Among("nule", -1, 13, None),
+    Among("rame", -1, 52, None),
+    Among("leme", -1, 51, None),
+    Among("acome", -1, 124, None),
+    Among("ecome", -1, 125, None),
+    Among("ucome", -1, 126, None),
+    Among("anjome", -1, 84, None),
+    Among("enjome", -1, 85, None),
+    Among("snjome", -1, 122, None),
+    Among("\u{0161}njome", -1, 86, None),
+    Among("kome", -1, 95, None),
+    Among("skome", 558, 1, None),
+    Among("\u{0161}kome", 558, 2, None),
+    Among("elome", -1, 83, None),
+    Among("nome", -1, 13, None),
+    Among("cinome", 562, 137, None),
+    Among("\u{010D}inome", 562, 89, None),
+    Among("osome", -1, 123, None),
+    Among("atome", -1, 120, None),
+    Among("evitome", -1, 92, None),
+    Among("ovitome", -1, 93, None),
+    Among("astome", -1, 94, None),
+    Among("avome", -1, 77, None),
+    Among("evome", -1, 78, None),
+    Among("ivome", -1, 79, None),
+    Among("ovome", -1, 80, None),
+    Among("a\u{0107}ome", -1, 14, None),
+    Among("e\u{0107}ome", -1, 15, None),
+    Among("u\u{0107}ome", -1, 16, None),
+    Among("o\u{0161}ome", -1, 91, None),
+    Among("ne", -1, 13, None),
+    Among("ane", 578, 10, None),
+    Among("acane", 579, 128, None),
+    Among("urane", 579, 105, None),
+    Among("tane", 579, 113, None),
+    Among("astane", 582, 110, None),
+    Among("istane", 582, 111, None),
+    Among("ostane", 582, 112, None),
+    Among("avane", 579, 97, None),
+    Among("evane", 579, 96, None),
+    Among("ivane", 579, 98, None),
+    Among("uvane", 579, 99, None),
+    Among("a\u{010D}ane", 579, 102, None),
+    Among("acene", 578, 124, None),
+    Among("lucene", 578, 121, None),
+    Among("a\u{010D}ene", 578, 101, None),
+    Among("lu\u{010D}ene", 578, 117, None),
+    Among("ine", 578, 11, None),
+    Among("cine", 595, 137, None),
+    Among("anine", 595, 10, None),
+    Among("\u{010D}ine", 595, 89, None),
+    Among("one", 578, 12, None),
+    Among("are", -1, 53, None),
+    Among("dre", -1, 54, None),
+    Among("ere", -1, 55, None),
+    Among("ore", -1, 56, None),
+    Among("ase", -1, 161, None),
+    Among("base", 604, 135, None),
+    Among("acase", 604, 128, None),
+    Among("gase", 604, 131, None),
+    Among("jase", 604, 129, None),
+    Among("astajase", 608, 138, None),
+    Among("istajase", 608, 139, None),
+    Among("ostajase", 608, 140, None),
+    Among("injase", 608, 150, None),
+    Among("kase", 604, 133, None),
+    Among("nase", 604, 132, None),
+    Among("irase", 604, 155, None),
+    Among("urase", 604, 156, None),
+    Among("tase", 604, 130, None),
+    Among("vase", 604, 134, None),
+    Among("avase", 618, 144, None),
+    Among("evase", 618, 145, None),
+    Among("ivase", 618, 146, None),
+    Among("ovase", 618, 148, None),
+    Among("uvase", 618, 147, None),
+    Among("ese", -1, 57, None),
+    Among("ise", -1, 58, None),
+    Among("acise", 625, 124, None),
+    Among("lucise", 625, 121, None),
+    Among("rosise", 625, 127, None),
+    Among("jetise", 625, 149, None),
+    Among("ose", -1, 123, None),
+    Among("astadose", 630, 141, None),
+    Among("istadose", 630, 142, None),
+    Among("ostadose", 630, 143, None),
+    Among("ate", -1, 104, None),
+    Among("acate", 634, 128, None),
+    Among("ikate", 634, 68, None),
+    Among("late", 634, 69, None),
+    Among("irate", 634, 100, None),
+    Among("urate", 634, 105, None),
+    Among("tate", 634, 113, None),
+    Among("avate", 634, 97, None),
+    Among("evate", 634, 96, None),
+    Among("ivate", 634, 98, None),
+    Among("uvate", 634, 99, None),
+    Among("a\u{010D}ate", 634, 102, None),
+    Among("ete", -1, 70, None),
+    Among("astadete", 646, 110, None),
+    Among("istadete", 646, 111, None),
+    Among("ostadete", 646, 112, None),
+    Among("astajete", 646, 106, None),
+    Among("istajete", 646, 107, None),
+    Among("ostajete", 646, 108, None),
+    Among("ijete", 646, 116, None),
+    Among("injete", 646, 114, None),
+    Among("ujete", 646, 25, None),
+    Among("lucujete", 655, 121, None),
+    Among("irujete", 655, 100, None),
+    Among("lu\u{010D}ujete", 655, 117, None),
+    Among("nete", 646, 13, None),
+    Among("astanete", 659, 110, None),
+    Among("istanete", 659, 111, None),
+    Among("ostanete", 659, 112, None),
+    Among("astete", 646, 115, None),
+    Among("ite", -1, 116, None),
+    Among("acite", 664, 124, None),
+    Among("lucite", 664, 121, None),
+    Among("nite", 664, 13, None),
+    Among("astanite", 667, 110, None),
+    Among("istanite", 667, 111, None),
+    Among("ostanite", 667, 112, None),
+    Among("rosite", 664, 127, None),
+    Among("jetite", 664, 118, None),
+    Among("astite", 664, 115, None),
+    Among("evite", 664, 92, None),
+    Among("ovite", 664, 93, None),
+    Among("a\u{010D}ite", 664, 101, None),
+    Among("lu\u{010D}ite", 664, 117, None),
+    Among("ro\u{0161}ite", 664, 90, None),
+    Among("ajte", -1, 104, None),
+    Among("urajte", 679, 105, None),
+    Among("tajte", 679, 113, None),
+    Among("astajte", 681, 106, None),
+    Among("istajte", 681, 107, None),
+    Among("ostajte", 681, 108, None),
+    Among("avajte", 679, 97, None),
+    Among("evajte", 679, 96, None),
+    Among("ivajte", 679, 98, None),
+    Among("uvajte", 679, 99, None),
+    Among("ijte", -1, 116, None),
+    Among("lucujte", -1, 121, None),
+    Among("irujte", -1, 100, None),
+    Among("lu\u{010D}ujte", -1, 117, None),
+    Among("aste", -1, 94, None),
+    Among("acaste", 693, 128, None),
+    Among("astajaste", 693, 106, None),
+    Among("istajaste", 693, 107, None),
+    Among("ostajaste", 693, 108, None),
+    Among("injaste", 693, 114, None),
+    Among("iraste", 693, 100, None),
+    Among("uraste", 693, 105, None),
+    Among("taste", 693, 113, None),
+    Among("avaste", 693, 97, None),
+    Among("evaste", 693, 96, None),
+    Among("ivaste", 693, 98, None),
+    Among("ovaste", 693, 76, None),
+    Among("uvaste", 693, 99, None),
+    Among("a\u{010D}aste", 693, 102, None),
+    Among("este", -1, 71, None),
+    Among("iste", -1, 72, None),
+    Among("aciste", 709, 124, None),
+    Among("luciste", 709, 121, None),
+    Among("niste", 709, 103, None),
+    Among("rosiste", 709, 127, None),
+    Among("jetiste", 709, 118, None),
+    Among("a\u{010D}iste", 709, 101, None),
+    Among("lu\u{010D}iste", 709, 117, None),
+    Among("ro\u{0161}iste", 709, 90, None),
+    Among("kste", -1, 73, None),
+    Among("oste", -1, 74, None),
+    Among("astadoste", 719, 110, None),
+    Among("istadoste", 719, 111, None),
+    Among("ostadoste", 719, 112, None),
+    Among("nuste", -1, 13, None),
+    Among("i\u{0161}te", -1, 75, None),
+    Among("ave", -1, 77, None),
+    Among("eve", -1, 78, None),
+    Among("ajeve", 726, 109, None),
+    Among("cajeve", 727, 26, None),
+    Among("lajeve", 727, 30, None),
+    Among("rajeve", 727, 31, None),
+    Among("\u{0107}ajeve", 727, 28, None),
+    Among("\u{010D}ajeve", 727, 27, None),
+    Among("\u{0111}ajeve", 727, 29, None),
+    Among("ive", -1, 79, None),
+    Among("ove", -1, 80, None),
+    Among("gove", 735, 20, None),
+    Among("ugove", 736, 17, None),
+    Among("love", 735, 82, None),
+    Among("olove", 738, 49, None),
+    Among("move", 735, 81, None),
+    Among("onove", 735, 12, None),
+    Among("a\u{0107}e", -1, 14, None),
+    Among("e\u{0107}e", -1, 15, None),
+    Among("u\u{0107}e", -1, 16, None),
+    Among("a\u{010D}e", -1, 101, None),
+    Among("lu\u{010D}e", -1, 117, None),
+    Among("a\u{0161}e", -1, 104, None),
+    Among("ba\u{0161}e", 747, 63, None),
+    Among("ga\u{0161}e", 747, 64, None),
+    Among("ja\u{0161}e", 747, 61, None),
+    Among("astaja\u{0161}e", 750, 106, None),
+    Among("istaja\u{0161}e", 750, 107, None),
+    Among("ostaja\u{0161}e", 750, 108, None),
+    Among("inja\u{0161}e", 750, 114, None),
+    Among("ka\u{0161}e", 747, 62, None),
+    Among("na\u{0161}e", 747, 60, None),
+    Among("ira\u{0161}e", 747, 100, None),
+    Among("ura\u{0161}e", 747, 105, None),
+    Among("ta\u{0161}e", 747, 59, None),
+    Among("va\u{0161}e", 747, 65, None),
+    Among("ava\u{0161}e", 760, 97, None),
+    Among("eva\u{0161}e", 760, 96, None),
+    Among("iva\u{0161}e", 760, 98, None),
+    Among("ova\u{0161}e", 760, 76, None),
+    Among("uva\u{0161}e", 760, 99, None),
+    Among("a\u{010D}a\u{0161}e", 747, 102, None),
+    Among("e\u{0161}e", -1, 66, None),
+    Among("i\u{0161}e", -1, 67, None),
+    Among("jeti\u{0161}e", 768, 118, None),
+    Among("a\u{010D}i\u{0161}e", 768, 101, None),
+    Among("lu\u{010D}i\u{0161}e", 768, 117, None),
+    Among("ro\u{0161}i\u{0161}e", 768, 90, None),
+    Among("o\u{0161}e", -1, 91, None),
+    Among("astado\u{0161}e", 773, 110, None),
+    Among("istado\u{0161}e", 773, 111, None),
+    Among("ostado\u{0161}e", 773, 112, None),
+    Among("aceg", -1, 124, None),
+    Among("eceg", -1, 125, None),
+    Among("uceg", -1, 126, None),
+    Among("anjijeg", -1, 84, None),
+    Among("enjijeg", -1, 85, None),
+    Among("snjijeg", -1, 122, None),
+    Among("\u{0161}njijeg", -1, 86, None),
+    Among("kijeg", -1, 95, None),
+    Among("skijeg", 784, 1, None),
+    Among("\u{0161}kijeg", 784, 2, None),
+    Among("elijeg", -1, 83, None),
+    Among("nijeg", -1, 13, None),
+    Among("osijeg", -1, 123, None),
+    Among("atijeg", -1, 120, None),
+    Among("evitijeg", -1, 92, None),
+    Among("ovitijeg", -1, 93, None),
+    Among("astijeg", -1, 94, None),
+    Among("avijeg", -1, 77, None),
+    Among("evijeg", -1, 78, None),
+    Among("ivijeg", -1, 79, None),
+    Among("ovijeg", -1, 80, None),
+    Among("o\u{0161}ijeg", -1, 91, None),
+    Among("anjeg", -1, 84, None),
+    Among("enjeg", -1, 85, None),
+    Among("snjeg", -1, 122, None),
+    Among("\u{0161}njeg", -1, 86, None),
+    Among("keg", -1, 95, None),
+    Among("eleg", -1, 83, None),
+    Among("neg", -1, 13, None),
+    Among("aneg", 805, 10, None),
+    Among("eneg", 805, 87, None),
+    Among("sneg", 805, 159, None),
+    Among("\u{0161}neg", 805, 88, None),
+    Among("oseg", -1, 123, None),
+    Among("ateg", -1, 120, None),
+    Among("aveg", -1, 77, None),
+    Among("eveg", -1, 78, None),
+    Among("iveg", -1, 79, None),
+    Among("oveg", -1, 80, None),
+    Among("a\u{0107}eg", -1, 14, None),
+    Among("e\u{0107}eg", -1, 15, None),
+    Among("u\u{0107}eg", -1, 16, None),
+    Among("o\u{0161}eg", -1, 91, None),
+    Among("acog", -1, 124, None),
+    Among("ecog", -1, 125, None),
+    Among("ucog", -1, 126, None),
+    Among("anjog", -1, 84, None),
+    Among("enjog", -1, 85, None),
+    Among("snjog", -1, 122, None),
+    Among("\u{0161}njog", -1, 86, None),
+    Among("kog", -1, 95, None),
+    Among("skog", 827, 1, None),
+    Among("\u{0161}kog", 827, 2, None),
+    Among("elog", -1, 83, None),
+    Among("nog", -1, 13, None),
+    Among("cinog", 831, 137, None),
+    Among("\u{010D}inog", 831, 89, None),
+    Among("osog", -1, 123, None),
+    Among("atog", -1, 120, None),
+    Among("evitog", -1, 92, None),
+    Among("ovitog", -1, 93, None),
+    Among("astog", -1, 94, None),
+    Among("avog", -1, 77, None),
+    Among("evog", -1, 78, None),
+    Among("ivog", -1, 79, None),
+    Among("ovog", -1, 80, None),
+    Among("a\u{0107}og", -1, 14, None),
+    Among("e\u{0107}og", -1, 15, None),
+    Among("u\u{0107}og", -1, 16, None),
+    Among("o\u{0161}og", -1, 91, None),
+    Among("ah", -1, 104, None),
+    Among("acah", 847, 128, None),
+    Among("astajah", 847, 106, None),
+    Among("istajah", 847, 107, None),
+    Among("ostajah", 847, 108, None),
+    Among("injah", 847, 114, None),
+    Among("irah", 847, 100, None),
+    Among("urah", 847, 105, None),
+    Among("tah", 847, 113, None),
+    Among("avah", 847, 97, None),
+    Among("evah", 847, 96, None),
+    Among("ivah", 847, 98, None),
+    Among("ovah", 847, 76, None),
+    Among("uvah", 847, 99, None),
+    Among("a\u{010D}ah", 847, 102, None),
+    Among("ih", -1, 116, None),
+    Among("acih", 862, 124, None),
+    Among("ecih", 862, 125, None),
+    Among("ucih", 862, 126, None),
+    Among("lucih", 865, 121, None),
+    Among("anjijih", 862, 84, None),
+    Among("enjijih", 862, 85, None),
+    Among("snjijih", 862, 122, None),
+    Among("\u{0161}njijih", 862, 86, None),
+    Among("kijih", 862, 95, None),
+    Among("skijih", 871, 1, None),
+    Among("\u{0161}kijih", 871, 2, None),
+    Among("elijih", 862, 83, None),
+    Among("nijih", 862, 13, None),
+    Among("osijih", 862, 123, None),
+    Among("atijih", 862, 120, None),
+    Among("evitijih", 862, 92, None),
+    Among("ovitijih", 862, 93, None),
+    Among("astijih", 862, 94, None),
+    Among("avijih", 862, 77, None),
+    Among("evijih", 862, 78, None),
+    Among("ivijih", 862, 79, None),
+    Among("ovijih", 862, 80, None),
+    Among("o\u{0161}ijih", 862, 91, None),
+    Among("anjih", 862, 84, None),
+    Among("enjih", 862, 85, None),
+    Among("snjih", 862, 122, None),
+    Among("\u{0161}njih", 862, 86, None),
+    Among("kih", 862, 95, None),
+    Among("skih", 890, 1, None),
+    Among("\u{0161}kih", 890, 2, None),
+    Among("elih", 862, 83, None),
+    Among("nih", 862, 13, None),
+    Among("cinih", 894, 137, None),
+    Among("\u{010D}inih", 894, 89, None),
+    Among("osih", 862, 123, None),
+    Among("rosih", 897, 127, None),
+    Among("atih", 862, 120, None),
+    Among("jetih", 862, 118, None),
+    Among("evitih", 862, 92, None),
+    Among("ovitih", 862, 93, None),
+    Among("astih", 862, 94, None),
+    Among("avih", 862, 77, None),
+    Among("evih", 862, 78, None),
+    Among("ivih", 862, 79, None),
+    Among("ovih", 862, 80, None),
+    Among("a\u{0107}ih", 862, 14, None),
+    Among("e\u{0107}ih", 862, 15, None),
+    Among("u\u{0107}ih", 862, 16, None),
+    Among("a\u{010D}ih", 862, 101, None),
+    Among("lu\u{010D}ih", 862, 117, None),
+    Among("o\u{0161}ih", 862, 91, None),
+    Among("ro\u{0161}ih", 913, 90, None),
+    Among("astadoh", -1, 110, None),
+    Among("istadoh", -1, 111, None),
+    Among("ostadoh", -1, 112, None),
+    Among("acuh", -1, 124, None),
+    Among("ecuh", -1, 125, None),
+    Among("ucuh", -1, 126, None),
+    Among("a\u{0107}uh", -1, 14, None),
+    Among("e\u{0107}uh", -1, 15, None),
+    Among("u\u{0107}uh", -1, 16, None),
+    Among("aci", -1, 124, None),
+    Among("aceci", -1, 124, None),
+    Among("ieci", -1, 162, None),
+    Among("ajuci", -1, 161, None),
+    Among("irajuci", 927, 155, None),
+    Among("urajuci", 927, 156, None),
+    Among("astajuci", 927, 138, None),
+    Among("istajuci", 927, 139, None),
+    Among("ostajuci", 927, 140, None),
+    Among("avajuci", 927, 144, None),
+    Among("evajuci", 927, 145, None),
+    Among("ivajuci", 927, 146, None),
+    Among("uvajuci", 927, 147, None),
+    Among("ujuci", -1, 157, None),
+    Among("lucujuci", 937, 121, None),
+    Among("irujuci", 937, 155, None),
+    Among("luci", -1, 121, None),
+    Among("nuci", -1, 164, None),
+    Among("etuci", -1, 153, None),
+    Among("astuci", -1, 136, None),
+    Among("gi", -1, 20, None),
+    Among("ugi", 944, 18, None),
+    Among("aji", -1, 109, None),
+    Among("caji", 946, 26, None),
+    Among("laji", 946, 30, None),
+    Among("raji", 946, 31, None),
+    Among("\u{0107}aji", 946, 28, None),
+    Among("\u{010D}aji", 946, 27, None),
+    Among("\u{0111}aji", 946, 29, None),
+    Among("biji", -1, 32, None),
+    Among("ciji", -1, 33, None),
+    Among("diji", -1, 34, None),
+    Among("fiji", -1, 40, None),
+    Among("giji", -1, 39, None),
+    Among("anjiji", -1, 84, None),
+    Among("enjiji", -1, 85, None),
+    Among("snjiji", -1, 122, None),
+    Among("\u{0161}njiji", -1, 86, None),
+    Among("kiji", -1, 95, None),
+    Among("skiji", 962, 1, None),
+    Among("\u{0161}kiji", 962, 2, None),
+    Among("liji", -1, 35, None),
+    Among("eliji", 965, 83, None),
+    Among("miji", -1, 37, None),
+    Among("niji", -1, 13, None),
+    Among("ganiji", 968, 9, None),
+    Among("maniji", 968, 6, None),
+    Among("paniji", 968, 7, None),
+    Among("raniji", 968, 8, None),
+    Among("taniji", 968, 5, None),
+    Among("piji", -1, 41, None),
+    Among("riji", -1, 42, None),
+    Among("siji", -1, 43, None),
+    Among("osiji", 976, 123, None),
+    Among("tiji", -1, 44, None),
+    Among("atiji", 978, 120, None),
+    Among("evitiji", 978, 92, None),
+    Among("ovitiji", 978, 93, None),
+    Among("astiji", 978, 94, None),
+    Among("aviji", -1, 77, None),
+    Among("eviji", -1, 78, None),
+    Among("iviji", -1, 79, None),
+    Among("oviji", -1, 80, None),
+    Among("ziji", -1, 45, None),
+    Among("o\u{0161}iji", -1, 91, None),
+    Among("\u{017E}iji", -1, 38, None),
+    Among("anji", -1, 84, None),
+    Among("enji", -1, 85, None),
+    Among("snji", -1, 122, None),
+    Among("\u{0161}nji", -1, 86, None),
+    Among("ki", -1, 95, None),
+    Among("ski", 994, 1, None),
+    Among("\u{0161}ki", 994, 2, None),
+    Among("ali", -1, 104, None),
+    Among("acali", 997, 128, None),
+    Among("astajali", 997, 106, None),
+    Among("istajali", 997, 107, None),
+    Among("ostajali", 997, 108, None),
+    Among("ijali", 997, 47, None),
+    Among("injali", 997, 114, None),
+    Among("nali", 997, 46, None),
+    Among("irali", 997, 100, None),
+    Among("urali", 997, 105, None),
+    Among("tali", 997, 113, None),
+    Among("astali", 1007, 110, None),
+    Among("istali", 1007, 111, None),
+    Among("ostali", 1007, 112, None),
+    Among("avali", 997, 97, None),
+    Among("evali", 997, 96, None),
+    Among("ivali", 997, 98, None),
+    Among("ovali", 997, 76, None),
+    Among("uvali", 997, 99, None),
+    Among("a\u{010D}ali", 997, 102, None),
+    Among("eli", -1, 83, None),
+    Among("ili", -1, 116, None),
+    Among("acili", 1018, 124, None),
+    Among("lucili", 1018, 121, None),
+    Among("nili", 1018, 103, None),
+    Among("rosili", 1018, 127, None),
+    Among("jetili", 1018, 118, None),
+    Among("ozili", 1018, 48, None),
+    Among("a\u{010D}ili", 1018, 101, None),
+    Among("lu\u{010D}ili", 1018, 117, None),
+    Among("ro\u{0161}ili", 1018, 90, None),
+    Among("oli", -1, 50, None),
+    Among("asli", -1, 115, None),
+    Among("nuli", -1, 13, None),
+    Among("rami", -1, 52, None),
+    Among("lemi", -1, 51, None),
+    Among("ni", -1, 13, None),
+    Among("ani", 1033, 10, None),
+    Among("acani", 1034, 128, None),
+    Among("urani", 1034, 105, None),
+    Among("tani", 1034, 113, None),
+    Among("avani", 1034, 97, None),
+    Among("evani", 1034, 96, None),
+    Among("ivani", 1034, 98, None),
+    Among("uvani", 1034, 99, None),
+    Among("a\u{010D}ani", 1034, 102, None),
+    Among("aceni", 1033, 124, None),
+    Among("luceni", 1033, 121, None),
+    Among("a\u{010D}eni", 1033, 101, None),
+    Among("lu\u{010D}eni", 1033, 117, None),
+    Among("ini", 1033, 11, None),
+    Among("cini", 1047, 137, None),
+    Among("\u{010D}ini", 1047, 89, None),
+    Among("oni", 1033, 12, None),
+    Among("ari", -1, 53, None),
+    Among("dri", -1, 54, None),
+    Among("eri", -1, 55, None),
+    Among("ori", -1, 56, None),
+    Among("basi", -1, 135, None),
+    Among("gasi", -1, 131, None),
+    Among("jasi", -1, 129, None),
+    Among("kasi", -1, 133, None),
+    Among("nasi", -1, 132, None),
+    Among("tasi", -1, 130, None),
+    Among("vasi", -1, 134, None),
+    Among("esi", -1, 152, None),
+    Among("isi", -1, 154, None),
+    Among("osi", -1, 123, None),
+    Among("avsi", -1, 161, None),
+    Among("acavsi", 1065, 128, None),
+    Among("iravsi", 1065, 155, None),
+    Among("tavsi", 1065, 160, None),
+    Among("etavsi", 1068, 153, None),
+    Among("astavsi", 1068, 141, None),
+    Among("istavsi", 1068, 142, None),
+    Among("ostavsi", 1068, 143, None),
+    Among("ivsi", -1, 162, None),
+    Among("nivsi", 1073, 158, None),
+    Among("rosivsi", 1073, 127, None),
+    Among("nuvsi", -1, 164, None),
+    Among("ati", -1, 104, None),
+    Among("acati", 1077, 128, None),
+    Among("astajati", 1077, 106, None),
+    Among("istajati", 1077, 107, None),
+    Among("ostajati", 1077, 108, None),
+    Among("injati", 1077, 114, None),
+    Among("ikati", 1077, 68, None),
+    Among("lati", 1077, 69, None),
+    Among("irati", 1077, 100, None),
+    Among("urati", 1077, 105, None),
+    Among("tati", 1077, 113, None),
+    Among("astati", 1087, 110, None),
+    Among("istati", 1087, 111, None),
+    Among("ostati", 1087, 112, None),
+    Among("avati", 1077, 97, None),
+    Among("evati", 1077, 96, None),
+    Among("ivati", 1077, 98, None),
+    Among("ovati", 1077, 76, None),
+    Among("uvati", 1077, 99, None),
+    Among("a\u{010D}ati", 1077, 102, None),
+    Among("eti", -1, 70, None),
+    Among("iti", -1, 116, None),
+    Among("aciti", 1098, 124, None),
+    Among("luciti", 1098, 121, None),
+    Among("niti", 1098, 103, None),
+    Among("rositi", 1098, 127, None),
+    Among("jetiti", 1098, 118, None),
+    Among("eviti", 1098, 92, None),
+    Among("oviti", 1098, 93, None),
+    Among("a\u{010D}iti", 1098, 101, None),
+    Among("lu\u{010D}iti", 1098, 117, None),
+    Among("ro\u{0161}iti", 1098, 90, None),
+    Among("asti", -1, 94, None),
+    Among("esti", -1, 71, None),
+    Among("isti", -1, 72, None),
+    Among("ksti", -1, 73, None),
+    Among("osti", -1, 74, None),
+    Among("nuti", -1, 13, None),
+    Among("avi", -1, 77, None),
+    Among("evi", -1, 78, None),
+    Among("ajevi", 1116, 109, None),
+    Among("cajevi", 1117, 26, None),
+    Among("lajevi", 1117, 30, None),
+    Among("rajevi", 1117, 31, None),
+    Among("\u{0107}ajevi", 1117, 28, None),
+    Among("\u{010D}ajevi", 1117, 27, None),
+    Among("\u{0111}ajevi", 1117, 29, None),
+    Among("ivi", -1, 79, None),
+    Among("ovi", -1, 80, None),
+    Among("govi", 1125, 20, None),
+    Among("ugovi", 1126, 17, None),
+    Among("lovi", 1125, 82, None),
+    Among("olovi", 1128, 49, None),
+    Among("movi", 1125, 81, None),
+    Among("onovi", 1125, 12, None),
+    Among("ie\u{0107}i", -1, 116, None),
+    Among("a\u{010D}e\u{0107}i", -1, 101, None),
+    Among("aju\u{0107}i", -1, 104, None),
+    Among("iraju\u{0107}i", 1134, 100, None),
+    Among("uraju\u{0107}i", 1134, 105, None),
+    Among("astaju\u{0107}i", 1134, 106, None),
+    Among("istaju\u{0107}i", 1134, 107, None),
+    Among("ostaju\u{0107}i", 1134, 108, None),
+    Among("avaju\u{0107}i", 1134, 97, None),
+    Among("evaju\u{0107}i", 1134, 96, None),
+    Among("ivaju\u{0107}i", 1134, 98, None),
+    Among("uvaju\u{0107}i", 1134, 99, None),
+    Among("uju\u{0107}i", -1, 25, None),
+    Among("iruju\u{0107}i", 1144, 100, None),
+    Among("lu\u{010D}uju\u{0107}i", 1144, 117, None),
+    Among("nu\u{0107}i", -1, 13, None),
+    Among("etu\u{0107}i", -1, 70, None),
+    Among("astu\u{0107}i", -1, 115, None),
+    Among("a\u{010D}i", -1, 101, None),
+    Among("lu\u{010D}i", -1, 117, None),
+    Among("ba\u{0161}i", -1, 63, None),
+    Among("ga\u{0161}i", -1, 64, None),
+    Among("ja\u{0161}i", -1, 61, None),
+    Among("ka\u{0161}i", -1, 62, None),
+    Among("na\u{0161}i", -1, 60, None),
+    Among("ta\u{0161}i", -1, 59, None),
+    Among("va\u{0161}i", -1, 65, None),
+    Among("e\u{0161}i", -1, 66, None),
+    Among("i\u{0161}i", -1, 67, None),
+    Among("o\u{0161}i", -1, 91, None),
+    Among("av\u{0161}i", -1, 104, None),
+    Among("irav\u{0161}i", 1162, 100, None),
+    Among("tav\u{0161}i", 1162, 113, None),
+    Among("etav\u{0161}i", 1164, 70, None),
+    Among("astav\u{0161}i", 1164, 110, None),
+    Among("istav\u{0161}i", 1164, 111, None),
+    Among("ostav\u{0161}i", 1164, 112, None),
+    Among("a\u{010D}av\u{0161}i", 1162, 102, None),
+    Among("iv\u{0161}i", -1, 116, None),
+    Among("niv\u{0161}i", 1170, 103, None),
+    Among("ro\u{0161}iv\u{0161}i", 1170, 90, None),
+    Among("nuv\u{0161}i", -1, 13, None),
+    Among("aj", -1, 104, None),
+    Among("uraj", 1174, 105, None),
+    Among("taj", 1174, 113, None),
+    Among("avaj", 1174, 97, None),
+    Among("evaj", 1174, 96, None),
+    Among("ivaj", 1174, 98, None),
+    Among("uvaj", 1174, 99, None),
+    Among("ij", -1, 116, None),
+    Among("acoj", -1, 124, None),
+    Among("ecoj", -1, 125, None),
+    Among("ucoj", -1, 126, None),
+    Among("anjijoj", -1, 84, None),
+    Among("enjijoj", -1, 85, None),
+    Among("snjijoj", -1, 122, None),
+    Among("\u{0161}njijoj", -1, 86, None),
+    Among("kijoj", -1, 95, None),
+    Among("skijoj", 1189, 1, None),
+    Among("\u{0161}kijoj", 1189, 2, None),
+    Among("elijoj", -1, 83, None),
+    Among("nijoj", -1, 13, None),
+    Among("osijoj", -1, 123, None),
+    Among("evitijoj", -1, 92, None),
+    Among("ovitijoj", -1, 93, None),
+    Among("astijoj", -1, 94, None),
+    Among("avijoj", -1, 77, None),
+    Among("evijoj", -1, 78, None),
+    Among("ivijoj", -1, 79, None),
+    Among("ovijoj", -1, 80, None),
+    Among("o\u{0161}ijoj", -1, 91, None),
+    Among("anjoj", -1, 84, None),
+    Among("enjoj", -1, 85, None),
+    Among("snjoj", -1, 122, None),
+    Among("\u{0161}njoj", -1, 86, None),
+    Among("koj", -1, 95, None),
+    Among("skoj", 1207, 1, None),
+    Among("\u{0161}koj", 1207, 2, None),
+    Among("aloj", -1, 104, None),
+    Among("eloj", -1, 83, None),
+    Among("noj", -1, 13, None),
+    Among("cinoj", 1212, 137, None),
+    Among("\u{010D}inoj", 1212, 89, None),
+    Among("osoj", -1, 123, None),
+    Among("atoj", -1, 120, None),
+    Among("evitoj", -1, 92, None),
+    Among("ovitoj", -1, 93, None),
+    Among("astoj", -1, 94, None),
+    Among("avoj", -1, 77, None),
+    Among("evoj", -1, 78, None),
+    Among("ivoj", -1, 79, None),
+    Among("ovoj", -1, 80, None),
+    Among("a\u{0107}oj", -1, 14, None),
+    Among("e\u{0107}oj", -1, 15, None),
+    Among("u\u{0107}oj", -1, 16, None),
+    Among("o\u{0161}oj", -1, 91, None),
+    Among("lucuj", -1, 121, None),
+    Among("iruj", -1, 100, None),
+    Among("lu\u{010D}uj", -1, 117, None),
+    Among("al", -1, 104, None),
+    Among("iral", 1231, 100, None),
+    Among("ural", 1231, 105, None),
+    Among("el", -1, 119, None),
+    Among("il", -1, 116, None),
+    Among("am", -1, 104, None),
+    Among("acam", 1236, 128, None),
+    Among("iram", 1236, 100, None),
+    Among("uram", 1236, 105, None),
+    Among("tam", 1236, 113, None),
+    Among("avam", 1236, 97, None),
+    Among("evam", 1236, 96, None),
+    Among("ivam", 1236, 98, None),
+    Among("uvam", 1236, 99, None),
+    Among("a\u{010D}am", 1236, 102, None),
+    Among("em", -1, 119, None),
+    Among("acem", 1246, 124, None),
+    Among("ecem", 1246, 125, None),
+    Among("ucem", 1246, 126, None),
+    Among("astadem", 1246, 110, None),
+    Among("istadem", 1246, 111, None),
+    Among("ostadem", 1246, 112, None),
+    Among("ajem", 1246, 104, None),
+    Among("cajem", 1253, 26, None),
+    Among("lajem", 1253, 30, None),
+    Among("rajem", 1253, 31, None),
+    Among("astajem", 1253, 106, None),
+    Among("istajem", 1253, 107, None),
+    Among("ostajem", 1253, 108, None),
+    Among("\u{0107}ajem", 1253, 28, None),
+    Among("\u{010D}ajem", 1253, 27, None),
+    Among("\u{0111}ajem", 1253, 29, None),
+    Among("ijem", 1246, 116, None),
+    Among("anjijem", 1263, 84, None),
+    Among("enjijem", 1263, 85, None),
+    Among("snjijem", 1263, 123, None),
+    Among("\u{0161}njijem", 1263, 86, None),
+    Among("kijem", 1263, 95, None),
+    Among("skijem", 1268, 1, None),
+    Among("\u{0161}kijem", 1268, 2, None),
+    Among("lijem", 1263, 24, None),
+    Among("elijem", 1271, 83, None),
+    Among("nijem", 1263, 13, None),
+    Among("rarijem", 1263, 21, None),
+    Among("sijem", 1263, 23, None),
+    Among("osijem", 1275, 123, None),
+    Among("atijem", 1263, 120, None),
+    Among("evitijem", 1263, 92, None),
+    Among("ovitijem", 1263, 93, None),
+    Among("otijem", 1263, 22, None),
+    Among("astijem", 1263, 94, None),
+    Among("avijem", 1263, 77, None),
+    Among("evijem", 1263, 78, None),
+    Among("ivijem", 1263, 79, None),
+    Among("ovijem", 1263, 80, None),
+    Among("o\u{0161}ijem", 1263, 91, None),
+    Among("anjem", 1246, 84, None),
+    Among("enjem", 1246, 85, None),
+    Among("injem", 1246, 114, None),
+    Among("snjem", 1246, 122, None),
+    Among("\u{0161}njem", 1246, 86, None),
+    Among("ujem", 1246, 25, None),
+    Among("lucujem", 1292, 121, None),
+    Among("irujem", 1292, 100, None),
+    Among("lu\u{010D}ujem", 1292, 117, None),
+    Among("kem", 1246, 95, None),
+    Among("skem", 1296, 1, None),
+    Among("\u{0161}kem", 1296, 2, None),
+    Among("elem", 1246, 83, None),
+    Among("nem", 1246, 13, None),
+    Among("anem", 1300, 10, None),
+    Among("astanem", 1301, 110, None),
+    Among("istanem", 1301, 111, None),
+    Among("ostanem", 1301, 112, None),
+    Among("enem", 1300, 87, None),
+    Among("snem", 1300, 159, None),
+    Among("\u{0161}nem", 1300, 88, None),
+    Among("basem", 1246, 135, None),
+    Among("gasem", 1246, 131, None),
+    Among("jasem", 1246, 129, None),
+    Among("kasem", 1246, 133, None),
+    Among("nasem", 1246, 132, None),
+    Among("tasem", 1246, 130, None),
+    Among("vasem", 1246, 134, None),
+    Among("esem", 1246, 152, None),
+    Among("isem", 1246, 154, None),
+    Among("osem", 1246, 123, None),
+    Among("atem", 1246, 120, None),
+    Among("etem", 1246, 70, None),
+    Among("evitem", 1246, 92, None),
+    Among("ovitem", 1246, 93, None),
+    Among("astem", 1246, 94, None),
+    Among("istem", 1246, 151, None),
+    Among("i\u{0161}tem", 1246, 75, None),
+    Among("avem", 1246, 77, None),
+    Among("evem", 1246, 78, None),
+    Among("ivem", 1246, 79, None),
+    Among("a\u{0107}em", 1246, 14, None),
+    Among("e\u{0107}em", 1246, 15, None),
+    Among("u\u{0107}em", 1246, 16, None),
+    Among("ba\u{0161}em", 1246, 63, None),
+    Among("ga\u{0161}em", 1246, 64, None),
+    Among("ja\u{0161}em", 1246, 61, None),
+    Among("ka\u{0161}em", 1246, 62, None),
+    Among("na\u{0161}em", 1246, 60, None),
+    Among("ta\u{0161}em", 1246, 59, None),
+    Among("va\u{0161}em", 1246, 65, None),
+    Among("e\u{0161}em", 1246, 66, None),
+    Among("i\u{0161}em", 1246, 67, None),
+    Among("o\u{0161}em", 1246, 91, None),
+    Among("im", -1, 116, None),
+    Among("acim", 1341, 124, None),
+    Among("ecim", 1341, 125, None),
+    Among("ucim", 1341, 126, None),
+    Among("lucim", 1344, 121, None),
+    Among("anjijim", 1341, 84, None),
+    Among("enjijim", 1341, 85, None),
+    Among("snjijim", 1341, 122, None),
+    Among("\u{0161}njijim", 1341, 86, None),
+    Among("kijim", 1341, 95, None),
+    Among("skijim", 1350, 1, None),
+    Among("\u{0161}kijim", 1350, 2, None),
+    Among("elijim", 1341, 83, None),
+    Among("nijim", 1341, 13, None),
+    Among("osijim", 1341, 123, None),
+    Among("atijim", 1341, 120, None),
+    Among("evitijim", 1341, 92, None),
+    Among("ovitijim", 1341, 93, None),
+    Among("astijim", 1341, 94, None),
+    Among("avijim", 1341, 77, None),
+    Among("evijim", 1341, 78, None),
+    Among("ivijim", 1341, 79, None),
+    Among("ovijim", 1341, 80, None),
+    Among("o\u{0161}ijim", 1341, 91, None),
+    Among("anjim", 1341, 84, None),
+    Among("enjim", 1341, 85, None),
+    Among("snjim", 1341, 122, None),
+    Among("\u{0161}njim", 1341, 86, None),
+    Among("kim", 1341, 95, None),
+    Among("skim", 1369, 1, None),
+    Among("\u{0161}kim", 1369, 2, None),
+    Among("elim", 1341, 83, None),
+    Among("nim", 1341, 13, None),
+    Among("cinim", 1373, 137, None),
+    Among("\u{010D}inim", 1373, 89, None),
+    Among("osim", 1341, 123, None),
+    Among("rosim", 1376, 127, None),
+    Among("atim", 1341, 120, None),
+    Among("jetim", 1341, 118, None),
+    Among("evitim", 1341, 92, None),
+    Among("ovitim", 1341, 93, None),
+    Among("astim", 1341, 94, None),
+    Among("avim", 1341, 77, None),
+    Among("evim", 1341, 78, None),
+    Among("ivim", 1341, 79, None),
+    Among("ovim", 1341, 80, None),
+    Among("a\u{0107}im", 1341, 14, None),
+    Among("e\u{0107}im", 1341, 15, None),
+    Among("u\u{0107}im", 1341, 16, None),
+    Among("a\u{010D}im", 1341, 101, None),
+    Among("lu\u{010D}im", 1341, 117, None),
+    Among("o\u{0161}im", 1341, 91, None),
+    Among("ro\u{0161}im", 1392, 90, None),
+    Among("acom", -1, 124, None),
+    Among("ecom", -1, 125, None),
+    Among("ucom", -1, 126, None),
+    Among("gom", -1, 20, None),
+    Among("logom", 1397, 19, None),
+    Among("ugom", 1397, 18, None),
+    Among("bijom", -1, 32, None),
+    Among("cijom", -1, 33, None),
+    Among("dijom", -1, 34, None),
+    Among("fijom", -1, 40, None),
+    Among("gijom", -1, 39, None),
+    Among("lijom", -1, 35, None),
+    Among("mijom", -1, 37, None),
+    Among("nijom", -1, 36, None),
+    Among("ganijom", 1407, 9, None),
+    Among("manijom", 1407, 6, None),
+    Among("panijom", 1407, 7, None),
+    Among("ranijom", 1407, 8, None),
+    Among("tanijom", 1407, 5, None),
+    Among("pijom", -1, 41, None),
+    Among("rijom", -1, 42, None),
+    Among("sijom", -1, 43, None),
+    Among("tijom", -1, 44, None),
+    Among("zijom", -1, 45, None),
+    Among("\u{017E}ijom", -1, 38, None),
+    Among("anjom", -1, 84, None),
+    Among("enjom", -1, 85, None),
+    Among("snjom", -1, 122, None),
+    Among("\u{0161}njom", -1, 86, None),
+    Among("kom", -1, 95, None),
+    Among("skom", 1423, 1, None),
+    Among("\u{0161}kom", 1423, 2, None),
+    Among("alom", -1, 104, None),
+    Among("ijalom", 1426, 47, None),
+    Among("nalom", 1426, 46, None),
+    Among("elom", -1, 83, None),
+    Among("ilom", -1, 116, None),
+    Among("ozilom", 1430, 48, None),
+    Among("olom", -1, 50, None),
+    Among("ramom", -1, 52, None),
+    Among("lemom", -1, 51, None),
+    Among("nom", -1, 13, None),
+    Among("anom", 1435, 10, None),
+    Among("inom", 1435, 11, None),
+    Among("cinom", 1437, 137, None),
+    Among("aninom", 1437, 10, None),
+    Among("\u{010D}inom", 1437, 89, None),
+    Among("onom", 1435, 12, None),
+    Among("arom", -1, 53, None),
+    Among("drom", -1, 54, None),
+    Among("erom", -1, 55, None),
+    Among("orom", -1, 56, None),
+    Among("basom", -1, 135, None),
+    Among("gasom", -1, 131, None),
+    Among("jasom", -1, 129, None),
+    Among("kasom", -1, 133, None),
+    Among("nasom", -1, 132, None),
+    Among("tasom", -1, 130, None),
+    Among("vasom", -1, 134, None),
+    Among("esom", -1, 57, None),
+    Among("isom", -1, 58, None),
+    Among("osom", -1, 123, None),
+    Among("atom", -1, 120, None),
+    Among("ikatom", 1456, 68, None),
+    Among("latom", 1456, 69, None),
+    Among("etom", -1, 70, None),
+    Among("evitom", -1, 92, None),
+    Among("ovitom", -1, 93, None),
+    Among("astom", -1, 94, None),
+    Among("estom", -1, 71, None),
+    Among("istom", -1, 72, None),
+    Among("kstom", -1, 73, None),
+    Among("ostom", -1, 74, None),
+    Among("avom", -1, 77, None),
+    Among("evom", -1, 78, None),
+    Among("ivom", -1, 79, None),
+    Among("ovom", -1, 80, None),
+    Among("lovom", 1470, 82, None),
+    Among("movom", 1470, 81, None),
+    Among("stvom", -1, 3, None),
+    Among("\u{0161}tvom", -1, 4, None),
+    Among("a\u{0107}om", -1, 14, None),
+    Among("e\u{0107}om", -1, 15, None),
+    Among("u\u{0107}om", -1, 16, None),
+    Among("ba\u{0161}om", -1, 63, None),
+    Among("ga\u{0161}om", -1, 64, None),
+    Among("ja\u{0161}om", -1, 61, None),
+    Among("ka\u{0161}om", -1, 62, None),
+    Among("na\u{0161}om", -1, 60, None),
+    Among("ta\u{0161}om", -1, 59, None),
+    Among("va\u{0161}om", -1, 65, None),
+    Among("e\u{0161}om", -1, 66, None),
+    Among("i\u{0161}om", -1, 67, None),
+    Among("o\u{0161}om", -1, 91, None),
+    Among("an", -1, 104, None),
+    Among("acan", 1488, 128, None),
+    Among("iran", 1488, 100, None),
+    Among("uran", 1488, 105, None),
+    Among("tan", 1488, 113, None),
+    Among("avan", 1488, 97, None),
+    Among("evan", 1488, 96, None),
+    Among("ivan", 1488, 98, None),
+    Among("uvan", 1488, 99, None),
+    Among("a\u{010D}an", 1488, 102, None),
+    Among("acen", -1, 124, None),
+    Among("lucen", -1, 121, None),
+    Among("a\u{010D}en", -1, 101, None),
+    Among("lu\u{010D}en", -1, 117, None),
+    Among("anin", -1, 10, None),
+    Among("ao", -1, 104, None),
+    Among("acao", 1503, 128, None),
+    Among("astajao", 1503, 106, None),
+    Among("istajao", 1503, 107, None),
+    Among("ostajao", 1503, 108, None),
+    Among("injao", 1503, 114, None),
+    Among("irao", 1503, 100, None),
+    Among("urao", 1503, 105, None),
+    Among("tao", 1503, 113, None),
+    Among("astao", 1511, 110, None),
+    Among("istao", 1511, 111, None),
+    Among("ostao", 1511, 112, None),
+    Among("avao", 1503, 97, None),
+    Among("evao", 1503, 96, None),
+    Among("ivao", 1503, 98, None),
+    Among("ovao", 1503, 76, None),
+    Among("uvao", 1503, 99, None),
+    Among("a\u{010D}ao", 1503, 102, None),
+    Among("go", -1, 20, None),
+    Among("ugo", 1521, 18, None),
+    Among("io", -1, 116, None),
+    Among("acio", 1523, 124, None),
+    Among("lucio", 1523, 121, None),
+    Among("lio", 1523, 24, None),
+    Among("nio", 1523, 103, None),
+    Among("rario", 1523, 21, None),
+    Among("sio", 1523, 23, None),
+    Among("rosio", 1529, 127, None),
+    Among("jetio", 1523, 118, None),
+    Among("otio", 1523, 22, None),
+    Among("a\u{010D}io", 1523, 101, None),
+    Among("lu\u{010D}io", 1523, 117, None),
+    Among("ro\u{0161}io", 1523, 90, None),
+    Among("bijo", -1, 32, None),
+    Among("cijo", -1, 33, None),
+    Among("dijo", -1, 34, None),
+    Among("fijo", -1, 40, None),
+    Among("gijo", -1, 39, None),
+    Among("lijo", -1, 35, None),
+    Among("mijo", -1, 37, None),
+    Among("nijo", -1, 36, None),
+    Among("pijo", -1, 41, None),
+    Among("rijo", -1, 42, None),
+    Among("sijo", -1, 43, None),
+    Among("tijo", -1, 44, None),
+    Among("zijo", -1, 45, None),
+    Among("\u{017E}ijo", -1, 38, None),
+    Among("anjo", -1, 84, None),
+    Among("enjo", -1, 85, None),
+    Among("snjo", -1, 122, None),
+    Among("\u{0161}njo", -1, 86, None),
+    Among("ko", -1, 95, None),
+    Among("sko", 1554, 1, None),
+    Among("\u{0161}ko", 1554, 2, None),
+    Among("alo", -1, 104, None),
+    Among("acalo", 1557, 128, None),
+    Among("astajalo", 1557, 106, None),
+    Among("istajalo", 1557, 107, None),
+    Among("ostajalo", 1557, 108, None),
+    Among("ijalo", 1557, 47, None),
+    Among("injalo", 1557, 114, None),
+    Among("nalo", 1557, 46, None),
+    Among("iralo", 1557, 100, None),
+    Among("uralo", 1557, 105, None),
+    Among("talo", 1557, 113, None),
+    Among("astalo", 1567, 110, None),
+    Among("istalo", 1567, 111, None),
+    Among("ostalo", 1567, 112, None),
+    Among("avalo", 1557, 97, None),
+    Among("evalo", 1557, 96, None),
+    Among("ivalo", 1557, 98, None),
+    Among("ovalo", 1557, 76, None),
+    Among("uvalo", 1557, 99, None),
+    Among("a\u{010D}alo", 1557, 102, None),
+    Among("elo", -1, 83, None),
+    Among("ilo", -1, 116, None),
+    Among("acilo", 1578, 124, None),
+    Among("lucilo", 1578, 121, None),
+    Among("nilo", 1578, 103, None),
+    Among("rosilo", 1578, 127, None),
+    Among("jetilo", 1578, 118, None),
+    Among("a\u{010D}ilo", 1578, 101, None),
+    Among("lu\u{010D}ilo", 1578, 117, None),
+    Among("ro\u{0161}ilo", 1578, 90, None),
+    Among("aslo", -1, 115, None),
+    Among("nulo", -1, 13, None),
+    Among("amo", -1, 104, None),
+    Among("acamo", 1589, 128, None),
+    Among("ramo", 1589, 52, None),
+    Among("iramo", 1591, 100, None),
+    Among("uramo", 1591, 105, None),
+    Among("tamo", 1589, 113, None),
+    Among("avamo", 1589, 97, None),
+    Among("evamo", 1589, 96, None),
+    Among("ivamo", 1589, 98, None),
+    Among("uvamo", 1589, 99, None),
+    Among("a\u{010D}amo", 1589, 102, None),
+    Among("emo", -1, 119, None),
+    Among("astademo", 1600, 110, None),
+    Among("istademo", 1600, 111, None),
+    Among("ostademo", 1600, 112, None),
+    Among("astajemo", 1600, 106, None),
+    Among("istajemo", 1600, 107, None),
+    Among("ostajemo", 1600, 108, None),
+    Among("ijemo", 1600, 116, None),
+    Among("injemo", 1600, 114, None),
+    Among("ujemo", 1600, 25, None),
+    Among("lucujemo", 1609, 121, None),
+    Among("irujemo", 1609, 100, None),
+    Among("lu\u{010D}ujemo", 1609, 117, None),
+    Among("lemo", 1600, 51, None),
+    Among("nemo", 1600, 13, None),
+    Among("astanemo", 1614, 110, None),
+    Among("istanemo", 1614, 111, None),
+    Among("ostanemo", 1614, 112, None),
+    Among("etemo", 1600, 70, None),
+    Among("astemo", 1600, 115, None),
+    Among("imo", -1, 116, None),
+    Among("acimo", 1620, 124, None),
+    Among("lucimo", 1620, 121, None),
+    Among("nimo", 1620, 13, None),
+    Among("astanimo", 1623, 110, None),
+    Among("istanimo", 1623, 111, None),
+    Among("ostanimo", 1623, 112, None),
+    Among("rosimo", 1620, 127, None),
+    Among("etimo", 1620, 70, None),
+    Among("jetimo", 1628, 118, None),
+    Among("astimo", 1620, 115, None),
+    Among("a\u{010D}imo", 1620, 101, None),
+    Among("lu\u{010D}imo", 1620, 117, None),
+    Among("ro\u{0161}imo", 1620, 90, None),
+    Among("ajmo", -1, 104, None),
+    Among("urajmo", 1634, 105, None),
+    Among("tajmo", 1634, 113, None),
+    Among("astajmo", 1636, 106, None),
+    Among("istajmo", 1636, 107, None),
+    Among("ostajmo", 1636, 108, None),
+    Among("avajmo", 1634, 97, None),
+    Among("evajmo", 1634, 96, None),
+    Among("ivajmo", 1634, 98, None),
+    Among("uvajmo", 1634, 99, None),
+    Among("ijmo", -1, 116, None),
+    Among("ujmo", -1, 25, None),
+    Among("lucujmo", 1645, 121, None),
+    Among("irujmo", 1645, 100, None),
+    Among("lu\u{010D}ujmo", 1645, 117, None),
+    Among("asmo", -1, 104, None),
+    Among("acasmo", 1649, 128, None),
+    Among("astajasmo", 1649, 106, None),
+    Among("istajasmo", 1649, 107, None),
+    Among("ostajasmo", 1649, 108, None),
+    Among("injasmo", 1649, 114, None),
+    Among("irasmo", 1649, 100, None),
+    Among("urasmo", 1649, 105, None),
+    Among("tasmo", 1649, 113, None),
+    Among("avasmo", 1649, 97, None),
+    Among("evasmo", 1649, 96, None),
+    Among("ivasmo", 1649, 98, None),
+    Among("ovasmo", 1649, 76, None),
+    Among("uvasmo", 1649, 99, None),
+    Among("a\u{010D}asmo", 1649, 102, None),
+    Among("ismo", -1, 116, None),
+    Among("acismo", 1664, 124, None),
+    Among("lucismo", 1664, 121, None),
+    Among("nismo", 1664, 103, None),
+    Among("rosismo", 1664, 127, None),
+    Among("jetismo", 1664, 118, None),
+    Among("a\u{010D}ismo", 1664, 101, None),
+    Among("lu\u{010D}ismo", 1664, 117, None),
+    Among("ro\u{0161}ismo", 1664, 90, None),
+    Among("astadosmo", -1, 110, None),
+    Among("istadosmo", -1, 111, None),
+    Among("ostadosmo", -1, 112, None),
+    Among("nusmo", -1, 13, None),
+    Among("no", -1, 13, None),
+    Among("ano", 1677, 104, None),
+    Among("acano", 1678, 128, None),
+    Among("urano", 1678, 105, None),
+    Among("tano", 1678, 113, None),
+    Among("avano", 1678, 97, None),
+    Among("evano", 1678, 96, None),
+    Among("ivano", 1678, 98, None),
+    Among("uvano", 1678, 99, None),
+    Among("a\u{010D}ano", 1678, 102, None),
+    Among("aceno", 1677, 124, None),
+    Among("luceno", 1677, 121, None),
+    Among("a\u{010D}eno", 1677, 101, None),
+    Among("lu\u{010D}eno", 1677, 117, None),
+    Among("ino", 1677, 11, None),
+    Among("cino", 1691, 137, None),
+    Among("\u{010D}ino", 1691, 89, None),
+    Among("ato", -1, 120, None),
+    Among("ikato", 1694, 68, None),
+    Among("lato", 1694, 69, None),
+    Among("eto", -1, 70, None),
+    Among("evito", -1, 92, None),
+    Among("ovito", -1, 93, None),
+    Among("asto", -1, 94, None),
+    Among("esto", -1, 71, None),
+    Among("isto", -1, 72, None),
+    Among("ksto", -1, 73, None),
+    Among("osto", -1, 74, None),
+    Among("nuto", -1, 13, None),
+    Among("nuo", -1, 13, None),
+    Among("avo", -1, 77, None),
+    Among("evo", -1, 78, None),
+    Among("ivo", -1, 79, None),
+    Among("ovo", -1, 80, None),
+    Among("stvo", -1, 3, None),
+    Among("\u{0161}tvo", -1, 4, None),
+    Among("as", -1, 161, None),
+    Among("acas", 1713, 128, None),
+    Among("iras", 1713, 155, None),
+    Among("uras", 1713, 156, None),
+    Among("tas", 1713, 160, None),
+    Among("avas", 1713, 144, None),
+    Among("evas", 1713, 145, None),
+    Among("ivas", 1713, 146, None),
+    Among("uvas", 1713, 147, None),
+    Among("es", -1, 163, None),
+    Among("astades", 1722, 141, None),
+    Among("istades", 1722, 142, None),
+    Among("ostades", 1722, 143, None),
+    Among("astajes", 1722, 138, None),
+    Among("istajes", 1722, 139, None),
+    Among("ostajes", 1722, 140, None),
+    Among("ijes", 1722, 162, None),
+    Among("injes", 1722, 150, None),
+    Among("ujes", 1722, 157, None),
+    Among("lucujes", 1731, 121, None),
+    Among("irujes", 1731, 155, None),
+    Among("nes", 1722, 164, None),
+    Among("astanes", 1734, 141, None),
+    Among("istanes", 1734, 142, None),
+    Among("ostanes", 1734, 143, None),
+    Among("etes", 1722, 153, None),
+    Among("astes", 1722, 136, None),
+    Among("is", -1, 162, None),
+    Among("acis", 1740, 124, None),
+    Among("lucis", 1740, 121, None),
+    Among("nis", 1740, 158, None),
+    Among("rosis", 1740, 127, None),
+    Among("jetis", 1740, 149, None),
+    Among("at", -1, 104, None),
+    Among("acat", 1746, 128, None),
+    Among("astajat", 1746, 106, None),
+    Among("istajat", 1746, 107, None),
+    Among("ostajat", 1746, 108, None),
+    Among("injat", 1746, 114, None),
+    Among("irat", 1746, 100, None),
+    Among("urat", 1746, 105, None),
+    Among("tat", 1746, 113, None),
+    Among("astat", 1754, 110, None),
+    Among("istat", 1754, 111, None),
+    Among("ostat", 1754, 112, None),
+    Among("avat", 1746, 97, None),
+    Among("evat", 1746, 96, None),
+    Among("ivat", 1746, 98, None),
+    Among("irivat", 1760, 100, None),
+    Among("ovat", 1746, 76, None),
+    Among("uvat", 1746, 99, None),
+    Among("a\u{010D}at", 1746, 102, None),
+    Among("it", -1, 116, None),
+    Among("acit", 1765, 124, None),
+    Among("lucit", 1765, 121, None),
+    Among("rosit", 1765, 127, None),
+    Among("jetit", 1765, 118, None),
+    Among("a\u{010D}it", 1765, 101, None),
+    Among("lu\u{010D}it", 1765, 117, None),
+    Among("ro\u{0161}it", 1765, 90, None),
+    Among("nut", -1, 13, None),
+    Among("astadu", -1, 110, None),
+    Among("istadu", -1, 111, None),
+    Among("ostadu", -1, 112, None),
+    Among("gu", -1, 20, None),
+    Among("logu", 1777, 19, None),
+    Among("ugu", 1777, 18, None),
+    Among("ahu", -1, 104, None),
+    Among("acahu", 1780, 128, None),
+    Among("astajahu", 1780, 106, None),
+    Among("istajahu", 1780, 107, None),
+    Among("ostajahu", 1780, 108, None),
+    Among("injahu", 1780, 114, None),
+    Among("irahu", 1780, 100, None),
+    Among("urahu", 1780, 105, None),
+    Among("avahu", 1780, 97, None),
+    Among("evahu", 1780, 96, None),
+    Among("ivahu", 1780, 98, None),
+    Among("ovahu", 1780, 76, None),
+    Among("uvahu", 1780, 99, None),
+    Among("a\u{010D}ahu", 1780, 102, None),
+    Among("aju", -1, 104, None),
+    Among("caju", 1794, 26, None),
+    Among("acaju", 1795, 128, None),
+    Among("laju", 1794, 30, None),
+    Among("raju", 1794, 31, None),
+    Among("iraju", 1798, 100, None),
+    Among("uraju", 1798, 105, None),
+    Among("taju", 1794, 113, None),
+    Among("astaju", 1801, 106, None),
+    Among("istaju", 1801, 107, None),
+    Among("ostaju", 1801, 108, None),
+    Among("avaju", 1794, 97, None),
+    Among("evaju", 1794, 96, None),
+    Among("ivaju", 1794, 98, None),
+    Among("uvaju", 1794, 99, None),
+    Among("\u{0107}aju", 1794, 28, None),
+    Among("\u{010D}aju", 1794, 27, None),
+    Among("a\u{010D}aju", 1810, 102, None),
+    Among("\u{0111}aju", 1794, 29, None),
+    Among("iju", -1, 116, None),
+    Among("biju", 1813, 32, None),
+    Among("ciju", 1813, 33, None),
+    Among("diju", 1813, 34, None),
+    Among("fiju", 1813, 40, None),
+    Among("giju", 1813, 39, None),
+    Among("anjiju", 1813, 84, None),
+    Among("enjiju", 1813, 85, None),
+    Among("snjiju", 1813, 122, None),
+    Among("\u{0161}njiju", 1813, 86, None),
+    Among("kiju", 1813, 95, None),
+    Among("liju", 1813, 24, None),
+    Among("eliju", 1824, 83, None),
+    Among("miju", 1813, 37, None),
+    Among("niju", 1813, 13, None),
+    Among("ganiju", 1827, 9, None),
+    Among("maniju", 1827, 6, None),
+    Among("paniju", 1827, 7, None),
+    Among("raniju", 1827, 8, None),
+    Among("taniju", 1827, 5, None),
+    Among("piju", 1813, 41, None),
+    Among("riju", 1813, 42, None),
+    Among("rariju", 1834, 21, None),
+    Among("siju", 1813, 23, None),
+    Among("osiju", 1836, 123, None),
+    Among("tiju", 1813, 44, None),
+    Among("atiju", 1838, 120, None),
+    Among("otiju", 1838, 22, None),
+    Among("aviju", 1813, 77, None),
+    Among("eviju", 1813, 78, None),
+    Among("iviju", 1813, 79, None),
+    Among("oviju", 1813, 80, None),
+    Among("ziju", 1813, 45, None),
+    Among("o\u{0161}iju", 1813, 91, None),
+    Among("\u{017E}iju", 1813, 38, None),
+    Among("anju", -1, 84, None),
+    Among("enju", -1, 85, None),
+    Among("snju", -1, 122, None),
+    Among("\u{0161}nju", -1, 86, None),
+    Among("uju", -1, 25, None),
+    Among("lucuju", 1852, 121, None),
+    Among("iruju", 1852, 100, None),
+    Among("lu\u{010D}uju", 1852, 117, None),
+    Among("ku", -1, 95, None),
+    Among("sku", 1856, 1, None),
+    Among("\u{0161}ku", 1856, 2, None),
+    Among("alu", -1, 104, None),
+    Among("ijalu", 1859, 47, None),
+    Among("nalu", 1859, 46, None),
+    Among("elu", -1, 83, None),
+    Among("ilu", -1, 116, None),
+    Among("ozilu", 1863, 48, None),
+    Among("olu", -1, 50, None),
+    Among("ramu", -1, 52, None),
+    Among("acemu", -1, 124, None),
+    Among("ecemu", -1, 125, None),
+    Among("ucemu", -1, 126, None),
+    Among("anjijemu", -1, 84, None),
+    Among("enjijemu", -1, 85, None),
+    Among("snjijemu", -1, 122, None),
+    Among("\u{0161}njijemu", -1, 86, None),
+    Among("kijemu", -1, 95, None),
+    Among("skijemu", 1874, 1, None),
+    Among("\u{0161}kijemu", 1874, 2, None),
+    Among("elijemu", -1, 83, None),
+    Among("nijemu", -1, 13, None),
+    Among("osijemu", -1, 123, None),
+    Among("atijemu", -1, 120, None),
+    Among("evitijemu", -1, 92, None),
+    Among("ovitijemu", -1, 93, None),
+    Among("astijemu", -1, 94, None),
+    Among("avijemu", -1, 77, None),
+    Among("evijemu", -1, 78, None),
+    Among("ivijemu", -1, 79, None),
+    Among("ovijemu", -1, 80, None),
+    Among("o\u{0161}ijemu", -1, 91, None),
+    Among("anjemu", -1, 84, None),
+    Among("enjemu", -1, 85, None),
+    Among("snjemu", -1, 122, None),
+    Among("\u{0161}njemu", -1, 86, None),
+    Among("kemu", -1, 95, None),
+    Among("skemu", 1893, 1, None),
+    Among("\u{0161}kemu", 1893, 2, None),
+    Among("lemu", -1, 51, None),
+    Among("elemu", 1896, 83, None),
+    Among("nemu", -1, 13, None),
+    Among("anemu", 1898, 10, None),
+    Among("enemu", 1898, 87, None),
+    Among("snemu", 1898, 159, None),
+    Among("\u{0161}nemu", 1898, 88, None),
+    Among("osemu", -1, 123, None),
+    Among("atemu", -1, 120, None),
+    Among("evitemu", -1, 92, None),
+    Among("ovitemu", -1, 93, None),
+    Among("astemu", -1, 94, None),
+    Among("avemu", -1, 77, None),
+    Among("evemu", -1, 78, None),
+    Among("ivemu", -1, 79, None),
+    Among("ovemu", -1, 80, None),
+    Among("a\u{0107}emu", -1, 14, None),
+    Among("e\u{0107}emu", -1, 15, None),
+    Among("u\u{0107}emu", -1, 16, None),
+    Among("o\u{0161}emu", -1, 91, None),
+    Among("acomu", -1, 124, None),
+    Among("ecomu", -1, 125, None),
+    Among("ucomu", -1, 126, None),
+    Among("anjomu", -1, 84, None),
+    Among("enjomu", -1, 85, None),
+    Among("snjomu", -1, 122, None),
+    Among("\u{0161}njomu", -1, 86, None),
+    Among("komu", -1, 95, None),
+    Among("skomu", 1923, 1, None),
+    Among("\u{0161}komu", 1923, 2, None),
+    Among("elomu", -1, 83, None),
+    Among("nomu", -1, 13, None),
+    Among("cinomu", 1927, 137, None),
+    Among("\u{010D}inomu", 1927, 89, None),
+    Among("osomu", -1, 123, None),
+    Among("atomu", -1, 120, None),
+    Among("evitomu", -1, 92, None),
+    Among("ovitomu", -1, 93, None),
+    Among("astomu", -1, 94, None),
+    Among("avomu", -1, 77, None),
+    Among("evomu", -1, 78, None),
+    Among("ivomu", -1, 79, None),
+    Among("ovomu", -1, 80, None),
+    Among("a\u{0107}omu", -1, 14, None),
+    Among("e\u{0107}omu", -1, 15, None),
+    Among("u\u{0107}omu", -1, 16, None),
+    Among("o\u{0161}omu", -1, 91, None),
+    Among("nu", -1, 13, None),
+    Among("anu", 1943, 10, None),
+    Among("astanu", 1944, 110, None),
+    Among("istanu", 1944, 111, None),
+    Among("ostanu", 1944, 112, None),
+    Among("inu", 1943, 11, None),
+    Among("cinu", 1948, 137, None),
+    Among("aninu", 1948, 10, None),
+    Among("\u{010D}inu", 1948, 89, None),
+    Among("onu", 1943, 12, None),
+    Among("aru", -1, 53, None),
+    Among("dru", -1, 54, None),
+    Among("eru", -1, 55, None),
+    Among("oru", -1, 56, None),
+    Among("basu", -1, 135, None),
+    Among("gasu", -1, 131, None),
+    Among("jasu", -1, 129, None),
+    Among("kasu", -1, 133, None),
+    Among("nasu", -1, 132, None),
+    Among("tasu", -1, 130, None),
+    Among("vasu", -1, 134, None),
+    Among("esu", -1, 57, None),
+    Among("isu", -1, 58, None),
+    Among("osu", -1, 123, None),
+    Among("atu", -1, 120, None),
+    Among("ikatu", 1967, 68, None),
+    Among("latu", 1967, 69, None),
+    Among("etu", -1, 70, None),
+    Among("evitu", -1, 92, None),
+    Among("ovitu", -1, 93, None),
+    Among("astu", -1, 94, None),
+    Among("estu", -1, 71, None),
+    Among("istu", -1, 72, None),
+    Among("kstu", -1, 73, None),
+    Among("ostu", -1, 74, None),
+    Among("i\u{0161}tu", -1, 75, None),
+    Among("avu", -1, 77, None),
+    Among("evu", -1, 78, None),
+    Among("ivu", -1, 79, None),
+    Among("ovu", -1, 80, None),
+    Among("lovu", 1982, 82, None),
+    Among("movu", 1982, 81, None),
+    Among("stvu", -1, 3, None),
+    Among("\u{0161}tvu", -1, 4, None),
+    Among("ba\u{0161}u", -1, 63, None),
+    Among("ga\u{0161}u", -1, 64, None),
+    Among("ja\u{0161}u", -1, 61, None),
+    Among("ka\u{0161}u", -1, 62, None),
+    Among("na\u{0161}u", -1, 60, None),
+    Among("ta\u{0161}u", -1, 59, None),
+    Among("va\u{0161}u", -1, 65, None),
+    Among("e\u{0161}u", -1, 66, None),
+    Among("i\u{0161}u", -1, 67, None),
+    Among("o\u{0161}u", -1, 91, None),
+    Among("avav", -1, 97, None),
+    Among("evav", -1, 96, None),
+    Among("ivav", -1, 98, None),
+    Among("uvav", -1, 99, None),
+    Among("kov", -1, 95, None),
+    Among("a\u{0161}", -1, 104, None),
+    Among("ira\u{0161}", 2002, 100, None),
+    Among("ura\u{0161}", 2002, 105, None),
+    Among("ta\u{0161}", 2002, 113, None),
+    Among("ava\u{0161}", 2002, 97, None),
+    Among("eva\u{0161}", 2002, 96, None),
+    Among("iva\u{0161}", 2002, 98, None),
+    Among("uva\u{0161}", 2002, 99, None),
+    Among("a\u{010D}a\u{0161}", 2002, 102, None),
+    Among("e\u{0161}", -1, 119, None),
+    Among("astade\u{0161}", 2011, 110, None),
+    Among("istade\u{0161}", 2011, 111, None),
+    Among("ostade\u{0161}", 2011, 112, None),
+    Among("astaje\u{0161}", 2011, 106, None),
+    Among("istaje\u{0161}", 2011, 107, None),
+    Among("ostaje\u{0161}", 2011, 108, None),
+    Among("ije\u{0161}", 2011, 116, None),
+    Among("inje\u{0161}", 2011, 114, None),
+    Among("uje\u{0161}", 2011, 25, None),
+    Among("iruje\u{0161}", 2020, 100, None),
+    Among("lu\u{010D}uje\u{0161}", 2020, 117, None),
+    Among("ne\u{0161}", 2011, 13, None),
+    Among("astane\u{0161}", 2023, 110, None),
+    Among("istane\u{0161}", 2023, 111, None),
+    Among("ostane\u{0161}", 2023, 112, None),
+    Among("ete\u{0161}", 2011, 70, None),
+    Among("aste\u{0161}", 2011, 115, None),
+    Among("i\u{0161}", -1, 116, None),
+    Among("ni\u{0161}", 2029, 103, None),
+    Among("jeti\u{0161}", 2029, 118, None),
+    Among("a\u{010D}i\u{0161}", 2029, 101, None),
+    Among("lu\u{010D}i\u{0161}", 2029, 117, None),
+    Among("ro\u{0161}i\u{0161}", 2029, 90, None),
+];
+
+static A_3: &'static [Among<Context>; 26] = &[
+    Among("a", -1, 1, None),
+    Among("oga", 0, 1, None),
+    Among("ama", 0, 1, None),
+    Among("ima", 0, 1, None),
+    Among("ena", 0, 1, None),
+    Among("e", -1, 1, None),
+    Among("og", -1, 1, None),
+    Among("anog", 6, 1, None),
+    Among("enog", 6, 1, None),
+    Among("anih", -1, 1, None),
+    Among("enih", -1, 1, None),
+    Among("i", -1, 1, None),
+    Among("ani", 11, 1, None),
+    Among("eni", 11, 1, None),
+    Among("anoj", -1, 1, None),
+    Among("enoj", -1, 1, None),
+    Among("anim", -1, 1, None),
+    Among("enim", -1, 1, None),
+    Among("om", -1, 1, None),
+    Among("enom", 18, 1, None),
+    Among("o", -1, 1, None),
+    Among("ano", 20, 1, None),
+    Among("eno", 20, 1, None),
+    Among("ost", -1, 1, None),
+    Among("u", -1, 1, None),
+    Among("enu", 24, 1, None),
+];
+
+static G_v: &'static [u8; 3] = &[17, 65, 16];
+
+static G_sa: &'static [u8; 15] = &[65, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 128];
+
+static G_ca: &'static [u8; 36] = &[119, 95, 23, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 16];
+
+static G_rg: &'static [u8; 1] = &[1];
+
+#[derive(Clone)]
+struct Context {
+    i_p1: i32,
+    b_no_diacritics: bool,
+}
+
+pub fn stem(env: &mut SnowballEnv) -> bool {
+    let mut context = &mut Context {
+        i_p1: 0,
+        b_no_diacritics: false,
+    };
+    let mut among_var;
+    'lab0: loop {
+        let v_2 = env.cursor;
+        'lab1: loop {
+            'replab2: loop{
+                let v_3 = env.cursor;
+                'lab3: for _ in 0..1 {
+                    'golab4: loop {
+                        let v_4 = env.cursor;
+                        'lab5: loop {
+                            env.bra = env.cursor;
+                            among_var = env.find_among(A_0, context);
+                            if among_var == 0 {
+                                break 'lab5;
+                            }
+                            env.ket = env.cursor;
+                            if among_var == 1 {
+                                if !env.slice_from("a") {
+                                    return false;
+                                }
+                            } else if among_var == 2 {
+                                if !env.slice_from("b") {
+                                    return false;
+                                }
+                            } else if among_var == 3 {
+                                if !env.slice_from("v") {
+                                    return false;
+                                }
+                            } else if among_var == 4 {
+                                if !env.slice_from("g") {
+                                    return false;
+                                }
+                            } else if among_var == 5 {
+                                if !env.slice_from("d") {
+                                    return false;
+                                }
+                            } else if among_var == 6 {
+                                if !env.slice_from("\u{0111}") {
+                                    return false;
+                                }
+                            } else if among_var == 7 {
+                                if !env.slice_from("e") {
+                                    return false;
+                                }
+                            } else if among_var == 8 {
+                                if !env.slice_from("\u{017E}") {
+                                    return false;
+                                }
+                            } else if among_var == 9 {
+                                if !env.slice_from("z") {
+                                    return false;
+                                }
+                            } else if among_var == 10 {
+                                if !env.slice_from("i") {
+                                    return false;
+                                }
+                            } else if among_var == 11 {
+                                if !env.slice_from("j") {
+                                    return false;
+                                }
+                            } else if among_var == 12 {
+                                if !env.slice_from("k") {
+                                    return false;
+                                }
+                            } else if among_var == 13 {
+                                if !env.slice_from("l") {
+                                    return false;
+                                }
+                            } else if among_var == 14 {
+                                if !env.slice_from("lj") {
+                                    return false;
+                                }
+                            } else if among_var == 15 {
+                                if !env.slice_from("m") {
+                                    return false;
+                                }
+                            } else if among_var == 16 {
+                                if !env.slice_from("n") {
+                                    return false;
+                                }
+                            } else if among_var == 17 {
+                                if !env.slice_from("nj") {
+                                    return false;
+                                }
+                            } else if among_var == 18 {
+                                if !env.slice_from("o") {
+                                    return false;
+                                }
+                            } else if among_var == 19 {
+                                if !env.slice_from("p") {
+                                    return false;
+                                }
+                            } else if among_var == 20 {
+                                if !env.slice_from("r") {
+                                    return false;
+                                }
+                            } else if among_var == 21 {
+                                if !env.slice_from("s") {
+                                    return false;
+                                }
+                            } else if among_var == 22 {
+                                if !env.slice_from("t") {
+                                    return false;
+                                }
+                            } else if among_var == 23 {
+                                if !env.slice_from("\u{0107}") {
+                                    return false;
+                                }
+                            } else if among_var == 24 {
+                                if !env.slice_from("u") {
+                                    return false;
+                                }
+                            } else if among_var == 25 {
+                                if !env.slice_from("f") {
+                                    return false;
+                                }
+                            } else if among_var == 26 {
+                                if !env.slice_from("h") {
+                                    return false;
+                                }
+                            } else if among_var == 27 {
+                                if !env.slice_from("c") {
+                                    return false;
+                                }
+                            } else if among_var == 28 {
+                                if !env.slice_from("\u{010D}") {
+                                    return false;
+                                }
+                            } else if among_var == 29 {
+                                if !env.slice_from("d\u{017E}") {
+                                    return false;
+                                }
+                            } else if among_var == 30 {
+                                if !env.slice_from("\u{0161}") {
+                                    return false;
+                                }
+                            }
+                            env.cursor = v_4;
+                            break 'golab4;
+                        }
+                        env.cursor = v_4;
+                        if env.cursor >= env.limit {
+                            break 'lab3;
+                        }
+                        env.next_char();
+                    }
+                    continue 'replab2;
+                }
+                env.cursor = v_3;
+                break 'replab2;
+            }
+            break 'lab1;
+        }
+        env.cursor = v_2;
+        break 'lab0;
+    }
+    'lab6: loop {
+        let v_6 = env.cursor;
+        'lab7: loop {
+            'replab8: loop{
+                let v_7 = env.cursor;
+                'lab9: for _ in 0..1 {
+                    'golab10: loop {
+                        let v_8 = env.cursor;
+                        'lab11: loop {
+                            if !env.in_grouping(G_ca, 98, 382) {
+                                break 'lab11;
+                            }
+                            env.bra = env.cursor;
+                            if !env.eq_s(&"ije") {
+                                break 'lab11;
+                            }
+                            env.ket = env.cursor;
+                            if !env.in_grouping(G_ca, 98, 382) {
+                                break 'lab11;
+                            }
+                            if !env.slice_from("e") {
+                                return false;
+                            }
+                            env.cursor = v_8;
+                            break 'golab10;
+                        }
+                        env.cursor = v_8;
+                        if env.cursor >= env.limit {
+                            break 'lab9;
+                        }
+                        env.next_char();
+                    }
+                    continue 'replab8;
+                }
+                env.cursor = v_7;
+                break 'replab8;
+            }
+            break 'lab7;
+        }
+        env.cursor = v_6;
+        let v_9 = env.cursor;
+        'lab12: loop {
+            'replab13: loop{
+                let v_10 = env.cursor;
+                'lab14: for _ in 0..1 {
+                    'golab15: loop {
+                        let v_11 = env.cursor;
+                        'lab16: loop {
+                            if !env.in_grouping(G_ca, 98, 382) {
+                                break 'lab16;
+                            }
+                            env.bra = env.cursor;
+                            if !env.eq_s(&"je") {
+                                break 'lab16;
+                            }
+                            env.ket = env.cursor;
+                            if !env.in_grouping(G_ca, 98, 382) {
+                                break 'lab16;
+                            }
+                            if !env.slice_from("e") {
+                                return false;
+                            }
+                            env.cursor = v_11;
+                            break 'golab15;
+                        }
+                        env.cursor = v_11;
+                        if env.cursor >= env.limit {
+                            break 'lab14;
+                        }
+                        env.next_char();
+                    }
+                    continue 'replab13;
+                }
+                env.cursor = v_10;
+                break 'replab13;
+            }
+            break 'lab12;
+        }
+        env.cursor = v_9;
+        let v_12 = env.cursor;
+        'lab17: loop {
+            'replab18: loop{
+                let v_13 = env.cursor;
+                'lab19: for _ in 0..1 {
+                    'golab20: loop {
+                        let v_14 = env.cursor;
+                        'lab21: loop {
+                            env.bra = env.cursor;
+                            if !env.eq_s(&"dj") {
+                                break 'lab21;
+                            }
+                            env.ket = env.cursor;
+                            if !env.slice_from("\u{0111}") {
+                                return false;
+                            }
+                            env.cursor = v_14;
+                            break 'golab20;
+                        }
+                        env.cursor = v_14;
+                        if env.cursor >= env.limit {
+                            break 'lab19;
+                        }
+                        env.next_char();
+                    }
+                    continue 'replab18;
+                }
+                env.cursor = v_13;
+                break 'replab18;
+            }
+            break 'lab17;
+        }
+        env.cursor = v_12;
+        break 'lab6;
+    }
+    'lab22: loop {
+        context.b_no_diacritics = true;
+        let v_16 = env.cursor;
+        'lab23: loop {
+            'golab24: loop {
+                'lab25: loop {
+                    if !env.in_grouping(G_sa, 263, 382) {
+                        break 'lab25;
+                    }
+                    break 'golab24;
+                }
+                if env.cursor >= env.limit {
+                    break 'lab23;
+                }
+                env.next_char();
+            }
+            context.b_no_diacritics = false;
+            break 'lab23;
+        }
+        env.cursor = v_16;
+        context.i_p1 = env.limit;
+        let v_18 = env.cursor;
+        'lab26: loop {
+            'golab27: loop {
+                'lab28: loop {
+                    if !env.in_grouping(G_v, 97, 117) {
+                        break 'lab28;
+                    }
+                    break 'golab27;
+                }
+                if env.cursor >= env.limit {
+                    break 'lab26;
+                }
+                env.next_char();
+            }
+            context.i_p1 = env.cursor;
+            if !(context.i_p1 < 2){
+                break 'lab26;
+            }
+            'golab29: loop {
+                'lab30: loop {
+                    if !env.out_grouping(G_v, 97, 117) {
+                        break 'lab30;
+                    }
+                    break 'golab29;
+                }
+                if env.cursor >= env.limit {
+                    break 'lab26;
+                }
+                env.next_char();
+            }
+            context.i_p1 = env.cursor;
+            break 'lab26;
+        }
+        env.cursor = v_18;
+        let v_21 = env.cursor;
+        'lab31: loop {
+            'golab32: loop {
+                'lab33: loop {
+                    if !env.eq_s(&"r") {
+                        break 'lab33;
+                    }
+                    break 'golab32;
+                }
+                if env.cursor >= env.limit {
+                    break 'lab31;
+                }
+                env.next_char();
+            }
+            'lab34: loop {
+                let v_23 = env.cursor;
+                'lab35: loop {
+                    if !(env.cursor >= 2){
+                        break 'lab35;
+                    }
+                    break 'lab34;
+                }
+                env.cursor = v_23;
+                'golab36: loop {
+                    'lab37: loop {
+                        if !env.out_grouping(G_rg, 114, 114) {
+                            break 'lab37;
+                        }
+                        break 'golab36;
+                    }
+                    if env.cursor >= env.limit {
+                        break 'lab31;
+                    }
+                    env.next_char();
+                }
+                break 'lab34;
+            }
+            if !((context.i_p1 - env.cursor) > 1){
+                break 'lab31;
+            }
+            context.i_p1 = env.cursor;
+            break 'lab31;
+        }
+        env.cursor = v_21;
+        break 'lab22;
+    }
+    env.limit_backward = env.cursor;
+    env.cursor = env.limit;
+    let v_25 = env.limit - env.cursor;
+    'lab38: loop {
+        env.ket = env.cursor;
+        among_var = env.find_among_b(A_1, context);
+        if among_var == 0 {
+            break 'lab38;
+        }
+        env.bra = env.cursor;
+        if among_var == 1 {
+            if !env.slice_from("loga") {
+                return false;
+            }
+        } else if among_var == 2 {
+            if !env.slice_from("peh") {
+                return false;
+            }
+        } else if among_var == 3 {
+            if !env.slice_from("vojka") {
+                return false;
+            }
+        } else if among_var == 4 {
+            if !env.slice_from("bojka") {
+                return false;
+            }
+        } else if among_var == 5 {
+            if !env.slice_from("jak") {
+                return false;
+            }
+        } else if among_var == 6 {
+            if !env.slice_from("\u{010D}ajni") {
+                return false;
+            }
+        } else if among_var == 7 {
+            if !context.b_no_diacritics {
+                break 'lab38;
+            }
+            if !env.slice_from("cajni") {
+                return false;
+            }
+        } else if among_var == 8 {
+            if !env.slice_from("erni") {
+                return false;
+            }
+        } else if among_var == 9 {
+            if !env.slice_from("larni") {
+                return false;
+            }
+        } else if among_var == 10 {
+            if !env.slice_from("esni") {
+                return false;
+            }
+        } else if among_var == 11 {
+            if !env.slice_from("anjca") {
+                return false;
+            }
+        } else if among_var == 12 {
+            if !env.slice_from("ajca") {
+                return false;
+            }
+        } else if among_var == 13 {
+            if !env.slice_from("ljca") {
+                return false;
+            }
+        } else if among_var == 14 {
+            if !env.slice_from("ejca") {
+                return false;
+            }
+        } else if among_var == 15 {
+            if !env.slice_from("ojca") {
+                return false;
+            }
+        } else if among_var == 16 {
+            if !env.slice_from("ajka") {
+                return false;
+            }
+        } else if among_var == 17 {
+            if !env.slice_from("ojka") {
+                return false;
+            }
+        } else if among_var == 18 {
+            if !env.slice_from("\u{0161}ca") {
+                return false;
+            }
+        } else if among_var == 19 {
+            if !env.slice_from("ing") {
+                return false;
+            }
+        } else if among_var == 20 {
+            if !env.slice_from("tvenik") {
+                return false;
+            }
+        } else if among_var == 21 {
+            if !env.slice_from("tetika") {
+                return false;
+            }
+        } else if among_var == 22 {
+            if !env.slice_from("nstva") {
+                return false;
+            }
+        } else if among_var == 23 {
+            if !env.slice_from("nik") {
+                return false;
+            }
+        } else if among_var == 24 {
+            if !env.slice_from("tik") {
+                return false;
+            }
+        } else if among_var == 25 {
+            if !env.slice_from("zik") {
+                return false;
+            }
+        } else if among_var == 26 {
+            if !env.slice_from("snik") {
+                return false;
+            }
+        } else if among_var == 27 {
+            if !env.slice_from("kusi") {
+                return false;
+            }
+        } else if among_var == 28 {
+            if !env.slice_from("kusni") {
+                return false;
+            }
+        } else if among_var == 29 {
+            if !env.slice_from("kustva") {
+                return false;
+            }
+        } else if among_var == 30 {
+            if !env.slice_from("du\u{0161}ni") {
+                return false;
+            }
+        } else if among_var == 31 {
+            if !context.b_no_diacritics {
+                break 'lab38;
+            }
+            if !env.slice_from("dusni") {
+                return false;
+            }
+        } else if among_var == 32 {
+            if !env.slice_from("antni") {
+                return false;
+            }
+        } else if among_var == 33 {
+            if !env.slice_from("bilni") {
+                return false;
+            }
+        } else if among_var == 34 {
+            if !env.slice_from("tilni") {
+                return false;
+            }
+        } else if among_var == 35 {
+            if !env.slice_from("avilni") {
+                return false;
+            }
+        } else if among_var == 36 {
+            if !env.slice_from("silni") {
+                return false;
+            }
+        } else if among_var == 37 {
+            if !env.slice_from("gilni") {
+                return false;
+            }
+        } else if among_var == 38 {
+            if !env.slice_from("rilni") {
+                return false;
+            }
+        } else if among_var == 39 {
+            if !env.slice_from("nilni") {
+                return false;
+            }
+        } else if among_var == 40 {
+            if !env.slice_from("alni") {
+                return false;
+            }
+        } else if among_var == 41 {
+            if !env.slice_from("ozni") {
+                return false;
+            }
+        } else if among_var == 42 {
+            if !env.slice_from("ravi") {
+                return false;
+            }
+        } else if among_var == 43 {
+            if !env.slice_from("stavni") {
+                return false;
+            }
+        } else if among_var == 44 {
+            if !env.slice_from("pravni") {
+                return false;
+            }
+        } else if among_var == 45 {
+            if !env.slice_from("tivni") {
+                return false;
+            }
+        } else if among_var == 46 {
+            if !env.slice_from("sivni") {
+                return false;
+            }
+        } else if among_var == 47 {
+            if !env.slice_from("atni") {
+                return false;
+            }
+        } else if among_var == 48 {
+            if !env.slice_from("enta") {
+                return false;
+            }
+        } else if among_var == 49 {
+            if !env.slice_from("tetni") {
+                return false;
+            }
+        } else if among_var == 50 {
+            if !env.slice_from("pletni") {
+                return false;
+            }
+        } else if among_var == 51 {
+            if !env.slice_from("\u{0161}avi") {
+                return false;
+            }
+        } else if among_var == 52 {
+            if !context.b_no_diacritics {
+                break 'lab38;
+            }
+            if !env.slice_from("savi") {
+                return false;
+            }
+        } else if among_var == 53 {
+            if !env.slice_from("anta") {
+                return false;
+            }
+        } else if among_var == 54 {
+            if !env.slice_from("a\u{010D}ka") {
+                return false;
+            }
+        } else if among_var == 55 {
+            if !context.b_no_diacritics {
+                break 'lab38;
+            }
+            if !env.slice_from("acka") {
+                return false;
+            }
+        } else if among_var == 56 {
+            if !env.slice_from("u\u{0161}ka") {
+                return false;
+            }
+        } else if among_var == 57 {
+            if !context.b_no_diacritics {
+                break 'lab38;
+            }
+            if !env.slice_from("uska") {
+                return false;
+            }
+        } else if among_var == 58 {
+            if !env.slice_from("atka") {
+                return false;
+            }
+        } else if among_var == 59 {
+            if !env.slice_from("etka") {
+                return false;
+            }
+        } else if among_var == 60 {
+            if !env.slice_from("itka") {
+                return false;
+            }
+        } else if among_var == 61 {
+            if !env.slice_from("otka") {
+                return false;
+            }
+        } else if among_var == 62 {
+            if !env.slice_from("utka") {
+                return false;
+            }
+        } else if among_var == 63 {
+            if !env.slice_from("eskna") {
+                return false;
+            }
+        } else if among_var == 64 {
+            if !env.slice_from("ti\u{010D}ni") {
+                return false;
+            }
+        } else if among_var == 65 {
+            if !context.b_no_diacritics {
+                break 'lab38;
+            }
+            if !env.slice_from("ticni") {
+                return false;
+            }
+        } else if among_var == 66 {
+            if !env.slice_from("ojska") {
+                return false;
+            }
+        } else if among_var == 67 {
+            if !env.slice_from("esma") {
+                return false;
+            }
+        } else if among_var == 68 {
+            if !env.slice_from("metra") {
+                return false;
+            }
+        } else if among_var == 69 {
+            if !env.slice_from("centra") {
+                return false;
+            }
+        } else if among_var == 70 {
+            if !env.slice_from("istra") {
+                return false;
+            }
+        } else if among_var == 71 {
+            if !env.slice_from("osti") {
+                return false;
+            }
+        } else if among_var == 72 {
+            if !context.b_no_diacritics {
+                break 'lab38;
+            }
+            if !env.slice_from("osti") {
+                return false;
+            }
+        } else if among_var == 73 {
+            if !env.slice_from("dba") {
+                return false;
+            }
+        } else if among_var == 74 {
+            if !env.slice_from("\u{010D}ka") {
+                return false;
+            }
+        } else if among_var == 75 {
+            if !env.slice_from("mca") {
+                return false;
+            }
+        } else if among_var == 76 {
+            if !env.slice_from("nca") {
+                return false;
+            }
+        } else if among_var == 77 {
+            if !env.slice_from("voljni") {
+                return false;
+            }
+        } else if among_var == 78 {
+            if !env.slice_from("anki") {
+                return false;
+            }
+        } else if among_var == 79 {
+            if !env.slice_from("vca") {
+                return false;
+            }
+        } else if among_var == 80 {
+            if !env.slice_from("sca") {
+                return false;
+            }
+        } else if among_var == 81 {
+            if !env.slice_from("rca") {
+                return false;
+            }
+        } else if among_var == 82 {
+            if !env.slice_from("alca") {
+                return false;
+            }
+        } else if among_var == 83 {
+            if !env.slice_from("elca") {
+                return false;
+            }
+        } else if among_var == 84 {
+            if !env.slice_from("olca") {
+                return false;
+            }
+        } else if among_var == 85 {
+            if !env.slice_from("njca") {
+                return false;
+            }
+        } else if among_var == 86 {
+            if !env.slice_from("ekta") {
+                return false;
+            }
+        } else if among_var == 87 {
+            if !env.slice_from("izma") {
+                return false;
+            }
+        } else if among_var == 88 {
+            if !env.slice_from("jebi") {
+                return false;
+            }
+        } else if among_var == 89 {
+            if !env.slice_from("baci") {
+                return false;
+            }
+        } else if among_var == 90 {
+            if !env.slice_from("a\u{0161}ni") {
+                return false;
+            }
+        } else if among_var == 91 {
+            if !context.b_no_diacritics {
+                break 'lab38;
+            }
+            if !env.slice_from("asni") {
+                return false;
+            }
+        }
+        break 'lab38;
+    }
+    env.cursor = env.limit - v_25;
+    let v_26 = env.limit - env.cursor;
+    'lab39: loop {
+        'lab40: loop {
+            let v_27 = env.limit - env.cursor;
+            'lab41: loop {
+                env.ket = env.cursor;
+                among_var = env.find_among_b(A_2, context);
+                if among_var == 0 {
+                    break 'lab41;
+                }
+                env.bra = env.cursor;
+                if !(context.i_p1 <= env.cursor){
+                    break 'lab41;
+                }
+                if among_var == 1 {
+                    if !env.slice_from("sk") {
+                        return false;
+                    }
+                } else if among_var == 2 {
+                    if !env.slice_from("\u{0161}k") {
+                        return false;
+                    }
+                } else if among_var == 3 {
+                    if !env.slice_from("stv") {
+                        return false;
+                    }
+                } else if among_var == 4 {
+                    if !env.slice_from("\u{0161}tv") {
+                        return false;
+                    }
+                } else if among_var == 5 {
+                    if !env.slice_from("tanij") {
+                        return false;
+                    }
+                } else if among_var == 6 {
+                    if !env.slice_from("manij") {
+                        return false;
+                    }
+                } else if among_var == 7 {
+                    if !env.slice_from("panij") {
+                        return false;
+                    }
+                } else if among_var == 8 {
+                    if !env.slice_from("ranij") {
+                        return false;
+                    }
+                } else if among_var == 9 {
+                    if !env.slice_from("ganij") {
+                        return false;
+                    }
+                } else if among_var == 10 {
+                    if !env.slice_from("an") {
+                        return false;
+                    }
+                } else if among_var == 11 {
+                    if !env.slice_from("in") {
+                        return false;
+                    }
+                } else if among_var == 12 {
+                    if !env.slice_from("on") {
+                        return false;
+                    }
+                } else if among_var == 13 {
+                    if !env.slice_from("n") {
+                        return false;
+                    }
+                } else if among_var == 14 {
+                    if !env.slice_from("a\u{0107}") {
+                        return false;
+                    }
+                } else if among_var == 15 {
+                    if !env.slice_from("e\u{0107}") {
+                        return false;
+                    }
+                } else if among_var == 16 {
+                    if !env.slice_from("u\u{0107}") {
+                        return false;
+                    }
+                } else if among_var == 17 {
+                    if !env.slice_from("ugov") {
+                        return false;
+                    }
+                } else if among_var == 18 {
+                    if !env.slice_from("ug") {
+                        return false;
+                    }
+                } else if among_var == 19 {
+                    if !env.slice_from("log") {
+                        return false;
+                    }
+                } else if among_var == 20 {
+                    if !env.slice_from("g") {
+                        return false;
+                    }
+                } else if among_var == 21 {
+                    if !env.slice_from("rari") {
+                        return false;
+                    }
+                } else if among_var == 22 {
+                    if !env.slice_from("oti") {
+                        return false;
+                    }
+                } else if among_var == 23 {
+                    if !env.slice_from("si") {
+                        return false;
+                    }
+                } else if among_var == 24 {
+                    if !env.slice_from("li") {
+                        return false;
+                    }
+                } else if among_var == 25 {
+                    if !env.slice_from("uj") {
+                        return false;
+                    }
+                } else if among_var == 26 {
+                    if !env.slice_from("caj") {
+                        return false;
+                    }
+                } else if among_var == 27 {
+                    if !env.slice_from("\u{010D}aj") {
+                        return false;
+                    }
+                } else if among_var == 28 {
+                    if !env.slice_from("\u{0107}aj") {
+                        return false;
+                    }
+                } else if among_var == 29 {
+                    if !env.slice_from("\u{0111}aj") {
+                        return false;
+                    }
+                } else if among_var == 30 {
+                    if !env.slice_from("laj") {
+                        return false;
+                    }
+                } else if among_var == 31 {
+                    if !env.slice_from("raj") {
+                        return false;
+                    }
+                } else if among_var == 32 {
+                    if !env.slice_from("bij") {
+                        return false;
+                    }
+                } else if among_var == 33 {
+                    if !env.slice_from("cij") {
+                        return false;
+                    }
+                } else if among_var == 34 {
+                    if !env.slice_from("dij") {
+                        return false;
+                    }
+                } else if among_var == 35 {
+                    if !env.slice_from("lij") {
+                        return false;
+                    }
+                } else if among_var == 36 {
+                    if !env.slice_from("nij") {
+                        return false;
+                    }
+                } else if among_var == 37 {
+                    if !env.slice_from("mij") {
+                        return false;
+                    }
+                } else if among_var == 38 {
+                    if !env.slice_from("\u{017E}ij") {
+                        return false;
+                    }
+                } else if among_var == 39 {
+                    if !env.slice_from("gij") {
+                        return false;
+                    }
+                } else if among_var == 40 {
+                    if !env.slice_from("fij") {
+                        return false;
+                    }
+                } else if among_var == 41 {
+                    if !env.slice_from("pij") {
+                        return false;
+                    }
+                } else if among_var == 42 {
+                    if !env.slice_from("rij") {
+                        return false;
+                    }
+                } else if among_var == 43 {
+                    if !env.slice_from("sij") {
+                        return false;
+                    }
+                } else if among_var == 44 {
+                    if !env.slice_from("tij") {
+                        return false;
+                    }
+                } else if among_var == 45 {
+                    if !env.slice_from("zij") {
+                        return false;
+                    }
+                } else if among_var == 46 {
+                    if !env.slice_from("nal") {
+                        return false;
+                    }
+                } else if among_var == 47 {
+                    if !env.slice_from("ijal") {
+                        return false;
+                    }
+                } else if among_var == 48 {
+                    if !env.slice_from("ozil") {
+                        return false;
+                    }
+                } else if among_var == 49 {
+                    if !env.slice_from("olov") {
+                        return false;
+                    }
+                } else if among_var == 50 {
+                    if !env.slice_from("ol") {
+                        return false;
+                    }
+                } else if among_var == 51 {
+                    if !env.slice_from("lem") {
+                        return false;
+                    }
+                } else if among_var == 52 {
+                    if !env.slice_from("ram") {
+                        return false;
+                    }
+                } else if among_var == 53 {
+                    if !env.slice_from("ar") {
+                        return false;
+                    }
+                } else if among_var == 54 {
+                    if !env.slice_from("dr") {
+                        return false;
+                    }
+                } else if among_var == 55 {
+                    if !env.slice_from("er") {
+                        return false;
+                    }
+                } else if among_var == 56 {
+                    if !env.slice_from("or") {
+                        return false;
+                    }
+                } else if among_var == 57 {
+                    if !env.slice_from("es") {
+                        return false;
+                    }
+                } else if among_var == 58 {
+                    if !env.slice_from("is") {
+                        return false;
+                    }
+                } else if among_var == 59 {
+                    if !env.slice_from("ta\u{0161}") {
+                        return false;
+                    }
+                } else if among_var == 60 {
+                    if !env.slice_from("na\u{0161}") {
+                        return false;
+                    }
+                } else if among_var == 61 {
+                    if !env.slice_from("ja\u{0161}") {
+                        return false;
+                    }
+                } else if among_var == 62 {
+                    if !env.slice_from("ka\u{0161}") {
+                        return false;
+                    }
+                } else if among_var == 63 {
+                    if !env.slice_from("ba\u{0161}") {
+                        return false;
+                    }
+                } else if among_var == 64 {
+                    if !env.slice_from("ga\u{0161}") {
+                        return false;
+                    }
+                } else if among_var == 65 {
+                    if !env.slice_from("va\u{0161}") {
+                        return false;
+                    }
+                } else if among_var == 66 {
+                    if !env.slice_from("e\u{0161}") {
+                        return false;
+                    }
+                } else if among_var == 67 {
+                    if !env.slice_from("i\u{0161}") {
+                        return false;
+                    }
+                } else if among_var == 68 {
+                    if !env.slice_from("ikat") {
+                        return false;
+                    }
+                } else if among_var == 69 {
+                    if !env.slice_from("lat") {
+                        return false;
+                    }
+                } else if among_var == 70 {
+                    if !env.slice_from("et") {
+                        return false;
+                    }
+                } else if among_var == 71 {
+                    if !env.slice_from("est") {
+                        return false;
+                    }
+                } else if among_var == 72 {
+                    if !env.slice_from("ist") {
+                        return false;
+                    }
+                } else if among_var == 73 {
+                    if !env.slice_from("kst") {
+                        return false;
+                    }
+                } else if among_var == 74 {
+                    if !env.slice_from("ost") {
+                        return false;
+                    }
+                } else if among_var == 75 {
+                    if !env.slice_from("i\u{0161}t") {
+                        return false;
+                    }
+                } else if among_var == 76 {
+                    if !env.slice_from("ova") {
+                        return false;
+                    }
+                } else if among_var == 77 {
+                    if !env.slice_from("av") {
+                        return false;
+                    }
+                } else if among_var == 78 {
+                    if !env.slice_from("ev") {
+                        return false;
+                    }
+                } else if among_var == 79 {
+                    if !env.slice_from("iv") {
+                        return false;
+                    }
+                } else if among_var == 80 {
+                    if !env.slice_from("ov") {
+                        return false;
+                    }
+                } else if among_var == 81 {
+                    if !env.slice_from("mov") {
+                        return false;
+                    }
+                } else if among_var == 82 {
+                    if !env.slice_from("lov") {
+                        return false;
+                    }
+                } else if among_var == 83 {
+                    if !env.slice_from("el") {
+                        return false;
+                    }
+                } else if among_var == 84 {
+                    if !env.slice_from("anj") {
+                        return false;
+                    }
+                } else if among_var == 85 {
+                    if !env.slice_from("enj") {
+                        return false;
+                    }
+                } else if among_var == 86 {
+                    if !env.slice_from("\u{0161}nj") {
+                        return false;
+                    }
+                } else if among_var == 87 {
+                    if !env.slice_from("en") {
+                        return false;
+                    }
+                } else if among_var == 88 {
+                    if !env.slice_from("\u{0161}n") {
+                        return false;
+                    }
+                } else if among_var == 89 {
+                    if !env.slice_from("\u{010D}in") {
+                        return false;
+                    }
+                } else if among_var == 90 {
+                    if !env.slice_from("ro\u{0161}i") {
+                        return false;
+                    }
+                } else if among_var == 91 {
+                    if !env.slice_from("o\u{0161}") {
+                        return false;
+                    }
+                } else if among_var == 92 {
+                    if !env.slice_from("evit") {
+                        return false;
+                    }
+                } else if among_var == 93 {
+                    if !env.slice_from("ovit") {
+                        return false;
+                    }
+                } else if among_var == 94 {
+                    if !env.slice_from("ast") {
+                        return false;
+                    }
+                } else if among_var == 95 {
+                    if !env.slice_from("k") {
+                        return false;
+                    }
+                } else if among_var == 96 {
+                    if !env.slice_from("eva") {
+                        return false;
+                    }
+                } else if among_var == 97 {
+                    if !env.slice_from("ava") {
+                        return false;
+                    }
+                } else if among_var == 98 {
+                    if !env.slice_from("iva") {
+                        return false;
+                    }
+                } else if among_var == 99 {
+                    if !env.slice_from("uva") {
+                        return false;
+                    }
+                } else if among_var == 100 {
+                    if !env.slice_from("ir") {
+                        return false;
+                    }
+                } else if among_var == 101 {
+                    if !env.slice_from("a\u{010D}") {
+                        return false;
+                    }
+                } else if among_var == 102 {
+                    if !env.slice_from("a\u{010D}a") {
+                        return false;
+                    }
+                } else if among_var == 103 {
+                    if !env.slice_from("ni") {
+                        return false;
+                    }
+                } else if among_var == 104 {
+                    if !env.slice_from("a") {
+                        return false;
+                    }
+                } else if among_var == 105 {
+                    if !env.slice_from("ur") {
+                        return false;
+                    }
+                } else if among_var == 106 {
+                    if !env.slice_from("astaj") {
+                        return false;
+                    }
+                } else if among_var == 107 {
+                    if !env.slice_from("istaj") {
+                        return false;
+                    }
+                } else if among_var == 108 {
+                    if !env.slice_from("ostaj") {
+                        return false;
+                    }
+                } else if among_var == 109 {
+                    if !env.slice_from("aj") {
+                        return false;
+                    }
+                } else if among_var == 110 {
+                    if !env.slice_from("asta") {
+                        return false;
+                    }
+                } else if among_var == 111 {
+                    if !env.slice_from("ista") {
+                        return false;
+                    }
+                } else if among_var == 112 {
+                    if !env.slice_from("osta") {
+                        return false;
+                    }
+                } else if among_var == 113 {
+                    if !env.slice_from("ta") {
+                        return false;
+                    }
+                } else if among_var == 114 {
+                    if !env.slice_from("inj") {
+                        return false;
+                    }
+                } else if among_var == 115 {
+                    if !env.slice_from("as") {
+                        return false;
+                    }
+                } else if among_var == 116 {
+                    if !env.slice_from("i") {
+                        return false;
+                    }
+                } else if among_var == 117 {
+                    if !env.slice_from("lu\u{010D}") {
+                        return false;
+                    }
+                } else if among_var == 118 {
+                    if !env.slice_from("jeti") {
+                        return false;
+                    }
+                } else if among_var == 119 {
+                    if !env.slice_from("e") {
+                        return false;
+                    }
+                } else if among_var == 120 {
+                    if !env.slice_from("at") {
+                        return false;
+                    }
+                } else if among_var == 121 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("luc") {
+                        return false;
+                    }
+                } else if among_var == 122 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("snj") {
+                        return false;
+                    }
+                } else if among_var == 123 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("os") {
+                        return false;
+                    }
+                } else if among_var == 124 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("ac") {
+                        return false;
+                    }
+                } else if among_var == 125 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("ec") {
+                        return false;
+                    }
+                } else if among_var == 126 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("uc") {
+                        return false;
+                    }
+                } else if among_var == 127 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("rosi") {
+                        return false;
+                    }
+                } else if among_var == 128 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("aca") {
+                        return false;
+                    }
+                } else if among_var == 129 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("jas") {
+                        return false;
+                    }
+                } else if among_var == 130 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("tas") {
+                        return false;
+                    }
+                } else if among_var == 131 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("gas") {
+                        return false;
+                    }
+                } else if among_var == 132 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("nas") {
+                        return false;
+                    }
+                } else if among_var == 133 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("kas") {
+                        return false;
+                    }
+                } else if among_var == 134 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("vas") {
+                        return false;
+                    }
+                } else if among_var == 135 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("bas") {
+                        return false;
+                    }
+                } else if among_var == 136 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("as") {
+                        return false;
+                    }
+                } else if among_var == 137 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("cin") {
+                        return false;
+                    }
+                } else if among_var == 138 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("astaj") {
+                        return false;
+                    }
+                } else if among_var == 139 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("istaj") {
+                        return false;
+                    }
+                } else if among_var == 140 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("ostaj") {
+                        return false;
+                    }
+                } else if among_var == 141 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("asta") {
+                        return false;
+                    }
+                } else if among_var == 142 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("ista") {
+                        return false;
+                    }
+                } else if among_var == 143 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("osta") {
+                        return false;
+                    }
+                } else if among_var == 144 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("ava") {
+                        return false;
+                    }
+                } else if among_var == 145 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("eva") {
+                        return false;
+                    }
+                } else if among_var == 146 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("iva") {
+                        return false;
+                    }
+                } else if among_var == 147 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("uva") {
+                        return false;
+                    }
+                } else if among_var == 148 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("ova") {
+                        return false;
+                    }
+                } else if among_var == 149 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("jeti") {
+                        return false;
+                    }
+                } else if among_var == 150 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("inj") {
+                        return false;
+                    }
+                } else if among_var == 151 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("ist") {
+                        return false;
+                    }
+                } else if among_var == 152 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("es") {
+                        return false;
+                    }
+                } else if among_var == 153 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("et") {
+                        return false;
+                    }
+                } else if among_var == 154 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("is") {
+                        return false;
+                    }
+                } else if among_var == 155 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("ir") {
+                        return false;
+                    }
+                } else if among_var == 156 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("ur") {
+                        return false;
+                    }
+                } else if among_var == 157 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("uj") {
+                        return false;
+                    }
+                } else if among_var == 158 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("ni") {
+                        return false;
+                    }
+                } else if among_var == 159 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("sn") {
+                        return false;
+                    }
+                } else if among_var == 160 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("ta") {
+                        return false;
+                    }
+                } else if among_var == 161 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("a") {
+                        return false;
+                    }
+                } else if among_var == 162 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("i") {
+                        return false;
+                    }
+                } else if among_var == 163 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("e") {
+                        return false;
+                    }
+                } else if among_var == 164 {
+                    if !context.b_no_diacritics {
+                        break 'lab41;
+                    }
+                    if !env.slice_from("n") {
+                        return false;
+                    }
+                }
+                break 'lab40;
+            }
+            env.cursor = env.limit - v_27;
+            env.ket = env.cursor;
+            if env.find_among_b(A_3, context) == 0 {
+                break 'lab39;
+            }
+            env.bra = env.cursor;
+            if !(context.i_p1 <= env.cursor){
+                break 'lab39;
+            }
+            if !env.slice_from("") {
+                return false;
+            }
+            break 'lab40;
+        }
+        break 'lab39;
+    }
+    env.cursor = env.limit - v_26;
+    env.cursor = env.limit_backward;
+    return true;
+}
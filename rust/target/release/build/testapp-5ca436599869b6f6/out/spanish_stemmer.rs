@@ -0,0 +1,803 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+#![allow(non_snake_case)]
+#![allow(non_upper_case_globals)]
+#![allow(unused_mut)]
+#![allow(unused_parens)]
+#![allow(unused_variables)]
+use snowball::SnowballEnv;
+use snowball::Among;
+
+static A_0: &'static [Among<Context>; 6] = &[
+    Among("", -1, 6, None),
+    Among("\u{00E1}", 0, 1, None),
+    Among("\u{00E9}", 0, 2, None),
+    Among("\u{00ED}", 0, 3, None),
+    Among("\u{00F3}", 0, 4, None),
+    Among("\u{00FA}", 0, 5, None),
+];
+
+static A_1: &'static [Among<Context>; 13] = &[
+    Among("la", -1, -1, None),
+    Among("sela", 0, -1, None),
+    Among("le", -1, -1, None),
+    Among("me", -1, -1, None),
+    Among("se", -1, -1, None),
+    Among("lo", -1, -1, None),
+    Among("selo", 5, -1, None),
+    Among("las", -1, -1, None),
+    Among("selas", 7, -1, None),
+    Among("les", -1, -1, None),
+    Among("los", -1, -1, None),
+    Among("selos", 10, -1, None),
+    Among("nos", -1, -1, None),
+];
+
+static A_2: &'static [Among<Context>; 11] = &[
+    Among("ando", -1, 6, None),
+    Among("iendo", -1, 6, None),
+    Among("yendo", -1, 7, None),
+    Among("\u{00E1}ndo", -1, 2, None),
+    Among("i\u{00E9}ndo", -1, 1, None),
+    Among("ar", -1, 6, None),
+    Among("er", -1, 6, None),
+    Among("ir", -1, 6, None),
+    Among("\u{00E1}r", -1, 3, None),
+    Among("\u{00E9}r", -1, 4, None),
+    Among("\u{00ED}r", -1, 5, None),
+];
+
+static A_3: &'static [Among<Context>; 4] = &[
+    Among("ic", -1, -1, None),
+    Among("ad", -1, -1, None),
+    Among("os", -1, -1, None),
+    Among("iv", -1, 1, None),
+];
+
+static A_4: &'static [Among<Context>; 3] = &[
+    Among("able", -1, 1, None),
+    Among("ible", -1, 1, None),
+    Among("ante", -1, 1, None),
+];
+
+static A_5: &'static [Among<Context>; 3] = &[
+    Among("ic", -1, 1, None),
+    Among("abil", -1, 1, None),
+    Among("iv", -1, 1, None),
+];
+
+static A_6: &'static [Among<Context>; 46] = &[
+    Among("ica", -1, 1, None),
+    Among("ancia", -1, 2, None),
+    Among("encia", -1, 5, None),
+    Among("adora", -1, 2, None),
+    Among("osa", -1, 1, None),
+    Among("ista", -1, 1, None),
+    Among("iva", -1, 9, None),
+    Among("anza", -1, 1, None),
+    Among("log\u{00ED}a", -1, 3, None),
+    Among("idad", -1, 8, None),
+    Among("able", -1, 1, None),
+    Among("ible", -1, 1, None),
+    Among("ante", -1, 2, None),
+    Among("mente", -1, 7, None),
+    Among("amente", 13, 6, None),
+    Among("aci\u{00F3}n", -1, 2, None),
+    Among("uci\u{00F3}n", -1, 4, None),
+    Among("ico", -1, 1, None),
+    Among("ismo", -1, 1, None),
+    Among("oso", -1, 1, None),
+    Among("amiento", -1, 1, None),
+    Among("imiento", -1, 1, None),
+    Among("ivo", -1, 9, None),
+    Among("ador", -1, 2, None),
+    Among("icas", -1, 1, None),
+    Among("ancias", -1, 2, None),
+    Among("encias", -1, 5, None),
+    Among("adoras", -1, 2, None),
+    Among("osas", -1, 1, None),
+    Among("istas", -1, 1, None),
+    Among("ivas", -1, 9, None),
+    Among("anzas", -1, 1, None),
+    Among("log\u{00ED}as", -1, 3, None),
+    Among("idades", -1, 8, None),
+    Among("ables", -1, 1, None),
+    Among("ibles", -1, 1, None),
+    Among("aciones", -1, 2, None),
+    Among("uciones", -1, 4, None),
+    Among("adores", -1, 2, None),
+    Among("antes", -1, 2, None),
+    Among("icos", -1, 1, None),
+    Among("ismos", -1, 1, None),
+    Among("osos", -1, 1, None),
+    Among("amientos", -1, 1, None),
+    Among("imientos", -1, 1, None),
+    Among("ivos", -1, 9, None),
+];
+
+static A_7: &'static [Among<Context>; 12] = &[
+    Among("ya", -1, 1, None),
+    Among("ye", -1, 1, None),
+    Among("yan", -1, 1, None),
+    Among("yen", -1, 1, None),
+    Among("yeron", -1, 1, None),
+    Among("yendo", -1, 1, None),
+    Among("yo", -1, 1, None),
+    Among("yas", -1, 1, None),
+    Among("yes", -1, 1, None),
+    Among("yais", -1, 1, None),
+    Among("yamos", -1, 1, None),
+    Among("y\u{00F3}", -1, 1, None),
+];
+
+static A_8: &'static [Among<Context>; 96] = &[
+    Among("aba", -1, 2, None),
+    Among("ada", -1, 2, None),
+    Among("ida", -1, 2, None),
+    Among("ara", -1, 2, None),
+    Among("iera", -1, 2, None),
+    Among("\u{00ED}a", -1, 2, None),
+    Among("ar\u{00ED}a", 5, 2, None),
+    Among("er\u{00ED}a", 5, 2, None),
+    Among("ir\u{00ED}a", 5, 2, None),
+    Among("ad", -1, 2, None),
+    Among("ed", -1, 2, None),
+    Among("id", -1, 2, None),
+    Among("ase", -1, 2, None),
+    Among("iese", -1, 2, None),
+    Among("aste", -1, 2, None),
+    Among("iste", -1, 2, None),
+    Among("an", -1, 2, None),
+    Among("aban", 16, 2, None),
+    Among("aran", 16, 2, None),
+    Among("ieran", 16, 2, None),
+    Among("\u{00ED}an", 16, 2, None),
+    Among("ar\u{00ED}an", 20, 2, None),
+    Among("er\u{00ED}an", 20, 2, None),
+    Among("ir\u{00ED}an", 20, 2, None),
+    Among("en", -1, 1, None),
+    Among("asen", 24, 2, None),
+    Among("iesen", 24, 2, None),
+    Among("aron", -1, 2, None),
+    Among("ieron", -1, 2, None),
+    Among("ar\u{00E1}n", -1, 2, None),
+    Among("er\u{00E1}n", -1, 2, None),
+    Among("ir\u{00E1}n", -1, 2, None),
+    Among("ado", -1, 2, None),
+    Among("ido", -1, 2, None),
+    Among("ando", -1, 2, None),
+    Among("iendo", -1, 2, None),
+    Among("ar", -1, 2, None),
+    Among("er", -1, 2, None),
+    Among("ir", -1, 2, None),
+    Among("as", -1, 2, None),
+    Among("abas", 39, 2, None),
+    Among("adas", 39, 2, None),
+    Among("idas", 39, 2, None),
+    Among("aras", 39, 2, None),
+    Among("ieras", 39, 2, None),
+    Among("\u{00ED}as", 39, 2, None),
+    Among("ar\u{00ED}as", 45, 2, None),
+    Among("er\u{00ED}as", 45, 2, None),
+    Among("ir\u{00ED}as", 45, 2, None),
+    Among("es", -1, 1, None),
+    Among("ases", 49, 2, None),
+    Among("ieses", 49, 2, None),
+    Among("abais", -1, 2, None),
+    Among("arais", -1, 2, None),
+    Among("ierais", -1, 2, None),
+    Among("\u{00ED}ais", -1, 2, None),
+    Among("ar\u{00ED}ais", 55, 2, None),
+    Among("er\u{00ED}ais", 55, 2, None),
+    Among("ir\u{00ED}ais", 55, 2, None),
+    Among("aseis", -1, 2, None),
+    Among("ieseis", -1, 2, None),
+    Among("asteis", -1, 2, None),
+    Among("isteis", -1, 2, None),
+    Among("\u{00E1}is", -1, 2, None),
+    Among("\u{00E9}is", -1, 1, None),
+    Among("ar\u{00E9}is", 64, 2, None),
+    Among("er\u{00E9}is", 64, 2, None),
+    Among("ir\u{00E9}is", 64, 2, None),
+    Among("ados", -1, 2, None),
+    Among("idos", -1, 2, None),
+    Among("amos", -1, 2, None),
+    Among("\u{00E1}bamos", 70, 2, None),
+    Among("\u{00E1}ramos", 70, 2, None),
+    Among("i\u{00E9}ramos", 70, 2, None),
+    Among("\u{00ED}amos", 70, 2, None),
+    Among("ar\u{00ED}amos", 74, 2, None),
+    Among("er\u{00ED}amos", 74, 2, None),
+    Among("ir\u{00ED}amos", 74, 2, None),
+    Among("emos", -1, 1, None),
+    Among("aremos", 78, 2, None),
+    Among("eremos", 78, 2, None),
+    Among("iremos", 78, 2, None),
+    Among("\u{00E1}semos", 78, 2, None),
+    Among("i\u{00E9}semos", 78, 2, None),
+    Among("imos", -1, 2, None),
+    Among("ar\u{00E1}s", -1, 2, None),
+    Among("er\u{00E1}s", -1, 2, None),
+    Among("ir\u{00E1}s", -1, 2, None),
+    Among("\u{00ED}s", -1, 2, None),
+    Among("ar\u{00E1}", -1, 2, None),
+    Among("er\u{00E1}", -1, 2, None),
+    Among("ir\u{00E1}", -1, 2, None),
+    Among("ar\u{00E9}", -1, 2, None),
+    Among("er\u{00E9}", -1, 2, None),
+    Among("ir\u{00E9}", -1, 2, None),
+    Among("i\u{00F3}", -1, 2, None),
+];
+
+static A_9: &'static [Among<Context>; 8] = &[
+    Among("a", -1, 1, None),
+    Among("e", -1, 2, None),
+    Among("o", -1, 1, None),
+    Among("os", -1, 1, None),
+    Among("\u{00E1}", -1, 1, None),
+    Among("\u{00E9}", -1, 2, None),
+    Among("\u{00ED}", -1, 1, None),
+    Among("\u{00F3}", -1, 1, None),
+];
+
+static G_v: &'static [u8; 20] = &[17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 17, 4, 10];
+
+#[derive(Clone)]
+struct Context {
+    i_p2: i32,
+    i_p1: i32,
+    i_pV: i32,
+}
+
+pub fn stem(env: &mut SnowballEnv) -> bool {
+    let mut context = &mut Context {
+        i_p2: 0,
+        i_p1: 0,
+        i_pV: 0,
+    };
+    let mut among_var;
+    'lab0: loop {
+        context.i_pV = env.limit;
+        context.i_p1 = env.limit;
+        context.i_p2 = env.limit;
+        let v_2 = env.cursor;
+        'lab1: loop {
+            'lab2: loop {
+                let v_3 = env.cursor;
+                'lab3: loop {
+                    if !env.in_grouping(G_v, 97, 252) {
+                        break 'lab3;
+                    }
+                    'lab4: loop {
+                        let v_4 = env.cursor;
+                        'lab5: loop {
+                            if !env.out_grouping(G_v, 97, 252) {
+                                break 'lab5;
+                            }
+                            'golab6: loop {
+                                'lab7: loop {
+                                    if !env.in_grouping(G_v, 97, 252) {
+                                        break 'lab7;
+                                    }
+                                    break 'golab6;
+                                }
+                                if env.cursor >= env.limit {
+                                    break 'lab5;
+                                }
+                                env.next_char();
+                            }
+                            break 'lab4;
+                        }
+                        env.cursor = v_4;
+                        if !env.in_grouping(G_v, 97, 252) {
+                            break 'lab3;
+                        }
+                        'golab8: loop {
+                            'lab9: loop {
+                                if !env.out_grouping(G_v, 97, 252) {
+                                    break 'lab9;
+                                }
+                                break 'golab8;
+                            }
+                            if env.cursor >= env.limit {
+                                break 'lab3;
+                            }
+                            env.next_char();
+                        }
+                        break 'lab4;
+                    }
+                    break 'lab2;
+                }
+                env.cursor = v_3;
+                if !env.out_grouping(G_v, 97, 252) {
+                    break 'lab1;
+                }
+                'lab10: loop {
+                    let v_7 = env.cursor;
+                    'lab11: loop {
+                        if !env.out_grouping(G_v, 97, 252) {
+                            break 'lab11;
+                        }
+                        'golab12: loop {
+                            'lab13: loop {
+                                if !env.in_grouping(G_v, 97, 252) {
+                                    break 'lab13;
+                                }
+                                break 'golab12;
+                            }
+                            if env.cursor >= env.limit {
+                                break 'lab11;
+                            }
+                            env.next_char();
+                        }
+                        break 'lab10;
+                    }
+                    env.cursor = v_7;
+                    if !env.in_grouping(G_v, 97, 252) {
+                        break 'lab1;
+                    }
+                    if env.cursor >= env.limit {
+                        break 'lab1;
+                    }
+                    env.next_char();
+                    break 'lab10;
+                }
+                break 'lab2;
+            }
+            context.i_pV = env.cursor;
+            break 'lab1;
+        }
+        env.cursor = v_2;
+        let v_9 = env.cursor;
+        'lab14: loop {
+            'golab15: loop {
+                'lab16: loop {
+                    if !env.in_grouping(G_v, 97, 252) {
+                        break 'lab16;
+                    }
+                    break 'golab15;
+                }
+                if env.cursor >= env.limit {
+                    break 'lab14;
+                }
+                env.next_char();
+            }
+            'golab17: loop {
+                'lab18: loop {
+                    if !env.out_grouping(G_v, 97, 252) {
+                        break 'lab18;
+                    }
+                    break 'golab17;
+                }
+                if env.cursor >= env.limit {
+                    break 'lab14;
+                }
+                env.next_char();
+            }
+            context.i_p1 = env.cursor;
+            'golab19: loop {
+                'lab20: loop {
+                    if !env.in_grouping(G_v, 97, 252) {
+                        break 'lab20;
+                    }
+                    break 'golab19;
+                }
+                if env.cursor >= env.limit {
+                    break 'lab14;
+                }
+                env.next_char();
+            }
+            'golab21: loop {
+                'lab22: loop {
+                    if !env.out_grouping(G_v, 97, 252) {
+                        break 'lab22;
+                    }
+                    break 'golab21;
+                }
+                if env.cursor >= env.limit {
+                    break 'lab14;
+                }
+                env.next_char();
+            }
+            context.i_p2 = env.cursor;
+            break 'lab14;
+        }
+        env.cursor = v_9;
+        break 'lab0;
+    }
+    env.limit_backward = env.cursor;
+    env.cursor = env.limit;
+    let v_14 = env.limit - env.cursor;
+    'lab23: loop {
+        env.ket = env.cursor;
+        if env.find_among_b(A_1, context) == 0 {
+            break 'lab23;
+        }
+        env.bra = env.cursor;
+        among_var = env.find_among_b(A_2, context);
+        if among_var == 0 {
+            break 'lab23;
+        }
+        if !(context.i_pV <= env.cursor){
+            break 'lab23;
+        }
+        if among_var == 1 {
+            env.bra = env.cursor;
+            if !env.slice_from("iendo") {
+                return false;
+            }
+        } else if among_var == 2 {
+            env.bra = env.cursor;
+            if !env.slice_from("ando") {
+                return false;
+            }
+        } else if among_var == 3 {
+            env.bra = env.cursor;
+            if !env.slice_from("ar") {
+                return false;
+            }
+        } else if among_var == 4 {
+            env.bra = env.cursor;
+            if !env.slice_from("er") {
+                return false;
+            }
+        } else if among_var == 5 {
+            env.bra = env.cursor;
+            if !env.slice_from("ir") {
+                return false;
+            }
+        } else if among_var == 6 {
+            if !env.slice_del() {
+                return false;
+            }
+        } else if among_var == 7 {
+            if !env.eq_s_b(&"u") {
+                break 'lab23;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+        }
+        break 'lab23;
+    }
+    env.cursor = env.limit - v_14;
+    let v_15 = env.limit - env.cursor;
+    'lab24: loop {
+        'lab25: loop {
+            let v_16 = env.limit - env.cursor;
+            'lab26: loop {
+                env.ket = env.cursor;
+                among_var = env.find_among_b(A_6, context);
+                if among_var == 0 {
+                    break 'lab26;
+                }
+                env.bra = env.cursor;
+                if among_var == 1 {
+                    if !(context.i_p2 <= env.cursor){
+                        break 'lab26;
+                    }
+                    if !env.slice_del() {
+                        return false;
+                    }
+                } else if among_var == 2 {
+                    if !(context.i_p2 <= env.cursor){
+                        break 'lab26;
+                    }
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    let v_17 = env.limit - env.cursor;
+                    'lab27: loop {
+                        env.ket = env.cursor;
+                        if !env.eq_s_b(&"ic") {
+                            env.cursor = env.limit - v_17;
+                            break 'lab27;
+                        }
+                        env.bra = env.cursor;
+                        if !(context.i_p2 <= env.cursor){
+                            env.cursor = env.limit - v_17;
+                            break 'lab27;
+                        }
+                        if !env.slice_del() {
+                            return false;
+                        }
+                        break 'lab27;
+                    }
+                } else if among_var == 3 {
+                    if !(context.i_p2 <= env.cursor){
+                        break 'lab26;
+                    }
+                    if !env.slice_from("log") {
+                        return false;
+                    }
+                } else if among_var == 4 {
+                    if !(context.i_p2 <= env.cursor){
+                        break 'lab26;
+                    }
+                    if !env.slice_from("u") {
+                        return false;
+                    }
+                } else if among_var == 5 {
+                    if !(context.i_p2 <= env.cursor){
+                        break 'lab26;
+                    }
+                    if !env.slice_from("ente") {
+                        return false;
+                    }
+                } else if among_var == 6 {
+                    if !(context.i_p1 <= env.cursor){
+                        break 'lab26;
+                    }
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    let v_18 = env.limit - env.cursor;
+                    'lab28: loop {
+                        env.ket = env.cursor;
+                        among_var = env.find_among_b(A_3, context);
+                        if among_var == 0 {
+                            env.cursor = env.limit - v_18;
+                            break 'lab28;
+                        }
+                        env.bra = env.cursor;
+                        if !(context.i_p2 <= env.cursor){
+                            env.cursor = env.limit - v_18;
+                            break 'lab28;
+                        }
+                        if !env.slice_del() {
+                            return false;
+                        }
+                        if among_var == 1 {
+                            env.ket = env.cursor;
+                            if !env.eq_s_b(&"at") {
+                                env.cursor = env.limit - v_18;
+                                break 'lab28;
+                            }
+                            env.bra = env.cursor;
+                            if !(context.i_p2 <= env.cursor){
+                                env.cursor = env.limit - v_18;
+                                break 'lab28;
+                            }
+                            if !env.slice_del() {
+                                return false;
+                            }
+                        }
+                        break 'lab28;
+                    }
+                } else if among_var == 7 {
+                    if !(context.i_p2 <= env.cursor){
+                        break 'lab26;
+                    }
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    let v_19 = env.limit - env.cursor;
+                    'lab29: loop {
+                        env.ket = env.cursor;
+                        if env.find_among_b(A_4, context) == 0 {
+                            env.cursor = env.limit - v_19;
+                            break 'lab29;
+                        }
+                        env.bra = env.cursor;
+                        if !(context.i_p2 <= env.cursor){
+                            env.cursor = env.limit - v_19;
+                            break 'lab29;
+                        }
+                        if !env.slice_del() {
+                            return false;
+                        }
+                        break 'lab29;
+                    }
+                } else if among_var == 8 {
+                    if !(context.i_p2 <= env.cursor){
+                        break 'lab26;
+                    }
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    let v_20 = env.limit - env.cursor;
+                    'lab30: loop {
+                        env.ket = env.cursor;
+                        if env.find_among_b(A_5, context) == 0 {
+                            env.cursor = env.limit - v_20;
+                            break 'lab30;
+                        }
+                        env.bra = env.cursor;
+                        if !(context.i_p2 <= env.cursor){
+                            env.cursor = env.limit - v_20;
+                            break 'lab30;
+                        }
+                        if !env.slice_del() {
+                            return false;
+                        }
+                        break 'lab30;
+                    }
+                } else if among_var == 9 {
+                    if !(context.i_p2 <= env.cursor){
+                        break 'lab26;
+                    }
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    let v_21 = env.limit - env.cursor;
+                    'lab31: loop {
+                        env.ket = env.cursor;
+                        if !env.eq_s_b(&"at") {
+                            env.cursor = env.limit - v_21;
+                            break 'lab31;
+                        }
+                        env.bra = env.cursor;
+                        if !(context.i_p2 <= env.cursor){
+                            env.cursor = env.limit - v_21;
+                            break 'lab31;
+                        }
+                        if !env.slice_del() {
+                            return false;
+                        }
+                        break 'lab31;
+                    }
+                }
+                break 'lab25;
+            }
+            env.cursor = env.limit - v_16;
+            'lab32: loop {
+                if env.cursor < context.i_pV {
+                    break 'lab32;
+                }
+                let v_23 = env.limit_backward;
+                env.limit_backward = context.i_pV;
+                env.ket = env.cursor;
+                if env.find_among_b(A_7, context) == 0 {
+                    env.limit_backward = v_23;
+                    break 'lab32;
+                }
+                env.bra = env.cursor;
+                env.limit_backward = v_23;
+                if !env.eq_s_b(&"u") {
+                    break 'lab32;
+                }
+                if !env.slice_del() {
+                    return false;
+                }
+                break 'lab25;
+            }
+            env.cursor = env.limit - v_16;
+            if env.cursor < context.i_pV {
+                break 'lab24;
+            }
+            let v_25 = env.limit_backward;
+            env.limit_backward = context.i_pV;
+            env.ket = env.cursor;
+            among_var = env.find_among_b(A_8, context);
+            if among_var == 0 {
+                env.limit_backward = v_25;
+                break 'lab24;
+            }
+            env.bra = env.cursor;
+            env.limit_backward = v_25;
+            if among_var == 1 {
+                let v_26 = env.limit - env.cursor;
+                'lab33: loop {
+                    if !env.eq_s_b(&"u") {
+                        env.cursor = env.limit - v_26;
+                        break 'lab33;
+                    }
+                    let v_27 = env.limit - env.cursor;
+                    if !env.eq_s_b(&"g") {
+                        env.cursor = env.limit - v_26;
+                        break 'lab33;
+                    }
+                    env.cursor = env.limit - v_27;
+                    break 'lab33;
+                }
+                env.bra = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+            } else if among_var == 2 {
+                if !env.slice_del() {
+                    return false;
+                }
+            }
+            break 'lab25;
+        }
+        break 'lab24;
+    }
+    env.cursor = env.limit - v_15;
+    let v_28 = env.limit - env.cursor;
+    'lab34: loop {
+        env.ket = env.cursor;
+        among_var = env.find_among_b(A_9, context);
+        if among_var == 0 {
+            break 'lab34;
+        }
+        env.bra = env.cursor;
+        if among_var == 1 {
+            if !(context.i_pV <= env.cursor){
+                break 'lab34;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+        } else if among_var == 2 {
+            if !(context.i_pV <= env.cursor){
+                break 'lab34;
+            }
+            if !env.slice_del() {
+                return false;
+            }
+            let v_29 = env.limit - env.cursor;
+            'lab35: loop {
+                env.ket = env.cursor;
+                if !env.eq_s_b(&"u") {
+                    env.cursor = env.limit - v_29;
+                    break 'lab35;
+                }
+                env.bra = env.cursor;
+                let v_30 = env.limit - env.cursor;
+                if !env.eq_s_b(&"g") {
+                    env.cursor = env.limit - v_29;
+                    break 'lab35;
+                }
+                env.cursor = env.limit - v_30;
+                if !(context.i_pV <= env.cursor){
+                    env.cursor = env.limit - v_29;
+                    break 'lab35;
+                }
+                if !env.slice_del() {
+                    return false;
+                }
+                break 'lab35;
+            }
+        }
+        break 'lab34;
+    }
+    env.cursor = env.limit - v_28;
+    env.cursor = env.limit_backward;
+    let v_31 = env.cursor;
+    'lab36: loop {
+        'replab37: loop{
+            let v_32 = env.cursor;
+            'lab38: for _ in 0..1 {
+                env.bra = env.cursor;
+                among_var = env.find_among(A_0, context);
+                if among_var == 0 {
+                    break 'lab38;
+                }
+                env.ket = env.cursor;
+                if among_var == 1 {
+                    if !env.slice_from("a") {
+                        return false;
+                    }
+                } else if among_var == 2 {
+                    if !env.slice_from("e") {
+                        return false;
+                    }
+                } else if among_var == 3 {
+                    if !env.slice_from("i") {
+                        return false;
+                    }
+                } else if among_var == 4 {
+                    if !env.slice_from("o") {
+                        return false;
+                    }
+                } else if among_var == 5 {
+                    if !env.slice_from("u") {
+                        return false;
+                    }
+                } else if among_var == 6 {
+                    if env.cursor >= env.limit {
+                        break 'lab38;
+                    }
+                    env.next_char();
+                }
+                continue 'replab37;
+            }
+            env.cursor = v_32;
+            break 'replab37;
+        }
+        break 'lab36;
+    }
+    env.cursor = v_31;
+    return true;
+}
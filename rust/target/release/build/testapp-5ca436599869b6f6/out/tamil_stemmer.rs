@@ -0,0 +1,1831 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+#![allow(non_snake_case)]
+#![allow(non_upper_case_globals)]
+#![allow(unused_mut)]
+#![allow(unused_parens)]
+#![allow(unused_variables)]
+use snowball::SnowballEnv;
+use snowball::Among;
+
+static A_0: &'static [Among<Context>; 10] = &[
+    Among("\u{0B95}", -1, -1, None),
+    Among("\u{0B99}", -1, -1, None),
+    Among("\u{0B9A}", -1, -1, None),
+    Among("\u{0B9E}", -1, -1, None),
+    Among("\u{0BA4}", -1, -1, None),
+    Among("\u{0BA8}", -1, -1, None),
+    Among("\u{0BAA}", -1, -1, None),
+    Among("\u{0BAE}", -1, -1, None),
+    Among("\u{0BAF}", -1, -1, None),
+    Among("\u{0BB5}", -1, -1, None),
+];
+
+static A_1: &'static [Among<Context>; 3] = &[
+    Among("\u{0BA8}\u{0BCD}\u{0BA4}\u{0BCD}", -1, -1, None),
+    Among("\u{0BA8}\u{0BCD}", -1, -1, None),
+    Among("\u{0BA8}\u{0BCD}\u{0BA4}", -1, -1, None),
+];
+
+static A_2: &'static [Among<Context>; 3] = &[
+    Among("\u{0BC0}", -1, -1, None),
+    Among("\u{0BC8}", -1, -1, None),
+    Among("\u{0BBF}", -1, -1, None),
+];
+
+static A_3: &'static [Among<Context>; 6] = &[
+    Among("\u{0B95}", -1, -1, None),
+    Among("\u{0B9A}", -1, -1, None),
+    Among("\u{0B9F}", -1, -1, None),
+    Among("\u{0BA4}", -1, -1, None),
+    Among("\u{0BAA}", -1, -1, None),
+    Among("\u{0BB1}", -1, -1, None),
+];
+
+static A_4: &'static [Among<Context>; 6] = &[
+    Among("\u{0B95}", -1, -1, None),
+    Among("\u{0B9A}", -1, -1, None),
+    Among("\u{0B9F}", -1, -1, None),
+    Among("\u{0BA4}", -1, -1, None),
+    Among("\u{0BAA}", -1, -1, None),
+    Among("\u{0BB1}", -1, -1, None),
+];
+
+static A_5: &'static [Among<Context>; 6] = &[
+    Among("\u{0B95}", -1, -1, None),
+    Among("\u{0B9A}", -1, -1, None),
+    Among("\u{0B9F}", -1, -1, None),
+    Among("\u{0BA4}", -1, -1, None),
+    Among("\u{0BAA}", -1, -1, None),
+    Among("\u{0BB1}", -1, -1, None),
+];
+
+static A_6: &'static [Among<Context>; 6] = &[
+    Among("\u{0BAF}", -1, -1, None),
+    Among("\u{0BB0}", -1, -1, None),
+    Among("\u{0BB2}", -1, -1, None),
+    Among("\u{0BB3}", -1, -1, None),
+    Among("\u{0BB4}", -1, -1, None),
+    Among("\u{0BB5}", -1, -1, None),
+];
+
+static A_7: &'static [Among<Context>; 6] = &[
+    Among("\u{0B99}", -1, -1, None),
+    Among("\u{0B9E}", -1, -1, None),
+    Among("\u{0BA3}", -1, -1, None),
+    Among("\u{0BA8}", -1, -1, None),
+    Among("\u{0BA9}", -1, -1, None),
+    Among("\u{0BAE}", -1, -1, None),
+];
+
+static A_8: &'static [Among<Context>; 3] = &[
+    Among("\u{0BB5}\u{0BCD}", -1, -1, None),
+    Among("\u{0BAF}", -1, -1, None),
+    Among("\u{0BB5}", -1, -1, None),
+];
+
+static A_9: &'static [Among<Context>; 8] = &[
+    Among("\u{0BC0}", -1, -1, None),
+    Among("\u{0BC1}", -1, -1, None),
+    Among("\u{0BC2}", -1, -1, None),
+    Among("\u{0BC6}", -1, -1, None),
+    Among("\u{0BC7}", -1, -1, None),
+    Among("\u{0BC8}", -1, -1, None),
+    Among("\u{0BBE}", -1, -1, None),
+    Among("\u{0BBF}", -1, -1, None),
+];
+
+static A_10: &'static [Among<Context>; 8] = &[
+    Among("\u{0BC0}", -1, -1, None),
+    Among("\u{0BC1}", -1, -1, None),
+    Among("\u{0BC2}", -1, -1, None),
+    Among("\u{0BC6}", -1, -1, None),
+    Among("\u{0BC7}", -1, -1, None),
+    Among("\u{0BC8}", -1, -1, None),
+    Among("\u{0BBE}", -1, -1, None),
+    Among("\u{0BBF}", -1, -1, None),
+];
+
+static A_11: &'static [Among<Context>; 3] = &[
+    Among("\u{0B85}", -1, -1, None),
+    Among("\u{0B87}", -1, -1, None),
+    Among("\u{0B89}", -1, -1, None),
+];
+
+static A_12: &'static [Among<Context>; 10] = &[
+    Among("\u{0B95}", -1, -1, None),
+    Among("\u{0B99}", -1, -1, None),
+    Among("\u{0B9A}", -1, -1, None),
+    Among("\u{0B9E}", -1, -1, None),
+    Among("\u{0BA4}", -1, -1, None),
+    Among("\u{0BA8}", -1, -1, None),
+    Among("\u{0BAA}", -1, -1, None),
+    Among("\u{0BAE}", -1, -1, None),
+    Among("\u{0BAF}", -1, -1, None),
+    Among("\u{0BB5}", -1, -1, None),
+];
+
+static A_13: &'static [Among<Context>; 6] = &[
+    Among("\u{0B95}", -1, -1, None),
+    Among("\u{0B9A}", -1, -1, None),
+    Among("\u{0B9F}", -1, -1, None),
+    Among("\u{0BA4}", -1, -1, None),
+    Among("\u{0BAA}", -1, -1, None),
+    Among("\u{0BB1}", -1, -1, None),
+];
+
+static A_14: &'static [Among<Context>; 3] = &[
+    Among("\u{0BC7}", -1, -1, None),
+    Among("\u{0BCB}", -1, -1, None),
+    Among("\u{0BBE}", -1, -1, None),
+];
+
+static A_15: &'static [Among<Context>; 2] = &[
+    Among("\u{0BAA}\u{0BBF}", -1, -1, None),
+    Among("\u{0BB5}\u{0BBF}", -1, -1, None),
+];
+
+static A_16: &'static [Among<Context>; 8] = &[
+    Among("\u{0BC0}", -1, -1, None),
+    Among("\u{0BC1}", -1, -1, None),
+    Among("\u{0BC2}", -1, -1, None),
+    Among("\u{0BC6}", -1, -1, None),
+    Among("\u{0BC7}", -1, -1, None),
+    Among("\u{0BC8}", -1, -1, None),
+    Among("\u{0BBE}", -1, -1, None),
+    Among("\u{0BBF}", -1, -1, None),
+];
+
+static A_17: &'static [Among<Context>; 13] = &[
+    Among("\u{0BAA}\u{0B9F}\u{0BCD}\u{0B9F}\u{0BC1}", -1, -1, None),
+    Among("\u{0BB5}\u{0BBF}\u{0B9F}\u{0BCD}\u{0B9F}\u{0BC1}", -1, -1, None),
+    Among("\u{0BAA}\u{0B9F}\u{0BC1}", -1, -1, None),
+    Among("\u{0BB5}\u{0BBF}\u{0B9F}\u{0BC1}", -1, -1, None),
+    Among("\u{0BAA}\u{0B9F}\u{0BCD}\u{0B9F}\u{0BA4}\u{0BC1}", -1, -1, None),
+    Among("\u{0BC6}\u{0BB2}\u{0BCD}\u{0BB2}\u{0BBE}\u{0BAE}\u{0BCD}", -1, -1, None),
+    Among("\u{0BAA}\u{0B9F}\u{0BCD}\u{0B9F}", -1, -1, None),
+    Among("\u{0BAA}\u{0B9F}\u{0BCD}\u{0B9F}\u{0BA3}", -1, -1, None),
+    Among("\u{0BA4}\u{0BBE}\u{0BA9}", -1, -1, None),
+    Among("\u{0BAA}\u{0B9F}\u{0BBF}\u{0BA4}\u{0BBE}\u{0BA9}", 8, -1, None),
+    Among("\u{0B95}\u{0BC1}\u{0BB0}\u{0BBF}\u{0BAF}", -1, -1, None),
+    Among("\u{0BAA}\u{0B9F}\u{0BBF}", -1, -1, None),
+    Among("\u{0BAA}\u{0BB1}\u{0BCD}\u{0BB1}\u{0BBF}", -1, -1, None),
+];
+
+static A_18: &'static [Among<Context>; 6] = &[
+    Among("\u{0B95}", -1, -1, None),
+    Among("\u{0B9A}", -1, -1, None),
+    Among("\u{0B9F}", -1, -1, None),
+    Among("\u{0BA4}", -1, -1, None),
+    Among("\u{0BAA}", -1, -1, None),
+    Among("\u{0BB1}", -1, -1, None),
+];
+
+static A_19: &'static [Among<Context>; 6] = &[
+    Among("\u{0B95}", -1, -1, None),
+    Among("\u{0B9A}", -1, -1, None),
+    Among("\u{0B9F}", -1, -1, None),
+    Among("\u{0BA4}", -1, -1, None),
+    Among("\u{0BAA}", -1, -1, None),
+    Among("\u{0BB1}", -1, -1, None),
+];
+
+static A_20: &'static [Among<Context>; 8] = &[
+    Among("\u{0BC0}", -1, -1, None),
+    Among("\u{0BC1}", -1, -1, None),
+    Among("\u{0BC2}", -1, -1, None),
+    Among("\u{0BC6}", -1, -1, None),
+    Among("\u{0BC7}", -1, -1, None),
+    Among("\u{0BC8}", -1, -1, None),
+    Among("\u{0BBE}", -1, -1, None),
+    Among("\u{0BBF}", -1, -1, None),
+];
+
+static A_21: &'static [Among<Context>; 8] = &[
+    Among("\u{0BC0}", -1, -1, None),
+    Among("\u{0BC1}", -1, -1, None),
+    Among("\u{0BC2}", -1, -1, None),
+    Among("\u{0BC6}", -1, -1, None),
+    Among("\u{0BC7}", -1, -1, None),
+    Among("\u{0BC8}", -1, -1, None),
+    Among("\u{0BBE}", -1, -1, None),
+    Among("\u{0BBF}", -1, -1, None),
+];
+
+static A_22: &'static [Among<Context>; 2] = &[
+    Among("\u{0BAA}\u{0B9F}\u{0BC1}", -1, -1, None),
+    Among("\u{0B95}\u{0BCA}\u{0BA3}\u{0BCD}\u{0B9F}\u{0BBF}\u{0BB0}\u{0BCD}", -1, -1, None),
+];
+
+static A_23: &'static [Among<Context>; 12] = &[
+    Among("\u{0B85}", -1, -1, None),
+    Among("\u{0B86}", -1, -1, None),
+    Among("\u{0B87}", -1, -1, None),
+    Among("\u{0B88}", -1, -1, None),
+    Among("\u{0B89}", -1, -1, None),
+    Among("\u{0B8A}", -1, -1, None),
+    Among("\u{0B8E}", -1, -1, None),
+    Among("\u{0B8F}", -1, -1, None),
+    Among("\u{0B90}", -1, -1, None),
+    Among("\u{0B92}", -1, -1, None),
+    Among("\u{0B93}", -1, -1, None),
+    Among("\u{0B94}", -1, -1, None),
+];
+
+static A_24: &'static [Among<Context>; 8] = &[
+    Among("\u{0BC0}", -1, -1, None),
+    Among("\u{0BC1}", -1, -1, None),
+    Among("\u{0BC2}", -1, -1, None),
+    Among("\u{0BC6}", -1, -1, None),
+    Among("\u{0BC7}", -1, -1, None),
+    Among("\u{0BC8}", -1, -1, None),
+    Among("\u{0BBE}", -1, -1, None),
+    Among("\u{0BBF}", -1, -1, None),
+];
+
+static A_25: &'static [Among<Context>; 6] = &[
+    Among("\u{0B95}\u{0BBF}\u{0BA9}\u{0BCD}\u{0BB1}\u{0BCD}", -1, -1, None),
+    Among("\u{0BBE}\u{0BA8}\u{0BBF}\u{0BA9}\u{0BCD}\u{0BB1}\u{0BCD}", -1, -1, None),
+    Among("\u{0B95}\u{0BBF}\u{0BB1}\u{0BCD}", -1, -1, None),
+    Among("\u{0B95}\u{0BBF}\u{0BA9}\u{0BCD}\u{0BB1}", -1, -1, None),
+    Among("\u{0BBE}\u{0BA8}\u{0BBF}\u{0BA9}\u{0BCD}\u{0BB1}", -1, -1, None),
+    Among("\u{0B95}\u{0BBF}\u{0BB1}", -1, -1, None),
+];
+
+#[derive(Clone)]
+struct Context {
+    b_found_vetrumai_urupu: bool,
+    b_found_a_match: bool,
+}
+
+fn r_fix_va_start(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    'lab0: loop {
+        let v_1 = env.cursor;
+        'lab1: loop {
+            let v_2 = env.cursor;
+            let v_3 = env.cursor;
+            'lab2: loop {
+                if !env.eq_s(&"\u{0BB5}\u{0BCB}") {
+                    env.cursor = v_3;
+                    break 'lab2;
+                }
+                break 'lab2;
+            }
+            env.cursor = v_2;
+            env.bra = env.cursor;
+            if !env.eq_s(&"\u{0BB5}\u{0BCB}") {
+                break 'lab1;
+            }
+            env.ket = env.cursor;
+            if !env.slice_from("\u{0B93}") {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = v_1;
+        'lab3: loop {
+            let v_4 = env.cursor;
+            let v_5 = env.cursor;
+            'lab4: loop {
+                if !env.eq_s(&"\u{0BB5}\u{0BCA}") {
+                    env.cursor = v_5;
+                    break 'lab4;
+                }
+                break 'lab4;
+            }
+            env.cursor = v_4;
+            env.bra = env.cursor;
+            if !env.eq_s(&"\u{0BB5}\u{0BCA}") {
+                break 'lab3;
+            }
+            env.ket = env.cursor;
+            if !env.slice_from("\u{0B92}") {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = v_1;
+        'lab5: loop {
+            let v_6 = env.cursor;
+            let v_7 = env.cursor;
+            'lab6: loop {
+                if !env.eq_s(&"\u{0BB5}\u{0BC1}") {
+                    env.cursor = v_7;
+                    break 'lab6;
+                }
+                break 'lab6;
+            }
+            env.cursor = v_6;
+            env.bra = env.cursor;
+            if !env.eq_s(&"\u{0BB5}\u{0BC1}") {
+                break 'lab5;
+            }
+            env.ket = env.cursor;
+            if !env.slice_from("\u{0B89}") {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = v_1;
+        let v_8 = env.cursor;
+        let v_9 = env.cursor;
+        'lab7: loop {
+            if !env.eq_s(&"\u{0BB5}\u{0BC2}") {
+                env.cursor = v_9;
+                break 'lab7;
+            }
+            break 'lab7;
+        }
+        env.cursor = v_8;
+        env.bra = env.cursor;
+        if !env.eq_s(&"\u{0BB5}\u{0BC2}") {
+            return false;
+        }
+        env.ket = env.cursor;
+        if !env.slice_from("\u{0B8A}") {
+            return false;
+        }
+        break 'lab0;
+    }
+    return true;
+}
+
+fn r_fix_endings(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    let v_1 = env.cursor;
+    'lab0: loop {
+        'replab1: loop{
+            let v_2 = env.cursor;
+            'lab2: for _ in 0..1 {
+                if !r_fix_ending(env, context) {
+                    break 'lab2;
+                }
+                continue 'replab1;
+            }
+            env.cursor = v_2;
+            break 'replab1;
+        }
+        break 'lab0;
+    }
+    env.cursor = v_1;
+    return true;
+}
+
+fn r_fix_ending(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !((env.current.chars().count() as i32) > 3){
+        return false;
+    }
+    env.limit_backward = env.cursor;
+    env.cursor = env.limit;
+    'lab0: loop {
+        let v_1 = env.limit - env.cursor;
+        'lab1: loop {
+            env.ket = env.cursor;
+            if env.find_among_b(A_1, context) == 0 {
+                break 'lab1;
+            }
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        'lab2: loop {
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"\u{0BAF}\u{0BCD}") {
+                break 'lab2;
+            }
+            let v_2 = env.limit - env.cursor;
+            if env.find_among_b(A_2, context) == 0 {
+                break 'lab2;
+            }
+            env.cursor = env.limit - v_2;
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        'lab3: loop {
+            env.ket = env.cursor;
+            'lab4: loop {
+                let v_3 = env.limit - env.cursor;
+                'lab5: loop {
+                    if !env.eq_s_b(&"\u{0B9F}\u{0BCD}\u{0BAA}\u{0BCD}") {
+                        break 'lab5;
+                    }
+                    break 'lab4;
+                }
+                env.cursor = env.limit - v_3;
+                if !env.eq_s_b(&"\u{0B9F}\u{0BCD}\u{0B95}\u{0BCD}") {
+                    break 'lab3;
+                }
+                break 'lab4;
+            }
+            env.bra = env.cursor;
+            if !env.slice_from("\u{0BB3}\u{0BCD}") {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        'lab6: loop {
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"\u{0BA9}\u{0BCD}\u{0BB1}\u{0BCD}") {
+                break 'lab6;
+            }
+            env.bra = env.cursor;
+            if !env.slice_from("\u{0BB2}\u{0BCD}") {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        'lab7: loop {
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"\u{0BB1}\u{0BCD}\u{0B95}\u{0BCD}") {
+                break 'lab7;
+            }
+            env.bra = env.cursor;
+            if !env.slice_from("\u{0BB2}\u{0BCD}") {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        'lab8: loop {
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"\u{0B9F}\u{0BCD}\u{0B9F}\u{0BCD}") {
+                break 'lab8;
+            }
+            env.bra = env.cursor;
+            if !env.slice_from("\u{0B9F}\u{0BC1}") {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        'lab9: loop {
+            if !context.b_found_vetrumai_urupu {
+                break 'lab9;
+            }
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"\u{0BA4}\u{0BCD}\u{0BA4}\u{0BCD}") {
+                break 'lab9;
+            }
+            let v_4 = env.limit - env.cursor;
+            let v_5 = env.limit - env.cursor;
+            'lab10: loop {
+                if !env.eq_s_b(&"\u{0BC8}") {
+                    break 'lab10;
+                }
+                break 'lab9;
+            }
+            env.cursor = env.limit - v_5;
+            env.cursor = env.limit - v_4;
+            env.bra = env.cursor;
+            if !env.slice_from("\u{0BAE}\u{0BCD}") {
+                return false;
+            }
+            env.bra = env.cursor;
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        'lab11: loop {
+            env.ket = env.cursor;
+            'lab12: loop {
+                let v_6 = env.limit - env.cursor;
+                'lab13: loop {
+                    if !env.eq_s_b(&"\u{0BC1}\u{0B95}\u{0BCD}") {
+                        break 'lab13;
+                    }
+                    break 'lab12;
+                }
+                env.cursor = env.limit - v_6;
+                if !env.eq_s_b(&"\u{0BC1}\u{0B95}\u{0BCD}\u{0B95}\u{0BCD}") {
+                    break 'lab11;
+                }
+                break 'lab12;
+            }
+            env.bra = env.cursor;
+            if !env.slice_from("\u{0BCD}") {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        'lab14: loop {
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"\u{0BCD}") {
+                break 'lab14;
+            }
+            if env.find_among_b(A_3, context) == 0 {
+                break 'lab14;
+            }
+            if !env.eq_s_b(&"\u{0BCD}") {
+                break 'lab14;
+            }
+            if env.find_among_b(A_4, context) == 0 {
+                break 'lab14;
+            }
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        'lab15: loop {
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"\u{0BC1}\u{0B95}\u{0BCD}") {
+                break 'lab15;
+            }
+            env.bra = env.cursor;
+            if !env.slice_from("\u{0BCD}") {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        'lab16: loop {
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"\u{0BCD}") {
+                break 'lab16;
+            }
+            if env.find_among_b(A_5, context) == 0 {
+                break 'lab16;
+            }
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        'lab17: loop {
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"\u{0BCD}") {
+                break 'lab17;
+            }
+            'lab18: loop {
+                let v_7 = env.limit - env.cursor;
+                'lab19: loop {
+                    if env.find_among_b(A_6, context) == 0 {
+                        break 'lab19;
+                    }
+                    break 'lab18;
+                }
+                env.cursor = env.limit - v_7;
+                if env.find_among_b(A_7, context) == 0 {
+                    break 'lab17;
+                }
+                break 'lab18;
+            }
+            if !env.eq_s_b(&"\u{0BCD}") {
+                break 'lab17;
+            }
+            env.bra = env.cursor;
+            if !env.slice_from("\u{0BCD}") {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        'lab20: loop {
+            env.ket = env.cursor;
+            if env.find_among_b(A_8, context) == 0 {
+                break 'lab20;
+            }
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        'lab21: loop {
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"\u{0BA9}\u{0BC1}") {
+                break 'lab21;
+            }
+            let v_8 = env.limit - env.cursor;
+            let v_9 = env.limit - env.cursor;
+            'lab22: loop {
+                if env.find_among_b(A_9, context) == 0 {
+                    break 'lab22;
+                }
+                break 'lab21;
+            }
+            env.cursor = env.limit - v_9;
+            env.cursor = env.limit - v_8;
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        'lab23: loop {
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"\u{0B99}\u{0BCD}") {
+                break 'lab23;
+            }
+            let v_10 = env.limit - env.cursor;
+            let v_11 = env.limit - env.cursor;
+            'lab24: loop {
+                if !env.eq_s_b(&"\u{0BC8}") {
+                    break 'lab24;
+                }
+                break 'lab23;
+            }
+            env.cursor = env.limit - v_11;
+            env.cursor = env.limit - v_10;
+            env.bra = env.cursor;
+            if !env.slice_from("\u{0BAE}\u{0BCD}") {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        'lab25: loop {
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"\u{0B99}\u{0BCD}") {
+                break 'lab25;
+            }
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        env.ket = env.cursor;
+        if !env.eq_s_b(&"\u{0BCD}") {
+            return false;
+        }
+        let v_12 = env.limit - env.cursor;
+        'lab26: loop {
+            let v_13 = env.limit - env.cursor;
+            'lab27: loop {
+                if env.find_among_b(A_10, context) == 0 {
+                    break 'lab27;
+                }
+                break 'lab26;
+            }
+            env.cursor = env.limit - v_13;
+            if !env.eq_s_b(&"\u{0BCD}") {
+                return false;
+            }
+            break 'lab26;
+        }
+        env.cursor = env.limit - v_12;
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        break 'lab0;
+    }
+    env.cursor = env.limit_backward;
+    return true;
+}
+
+pub fn stem(env: &mut SnowballEnv) -> bool {
+    let mut context = &mut Context {
+        b_found_vetrumai_urupu: false,
+        b_found_a_match: false,
+    };
+    context.b_found_vetrumai_urupu = false;
+    let v_1 = env.cursor;
+    r_fix_ending(env, context);
+    env.cursor = v_1;
+    if !((env.current.chars().count() as i32) > 4){
+        return false;
+    }
+    let v_2 = env.cursor;
+    'lab0: loop {
+        env.bra = env.cursor;
+        if !env.eq_s(&"\u{0B8E}") {
+            break 'lab0;
+        }
+        if env.find_among(A_0, context) == 0 {
+            break 'lab0;
+        }
+        if !env.eq_s(&"\u{0BCD}") {
+            break 'lab0;
+        }
+        env.ket = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        let v_3 = env.cursor;
+        r_fix_va_start(env, context);
+        env.cursor = v_3;
+        break 'lab0;
+    }
+    env.cursor = v_2;
+    let v_4 = env.cursor;
+    'lab1: loop {
+        context.b_found_a_match = false;
+        env.bra = env.cursor;
+        if env.find_among(A_11, context) == 0 {
+            break 'lab1;
+        }
+        if env.find_among(A_12, context) == 0 {
+            break 'lab1;
+        }
+        if !env.eq_s(&"\u{0BCD}") {
+            break 'lab1;
+        }
+        env.ket = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_found_a_match = true;
+        let v_5 = env.cursor;
+        r_fix_va_start(env, context);
+        env.cursor = v_5;
+        break 'lab1;
+    }
+    env.cursor = v_4;
+    let v_6 = env.cursor;
+    'lab2: loop {
+        if !((env.current.chars().count() as i32) > 4){
+            break 'lab2;
+        }
+        context.b_found_a_match = false;
+        env.limit_backward = env.cursor;
+        env.cursor = env.limit;
+        let v_7 = env.limit - env.cursor;
+        'lab3: loop {
+            env.ket = env.cursor;
+            if env.find_among_b(A_14, context) == 0 {
+                break 'lab3;
+            }
+            env.bra = env.cursor;
+            if !env.slice_from("\u{0BCD}") {
+                return false;
+            }
+            context.b_found_a_match = true;
+            break 'lab3;
+        }
+        env.cursor = env.limit - v_7;
+        env.cursor = env.limit_backward;
+        r_fix_endings(env, context);
+        break 'lab2;
+    }
+    env.cursor = v_6;
+    let v_9 = env.cursor;
+    'lab4: loop {
+        context.b_found_a_match = false;
+        if !((env.current.chars().count() as i32) > 4){
+            break 'lab4;
+        }
+        env.limit_backward = env.cursor;
+        env.cursor = env.limit;
+        env.ket = env.cursor;
+        if !env.eq_s_b(&"\u{0BC1}\u{0BAE}\u{0BCD}") {
+            break 'lab4;
+        }
+        env.bra = env.cursor;
+        if !env.slice_from("\u{0BCD}") {
+            return false;
+        }
+        context.b_found_a_match = true;
+        env.cursor = env.limit_backward;
+        let v_10 = env.cursor;
+        r_fix_ending(env, context);
+        env.cursor = v_10;
+        break 'lab4;
+    }
+    env.cursor = v_9;
+    let v_11 = env.cursor;
+    'lab5: loop {
+        context.b_found_a_match = false;
+        if !((env.current.chars().count() as i32) > 4){
+            break 'lab5;
+        }
+        env.limit_backward = env.cursor;
+        env.cursor = env.limit;
+        'lab6: loop {
+            let v_12 = env.limit - env.cursor;
+            'lab7: loop {
+                let v_13 = env.limit - env.cursor;
+                env.ket = env.cursor;
+                'lab8: loop {
+                    let v_14 = env.limit - env.cursor;
+                    'lab9: loop {
+                        if !env.eq_s_b(&"\u{0BC1}\u{0B9F}\u{0BA9}\u{0BCD}") {
+                            break 'lab9;
+                        }
+                        break 'lab8;
+                    }
+                    env.cursor = env.limit - v_14;
+                    'lab10: loop {
+                        if !env.eq_s_b(&"\u{0BBF}\u{0BB2}\u{0BCD}\u{0BB2}\u{0BC8}") {
+                            break 'lab10;
+                        }
+                        break 'lab8;
+                    }
+                    env.cursor = env.limit - v_14;
+                    'lab11: loop {
+                        if !env.eq_s_b(&"\u{0BBF}\u{0B9F}\u{0BAE}\u{0BCD}") {
+                            break 'lab11;
+                        }
+                        break 'lab8;
+                    }
+                    env.cursor = env.limit - v_14;
+                    'lab12: loop {
+                        if !env.eq_s_b(&"\u{0BBF}\u{0BA9}\u{0BCD}\u{0BB1}\u{0BBF}") {
+                            break 'lab12;
+                        }
+                        break 'lab8;
+                    }
+                    env.cursor = env.limit - v_14;
+                    'lab13: loop {
+                        if !env.eq_s_b(&"\u{0BBE}\u{0B95}\u{0BBF}") {
+                            break 'lab13;
+                        }
+                        break 'lab8;
+                    }
+                    env.cursor = env.limit - v_14;
+                    'lab14: loop {
+                        if !env.eq_s_b(&"\u{0BBE}\u{0B95}\u{0BBF}\u{0BAF}") {
+                            break 'lab14;
+                        }
+                        break 'lab8;
+                    }
+                    env.cursor = env.limit - v_14;
+                    'lab15: loop {
+                        if !env.eq_s_b(&"\u{0BC6}\u{0BA9}\u{0BCD}\u{0BB1}\u{0BC1}") {
+                            break 'lab15;
+                        }
+                        break 'lab8;
+                    }
+                    env.cursor = env.limit - v_14;
+                    'lab16: loop {
+                        if !env.eq_s_b(&"\u{0BC1}\u{0BB3}\u{0BCD}\u{0BB3}") {
+                            break 'lab16;
+                        }
+                        break 'lab8;
+                    }
+                    env.cursor = env.limit - v_14;
+                    'lab17: loop {
+                        if !env.eq_s_b(&"\u{0BC1}\u{0B9F}\u{0BC8}\u{0BAF}") {
+                            break 'lab17;
+                        }
+                        break 'lab8;
+                    }
+                    env.cursor = env.limit - v_14;
+                    'lab18: loop {
+                        if !env.eq_s_b(&"\u{0BC1}\u{0B9F}\u{0BC8}") {
+                            break 'lab18;
+                        }
+                        break 'lab8;
+                    }
+                    env.cursor = env.limit - v_14;
+                    'lab19: loop {
+                        if !env.eq_s_b(&"\u{0BC6}\u{0BA9}\u{0BC1}\u{0BAE}\u{0BCD}") {
+                            break 'lab19;
+                        }
+                        break 'lab8;
+                    }
+                    env.cursor = env.limit - v_14;
+                    'lab20: loop {
+                        if !env.eq_s_b(&"\u{0BB2}\u{0BCD}\u{0BB2}") {
+                            break 'lab20;
+                        }
+                        let v_15 = env.limit - env.cursor;
+                        let v_16 = env.limit - env.cursor;
+                        'lab21: loop {
+                            if env.find_among_b(A_16, context) == 0 {
+                                break 'lab21;
+                            }
+                            break 'lab20;
+                        }
+                        env.cursor = env.limit - v_16;
+                        env.cursor = env.limit - v_15;
+                        break 'lab8;
+                    }
+                    env.cursor = env.limit - v_14;
+                    'lab22: loop {
+                        if !env.eq_s_b(&"\u{0BC6}\u{0BA9}") {
+                            break 'lab22;
+                        }
+                        break 'lab8;
+                    }
+                    env.cursor = env.limit - v_14;
+                    if !env.eq_s_b(&"\u{0BBE}\u{0B95}\u{0BBF}") {
+                        break 'lab7;
+                    }
+                    break 'lab8;
+                }
+                env.bra = env.cursor;
+                if !env.slice_from("\u{0BCD}") {
+                    return false;
+                }
+                context.b_found_a_match = true;
+                env.cursor = env.limit - v_13;
+                break 'lab6;
+            }
+            env.cursor = env.limit - v_12;
+            let v_17 = env.limit - env.cursor;
+            env.ket = env.cursor;
+            if env.find_among_b(A_17, context) == 0 {
+                break 'lab5;
+            }
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            context.b_found_a_match = true;
+            env.cursor = env.limit - v_17;
+            break 'lab6;
+        }
+        env.cursor = env.limit_backward;
+        r_fix_endings(env, context);
+        break 'lab5;
+    }
+    env.cursor = v_11;
+    let v_19 = env.cursor;
+    'lab23: loop {
+        context.b_found_a_match = false;
+        context.b_found_vetrumai_urupu = false;
+        if !((env.current.chars().count() as i32) > 4){
+            break 'lab23;
+        }
+        env.limit_backward = env.cursor;
+        env.cursor = env.limit;
+        'lab24: loop {
+            let v_20 = env.limit - env.cursor;
+            'lab25: loop {
+                let v_21 = env.limit - env.cursor;
+                env.ket = env.cursor;
+                if !env.eq_s_b(&"\u{0BA9}\u{0BC8}") {
+                    break 'lab25;
+                }
+                env.bra = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+                env.cursor = env.limit - v_21;
+                break 'lab24;
+            }
+            env.cursor = env.limit - v_20;
+            'lab26: loop {
+                let v_22 = env.limit - env.cursor;
+                env.ket = env.cursor;
+                'lab27: loop {
+                    let v_23 = env.limit - env.cursor;
+                    'lab28: loop {
+                        'lab29: loop {
+                            let v_24 = env.limit - env.cursor;
+                            'lab30: loop {
+                                if !env.eq_s_b(&"\u{0BBF}\u{0BA9}\u{0BC8}") {
+                                    break 'lab30;
+                                }
+                                break 'lab29;
+                            }
+                            env.cursor = env.limit - v_24;
+                            if !env.eq_s_b(&"\u{0BC8}") {
+                                break 'lab28;
+                            }
+                            break 'lab29;
+                        }
+                        let v_25 = env.limit - env.cursor;
+                        let v_26 = env.limit - env.cursor;
+                        'lab31: loop {
+                            if env.find_among_b(A_18, context) == 0 {
+                                break 'lab31;
+                            }
+                            break 'lab28;
+                        }
+                        env.cursor = env.limit - v_26;
+                        env.cursor = env.limit - v_25;
+                        break 'lab27;
+                    }
+                    env.cursor = env.limit - v_23;
+                    if !env.eq_s_b(&"\u{0BC8}") {
+                        break 'lab26;
+                    }
+                    let v_27 = env.limit - env.cursor;
+                    if env.find_among_b(A_19, context) == 0 {
+                        break 'lab26;
+                    }
+                    if !env.eq_s_b(&"\u{0BCD}") {
+                        break 'lab26;
+                    }
+                    env.cursor = env.limit - v_27;
+                    break 'lab27;
+                }
+                env.bra = env.cursor;
+                if !env.slice_from("\u{0BCD}") {
+                    return false;
+                }
+                env.cursor = env.limit - v_22;
+                break 'lab24;
+            }
+            env.cursor = env.limit - v_20;
+            'lab32: loop {
+                let v_28 = env.limit - env.cursor;
+                env.ket = env.cursor;
+                'lab33: loop {
+                    let v_29 = env.limit - env.cursor;
+                    'lab34: loop {
+                        if !env.eq_s_b(&"\u{0BCA}\u{0B9F}\u{0BC1}") {
+                            break 'lab34;
+                        }
+                        break 'lab33;
+                    }
+                    env.cursor = env.limit - v_29;
+                    'lab35: loop {
+                        if !env.eq_s_b(&"\u{0BCB}\u{0B9F}\u{0BC1}") {
+                            break 'lab35;
+                        }
+                        break 'lab33;
+                    }
+                    env.cursor = env.limit - v_29;
+                    'lab36: loop {
+                        if !env.eq_s_b(&"\u{0BBF}\u{0BB2}\u{0BCD}") {
+                            break 'lab36;
+                        }
+                        break 'lab33;
+                    }
+                    env.cursor = env.limit - v_29;
+                    'lab37: loop {
+                        if !env.eq_s_b(&"\u{0BBF}\u{0BB1}\u{0BCD}") {
+                            break 'lab37;
+                        }
+                        break 'lab33;
+                    }
+                    env.cursor = env.limit - v_29;
+                    'lab38: loop {
+                        if !env.eq_s_b(&"\u{0BBF}\u{0BA9}\u{0BCD}") {
+                            break 'lab38;
+                        }
+                        let v_30 = env.limit - env.cursor;
+                        let v_31 = env.limit - env.cursor;
+                        'lab39: loop {
+                            if !env.eq_s_b(&"\u{0BAE}") {
+                                break 'lab39;
+                            }
+                            break 'lab38;
+                        }
+                        env.cursor = env.limit - v_31;
+                        env.cursor = env.limit - v_30;
+                        break 'lab33;
+                    }
+                    env.cursor = env.limit - v_29;
+                    'lab40: loop {
+                        if !env.eq_s_b(&"\u{0BBF}\u{0BA9}\u{0BCD}\u{0BB1}\u{0BC1}") {
+                            break 'lab40;
+                        }
+                        break 'lab33;
+                    }
+                    env.cursor = env.limit - v_29;
+                    'lab41: loop {
+                        if !env.eq_s_b(&"\u{0BBF}\u{0BB0}\u{0BC1}\u{0BA8}\u{0BCD}\u{0BA4}\u{0BC1}") {
+                            break 'lab41;
+                        }
+                        break 'lab33;
+                    }
+                    env.cursor = env.limit - v_29;
+                    'lab42: loop {
+                        if !env.eq_s_b(&"\u{0BB5}\u{0BBF}\u{0B9F}") {
+                            break 'lab42;
+                        }
+                        break 'lab33;
+                    }
+                    env.cursor = env.limit - v_29;
+                    'lab43: loop {
+                        if !((env.current.chars().count() as i32) >= 7){
+                            break 'lab43;
+                        }
+                        if !env.eq_s_b(&"\u{0BBF}\u{0B9F}\u{0BAE}\u{0BCD}") {
+                            break 'lab43;
+                        }
+                        break 'lab33;
+                    }
+                    env.cursor = env.limit - v_29;
+                    'lab44: loop {
+                        if !env.eq_s_b(&"\u{0BBE}\u{0BB2}\u{0BCD}") {
+                            break 'lab44;
+                        }
+                        break 'lab33;
+                    }
+                    env.cursor = env.limit - v_29;
+                    'lab45: loop {
+                        if !env.eq_s_b(&"\u{0BC1}\u{0B9F}\u{0BC8}") {
+                            break 'lab45;
+                        }
+                        break 'lab33;
+                    }
+                    env.cursor = env.limit - v_29;
+                    'lab46: loop {
+                        if !env.eq_s_b(&"\u{0BBE}\u{0BAE}\u{0BB2}\u{0BCD}") {
+                            break 'lab46;
+                        }
+                        break 'lab33;
+                    }
+                    env.cursor = env.limit - v_29;
+                    'lab47: loop {
+                        if !env.eq_s_b(&"\u{0BB2}\u{0BCD}") {
+                            break 'lab47;
+                        }
+                        let v_32 = env.limit - env.cursor;
+                        let v_33 = env.limit - env.cursor;
+                        'lab48: loop {
+                            if env.find_among_b(A_20, context) == 0 {
+                                break 'lab48;
+                            }
+                            break 'lab47;
+                        }
+                        env.cursor = env.limit - v_33;
+                        env.cursor = env.limit - v_32;
+                        break 'lab33;
+                    }
+                    env.cursor = env.limit - v_29;
+                    if !env.eq_s_b(&"\u{0BC1}\u{0BB3}\u{0BCD}") {
+                        break 'lab32;
+                    }
+                    break 'lab33;
+                }
+                env.bra = env.cursor;
+                if !env.slice_from("\u{0BCD}") {
+                    return false;
+                }
+                env.cursor = env.limit - v_28;
+                break 'lab24;
+            }
+            env.cursor = env.limit - v_20;
+            'lab49: loop {
+                let v_34 = env.limit - env.cursor;
+                env.ket = env.cursor;
+                'lab50: loop {
+                    let v_35 = env.limit - env.cursor;
+                    'lab51: loop {
+                        if !env.eq_s_b(&"\u{0B95}\u{0BA3}\u{0BCD}") {
+                            break 'lab51;
+                        }
+                        break 'lab50;
+                    }
+                    env.cursor = env.limit - v_35;
+                    'lab52: loop {
+                        if !env.eq_s_b(&"\u{0BAE}\u{0BC1}\u{0BA9}\u{0BCD}") {
+                            break 'lab52;
+                        }
+                        break 'lab50;
+                    }
+                    env.cursor = env.limit - v_35;
+                    'lab53: loop {
+                        if !env.eq_s_b(&"\u{0BAE}\u{0BC7}\u{0BB2}\u{0BCD}") {
+                            break 'lab53;
+                        }
+                        break 'lab50;
+                    }
+                    env.cursor = env.limit - v_35;
+                    'lab54: loop {
+                        if !env.eq_s_b(&"\u{0BAE}\u{0BC7}\u{0BB1}\u{0BCD}") {
+                            break 'lab54;
+                        }
+                        break 'lab50;
+                    }
+                    env.cursor = env.limit - v_35;
+                    'lab55: loop {
+                        if !env.eq_s_b(&"\u{0B95}\u{0BC0}\u{0BB4}\u{0BCD}") {
+                            break 'lab55;
+                        }
+                        break 'lab50;
+                    }
+                    env.cursor = env.limit - v_35;
+                    'lab56: loop {
+                        if !env.eq_s_b(&"\u{0BAA}\u{0BBF}\u{0BA9}\u{0BCD}") {
+                            break 'lab56;
+                        }
+                        break 'lab50;
+                    }
+                    env.cursor = env.limit - v_35;
+                    if !env.eq_s_b(&"\u{0BA4}\u{0BC1}") {
+                        break 'lab49;
+                    }
+                    let v_36 = env.limit - env.cursor;
+                    let v_37 = env.limit - env.cursor;
+                    'lab57: loop {
+                        if env.find_among_b(A_21, context) == 0 {
+                            break 'lab57;
+                        }
+                        break 'lab49;
+                    }
+                    env.cursor = env.limit - v_37;
+                    env.cursor = env.limit - v_36;
+                    break 'lab50;
+                }
+                env.bra = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+                env.cursor = env.limit - v_34;
+                break 'lab24;
+            }
+            env.cursor = env.limit - v_20;
+            let v_38 = env.limit - env.cursor;
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"\u{0BC0}") {
+                break 'lab23;
+            }
+            env.bra = env.cursor;
+            if !env.slice_from("\u{0BBF}") {
+                return false;
+            }
+            env.cursor = env.limit - v_38;
+            break 'lab24;
+        }
+        context.b_found_a_match = true;
+        context.b_found_vetrumai_urupu = true;
+        let v_39 = env.limit - env.cursor;
+        'lab58: loop {
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"\u{0BBF}\u{0BA9}\u{0BCD}") {
+                break 'lab58;
+            }
+            env.bra = env.cursor;
+            if !env.slice_from("\u{0BCD}") {
+                return false;
+            }
+            break 'lab58;
+        }
+        env.cursor = env.limit - v_39;
+        env.cursor = env.limit_backward;
+        r_fix_endings(env, context);
+        break 'lab23;
+    }
+    env.cursor = v_19;
+    let v_41 = env.cursor;
+    'lab59: loop {
+        context.b_found_a_match = false;
+        env.limit_backward = env.cursor;
+        env.cursor = env.limit;
+        'lab60: loop {
+            let v_42 = env.limit - env.cursor;
+            'lab61: loop {
+                env.ket = env.cursor;
+                if !env.eq_s_b(&"\u{0BC1}\u{0B99}\u{0BCD}\u{0B95}\u{0BB3}\u{0BCD}") {
+                    break 'lab61;
+                }
+                let v_43 = env.limit - env.cursor;
+                let v_44 = env.limit - env.cursor;
+                'lab62: loop {
+                    if env.find_among_b(A_13, context) == 0 {
+                        break 'lab62;
+                    }
+                    break 'lab61;
+                }
+                env.cursor = env.limit - v_44;
+                env.cursor = env.limit - v_43;
+                env.bra = env.cursor;
+                if !env.slice_from("\u{0BCD}") {
+                    return false;
+                }
+                break 'lab60;
+            }
+            env.cursor = env.limit - v_42;
+            'lab63: loop {
+                env.ket = env.cursor;
+                if !env.eq_s_b(&"\u{0BB1}\u{0BCD}\u{0B95}\u{0BB3}\u{0BCD}") {
+                    break 'lab63;
+                }
+                env.bra = env.cursor;
+                if !env.slice_from("\u{0BB2}\u{0BCD}") {
+                    return false;
+                }
+                break 'lab60;
+            }
+            env.cursor = env.limit - v_42;
+            'lab64: loop {
+                env.ket = env.cursor;
+                if !env.eq_s_b(&"\u{0B9F}\u{0BCD}\u{0B95}\u{0BB3}\u{0BCD}") {
+                    break 'lab64;
+                }
+                env.bra = env.cursor;
+                if !env.slice_from("\u{0BB3}\u{0BCD}") {
+                    return false;
+                }
+                break 'lab60;
+            }
+            env.cursor = env.limit - v_42;
+            env.ket = env.cursor;
+            if !env.eq_s_b(&"\u{0B95}\u{0BB3}\u{0BCD}") {
+                break 'lab59;
+            }
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            break 'lab60;
+        }
+        context.b_found_a_match = true;
+        env.cursor = env.limit_backward;
+        break 'lab59;
+    }
+    env.cursor = v_41;
+    let v_45 = env.cursor;
+    'lab65: loop {
+        if !((env.current.chars().count() as i32) > 4){
+            break 'lab65;
+        }
+        context.b_found_a_match = false;
+        env.limit_backward = env.cursor;
+        env.cursor = env.limit;
+        env.ket = env.cursor;
+        if env.find_among_b(A_15, context) == 0 {
+            break 'lab65;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        context.b_found_a_match = true;
+        env.cursor = env.limit_backward;
+        break 'lab65;
+    }
+    env.cursor = v_45;
+    let v_46 = env.cursor;
+    'lab66: loop {
+        context.b_found_a_match = true;
+        'replab67: loop{
+            let v_47 = env.cursor;
+            'lab68: for _ in 0..1 {
+                if !context.b_found_a_match {
+                    break 'lab68;
+                }
+                let v_48 = env.cursor;
+                'lab69: loop {
+                    context.b_found_a_match = false;
+                    if !((env.current.chars().count() as i32) > 4){
+                        break 'lab69;
+                    }
+                    env.limit_backward = env.cursor;
+                    env.cursor = env.limit;
+                    let v_49 = env.limit - env.cursor;
+                    'lab70: loop {
+                        'lab71: loop {
+                            let v_50 = env.limit - env.cursor;
+                            'lab72: loop {
+                                let v_51 = env.limit - env.cursor;
+                                env.ket = env.cursor;
+                                if env.find_among_b(A_22, context) == 0 {
+                                    break 'lab72;
+                                }
+                                env.bra = env.cursor;
+                                if !env.slice_del() {
+                                    return false;
+                                }
+                                context.b_found_a_match = true;
+                                env.cursor = env.limit - v_51;
+                                break 'lab71;
+                            }
+                            env.cursor = env.limit - v_50;
+                            'lab73: loop {
+                                let v_52 = env.limit - env.cursor;
+                                env.ket = env.cursor;
+                                'lab74: loop {
+                                    let v_53 = env.limit - env.cursor;
+                                    'lab75: loop {
+                                        if !env.eq_s_b(&"\u{0BAE}\u{0BBE}\u{0BB0}\u{0BCD}") {
+                                            break 'lab75;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab76: loop {
+                                        if !env.eq_s_b(&"\u{0BAE}\u{0BBF}\u{0BA9}\u{0BCD}") {
+                                            break 'lab76;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab77: loop {
+                                        if !env.eq_s_b(&"\u{0BA9}\u{0BA9}\u{0BCD}") {
+                                            break 'lab77;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab78: loop {
+                                        if !env.eq_s_b(&"\u{0BA9}\u{0BBE}\u{0BA9}\u{0BCD}") {
+                                            break 'lab78;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab79: loop {
+                                        if !env.eq_s_b(&"\u{0BA9}\u{0BBE}\u{0BB3}\u{0BCD}") {
+                                            break 'lab79;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab80: loop {
+                                        if !env.eq_s_b(&"\u{0BA9}\u{0BBE}\u{0BB0}\u{0BCD}") {
+                                            break 'lab80;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab81: loop {
+                                        if !env.eq_s_b(&"\u{0BB5}\u{0BA9}\u{0BCD}") {
+                                            break 'lab81;
+                                        }
+                                        let v_54 = env.limit - env.cursor;
+                                        let v_55 = env.limit - env.cursor;
+                                        'lab82: loop {
+                                            if env.find_among_b(A_23, context) == 0 {
+                                                break 'lab82;
+                                            }
+                                            break 'lab81;
+                                        }
+                                        env.cursor = env.limit - v_55;
+                                        env.cursor = env.limit - v_54;
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab83: loop {
+                                        if !env.eq_s_b(&"\u{0BA9}\u{0BB3}\u{0BCD}") {
+                                            break 'lab83;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab84: loop {
+                                        if !env.eq_s_b(&"\u{0BB5}\u{0BB3}\u{0BCD}") {
+                                            break 'lab84;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab85: loop {
+                                        if !env.eq_s_b(&"\u{0BA9}\u{0BB0}\u{0BCD}") {
+                                            break 'lab85;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab86: loop {
+                                        if !env.eq_s_b(&"\u{0BB5}\u{0BB0}\u{0BCD}") {
+                                            break 'lab86;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab87: loop {
+                                        if !env.eq_s_b(&"\u{0BA9}") {
+                                            break 'lab87;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab88: loop {
+                                        if !env.eq_s_b(&"\u{0BAA}") {
+                                            break 'lab88;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab89: loop {
+                                        if !env.eq_s_b(&"\u{0B95}") {
+                                            break 'lab89;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab90: loop {
+                                        if !env.eq_s_b(&"\u{0BA4}") {
+                                            break 'lab90;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab91: loop {
+                                        if !env.eq_s_b(&"\u{0BAF}") {
+                                            break 'lab91;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab92: loop {
+                                        if !env.eq_s_b(&"\u{0BAA}\u{0BA9}\u{0BCD}") {
+                                            break 'lab92;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab93: loop {
+                                        if !env.eq_s_b(&"\u{0BAA}\u{0BB3}\u{0BCD}") {
+                                            break 'lab93;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab94: loop {
+                                        if !env.eq_s_b(&"\u{0BAA}\u{0BB0}\u{0BCD}") {
+                                            break 'lab94;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab95: loop {
+                                        if !env.eq_s_b(&"\u{0BA4}\u{0BC1}") {
+                                            break 'lab95;
+                                        }
+                                        let v_56 = env.limit - env.cursor;
+                                        let v_57 = env.limit - env.cursor;
+                                        'lab96: loop {
+                                            if env.find_among_b(A_24, context) == 0 {
+                                                break 'lab96;
+                                            }
+                                            break 'lab95;
+                                        }
+                                        env.cursor = env.limit - v_57;
+                                        env.cursor = env.limit - v_56;
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab97: loop {
+                                        if !env.eq_s_b(&"\u{0BBF}\u{0BB1}\u{0BCD}\u{0BB1}\u{0BC1}") {
+                                            break 'lab97;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab98: loop {
+                                        if !env.eq_s_b(&"\u{0BAA}\u{0BAE}\u{0BCD}") {
+                                            break 'lab98;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab99: loop {
+                                        if !env.eq_s_b(&"\u{0BA9}\u{0BAE}\u{0BCD}") {
+                                            break 'lab99;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab100: loop {
+                                        if !env.eq_s_b(&"\u{0BA4}\u{0BC1}\u{0BAE}\u{0BCD}") {
+                                            break 'lab100;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab101: loop {
+                                        if !env.eq_s_b(&"\u{0BB1}\u{0BC1}\u{0BAE}\u{0BCD}") {
+                                            break 'lab101;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab102: loop {
+                                        if !env.eq_s_b(&"\u{0B95}\u{0BC1}\u{0BAE}\u{0BCD}") {
+                                            break 'lab102;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab103: loop {
+                                        if !env.eq_s_b(&"\u{0BA9}\u{0BC6}\u{0BA9}\u{0BCD}") {
+                                            break 'lab103;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    'lab104: loop {
+                                        if !env.eq_s_b(&"\u{0BA9}\u{0BC8}") {
+                                            break 'lab104;
+                                        }
+                                        break 'lab74;
+                                    }
+                                    env.cursor = env.limit - v_53;
+                                    if !env.eq_s_b(&"\u{0BB5}\u{0BC8}") {
+                                        break 'lab73;
+                                    }
+                                    break 'lab74;
+                                }
+                                env.bra = env.cursor;
+                                if !env.slice_del() {
+                                    return false;
+                                }
+                                context.b_found_a_match = true;
+                                env.cursor = env.limit - v_52;
+                                break 'lab71;
+                            }
+                            env.cursor = env.limit - v_50;
+                            'lab105: loop {
+                                let v_58 = env.limit - env.cursor;
+                                env.ket = env.cursor;
+                                'lab106: loop {
+                                    let v_59 = env.limit - env.cursor;
+                                    'lab107: loop {
+                                        if !env.eq_s_b(&"\u{0BBE}\u{0BA9}\u{0BCD}") {
+                                            break 'lab107;
+                                        }
+                                        let v_60 = env.limit - env.cursor;
+                                        let v_61 = env.limit - env.cursor;
+                                        'lab108: loop {
+                                            if !env.eq_s_b(&"\u{0B9A}") {
+                                                break 'lab108;
+                                            }
+                                            break 'lab107;
+                                        }
+                                        env.cursor = env.limit - v_61;
+                                        env.cursor = env.limit - v_60;
+                                        break 'lab106;
+                                    }
+                                    env.cursor = env.limit - v_59;
+                                    'lab109: loop {
+                                        if !env.eq_s_b(&"\u{0BBE}\u{0BB3}\u{0BCD}") {
+                                            break 'lab109;
+                                        }
+                                        break 'lab106;
+                                    }
+                                    env.cursor = env.limit - v_59;
+                                    'lab110: loop {
+                                        if !env.eq_s_b(&"\u{0BBE}\u{0BB0}\u{0BCD}") {
+                                            break 'lab110;
+                                        }
+                                        break 'lab106;
+                                    }
+                                    env.cursor = env.limit - v_59;
+                                    'lab111: loop {
+                                        if !env.eq_s_b(&"\u{0BC7}\u{0BA9}\u{0BCD}") {
+                                            break 'lab111;
+                                        }
+                                        break 'lab106;
+                                    }
+                                    env.cursor = env.limit - v_59;
+                                    'lab112: loop {
+                                        if !env.eq_s_b(&"\u{0BBE}") {
+                                            break 'lab112;
+                                        }
+                                        break 'lab106;
+                                    }
+                                    env.cursor = env.limit - v_59;
+                                    'lab113: loop {
+                                        if !env.eq_s_b(&"\u{0BBE}\u{0BAE}\u{0BCD}") {
+                                            break 'lab113;
+                                        }
+                                        break 'lab106;
+                                    }
+                                    env.cursor = env.limit - v_59;
+                                    'lab114: loop {
+                                        if !env.eq_s_b(&"\u{0BC6}\u{0BAE}\u{0BCD}") {
+                                            break 'lab114;
+                                        }
+                                        break 'lab106;
+                                    }
+                                    env.cursor = env.limit - v_59;
+                                    'lab115: loop {
+                                        if !env.eq_s_b(&"\u{0BC7}\u{0BAE}\u{0BCD}") {
+                                            break 'lab115;
+                                        }
+                                        break 'lab106;
+                                    }
+                                    env.cursor = env.limit - v_59;
+                                    'lab116: loop {
+                                        if !env.eq_s_b(&"\u{0BCB}\u{0BAE}\u{0BCD}") {
+                                            break 'lab116;
+                                        }
+                                        break 'lab106;
+                                    }
+                                    env.cursor = env.limit - v_59;
+                                    'lab117: loop {
+                                        if !env.eq_s_b(&"\u{0B95}\u{0BC1}\u{0BAE}\u{0BCD}") {
+                                            break 'lab117;
+                                        }
+                                        break 'lab106;
+                                    }
+                                    env.cursor = env.limit - v_59;
+                                    'lab118: loop {
+                                        if !env.eq_s_b(&"\u{0BA4}\u{0BC1}\u{0BAE}\u{0BCD}") {
+                                            break 'lab118;
+                                        }
+                                        break 'lab106;
+                                    }
+                                    env.cursor = env.limit - v_59;
+                                    'lab119: loop {
+                                        if !env.eq_s_b(&"\u{0B9F}\u{0BC1}\u{0BAE}\u{0BCD}") {
+                                            break 'lab119;
+                                        }
+                                        break 'lab106;
+                                    }
+                                    env.cursor = env.limit - v_59;
+                                    'lab120: loop {
+                                        if !env.eq_s_b(&"\u{0BB1}\u{0BC1}\u{0BAE}\u{0BCD}") {
+                                            break 'lab120;
+                                        }
+                                        break 'lab106;
+                                    }
+                                    env.cursor = env.limit - v_59;
+                                    'lab121: loop {
+                                        if !env.eq_s_b(&"\u{0BBE}\u{0BAF}\u{0BCD}") {
+                                            break 'lab121;
+                                        }
+                                        break 'lab106;
+                                    }
+                                    env.cursor = env.limit - v_59;
+                                    'lab122: loop {
+                                        if !env.eq_s_b(&"\u{0BA9}\u{0BC6}\u{0BA9}\u{0BCD}") {
+                                            break 'lab122;
+                                        }
+                                        break 'lab106;
+                                    }
+                                    env.cursor = env.limit - v_59;
+                                    'lab123: loop {
+                                        if !env.eq_s_b(&"\u{0BA9}\u{0BBF}\u{0BB0}\u{0BCD}") {
+                                            break 'lab123;
+                                        }
+                                        break 'lab106;
+                                    }
+                                    env.cursor = env.limit - v_59;
+                                    'lab124: loop {
+                                        if !env.eq_s_b(&"\u{0BC0}\u{0BB0}\u{0BCD}") {
+                                            break 'lab124;
+                                        }
+                                        break 'lab106;
+                                    }
+                                    env.cursor = env.limit - v_59;
+                                    if !env.eq_s_b(&"\u{0BC0}\u{0BAF}\u{0BB0}\u{0BCD}") {
+                                        break 'lab105;
+                                    }
+                                    break 'lab106;
+                                }
+                                env.bra = env.cursor;
+                                if !env.slice_from("\u{0BCD}") {
+                                    return false;
+                                }
+                                context.b_found_a_match = true;
+                                env.cursor = env.limit - v_58;
+                                break 'lab71;
+                            }
+                            env.cursor = env.limit - v_50;
+                            let v_62 = env.limit - env.cursor;
+                            env.ket = env.cursor;
+                            'lab125: loop {
+                                let v_63 = env.limit - env.cursor;
+                                'lab126: loop {
+                                    if !env.eq_s_b(&"\u{0B95}\u{0BC1}") {
+                                        break 'lab126;
+                                    }
+                                    break 'lab125;
+                                }
+                                env.cursor = env.limit - v_63;
+                                if !env.eq_s_b(&"\u{0BA4}\u{0BC1}") {
+                                    break 'lab70;
+                                }
+                                break 'lab125;
+                            }
+                            let v_64 = env.limit - env.cursor;
+                            if !env.eq_s_b(&"\u{0BCD}") {
+                                break 'lab70;
+                            }
+                            env.cursor = env.limit - v_64;
+                            env.bra = env.cursor;
+                            if !env.slice_del() {
+                                return false;
+                            }
+                            context.b_found_a_match = true;
+                            env.cursor = env.limit - v_62;
+                            break 'lab71;
+                        }
+                        break 'lab70;
+                    }
+                    env.cursor = env.limit - v_49;
+                    let v_65 = env.limit - env.cursor;
+                    'lab127: loop {
+                        env.ket = env.cursor;
+                        if env.find_among_b(A_25, context) == 0 {
+                            break 'lab127;
+                        }
+                        env.bra = env.cursor;
+                        if !env.slice_del() {
+                            return false;
+                        }
+                        context.b_found_a_match = true;
+                        break 'lab127;
+                    }
+                    env.cursor = env.limit - v_65;
+                    env.cursor = env.limit_backward;
+                    r_fix_endings(env, context);
+                    break 'lab69;
+                }
+                env.cursor = v_48;
+                continue 'replab67;
+            }
+            env.cursor = v_47;
+            break 'replab67;
+        }
+        break 'lab66;
+    }
+    env.cursor = v_46;
+    return true;
+}
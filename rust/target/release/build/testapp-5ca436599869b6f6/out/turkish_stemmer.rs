@@ -0,0 +1,2007 @@
+//! Generated by Snowball 2.2.0 - https://snowballstem.org/
+
+#![allow(non_snake_case)]
+#![allow(non_upper_case_globals)]
+#![allow(unused_mut)]
+#![allow(unused_parens)]
+#![allow(unused_variables)]
+use snowball::SnowballEnv;
+use snowball::Among;
+
+static A_0: &'static [Among<Context>; 10] = &[
+    Among("m", -1, -1, None),
+    Among("n", -1, -1, None),
+    Among("miz", -1, -1, None),
+    Among("niz", -1, -1, None),
+    Among("muz", -1, -1, None),
+    Among("nuz", -1, -1, None),
+    Among("m\u{0131}z", -1, -1, None),
+    Among("n\u{0131}z", -1, -1, None),
+    Among("m\u{00FC}z", -1, -1, None),
+    Among("n\u{00FC}z", -1, -1, None),
+];
+
+static A_1: &'static [Among<Context>; 2] = &[
+    Among("leri", -1, -1, None),
+    Among("lar\u{0131}", -1, -1, None),
+];
+
+static A_2: &'static [Among<Context>; 4] = &[
+    Among("ni", -1, -1, None),
+    Among("nu", -1, -1, None),
+    Among("n\u{0131}", -1, -1, None),
+    Among("n\u{00FC}", -1, -1, None),
+];
+
+static A_3: &'static [Among<Context>; 4] = &[
+    Among("in", -1, -1, None),
+    Among("un", -1, -1, None),
+    Among("\u{0131}n", -1, -1, None),
+    Among("\u{00FC}n", -1, -1, None),
+];
+
+static A_4: &'static [Among<Context>; 2] = &[
+    Among("a", -1, -1, None),
+    Among("e", -1, -1, None),
+];
+
+static A_5: &'static [Among<Context>; 2] = &[
+    Among("na", -1, -1, None),
+    Among("ne", -1, -1, None),
+];
+
+static A_6: &'static [Among<Context>; 4] = &[
+    Among("da", -1, -1, None),
+    Among("ta", -1, -1, None),
+    Among("de", -1, -1, None),
+    Among("te", -1, -1, None),
+];
+
+static A_7: &'static [Among<Context>; 2] = &[
+    Among("nda", -1, -1, None),
+    Among("nde", -1, -1, None),
+];
+
+static A_8: &'static [Among<Context>; 4] = &[
+    Among("dan", -1, -1, None),
+    Among("tan", -1, -1, None),
+    Among("den", -1, -1, None),
+    Among("ten", -1, -1, None),
+];
+
+static A_9: &'static [Among<Context>; 2] = &[
+    Among("ndan", -1, -1, None),
+    Among("nden", -1, -1, None),
+];
+
+static A_10: &'static [Among<Context>; 2] = &[
+    Among("la", -1, -1, None),
+    Among("le", -1, -1, None),
+];
+
+static A_11: &'static [Among<Context>; 2] = &[
+    Among("ca", -1, -1, None),
+    Among("ce", -1, -1, None),
+];
+
+static A_12: &'static [Among<Context>; 4] = &[
+    Among("im", -1, -1, None),
+    Among("um", -1, -1, None),
+    Among("\u{0131}m", -1, -1, None),
+    Among("\u{00FC}m", -1, -1, None),
+];
+
+static A_13: &'static [Among<Context>; 4] = &[
+    Among("sin", -1, -1, None),
+    Among("sun", -1, -1, None),
+    Among("s\u{0131}n", -1, -1, None),
+    Among("s\u{00FC}n", -1, -1, None),
+];
+
+static A_14: &'static [Among<Context>; 4] = &[
+    Among("iz", -1, -1, None),
+    Among("uz", -1, -1, None),
+    Among("\u{0131}z", -1, -1, None),
+    Among("\u{00FC}z", -1, -1, None),
+];
+
+static A_15: &'static [Among<Context>; 4] = &[
+    Among("siniz", -1, -1, None),
+    Among("sunuz", -1, -1, None),
+    Among("s\u{0131}n\u{0131}z", -1, -1, None),
+    Among("s\u{00FC}n\u{00FC}z", -1, -1, None),
+];
+
+static A_16: &'static [Among<Context>; 2] = &[
+    Among("lar", -1, -1, None),
+    Among("ler", -1, -1, None),
+];
+
+static A_17: &'static [Among<Context>; 4] = &[
+    Among("niz", -1, -1, None),
+    Among("nuz", -1, -1, None),
+    Among("n\u{0131}z", -1, -1, None),
+    Among("n\u{00FC}z", -1, -1, None),
+];
+
+static A_18: &'static [Among<Context>; 8] = &[
+    Among("dir", -1, -1, None),
+    Among("tir", -1, -1, None),
+    Among("dur", -1, -1, None),
+    Among("tur", -1, -1, None),
+    Among("d\u{0131}r", -1, -1, None),
+    Among("t\u{0131}r", -1, -1, None),
+    Among("d\u{00FC}r", -1, -1, None),
+    Among("t\u{00FC}r", -1, -1, None),
+];
+
+static A_19: &'static [Among<Context>; 2] = &[
+    Among("cas\u{0131}na", -1, -1, None),
+    Among("cesine", -1, -1, None),
+];
+
+static A_20: &'static [Among<Context>; 32] = &[
+    Among("di", -1, -1, None),
+    Among("ti", -1, -1, None),
+    Among("dik", -1, -1, None),
+    Among("tik", -1, -1, None),
+    Among("duk", -1, -1, None),
+    Among("tuk", -1, -1, None),
+    Among("d\u{0131}k", -1, -1, None),
+    Among("t\u{0131}k", -1, -1, None),
+    Among("d\u{00FC}k", -1, -1, None),
+    Among("t\u{00FC}k", -1, -1, None),
+    Among("dim", -1, -1, None),
+    Among("tim", -1, -1, None),
+    Among("dum", -1, -1, None),
+    Among("tum", -1, -1, None),
+    Among("d\u{0131}m", -1, -1, None),
+    Among("t\u{0131}m", -1, -1, None),
+    Among("d\u{00FC}m", -1, -1, None),
+    Among("t\u{00FC}m", -1, -1, None),
+    Among("din", -1, -1, None),
+    Among("tin", -1, -1, None),
+    Among("dun", -1, -1, None),
+    Among("tun", -1, -1, None),
+    Among("d\u{0131}n", -1, -1, None),
+    Among("t\u{0131}n", -1, -1, None),
+    Among("d\u{00FC}n", -1, -1, None),
+    Among("t\u{00FC}n", -1, -1, None),
+    Among("du", -1, -1, None),
+    Among("tu", -1, -1, None),
+    Among("d\u{0131}", -1, -1, None),
+    Among("t\u{0131}", -1, -1, None),
+    Among("d\u{00FC}", -1, -1, None),
+    Among("t\u{00FC}", -1, -1, None),
+];
+
+static A_21: &'static [Among<Context>; 8] = &[
+    Among("sa", -1, -1, None),
+    Among("se", -1, -1, None),
+    Among("sak", -1, -1, None),
+    Among("sek", -1, -1, None),
+    Among("sam", -1, -1, None),
+    Among("sem", -1, -1, None),
+    Among("san", -1, -1, None),
+    Among("sen", -1, -1, None),
+];
+
+static A_22: &'static [Among<Context>; 4] = &[
+    Among("mi\u{015F}", -1, -1, None),
+    Among("mu\u{015F}", -1, -1, None),
+    Among("m\u{0131}\u{015F}", -1, -1, None),
+    Among("m\u{00FC}\u{015F}", -1, -1, None),
+];
+
+static A_23: &'static [Among<Context>; 4] = &[
+    Among("b", -1, 1, None),
+    Among("c", -1, 2, None),
+    Among("d", -1, 3, None),
+    Among("\u{011F}", -1, 4, None),
+];
+
+static G_vowel: &'static [u8; 27] = &[17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 8, 0, 0, 0, 0, 0, 0, 1];
+
+static G_U: &'static [u8; 26] = &[1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 1];
+
+static G_vowel1: &'static [u8; 27] = &[1, 64, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1];
+
+static G_vowel2: &'static [u8; 19] = &[17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130];
+
+static G_vowel3: &'static [u8; 27] = &[1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1];
+
+static G_vowel4: &'static [u8; 1] = &[17];
+
+static G_vowel5: &'static [u8; 1] = &[65];
+
+static G_vowel6: &'static [u8; 1] = &[65];
+
+#[derive(Clone)]
+struct Context {
+    b_continue_stemming_noun_suffixes: bool,
+}
+
+fn r_check_vowel_harmony(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    let v_1 = env.limit - env.cursor;
+    'golab0: loop {
+        let v_2 = env.limit - env.cursor;
+        'lab1: loop {
+            if !env.in_grouping_b(G_vowel, 97, 305) {
+                break 'lab1;
+            }
+            env.cursor = env.limit - v_2;
+            break 'golab0;
+        }
+        env.cursor = env.limit - v_2;
+        if env.cursor <= env.limit_backward {
+            return false;
+        }
+        env.previous_char();
+    }
+    'lab2: loop {
+        let v_3 = env.limit - env.cursor;
+        'lab3: loop {
+            if !env.eq_s_b(&"a") {
+                break 'lab3;
+            }
+            'golab4: loop {
+                let v_4 = env.limit - env.cursor;
+                'lab5: loop {
+                    if !env.in_grouping_b(G_vowel1, 97, 305) {
+                        break 'lab5;
+                    }
+                    env.cursor = env.limit - v_4;
+                    break 'golab4;
+                }
+                env.cursor = env.limit - v_4;
+                if env.cursor <= env.limit_backward {
+                    break 'lab3;
+                }
+                env.previous_char();
+            }
+            break 'lab2;
+        }
+        env.cursor = env.limit - v_3;
+        'lab6: loop {
+            if !env.eq_s_b(&"e") {
+                break 'lab6;
+            }
+            'golab7: loop {
+                let v_5 = env.limit - env.cursor;
+                'lab8: loop {
+                    if !env.in_grouping_b(G_vowel2, 101, 252) {
+                        break 'lab8;
+                    }
+                    env.cursor = env.limit - v_5;
+                    break 'golab7;
+                }
+                env.cursor = env.limit - v_5;
+                if env.cursor <= env.limit_backward {
+                    break 'lab6;
+                }
+                env.previous_char();
+            }
+            break 'lab2;
+        }
+        env.cursor = env.limit - v_3;
+        'lab9: loop {
+            if !env.eq_s_b(&"\u{0131}") {
+                break 'lab9;
+            }
+            'golab10: loop {
+                let v_6 = env.limit - env.cursor;
+                'lab11: loop {
+                    if !env.in_grouping_b(G_vowel3, 97, 305) {
+                        break 'lab11;
+                    }
+                    env.cursor = env.limit - v_6;
+                    break 'golab10;
+                }
+                env.cursor = env.limit - v_6;
+                if env.cursor <= env.limit_backward {
+                    break 'lab9;
+                }
+                env.previous_char();
+            }
+            break 'lab2;
+        }
+        env.cursor = env.limit - v_3;
+        'lab12: loop {
+            if !env.eq_s_b(&"i") {
+                break 'lab12;
+            }
+            'golab13: loop {
+                let v_7 = env.limit - env.cursor;
+                'lab14: loop {
+                    if !env.in_grouping_b(G_vowel4, 101, 105) {
+                        break 'lab14;
+                    }
+                    env.cursor = env.limit - v_7;
+                    break 'golab13;
+                }
+                env.cursor = env.limit - v_7;
+                if env.cursor <= env.limit_backward {
+                    break 'lab12;
+                }
+                env.previous_char();
+            }
+            break 'lab2;
+        }
+        env.cursor = env.limit - v_3;
+        'lab15: loop {
+            if !env.eq_s_b(&"o") {
+                break 'lab15;
+            }
+            'golab16: loop {
+                let v_8 = env.limit - env.cursor;
+                'lab17: loop {
+                    if !env.in_grouping_b(G_vowel5, 111, 117) {
+                        break 'lab17;
+                    }
+                    env.cursor = env.limit - v_8;
+                    break 'golab16;
+                }
+                env.cursor = env.limit - v_8;
+                if env.cursor <= env.limit_backward {
+                    break 'lab15;
+                }
+                env.previous_char();
+            }
+            break 'lab2;
+        }
+        env.cursor = env.limit - v_3;
+        'lab18: loop {
+            if !env.eq_s_b(&"\u{00F6}") {
+                break 'lab18;
+            }
+            'golab19: loop {
+                let v_9 = env.limit - env.cursor;
+                'lab20: loop {
+                    if !env.in_grouping_b(G_vowel6, 246, 252) {
+                        break 'lab20;
+                    }
+                    env.cursor = env.limit - v_9;
+                    break 'golab19;
+                }
+                env.cursor = env.limit - v_9;
+                if env.cursor <= env.limit_backward {
+                    break 'lab18;
+                }
+                env.previous_char();
+            }
+            break 'lab2;
+        }
+        env.cursor = env.limit - v_3;
+        'lab21: loop {
+            if !env.eq_s_b(&"u") {
+                break 'lab21;
+            }
+            'golab22: loop {
+                let v_10 = env.limit - env.cursor;
+                'lab23: loop {
+                    if !env.in_grouping_b(G_vowel5, 111, 117) {
+                        break 'lab23;
+                    }
+                    env.cursor = env.limit - v_10;
+                    break 'golab22;
+                }
+                env.cursor = env.limit - v_10;
+                if env.cursor <= env.limit_backward {
+                    break 'lab21;
+                }
+                env.previous_char();
+            }
+            break 'lab2;
+        }
+        env.cursor = env.limit - v_3;
+        if !env.eq_s_b(&"\u{00FC}") {
+            return false;
+        }
+        'golab24: loop {
+            let v_11 = env.limit - env.cursor;
+            'lab25: loop {
+                if !env.in_grouping_b(G_vowel6, 246, 252) {
+                    break 'lab25;
+                }
+                env.cursor = env.limit - v_11;
+                break 'golab24;
+            }
+            env.cursor = env.limit - v_11;
+            if env.cursor <= env.limit_backward {
+                return false;
+            }
+            env.previous_char();
+        }
+        break 'lab2;
+    }
+    env.cursor = env.limit - v_1;
+    return true;
+}
+
+fn r_mark_suffix_with_optional_n_consonant(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    'lab0: loop {
+        let v_1 = env.limit - env.cursor;
+        'lab1: loop {
+            if !env.eq_s_b(&"n") {
+                break 'lab1;
+            }
+            let v_2 = env.limit - env.cursor;
+            if !env.in_grouping_b(G_vowel, 97, 305) {
+                break 'lab1;
+            }
+            env.cursor = env.limit - v_2;
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        let v_3 = env.limit - env.cursor;
+        'lab2: loop {
+            let v_4 = env.limit - env.cursor;
+            if !env.eq_s_b(&"n") {
+                break 'lab2;
+            }
+            env.cursor = env.limit - v_4;
+            return false;
+        }
+        env.cursor = env.limit - v_3;
+        let v_5 = env.limit - env.cursor;
+        if env.cursor <= env.limit_backward {
+            return false;
+        }
+        env.previous_char();
+        if !env.in_grouping_b(G_vowel, 97, 305) {
+            return false;
+        }
+        env.cursor = env.limit - v_5;
+        break 'lab0;
+    }
+    return true;
+}
+
+fn r_mark_suffix_with_optional_y_consonant(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    'lab0: loop {
+        let v_1 = env.limit - env.cursor;
+        'lab1: loop {
+            if !env.eq_s_b(&"y") {
+                break 'lab1;
+            }
+            let v_2 = env.limit - env.cursor;
+            if !env.in_grouping_b(G_vowel, 97, 305) {
+                break 'lab1;
+            }
+            env.cursor = env.limit - v_2;
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        let v_3 = env.limit - env.cursor;
+        'lab2: loop {
+            let v_4 = env.limit - env.cursor;
+            if !env.eq_s_b(&"y") {
+                break 'lab2;
+            }
+            env.cursor = env.limit - v_4;
+            return false;
+        }
+        env.cursor = env.limit - v_3;
+        let v_5 = env.limit - env.cursor;
+        if env.cursor <= env.limit_backward {
+            return false;
+        }
+        env.previous_char();
+        if !env.in_grouping_b(G_vowel, 97, 305) {
+            return false;
+        }
+        env.cursor = env.limit - v_5;
+        break 'lab0;
+    }
+    return true;
+}
+
+fn r_mark_possessives(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if env.find_among_b(A_0, context) == 0 {
+        return false;
+    }
+    'lab0: loop {
+        let v_1 = env.limit - env.cursor;
+        'lab1: loop {
+            if !env.in_grouping_b(G_U, 105, 305) {
+                break 'lab1;
+            }
+            let v_2 = env.limit - env.cursor;
+            if !env.out_grouping_b(G_vowel, 97, 305) {
+                break 'lab1;
+            }
+            env.cursor = env.limit - v_2;
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        let v_3 = env.limit - env.cursor;
+        'lab2: loop {
+            let v_4 = env.limit - env.cursor;
+            if !env.in_grouping_b(G_U, 105, 305) {
+                break 'lab2;
+            }
+            env.cursor = env.limit - v_4;
+            return false;
+        }
+        env.cursor = env.limit - v_3;
+        let v_5 = env.limit - env.cursor;
+        if env.cursor <= env.limit_backward {
+            return false;
+        }
+        env.previous_char();
+        if !env.out_grouping_b(G_vowel, 97, 305) {
+            return false;
+        }
+        env.cursor = env.limit - v_5;
+        break 'lab0;
+    }
+    return true;
+}
+
+fn r_mark_sU(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !r_check_vowel_harmony(env, context) {
+        return false;
+    }
+    if !env.in_grouping_b(G_U, 105, 305) {
+        return false;
+    }
+    'lab0: loop {
+        let v_1 = env.limit - env.cursor;
+        'lab1: loop {
+            if !env.eq_s_b(&"s") {
+                break 'lab1;
+            }
+            let v_2 = env.limit - env.cursor;
+            if !env.in_grouping_b(G_vowel, 97, 305) {
+                break 'lab1;
+            }
+            env.cursor = env.limit - v_2;
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        let v_3 = env.limit - env.cursor;
+        'lab2: loop {
+            let v_4 = env.limit - env.cursor;
+            if !env.eq_s_b(&"s") {
+                break 'lab2;
+            }
+            env.cursor = env.limit - v_4;
+            return false;
+        }
+        env.cursor = env.limit - v_3;
+        let v_5 = env.limit - env.cursor;
+        if env.cursor <= env.limit_backward {
+            return false;
+        }
+        env.previous_char();
+        if !env.in_grouping_b(G_vowel, 97, 305) {
+            return false;
+        }
+        env.cursor = env.limit - v_5;
+        break 'lab0;
+    }
+    return true;
+}
+
+fn r_mark_lArI(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if env.find_among_b(A_1, context) == 0 {
+        return false;
+    }
+    return true;
+}
+
+fn r_mark_nUn(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !r_check_vowel_harmony(env, context) {
+        return false;
+    }
+    if env.find_among_b(A_3, context) == 0 {
+        return false;
+    }
+    if !r_mark_suffix_with_optional_n_consonant(env, context) {
+        return false;
+    }
+    return true;
+}
+
+fn r_mark_DA(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !r_check_vowel_harmony(env, context) {
+        return false;
+    }
+    if env.find_among_b(A_6, context) == 0 {
+        return false;
+    }
+    return true;
+}
+
+fn r_mark_ndA(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !r_check_vowel_harmony(env, context) {
+        return false;
+    }
+    if env.find_among_b(A_7, context) == 0 {
+        return false;
+    }
+    return true;
+}
+
+fn r_mark_yUm(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !r_check_vowel_harmony(env, context) {
+        return false;
+    }
+    if env.find_among_b(A_12, context) == 0 {
+        return false;
+    }
+    if !r_mark_suffix_with_optional_y_consonant(env, context) {
+        return false;
+    }
+    return true;
+}
+
+fn r_mark_sUn(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !r_check_vowel_harmony(env, context) {
+        return false;
+    }
+    if env.find_among_b(A_13, context) == 0 {
+        return false;
+    }
+    return true;
+}
+
+fn r_mark_yUz(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !r_check_vowel_harmony(env, context) {
+        return false;
+    }
+    if env.find_among_b(A_14, context) == 0 {
+        return false;
+    }
+    if !r_mark_suffix_with_optional_y_consonant(env, context) {
+        return false;
+    }
+    return true;
+}
+
+fn r_mark_sUnUz(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if env.find_among_b(A_15, context) == 0 {
+        return false;
+    }
+    return true;
+}
+
+fn r_mark_lAr(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !r_check_vowel_harmony(env, context) {
+        return false;
+    }
+    if env.find_among_b(A_16, context) == 0 {
+        return false;
+    }
+    return true;
+}
+
+fn r_mark_DUr(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !r_check_vowel_harmony(env, context) {
+        return false;
+    }
+    if env.find_among_b(A_18, context) == 0 {
+        return false;
+    }
+    return true;
+}
+
+fn r_mark_yDU(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !r_check_vowel_harmony(env, context) {
+        return false;
+    }
+    if env.find_among_b(A_20, context) == 0 {
+        return false;
+    }
+    if !r_mark_suffix_with_optional_y_consonant(env, context) {
+        return false;
+    }
+    return true;
+}
+
+fn r_mark_ysA(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if env.find_among_b(A_21, context) == 0 {
+        return false;
+    }
+    if !r_mark_suffix_with_optional_y_consonant(env, context) {
+        return false;
+    }
+    return true;
+}
+
+fn r_mark_ymUs_(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    if !r_check_vowel_harmony(env, context) {
+        return false;
+    }
+    if env.find_among_b(A_22, context) == 0 {
+        return false;
+    }
+    if !r_mark_suffix_with_optional_y_consonant(env, context) {
+        return false;
+    }
+    return true;
+}
+
+fn r_stem_suffix_chain_before_ki(env: &mut SnowballEnv, context: &mut Context) -> bool {
+    env.ket = env.cursor;
+    if !env.eq_s_b(&"ki") {
+        return false;
+    }
+    'lab0: loop {
+        let v_1 = env.limit - env.cursor;
+        'lab1: loop {
+            if !r_mark_DA(env, context) {
+                break 'lab1;
+            }
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            let v_2 = env.limit - env.cursor;
+            'lab2: loop {
+                env.ket = env.cursor;
+                'lab3: loop {
+                    let v_3 = env.limit - env.cursor;
+                    'lab4: loop {
+                        if !r_mark_lAr(env, context) {
+                            break 'lab4;
+                        }
+                        env.bra = env.cursor;
+                        if !env.slice_del() {
+                            return false;
+                        }
+                        let v_4 = env.limit - env.cursor;
+                        'lab5: loop {
+                            if !r_stem_suffix_chain_before_ki(env, context) {
+                                env.cursor = env.limit - v_4;
+                                break 'lab5;
+                            }
+                            break 'lab5;
+                        }
+                        break 'lab3;
+                    }
+                    env.cursor = env.limit - v_3;
+                    if !r_mark_possessives(env, context) {
+                        env.cursor = env.limit - v_2;
+                        break 'lab2;
+                    }
+                    env.bra = env.cursor;
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    let v_5 = env.limit - env.cursor;
+                    'lab6: loop {
+                        env.ket = env.cursor;
+                        if !r_mark_lAr(env, context) {
+                            env.cursor = env.limit - v_5;
+                            break 'lab6;
+                        }
+                        env.bra = env.cursor;
+                        if !env.slice_del() {
+                            return false;
+                        }
+                        if !r_stem_suffix_chain_before_ki(env, context) {
+                            env.cursor = env.limit - v_5;
+                            break 'lab6;
+                        }
+                        break 'lab6;
+                    }
+                    break 'lab3;
+                }
+                break 'lab2;
+            }
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        'lab7: loop {
+            if !r_mark_nUn(env, context) {
+                break 'lab7;
+            }
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            let v_6 = env.limit - env.cursor;
+            'lab8: loop {
+                env.ket = env.cursor;
+                'lab9: loop {
+                    let v_7 = env.limit - env.cursor;
+                    'lab10: loop {
+                        if !r_mark_lArI(env, context) {
+                            break 'lab10;
+                        }
+                        env.bra = env.cursor;
+                        if !env.slice_del() {
+                            return false;
+                        }
+                        break 'lab9;
+                    }
+                    env.cursor = env.limit - v_7;
+                    'lab11: loop {
+                        env.ket = env.cursor;
+                        'lab12: loop {
+                            let v_8 = env.limit - env.cursor;
+                            'lab13: loop {
+                                if !r_mark_possessives(env, context) {
+                                    break 'lab13;
+                                }
+                                break 'lab12;
+                            }
+                            env.cursor = env.limit - v_8;
+                            if !r_mark_sU(env, context) {
+                                break 'lab11;
+                            }
+                            break 'lab12;
+                        }
+                        env.bra = env.cursor;
+                        if !env.slice_del() {
+                            return false;
+                        }
+                        let v_9 = env.limit - env.cursor;
+                        'lab14: loop {
+                            env.ket = env.cursor;
+                            if !r_mark_lAr(env, context) {
+                                env.cursor = env.limit - v_9;
+                                break 'lab14;
+                            }
+                            env.bra = env.cursor;
+                            if !env.slice_del() {
+                                return false;
+                            }
+                            if !r_stem_suffix_chain_before_ki(env, context) {
+                                env.cursor = env.limit - v_9;
+                                break 'lab14;
+                            }
+                            break 'lab14;
+                        }
+                        break 'lab9;
+                    }
+                    env.cursor = env.limit - v_7;
+                    if !r_stem_suffix_chain_before_ki(env, context) {
+                        env.cursor = env.limit - v_6;
+                        break 'lab8;
+                    }
+                    break 'lab9;
+                }
+                break 'lab8;
+            }
+            break 'lab0;
+        }
+        env.cursor = env.limit - v_1;
+        if !r_mark_ndA(env, context) {
+            return false;
+        }
+        'lab15: loop {
+            let v_10 = env.limit - env.cursor;
+            'lab16: loop {
+                if !r_mark_lArI(env, context) {
+                    break 'lab16;
+                }
+                env.bra = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+                break 'lab15;
+            }
+            env.cursor = env.limit - v_10;
+            'lab17: loop {
+                if !r_mark_sU(env, context) {
+                    break 'lab17;
+                }
+                env.bra = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+                let v_11 = env.limit - env.cursor;
+                'lab18: loop {
+                    env.ket = env.cursor;
+                    if !r_mark_lAr(env, context) {
+                        env.cursor = env.limit - v_11;
+                        break 'lab18;
+                    }
+                    env.bra = env.cursor;
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    if !r_stem_suffix_chain_before_ki(env, context) {
+                        env.cursor = env.limit - v_11;
+                        break 'lab18;
+                    }
+                    break 'lab18;
+                }
+                break 'lab15;
+            }
+            env.cursor = env.limit - v_10;
+            if !r_stem_suffix_chain_before_ki(env, context) {
+                return false;
+            }
+            break 'lab15;
+        }
+        break 'lab0;
+    }
+    return true;
+}
+
+pub fn stem(env: &mut SnowballEnv) -> bool {
+    let mut context = &mut Context {
+        b_continue_stemming_noun_suffixes: false,
+    };
+    let mut among_var;
+    let v_1 = env.cursor;
+    for _ in 0..2 {
+        'golab0: loop {
+            'lab1: loop {
+                if !env.in_grouping(G_vowel, 97, 305) {
+                    break 'lab1;
+                }
+                break 'golab0;
+            }
+            if env.cursor >= env.limit {
+                return false;
+            }
+            env.next_char();
+        }
+    }
+    env.cursor = v_1;
+    env.limit_backward = env.cursor;
+    env.cursor = env.limit;
+    let v_4 = env.limit - env.cursor;
+    'lab2: loop {
+        env.ket = env.cursor;
+        context.b_continue_stemming_noun_suffixes = true;
+        'lab3: loop {
+            let v_5 = env.limit - env.cursor;
+            'lab4: loop {
+                'lab5: loop {
+                    let v_6 = env.limit - env.cursor;
+                    'lab6: loop {
+                        if !r_mark_ymUs_(env, context) {
+                            break 'lab6;
+                        }
+                        break 'lab5;
+                    }
+                    env.cursor = env.limit - v_6;
+                    'lab7: loop {
+                        if !r_mark_yDU(env, context) {
+                            break 'lab7;
+                        }
+                        break 'lab5;
+                    }
+                    env.cursor = env.limit - v_6;
+                    'lab8: loop {
+                        if !r_mark_ysA(env, context) {
+                            break 'lab8;
+                        }
+                        break 'lab5;
+                    }
+                    env.cursor = env.limit - v_6;
+                    if !env.eq_s_b(&"ken") {
+                        break 'lab4;
+                    }
+                    if !r_mark_suffix_with_optional_y_consonant(env, context) {
+                        break 'lab4;
+                    }
+                    break 'lab5;
+                }
+                break 'lab3;
+            }
+            env.cursor = env.limit - v_5;
+            'lab9: loop {
+                if env.find_among_b(A_19, context) == 0 {
+                    break 'lab9;
+                }
+                'lab10: loop {
+                    let v_7 = env.limit - env.cursor;
+                    'lab11: loop {
+                        if !r_mark_sUnUz(env, context) {
+                            break 'lab11;
+                        }
+                        break 'lab10;
+                    }
+                    env.cursor = env.limit - v_7;
+                    'lab12: loop {
+                        if !r_mark_lAr(env, context) {
+                            break 'lab12;
+                        }
+                        break 'lab10;
+                    }
+                    env.cursor = env.limit - v_7;
+                    'lab13: loop {
+                        if !r_mark_yUm(env, context) {
+                            break 'lab13;
+                        }
+                        break 'lab10;
+                    }
+                    env.cursor = env.limit - v_7;
+                    'lab14: loop {
+                        if !r_mark_sUn(env, context) {
+                            break 'lab14;
+                        }
+                        break 'lab10;
+                    }
+                    env.cursor = env.limit - v_7;
+                    'lab15: loop {
+                        if !r_mark_yUz(env, context) {
+                            break 'lab15;
+                        }
+                        break 'lab10;
+                    }
+                    env.cursor = env.limit - v_7;
+                    break 'lab10;
+                }
+                if !r_mark_ymUs_(env, context) {
+                    break 'lab9;
+                }
+                break 'lab3;
+            }
+            env.cursor = env.limit - v_5;
+            'lab16: loop {
+                if !r_mark_lAr(env, context) {
+                    break 'lab16;
+                }
+                env.bra = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+                let v_8 = env.limit - env.cursor;
+                'lab17: loop {
+                    env.ket = env.cursor;
+                    'lab18: loop {
+                        let v_9 = env.limit - env.cursor;
+                        'lab19: loop {
+                            if !r_mark_DUr(env, context) {
+                                break 'lab19;
+                            }
+                            break 'lab18;
+                        }
+                        env.cursor = env.limit - v_9;
+                        'lab20: loop {
+                            if !r_mark_yDU(env, context) {
+                                break 'lab20;
+                            }
+                            break 'lab18;
+                        }
+                        env.cursor = env.limit - v_9;
+                        'lab21: loop {
+                            if !r_mark_ysA(env, context) {
+                                break 'lab21;
+                            }
+                            break 'lab18;
+                        }
+                        env.cursor = env.limit - v_9;
+                        if !r_mark_ymUs_(env, context) {
+                            env.cursor = env.limit - v_8;
+                            break 'lab17;
+                        }
+                        break 'lab18;
+                    }
+                    break 'lab17;
+                }
+                context.b_continue_stemming_noun_suffixes = false;
+                break 'lab3;
+            }
+            env.cursor = env.limit - v_5;
+            'lab22: loop {
+                if !r_check_vowel_harmony(env, context) {
+                    break 'lab22;
+                }
+                if env.find_among_b(A_17, context) == 0 {
+                    break 'lab22;
+                }
+                'lab23: loop {
+                    let v_10 = env.limit - env.cursor;
+                    'lab24: loop {
+                        if !r_mark_yDU(env, context) {
+                            break 'lab24;
+                        }
+                        break 'lab23;
+                    }
+                    env.cursor = env.limit - v_10;
+                    if !r_mark_ysA(env, context) {
+                        break 'lab22;
+                    }
+                    break 'lab23;
+                }
+                break 'lab3;
+            }
+            env.cursor = env.limit - v_5;
+            'lab25: loop {
+                'lab26: loop {
+                    let v_11 = env.limit - env.cursor;
+                    'lab27: loop {
+                        if !r_mark_sUnUz(env, context) {
+                            break 'lab27;
+                        }
+                        break 'lab26;
+                    }
+                    env.cursor = env.limit - v_11;
+                    'lab28: loop {
+                        if !r_mark_yUz(env, context) {
+                            break 'lab28;
+                        }
+                        break 'lab26;
+                    }
+                    env.cursor = env.limit - v_11;
+                    'lab29: loop {
+                        if !r_mark_sUn(env, context) {
+                            break 'lab29;
+                        }
+                        break 'lab26;
+                    }
+                    env.cursor = env.limit - v_11;
+                    if !r_mark_yUm(env, context) {
+                        break 'lab25;
+                    }
+                    break 'lab26;
+                }
+                env.bra = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+                let v_12 = env.limit - env.cursor;
+                'lab30: loop {
+                    env.ket = env.cursor;
+                    if !r_mark_ymUs_(env, context) {
+                        env.cursor = env.limit - v_12;
+                        break 'lab30;
+                    }
+                    break 'lab30;
+                }
+                break 'lab3;
+            }
+            env.cursor = env.limit - v_5;
+            if !r_mark_DUr(env, context) {
+                break 'lab2;
+            }
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            let v_13 = env.limit - env.cursor;
+            'lab31: loop {
+                env.ket = env.cursor;
+                'lab32: loop {
+                    let v_14 = env.limit - env.cursor;
+                    'lab33: loop {
+                        if !r_mark_sUnUz(env, context) {
+                            break 'lab33;
+                        }
+                        break 'lab32;
+                    }
+                    env.cursor = env.limit - v_14;
+                    'lab34: loop {
+                        if !r_mark_lAr(env, context) {
+                            break 'lab34;
+                        }
+                        break 'lab32;
+                    }
+                    env.cursor = env.limit - v_14;
+                    'lab35: loop {
+                        if !r_mark_yUm(env, context) {
+                            break 'lab35;
+                        }
+                        break 'lab32;
+                    }
+                    env.cursor = env.limit - v_14;
+                    'lab36: loop {
+                        if !r_mark_sUn(env, context) {
+                            break 'lab36;
+                        }
+                        break 'lab32;
+                    }
+                    env.cursor = env.limit - v_14;
+                    'lab37: loop {
+                        if !r_mark_yUz(env, context) {
+                            break 'lab37;
+                        }
+                        break 'lab32;
+                    }
+                    env.cursor = env.limit - v_14;
+                    break 'lab32;
+                }
+                if !r_mark_ymUs_(env, context) {
+                    env.cursor = env.limit - v_13;
+                    break 'lab31;
+                }
+                break 'lab31;
+            }
+            break 'lab3;
+        }
+        env.bra = env.cursor;
+        if !env.slice_del() {
+            return false;
+        }
+        break 'lab2;
+    }
+    env.cursor = env.limit - v_4;
+    if !context.b_continue_stemming_noun_suffixes {
+        return false;
+    }
+    let v_15 = env.limit - env.cursor;
+    'lab38: loop {
+        'lab39: loop {
+            let v_16 = env.limit - env.cursor;
+            'lab40: loop {
+                env.ket = env.cursor;
+                if !r_mark_lAr(env, context) {
+                    break 'lab40;
+                }
+                env.bra = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+                let v_17 = env.limit - env.cursor;
+                'lab41: loop {
+                    if !r_stem_suffix_chain_before_ki(env, context) {
+                        env.cursor = env.limit - v_17;
+                        break 'lab41;
+                    }
+                    break 'lab41;
+                }
+                break 'lab39;
+            }
+            env.cursor = env.limit - v_16;
+            'lab42: loop {
+                env.ket = env.cursor;
+                if !r_check_vowel_harmony(env, context) {
+                    break 'lab42;
+                }
+                if env.find_among_b(A_11, context) == 0 {
+                    break 'lab42;
+                }
+                if !r_mark_suffix_with_optional_n_consonant(env, context) {
+                    break 'lab42;
+                }
+                env.bra = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+                let v_18 = env.limit - env.cursor;
+                'lab43: loop {
+                    'lab44: loop {
+                        let v_19 = env.limit - env.cursor;
+                        'lab45: loop {
+                            env.ket = env.cursor;
+                            if !r_mark_lArI(env, context) {
+                                break 'lab45;
+                            }
+                            env.bra = env.cursor;
+                            if !env.slice_del() {
+                                return false;
+                            }
+                            break 'lab44;
+                        }
+                        env.cursor = env.limit - v_19;
+                        'lab46: loop {
+                            env.ket = env.cursor;
+                            'lab47: loop {
+                                let v_20 = env.limit - env.cursor;
+                                'lab48: loop {
+                                    if !r_mark_possessives(env, context) {
+                                        break 'lab48;
+                                    }
+                                    break 'lab47;
+                                }
+                                env.cursor = env.limit - v_20;
+                                if !r_mark_sU(env, context) {
+                                    break 'lab46;
+                                }
+                                break 'lab47;
+                            }
+                            env.bra = env.cursor;
+                            if !env.slice_del() {
+                                return false;
+                            }
+                            let v_21 = env.limit - env.cursor;
+                            'lab49: loop {
+                                env.ket = env.cursor;
+                                if !r_mark_lAr(env, context) {
+                                    env.cursor = env.limit - v_21;
+                                    break 'lab49;
+                                }
+                                env.bra = env.cursor;
+                                if !env.slice_del() {
+                                    return false;
+                                }
+                                if !r_stem_suffix_chain_before_ki(env, context) {
+                                    env.cursor = env.limit - v_21;
+                                    break 'lab49;
+                                }
+                                break 'lab49;
+                            }
+                            break 'lab44;
+                        }
+                        env.cursor = env.limit - v_19;
+                        env.ket = env.cursor;
+                        if !r_mark_lAr(env, context) {
+                            env.cursor = env.limit - v_18;
+                            break 'lab43;
+                        }
+                        env.bra = env.cursor;
+                        if !env.slice_del() {
+                            return false;
+                        }
+                        if !r_stem_suffix_chain_before_ki(env, context) {
+                            env.cursor = env.limit - v_18;
+                            break 'lab43;
+                        }
+                        break 'lab44;
+                    }
+                    break 'lab43;
+                }
+                break 'lab39;
+            }
+            env.cursor = env.limit - v_16;
+            'lab50: loop {
+                env.ket = env.cursor;
+                'lab51: loop {
+                    let v_22 = env.limit - env.cursor;
+                    'lab52: loop {
+                        if !r_mark_ndA(env, context) {
+                            break 'lab52;
+                        }
+                        break 'lab51;
+                    }
+                    env.cursor = env.limit - v_22;
+                    if !r_check_vowel_harmony(env, context) {
+                        break 'lab50;
+                    }
+                    if env.find_among_b(A_5, context) == 0 {
+                        break 'lab50;
+                    }
+                    break 'lab51;
+                }
+                'lab53: loop {
+                    let v_23 = env.limit - env.cursor;
+                    'lab54: loop {
+                        if !r_mark_lArI(env, context) {
+                            break 'lab54;
+                        }
+                        env.bra = env.cursor;
+                        if !env.slice_del() {
+                            return false;
+                        }
+                        break 'lab53;
+                    }
+                    env.cursor = env.limit - v_23;
+                    'lab55: loop {
+                        if !r_mark_sU(env, context) {
+                            break 'lab55;
+                        }
+                        env.bra = env.cursor;
+                        if !env.slice_del() {
+                            return false;
+                        }
+                        let v_24 = env.limit - env.cursor;
+                        'lab56: loop {
+                            env.ket = env.cursor;
+                            if !r_mark_lAr(env, context) {
+                                env.cursor = env.limit - v_24;
+                                break 'lab56;
+                            }
+                            env.bra = env.cursor;
+                            if !env.slice_del() {
+                                return false;
+                            }
+                            if !r_stem_suffix_chain_before_ki(env, context) {
+                                env.cursor = env.limit - v_24;
+                                break 'lab56;
+                            }
+                            break 'lab56;
+                        }
+                        break 'lab53;
+                    }
+                    env.cursor = env.limit - v_23;
+                    if !r_stem_suffix_chain_before_ki(env, context) {
+                        break 'lab50;
+                    }
+                    break 'lab53;
+                }
+                break 'lab39;
+            }
+            env.cursor = env.limit - v_16;
+            'lab57: loop {
+                env.ket = env.cursor;
+                'lab58: loop {
+                    let v_25 = env.limit - env.cursor;
+                    'lab59: loop {
+                        if !r_check_vowel_harmony(env, context) {
+                            break 'lab59;
+                        }
+                        if env.find_among_b(A_9, context) == 0 {
+                            break 'lab59;
+                        }
+                        break 'lab58;
+                    }
+                    env.cursor = env.limit - v_25;
+                    if !r_check_vowel_harmony(env, context) {
+                        break 'lab57;
+                    }
+                    if env.find_among_b(A_2, context) == 0 {
+                        break 'lab57;
+                    }
+                    break 'lab58;
+                }
+                'lab60: loop {
+                    let v_26 = env.limit - env.cursor;
+                    'lab61: loop {
+                        if !r_mark_sU(env, context) {
+                            break 'lab61;
+                        }
+                        env.bra = env.cursor;
+                        if !env.slice_del() {
+                            return false;
+                        }
+                        let v_27 = env.limit - env.cursor;
+                        'lab62: loop {
+                            env.ket = env.cursor;
+                            if !r_mark_lAr(env, context) {
+                                env.cursor = env.limit - v_27;
+                                break 'lab62;
+                            }
+                            env.bra = env.cursor;
+                            if !env.slice_del() {
+                                return false;
+                            }
+                            if !r_stem_suffix_chain_before_ki(env, context) {
+                                env.cursor = env.limit - v_27;
+                                break 'lab62;
+                            }
+                            break 'lab62;
+                        }
+                        break 'lab60;
+                    }
+                    env.cursor = env.limit - v_26;
+                    if !r_mark_lArI(env, context) {
+                        break 'lab57;
+                    }
+                    break 'lab60;
+                }
+                break 'lab39;
+            }
+            env.cursor = env.limit - v_16;
+            'lab63: loop {
+                env.ket = env.cursor;
+                if !r_check_vowel_harmony(env, context) {
+                    break 'lab63;
+                }
+                if env.find_among_b(A_8, context) == 0 {
+                    break 'lab63;
+                }
+                env.bra = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+                let v_28 = env.limit - env.cursor;
+                'lab64: loop {
+                    env.ket = env.cursor;
+                    'lab65: loop {
+                        let v_29 = env.limit - env.cursor;
+                        'lab66: loop {
+                            if !r_mark_possessives(env, context) {
+                                break 'lab66;
+                            }
+                            env.bra = env.cursor;
+                            if !env.slice_del() {
+                                return false;
+                            }
+                            let v_30 = env.limit - env.cursor;
+                            'lab67: loop {
+                                env.ket = env.cursor;
+                                if !r_mark_lAr(env, context) {
+                                    env.cursor = env.limit - v_30;
+                                    break 'lab67;
+                                }
+                                env.bra = env.cursor;
+                                if !env.slice_del() {
+                                    return false;
+                                }
+                                if !r_stem_suffix_chain_before_ki(env, context) {
+                                    env.cursor = env.limit - v_30;
+                                    break 'lab67;
+                                }
+                                break 'lab67;
+                            }
+                            break 'lab65;
+                        }
+                        env.cursor = env.limit - v_29;
+                        'lab68: loop {
+                            if !r_mark_lAr(env, context) {
+                                break 'lab68;
+                            }
+                            env.bra = env.cursor;
+                            if !env.slice_del() {
+                                return false;
+                            }
+                            let v_31 = env.limit - env.cursor;
+                            'lab69: loop {
+                                if !r_stem_suffix_chain_before_ki(env, context) {
+                                    env.cursor = env.limit - v_31;
+                                    break 'lab69;
+                                }
+                                break 'lab69;
+                            }
+                            break 'lab65;
+                        }
+                        env.cursor = env.limit - v_29;
+                        if !r_stem_suffix_chain_before_ki(env, context) {
+                            env.cursor = env.limit - v_28;
+                            break 'lab64;
+                        }
+                        break 'lab65;
+                    }
+                    break 'lab64;
+                }
+                break 'lab39;
+            }
+            env.cursor = env.limit - v_16;
+            'lab70: loop {
+                env.ket = env.cursor;
+                'lab71: loop {
+                    let v_32 = env.limit - env.cursor;
+                    'lab72: loop {
+                        if !r_mark_nUn(env, context) {
+                            break 'lab72;
+                        }
+                        break 'lab71;
+                    }
+                    env.cursor = env.limit - v_32;
+                    if !r_check_vowel_harmony(env, context) {
+                        break 'lab70;
+                    }
+                    if env.find_among_b(A_10, context) == 0 {
+                        break 'lab70;
+                    }
+                    if !r_mark_suffix_with_optional_y_consonant(env, context) {
+                        break 'lab70;
+                    }
+                    break 'lab71;
+                }
+                env.bra = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+                let v_33 = env.limit - env.cursor;
+                'lab73: loop {
+                    'lab74: loop {
+                        let v_34 = env.limit - env.cursor;
+                        'lab75: loop {
+                            env.ket = env.cursor;
+                            if !r_mark_lAr(env, context) {
+                                break 'lab75;
+                            }
+                            env.bra = env.cursor;
+                            if !env.slice_del() {
+                                return false;
+                            }
+                            if !r_stem_suffix_chain_before_ki(env, context) {
+                                break 'lab75;
+                            }
+                            break 'lab74;
+                        }
+                        env.cursor = env.limit - v_34;
+                        'lab76: loop {
+                            env.ket = env.cursor;
+                            'lab77: loop {
+                                let v_35 = env.limit - env.cursor;
+                                'lab78: loop {
+                                    if !r_mark_possessives(env, context) {
+                                        break 'lab78;
+                                    }
+                                    break 'lab77;
+                                }
+                                env.cursor = env.limit - v_35;
+                                if !r_mark_sU(env, context) {
+                                    break 'lab76;
+                                }
+                                break 'lab77;
+                            }
+                            env.bra = env.cursor;
+                            if !env.slice_del() {
+                                return false;
+                            }
+                            let v_36 = env.limit - env.cursor;
+                            'lab79: loop {
+                                env.ket = env.cursor;
+                                if !r_mark_lAr(env, context) {
+                                    env.cursor = env.limit - v_36;
+                                    break 'lab79;
+                                }
+                                env.bra = env.cursor;
+                                if !env.slice_del() {
+                                    return false;
+                                }
+                                if !r_stem_suffix_chain_before_ki(env, context) {
+                                    env.cursor = env.limit - v_36;
+                                    break 'lab79;
+                                }
+                                break 'lab79;
+                            }
+                            break 'lab74;
+                        }
+                        env.cursor = env.limit - v_34;
+                        if !r_stem_suffix_chain_before_ki(env, context) {
+                            env.cursor = env.limit - v_33;
+                            break 'lab73;
+                        }
+                        break 'lab74;
+                    }
+                    break 'lab73;
+                }
+                break 'lab39;
+            }
+            env.cursor = env.limit - v_16;
+            'lab80: loop {
+                env.ket = env.cursor;
+                if !r_mark_lArI(env, context) {
+                    break 'lab80;
+                }
+                env.bra = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+                break 'lab39;
+            }
+            env.cursor = env.limit - v_16;
+            'lab81: loop {
+                if !r_stem_suffix_chain_before_ki(env, context) {
+                    break 'lab81;
+                }
+                break 'lab39;
+            }
+            env.cursor = env.limit - v_16;
+            'lab82: loop {
+                env.ket = env.cursor;
+                'lab83: loop {
+                    let v_37 = env.limit - env.cursor;
+                    'lab84: loop {
+                        if !r_mark_DA(env, context) {
+                            break 'lab84;
+                        }
+                        break 'lab83;
+                    }
+                    env.cursor = env.limit - v_37;
+                    'lab85: loop {
+                        if !r_check_vowel_harmony(env, context) {
+                            break 'lab85;
+                        }
+                        if !env.in_grouping_b(G_U, 105, 305) {
+                            break 'lab85;
+                        }
+                        if !r_mark_suffix_with_optional_y_consonant(env, context) {
+                            break 'lab85;
+                        }
+                        break 'lab83;
+                    }
+                    env.cursor = env.limit - v_37;
+                    if !r_check_vowel_harmony(env, context) {
+                        break 'lab82;
+                    }
+                    if env.find_among_b(A_4, context) == 0 {
+                        break 'lab82;
+                    }
+                    if !r_mark_suffix_with_optional_y_consonant(env, context) {
+                        break 'lab82;
+                    }
+                    break 'lab83;
+                }
+                env.bra = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+                let v_38 = env.limit - env.cursor;
+                'lab86: loop {
+                    env.ket = env.cursor;
+                    'lab87: loop {
+                        let v_39 = env.limit - env.cursor;
+                        'lab88: loop {
+                            if !r_mark_possessives(env, context) {
+                                break 'lab88;
+                            }
+                            env.bra = env.cursor;
+                            if !env.slice_del() {
+                                return false;
+                            }
+                            let v_40 = env.limit - env.cursor;
+                            'lab89: loop {
+                                env.ket = env.cursor;
+                                if !r_mark_lAr(env, context) {
+                                    env.cursor = env.limit - v_40;
+                                    break 'lab89;
+                                }
+                                break 'lab89;
+                            }
+                            break 'lab87;
+                        }
+                        env.cursor = env.limit - v_39;
+                        if !r_mark_lAr(env, context) {
+                            env.cursor = env.limit - v_38;
+                            break 'lab86;
+                        }
+                        break 'lab87;
+                    }
+                    env.bra = env.cursor;
+                    if !env.slice_del() {
+                        return false;
+                    }
+                    env.ket = env.cursor;
+                    if !r_stem_suffix_chain_before_ki(env, context) {
+                        env.cursor = env.limit - v_38;
+                        break 'lab86;
+                    }
+                    break 'lab86;
+                }
+                break 'lab39;
+            }
+            env.cursor = env.limit - v_16;
+            env.ket = env.cursor;
+            'lab90: loop {
+                let v_41 = env.limit - env.cursor;
+                'lab91: loop {
+                    if !r_mark_possessives(env, context) {
+                        break 'lab91;
+                    }
+                    break 'lab90;
+                }
+                env.cursor = env.limit - v_41;
+                if !r_mark_sU(env, context) {
+                    break 'lab38;
+                }
+                break 'lab90;
+            }
+            env.bra = env.cursor;
+            if !env.slice_del() {
+                return false;
+            }
+            let v_42 = env.limit - env.cursor;
+            'lab92: loop {
+                env.ket = env.cursor;
+                if !r_mark_lAr(env, context) {
+                    env.cursor = env.limit - v_42;
+                    break 'lab92;
+                }
+                env.bra = env.cursor;
+                if !env.slice_del() {
+                    return false;
+                }
+                if !r_stem_suffix_chain_before_ki(env, context) {
+                    env.cursor = env.limit - v_42;
+                    break 'lab92;
+                }
+                break 'lab92;
+            }
+            break 'lab39;
+        }
+        break 'lab38;
+    }
+    env.cursor = env.limit - v_15;
+    env.cursor = env.limit_backward;
+    env.limit_backward = env.cursor;
+    env.cursor = env.limit;
+    let v_43 = env.limit - env.cursor;
+    'lab93: loop {
+        if !env.eq_s_b(&"ad") {
+            break 'lab93;
+        }
+        let v_44 = env.limit - env.cursor;
+        'lab94: loop {
+            if !env.eq_s_b(&"soy") {
+                env.cursor = env.limit - v_44;
+                break 'lab94;
+            }
+            break 'lab94;
+        }
+        if env.cursor > env.limit_backward {
+            break 'lab93;
+        }
+        return false;
+    }
+    env.cursor = env.limit - v_43;
+    let v_45 = env.limit - env.cursor;
+    'lab95: loop {
+        let v_46 = env.limit - env.cursor;
+        'lab96: loop {
+            let v_47 = env.limit - env.cursor;
+            'lab97: loop {
+                if !env.eq_s_b(&"d") {
+                    break 'lab97;
+                }
+                break 'lab96;
+            }
+            env.cursor = env.limit - v_47;
+            if !env.eq_s_b(&"g") {
+                break 'lab95;
+            }
+            break 'lab96;
+        }
+        env.cursor = env.limit - v_46;
+        'lab98: loop {
+            let v_48 = env.limit - env.cursor;
+            'lab99: loop {
+                let v_49 = env.limit - env.cursor;
+                'golab100: loop {
+                    let v_50 = env.limit - env.cursor;
+                    'lab101: loop {
+                        if !env.in_grouping_b(G_vowel, 97, 305) {
+                            break 'lab101;
+                        }
+                        env.cursor = env.limit - v_50;
+                        break 'golab100;
+                    }
+                    env.cursor = env.limit - v_50;
+                    if env.cursor <= env.limit_backward {
+                        break 'lab99;
+                    }
+                    env.previous_char();
+                }
+                'lab102: loop {
+                    let v_51 = env.limit - env.cursor;
+                    'lab103: loop {
+                        if !env.eq_s_b(&"a") {
+                            break 'lab103;
+                        }
+                        break 'lab102;
+                    }
+                    env.cursor = env.limit - v_51;
+                    if !env.eq_s_b(&"\u{0131}") {
+                        break 'lab99;
+                    }
+                    break 'lab102;
+                }
+                env.cursor = env.limit - v_49;
+                let c = env.cursor;
+                let (bra, ket) = (env.cursor, env.cursor);
+                env.insert(bra, ket, "\u{0131}");
+                env.cursor = c;
+                break 'lab98;
+            }
+            env.cursor = env.limit - v_48;
+            'lab104: loop {
+                let v_52 = env.limit - env.cursor;
+                'golab105: loop {
+                    let v_53 = env.limit - env.cursor;
+                    'lab106: loop {
+                        if !env.in_grouping_b(G_vowel, 97, 305) {
+                            break 'lab106;
+                        }
+                        env.cursor = env.limit - v_53;
+                        break 'golab105;
+                    }
+                    env.cursor = env.limit - v_53;
+                    if env.cursor <= env.limit_backward {
+                        break 'lab104;
+                    }
+                    env.previous_char();
+                }
+                'lab107: loop {
+                    let v_54 = env.limit - env.cursor;
+                    'lab108: loop {
+                        if !env.eq_s_b(&"e") {
+                            break 'lab108;
+                        }
+                        break 'lab107;
+                    }
+                    env.cursor = env.limit - v_54;
+                    if !env.eq_s_b(&"i") {
+                        break 'lab104;
+                    }
+                    break 'lab107;
+                }
+                env.cursor = env.limit - v_52;
+                let c = env.cursor;
+                let (bra, ket) = (env.cursor, env.cursor);
+                env.insert(bra, ket, "i");
+                env.cursor = c;
+                break 'lab98;
+            }
+            env.cursor = env.limit - v_48;
+            'lab109: loop {
+                let v_55 = env.limit - env.cursor;
+                'golab110: loop {
+                    let v_56 = env.limit - env.cursor;
+                    'lab111: loop {
+                        if !env.in_grouping_b(G_vowel, 97, 305) {
+                            break 'lab111;
+                        }
+                        env.cursor = env.limit - v_56;
+                        break 'golab110;
+                    }
+                    env.cursor = env.limit - v_56;
+                    if env.cursor <= env.limit_backward {
+                        break 'lab109;
+                    }
+                    env.previous_char();
+                }
+                'lab112: loop {
+                    let v_57 = env.limit - env.cursor;
+                    'lab113: loop {
+                        if !env.eq_s_b(&"o") {
+                            break 'lab113;
+                        }
+                        break 'lab112;
+                    }
+                    env.cursor = env.limit - v_57;
+                    if !env.eq_s_b(&"u") {
+                        break 'lab109;
+                    }
+                    break 'lab112;
+                }
+                env.cursor = env.limit - v_55;
+                let c = env.cursor;
+                let (bra, ket) = (env.cursor, env.cursor);
+                env.insert(bra, ket, "u");
+                env.cursor = c;
+                break 'lab98;
+            }
+            env.cursor = env.limit - v_48;
+            let v_58 = env.limit - env.cursor;
+            'golab114: loop {
+                let v_59 = env.limit - env.cursor;
+                'lab115: loop {
+                    if !env.in_grouping_b(G_vowel, 97, 305) {
+                        break 'lab115;
+                    }
+                    env.cursor = env.limit - v_59;
+                    break 'golab114;
+                }
+                env.cursor = env.limit - v_59;
+                if env.cursor <= env.limit_backward {
+                    break 'lab95;
+                }
+                env.previous_char();
+            }
+            'lab116: loop {
+                let v_60 = env.limit - env.cursor;
+                'lab117: loop {
+                    if !env.eq_s_b(&"\u{00F6}") {
+                        break 'lab117;
+                    }
+                    break 'lab116;
+                }
+                env.cursor = env.limit - v_60;
+                if !env.eq_s_b(&"\u{00FC}") {
+                    break 'lab95;
+                }
+                break 'lab116;
+            }
+            env.cursor = env.limit - v_58;
+            let c = env.cursor;
+            let (bra, ket) = (env.cursor, env.cursor);
+            env.insert(bra, ket, "\u{00FC}");
+            env.cursor = c;
+            break 'lab98;
+        }
+        break 'lab95;
+    }
+    env.cursor = env.limit - v_45;
+    let v_61 = env.limit - env.cursor;
+    'lab118: loop {
+        env.ket = env.cursor;
+        among_var = env.find_among_b(A_23, context);
+        if among_var == 0 {
+            break 'lab118;
+        }
+        env.bra = env.cursor;
+        if among_var == 1 {
+            if !env.slice_from("p") {
+                return false;
+            }
+        } else if among_var == 2 {
+            if !env.slice_from("\u{00E7}") {
+                return false;
+            }
+        } else if among_var == 3 {
+            if !env.slice_from("t") {
+                return false;
+            }
+        } else if among_var == 4 {
+            if !env.slice_from("k") {
+                return false;
+            }
+        }
+        break 'lab118;
+    }
+    env.cursor = env.limit - v_61;
+    env.cursor = env.limit_backward;
+    return true;
+}
@@ -0,0 +1,564 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int danish_ISO_8859_1_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+static int r_consonant_pair(struct SN_env * z);
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * danish_ISO_8859_1_create_env(void);
+extern void danish_ISO_8859_1_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[32] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 5, 0, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 5, 3, 1 },
+{ 0, 4, 3, 1 },
+{ 0, 6, 5, 1 },
+{ 0, 3, 3, 1 },
+{ 0, 4, 3, 1 },
+{ 0, 3, 3, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 10, 1 },
+{ 0, 4, 10, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 13, 1 },
+{ 0, 4, 13, 1 },
+{ 0, 1, -1, 2 },
+{ 0, 4, 16, 1 },
+{ 0, 2, 16, 1 },
+{ 0, 5, 18, 1 },
+{ 0, 7, 19, 1 },
+{ 0, 4, 18, 1 },
+{ 0, 5, 18, 1 },
+{ 0, 4, 18, 1 },
+{ 0, 3, 16, 1 },
+{ 0, 6, 24, 1 },
+{ 0, 5, 24, 1 },
+{ 0, 3, 16, 1 },
+{ 0, 3, 16, 1 },
+{ 0, 5, 28, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 30, 1 }
+};
+
+
+static const struct among a_1[4] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 }
+};
+
+
+static const struct among a_2[5] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 3, 0, 1 },
+{ 0, 4, 1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 2 }
+};
+
+static const unsigned char g_c_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const unsigned char g_s_ending_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'g') break;
+                i = 0;
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        i = 1;
+                        break;
+                    case 'g':
+                        i = 2;
+                        break;
+                    case 'k':
+                        i = 3;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+static const unsigned char g_v_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 192, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 64, 64, 0, 128, 0, 0, 0, 0, 0, 0, 0 };
+
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'h':
+                        i = 0;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'e') break;
+                        i = 1;
+                        break;
+                    case 'r':
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 'e':
+                i = 3;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 4;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 5;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'e') break;
+                                i = 6;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 7;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 8;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 9;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 10;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'd':
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'h') break;
+                        i = 11;
+                        break;
+                    case 'r':
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 12;
+                        break;
+                }
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 13;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'd':
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'h') break;
+                        i = 14;
+                        break;
+                    case 'r':
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 15;
+                        break;
+                }
+                break;
+            case 's':
+                i = 16;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'h') break;
+                        i = 17;
+                        break;
+                    case 'e':
+                        i = 18;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 19;
+                                if (n <= 5) break;
+                                if (q[-6] != 'r') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'e') break;
+                                i = 20;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'e':
+                                        i = 21;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 22;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 23;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 24;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'd':
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'h') break;
+                                i = 25;
+                                break;
+                            case 'r':
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 26;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 27;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 28;
+                        if (n <= 3) break;
+                        if (q[-4] != 'r') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'e') break;
+                        i = 29;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 30;
+                if (n <= 2) break;
+                if (q[-3] != 'r') break;
+                if (n <= 3) break;
+                if (q[-4] != 'e') break;
+                i = 31;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_0[i].s_size;
+    return a_0[i].result;
+}
+static const symbol s_0[] = { 's', 't' };
+static const symbol s_1[] = { 'i', 'g' };
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 0;
+                if (n <= 2) break;
+                if (q[-3] != 'l') break;
+                i = 1;
+                if (n <= 3) break;
+                if (q[-4] != 'e') break;
+                i = 2;
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 'l') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                i = 3;
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                if (q[-3] != 0xF8) break;
+                if (n <= 3) break;
+                if (q[-4] != 'l') break;
+                i = 4;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_2[] = { 'l', 0xF8, 's' };
+
+static int r_consonant_pair(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+
+        {   int mlimit2;
+            if (z->c < z->I[1]) return 0;
+            mlimit2 = z->lb; z->lb = z->I[1];
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 100 && z->p[z->c - 1] != 116) || z->p[z->c - 2] >> 5 != 3 || !((2192 >> (z->p[z->c - 2] & 0x1f)) & 1)) { z->lb = mlimit2; return 0; }
+            if (!(find_among_b_1(z))) { z->lb = mlimit2; return 0; }
+            z->bra = z->c;
+            z->lb = mlimit2;
+        }
+        z->c = z->l - m_test1;
+    }
+    if (z->c <= z->lb) return 0;
+    z->c--;
+    z->bra = z->c;
+    {   int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+extern int danish_ISO_8859_1_stem(struct SN_env * z) {
+    int among_var;
+    {   int c1 = z->c;
+        z->I[1] = z->l;
+        {   int c_test2 = z->c;
+z->c = z->c + 3;
+            if (z->c > z->l) goto lab0;
+            z->I[0] = z->c;
+            z->c = c_test2;
+        }
+        if (out_class_scan(z, g_v_class, g_v_scan) < 0) goto lab0;
+        {   
+            int ret = in_class_scan(z, g_v_class, g_v_scan);
+            if (ret < 0) goto lab0;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+        
+        if (!(z->I[1] < z->I[0])) goto lab1;
+        z->I[1] = z->I[0];
+    lab1:
+    lab0:
+        z->c = c1;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m3 = z->l - z->c; (void)m3;
+
+        {   int mlimit4;
+            if (z->c < z->I[1]) goto lab2;
+            mlimit4 = z->lb; z->lb = z->I[1];
+            z->ket = z->c;
+            if (z->c <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1851440 >> (z->p[z->c - 1] & 0x1f)) & 1)) { z->lb = mlimit4; goto lab2; }
+            among_var = find_among_b_0(z);
+            if (!(among_var)) { z->lb = mlimit4; goto lab2; }
+            z->bra = z->c;
+            z->lb = mlimit4;
+        }
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                if (in_class_b(z, g_s_ending_class, 0)) goto lab2;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab2:
+        z->c = z->l - m3;
+    }
+    {   int m5 = z->l - z->c; (void)m5;
+        {   int ret = r_consonant_pair(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - m5;
+    }
+    {   int m6 = z->l - z->c; (void)m6;
+        {   int m7 = z->l - z->c; (void)m7;
+            z->ket = z->c;
+            if (!(eq_s_b(z, 2, s_0))) goto lab4;
+            z->bra = z->c;
+            if (!(eq_s_b(z, 2, s_1))) goto lab4;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        lab4:
+            z->c = z->l - m7;
+        }
+
+        {   int mlimit8;
+            if (z->c < z->I[1]) goto lab3;
+            mlimit8 = z->lb; z->lb = z->I[1];
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1572992 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((528896 >> (z->p[z->c - 2] & 0x1f)) & 1)) { z->lb = mlimit8; goto lab3; }
+            among_var = find_among_b_2(z);
+            if (!(among_var)) { z->lb = mlimit8; goto lab3; }
+            z->bra = z->c;
+            z->lb = mlimit8;
+        }
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int m9 = z->l - z->c; (void)m9;
+                    {   int ret = r_consonant_pair(z);
+                        if (ret < 0) return ret;
+                    }
+                    z->c = z->l - m9;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 3, s_2);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab3:
+        z->c = z->l - m6;
+    }
+    {   int m10 = z->l - z->c; (void)m10;
+
+        {   int mlimit11;
+            if (z->c < z->I[1]) goto lab5;
+            mlimit11 = z->lb; z->lb = z->I[1];
+            z->ket = z->c;
+            if (in_class_b(z, g_c_class, 0)) { z->lb = mlimit11; goto lab5; }
+            z->bra = z->c;
+            z->S[0] = slice_to(z, z->S[0]);
+            if (z->S[0] == 0) return -1;
+            z->lb = mlimit11;
+        }
+        if (!(eq_v_b(z, z->S[0]))) goto lab5;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab5:
+        z->c = z->l - m10;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * danish_ISO_8859_1_create_env(void) { return SN_create_env(1, 2); }
+
+extern void danish_ISO_8859_1_close_env(struct SN_env * z) { SN_close_env(z, 1); }
+
@@ -0,0 +1,1852 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int english_ISO_8859_1_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * english_ISO_8859_1_create_env(void);
+extern void english_ISO_8859_1_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[3] =
+{
+{ 0, 5, -1, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 5, -1, -1 }
+};
+
+
+static const struct among a_1[3] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 3, 0, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_2[6] =
+{
+{ 0, 3, -1, 2 },
+{ 0, 1, -1, 3 },
+{ 0, 3, 1, 2 },
+{ 0, 4, 1, 1 },
+{ 0, 2, 1, -1 },
+{ 0, 2, 1, -1 }
+};
+
+
+static const struct among a_3[13] =
+{
+{ 0, 0, -1, 3 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 1 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 1 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 1 }
+};
+
+
+static const struct among a_4[6] =
+{
+{ 0, 2, -1, 2 },
+{ 0, 3, 0, 1 },
+{ 0, 3, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 5, 3, 1 },
+{ 0, 5, -1, 2 }
+};
+
+
+static const struct among a_5[24] =
+{
+{ 0, 4, -1, 3 },
+{ 0, 4, -1, 2 },
+{ 0, 3, -1, 13 },
+{ 0, 2, -1, 15 },
+{ 0, 3, 3, 12 },
+{ 0, 4, 4, 4 },
+{ 0, 4, 3, 8 },
+{ 0, 5, 3, 9 },
+{ 0, 6, 3, 14 },
+{ 0, 5, 3, 10 },
+{ 0, 5, 3, 5 },
+{ 0, 5, -1, 8 },
+{ 0, 6, -1, 12 },
+{ 0, 5, -1, 11 },
+{ 0, 6, -1, 1 },
+{ 0, 7, 14, 7 },
+{ 0, 5, -1, 8 },
+{ 0, 5, -1, 7 },
+{ 0, 7, 17, 6 },
+{ 0, 4, -1, 6 },
+{ 0, 4, -1, 7 },
+{ 0, 7, -1, 11 },
+{ 0, 7, -1, 9 },
+{ 0, 7, -1, 10 }
+};
+
+
+static const struct among a_6[9] =
+{
+{ 0, 5, -1, 4 },
+{ 0, 5, -1, 6 },
+{ 0, 5, -1, 3 },
+{ 0, 5, -1, 4 },
+{ 0, 4, -1, 4 },
+{ 0, 6, -1, 1 },
+{ 0, 7, 5, 2 },
+{ 0, 3, -1, 5 },
+{ 0, 4, -1, 5 }
+};
+
+
+static const struct among a_7[18] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 15, 1 },
+{ 0, 5, 16, 1 }
+};
+
+
+static const struct among a_8[2] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 2 }
+};
+
+
+static const struct among a_9[8] =
+{
+{ 0, 7, -1, -1 },
+{ 0, 7, -1, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 7, -1, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 7, -1, -1 },
+{ 0, 7, -1, -1 },
+{ 0, 6, -1, -1 }
+};
+
+
+static const struct among a_10[18] =
+{
+{ 0, 5, -1, -1 },
+{ 0, 5, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 5, -1, 3 },
+{ 0, 5, -1, 9 },
+{ 0, 6, -1, 7 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, 6 },
+{ 0, 5, -1, 4 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, 10 },
+{ 0, 6, -1, 11 },
+{ 0, 5, -1, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, -1 },
+{ 0, 5, -1, 5 },
+{ 0, 4, -1, 8 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const unsigned char g_v_WXY_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const unsigned char g_valid_LI_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+
+static int find_among_10(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[1]) {
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[2] != 'd') break;
+                        if (n <= 3) break;
+                        if (q[3] != 'e') break;
+                        if (n <= 4) break;
+                        if (q[4] != 's') break;
+                        i = 0;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[2] != 'l') break;
+                        if (n <= 3) break;
+                        if (q[3] != 'a') break;
+                        if (n <= 4) break;
+                        if (q[4] != 's') break;
+                        i = 1;
+                        break;
+                }
+                break;
+            case 'b':
+                if (n <= 1) break;
+                if (q[1] != 'i') break;
+                if (n <= 2) break;
+                if (q[2] != 'a') break;
+                if (n <= 3) break;
+                if (q[3] != 's') break;
+                i = 2;
+                break;
+            case 'c':
+                if (n <= 1) break;
+                if (q[1] != 'o') break;
+                if (n <= 2) break;
+                if (q[2] != 's') break;
+                if (n <= 3) break;
+                if (q[3] != 'm') break;
+                if (n <= 4) break;
+                if (q[4] != 'o') break;
+                if (n <= 5) break;
+                if (q[5] != 's') break;
+                i = 3;
+                break;
+            case 'd':
+                if (n <= 1) break;
+                if (q[1] != 'y') break;
+                if (n <= 2) break;
+                if (q[2] != 'i') break;
+                if (n <= 3) break;
+                if (q[3] != 'n') break;
+                if (n <= 4) break;
+                if (q[4] != 'g') break;
+                i = 4;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                if (q[1] != 'a') break;
+                if (n <= 2) break;
+                if (q[2] != 'r') break;
+                if (n <= 3) break;
+                if (q[3] != 'l') break;
+                if (n <= 4) break;
+                if (q[4] != 'y') break;
+                i = 5;
+                break;
+            case 'g':
+                if (n <= 1) break;
+                if (q[1] != 'e') break;
+                if (n <= 2) break;
+                if (q[2] != 'n') break;
+                if (n <= 3) break;
+                if (q[3] != 't') break;
+                if (n <= 4) break;
+                if (q[4] != 'l') break;
+                if (n <= 5) break;
+                if (q[5] != 'y') break;
+                i = 6;
+                break;
+            case 'h':
+                if (n <= 1) break;
+                if (q[1] != 'o') break;
+                if (n <= 2) break;
+                if (q[2] != 'w') break;
+                if (n <= 3) break;
+                if (q[3] != 'e') break;
+                i = 7;
+                break;
+            case 'i':
+                if (n <= 1) break;
+                if (q[1] != 'd') break;
+                if (n <= 2) break;
+                if (q[2] != 'l') break;
+                if (n <= 3) break;
+                if (q[3] != 'y') break;
+                i = 8;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[1] != 'y') break;
+                if (n <= 2) break;
+                if (q[2] != 'i') break;
+                if (n <= 3) break;
+                if (q[3] != 'n') break;
+                if (n <= 4) break;
+                if (q[4] != 'g') break;
+                i = 9;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[1] != 'e') break;
+                if (n <= 2) break;
+                if (q[2] != 'w') break;
+                if (n <= 3) break;
+                if (q[3] != 's') break;
+                i = 10;
+                break;
+            case 'o':
+                if (n <= 1) break;
+                if (q[1] != 'n') break;
+                if (n <= 2) break;
+                if (q[2] != 'l') break;
+                if (n <= 3) break;
+                if (q[3] != 'y') break;
+                i = 11;
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[1]) {
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[2] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[3] != 'g') break;
+                        if (n <= 4) break;
+                        if (q[4] != 'l') break;
+                        if (n <= 5) break;
+                        if (q[5] != 'y') break;
+                        i = 12;
+                        break;
+                    case 'k':
+                        if (n <= 2) break;
+                        switch (q[2]) {
+                            case 'i':
+                                if (n <= 3) break;
+                                switch (q[3]) {
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        if (q[4] != 's') break;
+                                        i = 13;
+                                        break;
+                                    case 's':
+                                        i = 14;
+                                        break;
+                                }
+                                break;
+                            case 'y':
+                                i = 15;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[1] != 'y') break;
+                if (n <= 2) break;
+                if (q[2] != 'i') break;
+                if (n <= 3) break;
+                if (q[3] != 'n') break;
+                if (n <= 4) break;
+                if (q[4] != 'g') break;
+                i = 16;
+                break;
+            case 'u':
+                if (n <= 1) break;
+                if (q[1] != 'g') break;
+                if (n <= 2) break;
+                if (q[2] != 'l') break;
+                if (n <= 3) break;
+                if (q[3] != 'y') break;
+                i = 17;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_10[i].s_size;
+    return a_10[i].result;
+}
+static const symbol s_0[] = { 's', 'k', 'i' };
+static const symbol s_1[] = { 's', 'k', 'y' };
+static const symbol s_2[] = { 'd', 'i', 'e' };
+static const symbol s_3[] = { 'l', 'i', 'e' };
+static const symbol s_4[] = { 't', 'i', 'e' };
+static const symbol s_5[] = { 'i', 'd', 'l' };
+static const symbol s_6[] = { 'g', 'e', 'n', 't', 'l' };
+static const symbol s_7[] = { 'u', 'g', 'l', 'i' };
+static const symbol s_8[] = { 'e', 'a', 'r', 'l', 'i' };
+static const symbol s_9[] = { 'o', 'n', 'l', 'i' };
+static const symbol s_10[] = { 's', 'i', 'n', 'g', 'l' };
+static const symbol s_11[] = { 'Y' };
+static const symbol s_12[] = { 'Y' };
+
+static int find_among_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[1] != 'r') break;
+                if (n <= 2) break;
+                if (q[2] != 's') break;
+                if (n <= 3) break;
+                if (q[3] != 'e') break;
+                if (n <= 4) break;
+                if (q[4] != 'n') break;
+                i = 0;
+                break;
+            case 'c':
+                if (n <= 1) break;
+                if (q[1] != 'o') break;
+                if (n <= 2) break;
+                if (q[2] != 'm') break;
+                if (n <= 3) break;
+                if (q[3] != 'm') break;
+                if (n <= 4) break;
+                if (q[4] != 'u') break;
+                if (n <= 5) break;
+                if (q[5] != 'n') break;
+                i = 1;
+                break;
+            case 'g':
+                if (n <= 1) break;
+                if (q[1] != 'e') break;
+                if (n <= 2) break;
+                if (q[2] != 'n') break;
+                if (n <= 3) break;
+                if (q[3] != 'e') break;
+                if (n <= 4) break;
+                if (q[4] != 'r') break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_0[i].s_size;
+    return a_0[i].result;
+}
+static const unsigned char g_v_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 192, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case '\'':
+                i = 0;
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                if (q[-3] != '\'') break;
+                i = 1;
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != '\'') break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 0;
+                break;
+            case 's':
+                i = 1;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                i = 2;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                i = 3;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        i = 4;
+                        break;
+                    case 'u':
+                        i = 5;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_13[] = { 's', 's' };
+static const symbol s_14[] = { 'i' };
+static const symbol s_15[] = { 'i', 'e' };
+
+static int find_among_b_9(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                if (n <= 3) break;
+                if (q[-4] != 'c') break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 'c':
+                        if (n <= 5) break;
+                        if (q[-6] != 'u') break;
+                        if (n <= 6) break;
+                        if (q[-7] != 's') break;
+                        i = 0;
+                        break;
+                    case 'o':
+                        if (n <= 5) break;
+                        if (q[-6] != 'r') break;
+                        if (n <= 6) break;
+                        if (q[-7] != 'p') break;
+                        i = 1;
+                        break;
+                    case 'x':
+                        if (n <= 5) break;
+                        if (q[-6] != 'e') break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'n':
+                        if (n <= 4) break;
+                        if (q[-5] != 'n') break;
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 'a':
+                                if (n <= 6) break;
+                                if (q[-7] != 'c') break;
+                                i = 3;
+                                break;
+                            case 'i':
+                                i = 4;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 4) break;
+                        if (q[-5] != 'r') break;
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 'a':
+                                if (n <= 6) break;
+                                if (q[-7] != 'e') break;
+                                i = 5;
+                                break;
+                            case 'e':
+                                if (n <= 6) break;
+                                if (q[-7] != 'h') break;
+                                i = 6;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 4) break;
+                        if (q[-5] != 'u') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'o') break;
+                        i = 7;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_9[i].s_size;
+    return a_9[i].result;
+}
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 0;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                i = 1;
+                break;
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 2;
+                break;
+            case 'y':
+                if (n <= 1) break;
+                if (q[-2] != 'l') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'd':
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 3;
+                        if (n <= 4) break;
+                        if (q[-5] != 'e') break;
+                        i = 4;
+                        break;
+                    case 'g':
+                        if (n <= 3) break;
+                        if (q[-4] != 'n') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 5;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+static const symbol s_16[] = { 'e', 'e' };
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        i = 0;
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'b':
+                if (n <= 1) break;
+                if (q[-2] != 'b') break;
+                i = 1;
+                break;
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'd') break;
+                i = 2;
+                break;
+            case 'f':
+                if (n <= 1) break;
+                if (q[-2] != 'f') break;
+                i = 3;
+                break;
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'g') break;
+                i = 4;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'b') break;
+                i = 5;
+                break;
+            case 'm':
+                if (n <= 1) break;
+                if (q[-2] != 'm') break;
+                i = 6;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                i = 7;
+                break;
+            case 'p':
+                if (n <= 1) break;
+                if (q[-2] != 'p') break;
+                i = 8;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'r') break;
+                i = 9;
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 10;
+                        break;
+                    case 't':
+                        i = 11;
+                        break;
+                }
+                break;
+            case 'z':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 12;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+static const symbol s_17[] = { 'e' };
+static const symbol s_18[] = { 'e' };
+static const symbol s_19[] = { 'i' };
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 0;
+                                break;
+                            case 'e':
+                                i = 1;
+                                break;
+                        }
+                        break;
+                    case 'g':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        i = 2;
+                        break;
+                    case 'l':
+                        i = 3;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'b':
+                                i = 4;
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 5;
+                                break;
+                            case 'l':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 6;
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'f') break;
+                                        i = 7;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'l') break;
+                                        i = 8;
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 9;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 10;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'l':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 11;
+                                        break;
+                                    case 'i':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'b') break;
+                                        i = 12;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 13;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                if (n <= 3) break;
+                if (q[-4] != 'o') break;
+                if (n <= 4) break;
+                if (q[-5] != 'i') break;
+                if (n <= 5) break;
+                if (q[-6] != 't') break;
+                i = 14;
+                if (n <= 6) break;
+                if (q[-7] != 'a') break;
+                i = 15;
+                break;
+            case 'm':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                if (n <= 3) break;
+                if (q[-4] != 'l') break;
+                if (n <= 4) break;
+                if (q[-5] != 'a') break;
+                i = 16;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                if (n <= 3) break;
+                if (q[-4] != 't') break;
+                if (n <= 4) break;
+                if (q[-5] != 'a') break;
+                i = 17;
+                if (n <= 5) break;
+                if (q[-6] != 'z') break;
+                if (n <= 6) break;
+                if (q[-7] != 'i') break;
+                i = 18;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'z') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 19;
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 20;
+                        break;
+                }
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                if (n <= 3) break;
+                if (q[-4] != 'n') break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 'e':
+                        if (n <= 5) break;
+                        if (q[-6] != 'v') break;
+                        if (n <= 6) break;
+                        if (q[-7] != 'i') break;
+                        i = 21;
+                        break;
+                    case 'l':
+                        if (n <= 5) break;
+                        if (q[-6] != 'u') break;
+                        if (n <= 6) break;
+                        if (q[-7] != 'f') break;
+                        i = 22;
+                        break;
+                    case 's':
+                        if (n <= 5) break;
+                        if (q[-6] != 'u') break;
+                        if (n <= 6) break;
+                        if (q[-7] != 'o') break;
+                        i = 23;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+static const symbol s_20[] = { 't', 'i', 'o', 'n' };
+static const symbol s_21[] = { 'e', 'n', 'c', 'e' };
+static const symbol s_22[] = { 'a', 'n', 'c', 'e' };
+static const symbol s_23[] = { 'a', 'b', 'l', 'e' };
+static const symbol s_24[] = { 'e', 'n', 't' };
+static const symbol s_25[] = { 'i', 'z', 'e' };
+static const symbol s_26[] = { 'a', 't', 'e' };
+static const symbol s_27[] = { 'a', 'l' };
+static const symbol s_28[] = { 'f', 'u', 'l' };
+static const symbol s_29[] = { 'o', 'u', 's' };
+static const symbol s_30[] = { 'i', 'v', 'e' };
+static const symbol s_31[] = { 'b', 'l', 'e' };
+static const symbol s_32[] = { 'o', 'g' };
+static const symbol s_33[] = { 'l', 'e', 's', 's' };
+
+static int find_among_b_6(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'c') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 0;
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 1;
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'l') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                if (q[-2] != 't') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                if (n <= 3) break;
+                if (q[-4] != 'c') break;
+                if (n <= 4) break;
+                if (q[-5] != 'i') break;
+                i = 3;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 4;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 't') break;
+                                i = 5;
+                                if (n <= 6) break;
+                                if (q[-7] != 'a') break;
+                                i = 6;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 'f') break;
+                        i = 7;
+                        break;
+                }
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                if (n <= 3) break;
+                if (q[-4] != 'n') break;
+                i = 8;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_6[i].s_size;
+    return a_6[i].result;
+}
+static const symbol s_34[] = { 't', 'i', 'o', 'n' };
+static const symbol s_35[] = { 'a', 't', 'e' };
+static const symbol s_36[] = { 'a', 'l' };
+static const symbol s_37[] = { 'i', 'c' };
+
+static int find_among_b_7(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'c':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 0;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 1;
+                                break;
+                            case 'e':
+                                i = 2;
+                                break;
+                        }
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'b') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 3;
+                                break;
+                            case 'i':
+                                i = 4;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 5;
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 6;
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 7;
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                if (q[-2] != 't') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 8;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                i = 9;
+                break;
+            case 'm':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 10;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 11;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 12;
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 'u') break;
+                if (n <= 2) break;
+                if (q[-3] != 'o') break;
+                i = 13;
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'a':
+                        i = 14;
+                        break;
+                    case 'e':
+                        i = 15;
+                        if (n <= 3) break;
+                        if (q[-4] != 'm') break;
+                        i = 16;
+                        if (n <= 4) break;
+                        if (q[-5] != 'e') break;
+                        i = 17;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_7[i].s_size;
+    return a_7[i].result;
+}
+
+static int find_among_b_8(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'e':
+                i = 0;
+                break;
+            case 'l':
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_8[i].s_size;
+    return a_8[i].result;
+}
+static const symbol s_38[] = { 'y' };
+
+extern int english_ISO_8859_1_stem(struct SN_env * z) {
+    int among_var;
+    {   int c1 = z->c;
+        z->bra = z->c;
+        if (z->c + 2 >= z->l || z->p[z->c + 2] >> 5 != 3 || !((42750482 >> (z->p[z->c + 2] & 0x1f)) & 1)) goto lab1;
+        among_var = find_among_10(z);
+        if (!(among_var)) goto lab1;
+        z->ket = z->c;
+        if (z->c < z->l) goto lab1;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 3, s_0);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 3, s_1);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 3, s_2);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                {   int ret = slice_from_s(z, 3, s_3);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                {   int ret = slice_from_s(z, 3, s_4);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {   int ret = slice_from_s(z, 3, s_5);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                {   int ret = slice_from_s(z, 5, s_6);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 8:
+                {   int ret = slice_from_s(z, 4, s_7);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 9:
+                {   int ret = slice_from_s(z, 5, s_8);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 10:
+                {   int ret = slice_from_s(z, 4, s_9);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 11:
+                {   int ret = slice_from_s(z, 5, s_10);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+        goto lab0;
+    lab1:
+        z->c = c1;
+        {   int c2 = z->c;
+z->c = z->c + 3;
+            if (z->c > z->l) goto lab3;
+            goto lab2;
+        lab3:
+            z->c = c2;
+        }
+        goto lab0;
+    lab2:
+        z->c = c1;
+        
+        z->I[2] = 0;
+        {   int c3 = z->c;
+            z->bra = z->c;
+            if (z->c == z->l || z->p[z->c] != '\'') goto lab5;
+            z->c++;
+            z->ket = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        lab5:
+            z->c = c3;
+        }
+        {   int c4 = z->c;
+            z->bra = z->c;
+            if (z->c == z->l || z->p[z->c] != 'y') goto lab6;
+            z->c++;
+            z->ket = z->c;
+            {   int ret = slice_from_s(z, 1, s_11);
+                if (ret < 0) return ret;
+            }
+            z->I[2] = 1;
+        lab6:
+            z->c = c4;
+        }
+        {   int c5 = z->c;
+            while(1) {
+                int c6 = z->c;
+                while(1) {
+                    int c7 = z->c;
+                    if (in_class(z, g_v_class, 0)) goto lab9;
+                    z->bra = z->c;
+                    if (z->c == z->l || z->p[z->c] != 'y') goto lab9;
+                    z->c++;
+                    z->ket = z->c;
+                    z->c = c7;
+                    break;
+                lab9:
+                    z->c = c7;
+                    if (z->c >= z->l) goto lab8;
+                    z->c++;
+                }
+                {   int ret = slice_from_s(z, 1, s_12);
+                    if (ret < 0) return ret;
+                }
+                z->I[2] = 1;
+                continue;
+            lab8:
+                z->c = c6;
+                break;
+            }
+            z->c = c5;
+        }
+        
+        z->I[1] = z->l;
+        z->I[0] = z->l;
+        {   int c8 = z->c;
+            {   int c9 = z->c;
+                if (z->c + 4 >= z->l || z->p[z->c + 4] >> 5 != 3 || !((2375680 >> (z->p[z->c + 4] & 0x1f)) & 1)) goto lab13;
+                if (!(find_among_0(z))) goto lab13;
+                goto lab12;
+            lab13:
+                z->c = c9;
+                {   
+                    int ret = out_class_scan(z, g_v_class, g_v_scan);
+                    if (ret < 0) goto lab11;
+                    z->c += ret;
+                }
+                {   
+                    int ret = in_class_scan(z, g_v_class, g_v_scan);
+                    if (ret < 0) goto lab11;
+                    z->c += ret;
+                }
+            }
+        lab12:
+            z->I[1] = z->c;
+            {   
+                int ret = out_class_scan(z, g_v_class, g_v_scan);
+                if (ret < 0) goto lab11;
+                z->c += ret;
+            }
+            {   
+                int ret = in_class_scan(z, g_v_class, g_v_scan);
+                if (ret < 0) goto lab11;
+                z->c += ret;
+            }
+            z->I[0] = z->c;
+        lab11:
+            z->c = c8;
+        }
+        z->lb = z->c; z->c = z->l;
+
+        {   int m10 = z->l - z->c; (void)m10;
+            {   int m11 = z->l - z->c; (void)m11;
+                z->ket = z->c;
+                if (z->c <= z->lb || (z->p[z->c - 1] != 39 && z->p[z->c - 1] != 115)) { z->c = z->l - m11; goto lab15; }
+                if (!(find_among_b_1(z))) { z->c = z->l - m11; goto lab15; }
+                z->bra = z->c;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+            lab15:
+                ;
+            }
+            z->ket = z->c;
+            if (z->c <= z->lb || (z->p[z->c - 1] != 100 && z->p[z->c - 1] != 115)) goto lab14;
+            among_var = find_among_b_2(z);
+            if (!(among_var)) goto lab14;
+            z->bra = z->c;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_from_s(z, 2, s_13);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    {   int m12 = z->l - z->c; (void)m12;
+z->c = z->c - 2;
+                        if (z->c < z->lb) goto lab17;
+                        {   int ret = slice_from_s(z, 1, s_14);
+                            if (ret < 0) return ret;
+                        }
+                        goto lab16;
+                    lab17:
+                        z->c = z->l - m12;
+                        {   int ret = slice_from_s(z, 2, s_15);
+                            if (ret < 0) return ret;
+                        }
+                    }
+                lab16:
+                    break;
+                case 3:
+                    if (z->c <= z->lb) goto lab14;
+                    z->c--;
+                    {   
+                        int ret = out_class_b(z, g_v_class, 1);
+                        if (ret < 0) goto lab14;
+                        z->c -= ret;
+                    }
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+        lab14:
+            z->c = z->l - m10;
+        }
+        {   int m13 = z->l - z->c; (void)m13;
+            z->ket = z->c;
+            if (z->c - 5 <= z->lb || (z->p[z->c - 1] != 100 && z->p[z->c - 1] != 103) || (z->p[z->c - 2] != 101 && z->p[z->c - 2] != 110)) goto lab19;
+            if (!(find_among_b_9(z))) goto lab19;
+            z->bra = z->c;
+            if (z->c > z->lb) goto lab19;
+            goto lab18;
+        lab19:
+            z->c = z->l - m13;
+            {   int m14 = z->l - z->c; (void)m14;
+                z->ket = z->c;
+                if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((33554576 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((20512 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab20;
+                among_var = find_among_b_4(z);
+                if (!(among_var)) goto lab20;
+                z->bra = z->c;
+                switch (among_var) {
+                    case 1:
+                        if (!(z->I[1] <= z->c)) goto lab20;
+                        {   int ret = slice_from_s(z, 2, s_16);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        {   int m_test15 = z->l - z->c;
+                            {   
+                                int ret = out_class_b(z, g_v_class, 1);
+                                if (ret < 0) goto lab20;
+                                z->c -= ret;
+                            }
+                            z->c = z->l - m_test15;
+                        }
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        {   int m_test16 = z->l - z->c;
+                            if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((68514004 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((1401558 >> (z->p[z->c - 2] & 0x1f)) & 1)) among_var = 3; else
+                            among_var = find_among_b_3(z);
+                            if (!(among_var)) goto lab20;
+                            z->c = z->l - m_test16;
+                        }
+                        switch (among_var) {
+                            case 1:
+                                {   int ret;
+                                    {   int saved_c = z->c;
+                                        ret = insert_s(z, z->c, z->c, 1, s_17);
+                                        z->c = saved_c;
+                                    }
+                                    if (ret < 0) return ret;
+                                }
+                                break;
+                            case 2:
+                                z->ket = z->c;
+                                if (z->c <= z->lb) goto lab20;
+                                z->c--;
+                                z->bra = z->c;
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                break;
+                            case 3:
+                                if (z->c != z->I[1]) goto lab20;
+                                {   int m_test17 = z->l - z->c;
+                                    {   int m18 = z->l - z->c; (void)m18;
+                                        if (out_class_b(z, g_v_WXY_class, 0)) goto lab22;
+                                        if (in_class_b(z, g_v_class, 0)) goto lab22;
+                                        if (out_class_b(z, g_v_class, 0)) goto lab22;
+                                        goto lab21;
+                                    lab22:
+                                        z->c = z->l - m18;
+                                        if (out_class_b(z, g_v_class, 0)) goto lab20;
+                                        if (in_class_b(z, g_v_class, 0)) goto lab20;
+                                        if (z->c > z->lb) goto lab20;
+                                    }
+                                lab21:
+                                    z->c = z->l - m_test17;
+                                }
+                                {   int ret;
+                                    {   int saved_c = z->c;
+                                        ret = insert_s(z, z->c, z->c, 1, s_18);
+                                        z->c = saved_c;
+                                    }
+                                    if (ret < 0) return ret;
+                                }
+                                break;
+                        }
+                        break;
+                }
+            lab20:
+                z->c = z->l - m14;
+            }
+            {   int m19 = z->l - z->c; (void)m19;
+                z->ket = z->c;
+                {   int m20 = z->l - z->c; (void)m20;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'y') goto lab25;
+                    z->c--;
+                    goto lab24;
+                lab25:
+                    z->c = z->l - m20;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'Y') goto lab23;
+                    z->c--;
+                }
+            lab24:
+                z->bra = z->c;
+                if (out_class_b(z, g_v_class, 0)) goto lab23;
+                
+                if (z->c > z->lb) goto lab26;
+                goto lab23;
+            lab26:
+                {   int ret = slice_from_s(z, 1, s_19);
+                    if (ret < 0) return ret;
+                }
+            lab23:
+                z->c = z->l - m19;
+            }
+            {   int m21 = z->l - z->c; (void)m21;
+                z->ket = z->c;
+                if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((815616 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((1609898 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab27;
+                among_var = find_among_b_5(z);
+                if (!(among_var)) goto lab27;
+                z->bra = z->c;
+                if (!(z->I[1] <= z->c)) goto lab27;
+                switch (among_var) {
+                    case 1:
+                        {   int ret = slice_from_s(z, 4, s_20);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        {   int ret = slice_from_s(z, 4, s_21);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 3:
+                        {   int ret = slice_from_s(z, 4, s_22);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 4:
+                        {   int ret = slice_from_s(z, 4, s_23);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 5:
+                        {   int ret = slice_from_s(z, 3, s_24);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 6:
+                        {   int ret = slice_from_s(z, 3, s_25);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 7:
+                        {   int ret = slice_from_s(z, 3, s_26);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 8:
+                        {   int ret = slice_from_s(z, 2, s_27);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 9:
+                        {   int ret = slice_from_s(z, 3, s_28);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 10:
+                        {   int ret = slice_from_s(z, 3, s_29);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 11:
+                        {   int ret = slice_from_s(z, 3, s_30);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 12:
+                        {   int ret = slice_from_s(z, 3, s_31);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 13:
+                        if (z->c <= z->lb || z->p[z->c - 1] != 'l') goto lab27;
+                        z->c--;
+                        {   int ret = slice_from_s(z, 2, s_32);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 14:
+                        {   int ret = slice_from_s(z, 4, s_33);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 15:
+                        if (in_class_b(z, g_valid_LI_class, 0)) goto lab27;
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+            lab27:
+                z->c = z->l - m21;
+            }
+            {   int m22 = z->l - z->c; (void)m22;
+                z->ket = z->c;
+                if (z->c - 2 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((528928 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((74973186 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab28;
+                among_var = find_among_b_6(z);
+                if (!(among_var)) goto lab28;
+                z->bra = z->c;
+                if (!(z->I[1] <= z->c)) goto lab28;
+                switch (among_var) {
+                    case 1:
+                        {   int ret = slice_from_s(z, 4, s_34);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        {   int ret = slice_from_s(z, 3, s_35);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 3:
+                        {   int ret = slice_from_s(z, 2, s_36);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 4:
+                        {   int ret = slice_from_s(z, 2, s_37);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 5:
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 6:
+                        if (!(z->I[0] <= z->c)) goto lab28;
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+            lab28:
+                z->c = z->l - m22;
+            }
+            {   int m23 = z->l - z->c; (void)m23;
+                z->ket = z->c;
+                if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1864232 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((75026986 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab29;
+                among_var = find_among_b_7(z);
+                if (!(among_var)) goto lab29;
+                z->bra = z->c;
+                if (!(z->I[0] <= z->c)) goto lab29;
+                switch (among_var) {
+                    case 1:
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        {   int m24 = z->l - z->c; (void)m24;
+                            if (z->c <= z->lb || z->p[z->c - 1] != 's') goto lab31;
+                            z->c--;
+                            goto lab30;
+                        lab31:
+                            z->c = z->l - m24;
+                            if (z->c <= z->lb || z->p[z->c - 1] != 't') goto lab29;
+                            z->c--;
+                        }
+                    lab30:
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+            lab29:
+                z->c = z->l - m23;
+            }
+            {   int m25 = z->l - z->c; (void)m25;
+                z->ket = z->c;
+                if (z->c <= z->lb || (z->p[z->c - 1] != 101 && z->p[z->c - 1] != 108)) goto lab32;
+                among_var = find_among_b_8(z);
+                if (!(among_var)) goto lab32;
+                z->bra = z->c;
+                switch (among_var) {
+                    case 1:
+                        {   int m26 = z->l - z->c; (void)m26;
+                            if (!(z->I[0] <= z->c)) goto lab34;
+                            goto lab33;
+                        lab34:
+                            z->c = z->l - m26;
+                            if (!(z->I[1] <= z->c)) goto lab32;
+                            {   int m27 = z->l - z->c; (void)m27;
+                                {   int m28 = z->l - z->c; (void)m28;
+                                    if (out_class_b(z, g_v_WXY_class, 0)) goto lab37;
+                                    if (in_class_b(z, g_v_class, 0)) goto lab37;
+                                    if (out_class_b(z, g_v_class, 0)) goto lab37;
+                                    goto lab36;
+                                lab37:
+                                    z->c = z->l - m28;
+                                    if (out_class_b(z, g_v_class, 0)) goto lab35;
+                                    if (in_class_b(z, g_v_class, 0)) goto lab35;
+                                    if (z->c > z->lb) goto lab35;
+                                }
+                            lab36:
+                                goto lab32;
+                            lab35:
+                                z->c = z->l - m27;
+                            }
+                        }
+                    lab33:
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        if (!(z->I[0] <= z->c)) goto lab32;
+                        if (z->c <= z->lb || z->p[z->c - 1] != 'l') goto lab32;
+                        z->c--;
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+            lab32:
+                z->c = z->l - m25;
+            }
+        }
+    lab18:
+        z->c = z->lb;
+        {   int c29 = z->c;
+            if (!(z->I[2])) goto lab38;
+            while(1) {
+                int c30 = z->c;
+                while(1) {
+                    int c31 = z->c;
+                    z->bra = z->c;
+                    if (z->c == z->l || z->p[z->c] != 'Y') goto lab40;
+                    z->c++;
+                    z->ket = z->c;
+                    z->c = c31;
+                    break;
+                lab40:
+                    z->c = c31;
+                    if (z->c >= z->l) goto lab39;
+                    z->c++;
+                }
+                {   int ret = slice_from_s(z, 1, s_38);
+                    if (ret < 0) return ret;
+                }
+                continue;
+            lab39:
+                z->c = c30;
+                break;
+            }
+        lab38:
+            z->c = c29;
+        }
+    }
+lab0:
+    return 1;
+}
+
+extern struct SN_env * english_ISO_8859_1_create_env(void) { return SN_create_env(0, 3); }
+
+extern void english_ISO_8859_1_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
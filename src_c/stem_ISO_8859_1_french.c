@@ -0,0 +1,2147 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int french_ISO_8859_1_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * french_ISO_8859_1_create_env(void);
+extern void french_ISO_8859_1_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[3] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_1[7] =
+{
+{ 0, 0, -1, 7 },
+{ 0, 1, 0, 6 },
+{ 0, 2, 1, 4 },
+{ 0, 2, 1, 5 },
+{ 0, 1, 0, 1 },
+{ 0, 1, 0, 2 },
+{ 0, 1, 0, 3 }
+};
+
+
+static const struct among a_2[6] =
+{
+{ 0, 3, -1, 3 },
+{ 0, 3, -1, 3 },
+{ 0, 3, -1, 4 },
+{ 0, 3, -1, 4 },
+{ 0, 3, -1, 2 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_3[3] =
+{
+{ 0, 2, -1, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 3 }
+};
+
+
+static const struct among a_4[43] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 5 },
+{ 0, 5, -1, 3 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 11 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 8 },
+{ 0, 2, -1, 8 },
+{ 0, 5, -1, 4 },
+{ 0, 5, -1, 2 },
+{ 0, 5, -1, 4 },
+{ 0, 5, -1, 2 },
+{ 0, 5, -1, 1 },
+{ 0, 7, -1, 2 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 5 },
+{ 0, 6, -1, 3 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 11 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 8 },
+{ 0, 3, -1, 8 },
+{ 0, 6, -1, 4 },
+{ 0, 6, -1, 2 },
+{ 0, 6, -1, 4 },
+{ 0, 6, -1, 2 },
+{ 0, 5, -1, 15 },
+{ 0, 6, 30, 6 },
+{ 0, 9, 31, 12 },
+{ 0, 4, -1, 7 },
+{ 0, 4, -1, 15 },
+{ 0, 5, 34, 6 },
+{ 0, 8, 35, 12 },
+{ 0, 6, 34, 13 },
+{ 0, 6, 34, 14 },
+{ 0, 3, -1, 10 },
+{ 0, 4, 39, 9 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 7 }
+};
+
+
+static const struct among a_5[35] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 4, 4, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 13, 1 },
+{ 0, 6, 13, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 21, 1 },
+{ 0, 6, 21, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 }
+};
+
+
+static const struct among a_6[38] =
+{
+{ 0, 1, -1, 3 },
+{ 0, 3, 0, 2 },
+{ 0, 4, -1, 3 },
+{ 0, 4, -1, 3 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 3 },
+{ 0, 4, 5, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 3 },
+{ 0, 4, 8, 2 },
+{ 0, 4, -1, 3 },
+{ 0, 5, -1, 3 },
+{ 0, 5, -1, 3 },
+{ 0, 4, -1, 3 },
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 3 },
+{ 0, 5, 15, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 17, 2 },
+{ 0, 7, 17, 3 },
+{ 0, 5, -1, 2 },
+{ 0, 4, -1, 3 },
+{ 0, 2, -1, 2 },
+{ 0, 3, -1, 3 },
+{ 0, 5, 23, 2 },
+{ 0, 3, -1, 3 },
+{ 0, 5, -1, 3 },
+{ 0, 7, 26, 2 },
+{ 0, 5, -1, 2 },
+{ 0, 6, -1, 3 },
+{ 0, 5, -1, 2 },
+{ 0, 2, -1, 3 },
+{ 0, 2, -1, 2 },
+{ 0, 3, 32, 2 },
+{ 0, 5, 33, 2 },
+{ 0, 6, 33, 3 },
+{ 0, 4, 32, 2 },
+{ 0, 1, -1, 2 }
+};
+
+
+static const struct among a_7[6] =
+{
+{ 0, 1, -1, 3 },
+{ 0, 4, 0, 2 },
+{ 0, 4, 0, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 2 }
+};
+
+
+static const struct among a_8[5] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0
+};
+
+static const unsigned char g_keep_with_s_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const symbol s_0[] = { 'U' };
+static const symbol s_1[] = { 'I' };
+static const symbol s_2[] = { 'Y' };
+static const symbol s_3[] = { 'H', 'e' };
+static const symbol s_4[] = { 'H', 'i' };
+static const symbol s_5[] = { 'Y' };
+static const symbol s_6[] = { 'U' };
+
+static int find_among_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 'c':
+                if (n <= 1) break;
+                if (q[1] != 'o') break;
+                if (n <= 2) break;
+                if (q[2] != 'l') break;
+                i = 0;
+                break;
+            case 'p':
+                if (n <= 1) break;
+                if (q[1] != 'a') break;
+                if (n <= 2) break;
+                if (q[2] != 'r') break;
+                i = 1;
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[1] != 'a') break;
+                if (n <= 2) break;
+                if (q[2] != 'p') break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_0[i].s_size;
+    return a_0[i].result;
+}
+static const unsigned char g_v_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 192, 0, 0, 0, 0, 0, 64, 64, 0, 64, 0, 128, 0, 0, 0, 64, 192, 64, 192, 0, 0, 64, 64 };
+
+
+static const unsigned char a_4_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x60, 0x40, 0x1C, 0x1,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0
+};
+
+static const unsigned char a_4_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x68, 0xF2, 0x7C, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0
+};
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'U':
+                        if (n <= 2) break;
+                        if (q[-3] != 'q') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 0;
+                        break;
+                    case 'c':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                i = 1;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 2;
+                                        break;
+                                    case 'e':
+                                        i = 3;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'g') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'o') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'l') break;
+                        i = 4;
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'b') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 5;
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 6;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'u') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 7;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 8;
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 9;
+                        break;
+                }
+                break;
+            case 'f':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 10;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 's':
+                        if (n <= 4) break;
+                        if (q[-5] != 'u') break;
+                        i = 11;
+                        break;
+                    case 't':
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 12;
+                                break;
+                            case 'u':
+                                i = 13;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'u') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                if (n <= 3) break;
+                if (q[-4] != 't') break;
+                if (n <= 4) break;
+                if (q[-5] != 'a') break;
+                i = 14;
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'U':
+                                if (n <= 3) break;
+                                if (q[-4] != 'q') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 15;
+                                break;
+                            case 'c':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'r') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'a') break;
+                                        i = 16;
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 17;
+                                                break;
+                                            case 'e':
+                                                i = 18;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 'g') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'o') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'l') break;
+                                i = 19;
+                                break;
+                            case 'l':
+                                if (n <= 3) break;
+                                if (q[-4] != 'b') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 20;
+                                break;
+                            case 'm':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 21;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'u') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 22;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 23;
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 24;
+                                break;
+                        }
+                        break;
+                    case 'f':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 25;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 's':
+                                if (n <= 5) break;
+                                if (q[-6] != 'u') break;
+                                i = 26;
+                                break;
+                            case 't':
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'a':
+                                        i = 27;
+                                        break;
+                                    case 'u':
+                                        i = 28;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'u') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 't') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'a') break;
+                        i = 29;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'm') break;
+                        i = 30;
+                        if (n <= 5) break;
+                        if (q[-6] != 'e') break;
+                        i = 31;
+                        if (n <= 6) break;
+                        if (q[-7] != 's') break;
+                        if (n <= 7) break;
+                        if (q[-8] != 's') break;
+                        if (n <= 8) break;
+                        if (q[-9] != 'i') break;
+                        i = 32;
+                        break;
+                    case 0xE9:
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 33;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                if (n <= 3) break;
+                if (q[-4] != 'm') break;
+                i = 34;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 'e':
+                        i = 35;
+                        if (n <= 5) break;
+                        if (q[-6] != 's') break;
+                        if (n <= 6) break;
+                        if (q[-7] != 's') break;
+                        if (n <= 7) break;
+                        if (q[-8] != 'i') break;
+                        i = 36;
+                        break;
+                    case 'm':
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 'a':
+                                i = 37;
+                                break;
+                            case 'e':
+                                i = 38;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'x':
+                if (n <= 1) break;
+                if (q[-2] != 'u') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'a':
+                        i = 39;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 40;
+                        break;
+                    case 'e':
+                        i = 41;
+                        break;
+                }
+                break;
+            case 0xE9:
+                if (n <= 1) break;
+                if (q[-2] != 't') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 42;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+static const symbol s_7[] = { 'i', 'c' };
+static const symbol s_8[] = { 'i', 'q', 'U' };
+static const symbol s_9[] = { 'l', 'o', 'g' };
+static const symbol s_10[] = { 'u' };
+static const symbol s_11[] = { 'e', 'n', 't' };
+
+static const unsigned char a_2_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x10, 0x4C, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static const unsigned char a_2_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x2, 0x22, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x0
+};
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'U':
+                if (n <= 1) break;
+                if (q[-2] != 'q') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 0;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'b') break;
+                if (n <= 2) break;
+                if (q[-3] != 'a') break;
+                i = 1;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 0xE8) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'I':
+                        i = 2;
+                        break;
+                    case 'i':
+                        i = 3;
+                        break;
+                }
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 'u') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                i = 4;
+                break;
+            case 'v':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 5;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_12[] = { 'a', 't' };
+static const symbol s_13[] = { 'e', 'u', 'x' };
+static const symbol s_14[] = { 'i' };
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'c':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 0;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                if (q[-3] != 'b') break;
+                if (n <= 3) break;
+                if (q[-4] != 'a') break;
+                i = 1;
+                break;
+            case 'v':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+static const symbol s_15[] = { 'a', 'b', 'l' };
+static const symbol s_16[] = { 'i', 'q', 'U' };
+static const symbol s_17[] = { 'a', 't' };
+static const symbol s_18[] = { 'i', 'c' };
+static const symbol s_19[] = { 'i', 'q', 'U' };
+static const symbol s_20[] = { 'e', 'a', 'u' };
+static const symbol s_21[] = { 'a', 'l' };
+static const symbol s_22[] = { 'e', 'u', 'x' };
+static const symbol s_23[] = { 'a', 'n', 't' };
+static const symbol s_24[] = { 'e', 'n', 't' };
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[-2] != 'r') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 0;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        i = 1;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 2;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 's') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 's') break;
+                        if (n <= 6) break;
+                        if (q[-7] != 'i') break;
+                        i = 3;
+                        break;
+                }
+                break;
+            case 'i':
+                i = 4;
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                if (n <= 2) break;
+                if (q[-3] != 'r') break;
+                if (n <= 3) break;
+                if (q[-4] != 'i') break;
+                i = 5;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 6;
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 7;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                i = 8;
+                                break;
+                            case 'm':
+                                if (n <= 3) break;
+                                if (q[-4] != 0xEE) break;
+                                i = 9;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 10;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 's') break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'i') break;
+                                        i = 11;
+                                        break;
+                                    case 0xEE:
+                                        i = 12;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        i = 13;
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'r':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 14;
+                                break;
+                            case 's':
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 15;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'i':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'r':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'i') break;
+                                        i = 16;
+                                        break;
+                                    case 's':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'i') break;
+                                        i = 17;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 18;
+                                break;
+                            case 's':
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 19;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 's') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 's') break;
+                        if (n <= 6) break;
+                        if (q[-7] != 'i') break;
+                        i = 20;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        i = 21;
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'r':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 22;
+                                break;
+                            case 's':
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 23;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 24;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'I':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'r':
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'i') break;
+                                                i = 25;
+                                                break;
+                                            case 's':
+                                                if (n <= 6) break;
+                                                if (q[-7] != 's') break;
+                                                if (n <= 7) break;
+                                                if (q[-8] != 'i') break;
+                                                i = 26;
+                                                break;
+                                        }
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 27;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'i') break;
+                                        i = 28;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 29;
+                                break;
+                        }
+                        break;
+                    case 0xEE:
+                        i = 30;
+                        break;
+                }
+                break;
+            case 'z':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'i':
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'r':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 31;
+                                break;
+                            case 's':
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 32;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 33;
+                        break;
+                    case 's':
+                        if (n <= 3) break;
+                        if (q[-4] != 's') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 34;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+
+static const unsigned char a_6_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x2, 0x1C, 0x4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0
+};
+
+static int find_among_b_6(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                i = 0;
+                if (n <= 1) break;
+                if (q[-2] != 'r') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                i = 1;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 2;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 3;
+                        break;
+                    case 0xE9:
+                        i = 4;
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                i = 5;
+                if (n <= 2) break;
+                if (q[-3] != 'r') break;
+                if (n <= 3) break;
+                if (q[-4] != 'e') break;
+                i = 6;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 7;
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 8;
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 9;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'm':
+                                if (n <= 3) break;
+                                if (q[-4] != 0xE2) break;
+                                i = 10;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 11;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 12;
+                                        break;
+                                    case 0xE2:
+                                        i = 13;
+                                        break;
+                                }
+                                break;
+                            case 0xE9:
+                                i = 14;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 15;
+                        if (n <= 3) break;
+                        if (q[-4] != 'r') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'e') break;
+                        i = 16;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'i':
+                                i = 17;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'r':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'e') break;
+                                        i = 18;
+                                        break;
+                                    case 's':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'a') break;
+                                        i = 19;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 20;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 21;
+                        break;
+                    case 0xE9:
+                        i = 22;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 23;
+                        if (n <= 3) break;
+                        if (q[-4] != 'r') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'e') break;
+                        i = 24;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 25;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'I':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 26;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'e') break;
+                                        i = 27;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xE8) break;
+                                        i = 28;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'a') break;
+                                        i = 29;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 30;
+                                break;
+                        }
+                        break;
+                    case 0xE2:
+                        i = 31;
+                        break;
+                }
+                break;
+            case 'z':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 32;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'i':
+                        i = 33;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'r':
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 34;
+                                break;
+                            case 's':
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                i = 35;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 36;
+                        break;
+                }
+                break;
+            case 0xE9:
+                i = 37;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_6[i].s_size;
+    return a_6[i].result;
+}
+static const symbol s_25[] = { 'i' };
+static const symbol s_26[] = { 'c' };
+static const symbol s_27[] = { 'H', 'i' };
+
+static int find_among_b_7(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'e':
+                i = 0;
+                if (n <= 1) break;
+                if (q[-2] != 'r') break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE8) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'I':
+                        i = 1;
+                        break;
+                    case 'i':
+                        i = 2;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 3;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'I':
+                        i = 4;
+                        break;
+                    case 'i':
+                        i = 5;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_7[i].s_size;
+    return a_7[i].result;
+}
+static const symbol s_28[] = { 'i' };
+
+static int find_among_b_8(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'l') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'e':
+                        i = 0;
+                        break;
+                    case 'i':
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 1;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'e':
+                        i = 2;
+                        break;
+                    case 'o':
+                        i = 3;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 't') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                i = 4;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_8[i].s_size;
+    return a_8[i].result;
+}
+static const symbol s_29[] = { 'e' };
+
+static int find_among_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        i = 0;
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 'H':
+                i = 1;
+                if (n <= 1) break;
+                switch (q[1]) {
+                    case 'e':
+                        i = 2;
+                        break;
+                    case 'i':
+                        i = 3;
+                        break;
+                }
+                break;
+            case 'I':
+                i = 4;
+                break;
+            case 'U':
+                i = 5;
+                break;
+            case 'Y':
+                i = 6;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_1[i].s_size;
+    return a_1[i].result;
+}
+static const symbol s_30[] = { 'i' };
+static const symbol s_31[] = { 'u' };
+static const symbol s_32[] = { 'y' };
+static const symbol s_33[] = { 0xEB };
+static const symbol s_34[] = { 0xEF };
+
+extern int french_ISO_8859_1_stem(struct SN_env * z) {
+    int among_var;
+    {   int c1 = z->c;
+        while(1) {
+            int c2 = z->c;
+            while(1) {
+                int c3 = z->c;
+                {   int c4 = z->c;
+                    if (in_class(z, g_v_class, 0)) goto lab4;
+                    z->bra = z->c;
+                    {   int c5 = z->c;
+                        if (z->c == z->l || z->p[z->c] != 'u') goto lab6;
+                        z->c++;
+                        z->ket = z->c;
+                        if (in_class(z, g_v_class, 0)) goto lab6;
+                        {   int ret = slice_from_s(z, 1, s_0);
+                            if (ret < 0) return ret;
+                        }
+                        goto lab5;
+                    lab6:
+                        z->c = c5;
+                        if (z->c == z->l || z->p[z->c] != 'i') goto lab7;
+                        z->c++;
+                        z->ket = z->c;
+                        if (in_class(z, g_v_class, 0)) goto lab7;
+                        {   int ret = slice_from_s(z, 1, s_1);
+                            if (ret < 0) return ret;
+                        }
+                        goto lab5;
+                    lab7:
+                        z->c = c5;
+                        if (z->c == z->l || z->p[z->c] != 'y') goto lab4;
+                        z->c++;
+                        z->ket = z->c;
+                        {   int ret = slice_from_s(z, 1, s_2);
+                            if (ret < 0) return ret;
+                        }
+                    }
+                lab5:
+                    goto lab3;
+                lab4:
+                    z->c = c4;
+                    z->bra = z->c;
+                    if (z->c == z->l || z->p[z->c] != 0xEB) goto lab8;
+                    z->c++;
+                    z->ket = z->c;
+                    {   int ret = slice_from_s(z, 2, s_3);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab3;
+                lab8:
+                    z->c = c4;
+                    z->bra = z->c;
+                    if (z->c == z->l || z->p[z->c] != 0xEF) goto lab9;
+                    z->c++;
+                    z->ket = z->c;
+                    {   int ret = slice_from_s(z, 2, s_4);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab3;
+                lab9:
+                    z->c = c4;
+                    z->bra = z->c;
+                    if (z->c == z->l || z->p[z->c] != 'y') goto lab10;
+                    z->c++;
+                    z->ket = z->c;
+                    if (in_class(z, g_v_class, 0)) goto lab10;
+                    {   int ret = slice_from_s(z, 1, s_5);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab3;
+                lab10:
+                    z->c = c4;
+                    if (z->c == z->l || z->p[z->c] != 'q') goto lab2;
+                    z->c++;
+                    z->bra = z->c;
+                    if (z->c == z->l || z->p[z->c] != 'u') goto lab2;
+                    z->c++;
+                    z->ket = z->c;
+                    {   int ret = slice_from_s(z, 1, s_6);
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab3:
+                z->c = c3;
+                break;
+            lab2:
+                z->c = c3;
+                if (z->c >= z->l) goto lab1;
+                z->c++;
+            }
+            continue;
+        lab1:
+            z->c = c2;
+            break;
+        }
+        z->c = c1;
+    }
+    
+    z->I[2] = z->l;
+    z->I[1] = z->l;
+    z->I[0] = z->l;
+    {   int c6 = z->c;
+        {   int c7 = z->c;
+            if (in_class(z, g_v_class, 0)) goto lab14;
+            if (in_class(z, g_v_class, 0)) goto lab14;
+            if (z->c >= z->l) goto lab14;
+            z->c++;
+            goto lab13;
+        lab14:
+            z->c = c7;
+            if (z->c + 2 >= z->l || z->p[z->c + 2] >> 5 != 3 || !((331776 >> (z->p[z->c + 2] & 0x1f)) & 1)) goto lab15;
+            if (!(find_among_0(z))) goto lab15;
+            goto lab13;
+        lab15:
+            z->c = c7;
+            if (z->c >= z->l) goto lab12;
+            z->c++;
+            {   
+                int ret = out_class_scan(z, g_v_class, g_v_scan);
+                if (ret < 0) goto lab12;
+                z->c += ret;
+            }
+        }
+    lab13:
+        z->I[2] = z->c;
+    lab12:
+        z->c = c6;
+    }
+    {   int c8 = z->c;
+        {   
+            int ret = out_class_scan(z, g_v_class, g_v_scan);
+            if (ret < 0) goto lab16;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan(z, g_v_class, g_v_scan);
+            if (ret < 0) goto lab16;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+        {   
+            int ret = out_class_scan(z, g_v_class, g_v_scan);
+            if (ret < 0) goto lab16;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan(z, g_v_class, g_v_scan);
+            if (ret < 0) goto lab16;
+            z->c += ret;
+        }
+        z->I[0] = z->c;
+    lab16:
+        z->c = c8;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m9 = z->l - z->c; (void)m9;
+        {   int m10 = z->l - z->c; (void)m10;
+            {   int m11 = z->l - z->c; (void)m11;
+                {   int m12 = z->l - z->c; (void)m12;
+                    z->ket = z->c;
+                    if (z->c - 1 <= z->lb || !((a_4_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || !((a_4_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) goto lab21;
+                    among_var = find_among_b_4(z);
+                    if (!(among_var)) goto lab21;
+                    z->bra = z->c;
+                    switch (among_var) {
+                        case 1:
+                            if (!(z->I[0] <= z->c)) goto lab21;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 2:
+                            if (!(z->I[0] <= z->c)) goto lab21;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            {   int m13 = z->l - z->c; (void)m13;
+                                z->ket = z->c;
+                                if (!(eq_s_b(z, 2, s_7))) { z->c = z->l - m13; goto lab22; }
+                                z->bra = z->c;
+                                {   int m14 = z->l - z->c; (void)m14;
+                                    if (!(z->I[0] <= z->c)) goto lab24;
+                                    {   int ret = slice_del(z);
+                                        if (ret < 0) return ret;
+                                    }
+                                    goto lab23;
+                                lab24:
+                                    z->c = z->l - m14;
+                                    {   int ret = slice_from_s(z, 3, s_8);
+                                        if (ret < 0) return ret;
+                                    }
+                                }
+                            lab23:
+                            lab22:
+                                ;
+                            }
+                            break;
+                        case 3:
+                            if (!(z->I[0] <= z->c)) goto lab21;
+                            {   int ret = slice_from_s(z, 3, s_9);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 4:
+                            if (!(z->I[0] <= z->c)) goto lab21;
+                            {   int ret = slice_from_s(z, 1, s_10);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 5:
+                            if (!(z->I[0] <= z->c)) goto lab21;
+                            {   int ret = slice_from_s(z, 3, s_11);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 6:
+                            if (!(z->I[2] <= z->c)) goto lab21;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            {   int m15 = z->l - z->c; (void)m15;
+                                z->ket = z->c;
+                                if (z->c - 1 <= z->lb || !((a_2_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || !((a_2_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) { z->c = z->l - m15; goto lab25; }
+                                among_var = find_among_b_2(z);
+                                if (!(among_var)) { z->c = z->l - m15; goto lab25; }
+                                z->bra = z->c;
+                                switch (among_var) {
+                                    case 1:
+                                        if (!(z->I[0] <= z->c)) { z->c = z->l - m15; goto lab25; }
+                                        {   int ret = slice_del(z);
+                                            if (ret < 0) return ret;
+                                        }
+                                        z->ket = z->c;
+                                        if (!(eq_s_b(z, 2, s_12))) { z->c = z->l - m15; goto lab25; }
+                                        z->bra = z->c;
+                                        if (!(z->I[0] <= z->c)) { z->c = z->l - m15; goto lab25; }
+                                        {   int ret = slice_del(z);
+                                            if (ret < 0) return ret;
+                                        }
+                                        break;
+                                    case 2:
+                                        {   int m16 = z->l - z->c; (void)m16;
+                                            if (!(z->I[0] <= z->c)) goto lab27;
+                                            {   int ret = slice_del(z);
+                                                if (ret < 0) return ret;
+                                            }
+                                            goto lab26;
+                                        lab27:
+                                            z->c = z->l - m16;
+                                            if (!(z->I[1] <= z->c)) { z->c = z->l - m15; goto lab25; }
+                                            {   int ret = slice_from_s(z, 3, s_13);
+                                                if (ret < 0) return ret;
+                                            }
+                                        }
+                                    lab26:
+                                        break;
+                                    case 3:
+                                        if (!(z->I[0] <= z->c)) { z->c = z->l - m15; goto lab25; }
+                                        {   int ret = slice_del(z);
+                                            if (ret < 0) return ret;
+                                        }
+                                        break;
+                                    case 4:
+                                        if (!(z->I[2] <= z->c)) { z->c = z->l - m15; goto lab25; }
+                                        {   int ret = slice_from_s(z, 1, s_14);
+                                            if (ret < 0) return ret;
+                                        }
+                                        break;
+                                }
+                            lab25:
+                                ;
+                            }
+                            break;
+                        case 7:
+                            if (!(z->I[0] <= z->c)) goto lab21;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            {   int m17 = z->l - z->c; (void)m17;
+                                z->ket = z->c;
+                                if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((4198408 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] != 105) { z->c = z->l - m17; goto lab28; }
+                                among_var = find_among_b_3(z);
+                                if (!(among_var)) { z->c = z->l - m17; goto lab28; }
+                                z->bra = z->c;
+                                switch (among_var) {
+                                    case 1:
+                                        {   int m18 = z->l - z->c; (void)m18;
+                                            if (!(z->I[0] <= z->c)) goto lab30;
+                                            {   int ret = slice_del(z);
+                                                if (ret < 0) return ret;
+                                            }
+                                            goto lab29;
+                                        lab30:
+                                            z->c = z->l - m18;
+                                            {   int ret = slice_from_s(z, 3, s_15);
+                                                if (ret < 0) return ret;
+                                            }
+                                        }
+                                    lab29:
+                                        break;
+                                    case 2:
+                                        {   int m19 = z->l - z->c; (void)m19;
+                                            if (!(z->I[0] <= z->c)) goto lab32;
+                                            {   int ret = slice_del(z);
+                                                if (ret < 0) return ret;
+                                            }
+                                            goto lab31;
+                                        lab32:
+                                            z->c = z->l - m19;
+                                            {   int ret = slice_from_s(z, 3, s_16);
+                                                if (ret < 0) return ret;
+                                            }
+                                        }
+                                    lab31:
+                                        break;
+                                    case 3:
+                                        if (!(z->I[0] <= z->c)) { z->c = z->l - m17; goto lab28; }
+                                        {   int ret = slice_del(z);
+                                            if (ret < 0) return ret;
+                                        }
+                                        break;
+                                }
+                            lab28:
+                                ;
+                            }
+                            break;
+                        case 8:
+                            if (!(z->I[0] <= z->c)) goto lab21;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            {   int m20 = z->l - z->c; (void)m20;
+                                z->ket = z->c;
+                                if (!(eq_s_b(z, 2, s_17))) { z->c = z->l - m20; goto lab33; }
+                                z->bra = z->c;
+                                if (!(z->I[0] <= z->c)) { z->c = z->l - m20; goto lab33; }
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                z->ket = z->c;
+                                if (!(eq_s_b(z, 2, s_18))) { z->c = z->l - m20; goto lab33; }
+                                z->bra = z->c;
+                                {   int m21 = z->l - z->c; (void)m21;
+                                    if (!(z->I[0] <= z->c)) goto lab35;
+                                    {   int ret = slice_del(z);
+                                        if (ret < 0) return ret;
+                                    }
+                                    goto lab34;
+                                lab35:
+                                    z->c = z->l - m21;
+                                    {   int ret = slice_from_s(z, 3, s_19);
+                                        if (ret < 0) return ret;
+                                    }
+                                }
+                            lab34:
+                            lab33:
+                                ;
+                            }
+                            break;
+                        case 9:
+                            {   int ret = slice_from_s(z, 3, s_20);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 10:
+                            if (!(z->I[1] <= z->c)) goto lab21;
+                            {   int ret = slice_from_s(z, 2, s_21);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 11:
+                            {   int m22 = z->l - z->c; (void)m22;
+                                if (!(z->I[0] <= z->c)) goto lab37;
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                goto lab36;
+                            lab37:
+                                z->c = z->l - m22;
+                                if (!(z->I[1] <= z->c)) goto lab21;
+                                {   int ret = slice_from_s(z, 3, s_22);
+                                    if (ret < 0) return ret;
+                                }
+                            }
+                        lab36:
+                            break;
+                        case 12:
+                            if (!(z->I[1] <= z->c)) goto lab21;
+                            if (out_class_b(z, g_v_class, 0)) goto lab21;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 13:
+                            if (!(z->I[2] <= z->c)) goto lab21;
+                            {   int ret = slice_from_s(z, 3, s_23);
+                                if (ret < 0) return ret;
+                            }
+                            goto lab21;
+                            break;
+                        case 14:
+                            if (!(z->I[2] <= z->c)) goto lab21;
+                            {   int ret = slice_from_s(z, 3, s_24);
+                                if (ret < 0) return ret;
+                            }
+                            goto lab21;
+                            break;
+                        case 15:
+                            {   int m_test23 = z->l - z->c;
+                                if (in_class_b(z, g_v_class, 0)) goto lab21;
+                                if (!(z->I[2] <= z->c)) goto lab21;
+                                z->c = z->l - m_test23;
+                            }
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            goto lab21;
+                            break;
+                    }
+                    goto lab20;
+                lab21:
+                    z->c = z->l - m12;
+
+                    {   int mlimit24;
+                        if (z->c < z->I[2]) goto lab38;
+                        mlimit24 = z->lb; z->lb = z->I[2];
+                        z->ket = z->c;
+                        if (z->c <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((68944418 >> (z->p[z->c - 1] & 0x1f)) & 1)) { z->lb = mlimit24; goto lab38; }
+                        if (!(find_among_b_5(z))) { z->lb = mlimit24; goto lab38; }
+                        z->bra = z->c;
+                        {   int m25 = z->l - z->c; (void)m25;
+                            if (z->c <= z->lb || z->p[z->c - 1] != 'H') goto lab39;
+                            z->c--;
+                            { z->lb = mlimit24; goto lab38; }
+                        lab39:
+                            z->c = z->l - m25;
+                        }
+                        if (out_class_b(z, g_v_class, 0)) { z->lb = mlimit24; goto lab38; }
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        z->lb = mlimit24;
+                    }
+                    goto lab20;
+                lab38:
+                    z->c = z->l - m12;
+
+                    {   int mlimit26;
+                        if (z->c < z->I[2]) goto lab19;
+                        mlimit26 = z->lb; z->lb = z->I[2];
+                        z->ket = z->c;
+                        if (z->c <= z->lb || !((a_6_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1)) { z->lb = mlimit26; goto lab19; }
+                        among_var = find_among_b_6(z);
+                        if (!(among_var)) { z->lb = mlimit26; goto lab19; }
+                        z->bra = z->c;
+                        switch (among_var) {
+                            case 1:
+                                if (!(z->I[0] <= z->c)) { z->lb = mlimit26; goto lab19; }
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                break;
+                            case 2:
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                break;
+                            case 3:
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                {   int m27 = z->l - z->c; (void)m27;
+                                    z->ket = z->c;
+                                    if (z->c <= z->lb || z->p[z->c - 1] != 'e') { z->c = z->l - m27; goto lab40; }
+                                    z->c--;
+                                    z->bra = z->c;
+                                    {   int ret = slice_del(z);
+                                        if (ret < 0) return ret;
+                                    }
+                                lab40:
+                                    ;
+                                }
+                                break;
+                        }
+                        z->lb = mlimit26;
+                    }
+                }
+            lab20:
+                z->c = z->l - m11;
+                {   int m28 = z->l - z->c; (void)m28;
+                    z->ket = z->c;
+                    {   int m29 = z->l - z->c; (void)m29;
+                        if (z->c <= z->lb || z->p[z->c - 1] != 'Y') goto lab43;
+                        z->c--;
+                        z->bra = z->c;
+                        {   int ret = slice_from_s(z, 1, s_25);
+                            if (ret < 0) return ret;
+                        }
+                        goto lab42;
+                    lab43:
+                        z->c = z->l - m29;
+                        if (z->c <= z->lb || z->p[z->c - 1] != 0xE7) { z->c = z->l - m28; goto lab41; }
+                        z->c--;
+                        z->bra = z->c;
+                        {   int ret = slice_from_s(z, 1, s_26);
+                            if (ret < 0) return ret;
+                        }
+                    }
+                lab42:
+                lab41:
+                    ;
+                }
+            }
+            goto lab18;
+        lab19:
+            z->c = z->l - m10;
+            {   int m30 = z->l - z->c; (void)m30;
+                z->ket = z->c;
+                if (z->c <= z->lb || z->p[z->c - 1] != 's') { z->c = z->l - m30; goto lab44; }
+                z->c--;
+                z->bra = z->c;
+                {   int m_test31 = z->l - z->c;
+                    {   int m32 = z->l - z->c; (void)m32;
+                        if (!(eq_s_b(z, 2, s_27))) goto lab46;
+                        goto lab45;
+                    lab46:
+                        z->c = z->l - m32;
+                        if (out_class_b(z, g_keep_with_s_class, 0)) { z->c = z->l - m30; goto lab44; }
+                    }
+                lab45:
+                    z->c = z->l - m_test31;
+                }
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+            lab44:
+                ;
+            }
+
+            {   int mlimit33;
+                if (z->c < z->I[2]) goto lab17;
+                mlimit33 = z->lb; z->lb = z->I[2];
+                z->ket = z->c;
+                if (z->c <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((278560 >> (z->p[z->c - 1] & 0x1f)) & 1)) { z->lb = mlimit33; goto lab17; }
+                among_var = find_among_b_7(z);
+                if (!(among_var)) { z->lb = mlimit33; goto lab17; }
+                z->bra = z->c;
+                switch (among_var) {
+                    case 1:
+                        if (!(z->I[0] <= z->c)) { z->lb = mlimit33; goto lab17; }
+                        {   int m34 = z->l - z->c; (void)m34;
+                            if (z->c <= z->lb || z->p[z->c - 1] != 's') goto lab48;
+                            z->c--;
+                            goto lab47;
+                        lab48:
+                            z->c = z->l - m34;
+                            if (z->c <= z->lb || z->p[z->c - 1] != 't') { z->lb = mlimit33; goto lab17; }
+                            z->c--;
+                        }
+                    lab47:
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        {   int ret = slice_from_s(z, 1, s_28);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 3:
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+                z->lb = mlimit33;
+            }
+        }
+    lab18:
+    lab17:
+        z->c = z->l - m9;
+    }
+    {   int m35 = z->l - z->c; (void)m35;
+        {   int m_test36 = z->l - z->c;
+            if (z->c - 2 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1069056 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((1069056 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab49;
+            if (!(find_among_b_8(z))) goto lab49;
+            z->c = z->l - m_test36;
+        }
+        z->ket = z->c;
+        if (z->c <= z->lb) goto lab49;
+        z->c--;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab49:
+        z->c = z->l - m35;
+    }
+    {   int m37 = z->l - z->c; (void)m37;
+        {   int i = 1;
+            while(1) {
+                if (out_class_b(z, g_v_class, 0)) goto lab51;
+                i--;
+                continue;
+            lab51:
+                break;
+            }
+            if (i > 0) goto lab50;
+        }
+        z->ket = z->c;
+        {   int m38 = z->l - z->c; (void)m38;
+            if (z->c <= z->lb || z->p[z->c - 1] != 0xE9) goto lab53;
+            z->c--;
+            goto lab52;
+        lab53:
+            z->c = z->l - m38;
+            if (z->c <= z->lb || z->p[z->c - 1] != 0xE8) goto lab50;
+            z->c--;
+        }
+    lab52:
+        z->bra = z->c;
+        {   int ret = slice_from_s(z, 1, s_29);
+            if (ret < 0) return ret;
+        }
+    lab50:
+        z->c = z->l - m37;
+    }
+    z->c = z->lb;
+    {   int c39 = z->c;
+        while(1) {
+            int c40 = z->c;
+            z->bra = z->c;
+            if (z->c >= z->l || z->p[z->c + 0] >> 5 != 2 || !((35652352 >> (z->p[z->c + 0] & 0x1f)) & 1)) among_var = 7; else
+            among_var = find_among_1(z);
+            if (!(among_var)) goto lab55;
+            z->ket = z->c;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_from_s(z, 1, s_30);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    {   int ret = slice_from_s(z, 1, s_31);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 3:
+                    {   int ret = slice_from_s(z, 1, s_32);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 4:
+                    {   int ret = slice_from_s(z, 1, s_33);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 5:
+                    {   int ret = slice_from_s(z, 1, s_34);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 6:
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 7:
+                    if (z->c >= z->l) goto lab55;
+                    z->c++;
+                    break;
+            }
+            continue;
+        lab55:
+            z->c = c40;
+            break;
+        }
+        z->c = c39;
+    }
+    return 1;
+}
+
+extern struct SN_env * french_ISO_8859_1_create_env(void) { return SN_create_env(0, 3); }
+
+extern void french_ISO_8859_1_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
@@ -0,0 +1,2106 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int spanish_ISO_8859_1_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * spanish_ISO_8859_1_create_env(void);
+extern void spanish_ISO_8859_1_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+static const symbol a_0_pool[10] = {
+    0xE1, 'a', 0xE9, 'e', 0xED, 'i', 0xF3, 'o', 0xFA, 'u'
+};
+
+static const struct translation_entry a_0_entry[5] = {
+    { 0, 1, 1, 1 },
+    { 2, 1, 3, 1 },
+    { 4, 1, 5, 1 },
+    { 6, 1, 7, 1 },
+    { 8, 1, 9, 1 }
+};
+
+static const unsigned short a_0_page[1] = {
+    256
+};
+
+static const unsigned short a_0_index[512] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 3, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0
+};
+
+static const struct translation a_0_translation = {
+    0, 0, 1, a_0_page, a_0_index, a_0_entry, a_0_pool
+};
+
+
+static const struct among a_1[13] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 4, 0, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 4, 5, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 5, 7, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 5, 10, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_2[11] =
+{
+{ 0, 4, -1, 6 },
+{ 0, 5, -1, 6 },
+{ 0, 5, -1, 7 },
+{ 0, 4, -1, 2 },
+{ 0, 5, -1, 1 },
+{ 0, 2, -1, 6 },
+{ 0, 2, -1, 6 },
+{ 0, 2, -1, 6 },
+{ 0, 2, -1, 3 },
+{ 0, 2, -1, 4 },
+{ 0, 2, -1, 5 }
+};
+
+
+static const struct among a_3[4] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_4[3] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+
+static const struct among a_5[3] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_6[46] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 2 },
+{ 0, 5, -1, 5 },
+{ 0, 5, -1, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 9 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 3 },
+{ 0, 4, -1, 8 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 2 },
+{ 0, 5, -1, 7 },
+{ 0, 6, 13, 6 },
+{ 0, 5, -1, 2 },
+{ 0, 5, -1, 4 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 0, 3, -1, 9 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 2 },
+{ 0, 6, -1, 5 },
+{ 0, 6, -1, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 9 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 3 },
+{ 0, 6, -1, 8 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 7, -1, 2 },
+{ 0, 7, -1, 4 },
+{ 0, 6, -1, 2 },
+{ 0, 5, -1, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 4, -1, 9 }
+};
+
+
+static const struct among a_7[12] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_8[96] =
+{
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 4, 5, 2 },
+{ 0, 4, 5, 2 },
+{ 0, 4, 5, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 3, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 4, 16, 2 },
+{ 0, 4, 16, 2 },
+{ 0, 5, 16, 2 },
+{ 0, 3, 16, 2 },
+{ 0, 5, 20, 2 },
+{ 0, 5, 20, 2 },
+{ 0, 5, 20, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 24, 2 },
+{ 0, 5, 24, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 5, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 5, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 4, 39, 2 },
+{ 0, 4, 39, 2 },
+{ 0, 4, 39, 2 },
+{ 0, 4, 39, 2 },
+{ 0, 5, 39, 2 },
+{ 0, 3, 39, 2 },
+{ 0, 5, 45, 2 },
+{ 0, 5, 45, 2 },
+{ 0, 5, 45, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 49, 2 },
+{ 0, 5, 49, 2 },
+{ 0, 5, -1, 2 },
+{ 0, 5, -1, 2 },
+{ 0, 6, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 6, 55, 2 },
+{ 0, 6, 55, 2 },
+{ 0, 6, 55, 2 },
+{ 0, 5, -1, 2 },
+{ 0, 6, -1, 2 },
+{ 0, 6, -1, 2 },
+{ 0, 6, -1, 2 },
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 64, 2 },
+{ 0, 5, 64, 2 },
+{ 0, 5, 64, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 6, 70, 2 },
+{ 0, 6, 70, 2 },
+{ 0, 7, 70, 2 },
+{ 0, 5, 70, 2 },
+{ 0, 7, 74, 2 },
+{ 0, 7, 74, 2 },
+{ 0, 7, 74, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 78, 2 },
+{ 0, 6, 78, 2 },
+{ 0, 6, 78, 2 },
+{ 0, 6, 78, 2 },
+{ 0, 7, 78, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 2 },
+{ 0, 2, -1, 2 }
+};
+
+
+static const struct among a_9[8] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 2 },
+{ 0, 1, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 2 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0
+};
+
+static const unsigned char g_v_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 64, 0, 0, 0, 0, 0, 64, 0, 64, 0, 128, 0, 0, 0, 0, 0, 64, 128, 0, 128, 64, 0, 0 };
+
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[-2] != 'l') break;
+                i = 0;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                if (n <= 3) break;
+                if (q[-4] != 's') break;
+                i = 1;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'l':
+                        i = 2;
+                        break;
+                    case 'm':
+                        i = 3;
+                        break;
+                    case 's':
+                        i = 4;
+                        break;
+                }
+                break;
+            case 'o':
+                if (n <= 1) break;
+                if (q[-2] != 'l') break;
+                i = 5;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                if (n <= 3) break;
+                if (q[-4] != 's') break;
+                i = 6;
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'l') break;
+                        i = 7;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 's') break;
+                        i = 8;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'l') break;
+                        i = 9;
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'l':
+                                i = 10;
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                i = 11;
+                                break;
+                            case 'n':
+                                i = 12;
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+
+static const unsigned char a_2_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x32, 0x2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x22, 0x0, 0x0
+};
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'o':
+                if (n <= 1) break;
+                if (q[-2] != 'd') break;
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'a':
+                        i = 0;
+                        break;
+                    case 'e':
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'i':
+                                i = 1;
+                                break;
+                            case 'y':
+                                i = 2;
+                                break;
+                        }
+                        break;
+                    case 0xE1:
+                        i = 3;
+                        break;
+                    case 0xE9:
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 'r':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 5;
+                        break;
+                    case 'e':
+                        i = 6;
+                        break;
+                    case 'i':
+                        i = 7;
+                        break;
+                    case 0xE1:
+                        i = 8;
+                        break;
+                    case 0xE9:
+                        i = 9;
+                        break;
+                    case 0xED:
+                        i = 10;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_0[] = { 'i', 'e', 'n', 'd', 'o' };
+static const symbol s_1[] = { 'a', 'n', 'd', 'o' };
+static const symbol s_2[] = { 'a', 'r' };
+static const symbol s_3[] = { 'e', 'r' };
+static const symbol s_4[] = { 'i', 'r' };
+
+static const unsigned char a_6_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2A, 0xB2, 0x5C, 0x4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x8, 0x0
+};
+
+static int find_among_b_6(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 0;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'c') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'n') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 1;
+                                break;
+                            case 'e':
+                                i = 2;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'd') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 3;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        i = 4;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 5;
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 6;
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 7;
+                        break;
+                    case 0xED:
+                        if (n <= 2) break;
+                        if (q[-3] != 'g') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'o') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'l') break;
+                        i = 8;
+                        break;
+                }
+                break;
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                if (n <= 2) break;
+                if (q[-3] != 'd') break;
+                if (n <= 3) break;
+                if (q[-4] != 'i') break;
+                i = 9;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'b') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 10;
+                                break;
+                            case 'i':
+                                i = 11;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 12;
+                                break;
+                            case 'e':
+                                if (n <= 4) break;
+                                if (q[-5] != 'm') break;
+                                i = 13;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                i = 14;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 0xF3) break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                if (n <= 3) break;
+                if (q[-4] != 'c') break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 'a':
+                        i = 15;
+                        break;
+                    case 'u':
+                        i = 16;
+                        break;
+                }
+                break;
+            case 'o':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 17;
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 18;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        i = 19;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'm') break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 'a':
+                                i = 20;
+                                break;
+                            case 'i':
+                                i = 21;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 22;
+                        break;
+                }
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                if (n <= 2) break;
+                if (q[-3] != 'd') break;
+                if (n <= 3) break;
+                if (q[-4] != 'a') break;
+                i = 23;
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 24;
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 'c') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'n') break;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'a':
+                                        i = 25;
+                                        break;
+                                    case 'e':
+                                        i = 26;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'd') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                i = 27;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 28;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 29;
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 30;
+                                break;
+                            case 'z':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 31;
+                                break;
+                            case 0xED:
+                                if (n <= 3) break;
+                                if (q[-4] != 'g') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'o') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'l') break;
+                                i = 32;
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'd') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 33;
+                                break;
+                            case 'l':
+                                if (n <= 3) break;
+                                if (q[-4] != 'b') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 34;
+                                        break;
+                                    case 'i':
+                                        i = 35;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'c') break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 'a':
+                                        i = 36;
+                                        break;
+                                    case 'u':
+                                        i = 37;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'd') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                i = 38;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 39;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 40;
+                                break;
+                            case 'm':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 41;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 42;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'm') break;
+                                if (n <= 7) break;
+                                switch (q[-8]) {
+                                    case 'a':
+                                        i = 43;
+                                        break;
+                                    case 'i':
+                                        i = 44;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 45;
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_6[i].s_size;
+    return a_6[i].result;
+}
+static const symbol s_5[] = { 'i', 'c' };
+static const symbol s_6[] = { 'l', 'o', 'g' };
+static const symbol s_7[] = { 'u' };
+static const symbol s_8[] = { 'e', 'n', 't', 'e' };
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'c':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 0;
+                break;
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                i = 1;
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                i = 2;
+                break;
+            case 'v':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+static const symbol s_9[] = { 'a', 't' };
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'e') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'l':
+                if (n <= 2) break;
+                if (q[-3] != 'b') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'a':
+                        i = 0;
+                        break;
+                    case 'i':
+                        i = 1;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                if (n <= 3) break;
+                if (q[-4] != 'a') break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'c':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 0;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                if (q[-3] != 'b') break;
+                if (n <= 3) break;
+                if (q[-4] != 'a') break;
+                i = 1;
+                break;
+            case 'v':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+static const symbol s_10[] = { 'a', 't' };
+
+static const unsigned char a_7_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0xC0, 0x8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0
+};
+
+static int find_among_b_7(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[-2] != 'y') break;
+                i = 0;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                if (q[-2] != 'y') break;
+                i = 1;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'y') break;
+                        i = 2;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'y') break;
+                        i = 3;
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'y') break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 'o':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'y') break;
+                        i = 5;
+                        break;
+                    case 'y':
+                        i = 6;
+                        break;
+                }
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'y') break;
+                        i = 7;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'y') break;
+                        i = 8;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'y') break;
+                        i = 9;
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        if (q[-3] != 'm') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'y') break;
+                        i = 10;
+                        break;
+                }
+                break;
+            case 0xF3:
+                if (n <= 1) break;
+                if (q[-2] != 'y') break;
+                i = 11;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_7[i].s_size;
+    return a_7[i].result;
+}
+
+static const unsigned char a_8_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x32, 0xC0, 0xC, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x2, 0x8, 0x0
+};
+
+static const unsigned char a_8_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x82, 0x1C, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0, 0x0
+};
+
+static int find_among_b_8(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'b':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 0;
+                        break;
+                    case 'd':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 1;
+                                break;
+                            case 'i':
+                                i = 2;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 3;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 4;
+                                break;
+                        }
+                        break;
+                    case 0xED:
+                        i = 5;
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 6;
+                                break;
+                            case 'e':
+                                i = 7;
+                                break;
+                            case 'i':
+                                i = 8;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'd':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 9;
+                        break;
+                    case 'e':
+                        i = 10;
+                        break;
+                    case 'i':
+                        i = 11;
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 's':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 12;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 13;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 14;
+                                break;
+                            case 'i':
+                                i = 15;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 16;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'b':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 17;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 18;
+                                        break;
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 19;
+                                        break;
+                                }
+                                break;
+                            case 0xED:
+                                i = 20;
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 21;
+                                        break;
+                                    case 'e':
+                                        i = 22;
+                                        break;
+                                    case 'i':
+                                        i = 23;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        i = 24;
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 25;
+                                break;
+                            case 'e':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 26;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 27;
+                                break;
+                            case 'e':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 28;
+                                break;
+                        }
+                        break;
+                    case 0xE1:
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 29;
+                                break;
+                            case 'e':
+                                i = 30;
+                                break;
+                            case 'i':
+                                i = 31;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'o':
+                if (n <= 1) break;
+                if (q[-2] != 'd') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'a':
+                        i = 32;
+                        break;
+                    case 'i':
+                        i = 33;
+                        break;
+                    case 'n':
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 34;
+                                break;
+                            case 'e':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 35;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'r':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 36;
+                        break;
+                    case 'e':
+                        i = 37;
+                        break;
+                    case 'i':
+                        i = 38;
+                        break;
+                }
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 39;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'b':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 40;
+                                break;
+                            case 'd':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 41;
+                                        break;
+                                    case 'i':
+                                        i = 42;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 43;
+                                        break;
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 44;
+                                        break;
+                                }
+                                break;
+                            case 0xED:
+                                i = 45;
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 46;
+                                        break;
+                                    case 'e':
+                                        i = 47;
+                                        break;
+                                    case 'i':
+                                        i = 48;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        i = 49;
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 50;
+                                break;
+                            case 'e':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 51;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 52;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 53;
+                                                break;
+                                            case 'e':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 54;
+                                                break;
+                                        }
+                                        break;
+                                    case 0xED:
+                                        i = 55;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'r') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 56;
+                                                break;
+                                            case 'e':
+                                                i = 57;
+                                                break;
+                                            case 'i':
+                                                i = 58;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 's':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 59;
+                                                break;
+                                            case 'e':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 60;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 61;
+                                                break;
+                                            case 'i':
+                                                i = 62;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 0xE1:
+                                i = 63;
+                                break;
+                            case 0xE9:
+                                i = 64;
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 65;
+                                        break;
+                                    case 'e':
+                                        i = 66;
+                                        break;
+                                    case 'i':
+                                        i = 67;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 68;
+                                        break;
+                                    case 'i':
+                                        i = 69;
+                                        break;
+                                }
+                                break;
+                            case 'm':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 70;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'b':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0xE1) break;
+                                                i = 71;
+                                                break;
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 0xE1:
+                                                        i = 72;
+                                                        break;
+                                                    case 0xE9:
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'i') break;
+                                                        i = 73;
+                                                        break;
+                                                }
+                                                break;
+                                            case 0xED:
+                                                i = 74;
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'r') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'a':
+                                                        i = 75;
+                                                        break;
+                                                    case 'e':
+                                                        i = 76;
+                                                        break;
+                                                    case 'i':
+                                                        i = 77;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'e':
+                                        i = 78;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 79;
+                                                        break;
+                                                    case 'e':
+                                                        i = 80;
+                                                        break;
+                                                    case 'i':
+                                                        i = 81;
+                                                        break;
+                                                }
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 0xE1:
+                                                        i = 82;
+                                                        break;
+                                                    case 0xE9:
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'i') break;
+                                                        i = 83;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'i':
+                                        i = 84;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0xE1:
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 85;
+                                break;
+                            case 'e':
+                                i = 86;
+                                break;
+                            case 'i':
+                                i = 87;
+                                break;
+                        }
+                        break;
+                    case 0xED:
+                        i = 88;
+                        break;
+                }
+                break;
+            case 0xE1:
+                if (n <= 1) break;
+                if (q[-2] != 'r') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'a':
+                        i = 89;
+                        break;
+                    case 'e':
+                        i = 90;
+                        break;
+                    case 'i':
+                        i = 91;
+                        break;
+                }
+                break;
+            case 0xE9:
+                if (n <= 1) break;
+                if (q[-2] != 'r') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'a':
+                        i = 92;
+                        break;
+                    case 'e':
+                        i = 93;
+                        break;
+                    case 'i':
+                        i = 94;
+                        break;
+                }
+                break;
+            case 0xF3:
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 95;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_8[i].s_size;
+    return a_8[i].result;
+}
+
+static const unsigned char a_9_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x80, 0x8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x22, 0x8, 0x0
+};
+
+static int find_among_b_9(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                i = 0;
+                break;
+            case 'e':
+                i = 1;
+                break;
+            case 'o':
+                i = 2;
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                i = 3;
+                break;
+            case 0xE1:
+                i = 4;
+                break;
+            case 0xE9:
+                i = 5;
+                break;
+            case 0xED:
+                i = 6;
+                break;
+            case 0xF3:
+                i = 7;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_9[i].s_size;
+    return a_9[i].result;
+}
+
+extern int spanish_ISO_8859_1_stem(struct SN_env * z) {
+    int among_var;
+    
+    z->I[2] = z->l;
+    z->I[1] = z->l;
+    z->I[0] = z->l;
+    {   int c1 = z->c;
+        {   int c2 = z->c;
+            if (in_class(z, g_v_class, 0)) goto lab3;
+            {   int c3 = z->c;
+                if (out_class(z, g_v_class, 0)) goto lab5;
+                {   
+                    int ret = out_class_scan(z, g_v_class, g_v_scan);
+                    if (ret < 0) goto lab5;
+                    z->c += ret;
+                }
+                goto lab4;
+            lab5:
+                z->c = c3;
+                if (in_class(z, g_v_class, 0)) goto lab3;
+                {   
+                    int ret = in_class_scan(z, g_v_class, g_v_scan);
+                    if (ret < 0) goto lab3;
+                    z->c += ret;
+                }
+            }
+        lab4:
+            goto lab2;
+        lab3:
+            z->c = c2;
+            if (out_class(z, g_v_class, 0)) goto lab1;
+            {   int c4 = z->c;
+                if (out_class(z, g_v_class, 0)) goto lab7;
+                {   
+                    int ret = out_class_scan(z, g_v_class, g_v_scan);
+                    if (ret < 0) goto lab7;
+                    z->c += ret;
+                }
+                goto lab6;
+            lab7:
+                z->c = c4;
+                if (in_class(z, g_v_class, 0)) goto lab1;
+                if (z->c >= z->l) goto lab1;
+                z->c++;
+            }
+        lab6:
+            ;
+        }
+    lab2:
+        z->I[2] = z->c;
+    lab1:
+        z->c = c1;
+    }
+    {   int c5 = z->c;
+        {   
+            int ret = out_class_scan(z, g_v_class, g_v_scan);
+            if (ret < 0) goto lab8;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan(z, g_v_class, g_v_scan);
+            if (ret < 0) goto lab8;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+        {   
+            int ret = out_class_scan(z, g_v_class, g_v_scan);
+            if (ret < 0) goto lab8;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan(z, g_v_class, g_v_scan);
+            if (ret < 0) goto lab8;
+            z->c += ret;
+        }
+        z->I[0] = z->c;
+    lab8:
+        z->c = c5;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m6 = z->l - z->c; (void)m6;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((557090 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((569378 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab9;
+        if (!(find_among_b_1(z))) goto lab9;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 111 && z->p[z->c - 1] != 114) || !((a_2_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) goto lab9;
+        among_var = find_among_b_2(z);
+        if (!(among_var)) goto lab9;
+        if (!(z->I[2] <= z->c)) goto lab9;
+        switch (among_var) {
+            case 1:
+                z->bra = z->c;
+                {   int ret = slice_from_s(z, 5, s_0);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                z->bra = z->c;
+                {   int ret = slice_from_s(z, 4, s_1);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                z->bra = z->c;
+                {   int ret = slice_from_s(z, 2, s_2);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                z->bra = z->c;
+                {   int ret = slice_from_s(z, 2, s_3);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                z->bra = z->c;
+                {   int ret = slice_from_s(z, 2, s_4);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                if (z->c <= z->lb || z->p[z->c - 1] != 'u') goto lab9;
+                z->c--;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab9:
+        z->c = z->l - m6;
+    }
+    {   int m7 = z->l - z->c; (void)m7;
+        {   int m8 = z->l - z->c; (void)m8;
+            z->ket = z->c;
+            if (z->c - 2 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((835634 >> (z->p[z->c - 1] & 0x1f)) & 1) || !((a_6_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) goto lab12;
+            among_var = find_among_b_6(z);
+            if (!(among_var)) goto lab12;
+            z->bra = z->c;
+            switch (among_var) {
+                case 1:
+                    if (!(z->I[0] <= z->c)) goto lab12;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    if (!(z->I[0] <= z->c)) goto lab12;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int m9 = z->l - z->c; (void)m9;
+                        z->ket = z->c;
+                        if (!(eq_s_b(z, 2, s_5))) { z->c = z->l - m9; goto lab13; }
+                        z->bra = z->c;
+                        if (!(z->I[0] <= z->c)) { z->c = z->l - m9; goto lab13; }
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                    lab13:
+                        ;
+                    }
+                    break;
+                case 3:
+                    if (!(z->I[0] <= z->c)) goto lab12;
+                    {   int ret = slice_from_s(z, 3, s_6);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 4:
+                    if (!(z->I[0] <= z->c)) goto lab12;
+                    {   int ret = slice_from_s(z, 1, s_7);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 5:
+                    if (!(z->I[0] <= z->c)) goto lab12;
+                    {   int ret = slice_from_s(z, 4, s_8);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 6:
+                    if (!(z->I[1] <= z->c)) goto lab12;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int m10 = z->l - z->c; (void)m10;
+                        z->ket = z->c;
+                        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((4718616 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((33282 >> (z->p[z->c - 2] & 0x1f)) & 1)) { z->c = z->l - m10; goto lab14; }
+                        among_var = find_among_b_3(z);
+                        if (!(among_var)) { z->c = z->l - m10; goto lab14; }
+                        z->bra = z->c;
+                        if (!(z->I[0] <= z->c)) { z->c = z->l - m10; goto lab14; }
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        switch (among_var) {
+                            case 1:
+                                z->ket = z->c;
+                                if (!(eq_s_b(z, 2, s_9))) { z->c = z->l - m10; goto lab14; }
+                                z->bra = z->c;
+                                if (!(z->I[0] <= z->c)) { z->c = z->l - m10; goto lab14; }
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                break;
+                        }
+                    lab14:
+                        ;
+                    }
+                    break;
+                case 7:
+                    if (!(z->I[0] <= z->c)) goto lab12;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int m11 = z->l - z->c; (void)m11;
+                        z->ket = z->c;
+                        if (z->c - 3 <= z->lb || z->p[z->c - 1] != 101 || (z->p[z->c - 2] != 108 && z->p[z->c - 2] != 116)) { z->c = z->l - m11; goto lab15; }
+                        if (!(find_among_b_4(z))) { z->c = z->l - m11; goto lab15; }
+                        z->bra = z->c;
+                        if (!(z->I[0] <= z->c)) { z->c = z->l - m11; goto lab15; }
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                    lab15:
+                        ;
+                    }
+                    break;
+                case 8:
+                    if (!(z->I[0] <= z->c)) goto lab12;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int m12 = z->l - z->c; (void)m12;
+                        z->ket = z->c;
+                        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((4198408 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] != 105) { z->c = z->l - m12; goto lab16; }
+                        if (!(find_among_b_5(z))) { z->c = z->l - m12; goto lab16; }
+                        z->bra = z->c;
+                        if (!(z->I[0] <= z->c)) { z->c = z->l - m12; goto lab16; }
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                    lab16:
+                        ;
+                    }
+                    break;
+                case 9:
+                    if (!(z->I[0] <= z->c)) goto lab12;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int m13 = z->l - z->c; (void)m13;
+                        z->ket = z->c;
+                        if (!(eq_s_b(z, 2, s_10))) { z->c = z->l - m13; goto lab17; }
+                        z->bra = z->c;
+                        if (!(z->I[0] <= z->c)) { z->c = z->l - m13; goto lab17; }
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                    lab17:
+                        ;
+                    }
+                    break;
+            }
+            goto lab11;
+        lab12:
+            z->c = z->l - m8;
+
+            {   int mlimit14;
+                if (z->c < z->I[2]) goto lab18;
+                mlimit14 = z->lb; z->lb = z->I[2];
+                z->ket = z->c;
+                if (z->c - 1 <= z->lb || !((a_7_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((33587762 >> (z->p[z->c - 2] & 0x1f)) & 1)) { z->lb = mlimit14; goto lab18; }
+                if (!(find_among_b_7(z))) { z->lb = mlimit14; goto lab18; }
+                z->bra = z->c;
+                z->lb = mlimit14;
+            }
+            if (z->c <= z->lb || z->p[z->c - 1] != 'u') goto lab18;
+            z->c--;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            goto lab11;
+        lab18:
+            z->c = z->l - m8;
+
+            {   int mlimit15;
+                if (z->c < z->I[2]) goto lab10;
+                mlimit15 = z->lb; z->lb = z->I[2];
+                z->ket = z->c;
+                if (z->c - 1 <= z->lb || !((a_8_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || !((a_8_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) { z->lb = mlimit15; goto lab10; }
+                among_var = find_among_b_8(z);
+                if (!(among_var)) { z->lb = mlimit15; goto lab10; }
+                z->bra = z->c;
+                z->lb = mlimit15;
+            }
+            switch (among_var) {
+                case 1:
+                    {   int m16 = z->l - z->c; (void)m16;
+                        if (z->c <= z->lb || z->p[z->c - 1] != 'u') { z->c = z->l - m16; goto lab19; }
+                        z->c--;
+                        {   int m_test17 = z->l - z->c;
+                            if (z->c <= z->lb || z->p[z->c - 1] != 'g') { z->c = z->l - m16; goto lab19; }
+                            z->c--;
+                            z->c = z->l - m_test17;
+                        }
+                    lab19:
+                        ;
+                    }
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+        }
+    lab11:
+    lab10:
+        z->c = z->l - m7;
+    }
+    {   int m18 = z->l - z->c; (void)m18;
+        z->ket = z->c;
+        if (z->c <= z->lb || !((a_9_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1)) goto lab20;
+        among_var = find_among_b_9(z);
+        if (!(among_var)) goto lab20;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(z->I[2] <= z->c)) goto lab20;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                if (!(z->I[2] <= z->c)) goto lab20;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int m19 = z->l - z->c; (void)m19;
+                    z->ket = z->c;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'u') { z->c = z->l - m19; goto lab21; }
+                    z->c--;
+                    z->bra = z->c;
+                    {   int m_test20 = z->l - z->c;
+                        if (z->c <= z->lb || z->p[z->c - 1] != 'g') { z->c = z->l - m19; goto lab21; }
+                        z->c--;
+                        z->c = z->l - m_test20;
+                    }
+                    if (!(z->I[2] <= z->c)) { z->c = z->l - m19; goto lab21; }
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                lab21:
+                    ;
+                }
+                break;
+        }
+    lab20:
+        z->c = z->l - m18;
+    }
+    z->c = z->lb;
+    {   int c21 = z->c;
+        {   int ret = translate(z, &a_0_translation);
+            if (ret < 0) return ret;
+        }
+        z->c = c21;
+    }
+    return 1;
+}
+
+extern struct SN_env * spanish_ISO_8859_1_create_env(void) { return SN_create_env(0, 3); }
+
+extern void spanish_ISO_8859_1_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
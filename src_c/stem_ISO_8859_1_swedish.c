@@ -0,0 +1,566 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int swedish_ISO_8859_1_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * swedish_ISO_8859_1_create_env(void);
+extern void swedish_ISO_8859_1_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[37] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 4, 0, 1 },
+{ 0, 4, 0, 1 },
+{ 0, 7, 2, 1 },
+{ 0, 4, 0, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 3, 6, 1 },
+{ 0, 4, 6, 1 },
+{ 0, 4, 6, 1 },
+{ 0, 3, 6, 1 },
+{ 0, 4, 6, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 12, 1 },
+{ 0, 4, 12, 1 },
+{ 0, 5, 12, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 18, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 1, -1, 2 },
+{ 0, 2, 21, 1 },
+{ 0, 5, 22, 1 },
+{ 0, 5, 22, 1 },
+{ 0, 5, 22, 1 },
+{ 0, 2, 21, 1 },
+{ 0, 4, 26, 1 },
+{ 0, 5, 26, 1 },
+{ 0, 3, 21, 1 },
+{ 0, 5, 29, 1 },
+{ 0, 6, 29, 1 },
+{ 0, 4, 21, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 }
+};
+
+
+static const struct among a_1[7] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 }
+};
+
+
+static const struct among a_2[5] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 3, 0, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 3 },
+{ 0, 4, -1, 2 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const unsigned char g_s_ending_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const unsigned char g_v_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 192, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 64, 64, 128, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                i = 0;
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                if (q[-3] != 'r') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'a':
+                        i = 1;
+                        break;
+                    case 'e':
+                        i = 2;
+                        if (n <= 4) break;
+                        if (q[-5] != 't') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'e') break;
+                        if (n <= 6) break;
+                        if (q[-7] != 'h') break;
+                        i = 3;
+                        break;
+                    case 'o':
+                        i = 4;
+                        break;
+                }
+                break;
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                i = 5;
+                break;
+            case 'e':
+                i = 6;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 7;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 8;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 9;
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 10;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 11;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        i = 12;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 13;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 14;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'h') break;
+                                i = 15;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 16;
+                        break;
+                }
+                break;
+            case 'r':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 17;
+                        break;
+                    case 'e':
+                        i = 18;
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'h') break;
+                        i = 19;
+                        break;
+                    case 'o':
+                        i = 20;
+                        break;
+                }
+                break;
+            case 's':
+                i = 21;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 22;
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'r') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 23;
+                                break;
+                            case 'e':
+                                i = 24;
+                                break;
+                            case 'o':
+                                i = 25;
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        i = 26;
+                        if (n <= 2) break;
+                        if (q[-3] != 'd') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 27;
+                                break;
+                            case 'n':
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 28;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 29;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 30;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'h') break;
+                                        i = 31;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 32;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 33;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 34;
+                                break;
+                            case 'h':
+                                i = 35;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 36;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_0[i].s_size;
+    return a_0[i].result;
+}
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        i = 0;
+                        break;
+                    case 'g':
+                        i = 1;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                i = 2;
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        i = 3;
+                        break;
+                    case 'g':
+                        i = 4;
+                        break;
+                    case 'k':
+                        i = 5;
+                        break;
+                    case 't':
+                        i = 6;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 0;
+                if (n <= 2) break;
+                if (q[-3] != 'l') break;
+                i = 1;
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 'l') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                i = 2;
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'l') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'u') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'f') break;
+                        i = 3;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 0xF6) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'l') break;
+                        i = 4;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_0[] = { 'l', 0xF6, 's' };
+static const symbol s_1[] = { 'f', 'u', 'l', 'l' };
+
+extern int swedish_ISO_8859_1_stem(struct SN_env * z) {
+    int among_var;
+    {   int c1 = z->c;
+        z->I[1] = z->l;
+        {   int c_test2 = z->c;
+z->c = z->c + 3;
+            if (z->c > z->l) goto lab0;
+            z->I[0] = z->c;
+            z->c = c_test2;
+        }
+        if (out_class_scan(z, g_v_class, g_v_scan) < 0) goto lab0;
+        {   
+            int ret = in_class_scan(z, g_v_class, g_v_scan);
+            if (ret < 0) goto lab0;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+        
+        if (!(z->I[1] < z->I[0])) goto lab1;
+        z->I[1] = z->I[0];
+    lab1:
+    lab0:
+        z->c = c1;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m3 = z->l - z->c; (void)m3;
+
+        {   int mlimit4;
+            if (z->c < z->I[1]) goto lab2;
+            mlimit4 = z->lb; z->lb = z->I[1];
+            z->ket = z->c;
+            if (z->c <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1851442 >> (z->p[z->c - 1] & 0x1f)) & 1)) { z->lb = mlimit4; goto lab2; }
+            among_var = find_among_b_0(z);
+            if (!(among_var)) { z->lb = mlimit4; goto lab2; }
+            z->bra = z->c;
+            z->lb = mlimit4;
+        }
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                if (in_class_b(z, g_s_ending_class, 0)) goto lab2;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab2:
+        z->c = z->l - m3;
+    }
+    {   int m5 = z->l - z->c; (void)m5;
+
+        {   int mlimit6;
+            if (z->c < z->I[1]) goto lab3;
+            mlimit6 = z->lb; z->lb = z->I[1];
+            {   int m7 = z->l - z->c; (void)m7;
+                if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1064976 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((1067152 >> (z->p[z->c - 2] & 0x1f)) & 1)) { z->lb = mlimit6; goto lab3; }
+                if (!(find_among_b_1(z))) { z->lb = mlimit6; goto lab3; }
+                z->c = z->l - m7;
+                z->ket = z->c;
+                if (z->c <= z->lb) { z->lb = mlimit6; goto lab3; }
+                z->c--;
+                z->bra = z->c;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+            }
+            z->lb = mlimit6;
+        }
+    lab3:
+        z->c = z->l - m5;
+    }
+    {   int m8 = z->l - z->c; (void)m8;
+
+        {   int mlimit9;
+            if (z->c < z->I[1]) goto lab4;
+            mlimit9 = z->lb; z->lb = z->I[1];
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1572992 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((528896 >> (z->p[z->c - 2] & 0x1f)) & 1)) { z->lb = mlimit9; goto lab4; }
+            among_var = find_among_b_2(z);
+            if (!(among_var)) { z->lb = mlimit9; goto lab4; }
+            z->bra = z->c;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    {   int ret = slice_from_s(z, 3, s_0);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 3:
+                    {   int ret = slice_from_s(z, 4, s_1);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+            z->lb = mlimit9;
+        }
+    lab4:
+        z->c = z->l - m8;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * swedish_ISO_8859_1_create_env(void) { return SN_create_env(0, 2); }
+
+extern void swedish_ISO_8859_1_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
@@ -0,0 +1,2121 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int romanian_ISO_8859_2_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * romanian_ISO_8859_2_create_env(void);
+extern void romanian_ISO_8859_2_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+static const symbol a_0_pool[4] = {
+    'I', 'i', 'U', 'u'
+};
+
+static const struct translation_entry a_0_entry[2] = {
+    { 0, 1, 1, 1 },
+    { 2, 1, 3, 1 }
+};
+
+static const unsigned short a_0_page[1] = {
+    256
+};
+
+static const unsigned short a_0_index[512] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const struct translation a_0_translation = {
+    0, 0, 1, a_0_page, a_0_index, a_0_entry, a_0_pool
+};
+
+
+static const struct among a_1[16] =
+{
+{ 0, 2, -1, 3 },
+{ 0, 4, -1, 7 },
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 4 },
+{ 0, 4, -1, 7 },
+{ 0, 3, -1, 3 },
+{ 0, 3, -1, 5 },
+{ 0, 4, 6, 4 },
+{ 0, 3, -1, 4 },
+{ 0, 4, -1, 6 },
+{ 0, 2, -1, 4 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 3 },
+{ 0, 4, -1, 4 },
+{ 0, 5, 14, 4 }
+};
+
+
+static const struct among a_2[46] =
+{
+{ 0, 5, -1, 4 },
+{ 0, 5, -1, 4 },
+{ 0, 5, -1, 5 },
+{ 0, 5, -1, 6 },
+{ 0, 5, -1, 4 },
+{ 0, 6, -1, 5 },
+{ 0, 6, -1, 6 },
+{ 0, 6, -1, 5 },
+{ 0, 6, -1, 6 },
+{ 0, 6, -1, 5 },
+{ 0, 7, -1, 4 },
+{ 0, 9, -1, 1 },
+{ 0, 9, -1, 2 },
+{ 0, 7, -1, 3 },
+{ 0, 5, -1, 4 },
+{ 0, 5, -1, 5 },
+{ 0, 5, -1, 6 },
+{ 0, 5, -1, 4 },
+{ 0, 5, -1, 5 },
+{ 0, 7, 18, 4 },
+{ 0, 5, -1, 6 },
+{ 0, 5, -1, 5 },
+{ 0, 7, -1, 4 },
+{ 0, 9, -1, 1 },
+{ 0, 7, -1, 3 },
+{ 0, 5, -1, 4 },
+{ 0, 5, -1, 5 },
+{ 0, 5, -1, 6 },
+{ 0, 6, -1, 4 },
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 3 },
+{ 0, 7, -1, 4 },
+{ 0, 9, -1, 1 },
+{ 0, 7, -1, 3 },
+{ 0, 4, -1, 4 },
+{ 0, 4, -1, 5 },
+{ 0, 6, 35, 4 },
+{ 0, 4, -1, 6 },
+{ 0, 4, -1, 5 },
+{ 0, 4, -1, 4 },
+{ 0, 4, -1, 5 },
+{ 0, 4, -1, 6 },
+{ 0, 5, -1, 4 },
+{ 0, 5, -1, 4 },
+{ 0, 5, -1, 5 },
+{ 0, 5, -1, 6 }
+};
+
+
+static const struct among a_3[62] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 3 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 3 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 17, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 3 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 2 },
+{ 0, 5, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 30, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 3 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 3 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 3 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 3 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 3 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 }
+};
+
+
+static const struct among a_4[94] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 3, 10, 1 },
+{ 0, 4, 10, 2 },
+{ 0, 3, 10, 1 },
+{ 0, 3, 10, 1 },
+{ 0, 3, 10, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 19, 1 },
+{ 0, 3, 19, 1 },
+{ 0, 3, -1, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 2 },
+{ 0, 5, 28, 1 },
+{ 0, 6, 28, 2 },
+{ 0, 5, 28, 1 },
+{ 0, 5, 28, 1 },
+{ 0, 5, 28, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 2 },
+{ 0, 4, 38, 1 },
+{ 0, 4, 38, 1 },
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 2 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 2 },
+{ 0, 7, 45, 1 },
+{ 0, 8, 45, 2 },
+{ 0, 7, 45, 1 },
+{ 0, 7, 45, 1 },
+{ 0, 7, 45, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 54, 1 },
+{ 0, 3, 54, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 4, 57, 1 },
+{ 0, 5, 57, 2 },
+{ 0, 4, 57, 1 },
+{ 0, 4, 57, 1 },
+{ 0, 4, 57, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 4, 65, 1 },
+{ 0, 5, 65, 2 },
+{ 0, 6, 67, 1 },
+{ 0, 7, 67, 2 },
+{ 0, 6, 67, 1 },
+{ 0, 6, 67, 1 },
+{ 0, 6, 67, 1 },
+{ 0, 4, 65, 1 },
+{ 0, 4, 65, 1 },
+{ 0, 4, 65, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 76, 1 },
+{ 0, 3, 76, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 2 },
+{ 0, 5, 84, 1 },
+{ 0, 6, 84, 2 },
+{ 0, 5, 84, 1 },
+{ 0, 5, 84, 1 },
+{ 0, 5, 84, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+
+static const struct among a_5[5] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const symbol s_0[] = { 'U' };
+static const symbol s_1[] = { 'I' };
+static const unsigned char g_v_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 64, 0, 0, 0, 0, 0, 64, 0, 0, 64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 64, 0 };
+
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        i = 0;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 0xFE) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 1;
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 2;
+                                break;
+                            case 'i':
+                                i = 3;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 0xFE) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 4;
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 5;
+                                break;
+                            case 'i':
+                                i = 6;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 7;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                i = 8;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 9;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        i = 10;
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 'l') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'u') break;
+                        i = 11;
+                        break;
+                }
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'u') break;
+                i = 12;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                if (n <= 2) break;
+                if (q[-3] != 'l') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'e':
+                        i = 13;
+                        break;
+                    case 'i':
+                        i = 14;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 15;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+static const symbol s_2[] = { 'a' };
+static const symbol s_3[] = { 'e' };
+static const symbol s_4[] = { 'i' };
+static const symbol s_5[] = { 'a', 'b' };
+static const symbol s_6[] = { 'i' };
+static const symbol s_7[] = { 'a', 't' };
+static const symbol s_8[] = { 'a', 0xFE, 'i' };
+
+static const unsigned char a_2_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x12, 0x44, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0
+};
+
+static const unsigned char a_2_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xD2, 0x54, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x40
+};
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'c') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 0;
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'c':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 1;
+                                break;
+                            case 't':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 2;
+                                        break;
+                                    case 'i':
+                                        i = 3;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'c') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 4;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'u') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xFE) break;
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 'a':
+                                i = 5;
+                                break;
+                            case 'i':
+                                i = 6;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'o') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 't') break;
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 'a':
+                                i = 7;
+                                break;
+                            case 'i':
+                                i = 8;
+                                break;
+                            case 0xE3:
+                                i = 9;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 'c':
+                                if (n <= 6) break;
+                                if (q[-7] != 'i') break;
+                                i = 10;
+                                break;
+                            case 'l':
+                                if (n <= 6) break;
+                                if (q[-7] != 'i') break;
+                                if (n <= 7) break;
+                                if (q[-8] != 'b') break;
+                                if (n <= 8) break;
+                                switch (q[-9]) {
+                                    case 'a':
+                                        i = 11;
+                                        break;
+                                    case 'i':
+                                        i = 12;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 6) break;
+                                if (q[-7] != 'i') break;
+                                i = 13;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'c':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 14;
+                                break;
+                            case 't':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 15;
+                                        break;
+                                    case 'i':
+                                        i = 16;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'c') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 17;
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 18;
+                                if (n <= 5) break;
+                                if (q[-6] != 'c') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'i') break;
+                                i = 19;
+                                break;
+                            case 'i':
+                                i = 20;
+                                break;
+                            case 0xE3:
+                                i = 21;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 'c':
+                                if (n <= 6) break;
+                                if (q[-7] != 'i') break;
+                                i = 22;
+                                break;
+                            case 'l':
+                                if (n <= 6) break;
+                                if (q[-7] != 'i') break;
+                                if (n <= 7) break;
+                                if (q[-8] != 'b') break;
+                                if (n <= 8) break;
+                                if (q[-9] != 'a') break;
+                                i = 23;
+                                break;
+                            case 'v':
+                                if (n <= 6) break;
+                                if (q[-7] != 'i') break;
+                                i = 24;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'c':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 25;
+                                break;
+                            case 't':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 26;
+                                        break;
+                                    case 'i':
+                                        i = 27;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0xE3:
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'c':
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 28;
+                                break;
+                            case 'l':
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'b') break;
+                                if (n <= 7) break;
+                                if (q[-8] != 'a') break;
+                                i = 29;
+                                break;
+                            case 'v':
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 30;
+                                break;
+                        }
+                        break;
+                    case 0xFE:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xE3) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 'c':
+                                if (n <= 6) break;
+                                if (q[-7] != 'i') break;
+                                i = 31;
+                                break;
+                            case 'l':
+                                if (n <= 6) break;
+                                if (q[-7] != 'i') break;
+                                if (n <= 7) break;
+                                if (q[-8] != 'b') break;
+                                if (n <= 8) break;
+                                if (q[-9] != 'a') break;
+                                i = 32;
+                                break;
+                            case 'v':
+                                if (n <= 6) break;
+                                if (q[-7] != 'i') break;
+                                i = 33;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                if (n <= 2) break;
+                if (q[-3] != 'c') break;
+                if (n <= 3) break;
+                if (q[-4] != 'i') break;
+                i = 34;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                if (n <= 2) break;
+                if (q[-3] != 't') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'a':
+                        i = 35;
+                        if (n <= 4) break;
+                        if (q[-5] != 'c') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'i') break;
+                        i = 36;
+                        break;
+                    case 'i':
+                        i = 37;
+                        break;
+                    case 0xE3:
+                        i = 38;
+                        break;
+                }
+                break;
+            case 'v':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'c':
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 39;
+                        break;
+                    case 't':
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 40;
+                                break;
+                            case 'i':
+                                i = 41;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0xE3:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'c') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 42;
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'c':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 43;
+                                break;
+                            case 't':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 44;
+                                        break;
+                                    case 'i':
+                                        i = 45;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_9[] = { 'a', 'b', 'i', 'l' };
+static const symbol s_10[] = { 'i', 'b', 'i', 'l' };
+static const symbol s_11[] = { 'i', 'v' };
+static const symbol s_12[] = { 'i', 'c' };
+static const symbol s_13[] = { 'a', 't' };
+static const symbol s_14[] = { 'i', 't' };
+
+static const unsigned char a_3_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2A, 0x32, 0x5C, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0
+};
+
+static const unsigned char a_3_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA, 0xF2, 0x7C, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x40
+};
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 0;
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'b') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 1;
+                                break;
+                            case 'i':
+                                i = 2;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'o') break;
+                        i = 3;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 4;
+                                break;
+                            case 'i':
+                                i = 5;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 6;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 7;
+                                break;
+                            case 'u':
+                                i = 8;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 9;
+                        break;
+                }
+                break;
+            case 'c':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 10;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 11;
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'b') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 12;
+                                break;
+                            case 'i':
+                                i = 13;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 14;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'u') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 15;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'o') break;
+                        i = 16;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 17;
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 18;
+                                break;
+                            case 'i':
+                                i = 19;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 20;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 21;
+                                break;
+                            case 'u':
+                                i = 22;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 23;
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 24;
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'b') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 25;
+                                break;
+                            case 'i':
+                                i = 26;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'u') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 27;
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 28;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        i = 29;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 30;
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 31;
+                                break;
+                            case 'i':
+                                i = 32;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 33;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 34;
+                                break;
+                            case 'u':
+                                i = 35;
+                                break;
+                            case 0xBA:
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 36;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 37;
+                        break;
+                    case 0xBA:
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        i = 38;
+                        break;
+                    case 0xE3:
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 39;
+                        break;
+                    case 0xFE:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xE3) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 40;
+                        break;
+                }
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                if (q[-3] != 'b') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'a':
+                        i = 41;
+                        break;
+                    case 'i':
+                        i = 42;
+                        break;
+                }
+                break;
+            case 'm':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 43;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                if (n <= 2) break;
+                if (q[-3] != 't') break;
+                if (n <= 3) break;
+                if (q[-4] != 'a') break;
+                i = 44;
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                i = 45;
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 46;
+                        break;
+                    case 'i':
+                        i = 47;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 48;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 49;
+                        break;
+                    case 'u':
+                        i = 50;
+                        break;
+                }
+                break;
+            case 'v':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 51;
+                break;
+            case 0xE3:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 52;
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'b') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 53;
+                                break;
+                            case 'i':
+                                i = 54;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'o') break;
+                        i = 55;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 56;
+                                break;
+                            case 'i':
+                                i = 57;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 58;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 59;
+                                break;
+                            case 'u':
+                                i = 60;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 61;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+static const symbol s_15[] = { 't' };
+static const symbol s_16[] = { 'i', 's', 't' };
+
+static const unsigned char a_4_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3A, 0x22, 0x20, 0x4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0
+};
+
+static const unsigned char a_4_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3A, 0x42, 0x3C, 0x4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0xC, 0x0, 0x0, 0x40
+};
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        i = 0;
+                        break;
+                    case 'i':
+                        i = 1;
+                        break;
+                }
+                break;
+            case 'c':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'e':
+                        i = 2;
+                        break;
+                    case 0xE3:
+                        i = 3;
+                        break;
+                }
+                break;
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'i':
+                        i = 4;
+                        break;
+                    case 0xE2:
+                        i = 5;
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 6;
+                                break;
+                            case 'e':
+                                i = 7;
+                                break;
+                            case 'i':
+                                i = 8;
+                                break;
+                            case 0xE2:
+                                i = 9;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        i = 10;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 11;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                i = 12;
+                                break;
+                            case 'i':
+                                i = 13;
+                                break;
+                            case 'u':
+                                i = 14;
+                                break;
+                            case 0xE2:
+                                i = 15;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 0xBA) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'e':
+                                i = 16;
+                                break;
+                            case 0xE3:
+                                i = 17;
+                                break;
+                        }
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 18;
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 19;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 20;
+                                break;
+                            case 'i':
+                                i = 21;
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        i = 22;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 0xBA) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'e':
+                                i = 23;
+                                break;
+                            case 0xE3:
+                                i = 24;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        i = 25;
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 26;
+                        break;
+                    case 0xBA:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 27;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                i = 28;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 29;
+                                        break;
+                                    case 'e':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        i = 30;
+                                        break;
+                                    case 'i':
+                                        i = 31;
+                                        break;
+                                    case 'u':
+                                        i = 32;
+                                        break;
+                                    case 0xE2:
+                                        i = 33;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 34;
+                                break;
+                            case 'u':
+                                i = 35;
+                                break;
+                            case 0xE2:
+                                i = 36;
+                                break;
+                        }
+                        break;
+                    case 0xE2:
+                        i = 37;
+                        break;
+                    case 0xFE:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 38;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'e':
+                                        i = 39;
+                                        break;
+                                    case 'i':
+                                        i = 40;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 41;
+                                break;
+                            case 'i':
+                                i = 42;
+                                break;
+                            case 0xE2:
+                                i = 43;
+                                break;
+                            case 0xE3:
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 44;
+                                        break;
+                                    case 'e':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        i = 45;
+                                        if (n <= 6) break;
+                                        switch (q[-7]) {
+                                            case 'a':
+                                                i = 46;
+                                                break;
+                                            case 'e':
+                                                if (n <= 7) break;
+                                                if (q[-8] != 's') break;
+                                                i = 47;
+                                                break;
+                                            case 'i':
+                                                i = 48;
+                                                break;
+                                            case 'u':
+                                                i = 49;
+                                                break;
+                                            case 0xE2:
+                                                i = 50;
+                                                break;
+                                        }
+                                        break;
+                                    case 'i':
+                                        i = 51;
+                                        break;
+                                    case 'u':
+                                        i = 52;
+                                        break;
+                                    case 0xE2:
+                                        i = 53;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'm':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 54;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 55;
+                                break;
+                            case 'i':
+                                i = 56;
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        i = 57;
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 58;
+                                break;
+                            case 'e':
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                i = 59;
+                                break;
+                            case 'i':
+                                i = 60;
+                                break;
+                            case 'u':
+                                i = 61;
+                                break;
+                            case 0xE2:
+                                i = 62;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        i = 63;
+                        break;
+                    case 0xE2:
+                        i = 64;
+                        break;
+                    case 0xE3:
+                        i = 65;
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 66;
+                                break;
+                            case 'e':
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                i = 67;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'a':
+                                        i = 68;
+                                        break;
+                                    case 'e':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 's') break;
+                                        i = 69;
+                                        break;
+                                    case 'i':
+                                        i = 70;
+                                        break;
+                                    case 'u':
+                                        i = 71;
+                                        break;
+                                    case 0xE2:
+                                        i = 72;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 73;
+                                break;
+                            case 'u':
+                                i = 74;
+                                break;
+                            case 0xE2:
+                                i = 75;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'u':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 76;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 77;
+                                break;
+                            case 'i':
+                                i = 78;
+                                break;
+                        }
+                        break;
+                    case 'd':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'i':
+                                i = 79;
+                                break;
+                            case 0xE2:
+                                i = 80;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'z':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 81;
+                break;
+            case 0xE3:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'e') break;
+                        i = 82;
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 83;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                i = 84;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 85;
+                                        break;
+                                    case 'e':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        i = 86;
+                                        break;
+                                    case 'i':
+                                        i = 87;
+                                        break;
+                                    case 'u':
+                                        i = 88;
+                                        break;
+                                    case 0xE2:
+                                        i = 89;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 90;
+                                break;
+                            case 'u':
+                                i = 91;
+                                break;
+                            case 0xE2:
+                                i = 92;
+                                break;
+                        }
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 93;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+
+static const unsigned char a_5_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                i = 0;
+                break;
+            case 'e':
+                i = 1;
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 2;
+                break;
+            case 'i':
+                i = 3;
+                break;
+            case 0xE3:
+                i = 4;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+
+extern int romanian_ISO_8859_2_stem(struct SN_env * z) {
+    int among_var;
+    {   int c1 = z->c;
+        while(1) {
+            int c2 = z->c;
+            while(1) {
+                int c3 = z->c;
+                if (in_class(z, g_v_class, 0)) goto lab2;
+                z->bra = z->c;
+                {   int c4 = z->c;
+                    if (z->c == z->l || z->p[z->c] != 'u') goto lab4;
+                    z->c++;
+                    z->ket = z->c;
+                    if (in_class(z, g_v_class, 0)) goto lab4;
+                    {   int ret = slice_from_s(z, 1, s_0);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab3;
+                lab4:
+                    z->c = c4;
+                    if (z->c == z->l || z->p[z->c] != 'i') goto lab2;
+                    z->c++;
+                    z->ket = z->c;
+                    if (in_class(z, g_v_class, 0)) goto lab2;
+                    {   int ret = slice_from_s(z, 1, s_1);
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab3:
+                z->c = c3;
+                break;
+            lab2:
+                z->c = c3;
+                if (z->c >= z->l) goto lab1;
+                z->c++;
+            }
+            continue;
+        lab1:
+            z->c = c2;
+            break;
+        }
+        z->c = c1;
+    }
+    
+    z->I[2] = z->l;
+    z->I[1] = z->l;
+    z->I[0] = z->l;
+    {   int c5 = z->c;
+        {   int c6 = z->c;
+            if (in_class(z, g_v_class, 0)) goto lab8;
+            {   int c7 = z->c;
+                if (out_class(z, g_v_class, 0)) goto lab10;
+                {   
+                    int ret = out_class_scan(z, g_v_class, g_v_scan);
+                    if (ret < 0) goto lab10;
+                    z->c += ret;
+                }
+                goto lab9;
+            lab10:
+                z->c = c7;
+                if (in_class(z, g_v_class, 0)) goto lab8;
+                {   
+                    int ret = in_class_scan(z, g_v_class, g_v_scan);
+                    if (ret < 0) goto lab8;
+                    z->c += ret;
+                }
+            }
+        lab9:
+            goto lab7;
+        lab8:
+            z->c = c6;
+            if (out_class(z, g_v_class, 0)) goto lab6;
+            {   int c8 = z->c;
+                if (out_class(z, g_v_class, 0)) goto lab12;
+                {   
+                    int ret = out_class_scan(z, g_v_class, g_v_scan);
+                    if (ret < 0) goto lab12;
+                    z->c += ret;
+                }
+                goto lab11;
+            lab12:
+                z->c = c8;
+                if (in_class(z, g_v_class, 0)) goto lab6;
+                if (z->c >= z->l) goto lab6;
+                z->c++;
+            }
+        lab11:
+            ;
+        }
+    lab7:
+        z->I[2] = z->c;
+    lab6:
+        z->c = c5;
+    }
+    {   int c9 = z->c;
+        {   
+            int ret = out_class_scan(z, g_v_class, g_v_scan);
+            if (ret < 0) goto lab13;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan(z, g_v_class, g_v_scan);
+            if (ret < 0) goto lab13;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+        {   
+            int ret = out_class_scan(z, g_v_class, g_v_scan);
+            if (ret < 0) goto lab13;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan(z, g_v_class, g_v_scan);
+            if (ret < 0) goto lab13;
+            z->c += ret;
+        }
+        z->I[0] = z->c;
+    lab13:
+        z->c = c9;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m10 = z->l - z->c; (void)m10;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((266786 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((2134560 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab14;
+        among_var = find_among_b_1(z);
+        if (!(among_var)) goto lab14;
+        z->bra = z->c;
+        if (!(z->I[1] <= z->c)) goto lab14;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 1, s_2);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 1, s_3);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                {   int ret = slice_from_s(z, 1, s_4);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                {   int m11 = z->l - z->c; (void)m11;
+                    if (!(eq_s_b(z, 2, s_5))) goto lab15;
+                    goto lab14;
+                lab15:
+                    z->c = z->l - m11;
+                }
+                {   int ret = slice_from_s(z, 1, s_6);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {   int ret = slice_from_s(z, 2, s_7);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                {   int ret = slice_from_s(z, 3, s_8);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab14:
+        z->c = z->l - m10;
+    }
+    {   int m12 = z->l - z->c; (void)m12;
+        z->I[3] = 0;
+        while(1) {
+            int m13 = z->l - z->c; (void)m13;
+            {   int m_test14 = z->l - z->c;
+                z->ket = z->c;
+                if (z->c - 3 <= z->lb || !((a_2_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || !((a_2_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) goto lab17;
+                among_var = find_among_b_2(z);
+                if (!(among_var)) goto lab17;
+                z->bra = z->c;
+                if (!(z->I[1] <= z->c)) goto lab17;
+                switch (among_var) {
+                    case 1:
+                        {   int ret = slice_from_s(z, 4, s_9);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        {   int ret = slice_from_s(z, 4, s_10);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 3:
+                        {   int ret = slice_from_s(z, 2, s_11);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 4:
+                        {   int ret = slice_from_s(z, 2, s_12);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 5:
+                        {   int ret = slice_from_s(z, 2, s_13);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 6:
+                        {   int ret = slice_from_s(z, 2, s_14);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+                z->I[3] = 1;
+                z->c = z->l - m_test14;
+            }
+            continue;
+        lab17:
+            z->c = z->l - m13;
+            break;
+        }
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || !((a_3_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || !((a_3_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) goto lab16;
+        among_var = find_among_b_3(z);
+        if (!(among_var)) goto lab16;
+        z->bra = z->c;
+        if (!(z->I[0] <= z->c)) goto lab16;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                if (z->c <= z->lb || z->p[z->c - 1] != 0xFE) goto lab16;
+                z->c--;
+                z->bra = z->c;
+                {   int ret = slice_from_s(z, 1, s_15);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 3, s_16);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+        z->I[3] = 1;
+    lab16:
+        z->c = z->l - m12;
+    }
+    {   int m15 = z->l - z->c; (void)m15;
+        {   int m16 = z->l - z->c; (void)m16;
+            if (!(z->I[3])) goto lab20;
+            goto lab19;
+        lab20:
+            z->c = z->l - m16;
+
+            {   int mlimit17;
+                if (z->c < z->I[2]) goto lab18;
+                mlimit17 = z->lb; z->lb = z->I[2];
+                z->ket = z->c;
+                if (z->c - 1 <= z->lb || !((a_4_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || !((a_4_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) { z->lb = mlimit17; goto lab18; }
+                among_var = find_among_b_4(z);
+                if (!(among_var)) { z->lb = mlimit17; goto lab18; }
+                z->bra = z->c;
+                switch (among_var) {
+                    case 1:
+                        {   int m18 = z->l - z->c; (void)m18;
+                            if (out_class_b(z, g_v_class, 0)) goto lab22;
+                            goto lab21;
+                        lab22:
+                            z->c = z->l - m18;
+                            if (z->c <= z->lb || z->p[z->c - 1] != 'u') { z->lb = mlimit17; goto lab18; }
+                            z->c--;
+                        }
+                    lab21:
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+                z->lb = mlimit17;
+            }
+        }
+    lab19:
+    lab18:
+        z->c = z->l - m15;
+    }
+    {   int m19 = z->l - z->c; (void)m19;
+        z->ket = z->c;
+        if (z->c <= z->lb || !((a_5_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1)) goto lab23;
+        if (!(find_among_b_5(z))) goto lab23;
+        z->bra = z->c;
+        if (!(z->I[2] <= z->c)) goto lab23;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab23:
+        z->c = z->l - m19;
+    }
+    z->c = z->lb;
+    {   int c20 = z->c;
+        {   int ret = translate(z, &a_0_translation);
+            if (ret < 0) return ret;
+        }
+        z->c = c20;
+    }
+    return 1;
+}
+
+extern struct SN_env * romanian_ISO_8859_2_create_env(void) { return SN_create_env(0, 4); }
+
+extern void romanian_ISO_8859_2_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
@@ -0,0 +1,1935 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int arabic_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+static int r_Suffix_Verb_Step2a(struct SN_env * z);
+static int r_Suffix_Noun_Step2c1(struct SN_env * z);
+static int r_Suffix_Noun_Step2b(struct SN_env * z);
+static int r_Suffix_Noun_Step2a(struct SN_env * z);
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * arabic_UTF_8_create_env(void);
+extern void arabic_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+static const symbol a_0_pool[511] = {
+    0xD9, 0x80, 0xD9, 0x8B, 0xD9, 0x8C, 0xD9, 0x8D, 0xD9, 0x8E, 0xD9, 0x8F, 0xD9, 0x90, 0xD9, 0x91,
+    0xD9, 0x92, 0xD9, 0xA0, '0', 0xD9, 0xA1, '1', 0xD9, 0xA2, '2', 0xD9, 0xA3, '3', 0xD9, 0xA4,
+    '4', 0xD9, 0xA5, '5', 0xD9, 0xA6, '6', 0xD9, 0xA7, '7', 0xD9, 0xA8, '8', 0xD9, 0xA9, '9',
+    0xEF, 0xBA, 0x80, 0xD8, 0xA1, 0xEF, 0xBA, 0x81, 0xD8, 0xA2, 0xEF, 0xBA, 0x82, 0xEF, 0xBA, 0x83,
+    0xD8, 0xA3, 0xEF, 0xBA, 0x84, 0xEF, 0xBA, 0x85, 0xD8, 0xA4, 0xEF, 0xBA, 0x86, 0xEF, 0xBA, 0x87,
+    0xD8, 0xA5, 0xEF, 0xBA, 0x88, 0xEF, 0xBA, 0x89, 0xD8, 0xA6, 0xEF, 0xBA, 0x8A, 0xEF, 0xBA, 0x8B,
+    0xEF, 0xBA, 0x8C, 0xEF, 0xBA, 0x8D, 0xD8, 0xA7, 0xEF, 0xBA, 0x8E, 0xEF, 0xBA, 0x8F, 0xD8, 0xA8,
+    0xEF, 0xBA, 0x90, 0xEF, 0xBA, 0x91, 0xEF, 0xBA, 0x92, 0xEF, 0xBA, 0x93, 0xD8, 0xA9, 0xEF, 0xBA,
+    0x94, 0xEF, 0xBA, 0x95, 0xD8, 0xAA, 0xEF, 0xBA, 0x96, 0xEF, 0xBA, 0x97, 0xEF, 0xBA, 0x98, 0xEF,
+    0xBA, 0x99, 0xD8, 0xAB, 0xEF, 0xBA, 0x9A, 0xEF, 0xBA, 0x9B, 0xEF, 0xBA, 0x9C, 0xEF, 0xBA, 0x9D,
+    0xD8, 0xAC, 0xEF, 0xBA, 0x9E, 0xEF, 0xBA, 0x9F, 0xEF, 0xBA, 0xA0, 0xEF, 0xBA, 0xA1, 0xD8, 0xAD,
+    0xEF, 0xBA, 0xA2, 0xEF, 0xBA, 0xA3, 0xEF, 0xBA, 0xA4, 0xEF, 0xBA, 0xA5, 0xD8, 0xAE, 0xEF, 0xBA,
+    0xA6, 0xEF, 0xBA, 0xA7, 0xEF, 0xBA, 0xA8, 0xEF, 0xBA, 0xA9, 0xD8, 0xAF, 0xEF, 0xBA, 0xAA, 0xEF,
+    0xBA, 0xAB, 0xD8, 0xB0, 0xEF, 0xBA, 0xAC, 0xEF, 0xBA, 0xAD, 0xD8, 0xB1, 0xEF, 0xBA, 0xAE, 0xEF,
+    0xBA, 0xAF, 0xD8, 0xB2, 0xEF, 0xBA, 0xB0, 0xEF, 0xBA, 0xB1, 0xD8, 0xB3, 0xEF, 0xBA, 0xB2, 0xEF,
+    0xBA, 0xB3, 0xEF, 0xBA, 0xB4, 0xEF, 0xBA, 0xB5, 0xD8, 0xB4, 0xEF, 0xBA, 0xB6, 0xEF, 0xBA, 0xB7,
+    0xEF, 0xBA, 0xB8, 0xEF, 0xBA, 0xB9, 0xD8, 0xB5, 0xEF, 0xBA, 0xBA, 0xEF, 0xBA, 0xBB, 0xEF, 0xBA,
+    0xBC, 0xEF, 0xBA, 0xBD, 0xD8, 0xB6, 0xEF, 0xBA, 0xBE, 0xEF, 0xBA, 0xBF, 0xEF, 0xBB, 0x80, 0xEF,
+    0xBB, 0x81, 0xD8, 0xB7, 0xEF, 0xBB, 0x82, 0xEF, 0xBB, 0x83, 0xEF, 0xBB, 0x84, 0xEF, 0xBB, 0x85,
+    0xD8, 0xB8, 0xEF, 0xBB, 0x86, 0xEF, 0xBB, 0x87, 0xEF, 0xBB, 0x88, 0xEF, 0xBB, 0x89, 0xD8, 0xB9,
+    0xEF, 0xBB, 0x8A, 0xEF, 0xBB, 0x8B, 0xEF, 0xBB, 0x8C, 0xEF, 0xBB, 0x8D, 0xD8, 0xBA, 0xEF, 0xBB,
+    0x8E, 0xEF, 0xBB, 0x8F, 0xEF, 0xBB, 0x90, 0xEF, 0xBB, 0x91, 0xD9, 0x81, 0xEF, 0xBB, 0x92, 0xEF,
+    0xBB, 0x93, 0xEF, 0xBB, 0x94, 0xEF, 0xBB, 0x95, 0xD9, 0x82, 0xEF, 0xBB, 0x96, 0xEF, 0xBB, 0x97,
+    0xEF, 0xBB, 0x98, 0xEF, 0xBB, 0x99, 0xD9, 0x83, 0xEF, 0xBB, 0x9A, 0xEF, 0xBB, 0x9B, 0xEF, 0xBB,
+    0x9C, 0xEF, 0xBB, 0x9D, 0xD9, 0x84, 0xEF, 0xBB, 0x9E, 0xEF, 0xBB, 0x9F, 0xEF, 0xBB, 0xA0, 0xEF,
+    0xBB, 0xA1, 0xD9, 0x85, 0xEF, 0xBB, 0xA2, 0xEF, 0xBB, 0xA3, 0xEF, 0xBB, 0xA4, 0xEF, 0xBB, 0xA5,
+    0xD9, 0x86, 0xEF, 0xBB, 0xA6, 0xEF, 0xBB, 0xA7, 0xEF, 0xBB, 0xA8, 0xEF, 0xBB, 0xA9, 0xD9, 0x87,
+    0xEF, 0xBB, 0xAA, 0xEF, 0xBB, 0xAB, 0xEF, 0xBB, 0xAC, 0xEF, 0xBB, 0xAD, 0xD9, 0x88, 0xEF, 0xBB,
+    0xAE, 0xEF, 0xBB, 0xAF, 0xD9, 0x89, 0xEF, 0xBB, 0xB0, 0xEF, 0xBB, 0xB1, 0xD9, 0x8A, 0xEF, 0xBB,
+    0xB2, 0xEF, 0xBB, 0xB3, 0xEF, 0xBB, 0xB4, 0xEF, 0xBB, 0xB5, 0xD9, 0x84, 0xD8, 0xA2, 0xEF, 0xBB,
+    0xB6, 0xEF, 0xBB, 0xB7, 0xD9, 0x84, 0xD8, 0xA3, 0xEF, 0xBB, 0xB8, 0xEF, 0xBB, 0xB9, 0xD9, 0x84,
+    0xD8, 0xA5, 0xEF, 0xBB, 0xBA, 0xEF, 0xBB, 0xBB, 0xD9, 0x84, 0xD8, 0xA7, 0xEF, 0xBB, 0xBC
+};
+
+static const struct translation_entry a_0_entry[144] = {
+    { 0, 2, 0, 0 },
+    { 2, 2, 0, 0 },
+    { 4, 2, 0, 0 },
+    { 6, 2, 0, 0 },
+    { 8, 2, 0, 0 },
+    { 10, 2, 0, 0 },
+    { 12, 2, 0, 0 },
+    { 14, 2, 0, 0 },
+    { 16, 2, 0, 0 },
+    { 18, 2, 20, 1 },
+    { 21, 2, 23, 1 },
+    { 24, 2, 26, 1 },
+    { 27, 2, 29, 1 },
+    { 30, 2, 32, 1 },
+    { 33, 2, 35, 1 },
+    { 36, 2, 38, 1 },
+    { 39, 2, 41, 1 },
+    { 42, 2, 44, 1 },
+    { 45, 2, 47, 1 },
+    { 48, 3, 51, 2 },
+    { 53, 3, 56, 2 },
+    { 58, 3, 56, 2 },
+    { 61, 3, 64, 2 },
+    { 66, 3, 64, 2 },
+    { 69, 3, 72, 2 },
+    { 74, 3, 72, 2 },
+    { 77, 3, 80, 2 },
+    { 82, 3, 80, 2 },
+    { 85, 3, 88, 2 },
+    { 90, 3, 88, 2 },
+    { 93, 3, 88, 2 },
+    { 96, 3, 88, 2 },
+    { 99, 3, 102, 2 },
+    { 104, 3, 102, 2 },
+    { 107, 3, 110, 2 },
+    { 112, 3, 110, 2 },
+    { 115, 3, 110, 2 },
+    { 118, 3, 110, 2 },
+    { 121, 3, 124, 2 },
+    { 126, 3, 124, 2 },
+    { 129, 3, 132, 2 },
+    { 134, 3, 132, 2 },
+    { 137, 3, 132, 2 },
+    { 140, 3, 132, 2 },
+    { 143, 3, 146, 2 },
+    { 148, 3, 146, 2 },
+    { 151, 3, 146, 2 },
+    { 154, 3, 146, 2 },
+    { 157, 3, 160, 2 },
+    { 162, 3, 160, 2 },
+    { 165, 3, 160, 2 },
+    { 168, 3, 160, 2 },
+    { 171, 3, 174, 2 },
+    { 176, 3, 174, 2 },
+    { 179, 3, 174, 2 },
+    { 182, 3, 174, 2 },
+    { 185, 3, 188, 2 },
+    { 190, 3, 188, 2 },
+    { 193, 3, 188, 2 },
+    { 196, 3, 188, 2 },
+    { 199, 3, 202, 2 },
+    { 204, 3, 202, 2 },
+    { 207, 3, 210, 2 },
+    { 212, 3, 210, 2 },
+    { 215, 3, 218, 2 },
+    { 220, 3, 218, 2 },
+    { 223, 3, 226, 2 },
+    { 228, 3, 226, 2 },
+    { 231, 3, 234, 2 },
+    { 236, 3, 234, 2 },
+    { 239, 3, 234, 2 },
+    { 242, 3, 234, 2 },
+    { 245, 3, 248, 2 },
+    { 250, 3, 248, 2 },
+    { 253, 3, 248, 2 },
+    { 256, 3, 248, 2 },
+    { 259, 3, 262, 2 },
+    { 264, 3, 262, 2 },
+    { 267, 3, 262, 2 },
+    { 270, 3, 262, 2 },
+    { 273, 3, 276, 2 },
+    { 278, 3, 276, 2 },
+    { 281, 3, 276, 2 },
+    { 284, 3, 276, 2 },
+    { 287, 3, 290, 2 },
+    { 292, 3, 290, 2 },
+    { 295, 3, 290, 2 },
+    { 298, 3, 290, 2 },
+    { 301, 3, 304, 2 },
+    { 306, 3, 304, 2 },
+    { 309, 3, 304, 2 },
+    { 312, 3, 304, 2 },
+    { 315, 3, 318, 2 },
+    { 320, 3, 318, 2 },
+    { 323, 3, 318, 2 },
+    { 326, 3, 318, 2 },
+    { 329, 3, 332, 2 },
+    { 334, 3, 332, 2 },
+    { 337, 3, 332, 2 },
+    { 340, 3, 332, 2 },
+    { 343, 3, 346, 2 },
+    { 348, 3, 346, 2 },
+    { 351, 3, 346, 2 },
+    { 354, 3, 346, 2 },
+    { 357, 3, 360, 2 },
+    { 362, 3, 360, 2 },
+    { 365, 3, 360, 2 },
+    { 368, 3, 360, 2 },
+    { 371, 3, 374, 2 },
+    { 376, 3, 374, 2 },
+    { 379, 3, 374, 2 },
+    { 382, 3, 374, 2 },
+    { 385, 3, 388, 2 },
+    { 390, 3, 388, 2 },
+    { 393, 3, 388, 2 },
+    { 396, 3, 388, 2 },
+    { 399, 3, 402, 2 },
+    { 404, 3, 402, 2 },
+    { 407, 3, 402, 2 },
+    { 410, 3, 402, 2 },
+    { 413, 3, 416, 2 },
+    { 418, 3, 416, 2 },
+    { 421, 3, 416, 2 },
+    { 424, 3, 416, 2 },
+    { 427, 3, 430, 2 },
+    { 432, 3, 430, 2 },
+    { 435, 3, 430, 2 },
+    { 438, 3, 430, 2 },
+    { 441, 3, 444, 2 },
+    { 446, 3, 444, 2 },
+    { 449, 3, 452, 2 },
+    { 454, 3, 452, 2 },
+    { 457, 3, 460, 2 },
+    { 462, 3, 460, 2 },
+    { 465, 3, 460, 2 },
+    { 468, 3, 460, 2 },
+    { 471, 3, 474, 4 },
+    { 478, 3, 474, 4 },
+    { 481, 3, 484, 4 },
+    { 488, 3, 484, 4 },
+    { 491, 3, 494, 4 },
+    { 498, 3, 494, 4 },
+    { 501, 3, 504, 4 },
+    { 508, 3, 504, 4 }
+};
+
+static const unsigned short a_0_page[249] = {
+    256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 512
+};
+
+static const unsigned short a_0_index[768] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 4, 5, 6,
+    7, 8, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
+    68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+    84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99,
+    100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+    116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+    132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 0, 0, 0
+};
+
+static const struct translation a_0_translation = {
+    6, 254, 0, a_0_page, a_0_index, a_0_entry, a_0_pool
+};
+
+
+static const struct among a_1[5] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+static const symbol a_2_pool[16] = {
+    0xD8, 0xA2, 0xD8, 0xA7, 0xD8, 0xA3, 0xD8, 0xA4, 0xD9, 0x88, 0xD8, 0xA5, 0xD8, 0xA6, 0xD9, 0x8A
+};
+
+static const struct translation_entry a_2_entry[5] = {
+    { 0, 2, 2, 2 },
+    { 4, 2, 2, 2 },
+    { 6, 2, 8, 2 },
+    { 10, 2, 2, 2 },
+    { 12, 2, 14, 2 }
+};
+
+static const unsigned short a_2_page[1] = {
+    256
+};
+
+static const unsigned short a_2_index[512] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 2, 3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const struct translation a_2_translation = {
+    6, 6, 0, a_2_page, a_2_index, a_2_entry, a_2_pool
+};
+
+
+static const struct among a_3[4] =
+{
+{ 0, 4, -1, 2 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 2 }
+};
+
+
+static const struct among a_4[5] =
+{
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 4 },
+{ 0, 4, -1, 3 }
+};
+
+
+static const struct among a_5[2] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_6[4] =
+{
+{ 0, 4, -1, 2 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 2 }
+};
+
+
+static const struct among a_7[4] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 4, 0, -1 },
+{ 0, 4, 0, 2 },
+{ 0, 4, -1, 3 }
+};
+
+
+static const struct among a_8[4] =
+{
+{ 0, 4, -1, 4 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 3 },
+{ 0, 4, -1, 1 }
+};
+
+
+static const struct among a_9[3] =
+{
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 }
+};
+
+
+static const struct among a_10[10] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 6, -1, 3 },
+{ 0, 6, -1, 3 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 2 }
+};
+
+
+static const struct among a_11[1] =
+{
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_12[3] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_13[1] =
+{
+{ 0, 4, -1, 1 }
+};
+
+
+static const struct among a_14[1] =
+{
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_15[1] =
+{
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_16[1] =
+{
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_17[12] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 6, -1, 3 },
+{ 0, 4, -1, 2 },
+{ 0, 6, -1, 3 },
+{ 0, 6, -1, 3 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 2 }
+};
+
+
+static const struct among a_18[11] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 4, 0, 3 },
+{ 0, 4, 0, 3 },
+{ 0, 4, 0, 3 },
+{ 0, 4, 0, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 6, 6, 4 },
+{ 0, 4, 6, 2 },
+{ 0, 4, 6, 2 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_19[2] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+
+static const struct among a_20[2] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 6, 0, 2 }
+};
+
+
+static const struct among a_21[1] =
+{
+{ 0, 2, -1, 1 }
+};
+
+
+static const unsigned char a_12_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x5, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_12(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x88:
+                if (n <= 1) break;
+                if (q[-2] != 0xD9) break;
+                i = 0;
+                break;
+            case 0x8A:
+                if (n <= 1) break;
+                if (q[-2] != 0xD9) break;
+                i = 1;
+                break;
+            case 0xA7:
+                if (n <= 1) break;
+                if (q[-2] != 0xD8) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_12[i].s_size;
+    return a_12[i].result;
+}
+
+static int find_among_b_13(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0xAA) break;
+        if (n <= 1) break;
+        if (q[-2] != 0xD8) break;
+        if (n <= 2) break;
+        if (q[-3] != 0xA7) break;
+        if (n <= 3) break;
+        if (q[-4] != 0xD8) break;
+        i = 0;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_13[i].s_size;
+    return a_13[i].result;
+}
+
+static int find_among_b_14(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0xAA) break;
+        if (n <= 1) break;
+        if (q[-2] != 0xD8) break;
+        i = 0;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_14[i].s_size;
+    return a_14[i].result;
+}
+
+static const unsigned char a_18_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x40, 0x4, 0x0, 0x0, 0x80, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_18(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x86:
+                if (n <= 1) break;
+                if (q[-2] != 0xD9) break;
+                i = 0;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x88:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD9) break;
+                        i = 1;
+                        break;
+                    case 0x8A:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD9) break;
+                        i = 2;
+                        break;
+                    case 0xA7:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD8) break;
+                        i = 3;
+                        break;
+                    case 0xAA:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD8) break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 0x8A:
+                if (n <= 1) break;
+                if (q[-2] != 0xD9) break;
+                i = 5;
+                break;
+            case 0xA7:
+                if (n <= 1) break;
+                if (q[-2] != 0xD8) break;
+                i = 6;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x85:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD9) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xAA) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD8) break;
+                        i = 7;
+                        break;
+                    case 0x86:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD9) break;
+                        i = 8;
+                        break;
+                    case 0xAA:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD8) break;
+                        i = 9;
+                        break;
+                }
+                break;
+            case 0xAA:
+                if (n <= 1) break;
+                if (q[-2] != 0xD8) break;
+                i = 10;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_18[i].s_size;
+    return a_18[i].result;
+}
+
+static int find_among_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 0xD8:
+                if (n <= 1) break;
+                switch (q[1]) {
+                    case 0xA7:
+                        if (n <= 2) break;
+                        if (q[2] != 0xD9) break;
+                        if (n <= 3) break;
+                        if (q[3] != 0x84) break;
+                        i = 0;
+                        break;
+                    case 0xA8:
+                        if (n <= 2) break;
+                        if (q[2] != 0xD8) break;
+                        if (n <= 3) break;
+                        if (q[3] != 0xA7) break;
+                        if (n <= 4) break;
+                        if (q[4] != 0xD9) break;
+                        if (n <= 5) break;
+                        if (q[5] != 0x84) break;
+                        i = 1;
+                        break;
+                }
+                break;
+            case 0xD9:
+                if (n <= 1) break;
+                switch (q[1]) {
+                    case 0x83:
+                        if (n <= 2) break;
+                        if (q[2] != 0xD8) break;
+                        if (n <= 3) break;
+                        if (q[3] != 0xA7) break;
+                        if (n <= 4) break;
+                        if (q[4] != 0xD9) break;
+                        if (n <= 5) break;
+                        if (q[5] != 0x84) break;
+                        i = 2;
+                        break;
+                    case 0x84:
+                        if (n <= 2) break;
+                        if (q[2] != 0xD9) break;
+                        if (n <= 3) break;
+                        if (q[3] != 0x84) break;
+                        i = 3;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_3[i].s_size;
+    return a_3[i].result;
+}
+
+static const unsigned char a_17_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xE8, 0x5, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_17(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xD9) break;
+                i = 0;
+                break;
+            case 0x85:
+                if (n <= 1) break;
+                if (q[-2] != 0xD9) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x83:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD9) break;
+                        i = 1;
+                        break;
+                    case 0x87:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD9) break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0x86:
+                if (n <= 1) break;
+                if (q[-2] != 0xD9) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x83:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD9) break;
+                        i = 3;
+                        break;
+                    case 0x87:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD9) break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 0x87:
+                if (n <= 1) break;
+                if (q[-2] != 0xD9) break;
+                i = 5;
+                break;
+            case 0x88:
+                if (n <= 1) break;
+                if (q[-2] != 0xD9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x85) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD9) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x83) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD9) break;
+                i = 6;
+                break;
+            case 0x8A:
+                if (n <= 1) break;
+                if (q[-2] != 0xD9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x86) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD9) break;
+                i = 7;
+                break;
+            case 0xA7:
+                if (n <= 1) break;
+                if (q[-2] != 0xD8) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x85:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD9) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x83:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD9) break;
+                                i = 8;
+                                break;
+                            case 0x87:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD9) break;
+                                i = 9;
+                                break;
+                        }
+                        break;
+                    case 0x86:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD9) break;
+                        i = 10;
+                        break;
+                    case 0x87:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD9) break;
+                        i = 11;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_17[i].s_size;
+    return a_17[i].result;
+}
+
+static int find_among_b_20(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x88) break;
+        if (n <= 1) break;
+        if (q[-2] != 0xD9) break;
+        i = 0;
+        if (n <= 2) break;
+        if (q[-3] != 0x85) break;
+        if (n <= 3) break;
+        if (q[-4] != 0xD9) break;
+        if (n <= 4) break;
+        if (q[-5] != 0xAA) break;
+        if (n <= 5) break;
+        if (q[-6] != 0xD8) break;
+        i = 1;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_20[i].s_size;
+    return a_20[i].result;
+}
+
+static int find_among_b_19(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x85:
+                if (n <= 1) break;
+                if (q[-2] != 0xD9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xAA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD8) break;
+                i = 0;
+                break;
+            case 0xA7:
+                if (n <= 1) break;
+                if (q[-2] != 0xD8) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x88) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD9) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_19[i].s_size;
+    return a_19[i].result;
+}
+
+static int find_among_b_15(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0xA9) break;
+        if (n <= 1) break;
+        if (q[-2] != 0xD8) break;
+        i = 0;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_15[i].s_size;
+    return a_15[i].result;
+}
+
+static const unsigned char a_10_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xE8, 0x4, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_10(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xD9) break;
+                i = 0;
+                break;
+            case 0x85:
+                if (n <= 1) break;
+                if (q[-2] != 0xD9) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x83:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD9) break;
+                        i = 1;
+                        break;
+                    case 0x87:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD9) break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0x86:
+                if (n <= 1) break;
+                if (q[-2] != 0xD9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x87) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD9) break;
+                i = 3;
+                break;
+            case 0x87:
+                if (n <= 1) break;
+                if (q[-2] != 0xD9) break;
+                i = 4;
+                break;
+            case 0x8A:
+                if (n <= 1) break;
+                if (q[-2] != 0xD9) break;
+                i = 5;
+                break;
+            case 0xA7:
+                if (n <= 1) break;
+                if (q[-2] != 0xD8) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x85:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD9) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x83:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD9) break;
+                                i = 6;
+                                break;
+                            case 0x87:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD9) break;
+                                i = 7;
+                                break;
+                        }
+                        break;
+                    case 0x86:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD9) break;
+                        i = 8;
+                        break;
+                    case 0x87:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD9) break;
+                        i = 9;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_10[i].s_size;
+    return a_10[i].result;
+}
+
+static int find_among_b_11(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x86) break;
+        if (n <= 1) break;
+        if (q[-2] != 0xD9) break;
+        i = 0;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_11[i].s_size;
+    return a_11[i].result;
+}
+
+static int find_among_b_16(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x8A) break;
+        if (n <= 1) break;
+        if (q[-2] != 0xD9) break;
+        i = 0;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_16[i].s_size;
+    return a_16[i].result;
+}
+
+static int find_among_b_21(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x89) break;
+        if (n <= 1) break;
+        if (q[-2] != 0xD9) break;
+        i = 0;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_21[i].s_size;
+    return a_21[i].result;
+}
+static const symbol s_0[] = { 0xD9, 0x8A };
+
+static int find_among_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[0] != 0xD8) break;
+        if (n <= 1) break;
+        if (q[1] != 0xA3) break;
+        if (n <= 2) break;
+        if (q[2] != 0xD8) break;
+        if (n <= 3) break;
+        switch (q[3]) {
+            case 0xA2:
+                i = 0;
+                break;
+            case 0xA3:
+                i = 1;
+                break;
+            case 0xA4:
+                i = 2;
+                break;
+            case 0xA5:
+                i = 3;
+                break;
+            case 0xA7:
+                i = 4;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_4[i].s_size;
+    return a_4[i].result;
+}
+static const symbol s_1[] = { 0xD8, 0xA3 };
+static const symbol s_2[] = { 0xD8, 0xA2 };
+static const symbol s_3[] = { 0xD8, 0xA7 };
+static const symbol s_4[] = { 0xD8, 0xA5 };
+
+static int find_among_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[0] != 0xD9) break;
+        if (n <= 1) break;
+        switch (q[1]) {
+            case 0x81:
+                i = 0;
+                break;
+            case 0x88:
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_5[i].s_size;
+    return a_5[i].result;
+}
+static const symbol s_5[] = { 0xD8, 0xA7 };
+
+static int find_among_6(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 0xD8:
+                if (n <= 1) break;
+                switch (q[1]) {
+                    case 0xA7:
+                        if (n <= 2) break;
+                        if (q[2] != 0xD9) break;
+                        if (n <= 3) break;
+                        if (q[3] != 0x84) break;
+                        i = 0;
+                        break;
+                    case 0xA8:
+                        if (n <= 2) break;
+                        if (q[2] != 0xD8) break;
+                        if (n <= 3) break;
+                        if (q[3] != 0xA7) break;
+                        if (n <= 4) break;
+                        if (q[4] != 0xD9) break;
+                        if (n <= 5) break;
+                        if (q[5] != 0x84) break;
+                        i = 1;
+                        break;
+                }
+                break;
+            case 0xD9:
+                if (n <= 1) break;
+                switch (q[1]) {
+                    case 0x83:
+                        if (n <= 2) break;
+                        if (q[2] != 0xD8) break;
+                        if (n <= 3) break;
+                        if (q[3] != 0xA7) break;
+                        if (n <= 4) break;
+                        if (q[4] != 0xD9) break;
+                        if (n <= 5) break;
+                        if (q[5] != 0x84) break;
+                        i = 2;
+                        break;
+                    case 0x84:
+                        if (n <= 2) break;
+                        if (q[2] != 0xD9) break;
+                        if (n <= 3) break;
+                        if (q[3] != 0x84) break;
+                        i = 3;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_6[i].s_size;
+    return a_6[i].result;
+}
+
+static int find_among_7(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 0xD8:
+                if (n <= 1) break;
+                if (q[1] != 0xA8) break;
+                i = 0;
+                if (n <= 2) break;
+                if (q[2] != 0xD8) break;
+                if (n <= 3) break;
+                switch (q[3]) {
+                    case 0xA7:
+                        i = 1;
+                        break;
+                    case 0xA8:
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0xD9:
+                if (n <= 1) break;
+                if (q[1] != 0x83) break;
+                if (n <= 2) break;
+                if (q[2] != 0xD9) break;
+                if (n <= 3) break;
+                if (q[3] != 0x83) break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_7[i].s_size;
+    return a_7[i].result;
+}
+static const symbol s_6[] = { 0xD8, 0xA8 };
+static const symbol s_7[] = { 0xD9, 0x83 };
+
+static const unsigned char a_8_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x40, 0x4, 0x0, 0x0, 0x8, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_8(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[0] != 0xD8) break;
+        if (n <= 1) break;
+        if (q[1] != 0xB3) break;
+        if (n <= 2) break;
+        switch (q[2]) {
+            case 0xD8:
+                if (n <= 3) break;
+                switch (q[3]) {
+                    case 0xA3:
+                        i = 0;
+                        break;
+                    case 0xAA:
+                        i = 1;
+                        break;
+                }
+                break;
+            case 0xD9:
+                if (n <= 3) break;
+                switch (q[3]) {
+                    case 0x86:
+                        i = 2;
+                        break;
+                    case 0x8A:
+                        i = 3;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_8[i].s_size;
+    return a_8[i].result;
+}
+static const symbol s_8[] = { 0xD9, 0x8A };
+static const symbol s_9[] = { 0xD8, 0xAA };
+static const symbol s_10[] = { 0xD9, 0x86 };
+static const symbol s_11[] = { 0xD8, 0xA3 };
+
+static int find_among_9(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 0xD8:
+                if (n <= 1) break;
+                if (q[1] != 0xAA) break;
+                if (n <= 2) break;
+                if (q[2] != 0xD8) break;
+                if (n <= 3) break;
+                if (q[3] != 0xB3) break;
+                if (n <= 4) break;
+                if (q[4] != 0xD8) break;
+                if (n <= 5) break;
+                if (q[5] != 0xAA) break;
+                i = 0;
+                break;
+            case 0xD9:
+                if (n <= 1) break;
+                switch (q[1]) {
+                    case 0x86:
+                        if (n <= 2) break;
+                        if (q[2] != 0xD8) break;
+                        if (n <= 3) break;
+                        if (q[3] != 0xB3) break;
+                        if (n <= 4) break;
+                        if (q[4] != 0xD8) break;
+                        if (n <= 5) break;
+                        if (q[5] != 0xAA) break;
+                        i = 1;
+                        break;
+                    case 0x8A:
+                        if (n <= 2) break;
+                        if (q[2] != 0xD8) break;
+                        if (n <= 3) break;
+                        if (q[3] != 0xB3) break;
+                        if (n <= 4) break;
+                        if (q[4] != 0xD8) break;
+                        if (n <= 5) break;
+                        if (q[5] != 0xAA) break;
+                        i = 2;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_9[i].s_size;
+    return a_9[i].result;
+}
+static const symbol s_12[] = { 0xD8, 0xA7, 0xD8, 0xB3, 0xD8, 0xAA };
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0xA2:
+                if (n <= 1) break;
+                if (q[-2] != 0xD8) break;
+                i = 0;
+                break;
+            case 0xA3:
+                if (n <= 1) break;
+                if (q[-2] != 0xD8) break;
+                i = 1;
+                break;
+            case 0xA4:
+                if (n <= 1) break;
+                if (q[-2] != 0xD8) break;
+                i = 2;
+                break;
+            case 0xA5:
+                if (n <= 1) break;
+                if (q[-2] != 0xD8) break;
+                i = 3;
+                break;
+            case 0xA6:
+                if (n <= 1) break;
+                if (q[-2] != 0xD8) break;
+                i = 4;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+static const symbol s_13[] = { 0xD8, 0xA1 };
+
+static int r_Suffix_Noun_Step2a(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c - 1 <= z->lb || !((a_12_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 216 && z->p[z->c - 2] != 217)) return 0;
+    if (!(find_among_b_12(z))) return 0;
+    z->bra = z->c;
+    if (!(lenof_utf8(z, z->p) > 4)) return 0;
+    {   int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_Suffix_Noun_Step2b(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c - 3 <= z->lb || z->p[z->c - 1] != 170 || z->p[z->c - 2] != 216) return 0;
+    if (!(find_among_b_13(z))) return 0;
+    z->bra = z->c;
+    if (!(lenof_utf8(z, z->p) >= 5)) return 0;
+    {   int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_Suffix_Noun_Step2c1(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c - 1 <= z->lb || z->p[z->c - 1] != 170 || z->p[z->c - 2] != 216) return 0;
+    if (!(find_among_b_14(z))) return 0;
+    z->bra = z->c;
+    if (!(lenof_utf8(z, z->p) >= 4)) return 0;
+    {   int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_Suffix_Verb_Step2a(struct SN_env * z) {
+    int among_var;
+    z->ket = z->c;
+    if (z->c - 1 <= z->lb || !((a_18_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 216 && z->p[z->c - 2] != 217)) return 0;
+    among_var = find_among_b_18(z);
+    if (!(among_var)) return 0;
+    z->bra = z->c;
+    switch (among_var) {
+        case 1:
+            if (!(lenof_utf8(z, z->p) >= 4)) return 0;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 2:
+            if (!(lenof_utf8(z, z->p) >= 5)) return 0;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 3:
+            if (!(lenof_utf8(z, z->p) > 5)) return 0;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 4:
+            if (!(lenof_utf8(z, z->p) >= 6)) return 0;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            break;
+    }
+    return 1;
+}
+
+extern int arabic_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    z->I[2] = 1;
+    z->I[1] = 1;
+    z->I[0] = 0;
+    {   int c1 = z->c;
+        z->bra = z->c;
+        if (z->c + 3 >= z->l || (z->p[z->c + 3] != 132 && z->p[z->c + 3] != 167)) goto lab0;
+        among_var = find_among_3(z);
+        if (!(among_var)) goto lab0;
+        z->ket = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(lenof_utf8(z, z->p) > 4)) goto lab0;
+                z->I[2] = 1;
+                z->I[1] = 0;
+                z->I[0] = 1;
+                break;
+            case 2:
+                if (!(lenof_utf8(z, z->p) > 3)) goto lab0;
+                z->I[2] = 1;
+                z->I[1] = 0;
+                z->I[0] = 1;
+                break;
+        }
+    lab0:
+        z->c = c1;
+    }
+    
+    {   int c2 = z->c;
+        {   int ret = translate_U(z, &a_0_translation);
+            if (ret < 0) return ret;
+        }
+        z->c = c2;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m3 = z->l - z->c; (void)m3;
+        {   int m4 = z->l - z->c; (void)m4;
+            if (!(z->I[1])) goto lab5;
+            {   int m5 = z->l - z->c; (void)m5;
+                {   int i = 1;
+                    while(1) {
+                        int m6 = z->l - z->c; (void)m6;
+                        z->ket = z->c;
+                        if (z->c - 1 <= z->lb || !((a_17_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 216 && z->p[z->c - 2] != 217)) goto lab8;
+                        among_var = find_among_b_17(z);
+                        if (!(among_var)) goto lab8;
+                        z->bra = z->c;
+                        switch (among_var) {
+                            case 1:
+                                if (!(lenof_utf8(z, z->p) >= 4)) goto lab8;
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                break;
+                            case 2:
+                                if (!(lenof_utf8(z, z->p) >= 5)) goto lab8;
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                break;
+                            case 3:
+                                if (!(lenof_utf8(z, z->p) >= 6)) goto lab8;
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                break;
+                        }
+                        i--;
+                        continue;
+                    lab8:
+                        z->c = z->l - m6;
+                        break;
+                    }
+                    if (i > 0) goto lab7;
+                }
+                {   int m7 = z->l - z->c; (void)m7;
+                    {   int ret = r_Suffix_Verb_Step2a(z);
+                        if (ret == 0) goto lab10;
+                        if (ret < 0) return ret;
+                    }
+                    goto lab9;
+                lab10:
+                    z->c = z->l - m7;
+                    z->ket = z->c;
+                    if (z->c - 1 <= z->lb || z->p[z->c - 1] != 136 || z->p[z->c - 2] != 217) goto lab11;
+                    among_var = find_among_b_20(z);
+                    if (!(among_var)) goto lab11;
+                    z->bra = z->c;
+                    switch (among_var) {
+                        case 1:
+                            if (!(lenof_utf8(z, z->p) >= 4)) goto lab11;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 2:
+                            if (!(lenof_utf8(z, z->p) >= 6)) goto lab11;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                    }
+                    goto lab9;
+                lab11:
+                    z->c = z->l - m7;
+                    {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+                        if (ret < 0) goto lab7;
+                        z->c = ret;
+                    }
+                }
+            lab9:
+                goto lab6;
+            lab7:
+                z->c = z->l - m5;
+                z->ket = z->c;
+                if (z->c - 3 <= z->lb || (z->p[z->c - 1] != 133 && z->p[z->c - 1] != 167) || (z->p[z->c - 2] != 216 && z->p[z->c - 2] != 217)) goto lab12;
+                if (!(find_among_b_19(z))) goto lab12;
+                z->bra = z->c;
+                if (!(lenof_utf8(z, z->p) >= 5)) goto lab12;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                goto lab6;
+            lab12:
+                z->c = z->l - m5;
+                {   int ret = r_Suffix_Verb_Step2a(z);
+                    if (ret == 0) goto lab5;
+                    if (ret < 0) return ret;
+                }
+            }
+        lab6:
+            goto lab4;
+        lab5:
+            z->c = z->l - m4;
+            if (!(z->I[2])) goto lab13;
+            {   int m8 = z->l - z->c; (void)m8;
+                {   int m9 = z->l - z->c; (void)m9;
+                    z->ket = z->c;
+                    if (z->c - 1 <= z->lb || z->p[z->c - 1] != 169 || z->p[z->c - 2] != 216) goto lab16;
+                    if (!(find_among_b_15(z))) goto lab16;
+                    z->bra = z->c;
+                    if (!(lenof_utf8(z, z->p) >= 4)) goto lab16;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab15;
+                lab16:
+                    z->c = z->l - m9;
+                    
+                    if (!(z->I[0])) goto lab18;
+                    goto lab17;
+                lab18:
+                    z->ket = z->c;
+                    if (z->c - 1 <= z->lb || !((a_10_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 216 && z->p[z->c - 2] != 217)) goto lab17;
+                    among_var = find_among_b_10(z);
+                    if (!(among_var)) goto lab17;
+                    z->bra = z->c;
+                    switch (among_var) {
+                        case 1:
+                            if (!(lenof_utf8(z, z->p) >= 4)) goto lab17;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 2:
+                            if (!(lenof_utf8(z, z->p) >= 5)) goto lab17;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 3:
+                            if (!(lenof_utf8(z, z->p) >= 6)) goto lab17;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                    }
+                    {   int m10 = z->l - z->c; (void)m10;
+                        {   int ret = r_Suffix_Noun_Step2a(z);
+                            if (ret == 0) goto lab20;
+                            if (ret < 0) return ret;
+                        }
+                        goto lab19;
+                    lab20:
+                        z->c = z->l - m10;
+                        {   int ret = r_Suffix_Noun_Step2b(z);
+                            if (ret == 0) goto lab21;
+                            if (ret < 0) return ret;
+                        }
+                        goto lab19;
+                    lab21:
+                        z->c = z->l - m10;
+                        {   int ret = r_Suffix_Noun_Step2c1(z);
+                            if (ret == 0) goto lab22;
+                            if (ret < 0) return ret;
+                        }
+                        goto lab19;
+                    lab22:
+                        z->c = z->l - m10;
+                        {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+                            if (ret < 0) goto lab17;
+                            z->c = ret;
+                        }
+                    }
+                lab19:
+                    goto lab15;
+                lab17:
+                    z->c = z->l - m9;
+                    z->ket = z->c;
+                    if (z->c - 1 <= z->lb || z->p[z->c - 1] != 134 || z->p[z->c - 2] != 217) goto lab23;
+                    if (!(find_among_b_11(z))) goto lab23;
+                    z->bra = z->c;
+                    if (!(lenof_utf8(z, z->p) > 5)) goto lab23;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int m11 = z->l - z->c; (void)m11;
+                        {   int ret = r_Suffix_Noun_Step2a(z);
+                            if (ret == 0) goto lab25;
+                            if (ret < 0) return ret;
+                        }
+                        goto lab24;
+                    lab25:
+                        z->c = z->l - m11;
+                        {   int ret = r_Suffix_Noun_Step2b(z);
+                            if (ret == 0) goto lab26;
+                            if (ret < 0) return ret;
+                        }
+                        goto lab24;
+                    lab26:
+                        z->c = z->l - m11;
+                        {   int ret = r_Suffix_Noun_Step2c1(z);
+                            if (ret == 0) goto lab23;
+                            if (ret < 0) return ret;
+                        }
+                    }
+                lab24:
+                    goto lab15;
+                lab23:
+                    z->c = z->l - m9;
+                    
+                    if (!(z->I[0])) goto lab28;
+                    goto lab27;
+                lab28:
+                    {   int ret = r_Suffix_Noun_Step2a(z);
+                        if (ret == 0) goto lab27;
+                        if (ret < 0) return ret;
+                    }
+                    goto lab15;
+                lab27:
+                    z->c = z->l - m9;
+                    {   int ret = r_Suffix_Noun_Step2b(z);
+                        if (ret == 0) { z->c = z->l - m8; goto lab14; }
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab15:
+            lab14:
+                ;
+            }
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb || z->p[z->c - 1] != 138 || z->p[z->c - 2] != 217) goto lab13;
+            if (!(find_among_b_16(z))) goto lab13;
+            z->bra = z->c;
+            if (!(lenof_utf8(z, z->p) >= 3)) goto lab13;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            goto lab4;
+        lab13:
+            z->c = z->l - m4;
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb || z->p[z->c - 1] != 137 || z->p[z->c - 2] != 217) goto lab3;
+            if (!(find_among_b_21(z))) goto lab3;
+            z->bra = z->c;
+            {   int ret = slice_from_s(z, 2, s_0);
+                if (ret < 0) return ret;
+            }
+        }
+    lab4:
+    lab3:
+        z->c = z->l - m3;
+    }
+    z->c = z->lb;
+    {   int c12 = z->c;
+        {   int c13 = z->c;
+            z->bra = z->c;
+            if (z->c + 3 >= z->l || z->p[z->c + 3] >> 5 != 5 || !((188 >> (z->p[z->c + 3] & 0x1f)) & 1)) { z->c = c13; goto lab30; }
+            among_var = find_among_4(z);
+            if (!(among_var)) { z->c = c13; goto lab30; }
+            z->ket = z->c;
+            switch (among_var) {
+                case 1:
+                    if (!(lenof_utf8(z, z->p) > 3)) { z->c = c13; goto lab30; }
+                    {   int ret = slice_from_s(z, 2, s_1);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    if (!(lenof_utf8(z, z->p) > 3)) { z->c = c13; goto lab30; }
+                    {   int ret = slice_from_s(z, 2, s_2);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 3:
+                    if (!(lenof_utf8(z, z->p) > 3)) { z->c = c13; goto lab30; }
+                    {   int ret = slice_from_s(z, 2, s_3);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 4:
+                    if (!(lenof_utf8(z, z->p) > 3)) { z->c = c13; goto lab30; }
+                    {   int ret = slice_from_s(z, 2, s_4);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+        lab30:
+            ;
+        }
+        {   int c14 = z->c;
+            z->bra = z->c;
+            if (z->c + 1 >= z->l || (z->p[z->c + 1] != 129 && z->p[z->c + 1] != 136)) { z->c = c14; goto lab31; }
+            if (!(find_among_5(z))) { z->c = c14; goto lab31; }
+            z->ket = z->c;
+            if (!(lenof_utf8(z, z->p) > 3)) { z->c = c14; goto lab31; }
+            {   int c15 = z->c;
+                if (!(eq_s(z, 2, s_5))) goto lab32;
+                { z->c = c14; goto lab31; }
+            lab32:
+                z->c = c15;
+            }
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        lab31:
+            ;
+        }
+        {   int c16 = z->c;
+            z->bra = z->c;
+            if (z->c + 3 >= z->l || (z->p[z->c + 3] != 132 && z->p[z->c + 3] != 167)) goto lab34;
+            among_var = find_among_6(z);
+            if (!(among_var)) goto lab34;
+            z->ket = z->c;
+            switch (among_var) {
+                case 1:
+                    if (!(lenof_utf8(z, z->p) > 5)) goto lab34;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    if (!(lenof_utf8(z, z->p) > 4)) goto lab34;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+            goto lab33;
+        lab34:
+            z->c = c16;
+            if (!(z->I[2])) goto lab35;
+            z->bra = z->c;
+            if (z->c + 1 >= z->l || (z->p[z->c + 1] != 131 && z->p[z->c + 1] != 168)) goto lab35;
+            among_var = find_among_7(z);
+            if (!(among_var)) goto lab35;
+            z->ket = z->c;
+            switch (among_var) {
+                case 1:
+                    if (!(lenof_utf8(z, z->p) > 3)) goto lab35;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    if (!(lenof_utf8(z, z->p) > 3)) goto lab35;
+                    {   int ret = slice_from_s(z, 2, s_6);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 3:
+                    if (!(lenof_utf8(z, z->p) > 3)) goto lab35;
+                    {   int ret = slice_from_s(z, 2, s_7);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+            goto lab33;
+        lab35:
+            z->c = c16;
+            if (!(z->I[1])) goto lab29;
+            {   int c17 = z->c;
+                z->bra = z->c;
+                if (z->c + 3 >= z->l || !((a_8_filter0[z->p[z->c + 3] >> 3] >> (z->p[z->c + 3] & 7)) & 1)) { z->c = c17; goto lab36; }
+                among_var = find_among_8(z);
+                if (!(among_var)) { z->c = c17; goto lab36; }
+                z->ket = z->c;
+                switch (among_var) {
+                    case 1:
+                        if (!(lenof_utf8(z, z->p) > 4)) { z->c = c17; goto lab36; }
+                        {   int ret = slice_from_s(z, 2, s_8);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        if (!(lenof_utf8(z, z->p) > 4)) { z->c = c17; goto lab36; }
+                        {   int ret = slice_from_s(z, 2, s_9);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 3:
+                        if (!(lenof_utf8(z, z->p) > 4)) { z->c = c17; goto lab36; }
+                        {   int ret = slice_from_s(z, 2, s_10);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 4:
+                        if (!(lenof_utf8(z, z->p) > 4)) { z->c = c17; goto lab36; }
+                        {   int ret = slice_from_s(z, 2, s_11);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+            lab36:
+                ;
+            }
+            z->bra = z->c;
+            if (z->c + 5 >= z->l || z->p[z->c + 5] != 170) goto lab29;
+            if (!(find_among_9(z))) goto lab29;
+            z->ket = z->c;
+            if (!(lenof_utf8(z, z->p) > 4)) goto lab29;
+            z->I[1] = 1;
+            z->I[2] = 0;
+            {   int ret = slice_from_s(z, 6, s_12);
+                if (ret < 0) return ret;
+            }
+        }
+    lab33:
+    lab29:
+        z->c = c12;
+    }
+    
+    {   int c18 = z->c;
+        z->lb = z->c; z->c = z->l;
+
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 5 || !((124 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] != 216) goto lab38;
+        if (!(find_among_b_1(z))) goto lab38;
+        z->bra = z->c;
+        {   int ret = slice_from_s(z, 2, s_13);
+            if (ret < 0) return ret;
+        }
+        z->c = z->lb;
+    lab38:
+        z->c = c18;
+    }
+    {   int c19 = z->c;
+        {   int ret = translate_U(z, &a_2_translation);
+            if (ret < 0) return ret;
+        }
+        z->c = c19;
+    }
+    return 1;
+}
+
+extern struct SN_env * arabic_UTF_8_create_env(void) { return SN_create_env(0, 3); }
+
+extern void arabic_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
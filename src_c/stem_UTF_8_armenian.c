@@ -0,0 +1,2271 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int armenian_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * armenian_UTF_8_create_env(void);
+extern void armenian_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[23] =
+{
+{ 0, 6, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 10, 1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, 10, 1 },
+{ 0, 8, 10, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 14, 1 },
+{ 0, 8, 14, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 }
+};
+
+
+static const struct among a_1[71] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 8, 0, 1 },
+{ 0, 8, 0, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 10, 5, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 10, 10, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 14, 1 },
+{ 0, 8, 15, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 10, 19, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 8, 21, 1 },
+{ 0, 10, 22, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 12, 26, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 6, 28, 1 },
+{ 0, 6, 28, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 8, 34, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 36, 1 },
+{ 0, 10, 36, 1 },
+{ 0, 8, 36, 1 },
+{ 0, 8, 36, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 41, 1 },
+{ 0, 6, 41, 1 },
+{ 0, 8, 43, 1 },
+{ 0, 10, 44, 1 },
+{ 0, 6, 41, 1 },
+{ 0, 6, 41, 1 },
+{ 0, 10, 47, 1 },
+{ 0, 10, 47, 1 },
+{ 0, 6, 41, 1 },
+{ 0, 8, 50, 1 },
+{ 0, 8, 50, 1 },
+{ 0, 10, 52, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 8, 55, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 57, 1 },
+{ 0, 8, 58, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 10, 62, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, 66, 1 },
+{ 0, 8, 66, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 }
+};
+
+
+static const struct among a_2[40] =
+{
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 8, 1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 6, 6, 1 },
+{ 0, 6, 6, 1 },
+{ 0, 4, 6, 1 },
+{ 0, 8, 9, 1 },
+{ 0, 8, 9, 1 },
+{ 0, 8, 6, 1 },
+{ 0, 8, 6, 1 },
+{ 0, 8, 6, 1 },
+{ 0, 10, 14, 1 },
+{ 0, 6, 6, 1 },
+{ 0, 6, 6, 1 },
+{ 0, 6, 6, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 25, 1 },
+{ 0, 8, 25, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 14, 29, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, 31, 1 },
+{ 0, 6, 31, 1 },
+{ 0, 8, 31, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 8, -1, 1 }
+};
+
+
+static const struct among a_3[57] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 6, 0, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 6, 2, 1 },
+{ 0, 4, 2, 1 },
+{ 0, 8, 4, 1 },
+{ 0, 10, 5, 1 },
+{ 0, 6, 4, 1 },
+{ 0, 10, 4, 1 },
+{ 0, 8, 4, 1 },
+{ 0, 6, 4, 1 },
+{ 0, 4, 2, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 6, 15, 1 },
+{ 0, 8, 16, 1 },
+{ 0, 6, 15, 1 },
+{ 0, 6, 15, 1 },
+{ 0, 14, 19, 1 },
+{ 0, 8, 19, 1 },
+{ 0, 6, 15, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 6, 23, 1 },
+{ 0, 8, 24, 1 },
+{ 0, 6, 23, 1 },
+{ 0, 14, 26, 1 },
+{ 0, 8, 26, 1 },
+{ 0, 6, 23, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 6, 30, 1 },
+{ 0, 8, 31, 1 },
+{ 0, 4, 30, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 12, 34, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 6, 37, 1 },
+{ 0, 8, 38, 1 },
+{ 0, 6, 37, 1 },
+{ 0, 4, 37, 1 },
+{ 0, 12, 41, 1 },
+{ 0, 6, 41, 1 },
+{ 0, 4, 37, 1 },
+{ 0, 8, 44, 1 },
+{ 0, 10, 45, 1 },
+{ 0, 14, 37, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 14, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, 52, 1 },
+{ 0, 10, 53, 1 },
+{ 0, 8, 52, 1 },
+{ 0, 6, 52, 1 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v[] = { 209, 4, 128, 0, 18 };
+
+
+static const unsigned char a_3_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x0, 0x0, 0x0, 0x16, 0x9, 0x50, 0x68, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xD6) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xA5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                i = 0;
+                if (n <= 4) break;
+                if (q[-5] != 0xB6) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD5) break;
+                i = 1;
+                break;
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xD6) break;
+                i = 2;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x82:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD6) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB8) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 3;
+                        break;
+                    case 0xAB:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 4;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x80:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD6) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xA5) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 5;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xB6) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD5) break;
+                                i = 6;
+                                break;
+                            case 0x81:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD6) break;
+                                i = 7;
+                                break;
+                            case 0xB6:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xA1) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xBE) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD5) break;
+                                i = 8;
+                                break;
+                            case 0xBB:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB8) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 9;
+                                break;
+                            case 0xBE:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                i = 10;
+                                break;
+                        }
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 11;
+                        break;
+                }
+                break;
+            case 0xA1:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xBD:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 12;
+                        break;
+                    case 0xBE:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 13;
+                        break;
+                }
+                break;
+            case 0xA2:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB4) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xA1) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD5) break;
+                i = 14;
+                break;
+            case 0xA4:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                i = 15;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x80:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD6) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA5) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 16;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB6) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 17;
+                        break;
+                    case 0x82:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD6) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB8) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 18;
+                        break;
+                    case 0xB6:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 19;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0xB5:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xA9) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD5) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0x82) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xD6) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xB8) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xD5) break;
+                                i = 20;
+                                break;
+                            case 0xBE:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 21;
+                                break;
+                        }
+                        break;
+                    case 0xBB:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB8) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 22;
+                        break;
+                }
+                break;
+            case 0xA8:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                i = 23;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x80:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD6) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA5) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 24;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB6) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 25;
+                        break;
+                    case 0xB6:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 26;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0xB5:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xA9) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD5) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0x82) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xD6) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xB8) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xD5) break;
+                                i = 27;
+                                break;
+                            case 0xBE:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 28;
+                                break;
+                        }
+                        break;
+                    case 0xBB:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB8) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 29;
+                        break;
+                }
+                break;
+            case 0xAB:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                i = 30;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x80:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD6) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA5) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 31;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB6) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 32;
+                        break;
+                    case 0xBE:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 33;
+                        break;
+                }
+                break;
+            case 0xB4:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x82) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD6) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB8) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD5) break;
+                if (n <= 6) break;
+                switch (q[-7]) {
+                    case 0x80:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD6) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xA5) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xD5) break;
+                        i = 34;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xB6) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xD5) break;
+                        i = 35;
+                        break;
+                    case 0xB6:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xA1) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xD5) break;
+                        i = 36;
+                        break;
+                }
+                break;
+            case 0xB6:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                i = 37;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x80:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD6) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA5) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 38;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB6) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 39;
+                        break;
+                    case 0x82:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD6) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB8) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 40;
+                        break;
+                    case 0xA1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 41;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0xB5:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xA9) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0x82) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD6) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xB8) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xD5) break;
+                                i = 42;
+                                break;
+                            case 0xBE:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                i = 43;
+                                break;
+                        }
+                        break;
+                    case 0xAB:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 44;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x80) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD6) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA5) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 45;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB6) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xD5) break;
+                        i = 46;
+                        break;
+                    case 0xB6:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB5) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xA9) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xD5) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0x82) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xD6) break;
+                        if (n <= 12) break;
+                        if (q[-13] != 0xB8) break;
+                        if (n <= 13) break;
+                        if (q[-14] != 0xD5) break;
+                        i = 47;
+                        break;
+                }
+                break;
+            case 0xBB:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB8) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                i = 48;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xB6:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0xB5:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xA9) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD5) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0x82) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xD6) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xB8) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xD5) break;
+                                i = 49;
+                                break;
+                            case 0xBE:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 50;
+                                break;
+                        }
+                        break;
+                    case 0xBB:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB8) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 51;
+                        break;
+                }
+                break;
+            case 0xBE:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB8) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                i = 52;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x80:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD6) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA5) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 53;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB6) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xD5) break;
+                        i = 54;
+                        break;
+                    case 0xB6:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA1) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 55;
+                        break;
+                    case 0xBE:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 56;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+
+static const unsigned char a_1_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x17, 0x0, 0x0, 0x0, 0x22, 0x58, 0x50, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xD6) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xA1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 0;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x81) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD6) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0xA1:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 1;
+                                break;
+                            case 0xA5:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 2;
+                                break;
+                        }
+                        break;
+                    case 0xAB:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x80:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD6) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x81) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD6) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xA1) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD5) break;
+                                i = 3;
+                                break;
+                            case 0x81:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD6) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0xA1:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD5) break;
+                                        i = 4;
+                                        break;
+                                    case 0xA5:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD5) break;
+                                        i = 5;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xBE) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xD5) break;
+                                        i = 6;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xD6) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x82:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD6) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB8) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xAC) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        if (n <= 8) break;
+                        switch (q[-9]) {
+                            case 0xA1:
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD5) break;
+                                i = 7;
+                                break;
+                            case 0xA5:
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD5) break;
+                                i = 8;
+                                break;
+                        }
+                        break;
+                    case 0xA1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 9;
+                        break;
+                    case 0xA5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 10;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x80) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD6) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x81) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD6) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xA1) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xD5) break;
+                        i = 11;
+                        break;
+                }
+                break;
+            case 0x82:
+                if (n <= 1) break;
+                if (q[-2] != 0xD6) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB8) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xAC) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD5) break;
+                if (n <= 6) break;
+                switch (q[-7]) {
+                    case 0xA1:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 12;
+                        break;
+                    case 0xA5:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 13;
+                        break;
+                }
+                break;
+            case 0x84:
+                if (n <= 1) break;
+                if (q[-2] != 0xD6) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xA1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 14;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x81) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD6) break;
+                        i = 15;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA1) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 16;
+                        break;
+                    case 0xAB:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x80:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD6) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x81) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD6) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xA1) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD5) break;
+                                i = 17;
+                                break;
+                            case 0x81:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD6) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0xA1:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD5) break;
+                                        i = 18;
+                                        break;
+                                    case 0xA5:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD5) break;
+                                        i = 19;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xBE) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xD5) break;
+                                        i = 20;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0xB6:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0xA1:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                i = 21;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x81) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD6) break;
+                                i = 22;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xA1) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD5) break;
+                                i = 23;
+                                break;
+                            case 0xAB:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x80:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD6) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0x81) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xD6) break;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA1) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xD5) break;
+                                        i = 24;
+                                        break;
+                                    case 0x81:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD6) break;
+                                        if (n <= 8) break;
+                                        switch (q[-9]) {
+                                            case 0xA1:
+                                                if (n <= 9) break;
+                                                if (q[-10] != 0xD5) break;
+                                                i = 25;
+                                                break;
+                                            case 0xA5:
+                                                if (n <= 9) break;
+                                                if (q[-10] != 0xD5) break;
+                                                i = 26;
+                                                if (n <= 10) break;
+                                                if (q[-11] != 0xBE) break;
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xD5) break;
+                                                i = 27;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0xA1:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                i = 28;
+                if (n <= 2) break;
+                if (q[-3] != 0x81) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD6) break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0xA1:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 29;
+                        break;
+                    case 0xA5:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 30;
+                        break;
+                }
+                break;
+            case 0xA5:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBE) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                i = 31;
+                break;
+            case 0xAB:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x80:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD6) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x81) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD6) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA1) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 32;
+                        break;
+                    case 0x81:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD6) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0xA1:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                i = 33;
+                                break;
+                            case 0xA5:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                i = 34;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xBE) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 35;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0xAC:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xA1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 36;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0xA8:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                i = 37;
+                                break;
+                            case 0xB6:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x81:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD6) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xA1) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xD5) break;
+                                        i = 38;
+                                        break;
+                                    case 0xA1:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD5) break;
+                                        i = 39;
+                                        break;
+                                    case 0xA5:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD5) break;
+                                        i = 40;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0xA5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 41;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0xA8:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                i = 42;
+                                break;
+                            case 0xB6:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                i = 43;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x81) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD6) break;
+                                i = 44;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xA5) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD5) break;
+                                i = 45;
+                                break;
+                            case 0xB9:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                i = 46;
+                                break;
+                            case 0xBE:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                i = 47;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x81) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD6) break;
+                                if (n <= 8) break;
+                                switch (q[-9]) {
+                                    case 0xA1:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xD5) break;
+                                        i = 48;
+                                        break;
+                                    case 0xA5:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xD5) break;
+                                        i = 49;
+                                        break;
+                                }
+                                break;
+                            case 0xBF:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                i = 50;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0xA1:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD5) break;
+                                        i = 51;
+                                        break;
+                                    case 0xB8:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD5) break;
+                                        i = 52;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xAF) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xD5) break;
+                                        i = 53;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0xAE:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xA1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBE) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD5) break;
+                i = 54;
+                break;
+            case 0xB4:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x82) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD6) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB8) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD5) break;
+                i = 55;
+                if (n <= 6) break;
+                if (q[-7] != 0xBE) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xD5) break;
+                i = 56;
+                break;
+            case 0xB6:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xA1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 57;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x81) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD6) break;
+                        i = 58;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA1) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 59;
+                        break;
+                    case 0xAB:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x80:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD6) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x81) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD6) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xA1) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD5) break;
+                                i = 60;
+                                break;
+                            case 0x81:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD6) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0xA1:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD5) break;
+                                        i = 61;
+                                        break;
+                                    case 0xA5:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD5) break;
+                                        i = 62;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xBE) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xD5) break;
+                                        i = 63;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xAB) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xAC) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD5) break;
+                if (n <= 6) break;
+                switch (q[-7]) {
+                    case 0xA1:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 64;
+                        break;
+                    case 0xA5:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 65;
+                        break;
+                }
+                break;
+            case 0xBE:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xA1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 66;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x81) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD6) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0xA1:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 67;
+                                break;
+                            case 0xA5:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 68;
+                                break;
+                        }
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xAC) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0xA1:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 69;
+                                break;
+                            case 0xA5:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 70;
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+
+static const unsigned char a_0_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x0, 0x0, 0x0, 0x10, 0x88, 0x44, 0xE0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xD6) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xA1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xA2) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD5) break;
+                i = 0;
+                break;
+            case 0xA4:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x80) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD6) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB8) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD5) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x80) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xD6) break;
+                i = 1;
+                if (n <= 8) break;
+                if (q[-9] != 0xA5) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xD5) break;
+                i = 2;
+                break;
+            case 0xAB:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xAC:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 3;
+                        break;
+                    case 0xAF:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 0xAF:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xA1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x80) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD6) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB8) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xD5) break;
+                i = 5;
+                break;
+            case 0xB2:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xA5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                i = 6;
+                break;
+            case 0xB6:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x82:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD6) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB8) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBE) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 7;
+                        break;
+                    case 0xA1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x80:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD6) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xA1) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 8;
+                                break;
+                            case 0xAF:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xA1) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 9;
+                                break;
+                        }
+                        break;
+                    case 0xA5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 10;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x80:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD6) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xA5) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 11;
+                                break;
+                            case 0xAF:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xA5) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 12;
+                                break;
+                        }
+                        break;
+                    case 0xA7:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x80) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD6) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB8) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 13;
+                        break;
+                    case 0xAB:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 14;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0xA3:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                i = 15;
+                                break;
+                            case 0xBE:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB8) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 16;
+                                break;
+                        }
+                        break;
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xAC) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 17;
+                        break;
+                }
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xA5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBA) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD5) break;
+                i = 18;
+                break;
+            case 0xBE:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xAB) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                i = 19;
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xA1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 20;
+                        break;
+                    case 0xA5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xBE) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA1) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 21;
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xAF) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 22;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_0[i].s_size;
+    return a_0[i].result;
+}
+
+static const unsigned char a_2_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x17, 0x0, 0x0, 0x0, 0x10, 0x9A, 0x40, 0xA3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xD6) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xA1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA3) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 0;
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xBE) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 1;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA1) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xD6) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x85:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD6) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB6) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA1) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 3;
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 0x82:
+                if (n <= 1) break;
+                if (q[-2] != 0xD6) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB8) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                i = 5;
+                break;
+            case 0x84:
+                if (n <= 1) break;
+                if (q[-2] != 0xD6) break;
+                i = 6;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x80:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD6) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 7;
+                        break;
+                    case 0xA5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB9) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 8;
+                        break;
+                    case 0xAB:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 9;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0xAC:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xA1) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 10;
+                                break;
+                            case 0xB6:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xA1) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 11;
+                                break;
+                        }
+                        break;
+                    case 0xAE:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBE) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 12;
+                        break;
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x82) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD6) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB8) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 13;
+                        break;
+                    case 0xB6:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x82:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD6) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB8) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 14;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xB4) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD5) break;
+                                i = 15;
+                                break;
+                            case 0xA5:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                i = 16;
+                                break;
+                            case 0xB8:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                i = 17;
+                                break;
+                        }
+                        break;
+                    case 0xB9:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xAB) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 18;
+                        break;
+                }
+                break;
+            case 0xA4:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x80) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD6) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB8) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD5) break;
+                i = 19;
+                break;
+            case 0xA9:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x82) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD6) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB8) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xD5) break;
+                i = 20;
+                break;
+            case 0xAB:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x81:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD6) break;
+                        i = 21;
+                        break;
+                    case 0xB0:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x82) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD6) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB8) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 22;
+                        break;
+                }
+                break;
+            case 0xAC:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xAB) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                i = 23;
+                break;
+            case 0xAF:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x82:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD6) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB8) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        i = 24;
+                        break;
+                    case 0xA1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 25;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0xB5:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                i = 26;
+                                break;
+                            case 0xB6:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xA1) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 27;
+                                break;
+                        }
+                        break;
+                    case 0xAB:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 28;
+                        break;
+                }
+                break;
+            case 0xB6:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x82:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD6) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB8) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB5) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 29;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xA9) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xD5) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0x82) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xD6) break;
+                        if (n <= 12) break;
+                        if (q[-13] != 0xB8) break;
+                        if (n <= 13) break;
+                        if (q[-14] != 0xD5) break;
+                        i = 30;
+                        break;
+                    case 0xA1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        i = 31;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x80:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD6) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xA1) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 32;
+                                break;
+                            case 0xBA:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                i = 33;
+                                break;
+                            case 0xBF:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD5) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xBD) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD5) break;
+                                i = 34;
+                                break;
+                        }
+                        break;
+                    case 0xA7:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB2) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD5) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA5) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD5) break;
+                        i = 35;
+                        break;
+                }
+                break;
+            case 0xB8:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xAE) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xA1) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD5) break;
+                i = 36;
+                break;
+            case 0xB9:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xAB) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                i = 37;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x82) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD6) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB8) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD5) break;
+                i = 38;
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xD5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBD) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD5) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x82) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD6) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB8) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xD5) break;
+                i = 39;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+
+extern int armenian_UTF_8_stem(struct SN_env * z) {
+    
+    z->I[1] = z->l;
+    z->I[0] = z->l;
+    {   int c1 = z->c;
+        {   
+            int ret = out_class_U(z, g_v_class, g_v, 1377, 1413, 1);
+            if (ret < 0) goto lab1;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+        {   
+            int ret = in_class_U(z, g_v_class, g_v, 1377, 1413, 1);
+            if (ret < 0) goto lab1;
+            z->c += ret;
+        }
+        {   
+            int ret = out_class_U(z, g_v_class, g_v, 1377, 1413, 1);
+            if (ret < 0) goto lab1;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_U(z, g_v_class, g_v, 1377, 1413, 1);
+            if (ret < 0) goto lab1;
+            z->c += ret;
+        }
+        z->I[0] = z->c;
+    lab1:
+        z->c = c1;
+    }
+    z->lb = z->c; z->c = z->l;
+
+
+    {   int mlimit2;
+        if (z->c < z->I[1]) return 0;
+        mlimit2 = z->lb; z->lb = z->I[1];
+        {   int m3 = z->l - z->c; (void)m3;
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb || !((a_3_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 213 && z->p[z->c - 2] != 214)) goto lab2;
+            if (!(find_among_b_3(z))) goto lab2;
+            z->bra = z->c;
+            if (!(z->I[0] <= z->c)) goto lab2;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        lab2:
+            z->c = z->l - m3;
+        }
+        {   int m4 = z->l - z->c; (void)m4;
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb || !((a_1_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 213 && z->p[z->c - 2] != 214)) goto lab3;
+            if (!(find_among_b_1(z))) goto lab3;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        lab3:
+            z->c = z->l - m4;
+        }
+        {   int m5 = z->l - z->c; (void)m5;
+            z->ket = z->c;
+            if (z->c - 3 <= z->lb || !((a_0_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 213 && z->p[z->c - 2] != 214)) goto lab4;
+            if (!(find_among_b_0(z))) goto lab4;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        lab4:
+            z->c = z->l - m5;
+        }
+        {   int m6 = z->l - z->c; (void)m6;
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb || !((a_2_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 213 && z->p[z->c - 2] != 214)) goto lab5;
+            if (!(find_among_b_2(z))) goto lab5;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        lab5:
+            z->c = z->l - m6;
+        }
+        z->lb = mlimit2;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * armenian_UTF_8_create_env(void) { return SN_create_env(0, 2); }
+
+extern void armenian_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
@@ -0,0 +1,3154 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int basque_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * basque_UTF_8_create_env(void);
+extern void basque_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[109] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 5, 0, 1 },
+{ 0, 5, 0, 1 },
+{ 0, 5, 0, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, 12, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 2 },
+{ 0, 6, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 17, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, 23, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 28, 1 },
+{ 0, 7, 29, 4 },
+{ 0, 4, 28, 1 },
+{ 0, 4, 28, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 33, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 39, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, 42, 1 },
+{ 0, 3, -1, 2 },
+{ 0, 6, 44, 1 },
+{ 0, 6, 44, 1 },
+{ 0, 6, 44, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 48, 1 },
+{ 0, 4, 48, 1 },
+{ 0, 4, 48, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 55, 1 },
+{ 0, 5, 55, 1 },
+{ 0, 6, 55, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 61, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 64, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 67, 1 },
+{ 0, 4, 67, 1 },
+{ 0, 4, 67, 1 },
+{ 0, 5, 70, 1 },
+{ 0, 5, -1, 2 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, 74, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 76, 1 },
+{ 0, 4, 77, 1 },
+{ 0, 3, 76, 1 },
+{ 0, 4, 76, 1 },
+{ 0, 7, -1, 3 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 84, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 86, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 90, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 94, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 99, 1 },
+{ 0, 6, 100, 1 },
+{ 0, 4, 100, 1 },
+{ 0, 6, 99, 5 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 104, 1 },
+{ 0, 4, 104, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 }
+};
+
+
+static const struct among a_1[295] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 4, 0, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, 6, 1 },
+{ 0, 6, 6, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, 10, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 15, 1 },
+{ 0, 6, 15, 1 },
+{ 0, 4, 15, 1 },
+{ 0, 5, 18, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 22, 1 },
+{ 0, 5, 22, 1 },
+{ 0, 5, 22, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 27, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, 30, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 35, 1 },
+{ 0, 5, 35, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 40, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 42, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 44, 1 },
+{ 0, 5, 44, 1 },
+{ 0, 5, 44, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 48, 1 },
+{ 0, 5, 48, 1 },
+{ 0, 6, -1, 2 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 60, 3 },
+{ 0, 5, 60, 10 },
+{ 0, 3, 60, 1 },
+{ 0, 3, 60, 1 },
+{ 0, 3, 60, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 72, 1 },
+{ 0, 3, 72, 1 },
+{ 0, 7, 74, 1 },
+{ 0, 7, 74, 1 },
+{ 0, 6, 74, 1 },
+{ 0, 5, 72, 1 },
+{ 0, 6, 78, 1 },
+{ 0, 4, 72, 1 },
+{ 0, 4, 72, 1 },
+{ 0, 5, 72, 1 },
+{ 0, 3, 72, 1 },
+{ 0, 4, 83, 1 },
+{ 0, 5, 83, 1 },
+{ 0, 6, 85, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, 87, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 91, 1 },
+{ 0, 4, 91, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 94, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 96, 1 },
+{ 0, 5, 96, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 102, 1 },
+{ 0, 4, 102, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 108, 1 },
+{ 0, 4, 109, 1 },
+{ 0, 5, 109, 1 },
+{ 0, 5, 109, 1 },
+{ 0, 4, 109, 1 },
+{ 0, 5, 113, 1 },
+{ 0, 5, 109, 1 },
+{ 0, 4, 108, 1 },
+{ 0, 4, 108, 1 },
+{ 0, 4, 108, 1 },
+{ 0, 3, 108, 2 },
+{ 0, 6, 108, 1 },
+{ 0, 5, 108, 1 },
+{ 0, 3, 108, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 123, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 125, 1 },
+{ 0, 4, 126, 1 },
+{ 0, 3, 125, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, 129, 1 },
+{ 0, 5, 129, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, 136, 1 },
+{ 0, 5, 136, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 140, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 142, 1 },
+{ 0, 5, 142, 1 },
+{ 0, 3, 142, 2 },
+{ 0, 6, 145, 1 },
+{ 0, 5, 145, 1 },
+{ 0, 6, 145, 1 },
+{ 0, 6, 145, 1 },
+{ 0, 6, 145, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 154, 1 },
+{ 0, 5, 154, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 159, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 164, 1 },
+{ 0, 3, 164, 1 },
+{ 0, 4, 166, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 170, 1 },
+{ 0, 4, 170, 1 },
+{ 0, 4, 170, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 176, 1 },
+{ 0, 5, 177, 1 },
+{ 0, 5, 176, 8 },
+{ 0, 5, 176, 1 },
+{ 0, 5, 176, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 183, 1 },
+{ 0, 4, 183, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 188, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 190, 1 },
+{ 0, 3, 190, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 193, 1 },
+{ 0, 4, 193, 1 },
+{ 0, 4, 193, 1 },
+{ 0, 5, -1, 2 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 209, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 212, 1 },
+{ 0, 2, -1, 4 },
+{ 0, 3, 214, 2 },
+{ 0, 6, 215, 1 },
+{ 0, 6, 215, 1 },
+{ 0, 5, 215, 1 },
+{ 0, 3, 214, 4 },
+{ 0, 4, 214, 4 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 221, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 226, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 229, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 231, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 234, 5 },
+{ 0, 4, 234, 1 },
+{ 0, 5, 236, 1 },
+{ 0, 3, 234, 1 },
+{ 0, 6, 234, 1 },
+{ 0, 3, 234, 1 },
+{ 0, 4, 234, 1 },
+{ 0, 8, 241, 6 },
+{ 0, 3, 234, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 244, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 246, 1 },
+{ 0, 5, 247, 9 },
+{ 0, 4, 247, 1 },
+{ 0, 4, 247, 1 },
+{ 0, 3, 246, 1 },
+{ 0, 4, 246, 1 },
+{ 0, 3, 246, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 255, 1 },
+{ 0, 3, 255, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, 259, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 263, 1 },
+{ 0, 5, 263, 1 },
+{ 0, 5, 263, 7 },
+{ 0, 4, 263, 1 },
+{ 0, 4, 263, 1 },
+{ 0, 3, 263, 1 },
+{ 0, 4, 263, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 3, 271, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 275, 1 },
+{ 0, 4, 275, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 282, 4 },
+{ 0, 5, 282, 1 },
+{ 0, 4, 282, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 287, 1 },
+{ 0, 6, 288, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 290, 1 },
+{ 0, 4, 290, 1 },
+{ 0, 2, 290, 1 },
+{ 0, 5, 293, 1 }
+};
+
+
+static const struct among a_2[19] =
+{
+{ 0, 4, -1, 2 },
+{ 0, 5, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 10, 1 },
+{ 0, 3, 10, 1 },
+{ 0, 5, 12, 1 },
+{ 0, 4, 10, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 16, 1 },
+{ 0, 2, -1, 1 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v[] = { 17, 65, 16 };
+
+static const unsigned char g_v_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 64, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 0;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'b':
+                                                i = 1;
+                                                break;
+                                            case 'k':
+                                                i = 2;
+                                                break;
+                                            case 'p':
+                                                i = 3;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'u') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'k') break;
+                                        i = 4;
+                                        break;
+                                }
+                                break;
+                            case 'l':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'g') break;
+                                        i = 5;
+                                        break;
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 't':
+                                                i = 6;
+                                                break;
+                                            case 'z':
+                                                if (n <= 6) break;
+                                                if (q[-7] != 't') break;
+                                                i = 7;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'u') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'g':
+                                        i = 8;
+                                        break;
+                                    case 'k':
+                                        i = 9;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'g':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'z') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 't') break;
+                        i = 10;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 'g') break;
+                                i = 11;
+                                break;
+                            case 'd':
+                                if (n <= 3) break;
+                                if (q[-4] != 'l') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 12;
+                                if (n <= 5) break;
+                                if (q[-6] != 't') break;
+                                i = 13;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'k') break;
+                                        i = 14;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'g':
+                                                i = 15;
+                                                break;
+                                            case 'k':
+                                                i = 16;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'k':
+                        i = 17;
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'z') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 't') break;
+                        i = 18;
+                        break;
+                    case 'l':
+                        i = 19;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'm':
+                                        i = 20;
+                                        break;
+                                    case 'p':
+                                        i = 21;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'k':
+                                        i = 22;
+                                        break;
+                                    case 'z':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 23;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        i = 24;
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'k':
+                                        i = 25;
+                                        break;
+                                    case 't':
+                                        i = 26;
+                                        break;
+                                    case 'z':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'k') break;
+                                        i = 27;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 28;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        i = 29;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'a') break;
+                                        i = 30;
+                                        break;
+                                    case 'k':
+                                        i = 31;
+                                        break;
+                                    case 'p':
+                                        i = 32;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 33;
+                                if (n <= 4) break;
+                                if (q[-5] != 'k') break;
+                                i = 34;
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'd':
+                                        i = 35;
+                                        break;
+                                    case 'g':
+                                        i = 36;
+                                        break;
+                                    case 'k':
+                                        i = 37;
+                                        break;
+                                    case 't':
+                                        i = 38;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 39;
+                        if (n <= 3) break;
+                        if (q[-4] != 'k') break;
+                        i = 40;
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 'l') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'g') break;
+                        i = 41;
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 42;
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'e') break;
+                                i = 43;
+                                break;
+                            case 't':
+                                i = 44;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'g':
+                                                i = 45;
+                                                break;
+                                            case 'k':
+                                                i = 46;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'u') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'k') break;
+                                        i = 47;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                i = 48;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        i = 49;
+                                        break;
+                                    case 'k':
+                                        i = 50;
+                                        break;
+                                    case 'p':
+                                        i = 51;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'u') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'k') break;
+                                i = 52;
+                                break;
+                        }
+                        break;
+                    case 'k':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 'z') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                i = 53;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 'z') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                i = 54;
+                                break;
+                        }
+                        break;
+                    case 'l':
+                        i = 55;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 'g') break;
+                                i = 56;
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 't':
+                                        i = 57;
+                                        break;
+                                    case 'z':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        i = 58;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'u') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'g':
+                                i = 59;
+                                break;
+                            case 'k':
+                                i = 60;
+                                break;
+                        }
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        i = 61;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 62;
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'g') break;
+                        i = 63;
+                        break;
+                    case 'd':
+                        if (n <= 2) break;
+                        if (q[-3] != 'l') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 64;
+                        if (n <= 4) break;
+                        if (q[-5] != 't') break;
+                        i = 65;
+                        break;
+                    case 'k':
+                        i = 66;
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 67;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'k':
+                                        i = 68;
+                                        break;
+                                    case 'l':
+                                        i = 69;
+                                        break;
+                                    case 't':
+                                        i = 70;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 71;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'g':
+                                        i = 72;
+                                        break;
+                                    case 'k':
+                                        i = 73;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'r') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 74;
+                        if (n <= 5) break;
+                        if (q[-6] != 't') break;
+                        i = 75;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 76;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 77;
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                i = 78;
+                                break;
+                            case 'k':
+                                i = 79;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 80;
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 't') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'a') break;
+                                i = 81;
+                                break;
+                            case 'm':
+                                i = 82;
+                                break;
+                            case 'p':
+                                i = 83;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'k':
+                                i = 84;
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                i = 85;
+                                break;
+                            case 'z':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 86;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                i = 87;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 't':
+                                i = 88;
+                                break;
+                            case 'z':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'k') break;
+                                i = 89;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'o':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'g':
+                        i = 90;
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 91;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        i = 92;
+                        break;
+                    case 'k':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'd') break;
+                        i = 93;
+                        break;
+                }
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                i = 94;
+                if (n <= 2) break;
+                if (q[-3] != 'k') break;
+                i = 95;
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                if (n <= 2) break;
+                if (q[-3] != 'z') break;
+                if (n <= 3) break;
+                if (q[-4] != 't') break;
+                i = 96;
+                break;
+            case 'u':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        i = 97;
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'g') break;
+                        i = 98;
+                        break;
+                    case 't':
+                        i = 99;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 100;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'd':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'l') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'a') break;
+                                        i = 101;
+                                        break;
+                                    case 't':
+                                        i = 102;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 'd') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'b') break;
+                                i = 103;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'z':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        i = 104;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 105;
+                                break;
+                            case 'z':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                i = 106;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'g':
+                                i = 107;
+                                break;
+                            case 'k':
+                                i = 108;
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_0[i].s_size;
+    return a_0[i].result;
+}
+static const symbol s_0[] = { 'a', 't', 's', 'e', 'd', 'e', 'n' };
+static const symbol s_1[] = { 'a', 'r', 'a', 'b', 'e', 'r', 'a' };
+static const symbol s_2[] = { 'b', 'a', 'd', 'i', 't', 'u' };
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 0;
+                                if (n <= 3) break;
+                                if (q[-4] != 'k') break;
+                                i = 1;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 2;
+                                        break;
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'd') break;
+                                        i = 3;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'b':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'g':
+                                        i = 4;
+                                        break;
+                                    case 'k':
+                                        i = 5;
+                                        break;
+                                }
+                                break;
+                            case 'd':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'l':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 6;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'k':
+                                                i = 7;
+                                                break;
+                                            case 't':
+                                                i = 8;
+                                                break;
+                                        }
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 9;
+                                        break;
+                                }
+                                break;
+                            case 'l':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'z') break;
+                                        i = 10;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        i = 11;
+                                        break;
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'g') break;
+                                        i = 12;
+                                        break;
+                                }
+                                break;
+                            case 'm':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'e':
+                                        i = 13;
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'k') break;
+                                        i = 14;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                i = 15;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'e':
+                                        i = 16;
+                                        break;
+                                    case 'o':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'z') break;
+                                        i = 17;
+                                        break;
+                                    case 'u':
+                                        i = 18;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'g') break;
+                                        i = 19;
+                                        break;
+                                }
+                                break;
+                            case 'p':
+                                i = 20;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'u') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                i = 21;
+                                break;
+                            case 't':
+                                i = 22;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'o':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'k') break;
+                                        i = 23;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 24;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 25;
+                                        break;
+                                }
+                                break;
+                            case 'x':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 26;
+                                break;
+                        }
+                        break;
+                    case 'g':
+                        i = 27;
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 28;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 'g') break;
+                                i = 29;
+                                break;
+                            case 'd':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'l':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 30;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        i = 31;
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'h') break;
+                                                i = 32;
+                                                break;
+                                            case 'e':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'm') break;
+                                                i = 33;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 'g') break;
+                                i = 34;
+                                break;
+                            case 'g':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 35;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'd':
+                                        i = 36;
+                                        break;
+                                    case 't':
+                                        i = 37;
+                                        break;
+                                }
+                                break;
+                            case 'h':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'n') break;
+                                        i = 38;
+                                        break;
+                                    case 'o':
+                                        i = 39;
+                                        break;
+                                }
+                                break;
+                            case 'k':
+                                i = 40;
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                i = 41;
+                                break;
+                            case 'o':
+                                i = 42;
+                                if (n <= 3) break;
+                                if (q[-4] != 'k') break;
+                                i = 43;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 44;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'k':
+                                                i = 45;
+                                                break;
+                                            case 'l':
+                                                i = 46;
+                                                break;
+                                            case 't':
+                                                i = 47;
+                                                break;
+                                        }
+                                        break;
+                                    case 'e':
+                                        i = 48;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'k':
+                                                i = 49;
+                                                break;
+                                            case 't':
+                                                i = 50;
+                                                break;
+                                        }
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'g':
+                                                        i = 51;
+                                                        break;
+                                                    case 'l':
+                                                        i = 52;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'i':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'k') break;
+                                                i = 53;
+                                                break;
+                                        }
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'd') break;
+                                        i = 54;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 55;
+                                break;
+                            case 't':
+                                i = 56;
+                                break;
+                            case 'z':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'e':
+                                        i = 57;
+                                        break;
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'b') break;
+                                        i = 58;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'n') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'o') break;
+                                        i = 59;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'k':
+                        i = 60;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 'j') break;
+                                i = 61;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'u') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 62;
+                                break;
+                            case 's':
+                                i = 63;
+                                break;
+                            case 'x':
+                                i = 64;
+                                break;
+                            case 'z':
+                                i = 65;
+                                break;
+                        }
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'g') break;
+                                        i = 66;
+                                        break;
+                                    case 'g':
+                                        i = 67;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'k') break;
+                                        i = 68;
+                                        break;
+                                    case 'k':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        i = 69;
+                                        break;
+                                    case 't':
+                                        i = 70;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                i = 71;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        i = 72;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 'k') break;
+                                i = 73;
+                                break;
+                            case 'e':
+                                i = 74;
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'a':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'g') break;
+                                        i = 75;
+                                        break;
+                                    case 'e':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'g') break;
+                                        i = 76;
+                                        break;
+                                    case 'u':
+                                        i = 77;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'z') break;
+                                        i = 78;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        i = 79;
+                                        break;
+                                    case 'k':
+                                        i = 80;
+                                        break;
+                                    case 'm':
+                                        i = 81;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'g') break;
+                                i = 82;
+                                break;
+                            case 'u':
+                                i = 83;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'd':
+                                        i = 84;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 85;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        i = 86;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'o') break;
+                                i = 87;
+                                if (n <= 5) break;
+                                if (q[-6] != 'k') break;
+                                i = 88;
+                                break;
+                            case 'g':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                i = 89;
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 'z') break;
+                                i = 90;
+                                break;
+                            case 'k':
+                                i = 91;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 't') break;
+                                        i = 92;
+                                        break;
+                                    case 'z':
+                                        i = 93;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                i = 94;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'z') break;
+                                i = 95;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 96;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 't':
+                                                i = 97;
+                                                break;
+                                            case 'z':
+                                                i = 98;
+                                                break;
+                                        }
+                                        break;
+                                    case 'e':
+                                        i = 99;
+                                        break;
+                                    case 'o':
+                                        i = 100;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 101;
+                                break;
+                            case 't':
+                                i = 102;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 't':
+                                        i = 103;
+                                        break;
+                                    case 'z':
+                                        i = 104;
+                                        break;
+                                }
+                                break;
+                            case 'x':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                i = 105;
+                                break;
+                            case 'z':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                i = 106;
+                                break;
+                            case 0xB1:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 107;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        i = 108;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 109;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'd':
+                                        i = 110;
+                                        break;
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'l':
+                                                i = 111;
+                                                break;
+                                            case 't':
+                                                i = 112;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        i = 113;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 114;
+                                        break;
+                                    case 'z':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 't') break;
+                                        i = 115;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        i = 116;
+                                        break;
+                                    case 'k':
+                                        i = 117;
+                                        break;
+                                    case 'p':
+                                        i = 118;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                i = 119;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'z') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        i = 120;
+                                        break;
+                                    case 'o':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'k') break;
+                                        i = 121;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                i = 122;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        i = 123;
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        i = 124;
+                        break;
+                    case 't':
+                        i = 125;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 126;
+                                if (n <= 3) break;
+                                if (q[-4] != 'k') break;
+                                i = 127;
+                                break;
+                            case 's':
+                                i = 128;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                i = 129;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'm') break;
+                                        i = 130;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 131;
+                                        break;
+                                }
+                                break;
+                            case 'k':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'l') break;
+                                i = 132;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'u') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'b':
+                                        i = 133;
+                                        break;
+                                    case 'd':
+                                        i = 134;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                i = 135;
+                                break;
+                            case 't':
+                                i = 136;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'm') break;
+                                        i = 137;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 138;
+                                        break;
+                                }
+                                break;
+                            case 'x':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                i = 139;
+                                break;
+                            case 'z':
+                                i = 140;
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                i = 141;
+                                break;
+                        }
+                        break;
+                    case 'z':
+                        i = 142;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 143;
+                                break;
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 144;
+                                break;
+                            case 't':
+                                i = 145;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'k') break;
+                                        i = 146;
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 147;
+                                                break;
+                                            case 'i':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'g':
+                                                        i = 148;
+                                                        break;
+                                                    case 'k':
+                                                        i = 149;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'k') break;
+                                                i = 150;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'b':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'g':
+                                i = 151;
+                                break;
+                            case 'k':
+                                i = 152;
+                                break;
+                        }
+                        break;
+                    case 'd':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 'k') break;
+                                i = 153;
+                                break;
+                            case 'l':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 154;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'k':
+                                        i = 155;
+                                        break;
+                                    case 't':
+                                        i = 156;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 157;
+                                break;
+                        }
+                        break;
+                    case 'g':
+                        i = 158;
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 'z') break;
+                                i = 159;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                i = 160;
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 'g') break;
+                                i = 161;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 162;
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'k') break;
+                                i = 163;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        i = 164;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'z') break;
+                                i = 165;
+                                break;
+                            case 'u':
+                                i = 166;
+                                if (n <= 3) break;
+                                if (q[-4] != 'g') break;
+                                i = 167;
+                                break;
+                        }
+                        break;
+                    case 'p':
+                        i = 168;
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'u') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 169;
+                        break;
+                    case 't':
+                        i = 170;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 'k') break;
+                                i = 171;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 172;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 173;
+                                break;
+                        }
+                        break;
+                    case 'x':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 174;
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'g') break;
+                        i = 175;
+                        break;
+                    case 'd':
+                        i = 176;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'l':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 177;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 't') break;
+                                        i = 178;
+                                        break;
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'g') break;
+                                        i = 179;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'h') break;
+                                        i = 180;
+                                        break;
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'm') break;
+                                        i = 181;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'g') break;
+                        i = 182;
+                        break;
+                    case 'g':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 183;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'd':
+                                i = 184;
+                                break;
+                            case 't':
+                                i = 185;
+                                break;
+                        }
+                        break;
+                    case 'h':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                i = 186;
+                                break;
+                            case 'o':
+                                i = 187;
+                                break;
+                        }
+                        break;
+                    case 'k':
+                        i = 188;
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        i = 189;
+                        break;
+                    case 'o':
+                        i = 190;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'g':
+                                i = 191;
+                                break;
+                            case 'k':
+                                i = 192;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 193;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'k':
+                                        i = 194;
+                                        break;
+                                    case 'l':
+                                        i = 195;
+                                        break;
+                                    case 't':
+                                        i = 196;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'g':
+                                                i = 197;
+                                                break;
+                                            case 'l':
+                                                i = 198;
+                                                break;
+                                        }
+                                        break;
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'k') break;
+                                        i = 199;
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'd') break;
+                                i = 200;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 201;
+                        break;
+                    case 't':
+                        i = 202;
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'n') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'o') break;
+                        i = 203;
+                        break;
+                    case 0xB1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 204;
+                        break;
+                }
+                break;
+            case 'k':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 205;
+                        break;
+                    case 'e':
+                        i = 206;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 't') break;
+                        i = 207;
+                        break;
+                }
+                break;
+            case 'l':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'b') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'g') break;
+                        i = 208;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 209;
+                        if (n <= 3) break;
+                        if (q[-4] != 'k') break;
+                        i = 210;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'k':
+                                i = 211;
+                                break;
+                            case 't':
+                                i = 212;
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 213;
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        i = 214;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'r':
+                                i = 215;
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'g') break;
+                                        i = 216;
+                                        break;
+                                    case 'e':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'g') break;
+                                        i = 217;
+                                        break;
+                                    case 'u':
+                                        i = 218;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                i = 219;
+                                break;
+                            case 'z':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                i = 220;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 'z') break;
+                                i = 221;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                i = 222;
+                                break;
+                            case 'k':
+                                i = 223;
+                                break;
+                            case 'm':
+                                i = 224;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                i = 225;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 226;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                i = 227;
+                                break;
+                            case 'z':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 228;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'o':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'o') break;
+                        i = 229;
+                        if (n <= 4) break;
+                        if (q[-5] != 'k') break;
+                        i = 230;
+                        break;
+                    case 'g':
+                        i = 231;
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        i = 232;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'z') break;
+                        i = 233;
+                        break;
+                    case 'k':
+                        i = 234;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 't') break;
+                                        i = 235;
+                                        break;
+                                    case 't':
+                                        i = 236;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 237;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 238;
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 't') break;
+                                i = 239;
+                                break;
+                            case 's':
+                                i = 240;
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                i = 241;
+                                if (n <= 4) break;
+                                if (q[-5] != 'u') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'n') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'i') break;
+                                if (n <= 7) break;
+                                if (q[-8] != 'm') break;
+                                i = 242;
+                                break;
+                            case 'z':
+                                i = 243;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        i = 244;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'z') break;
+                        i = 245;
+                        break;
+                    case 'r':
+                        i = 246;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 247;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'g':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 248;
+                                        break;
+                                    case 't':
+                                        i = 249;
+                                        break;
+                                    case 'z':
+                                        i = 250;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 251;
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 'g') break;
+                                i = 252;
+                                break;
+                            case 'o':
+                                i = 253;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        i = 254;
+                        break;
+                    case 't':
+                        i = 255;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 't':
+                                i = 256;
+                                break;
+                            case 'z':
+                                i = 257;
+                                break;
+                        }
+                        break;
+                    case 'x':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        i = 258;
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        i = 259;
+                        if (n <= 3) break;
+                        if (q[-4] != 'n') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'g') break;
+                        i = 260;
+                        break;
+                    case 0xB1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 261;
+                        break;
+                }
+                break;
+            case 'p':
+                if (n <= 1) break;
+                if (q[-2] != 'z') break;
+                i = 262;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 263;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                i = 264;
+                                break;
+                            case 'h':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'b':
+                                        i = 265;
+                                        break;
+                                    case 'z':
+                                        i = 266;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'l':
+                                        i = 267;
+                                        break;
+                                    case 't':
+                                        i = 268;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                i = 269;
+                                break;
+                            case 'z':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                i = 270;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        i = 271;
+                        if (n <= 2) break;
+                        if (q[-3] != 'k') break;
+                        i = 272;
+                        break;
+                }
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                i = 273;
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                if (n <= 2) break;
+                if (q[-3] != 'k') break;
+                i = 274;
+                break;
+            case 'u':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        i = 275;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'm') break;
+                                i = 276;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 277;
+                                break;
+                        }
+                        break;
+                    case 'k':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'l') break;
+                        i = 278;
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'u') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'b':
+                                i = 279;
+                                break;
+                            case 'd':
+                                i = 280;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        i = 281;
+                        break;
+                    case 't':
+                        i = 282;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                i = 283;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'm') break;
+                                i = 284;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 285;
+                                break;
+                        }
+                        break;
+                    case 'x':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        i = 286;
+                        break;
+                    case 'z':
+                        i = 287;
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        i = 288;
+                        if (n <= 3) break;
+                        if (q[-4] != 'n') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'g') break;
+                        i = 289;
+                        break;
+                }
+                break;
+            case 'z':
+                i = 290;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        i = 291;
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 292;
+                        break;
+                    case 't':
+                        i = 293;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'o') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'k') break;
+                        i = 294;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+static const symbol s_3[] = { 'j', 'o', 'k' };
+static const symbol s_4[] = { 't', 'r', 'a' };
+static const symbol s_5[] = { 'm', 'i', 'n', 'u', 't', 'u' };
+static const symbol s_6[] = { 'z', 'e', 'h', 'a', 'r' };
+static const symbol s_7[] = { 'g', 'e', 'l', 'd', 'i' };
+static const symbol s_8[] = { 'i', 'g', 'a', 'r', 'o' };
+static const symbol s_9[] = { 'a', 'u', 'r', 'k', 'a' };
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'l') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'z') break;
+                        i = 0;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'k') break;
+                        i = 1;
+                        break;
+                    case 'l':
+                        i = 2;
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 3;
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'd':
+                                i = 4;
+                                break;
+                            case 't':
+                                i = 5;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'd':
+                                i = 6;
+                                break;
+                            case 't':
+                                i = 7;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'g':
+                        i = 8;
+                        break;
+                    case 'k':
+                        i = 9;
+                        break;
+                }
+                break;
+            case 'k':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 10;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'n':
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'l') break;
+                        i = 11;
+                        break;
+                    case 'r':
+                        i = 12;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'l') break;
+                        i = 13;
+                        break;
+                    case 't':
+                        if (n <= 3) break;
+                        if (q[-4] != 'z') break;
+                        i = 14;
+                        break;
+                }
+                break;
+            case 'o':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'g':
+                        i = 15;
+                        break;
+                    case 'r':
+                        i = 16;
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 17;
+                        break;
+                    case 't':
+                        i = 18;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_10[] = { 'z' };
+
+extern int basque_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    
+    z->I[2] = z->l;
+    z->I[1] = z->l;
+    z->I[0] = z->l;
+    {   int c1 = z->c;
+        {   int c2 = z->c;
+            if (in_class_U(z, g_v_class, g_v, 97, 117, 0)) goto lab3;
+            {   int c3 = z->c;
+                if (out_class_U(z, g_v_class, g_v, 97, 117, 0)) goto lab5;
+                {   
+                    int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 117);
+                    if (ret < 0) goto lab5;
+                    z->c += ret;
+                }
+                goto lab4;
+            lab5:
+                z->c = c3;
+                if (in_class_U(z, g_v_class, g_v, 97, 117, 0)) goto lab3;
+                {   
+                    int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 117);
+                    if (ret < 0) goto lab3;
+                    z->c += ret;
+                }
+            }
+        lab4:
+            goto lab2;
+        lab3:
+            z->c = c2;
+            if (out_class_U(z, g_v_class, g_v, 97, 117, 0)) goto lab1;
+            {   int c4 = z->c;
+                if (out_class_U(z, g_v_class, g_v, 97, 117, 0)) goto lab7;
+                {   
+                    int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 117);
+                    if (ret < 0) goto lab7;
+                    z->c += ret;
+                }
+                goto lab6;
+            lab7:
+                z->c = c4;
+                if (in_class_U(z, g_v_class, g_v, 97, 117, 0)) goto lab1;
+                {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                    if (ret < 0) goto lab1;
+                    z->c = ret;
+                }
+            }
+        lab6:
+            ;
+        }
+    lab2:
+        z->I[2] = z->c;
+    lab1:
+        z->c = c1;
+    }
+    {   int c5 = z->c;
+        {   
+            int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 117);
+            if (ret < 0) goto lab8;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 117);
+            if (ret < 0) goto lab8;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+        {   
+            int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 117);
+            if (ret < 0) goto lab8;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 117);
+            if (ret < 0) goto lab8;
+            z->c += ret;
+        }
+        z->I[0] = z->c;
+    lab8:
+        z->c = c5;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    while(1) {
+        int m6 = z->l - z->c; (void)m6;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((70566434 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((70572722 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab9;
+        among_var = find_among_b_0(z);
+        if (!(among_var)) goto lab9;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(z->I[2] <= z->c)) goto lab9;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                if (!(z->I[0] <= z->c)) goto lab9;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 7, s_0);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                {   int ret = slice_from_s(z, 7, s_1);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                {   int ret = slice_from_s(z, 6, s_2);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+        continue;
+    lab9:
+        z->c = z->l - m6;
+        break;
+    }
+    while(1) {
+        int m7 = z->l - z->c; (void)m7;
+        z->ket = z->c;
+        if (z->c <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((71162402 >> (z->p[z->c - 1] & 0x1f)) & 1)) goto lab10;
+        among_var = find_among_b_1(z);
+        if (!(among_var)) goto lab10;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(z->I[2] <= z->c)) goto lab10;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                if (!(z->I[0] <= z->c)) goto lab10;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 3, s_3);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                if (!(z->I[1] <= z->c)) goto lab10;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                {   int ret = slice_from_s(z, 3, s_4);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {   int ret = slice_from_s(z, 6, s_5);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                {   int ret = slice_from_s(z, 5, s_6);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 8:
+                {   int ret = slice_from_s(z, 5, s_7);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 9:
+                {   int ret = slice_from_s(z, 5, s_8);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 10:
+                {   int ret = slice_from_s(z, 5, s_9);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+        continue;
+    lab10:
+        z->c = z->l - m7;
+        break;
+    }
+    {   int m8 = z->l - z->c; (void)m8;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((35362 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((1317552 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab11;
+        among_var = find_among_b_2(z);
+        if (!(among_var)) goto lab11;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(z->I[2] <= z->c)) goto lab11;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 1, s_10);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab11:
+        z->c = z->l - m8;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * basque_UTF_8_create_env(void) { return SN_create_env(0, 3); }
+
+extern void basque_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
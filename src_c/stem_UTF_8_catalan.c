@@ -0,0 +1,4129 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int catalan_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * catalan_UTF_8_create_env(void);
+extern void catalan_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+static const symbol a_0_pool[30] = {
+    0xC2, 0xB7, '.', 0xC3, 0xA0, 'a', 0xC3, 0xA1, 0xC3, 0xA8, 'e', 0xC3, 0xA9, 0xC3, 0xAC, 'i',
+    0xC3, 0xAD, 0xC3, 0xAF, 0xC3, 0xB2, 'o', 0xC3, 0xB3, 0xC3, 0xBA, 'u', 0xC3, 0xBC
+};
+
+static const struct translation_entry a_0_entry[12] = {
+    { 0, 2, 2, 1 },
+    { 3, 2, 5, 1 },
+    { 6, 2, 5, 1 },
+    { 8, 2, 10, 1 },
+    { 11, 2, 10, 1 },
+    { 13, 2, 15, 1 },
+    { 16, 2, 15, 1 },
+    { 18, 2, 15, 1 },
+    { 20, 2, 22, 1 },
+    { 23, 2, 22, 1 },
+    { 25, 2, 27, 1 },
+    { 28, 2, 27, 1 }
+};
+
+static const unsigned short a_0_page[1] = {
+    256
+};
+
+static const unsigned short a_0_index[512] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    2, 3, 0, 0, 0, 0, 0, 0, 4, 5, 0, 0, 6, 7, 0, 8,
+    0, 0, 9, 10, 0, 0, 0, 0, 0, 0, 11, 0, 12, 0, 0, 0
+};
+
+static const struct translation a_0_translation = {
+    0, 0, 1, a_0_page, a_0_index, a_0_entry, a_0_pool
+};
+
+
+static const struct among a_1[39] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 3, 0, 1 },
+{ 0, 4, 0, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 4, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 8, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 10, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 17, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 19, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 22, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 24, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 31, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 33, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 36, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_2[200] =
+{
+{ 0, 3, -1, 4 },
+{ 0, 7, 0, 3 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 2 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 3 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 9, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 7, 17, 1 },
+{ 0, 9, 18, 5 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 22, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 24, 1 },
+{ 0, 5, 25, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 7, 36, 1 },
+{ 0, 7, 36, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 39, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 3 },
+{ 0, 2, -1, 4 },
+{ 0, 6, 43, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 49, 1 },
+{ 0, 4, 49, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 7, 52, 1 },
+{ 0, 7, 52, 1 },
+{ 0, 6, 52, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 3 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 8, 73, 5 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 6, 77, 1 },
+{ 0, 4, 77, 1 },
+{ 0, 4, 77, 1 },
+{ 0, 4, 77, 1 },
+{ 0, 5, 77, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 84, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 3, -1, 4 },
+{ 0, 7, 88, 3 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 2 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 3 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 103, 1 },
+{ 0, 5, 103, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, 106, 1 },
+{ 0, 10, 107, 5 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 8, 110, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 114, 1 },
+{ 0, 6, 115, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 8, 124, 1 },
+{ 0, 8, 124, 1 },
+{ 0, 5, -1, 4 },
+{ 0, 9, 127, 3 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 129, 1 },
+{ 0, 7, -1, 3 },
+{ 0, 10, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 3 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 138, 1 },
+{ 0, 4, 138, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 7, 141, 1 },
+{ 0, 9, 142, 5 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 144, 1 },
+{ 0, 6, 145, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 152, 1 },
+{ 0, 5, 153, 1 },
+{ 0, 5, 153, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 156, 1 },
+{ 0, 8, 157, 1 },
+{ 0, 7, 157, 1 },
+{ 0, 9, 159, 1 },
+{ 0, 6, 156, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 164, 1 },
+{ 0, 6, 165, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 169, 1 },
+{ 0, 5, 169, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 174, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 7, 177, 1 },
+{ 0, 6, 177, 1 },
+{ 0, 8, 179, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 184, 1 },
+{ 0, 4, 184, 1 },
+{ 0, 5, 186, 1 },
+{ 0, 7, 187, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 196, 1 },
+{ 0, 4, 197, 1 },
+{ 0, 5, 198, 1 }
+};
+
+
+static const struct among a_3[283] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 8, 1 },
+{ 0, 4, 8, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 19, 1 },
+{ 0, 5, 19, 1 },
+{ 0, 5, 19, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 30, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 42, 1 },
+{ 0, 4, 42, 1 },
+{ 0, 5, 42, 1 },
+{ 0, 5, 42, 1 },
+{ 0, 6, 42, 1 },
+{ 0, 6, 42, 1 },
+{ 0, 5, 42, 1 },
+{ 0, 6, 42, 1 },
+{ 0, 4, 42, 1 },
+{ 0, 5, 42, 1 },
+{ 0, 5, 42, 1 },
+{ 0, 6, 42, 1 },
+{ 0, 4, 42, 1 },
+{ 0, 6, 55, 1 },
+{ 0, 6, 55, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 66, 1 },
+{ 0, 5, 66, 1 },
+{ 0, 4, 66, 1 },
+{ 0, 5, 66, 1 },
+{ 0, 4, 66, 1 },
+{ 0, 4, 66, 1 },
+{ 0, 6, 72, 1 },
+{ 0, 6, 72, 1 },
+{ 0, 6, 72, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 76, 1 },
+{ 0, 5, 77, 1 },
+{ 0, 5, 77, 1 },
+{ 0, 4, 76, 1 },
+{ 0, 4, 76, 1 },
+{ 0, 4, 76, 1 },
+{ 0, 5, 76, 1 },
+{ 0, 5, 76, 1 },
+{ 0, 4, 76, 1 },
+{ 0, 5, 76, 1 },
+{ 0, 5, 76, 1 },
+{ 0, 5, 76, 1 },
+{ 0, 5, 76, 1 },
+{ 0, 6, 76, 1 },
+{ 0, 6, 76, 1 },
+{ 0, 6, 76, 1 },
+{ 0, 6, 76, 1 },
+{ 0, 7, 76, 1 },
+{ 0, 4, 76, 1 },
+{ 0, 4, 76, 1 },
+{ 0, 5, 96, 1 },
+{ 0, 5, 76, 1 },
+{ 0, 4, 76, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 100, 1 },
+{ 0, 3, 100, 1 },
+{ 0, 4, 102, 1 },
+{ 0, 5, 102, 1 },
+{ 0, 5, 102, 1 },
+{ 0, 5, 102, 1 },
+{ 0, 6, 102, 1 },
+{ 0, 6, 100, 1 },
+{ 0, 5, 100, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 2 },
+{ 0, 5, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 121, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 125, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 127, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 131, 1 },
+{ 0, 4, 131, 1 },
+{ 0, 4, 131, 1 },
+{ 0, 4, 131, 1 },
+{ 0, 5, 131, 1 },
+{ 0, 4, 131, 1 },
+{ 0, 6, 137, 1 },
+{ 0, 6, 137, 1 },
+{ 0, 6, 137, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 142, 1 },
+{ 0, 4, 142, 1 },
+{ 0, 4, 142, 1 },
+{ 0, 5, 142, 1 },
+{ 0, 5, 142, 1 },
+{ 0, 3, 142, 1 },
+{ 0, 5, 148, 1 },
+{ 0, 5, 148, 1 },
+{ 0, 4, 142, 1 },
+{ 0, 4, 142, 1 },
+{ 0, 6, 142, 1 },
+{ 0, 5, 142, 1 },
+{ 0, 4, 142, 1 },
+{ 0, 5, 142, 1 },
+{ 0, 5, 142, 1 },
+{ 0, 5, 142, 1 },
+{ 0, 5, 142, 1 },
+{ 0, 6, 142, 1 },
+{ 0, 4, 142, 1 },
+{ 0, 6, 161, 1 },
+{ 0, 7, 161, 1 },
+{ 0, 4, 142, 1 },
+{ 0, 4, 142, 1 },
+{ 0, 5, 165, 1 },
+{ 0, 5, 142, 1 },
+{ 0, 4, 142, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 7, 172, 1 },
+{ 0, 7, 172, 1 },
+{ 0, 7, 172, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 181, 1 },
+{ 0, 5, 181, 1 },
+{ 0, 5, 181, 1 },
+{ 0, 5, 181, 1 },
+{ 0, 6, 181, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 7, 197, 1 },
+{ 0, 7, 197, 1 },
+{ 0, 8, 197, 1 },
+{ 0, 6, 197, 1 },
+{ 0, 8, 201, 1 },
+{ 0, 8, 201, 1 },
+{ 0, 8, 201, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 212, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 218, 1 },
+{ 0, 5, 218, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 224, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 235, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 7, 244, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 253, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 255, 1 },
+{ 0, 6, 255, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 265, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 }
+};
+
+
+static const struct among a_4[22] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 6, 1 },
+{ 0, 2, 6, 1 },
+{ 0, 3, 6, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v[] = { 17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 129, 81, 6, 10 };
+
+static const unsigned char g_v_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 64, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+
+static const unsigned char a_1_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x80, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0xF1, 0x38, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[-2] != 'l') break;
+                i = 0;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case '-':
+                        i = 1;
+                        break;
+                    case 'e':
+                        if (n <= 3) break;
+                        if (q[-4] != 's') break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'l':
+                        i = 3;
+                        break;
+                    case 'm':
+                        i = 4;
+                        if (n <= 2) break;
+                        if (q[-3] != '-') break;
+                        i = 5;
+                        break;
+                    case 's':
+                        i = 6;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != '-') break;
+                        i = 7;
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'h':
+                        i = 8;
+                        if (n <= 2) break;
+                        if (q[-3] != '\'') break;
+                        i = 9;
+                        break;
+                    case 'l':
+                        i = 10;
+                        if (n <= 2) break;
+                        if (q[-3] != '-') break;
+                        i = 11;
+                        break;
+                }
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != '\'') break;
+                i = 12;
+                break;
+            case 'm':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case '\'':
+                        i = 13;
+                        break;
+                    case '-':
+                        i = 14;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case '\'':
+                        i = 15;
+                        break;
+                    case '-':
+                        i = 16;
+                        break;
+                }
+                break;
+            case 'o':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'h':
+                        i = 17;
+                        if (n <= 2) break;
+                        if (q[-3] != '\'') break;
+                        i = 18;
+                        break;
+                    case 'l':
+                        i = 19;
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 's') break;
+                        i = 20;
+                        break;
+                }
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case '\'':
+                        i = 21;
+                        break;
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'l') break;
+                        i = 22;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 's') break;
+                        i = 23;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'l') break;
+                        i = 24;
+                        if (n <= 3) break;
+                        if (q[-4] != '-') break;
+                        i = 25;
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case '\'':
+                                i = 26;
+                                break;
+                            case '-':
+                                i = 27;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case '\'':
+                                i = 28;
+                                break;
+                            case '-':
+                                i = 29;
+                                break;
+                            case 'e':
+                                i = 30;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'l':
+                                i = 31;
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                i = 32;
+                                break;
+                            case 'n':
+                                i = 33;
+                                if (n <= 3) break;
+                                if (q[-4] != '-') break;
+                                i = 34;
+                                break;
+                            case 'v':
+                                i = 35;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        i = 36;
+                        if (n <= 2) break;
+                        if (q[-3] != '-') break;
+                        i = 37;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != '\'') break;
+                i = 38;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+
+static const unsigned char a_2_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3A, 0x72, 0x3C, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static const unsigned char a_2_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xBA, 0xF2, 0x7C, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x80, 0x23, 0x8, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                i = 0;
+                                if (n <= 3) break;
+                                if (q[-4] != 'g') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0xB3) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'l') break;
+                                i = 1;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 2;
+                                break;
+                        }
+                        break;
+                    case 'd':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 3;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 4;
+                                                break;
+                                            case 'e':
+                                                i = 5;
+                                                break;
+                                            case 0xA8:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0xC3) break;
+                                                i = 6;
+                                                break;
+                                        }
+                                        break;
+                                    case 0xAD:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 7;
+                                        break;
+                                }
+                                break;
+                            case 'g':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'l') break;
+                                i = 8;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 9;
+                                if (n <= 4) break;
+                                if (q[-5] != 0xAD) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                i = 10;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'e':
+                                        i = 11;
+                                        break;
+                                    case 0xA0:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 12;
+                                        break;
+                                    case 0xB2:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'a') break;
+                                        i = 13;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'l':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 14;
+                                        break;
+                                    case 'e':
+                                        i = 15;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 'v') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0xAD) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                i = 16;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 17;
+                        if (n <= 3) break;
+                        if (q[-4] != 's') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 's') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xAD) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xC3) break;
+                        i = 18;
+                        if (n <= 7) break;
+                        if (q[-8] != 'u') break;
+                        if (n <= 8) break;
+                        if (q[-9] != 'q') break;
+                        i = 19;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 20;
+                                break;
+                            case 'i':
+                                i = 21;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 22;
+                                if (n <= 3) break;
+                                if (q[-4] != 'f') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                i = 23;
+                                break;
+                            case 'o':
+                                i = 24;
+                                if (n <= 3) break;
+                                if (q[-4] != 'd') break;
+                                i = 25;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 26;
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'd') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 27;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 28;
+                                break;
+                            case 'o':
+                                i = 29;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 30;
+                                        break;
+                                    case 'e':
+                                        i = 31;
+                                        break;
+                                    case 'i':
+                                        i = 32;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 33;
+                                break;
+                            case 'i':
+                                i = 34;
+                                break;
+                            case 'o':
+                                i = 35;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 36;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'l':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'a') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'i') break;
+                                        i = 37;
+                                        break;
+                                    case 'n':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'o') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'i') break;
+                                        i = 38;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 39;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 40;
+                        break;
+                    case 0xA7:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'n') break;
+                        i = 41;
+                        break;
+                    case 0xAD:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'g') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'o') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'l') break;
+                        i = 42;
+                        break;
+                }
+                break;
+            case 'c':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        i = 43;
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 's') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xAD) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xC3) break;
+                        i = 44;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 45;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 46;
+                        break;
+                }
+                break;
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'u') break;
+                i = 47;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'g':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 48;
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'b') break;
+                        i = 49;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 50;
+                                break;
+                            case 'i':
+                                i = 51;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 52;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'l':
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'i') break;
+                                i = 53;
+                                break;
+                            case 'n':
+                                if (n <= 5) break;
+                                if (q[-6] != 'o') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'i') break;
+                                i = 54;
+                                break;
+                            case 'v':
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 55;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 56;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 57;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 58;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                i = 59;
+                                break;
+                            case 0xAD:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 60;
+                                break;
+                        }
+                        break;
+                    case 'g':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'l') break;
+                        i = 61;
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 62;
+                                break;
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                i = 63;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'l':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 64;
+                        break;
+                    case 'i':
+                        i = 65;
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 66;
+                                break;
+                            case 'e':
+                                i = 67;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        if (q[-3] != 'v') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0xAD) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xC3) break;
+                        i = 68;
+                        break;
+                }
+                break;
+            case 'm':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 69;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 's') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'i':
+                                i = 70;
+                                break;
+                            case 0xAC:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                i = 71;
+                                break;
+                            case 0xAD:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                i = 72;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 's') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xAD) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xC3) break;
+                        i = 73;
+                        if (n <= 6) break;
+                        if (q[-7] != 'u') break;
+                        if (n <= 7) break;
+                        if (q[-8] != 'q') break;
+                        i = 74;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'm') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 75;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 's') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xAC) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xC3) break;
+                        i = 76;
+                        break;
+                }
+                break;
+            case 'r':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 77;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'f') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 78;
+                                break;
+                            case 'g':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 79;
+                                break;
+                            case 'j':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 80;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 81;
+                                break;
+                            case 'z':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 82;
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'f') break;
+                        i = 83;
+                        break;
+                    case 'o':
+                        i = 84;
+                        if (n <= 2) break;
+                        if (q[-3] != 'd') break;
+                        i = 85;
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 'd') break;
+                        i = 86;
+                        break;
+                }
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'o') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'd') break;
+                        i = 87;
+                        break;
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 88;
+                        if (n <= 3) break;
+                        if (q[-4] != 'g') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB3) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xC3) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 'l') break;
+                        i = 89;
+                        break;
+                    case 'd':
+                        if (n <= 2) break;
+                        if (q[-3] != 'u') break;
+                        i = 90;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                i = 91;
+                                break;
+                            case 'd':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 92;
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 93;
+                                                        break;
+                                                    case 'e':
+                                                        i = 94;
+                                                        break;
+                                                    case 0xA8:
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 0xC3) break;
+                                                        i = 95;
+                                                        break;
+                                                }
+                                                break;
+                                            case 0xAD:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0xC3) break;
+                                                i = 96;
+                                                break;
+                                        }
+                                        break;
+                                    case 'g':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'l') break;
+                                        i = 97;
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'i':
+                                                i = 98;
+                                                break;
+                                            case 0xAD:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0xC3) break;
+                                                i = 99;
+                                                break;
+                                        }
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'e':
+                                                i = 100;
+                                                break;
+                                            case 0xA0:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0xC3) break;
+                                                i = 101;
+                                                break;
+                                            case 0xB2:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0xC3) break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 't') break;
+                                                if (n <= 7) break;
+                                                if (q[-8] != 'a') break;
+                                                i = 102;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'l':
+                                if (n <= 3) break;
+                                if (q[-4] != 'b') break;
+                                i = 103;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 104;
+                                        break;
+                                    case 'i':
+                                        i = 105;
+                                        break;
+                                }
+                                break;
+                            case 'm':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 106;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 0xAD) break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xC3) break;
+                                        i = 107;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 'u') break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 'q') break;
+                                        i = 108;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'f') break;
+                                        i = 109;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 110;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'l') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'a') break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'i') break;
+                                        i = 111;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 112;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'e':
+                                        i = 113;
+                                        break;
+                                    case 'o':
+                                        i = 114;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'd') break;
+                                        i = 115;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'i') break;
+                                        i = 116;
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'd') break;
+                                        i = 117;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'e':
+                                        i = 118;
+                                        break;
+                                    case 'o':
+                                        i = 119;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 120;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 121;
+                                        break;
+                                    case 'i':
+                                        i = 122;
+                                        break;
+                                    case 'o':
+                                        i = 123;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 124;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'l':
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'a') break;
+                                                if (n <= 7) break;
+                                                if (q[-8] != 'i') break;
+                                                i = 125;
+                                                break;
+                                            case 'n':
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'o') break;
+                                                if (n <= 7) break;
+                                                if (q[-8] != 'i') break;
+                                                i = 126;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'q') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 127;
+                                if (n <= 5) break;
+                                if (q[-6] != 'g') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB3) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xC3) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 'l') break;
+                                i = 128;
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 129;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                i = 130;
+                                break;
+                            case 0xAD:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'g') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'o') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'l') break;
+                                i = 131;
+                                break;
+                            case 0xBC:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'g') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'n') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'e') break;
+                                if (n <= 7) break;
+                                if (q[-8] != 'l') break;
+                                if (n <= 8) break;
+                                if (q[-9] != 'l') break;
+                                if (n <= 9) break;
+                                if (q[-10] != 'a') break;
+                                i = 132;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 133;
+                                        break;
+                                    case 0xAD:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 134;
+                                        break;
+                                }
+                                break;
+                            case 'g':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'l') break;
+                                i = 135;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 136;
+                                        break;
+                                    case 'o':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 't') break;
+                                        i = 137;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'l':
+                        i = 138;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 139;
+                                break;
+                            case 'l':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 140;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 141;
+                        if (n <= 3) break;
+                        if (q[-4] != 's') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 's') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xAD) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xC3) break;
+                        i = 142;
+                        if (n <= 7) break;
+                        if (q[-8] != 'u') break;
+                        if (n <= 8) break;
+                        if (q[-9] != 'q') break;
+                        i = 143;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 144;
+                        if (n <= 4) break;
+                        if (q[-5] != 'c') break;
+                        i = 145;
+                        if (n <= 5) break;
+                        if (q[-6] != 'a') break;
+                        i = 146;
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'e':
+                                i = 147;
+                                break;
+                            case 'o':
+                                i = 148;
+                                break;
+                            case 's':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 149;
+                                        break;
+                                    case 'i':
+                                        i = 150;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 151;
+                                break;
+                            case 'o':
+                                i = 152;
+                                if (n <= 3) break;
+                                if (q[-4] != 'd') break;
+                                i = 153;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 154;
+                                        break;
+                                    case 'i':
+                                        i = 155;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 156;
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'i':
+                                        i = 157;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'l':
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'i') break;
+                                                if (n <= 7) break;
+                                                if (q[-8] != 'b') break;
+                                                i = 158;
+                                                break;
+                                            case 'v':
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'i') break;
+                                                i = 159;
+                                                if (n <= 7) break;
+                                                if (q[-8] != 't') break;
+                                                if (n <= 8) break;
+                                                if (q[-9] != 'a') break;
+                                                i = 160;
+                                                break;
+                                        }
+                                        break;
+                                    case 0xAF:
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0xC3) break;
+                                        i = 161;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 162;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 163;
+                                        break;
+                                    case 'e':
+                                        i = 164;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'm') break;
+                                        i = 165;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'a') break;
+                                        i = 166;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                i = 167;
+                                break;
+                            case 'u':
+                                i = 168;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 169;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'r':
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                i = 170;
+                                break;
+                            case 't':
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 171;
+                                break;
+                        }
+                        break;
+                    case 0xA8:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 172;
+                        break;
+                    case 0xA9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 173;
+                        break;
+                    case 0xAD:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 174;
+                        if (n <= 3) break;
+                        if (q[-4] != 'd') break;
+                        i = 175;
+                        break;
+                    case 0xB3:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 176;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'i':
+                                i = 177;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'l':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'i') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'b') break;
+                                        i = 178;
+                                        break;
+                                    case 'v':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'i') break;
+                                        i = 179;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 't') break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'a') break;
+                                        i = 180;
+                                        break;
+                                }
+                                break;
+                            case 0xAF:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xC3) break;
+                                i = 181;
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        i = 182;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 183;
+                                break;
+                            case 'e':
+                                i = 184;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 185;
+                                        break;
+                                    case 'm':
+                                        i = 186;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 187;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'i') break;
+                                        i = 188;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        i = 189;
+                        break;
+                }
+                break;
+            case 'u':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 's') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'i':
+                                i = 190;
+                                break;
+                            case 0xAC:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                i = 191;
+                                break;
+                            case 0xAD:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                i = 192;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                i = 193;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0xAD) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                i = 194;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 195;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0xB3:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                i = 196;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 197;
+                if (n <= 3) break;
+                if (q[-4] != 'c') break;
+                i = 198;
+                if (n <= 4) break;
+                if (q[-5] != 'a') break;
+                i = 199;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_0[] = { 'l', 'o', 'g' };
+static const symbol s_1[] = { 'i', 'c' };
+static const symbol s_2[] = { 'c' };
+
+static const unsigned char a_3_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3A, 0xE2, 0x3C, 0x5,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xA3, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static const unsigned char a_3_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3E, 0xE2, 0x7C, 0x5,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xA2, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'b':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 0;
+                        break;
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'e':
+                                i = 1;
+                                break;
+                            case 'i':
+                                i = 2;
+                                break;
+                            case 0xAF:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xC3) break;
+                                i = 3;
+                                break;
+                        }
+                        break;
+                    case 'd':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 4;
+                                break;
+                            case 'i':
+                                i = 5;
+                                break;
+                            case 'u':
+                                i = 6;
+                                break;
+                            case 0xAF:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 7;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        i = 8;
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 9;
+                                break;
+                            case 'i':
+                                i = 10;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 11;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 12;
+                                break;
+                            case 'i':
+                                i = 13;
+                                break;
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 'd') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 14;
+                                break;
+                            case 0xAF:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 15;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 16;
+                        break;
+                    case 'x':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 17;
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 18;
+                        break;
+                    case 0xAD:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 19;
+                        if (n <= 3) break;
+                        if (q[-4] != 'r') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 20;
+                                break;
+                            case 'e':
+                                i = 21;
+                                break;
+                            case 'i':
+                                i = 22;
+                                break;
+                        }
+                        break;
+                    case 0xAF:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 23;
+                        break;
+                }
+                break;
+            case 'c':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'i':
+                        i = 24;
+                        break;
+                    case 0xAF:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xC3) break;
+                        i = 25;
+                        break;
+                }
+                break;
+            case 'd':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 26;
+                        break;
+                    case 'e':
+                        i = 27;
+                        break;
+                    case 'i':
+                        i = 28;
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        i = 29;
+                        break;
+                    case 'r':
+                        i = 30;
+                        if (n <= 2) break;
+                        if (q[-3] != 'd') break;
+                        i = 31;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 32;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 33;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 34;
+                                break;
+                            case 'i':
+                                i = 35;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        i = 36;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 37;
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 'q') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 's') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'e') break;
+                        i = 38;
+                        break;
+                    case 'x':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 39;
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 40;
+                        break;
+                }
+                break;
+            case 'm':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 41;
+                        break;
+                    case 'e':
+                        i = 42;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 43;
+                                        break;
+                                    case 'i':
+                                        i = 44;
+                                        break;
+                                    case 0xA0:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 45;
+                                        break;
+                                    case 0xAD:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 46;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 0xA0:
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0xC3) break;
+                                        i = 47;
+                                        break;
+                                    case 0xA9:
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0xC3) break;
+                                        i = 48;
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'g') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'i':
+                                        i = 49;
+                                        break;
+                                    case 0xAF:
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0xC3) break;
+                                        i = 50;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 51;
+                                        break;
+                                    case 0xA0:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 52;
+                                        break;
+                                    case 0xA1:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 53;
+                                        break;
+                                }
+                                break;
+                            case 0xAC:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 54;
+                                break;
+                            case 0xAD:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 55;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'a':
+                                        i = 56;
+                                        break;
+                                    case 'i':
+                                        i = 57;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 's') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 58;
+                                break;
+                            case 'e':
+                                i = 59;
+                                break;
+                            case 'i':
+                                i = 60;
+                                break;
+                            case 0xA0:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                i = 61;
+                                break;
+                            case 0xA8:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                i = 62;
+                                break;
+                            case 0xA9:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                i = 63;
+                                break;
+                            case 0xAD:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                i = 64;
+                                break;
+                        }
+                        break;
+                    case 0xAF:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 65;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 66;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'b':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 67;
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 68;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 69;
+                                        break;
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 70;
+                                        break;
+                                    case 'i':
+                                        i = 71;
+                                        break;
+                                }
+                                break;
+                            case 0xAD:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 72;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'a':
+                                        i = 73;
+                                        break;
+                                    case 'e':
+                                        i = 74;
+                                        break;
+                                    case 'i':
+                                        i = 75;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        i = 76;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                i = 77;
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 78;
+                                        break;
+                                    case 'i':
+                                        i = 79;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 80;
+                                        break;
+                                    case 'e':
+                                        i = 81;
+                                        break;
+                                    case 'i':
+                                        i = 82;
+                                        break;
+                                    case 0xA0:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 83;
+                                        break;
+                                    case 0xAF:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 84;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 85;
+                                        break;
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 86;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 87;
+                                                break;
+                                            case 'e':
+                                                i = 88;
+                                                break;
+                                            case 'i':
+                                                i = 89;
+                                                break;
+                                            case 0xA9:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0xC3) break;
+                                                i = 90;
+                                                break;
+                                            case 0xAF:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0xC3) break;
+                                                i = 91;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'q') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'e':
+                                        i = 92;
+                                        break;
+                                    case 'i':
+                                        i = 93;
+                                        break;
+                                    case 0xAF:
+                                        if (n <= 6) break;
+                                        if (q[-7] != 0xC3) break;
+                                        i = 94;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 95;
+                                break;
+                            case 'x':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 96;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 97;
+                                        break;
+                                    case 0xAF:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 98;
+                                        break;
+                                }
+                                break;
+                            case 0xAF:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 99;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        i = 100;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 101;
+                                break;
+                            case 's':
+                                i = 102;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 103;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 104;
+                                                break;
+                                            case 'e':
+                                                i = 105;
+                                                break;
+                                            case 'i':
+                                                i = 106;
+                                                break;
+                                            case 0xAF:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0xC3) break;
+                                                i = 107;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'q') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'e') break;
+                                i = 108;
+                                break;
+                            case 'x':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 109;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 110;
+                                break;
+                            case 'e':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 111;
+                                break;
+                        }
+                        break;
+                    case 0xA1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'r') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 112;
+                                break;
+                            case 'e':
+                                i = 113;
+                                break;
+                            case 'i':
+                                i = 114;
+                                break;
+                        }
+                        break;
+                    case 0xAF:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 115;
+                        break;
+                }
+                break;
+            case 'o':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 116;
+                                break;
+                            case 'i':
+                                i = 117;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 118;
+                                        break;
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 119;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        i = 120;
+                        break;
+                    case 'x':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                i = 121;
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 122;
+                                break;
+                            case 0xAF:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 123;
+                                break;
+                        }
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 124;
+                        break;
+                }
+                break;
+            case 'r':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 125;
+                        if (n <= 2) break;
+                        if (q[-3] != 'z') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        i = 126;
+                        break;
+                    case 'e':
+                        i = 127;
+                        if (n <= 2) break;
+                        if (q[-3] != 'x') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'e') break;
+                        i = 128;
+                        break;
+                    case 'i':
+                        i = 129;
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        if (q[-3] != 'd') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 130;
+                        break;
+                }
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 131;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'b':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 132;
+                                break;
+                            case 'd':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 133;
+                                        break;
+                                    case 'i':
+                                        i = 134;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 135;
+                                        break;
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 136;
+                                        break;
+                                }
+                                break;
+                            case 0xAD:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 137;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'a':
+                                        i = 138;
+                                        break;
+                                    case 'e':
+                                        i = 139;
+                                        break;
+                                    case 'i':
+                                        i = 140;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'd':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 141;
+                        break;
+                    case 'e':
+                        i = 142;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 143;
+                                        break;
+                                    case 'i':
+                                        i = 144;
+                                        break;
+                                    case 'u':
+                                        i = 145;
+                                        break;
+                                    case 0xAF:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 146;
+                                        break;
+                                }
+                                break;
+                            case 'g':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 147;
+                                break;
+                            case 'i':
+                                i = 148;
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 149;
+                                        break;
+                                    case 'i':
+                                        i = 150;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 151;
+                                        break;
+                                    case 'i':
+                                        i = 152;
+                                        break;
+                                    case 'o':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'd') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'a') break;
+                                        i = 153;
+                                        break;
+                                    case 0xAF:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 154;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 155;
+                                        break;
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 156;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 157;
+                                                break;
+                                            case 'e':
+                                                i = 158;
+                                                break;
+                                            case 'i':
+                                                i = 159;
+                                                break;
+                                            case 0xAF:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0xC3) break;
+                                                i = 160;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'q') break;
+                                i = 161;
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'e':
+                                        i = 162;
+                                        break;
+                                    case 0xAF:
+                                        if (n <= 6) break;
+                                        if (q[-7] != 0xC3) break;
+                                        i = 163;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 164;
+                                break;
+                            case 'x':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 165;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 166;
+                                        break;
+                                    case 0xAF:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 167;
+                                        break;
+                                }
+                                break;
+                            case 0xAF:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 168;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 169;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 170;
+                                                break;
+                                            case 'e':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 171;
+                                                break;
+                                        }
+                                        break;
+                                    case 0xAD:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 172;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        if (n <= 6) break;
+                                        switch (q[-7]) {
+                                            case 'a':
+                                                i = 173;
+                                                break;
+                                            case 'e':
+                                                i = 174;
+                                                break;
+                                            case 'i':
+                                                i = 175;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 's':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 176;
+                                                break;
+                                            case 'e':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 177;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 178;
+                                                break;
+                                            case 'i':
+                                                i = 179;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 180;
+                                break;
+                            case 's':
+                                i = 181;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 182;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 183;
+                                                break;
+                                            case 'e':
+                                                i = 184;
+                                                break;
+                                            case 'i':
+                                                i = 185;
+                                                break;
+                                            case 0xAF:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0xC3) break;
+                                                i = 186;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'q') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'e') break;
+                                i = 187;
+                                break;
+                            case 'x':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 188;
+                                break;
+                            case 'z':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 189;
+                                break;
+                            case 0xA1:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 190;
+                                break;
+                            case 0xA9:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'a':
+                                        i = 191;
+                                        break;
+                                    case 'e':
+                                        i = 192;
+                                        break;
+                                    case 'i':
+                                        i = 193;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 194;
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 195;
+                                        break;
+                                    case 'i':
+                                        i = 196;
+                                        break;
+                                }
+                                break;
+                            case 'm':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 197;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'b':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0xA1) break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 0xC3) break;
+                                                i = 198;
+                                                break;
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 0xA1:
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 0xC3) break;
+                                                        i = 199;
+                                                        break;
+                                                    case 0xA9:
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 0xC3) break;
+                                                        if (n <= 7) break;
+                                                        if (q[-8] != 'i') break;
+                                                        i = 200;
+                                                        break;
+                                                }
+                                                break;
+                                            case 0xAD:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0xC3) break;
+                                                i = 201;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'r') break;
+                                                if (n <= 7) break;
+                                                switch (q[-8]) {
+                                                    case 'a':
+                                                        i = 202;
+                                                        break;
+                                                    case 'e':
+                                                        i = 203;
+                                                        break;
+                                                    case 'i':
+                                                        i = 204;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 205;
+                                                        break;
+                                                    case 'e':
+                                                        i = 206;
+                                                        break;
+                                                    case 'i':
+                                                        i = 207;
+                                                        break;
+                                                }
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 0xA1:
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 0xC3) break;
+                                                        i = 208;
+                                                        break;
+                                                    case 0xA9:
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 0xC3) break;
+                                                        if (n <= 7) break;
+                                                        if (q[-8] != 'i') break;
+                                                        i = 209;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'i':
+                                        i = 210;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'd') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 211;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 212;
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 213;
+                                break;
+                            case 'e':
+                                i = 214;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 215;
+                                break;
+                            case 'i':
+                                i = 216;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 217;
+                                break;
+                        }
+                        break;
+                    case 0xA0:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 218;
+                        if (n <= 3) break;
+                        if (q[-4] != 'r') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 219;
+                                break;
+                            case 'i':
+                                i = 220;
+                                break;
+                        }
+                        break;
+                    case 0xA1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'r') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 221;
+                                break;
+                            case 'e':
+                                i = 222;
+                                break;
+                            case 'i':
+                                i = 223;
+                                break;
+                        }
+                        break;
+                    case 0xA9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 224;
+                        if (n <= 3) break;
+                        if (q[-4] != 'r') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 225;
+                        break;
+                    case 0xAD:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 226;
+                        break;
+                    case 0xAF:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 227;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 228;
+                        break;
+                    case 'i':
+                        i = 229;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 230;
+                                break;
+                            case 'e':
+                                i = 231;
+                                break;
+                            case 'i':
+                                i = 232;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        i = 233;
+                        break;
+                    case 0xAF:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 234;
+                        break;
+                }
+                break;
+            case 'u':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 235;
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 236;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                i = 237;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 238;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 239;
+                                        break;
+                                    case 'i':
+                                        i = 240;
+                                        break;
+                                    case 0xA0:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 241;
+                                        break;
+                                    case 0xAD:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 242;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 243;
+                                        break;
+                                    case 'e':
+                                        i = 244;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'e') break;
+                                        i = 245;
+                                        break;
+                                    case 0xA0:
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0xC3) break;
+                                        i = 246;
+                                        break;
+                                    case 0xA9:
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0xC3) break;
+                                        i = 247;
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'g') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'i':
+                                        i = 248;
+                                        break;
+                                    case 0xAF:
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0xC3) break;
+                                        i = 249;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0xA0:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 250;
+                                        break;
+                                    case 0xA1:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xC3) break;
+                                        i = 251;
+                                        break;
+                                }
+                                break;
+                            case 'z':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 252;
+                                break;
+                            case 0xAC:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 253;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 254;
+                                break;
+                            case 0xAD:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 255;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'a':
+                                        i = 256;
+                                        break;
+                                    case 'i':
+                                        i = 257;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 's') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 258;
+                                break;
+                            case 'i':
+                                i = 259;
+                                break;
+                            case 0xA0:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                i = 260;
+                                break;
+                            case 0xA8:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                i = 261;
+                                break;
+                            case 0xA9:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                i = 262;
+                                break;
+                            case 0xAD:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                i = 263;
+                                break;
+                        }
+                        break;
+                    case 0xAF:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 264;
+                        break;
+                }
+                break;
+            case 'x':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        i = 265;
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 266;
+                        break;
+                    case 0xAF:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 267;
+                        break;
+                }
+                break;
+            case 'z':
+                if (n <= 1) break;
+                if (q[-2] != 't') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 268;
+                break;
+            case 0xA0:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'i':
+                        i = 269;
+                        break;
+                    case 'r':
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 270;
+                                break;
+                            case 'i':
+                                i = 271;
+                                break;
+                        }
+                        break;
+                    case 'z':
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 272;
+                        break;
+                }
+                break;
+            case 0xA1:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                if (n <= 2) break;
+                if (q[-3] != 'r') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'a':
+                        i = 273;
+                        break;
+                    case 'e':
+                        i = 274;
+                        break;
+                    case 'i':
+                        i = 275;
+                        break;
+                }
+                break;
+            case 0xA8:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                if (n <= 2) break;
+                if (q[-3] != 'r') break;
+                if (n <= 3) break;
+                if (q[-4] != 'i') break;
+                i = 276;
+                break;
+            case 0xA9:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                if (n <= 2) break;
+                if (q[-3] != 'r') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'a':
+                        i = 277;
+                        break;
+                    case 'e':
+                        i = 278;
+                        break;
+                    case 'i':
+                        i = 279;
+                        break;
+                }
+                break;
+            case 0xAD:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                i = 280;
+                break;
+            case 0xAF:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 281;
+                break;
+            case 0xB3:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 282;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+
+static const unsigned char a_4_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0xC2, 0x3C, 0x4,
+    0x0, 0x0, 0x0, 0x0, 0x3, 0xB2, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                i = 0;
+                break;
+            case 'e':
+                i = 1;
+                break;
+            case 'i':
+                i = 2;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xC3) break;
+                i = 3;
+                break;
+            case 'o':
+                i = 4;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 5;
+                break;
+            case 's':
+                i = 6;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        i = 7;
+                        break;
+                    case 'o':
+                        i = 8;
+                        break;
+                    case 0xAF:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 9;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 10;
+                break;
+            case 'u':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        i = 11;
+                        break;
+                    case 'i':
+                        i = 12;
+                        break;
+                    case 'q':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 13;
+                        break;
+                }
+                break;
+            case 'z':
+                if (n <= 1) break;
+                if (q[-2] != 't') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 14;
+                break;
+            case 0xA0:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                i = 15;
+                break;
+            case 0xA1:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                i = 16;
+                break;
+            case 0xA9:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                i = 17;
+                break;
+            case 0xAC:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                i = 18;
+                break;
+            case 0xAD:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                i = 19;
+                break;
+            case 0xAF:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                i = 20;
+                break;
+            case 0xB3:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                i = 21;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+static const symbol s_3[] = { 'i', 'c' };
+
+extern int catalan_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    
+    z->I[1] = z->l;
+    z->I[0] = z->l;
+    {   int c1 = z->c;
+        {   
+            int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 252);
+            if (ret < 0) goto lab1;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 252);
+            if (ret < 0) goto lab1;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+        {   
+            int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 252);
+            if (ret < 0) goto lab1;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 252);
+            if (ret < 0) goto lab1;
+            z->c += ret;
+        }
+        z->I[0] = z->c;
+    lab1:
+        z->c = c1;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m2 = z->l - z->c; (void)m2;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1634850 >> (z->p[z->c - 1] & 0x1f)) & 1) || !((a_1_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) goto lab2;
+        if (!(find_among_b_1(z))) goto lab2;
+        z->bra = z->c;
+        if (!(z->I[1] <= z->c)) goto lab2;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab2:
+        z->c = z->l - m2;
+    }
+    {   int m3 = z->l - z->c; (void)m3;
+        {   int m4 = z->l - z->c; (void)m4;
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb || !((a_2_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || !((a_2_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) goto lab5;
+            among_var = find_among_b_2(z);
+            if (!(among_var)) goto lab5;
+            z->bra = z->c;
+            switch (among_var) {
+                case 1:
+                    if (!(z->I[1] <= z->c)) goto lab5;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    if (!(z->I[0] <= z->c)) goto lab5;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 3:
+                    if (!(z->I[0] <= z->c)) goto lab5;
+                    {   int ret = slice_from_s(z, 3, s_0);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 4:
+                    if (!(z->I[0] <= z->c)) goto lab5;
+                    {   int ret = slice_from_s(z, 2, s_1);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 5:
+                    if (!(z->I[1] <= z->c)) goto lab5;
+                    {   int ret = slice_from_s(z, 1, s_2);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+            goto lab4;
+        lab5:
+            z->c = z->l - m4;
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb || !((a_3_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || !((a_3_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) goto lab3;
+            among_var = find_among_b_3(z);
+            if (!(among_var)) goto lab3;
+            z->bra = z->c;
+            switch (among_var) {
+                case 1:
+                    if (!(z->I[1] <= z->c)) goto lab3;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    if (!(z->I[0] <= z->c)) goto lab3;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+        }
+    lab4:
+    lab3:
+        z->c = z->l - m3;
+    }
+    {   int m5 = z->l - z->c; (void)m5;
+        z->ket = z->c;
+        if (z->c <= z->lb || !((a_4_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1)) goto lab6;
+        among_var = find_among_b_4(z);
+        if (!(among_var)) goto lab6;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(z->I[1] <= z->c)) goto lab6;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                if (!(z->I[1] <= z->c)) goto lab6;
+                {   int ret = slice_from_s(z, 2, s_3);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab6:
+        z->c = z->l - m5;
+    }
+    z->c = z->lb;
+    {   int c6 = z->c;
+        {   int ret = translate_U(z, &a_0_translation);
+            if (ret < 0) return ret;
+        }
+        z->c = c6;
+    }
+    return 1;
+}
+
+extern struct SN_env * catalan_UTF_8_create_env(void) { return SN_create_env(0, 2); }
+
+extern void catalan_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
@@ -0,0 +1,722 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int dutch_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+static int r_undouble(struct SN_env * z);
+static int r_en_ending(struct SN_env * z);
+static int r_e_ending(struct SN_env * z);
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * dutch_UTF_8_create_env(void);
+extern void dutch_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+static const symbol a_0_pool[25] = {
+    0xC3, 0xA1, 'a', 0xC3, 0xA4, 0xC3, 0xA9, 'e', 0xC3, 0xAB, 0xC3, 0xAD, 'i', 0xC3, 0xAF, 0xC3,
+    0xB3, 'o', 0xC3, 0xB6, 0xC3, 0xBA, 'u', 0xC3, 0xBC
+};
+
+static const struct translation_entry a_0_entry[10] = {
+    { 0, 2, 2, 1 },
+    { 3, 2, 2, 1 },
+    { 5, 2, 7, 1 },
+    { 8, 2, 7, 1 },
+    { 10, 2, 12, 1 },
+    { 13, 2, 12, 1 },
+    { 15, 2, 17, 1 },
+    { 18, 2, 17, 1 },
+    { 20, 2, 22, 1 },
+    { 23, 2, 22, 1 }
+};
+
+static const unsigned short a_0_page[1] = {
+    256
+};
+
+static const unsigned short a_0_index[512] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 2, 0, 0, 0, 0, 3, 0, 4, 0, 5, 0, 6,
+    0, 0, 0, 7, 0, 0, 8, 0, 0, 0, 9, 0, 10, 0, 0, 0
+};
+
+static const struct translation a_0_translation = {
+    0, 0, 1, a_0_page, a_0_index, a_0_entry, a_0_pool
+};
+
+static const symbol a_1_pool[4] = {
+    'I', 'i', 'Y', 'y'
+};
+
+static const struct translation_entry a_1_entry[2] = {
+    { 0, 1, 1, 1 },
+    { 2, 1, 3, 1 }
+};
+
+static const unsigned short a_1_page[1] = {
+    256
+};
+
+static const unsigned short a_1_index[512] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const struct translation a_1_translation = {
+    0, 0, 1, a_1_page, a_1_index, a_1_entry, a_1_pool
+};
+
+
+static const struct among a_2[3] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 }
+};
+
+
+static const struct among a_3[5] =
+{
+{ 0, 3, -1, 2 },
+{ 0, 2, -1, 3 },
+{ 0, 2, -1, 2 },
+{ 0, 5, 2, 1 },
+{ 0, 1, -1, 3 }
+};
+
+
+static const struct among a_4[6] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 3 },
+{ 0, 4, -1, 4 },
+{ 0, 3, -1, 5 }
+};
+
+
+static const struct among a_5[4] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v[] = { 17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128 };
+
+static const unsigned char g_v_I_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v_I[] = { 1, 0, 0, 17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128 };
+
+static const unsigned char g_v_j_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v_j[] = { 17, 67, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128 };
+
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'd') break;
+                i = 0;
+                break;
+            case 'k':
+                if (n <= 1) break;
+                if (q[-2] != 'k') break;
+                i = 1;
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 't') break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_0[] = { 'g', 'e', 'm' };
+static const symbol s_1[] = { 'Y' };
+static const symbol s_2[] = { 'I' };
+static const symbol s_3[] = { 'Y' };
+static const unsigned char g_v_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 192, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 0;
+                        break;
+                    case 's':
+                        i = 1;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 2;
+                if (n <= 2) break;
+                if (q[-3] != 'd') break;
+                if (n <= 3) break;
+                if (q[-4] != 'e') break;
+                if (n <= 4) break;
+                if (q[-5] != 'h') break;
+                i = 3;
+                break;
+            case 's':
+                i = 4;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+static const symbol s_4[] = { 'h', 'e', 'i', 'd' };
+static const symbol s_5[] = { 'h', 'e', 'i', 'd' };
+static const symbol s_6[] = { 'e', 'n' };
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                i = 0;
+                break;
+            case 'g':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        i = 1;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 'k':
+                if (n <= 1) break;
+                if (q[-2] != 'j') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                if (n <= 3) break;
+                if (q[-4] != 'l') break;
+                i = 3;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'a':
+                        if (n <= 3) break;
+                        if (q[-4] != 'b') break;
+                        i = 4;
+                        break;
+                    case 'b':
+                        i = 5;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+static const symbol s_7[] = { 'i', 'g' };
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                i = 0;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 1;
+                break;
+            case 'o':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                i = 2;
+                break;
+            case 'u':
+                if (n <= 1) break;
+                if (q[-2] != 'u') break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+
+static int r_undouble(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1050640 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((1050640 >> (z->p[z->c - 2] & 0x1f)) & 1)) return 0;
+        if (!(find_among_b_2(z))) return 0;
+        z->c = z->l - m_test1;
+    }
+    z->ket = z->c;
+    {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+        if (ret < 0) return 0;
+        z->c = ret;
+    }
+    z->bra = z->c;
+    {   int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_e_ending(struct SN_env * z) {
+    z->I[2] = 0;
+    z->ket = z->c;
+    if (z->c <= z->lb || z->p[z->c - 1] != 'e') return 0;
+    z->c--;
+    z->bra = z->c;
+    if (!(z->I[1] <= z->c)) return 0;
+    {   int m_test1 = z->l - z->c;
+        if (out_class_b_U(z, g_v_class, g_v, 97, 232, 0)) return 0;
+        z->c = z->l - m_test1;
+    }
+    {   int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    z->I[2] = 1;
+    {   int ret = r_undouble(z);
+        if (ret <= 0) return ret;
+    }
+    return 1;
+}
+
+static int r_en_ending(struct SN_env * z) {
+    if (!(z->I[1] <= z->c)) return 0;
+    {   int m1 = z->l - z->c; (void)m1;
+        if (out_class_b_U(z, g_v_class, g_v, 97, 232, 0)) return 0;
+        z->c = z->l - m1;
+        {   int m2 = z->l - z->c; (void)m2;
+            if (!(eq_s_b(z, 3, s_0))) goto lab0;
+            return 0;
+        lab0:
+            z->c = z->l - m2;
+        }
+    }
+    {   int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    {   int ret = r_undouble(z);
+        if (ret <= 0) return ret;
+    }
+    return 1;
+}
+
+extern int dutch_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    {   int c1 = z->c;
+        {   int c_test2 = z->c;
+            {   int ret = translate_U(z, &a_0_translation);
+                if (ret < 0) return ret;
+            }
+            z->c = c_test2;
+        }
+        {   int c3 = z->c;
+            z->bra = z->c;
+            if (z->c == z->l || z->p[z->c] != 'y') { z->c = c3; goto lab1; }
+            z->c++;
+            z->ket = z->c;
+            {   int ret = slice_from_s(z, 1, s_1);
+                if (ret < 0) return ret;
+            }
+        lab1:
+            ;
+        }
+        while(1) {
+            int c4 = z->c;
+            while(1) {
+                int c5 = z->c;
+                if (in_class_U(z, g_v_class, g_v, 97, 232, 0)) goto lab3;
+                z->bra = z->c;
+                {   int c6 = z->c;
+                    if (z->c == z->l || z->p[z->c] != 'i') goto lab5;
+                    z->c++;
+                    z->ket = z->c;
+                    if (in_class_U(z, g_v_class, g_v, 97, 232, 0)) goto lab5;
+                    {   int ret = slice_from_s(z, 1, s_2);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab4;
+                lab5:
+                    z->c = c6;
+                    if (z->c == z->l || z->p[z->c] != 'y') goto lab3;
+                    z->c++;
+                    z->ket = z->c;
+                    {   int ret = slice_from_s(z, 1, s_3);
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab4:
+                z->c = c5;
+                break;
+            lab3:
+                z->c = c5;
+                {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                    if (ret < 0) goto lab2;
+                    z->c = ret;
+                }
+            }
+            continue;
+        lab2:
+            z->c = c4;
+            break;
+        }
+        z->c = c1;
+    }
+    {   int c7 = z->c;
+        z->I[1] = z->l;
+        z->I[0] = z->l;
+        {   
+            int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 232);
+            if (ret < 0) goto lab6;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 232);
+            if (ret < 0) goto lab6;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+        
+        if (!(z->I[1] < 3)) goto lab7;
+        z->I[1] = 3;
+    lab7:
+        {   
+            int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 232);
+            if (ret < 0) goto lab6;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 232);
+            if (ret < 0) goto lab6;
+            z->c += ret;
+        }
+        z->I[0] = z->c;
+    lab6:
+        z->c = c7;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    
+    {   int m8 = z->l - z->c; (void)m8;
+        z->ket = z->c;
+        if (z->c <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((540704 >> (z->p[z->c - 1] & 0x1f)) & 1)) goto lab9;
+        among_var = find_among_b_3(z);
+        if (!(among_var)) goto lab9;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(z->I[1] <= z->c)) goto lab9;
+                {   int ret = slice_from_s(z, 4, s_4);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = r_en_ending(z);
+                    if (ret == 0) goto lab9;
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                if (!(z->I[1] <= z->c)) goto lab9;
+                if (out_class_b_U(z, g_v_j_class, g_v_j, 97, 232, 0)) goto lab9;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab9:
+        z->c = z->l - m8;
+    }
+    {   int m9 = z->l - z->c; (void)m9;
+        {   int ret = r_e_ending(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - m9;
+    }
+    {   int m10 = z->l - z->c; (void)m10;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 4, s_5))) goto lab10;
+        z->bra = z->c;
+        if (!(z->I[0] <= z->c)) goto lab10;
+        {   int m11 = z->l - z->c; (void)m11;
+            if (z->c <= z->lb || z->p[z->c - 1] != 'c') goto lab11;
+            z->c--;
+            goto lab10;
+        lab11:
+            z->c = z->l - m11;
+        }
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->ket = z->c;
+        if (!(eq_s_b(z, 2, s_6))) goto lab10;
+        z->bra = z->c;
+        {   int ret = r_en_ending(z);
+            if (ret == 0) goto lab10;
+            if (ret < 0) return ret;
+        }
+    lab10:
+        z->c = z->l - m10;
+    }
+    {   int m12 = z->l - z->c; (void)m12;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((264336 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((17922 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab12;
+        among_var = find_among_b_4(z);
+        if (!(among_var)) goto lab12;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(z->I[0] <= z->c)) goto lab12;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int m13 = z->l - z->c; (void)m13;
+                    z->ket = z->c;
+                    if (!(eq_s_b(z, 2, s_7))) goto lab14;
+                    z->bra = z->c;
+                    if (!(z->I[0] <= z->c)) goto lab14;
+                    {   int m14 = z->l - z->c; (void)m14;
+                        if (z->c <= z->lb || z->p[z->c - 1] != 'e') goto lab15;
+                        z->c--;
+                        goto lab14;
+                    lab15:
+                        z->c = z->l - m14;
+                    }
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab13;
+                lab14:
+                    z->c = z->l - m13;
+                    {   int ret = r_undouble(z);
+                        if (ret == 0) goto lab12;
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab13:
+                break;
+            case 2:
+                if (!(z->I[0] <= z->c)) goto lab12;
+                {   int m15 = z->l - z->c; (void)m15;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'e') goto lab16;
+                    z->c--;
+                    goto lab12;
+                lab16:
+                    z->c = z->l - m15;
+                }
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                if (!(z->I[0] <= z->c)) goto lab12;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int ret = r_e_ending(z);
+                    if (ret == 0) goto lab12;
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                if (!(z->I[0] <= z->c)) goto lab12;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                if (!(z->I[0] <= z->c)) goto lab12;
+                if (!(z->I[2])) goto lab12;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab12:
+        z->c = z->l - m12;
+    }
+    {   int m16 = z->l - z->c; (void)m16;
+        if (out_class_b_U(z, g_v_I_class, g_v_I, 73, 232, 0)) goto lab17;
+        {   int m_test17 = z->l - z->c;
+            if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((2129954 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((2129954 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab17;
+            if (!(find_among_b_5(z))) goto lab17;
+            if (out_class_b_U(z, g_v_class, g_v, 97, 232, 0)) goto lab17;
+            z->c = z->l - m_test17;
+        }
+        z->ket = z->c;
+        {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+            if (ret < 0) goto lab17;
+            z->c = ret;
+        }
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab17:
+        z->c = z->l - m16;
+    }
+    z->c = z->lb;
+    {   int c18 = z->c;
+        {   int ret = translate_U(z, &a_1_translation);
+            if (ret < 0) return ret;
+        }
+        z->c = c18;
+    }
+    return 1;
+}
+
+extern struct SN_env * dutch_UTF_8_create_env(void) { return SN_create_env(0, 3); }
+
+extern void dutch_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
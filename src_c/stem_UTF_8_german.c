@@ -0,0 +1,632 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int german_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * german_UTF_8_create_env(void);
+extern void german_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+static const symbol a_0_pool[12] = {
+    'U', 'u', 'Y', 'y', 0xC3, 0xA4, 'a', 0xC3, 0xB6, 'o', 0xC3, 0xBC
+};
+
+static const struct translation_entry a_0_entry[5] = {
+    { 0, 1, 1, 1 },
+    { 2, 1, 3, 1 },
+    { 4, 2, 6, 1 },
+    { 7, 2, 9, 1 },
+    { 10, 2, 1, 1 }
+};
+
+static const unsigned short a_0_page[1] = {
+    256
+};
+
+static const unsigned short a_0_index[512] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 5, 0, 0, 0
+};
+
+static const struct translation a_0_translation = {
+    0, 0, 1, a_0_page, a_0_index, a_0_entry, a_0_pool
+};
+
+
+static const struct among a_1[7] =
+{
+{ 0, 1, -1, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 1, -1, 3 },
+{ 0, 2, 5, 2 }
+};
+
+
+static const struct among a_2[4] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 3, 2, 1 }
+};
+
+
+static const struct among a_3[2] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+
+static const struct among a_4[8] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 3 },
+{ 0, 4, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 4, -1, 3 },
+{ 0, 4, -1, 4 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v[] = { 17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32, 8 };
+
+static const unsigned char g_s_ending_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 1, 0, 1, 1, 1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_s_ending[] = { 117, 30, 5 };
+
+static const unsigned char g_st_ending_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 1, 0, 1, 1, 1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_st_ending[] = { 117, 30, 4 };
+
+static const symbol s_0[] = { 0xC3, 0x9F };
+static const symbol s_1[] = { 's', 's' };
+static const symbol s_2[] = { 'U' };
+static const symbol s_3[] = { 'Y' };
+static const unsigned char g_v_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 192, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'e':
+                i = 0;
+                break;
+            case 'm':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 1;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        i = 2;
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 3;
+                        break;
+                }
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 4;
+                break;
+            case 's':
+                i = 5;
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 6;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+static const symbol s_4[] = { 'n', 'i', 's' };
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 0;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 1;
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                i = 2;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                i = 0;
+                break;
+            case 'g':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        i = 1;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'u') break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 'h':
+                if (n <= 1) break;
+                if (q[-2] != 'c') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'i':
+                        if (n <= 3) break;
+                        if (q[-4] != 'l') break;
+                        i = 3;
+                        break;
+                    case 's':
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 'k':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 5;
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'h':
+                        i = 6;
+                        break;
+                    case 'k':
+                        i = 7;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+static const symbol s_5[] = { 'i', 'g' };
+static const symbol s_6[] = { 'e', 'r' };
+static const symbol s_7[] = { 'e', 'n' };
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 0;
+                break;
+            case 'h':
+                if (n <= 1) break;
+                if (q[-2] != 'c') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                if (n <= 3) break;
+                if (q[-4] != 'l') break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+
+extern int german_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    {   int c1 = z->c;
+        {   int c_test2 = z->c;
+            while(1) {
+                int c3 = z->c;
+                {   int c4 = z->c;
+                    z->bra = z->c;
+                    if (!(eq_s(z, 2, s_0))) goto lab3;
+                    z->ket = z->c;
+                    {   int ret = slice_from_s(z, 2, s_1);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab2;
+                lab3:
+                    z->c = c4;
+                    {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                        if (ret < 0) goto lab1;
+                        z->c = ret;
+                    }
+                }
+            lab2:
+                continue;
+            lab1:
+                z->c = c3;
+                break;
+            }
+            z->c = c_test2;
+        }
+        while(1) {
+            int c5 = z->c;
+            while(1) {
+                int c6 = z->c;
+                if (in_class_U(z, g_v_class, g_v, 97, 252, 0)) goto lab5;
+                z->bra = z->c;
+                {   int c7 = z->c;
+                    if (z->c == z->l || z->p[z->c] != 'u') goto lab7;
+                    z->c++;
+                    z->ket = z->c;
+                    if (in_class_U(z, g_v_class, g_v, 97, 252, 0)) goto lab7;
+                    {   int ret = slice_from_s(z, 1, s_2);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab6;
+                lab7:
+                    z->c = c7;
+                    if (z->c == z->l || z->p[z->c] != 'y') goto lab5;
+                    z->c++;
+                    z->ket = z->c;
+                    if (in_class_U(z, g_v_class, g_v, 97, 252, 0)) goto lab5;
+                    {   int ret = slice_from_s(z, 1, s_3);
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab6:
+                z->c = c6;
+                break;
+            lab5:
+                z->c = c6;
+                {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                    if (ret < 0) goto lab4;
+                    z->c = ret;
+                }
+            }
+            continue;
+        lab4:
+            z->c = c5;
+            break;
+        }
+        z->c = c1;
+    }
+    {   int c8 = z->c;
+        z->I[2] = z->l;
+        z->I[1] = z->l;
+        {   int c_test9 = z->c;
+            {   int ret = hop_utf8(z, z->c, z->l, 3);
+                if (ret < 0) goto lab8;
+                z->c = ret;
+            }
+            z->I[0] = z->c;
+            z->c = c_test9;
+        }
+        {   
+            int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 252);
+            if (ret < 0) goto lab8;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 252);
+            if (ret < 0) goto lab8;
+            z->c += ret;
+        }
+        z->I[2] = z->c;
+        
+        if (!(z->I[2] < z->I[0])) goto lab9;
+        z->I[2] = z->I[0];
+    lab9:
+        {   
+            int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 252);
+            if (ret < 0) goto lab8;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 252);
+            if (ret < 0) goto lab8;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+    lab8:
+        z->c = c8;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    
+    {   int m10 = z->l - z->c; (void)m10;
+        z->ket = z->c;
+        if (z->c <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((811040 >> (z->p[z->c - 1] & 0x1f)) & 1)) goto lab11;
+        among_var = find_among_b_1(z);
+        if (!(among_var)) goto lab11;
+        z->bra = z->c;
+        if (!(z->I[2] <= z->c)) goto lab11;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int m11 = z->l - z->c; (void)m11;
+                    z->ket = z->c;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 's') { z->c = z->l - m11; goto lab12; }
+                    z->c--;
+                    z->bra = z->c;
+                    if (!(eq_s_b(z, 3, s_4))) { z->c = z->l - m11; goto lab12; }
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                lab12:
+                    ;
+                }
+                break;
+            case 3:
+                if (in_class_b_U(z, g_s_ending_class, g_s_ending, 98, 116, 0)) goto lab11;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab11:
+        z->c = z->l - m10;
+    }
+    {   int m12 = z->l - z->c; (void)m12;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1327104 >> (z->p[z->c - 1] & 0x1f)) & 1) || (z->p[z->c - 2] != 101 && z->p[z->c - 2] != 115)) goto lab13;
+        among_var = find_among_b_2(z);
+        if (!(among_var)) goto lab13;
+        z->bra = z->c;
+        if (!(z->I[2] <= z->c)) goto lab13;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                if (in_class_b_U(z, g_st_ending_class, g_st_ending, 98, 116, 0)) goto lab13;
+                {   int ret = hop_b_utf8(z, z->c, z->lb, 3);
+                    if (ret < 0) goto lab13;
+                    z->c = ret;
+                }
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab13:
+        z->c = z->l - m12;
+    }
+    {   int m13 = z->l - z->c; (void)m13;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1051024 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((16904 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab14;
+        among_var = find_among_b_4(z);
+        if (!(among_var)) goto lab14;
+        z->bra = z->c;
+        if (!(z->I[1] <= z->c)) goto lab14;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int m14 = z->l - z->c; (void)m14;
+                    z->ket = z->c;
+                    if (!(eq_s_b(z, 2, s_5))) { z->c = z->l - m14; goto lab15; }
+                    z->bra = z->c;
+                    {   int m15 = z->l - z->c; (void)m15;
+                        if (z->c <= z->lb || z->p[z->c - 1] != 'e') goto lab16;
+                        z->c--;
+                        { z->c = z->l - m14; goto lab15; }
+                    lab16:
+                        z->c = z->l - m15;
+                    }
+                    if (!(z->I[1] <= z->c)) { z->c = z->l - m14; goto lab15; }
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                lab15:
+                    ;
+                }
+                break;
+            case 2:
+                {   int m16 = z->l - z->c; (void)m16;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'e') goto lab17;
+                    z->c--;
+                    goto lab14;
+                lab17:
+                    z->c = z->l - m16;
+                }
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int m17 = z->l - z->c; (void)m17;
+                    z->ket = z->c;
+                    {   int m18 = z->l - z->c; (void)m18;
+                        if (!(eq_s_b(z, 2, s_6))) goto lab20;
+                        goto lab19;
+                    lab20:
+                        z->c = z->l - m18;
+                        if (!(eq_s_b(z, 2, s_7))) { z->c = z->l - m17; goto lab18; }
+                    }
+                lab19:
+                    z->bra = z->c;
+                    if (!(z->I[2] <= z->c)) { z->c = z->l - m17; goto lab18; }
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                lab18:
+                    ;
+                }
+                break;
+            case 4:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int m19 = z->l - z->c; (void)m19;
+                    z->ket = z->c;
+                    if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 103 && z->p[z->c - 1] != 104) || (z->p[z->c - 2] != 99 && z->p[z->c - 2] != 105)) { z->c = z->l - m19; goto lab21; }
+                    if (!(find_among_b_3(z))) { z->c = z->l - m19; goto lab21; }
+                    z->bra = z->c;
+                    if (!(z->I[1] <= z->c)) { z->c = z->l - m19; goto lab21; }
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                lab21:
+                    ;
+                }
+                break;
+        }
+    lab14:
+        z->c = z->l - m13;
+    }
+    z->c = z->lb;
+    {   int c20 = z->c;
+        {   int ret = translate_U(z, &a_0_translation);
+            if (ret < 0) return ret;
+        }
+        z->c = c20;
+    }
+    return 1;
+}
+
+extern struct SN_env * german_UTF_8_create_env(void) { return SN_create_env(0, 3); }
+
+extern void german_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
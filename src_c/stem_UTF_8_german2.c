@@ -0,0 +1,708 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int german2_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * german2_UTF_8_create_env(void);
+extern void german2_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[6] =
+{
+{ 0, 0, -1, 5 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 3 },
+{ 0, 2, 0, -1 },
+{ 0, 2, 0, 4 },
+{ 0, 2, 0, 1 }
+};
+
+static const symbol a_1_pool[12] = {
+    'U', 'u', 'Y', 'y', 0xC3, 0xA4, 'a', 0xC3, 0xB6, 'o', 0xC3, 0xBC
+};
+
+static const struct translation_entry a_1_entry[5] = {
+    { 0, 1, 1, 1 },
+    { 2, 1, 3, 1 },
+    { 4, 2, 6, 1 },
+    { 7, 2, 9, 1 },
+    { 10, 2, 1, 1 }
+};
+
+static const unsigned short a_1_page[1] = {
+    256
+};
+
+static const unsigned short a_1_index[512] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 5, 0, 0, 0
+};
+
+static const struct translation a_1_translation = {
+    0, 0, 1, a_1_page, a_1_index, a_1_entry, a_1_pool
+};
+
+
+static const struct among a_2[7] =
+{
+{ 0, 1, -1, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 1, -1, 3 },
+{ 0, 2, 5, 2 }
+};
+
+
+static const struct among a_3[4] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 3, 2, 1 }
+};
+
+
+static const struct among a_4[2] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+
+static const struct among a_5[8] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 3 },
+{ 0, 4, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 4, -1, 3 },
+{ 0, 4, -1, 4 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v[] = { 17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32, 8 };
+
+static const unsigned char g_s_ending_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 1, 0, 1, 1, 1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_s_ending[] = { 117, 30, 5 };
+
+static const unsigned char g_st_ending_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 1, 0, 1, 1, 1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_st_ending[] = { 117, 30, 4 };
+
+static const symbol s_0[] = { 'U' };
+static const symbol s_1[] = { 'Y' };
+
+static const unsigned char a_0_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        i = 0;
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[1] != 'e') break;
+                i = 1;
+                break;
+            case 'o':
+                if (n <= 1) break;
+                if (q[1] != 'e') break;
+                i = 2;
+                break;
+            case 'q':
+                if (n <= 1) break;
+                if (q[1] != 'u') break;
+                i = 3;
+                break;
+            case 'u':
+                if (n <= 1) break;
+                if (q[1] != 'e') break;
+                i = 4;
+                break;
+            case 0xC3:
+                if (n <= 1) break;
+                if (q[1] != 0x9F) break;
+                i = 5;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_0[i].s_size;
+    return a_0[i].result;
+}
+static const symbol s_2[] = { 's', 's' };
+static const symbol s_3[] = { 0xC3, 0xA4 };
+static const symbol s_4[] = { 0xC3, 0xB6 };
+static const symbol s_5[] = { 0xC3, 0xBC };
+static const unsigned char g_v_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 192, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'e':
+                i = 0;
+                break;
+            case 'm':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 1;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        i = 2;
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 3;
+                        break;
+                }
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 4;
+                break;
+            case 's':
+                i = 5;
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 6;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_6[] = { 'n', 'i', 's' };
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 0;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 1;
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                i = 2;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                i = 0;
+                break;
+            case 'g':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        i = 1;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'u') break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 'h':
+                if (n <= 1) break;
+                if (q[-2] != 'c') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'i':
+                        if (n <= 3) break;
+                        if (q[-4] != 'l') break;
+                        i = 3;
+                        break;
+                    case 's':
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 'k':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 5;
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'h':
+                        i = 6;
+                        break;
+                    case 'k':
+                        i = 7;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+static const symbol s_7[] = { 'i', 'g' };
+static const symbol s_8[] = { 'e', 'r' };
+static const symbol s_9[] = { 'e', 'n' };
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 0;
+                break;
+            case 'h':
+                if (n <= 1) break;
+                if (q[-2] != 'c') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                if (n <= 3) break;
+                if (q[-4] != 'l') break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+
+extern int german2_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    {   int c1 = z->c;
+        {   int c_test2 = z->c;
+            while(1) {
+                int c3 = z->c;
+                while(1) {
+                    int c4 = z->c;
+                    if (in_class_U(z, g_v_class, g_v, 97, 252, 0)) goto lab2;
+                    z->bra = z->c;
+                    {   int c5 = z->c;
+                        if (z->c == z->l || z->p[z->c] != 'u') goto lab4;
+                        z->c++;
+                        z->ket = z->c;
+                        if (in_class_U(z, g_v_class, g_v, 97, 252, 0)) goto lab4;
+                        {   int ret = slice_from_s(z, 1, s_0);
+                            if (ret < 0) return ret;
+                        }
+                        goto lab3;
+                    lab4:
+                        z->c = c5;
+                        if (z->c == z->l || z->p[z->c] != 'y') goto lab2;
+                        z->c++;
+                        z->ket = z->c;
+                        if (in_class_U(z, g_v_class, g_v, 97, 252, 0)) goto lab2;
+                        {   int ret = slice_from_s(z, 1, s_1);
+                            if (ret < 0) return ret;
+                        }
+                    }
+                lab3:
+                    z->c = c4;
+                    break;
+                lab2:
+                    z->c = c4;
+                    {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                        if (ret < 0) goto lab1;
+                        z->c = ret;
+                    }
+                }
+                continue;
+            lab1:
+                z->c = c3;
+                break;
+            }
+            z->c = c_test2;
+        }
+        while(1) {
+            int c6 = z->c;
+            z->bra = z->c;
+            if (z->c + 1 >= z->l || !((a_0_filter0[z->p[z->c + 1] >> 3] >> (z->p[z->c + 1] & 7)) & 1)) among_var = 5; else
+            among_var = find_among_0(z);
+            if (!(among_var)) goto lab5;
+            z->ket = z->c;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_from_s(z, 2, s_2);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    {   int ret = slice_from_s(z, 2, s_3);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 3:
+                    {   int ret = slice_from_s(z, 2, s_4);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 4:
+                    {   int ret = slice_from_s(z, 2, s_5);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 5:
+                    {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                        if (ret < 0) goto lab5;
+                        z->c = ret;
+                    }
+                    break;
+            }
+            continue;
+        lab5:
+            z->c = c6;
+            break;
+        }
+        z->c = c1;
+    }
+    {   int c7 = z->c;
+        z->I[2] = z->l;
+        z->I[1] = z->l;
+        {   int c_test8 = z->c;
+            {   int ret = hop_utf8(z, z->c, z->l, 3);
+                if (ret < 0) goto lab6;
+                z->c = ret;
+            }
+            z->I[0] = z->c;
+            z->c = c_test8;
+        }
+        {   
+            int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 252);
+            if (ret < 0) goto lab6;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 252);
+            if (ret < 0) goto lab6;
+            z->c += ret;
+        }
+        z->I[2] = z->c;
+        
+        if (!(z->I[2] < z->I[0])) goto lab7;
+        z->I[2] = z->I[0];
+    lab7:
+        {   
+            int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 252);
+            if (ret < 0) goto lab6;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 252);
+            if (ret < 0) goto lab6;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+    lab6:
+        z->c = c7;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    
+    {   int m9 = z->l - z->c; (void)m9;
+        z->ket = z->c;
+        if (z->c <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((811040 >> (z->p[z->c - 1] & 0x1f)) & 1)) goto lab9;
+        among_var = find_among_b_2(z);
+        if (!(among_var)) goto lab9;
+        z->bra = z->c;
+        if (!(z->I[2] <= z->c)) goto lab9;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int m10 = z->l - z->c; (void)m10;
+                    z->ket = z->c;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 's') { z->c = z->l - m10; goto lab10; }
+                    z->c--;
+                    z->bra = z->c;
+                    if (!(eq_s_b(z, 3, s_6))) { z->c = z->l - m10; goto lab10; }
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                lab10:
+                    ;
+                }
+                break;
+            case 3:
+                if (in_class_b_U(z, g_s_ending_class, g_s_ending, 98, 116, 0)) goto lab9;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab9:
+        z->c = z->l - m9;
+    }
+    {   int m11 = z->l - z->c; (void)m11;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1327104 >> (z->p[z->c - 1] & 0x1f)) & 1) || (z->p[z->c - 2] != 101 && z->p[z->c - 2] != 115)) goto lab11;
+        among_var = find_among_b_3(z);
+        if (!(among_var)) goto lab11;
+        z->bra = z->c;
+        if (!(z->I[2] <= z->c)) goto lab11;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                if (in_class_b_U(z, g_st_ending_class, g_st_ending, 98, 116, 0)) goto lab11;
+                {   int ret = hop_b_utf8(z, z->c, z->lb, 3);
+                    if (ret < 0) goto lab11;
+                    z->c = ret;
+                }
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab11:
+        z->c = z->l - m11;
+    }
+    {   int m12 = z->l - z->c; (void)m12;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1051024 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((16904 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab12;
+        among_var = find_among_b_5(z);
+        if (!(among_var)) goto lab12;
+        z->bra = z->c;
+        if (!(z->I[1] <= z->c)) goto lab12;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int m13 = z->l - z->c; (void)m13;
+                    z->ket = z->c;
+                    if (!(eq_s_b(z, 2, s_7))) { z->c = z->l - m13; goto lab13; }
+                    z->bra = z->c;
+                    {   int m14 = z->l - z->c; (void)m14;
+                        if (z->c <= z->lb || z->p[z->c - 1] != 'e') goto lab14;
+                        z->c--;
+                        { z->c = z->l - m13; goto lab13; }
+                    lab14:
+                        z->c = z->l - m14;
+                    }
+                    if (!(z->I[1] <= z->c)) { z->c = z->l - m13; goto lab13; }
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                lab13:
+                    ;
+                }
+                break;
+            case 2:
+                {   int m15 = z->l - z->c; (void)m15;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'e') goto lab15;
+                    z->c--;
+                    goto lab12;
+                lab15:
+                    z->c = z->l - m15;
+                }
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int m16 = z->l - z->c; (void)m16;
+                    z->ket = z->c;
+                    {   int m17 = z->l - z->c; (void)m17;
+                        if (!(eq_s_b(z, 2, s_8))) goto lab18;
+                        goto lab17;
+                    lab18:
+                        z->c = z->l - m17;
+                        if (!(eq_s_b(z, 2, s_9))) { z->c = z->l - m16; goto lab16; }
+                    }
+                lab17:
+                    z->bra = z->c;
+                    if (!(z->I[2] <= z->c)) { z->c = z->l - m16; goto lab16; }
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                lab16:
+                    ;
+                }
+                break;
+            case 4:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int m18 = z->l - z->c; (void)m18;
+                    z->ket = z->c;
+                    if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 103 && z->p[z->c - 1] != 104) || (z->p[z->c - 2] != 99 && z->p[z->c - 2] != 105)) { z->c = z->l - m18; goto lab19; }
+                    if (!(find_among_b_4(z))) { z->c = z->l - m18; goto lab19; }
+                    z->bra = z->c;
+                    if (!(z->I[1] <= z->c)) { z->c = z->l - m18; goto lab19; }
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                lab19:
+                    ;
+                }
+                break;
+        }
+    lab12:
+        z->c = z->l - m12;
+    }
+    z->c = z->lb;
+    {   int c19 = z->c;
+        {   int ret = translate_U(z, &a_1_translation);
+            if (ret < 0) return ret;
+        }
+        z->c = c19;
+    }
+    return 1;
+}
+
+extern struct SN_env * german2_UTF_8_create_env(void) { return SN_create_env(0, 3); }
+
+extern void german2_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
@@ -0,0 +1,9092 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int greek_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * greek_UTF_8_create_env(void);
+extern void greek_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+static const symbol a_0_pool[138] = {
+    0xCF, 0x82, 0xCF, 0x83, 0xCE, 0x86, 0xCE, 0xB1, 0xCE, 0x88, 0xCE, 0xB5, 0xCE, 0x89, 0xCE, 0xB7,
+    0xCE, 0x8A, 0xCE, 0xB9, 0xCF, 0x8A, 0xCF, 0x8B, 0xCF, 0x85, 0xCE, 0x8C, 0xCE, 0xBF, 0xCF, 0x8C,
+    0xCF, 0x8D, 0xCE, 0x8E, 0xCF, 0x8E, 0xCF, 0x89, 0xCE, 0x8F, 0xCE, 0x90, 0xCE, 0x91, 0xCE, 0x92,
+    0xCE, 0xB2, 0xCE, 0x93, 0xCE, 0xB3, 0xCE, 0x94, 0xCE, 0xB4, 0xCE, 0x95, 0xCE, 0x96, 0xCE, 0xB6,
+    0xCE, 0x97, 0xCE, 0x98, 0xCE, 0xB8, 0xCE, 0x99, 0xCE, 0x9A, 0xCE, 0xBA, 0xCE, 0x9B, 0xCE, 0xBB,
+    0xCE, 0x9C, 0xCE, 0xBC, 0xCE, 0x9D, 0xCE, 0xBD, 0xCE, 0x9E, 0xCE, 0xBE, 0xCE, 0x9F, 0xCE, 0xA0,
+    0xCF, 0x80, 0xCE, 0xA1, 0xCF, 0x81, 0xCE, 0xA3, 0xCE, 0xA4, 0xCF, 0x84, 0xCE, 0xA5, 0xCE, 0xA6,
+    0xCF, 0x86, 0xCE, 0xA7, 0xCF, 0x87, 0xCE, 0xA8, 0xCF, 0x88, 0xCE, 0xA9, 0xCE, 0xAA, 0xCE, 0xAB,
+    0xCE, 0xAC, 0xCE, 0xAD, 0xCE, 0xAE, 0xCE, 0xAF, 0xCE, 0xB0
+};
+
+static const struct translation_entry a_0_entry[45] = {
+    { 0, 2, 2, 2 },
+    { 4, 2, 6, 2 },
+    { 8, 2, 10, 2 },
+    { 12, 2, 14, 2 },
+    { 16, 2, 18, 2 },
+    { 20, 2, 14, 2 },
+    { 22, 2, 24, 2 },
+    { 26, 2, 28, 2 },
+    { 30, 2, 28, 2 },
+    { 32, 2, 24, 2 },
+    { 34, 2, 24, 2 },
+    { 36, 2, 38, 2 },
+    { 40, 2, 38, 2 },
+    { 42, 2, 14, 2 },
+    { 44, 2, 6, 2 },
+    { 46, 2, 48, 2 },
+    { 50, 2, 52, 2 },
+    { 54, 2, 56, 2 },
+    { 58, 2, 10, 2 },
+    { 60, 2, 62, 2 },
+    { 64, 2, 14, 2 },
+    { 66, 2, 68, 2 },
+    { 70, 2, 18, 2 },
+    { 72, 2, 74, 2 },
+    { 76, 2, 78, 2 },
+    { 80, 2, 82, 2 },
+    { 84, 2, 86, 2 },
+    { 88, 2, 90, 2 },
+    { 92, 2, 28, 2 },
+    { 94, 2, 96, 2 },
+    { 98, 2, 100, 2 },
+    { 102, 2, 2, 2 },
+    { 104, 2, 106, 2 },
+    { 108, 2, 24, 2 },
+    { 110, 2, 112, 2 },
+    { 114, 2, 116, 2 },
+    { 118, 2, 120, 2 },
+    { 122, 2, 38, 2 },
+    { 124, 2, 18, 2 },
+    { 126, 2, 24, 2 },
+    { 128, 2, 6, 2 },
+    { 130, 2, 10, 2 },
+    { 132, 2, 14, 2 },
+    { 134, 2, 18, 2 },
+    { 136, 2, 24, 2 }
+};
+
+static const unsigned short a_0_page[1] = {
+    256
+};
+
+static const unsigned short a_0_index[512] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 2, 0, 3, 4, 5, 0, 8, 0, 11, 13,
+    14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29,
+    30, 31, 0, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44,
+    45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 6, 7, 9, 10, 12, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const struct translation a_0_translation = {
+    3, 3, 1, a_0_page, a_0_index, a_0_entry, a_0_pool
+};
+
+
+static const struct among a_1[40] =
+{
+{ 0, 16, -1, 10 },
+{ 0, 6, -1, 9 },
+{ 0, 10, -1, 7 },
+{ 0, 10, -1, 8 },
+{ 0, 10, -1, 6 },
+{ 0, 20, -1, 10 },
+{ 0, 10, -1, 9 },
+{ 0, 14, -1, 7 },
+{ 0, 14, -1, 8 },
+{ 0, 14, -1, 6 },
+{ 0, 18, -1, 11 },
+{ 0, 14, -1, 11 },
+{ 0, 12, -1, 1 },
+{ 0, 14, -1, 2 },
+{ 0, 12, -1, 4 },
+{ 0, 16, -1, 5 },
+{ 0, 14, -1, 3 },
+{ 0, 18, -1, 10 },
+{ 0, 8, -1, 9 },
+{ 0, 12, -1, 7 },
+{ 0, 12, -1, 8 },
+{ 0, 12, -1, 6 },
+{ 0, 16, -1, 11 },
+{ 0, 10, -1, 1 },
+{ 0, 12, -1, 2 },
+{ 0, 10, -1, 4 },
+{ 0, 14, -1, 5 },
+{ 0, 12, -1, 3 },
+{ 0, 12, -1, 7 },
+{ 0, 20, -1, 10 },
+{ 0, 10, -1, 9 },
+{ 0, 14, -1, 7 },
+{ 0, 14, -1, 8 },
+{ 0, 14, -1, 6 },
+{ 0, 18, -1, 11 },
+{ 0, 12, -1, 1 },
+{ 0, 14, -1, 2 },
+{ 0, 12, -1, 4 },
+{ 0, 16, -1, 5 },
+{ 0, 14, -1, 3 }
+};
+
+static const unsigned short a_2_displacement[] = {
+    1, 1, 2, 9, 1, 30, 8, 42,
+    0, 56, 1, 3, 5, 3, 33, 0
+};
+static const short a_2_slot[] = {
+    10, 8, 9, 15, 29, 6, 19, 17,
+    2, 24, 12, 5, 30, 28, 11, 0,
+    20, 3, 23, 16, 4, 25, 22, 18,
+    7, 27, 14, 26, 1, 21, 13
+};
+static const struct among_hash a_2_hash = {
+    21844, 16, a_2_displacement, a_2_slot
+};
+
+static const symbol a_2_pool[200] = {
+    0xCF, 0x80, 0xCE, 0xB9, 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xBF, 0xCF, 0x81, 0xCF, 0x83,
+    0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xB8, 0xCF, 0x81, 0xCE, 0xBF, 0xCE, 0xB3, 0xCE, 0xBB,
+    0xCF, 0x85, 0xCE, 0xBA, 0xCF, 0x85, 0xCF, 0x81, 0xCE, 0xB2, 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xB2,
+    0xCE, 0xBF, 0xCF, 0x81, 0xCE, 0xB3, 0xCE, 0xBB, 0xCF, 0x85, 0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x81,
+    0xCE, 0xBE, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB5,
+    0xCF, 0x81, 0xCE, 0xB9, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xBC, 0xCF, 0x80,
+    0xCE, 0xB1, 0xCE, 0xB2, 0xCE, 0xB1, 0xCE, 0xB8, 0xCF, 0x85, 0xCF, 0x81, 0xCE, 0xB9, 0xCF, 0x80,
+    0xCE, 0xBF, 0xCE, 0xBB, 0xCF, 0x85, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1,
+    0xCF, 0x81, 0xCE, 0xB5, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xB4, 0xCE, 0xB1, 0xCE, 0xBD,
+    0xCE, 0xB5, 0xCE, 0xB2, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xBA, 0xCE, 0xBC, 0xCE, 0xB1, 0xCF, 0x81,
+    0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x81, 0xCE, 0xBD, 0xCE, 0xB9, 0xCE, 0xBC, 0xCF, 0x80, 0xCF, 0x81,
+    0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x81, 0xCE, 0xB3, 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xBB, 0xCE, 0xBF,
+    0xCF, 0x85, 0xCE, 0xB5, 0xCF, 0x80, 0xCE, 0xB1
+};
+
+static const struct among a_2[31] =
+{
+{ 0, 2, -1, 2 },
+{ 168, 6, 0, 2 },
+{ 8, 2, -1, 2 },
+{ 172, 4, 2, 2 },
+{ 170, 6, 3, 2 },
+{ 176, 6, 2, 2 },
+{ 28, 12, 2, 2 },
+{ 110, 10, 2, 2 },
+{ 120, 10, 2, 2 },
+{ 154, 6, 2, 2 },
+{ 182, 6, 2, 2 },
+{ 0, 14, 2, 2 },
+{ 40, 12, 2, 2 },
+{ 52, 12, 2, 2 },
+{ 188, 6, -1, 2 },
+{ 72, 4, -1, 1 },
+{ 64, 12, 15, 1 },
+{ 194, 6, 15, 1 },
+{ 76, 12, 15, 1 },
+{ 86, 12, 15, 1 },
+{ 130, 8, 15, 1 },
+{ 40, 2, -1, 2 },
+{ 138, 8, -1, 1 },
+{ 98, 12, -1, 2 },
+{ 146, 8, -1, 2 },
+{ 154, 8, -1, 2 },
+{ 30, 2, -1, 2 },
+{ 92, 2, -1, 2 },
+{ 160, 8, -1, 2 },
+{ 20, 8, -1, 1 },
+{ 14, 14, 29, 1 }
+};
+
+static const struct among_table a_2_table = {
+    a_2, 31, a_2_pool, 0
+};
+
+
+static const struct among a_3[14] =
+{
+{ 0, 8, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 }
+};
+
+static const unsigned short a_4_displacement[] = {
+    2, 18, 2, 0, 6
+};
+static const short a_4_slot[] = {
+    3, 7, 1, 4, 5, 0, 6, 2
+};
+static const struct among_hash a_4_hash = {
+    20, 5, a_4_displacement, a_4_slot
+};
+
+static const symbol a_4_pool[28] = {
+    0xCF, 0x85, 0xCF, 0x88, 0xCE, 0xB6, 0xCF, 0x89, 0xCE, 0xB2, 0xCE, 0xB9, 0xCE, 0xBB, 0xCE, 0xB9,
+    0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xB5, 0xCE, 0xBD, 0xCF, 0x83, 0xCF, 0x87
+};
+
+static const struct among a_4[8] =
+{
+{ 24, 2, -1, 1 },
+{ 26, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 4, 4, -1, 1 },
+{ 8, 4, -1, 1 },
+{ 12, 4, -1, 1 },
+{ 16, 4, -1, 1 },
+{ 20, 4, -1, 1 }
+};
+
+static const struct among_table a_4_table = {
+    a_4, 8, a_4_pool, 0
+};
+
+
+static const struct among a_5[7] =
+{
+{ 0, 12, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 14, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 14, -1, 1 },
+{ 0, 14, -1, 1 },
+{ 0, 12, -1, 1 }
+};
+
+static const unsigned short a_6_displacement[] = {
+    2, 1, 15, 0, 1, 12, 85, 1,
+    0, 2, 1, 14, 3, 2, 1, 2,
+    2
+};
+static const short a_6_slot[] = {
+    28, 6, 7, 4, 3, 20, 23, 9,
+    30, 24, 22, 2, 16, 25, 11, 18,
+    26, 19, 12, 14, 5, 8, 1, 29,
+    31, 0, 13, 21, 27, 17, 10, 15
+};
+static const struct among_hash a_6_hash = {
+    348500, 17, a_6_displacement, a_6_slot
+};
+
+static const symbol a_6_pool[222] = {
+    0xCE, 0xB3, 0xCE, 0xB9, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xBF, 0xCE, 0xB1,
+    0xCF, 0x86, 0xCE, 0xB4, 0xCE, 0xB7, 0xCE, 0xBC, 0xCE, 0xBF, 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xB1,
+    0xCF, 0x84, 0xCF, 0x87, 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x80, 0xCE, 0xB1,
+    0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xB8, 0xCF, 0x81, 0xCE, 0xBF, 0xCE, 0xBE,
+    0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81,
+    0xCE, 0xB9, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1,
+    0xCE, 0xB5, 0xCE, 0xBE, 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x87, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5,
+    0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x89, 0xCE, 0xBA, 0xCE, 0xBB,
+    0xCE, 0xB5, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB5, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5, 0xCE, 0xB1,
+    0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x85,
+    0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xB4,
+    0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5, 0xCE, 0xBB, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB5, 0xCF, 0x80,
+    0xCE, 0xB1, 0xCE, 0xB5, 0xCF, 0x83, 0xCE, 0xB5, 0xCE, 0xB3, 0xCE, 0xBA, 0xCE, 0xB5, 0xCE, 0xBA,
+    0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xB3, 0xCE, 0xB5
+};
+
+static const struct among a_6[32] =
+{
+{ 44, 2, -1, 2 },
+{ 182, 6, -1, 2 },
+{ 18, 16, -1, 2 },
+{ 14, 4, -1, 2 },
+{ 0, 18, 3, 2 },
+{ 62, 12, -1, 1 },
+{ 188, 6, -1, 1 },
+{ 74, 12, -1, 1 },
+{ 84, 12, -1, 1 },
+{ 166, 8, -1, 1 },
+{ 34, 14, -1, 1 },
+{ 96, 12, -1, 1 },
+{ 74, 4, -1, 1 },
+{ 114, 6, 12, 1 },
+{ 108, 12, 13, 1 },
+{ 194, 6, -1, 1 },
+{ 218, 4, -1, 2 },
+{ 200, 6, -1, 2 },
+{ 124, 6, -1, 1 },
+{ 118, 12, 18, 1 },
+{ 134, 8, 18, 1 },
+{ 130, 12, 20, 1 },
+{ 142, 12, 18, 1 },
+{ 174, 8, -1, 1 },
+{ 200, 4, -1, 2 },
+{ 22, 2, -1, 2 },
+{ 154, 12, 25, 2 },
+{ 206, 6, 25, 2 },
+{ 6, 4, -1, 2 },
+{ 54, 8, -1, 1 },
+{ 48, 14, 29, 1 },
+{ 212, 6, -1, 2 }
+};
+
+static const struct among_table a_6_table = {
+    a_6, 32, a_6_pool, 0
+};
+
+
+static const struct among a_7[7] =
+{
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 }
+};
+
+static const unsigned short a_8_displacement[] = {
+    1, 7, 8, 0, 2, 0, 10, 58,
+    36, 13
+};
+static const short a_8_slot[] = {
+    2, 12, 7, 0, 16, 17, 11, 6,
+    18, 13, 9, 8, 1, 10, 5, 15,
+    14, 4, 3
+};
+static const struct among_hash a_8_hash = {
+    20816, 10, a_8_displacement, a_8_slot
+};
+
+static const symbol a_8_pool[144] = {
+    0xCF, 0x87, 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x83,
+    0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xB8, 0xCF, 0x81, 0xCE, 0xBF, 0xCE, 0xBE, 0xCE, 0xB1,
+    0xCE, 0xBD, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB9,
+    0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xB5,
+    0xCE, 0xBE, 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x87, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5, 0xCF, 0x84,
+    0xCE, 0xB5, 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x89, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5,
+    0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB5, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5, 0xCE, 0xB1, 0xCF, 0x80,
+    0xCE, 0xBF, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xB4,
+    0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xB5, 0xCF, 0x83, 0xCE, 0xB5
+};
+
+static const struct among a_8[19] =
+{
+{ 28, 12, -1, 1 },
+{ 132, 6, -1, 1 },
+{ 40, 12, -1, 1 },
+{ 50, 12, -1, 1 },
+{ 118, 8, -1, 1 },
+{ 0, 14, -1, 1 },
+{ 62, 12, -1, 1 },
+{ 40, 4, -1, 1 },
+{ 80, 6, 7, 1 },
+{ 74, 12, 8, 1 },
+{ 138, 6, -1, 1 },
+{ 90, 6, -1, 1 },
+{ 84, 12, 11, 1 },
+{ 100, 8, 11, 1 },
+{ 96, 12, 13, 1 },
+{ 108, 12, 11, 1 },
+{ 126, 8, -1, 1 },
+{ 20, 8, -1, 1 },
+{ 14, 14, 17, 1 }
+};
+
+static const struct among_table a_8_table = {
+    a_8, 19, a_8_pool, 0
+};
+
+
+static const struct among a_9[7] =
+{
+{ 0, 10, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 10, -1, 1 }
+};
+
+static const unsigned short a_10_displacement[] = {
+    0, 1, 12, 2, 2, 3, 1, 1,
+    9, 2, 2, 1, 40, 2, 3, 8,
+    29, 8, 27, 31, 61
+};
+static const short a_10_slot[] = {
+    8, 9, 22, 37, 2, 29, 27, 28,
+    18, 13, 38, 19, 4, 31, 1, 21,
+    15, 6, 33, 5, 34, 3, 7, 0,
+    36, 24, 39, 10, 30, 35, 25, 14,
+    32, 11, 17, 26, 12, 16, 20, 23
+};
+static const struct among_hash a_10_hash = {
+    20820, 21, a_10_displacement, a_10_slot
+};
+
+static const symbol a_10_pool[190] = {
+    0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xB8, 0xCF, 0x81, 0xCE, 0xBF, 0xCE, 0xB5,
+    0xCF, 0x83, 0xCF, 0x89, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5, 0xCE, 0xB4, 0xCE, 0xB1, 0xCE, 0xBD,
+    0xCE, 0xB5, 0xCF, 0x85, 0xCF, 0x80, 0xCE, 0xB5, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB3, 0xCF, 0x85,
+    0xCF, 0x81, 0xCF, 0x87, 0xCF, 0x89, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBF, 0xCF, 0x81, 0xCE, 0xB1,
+    0xCF, 0x87, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBA, 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x87,
+    0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x87, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xB7, 0xCF, 0x86,
+    0xCE, 0xB1, 0xCE, 0xBB, 0xCF, 0x85, 0xCE, 0xB3, 0xCE, 0xBC, 0xCE, 0xB5, 0xCE, 0xB3, 0xCE, 0xB1,
+    0xCF, 0x83, 0xCE, 0xB5, 0xCF, 0x80, 0xCE, 0xBB, 0xCE, 0xB5, 0xCF, 0x87, 0xCE, 0xB8, 0xCE, 0xBA,
+    0xCE, 0xB1, 0xCE, 0xB8, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xBA,
+    0xCF, 0x85, 0xCE, 0xBB, 0xCF, 0x86, 0xCE, 0xB9, 0xCE, 0xBB, 0xCE, 0xB3, 0xCE, 0xB5, 0xCE, 0xBC,
+    0xCE, 0xB1, 0xCF, 0x87, 0xCE, 0xBD, 0xCE, 0xB1, 0xCF, 0x80, 0xCF, 0x87, 0xCF, 0x81, 0xCE, 0xB1,
+    0xCF, 0x81, 0xCF, 0x85, 0xCF, 0x88, 0xCE, 0xB7, 0xCE, 0xB4, 0xCF, 0x83, 0xCE, 0xBA
+};
+
+static const struct among a_10[40] =
+{
+{ 36, 2, -1, 2 },
+{ 32, 6, 0, 2 },
+{ 166, 4, 0, 2 },
+{ 38, 6, 0, 2 },
+{ 44, 6, -1, 2 },
+{ 170, 4, -1, 2 },
+{ 50, 6, -1, 2 },
+{ 174, 4, -1, 2 },
+{ 56, 6, -1, 2 },
+{ 64, 4, -1, 2 },
+{ 62, 6, 9, 2 },
+{ 70, 4, -1, 2 },
+{ 68, 6, 11, 2 },
+{ 76, 4, -1, 2 },
+{ 74, 6, 13, 2 },
+{ 80, 6, -1, 2 },
+{ 178, 4, -1, 2 },
+{ 86, 6, -1, 2 },
+{ 94, 4, -1, 2 },
+{ 92, 6, 18, 2 },
+{ 98, 6, -1, 2 },
+{ 104, 6, -1, 2 },
+{ 182, 4, -1, 2 },
+{ 112, 4, -1, 1 },
+{ 110, 6, 23, 1 },
+{ 116, 6, -1, 1 },
+{ 20, 6, -1, 1 },
+{ 14, 12, 26, 1 },
+{ 26, 8, -1, 1 },
+{ 120, 6, -1, 2 },
+{ 126, 6, -1, 2 },
+{ 186, 4, -1, 2 },
+{ 132, 6, -1, 2 },
+{ 138, 6, -1, 2 },
+{ 142, 6, -1, 2 },
+{ 148, 6, -1, 2 },
+{ 40, 2, -1, 2 },
+{ 154, 6, 36, 2 },
+{ 160, 6, -1, 2 },
+{ 0, 14, -1, 1 }
+};
+
+static const struct among_table a_10_table = {
+    a_10, 40, a_10_pool, 0
+};
+
+
+static const struct among a_11[11] =
+{
+{ 0, 12, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 }
+};
+
+static const unsigned short a_12_displacement[] = {
+    2, 10, 1, 13
+};
+static const short a_12_slot[] = {
+    2, 6, 3, 4, 1, 5, 0
+};
+static const struct among_hash a_12_hash = {
+    87312, 4, a_12_displacement, a_12_slot
+};
+
+static const symbol a_12_pool[62] = {
+    0xCE, 0xB1, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB9, 0xCE, 0xB4, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5,
+    0xCE, 0xBC, 0xCE, 0xB9, 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xB5, 0xCE, 0xBC,
+    0xCE, 0xB5, 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x83, 0xCE, 0xB5, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBF,
+    0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5, 0xCE, 0xB3, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5
+};
+
+static const struct among a_12[7] =
+{
+{ 26, 4, -1, 1 },
+{ 30, 12, 0, 1 },
+{ 16, 14, 0, 1 },
+{ 52, 10, -1, 1 },
+{ 42, 12, -1, 1 },
+{ 8, 8, -1, 2 },
+{ 0, 16, 5, 2 }
+};
+
+static const struct among_table a_12_table = {
+    a_12, 7, a_12_pool, 0
+};
+
+
+static const struct among a_13[10] =
+{
+{ 0, 10, -1, 7 },
+{ 0, 14, -1, 6 },
+{ 0, 14, -1, 3 },
+{ 0, 16, 2, 1 },
+{ 0, 16, -1, 5 },
+{ 0, 12, -1, 2 },
+{ 0, 10, -1, 4 },
+{ 0, 14, -1, 10 },
+{ 0, 20, -1, 8 },
+{ 0, 16, -1, 9 }
+};
+
+
+static const struct among a_14[6] =
+{
+{ 0, 12, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 }
+};
+
+static const unsigned short a_15_displacement[] = {
+    0, 1
+};
+static const short a_15_slot[] = {
+    1, 0
+};
+static const struct among_hash a_15_hash = {
+    4, 2, a_15_displacement, a_15_slot
+};
+
+static const symbol a_15_pool[4] = {
+    0xCF, 0x83, 0xCF, 0x87
+};
+
+static const struct among a_15[2] =
+{
+{ 0, 2, -1, 1 },
+{ 2, 2, -1, 1 }
+};
+
+static const struct among_table a_15_table = {
+    a_15, 2, a_15_pool, 0
+};
+
+
+static const struct among a_16[4] =
+{
+{ 0, 12, -1, 1 },
+{ 0, 14, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 12, -1, 1 }
+};
+
+static const unsigned short a_17_displacement[] = {
+    0, 6, 1, 1, 1, 21, 6, 18,
+    8, 2, 4, 4, 12, 11, 1, 1,
+    0, 25, 10, 3, 4, 46, 1, 29
+};
+static const short a_17_slot[] = {
+    45, 39, 31, 44, 8, 11, 4, 3,
+    38, 41, 35, 32, 28, 29, 26, 36,
+    30, 9, 6, 37, 14, 34, 2, 27,
+    7, 16, 19, 42, 13, 22, 5, 1,
+    21, 24, 18, 23, 0, 20, 10, 25,
+    17, 12, 43, 40, 33, 15
+};
+static const struct among_hash a_17_hash = {
+    283988, 24, a_17_displacement, a_17_slot
+};
+
+static const symbol a_17_pool[278] = {
+    0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xB5, 0xCF, 0x87, 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xBB, 0xCE, 0xBF,
+    0xCE, 0xB2, 0xCE, 0xB7, 0xCE, 0xB3, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBC, 0xCE, 0xB5, 0xCE, 0xBD,
+    0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x84, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBD, 0xCE, 0xB1,
+    0xCE, 0xB3, 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84, 0xCF, 0x81, 0xCE, 0xB9, 0xCF, 0x80,
+    0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xBA, 0xCF, 0x81, 0xCF, 0x85, 0xCE, 0xBD,
+    0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x85,
+    0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xB9, 0xCF, 0x83, 0xCF, 0x86, 0xCE, 0xBA,
+    0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB1, 0xCE, 0xB2, 0xCF, 0x81,
+    0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB2, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB8, 0xCF, 0x81,
+    0xCE, 0xB2, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB2, 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB4,
+    0xCE, 0xBB, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBB, 0xCF, 0x86, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xBC,
+    0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xB9, 0xCE, 0xBC, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB9, 0xCE, 0xBC,
+    0xCF, 0x83, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB3, 0xCE, 0xB9, 0xCE, 0xB1, 0xCE, 0xBD,
+    0xCE, 0xBC, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x81, 0xCF, 0x84, 0xCE, 0xBF,
+    0xCF, 0x83, 0xCE, 0xBD, 0xCF, 0x85, 0xCF, 0x86, 0xCF, 0x83, 0xCE, 0xBF, 0xCE, 0xBA, 0xCF, 0x86,
+    0xCF, 0x85, 0xCE, 0xBB, 0xCE, 0xB2, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xBB,
+    0xCE, 0xBA, 0xCE, 0xBF, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB6, 0xCF, 0x83, 0xCE, 0xBA, 0xCF, 0x80,
+    0xCE, 0xBB, 0xCE, 0xB3, 0xCE, 0xBB
+};
+
+static const struct among a_17[46] =
+{
+{ 42, 2, -1, 2 },
+{ 32, 12, 0, 1 },
+{ 38, 2, -1, 1 },
+{ 124, 4, 2, 1 },
+{ 120, 8, 3, 1 },
+{ 128, 8, 3, 1 },
+{ 80, 10, 2, 2 },
+{ 208, 6, 2, 1 },
+{ 136, 8, 2, 1 },
+{ 214, 6, 2, 1 },
+{ 2, 2, -1, 1 },
+{ 44, 12, 10, 1 },
+{ 220, 6, 10, 2 },
+{ 90, 10, -1, 1 },
+{ 74, 4, -1, 1 },
+{ 108, 2, -1, 1 },
+{ 106, 4, 15, 1 },
+{ 100, 10, 16, 1 },
+{ 226, 6, 15, 2 },
+{ 6, 2, -1, 1 },
+{ 16, 2, -1, 2 },
+{ 144, 8, 20, 1 },
+{ 10, 8, 20, 1 },
+{ 0, 18, 22, 1 },
+{ 152, 8, -1, 2 },
+{ 264, 2, -1, 2 },
+{ 262, 4, 25, 1 },
+{ 32, 2, -1, 1 },
+{ 266, 4, 27, 1 },
+{ 110, 10, 27, 1 },
+{ 232, 6, 27, 1 },
+{ 270, 4, -1, 1 },
+{ 238, 6, -1, 1 },
+{ 160, 8, -1, 1 },
+{ 244, 6, -1, 2 },
+{ 250, 6, -1, 1 },
+{ 274, 4, -1, 2 },
+{ 56, 12, -1, 2 },
+{ 168, 8, -1, 1 },
+{ 176, 8, -1, 1 },
+{ 184, 8, -1, 1 },
+{ 68, 12, -1, 2 },
+{ 192, 8, -1, 1 },
+{ 200, 8, -1, 2 },
+{ 18, 14, -1, 2 },
+{ 256, 6, -1, 1 }
+};
+
+static const struct among_table a_17_table = {
+    a_17, 46, a_17_pool, 0
+};
+
+
+static const struct among a_18[8] =
+{
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 12, 3, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 10, 5, 1 },
+{ 0, 10, -1, 1 }
+};
+
+static const unsigned short a_19_displacement[] = {
+    2, 1, 1
+};
+static const short a_19_slot[] = {
+    3, 0, 2, 1
+};
+static const struct among_hash a_19_hash = {
+    336, 3, a_19_displacement, a_19_slot
+};
+
+static const symbol a_19_pool[24] = {
+    0xCE, 0xB1, 0xCE, 0xB9, 0xCF, 0x86, 0xCE, 0xBD, 0xCF, 0x88, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xBF,
+    0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xB9, 0xCF, 0x81
+};
+
+static const struct among a_19[4] =
+{
+{ 20, 4, -1, 1 },
+{ 8, 6, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 14, 6, -1, 1 }
+};
+
+static const struct among_table a_19_table = {
+    a_19, 4, a_19_pool, 0
+};
+
+
+static const struct among a_20[2] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 10, -1, 1 }
+};
+
+
+static const struct among a_21[3] =
+{
+{ 0, 8, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 }
+};
+
+static const unsigned short a_22_displacement[] = {
+    1, 3, 4, 9
+};
+static const short a_22_slot[] = {
+    1, 3, 2, 0, 4, 6, 5
+};
+static const struct among_hash a_22_hash = {
+    1364, 4, a_22_displacement, a_22_slot
+};
+
+static const symbol a_22_pool[34] = {
+    0xCF, 0x86, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xBA, 0xCE, 0xBF, 0xCE, 0xB2, 0xCE, 0xB5,
+    0xCE, 0xBB, 0xCF, 0x85, 0xCE, 0xBA, 0xCE, 0xBC, 0xCE, 0xB7, 0xCE, 0xBD, 0xCE, 0xB9, 0xCE, 0xB2,
+    0xCE, 0xB4
+};
+
+static const struct among a_22[7] =
+{
+{ 2, 2, -1, 1 },
+{ 28, 4, -1, 1 },
+{ 32, 2, -1, 1 },
+{ 16, 6, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 10, 8, -1, 1 },
+{ 22, 6, -1, 1 }
+};
+
+static const struct among_table a_22_table = {
+    a_22, 7, a_22_pool, 0
+};
+
+
+static const struct among a_23[4] =
+{
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 }
+};
+
+
+static const struct among a_24[2] =
+{
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 }
+};
+
+
+static const struct among a_25[10] =
+{
+{ 0, 10, -1, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 10, -1, -1 },
+{ 0, 10, -1, -1 },
+{ 0, 10, -1, -1 },
+{ 0, 10, -1, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 6, -1, -1 }
+};
+
+
+static const struct among a_26[2] =
+{
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 }
+};
+
+
+static const struct among a_27[8] =
+{
+{ 0, 10, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 }
+};
+
+
+static const struct among a_28[2] =
+{
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 }
+};
+
+
+static const struct among a_29[15] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, -1, 1 }
+};
+
+
+static const struct among a_30[2] =
+{
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 }
+};
+
+static const unsigned short a_31_displacement[] = {
+    1, 5, 2, 7, 7
+};
+static const short a_31_slot[] = {
+    4, 1, 6, 3, 5, 0, 7, 2
+};
+static const struct among_hash a_31_hash = {
+    84, 5, a_31_displacement, a_31_slot
+};
+
+static const symbol a_31_pool[24] = {
+    0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xB9, 0xCE, 0xB4,
+    0xCE, 0xB5, 0xCE, 0xBB, 0xCE, 0xB8, 0xCE, 0xBD
+};
+
+static const struct among a_31[8] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 14, 2, -1, 1 },
+{ 12, 4, 2, 1 },
+{ 20, 2, -1, 1 },
+{ 6, 6, -1, 1 },
+{ 16, 4, -1, 1 },
+{ 22, 2, -1, 1 }
+};
+
+static const struct among_table a_31_table = {
+    a_31, 8, a_31_pool, 0
+};
+
+
+static const struct among a_32[3] =
+{
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 }
+};
+
+
+static const struct among a_33[4] =
+{
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 }
+};
+
+static const unsigned short a_34_displacement[] = {
+    1, 4, 9, 15, 1, 0, 3, 20,
+    4, 2, 8, 0, 1, 8, 43, 1,
+    6, 21, 4
+};
+static const short a_34_slot[] = {
+    32, 16, 17, 25, 22, 24, 0, 34,
+    14, 1, 15, 21, 5, 3, 26, 11,
+    7, 27, 20, 8, 12, 10, 18, 13,
+    23, 9, 35, 30, 29, 6, 28, 33,
+    19, 2, 31, 4
+};
+static const struct among_hash a_34_hash = {
+    21840, 19, a_34_displacement, a_34_slot
+};
+
+static const symbol a_34_pool[296] = {
+    0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB9, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB1,
+    0xCE, 0xBC, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x87, 0xCE, 0xB1, 0xCE, 0xBB, 0xCF, 0x83, 0xCF, 0x85,
+    0xCE, 0xBD, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xB7, 0xCE, 0xBB, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x83,
+    0xCF, 0x84, 0xCE, 0xB5, 0xCE, 0xBB, 0xCE, 0xBD, 0xCF, 0x80, 0xCE, 0xBB, 0xCE, 0xB9, 0xCE, 0xB1,
+    0xCF, 0x84, 0xCF, 0x83, 0xCF, 0x80, 0xCE, 0xB9, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBD, 0xCF, 0x84,
+    0xCF, 0x80, 0xCF, 0x81, 0xCF, 0x89, 0xCF, 0x84, 0xCE, 0xBF, 0xCE, 0xB4, 0xCE, 0xBA, 0xCE, 0xB1,
+    0xCE, 0xBB, 0xCE, 0xBB, 0xCE, 0xB9, 0xCE, 0xBD, 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB1,
+    0xCE, 0xB4, 0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xB4, 0xCE, 0xB1, 0xCE, 0xBD,
+    0xCF, 0x84, 0xCE, 0xB9, 0xCE, 0xB4, 0xCF, 0x86, 0xCF, 0x85, 0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xB4,
+    0xCF, 0x86, 0xCE, 0xB9, 0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xBD, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBB,
+    0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x84, 0xCF, 0x83, 0xCF, 0x80, 0xCE, 0xB9, 0xCF, 0x84, 0xCF, 0x83,
+    0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xB5, 0xCF, 0x81, 0xCF, 0x84, 0xCE, 0xB5,
+    0xCE, 0xBE, 0xCF, 0x89, 0xCE, 0xB4, 0xCF, 0x85, 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xB4, 0xCE, 0xB1,
+    0xCE, 0xBD, 0xCE, 0xB7, 0xCE, 0xB8, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBB, 0xCE, 0xBC,
+    0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xB2, 0xCF, 0x81, 0xCF, 0x89, 0xCE, 0xBC, 0xCF, 0x84,
+    0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB1, 0xCE, 0xBC,
+    0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB3, 0xCE, 0xB5, 0xCF, 0x81, 0xCF, 0x86, 0xCF, 0x85, 0xCF, 0x83,
+    0xCF, 0x87, 0xCE, 0xB1, 0xCF, 0x83, 0xCE, 0xBD, 0xCE, 0xB9, 0xCF, 0x84, 0xCE, 0xB5, 0xCE, 0xBD,
+    0xCE, 0xB4, 0xCE, 0xBE, 0xCE, 0xB9, 0xCE, 0xBA
+};
+
+static const struct among a_34[36] =
+{
+{ 154, 8, -1, 1 },
+{ 260, 6, -1, 1 },
+{ 56, 12, -1, 1 },
+{ 160, 8, -1, 1 },
+{ 168, 8, -1, 1 },
+{ 266, 6, -1, 1 },
+{ 272, 6, -1, 1 },
+{ 176, 8, -1, 1 },
+{ 182, 8, -1, 1 },
+{ 0, 14, -1, 1 },
+{ 278, 6, -1, 1 },
+{ 68, 12, -1, 1 },
+{ 190, 8, -1, 1 },
+{ 110, 4, -1, 1 },
+{ 104, 10, 13, 1 },
+{ 114, 10, 13, 1 },
+{ 124, 10, -1, 1 },
+{ 284, 6, -1, 1 },
+{ 198, 8, -1, 1 },
+{ 80, 12, -1, 1 },
+{ 134, 10, -1, 1 },
+{ 210, 4, -1, 1 },
+{ 206, 8, 21, 1 },
+{ 290, 6, -1, 1 },
+{ 214, 8, -1, 1 },
+{ 24, 4, -1, 1 },
+{ 14, 14, 25, 1 },
+{ 28, 14, -1, 1 },
+{ 222, 8, -1, 1 },
+{ 230, 8, -1, 1 },
+{ 238, 8, -1, 1 },
+{ 244, 8, -1, 1 },
+{ 252, 8, -1, 1 },
+{ 92, 12, -1, 1 },
+{ 42, 14, -1, 1 },
+{ 144, 10, -1, 1 }
+};
+
+static const struct among_table a_34_table = {
+    a_34, 36, a_34_pool, 0
+};
+
+
+static const struct among a_35[5] =
+{
+{ 0, 12, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 14, 3, 1 }
+};
+
+static const unsigned short a_36_displacement[] = {
+    2, 2, 1, 5, 5, 3, 2
+};
+static const short a_36_slot[] = {
+    11, 6, 0, 5, 9, 3, 10, 2,
+    1, 7, 8, 4
+};
+static const struct among_hash a_36_hash = {
+    1348, 7, a_36_displacement, a_36_slot
+};
+
+static const symbol a_36_pool[78] = {
+    0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB1,
+    0xCF, 0x80, 0xCE, 0xB9, 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xB2, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xB2,
+    0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xB8, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBA,
+    0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xB9, 0xCF, 0x87, 0xCF, 0x80, 0xCE, 0xB5,
+    0xCE, 0xB8, 0xCE, 0xBE, 0xCE, 0xB5, 0xCE, 0xB8, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBB
+};
+
+static const struct among a_36[12] =
+{
+{ 10, 8, -1, 1 },
+{ 16, 8, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 48, 6, -1, 1 },
+{ 58, 2, -1, 1 },
+{ 54, 6, 4, 1 },
+{ 24, 8, -1, 1 },
+{ 60, 6, -1, 1 },
+{ 66, 6, -1, 1 },
+{ 32, 8, -1, 1 },
+{ 40, 8, -1, 1 },
+{ 72, 6, -1, 1 }
+};
+
+static const struct among_table a_36_table = {
+    a_36, 12, a_36_pool, 0
+};
+
+static const unsigned short a_37_displacement[] = {
+    0, 1
+};
+static const short a_37_slot[] = {
+    1, 0
+};
+static const struct among_hash a_37_hash = {
+    16, 2, a_37_displacement, a_37_slot
+};
+
+static const symbol a_37_pool[8] = {
+    0xCF, 0x84, 0xCF, 0x81, 0xCF, 0x84, 0xCF, 0x83
+};
+
+static const struct among a_37[2] =
+{
+{ 0, 4, -1, 1 },
+{ 4, 4, -1, 1 }
+};
+
+static const struct among_table a_37_table = {
+    a_37, 2, a_37_pool, 0
+};
+
+
+static const struct among a_38[11] =
+{
+{ 0, 12, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 14, -1, 1 },
+{ 0, 16, 2, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 14, 4, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 12, 6, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 14, 9, 1 }
+};
+
+static const unsigned short a_39_displacement[] = {
+    2, 2, 10, 2, 9, 1, 0, 3,
+    4, 8, 0, 0, 1, 1, 13, 6,
+    7, 7, 1, 3, 1, 2, 28, 1,
+    4, 1, 2, 40, 74, 11, 2, 14,
+    0, 2, 25, 4, 20, 18, 16, 37,
+    0, 176, 66, 50, 1, 42, 4, 0
+};
+static const short a_39_slot[] = {
+    29, 56, 40, 82, 23, 32, 79, 34,
+    46, 5, 70, 7, 31, 55, 74, 61,
+    67, 51, 36, 4, 11, 9, 19, 58,
+    26, 65, 86, 28, 20, 66, 0, 44,
+    41, 87, 63, 76, 57, 33, 92, 47,
+    45, 37, 48, 54, 17, 25, 90, 16,
+    22, 94, 89, 42, 8, 49, 27, 21,
+    73, 53, 13, 83, 64, 1, 6, 77,
+    72, 18, 35, 12, 81, 68, 78, 80,
+    84, 75, 10, 3, 43, 71, 38, 91,
+    24, 50, 88, 15, 39, 52, 60, 14,
+    2, 30, 69, 93, 62, 85, 59
+};
+static const struct among_hash a_39_hash = {
+    4543828, 48, a_39_displacement, a_39_slot
+};
+
+static const symbol a_39_pool[752] = {
+    0xCE, 0xBC, 0xCE, 0xB9, 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xBF, 0xCE, 0xB2, 0xCE, 0xB9, 0xCE, 0xBF,
+    0xCE, 0xBC, 0xCE, 0xB7, 0xCF, 0x87, 0xCE, 0xBC, 0xCE, 0xB5, 0xCE, 0xB3, 0xCE, 0xBB, 0xCE, 0xBF,
+    0xCE, 0xB2, 0xCE, 0xB9, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xB7, 0xCF, 0x87, 0xCE, 0xBA, 0xCE, 0xB1,
+    0xCF, 0x80, 0xCE, 0xBD, 0xCE, 0xBF, 0xCE, 0xB2, 0xCE, 0xB9, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xB7,
+    0xCF, 0x87, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB7, 0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xB4, 0xCE, 0xB1,
+    0xCF, 0x80, 0xCF, 0x83, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x84,
+    0xCF, 0x83, 0xCF, 0x86, 0xCF, 0x89, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5,
+    0xCF, 0x86, 0xCE, 0xBE, 0xCE, 0xB7, 0xCF, 0x81, 0xCE, 0xBF, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB9,
+    0xCE, 0xB2, 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xB9, 0xCE, 0xB3, 0xCE, 0xBF, 0xCE, 0xB4, 0xCE, 0xB1,
+    0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBB, 0xCE, 0xBC,
+    0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB9, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBD,
+    0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBB, 0xCF, 0x85, 0xCE, 0xB4, 0xCE, 0xB1, 0xCF, 0x80, 0xCF, 0x84,
+    0xCF, 0x83, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xBB, 0xCE, 0xB1, 0xCF, 0x84, 0xCF, 0x80, 0xCE, 0xB5,
+    0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x86, 0xCE, 0xBA, 0xCE, 0xBF, 0xCE, 0xB9,
+    0xCE, 0xBB, 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x86, 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBB, 0xCF, 0x85,
+    0xCE, 0xBC, 0xCE, 0xB7, 0xCF, 0x87, 0xCF, 0x88, 0xCE, 0xB7, 0xCE, 0xBB, 0xCE, 0xBF, 0xCF, 0x84,
+    0xCE, 0xB1, 0xCE, 0xB2, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBB, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x85,
+    0xCE, 0xB6, 0xCE, 0xB2, 0xCE, 0xB1, 0xCE, 0xB8, 0xCF, 0x85, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBB,
+    0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xB4,
+    0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xB4, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBC, 0xCF, 0x85, 0xCF, 0x80,
+    0xCE, 0xBF, 0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB9, 0xCF, 0x84,
+    0xCF, 0x81, 0xCE, 0xBB, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xB8, 0xCE, 0xB7, 0xCF, 0x81, 0xCE, 0xBA,
+    0xCE, 0xBF, 0xCF, 0x81, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x81, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x85,
+    0xCF, 0x81, 0xCE, 0xB9, 0xCF, 0x84, 0xCF, 0x85, 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB7,
+    0xCF, 0x86, 0xCE, 0xB1, 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xB9, 0xCE, 0xB3, 0xCE, 0xB3, 0xCE, 0xBC,
+    0xCF, 0x89, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5, 0xCE, 0xB8, 0xCE, 0xB2, 0xCF, 0x81, 0xCE, 0xB1,
+    0xCF, 0x87, 0xCF, 0x85, 0xCE, 0xBA, 0xCF, 0x88, 0xCF, 0x85, 0xCF, 0x87, 0xCE, 0xBF, 0xCF, 0x80,
+    0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xBA,
+    0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5, 0xCE, 0xBB, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x81,
+    0xCF, 0x84, 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xB2, 0xCE, 0xB5, 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x81,
+    0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBB,
+    0xCF, 0x84, 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xB9, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD,
+    0xCE, 0xBF, 0xCF, 0x81, 0xCE, 0xB3, 0xCE, 0xB5, 0xCE, 0xBD, 0xCE, 0xBF, 0xCF, 0x81, 0xCE, 0xB3,
+    0xCE, 0xB1, 0xCE, 0xB8, 0xCE, 0xB9, 0xCE, 0xB3, 0xCE, 0xB3, 0xCF, 0x80, 0xCE, 0xB5, 0xCE, 0xBB,
+    0xCE, 0xB5, 0xCE, 0xBA, 0xCE, 0xB2, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBB, 0xCE, 0xBA, 0xCE, 0xBB,
+    0xCE, 0xB1, 0xCE, 0xBF, 0xCF, 0x80, 0xCE, 0xBB, 0xCE, 0xB2, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x87,
+    0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xB4, 0xCE, 0xB1, 0xCF, 0x80, 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xBF,
+    0xCF, 0x80, 0xCE, 0xB4, 0xCE, 0xB9, 0xCE, 0xB1, 0xCF, 0x84, 0xCF, 0x80, 0xCE, 0xBB, 0xCE, 0xB1,
+    0xCF, 0x84, 0xCE, 0xB6, 0xCF, 0x89, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB4, 0xCE, 0xB9, 0xCE, 0xB1,
+    0xCF, 0x86, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB7, 0xCF, 0x87, 0xCE, 0xBD, 0xCF, 0x84, 0xCE, 0xB1,
+    0xCE, 0xB2, 0xCF, 0x84, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xB3, 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xB1,
+    0xCE, 0xB3, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5, 0xCE, 0xB3, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB7,
+    0xCE, 0xB3, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB9, 0xCE, 0xB8, 0xCE, 0xB2, 0xCE, 0xB1, 0xCF, 0x83,
+    0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB9, 0xCE, 0xBA, 0xCE, 0xB4, 0xCE, 0xB9, 0xCF, 0x80,
+    0xCE, 0xBB, 0xCE, 0xB3, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB8, 0xCF, 0x85, 0xCF, 0x83, 0xCF, 0x84,
+    0xCE, 0xB5, 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x81, 0xCF, 0x86, 0xCE, 0xBB, 0xCE, 0xB9, 0xCF, 0x87,
+    0xCE, 0xB4, 0xCE, 0xB5, 0xCE, 0xBA, 0xCE, 0xBC, 0xCE, 0xB5, 0xCE, 0xBB, 0xCF, 0x83, 0xCF, 0x80
+};
+
+static const struct among a_39[95] =
+{
+{ 48, 2, -1, 1 },
+{ 748, 4, 0, 1 },
+{ 176, 14, 0, 1 },
+{ 578, 8, 0, 1 },
+{ 64, 18, 0, 1 },
+{ 586, 8, 0, 1 },
+{ 322, 6, 0, 1 },
+{ 316, 12, 6, 1 },
+{ 326, 12, -1, 1 },
+{ 364, 6, -1, 1 },
+{ 164, 4, -1, 1 },
+{ 470, 10, 10, 1 },
+{ 706, 6, 10, 1 },
+{ 338, 12, -1, 1 },
+{ 350, 12, -1, 1 },
+{ 82, 2, -1, 1 },
+{ 82, 16, 15, 1 },
+{ 712, 6, 15, 1 },
+{ 682, 6, 15, 1 },
+{ 480, 10, 15, 1 },
+{ 446, 8, -1, 1 },
+{ 594, 8, -1, 1 },
+{ 602, 8, -1, 1 },
+{ 190, 14, -1, 1 },
+{ 718, 6, -1, 1 },
+{ 362, 12, -1, 1 },
+{ 488, 10, -1, 1 },
+{ 610, 8, -1, 1 },
+{ 498, 10, -1, 1 },
+{ 98, 2, -1, 1 },
+{ 204, 14, 29, 1 },
+{ 218, 14, 29, 1 },
+{ 724, 6, 29, 1 },
+{ 618, 8, 29, 1 },
+{ 106, 8, 29, 1 },
+{ 98, 16, 34, 1 },
+{ 376, 10, 29, 1 },
+{ 374, 12, 36, 1 },
+{ 20, 2, -1, 1 },
+{ 232, 14, 38, 1 },
+{ 626, 8, 38, 1 },
+{ 10, 12, 38, 1 },
+{ 0, 22, 41, 1 },
+{ 22, 22, 41, 1 },
+{ 44, 22, 41, 1 },
+{ 730, 6, 38, 1 },
+{ 254, 6, -1, 1 },
+{ 634, 8, 46, 1 },
+{ 246, 14, 46, 1 },
+{ 124, 6, -1, 1 },
+{ 122, 8, 49, 1 },
+{ 114, 16, 50, 1 },
+{ 26, 2, -1, 1 },
+{ 508, 10, 52, 1 },
+{ 518, 10, 52, 1 },
+{ 294, 4, 52, 1 },
+{ 642, 8, 55, 1 },
+{ 650, 8, 55, 1 },
+{ 388, 10, 52, 1 },
+{ 386, 12, 58, 1 },
+{ 528, 10, 52, 1 },
+{ 658, 8, 52, 1 },
+{ 666, 8, 52, 1 },
+{ 390, 6, 52, 1 },
+{ 260, 14, -1, 1 },
+{ 278, 2, -1, 1 },
+{ 398, 12, 65, 1 },
+{ 676, 6, 65, 1 },
+{ 674, 8, 67, 1 },
+{ 682, 8, -1, 1 },
+{ 410, 12, -1, 1 },
+{ 736, 6, -1, 1 },
+{ 538, 10, -1, 1 },
+{ 2, 4, -1, 1 },
+{ 690, 8, 73, 1 },
+{ 548, 10, -1, 1 },
+{ 430, 4, -1, 1 },
+{ 698, 8, 76, 1 },
+{ 422, 12, 76, 1 },
+{ 558, 10, 76, 1 },
+{ 152, 6, -1, 1 },
+{ 282, 6, -1, 1 },
+{ 274, 14, 81, 1 },
+{ 288, 14, 81, 1 },
+{ 434, 12, 81, 1 },
+{ 446, 12, -1, 1 },
+{ 742, 6, -1, 1 },
+{ 458, 12, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 302, 14, 88, 1 },
+{ 568, 10, 88, 1 },
+{ 130, 16, 88, 1 },
+{ 144, 16, 88, 1 },
+{ 50, 2, -1, 1 },
+{ 160, 16, 93, 1 }
+};
+
+static const struct among_table a_39_table = {
+    a_39, 95, a_39_pool, 0
+};
+
+
+static const struct among a_40[1] =
+{
+{ 0, 10, -1, 1 }
+};
+
+
+static const struct among a_41[31] =
+{
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 }
+};
+
+static const unsigned short a_42_displacement[] = {
+    6, 0, 16, 8, 1, 6, 3, 10,
+    0, 3, 1, 22, 13
+};
+static const short a_42_slot[] = {
+    2, 15, 10, 5, 11, 9, 14, 13,
+    20, 21, 24, 4, 8, 22, 1, 6,
+    12, 18, 3, 7, 23, 0, 17, 16,
+    19
+};
+static const struct among_hash a_42_hash = {
+    17748, 13, a_42_displacement, a_42_slot
+};
+
+static const symbol a_42_pool[144] = {
+    0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xB2,
+    0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xBF, 0xCE, 0xBD, 0xCF, 0x83, 0xCE, 0xB5, 0xCF, 0x81, 0xCF, 0x80,
+    0xCE, 0xB8, 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xB2, 0xCE, 0xB1, 0xCF, 0x81,
+    0xCE, 0xB5, 0xCE, 0xBD, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x81,
+    0xCF, 0x83, 0xCF, 0x85, 0xCF, 0x81, 0xCF, 0x86, 0xCF, 0x83, 0xCE, 0xBA, 0xCE, 0xB5, 0xCE, 0xBB,
+    0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x80, 0xCE, 0xBD, 0xCF, 0x84, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xB2,
+    0xCF, 0x81, 0xCE, 0xBD, 0xCE, 0xB9, 0xCF, 0x86, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xB3, 0xCF, 0x84,
+    0xCE, 0xBF, 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBB, 0xCE, 0xB2, 0xCE, 0xB5, 0xCE, 0xBD,
+    0xCE, 0xB1, 0xCE, 0xB4, 0xCE, 0xB1, 0xCE, 0xB8, 0xCE, 0xB5, 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xBD
+};
+
+static const struct among a_42[25] =
+{
+{ 24, 8, -1, 1 },
+{ 80, 6, -1, 1 },
+{ 32, 8, -1, 1 },
+{ 86, 6, -1, 1 },
+{ 40, 8, -1, 1 },
+{ 48, 8, -1, 1 },
+{ 92, 6, -1, 1 },
+{ 56, 8, -1, 1 },
+{ 66, 2, -1, 1 },
+{ 64, 8, -1, 1 },
+{ 98, 6, -1, 1 },
+{ 104, 6, -1, 1 },
+{ 130, 2, -1, 1 },
+{ 128, 4, 12, 1 },
+{ 32, 2, -1, 1 },
+{ 132, 4, 14, 1 },
+{ 72, 4, -1, 1 },
+{ 110, 6, -1, 1 },
+{ 116, 6, -1, 1 },
+{ 0, 14, -1, 1 },
+{ 72, 8, -1, 1 },
+{ 136, 4, -1, 1 },
+{ 140, 4, -1, 1 },
+{ 122, 6, -1, 1 },
+{ 14, 10, -1, 1 }
+};
+
+static const struct among_table a_42_table = {
+    a_42, 25, a_42_pool, 0
+};
+
+
+static const struct among a_43[2] =
+{
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 }
+};
+
+
+static const struct among a_44[2] =
+{
+{ 0, 12, -1, 1 },
+{ 0, 14, 0, 1 }
+};
+
+static const unsigned short a_45_displacement[] = {
+    1, 1, 2, 0
+};
+static const short a_45_slot[] = {
+    0, 4, 2, 1, 3, 5
+};
+static const struct among_hash a_45_hash = {
+    21780, 4, a_45_displacement, a_45_slot
+};
+
+static const symbol a_45_pool[36] = {
+    0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBC, 0xCF, 0x86, 0xCE, 0xB1,
+    0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x85,
+    0xCE, 0xBC, 0xCF, 0x80
+};
+
+static const struct among a_45[6] =
+{
+{ 24, 2, -1, 1 },
+{ 22, 4, 0, 1 },
+{ 14, 12, 1, 1 },
+{ 28, 8, 0, 1 },
+{ 26, 10, 3, 1 },
+{ 0, 14, -1, 1 }
+};
+
+static const struct among_table a_45_table = {
+    a_45, 6, a_45_pool, 0
+};
+
+static const unsigned short a_46_displacement[] = {
+    3, 3, 1, 19, 4
+};
+static const short a_46_slot[] = {
+    4, 2, 1, 7, 8, 0, 6, 5,
+    3
+};
+static const struct among_hash a_46_hash = {
+    17492, 5, a_46_displacement, a_46_slot
+};
+
+static const symbol a_46_pool[42] = {
+    0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xB5,
+    0xCE, 0xBA, 0xCF, 0x84, 0xCE, 0xB5, 0xCE, 0xBB, 0xCE, 0xBD, 0xCE, 0xB9, 0xCF, 0x83, 0xCF, 0x80,
+    0xCF, 0x81, 0xCE, 0xBF, 0xCE, 0xB6, 0xCE, 0xBC, 0xCE, 0xBE
+};
+
+static const struct among a_46[9] =
+{
+{ 2, 4, -1, 1 },
+{ 24, 6, -1, 1 },
+{ 36, 2, -1, 1 },
+{ 10, 4, -1, 1 },
+{ 0, 14, 3, 1 },
+{ 14, 10, -1, 1 },
+{ 38, 2, -1, 1 },
+{ 40, 2, -1, 1 },
+{ 30, 6, -1, 1 }
+};
+
+static const struct among_table a_46_table = {
+    a_46, 9, a_46_pool, 0
+};
+
+
+static const struct among a_47[3] =
+{
+{ 0, 12, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 10, -1, 1 }
+};
+
+
+static const struct among a_48[6] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 }
+};
+
+static const unsigned short a_49_displacement[] = {
+    0, 2, 2
+};
+static const short a_49_slot[] = {
+    2, 3, 4, 1, 0
+};
+static const struct among_hash a_49_hash = {
+    263428, 3, a_49_displacement, a_49_slot
+};
+
+static const symbol a_49_pool[44] = {
+    0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB1,
+    0xCE, 0xB8, 0xCF, 0x80, 0xCF, 0x81, 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xB8, 0xCE, 0xB4, 0xCE, 0xB9,
+    0xCE, 0xB1, 0xCE, 0xB8, 0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBD, 0xCE, 0xB8
+};
+
+static const struct among a_49[5] =
+{
+{ 16, 2, -1, 1 },
+{ 18, 10, 0, 1 },
+{ 0, 18, 0, 1 },
+{ 28, 8, 0, 1 },
+{ 36, 8, 0, 1 }
+};
+
+static const struct among_table a_49_table = {
+    a_49, 5, a_49_pool, 0
+};
+
+
+static const struct among a_50[3] =
+{
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 }
+};
+
+
+static const struct among a_51[12] =
+{
+{ 0, 8, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+static const unsigned short a_52_displacement[] = {
+    5, 2, 1, 7, 1, 18, 1, 0,
+    0, 3, 21, 6, 4
+};
+static const short a_52_slot[] = {
+    9, 19, 2, 0, 12, 8, 4, 7,
+    5, 15, 13, 10, 1, 21, 16, 3,
+    18, 23, 20, 14, 24, 22, 17, 11,
+    6
+};
+static const struct among_hash a_52_hash = {
+    87380, 13, a_52_displacement, a_52_slot
+};
+
+static const symbol a_52_pool[186] = {
+    0xCE, 0xB5, 0xCE, 0xBD, 0xCE, 0xB4, 0xCE, 0xB9, 0xCE, 0xB1, 0xCF, 0x86, 0xCE, 0xB5, 0xCF, 0x81,
+    0xCE, 0xB4, 0xCE, 0xB5, 0xCF, 0x85, 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB5, 0xCF, 0x85,
+    0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xB8, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB5, 0xCF, 0x85, 0xCF, 0x80,
+    0xCE, 0xBF, 0xCF, 0x84, 0xCE, 0xB5, 0xCE, 0xB9, 0xCE, 0xBD, 0xCE, 0xBB, 0xCE, 0xB1, 0xCE, 0xBC,
+    0xCF, 0x80, 0xCE, 0xB9, 0xCE, 0xB4, 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xB6,
+    0xCF, 0x86, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xB5, 0xCE, 0xBA,
+    0xCE, 0xBB, 0xCE, 0xB9, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x81,
+    0xCE, 0xBC, 0xCE, 0xB5, 0xCF, 0x83, 0xCE, 0xB1, 0xCE, 0xB6, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB7,
+    0xCE, 0xBA, 0xCE, 0xB2, 0xCF, 0x81, 0xCE, 0xBF, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x84,
+    0xCE, 0xBB, 0xCE, 0xB5, 0xCF, 0x87, 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xB1, 0xCF, 0x87, 0xCE, 0xB1,
+    0xCE, 0xB4, 0xCE, 0xBC, 0xCE, 0xB5, 0xCE, 0xB4, 0xCF, 0x80, 0xCE, 0xBB, 0xCE, 0xB5, 0xCE, 0xB1,
+    0xCE, 0xB9, 0xCE, 0xB8, 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xBA
+};
+
+static const struct among a_52[25] =
+{
+{ 92, 10, -1, 1 },
+{ 14, 2, -1, 1 },
+{ 102, 10, 1, 1 },
+{ 0, 16, 1, 1 },
+{ 138, 6, -1, 1 },
+{ 32, 14, -1, 1 },
+{ 16, 16, -1, 1 },
+{ 144, 6, -1, 1 },
+{ 150, 6, -1, 1 },
+{ 156, 6, -1, 1 },
+{ 162, 6, -1, 1 },
+{ 58, 12, -1, 1 },
+{ 16, 4, -1, 1 },
+{ 168, 6, -1, 1 },
+{ 112, 10, -1, 1 },
+{ 68, 12, -1, 1 },
+{ 174, 6, -1, 1 },
+{ 80, 12, -1, 1 },
+{ 180, 6, -1, 1 },
+{ 122, 8, -1, 1 },
+{ 58, 2, -1, 1 },
+{ 62, 2, -1, 1 },
+{ 60, 4, 21, 1 },
+{ 130, 8, 21, 1 },
+{ 44, 14, -1, 1 }
+};
+
+static const struct among_table a_52_table = {
+    a_52, 25, a_52_pool, 0
+};
+
+
+static const struct among a_53[3] =
+{
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 }
+};
+
+
+static const struct among a_54[12] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 5, -1 },
+{ 0, 6, -1, 1 },
+{ 0, 12, 7, -1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, -1, 1 }
+};
+
+static const unsigned short a_55_displacement[] = {
+    1, 1, 0, 3, 1, 7, 0, 1,
+    0, 0, 6, 0, 17, 17, 14, 6,
+    20, 10, 89, 3, 5, 6, 16
+};
+static const short a_55_slot[] = {
+    20, 0, 40, 2, 22, 39, 9, 15,
+    7, 28, 10, 19, 35, 5, 12, 36,
+    16, 3, 4, 8, 31, 21, 29, 38,
+    6, 23, 30, 27, 14, 33, 17, 43,
+    41, 1, 24, 32, 25, 42, 13, 11,
+    37, 26, 18, 34
+};
+static const struct among_hash a_55_hash = {
+    87380, 23, a_55_displacement, a_55_slot
+};
+
+static const symbol a_55_pool[312] = {
+    0xCF, 0x80, 0xCF, 0x81, 0xCE, 0xBF, 0xCF, 0x83, 0xCF, 0x89, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x80,
+    0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xBF, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xBF, 0xCF, 0x80,
+    0xCF, 0x83, 0xCE, 0xB9, 0xCE, 0xB4, 0xCE, 0xB7, 0xCF, 0x81, 0xCE, 0xBF, 0xCF, 0x80, 0xCE, 0xB4,
+    0xCF, 0x81, 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xB9, 0xCE, 0xBC,
+    0xCE, 0xBF, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xBB,
+    0xCE, 0xB9, 0xCE, 0xB4, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB2, 0xCE, 0xB5, 0xCE, 0xBD, 0xCE, 0xB1,
+    0xCF, 0x81, 0xCF, 0x84, 0xCE, 0xB9, 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x80, 0xCE, 0xB1,
+    0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBD, 0xCF, 0x85, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xB2,
+    0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84, 0xCF, 0x80, 0xCF, 0x81, 0xCE, 0xBF, 0xCF, 0x83, 0xCF, 0x84,
+    0xCE, 0xBD, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xBF, 0xCF, 0x84, 0xCF, 0x80, 0xCE, 0xBF, 0xCE, 0xBB,
+    0xCF, 0x85, 0xCF, 0x86, 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBB, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB1,
+    0xCE, 0xBD, 0xCF, 0x85, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xB5, 0xCE, 0xB9, 0xCF, 0x80, 0xCF, 0x83,
+    0xCF, 0x85, 0xCE, 0xBC, 0xCF, 0x80, 0xCE, 0xBD, 0xCE, 0xB5, 0xCE, 0xBF, 0xCF, 0x80, 0xCE, 0xBF,
+    0xCE, 0xBB, 0xCE, 0xBF, 0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x87, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB1,
+    0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB4, 0xCE, 0xB9, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xB5,
+    0xCF, 0x80, 0xCE, 0xB9, 0xCF, 0x84, 0xCF, 0x83, 0xCF, 0x85, 0xCE, 0xBD, 0xCF, 0x84, 0xCF, 0x85,
+    0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBF, 0xCF, 0x84, 0xCE, 0xB1,
+    0xCE, 0xB4, 0xCE, 0xB7, 0xCF, 0x86, 0xCF, 0x80, 0xCE, 0xB1, 0xCE, 0xBC, 0xCF, 0x86, 0xCE, 0xBF,
+    0xCF, 0x85, 0xCF, 0x81, 0xCE, 0xBD, 0xCE, 0xB1, 0xCF, 0x85, 0xCE, 0xBE, 0xCE, 0xB5, 0xCF, 0x86,
+    0xCF, 0x84, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x86
+};
+
+static const struct among a_55[44] =
+{
+{ 0, 2, -1, 1 },
+{ 104, 6, 0, 1 },
+{ 174, 8, 0, 1 },
+{ 94, 10, 0, 1 },
+{ 182, 8, 0, 1 },
+{ 190, 8, 0, 1 },
+{ 0, 16, 0, 1 },
+{ 32, 14, 0, 1 },
+{ 46, 12, 0, 1 },
+{ 198, 8, 0, 1 },
+{ 16, 16, 0, 1 },
+{ 206, 8, 0, 1 },
+{ 2, 2, -1, 1 },
+{ 304, 4, 12, 1 },
+{ 286, 6, 12, 1 },
+{ 104, 10, 12, 1 },
+{ 216, 6, 12, 1 },
+{ 214, 8, 16, 1 },
+{ 222, 8, 12, 1 },
+{ 68, 2, -1, 1 },
+{ 114, 10, 19, 1 },
+{ 124, 10, 19, 1 },
+{ 134, 10, 19, 1 },
+{ 58, 12, 19, 1 },
+{ 230, 8, 19, 1 },
+{ 238, 8, 19, 1 },
+{ 246, 8, 19, 1 },
+{ 254, 8, 19, 1 },
+{ 262, 8, 19, 1 },
+{ 146, 8, 19, 1 },
+{ 144, 10, 29, 1 },
+{ 292, 6, -1, 1 },
+{ 154, 10, -1, 1 },
+{ 308, 4, -1, 1 },
+{ 298, 6, -1, 1 },
+{ 270, 8, -1, 1 },
+{ 278, 8, -1, 1 },
+{ 70, 12, -1, 1 },
+{ 26, 2, -1, 1 },
+{ 70, 8, 38, 1 },
+{ 62, 2, -1, 1 },
+{ 164, 10, 40, 1 },
+{ 90, 4, -1, 1 },
+{ 82, 12, 42, 1 }
+};
+
+static const struct among_table a_55_table = {
+    a_55, 44, a_55_pool, 0
+};
+
+
+static const struct among a_56[3] =
+{
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 }
+};
+
+
+static const struct among a_57[3] =
+{
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 }
+};
+
+static const unsigned short a_58_displacement[] = {
+    2, 0, 3, 2
+};
+static const short a_58_slot[] = {
+    1, 4, 0, 5, 3, 2
+};
+static const struct among_hash a_58_hash = {
+    21508, 4, a_58_displacement, a_58_slot
+};
+
+static const symbol a_58_pool[62] = {
+    0xCE, 0xB4, 0xCF, 0x89, 0xCE, 0xB4, 0xCE, 0xB5, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xBC,
+    0xCE, 0xB5, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xBF, 0xCE, 0xBD, 0xCF, 0x87, 0xCE, 0xB5,
+    0xCF, 0x81, 0xCF, 0x83, 0xCE, 0xBF, 0xCE, 0xBD, 0xCE, 0xB5, 0xCF, 0x81, 0xCE, 0xB7, 0xCE, 0xBC,
+    0xCE, 0xBF, 0xCE, 0xBD, 0xCE, 0xB5, 0xCF, 0x80, 0xCF, 0x84, 0xCE, 0xB1, 0xCE, 0xBD
+};
+
+static const struct among a_58[6] =
+{
+{ 12, 2, -1, 1 },
+{ 52, 10, 0, 1 },
+{ 0, 14, 0, 1 },
+{ 28, 12, 0, 1 },
+{ 14, 14, 0, 1 },
+{ 40, 12, 0, 1 }
+};
+
+static const struct among_table a_58_table = {
+    a_58, 6, a_58_pool, 0
+};
+
+
+static const struct among a_59[1] =
+{
+{ 0, 8, -1, 1 }
+};
+
+static const unsigned short a_60_displacement[] = {
+    1, 2, 0, 0, 14, 39
+};
+static const short a_60_slot[] = {
+    3, 4, 2, 7, 1, 8, 5, 6,
+    9, 0
+};
+static const struct among_hash a_60_hash = {
+    21840, 6, a_60_displacement, a_60_slot
+};
+
+static const symbol a_60_pool[72] = {
+    0xCE, 0xBA, 0xCE, 0xBF, 0xCE, 0xB9, 0xCE, 0xBD, 0xCE, 0xBF, 0xCF, 0x87, 0xCF, 0x81, 0xCF, 0x80,
+    0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xB9, 0xCE, 0xBC, 0xCF, 0x88, 0xCE, 0xB4, 0xCF, 0x85, 0xCF, 0x83,
+    0xCF, 0x87, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xB5, 0xCE, 0xB9, 0xCE, 0xBC, 0xCE, 0xBD, 0xCE, 0xB5,
+    0xCF, 0x85, 0xCF, 0x87, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x87, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x83,
+    0xCE, 0xB2, 0xCE, 0xB1, 0xCF, 0x80, 0xCE, 0xBB
+};
+
+static const struct among a_60[10] =
+{
+{ 10, 4, -1, 1 },
+{ 26, 10, 0, 1 },
+{ 46, 8, 0, 1 },
+{ 54, 6, 0, 1 },
+{ 0, 14, 0, 1 },
+{ 14, 12, -1, 1 },
+{ 62, 4, -1, 1 },
+{ 60, 6, 6, 1 },
+{ 66, 6, -1, 1 },
+{ 36, 10, -1, 1 }
+};
+
+static const struct among_table a_60_table = {
+    a_60, 10, a_60_pool, 0
+};
+
+
+static const struct among a_61[3] =
+{
+{ 0, 8, -1, 1 },
+{ 0, 12, 0, 1 },
+{ 0, 12, 0, 1 }
+};
+
+static const unsigned short a_62_displacement[] = {
+    1, 6, 3, 1
+};
+static const short a_62_slot[] = {
+    4, 5, 1, 3, 0, 2
+};
+static const struct among_hash a_62_hash = {
+    4456772, 4, a_62_displacement, a_62_slot
+};
+
+static const symbol a_62_pool[54] = {
+    0xCF, 0x83, 0xCF, 0x84, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xB2, 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xBF,
+    0xCF, 0x85, 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xBA, 0xCE, 0xBF, 0xCE, 0xBC,
+    0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x84, 0xCF, 0x83, 0xCE, 0xB5, 0xCE, 0xBE, 0xCF, 0x89, 0xCE, 0xBD,
+    0xCF, 0x83, 0xCF, 0x80, 0xCE, 0xB9
+};
+
+static const struct among a_62[6] =
+{
+{ 4, 2, -1, 1 },
+{ 0, 22, -1, 1 },
+{ 22, 18, -1, 1 },
+{ 48, 6, -1, 1 },
+{ 46, 2, -1, 1 },
+{ 40, 8, 4, 1 }
+};
+
+static const struct among_table a_62_table = {
+    a_62, 6, a_62_pool, 0
+};
+
+
+static const struct among a_63[3] =
+{
+{ 0, 8, -1, 1 },
+{ 0, 12, 0, 1 },
+{ 0, 12, 0, 1 }
+};
+
+static const unsigned short a_64_displacement[] = {
+    13, 6, 2, 0
+};
+static const short a_64_slot[] = {
+    5, 4, 0, 6, 2, 3, 1
+};
+static const struct among_hash a_64_hash = {
+    70676, 4, a_64_displacement, a_64_slot
+};
+
+static const symbol a_64_pool[52] = {
+    0xCF, 0x80, 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB1, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83,
+    0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xBB, 0xCE, 0xBF, 0xCF, 0x83, 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83,
+    0xCF, 0x89, 0xCF, 0x81, 0xCE, 0xB9, 0xCE, 0xBF, 0xCF, 0x80, 0xCE, 0xBB, 0xCE, 0xB1, 0xCE, 0xB6,
+    0xCF, 0x86, 0xCF, 0x87
+};
+
+static const struct among a_64[7] =
+{
+{ 6, 10, -1, 1 },
+{ 0, 16, 0, 1 },
+{ 16, 16, -1, 1 },
+{ 48, 2, -1, 1 },
+{ 50, 2, -1, 1 },
+{ 44, 4, -1, 1 },
+{ 32, 12, -1, 1 }
+};
+
+static const struct among_table a_64_table = {
+    a_64, 7, a_64_pool, 0
+};
+
+
+static const struct among a_65[3] =
+{
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 10, -1, 1 }
+};
+
+
+static const struct among a_66[84] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 6, 0, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, 3, 1 },
+{ 0, 8, 3, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 10, 7, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 10, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 6, 12, 1 },
+{ 0, 4, 12, 1 },
+{ 0, 6, 12, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 10, 16, 1 },
+{ 0, 12, 16, 1 },
+{ 0, 14, 18, 1 },
+{ 0, 12, 16, 1 },
+{ 0, 14, 20, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 14, 22, 1 },
+{ 0, 12, 22, 1 },
+{ 0, 14, 24, 1 },
+{ 0, 14, 22, 1 },
+{ 0, 16, 26, 1 },
+{ 0, 14, 22, 1 },
+{ 0, 12, 22, 1 },
+{ 0, 10, 22, 1 },
+{ 0, 10, 22, 1 },
+{ 0, 10, 22, 1 },
+{ 0, 14, 32, 1 },
+{ 0, 8, 22, 1 },
+{ 0, 12, 34, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 8, 37, 1 },
+{ 0, 8, 37, 1 },
+{ 0, 10, 39, 1 },
+{ 0, 8, 37, 1 },
+{ 0, 8, 37, 1 },
+{ 0, 10, 42, 1 },
+{ 0, 12, 37, 1 },
+{ 0, 14, 44, 1 },
+{ 0, 10, 37, 1 },
+{ 0, 10, 37, 1 },
+{ 0, 8, 37, 1 },
+{ 0, 10, 37, 1 },
+{ 0, 8, 37, 1 },
+{ 0, 4, 37, 1 },
+{ 0, 8, 51, 1 },
+{ 0, 6, 51, 1 },
+{ 0, 8, 51, 1 },
+{ 0, 4, 37, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 10, 56, 1 },
+{ 0, 10, 56, 1 },
+{ 0, 12, 58, 1 },
+{ 0, 10, 56, 1 },
+{ 0, 10, 56, 1 },
+{ 0, 12, 61, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, 63, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 10, 65, 1 },
+{ 0, 16, 66, 1 },
+{ 0, 18, 67, 1 },
+{ 0, 8, 65, 1 },
+{ 0, 14, 65, 1 },
+{ 0, 16, 70, 1 },
+{ 0, 14, 65, 1 },
+{ 0, 16, 72, 1 },
+{ 0, 12, 65, 1 },
+{ 0, 14, 74, 1 },
+{ 0, 10, 65, 1 },
+{ 0, 12, 76, 1 },
+{ 0, 8, 65, 1 },
+{ 0, 10, 78, 1 },
+{ 0, 8, 65, 1 },
+{ 0, 8, 65, 1 },
+{ 0, 12, 81, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_67[8] =
+{
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v[] = { 81, 65, 16, 1 };
+
+static const unsigned char g_v2_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v2[] = { 81, 65, 0, 1 };
+
+
+static const unsigned char a_1_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x28, 0x0, 0x0, 0x0, 0x0, 0x0, 0x82, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x89:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x84:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x83) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCF) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xB5) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xB8) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xB1) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xCE) break;
+                                if (n <= 14) break;
+                                if (q[-15] != 0xBA) break;
+                                if (n <= 15) break;
+                                if (q[-16] != 0xCE) break;
+                                i = 0;
+                                break;
+                            case 0x86:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                i = 1;
+                                break;
+                        }
+                        break;
+                    case 0xB1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x81:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB5) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                switch (q[-9]) {
+                                    case 0x80:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCF) break;
+                                        i = 2;
+                                        break;
+                                    case 0x84:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCF) break;
+                                        i = 3;
+                                        break;
+                                }
+                                break;
+                            case 0xB5:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x81) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCF) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xBA) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                i = 4;
+                                break;
+                        }
+                        break;
+                    case 0xBF:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x84:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x89:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCF) break;
+                                        if (n <= 8) break;
+                                        switch (q[-9]) {
+                                            case 0x84:
+                                                if (n <= 9) break;
+                                                if (q[-10] != 0xCF) break;
+                                                if (n <= 10) break;
+                                                if (q[-11] != 0x83) break;
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xCF) break;
+                                                if (n <= 12) break;
+                                                if (q[-13] != 0xB5) break;
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xCE) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xB8) break;
+                                                if (n <= 15) break;
+                                                if (q[-16] != 0xCE) break;
+                                                if (n <= 16) break;
+                                                if (q[-17] != 0xB1) break;
+                                                if (n <= 17) break;
+                                                if (q[-18] != 0xCE) break;
+                                                if (n <= 18) break;
+                                                if (q[-19] != 0xBA) break;
+                                                if (n <= 19) break;
+                                                if (q[-20] != 0xCE) break;
+                                                i = 5;
+                                                break;
+                                            case 0x86:
+                                                if (n <= 9) break;
+                                                if (q[-10] != 0xCF) break;
+                                                i = 6;
+                                                break;
+                                        }
+                                        break;
+                                    case 0xB1:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCE) break;
+                                        if (n <= 8) break;
+                                        switch (q[-9]) {
+                                            case 0x81:
+                                                if (n <= 9) break;
+                                                if (q[-10] != 0xCF) break;
+                                                if (n <= 10) break;
+                                                if (q[-11] != 0xB5) break;
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xCE) break;
+                                                if (n <= 12) break;
+                                                switch (q[-13]) {
+                                                    case 0x80:
+                                                        if (n <= 13) break;
+                                                        if (q[-14] != 0xCF) break;
+                                                        i = 7;
+                                                        break;
+                                                    case 0x84:
+                                                        if (n <= 13) break;
+                                                        if (q[-14] != 0xCF) break;
+                                                        i = 8;
+                                                        break;
+                                                }
+                                                break;
+                                            case 0xB5:
+                                                if (n <= 9) break;
+                                                if (q[-10] != 0xCE) break;
+                                                if (n <= 10) break;
+                                                if (q[-11] != 0x81) break;
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xCF) break;
+                                                if (n <= 12) break;
+                                                if (q[-13] != 0xBA) break;
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xCE) break;
+                                                i = 9;
+                                                break;
+                                        }
+                                        break;
+                                    case 0xBF:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCE) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xBD) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCE) break;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xBF) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCE) break;
+                                        if (n <= 12) break;
+                                        if (q[-13] != 0xB3) break;
+                                        if (n <= 13) break;
+                                        if (q[-14] != 0xCE) break;
+                                        if (n <= 14) break;
+                                        if (q[-15] != 0xB5) break;
+                                        if (n <= 15) break;
+                                        if (q[-16] != 0xCE) break;
+                                        if (n <= 16) break;
+                                        if (q[-17] != 0xB3) break;
+                                        if (n <= 17) break;
+                                        if (q[-18] != 0xCE) break;
+                                        i = 10;
+                                        break;
+                                }
+                                break;
+                            case 0xBD:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xBF) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xB3) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xB5) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xB3) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xCE) break;
+                                i = 11;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x85:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBF) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB9) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB3) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                if (n <= 8) break;
+                switch (q[-9]) {
+                    case 0xB1:
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        if (n <= 10) break;
+                        switch (q[-11]) {
+                            case 0x86:
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCF) break;
+                                i = 12;
+                                break;
+                            case 0xBA:
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0x83) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xCF) break;
+                                i = 13;
+                                break;
+                        }
+                        break;
+                    case 0xBF:
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        if (n <= 10) break;
+                        switch (q[-11]) {
+                            case 0x83:
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCF) break;
+                                i = 14;
+                                break;
+                            case 0x84:
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCF) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xB1) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xCE) break;
+                                if (n <= 14) break;
+                                if (q[-15] != 0x84) break;
+                                if (n <= 15) break;
+                                if (q[-16] != 0xCF) break;
+                                i = 15;
+                                break;
+                            case 0xBB:
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xBF) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xCE) break;
+                                i = 16;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x84:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x89:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x84:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCF) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0x83) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCF) break;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xB5) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCE) break;
+                                        if (n <= 12) break;
+                                        if (q[-13] != 0xB8) break;
+                                        if (n <= 13) break;
+                                        if (q[-14] != 0xCE) break;
+                                        if (n <= 14) break;
+                                        if (q[-15] != 0xB1) break;
+                                        if (n <= 15) break;
+                                        if (q[-16] != 0xCE) break;
+                                        if (n <= 16) break;
+                                        if (q[-17] != 0xBA) break;
+                                        if (n <= 17) break;
+                                        if (q[-18] != 0xCE) break;
+                                        i = 17;
+                                        break;
+                                    case 0x86:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCF) break;
+                                        i = 18;
+                                        break;
+                                }
+                                break;
+                            case 0xB1:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x81:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCF) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xB5) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCE) break;
+                                        if (n <= 10) break;
+                                        switch (q[-11]) {
+                                            case 0x80:
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xCF) break;
+                                                i = 19;
+                                                break;
+                                            case 0x84:
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xCF) break;
+                                                i = 20;
+                                                break;
+                                        }
+                                        break;
+                                    case 0xB5:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCE) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0x81) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCF) break;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xBA) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCE) break;
+                                        i = 21;
+                                        break;
+                                }
+                                break;
+                            case 0xBF:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xBD) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xBF) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xB3) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xB5) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xCE) break;
+                                if (n <= 14) break;
+                                if (q[-15] != 0xB3) break;
+                                if (n <= 15) break;
+                                if (q[-16] != 0xCE) break;
+                                i = 22;
+                                break;
+                        }
+                        break;
+                    case 0xB9:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB3) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0xB1:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                switch (q[-9]) {
+                                    case 0x86:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCF) break;
+                                        i = 23;
+                                        break;
+                                    case 0xBA:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCE) break;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0x83) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCF) break;
+                                        i = 24;
+                                        break;
+                                }
+                                break;
+                            case 0xBF:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                switch (q[-9]) {
+                                    case 0x83:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCF) break;
+                                        i = 25;
+                                        break;
+                                    case 0x84:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCF) break;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xB1) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCE) break;
+                                        if (n <= 12) break;
+                                        if (q[-13] != 0x84) break;
+                                        if (n <= 13) break;
+                                        if (q[-14] != 0xCF) break;
+                                        i = 26;
+                                        break;
+                                    case 0xBB:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCE) break;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xBF) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCE) break;
+                                        i = 27;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0xB7:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x84) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB1) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x81) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB5) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                if (n <= 10) break;
+                if (q[-11] != 0x80) break;
+                if (n <= 11) break;
+                if (q[-12] != 0xCF) break;
+                i = 28;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x89) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x84:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x89:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCF) break;
+                                if (n <= 8) break;
+                                switch (q[-9]) {
+                                    case 0x84:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCF) break;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0x83) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCF) break;
+                                        if (n <= 12) break;
+                                        if (q[-13] != 0xB5) break;
+                                        if (n <= 13) break;
+                                        if (q[-14] != 0xCE) break;
+                                        if (n <= 14) break;
+                                        if (q[-15] != 0xB8) break;
+                                        if (n <= 15) break;
+                                        if (q[-16] != 0xCE) break;
+                                        if (n <= 16) break;
+                                        if (q[-17] != 0xB1) break;
+                                        if (n <= 17) break;
+                                        if (q[-18] != 0xCE) break;
+                                        if (n <= 18) break;
+                                        if (q[-19] != 0xBA) break;
+                                        if (n <= 19) break;
+                                        if (q[-20] != 0xCE) break;
+                                        i = 29;
+                                        break;
+                                    case 0x86:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCF) break;
+                                        i = 30;
+                                        break;
+                                }
+                                break;
+                            case 0xB1:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                switch (q[-9]) {
+                                    case 0x81:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCF) break;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xB5) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCE) break;
+                                        if (n <= 12) break;
+                                        switch (q[-13]) {
+                                            case 0x80:
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xCF) break;
+                                                i = 31;
+                                                break;
+                                            case 0x84:
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xCF) break;
+                                                i = 32;
+                                                break;
+                                        }
+                                        break;
+                                    case 0xB5:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCE) break;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0x81) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCF) break;
+                                        if (n <= 12) break;
+                                        if (q[-13] != 0xBA) break;
+                                        if (n <= 13) break;
+                                        if (q[-14] != 0xCE) break;
+                                        i = 33;
+                                        break;
+                                }
+                                break;
+                            case 0xBF:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xBD) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xBF) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xB3) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xCE) break;
+                                if (n <= 14) break;
+                                if (q[-15] != 0xB5) break;
+                                if (n <= 15) break;
+                                if (q[-16] != 0xCE) break;
+                                if (n <= 16) break;
+                                if (q[-17] != 0xB3) break;
+                                if (n <= 17) break;
+                                if (q[-18] != 0xCE) break;
+                                i = 34;
+                                break;
+                        }
+                        break;
+                    case 0xB9:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB3) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        switch (q[-9]) {
+                            case 0xB1:
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                if (n <= 10) break;
+                                switch (q[-11]) {
+                                    case 0x86:
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCF) break;
+                                        i = 35;
+                                        break;
+                                    case 0xBA:
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCE) break;
+                                        if (n <= 12) break;
+                                        if (q[-13] != 0x83) break;
+                                        if (n <= 13) break;
+                                        if (q[-14] != 0xCF) break;
+                                        i = 36;
+                                        break;
+                                }
+                                break;
+                            case 0xBF:
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                if (n <= 10) break;
+                                switch (q[-11]) {
+                                    case 0x83:
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCF) break;
+                                        i = 37;
+                                        break;
+                                    case 0x84:
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCF) break;
+                                        if (n <= 12) break;
+                                        if (q[-13] != 0xB1) break;
+                                        if (n <= 13) break;
+                                        if (q[-14] != 0xCE) break;
+                                        if (n <= 14) break;
+                                        if (q[-15] != 0x84) break;
+                                        if (n <= 15) break;
+                                        if (q[-16] != 0xCF) break;
+                                        i = 38;
+                                        break;
+                                    case 0xBB:
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCE) break;
+                                        if (n <= 12) break;
+                                        if (q[-13] != 0xBF) break;
+                                        if (n <= 13) break;
+                                        if (q[-14] != 0xCE) break;
+                                        i = 39;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+static const symbol s_0[] = { 0xCF, 0x86, 0xCE, 0xB1 };
+static const symbol s_1[] = { 0xCF, 0x83, 0xCE, 0xBA, 0xCE, 0xB1 };
+static const symbol s_2[] = { 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xBF };
+static const symbol s_3[] = { 0xCF, 0x83, 0xCE, 0xBF };
+static const symbol s_4[] = { 0xCF, 0x84, 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xBF };
+static const symbol s_5[] = { 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xB5 };
+static const symbol s_6[] = { 0xCF, 0x80, 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_7[] = { 0xCF, 0x84, 0xCE, 0xB5, 0xCF, 0x81 };
+static const symbol s_8[] = { 0xCF, 0x86, 0xCF, 0x89 };
+static const symbol s_9[] = { 0xCE, 0xBA, 0xCE, 0xB1, 0xCE, 0xB8, 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_10[] = { 0xCE, 0xB3, 0xCE, 0xB5, 0xCE, 0xB3, 0xCE, 0xBF, 0xCE, 0xBD };
+
+static const unsigned char a_3_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x2, 0x0, 0x0, 0x0, 0x0, 0x22, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB6) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB9) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        i = 0;
+                        break;
+                    case 0xB9:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB5) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB6) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB9) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 1;
+                        break;
+                }
+                break;
+            case 0x89:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB6) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB9) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 2;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB6) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB9) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 3;
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x84:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0xB1:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB6) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xB9) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                i = 4;
+                                break;
+                            case 0xB5:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB6) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xB9) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                i = 5;
+                                break;
+                        }
+                        break;
+                    case 0xB6:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB9) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 6;
+                        break;
+                    case 0xBC:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x85:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xBF) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xB6) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xB9) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                i = 7;
+                                break;
+                            case 0xB1:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB6) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xB9) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                i = 8;
+                                break;
+                        }
+                        break;
+                    case 0xBD:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x85:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xBF) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xB6) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xB9) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                i = 9;
+                                break;
+                            case 0xB1:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB6) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xB9) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                i = 10;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0xB9:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB6) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB9) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 11;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x85:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xBF) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB6) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB9) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 12;
+                        break;
+                    case 0xB1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB6) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB9) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        i = 13;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+
+static const unsigned char a_2_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x23, 0x0, 0x0, 0x0, 0x0, 0x0, 0x26, 0xBE, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_11[] = { 0xCE, 0xB9 };
+static const symbol s_12[] = { 0xCE, 0xB9, 0xCE, 0xB6 };
+
+static const unsigned char a_5_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBA) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB7) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB8) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                if (n <= 10) break;
+                if (q[-11] != 0x89) break;
+                if (n <= 11) break;
+                if (q[-12] != 0xCF) break;
+                i = 0;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB7) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB8) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0x89) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCF) break;
+                i = 1;
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x84:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBA) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB7) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xB8) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        if (n <= 12) break;
+                        if (q[-13] != 0x89) break;
+                        if (n <= 13) break;
+                        if (q[-14] != 0xCF) break;
+                        i = 2;
+                        break;
+                    case 0xBA:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB7) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB8) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0x89) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCF) break;
+                        i = 3;
+                        break;
+                    case 0xBC:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBA) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB7) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xB8) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        if (n <= 12) break;
+                        if (q[-13] != 0x89) break;
+                        if (n <= 13) break;
+                        if (q[-14] != 0xCF) break;
+                        i = 4;
+                        break;
+                    case 0xBD:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBA) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB7) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xB8) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        if (n <= 12) break;
+                        if (q[-13] != 0x89) break;
+                        if (n <= 13) break;
+                        if (q[-14] != 0xCF) break;
+                        i = 5;
+                        break;
+                }
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBA) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB7) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB8) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                if (n <= 10) break;
+                if (q[-11] != 0x89) break;
+                if (n <= 11) break;
+                if (q[-12] != 0xCF) break;
+                i = 6;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+
+static const unsigned char a_4_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x88, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_13[] = { 0xCF, 0x89, 0xCE, 0xBD };
+
+static const unsigned char a_7_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_7(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x83) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB9) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 0;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x83) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB9) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 1;
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x83:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB9) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 2;
+                        break;
+                    case 0x84:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x83) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB9) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 3;
+                        break;
+                    case 0xBC:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x83) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB9) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 4;
+                        break;
+                    case 0xBD:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x83) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB9) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 5;
+                        break;
+                }
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x83) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB9) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 6;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_7[i].s_size;
+    return a_7[i].result;
+}
+static const symbol s_14[] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xB1 };
+static const symbol s_15[] = { 0xCE, 0xB9, 0xCF, 0x83 };
+
+static const unsigned char a_6_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x53, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0xB4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_16[] = { 0xCE, 0xB9 };
+static const symbol s_17[] = { 0xCE, 0xB9, 0xCF, 0x83 };
+
+static const unsigned char a_9_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x2, 0x0, 0x0, 0x0, 0x0, 0x20, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_9(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB9) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB5) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x83) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB9) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 0;
+                break;
+            case 0x89:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x83) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB9) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 1;
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x84:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB5) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x83) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB9) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 2;
+                        break;
+                    case 0xBC:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x85) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBF) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0x83) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCF) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xB9) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        i = 3;
+                        break;
+                    case 0xBD:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x85) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBF) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0x83) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCF) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xB9) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 0xB9:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x83) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB9) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 5;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x85) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBF) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x83) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB9) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 6;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_9[i].s_size;
+    return a_9[i].result;
+}
+static const symbol s_18[] = { 0xCE, 0xB9 };
+
+static const unsigned char a_11_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x28, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA2, 0xA2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_11(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x85:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xBF) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x84) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0x83) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCF) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xB9) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        i = 0;
+                        break;
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x84) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x83) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB9) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 1;
+                        break;
+                    case 0xB7:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x84) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x83) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB9) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 2;
+                        break;
+                    case 0xBF:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x84) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x83) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB9) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 3;
+                        break;
+                }
+                break;
+            case 0x85:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBF) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x84) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x83) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB9) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 4;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x84) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x83) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB9) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 5;
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x84) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x83) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB9) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 6;
+                break;
+            case 0xB7:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x84) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x83) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB9) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 7;
+                break;
+            case 0xB9:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBF) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x84) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x83) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB9) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 8;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x89) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x84) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x83) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB9) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 9;
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x84) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x83) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB9) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 10;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_11[i].s_size;
+    return a_11[i].result;
+}
+
+static const unsigned char a_10_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x93, 0x1, 0x0, 0x0, 0x0, 0x0, 0x3A, 0xBD, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_19[] = { 0xCE, 0xB9 };
+static const symbol s_20[] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCF, 0x84 };
+
+static const unsigned char a_14_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x28, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_14(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x85:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xBF) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBC) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0x83) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCF) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xB9) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        i = 0;
+                        break;
+                    case 0xBF:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xBC) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x83) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB9) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 1;
+                        break;
+                }
+                break;
+            case 0x85:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBF) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBC) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x83) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB9) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 2;
+                break;
+            case 0xB9:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBF) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBC) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x83) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB9) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 3;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x89) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBC) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x83) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB9) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 4;
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBC) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x83) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB9) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 5;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_14[i].s_size;
+    return a_14[i].result;
+}
+static const symbol s_21[] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBC };
+static const symbol s_22[] = { 0xCE, 0xB9 };
+
+static int find_among_b_13(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0xBA:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB9) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x80:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBF) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0x84) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCF) break;
+                        i = 0;
+                        break;
+                    case 0x84:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x80:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCF) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xB5) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xBA) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0x83) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xCF) break;
+                                i = 1;
+                                break;
+                            case 0x83:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCF) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0x89) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCF) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xBD) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xB3) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xCE) break;
+                                i = 2;
+                                if (n <= 14) break;
+                                if (q[-15] != 0xB1) break;
+                                if (n <= 15) break;
+                                if (q[-16] != 0xCE) break;
+                                i = 3;
+                                break;
+                            case 0xBA:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xB5) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xBB) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xBA) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xCE) break;
+                                if (n <= 14) break;
+                                if (q[-15] != 0xB5) break;
+                                if (n <= 15) break;
+                                if (q[-16] != 0xCE) break;
+                                i = 4;
+                                break;
+                        }
+                        break;
+                    case 0xBC:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBF) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0x84) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCF) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xB1) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        i = 5;
+                        break;
+                    case 0xBD:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB8) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB5) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 6;
+                        break;
+                }
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB9) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x81:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x84:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCF) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xB1) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xB5) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xB8) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xCE) break;
+                                i = 7;
+                                break;
+                            case 0xB4:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xBD) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xB1) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xBE) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xCE) break;
+                                if (n <= 14) break;
+                                if (q[-15] != 0xB5) break;
+                                if (n <= 15) break;
+                                if (q[-16] != 0xCE) break;
+                                if (n <= 16) break;
+                                if (q[-17] != 0xBB) break;
+                                if (n <= 17) break;
+                                if (q[-18] != 0xCE) break;
+                                if (n <= 18) break;
+                                if (q[-19] != 0xB1) break;
+                                if (n <= 19) break;
+                                if (q[-20] != 0xCE) break;
+                                i = 8;
+                                break;
+                        }
+                        break;
+                    case 0x84:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBD) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB1) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xB6) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        if (n <= 12) break;
+                        if (q[-13] != 0x85) break;
+                        if (n <= 13) break;
+                        if (q[-14] != 0xCF) break;
+                        if (n <= 14) break;
+                        if (q[-15] != 0xB2) break;
+                        if (n <= 15) break;
+                        if (q[-16] != 0xCE) break;
+                        i = 9;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_13[i].s_size;
+    return a_13[i].result;
+}
+static const symbol s_23[] = { 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xBD, 0xCF, 0x89, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_24[] = { 0xCE, 0xB1, 0xCF, 0x84, 0xCE, 0xBF, 0xCE, 0xBC };
+static const symbol s_25[] = { 0xCE, 0xB3, 0xCE, 0xBD, 0xCF, 0x89, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_26[] = { 0xCE, 0xB5, 0xCE, 0xB8, 0xCE, 0xBD };
+static const symbol s_27[] = { 0xCE, 0xB5, 0xCE, 0xBA, 0xCE, 0xBB, 0xCE, 0xB5, 0xCE, 0xBA, 0xCF, 0x84 };
+static const symbol s_28[] = { 0xCF, 0x83, 0xCE, 0xBA, 0xCE, 0xB5, 0xCF, 0x80, 0xCF, 0x84 };
+static const symbol s_29[] = { 0xCF, 0x84, 0xCE, 0xBF, 0xCF, 0x80 };
+static const symbol s_30[] = { 0xCE, 0xB1, 0xCE, 0xBB, 0xCE, 0xB5, 0xCE, 0xBE, 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB4, 0xCF, 0x81 };
+static const symbol s_31[] = { 0xCE, 0xB2, 0xCF, 0x85, 0xCE, 0xB6, 0xCE, 0xB1, 0xCE, 0xBD, 0xCF, 0x84 };
+static const symbol s_32[] = { 0xCE, 0xB8, 0xCE, 0xB5, 0xCE, 0xB1, 0xCF, 0x84, 0xCF, 0x81 };
+
+static int find_among_b_16(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB9) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBA) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB1) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                if (n <= 8) break;
+                switch (q[-9]) {
+                    case 0x81:
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCF) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xB1) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        i = 0;
+                        break;
+                    case 0xB4:
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0x85) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCF) break;
+                        if (n <= 12) break;
+                        if (q[-13] != 0xBF) break;
+                        if (n <= 13) break;
+                        if (q[-14] != 0xCE) break;
+                        i = 1;
+                        break;
+                }
+                break;
+            case 0xB9:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB1) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                switch (q[-7]) {
+                    case 0x81:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB1) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 2;
+                        break;
+                    case 0xB4:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0x85) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCF) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xBF) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        i = 3;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_16[i].s_size;
+    return a_16[i].result;
+}
+static const symbol s_33[] = { 0xCE, 0xB1, 0xCF, 0x81, 0xCE, 0xB1, 0xCE, 0xBA };
+
+static const unsigned char a_18_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_18(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xB1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x83) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x84) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB9) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 0;
+                        break;
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x83) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x84) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB9) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 1;
+                        break;
+                }
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x83:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x84) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB9) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        i = 2;
+                        break;
+                    case 0xB9:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xBA) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB1) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        i = 3;
+                        if (n <= 8) break;
+                        if (q[-9] != 0x81) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCF) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xB1) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 0xB9:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB1) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 5;
+                if (n <= 6) break;
+                if (q[-7] != 0x81) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB1) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 6;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x89) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x83) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x84) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB9) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 7;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_18[i].s_size;
+    return a_18[i].result;
+}
+
+static const unsigned char a_17_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xFB, 0x0, 0x0, 0x0, 0x0, 0x0, 0x54, 0x3C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_34[] = { 0xCE, 0xB1, 0xCE, 0xBA };
+static const symbol s_35[] = { 0xCE, 0xB9, 0xCF, 0x84, 0xCF, 0x83 };
+static const symbol s_36[] = { 0xCE, 0xBA, 0xCE, 0xBF, 0xCF, 0x81 };
+static const symbol s_37[] = { 0xCE, 0xB9, 0xCF, 0x84, 0xCF, 0x83 };
+
+static int find_among_b_21(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB9) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB4) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB9) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 0;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x89) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB9) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB4) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB9) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 1;
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB9) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB4) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB9) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_21[i].s_size;
+    return a_21[i].result;
+}
+
+static const unsigned char a_19_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_38[] = { 0xCE, 0xB9, 0xCE, 0xB4 };
+
+static int find_among_b_20(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                i = 0;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x87) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB9) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB1) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0x80) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCF) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_20[i].s_size;
+    return a_20[i].result;
+}
+static const symbol s_39[] = { 0xCE, 0xB9, 0xCE, 0xB4 };
+
+static const unsigned char a_23_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x28, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_23(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBF) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBA) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x83) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB9) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 0;
+                break;
+            case 0x85:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBF) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBA) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x83) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB9) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 1;
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x83) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB9) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 2;
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x83) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB9) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_23[i].s_size;
+    return a_23[i].result;
+}
+
+static const unsigned char a_22_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x14, 0x2C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_40[] = { 0xCE, 0xB9, 0xCF, 0x83, 0xCE, 0xBA };
+
+static int find_among_b_24(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB4) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB1) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 0;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x89) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB4) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB1) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_24[i].s_size;
+    return a_24[i].result;
+}
+
+static const unsigned char a_25_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x13, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x36, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_25(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBC) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB1) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x80) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xBC) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 0;
+                break;
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x85:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xBA) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 1;
+                        break;
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x84:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB1) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0x80) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCF) break;
+                                i = 2;
+                                break;
+                            case 0xB8:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB5) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0x80) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCF) break;
+                                i = 3;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x84:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBD) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB1) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x84) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xBD) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 4;
+                break;
+            case 0xB9:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xB3:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB9) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB3) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 5;
+                        break;
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB8) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 6;
+                        break;
+                }
+                break;
+            case 0xBA:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBF) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                i = 7;
+                break;
+            case 0xBC:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBC) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 8;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBC) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 9;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_25[i].s_size;
+    return a_25[i].result;
+}
+static const symbol s_41[] = { 0xCE, 0xB1, 0xCE, 0xB4 };
+
+static int find_among_b_26(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB4) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB5) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 0;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x89) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB4) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB5) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_26[i].s_size;
+    return a_26[i].result;
+}
+
+static int find_among_b_27(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x83:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x81) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xBA) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 0;
+                        break;
+                    case 0x85:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        i = 1;
+                        break;
+                    case 0xB1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 2;
+                        break;
+                    case 0xB7:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB3) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 3;
+                        break;
+                    case 0xB9:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        i = 4;
+                        break;
+                    case 0xBC:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB5) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 5;
+                        break;
+                    case 0xBF:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        i = 6;
+                        break;
+                }
+                break;
+            case 0xBB:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB9) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBC) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 7;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_27[i].s_size;
+    return a_27[i].result;
+}
+static const symbol s_42[] = { 0xCE, 0xB5, 0xCE, 0xB4 };
+
+static int find_among_b_28(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB4) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x85) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xBF) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 0;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x89) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB4) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x85) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xBF) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_28[i].s_size;
+    return a_28[i].result;
+}
+
+static const unsigned char a_29_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x6C, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_29(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x83) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                i = 0;
+                break;
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x86) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                i = 1;
+                break;
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                i = 2;
+                break;
+            case 0x87:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB9) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBB) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 3;
+                break;
+            case 0xB3:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x81) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x84) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                i = 4;
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x86) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                i = 5;
+                break;
+            case 0xBA:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x81:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 6;
+                        break;
+                    case 0x83:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        i = 7;
+                        break;
+                    case 0xB1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB9) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBB) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB1) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xBA) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        i = 8;
+                        break;
+                }
+                break;
+            case 0xBB:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x85:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xBF) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBB) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        i = 9;
+                        break;
+                    case 0x86:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        i = 10;
+                        break;
+                    case 0xB1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x84) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB5) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0x80) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCF) break;
+                        i = 11;
+                        break;
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB2) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 12;
+                        break;
+                }
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x87) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                i = 13;
+                break;
+            case 0xBE:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBB) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x80) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                i = 14;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_29[i].s_size;
+    return a_29[i].result;
+}
+static const symbol s_43[] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xB4 };
+
+static int find_among_b_30(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x89) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB5) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 0;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x89) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB5) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_30[i].s_size;
+    return a_30[i].result;
+}
+
+static const unsigned char a_31_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x29, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_44[] = { 0xCE, 0xB5 };
+
+static const unsigned char a_32_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_32(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x85:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBF) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB9) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 0;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB9) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                i = 1;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x89) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB9) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_32[i].s_size;
+    return a_32[i].result;
+}
+static const symbol s_45[] = { 0xCE, 0xB9 };
+
+static const unsigned char a_33_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xA0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_33(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x85:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBF) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBA) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB9) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 0;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB9) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 1;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x89) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBA) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB9) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 2;
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB9) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_33[i].s_size;
+    return a_33[i].result;
+}
+static const symbol s_46[] = { 0xCE, 0xB9, 0xCE, 0xBA };
+
+static const unsigned char a_34_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x3D, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_47[] = { 0xCE, 0xB9, 0xCE, 0xBA };
+static const symbol s_48[] = { 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5 };
+static const symbol s_49[] = { 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBC };
+
+static int find_among_b_35(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0xB5) break;
+        if (n <= 1) break;
+        if (q[-2] != 0xCE) break;
+        if (n <= 2) break;
+        if (q[-3] != 0xBC) break;
+        if (n <= 3) break;
+        if (q[-4] != 0xCE) break;
+        if (n <= 4) break;
+        if (q[-5] != 0xB1) break;
+        if (n <= 5) break;
+        if (q[-6] != 0xCE) break;
+        if (n <= 6) break;
+        switch (q[-7]) {
+            case 0x83:
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                switch (q[-9]) {
+                    case 0x85:
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCF) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xBF) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        i = 0;
+                        break;
+                    case 0xB7:
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 1;
+                        break;
+                }
+                break;
+            case 0xB3:
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB1) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 2;
+                break;
+            case 0xBA:
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB7) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 3;
+                if (n <= 10) break;
+                if (q[-11] != 0xB8) break;
+                if (n <= 11) break;
+                if (q[-12] != 0xCE) break;
+                if (n <= 12) break;
+                if (q[-13] != 0xB7) break;
+                if (n <= 13) break;
+                if (q[-14] != 0xCE) break;
+                i = 4;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_35[i].s_size;
+    return a_35[i].result;
+}
+static const symbol s_50[] = { 0xCE, 0xB1, 0xCE, 0xBC, 0xCE, 0xB5 };
+
+static const unsigned char a_36_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xD, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_51[] = { 0xCE, 0xB1, 0xCE, 0xBC };
+
+static int find_among_b_38(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0xB5) break;
+        if (n <= 1) break;
+        if (q[-2] != 0xCE) break;
+        if (n <= 2) break;
+        if (q[-3] != 0xBD) break;
+        if (n <= 3) break;
+        if (q[-4] != 0xCE) break;
+        if (n <= 4) break;
+        if (q[-5] != 0xB1) break;
+        if (n <= 5) break;
+        if (q[-6] != 0xCE) break;
+        if (n <= 6) break;
+        switch (q[-7]) {
+            case 0x83:
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                switch (q[-9]) {
+                    case 0x85:
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCF) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xBF) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        i = 0;
+                        break;
+                    case 0xB7:
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 1;
+                        break;
+                }
+                break;
+            case 0x84:
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                switch (q[-9]) {
+                    case 0xBD:
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        if (n <= 10) break;
+                        switch (q[-11]) {
+                            case 0x85:
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCF) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xBF) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xCE) break;
+                                i = 2;
+                                if (n <= 14) break;
+                                if (q[-15] != 0xB9) break;
+                                if (n <= 15) break;
+                                if (q[-16] != 0xCE) break;
+                                i = 3;
+                                break;
+                            case 0xBF:
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                i = 4;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xB9) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xCE) break;
+                                i = 5;
+                                break;
+                        }
+                        break;
+                    case 0xBF:
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 6;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xB9) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        i = 7;
+                        break;
+                }
+                break;
+            case 0xB3:
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB1) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 8;
+                break;
+            case 0xBA:
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB7) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 9;
+                if (n <= 10) break;
+                if (q[-11] != 0xB8) break;
+                if (n <= 11) break;
+                if (q[-12] != 0xCE) break;
+                if (n <= 12) break;
+                if (q[-13] != 0xB7) break;
+                if (n <= 13) break;
+                if (q[-14] != 0xCE) break;
+                i = 10;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_38[i].s_size;
+    return a_38[i].result;
+}
+static const symbol s_52[] = { 0xCE, 0xB1, 0xCE, 0xB3, 0xCE, 0xB1, 0xCE, 0xBD };
+static const symbol s_53[] = { 0xCE, 0xB1, 0xCE, 0xBD, 0xCE, 0xB5 };
+static const symbol s_54[] = { 0xCE, 0xB1, 0xCE, 0xBD };
+
+static const unsigned char a_39_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xDB, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4C, 0x3D, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_55[] = { 0xCE, 0xB1, 0xCE, 0xBD };
+
+static int find_among_b_40(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0xB5) break;
+        if (n <= 1) break;
+        if (q[-2] != 0xCE) break;
+        if (n <= 2) break;
+        if (q[-3] != 0x84) break;
+        if (n <= 3) break;
+        if (q[-4] != 0xCF) break;
+        if (n <= 4) break;
+        if (q[-5] != 0xB5) break;
+        if (n <= 5) break;
+        if (q[-6] != 0xCE) break;
+        if (n <= 6) break;
+        if (q[-7] != 0x83) break;
+        if (n <= 7) break;
+        if (q[-8] != 0xCF) break;
+        if (n <= 8) break;
+        if (q[-9] != 0xB7) break;
+        if (n <= 9) break;
+        if (q[-10] != 0xCE) break;
+        i = 0;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_40[i].s_size;
+    return a_40[i].result;
+}
+static const symbol s_56[] = { 0xCE, 0xB5, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_57[] = { 0xCE, 0xB5, 0xCF, 0x84 };
+
+static const unsigned char a_41_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x92, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x2D, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_41(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x85:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x80:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                i = 0;
+                                break;
+                            case 0xB5:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                i = 1;
+                                break;
+                        }
+                        break;
+                    case 0x89:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x87) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        i = 2;
+                        break;
+                    case 0xB1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB2) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 3;
+                        break;
+                    case 0xB2:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        i = 4;
+                        break;
+                    case 0xB9:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 5;
+                        break;
+                    case 0xBF:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x86) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        i = 6;
+                        break;
+                }
+                break;
+            case 0x84:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBD) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 7;
+                break;
+            case 0x87:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x83) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                i = 8;
+                break;
+            case 0xB4:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xBD:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x85:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x83) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCF) break;
+                                i = 9;
+                                break;
+                            case 0xB5:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                i = 10;
+                                break;
+                        }
+                        break;
+                    case 0xBF:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        i = 11;
+                        break;
+                }
+                break;
+            case 0xB8:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x81:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB5) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x80) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0x85) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCF) break;
+                        i = 12;
+                        break;
+                    case 0x83:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        i = 13;
+                        break;
+                    case 0x85:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB5) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 14;
+                        break;
+                    case 0xB1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x81:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                i = 15;
+                                break;
+                            case 0x84:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                i = 16;
+                                break;
+                            case 0xB9:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB4) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                i = 17;
+                                break;
+                            case 0xBA:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                i = 18;
+                                break;
+                        }
+                        break;
+                    case 0xB9:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x84) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        i = 19;
+                        break;
+                    case 0xBA:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB5) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 20;
+                        break;
+                    case 0xBD:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x85:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x83) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCF) break;
+                                i = 21;
+                                break;
+                            case 0xB5:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                i = 22;
+                                break;
+                        }
+                        break;
+                    case 0xBF:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x81) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        i = 23;
+                        break;
+                }
+                break;
+            case 0xBA:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x81) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB1) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 24;
+                break;
+            case 0xBB:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x86) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x89) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        i = 25;
+                        break;
+                    case 0xBF:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB2) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 26;
+                        break;
+                }
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x85:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x83) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        i = 27;
+                        break;
+                    case 0xB9:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 28;
+                        break;
+                    case 0xBF:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x80:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                i = 29;
+                                break;
+                            case 0x81:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                i = 30;
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_41[i].s_size;
+    return a_41[i].result;
+}
+static const symbol s_58[] = { 0xCE, 0xB5, 0xCF, 0x84 };
+
+static const unsigned char a_42_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x63, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x3D, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_59[] = { 0xCE, 0xB5, 0xCF, 0x84 };
+
+static int find_among_b_43(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x83) break;
+        if (n <= 1) break;
+        if (q[-2] != 0xCF) break;
+        if (n <= 2) break;
+        if (q[-3] != 0xB1) break;
+        if (n <= 3) break;
+        if (q[-4] != 0xCE) break;
+        if (n <= 4) break;
+        if (q[-5] != 0x84) break;
+        if (n <= 5) break;
+        if (q[-6] != 0xCF) break;
+        if (n <= 6) break;
+        if (q[-7] != 0xBD) break;
+        if (n <= 7) break;
+        if (q[-8] != 0xCE) break;
+        if (n <= 8) break;
+        switch (q[-9]) {
+            case 0x89:
+                if (n <= 9) break;
+                if (q[-10] != 0xCF) break;
+                i = 0;
+                break;
+            case 0xBF:
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_43[i].s_size;
+    return a_43[i].result;
+}
+static const symbol s_60[] = { 0xCE, 0xB1, 0xCF, 0x81, 0xCF, 0x87 };
+static const symbol s_61[] = { 0xCE, 0xBF, 0xCE, 0xBD, 0xCF, 0x84 };
+static const symbol s_62[] = { 0xCE, 0xBA, 0xCF, 0x81, 0xCE, 0xB5 };
+static const symbol s_63[] = { 0xCF, 0x89, 0xCE, 0xBD, 0xCF, 0x84 };
+
+static int find_among_b_44(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0xB5) break;
+        if (n <= 1) break;
+        if (q[-2] != 0xCE) break;
+        if (n <= 2) break;
+        if (q[-3] != 0x84) break;
+        if (n <= 3) break;
+        if (q[-4] != 0xCF) break;
+        if (n <= 4) break;
+        if (q[-5] != 0x83) break;
+        if (n <= 5) break;
+        if (q[-6] != 0xCF) break;
+        if (n <= 6) break;
+        if (q[-7] != 0xB1) break;
+        if (n <= 7) break;
+        if (q[-8] != 0xCE) break;
+        if (n <= 8) break;
+        if (q[-9] != 0xBC) break;
+        if (n <= 9) break;
+        if (q[-10] != 0xCE) break;
+        if (n <= 10) break;
+        if (q[-11] != 0xBF) break;
+        if (n <= 11) break;
+        if (q[-12] != 0xCE) break;
+        i = 0;
+        if (n <= 12) break;
+        if (q[-13] != 0xB9) break;
+        if (n <= 13) break;
+        if (q[-14] != 0xCE) break;
+        i = 1;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_44[i].s_size;
+    return a_44[i].result;
+}
+static const symbol s_64[] = { 0xCE, 0xBF, 0xCE, 0xBD };
+static const symbol s_65[] = { 0xCE, 0xBF, 0xCE, 0xBC, 0xCE, 0xB1, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_66[] = { 0xCE, 0xB9, 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5 };
+static const symbol s_67[] = { 0xCE, 0xB9, 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x84 };
+static const symbol s_68[] = { 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x84, 0xCE, 0xB5 };
+
+static const unsigned char a_46_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xA, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40, 0xD8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_69[] = { 0xCE, 0xB9, 0xCE, 0xB5, 0xCF, 0x83, 0xCF, 0x84 };
+
+static const unsigned char a_47_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_47(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBA) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB7) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB8) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                if (n <= 10) break;
+                if (q[-11] != 0xB7) break;
+                if (n <= 11) break;
+                if (q[-12] != 0xCE) break;
+                i = 0;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB7) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB8) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB7) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 1;
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB7) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB8) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB7) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_47[i].s_size;
+    return a_47[i].result;
+}
+
+static const unsigned char a_50_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_50(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBA) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB7) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 0;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB7) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 1;
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB7) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_50[i].s_size;
+    return a_50[i].result;
+}
+
+static const unsigned char a_48_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_48(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x86:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x83) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                i = 0;
+                break;
+            case 0xB8:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x81:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBD) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        i = 1;
+                        break;
+                    case 0xB9:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x80) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        i = 2;
+                        break;
+                    case 0xBF:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        i = 3;
+                        break;
+                }
+                break;
+            case 0xBB:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x85:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xBF) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBA) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0x83) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCF) break;
+                        i = 4;
+                        break;
+                    case 0x89:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xBA) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x83) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        i = 5;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_48[i].s_size;
+    return a_48[i].result;
+}
+static const symbol s_70[] = { 0xCE, 0xB7, 0xCE, 0xBA };
+static const symbol s_71[] = { 0xCE, 0xB7, 0xCE, 0xBA };
+
+static const unsigned char a_53_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_53(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x83) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x85) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xBF) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 0;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x83) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x85) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xBF) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 1;
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x83) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x85) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xBF) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_53[i].s_size;
+    return a_53[i].result;
+}
+
+static const unsigned char a_51_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x93, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_51(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBB) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB2) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 0;
+                break;
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB4) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xBF) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0x80) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCF) break;
+                i = 1;
+                break;
+            case 0x84:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x89:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x81) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x80) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        i = 2;
+                        break;
+                    case 0xB1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xBC) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x85) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xBA) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 3;
+                        break;
+                }
+                break;
+            case 0x87:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x84:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBD) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB1) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0x80) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCF) break;
+                        i = 4;
+                        break;
+                    case 0xBB:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 5;
+                        break;
+                }
+                break;
+            case 0xB3:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xB1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x86) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        i = 6;
+                        break;
+                    case 0xB7:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xBB) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 7;
+                        break;
+                }
+                break;
+            case 0xB4:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x85) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x81) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x86) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                i = 8;
+                break;
+            case 0xBB:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xB9:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x84) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBD) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB1) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xBC) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        i = 9;
+                        break;
+                    case 0xBB:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBC) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        i = 10;
+                        break;
+                }
+                break;
+            case 0xBC:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBF) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                i = 11;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_51[i].s_size;
+    return a_51[i].result;
+}
+static const symbol s_72[] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83 };
+
+static const unsigned char a_52_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xB3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x72, 0x3D, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_73[] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCF, 0x83 };
+
+static const unsigned char a_57_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_57(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x85:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBF) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x83) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB7) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 0;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x83) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB7) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 1;
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x83) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB7) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_57[i].s_size;
+    return a_57[i].result;
+}
+static const symbol s_74[] = { 0xCE, 0xB7, 0xCF, 0x83 };
+
+static const unsigned char a_56_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_56(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB3) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB1) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 0;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB3) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB1) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 1;
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB3) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB1) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_56[i].s_size;
+    return a_56[i].result;
+}
+static const symbol s_75[] = { 0xCE, 0xBA, 0xCE, 0xBF, 0xCE, 0xBB, 0xCE, 0xBB };
+static const symbol s_76[] = { 0xCE, 0xB1, 0xCE, 0xB3 };
+
+static const unsigned char a_54_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xD3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x28, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_54(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x81) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                i = 0;
+                break;
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x80:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        i = 1;
+                        break;
+                    case 0x86:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0x84:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x81) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBF) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x87) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                i = 3;
+                break;
+            case 0x86:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x83:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        i = 4;
+                        break;
+                    case 0xBF:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        i = 5;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x88) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        i = 6;
+                        break;
+                }
+                break;
+            case 0x87:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBF) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBB) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                i = 7;
+                if (n <= 6) break;
+                if (q[-7] != 0x85) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB1) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                if (n <= 10) break;
+                if (q[-11] != 0xBD) break;
+                if (n <= 11) break;
+                if (q[-12] != 0xCE) break;
+                i = 8;
+                break;
+            case 0xBB:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x80) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        i = 9;
+                        break;
+                    case 0xBB:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        i = 10;
+                        break;
+                }
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB7) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBC) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x83) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCF) break;
+                i = 11;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_54[i].s_size;
+    return a_54[i].result;
+}
+static const symbol s_77[] = { 0xCE, 0xB1, 0xCE, 0xB3 };
+
+static const unsigned char a_55_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x73, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3A, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_78[] = { 0xCE, 0xB1, 0xCE, 0xB3 };
+
+static int find_among_b_59(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0xB5) break;
+        if (n <= 1) break;
+        if (q[-2] != 0xCE) break;
+        if (n <= 2) break;
+        if (q[-3] != 0x84) break;
+        if (n <= 3) break;
+        if (q[-4] != 0xCF) break;
+        if (n <= 4) break;
+        if (q[-5] != 0x83) break;
+        if (n <= 5) break;
+        if (q[-6] != 0xCF) break;
+        if (n <= 6) break;
+        if (q[-7] != 0xB7) break;
+        if (n <= 7) break;
+        if (q[-8] != 0xCE) break;
+        i = 0;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_59[i].s_size;
+    return a_59[i].result;
+}
+
+static const unsigned char a_60_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x1, 0x0, 0x0, 0x0, 0x0, 0x4, 0x28, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_79[] = { 0xCE, 0xB7, 0xCF, 0x83, 0xCF, 0x84 };
+
+static int find_among_b_61(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0xB5) break;
+        if (n <= 1) break;
+        if (q[-2] != 0xCE) break;
+        if (n <= 2) break;
+        if (q[-3] != 0xBD) break;
+        if (n <= 3) break;
+        if (q[-4] != 0xCE) break;
+        if (n <= 4) break;
+        if (q[-5] != 0x85) break;
+        if (n <= 5) break;
+        if (q[-6] != 0xCF) break;
+        if (n <= 6) break;
+        if (q[-7] != 0xBF) break;
+        if (n <= 7) break;
+        if (q[-8] != 0xCE) break;
+        i = 0;
+        if (n <= 8) break;
+        switch (q[-9]) {
+            case 0x83:
+                if (n <= 9) break;
+                if (q[-10] != 0xCF) break;
+                if (n <= 10) break;
+                if (q[-11] != 0xB7) break;
+                if (n <= 11) break;
+                if (q[-12] != 0xCE) break;
+                i = 1;
+                break;
+            case 0xB8:
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                if (n <= 10) break;
+                if (q[-11] != 0xB7) break;
+                if (n <= 11) break;
+                if (q[-12] != 0xCE) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_61[i].s_size;
+    return a_61[i].result;
+}
+
+static const unsigned char a_62_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xA, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_80[] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBD };
+
+static int find_among_b_63(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0xB5) break;
+        if (n <= 1) break;
+        if (q[-2] != 0xCE) break;
+        if (n <= 2) break;
+        if (q[-3] != 0xBC) break;
+        if (n <= 3) break;
+        if (q[-4] != 0xCE) break;
+        if (n <= 4) break;
+        if (q[-5] != 0x85) break;
+        if (n <= 5) break;
+        if (q[-6] != 0xCF) break;
+        if (n <= 6) break;
+        if (q[-7] != 0xBF) break;
+        if (n <= 7) break;
+        if (q[-8] != 0xCE) break;
+        i = 0;
+        if (n <= 8) break;
+        switch (q[-9]) {
+            case 0x83:
+                if (n <= 9) break;
+                if (q[-10] != 0xCF) break;
+                if (n <= 10) break;
+                if (q[-11] != 0xB7) break;
+                if (n <= 11) break;
+                if (q[-12] != 0xCE) break;
+                i = 1;
+                break;
+            case 0xB8:
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                if (n <= 10) break;
+                if (q[-11] != 0xB7) break;
+                if (n <= 11) break;
+                if (q[-12] != 0xCE) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_63[i].s_size;
+    return a_63[i].result;
+}
+
+static const unsigned char a_64_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xC8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+static const symbol s_81[] = { 0xCE, 0xBF, 0xCF, 0x85, 0xCE, 0xBC };
+
+static const unsigned char a_65_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_65(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBF) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x84) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB1) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xBC) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 0;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x84) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB1) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCE) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xBC) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                i = 1;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x89) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x84) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB1) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xCE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xBC) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xCE) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_65[i].s_size;
+    return a_65[i].result;
+}
+static const symbol s_82[] = { 0xCE, 0xBC, 0xCE, 0xB1 };
+
+static const unsigned char a_66_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x28, 0x2, 0x0, 0x0, 0x0, 0x0, 0xA2, 0xA2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_66(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x85:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        i = 0;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xBF) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 1;
+                        break;
+                    case 0xB1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        i = 2;
+                        break;
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        i = 3;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x83:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB7) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                i = 4;
+                                break;
+                            case 0xB4:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB7) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                i = 5;
+                                break;
+                        }
+                        break;
+                    case 0xB7:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        i = 6;
+                        break;
+                    case 0xB9:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB5) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 7;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB8) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB7) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 8;
+                        break;
+                    case 0xBF:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        i = 9;
+                        break;
+                }
+                break;
+            case 0x85:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                i = 10;
+                if (n <= 2) break;
+                if (q[-3] != 0xBF) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                i = 11;
+                break;
+            case 0x89:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                i = 12;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x83:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB7) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 13;
+                        break;
+                    case 0xB1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        i = 14;
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB7) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 15;
+                        break;
+                }
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                i = 16;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xBC:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x85) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBF) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB9) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 17;
+                        break;
+                    case 0xBD:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x85) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBF) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        switch (q[-9]) {
+                            case 0x83:
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCF) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xBF) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                i = 18;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xB9) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xCE) break;
+                                i = 19;
+                                break;
+                            case 0xBC:
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xBF) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                i = 20;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xB9) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xCE) break;
+                                i = 21;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                i = 22;
+                if (n <= 2) break;
+                if (q[-3] != 0x84) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCF) break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x83:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCF) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB1) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        if (n <= 8) break;
+                        switch (q[-9]) {
+                            case 0x83:
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCF) break;
+                                if (n <= 10) break;
+                                switch (q[-11]) {
+                                    case 0xB5:
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCE) break;
+                                        if (n <= 12) break;
+                                        if (q[-13] != 0xB9) break;
+                                        if (n <= 13) break;
+                                        if (q[-14] != 0xCE) break;
+                                        i = 23;
+                                        break;
+                                    case 0xBF:
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCE) break;
+                                        i = 24;
+                                        if (n <= 12) break;
+                                        if (q[-13] != 0xB9) break;
+                                        if (n <= 13) break;
+                                        if (q[-14] != 0xCE) break;
+                                        i = 25;
+                                        break;
+                                }
+                                break;
+                            case 0xBC:
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                if (n <= 10) break;
+                                switch (q[-11]) {
+                                    case 0x85:
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCF) break;
+                                        if (n <= 12) break;
+                                        if (q[-13] != 0xBF) break;
+                                        if (n <= 13) break;
+                                        if (q[-14] != 0xCE) break;
+                                        i = 26;
+                                        if (n <= 14) break;
+                                        if (q[-15] != 0xB9) break;
+                                        if (n <= 15) break;
+                                        if (q[-16] != 0xCE) break;
+                                        i = 27;
+                                        break;
+                                    case 0xB5:
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCE) break;
+                                        if (n <= 12) break;
+                                        if (q[-13] != 0xB9) break;
+                                        if (n <= 13) break;
+                                        if (q[-14] != 0xCE) break;
+                                        i = 28;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0xB1:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x83:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCF) break;
+                                if (n <= 8) break;
+                                switch (q[-9]) {
+                                    case 0x85:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCF) break;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xBF) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCE) break;
+                                        i = 29;
+                                        break;
+                                    case 0xB7:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCE) break;
+                                        i = 30;
+                                        break;
+                                }
+                                break;
+                            case 0xB3:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xB1) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                i = 31;
+                                break;
+                            case 0xBA:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xB7) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                i = 32;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xB8) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xB7) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xCE) break;
+                                i = 33;
+                                break;
+                        }
+                        break;
+                    case 0xB9:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB5) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        i = 34;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB8) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xB7) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xCE) break;
+                        i = 35;
+                        break;
+                }
+                break;
+            case 0xB7:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                i = 36;
+                break;
+            case 0xB9:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                i = 37;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xB1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x83:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0xB1:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCE) break;
+                                        i = 38;
+                                        break;
+                                    case 0xB5:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCE) break;
+                                        i = 39;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xB9) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCE) break;
+                                        i = 40;
+                                        break;
+                                }
+                                break;
+                            case 0x84:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0xB1:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCE) break;
+                                        i = 41;
+                                        break;
+                                    case 0xB5:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCE) break;
+                                        i = 42;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xB9) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCE) break;
+                                        i = 43;
+                                        break;
+                                    case 0xBD:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCE) break;
+                                        if (n <= 8) break;
+                                        switch (q[-9]) {
+                                            case 0x85:
+                                                if (n <= 9) break;
+                                                if (q[-10] != 0xCF) break;
+                                                if (n <= 10) break;
+                                                if (q[-11] != 0xBF) break;
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xCE) break;
+                                                i = 44;
+                                                if (n <= 12) break;
+                                                if (q[-13] != 0xB9) break;
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xCE) break;
+                                                i = 45;
+                                                break;
+                                            case 0xBF:
+                                                if (n <= 9) break;
+                                                if (q[-10] != 0xCE) break;
+                                                i = 46;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 0xBC:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x85:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCF) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xBF) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCE) break;
+                                        i = 47;
+                                        break;
+                                    case 0xB1:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCE) break;
+                                        i = 48;
+                                        break;
+                                    case 0xB5:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCE) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xB9) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCE) break;
+                                        i = 49;
+                                        break;
+                                    case 0xBF:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCE) break;
+                                        i = 50;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        i = 51;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x83:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB7) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                i = 52;
+                                break;
+                            case 0xB1:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                i = 53;
+                                break;
+                            case 0xB8:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB7) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                i = 54;
+                                break;
+                        }
+                        break;
+                    case 0xBF:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        i = 55;
+                        break;
+                }
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x85:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xBF) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        i = 56;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x83:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCF) break;
+                                if (n <= 8) break;
+                                switch (q[-9]) {
+                                    case 0xB7:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCE) break;
+                                        i = 57;
+                                        break;
+                                    case 0xBF:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCE) break;
+                                        i = 58;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xB9) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCE) break;
+                                        i = 59;
+                                        break;
+                                }
+                                break;
+                            case 0xB8:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xB7) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                i = 60;
+                                break;
+                            case 0xBC:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xBF) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                i = 61;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xB9) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                i = 62;
+                                break;
+                        }
+                        break;
+                    case 0x89:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCF) break;
+                        i = 63;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xCE) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB7) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        i = 64;
+                        break;
+                    case 0xB1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xCE) break;
+                        i = 65;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x83:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x85:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCF) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xBF) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCE) break;
+                                        i = 66;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0x84) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xCF) break;
+                                        if (n <= 12) break;
+                                        if (q[-13] != 0xBD) break;
+                                        if (n <= 13) break;
+                                        if (q[-14] != 0xCE) break;
+                                        if (n <= 14) break;
+                                        if (q[-15] != 0xBF) break;
+                                        if (n <= 15) break;
+                                        if (q[-16] != 0xCE) break;
+                                        i = 67;
+                                        if (n <= 16) break;
+                                        if (q[-17] != 0xB9) break;
+                                        if (n <= 17) break;
+                                        if (q[-18] != 0xCE) break;
+                                        i = 68;
+                                        break;
+                                    case 0xB7:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCE) break;
+                                        i = 69;
+                                        break;
+                                }
+                                break;
+                            case 0x84:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCF) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x83:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCF) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xB1) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCE) break;
+                                        if (n <= 10) break;
+                                        switch (q[-11]) {
+                                            case 0x83:
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xCF) break;
+                                                if (n <= 12) break;
+                                                if (q[-13] != 0xBF) break;
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xCE) break;
+                                                i = 70;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xB9) break;
+                                                if (n <= 15) break;
+                                                if (q[-16] != 0xCE) break;
+                                                i = 71;
+                                                break;
+                                            case 0xBC:
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xCE) break;
+                                                if (n <= 12) break;
+                                                if (q[-13] != 0xBF) break;
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xCE) break;
+                                                i = 72;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xB9) break;
+                                                if (n <= 15) break;
+                                                if (q[-16] != 0xCE) break;
+                                                i = 73;
+                                                break;
+                                        }
+                                        break;
+                                    case 0xBD:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCE) break;
+                                        if (n <= 8) break;
+                                        switch (q[-9]) {
+                                            case 0x85:
+                                                if (n <= 9) break;
+                                                if (q[-10] != 0xCF) break;
+                                                if (n <= 10) break;
+                                                if (q[-11] != 0xBF) break;
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xCE) break;
+                                                i = 74;
+                                                if (n <= 12) break;
+                                                if (q[-13] != 0xB9) break;
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xCE) break;
+                                                i = 75;
+                                                break;
+                                            case 0xBF:
+                                                if (n <= 9) break;
+                                                if (q[-10] != 0xCE) break;
+                                                i = 76;
+                                                if (n <= 10) break;
+                                                if (q[-11] != 0xB9) break;
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xCE) break;
+                                                i = 77;
+                                                break;
+                                        }
+                                        break;
+                                    case 0xBF:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xCE) break;
+                                        i = 78;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xB9) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xCE) break;
+                                        i = 79;
+                                        break;
+                                }
+                                break;
+                            case 0xB3:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB1) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                i = 80;
+                                break;
+                            case 0xBA:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xCE) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB7) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xCE) break;
+                                i = 81;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xB8) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xCE) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xB7) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xCE) break;
+                                i = 82;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xCE) break;
+                i = 83;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_66[i].s_size;
+    return a_66[i].result;
+}
+
+static int find_among_b_67(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x84) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                switch (q[-7]) {
+                    case 0x83:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB5) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 0;
+                        break;
+                    case 0x85:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        i = 1;
+                        break;
+                    case 0x89:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        i = 2;
+                        break;
+                    case 0xBF:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        i = 3;
+                        break;
+                }
+                break;
+            case 0x84:
+                if (n <= 1) break;
+                if (q[-2] != 0xCF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xCE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x84) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xCF) break;
+                if (n <= 6) break;
+                switch (q[-7]) {
+                    case 0x83:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB5) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xCE) break;
+                        i = 4;
+                        break;
+                    case 0x85:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        i = 5;
+                        break;
+                    case 0x89:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCF) break;
+                        i = 6;
+                        break;
+                    case 0xBF:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xCE) break;
+                        i = 7;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_67[i].s_size;
+    return a_67[i].result;
+}
+
+extern int greek_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    z->lb = z->c; z->c = z->l;
+
+    {   int m1 = z->l - z->c; (void)m1;
+        {   int ret = translate_b_U(z, &a_0_translation);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - m1;
+    }
+    if (!(lenof_utf8(z, z->p) >= 3)) return 0;
+    z->I[0] = 1;
+    {   int m2 = z->l - z->c; (void)m2;
+        z->ket = z->c;
+        if (z->c - 5 <= z->lb || !((a_1_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab1;
+        among_var = find_among_b_1(z);
+        if (!(among_var)) goto lab1;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 4, s_0);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 6, s_1);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 6, s_2);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                {   int ret = slice_from_s(z, 4, s_3);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                {   int ret = slice_from_s(z, 8, s_4);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {   int ret = slice_from_s(z, 6, s_5);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                {   int ret = slice_from_s(z, 6, s_6);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 8:
+                {   int ret = slice_from_s(z, 6, s_7);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 9:
+                {   int ret = slice_from_s(z, 4, s_8);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 10:
+                {   int ret = slice_from_s(z, 12, s_9);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 11:
+                {   int ret = slice_from_s(z, 10, s_10);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+        z->I[0] = 0;
+    lab1:
+        z->c = z->l - m2;
+    }
+    {   int m3 = z->l - z->c; (void)m3;
+        z->ket = z->c;
+        if (z->c - 5 <= z->lb || !((a_3_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab2;
+        if (!(find_among_b_3(z))) goto lab2;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || !((a_2_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab2;
+        among_var = find_among_hash_b(z, &a_2_table, &a_2_hash);
+        if (!(among_var)) goto lab2;
+        if (z->c > z->lb) goto lab2;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 2, s_11);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 4, s_12);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab2:
+        z->c = z->l - m3;
+    }
+    {   int m4 = z->l - z->c; (void)m4;
+        z->ket = z->c;
+        if (z->c - 9 <= z->lb || !((a_5_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab3;
+        if (!(find_among_b_5(z))) goto lab3;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || !((a_4_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab3;
+        if (!(find_among_hash_b(z, &a_4_table, &a_4_hash))) goto lab3;
+        if (z->c > z->lb) goto lab3;
+        {   int ret = slice_from_s(z, 4, s_13);
+            if (ret < 0) return ret;
+        }
+    lab3:
+        z->c = z->l - m4;
+    }
+    {   int m5 = z->l - z->c; (void)m5;
+        z->ket = z->c;
+        if (z->c - 5 <= z->lb || !((a_7_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab4;
+        if (!(find_among_b_7(z))) goto lab4;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m6 = z->l - z->c; (void)m6;
+            if (!(eq_s_b(z, 6, s_14))) goto lab6;
+            if (z->c > z->lb) goto lab6;
+            {   int ret = slice_from_s(z, 4, s_15);
+                if (ret < 0) return ret;
+            }
+            goto lab5;
+        lab6:
+            z->c = z->l - m6;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 1 <= z->lb || !((a_6_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab4;
+            among_var = find_among_hash_b(z, &a_6_table, &a_6_hash);
+            if (!(among_var)) goto lab4;
+            if (z->c > z->lb) goto lab4;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_from_s(z, 2, s_16);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    {   int ret = slice_from_s(z, 4, s_17);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+        }
+    lab5:
+    lab4:
+        z->c = z->l - m5;
+    }
+    {   int m7 = z->l - z->c; (void)m7;
+        z->ket = z->c;
+        if (z->c - 5 <= z->lb || !((a_9_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab7;
+        if (!(find_among_b_9(z))) goto lab7;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 3 <= z->lb || z->p[z->c - 1] >> 5 != 5 || !((-2145255424 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] != 206) goto lab7;
+        if (!(find_among_hash_b(z, &a_8_table, &a_8_hash))) goto lab7;
+        if (z->c > z->lb) goto lab7;
+        {   int ret = slice_from_s(z, 2, s_18);
+            if (ret < 0) return ret;
+        }
+    lab7:
+        z->c = z->l - m7;
+    }
+    {   int m8 = z->l - z->c; (void)m8;
+        z->ket = z->c;
+        if (z->c - 7 <= z->lb || !((a_11_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab8;
+        if (!(find_among_b_11(z))) goto lab8;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || !((a_10_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab8;
+        among_var = find_among_hash_b(z, &a_10_table, &a_10_hash);
+        if (!(among_var)) goto lab8;
+        if (z->c > z->lb) goto lab8;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 2, s_19);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 6, s_20);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab8:
+        z->c = z->l - m8;
+    }
+    {   int m9 = z->l - z->c; (void)m9;
+        z->ket = z->c;
+        if (z->c - 7 <= z->lb || !((a_14_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab9;
+        if (!(find_among_b_14(z))) goto lab9;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m10 = z->l - z->c; (void)m10;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 3 <= z->lb || z->p[z->c - 1] != 181 || z->p[z->c - 2] != 206) goto lab11;
+            among_var = find_among_hash_b(z, &a_12_table, &a_12_hash);
+            if (!(among_var)) goto lab11;
+            if (z->c > z->lb) goto lab11;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_from_s(z, 6, s_21);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    {   int ret = slice_from_s(z, 2, s_22);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+            goto lab10;
+        lab11:
+            z->c = z->l - m10;
+            z->ket = z->c;
+            if (z->c - 9 <= z->lb || (z->p[z->c - 1] != 186 && z->p[z->c - 1] != 189) || z->p[z->c - 2] != 206) goto lab9;
+            among_var = find_among_b_13(z);
+            if (!(among_var)) goto lab9;
+            z->bra = z->c;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_from_s(z, 12, s_23);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    {   int ret = slice_from_s(z, 8, s_24);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 3:
+                    {   int ret = slice_from_s(z, 10, s_25);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 4:
+                    {   int ret = slice_from_s(z, 6, s_26);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 5:
+                    {   int ret = slice_from_s(z, 12, s_27);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 6:
+                    {   int ret = slice_from_s(z, 10, s_28);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 7:
+                    {   int ret = slice_from_s(z, 6, s_29);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 8:
+                    {   int ret = slice_from_s(z, 16, s_30);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 9:
+                    {   int ret = slice_from_s(z, 12, s_31);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 10:
+                    {   int ret = slice_from_s(z, 10, s_32);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+        }
+    lab10:
+    lab9:
+        z->c = z->l - m9;
+    }
+    {   int m11 = z->l - z->c; (void)m11;
+        z->ket = z->c;
+        if (z->c - 9 <= z->lb || (z->p[z->c - 1] != 177 && z->p[z->c - 1] != 185) || z->p[z->c - 2] != 206) goto lab12;
+        if (!(find_among_b_16(z))) goto lab12;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 131 && z->p[z->c - 1] != 135) || z->p[z->c - 2] != 207) goto lab12;
+        if (!(find_among_hash_b(z, &a_15_table, &a_15_hash))) goto lab12;
+        if (z->c > z->lb) goto lab12;
+        {   int ret = slice_from_s(z, 8, s_33);
+            if (ret < 0) return ret;
+        }
+    lab12:
+        z->c = z->l - m11;
+    }
+    {   int m12 = z->l - z->c; (void)m12;
+        z->ket = z->c;
+        if (z->c - 5 <= z->lb || !((a_18_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab13;
+        if (!(find_among_b_18(z))) goto lab13;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m13 = z->l - z->c; (void)m13;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 1 <= z->lb || !((a_17_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab15;
+            among_var = find_among_hash_b(z, &a_17_table, &a_17_hash);
+            if (!(among_var)) goto lab15;
+            if (z->c > z->lb) goto lab15;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_from_s(z, 4, s_34);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    {   int ret = slice_from_s(z, 6, s_35);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+            goto lab14;
+        lab15:
+            z->c = z->l - m13;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (!(eq_s_b(z, 6, s_36))) goto lab13;
+            {   int ret = slice_from_s(z, 6, s_37);
+                if (ret < 0) return ret;
+            }
+        }
+    lab14:
+    lab13:
+        z->c = z->l - m12;
+    }
+    {   int m14 = z->l - z->c; (void)m14;
+        z->ket = z->c;
+        if (z->c - 7 <= z->lb || z->p[z->c - 1] >> 5 != 5 || !((-1610481664 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] != 206) goto lab16;
+        if (!(find_among_b_21(z))) goto lab16;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m15 = z->l - z->c; (void)m15;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 3 <= z->lb || !((a_19_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab18;
+            if (!(find_among_hash_b(z, &a_19_table, &a_19_hash))) goto lab18;
+            if (z->c > z->lb) goto lab18;
+            {   int ret = slice_from_s(z, 4, s_38);
+                if (ret < 0) return ret;
+            }
+            goto lab17;
+        lab18:
+            z->c = z->l - m15;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 181 && z->p[z->c - 1] != 189) || z->p[z->c - 2] != 206) goto lab16;
+            if (!(find_among_b_20(z))) goto lab16;
+            {   int ret = slice_from_s(z, 4, s_39);
+                if (ret < 0) return ret;
+            }
+        }
+    lab17:
+    lab16:
+        z->c = z->l - m14;
+    }
+    {   int m16 = z->l - z->c; (void)m16;
+        z->ket = z->c;
+        if (z->c - 7 <= z->lb || !((a_23_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab19;
+        if (!(find_among_b_23(z))) goto lab19;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || !((a_22_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab19;
+        if (!(find_among_hash_b(z, &a_22_table, &a_22_hash))) goto lab19;
+        if (z->c > z->lb) goto lab19;
+        {   int ret = slice_from_s(z, 6, s_40);
+            if (ret < 0) return ret;
+        }
+    lab19:
+        z->c = z->l - m16;
+    }
+    {   int m17 = z->l - z->c; (void)m17;
+        z->ket = z->c;
+        if (z->c - 7 <= z->lb || (z->p[z->c - 1] != 131 && z->p[z->c - 1] != 189) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab20;
+        if (!(find_among_b_24(z))) goto lab20;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        {   int m18 = z->l - z->c; (void)m18;
+            if (z->c - 3 <= z->lb || !((a_25_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab21;
+            if (!(find_among_b_25(z))) goto lab21;
+            goto lab20;
+        lab21:
+            z->c = z->l - m18;
+        }
+        {   int ret;
+            {   int saved_c = z->c;
+                ret = insert_s(z, z->c, z->c, 4, s_41);
+                z->c = saved_c;
+            }
+            if (ret < 0) return ret;
+        }
+    lab20:
+        z->c = z->l - m17;
+    }
+    {   int m19 = z->l - z->c; (void)m19;
+        z->ket = z->c;
+        if (z->c - 7 <= z->lb || (z->p[z->c - 1] != 131 && z->p[z->c - 1] != 189) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab22;
+        if (!(find_among_b_26(z))) goto lab22;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 3 <= z->lb || (z->p[z->c - 1] != 128 && z->p[z->c - 1] != 187) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab22;
+        if (!(find_among_b_27(z))) goto lab22;
+        {   int ret = slice_from_s(z, 4, s_42);
+            if (ret < 0) return ret;
+        }
+    lab22:
+        z->c = z->l - m19;
+    }
+    {   int m20 = z->l - z->c; (void)m20;
+        z->ket = z->c;
+        if (z->c - 9 <= z->lb || (z->p[z->c - 1] != 131 && z->p[z->c - 1] != 189) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab23;
+        if (!(find_among_b_28(z))) goto lab23;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || !((a_29_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab23;
+        if (!(find_among_b_29(z))) goto lab23;
+        {   int ret = slice_from_s(z, 6, s_43);
+            if (ret < 0) return ret;
+        }
+    lab23:
+        z->c = z->l - m20;
+    }
+    {   int m21 = z->l - z->c; (void)m21;
+        z->ket = z->c;
+        if (z->c - 5 <= z->lb || (z->p[z->c - 1] != 131 && z->p[z->c - 1] != 189) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab24;
+        if (!(find_among_b_30(z))) goto lab24;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || !((a_31_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab24;
+        if (!(find_among_hash_b(z, &a_31_table, &a_31_hash))) goto lab24;
+        if (z->c > z->lb) goto lab24;
+        {   int ret = slice_from_s(z, 2, s_44);
+            if (ret < 0) return ret;
+        }
+    lab24:
+        z->c = z->l - m21;
+    }
+    {   int m22 = z->l - z->c; (void)m22;
+        z->ket = z->c;
+        if (z->c - 3 <= z->lb || !((a_32_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab25;
+        if (!(find_among_b_32(z))) goto lab25;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (in_class_b_U(z, g_v_class, g_v, 945, 969, 0)) goto lab25;
+        {   int ret = slice_from_s(z, 2, s_45);
+            if (ret < 0) return ret;
+        }
+    lab25:
+        z->c = z->l - m22;
+    }
+    {   int m23 = z->l - z->c; (void)m23;
+        z->ket = z->c;
+        if (z->c - 5 <= z->lb || !((a_33_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab26;
+        if (!(find_among_b_33(z))) goto lab26;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m24 = z->l - z->c; (void)m24;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (in_class_b_U(z, g_v_class, g_v, 945, 969, 0)) goto lab28;
+            {   int ret = slice_from_s(z, 4, s_46);
+                if (ret < 0) return ret;
+            }
+            goto lab27;
+        lab28:
+            z->c = z->l - m24;
+            z->ket = z->c;
+        }
+    lab27:
+        z->bra = z->c;
+        if (z->c - 3 <= z->lb || !((a_34_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab26;
+        if (!(find_among_hash_b(z, &a_34_table, &a_34_hash))) goto lab26;
+        if (z->c > z->lb) goto lab26;
+        {   int ret = slice_from_s(z, 4, s_47);
+            if (ret < 0) return ret;
+        }
+    lab26:
+        z->c = z->l - m23;
+    }
+    {   int m25 = z->l - z->c; (void)m25;
+        {   int m26 = z->l - z->c; (void)m26;
+            if (!(eq_s_b(z, 10, s_48))) goto lab30;
+            if (z->c > z->lb) goto lab30;
+            {   int ret = slice_from_s(z, 8, s_49);
+                if (ret < 0) return ret;
+            }
+        lab30:
+            z->c = z->l - m26;
+        }
+        {   int m27 = z->l - z->c; (void)m27;
+            z->ket = z->c;
+            if (z->c - 9 <= z->lb || z->p[z->c - 1] != 181 || z->p[z->c - 2] != 206) goto lab31;
+            if (!(find_among_b_35(z))) goto lab31;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            z->I[0] = 0;
+        lab31:
+            z->c = z->l - m27;
+        }
+        z->ket = z->c;
+        if (!(eq_s_b(z, 6, s_50))) goto lab29;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || !((a_36_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab29;
+        if (!(find_among_hash_b(z, &a_36_table, &a_36_hash))) goto lab29;
+        if (z->c > z->lb) goto lab29;
+        {   int ret = slice_from_s(z, 4, s_51);
+            if (ret < 0) return ret;
+        }
+    lab29:
+        z->c = z->l - m25;
+    }
+    {   int m28 = z->l - z->c; (void)m28;
+        {   int m29 = z->l - z->c; (void)m29;
+            z->ket = z->c;
+            if (z->c - 9 <= z->lb || z->p[z->c - 1] != 181 || z->p[z->c - 2] != 206) goto lab33;
+            if (!(find_among_b_38(z))) goto lab33;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            z->I[0] = 0;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 3 <= z->lb || (z->p[z->c - 1] != 129 && z->p[z->c - 1] != 131) || z->p[z->c - 2] != 207) goto lab33;
+            if (!(find_among_hash_b(z, &a_37_table, &a_37_hash))) goto lab33;
+            if (z->c > z->lb) goto lab33;
+            {   int ret = slice_from_s(z, 8, s_52);
+                if (ret < 0) return ret;
+            }
+        lab33:
+            z->c = z->l - m29;
+        }
+        z->ket = z->c;
+        if (!(eq_s_b(z, 6, s_53))) goto lab32;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m30 = z->l - z->c; (void)m30;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (in_class_b_U(z, g_v2_class, g_v2, 945, 969, 0)) goto lab35;
+            {   int ret = slice_from_s(z, 4, s_54);
+                if (ret < 0) return ret;
+            }
+            goto lab34;
+        lab35:
+            z->c = z->l - m30;
+            z->ket = z->c;
+        }
+    lab34:
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || !((a_39_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab32;
+        if (!(find_among_hash_b(z, &a_39_table, &a_39_hash))) goto lab32;
+        if (z->c > z->lb) goto lab32;
+        {   int ret = slice_from_s(z, 4, s_55);
+            if (ret < 0) return ret;
+        }
+    lab32:
+        z->c = z->l - m28;
+    }
+    {   int m31 = z->l - z->c; (void)m31;
+        {   int m32 = z->l - z->c; (void)m32;
+            z->ket = z->c;
+            if (z->c - 9 <= z->lb || z->p[z->c - 1] != 181 || z->p[z->c - 2] != 206) goto lab37;
+            if (!(find_among_b_40(z))) goto lab37;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            z->I[0] = 0;
+        lab37:
+            z->c = z->l - m32;
+        }
+        z->ket = z->c;
+        if (!(eq_s_b(z, 6, s_56))) goto lab36;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m33 = z->l - z->c; (void)m33;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (in_class_b_U(z, g_v2_class, g_v2, 945, 969, 0)) goto lab39;
+            {   int ret = slice_from_s(z, 4, s_57);
+                if (ret < 0) return ret;
+            }
+            goto lab38;
+        lab39:
+            z->c = z->l - m33;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 3 <= z->lb || !((a_41_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab40;
+            if (!(find_among_b_41(z))) goto lab40;
+            {   int ret = slice_from_s(z, 4, s_58);
+                if (ret < 0) return ret;
+            }
+            goto lab38;
+        lab40:
+            z->c = z->l - m33;
+            z->ket = z->c;
+        }
+    lab38:
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || !((a_42_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab36;
+        if (!(find_among_hash_b(z, &a_42_table, &a_42_hash))) goto lab36;
+        if (z->c > z->lb) goto lab36;
+        {   int ret = slice_from_s(z, 4, s_59);
+            if (ret < 0) return ret;
+        }
+    lab36:
+        z->c = z->l - m31;
+    }
+    {   int m34 = z->l - z->c; (void)m34;
+        z->ket = z->c;
+        if (z->c - 9 <= z->lb || z->p[z->c - 1] != 131 || z->p[z->c - 2] != 207) goto lab41;
+        if (!(find_among_b_43(z))) goto lab41;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m35 = z->l - z->c; (void)m35;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (!(eq_s_b(z, 6, s_60))) goto lab43;
+            if (z->c > z->lb) goto lab43;
+            {   int ret = slice_from_s(z, 6, s_61);
+                if (ret < 0) return ret;
+            }
+            goto lab42;
+        lab43:
+            z->c = z->l - m35;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (!(eq_s_b(z, 6, s_62))) goto lab41;
+            {   int ret = slice_from_s(z, 6, s_63);
+                if (ret < 0) return ret;
+            }
+        }
+    lab42:
+    lab41:
+        z->c = z->l - m34;
+    }
+    {   int m36 = z->l - z->c; (void)m36;
+        z->ket = z->c;
+        if (z->c - 11 <= z->lb || z->p[z->c - 1] != 181 || z->p[z->c - 2] != 206) goto lab44;
+        if (!(find_among_b_44(z))) goto lab44;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (!(eq_s_b(z, 4, s_64))) goto lab44;
+        if (z->c > z->lb) goto lab44;
+        {   int ret = slice_from_s(z, 10, s_65);
+            if (ret < 0) return ret;
+        }
+    lab44:
+        z->c = z->l - m36;
+    }
+    {   int m37 = z->l - z->c; (void)m37;
+        {   int m38 = z->l - z->c; (void)m38;
+            z->ket = z->c;
+            if (!(eq_s_b(z, 10, s_66))) goto lab46;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            z->I[0] = 0;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 128 && z->p[z->c - 1] != 134) || z->p[z->c - 2] != 207) goto lab46;
+            if (!(find_among_hash_b(z, &a_45_table, &a_45_hash))) goto lab46;
+            if (z->c > z->lb) goto lab46;
+            {   int ret = slice_from_s(z, 8, s_67);
+                if (ret < 0) return ret;
+            }
+        lab46:
+            z->c = z->l - m38;
+        }
+        z->ket = z->c;
+        if (!(eq_s_b(z, 8, s_68))) goto lab45;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || !((a_46_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab45;
+        if (!(find_among_hash_b(z, &a_46_table, &a_46_hash))) goto lab45;
+        if (z->c > z->lb) goto lab45;
+        {   int ret = slice_from_s(z, 8, s_69);
+            if (ret < 0) return ret;
+        }
+    lab45:
+        z->c = z->l - m37;
+    }
+    {   int m39 = z->l - z->c; (void)m39;
+        {   int m40 = z->l - z->c; (void)m40;
+            z->ket = z->c;
+            if (z->c - 9 <= z->lb || !((a_47_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab48;
+            if (!(find_among_b_47(z))) goto lab48;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            z->I[0] = 0;
+        lab48:
+            z->c = z->l - m40;
+        }
+        z->ket = z->c;
+        if (z->c - 5 <= z->lb || !((a_50_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab47;
+        if (!(find_among_b_50(z))) goto lab47;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m41 = z->l - z->c; (void)m41;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 3 <= z->lb || !((a_48_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab50;
+            if (!(find_among_b_48(z))) goto lab50;
+            {   int ret = slice_from_s(z, 4, s_70);
+                if (ret < 0) return ret;
+            }
+            goto lab49;
+        lab50:
+            z->c = z->l - m41;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 1 <= z->lb || z->p[z->c - 1] != 184 || z->p[z->c - 2] != 206) goto lab47;
+            if (!(find_among_hash_b(z, &a_49_table, &a_49_hash))) goto lab47;
+            if (z->c > z->lb) goto lab47;
+            {   int ret = slice_from_s(z, 4, s_71);
+                if (ret < 0) return ret;
+            }
+        }
+    lab49:
+    lab47:
+        z->c = z->l - m39;
+    }
+    {   int m42 = z->l - z->c; (void)m42;
+        z->ket = z->c;
+        if (z->c - 7 <= z->lb || !((a_53_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab51;
+        if (!(find_among_b_53(z))) goto lab51;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m43 = z->l - z->c; (void)m43;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 3 <= z->lb || !((a_51_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab53;
+            if (!(find_among_b_51(z))) goto lab53;
+            {   int ret = slice_from_s(z, 6, s_72);
+                if (ret < 0) return ret;
+            }
+            goto lab52;
+        lab53:
+            z->c = z->l - m43;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 1 <= z->lb || !((a_52_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab51;
+            if (!(find_among_hash_b(z, &a_52_table, &a_52_hash))) goto lab51;
+            if (z->c > z->lb) goto lab51;
+            {   int ret = slice_from_s(z, 6, s_73);
+                if (ret < 0) return ret;
+            }
+        }
+    lab52:
+    lab51:
+        z->c = z->l - m42;
+    }
+    {   int m44 = z->l - z->c; (void)m44;
+        z->ket = z->c;
+        if (z->c - 5 <= z->lb || !((a_57_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab54;
+        if (!(find_among_b_57(z))) goto lab54;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] != 189 || z->p[z->c - 2] != 206) goto lab54;
+        if (!(find_among_hash_b(z, &a_58_table, &a_58_hash))) goto lab54;
+        if (z->c > z->lb) goto lab54;
+        {   int ret = slice_from_s(z, 4, s_74);
+            if (ret < 0) return ret;
+        }
+    lab54:
+        z->c = z->l - m44;
+    }
+    {   int m45 = z->l - z->c; (void)m45;
+        z->ket = z->c;
+        if (z->c - 5 <= z->lb || !((a_56_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab55;
+        if (!(find_among_b_56(z))) goto lab55;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m46 = z->l - z->c; (void)m46;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (!(eq_s_b(z, 8, s_75))) goto lab57;
+            {   int ret = slice_from_s(z, 4, s_76);
+                if (ret < 0) return ret;
+            }
+            goto lab56;
+        lab57:
+            z->c = z->l - m46;
+            {   int m47 = z->l - z->c; (void)m47;
+                z->ket = z->c;
+                z->bra = z->c;
+                if (z->c - 3 <= z->lb || !((a_54_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab59;
+                among_var = find_among_b_54(z);
+                if (!(among_var)) goto lab59;
+                switch (among_var) {
+                    case 1:
+                        {   int ret = slice_from_s(z, 4, s_77);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+                goto lab58;
+            lab59:
+                z->c = z->l - m47;
+                z->ket = z->c;
+                z->bra = z->c;
+                if (z->c - 1 <= z->lb || !((a_55_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab55;
+                if (!(find_among_hash_b(z, &a_55_table, &a_55_hash))) goto lab55;
+                if (z->c > z->lb) goto lab55;
+                {   int ret = slice_from_s(z, 4, s_78);
+                    if (ret < 0) return ret;
+                }
+            }
+        lab58:
+            ;
+        }
+    lab56:
+    lab55:
+        z->c = z->l - m45;
+    }
+    {   int m48 = z->l - z->c; (void)m48;
+        z->ket = z->c;
+        if (z->c - 7 <= z->lb || z->p[z->c - 1] != 181 || z->p[z->c - 2] != 206) goto lab60;
+        if (!(find_among_b_59(z))) goto lab60;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 3 <= z->lb || !((a_60_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab60;
+        if (!(find_among_hash_b(z, &a_60_table, &a_60_hash))) goto lab60;
+        if (z->c > z->lb) goto lab60;
+        {   int ret = slice_from_s(z, 6, s_79);
+            if (ret < 0) return ret;
+        }
+    lab60:
+        z->c = z->l - m48;
+    }
+    {   int m49 = z->l - z->c; (void)m49;
+        z->ket = z->c;
+        if (z->c - 7 <= z->lb || z->p[z->c - 1] != 181 || z->p[z->c - 2] != 206) goto lab61;
+        if (!(find_among_b_61(z))) goto lab61;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || !((a_62_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab61;
+        if (!(find_among_hash_b(z, &a_62_table, &a_62_hash))) goto lab61;
+        if (z->c > z->lb) goto lab61;
+        {   int ret = slice_from_s(z, 6, s_80);
+            if (ret < 0) return ret;
+        }
+    lab61:
+        z->c = z->l - m49;
+    }
+    {   int m50 = z->l - z->c; (void)m50;
+        z->ket = z->c;
+        if (z->c - 7 <= z->lb || z->p[z->c - 1] != 181 || z->p[z->c - 2] != 206) goto lab62;
+        if (!(find_among_b_63(z))) goto lab62;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || !((a_64_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab62;
+        if (!(find_among_hash_b(z, &a_64_table, &a_64_hash))) goto lab62;
+        if (z->c > z->lb) goto lab62;
+        {   int ret = slice_from_s(z, 6, s_81);
+            if (ret < 0) return ret;
+        }
+    lab62:
+        z->c = z->l - m50;
+    }
+    {   int m51 = z->l - z->c; (void)m51;
+        {   int m52 = z->l - z->c; (void)m52;
+            z->ket = z->c;
+            if (z->c - 7 <= z->lb || !((a_65_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab64;
+            if (!(find_among_b_65(z))) goto lab64;
+            z->bra = z->c;
+            {   int ret = slice_from_s(z, 4, s_82);
+                if (ret < 0) return ret;
+            }
+        lab64:
+            z->c = z->l - m52;
+        }
+        if (!(z->I[0])) goto lab63;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || !((a_66_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 206 && z->p[z->c - 2] != 207)) goto lab63;
+        if (!(find_among_b_66(z))) goto lab63;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab63:
+        z->c = z->l - m51;
+    }
+    {   int m53 = z->l - z->c; (void)m53;
+        z->ket = z->c;
+        if (z->c - 7 <= z->lb || (z->p[z->c - 1] != 129 && z->p[z->c - 1] != 132) || z->p[z->c - 2] != 207) goto lab65;
+        if (!(find_among_b_67(z))) goto lab65;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab65:
+        z->c = z->l - m53;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * greek_UTF_8_create_env(void) { return SN_create_env(0, 1); }
+
+extern void greek_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
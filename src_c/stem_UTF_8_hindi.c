@@ -0,0 +1,1499 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+static int r_CONSONANT(struct SN_env * z);
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int hindi_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * hindi_UTF_8_create_env(void);
+extern void hindi_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[132] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 12, 0, -1 },
+{ 0, 12, 0, -1 },
+{ 0, 12, 0, -1 },
+{ 0, 15, 3, -1 },
+{ 0, 15, 3, -1 },
+{ 0, 12, 0, -1 },
+{ 0, 15, 6, -1 },
+{ 0, 15, 6, -1 },
+{ 0, 9, 0, -1 },
+{ 0, 9, 0, -1 },
+{ 0, 9, 0, -1 },
+{ 0, 12, 11, -1 },
+{ 0, 12, 11, -1 },
+{ 0, 9, 0, -1 },
+{ 0, 12, 14, -1 },
+{ 0, 12, 14, -1 },
+{ 0, 6, 0, -1 },
+{ 0, 9, 17, -1 },
+{ 0, 9, 17, -1 },
+{ 0, 9, 17, -1 },
+{ 0, 6, 0, -1 },
+{ 0, 9, 21, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 12, 24, -1 },
+{ 0, 15, 25, -1 },
+{ 0, 15, 25, -1 },
+{ 0, 12, 24, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 9, 30, -1 },
+{ 0, 12, 31, -1 },
+{ 0, 12, 31, -1 },
+{ 0, 12, 31, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 9, 35, -1 },
+{ 0, 9, 35, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 9, 39, -1 },
+{ 0, 9, 39, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 12, 42, -1 },
+{ 0, 15, 43, -1 },
+{ 0, 15, 43, -1 },
+{ 0, 12, 42, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 9, 47, -1 },
+{ 0, 9, 47, -1 },
+{ 0, 9, 47, -1 },
+{ 0, 9, 47, -1 },
+{ 0, 12, 51, -1 },
+{ 0, 15, 52, -1 },
+{ 0, 12, 51, -1 },
+{ 0, 15, 54, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 9, 56, -1 },
+{ 0, 9, 56, -1 },
+{ 0, 9, 56, -1 },
+{ 0, 9, 56, -1 },
+{ 0, 12, 60, -1 },
+{ 0, 15, 61, -1 },
+{ 0, 12, 60, -1 },
+{ 0, 15, 63, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 12, 65, -1 },
+{ 0, 15, 66, -1 },
+{ 0, 15, 66, -1 },
+{ 0, 12, 65, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 12, 74, -1 },
+{ 0, 12, 74, -1 },
+{ 0, 15, 76, -1 },
+{ 0, 15, 76, -1 },
+{ 0, 9, 74, -1 },
+{ 0, 9, 74, -1 },
+{ 0, 12, 80, -1 },
+{ 0, 12, 80, -1 },
+{ 0, 6, 74, -1 },
+{ 0, 9, 83, -1 },
+{ 0, 9, 83, -1 },
+{ 0, 9, 83, -1 },
+{ 0, 6, 74, -1 },
+{ 0, 9, 87, -1 },
+{ 0, 9, 87, -1 },
+{ 0, 9, 87, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 6, 91, -1 },
+{ 0, 6, 91, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 6, 98, -1 },
+{ 0, 6, 98, -1 },
+{ 0, 9, 100, -1 },
+{ 0, 9, 100, -1 },
+{ 0, 6, 98, -1 },
+{ 0, 6, 98, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 6, 105, -1 },
+{ 0, 6, 105, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 9, 108, -1 },
+{ 0, 9, 108, -1 },
+{ 0, 9, 108, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 12, 112, -1 },
+{ 0, 12, 112, -1 },
+{ 0, 15, 114, -1 },
+{ 0, 15, 114, -1 },
+{ 0, 9, 112, -1 },
+{ 0, 9, 112, -1 },
+{ 0, 12, 118, -1 },
+{ 0, 12, 118, -1 },
+{ 0, 6, 112, -1 },
+{ 0, 9, 121, -1 },
+{ 0, 9, 121, -1 },
+{ 0, 9, 121, -1 },
+{ 0, 6, 112, -1 },
+{ 0, 9, 125, -1 },
+{ 0, 9, 125, -1 },
+{ 0, 9, 125, -1 },
+{ 0, 9, 112, -1 },
+{ 0, 9, 112, -1 },
+{ 0, 3, -1, -1 }
+};
+
+static int (* const a_0_functions[132])(struct SN_env *) = {
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0
+};
+
+static const unsigned char g_consonant_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_consonant[] = { 255, 255, 255, 255, 159, 0, 0, 0, 248, 7 };
+
+
+static const unsigned char a_0_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xE7, 0xAF, 0x8, 0x0, 0x0, 0x0, 0x1, 0xC0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xA5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x97:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x82:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                if (n <= 9) break;
+                                switch (q[-10]) {
+                                    case 0x82:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA5) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 1;
+                                        break;
+                                    case 0x87:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA5) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 2;
+                                        break;
+                                    case 0x8A:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 3;
+                                        if (n <= 12) break;
+                                        switch (q[-13]) {
+                                            case 0x86:
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 4;
+                                                break;
+                                            case 0xBE:
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 5;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x8F:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 6;
+                                        if (n <= 12) break;
+                                        switch (q[-13]) {
+                                            case 0x86:
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 7;
+                                                break;
+                                            case 0xBE:
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 8;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 0x87:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 9;
+                                break;
+                            case 0x8B:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 10;
+                                break;
+                            case 0x8F:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 11;
+                                if (n <= 9) break;
+                                switch (q[-10]) {
+                                    case 0x86:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 12;
+                                        break;
+                                    case 0xBE:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 13;
+                                        break;
+                                }
+                                break;
+                            case 0x93:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 14;
+                                if (n <= 9) break;
+                                switch (q[-10]) {
+                                    case 0x86:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 15;
+                                        break;
+                                    case 0xBE:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 16;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0xA4:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 17;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x85:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 18;
+                                break;
+                            case 0x86:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 19;
+                                break;
+                            case 0xBE:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 20;
+                                break;
+                        }
+                        break;
+                    case 0xA8:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 21;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x85) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xA4) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        i = 22;
+                        break;
+                }
+                break;
+            case 0x81:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0xA4:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xE0) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x86:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xA4) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                i = 23;
+                                break;
+                            case 0xBE:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xA4) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                i = 24;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xAF) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                if (n <= 9) break;
+                                switch (q[-10]) {
+                                    case 0x87:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 25;
+                                        if (n <= 12) break;
+                                        switch (q[-13]) {
+                                            case 0x86:
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 26;
+                                                break;
+                                            case 0xBE:
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 27;
+                                                break;
+                                        }
+                                        break;
+                                    case 0xBF:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 28;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0xA5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xE0) break;
+                        i = 29;
+                        break;
+                }
+                break;
+            case 0x82:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0xA4:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xE0) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x80:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xA5) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                i = 30;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xA4) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 31;
+                                if (n <= 9) break;
+                                switch (q[-10]) {
+                                    case 0x85:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 32;
+                                        break;
+                                    case 0x86:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 33;
+                                        break;
+                                    case 0xBE:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 34;
+                                        break;
+                                }
+                                break;
+                            case 0x86:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xA4) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                i = 35;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x81:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA5) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 36;
+                                        break;
+                                    case 0x89:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA4) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 37;
+                                        break;
+                                }
+                                break;
+                            case 0x87:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xA5) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                i = 38;
+                                break;
+                            case 0x88:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xA4) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                i = 39;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x86:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA4) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 40;
+                                        break;
+                                    case 0xBE:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA4) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 41;
+                                        break;
+                                }
+                                break;
+                            case 0x8B:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xA5) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                i = 42;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xAF) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                if (n <= 9) break;
+                                switch (q[-10]) {
+                                    case 0x87:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 43;
+                                        if (n <= 12) break;
+                                        switch (q[-13]) {
+                                            case 0x86:
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 44;
+                                                break;
+                                            case 0xBE:
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 45;
+                                                break;
+                                        }
+                                        break;
+                                    case 0xBF:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 46;
+                                        break;
+                                }
+                                break;
+                            case 0x8F:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xA4) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                i = 47;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x81:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA5) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 48;
+                                        break;
+                                    case 0x86:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA4) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 49;
+                                        break;
+                                    case 0x89:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA4) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 50;
+                                        break;
+                                    case 0xBE:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA4) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 51;
+                                        if (n <= 9) break;
+                                        switch (q[-10]) {
+                                            case 0xA4:
+                                                if (n <= 10) break;
+                                                if (q[-11] != 0xA4) break;
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xE0) break;
+                                                i = 52;
+                                                if (n <= 12) break;
+                                                if (q[-13] != 0x85) break;
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 53;
+                                                break;
+                                            case 0xA8:
+                                                if (n <= 10) break;
+                                                if (q[-11] != 0xA4) break;
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xE0) break;
+                                                i = 54;
+                                                if (n <= 12) break;
+                                                if (q[-13] != 0x85) break;
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 55;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 0x93:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xA4) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                i = 56;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x81:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA5) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 57;
+                                        break;
+                                    case 0x86:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA4) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 58;
+                                        break;
+                                    case 0x89:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA4) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 59;
+                                        break;
+                                    case 0xBE:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA4) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 60;
+                                        if (n <= 9) break;
+                                        switch (q[-10]) {
+                                            case 0xA4:
+                                                if (n <= 10) break;
+                                                if (q[-11] != 0xA4) break;
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xE0) break;
+                                                i = 61;
+                                                if (n <= 12) break;
+                                                if (q[-13] != 0x85) break;
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 62;
+                                                break;
+                                            case 0xA8:
+                                                if (n <= 10) break;
+                                                if (q[-11] != 0xA4) break;
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xE0) break;
+                                                i = 63;
+                                                if (n <= 12) break;
+                                                if (q[-13] != 0x85) break;
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 64;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 0xBE:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xA4) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                i = 65;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xAF) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                if (n <= 9) break;
+                                switch (q[-10]) {
+                                    case 0x87:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 66;
+                                        if (n <= 12) break;
+                                        switch (q[-13]) {
+                                            case 0x86:
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 67;
+                                                break;
+                                            case 0xBE:
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 68;
+                                                break;
+                                        }
+                                        break;
+                                    case 0xBF:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 69;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0xA5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xE0) break;
+                        i = 70;
+                        break;
+                }
+                break;
+            case 0x85:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 71;
+                break;
+            case 0x86:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 72;
+                break;
+            case 0x87:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0xA4:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xE0) break;
+                        i = 73;
+                        break;
+                    case 0xA5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xE0) break;
+                        i = 74;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x97:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xA4) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x82:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA4) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        if (n <= 9) break;
+                                        switch (q[-10]) {
+                                            case 0x87:
+                                                if (n <= 10) break;
+                                                if (q[-11] != 0xA5) break;
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xE0) break;
+                                                i = 75;
+                                                break;
+                                            case 0x8F:
+                                                if (n <= 10) break;
+                                                if (q[-11] != 0xA4) break;
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xE0) break;
+                                                i = 76;
+                                                if (n <= 12) break;
+                                                switch (q[-13]) {
+                                                    case 0x86:
+                                                        if (n <= 13) break;
+                                                        if (q[-14] != 0xA4) break;
+                                                        if (n <= 14) break;
+                                                        if (q[-15] != 0xE0) break;
+                                                        i = 77;
+                                                        break;
+                                                    case 0xBE:
+                                                        if (n <= 13) break;
+                                                        if (q[-14] != 0xA4) break;
+                                                        if (n <= 14) break;
+                                                        if (q[-15] != 0xE0) break;
+                                                        i = 78;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 0x8B:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA5) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 79;
+                                        break;
+                                    case 0x93:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA4) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 80;
+                                        if (n <= 9) break;
+                                        switch (q[-10]) {
+                                            case 0x86:
+                                                if (n <= 10) break;
+                                                if (q[-11] != 0xA4) break;
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xE0) break;
+                                                i = 81;
+                                                break;
+                                            case 0xBE:
+                                                if (n <= 10) break;
+                                                if (q[-11] != 0xA4) break;
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xE0) break;
+                                                i = 82;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 0xA4:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xA4) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                i = 83;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x85:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA4) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 84;
+                                        break;
+                                    case 0x86:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA4) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 85;
+                                        break;
+                                    case 0xBE:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA4) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 86;
+                                        break;
+                                }
+                                break;
+                            case 0xA8:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xA4) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                i = 87;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x85:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA4) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 88;
+                                        break;
+                                    case 0x86:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA4) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 89;
+                                        break;
+                                    case 0xBE:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xA4) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 90;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x88:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 91;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x86:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 92;
+                        break;
+                    case 0xBE:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 93;
+                        break;
+                }
+                break;
+            case 0x89:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 94;
+                break;
+            case 0x8A:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 95;
+                break;
+            case 0x8B:
+                if (n <= 1) break;
+                if (q[-2] != 0xA5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 96;
+                break;
+            case 0x8D:
+                if (n <= 1) break;
+                if (q[-2] != 0xA5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 97;
+                break;
+            case 0x8F:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 98;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x86:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 99;
+                        break;
+                    case 0x87:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 100;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x86:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 101;
+                                break;
+                            case 0xBE:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 102;
+                                break;
+                        }
+                        break;
+                    case 0xBE:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 103;
+                        break;
+                    case 0xBF:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 104;
+                        break;
+                }
+                break;
+            case 0x93:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 105;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x86:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 106;
+                        break;
+                    case 0xBE:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 107;
+                        break;
+                }
+                break;
+            case 0xB0:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x95) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xA4) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xE0) break;
+                i = 108;
+                if (n <= 6) break;
+                switch (q[-7]) {
+                    case 0x85:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xA4) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        i = 109;
+                        break;
+                    case 0x86:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xA4) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        i = 110;
+                        break;
+                    case 0xBE:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xA4) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        i = 111;
+                        break;
+                }
+                break;
+            case 0xBE:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 112;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x97:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x82:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                if (n <= 9) break;
+                                switch (q[-10]) {
+                                    case 0x82:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA5) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 113;
+                                        break;
+                                    case 0x8A:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 114;
+                                        if (n <= 12) break;
+                                        switch (q[-13]) {
+                                            case 0x86:
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 115;
+                                                break;
+                                            case 0xBE:
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 116;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 0x87:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 117;
+                                break;
+                            case 0x8F:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 118;
+                                if (n <= 9) break;
+                                switch (q[-10]) {
+                                    case 0x86:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 119;
+                                        break;
+                                    case 0xBE:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 120;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0xA4:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 121;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x85:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 122;
+                                break;
+                            case 0x86:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 123;
+                                break;
+                            case 0xBE:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 124;
+                                break;
+                        }
+                        break;
+                    case 0xA8:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 125;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x85:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 126;
+                                break;
+                            case 0x86:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 127;
+                                break;
+                            case 0xBE:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 128;
+                                break;
+                        }
+                        break;
+                    case 0xAF:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x86:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 129;
+                                break;
+                            case 0xBE:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 130;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 131;
+                break;
+        }
+    } while (0);
+    while (i >= 0) {
+        const struct among * w = a_0 + i;
+        z->c = c - w->s_size;
+        if (a_0_functions[i] == 0) return w->result;
+        {   int res = a_0_functions[i](z);
+            z->c = c - w->s_size;
+            if (res) return w->result;
+        }
+        i = w->substring_i;
+    }
+    return 0;
+}
+
+static int r_CONSONANT(struct SN_env * z) {
+    if (in_class_b_U(z, g_consonant_class, g_consonant, 2325, 2399, 0)) return 0;
+    return 1;
+}
+
+extern int hindi_UTF_8_stem(struct SN_env * z) {
+    {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+        if (ret < 0) return 0;
+        z->c = ret;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    z->ket = z->c;
+    if (z->c - 2 <= z->lb || !((a_0_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 164 && z->p[z->c - 2] != 165)) return 0;
+    if (!(find_among_b_0(z))) return 0;
+    z->bra = z->c;
+    {   int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * hindi_UTF_8_create_env(void) { return SN_create_env(0, 0); }
+
+extern void hindi_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
@@ -0,0 +1,1728 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int hungarian_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+static int r_double(struct SN_env * z);
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * hungarian_UTF_8_create_env(void);
+extern void hungarian_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[8] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 }
+};
+
+
+static const struct among a_1[2] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 2 }
+};
+
+
+static const struct among a_2[23] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 }
+};
+
+
+static const struct among a_3[2] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_4[44] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 2, 19, -1 },
+{ 0, 3, 20, -1 },
+{ 0, 2, 19, -1 },
+{ 0, 3, 22, -1 },
+{ 0, 7, 22, -1 },
+{ 0, 2, 19, -1 },
+{ 0, 3, 19, -1 },
+{ 0, 5, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 2, 29, -1 },
+{ 0, 2, 29, -1 },
+{ 0, 5, 29, -1 },
+{ 0, 7, 32, -1 },
+{ 0, 7, 32, -1 },
+{ 0, 7, 32, -1 },
+{ 0, 2, 29, -1 },
+{ 0, 4, 29, -1 },
+{ 0, 3, 29, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_5[3] =
+{
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 8, -1, 2 }
+};
+
+
+static const struct among a_6[6] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 5, 0, 1 },
+{ 0, 6, 0, 2 },
+{ 0, 5, -1, 1 },
+{ 0, 6, 3, 1 },
+{ 0, 7, 3, 3 }
+};
+
+
+static const struct among a_7[2] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_8[7] =
+{
+{ 0, 1, -1, 3 },
+{ 0, 2, 0, 3 },
+{ 0, 2, 0, 3 },
+{ 0, 2, 0, 3 },
+{ 0, 3, 0, 1 },
+{ 0, 3, 0, 2 },
+{ 0, 3, 0, 3 }
+};
+
+
+static const struct among a_9[12] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 5, 0, 3 },
+{ 0, 5, 0, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 3, 1 },
+{ 0, 4, 4, 1 },
+{ 0, 4, 4, 1 },
+{ 0, 4, 4, 1 },
+{ 0, 5, 4, 3 },
+{ 0, 5, 4, 2 },
+{ 0, 5, 4, 1 },
+{ 0, 4, 3, 2 }
+};
+
+
+static const struct among a_10[31] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 2, 0, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 2, 1 },
+{ 0, 2, 2, 1 },
+{ 0, 2, 2, 1 },
+{ 0, 3, 2, 2 },
+{ 0, 3, 2, 3 },
+{ 0, 3, 2, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 9, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 11, 1 },
+{ 0, 4, 11, 2 },
+{ 0, 4, 11, 3 },
+{ 0, 4, 11, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 16, 1 },
+{ 0, 5, 17, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 19, 1 },
+{ 0, 6, 20, 3 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 22, 1 },
+{ 0, 2, 22, 1 },
+{ 0, 2, 22, 1 },
+{ 0, 3, 22, 2 },
+{ 0, 3, 22, 3 },
+{ 0, 1, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 3 }
+};
+
+
+static const struct among a_11[42] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 3, 0, 1 },
+{ 0, 4, 1, 1 },
+{ 0, 3, 0, 1 },
+{ 0, 4, 3, 1 },
+{ 0, 4, 0, 2 },
+{ 0, 4, 0, 3 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 7, 1 },
+{ 0, 3, 8, 1 },
+{ 0, 2, 7, 1 },
+{ 0, 3, 10, 1 },
+{ 0, 3, 7, 2 },
+{ 0, 3, 7, 3 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 14, 1 },
+{ 0, 6, 15, 1 },
+{ 0, 6, 14, 3 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 18, 1 },
+{ 0, 4, 19, 1 },
+{ 0, 3, 18, 1 },
+{ 0, 4, 21, 1 },
+{ 0, 4, 18, 2 },
+{ 0, 4, 18, 3 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 25, 1 },
+{ 0, 5, 26, 1 },
+{ 0, 4, 25, 1 },
+{ 0, 5, 28, 1 },
+{ 0, 5, 25, 2 },
+{ 0, 5, 25, 3 },
+{ 0, 5, -1, 1 },
+{ 0, 6, 32, 1 },
+{ 0, 6, -1, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 35, 1 },
+{ 0, 4, 36, 1 },
+{ 0, 3, 35, 1 },
+{ 0, 4, 38, 1 },
+{ 0, 4, 35, 2 },
+{ 0, 4, 35, 3 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v[] = { 17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 17, 36, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1 };
+
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'b':
+                if (n <= 1) break;
+                if (q[-2] != 'b') break;
+                i = 0;
+                break;
+            case 'c':
+                if (n <= 1) break;
+                if (q[-2] != 'c') break;
+                i = 1;
+                break;
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'd') break;
+                i = 2;
+                break;
+            case 'f':
+                if (n <= 1) break;
+                if (q[-2] != 'f') break;
+                i = 3;
+                break;
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'g') break;
+                i = 4;
+                break;
+            case 'j':
+                if (n <= 1) break;
+                if (q[-2] != 'j') break;
+                i = 5;
+                break;
+            case 'k':
+                if (n <= 1) break;
+                if (q[-2] != 'k') break;
+                i = 6;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'l') break;
+                i = 7;
+                break;
+            case 'm':
+                if (n <= 1) break;
+                if (q[-2] != 'm') break;
+                i = 8;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                i = 9;
+                break;
+            case 'p':
+                if (n <= 1) break;
+                if (q[-2] != 'p') break;
+                i = 10;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'r') break;
+                i = 11;
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'c') break;
+                        i = 12;
+                        break;
+                    case 's':
+                        i = 13;
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 'z') break;
+                        i = 14;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 't') break;
+                i = 15;
+                break;
+            case 'v':
+                if (n <= 1) break;
+                if (q[-2] != 'v') break;
+                i = 16;
+                break;
+            case 'y':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'g':
+                        if (n <= 2) break;
+                        if (q[-3] != 'g') break;
+                        i = 17;
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'l') break;
+                        i = 18;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        i = 19;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        i = 20;
+                        break;
+                }
+                break;
+            case 'z':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        i = 21;
+                        break;
+                    case 'z':
+                        i = 22;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const unsigned char g_v_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 64, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+
+static int find_among_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 'c':
+                if (n <= 1) break;
+                if (q[1] != 's') break;
+                i = 0;
+                break;
+            case 'd':
+                if (n <= 1) break;
+                if (q[1] != 'z') break;
+                if (n <= 2) break;
+                if (q[2] != 's') break;
+                i = 1;
+                break;
+            case 'g':
+                if (n <= 1) break;
+                if (q[1] != 'y') break;
+                i = 2;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[1] != 'y') break;
+                i = 3;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[1] != 'y') break;
+                i = 4;
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[1] != 'z') break;
+                i = 5;
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[1] != 'y') break;
+                i = 6;
+                break;
+            case 'z':
+                if (n <= 1) break;
+                if (q[1] != 's') break;
+                i = 7;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_0[i].s_size;
+    return a_0[i].result;
+}
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'l') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'a':
+                i = 0;
+                break;
+            case 'e':
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+
+static const unsigned char a_4_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xA2, 0x58, 0x15, 0x4,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'b':
+                        i = 0;
+                        break;
+                    case 'r':
+                        i = 1;
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'b':
+                        i = 2;
+                        break;
+                    case 'r':
+                        i = 3;
+                        break;
+                }
+                break;
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 4;
+                break;
+            case 'k':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        i = 5;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        i = 6;
+                        break;
+                }
+                break;
+            case 'l':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'v') break;
+                        i = 7;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'v') break;
+                        i = 8;
+                        break;
+                    case 'u':
+                        i = 9;
+                        break;
+                    case 0x91:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC5) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'b':
+                                i = 10;
+                                break;
+                            case 'r':
+                                i = 11;
+                                break;
+                            case 't':
+                                i = 12;
+                                break;
+                        }
+                        break;
+                    case 0xA1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'n') break;
+                        i = 13;
+                        break;
+                    case 0xA9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'n') break;
+                        i = 14;
+                        break;
+                    case 0xB3:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'b':
+                                i = 15;
+                                break;
+                            case 'r':
+                                i = 16;
+                                break;
+                            case 't':
+                                i = 17;
+                                break;
+                        }
+                        break;
+                    case 0xBC:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 18;
+                        break;
+                }
+                break;
+            case 'n':
+                i = 19;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 20;
+                        if (n <= 2) break;
+                        if (q[-3] != 'b') break;
+                        i = 21;
+                        break;
+                    case 'e':
+                        i = 22;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'b':
+                                i = 23;
+                                break;
+                            case 'p':
+                                if (n <= 3) break;
+                                if (q[-4] != 'p') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0xA9) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'k') break;
+                                i = 24;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        i = 25;
+                        break;
+                    case 0xB6:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 26;
+                        break;
+                }
+                break;
+            case 'p':
+                if (n <= 1) break;
+                if (q[-2] != 'p') break;
+                if (n <= 2) break;
+                if (q[-3] != 0xA9) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xC3) break;
+                if (n <= 4) break;
+                if (q[-5] != 'k') break;
+                i = 27;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                if (n <= 2) break;
+                if (q[-3] != 'k') break;
+                i = 28;
+                break;
+            case 't':
+                i = 29;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 30;
+                        break;
+                    case 'e':
+                        i = 31;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 0xA9) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0xC3) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'k') break;
+                        i = 32;
+                        if (n <= 5) break;
+                        if (q[-6] != 'n') break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 'a':
+                                i = 33;
+                                break;
+                            case 'e':
+                                i = 34;
+                                break;
+                            case 'o':
+                                i = 35;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        i = 36;
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 0xA9) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0xC3) break;
+                        i = 37;
+                        break;
+                    case 0xB6:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 38;
+                        break;
+                }
+                break;
+            case 'z':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'h') break;
+                        i = 39;
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        if (q[-3] != 'h') break;
+                        i = 40;
+                        break;
+                    case 0xB6:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'h') break;
+                        i = 41;
+                        break;
+                }
+                break;
+            case 0xA1:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                if (n <= 2) break;
+                if (q[-3] != 'v') break;
+                i = 42;
+                break;
+            case 0xA9:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                if (n <= 2) break;
+                if (q[-3] != 'v') break;
+                i = 43;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0xA1:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                i = 0;
+                break;
+            case 0xA9:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+static const symbol s_0[] = { 'a' };
+static const symbol s_1[] = { 'e' };
+
+static const unsigned char a_5_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0xA1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 0;
+                        break;
+                    case 0xA9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 1;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                if (q[-3] != 0xA9) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xC3) break;
+                if (n <= 4) break;
+                if (q[-5] != 'k') break;
+                if (n <= 5) break;
+                if (q[-6] != 'n') break;
+                if (n <= 6) break;
+                if (q[-7] != 0xA1) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xC3) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+static const symbol s_2[] = { 'e' };
+static const symbol s_3[] = { 'a' };
+
+static int find_among_b_6(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'l') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'u':
+                if (n <= 2) break;
+                if (q[-3] != 't') break;
+                if (n <= 3) break;
+                if (q[-4] != 's') break;
+                i = 0;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 'a':
+                        i = 1;
+                        break;
+                    case 0xA1:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xC3) break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0xBC:
+                if (n <= 2) break;
+                if (q[-3] != 0xC3) break;
+                if (n <= 3) break;
+                if (q[-4] != 't') break;
+                if (n <= 4) break;
+                if (q[-5] != 's') break;
+                i = 3;
+                if (n <= 5) break;
+                switch (q[-6]) {
+                    case 'e':
+                        i = 4;
+                        break;
+                    case 0xA9:
+                        if (n <= 6) break;
+                        if (q[-7] != 0xC3) break;
+                        i = 5;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_6[i].s_size;
+    return a_6[i].result;
+}
+static const symbol s_4[] = { 'a' };
+static const symbol s_5[] = { 'e' };
+
+static int find_among_b_7(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0xA1:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                i = 0;
+                break;
+            case 0xA9:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_7[i].s_size;
+    return a_7[i].result;
+}
+
+static int find_among_b_9(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'i':
+                if (n <= 1) break;
+                if (q[-2] != 0xA9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xC3) break;
+                i = 0;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0xA1:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xC3) break;
+                        i = 1;
+                        break;
+                    case 0xA9:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xC3) break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0xA9:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                i = 3;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'k':
+                        i = 4;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 5;
+                                break;
+                            case 'e':
+                                i = 6;
+                                break;
+                            case 'o':
+                                i = 7;
+                                break;
+                            case 0xA1:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xC3) break;
+                                i = 8;
+                                break;
+                            case 0xA9:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xC3) break;
+                                i = 9;
+                                break;
+                            case 0xB6:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xC3) break;
+                                i = 10;
+                                break;
+                        }
+                        break;
+                    case 0xA9:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xC3) break;
+                        i = 11;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_9[i].s_size;
+    return a_9[i].result;
+}
+static const symbol s_6[] = { 'e' };
+static const symbol s_7[] = { 'a' };
+
+static const unsigned char a_10_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x32, 0xA8, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_10(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                i = 0;
+                if (n <= 1) break;
+                if (q[-2] != 'j') break;
+                i = 1;
+                break;
+            case 'd':
+                i = 2;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 3;
+                        break;
+                    case 'e':
+                        i = 4;
+                        break;
+                    case 'o':
+                        i = 5;
+                        break;
+                    case 0xA1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 6;
+                        break;
+                    case 0xA9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 7;
+                        break;
+                    case 0xB6:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 8;
+                        break;
+                }
+                break;
+            case 'e':
+                i = 9;
+                if (n <= 1) break;
+                if (q[-2] != 'j') break;
+                i = 10;
+                break;
+            case 'k':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'n':
+                        i = 11;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'u':
+                                i = 12;
+                                break;
+                            case 0xA1:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 13;
+                                break;
+                            case 0xA9:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 14;
+                                break;
+                            case 0xBC:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 15;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        i = 16;
+                        if (n <= 2) break;
+                        if (q[-3] != 'j') break;
+                        i = 17;
+                        if (n <= 3) break;
+                        if (q[-4] != 0xA1) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xC3) break;
+                        i = 18;
+                        break;
+                    case 0xBC:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 19;
+                        if (n <= 3) break;
+                        if (q[-4] != 'j') break;
+                        i = 20;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA9) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xC3) break;
+                        i = 21;
+                        break;
+                }
+                break;
+            case 'm':
+                i = 22;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 23;
+                        break;
+                    case 'e':
+                        i = 24;
+                        break;
+                    case 'o':
+                        i = 25;
+                        break;
+                    case 0xA1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 26;
+                        break;
+                    case 0xA9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 27;
+                        break;
+                }
+                break;
+            case 'o':
+                i = 28;
+                break;
+            case 0xA1:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                i = 29;
+                break;
+            case 0xA9:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                i = 30;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_10[i].s_size;
+    return a_10[i].result;
+}
+static const symbol s_8[] = { 'a' };
+static const symbol s_9[] = { 'e' };
+
+static int find_among_b_11(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 0;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'a':
+                        i = 1;
+                        if (n <= 3) break;
+                        if (q[-4] != 'j') break;
+                        i = 2;
+                        break;
+                    case 'e':
+                        i = 3;
+                        if (n <= 3) break;
+                        if (q[-4] != 'j') break;
+                        i = 4;
+                        break;
+                    case 0xA1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xC3) break;
+                        i = 5;
+                        break;
+                    case 0xA9:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xC3) break;
+                        i = 6;
+                        break;
+                }
+                break;
+            case 'i':
+                i = 7;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 8;
+                        if (n <= 2) break;
+                        if (q[-3] != 'j') break;
+                        i = 9;
+                        break;
+                    case 'e':
+                        i = 10;
+                        if (n <= 2) break;
+                        if (q[-3] != 'j') break;
+                        i = 11;
+                        break;
+                    case 0xA1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 12;
+                        break;
+                    case 0xA9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        i = 13;
+                        break;
+                }
+                break;
+            case 'k':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 14;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'e':
+                                i = 15;
+                                if (n <= 5) break;
+                                if (q[-6] != 'j') break;
+                                i = 16;
+                                break;
+                            case 0xA9:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                i = 17;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        i = 18;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 19;
+                                if (n <= 3) break;
+                                if (q[-4] != 'j') break;
+                                i = 20;
+                                break;
+                            case 'e':
+                                i = 21;
+                                if (n <= 3) break;
+                                if (q[-4] != 'j') break;
+                                i = 22;
+                                break;
+                            case 0xA1:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 23;
+                                break;
+                            case 0xA9:
+                                if (n <= 3) break;
+                                if (q[-4] != 0xC3) break;
+                                i = 24;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 25;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 26;
+                                if (n <= 4) break;
+                                if (q[-5] != 'j') break;
+                                i = 27;
+                                break;
+                            case 'e':
+                                i = 28;
+                                if (n <= 4) break;
+                                if (q[-5] != 'j') break;
+                                i = 29;
+                                break;
+                            case 0xA1:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xC3) break;
+                                i = 30;
+                                break;
+                            case 0xA9:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xC3) break;
+                                i = 31;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 32;
+                                if (n <= 5) break;
+                                if (q[-6] != 'j') break;
+                                i = 33;
+                                break;
+                            case 0xA1:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xC3) break;
+                                i = 34;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'm':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 35;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'a':
+                        i = 36;
+                        if (n <= 3) break;
+                        if (q[-4] != 'j') break;
+                        i = 37;
+                        break;
+                    case 'e':
+                        i = 38;
+                        if (n <= 3) break;
+                        if (q[-4] != 'j') break;
+                        i = 39;
+                        break;
+                    case 0xA1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xC3) break;
+                        i = 40;
+                        break;
+                    case 0xA9:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xC3) break;
+                        i = 41;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_11[i].s_size;
+    return a_11[i].result;
+}
+static const symbol s_10[] = { 'a' };
+static const symbol s_11[] = { 'e' };
+
+static int find_among_b_8(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'k') break;
+        i = 0;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'a':
+                i = 1;
+                break;
+            case 'e':
+                i = 2;
+                break;
+            case 'o':
+                i = 3;
+                break;
+            case 0xA1:
+                if (n <= 2) break;
+                if (q[-3] != 0xC3) break;
+                i = 4;
+                break;
+            case 0xA9:
+                if (n <= 2) break;
+                if (q[-3] != 0xC3) break;
+                i = 5;
+                break;
+            case 0xB6:
+                if (n <= 2) break;
+                if (q[-3] != 0xC3) break;
+                i = 6;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_8[i].s_size;
+    return a_8[i].result;
+}
+static const symbol s_12[] = { 'a' };
+static const symbol s_13[] = { 'e' };
+
+static int r_double(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((106790108 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((73235676 >> (z->p[z->c - 2] & 0x1f)) & 1)) return 0;
+        if (!(find_among_b_2(z))) return 0;
+        z->c = z->l - m_test1;
+    }
+    return 1;
+}
+
+extern int hungarian_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    {   int c1 = z->c;
+        z->I[0] = z->l;
+        {   int c2 = z->c;
+            if (in_class_U(z, g_v_class, g_v, 97, 369, 0)) goto lab2;
+            if (in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 369) < 0) goto lab2;
+            {   int c3 = z->c;
+                if (z->c + 1 >= z->l || z->p[z->c + 1] >> 5 != 3 || !((101187584 >> (z->p[z->c + 1] & 0x1f)) & 1)) goto lab4;
+                if (!(find_among_0(z))) goto lab4;
+                goto lab3;
+            lab4:
+                z->c = c3;
+                {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                    if (ret < 0) goto lab2;
+                    z->c = ret;
+                }
+            }
+        lab3:
+            z->I[0] = z->c;
+            goto lab1;
+        lab2:
+            z->c = c2;
+            if (out_class_U(z, g_v_class, g_v, 97, 369, 0)) goto lab0;
+            {   
+                int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 369);
+                if (ret < 0) goto lab0;
+                z->c += ret;
+            }
+            z->I[0] = z->c;
+        }
+    lab1:
+    lab0:
+        z->c = c1;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m4 = z->l - z->c; (void)m4;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] != 108 || (z->p[z->c - 2] != 97 && z->p[z->c - 2] != 101)) goto lab5;
+        if (!(find_among_b_3(z))) goto lab5;
+        z->bra = z->c;
+        if (!(z->I[0] <= z->c)) goto lab5;
+        {   int ret = r_double(z);
+            if (ret == 0) goto lab5;
+            if (ret < 0) return ret;
+        }
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+            if (ret < 0) goto lab5;
+            z->c = ret;
+        }
+        z->ket = z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 1);
+            if (ret < 0) goto lab5;
+            z->c = ret;
+        }
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab5:
+        z->c = z->l - m4;
+    }
+    {   int m5 = z->l - z->c; (void)m5;
+        z->ket = z->c;
+        if (z->c <= z->lb || !((a_4_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1)) goto lab6;
+        if (!(find_among_b_4(z))) goto lab6;
+        z->bra = z->c;
+        if (!(z->I[0] <= z->c)) goto lab6;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 161 && z->p[z->c - 1] != 169) || z->p[z->c - 2] != 195) goto lab6;
+        among_var = find_among_b_1(z);
+        if (!(among_var)) goto lab6;
+        z->bra = z->c;
+        if (!(z->I[0] <= z->c)) goto lab6;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 1, s_0);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 1, s_1);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab6:
+        z->c = z->l - m5;
+    }
+    {   int m6 = z->l - z->c; (void)m6;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb || (z->p[z->c - 1] != 110 && z->p[z->c - 1] != 116) || !((a_5_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) goto lab7;
+        among_var = find_among_b_5(z);
+        if (!(among_var)) goto lab7;
+        z->bra = z->c;
+        if (!(z->I[0] <= z->c)) goto lab7;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 1, s_2);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 1, s_3);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab7:
+        z->c = z->l - m6;
+    }
+    {   int m7 = z->l - z->c; (void)m7;
+        z->ket = z->c;
+        if (z->c - 3 <= z->lb || z->p[z->c - 1] != 108 || (z->p[z->c - 2] != 117 && z->p[z->c - 2] != 188)) goto lab8;
+        among_var = find_among_b_6(z);
+        if (!(among_var)) goto lab8;
+        z->bra = z->c;
+        if (!(z->I[0] <= z->c)) goto lab8;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 1, s_4);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 1, s_5);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab8:
+        z->c = z->l - m7;
+    }
+    {   int m8 = z->l - z->c; (void)m8;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 161 && z->p[z->c - 1] != 169) || z->p[z->c - 2] != 195) goto lab9;
+        if (!(find_among_b_7(z))) goto lab9;
+        z->bra = z->c;
+        if (!(z->I[0] <= z->c)) goto lab9;
+        {   int ret = r_double(z);
+            if (ret == 0) goto lab9;
+            if (ret < 0) return ret;
+        }
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+            if (ret < 0) goto lab9;
+            z->c = ret;
+        }
+        z->ket = z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 1);
+            if (ret < 0) goto lab9;
+            z->c = ret;
+        }
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab9:
+        z->c = z->l - m8;
+    }
+    {   int m9 = z->l - z->c; (void)m9;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 105 && z->p[z->c - 1] != 169) || (z->p[z->c - 2] != 169 && z->p[z->c - 2] != 195)) goto lab10;
+        among_var = find_among_b_9(z);
+        if (!(among_var)) goto lab10;
+        z->bra = z->c;
+        if (!(z->I[0] <= z->c)) goto lab10;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 1, s_6);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 1, s_7);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab10:
+        z->c = z->l - m9;
+    }
+    {   int m10 = z->l - z->c; (void)m10;
+        z->ket = z->c;
+        if (z->c <= z->lb || !((a_10_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1)) goto lab11;
+        among_var = find_among_b_10(z);
+        if (!(among_var)) goto lab11;
+        z->bra = z->c;
+        if (!(z->I[0] <= z->c)) goto lab11;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 1, s_8);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 1, s_9);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab11:
+        z->c = z->l - m10;
+    }
+    {   int m11 = z->l - z->c; (void)m11;
+        z->ket = z->c;
+        if (z->c <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((10768 >> (z->p[z->c - 1] & 0x1f)) & 1)) goto lab12;
+        among_var = find_among_b_11(z);
+        if (!(among_var)) goto lab12;
+        z->bra = z->c;
+        if (!(z->I[0] <= z->c)) goto lab12;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 1, s_10);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 1, s_11);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab12:
+        z->c = z->l - m11;
+    }
+    {   int m12 = z->l - z->c; (void)m12;
+        z->ket = z->c;
+        if (z->c <= z->lb || z->p[z->c - 1] != 107) goto lab13;
+        among_var = find_among_b_8(z);
+        if (!(among_var)) goto lab13;
+        z->bra = z->c;
+        if (!(z->I[0] <= z->c)) goto lab13;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 1, s_12);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 1, s_13);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab13:
+        z->c = z->l - m12;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * hungarian_UTF_8_create_env(void) { return SN_create_env(0, 1); }
+
+extern void hungarian_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
@@ -0,0 +1,654 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int indonesian_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+static int r_VOWEL(struct SN_env * z);
+static int r_SUFFIX_I_OK(struct SN_env * z);
+static int r_SUFFIX_AN_OK(struct SN_env * z);
+static int r_SUFFIX_KAN_OK(struct SN_env * z);
+static int r_KER(struct SN_env * z);
+static int r_remove_suffix(struct SN_env * z);
+static int r_remove_second_order_prefix(struct SN_env * z);
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * indonesian_UTF_8_create_env(void);
+extern void indonesian_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[3] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 }
+};
+
+
+static const struct among a_1[3] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_2[3] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 1, 1 }
+};
+
+static int (* const a_2_functions[3])(struct SN_env *) = {
+    r_SUFFIX_I_OK,
+    r_SUFFIX_AN_OK,
+    r_SUFFIX_KAN_OK
+};
+
+
+static const struct among a_3[12] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 2, 5 },
+{ 0, 3, 2, 1 },
+{ 0, 4, 4, 1 },
+{ 0, 4, 4, 3 },
+{ 0, 3, -1, 6 },
+{ 0, 3, -1, 2 },
+{ 0, 4, 8, 2 },
+{ 0, 4, 8, 4 },
+{ 0, 3, -1, 1 }
+};
+
+static int (* const a_3_functions[12])(struct SN_env *) = {
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    r_VOWEL,
+    0,
+    0,
+    0,
+    r_VOWEL,
+    0
+};
+
+
+static const struct among a_4[6] =
+{
+{ 0, 2, -1, 3 },
+{ 0, 7, 0, 4 },
+{ 0, 3, 0, 3 },
+{ 0, 2, -1, 1 },
+{ 0, 7, 3, 2 },
+{ 0, 3, 3, 1 }
+};
+
+static int (* const a_4_functions[6])(struct SN_env *) = {
+    r_KER,
+    0,
+    0,
+    0,
+    0,
+    0
+};
+
+static const unsigned char g_vowel_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_vowel[] = { 17, 65, 16 };
+
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'i':
+                i = 0;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                i = 1;
+                if (n <= 2) break;
+                if (q[-3] != 'k') break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    while (i >= 0) {
+        const struct among * w = a_2 + i;
+        z->c = c - w->s_size;
+        if (a_2_functions[i] == 0) return w->result;
+        {   int res = a_2_functions[i](z);
+            z->c = c - w->s_size;
+            if (res) return w->result;
+        }
+        i = w->substring_i;
+    }
+    return 0;
+}
+static const symbol s_0[] = { 'e', 'r' };
+
+static int find_among_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 'b':
+                if (n <= 1) break;
+                if (q[1] != 'e') break;
+                i = 0;
+                if (n <= 2) break;
+                switch (q[2]) {
+                    case 'l':
+                        if (n <= 3) break;
+                        if (q[3] != 'a') break;
+                        if (n <= 4) break;
+                        if (q[4] != 'j') break;
+                        if (n <= 5) break;
+                        if (q[5] != 'a') break;
+                        if (n <= 6) break;
+                        if (q[6] != 'r') break;
+                        i = 1;
+                        break;
+                    case 'r':
+                        i = 2;
+                        break;
+                }
+                break;
+            case 'p':
+                if (n <= 1) break;
+                if (q[1] != 'e') break;
+                i = 3;
+                if (n <= 2) break;
+                switch (q[2]) {
+                    case 'l':
+                        if (n <= 3) break;
+                        if (q[3] != 'a') break;
+                        if (n <= 4) break;
+                        if (q[4] != 'j') break;
+                        if (n <= 5) break;
+                        if (q[5] != 'a') break;
+                        if (n <= 6) break;
+                        if (q[6] != 'r') break;
+                        i = 4;
+                        break;
+                    case 'r':
+                        i = 5;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    while (i >= 0) {
+        const struct among * w = a_4 + i;
+        z->c = c + w->s_size;
+        if (a_4_functions[i] == 0) return w->result;
+        {   int res = a_4_functions[i](z);
+            z->c = c + w->s_size;
+            if (res) return w->result;
+        }
+        i = w->substring_i;
+    }
+    return 0;
+}
+static const symbol s_1[] = { 'a', 'j', 'a', 'r' };
+static const symbol s_2[] = { 'a', 'j', 'a', 'r' };
+static const unsigned char g_vowel_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 64, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'h':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'k':
+                        i = 0;
+                        break;
+                    case 'l':
+                        i = 1;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'u') break;
+                if (n <= 2) break;
+                if (q[-3] != 'p') break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_0[i].s_size;
+    return a_0[i].result;
+}
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[-2] != 'y') break;
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                i = 0;
+                break;
+            case 'u':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'k':
+                        i = 1;
+                        break;
+                    case 'm':
+                        i = 2;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+
+static int find_among_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 'd':
+                if (n <= 1) break;
+                if (q[1] != 'i') break;
+                i = 0;
+                break;
+            case 'k':
+                if (n <= 1) break;
+                if (q[1] != 'e') break;
+                i = 1;
+                break;
+            case 'm':
+                if (n <= 1) break;
+                if (q[1] != 'e') break;
+                i = 2;
+                if (n <= 2) break;
+                switch (q[2]) {
+                    case 'm':
+                        i = 3;
+                        break;
+                    case 'n':
+                        i = 4;
+                        if (n <= 3) break;
+                        switch (q[3]) {
+                            case 'g':
+                                i = 5;
+                                break;
+                            case 'y':
+                                i = 6;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'p':
+                if (n <= 1) break;
+                if (q[1] != 'e') break;
+                if (n <= 2) break;
+                switch (q[2]) {
+                    case 'm':
+                        i = 7;
+                        break;
+                    case 'n':
+                        i = 8;
+                        if (n <= 3) break;
+                        switch (q[3]) {
+                            case 'g':
+                                i = 9;
+                                break;
+                            case 'y':
+                                i = 10;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[1] != 'e') break;
+                if (n <= 2) break;
+                if (q[2] != 'r') break;
+                i = 11;
+                break;
+        }
+    } while (0);
+    while (i >= 0) {
+        const struct among * w = a_3 + i;
+        z->c = c + w->s_size;
+        if (a_3_functions[i] == 0) return w->result;
+        {   int res = a_3_functions[i](z);
+            z->c = c + w->s_size;
+            if (res) return w->result;
+        }
+        i = w->substring_i;
+    }
+    return 0;
+}
+static const symbol s_3[] = { 's' };
+static const symbol s_4[] = { 's' };
+static const symbol s_5[] = { 'p' };
+static const symbol s_6[] = { 'p' };
+
+static int r_SUFFIX_KAN_OK(struct SN_env * z) {
+    
+    if (!(z->I[0] != 3)) return 0;
+    if (!(z->I[0] != 2)) return 0;
+    return 1;
+}
+
+static int r_SUFFIX_AN_OK(struct SN_env * z) {
+    if (!(z->I[0] != 1)) return 0;
+    return 1;
+}
+
+static int r_SUFFIX_I_OK(struct SN_env * z) {
+    if (!(z->I[0] <= 2)) return 0;
+    {   int m1 = z->l - z->c; (void)m1;
+        if (z->c <= z->lb || z->p[z->c - 1] != 's') goto lab0;
+        z->c--;
+        return 0;
+    lab0:
+        z->c = z->l - m1;
+    }
+    return 1;
+}
+
+static int r_remove_suffix(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c <= z->lb || (z->p[z->c - 1] != 105 && z->p[z->c - 1] != 110)) return 0;
+    if (!(find_among_b_2(z))) return 0;
+    z->bra = z->c;
+    {   int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    z->I[1] -= 1;
+    return 1;
+}
+
+static int r_VOWEL(struct SN_env * z) {
+    if (in_class_U(z, g_vowel_class, g_vowel, 97, 117, 0)) return 0;
+    return 1;
+}
+
+static int r_KER(struct SN_env * z) {
+    if (out_class_U(z, g_vowel_class, g_vowel, 97, 117, 0)) return 0;
+    if (!(eq_s(z, 2, s_0))) return 0;
+    return 1;
+}
+
+static int r_remove_second_order_prefix(struct SN_env * z) {
+    int among_var;
+    z->bra = z->c;
+    if (z->c + 1 >= z->l || z->p[z->c + 1] != 101) return 0;
+    among_var = find_among_4(z);
+    if (!(among_var)) return 0;
+    z->ket = z->c;
+    switch (among_var) {
+        case 1:
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            z->I[0] = 2;
+            z->I[1] -= 1;
+            break;
+        case 2:
+            {   int ret = slice_from_s(z, 4, s_1);
+                if (ret < 0) return ret;
+            }
+            z->I[1] -= 1;
+            break;
+        case 3:
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            z->I[0] = 4;
+            z->I[1] -= 1;
+            break;
+        case 4:
+            {   int ret = slice_from_s(z, 4, s_2);
+                if (ret < 0) return ret;
+            }
+            z->I[0] = 4;
+            z->I[1] -= 1;
+            break;
+    }
+    return 1;
+}
+
+extern int indonesian_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    z->I[1] = 0;
+    {   int c1 = z->c;
+        while(1) {
+            int c2 = z->c;
+            {   
+                int ret = out_class_scan_U(z, g_vowel_class, g_vowel_scan, g_vowel, 97, 117);
+                if (ret < 0) goto lab1;
+                z->c += ret;
+            }
+            z->I[1] += 1;
+            continue;
+        lab1:
+            z->c = c2;
+            break;
+        }
+        z->c = c1;
+    }
+    if (!(z->I[1] > 2)) return 0;
+    z->I[0] = 0;
+    z->lb = z->c; z->c = z->l;
+
+    {   int m3 = z->l - z->c; (void)m3;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb || (z->p[z->c - 1] != 104 && z->p[z->c - 1] != 110) || (z->p[z->c - 2] != 97 && z->p[z->c - 2] != 117)) goto lab2;
+        if (!(find_among_b_0(z))) goto lab2;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[1] -= 1;
+    lab2:
+        z->c = z->l - m3;
+    }
+    if (!(z->I[1] > 2)) return 0;
+    {   int m4 = z->l - z->c; (void)m4;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 97 && z->p[z->c - 1] != 117) || z->p[z->c - 2] >> 5 != 3 || !((33564672 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab3;
+        if (!(find_among_b_1(z))) goto lab3;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[1] -= 1;
+    lab3:
+        z->c = z->l - m4;
+    }
+    z->c = z->lb;
+    if (!(z->I[1] > 2)) return 0;
+    {   int c5 = z->c;
+        {   int c_test6 = z->c;
+            z->bra = z->c;
+            if (z->c + 1 >= z->l || (z->p[z->c + 1] != 101 && z->p[z->c + 1] != 105)) goto lab5;
+            among_var = find_among_3(z);
+            if (!(among_var)) goto lab5;
+            z->ket = z->c;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    z->I[0] = 1;
+                    z->I[1] -= 1;
+                    break;
+                case 2:
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    z->I[0] = 3;
+                    z->I[1] -= 1;
+                    break;
+                case 3:
+                    z->I[0] = 1;
+                    {   int ret = slice_from_s(z, 1, s_3);
+                        if (ret < 0) return ret;
+                    }
+                    z->I[1] -= 1;
+                    break;
+                case 4:
+                    z->I[0] = 3;
+                    {   int ret = slice_from_s(z, 1, s_4);
+                        if (ret < 0) return ret;
+                    }
+                    z->I[1] -= 1;
+                    break;
+                case 5:
+                    z->I[0] = 1;
+                    z->I[1] -= 1;
+                    {   int c7 = z->c;
+                        {   int c8 = z->c;
+                            if (in_class_U(z, g_vowel_class, g_vowel, 97, 117, 0)) goto lab7;
+                            z->c = c8;
+                            {   int ret = slice_from_s(z, 1, s_5);
+                                if (ret < 0) return ret;
+                            }
+                        }
+                        goto lab6;
+                    lab7:
+                        z->c = c7;
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                    }
+                lab6:
+                    break;
+                case 6:
+                    z->I[0] = 3;
+                    z->I[1] -= 1;
+                    {   int c9 = z->c;
+                        {   int c10 = z->c;
+                            if (in_class_U(z, g_vowel_class, g_vowel, 97, 117, 0)) goto lab9;
+                            z->c = c10;
+                            {   int ret = slice_from_s(z, 1, s_6);
+                                if (ret < 0) return ret;
+                            }
+                        }
+                        goto lab8;
+                    lab9:
+                        z->c = c9;
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                    }
+                lab8:
+                    break;
+            }
+            {   int c11 = z->c;
+                {   int c_test12 = z->c;
+                    if (!(z->I[1] > 2)) goto lab10;
+                    z->lb = z->c; z->c = z->l;
+
+                    {   int ret = r_remove_suffix(z);
+                        if (ret == 0) goto lab10;
+                        if (ret < 0) return ret;
+                    }
+                    z->c = z->lb;
+                    z->c = c_test12;
+                }
+                if (!(z->I[1] > 2)) goto lab10;
+                {   int ret = r_remove_second_order_prefix(z);
+                    if (ret == 0) goto lab10;
+                    if (ret < 0) return ret;
+                }
+            lab10:
+                z->c = c11;
+            }
+            z->c = c_test6;
+        }
+        goto lab4;
+    lab5:
+        z->c = c5;
+        {   int c13 = z->c;
+            {   int ret = r_remove_second_order_prefix(z);
+                if (ret < 0) return ret;
+            }
+            z->c = c13;
+        }
+        {   int c14 = z->c;
+            if (!(z->I[1] > 2)) goto lab11;
+            z->lb = z->c; z->c = z->l;
+
+            {   int ret = r_remove_suffix(z);
+                if (ret == 0) goto lab11;
+                if (ret < 0) return ret;
+            }
+            z->c = z->lb;
+        lab11:
+            z->c = c14;
+        }
+    }
+lab4:
+    return 1;
+}
+
+extern struct SN_env * indonesian_UTF_8_create_env(void) { return SN_create_env(0, 2); }
+
+extern void indonesian_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
@@ -0,0 +1,1016 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int irish_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * irish_UTF_8_create_env(void);
+extern void irish_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[24] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 4 },
+{ 0, 3, 1, 2 },
+{ 0, 2, -1, 8 },
+{ 0, 2, -1, 5 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 5, 2 },
+{ 0, 2, -1, 6 },
+{ 0, 2, -1, 9 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 5 },
+{ 0, 2, -1, 7 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 4 },
+{ 0, 2, -1, 10 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 6 },
+{ 0, 2, -1, 7 },
+{ 0, 2, -1, 8 },
+{ 0, 2, -1, 3 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 9 },
+{ 0, 2, -1, 3 }
+};
+
+
+static const struct among a_1[16] =
+{
+{ 0, 7, -1, 1 },
+{ 0, 8, 0, 1 },
+{ 0, 3, -1, 2 },
+{ 0, 4, 2, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 4, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 6, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 8, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 10, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 7, 12, 1 },
+{ 0, 4, -1, 2 },
+{ 0, 5, 14, 2 }
+};
+
+
+static const struct among a_2[25] =
+{
+{ 0, 9, -1, 6 },
+{ 0, 7, -1, 5 },
+{ 0, 5, -1, 1 },
+{ 0, 8, 2, 2 },
+{ 0, 6, 2, 1 },
+{ 0, 12, -1, 4 },
+{ 0, 5, -1, 5 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 7, 1 },
+{ 0, 8, 8, 6 },
+{ 0, 7, 8, 3 },
+{ 0, 6, 7, 5 },
+{ 0, 10, -1, 4 },
+{ 0, 7, -1, 5 },
+{ 0, 7, -1, 6 },
+{ 0, 8, -1, 1 },
+{ 0, 9, 15, 1 },
+{ 0, 6, -1, 3 },
+{ 0, 5, -1, 3 },
+{ 0, 4, -1, 1 },
+{ 0, 7, 19, 2 },
+{ 0, 5, 19, 1 },
+{ 0, 11, -1, 4 },
+{ 0, 10, -1, 2 },
+{ 0, 14, -1, 4 }
+};
+
+
+static const struct among a_3[12] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 5, 0, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, 2, 1 },
+{ 0, 3, -1, 2 },
+{ 0, 4, 4, 2 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 2 },
+{ 0, 3, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 3, -1, 2 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v[] = { 17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 17, 4, 2 };
+
+
+static const unsigned char a_0_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x80, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9C, 0x1, 0x19, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 'b':
+                if (n <= 1) break;
+                switch (q[1]) {
+                    case '\'':
+                        i = 0;
+                        break;
+                    case 'h':
+                        i = 1;
+                        if (n <= 2) break;
+                        if (q[2] != 'f') break;
+                        i = 2;
+                        break;
+                    case 'p':
+                        i = 3;
+                        break;
+                }
+                break;
+            case 'c':
+                if (n <= 1) break;
+                if (q[1] != 'h') break;
+                i = 4;
+                break;
+            case 'd':
+                if (n <= 1) break;
+                switch (q[1]) {
+                    case '\'':
+                        i = 5;
+                        if (n <= 2) break;
+                        if (q[2] != 'f') break;
+                        if (n <= 3) break;
+                        if (q[3] != 'h') break;
+                        i = 6;
+                        break;
+                    case 'h':
+                        i = 7;
+                        break;
+                    case 't':
+                        i = 8;
+                        break;
+                }
+                break;
+            case 'f':
+                if (n <= 1) break;
+                if (q[1] != 'h') break;
+                i = 9;
+                break;
+            case 'g':
+                if (n <= 1) break;
+                switch (q[1]) {
+                    case 'c':
+                        i = 10;
+                        break;
+                    case 'h':
+                        i = 11;
+                        break;
+                }
+                break;
+            case 'h':
+                if (n <= 1) break;
+                if (q[1] != '-') break;
+                i = 12;
+                break;
+            case 'm':
+                if (n <= 1) break;
+                switch (q[1]) {
+                    case '\'':
+                        i = 13;
+                        break;
+                    case 'b':
+                        i = 14;
+                        break;
+                    case 'h':
+                        i = 15;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[1]) {
+                    case '-':
+                        i = 16;
+                        break;
+                    case 'd':
+                        i = 17;
+                        break;
+                    case 'g':
+                        i = 18;
+                        break;
+                }
+                break;
+            case 'p':
+                if (n <= 1) break;
+                if (q[1] != 'h') break;
+                i = 19;
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[1] != 'h') break;
+                i = 20;
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[1]) {
+                    case '-':
+                        i = 21;
+                        break;
+                    case 'h':
+                        i = 22;
+                        break;
+                    case 's':
+                        i = 23;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_0[i].s_size;
+    return a_0[i].result;
+}
+static const symbol s_0[] = { 'f' };
+static const symbol s_1[] = { 's' };
+static const symbol s_2[] = { 'b' };
+static const symbol s_3[] = { 'c' };
+static const symbol s_4[] = { 'd' };
+static const symbol s_5[] = { 'g' };
+static const symbol s_6[] = { 'p' };
+static const symbol s_7[] = { 't' };
+static const symbol s_8[] = { 'm' };
+static const unsigned char g_v_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 64, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+
+static const unsigned char a_1_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x1, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static const unsigned char a_1_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0x21, 0x14, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[-2] != 't') break;
+                if (n <= 2) break;
+                if (q[-3] != 'h') break;
+                if (n <= 3) break;
+                if (q[-4] != 'c') break;
+                if (n <= 4) break;
+                if (q[-5] != 'o') break;
+                if (n <= 5) break;
+                if (q[-6] != 0xAD) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xC3) break;
+                i = 0;
+                if (n <= 7) break;
+                if (q[-8] != 'a') break;
+                i = 1;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                if (q[-2] != 'r') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 2;
+                if (n <= 3) break;
+                if (q[-4] != 'a') break;
+                i = 3;
+                break;
+            case 'h':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'b':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 4;
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 5;
+                                break;
+                            case 'i':
+                                i = 6;
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 7;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 8;
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 9;
+                                break;
+                            case 'i':
+                                i = 10;
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 11;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 'h') break;
+                if (n <= 2) break;
+                if (q[-3] != 'c') break;
+                if (n <= 3) break;
+                if (q[-4] != 'o') break;
+                if (n <= 4) break;
+                if (q[-5] != 0xAD) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xC3) break;
+                i = 12;
+                if (n <= 6) break;
+                if (q[-7] != 'a') break;
+                i = 13;
+                break;
+            case 0xAD:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                if (n <= 2) break;
+                if (q[-3] != 'r') break;
+                if (n <= 3) break;
+                if (q[-4] != 'i') break;
+                i = 14;
+                if (n <= 4) break;
+                if (q[-5] != 'a') break;
+                i = 15;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+
+static const unsigned char a_2_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x11, 0x18, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static const unsigned char a_2_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8A, 0x3, 0x10, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'h':
+                        if (n <= 2) break;
+                        if (q[-3] != 'c') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'e':
+                                if (n <= 5) break;
+                                if (q[-6] != 'd') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'i') break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xB3) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xC3) break;
+                                i = 0;
+                                break;
+                            case 't':
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'p') break;
+                                i = 1;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'h') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'c') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 2;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'c':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'r') break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'a') break;
+                                        i = 3;
+                                        break;
+                                    case 'e':
+                                        i = 4;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                if (n <= 5) break;
+                                if (q[-6] != 0xAD) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xC3) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 'a') break;
+                                if (n <= 8) break;
+                                if (q[-9] != 'f') break;
+                                if (n <= 9) break;
+                                if (q[-10] != 'a') break;
+                                if (n <= 10) break;
+                                if (q[-11] != 'r') break;
+                                if (n <= 11) break;
+                                if (q[-12] != 'g') break;
+                                i = 5;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                if (q[-2] != 't') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                if (n <= 3) break;
+                if (q[-4] != 'a') break;
+                if (n <= 4) break;
+                if (q[-5] != 'p') break;
+                i = 6;
+                break;
+            case 'h':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 7;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'e':
+                                        i = 8;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'd':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 0xB3) break;
+                                                if (n <= 7) break;
+                                                if (q[-8] != 0xC3) break;
+                                                i = 9;
+                                                break;
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'g') break;
+                                                i = 10;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'p') break;
+                                        i = 11;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 0xAD) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0xC3) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'f') break;
+                                if (n <= 7) break;
+                                if (q[-8] != 'a') break;
+                                if (n <= 8) break;
+                                if (q[-9] != 'r') break;
+                                if (n <= 9) break;
+                                if (q[-10] != 'g') break;
+                                i = 12;
+                                break;
+                        }
+                        break;
+                    case 'g':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'p') break;
+                                i = 13;
+                                break;
+                            case 'd':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xB3) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xC3) break;
+                                i = 14;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xC3) break;
+                if (n <= 4) break;
+                if (q[-5] != 't') break;
+                if (n <= 5) break;
+                if (q[-6] != 'h') break;
+                if (n <= 6) break;
+                if (q[-7] != 'c') break;
+                if (n <= 7) break;
+                if (q[-8] != 'a') break;
+                i = 15;
+                if (n <= 8) break;
+                if (q[-9] != 'e') break;
+                i = 16;
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'n') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'g') break;
+                        i = 17;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'g') break;
+                        i = 18;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 'h') break;
+                if (n <= 2) break;
+                if (q[-3] != 'c') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'a':
+                        i = 19;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'c':
+                                if (n <= 5) break;
+                                if (q[-6] != 'r') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'a') break;
+                                i = 20;
+                                break;
+                            case 'e':
+                                i = 21;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        if (n <= 4) break;
+                        if (q[-5] != 0xAD) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xC3) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 'a') break;
+                        if (n <= 7) break;
+                        if (q[-8] != 'f') break;
+                        if (n <= 8) break;
+                        if (q[-9] != 'a') break;
+                        if (n <= 9) break;
+                        if (q[-10] != 'r') break;
+                        if (n <= 10) break;
+                        if (q[-11] != 'g') break;
+                        i = 22;
+                        break;
+                }
+                break;
+            case 0xAD:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                if (n <= 2) break;
+                if (q[-3] != 'a') break;
+                if (n <= 3) break;
+                if (q[-4] != 't') break;
+                if (n <= 4) break;
+                if (q[-5] != 'h') break;
+                if (n <= 5) break;
+                if (q[-6] != 'c') break;
+                if (n <= 6) break;
+                switch (q[-7]) {
+                    case 'a':
+                        if (n <= 7) break;
+                        if (q[-8] != 'c') break;
+                        if (n <= 8) break;
+                        if (q[-9] != 'r') break;
+                        if (n <= 9) break;
+                        if (q[-10] != 'a') break;
+                        i = 23;
+                        break;
+                    case 'o':
+                        if (n <= 7) break;
+                        if (q[-8] != 0xAD) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xC3) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 'a') break;
+                        if (n <= 10) break;
+                        if (q[-11] != 'f') break;
+                        if (n <= 11) break;
+                        if (q[-12] != 'a') break;
+                        if (n <= 12) break;
+                        if (q[-13] != 'r') break;
+                        if (n <= 13) break;
+                        if (q[-14] != 'g') break;
+                        i = 24;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_9[] = { 'a', 'r', 'c' };
+static const symbol s_10[] = { 'g', 'i', 'n' };
+static const symbol s_11[] = { 'g', 'r', 'a', 'f' };
+static const symbol s_12[] = { 'p', 'a', 'i', 't', 'e' };
+static const symbol s_13[] = { 0xC3, 0xB3, 'i', 'd' };
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                if (q[-3] != 'm') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'i':
+                        i = 0;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 1;
+                        break;
+                    case 0xAD:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xC3) break;
+                        i = 2;
+                        if (n <= 5) break;
+                        if (q[-6] != 'a') break;
+                        i = 3;
+                        break;
+                }
+                break;
+            case 'h':
+                if (n <= 1) break;
+                if (q[-2] != 'd') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'a':
+                        i = 4;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 5;
+                        break;
+                    case 'i':
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                if (n <= 4) break;
+                                if (q[-5] != 'f') break;
+                                i = 6;
+                                break;
+                            case 'f':
+                                i = 7;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                if (q[-3] != 0xA1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xC3) break;
+                i = 8;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                if (q[-3] != 'a') break;
+                i = 9;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'e':
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        i = 10;
+                        break;
+                    case 't':
+                        i = 11;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+
+extern int irish_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    {   int c1 = z->c;
+        z->bra = z->c;
+        if (z->c + 1 >= z->l || !((a_0_filter0[z->p[z->c + 1] >> 3] >> (z->p[z->c + 1] & 7)) & 1)) goto lab0;
+        among_var = find_among_0(z);
+        if (!(among_var)) goto lab0;
+        z->ket = z->c;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 1, s_0);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 1, s_1);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                {   int ret = slice_from_s(z, 1, s_2);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                {   int ret = slice_from_s(z, 1, s_3);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {   int ret = slice_from_s(z, 1, s_4);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                {   int ret = slice_from_s(z, 1, s_5);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 8:
+                {   int ret = slice_from_s(z, 1, s_6);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 9:
+                {   int ret = slice_from_s(z, 1, s_7);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 10:
+                {   int ret = slice_from_s(z, 1, s_8);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab0:
+        z->c = c1;
+    }
+    
+    z->I[2] = z->l;
+    z->I[1] = z->l;
+    z->I[0] = z->l;
+    {   int c2 = z->c;
+        {   
+            int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 250);
+            if (ret < 0) goto lab2;
+            z->c += ret;
+        }
+        z->I[2] = z->c;
+        {   
+            int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 250);
+            if (ret < 0) goto lab2;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+        {   
+            int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 250);
+            if (ret < 0) goto lab2;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 250);
+            if (ret < 0) goto lab2;
+            z->c += ret;
+        }
+        z->I[0] = z->c;
+    lab2:
+        z->c = c2;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m3 = z->l - z->c; (void)m3;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb || !((a_1_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || !((a_1_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) goto lab3;
+        among_var = find_among_b_1(z);
+        if (!(among_var)) goto lab3;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(z->I[1] <= z->c)) goto lab3;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                if (!(z->I[0] <= z->c)) goto lab3;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab3:
+        z->c = z->l - m3;
+    }
+    {   int m4 = z->l - z->c; (void)m4;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb || !((a_2_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || !((a_2_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) goto lab4;
+        among_var = find_among_b_2(z);
+        if (!(among_var)) goto lab4;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(z->I[0] <= z->c)) goto lab4;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 3, s_9);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 3, s_10);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                {   int ret = slice_from_s(z, 4, s_11);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                {   int ret = slice_from_s(z, 5, s_12);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {   int ret = slice_from_s(z, 4, s_13);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab4:
+        z->c = z->l - m4;
+    }
+    {   int m5 = z->l - z->c; (void)m5;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((282896 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((530 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab5;
+        among_var = find_among_b_3(z);
+        if (!(among_var)) goto lab5;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(z->I[2] <= z->c)) goto lab5;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                if (!(z->I[1] <= z->c)) goto lab5;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab5:
+        z->c = z->l - m5;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * irish_UTF_8_create_env(void) { return SN_create_env(0, 3); }
+
+extern void irish_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
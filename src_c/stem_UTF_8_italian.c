@@ -0,0 +1,2104 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int italian_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * italian_UTF_8_create_env(void);
+extern void italian_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[7] =
+{
+{ 0, 0, -1, 7 },
+{ 0, 2, 0, 6 },
+{ 0, 2, 0, 1 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 3 },
+{ 0, 2, 0, 4 },
+{ 0, 2, 0, 5 }
+};
+
+static const symbol a_1_pool[4] = {
+    'I', 'i', 'U', 'u'
+};
+
+static const struct translation_entry a_1_entry[2] = {
+    { 0, 1, 1, 1 },
+    { 2, 1, 3, 1 }
+};
+
+static const unsigned short a_1_page[1] = {
+    256
+};
+
+static const unsigned short a_1_index[512] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const struct translation a_1_translation = {
+    0, 0, 1, a_1_page, a_1_index, a_1_entry, a_1_pool
+};
+
+
+static const struct among a_2[37] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 4, 0, -1 },
+{ 0, 6, 0, -1 },
+{ 0, 4, 0, -1 },
+{ 0, 4, 0, -1 },
+{ 0, 4, 0, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 4, 6, -1 },
+{ 0, 6, 6, -1 },
+{ 0, 4, 6, -1 },
+{ 0, 4, 6, -1 },
+{ 0, 4, 6, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 4, 12, -1 },
+{ 0, 6, 12, -1 },
+{ 0, 4, 12, -1 },
+{ 0, 4, 12, -1 },
+{ 0, 4, 12, -1 },
+{ 0, 4, 12, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 4, 20, -1 },
+{ 0, 6, 20, -1 },
+{ 0, 4, 20, -1 },
+{ 0, 4, 20, -1 },
+{ 0, 4, 20, -1 },
+{ 0, 3, 20, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 4, 31, -1 },
+{ 0, 6, 31, -1 },
+{ 0, 4, 31, -1 },
+{ 0, 4, 31, -1 },
+{ 0, 4, 31, -1 }
+};
+
+
+static const struct among a_3[5] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 }
+};
+
+
+static const struct among a_4[4] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_5[3] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_6[51] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 3 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 9 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 5 },
+{ 0, 3, -1, 1 },
+{ 0, 6, 7, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 3 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 4 },
+{ 0, 6, -1, 2 },
+{ 0, 6, -1, 4 },
+{ 0, 5, -1, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, 19, 7 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 9 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 5 },
+{ 0, 3, -1, 1 },
+{ 0, 6, 25, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 4 },
+{ 0, 6, -1, 2 },
+{ 0, 6, -1, 4 },
+{ 0, 5, -1, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 6 },
+{ 0, 6, -1, 6 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 9 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, -1, 6 },
+{ 0, 6, -1, 6 },
+{ 0, 3, -1, 9 },
+{ 0, 4, -1, 8 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 }
+};
+
+
+static const struct among a_7[87] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 16, 1 },
+{ 0, 5, 16, 1 },
+{ 0, 5, 16, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 20, 1 },
+{ 0, 5, 20, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 54, 1 },
+{ 0, 6, 54, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, 58, 1 },
+{ 0, 5, 58, 1 },
+{ 0, 5, 58, 1 },
+{ 0, 5, 58, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, 65, 1 },
+{ 0, 5, 65, 1 },
+{ 0, 5, 65, 1 },
+{ 0, 5, 65, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v[] = { 17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 8, 2, 1 };
+
+static const unsigned char g_AEIO_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_AEIO[] = { 17, 65, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 128, 8, 2 };
+
+static const unsigned char g_CG_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_CG[] = { 17 };
+
+static const symbol s_0[] = { 'd', 'i', 'v', 'a', 'n', 'o' };
+static const symbol s_1[] = { 'd', 'i', 'v', 'a', 'n' };
+
+static const unsigned char a_0_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x2, 0x22, 0x8, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        i = 0;
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 'q':
+                if (n <= 1) break;
+                if (q[1] != 'u') break;
+                i = 1;
+                break;
+            case 0xC3:
+                if (n <= 1) break;
+                switch (q[1]) {
+                    case 0xA1:
+                        i = 2;
+                        break;
+                    case 0xA9:
+                        i = 3;
+                        break;
+                    case 0xAD:
+                        i = 4;
+                        break;
+                    case 0xB3:
+                        i = 5;
+                        break;
+                    case 0xBA:
+                        i = 6;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_0[i].s_size;
+    return a_0[i].result;
+}
+static const symbol s_2[] = { 0xC3, 0xA0 };
+static const symbol s_3[] = { 0xC3, 0xA8 };
+static const symbol s_4[] = { 0xC3, 0xAC };
+static const symbol s_5[] = { 0xC3, 0xB2 };
+static const symbol s_6[] = { 0xC3, 0xB9 };
+static const symbol s_7[] = { 'q', 'U' };
+static const symbol s_8[] = { 'U' };
+static const symbol s_9[] = { 'I' };
+static const unsigned char g_v_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 64, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[-2] != 'l') break;
+                i = 0;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'c':
+                        i = 1;
+                        break;
+                    case 'i':
+                        if (n <= 4) break;
+                        if (q[-5] != 'l') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'g') break;
+                        i = 2;
+                        break;
+                    case 'm':
+                        i = 3;
+                        break;
+                    case 't':
+                        i = 4;
+                        break;
+                    case 'v':
+                        i = 5;
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'l':
+                        i = 6;
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'c':
+                                i = 7;
+                                break;
+                            case 'i':
+                                if (n <= 4) break;
+                                if (q[-5] != 'l') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'g') break;
+                                i = 8;
+                                break;
+                            case 'm':
+                                i = 9;
+                                break;
+                            case 't':
+                                i = 10;
+                                break;
+                            case 'v':
+                                i = 11;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        i = 12;
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'c':
+                                i = 13;
+                                break;
+                            case 'i':
+                                if (n <= 4) break;
+                                if (q[-5] != 'l') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'g') break;
+                                i = 14;
+                                break;
+                            case 'm':
+                                i = 15;
+                                break;
+                            case 's':
+                                i = 16;
+                                break;
+                            case 't':
+                                i = 17;
+                                break;
+                            case 'v':
+                                i = 18;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        i = 19;
+                        break;
+                    case 'l':
+                        i = 20;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        i = 21;
+                                        break;
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'l') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'g') break;
+                                        i = 22;
+                                        break;
+                                    case 'm':
+                                        i = 23;
+                                        break;
+                                    case 't':
+                                        i = 24;
+                                        break;
+                                    case 'v':
+                                        i = 25;
+                                        break;
+                                }
+                                break;
+                            case 'g':
+                                i = 26;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        i = 27;
+                        break;
+                    case 's':
+                        i = 28;
+                        break;
+                    case 't':
+                        i = 29;
+                        break;
+                    case 'v':
+                        i = 30;
+                        break;
+                }
+                break;
+            case 'o':
+                if (n <= 1) break;
+                if (q[-2] != 'l') break;
+                i = 31;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'c':
+                        i = 32;
+                        break;
+                    case 'i':
+                        if (n <= 4) break;
+                        if (q[-5] != 'l') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'g') break;
+                        i = 33;
+                        break;
+                    case 'm':
+                        i = 34;
+                        break;
+                    case 't':
+                        i = 35;
+                        break;
+                    case 'v':
+                        i = 36;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'o':
+                if (n <= 1) break;
+                if (q[-2] != 'd') break;
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'a':
+                        i = 0;
+                        break;
+                    case 'e':
+                        i = 1;
+                        break;
+                }
+                break;
+            case 'r':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 2;
+                        break;
+                    case 'e':
+                        i = 3;
+                        break;
+                    case 'i':
+                        i = 4;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+static const symbol s_10[] = { 'e' };
+
+static const unsigned char a_6_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x82, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static const unsigned char a_6_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x73, 0x5C, 0x4,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_6(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 0;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'g') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'o') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'l') break;
+                        i = 1;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        i = 2;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 3;
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 4;
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 5;
+                                break;
+                            case 'e':
+                                i = 6;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 7;
+                        if (n <= 3) break;
+                        if (q[-4] != 'r') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 't') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'a') break;
+                        i = 8;
+                        break;
+                    case 'h':
+                        if (n <= 2) break;
+                        if (q[-3] != 'c') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 9;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'g') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'o') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'l') break;
+                        i = 10;
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'b') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 11;
+                                break;
+                            case 'i':
+                                i = 12;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 's':
+                                if (n <= 5) break;
+                                if (q[-6] != 'u') break;
+                                i = 13;
+                                break;
+                            case 'z':
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'a':
+                                        i = 14;
+                                        break;
+                                    case 'u':
+                                        i = 15;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 16;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        i = 17;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 18;
+                                        break;
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'm') break;
+                                        i = 19;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'a') break;
+                                        i = 20;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 21;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 22;
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 23;
+                                break;
+                            case 'e':
+                                i = 24;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 25;
+                        if (n <= 3) break;
+                        if (q[-4] != 'r') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 't') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'a') break;
+                        i = 26;
+                        break;
+                    case 'h':
+                        if (n <= 2) break;
+                        if (q[-3] != 'c') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 27;
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'b') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 28;
+                                break;
+                            case 'i':
+                                i = 29;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 30;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 's':
+                                if (n <= 5) break;
+                                if (q[-6] != 'u') break;
+                                i = 31;
+                                break;
+                            case 'z':
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'a':
+                                        i = 32;
+                                        break;
+                                    case 'u':
+                                        i = 33;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 34;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        i = 35;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 36;
+                                        break;
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'm') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 37;
+                                                break;
+                                            case 'i':
+                                                i = 38;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 39;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 40;
+                        break;
+                }
+                break;
+            case 'o':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 41;
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 42;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        i = 43;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'm') break;
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 'a':
+                                i = 44;
+                                break;
+                            case 'i':
+                                i = 45;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 46;
+                        break;
+                }
+                break;
+            case 0xA0:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                if (n <= 2) break;
+                if (q[-3] != 't') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'i':
+                        i = 47;
+                        break;
+                    case 's':
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 48;
+                        break;
+                }
+                break;
+            case 0xA8:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                if (n <= 2) break;
+                if (q[-3] != 't') break;
+                if (n <= 3) break;
+                if (q[-4] != 's') break;
+                if (n <= 4) break;
+                if (q[-5] != 'i') break;
+                i = 49;
+                break;
+            case 0xAC:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                if (n <= 2) break;
+                if (q[-3] != 't') break;
+                if (n <= 3) break;
+                if (q[-4] != 's') break;
+                if (n <= 4) break;
+                if (q[-5] != 'i') break;
+                i = 50;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_6[i].s_size;
+    return a_6[i].result;
+}
+static const symbol s_11[] = { 'i', 'c' };
+static const symbol s_12[] = { 'l', 'o', 'g' };
+static const symbol s_13[] = { 'u' };
+static const symbol s_14[] = { 'e', 'n', 't', 'e' };
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'c':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 0;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                if (q[-3] != 'b') break;
+                if (n <= 3) break;
+                if (q[-4] != 'a') break;
+                i = 1;
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                i = 2;
+                break;
+            case 'v':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+static const symbol s_15[] = { 'a', 't' };
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'c':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 0;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                if (q[-3] != 'b') break;
+                if (n <= 3) break;
+                if (q[-4] != 'a') break;
+                i = 1;
+                break;
+            case 'v':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+static const symbol s_16[] = { 'a', 't' };
+static const symbol s_17[] = { 'i', 'c' };
+
+static const unsigned char a_7_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x82, 0x4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x1, 0x0, 0x4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static const unsigned char a_7_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3E, 0x62, 0x5C, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_7(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 0;
+                        break;
+                    case 'd':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 1;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 2;
+                                break;
+                            case 'i':
+                                i = 3;
+                                break;
+                            case 'u':
+                                i = 4;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 5;
+                                break;
+                            case 'e':
+                                i = 6;
+                                break;
+                            case 'i':
+                                i = 7;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'b':
+                        if (n <= 2) break;
+                        if (q[-3] != 'b') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'r') break;
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 'e':
+                                i = 8;
+                                break;
+                            case 'i':
+                                i = 9;
+                                break;
+                        }
+                        break;
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 10;
+                        break;
+                    case 'd':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 11;
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 12;
+                                break;
+                            case 'e':
+                                i = 13;
+                                break;
+                            case 'i':
+                                i = 14;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 15;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 16;
+                                if (n <= 3) break;
+                                if (q[-4] != 'v') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 17;
+                                        break;
+                                    case 'e':
+                                        i = 18;
+                                        break;
+                                    case 'i':
+                                        i = 19;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 20;
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'e':
+                                        i = 21;
+                                        break;
+                                    case 'i':
+                                        i = 22;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 23;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'e':
+                                        i = 24;
+                                        break;
+                                    case 'i':
+                                        i = 25;
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                i = 26;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'e':
+                                i = 27;
+                                break;
+                            case 'i':
+                                i = 28;
+                                break;
+                        }
+                        break;
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 29;
+                        break;
+                    case 'd':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 30;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'e':
+                                i = 31;
+                                break;
+                            case 'i':
+                                i = 32;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 33;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 34;
+                                break;
+                            case 'i':
+                                i = 35;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'e':
+                                        i = 36;
+                                        break;
+                                    case 'i':
+                                        i = 37;
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                i = 38;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 39;
+                                break;
+                            case 'e':
+                                i = 40;
+                                break;
+                            case 'i':
+                                i = 41;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'o':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 42;
+                        break;
+                    case 'd':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 43;
+                                break;
+                            case 'e':
+                                i = 44;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'Y':
+                                        i = 45;
+                                        break;
+                                    case 'i':
+                                        i = 46;
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 47;
+                                                break;
+                                            case 'e':
+                                                i = 48;
+                                                break;
+                                            case 'i':
+                                                i = 49;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'e':
+                                        i = 50;
+                                        break;
+                                    case 'i':
+                                        i = 51;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                i = 52;
+                                break;
+                            case 'm':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 53;
+                                        break;
+                                    case 'e':
+                                        i = 54;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'r') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'e':
+                                                i = 55;
+                                                break;
+                                            case 'i':
+                                                i = 56;
+                                                break;
+                                        }
+                                        break;
+                                    case 'i':
+                                        i = 57;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 58;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'i') break;
+                                        i = 59;
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 60;
+                                                break;
+                                            case 'e':
+                                                i = 61;
+                                                break;
+                                            case 'i':
+                                                i = 62;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'e':
+                                        i = 63;
+                                        break;
+                                    case 'i':
+                                        i = 64;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                i = 65;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'i') break;
+                                        i = 66;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 67;
+                                                break;
+                                            case 'e':
+                                                i = 68;
+                                                break;
+                                            case 'i':
+                                                i = 69;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'b':
+                                if (n <= 4) break;
+                                if (q[-5] != 'b') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'e') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'r') break;
+                                if (n <= 7) break;
+                                switch (q[-8]) {
+                                    case 'e':
+                                        i = 70;
+                                        break;
+                                    case 'i':
+                                        i = 71;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'a':
+                                        i = 72;
+                                        break;
+                                    case 'e':
+                                        i = 73;
+                                        break;
+                                    case 'i':
+                                        i = 74;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 75;
+                                break;
+                            case 'i':
+                                i = 76;
+                                break;
+                            case 'u':
+                                i = 77;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 78;
+                                break;
+                            case 'e':
+                                i = 79;
+                                break;
+                            case 'i':
+                                i = 80;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'r':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 81;
+                        break;
+                    case 'i':
+                        i = 82;
+                        break;
+                }
+                break;
+            case 0xA0:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                if (n <= 2) break;
+                if (q[-3] != 'r') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'e':
+                        i = 83;
+                        break;
+                    case 'i':
+                        i = 84;
+                        break;
+                }
+                break;
+            case 0xB2:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                if (n <= 2) break;
+                if (q[-3] != 'r') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'e':
+                        i = 85;
+                        break;
+                    case 'i':
+                        i = 86;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_7[i].s_size;
+    return a_7[i].result;
+}
+
+extern int italian_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    {   int c1 = z->c;
+        z->bra = z->c;
+        if (!(eq_s(z, 6, s_0))) goto lab1;
+        if (z->c < z->l) goto lab1;
+        z->ket = z->c;
+        {   int ret = slice_from_s(z, 5, s_1);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab1:
+        z->c = c1;
+        {   int c2 = z->c;
+            {   int c_test3 = z->c;
+                while(1) {
+                    int c4 = z->c;
+                    z->bra = z->c;
+                    if (z->c + 1 >= z->l || !((a_0_filter0[z->p[z->c + 1] >> 3] >> (z->p[z->c + 1] & 7)) & 1)) among_var = 7; else
+                    among_var = find_among_0(z);
+                    if (!(among_var)) goto lab3;
+                    z->ket = z->c;
+                    switch (among_var) {
+                        case 1:
+                            {   int ret = slice_from_s(z, 2, s_2);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 2:
+                            {   int ret = slice_from_s(z, 2, s_3);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 3:
+                            {   int ret = slice_from_s(z, 2, s_4);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 4:
+                            {   int ret = slice_from_s(z, 2, s_5);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 5:
+                            {   int ret = slice_from_s(z, 2, s_6);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 6:
+                            {   int ret = slice_from_s(z, 2, s_7);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 7:
+                            {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                                if (ret < 0) goto lab3;
+                                z->c = ret;
+                            }
+                            break;
+                    }
+                    continue;
+                lab3:
+                    z->c = c4;
+                    break;
+                }
+                z->c = c_test3;
+            }
+            while(1) {
+                int c5 = z->c;
+                while(1) {
+                    int c6 = z->c;
+                    if (in_class_U(z, g_v_class, g_v, 97, 249, 0)) goto lab5;
+                    z->bra = z->c;
+                    {   int c7 = z->c;
+                        if (z->c == z->l || z->p[z->c] != 'u') goto lab7;
+                        z->c++;
+                        z->ket = z->c;
+                        if (in_class_U(z, g_v_class, g_v, 97, 249, 0)) goto lab7;
+                        {   int ret = slice_from_s(z, 1, s_8);
+                            if (ret < 0) return ret;
+                        }
+                        goto lab6;
+                    lab7:
+                        z->c = c7;
+                        if (z->c == z->l || z->p[z->c] != 'i') goto lab5;
+                        z->c++;
+                        z->ket = z->c;
+                        if (in_class_U(z, g_v_class, g_v, 97, 249, 0)) goto lab5;
+                        {   int ret = slice_from_s(z, 1, s_9);
+                            if (ret < 0) return ret;
+                        }
+                    }
+                lab6:
+                    z->c = c6;
+                    break;
+                lab5:
+                    z->c = c6;
+                    {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                        if (ret < 0) goto lab4;
+                        z->c = ret;
+                    }
+                }
+                continue;
+            lab4:
+                z->c = c5;
+                break;
+            }
+            z->c = c2;
+        }
+        
+        z->I[2] = z->l;
+        z->I[1] = z->l;
+        z->I[0] = z->l;
+        {   int c8 = z->c;
+            {   int c9 = z->c;
+                if (in_class_U(z, g_v_class, g_v, 97, 249, 0)) goto lab11;
+                {   int c10 = z->c;
+                    if (out_class_U(z, g_v_class, g_v, 97, 249, 0)) goto lab13;
+                    {   
+                        int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 249);
+                        if (ret < 0) goto lab13;
+                        z->c += ret;
+                    }
+                    goto lab12;
+                lab13:
+                    z->c = c10;
+                    if (in_class_U(z, g_v_class, g_v, 97, 249, 0)) goto lab11;
+                    {   
+                        int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 249);
+                        if (ret < 0) goto lab11;
+                        z->c += ret;
+                    }
+                }
+            lab12:
+                goto lab10;
+            lab11:
+                z->c = c9;
+                if (out_class_U(z, g_v_class, g_v, 97, 249, 0)) goto lab9;
+                {   int c11 = z->c;
+                    if (out_class_U(z, g_v_class, g_v, 97, 249, 0)) goto lab15;
+                    {   
+                        int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 249);
+                        if (ret < 0) goto lab15;
+                        z->c += ret;
+                    }
+                    goto lab14;
+                lab15:
+                    z->c = c11;
+                    if (in_class_U(z, g_v_class, g_v, 97, 249, 0)) goto lab9;
+                    {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                        if (ret < 0) goto lab9;
+                        z->c = ret;
+                    }
+                }
+            lab14:
+                ;
+            }
+        lab10:
+            z->I[2] = z->c;
+        lab9:
+            z->c = c8;
+        }
+        {   int c12 = z->c;
+            {   
+                int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 249);
+                if (ret < 0) goto lab16;
+                z->c += ret;
+            }
+            {   
+                int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 249);
+                if (ret < 0) goto lab16;
+                z->c += ret;
+            }
+            z->I[1] = z->c;
+            {   
+                int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 249);
+                if (ret < 0) goto lab16;
+                z->c += ret;
+            }
+            {   
+                int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 249);
+                if (ret < 0) goto lab16;
+                z->c += ret;
+            }
+            z->I[0] = z->c;
+        lab16:
+            z->c = c12;
+        }
+        z->lb = z->c; z->c = z->l;
+
+        {   int m13 = z->l - z->c; (void)m13;
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((33314 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((5795848 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab17;
+            if (!(find_among_b_2(z))) goto lab17;
+            z->bra = z->c;
+            if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 111 && z->p[z->c - 1] != 114) || z->p[z->c - 2] >> 5 != 3 || !((562 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab17;
+            among_var = find_among_b_3(z);
+            if (!(among_var)) goto lab17;
+            if (!(z->I[2] <= z->c)) goto lab17;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    {   int ret = slice_from_s(z, 1, s_10);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+        lab17:
+            z->c = z->l - m13;
+        }
+        {   int m14 = z->l - z->c; (void)m14;
+            {   int m15 = z->l - z->c; (void)m15;
+                z->ket = z->c;
+                if (z->c - 2 <= z->lb || !((a_6_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || !((a_6_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) goto lab20;
+                among_var = find_among_b_6(z);
+                if (!(among_var)) goto lab20;
+                z->bra = z->c;
+                switch (among_var) {
+                    case 1:
+                        if (!(z->I[0] <= z->c)) goto lab20;
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        if (!(z->I[0] <= z->c)) goto lab20;
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        {   int m16 = z->l - z->c; (void)m16;
+                            z->ket = z->c;
+                            if (!(eq_s_b(z, 2, s_11))) { z->c = z->l - m16; goto lab21; }
+                            z->bra = z->c;
+                            if (!(z->I[0] <= z->c)) { z->c = z->l - m16; goto lab21; }
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                        lab21:
+                            ;
+                        }
+                        break;
+                    case 3:
+                        if (!(z->I[0] <= z->c)) goto lab20;
+                        {   int ret = slice_from_s(z, 3, s_12);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 4:
+                        if (!(z->I[0] <= z->c)) goto lab20;
+                        {   int ret = slice_from_s(z, 1, s_13);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 5:
+                        if (!(z->I[0] <= z->c)) goto lab20;
+                        {   int ret = slice_from_s(z, 4, s_14);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 6:
+                        if (!(z->I[2] <= z->c)) goto lab20;
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 7:
+                        if (!(z->I[1] <= z->c)) goto lab20;
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        {   int m17 = z->l - z->c; (void)m17;
+                            z->ket = z->c;
+                            if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((4722696 >> (z->p[z->c - 1] & 0x1f)) & 1) || (z->p[z->c - 2] != 105 && z->p[z->c - 2] != 111)) { z->c = z->l - m17; goto lab22; }
+                            among_var = find_among_b_4(z);
+                            if (!(among_var)) { z->c = z->l - m17; goto lab22; }
+                            z->bra = z->c;
+                            if (!(z->I[0] <= z->c)) { z->c = z->l - m17; goto lab22; }
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            switch (among_var) {
+                                case 1:
+                                    z->ket = z->c;
+                                    if (!(eq_s_b(z, 2, s_15))) { z->c = z->l - m17; goto lab22; }
+                                    z->bra = z->c;
+                                    if (!(z->I[0] <= z->c)) { z->c = z->l - m17; goto lab22; }
+                                    {   int ret = slice_del(z);
+                                        if (ret < 0) return ret;
+                                    }
+                                    break;
+                            }
+                        lab22:
+                            ;
+                        }
+                        break;
+                    case 8:
+                        if (!(z->I[0] <= z->c)) goto lab20;
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        {   int m18 = z->l - z->c; (void)m18;
+                            z->ket = z->c;
+                            if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((4198408 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] != 105) { z->c = z->l - m18; goto lab23; }
+                            if (!(find_among_b_5(z))) { z->c = z->l - m18; goto lab23; }
+                            z->bra = z->c;
+                            if (!(z->I[0] <= z->c)) { z->c = z->l - m18; goto lab23; }
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                        lab23:
+                            ;
+                        }
+                        break;
+                    case 9:
+                        if (!(z->I[0] <= z->c)) goto lab20;
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        {   int m19 = z->l - z->c; (void)m19;
+                            z->ket = z->c;
+                            if (!(eq_s_b(z, 2, s_16))) { z->c = z->l - m19; goto lab24; }
+                            z->bra = z->c;
+                            if (!(z->I[0] <= z->c)) { z->c = z->l - m19; goto lab24; }
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            z->ket = z->c;
+                            if (!(eq_s_b(z, 2, s_17))) { z->c = z->l - m19; goto lab24; }
+                            z->bra = z->c;
+                            if (!(z->I[0] <= z->c)) { z->c = z->l - m19; goto lab24; }
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                        lab24:
+                            ;
+                        }
+                        break;
+                }
+                goto lab19;
+            lab20:
+                z->c = z->l - m15;
+
+                {   int mlimit20;
+                    if (z->c < z->I[2]) goto lab18;
+                    mlimit20 = z->lb; z->lb = z->I[2];
+                    z->ket = z->c;
+                    if (z->c - 1 <= z->lb || !((a_7_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || !((a_7_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) { z->lb = mlimit20; goto lab18; }
+                    if (!(find_among_b_7(z))) { z->lb = mlimit20; goto lab18; }
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    z->lb = mlimit20;
+                }
+            }
+        lab19:
+        lab18:
+            z->c = z->l - m14;
+        }
+        {   int m21 = z->l - z->c; (void)m21;
+            {   int m22 = z->l - z->c; (void)m22;
+                z->ket = z->c;
+                if (in_class_b_U(z, g_AEIO_class, g_AEIO, 97, 242, 0)) { z->c = z->l - m22; goto lab26; }
+                z->bra = z->c;
+                if (!(z->I[2] <= z->c)) { z->c = z->l - m22; goto lab26; }
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                z->ket = z->c;
+                if (z->c <= z->lb || z->p[z->c - 1] != 'i') { z->c = z->l - m22; goto lab26; }
+                z->c--;
+                z->bra = z->c;
+                if (!(z->I[2] <= z->c)) { z->c = z->l - m22; goto lab26; }
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+            lab26:
+                ;
+            }
+            {   int m23 = z->l - z->c; (void)m23;
+                z->ket = z->c;
+                if (z->c <= z->lb || z->p[z->c - 1] != 'h') { z->c = z->l - m23; goto lab27; }
+                z->c--;
+                z->bra = z->c;
+                if (in_class_b_U(z, g_CG_class, g_CG, 99, 103, 0)) { z->c = z->l - m23; goto lab27; }
+                if (!(z->I[2] <= z->c)) { z->c = z->l - m23; goto lab27; }
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+            lab27:
+                ;
+            }
+            z->c = z->l - m21;
+        }
+        z->c = z->lb;
+        {   int c24 = z->c;
+            {   int ret = translate_U(z, &a_1_translation);
+                if (ret < 0) return ret;
+            }
+            z->c = c24;
+        }
+    }
+lab0:
+    return 1;
+}
+
+extern struct SN_env * italian_UTF_8_create_env(void) { return SN_create_env(0, 3); }
+
+extern void italian_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
@@ -0,0 +1,2111 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int kraaij_pohlmann_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+static int r_measure(struct SN_env * z);
+static int r_Step_1c(struct SN_env * z);
+static int r_lengthen_V(struct SN_env * z);
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * kraaij_pohlmann_UTF_8_create_env(void);
+extern void kraaij_pohlmann_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[7] =
+{
+{ 0, 3, -1, 7 },
+{ 0, 2, -1, 6 },
+{ 0, 1, -1, 2 },
+{ 0, 2, 2, 1 },
+{ 0, 2, 2, 4 },
+{ 0, 3, 4, 3 },
+{ 0, 3, 2, 5 }
+};
+
+
+static const struct among a_1[11] =
+{
+{ 0, 2, -1, 5 },
+{ 0, 2, -1, 2 },
+{ 0, 5, -1, 4 },
+{ 0, 2, -1, 1 },
+{ 0, 5, -1, 3 },
+{ 0, 2, -1, 9 },
+{ 0, 3, -1, 10 },
+{ 0, 2, -1, 8 },
+{ 0, 2, -1, 7 },
+{ 0, 2, -1, 6 },
+{ 0, 4, -1, 11 }
+};
+
+
+static const struct among a_2[14] =
+{
+{ 0, 4, -1, 3 },
+{ 0, 3, -1, 6 },
+{ 0, 3, -1, 7 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 2 },
+{ 0, 3, -1, 2 },
+{ 0, 4, -1, 5 },
+{ 0, 4, -1, 2 },
+{ 0, 3, -1, 3 },
+{ 0, 4, -1, 4 },
+{ 0, 4, -1, 3 },
+{ 0, 5, -1, 2 },
+{ 0, 3, -1, 9 },
+{ 0, 3, -1, 8 }
+};
+
+
+static const struct among a_3[16] =
+{
+{ 0, 3, -1, 9 },
+{ 0, 5, -1, 2 },
+{ 0, 4, -1, 9 },
+{ 0, 6, -1, 3 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 3 },
+{ 0, 4, -1, 5 },
+{ 0, 4, -1, 4 },
+{ 0, 4, -1, 6 },
+{ 0, 6, -1, 9 },
+{ 0, 8, -1, 3 },
+{ 0, 6, -1, 8 },
+{ 0, 4, -1, 7 },
+{ 0, 6, -1, 9 },
+{ 0, 8, -1, 3 },
+{ 0, 6, -1, 8 }
+};
+
+
+static const struct among a_4[3] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+
+static const struct among a_5[3] =
+{
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 3 }
+};
+
+
+static const struct among a_6[22] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 3 },
+{ 0, 2, -1, 4 },
+{ 0, 2, -1, 5 },
+{ 0, 2, -1, 6 },
+{ 0, 2, -1, 7 },
+{ 0, 2, -1, 8 },
+{ 0, 2, -1, 9 },
+{ 0, 2, -1, 10 },
+{ 0, 2, -1, 11 },
+{ 0, 2, -1, 12 },
+{ 0, 2, -1, 13 },
+{ 0, 2, -1, 14 },
+{ 0, 2, -1, 15 },
+{ 0, 2, -1, 16 },
+{ 0, 1, -1, 4 },
+{ 0, 2, 16, 17 },
+{ 0, 2, -1, 18 },
+{ 0, 2, -1, 19 },
+{ 0, 1, -1, 15 },
+{ 0, 2, 20, 20 }
+};
+
+
+static const struct among a_7[2] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 2 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v[] = { 17, 65, 16, 1 };
+
+static const unsigned char g_v_WX_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v_WX[] = { 17, 65, 208, 1 };
+
+static const unsigned char g_AOU_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_AOU[] = { 1, 64, 16 };
+
+static const unsigned char g_AIOU_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_AIOU[] = { 1, 65, 16 };
+
+
+static int find_among_b_7(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                i = 0;
+                break;
+            case 't':
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_7[i].s_size;
+    return a_7[i].result;
+}
+static const symbol s_0[] = { 'i', 'j' };
+static const symbol s_1[] = { 'i', 'j' };
+static const symbol s_2[] = { 'i', 'j' };
+static const symbol s_3[] = { 'Y' };
+static const symbol s_4[] = { 'Y' };
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'e':
+                if (n <= 1) break;
+                if (q[-2] != 'd') break;
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                i = 0;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 1;
+                break;
+            case 's':
+                i = 2;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case '\'':
+                        i = 3;
+                        break;
+                    case 'e':
+                        i = 4;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 5;
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 6;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_0[i].s_size;
+    return a_0[i].result;
+}
+static const symbol s_5[] = { 'i', 'j' };
+static const symbol s_6[] = { 'i', 'e' };
+static const symbol s_7[] = { 'a', 'r' };
+static const symbol s_8[] = { 'i', 'j' };
+static const symbol s_9[] = { 'e', 'r' };
+static const symbol s_10[] = { 'i', 'j' };
+static const symbol s_11[] = { 'i', 'j' };
+static const symbol s_12[] = { 'e' };
+static const symbol s_13[] = { 'i', 'j' };
+static const symbol s_14[] = { 'a', 'u' };
+static const symbol s_15[] = { 'h', 'e', 'd' };
+static const symbol s_16[] = { 'h', 'e', 'i', 'd' };
+static const symbol s_17[] = { 'n', 'd' };
+static const symbol s_18[] = { 'i', 'j' };
+static const symbol s_19[] = { 'i', 'j' };
+static const symbol s_20[] = { 'i', 'j' };
+static const symbol s_21[] = { 'n', 'd' };
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'e') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'd':
+                i = 0;
+                break;
+            case 'g':
+                i = 1;
+                break;
+            case 'h':
+                if (n <= 2) break;
+                if (q[-3] != 'c') break;
+                if (n <= 3) break;
+                if (q[-4] != 's') break;
+                if (n <= 4) break;
+                if (q[-5] != 'i') break;
+                i = 2;
+                break;
+            case 'j':
+                i = 3;
+                break;
+            case 'k':
+                if (n <= 2) break;
+                if (q[-3] != 'j') break;
+                if (n <= 3) break;
+                if (q[-4] != 'i') break;
+                if (n <= 4) break;
+                if (q[-5] != 'l') break;
+                i = 4;
+                break;
+            case 'l':
+                i = 5;
+                break;
+            case 'n':
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                i = 6;
+                break;
+            case 'r':
+                i = 7;
+                break;
+            case 's':
+                i = 8;
+                break;
+            case 't':
+                i = 9;
+                break;
+            case 'v':
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                if (n <= 3) break;
+                if (q[-4] != 'i') break;
+                i = 10;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+static const symbol s_22[] = { '\'', 't' };
+static const symbol s_23[] = { 'e', 't' };
+static const symbol s_24[] = { 'i', 'j' };
+static const symbol s_25[] = { 'r', 'n', 't' };
+static const symbol s_26[] = { 'r', 'n' };
+static const symbol s_27[] = { 'i', 'j' };
+static const symbol s_28[] = { 'i', 'n', 'k' };
+static const symbol s_29[] = { 'i', 'n', 'g' };
+static const symbol s_30[] = { 'm', 'p' };
+static const symbol s_31[] = { 'm' };
+static const symbol s_32[] = { 'i', 'j' };
+static const symbol s_33[] = { 'g' };
+static const symbol s_34[] = { 'l', 'i', 'j', 'k' };
+static const symbol s_35[] = { 'i', 's', 'c', 'h' };
+static const symbol s_36[] = { 'i', 'j' };
+static const symbol s_37[] = { 't' };
+static const symbol s_38[] = { 's' };
+static const symbol s_39[] = { 'r' };
+static const symbol s_40[] = { 'l' };
+static const symbol s_41[] = { 'i', 'j' };
+static const symbol s_42[] = { 'e', 'n' };
+static const symbol s_43[] = { 'i', 'j' };
+static const symbol s_44[] = { 'i', 'e', 'f' };
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                if (n <= 3) break;
+                if (q[-4] != 'h') break;
+                i = 0;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'f':
+                                i = 1;
+                                break;
+                            case 'g':
+                                i = 2;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 3;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 5;
+                break;
+            case 'j':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                if (q[-3] != 'r') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'a':
+                        i = 6;
+                        break;
+                    case 'e':
+                        i = 7;
+                        break;
+                }
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                if (n <= 2) break;
+                if (q[-3] != 's') break;
+                i = 8;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'd':
+                        if (n <= 3) break;
+                        if (q[-4] != 'r') break;
+                        i = 9;
+                        break;
+                    case 't':
+                        if (n <= 3) break;
+                        if (q[-4] != 's') break;
+                        i = 10;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 11;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                i = 12;
+                                break;
+                            case 't':
+                                i = 13;
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_45[] = { 'e', 'e', 'r' };
+static const symbol s_46[] = { 'r' };
+static const symbol s_47[] = { 'i', 'j' };
+static const symbol s_48[] = { 'a', 'a', 'r' };
+static const symbol s_49[] = { 'f' };
+static const symbol s_50[] = { 'g' };
+static const symbol s_51[] = { 'i', 'j' };
+static const symbol s_52[] = { 't' };
+static const symbol s_53[] = { 'i', 'j' };
+static const symbol s_54[] = { 'd' };
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                i = 0;
+                break;
+            case 'f':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                if (n <= 3) break;
+                if (q[-4] != 't') break;
+                if (n <= 4) break;
+                if (q[-5] != 'a') break;
+                i = 1;
+                break;
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'r':
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 2;
+                        break;
+                    case 't':
+                        if (n <= 3) break;
+                        if (q[-4] != 'h') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'c') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'a') break;
+                        i = 3;
+                        break;
+                }
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                if (n <= 3) break;
+                if (q[-4] != 'n') break;
+                if (n <= 4) break;
+                if (q[-5] != 'o') break;
+                if (n <= 5) break;
+                if (q[-6] != 'i') break;
+                i = 4;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'b':
+                                i = 5;
+                                break;
+                            case 'l':
+                                i = 6;
+                                break;
+                            case 'n':
+                                i = 7;
+                                break;
+                            case 'r':
+                                i = 8;
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'g':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'r':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'e') break;
+                                        i = 9;
+                                        break;
+                                    case 't':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'h') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'c') break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'a') break;
+                                        i = 10;
+                                        break;
+                                }
+                                break;
+                            case 'k':
+                                if (n <= 3) break;
+                                if (q[-4] != 'j') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'l') break;
+                                i = 11;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        i = 12;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'g':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'r':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'e') break;
+                                        i = 13;
+                                        break;
+                                    case 't':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'h') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'c') break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'a') break;
+                                        i = 14;
+                                        break;
+                                }
+                                break;
+                            case 'k':
+                                if (n <= 3) break;
+                                if (q[-4] != 'j') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'l') break;
+                                i = 15;
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+static const symbol s_55[] = { 'i', 'e' };
+static const symbol s_56[] = { 'e', 'e', 'r' };
+static const symbol s_57[] = { 'i', 'j' };
+static const symbol s_58[] = { 'n' };
+static const symbol s_59[] = { 'i', 'j' };
+static const symbol s_60[] = { 'l' };
+static const symbol s_61[] = { 'i', 'j' };
+static const symbol s_62[] = { 'r' };
+static const symbol s_63[] = { 't', 'e', 'e', 'r' };
+static const symbol s_64[] = { 'l', 'i', 'j', 'k' };
+static const symbol s_65[] = { 'i', 'j' };
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 0;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                if (n <= 2) break;
+                if (q[-3] != 'g') break;
+                if (n <= 3) break;
+                if (q[-4] != 'i') break;
+                i = 1;
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                if (q[-3] != 'g') break;
+                if (n <= 3) break;
+                if (q[-4] != 'i') break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+static const symbol s_66[] = { 'i', 'j' };
+static const symbol s_67[] = { 'g', 'e' };
+static const unsigned char g_v_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 192, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+static const symbol s_68[] = { 'g', 'e' };
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 't') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'f':
+                i = 0;
+                break;
+            case 'k':
+                i = 1;
+                break;
+            case 'p':
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+static const symbol s_69[] = { 'k' };
+static const symbol s_70[] = { 'f' };
+static const symbol s_71[] = { 'p' };
+
+static int find_among_b_6(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'b':
+                if (n <= 1) break;
+                if (q[-2] != 'b') break;
+                i = 0;
+                break;
+            case 'c':
+                if (n <= 1) break;
+                if (q[-2] != 'c') break;
+                i = 1;
+                break;
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'd') break;
+                i = 2;
+                break;
+            case 'f':
+                if (n <= 1) break;
+                if (q[-2] != 'f') break;
+                i = 3;
+                break;
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'g') break;
+                i = 4;
+                break;
+            case 'h':
+                if (n <= 1) break;
+                if (q[-2] != 'h') break;
+                i = 5;
+                break;
+            case 'j':
+                if (n <= 1) break;
+                if (q[-2] != 'j') break;
+                i = 6;
+                break;
+            case 'k':
+                if (n <= 1) break;
+                if (q[-2] != 'k') break;
+                i = 7;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'l') break;
+                i = 8;
+                break;
+            case 'm':
+                if (n <= 1) break;
+                if (q[-2] != 'm') break;
+                i = 9;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                i = 10;
+                break;
+            case 'p':
+                if (n <= 1) break;
+                if (q[-2] != 'p') break;
+                i = 11;
+                break;
+            case 'q':
+                if (n <= 1) break;
+                if (q[-2] != 'q') break;
+                i = 12;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'r') break;
+                i = 13;
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                i = 14;
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 't') break;
+                i = 15;
+                break;
+            case 'v':
+                i = 16;
+                if (n <= 1) break;
+                if (q[-2] != 'v') break;
+                i = 17;
+                break;
+            case 'w':
+                if (n <= 1) break;
+                if (q[-2] != 'w') break;
+                i = 18;
+                break;
+            case 'x':
+                if (n <= 1) break;
+                if (q[-2] != 'x') break;
+                i = 19;
+                break;
+            case 'z':
+                i = 20;
+                if (n <= 1) break;
+                if (q[-2] != 'z') break;
+                i = 21;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_6[i].s_size;
+    return a_6[i].result;
+}
+static const symbol s_72[] = { 'b' };
+static const symbol s_73[] = { 'c' };
+static const symbol s_74[] = { 'd' };
+static const symbol s_75[] = { 'f' };
+static const symbol s_76[] = { 'g' };
+static const symbol s_77[] = { 'h' };
+static const symbol s_78[] = { 'j' };
+static const symbol s_79[] = { 'k' };
+static const symbol s_80[] = { 'l' };
+static const symbol s_81[] = { 'm' };
+static const symbol s_82[] = { 'n' };
+static const symbol s_83[] = { 'p' };
+static const symbol s_84[] = { 'q' };
+static const symbol s_85[] = { 'r' };
+static const symbol s_86[] = { 's' };
+static const symbol s_87[] = { 't' };
+static const symbol s_88[] = { 'v' };
+static const symbol s_89[] = { 'w' };
+static const symbol s_90[] = { 'x' };
+static const symbol s_91[] = { 'z' };
+static const symbol s_92[] = { 'y' };
+
+static int r_lengthen_V(struct SN_env * z) {
+    {   int m1 = z->l - z->c; (void)m1;
+        if (out_class_b_U(z, g_v_WX_class, g_v_WX, 97, 121, 0)) goto lab0;
+        z->ket = z->c;
+        {   int m2 = z->l - z->c; (void)m2;
+            if (in_class_b_U(z, g_AOU_class, g_AOU, 97, 117, 0)) goto lab2;
+            z->bra = z->c;
+            {   int m_test3 = z->l - z->c;
+                {   int m4 = z->l - z->c; (void)m4;
+                    if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab4;
+                    goto lab3;
+                lab4:
+                    z->c = z->l - m4;
+                    if (z->c > z->lb) goto lab2;
+                }
+            lab3:
+                z->c = z->l - m_test3;
+            }
+            goto lab1;
+        lab2:
+            z->c = z->l - m2;
+            if (z->c <= z->lb || z->p[z->c - 1] != 'e') goto lab0;
+            z->c--;
+            z->bra = z->c;
+            {   int m_test5 = z->l - z->c;
+                {   int m6 = z->l - z->c; (void)m6;
+                    if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab6;
+                    goto lab5;
+                lab6:
+                    z->c = z->l - m6;
+                    if (z->c > z->lb) goto lab0;
+                }
+            lab5:
+                {   int m7 = z->l - z->c; (void)m7;
+                    if (in_class_b_U(z, g_AIOU_class, g_AIOU, 97, 117, 0)) goto lab7;
+                    goto lab0;
+                lab7:
+                    z->c = z->l - m7;
+                }
+                {   int m8 = z->l - z->c; (void)m8;
+                    {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+                        if (ret < 0) goto lab8;
+                        z->c = ret;
+                    }
+                    if (in_class_b_U(z, g_AIOU_class, g_AIOU, 97, 117, 0)) goto lab8;
+                    if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab8;
+                    goto lab0;
+                lab8:
+                    z->c = z->l - m8;
+                }
+                z->c = z->l - m_test5;
+            }
+        }
+    lab1:
+        z->S[0] = slice_to(z, z->S[0]);
+        if (z->S[0] == 0) return -1;
+        {   int ret;
+            {   int saved_c = z->c;
+                ret = insert_v(z, z->c, z->c, z->S[0]);
+                z->c = saved_c;
+            }
+            if (ret < 0) return ret;
+        }
+    lab0:
+        z->c = z->l - m1;
+    }
+    return 1;
+}
+
+static int r_Step_1c(struct SN_env * z) {
+    int among_var;
+    z->ket = z->c;
+    if (z->c <= z->lb || (z->p[z->c - 1] != 100 && z->p[z->c - 1] != 116)) return 0;
+    among_var = find_among_b_7(z);
+    if (!(among_var)) return 0;
+    z->bra = z->c;
+    if (!(z->I[1] <= z->c)) return 0;
+    {   int m_test1 = z->l - z->c;
+        {   int m2 = z->l - z->c; (void)m2;
+            if (!(eq_s_b(z, 2, s_0))) goto lab0;
+            return 0;
+        lab0:
+            z->c = z->l - m2;
+        }
+        if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) return 0;
+        z->c = z->l - m_test1;
+    }
+    switch (among_var) {
+        case 1:
+            {   int m3 = z->l - z->c; (void)m3;
+                if (z->c <= z->lb || z->p[z->c - 1] != 'n') goto lab1;
+                z->c--;
+                if (!(z->I[1] <= z->c)) goto lab1;
+                return 0;
+            lab1:
+                z->c = z->l - m3;
+            }
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 2:
+            {   int m4 = z->l - z->c; (void)m4;
+                if (z->c <= z->lb || z->p[z->c - 1] != 'h') goto lab2;
+                z->c--;
+                if (!(z->I[1] <= z->c)) goto lab2;
+                return 0;
+            lab2:
+                z->c = z->l - m4;
+            }
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            break;
+    }
+    return 1;
+}
+
+static int r_measure(struct SN_env * z) {
+    z->I[1] = z->l;
+    z->I[0] = z->l;
+    {   int c1 = z->c;
+        while(1) {
+            if (out_class_U(z, g_v_class, g_v, 97, 121, 0)) goto lab1;
+            continue;
+        lab1:
+            break;
+        }
+        {   int i = 1;
+            while(1) {
+                int c2 = z->c;
+                {   int c3 = z->c;
+                    if (!(eq_s(z, 2, s_1))) goto lab4;
+                    goto lab3;
+                lab4:
+                    z->c = c3;
+                    if (in_class_U(z, g_v_class, g_v, 97, 121, 0)) goto lab2;
+                }
+            lab3:
+                i--;
+                continue;
+            lab2:
+                z->c = c2;
+                break;
+            }
+            if (i > 0) goto lab0;
+        }
+        if (out_class_U(z, g_v_class, g_v, 97, 121, 0)) goto lab0;
+        z->I[1] = z->c;
+        while(1) {
+            if (out_class_U(z, g_v_class, g_v, 97, 121, 0)) goto lab5;
+            continue;
+        lab5:
+            break;
+        }
+        {   int i = 1;
+            while(1) {
+                int c4 = z->c;
+                {   int c5 = z->c;
+                    if (!(eq_s(z, 2, s_2))) goto lab8;
+                    goto lab7;
+                lab8:
+                    z->c = c5;
+                    if (in_class_U(z, g_v_class, g_v, 97, 121, 0)) goto lab6;
+                }
+            lab7:
+                i--;
+                continue;
+            lab6:
+                z->c = c4;
+                break;
+            }
+            if (i > 0) goto lab0;
+        }
+        if (out_class_U(z, g_v_class, g_v, 97, 121, 0)) goto lab0;
+        z->I[0] = z->c;
+    lab0:
+        z->c = c1;
+    }
+    return 1;
+}
+
+extern int kraaij_pohlmann_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    z->I[4] = 0;
+    z->I[3] = 0;
+    {   int c1 = z->c;
+        z->bra = z->c;
+        if (z->c == z->l || z->p[z->c] != 'y') goto lab0;
+        z->c++;
+        z->ket = z->c;
+        {   int ret = slice_from_s(z, 1, s_3);
+            if (ret < 0) return ret;
+        }
+        z->I[4] = 1;
+    lab0:
+        z->c = c1;
+    }
+    {   int c2 = z->c;
+        while(1) {
+            int c3 = z->c;
+            while(1) {
+                int c4 = z->c;
+                if (in_class_U(z, g_v_class, g_v, 97, 121, 0)) goto lab3;
+                z->bra = z->c;
+                if (z->c == z->l || z->p[z->c] != 'y') goto lab3;
+                z->c++;
+                z->ket = z->c;
+                z->c = c4;
+                break;
+            lab3:
+                z->c = c4;
+                {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                    if (ret < 0) goto lab2;
+                    z->c = ret;
+                }
+            }
+            {   int ret = slice_from_s(z, 1, s_4);
+                if (ret < 0) return ret;
+            }
+            z->I[4] = 1;
+            continue;
+        lab2:
+            z->c = c3;
+            break;
+        }
+        z->c = c2;
+    }
+    {   int ret = r_measure(z);
+        if (ret <= 0) return ret;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m5 = z->l - z->c; (void)m5;
+        z->ket = z->c;
+        if (z->c <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((540704 >> (z->p[z->c - 1] & 0x1f)) & 1)) goto lab4;
+        among_var = find_among_b_0(z);
+        if (!(among_var)) goto lab4;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                if (!(z->I[1] <= z->c)) goto lab4;
+                {   int m6 = z->l - z->c; (void)m6;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 't') goto lab5;
+                    z->c--;
+                    if (!(z->I[1] <= z->c)) goto lab5;
+                    goto lab4;
+                lab5:
+                    z->c = z->l - m6;
+                }
+                {   int m_test7 = z->l - z->c;
+                    {   int m8 = z->l - z->c; (void)m8;
+                        if (!(eq_s_b(z, 2, s_5))) goto lab6;
+                        goto lab4;
+                    lab6:
+                        z->c = z->l - m8;
+                    }
+                    if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab4;
+                    z->c = z->l - m_test7;
+                }
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                if (!(z->I[1] <= z->c)) goto lab4;
+                {   int ret = slice_from_s(z, 2, s_6);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                {   int m9 = z->l - z->c; (void)m9;
+                    if (!(eq_s_b(z, 2, s_7))) goto lab8;
+                    if (!(z->I[1] <= z->c)) goto lab8;
+                    {   int m_test10 = z->l - z->c;
+                        {   int m11 = z->l - z->c; (void)m11;
+                            if (!(eq_s_b(z, 2, s_8))) goto lab9;
+                            goto lab8;
+                        lab9:
+                            z->c = z->l - m11;
+                        }
+                        if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab8;
+                        z->c = z->l - m_test10;
+                    }
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int ret = r_lengthen_V(z);
+                        if (ret == 0) goto lab8;
+                        if (ret < 0) return ret;
+                    }
+                    goto lab7;
+                lab8:
+                    z->c = z->l - m9;
+                    if (!(eq_s_b(z, 2, s_9))) goto lab10;
+                    if (!(z->I[1] <= z->c)) goto lab10;
+                    {   int m_test12 = z->l - z->c;
+                        {   int m13 = z->l - z->c; (void)m13;
+                            if (!(eq_s_b(z, 2, s_10))) goto lab11;
+                            goto lab10;
+                        lab11:
+                            z->c = z->l - m13;
+                        }
+                        if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab10;
+                        z->c = z->l - m_test12;
+                    }
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab7;
+                lab10:
+                    z->c = z->l - m9;
+                    if (!(z->I[1] <= z->c)) goto lab4;
+                    {   int m_test14 = z->l - z->c;
+                        {   int m15 = z->l - z->c; (void)m15;
+                            if (!(eq_s_b(z, 2, s_11))) goto lab12;
+                            goto lab4;
+                        lab12:
+                            z->c = z->l - m15;
+                        }
+                        if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab4;
+                        z->c = z->l - m_test14;
+                    }
+                    {   int ret = slice_from_s(z, 1, s_12);
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab7:
+                break;
+            case 5:
+                if (!(z->I[1] <= z->c)) goto lab4;
+                {   int m_test16 = z->l - z->c;
+                    {   int m17 = z->l - z->c; (void)m17;
+                        if (in_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab14;
+                        goto lab13;
+                    lab14:
+                        z->c = z->l - m17;
+                        if (!(eq_s_b(z, 2, s_13))) goto lab4;
+                    }
+                lab13:
+                    z->c = z->l - m_test16;
+                }
+                {   int ret = slice_from_s(z, 2, s_14);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {   int m18 = z->l - z->c; (void)m18;
+                    if (!(eq_s_b(z, 3, s_15))) goto lab16;
+                    if (!(z->I[1] <= z->c)) goto lab16;
+                    z->bra = z->c;
+                    {   int ret = slice_from_s(z, 4, s_16);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab15;
+                lab16:
+                    z->c = z->l - m18;
+                    if (!(eq_s_b(z, 2, s_17))) goto lab17;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab15;
+                lab17:
+                    z->c = z->l - m18;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'd') goto lab18;
+                    z->c--;
+                    if (!(z->I[1] <= z->c)) goto lab18;
+                    {   int m_test19 = z->l - z->c;
+                        {   int m20 = z->l - z->c; (void)m20;
+                            if (!(eq_s_b(z, 2, s_18))) goto lab19;
+                            goto lab18;
+                        lab19:
+                            z->c = z->l - m20;
+                        }
+                        if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab18;
+                        z->c = z->l - m_test19;
+                    }
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab15;
+                lab18:
+                    z->c = z->l - m18;
+                    {   int m21 = z->l - z->c; (void)m21;
+                        if (z->c <= z->lb || z->p[z->c - 1] != 'i') goto lab22;
+                        z->c--;
+                        goto lab21;
+                    lab22:
+                        z->c = z->l - m21;
+                        if (z->c <= z->lb || z->p[z->c - 1] != 'j') goto lab20;
+                        z->c--;
+                    }
+                lab21:
+                    {   int m_test22 = z->l - z->c;
+                        {   int m23 = z->l - z->c; (void)m23;
+                            if (in_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab24;
+                            goto lab23;
+                        lab24:
+                            z->c = z->l - m23;
+                            if (!(eq_s_b(z, 2, s_19))) goto lab20;
+                        }
+                    lab23:
+                        z->c = z->l - m_test22;
+                    }
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab15;
+                lab20:
+                    z->c = z->l - m18;
+                    if (!(z->I[1] <= z->c)) goto lab4;
+                    {   int m_test24 = z->l - z->c;
+                        {   int m25 = z->l - z->c; (void)m25;
+                            if (!(eq_s_b(z, 2, s_20))) goto lab25;
+                            goto lab4;
+                        lab25:
+                            z->c = z->l - m25;
+                        }
+                        if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab4;
+                        z->c = z->l - m_test24;
+                    }
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int ret = r_lengthen_V(z);
+                        if (ret == 0) goto lab4;
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab15:
+                break;
+            case 7:
+                {   int ret = slice_from_s(z, 2, s_21);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+        z->I[3] = 1;
+    lab4:
+        z->c = z->l - m5;
+    }
+    {   int m26 = z->l - z->c; (void)m26;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] != 101 || z->p[z->c - 2] >> 5 != 3 || !((6053264 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab26;
+        among_var = find_among_b_1(z);
+        if (!(among_var)) goto lab26;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {   int m27 = z->l - z->c; (void)m27;
+                    if (!(eq_s_b(z, 2, s_22))) goto lab28;
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab27;
+                lab28:
+                    z->c = z->l - m27;
+                    if (!(eq_s_b(z, 2, s_23))) goto lab29;
+                    z->bra = z->c;
+                    if (!(z->I[1] <= z->c)) goto lab29;
+                    {   int m_test28 = z->l - z->c;
+                        {   int m29 = z->l - z->c; (void)m29;
+                            if (!(eq_s_b(z, 2, s_24))) goto lab30;
+                            goto lab29;
+                        lab30:
+                            z->c = z->l - m29;
+                        }
+                        if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab29;
+                        z->c = z->l - m_test28;
+                    }
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab27;
+                lab29:
+                    z->c = z->l - m27;
+                    if (!(eq_s_b(z, 3, s_25))) goto lab31;
+                    z->bra = z->c;
+                    {   int ret = slice_from_s(z, 2, s_26);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab27;
+                lab31:
+                    z->c = z->l - m27;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 't') goto lab32;
+                    z->c--;
+                    z->bra = z->c;
+                    if (!(z->I[1] <= z->c)) goto lab32;
+                    {   int m_test30 = z->l - z->c;
+                        {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+                            if (ret < 0) goto lab32;
+                            z->c = ret;
+                        }
+                        {   int m31 = z->l - z->c; (void)m31;
+                            if (in_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab34;
+                            goto lab33;
+                        lab34:
+                            z->c = z->l - m31;
+                            if (!(eq_s_b(z, 2, s_27))) goto lab32;
+                        }
+                    lab33:
+                        z->c = z->l - m_test30;
+                    }
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab27;
+                lab32:
+                    z->c = z->l - m27;
+                    if (!(eq_s_b(z, 3, s_28))) goto lab35;
+                    z->bra = z->c;
+                    {   int ret = slice_from_s(z, 3, s_29);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab27;
+                lab35:
+                    z->c = z->l - m27;
+                    if (!(eq_s_b(z, 2, s_30))) goto lab36;
+                    z->bra = z->c;
+                    {   int ret = slice_from_s(z, 1, s_31);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab27;
+                lab36:
+                    z->c = z->l - m27;
+                    if (z->c <= z->lb || z->p[z->c - 1] != '\'') goto lab37;
+                    z->c--;
+                    z->bra = z->c;
+                    if (!(z->I[1] <= z->c)) goto lab37;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab27;
+                lab37:
+                    z->c = z->l - m27;
+                    z->bra = z->c;
+                    if (!(z->I[1] <= z->c)) goto lab26;
+                    {   int m_test32 = z->l - z->c;
+                        {   int m33 = z->l - z->c; (void)m33;
+                            if (!(eq_s_b(z, 2, s_32))) goto lab38;
+                            goto lab26;
+                        lab38:
+                            z->c = z->l - m33;
+                        }
+                        if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab26;
+                        z->c = z->l - m_test32;
+                    }
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab27:
+                break;
+            case 2:
+                if (!(z->I[1] <= z->c)) goto lab26;
+                {   int ret = slice_from_s(z, 1, s_33);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                if (!(z->I[1] <= z->c)) goto lab26;
+                {   int ret = slice_from_s(z, 4, s_34);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                if (!(z->I[1] <= z->c)) goto lab26;
+                {   int ret = slice_from_s(z, 4, s_35);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                if (!(z->I[1] <= z->c)) goto lab26;
+                {   int m_test34 = z->l - z->c;
+                    {   int m35 = z->l - z->c; (void)m35;
+                        if (!(eq_s_b(z, 2, s_36))) goto lab39;
+                        goto lab26;
+                    lab39:
+                        z->c = z->l - m35;
+                    }
+                    if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab26;
+                    z->c = z->l - m_test34;
+                }
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                if (!(z->I[1] <= z->c)) goto lab26;
+                {   int ret = slice_from_s(z, 1, s_37);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                if (!(z->I[1] <= z->c)) goto lab26;
+                {   int ret = slice_from_s(z, 1, s_38);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 8:
+                if (!(z->I[1] <= z->c)) goto lab26;
+                {   int ret = slice_from_s(z, 1, s_39);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 9:
+                if (!(z->I[1] <= z->c)) goto lab26;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int ret;
+                    ret = insert_s(z, z->c, z->c, 1, s_40);
+                    if (ret < 0) return ret;
+                }
+                {   int ret = r_lengthen_V(z);
+                    if (ret == 0) goto lab26;
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 10:
+                if (!(z->I[1] <= z->c)) goto lab26;
+                {   int m_test36 = z->l - z->c;
+                    {   int m37 = z->l - z->c; (void)m37;
+                        if (!(eq_s_b(z, 2, s_41))) goto lab40;
+                        goto lab26;
+                    lab40:
+                        z->c = z->l - m37;
+                    }
+                    if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab26;
+                    z->c = z->l - m_test36;
+                }
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int ret;
+                    ret = insert_s(z, z->c, z->c, 2, s_42);
+                    if (ret < 0) return ret;
+                }
+                {   int ret = r_lengthen_V(z);
+                    if (ret == 0) goto lab26;
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 11:
+                if (!(z->I[1] <= z->c)) goto lab26;
+                {   int m_test38 = z->l - z->c;
+                    {   int m39 = z->l - z->c; (void)m39;
+                        if (!(eq_s_b(z, 2, s_43))) goto lab41;
+                        goto lab26;
+                    lab41:
+                        z->c = z->l - m39;
+                    }
+                    if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab26;
+                    z->c = z->l - m_test38;
+                }
+                {   int ret = slice_from_s(z, 3, s_44);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+        z->I[3] = 1;
+    lab26:
+        z->c = z->l - m26;
+    }
+    {   int m40 = z->l - z->c; (void)m40;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1316016 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((549408 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab42;
+        among_var = find_among_b_2(z);
+        if (!(among_var)) goto lab42;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(z->I[1] <= z->c)) goto lab42;
+                {   int ret = slice_from_s(z, 3, s_45);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                if (!(z->I[1] <= z->c)) goto lab42;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int ret = r_lengthen_V(z);
+                    if (ret == 0) goto lab42;
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                if (!(z->I[1] <= z->c)) goto lab42;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                {   int ret = slice_from_s(z, 1, s_46);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                if (!(z->I[1] <= z->c)) goto lab42;
+                {   int m_test41 = z->l - z->c;
+                    {   int m42 = z->l - z->c; (void)m42;
+                        if (!(eq_s_b(z, 2, s_47))) goto lab43;
+                        goto lab42;
+                    lab43:
+                        z->c = z->l - m42;
+                    }
+                    if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab42;
+                    z->c = z->l - m_test41;
+                }
+                {   int ret = slice_from_s(z, 3, s_48);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                if (!(z->I[0] <= z->c)) goto lab42;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int ret;
+                    ret = insert_s(z, z->c, z->c, 1, s_49);
+                    if (ret < 0) return ret;
+                }
+                {   int ret = r_lengthen_V(z);
+                    if (ret == 0) goto lab42;
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                if (!(z->I[0] <= z->c)) goto lab42;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int ret;
+                    ret = insert_s(z, z->c, z->c, 1, s_50);
+                    if (ret < 0) return ret;
+                }
+                {   int ret = r_lengthen_V(z);
+                    if (ret == 0) goto lab42;
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 8:
+                if (!(z->I[1] <= z->c)) goto lab42;
+                {   int m_test43 = z->l - z->c;
+                    {   int m44 = z->l - z->c; (void)m44;
+                        if (!(eq_s_b(z, 2, s_51))) goto lab44;
+                        goto lab42;
+                    lab44:
+                        z->c = z->l - m44;
+                    }
+                    if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab42;
+                    z->c = z->l - m_test43;
+                }
+                {   int ret = slice_from_s(z, 1, s_52);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 9:
+                if (!(z->I[1] <= z->c)) goto lab42;
+                {   int m_test45 = z->l - z->c;
+                    {   int m46 = z->l - z->c; (void)m46;
+                        if (!(eq_s_b(z, 2, s_53))) goto lab45;
+                        goto lab42;
+                    lab45:
+                        z->c = z->l - m46;
+                    }
+                    if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab42;
+                    z->c = z->l - m_test45;
+                }
+                {   int ret = slice_from_s(z, 1, s_54);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+        z->I[3] = 1;
+    lab42:
+        z->c = z->l - m40;
+    }
+    {   int m47 = z->l - z->c; (void)m47;
+        {   int m48 = z->l - z->c; (void)m48;
+            z->ket = z->c;
+            if (z->c - 2 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1315024 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((541218 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab48;
+            among_var = find_among_b_3(z);
+            if (!(among_var)) goto lab48;
+            z->bra = z->c;
+            switch (among_var) {
+                case 1:
+                    if (!(z->I[1] <= z->c)) goto lab48;
+                    {   int ret = slice_from_s(z, 2, s_55);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    if (!(z->I[1] <= z->c)) goto lab48;
+                    {   int ret = slice_from_s(z, 3, s_56);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 3:
+                    if (!(z->I[1] <= z->c)) goto lab48;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 4:
+                    if (!(z->I[1] <= z->c)) goto lab48;
+                    {   int m_test49 = z->l - z->c;
+                        {   int m50 = z->l - z->c; (void)m50;
+                            if (in_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab50;
+                            goto lab49;
+                        lab50:
+                            z->c = z->l - m50;
+                            if (!(eq_s_b(z, 2, s_57))) goto lab48;
+                        }
+                    lab49:
+                        z->c = z->l - m_test49;
+                    }
+                    {   int ret = slice_from_s(z, 1, s_58);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 5:
+                    if (!(z->I[1] <= z->c)) goto lab48;
+                    {   int m_test51 = z->l - z->c;
+                        {   int m52 = z->l - z->c; (void)m52;
+                            if (in_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab52;
+                            goto lab51;
+                        lab52:
+                            z->c = z->l - m52;
+                            if (!(eq_s_b(z, 2, s_59))) goto lab48;
+                        }
+                    lab51:
+                        z->c = z->l - m_test51;
+                    }
+                    {   int ret = slice_from_s(z, 1, s_60);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 6:
+                    if (!(z->I[1] <= z->c)) goto lab48;
+                    {   int m_test53 = z->l - z->c;
+                        {   int m54 = z->l - z->c; (void)m54;
+                            if (in_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab54;
+                            goto lab53;
+                        lab54:
+                            z->c = z->l - m54;
+                            if (!(eq_s_b(z, 2, s_61))) goto lab48;
+                        }
+                    lab53:
+                        z->c = z->l - m_test53;
+                    }
+                    {   int ret = slice_from_s(z, 1, s_62);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 7:
+                    if (!(z->I[1] <= z->c)) goto lab48;
+                    {   int ret = slice_from_s(z, 4, s_63);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 8:
+                    if (!(z->I[1] <= z->c)) goto lab48;
+                    {   int ret = slice_from_s(z, 4, s_64);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 9:
+                    if (!(z->I[1] <= z->c)) goto lab48;
+                    {   int m_test55 = z->l - z->c;
+                        {   int m56 = z->l - z->c; (void)m56;
+                            if (!(eq_s_b(z, 2, s_65))) goto lab55;
+                            goto lab48;
+                        lab55:
+                            z->c = z->l - m56;
+                        }
+                        if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab48;
+                        z->c = z->l - m_test55;
+                    }
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int ret = r_lengthen_V(z);
+                        if (ret == 0) goto lab48;
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+            goto lab47;
+        lab48:
+            z->c = z->l - m48;
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1310848 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((524832 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab46;
+            if (!(find_among_b_4(z))) goto lab46;
+            z->bra = z->c;
+            if (!(z->I[1] <= z->c)) goto lab46;
+            {   int m_test57 = z->l - z->c;
+                {   int m58 = z->l - z->c; (void)m58;
+                    if (!(eq_s_b(z, 2, s_66))) goto lab56;
+                    goto lab46;
+                lab56:
+                    z->c = z->l - m58;
+                }
+                if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab46;
+                z->c = z->l - m_test57;
+            }
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            {   int ret = r_lengthen_V(z);
+                if (ret == 0) goto lab46;
+                if (ret < 0) return ret;
+            }
+        }
+    lab47:
+        z->I[3] = 1;
+    lab46:
+        z->c = z->l - m47;
+    }
+    z->c = z->lb;
+    z->I[2] = 0;
+    {   int c59 = z->c;
+        {   int c60 = z->c;
+            z->bra = z->c;
+            if (!(eq_s(z, 2, s_67))) goto lab57;
+            z->ket = z->c;
+            {   int c_test61 = z->c;
+                {   int ret = hop_utf8(z, z->c, z->l, 3);
+                    if (ret < 0) goto lab57;
+                    z->c = ret;
+                }
+                z->c = c_test61;
+            }
+            if (out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 121) < 0) goto lab57;
+            if (in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 121) < 0) goto lab57;
+            z->I[2] = 1;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            z->c = c60;
+            {   int ret = r_measure(z);
+                if (ret == 0) goto lab57;
+                if (ret < 0) return ret;
+            }
+        }
+    lab57:
+        z->c = c59;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m62 = z->l - z->c; (void)m62;
+        if (!(z->I[2])) goto lab58;
+        {   int ret = r_Step_1c(z);
+            if (ret == 0) goto lab58;
+            if (ret < 0) return ret;
+        }
+    lab58:
+        z->c = z->l - m62;
+    }
+    z->c = z->lb;
+    z->I[2] = 0;
+    {   int c63 = z->c;
+        {   int c64 = z->c;
+            {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                if (ret < 0) goto lab59;
+                z->c = ret;
+            }
+            while(1) {
+                z->bra = z->c;
+                if (!(eq_s(z, 2, s_68))) goto lab60;
+                z->ket = z->c;
+                break;
+            lab60:
+                {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                    if (ret < 0) goto lab59;
+                    z->c = ret;
+                }
+            }
+            {   int c_test65 = z->c;
+                {   int ret = hop_utf8(z, z->c, z->l, 3);
+                    if (ret < 0) goto lab59;
+                    z->c = ret;
+                }
+                z->c = c_test65;
+            }
+            if (out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 121) < 0) goto lab59;
+            if (in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 121) < 0) goto lab59;
+            z->I[2] = 1;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            z->c = c64;
+            {   int ret = r_measure(z);
+                if (ret == 0) goto lab59;
+                if (ret < 0) return ret;
+            }
+        }
+    lab59:
+        z->c = c63;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m66 = z->l - z->c; (void)m66;
+        if (!(z->I[2])) goto lab61;
+        {   int ret = r_Step_1c(z);
+            if (ret == 0) goto lab61;
+            if (ret < 0) return ret;
+        }
+    lab61:
+        z->c = z->l - m66;
+    }
+    z->c = z->lb;
+    z->lb = z->c; z->c = z->l;
+
+    {   int m67 = z->l - z->c; (void)m67;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] != 116 || z->p[z->c - 2] >> 5 != 3 || !((67648 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab62;
+        among_var = find_among_b_5(z);
+        if (!(among_var)) goto lab62;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 1, s_69);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 1, s_70);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 1, s_71);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+        z->I[3] = 1;
+    lab62:
+        z->c = z->l - m67;
+    }
+    {   int m68 = z->l - z->c; (void)m68;
+        
+        if (!(z->I[3])) goto lab65;
+        goto lab64;
+    lab65:
+        if (!(z->I[2])) goto lab63;
+    lab64:
+        z->ket = z->c;
+        if (z->c <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((98532828 >> (z->p[z->c - 1] & 0x1f)) & 1)) goto lab63;
+        among_var = find_among_b_6(z);
+        if (!(among_var)) goto lab63;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 1, s_72);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 1, s_73);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 1, s_74);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                {   int ret = slice_from_s(z, 1, s_75);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                {   int ret = slice_from_s(z, 1, s_76);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {   int ret = slice_from_s(z, 1, s_77);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                {   int ret = slice_from_s(z, 1, s_78);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 8:
+                {   int ret = slice_from_s(z, 1, s_79);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 9:
+                {   int ret = slice_from_s(z, 1, s_80);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 10:
+                {   int ret = slice_from_s(z, 1, s_81);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 11:
+                {   int ret = slice_from_s(z, 1, s_82);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 12:
+                {   int ret = slice_from_s(z, 1, s_83);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 13:
+                {   int ret = slice_from_s(z, 1, s_84);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 14:
+                {   int ret = slice_from_s(z, 1, s_85);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 15:
+                {   int ret = slice_from_s(z, 1, s_86);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 16:
+                {   int ret = slice_from_s(z, 1, s_87);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 17:
+                {   int ret = slice_from_s(z, 1, s_88);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 18:
+                {   int ret = slice_from_s(z, 1, s_89);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 19:
+                {   int ret = slice_from_s(z, 1, s_90);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 20:
+                {   int ret = slice_from_s(z, 1, s_91);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab63:
+        z->c = z->l - m68;
+    }
+    z->c = z->lb;
+    {   int c69 = z->c;
+        if (!(z->I[4])) goto lab66;
+        while(1) {
+            int c70 = z->c;
+            while(1) {
+                int c71 = z->c;
+                z->bra = z->c;
+                if (z->c == z->l || z->p[z->c] != 'Y') goto lab68;
+                z->c++;
+                z->ket = z->c;
+                z->c = c71;
+                break;
+            lab68:
+                z->c = c71;
+                {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                    if (ret < 0) goto lab67;
+                    z->c = ret;
+                }
+            }
+            {   int ret = slice_from_s(z, 1, s_92);
+                if (ret < 0) return ret;
+            }
+            continue;
+        lab67:
+            z->c = c70;
+            break;
+        }
+    lab66:
+        z->c = c69;
+    }
+    return 1;
+}
+
+extern struct SN_env * kraaij_pohlmann_UTF_8_create_env(void) { return SN_create_env(1, 5); }
+
+extern void kraaij_pohlmann_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 1); }
+
@@ -0,0 +1,3738 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int lovins_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+static int r_CC(struct SN_env * z);
+static int r_BB(struct SN_env * z);
+static int r_AA(struct SN_env * z);
+static int r_Z(struct SN_env * z);
+static int r_Y(struct SN_env * z);
+static int r_X(struct SN_env * z);
+static int r_W(struct SN_env * z);
+static int r_V(struct SN_env * z);
+static int r_U(struct SN_env * z);
+static int r_T(struct SN_env * z);
+static int r_S(struct SN_env * z);
+static int r_R(struct SN_env * z);
+static int r_Q(struct SN_env * z);
+static int r_P(struct SN_env * z);
+static int r_O(struct SN_env * z);
+static int r_N(struct SN_env * z);
+static int r_M(struct SN_env * z);
+static int r_L(struct SN_env * z);
+static int r_K(struct SN_env * z);
+static int r_J(struct SN_env * z);
+static int r_I(struct SN_env * z);
+static int r_H(struct SN_env * z);
+static int r_G(struct SN_env * z);
+static int r_F(struct SN_env * z);
+static int r_E(struct SN_env * z);
+static int r_D(struct SN_env * z);
+static int r_C(struct SN_env * z);
+static int r_B(struct SN_env * z);
+static int r_A(struct SN_env * z);
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * lovins_UTF_8_create_env(void);
+extern void lovins_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[9] =
+{
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 1, -1, -1 }
+};
+
+
+static const struct among a_1[294] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 1, 1 },
+{ 0, 3, 1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 4, 1 },
+{ 0, 5, 4, 1 },
+{ 0, 4, 4, 1 },
+{ 0, 4, 4, 1 },
+{ 0, 4, 4, 1 },
+{ 0, 5, 4, 1 },
+{ 0, 5, 4, 1 },
+{ 0, 7, 11, 1 },
+{ 0, 7, 11, 1 },
+{ 0, 7, 11, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 15, 1 },
+{ 0, 5, 15, 1 },
+{ 0, 5, 15, 1 },
+{ 0, 3, 15, 1 },
+{ 0, 4, 15, 1 },
+{ 0, 5, 15, 1 },
+{ 0, 4, 15, 1 },
+{ 0, 5, 15, 1 },
+{ 0, 4, 15, 1 },
+{ 0, 6, 24, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 26, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 28, 1 },
+{ 0, 5, 28, 1 },
+{ 0, 7, 30, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 33, 1 },
+{ 0, 4, 33, 1 },
+{ 0, 6, 35, 1 },
+{ 0, 4, 33, 1 },
+{ 0, 3, 33, 1 },
+{ 0, 5, 38, 1 },
+{ 0, 5, 38, 1 },
+{ 0, 3, 33, 1 },
+{ 0, 4, 33, 1 },
+{ 0, 6, 42, 1 },
+{ 0, 6, 42, 1 },
+{ 0, 8, 44, 1 },
+{ 0, 4, 33, 1 },
+{ 0, 7, 46, 1 },
+{ 0, 3, 33, 1 },
+{ 0, 3, 33, 1 },
+{ 0, 5, 49, 1 },
+{ 0, 3, 33, 1 },
+{ 0, 5, 33, 1 },
+{ 0, 6, 52, 1 },
+{ 0, 3, 33, 1 },
+{ 0, 4, 33, 1 },
+{ 0, 3, 33, 1 },
+{ 0, 7, 56, 1 },
+{ 0, 5, 56, 1 },
+{ 0, 6, 56, 1 },
+{ 0, 3, 33, 1 },
+{ 0, 3, 33, 1 },
+{ 0, 5, 61, 1 },
+{ 0, 3, 33, 1 },
+{ 0, 5, 63, 1 },
+{ 0, 7, 64, 1 },
+{ 0, 6, 64, 1 },
+{ 0, 9, 66, 1 },
+{ 0, 8, 64, 1 },
+{ 0, 5, 63, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, 70, 1 },
+{ 0, 6, 70, 1 },
+{ 0, 5, 70, 1 },
+{ 0, 5, 70, 1 },
+{ 0, 6, 70, 1 },
+{ 0, 5, 70, 1 },
+{ 0, 6, 70, 1 },
+{ 0, 4, 70, 1 },
+{ 0, 5, 70, 1 },
+{ 0, 7, 79, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 81, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 84, 1 },
+{ 0, 5, 85, 1 },
+{ 0, 7, 85, 1 },
+{ 0, 5, 84, 1 },
+{ 0, 3, 84, 1 },
+{ 0, 3, 84, 1 },
+{ 0, 6, 90, 1 },
+{ 0, 5, 90, 1 },
+{ 0, 6, 90, 1 },
+{ 0, 5, 84, 1 },
+{ 0, 7, 94, 1 },
+{ 0, 9, 95, 1 },
+{ 0, 5, 84, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 98, 1 },
+{ 0, 4, 98, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 102, 1 },
+{ 0, 6, 102, 1 },
+{ 0, 5, 102, 1 },
+{ 0, 7, 105, 1 },
+{ 0, 8, 105, 1 },
+{ 0, 5, 102, 1 },
+{ 0, 7, 102, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 110, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 112, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 114, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 116, 1 },
+{ 0, 5, 117, 1 },
+{ 0, 7, 118, 1 },
+{ 0, 9, 118, 1 },
+{ 0, 7, 118, 1 },
+{ 0, 7, 118, 1 },
+{ 0, 9, 122, 1 },
+{ 0, 8, 118, 1 },
+{ 0, 7, 118, 1 },
+{ 0, 9, 125, 1 },
+{ 0, 6, 117, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 129, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 133, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 135, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 137, 1 },
+{ 0, 2, 137, 1 },
+{ 0, 3, 137, 1 },
+{ 0, 6, 140, 1 },
+{ 0, 2, 137, 1 },
+{ 0, 5, 142, 1 },
+{ 0, 5, 142, 1 },
+{ 0, 4, 142, 1 },
+{ 0, 5, 145, 1 },
+{ 0, 4, 142, 1 },
+{ 0, 3, 142, 1 },
+{ 0, 5, 148, 1 },
+{ 0, 6, 148, 1 },
+{ 0, 6, 148, 1 },
+{ 0, 5, 148, 1 },
+{ 0, 5, 148, 1 },
+{ 0, 7, 153, 1 },
+{ 0, 7, 153, 1 },
+{ 0, 4, 142, 1 },
+{ 0, 6, 142, 1 },
+{ 0, 4, 142, 1 },
+{ 0, 6, 142, 1 },
+{ 0, 4, 137, 1 },
+{ 0, 2, 137, 1 },
+{ 0, 3, 137, 1 },
+{ 0, 4, 162, 1 },
+{ 0, 7, 163, 1 },
+{ 0, 6, 162, 1 },
+{ 0, 4, 137, 1 },
+{ 0, 4, 137, 1 },
+{ 0, 6, 167, 1 },
+{ 0, 4, 137, 1 },
+{ 0, 6, 169, 1 },
+{ 0, 10, 170, 1 },
+{ 0, 9, 170, 1 },
+{ 0, 8, 170, 1 },
+{ 0, 10, 173, 1 },
+{ 0, 3, 137, 1 },
+{ 0, 4, 137, 1 },
+{ 0, 5, 137, 1 },
+{ 0, 5, 137, 1 },
+{ 0, 4, 137, 1 },
+{ 0, 5, 179, 1 },
+{ 0, 4, 137, 1 },
+{ 0, 5, 181, 1 },
+{ 0, 8, 182, 1 },
+{ 0, 9, 183, 1 },
+{ 0, 8, 182, 1 },
+{ 0, 7, 182, 1 },
+{ 0, 7, 182, 1 },
+{ 0, 7, 182, 1 },
+{ 0, 9, 188, 1 },
+{ 0, 7, 181, 1 },
+{ 0, 7, 181, 1 },
+{ 0, 5, 181, 1 },
+{ 0, 7, 192, 1 },
+{ 0, 6, 181, 1 },
+{ 0, 8, 194, 1 },
+{ 0, 10, 194, 1 },
+{ 0, 10, 194, 1 },
+{ 0, 9, 194, 1 },
+{ 0, 7, 181, 1 },
+{ 0, 8, 181, 1 },
+{ 0, 7, 181, 1 },
+{ 0, 8, 201, 1 },
+{ 0, 8, 201, 1 },
+{ 0, 9, 201, 1 },
+{ 0, 7, 181, 1 },
+{ 0, 4, 137, 1 },
+{ 0, 4, 137, 1 },
+{ 0, 6, 207, 1 },
+{ 0, 2, 137, 1 },
+{ 0, 3, 209, 1 },
+{ 0, 4, 210, 1 },
+{ 0, 6, 211, 1 },
+{ 0, 9, 211, 1 },
+{ 0, 4, 210, 1 },
+{ 0, 6, 214, 1 },
+{ 0, 5, 210, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 217, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 219, 1 },
+{ 0, 7, 220, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 222, 1 },
+{ 0, 5, 222, 1 },
+{ 0, 7, 224, 1 },
+{ 0, 6, 224, 1 },
+{ 0, 6, 222, 1 },
+{ 0, 6, 222, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 3, 229, 1 },
+{ 0, 4, 229, 1 },
+{ 0, 4, 229, 1 },
+{ 0, 2, 229, 1 },
+{ 0, 4, 233, 1 },
+{ 0, 4, 233, 1 },
+{ 0, 4, 233, 1 },
+{ 0, 4, 233, 1 },
+{ 0, 5, 237, 1 },
+{ 0, 3, 233, 1 },
+{ 0, 5, 239, 1 },
+{ 0, 5, 239, 1 },
+{ 0, 7, 241, 1 },
+{ 0, 5, 233, 1 },
+{ 0, 7, 243, 1 },
+{ 0, 3, 233, 1 },
+{ 0, 4, 245, 1 },
+{ 0, 5, 245, 1 },
+{ 0, 4, 233, 1 },
+{ 0, 6, 248, 1 },
+{ 0, 7, 249, 1 },
+{ 0, 9, 249, 1 },
+{ 0, 9, 249, 1 },
+{ 0, 11, 252, 1 },
+{ 0, 7, 248, 1 },
+{ 0, 5, 248, 1 },
+{ 0, 8, 255, 1 },
+{ 0, 7, 248, 1 },
+{ 0, 9, 257, 1 },
+{ 0, 11, 258, 1 },
+{ 0, 7, 248, 1 },
+{ 0, 5, 233, 1 },
+{ 0, 6, 261, 1 },
+{ 0, 6, 261, 1 },
+{ 0, 4, 233, 1 },
+{ 0, 4, 233, 1 },
+{ 0, 5, 265, 1 },
+{ 0, 6, 233, 1 },
+{ 0, 5, 233, 1 },
+{ 0, 6, 268, 1 },
+{ 0, 6, 268, 1 },
+{ 0, 5, 233, 1 },
+{ 0, 3, 229, 1 },
+{ 0, 3, 229, 1 },
+{ 0, 7, 229, 1 },
+{ 0, 5, 229, 1 },
+{ 0, 3, 229, 1 },
+{ 0, 5, 276, 1 },
+{ 0, 5, 276, 1 },
+{ 0, 4, 276, 1 },
+{ 0, 5, 276, 1 },
+{ 0, 7, 280, 1 },
+{ 0, 6, 280, 1 },
+{ 0, 9, 282, 1 },
+{ 0, 9, 282, 1 },
+{ 0, 8, 280, 1 },
+{ 0, 5, 276, 1 },
+{ 0, 7, 276, 1 },
+{ 0, 9, 287, 1 },
+{ 0, 11, 288, 1 },
+{ 0, 7, 276, 1 },
+{ 0, 5, 276, 1 },
+{ 0, 5, 276, 1 },
+{ 0, 5, 276, 1 }
+};
+
+static int (* const a_1_functions[294])(struct SN_env *) = {
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_BB,
+    r_A,
+    r_B,
+    r_H,
+    r_C,
+    r_A,
+    r_B,
+    r_A,
+    r_A,
+    r_E,
+    r_B,
+    r_A,
+    r_A,
+    r_A,
+    r_E,
+    r_A,
+    r_I,
+    r_C,
+    r_F,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_E,
+    r_A,
+    r_A,
+    r_A,
+    r_B,
+    r_A,
+    r_A,
+    r_L,
+    r_A,
+    r_A,
+    r_B,
+    r_A,
+    r_A,
+    r_E,
+    r_A,
+    r_A,
+    r_A,
+    r_E,
+    r_M,
+    r_I,
+    r_R,
+    r_E,
+    r_Z,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_D,
+    r_AA,
+    r_A,
+    r_A,
+    r_F,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_N,
+    r_B,
+    r_A,
+    r_B,
+    r_E,
+    r_A,
+    r_I,
+    r_C,
+    r_B,
+    r_F,
+    r_A,
+    r_C,
+    r_A,
+    r_A,
+    r_BB,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_Y,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_B,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_R,
+    r_B,
+    r_A,
+    r_A,
+    r_B,
+    r_A,
+    r_A,
+    r_J,
+    r_A,
+    r_U,
+    r_A,
+    r_A,
+    r_A,
+    r_F,
+    r_A,
+    r_S,
+    r_Q,
+    r_B,
+    r_G,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_F,
+    r_A,
+    r_G,
+    r_A,
+    r_X,
+    r_Y,
+    r_A,
+    r_A,
+    r_F,
+    r_A,
+    r_T,
+    r_A,
+    r_W,
+    r_A,
+    r_B,
+    r_A,
+    r_A,
+    r_E,
+    r_B,
+    r_A,
+    r_L,
+    r_A,
+    r_B,
+    r_P,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_M,
+    r_A,
+    r_A,
+    r_A,
+    r_N,
+    r_A,
+    r_BB,
+    r_A,
+    r_A,
+    r_A,
+    r_B,
+    r_A,
+    r_A,
+    r_B,
+    r_B,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_O,
+    r_A,
+    r_F,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_E,
+    r_A,
+    r_E,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_E,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_B,
+    r_A,
+    r_A,
+    r_V,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_B,
+    r_A,
+    r_B,
+    r_A,
+    r_C,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_B,
+    r_A,
+    r_B,
+    r_A,
+    r_B,
+    r_Y,
+    r_A,
+    r_A,
+    r_E,
+    r_A,
+    r_E,
+    r_A,
+    r_A,
+    r_A,
+    r_B,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_B,
+    r_A,
+    r_A,
+    r_C,
+    r_A,
+    r_B,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_B,
+    r_B,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_E,
+    r_K,
+    r_Y,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_F,
+    r_E,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_A,
+    r_CC,
+    r_B,
+    r_A
+};
+
+
+static const struct among a_2[10] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 }
+};
+
+
+static const struct among a_3[34] =
+{
+{ 0, 3, -1, 18 },
+{ 0, 3, -1, 19 },
+{ 0, 3, -1, 20 },
+{ 0, 3, -1, 21 },
+{ 0, 4, -1, 22 },
+{ 0, 4, -1, 23 },
+{ 0, 3, -1, 24 },
+{ 0, 3, -1, 25 },
+{ 0, 3, -1, 26 },
+{ 0, 3, -1, 27 },
+{ 0, 2, -1, 9 },
+{ 0, 3, -1, 28 },
+{ 0, 4, -1, 7 },
+{ 0, 4, -1, 6 },
+{ 0, 3, -1, 5 },
+{ 0, 3, -1, 2 },
+{ 0, 2, -1, 32 },
+{ 0, 3, -1, 29 },
+{ 0, 3, -1, 30 },
+{ 0, 4, -1, 3 },
+{ 0, 3, -1, 4 },
+{ 0, 3, -1, 31 },
+{ 0, 2, -1, 33 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 8 },
+{ 0, 2, -1, 14 },
+{ 0, 2, -1, 15 },
+{ 0, 3, 26, 10 },
+{ 0, 3, 26, 11 },
+{ 0, 3, 26, 12 },
+{ 0, 3, 26, 13 },
+{ 0, 2, -1, 16 },
+{ 0, 3, -1, 17 },
+{ 0, 2, -1, 33 }
+};
+
+static const symbol s_0[] = { 'l', 'l' };
+static const symbol s_1[] = { 'd', 'r' };
+static const symbol s_2[] = { 'i', 'n' };
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                i = 0;
+                break;
+            case 'f':
+                i = 1;
+                break;
+            case 'h':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'p':
+                        i = 2;
+                        break;
+                    case 't':
+                        i = 3;
+                        break;
+                }
+                break;
+            case 'l':
+                i = 4;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        i = 5;
+                        break;
+                    case 'o':
+                        i = 6;
+                        break;
+                }
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 7;
+                break;
+            case 't':
+                i = 8;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_0[i].s_size;
+    return a_0[i].result;
+}
+static const symbol s_3[] = { 'm', 'e', 't' };
+static const symbol s_4[] = { 'r', 'y', 's', 't' };
+
+static const unsigned char a_1_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xBA, 0xF3, 0x1C, 0x2,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case '\'':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                i = 0;
+                break;
+            case 'a':
+                i = 1;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        i = 2;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 3;
+                        break;
+                }
+                break;
+            case 'c':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 4;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'a':
+                        i = 5;
+                        break;
+                    case 'l':
+                        if (n <= 3) break;
+                        if (q[-4] != 'l') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 6;
+                        break;
+                    case 'r':
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 7;
+                        break;
+                    case 't':
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 8;
+                                break;
+                            case 'i':
+                                i = 9;
+                                break;
+                            case 'n':
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 10;
+                                break;
+                            case 's':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 11;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'l':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'a') break;
+                                        i = 12;
+                                        break;
+                                    case 'r':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'a') break;
+                                        i = 13;
+                                        break;
+                                    case 'v':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'i') break;
+                                        i = 14;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'd':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        i = 15;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 16;
+                                        break;
+                                    case 'e':
+                                        i = 17;
+                                        break;
+                                }
+                                break;
+                            case 'h':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 18;
+                                break;
+                            case 'i':
+                                i = 19;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'e':
+                                        i = 20;
+                                        break;
+                                    case 'o':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 21;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 22;
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 23;
+                                        break;
+                                }
+                                break;
+                            case 'z':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 24;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                i = 25;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        i = 26;
+                        if (n <= 3) break;
+                        if (q[-4] != 'r') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 27;
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'h') break;
+                        i = 28;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'e':
+                                i = 29;
+                                break;
+                            case 'i':
+                                i = 30;
+                                if (n <= 5) break;
+                                if (q[-6] != 'l') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'e') break;
+                                i = 31;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'w') break;
+                        i = 32;
+                        break;
+                }
+                break;
+            case 'e':
+                i = 33;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 34;
+                        break;
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 35;
+                                if (n <= 4) break;
+                                if (q[-5] != 'c') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 36;
+                                break;
+                            case 'e':
+                                i = 37;
+                                break;
+                        }
+                        break;
+                    case 'd':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 38;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'c':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 39;
+                                break;
+                            case 't':
+                                if (n <= 4) break;
+                                if (q[-5] != 'o') break;
+                                i = 40;
+                                break;
+                        }
+                        break;
+                    case 'g':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 41;
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'b') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 42;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 't':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'a') break;
+                                        i = 43;
+                                        break;
+                                    case 'z':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'i') break;
+                                        i = 44;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'r') break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'a') break;
+                                        i = 45;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 46;
+                                if (n <= 4) break;
+                                if (q[-5] != 'c') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'n') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'e') break;
+                                i = 47;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 48;
+                                break;
+                            case 'i':
+                                i = 49;
+                                if (n <= 3) break;
+                                if (q[-4] != 'd') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 50;
+                                break;
+                            case 'o':
+                                i = 51;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'u') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 52;
+                        if (n <= 5) break;
+                        if (q[-6] != 'e') break;
+                        i = 53;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 54;
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 'w') break;
+                                i = 55;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 56;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 't') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'n') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'e') break;
+                                        i = 57;
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'i':
+                                                i = 58;
+                                                break;
+                                            case 'o':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 59;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 60;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 61;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 62;
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 63;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'l':
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 64;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'c':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'i') break;
+                                        i = 65;
+                                        break;
+                                    case 'i':
+                                        i = 66;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 't') break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'n') break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 'e') break;
+                                        i = 67;
+                                        break;
+                                    case 'n':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'o') break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'i') break;
+                                        i = 68;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 69;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 70;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'c':
+                        if (n <= 4) break;
+                        if (q[-5] != 'n') break;
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 'a':
+                                i = 71;
+                                break;
+                            case 'e':
+                                i = 72;
+                                break;
+                        }
+                        break;
+                    case 'g':
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 73;
+                        break;
+                    case 'n':
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'e':
+                                i = 74;
+                                break;
+                            case 'o':
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 75;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 76;
+                                break;
+                            case 'n':
+                                if (n <= 5) break;
+                                if (q[-6] != 'e') break;
+                                i = 77;
+                                break;
+                        }
+                        break;
+                    case 'y':
+                        i = 78;
+                        break;
+                    case 'z':
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 79;
+                        if (n <= 5) break;
+                        if (q[-6] != 'r') break;
+                        if (n <= 6) break;
+                        if (q[-7] != 'a') break;
+                        i = 80;
+                        break;
+                }
+                break;
+            case 'h':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 81;
+                if (n <= 3) break;
+                if (q[-4] != 'y') break;
+                i = 82;
+                break;
+            case 'i':
+                i = 83;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 84;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 85;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 86;
+                                        break;
+                                    case 't':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'i') break;
+                                        i = 87;
+                                        break;
+                                }
+                                break;
+                            case 'd':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'o') break;
+                                i = 88;
+                                break;
+                            case 'e':
+                                i = 89;
+                                break;
+                            case 'i':
+                                i = 90;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'n') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'a') break;
+                                        i = 91;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 92;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'n') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'e') break;
+                                        i = 93;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 94;
+                                if (n <= 5) break;
+                                if (q[-6] != 't') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'a') break;
+                                i = 95;
+                                if (n <= 7) break;
+                                if (q[-8] != 'z') break;
+                                if (n <= 8) break;
+                                if (q[-9] != 'i') break;
+                                i = 96;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 97;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 'f') break;
+                        i = 98;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'e':
+                                i = 99;
+                                break;
+                            case 'i':
+                                i = 100;
+                                break;
+                        }
+                        break;
+                    case 'y':
+                        i = 101;
+                        break;
+                }
+                break;
+            case 'm':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 102;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'c':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 103;
+                                break;
+                            case 'd':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'o') break;
+                                i = 104;
+                                break;
+                            case 'l':
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 105;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'c':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'i') break;
+                                        i = 106;
+                                        break;
+                                    case 'n':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'o') break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'i') break;
+                                        i = 107;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 108;
+                                break;
+                            case 'v':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 't') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'a') break;
+                                i = 109;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        i = 110;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 111;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 112;
+                        if (n <= 3) break;
+                        if (q[-4] != 'c') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 113;
+                        break;
+                    case 'e':
+                        i = 114;
+                        if (n <= 2) break;
+                        if (q[-3] != 'g') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'o') break;
+                        i = 115;
+                        break;
+                    case 'o':
+                        i = 116;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 117;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 118;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'c':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'i') break;
+                                        i = 119;
+                                        break;
+                                    case 'i':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 't') break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'n') break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 'e') break;
+                                        i = 120;
+                                        break;
+                                    case 'n':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'i') break;
+                                        i = 121;
+                                        break;
+                                    case 's':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'i') break;
+                                        i = 122;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'r') break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 'a') break;
+                                        i = 123;
+                                        break;
+                                    case 't':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'n') break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'e') break;
+                                        i = 124;
+                                        break;
+                                    case 'z':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'i') break;
+                                        i = 125;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'r') break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 'a') break;
+                                        i = 126;
+                                        break;
+                                }
+                                break;
+                            case 'c':
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                i = 127;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'o':
+                i = 128;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 129;
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 130;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                i = 131;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                i = 132;
+                                break;
+                            case 'z':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 133;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                i = 134;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        i = 135;
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 136;
+                        break;
+                }
+                break;
+            case 's':
+                i = 137;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case '\'':
+                        i = 138;
+                        break;
+                    case 'a':
+                        i = 139;
+                        break;
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 140;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 's') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'i') break;
+                        i = 141;
+                        break;
+                    case 'e':
+                        i = 142;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 143;
+                                        break;
+                                    case 'e':
+                                        i = 144;
+                                        break;
+                                }
+                                break;
+                            case 'd':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 145;
+                                if (n <= 4) break;
+                                if (q[-5] != 'o') break;
+                                i = 146;
+                                break;
+                            case 'g':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 147;
+                                break;
+                            case 'i':
+                                i = 148;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 149;
+                                                break;
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 150;
+                                                        break;
+                                                    case 'e':
+                                                        i = 151;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 152;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 153;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'l':
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'a') break;
+                                                i = 154;
+                                                break;
+                                            case 'v':
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'i') break;
+                                                i = 155;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 156;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'n') break;
+                                i = 157;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 158;
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                i = 159;
+                                break;
+                        }
+                        break;
+                    case 'g':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 160;
+                        break;
+                    case 'i':
+                        i = 161;
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 162;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'i':
+                                i = 163;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'n') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'e') break;
+                                i = 164;
+                                break;
+                            case 'n':
+                                if (n <= 4) break;
+                                if (q[-5] != 'o') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 165;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 166;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 167;
+                                if (n <= 4) break;
+                                if (q[-5] != 'c') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 168;
+                                break;
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 169;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                i = 170;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 's':
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'i') break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 'r') break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 'a') break;
+                                        i = 171;
+                                        break;
+                                    case 't':
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'n') break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 'e') break;
+                                        i = 172;
+                                        break;
+                                    case 'z':
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'i') break;
+                                        i = 173;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 'r') break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 'a') break;
+                                        i = 174;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 175;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 176;
+                                        break;
+                                    case 'z':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 177;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 178;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'l':
+                                i = 179;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 180;
+                                break;
+                            case 'n':
+                                i = 181;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'e':
+                                        i = 182;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'l':
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'b') break;
+                                                if (n <= 7) break;
+                                                switch (q[-8]) {
+                                                    case 'a':
+                                                        i = 183;
+                                                        if (n <= 8) break;
+                                                        if (q[-9] != 'e') break;
+                                                        i = 184;
+                                                        break;
+                                                    case 'i':
+                                                        i = 185;
+                                                        break;
+                                                }
+                                                break;
+                                            case 't':
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'a':
+                                                        i = 186;
+                                                        break;
+                                                    case 'i':
+                                                        i = 187;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'v':
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'i') break;
+                                                i = 188;
+                                                if (n <= 7) break;
+                                                if (q[-8] != 't') break;
+                                                if (n <= 8) break;
+                                                if (q[-9] != 'a') break;
+                                                i = 189;
+                                                break;
+                                        }
+                                        break;
+                                    case 'g':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'n') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'i') break;
+                                        i = 190;
+                                        break;
+                                    case 'h':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'i') break;
+                                        i = 191;
+                                        break;
+                                    case 'i':
+                                        i = 192;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'a') break;
+                                        i = 193;
+                                        break;
+                                    case 'l':
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 194;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'c':
+                                                        if (n <= 7) break;
+                                                        if (q[-8] != 'i') break;
+                                                        i = 195;
+                                                        break;
+                                                    case 'i':
+                                                        if (n <= 7) break;
+                                                        if (q[-8] != 't') break;
+                                                        if (n <= 8) break;
+                                                        if (q[-9] != 'n') break;
+                                                        if (n <= 9) break;
+                                                        switch (q[-10]) {
+                                                            case 'a':
+                                                                i = 196;
+                                                                break;
+                                                            case 'e':
+                                                                i = 197;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'n':
+                                                        if (n <= 7) break;
+                                                        if (q[-8] != 'o') break;
+                                                        if (n <= 8) break;
+                                                        if (q[-9] != 'i') break;
+                                                        i = 198;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'u':
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'f') break;
+                                                i = 199;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 's':
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'e') break;
+                                                if (n <= 7) break;
+                                                if (q[-8] != 'l') break;
+                                                i = 200;
+                                                break;
+                                            case 'u':
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'o') break;
+                                                i = 201;
+                                                if (n <= 7) break;
+                                                switch (q[-8]) {
+                                                    case 'e':
+                                                        i = 202;
+                                                        break;
+                                                    case 'i':
+                                                        i = 203;
+                                                        break;
+                                                    case 't':
+                                                        if (n <= 8) break;
+                                                        if (q[-9] != 'i') break;
+                                                        i = 204;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'n') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'e') break;
+                                        i = 205;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 206;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 207;
+                                if (n <= 4) break;
+                                if (q[-5] != 'c') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 208;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        i = 209;
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        i = 210;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'e':
+                                i = 211;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'c':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'a') break;
+                                        i = 212;
+                                        break;
+                                    case 'n':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'a') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 't') break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 'n') break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 'a') break;
+                                        i = 213;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 214;
+                                if (n <= 4) break;
+                                if (q[-5] != 'c') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                i = 215;
+                                break;
+                            case 't':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 216;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'n':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 217;
+                                if (n <= 3) break;
+                                if (q[-4] != 'c') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 218;
+                                break;
+                            case 'e':
+                                i = 219;
+                                if (n <= 3) break;
+                                if (q[-4] != 'm') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 220;
+                                if (n <= 5) break;
+                                if (q[-6] != 'z') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'i') break;
+                                i = 221;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 222;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'c':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 223;
+                                break;
+                            case 'l':
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 224;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'c':
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'i') break;
+                                        i = 225;
+                                        break;
+                                    case 'i':
+                                        i = 226;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 4) break;
+                                if (q[-5] != 'o') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 227;
+                                break;
+                            case 't':
+                                if (n <= 4) break;
+                                if (q[-5] != 'n') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'e') break;
+                                i = 228;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'y':
+                i = 229;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 230;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 231;
+                                        break;
+                                    case 'e':
+                                        i = 232;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'l':
+                        i = 233;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 234;
+                                break;
+                            case 'b':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 235;
+                                        break;
+                                    case 'i':
+                                        i = 236;
+                                        break;
+                                }
+                                break;
+                            case 'd':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 237;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 238;
+                                break;
+                            case 'e':
+                                i = 239;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 240;
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 241;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 'a') break;
+                                        i = 242;
+                                        break;
+                                }
+                                break;
+                            case 'g':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 243;
+                                if (n <= 5) break;
+                                if (q[-6] != 't') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'a') break;
+                                i = 244;
+                                break;
+                            case 'i':
+                                i = 245;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'l':
+                                        i = 246;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 247;
+                                        break;
+                                }
+                                break;
+                            case 'l':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 248;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'c':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 249;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'a':
+                                                        i = 250;
+                                                        break;
+                                                    case 'l':
+                                                        if (n <= 7) break;
+                                                        if (q[-8] != 'l') break;
+                                                        if (n <= 8) break;
+                                                        if (q[-9] != 'a') break;
+                                                        i = 251;
+                                                        break;
+                                                    case 't':
+                                                        if (n <= 7) break;
+                                                        if (q[-8] != 's') break;
+                                                        if (n <= 8) break;
+                                                        if (q[-9] != 'i') break;
+                                                        i = 252;
+                                                        if (n <= 9) break;
+                                                        if (q[-10] != 'l') break;
+                                                        if (n <= 10) break;
+                                                        if (q[-11] != 'a') break;
+                                                        i = 253;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'd':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'o') break;
+                                                i = 254;
+                                                break;
+                                            case 'i':
+                                                i = 255;
+                                                if (n <= 5) break;
+                                                if (q[-6] != 't') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'n') break;
+                                                if (n <= 7) break;
+                                                if (q[-8] != 'e') break;
+                                                i = 256;
+                                                break;
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'o') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'i') break;
+                                                i = 257;
+                                                if (n <= 7) break;
+                                                if (q[-8] != 't') break;
+                                                if (n <= 8) break;
+                                                if (q[-9] != 'a') break;
+                                                i = 258;
+                                                if (n <= 9) break;
+                                                if (q[-10] != 'z') break;
+                                                if (n <= 10) break;
+                                                if (q[-11] != 'i') break;
+                                                i = 259;
+                                                break;
+                                            case 't':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'n') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'e') break;
+                                                i = 260;
+                                                break;
+                                        }
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'f') break;
+                                        i = 261;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'e':
+                                                i = 262;
+                                                break;
+                                            case 'i':
+                                                i = 263;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 264;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 265;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 266;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'l') break;
+                                        i = 267;
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 268;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'e':
+                                                i = 269;
+                                                break;
+                                            case 'i':
+                                                i = 270;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 271;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 272;
+                                break;
+                            case 'e':
+                                i = 273;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'c') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'i') break;
+                                i = 274;
+                                break;
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 275;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 276;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'c':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 277;
+                                        break;
+                                    case 'i':
+                                        i = 278;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 279;
+                                break;
+                            case 'l':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 280;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'c':
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'i') break;
+                                                i = 281;
+                                                break;
+                                            case 'i':
+                                                i = 282;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 't') break;
+                                                if (n <= 7) break;
+                                                if (q[-8] != 'n') break;
+                                                if (n <= 8) break;
+                                                switch (q[-9]) {
+                                                    case 'a':
+                                                        i = 283;
+                                                        break;
+                                                    case 'e':
+                                                        i = 284;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'n':
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'o') break;
+                                                if (n <= 7) break;
+                                                if (q[-8] != 'i') break;
+                                                i = 285;
+                                                break;
+                                        }
+                                        break;
+                                    case 'e':
+                                        i = 286;
+                                        break;
+                                    case 'i':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'b') break;
+                                        if (n <= 6) break;
+                                        switch (q[-7]) {
+                                            case 'a':
+                                                i = 287;
+                                                if (n <= 7) break;
+                                                if (q[-8] != 'z') break;
+                                                if (n <= 8) break;
+                                                if (q[-9] != 'i') break;
+                                                i = 288;
+                                                if (n <= 9) break;
+                                                if (q[-10] != 'r') break;
+                                                if (n <= 10) break;
+                                                if (q[-11] != 'a') break;
+                                                i = 289;
+                                                break;
+                                            case 'i':
+                                                i = 290;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 291;
+                                break;
+                            case 'r':
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 292;
+                                break;
+                            case 'v':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 293;
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    while (i >= 0) {
+        const struct among * w = a_1 + i;
+        z->c = c - w->s_size;
+        if (a_1_functions[i] == 0) return w->result;
+        {   int res = a_1_functions[i](z);
+            z->c = c - w->s_size;
+            if (res) return w->result;
+        }
+        i = w->substring_i;
+    }
+    return 0;
+}
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'b':
+                if (n <= 1) break;
+                if (q[-2] != 'b') break;
+                i = 0;
+                break;
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'd') break;
+                i = 1;
+                break;
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'g') break;
+                i = 2;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'l') break;
+                i = 3;
+                break;
+            case 'm':
+                if (n <= 1) break;
+                if (q[-2] != 'm') break;
+                i = 4;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                i = 5;
+                break;
+            case 'p':
+                if (n <= 1) break;
+                if (q[-2] != 'p') break;
+                i = 6;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'r') break;
+                i = 7;
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                i = 8;
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 't') break;
+                i = 9;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'u':
+                                i = 0;
+                                break;
+                            case 'v':
+                                i = 1;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                i = 2;
+                                break;
+                            case 'l':
+                                i = 3;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 4;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 'p') break;
+                                i = 5;
+                                break;
+                            case 'e':
+                                i = 6;
+                                break;
+                            case 'o':
+                                i = 7;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'l':
+                                i = 8;
+                                break;
+                            case 'r':
+                                i = 9;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'u') break;
+                i = 10;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'h') break;
+                        i = 11;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 'm') break;
+                                i = 12;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 13;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 'r') break;
+                if (n <= 2) break;
+                if (q[-3] != 'u') break;
+                i = 14;
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'u') break;
+                        i = 15;
+                        break;
+                    case 'e':
+                        i = 16;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'm') break;
+                        i = 17;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 18;
+                        break;
+                    case 'p':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'm':
+                                if (n <= 3) break;
+                                if (q[-4] != 'u') break;
+                                i = 19;
+                                break;
+                            case 'r':
+                                i = 20;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 21;
+                        break;
+                    case 'y':
+                        i = 22;
+                        break;
+                }
+                break;
+            case 'v':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 23;
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        i = 24;
+                        break;
+                }
+                break;
+            case 'x':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 25;
+                        break;
+                    case 'e':
+                        i = 26;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'b':
+                                i = 27;
+                                break;
+                            case 'd':
+                                i = 28;
+                                break;
+                            case 'p':
+                                i = 29;
+                                break;
+                            case 't':
+                                i = 30;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        i = 31;
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 'l') break;
+                        i = 32;
+                        break;
+                }
+                break;
+            case 'z':
+                if (n <= 1) break;
+                if (q[-2] != 'y') break;
+                i = 33;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+static const symbol s_5[] = { 'i', 'e', 'f' };
+static const symbol s_6[] = { 'u', 'c' };
+static const symbol s_7[] = { 'u', 'm' };
+static const symbol s_8[] = { 'r', 'b' };
+static const symbol s_9[] = { 'u', 'r' };
+static const symbol s_10[] = { 'i', 's', 't', 'e', 'r' };
+static const symbol s_11[] = { 'm', 'e', 't', 'e', 'r' };
+static const symbol s_12[] = { 'o', 'l', 'u', 't' };
+static const symbol s_13[] = { 'l' };
+static const symbol s_14[] = { 'b', 'i', 'c' };
+static const symbol s_15[] = { 'd', 'i', 'c' };
+static const symbol s_16[] = { 'p', 'i', 'c' };
+static const symbol s_17[] = { 't', 'i', 'c' };
+static const symbol s_18[] = { 'a', 'c' };
+static const symbol s_19[] = { 'e', 'c' };
+static const symbol s_20[] = { 'i', 'c' };
+static const symbol s_21[] = { 'l', 'u', 'c' };
+static const symbol s_22[] = { 'u', 'a', 's' };
+static const symbol s_23[] = { 'v', 'a', 's' };
+static const symbol s_24[] = { 'c', 'i', 's' };
+static const symbol s_25[] = { 'l', 'i', 's' };
+static const symbol s_26[] = { 'e', 'r', 'i', 's' };
+static const symbol s_27[] = { 'p', 'a', 'n', 's' };
+static const symbol s_28[] = { 'e', 'n', 's' };
+static const symbol s_29[] = { 'o', 'n', 's' };
+static const symbol s_30[] = { 'l', 'u', 's' };
+static const symbol s_31[] = { 'r', 'u', 's' };
+static const symbol s_32[] = { 'h', 'e', 's' };
+static const symbol s_33[] = { 'm', 'i', 's' };
+static const symbol s_34[] = { 'e', 'n', 's' };
+static const symbol s_35[] = { 'e', 'r', 's' };
+static const symbol s_36[] = { 'e', 's' };
+static const symbol s_37[] = { 'y', 's' };
+
+static int r_A(struct SN_env * z) {
+    {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+        if (ret < 0) return 0;
+        z->c = ret;
+    }
+    return 1;
+}
+
+static int r_B(struct SN_env * z) {
+    {   int ret = hop_b_utf8(z, z->c, z->lb, 3);
+        if (ret < 0) return 0;
+        z->c = ret;
+    }
+    return 1;
+}
+
+static int r_C(struct SN_env * z) {
+    {   int ret = hop_b_utf8(z, z->c, z->lb, 4);
+        if (ret < 0) return 0;
+        z->c = ret;
+    }
+    return 1;
+}
+
+static int r_D(struct SN_env * z) {
+    {   int ret = hop_b_utf8(z, z->c, z->lb, 5);
+        if (ret < 0) return 0;
+        z->c = ret;
+    }
+    return 1;
+}
+
+static int r_E(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'e') goto lab0;
+        z->c--;
+        return 0;
+    lab0:
+        z->c = z->l - m2;
+    }
+    return 1;
+}
+
+static int r_F(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 3);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'e') goto lab0;
+        z->c--;
+        return 0;
+    lab0:
+        z->c = z->l - m2;
+    }
+    return 1;
+}
+
+static int r_G(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 3);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    if (z->c <= z->lb || z->p[z->c - 1] != 'f') return 0;
+    z->c--;
+    return 1;
+}
+
+static int r_H(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 't') goto lab1;
+        z->c--;
+        goto lab0;
+    lab1:
+        z->c = z->l - m2;
+        if (!(eq_s_b(z, 2, s_0))) return 0;
+    }
+lab0:
+    return 1;
+}
+
+static int r_I(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'o') goto lab0;
+        z->c--;
+        return 0;
+    lab0:
+        z->c = z->l - m2;
+    }
+    {   int m3 = z->l - z->c; (void)m3;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'e') goto lab1;
+        z->c--;
+        return 0;
+    lab1:
+        z->c = z->l - m3;
+    }
+    return 1;
+}
+
+static int r_J(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'a') goto lab0;
+        z->c--;
+        return 0;
+    lab0:
+        z->c = z->l - m2;
+    }
+    {   int m3 = z->l - z->c; (void)m3;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'e') goto lab1;
+        z->c--;
+        return 0;
+    lab1:
+        z->c = z->l - m3;
+    }
+    return 1;
+}
+
+static int r_K(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 3);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'l') goto lab1;
+        z->c--;
+        goto lab0;
+    lab1:
+        z->c = z->l - m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'i') goto lab2;
+        z->c--;
+        goto lab0;
+    lab2:
+        z->c = z->l - m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'e') return 0;
+        z->c--;
+        {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        if (z->c <= z->lb || z->p[z->c - 1] != 'u') return 0;
+        z->c--;
+    }
+lab0:
+    return 1;
+}
+
+static int r_L(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'u') goto lab0;
+        z->c--;
+        return 0;
+    lab0:
+        z->c = z->l - m2;
+    }
+    {   int m3 = z->l - z->c; (void)m3;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'x') goto lab1;
+        z->c--;
+        return 0;
+    lab1:
+        z->c = z->l - m3;
+    }
+    {   int m4 = z->l - z->c; (void)m4;
+        if (z->c <= z->lb || z->p[z->c - 1] != 's') goto lab2;
+        z->c--;
+        {   int m5 = z->l - z->c; (void)m5;
+            if (z->c <= z->lb || z->p[z->c - 1] != 'o') goto lab3;
+            z->c--;
+            goto lab2;
+        lab3:
+            z->c = z->l - m5;
+        }
+        return 0;
+    lab2:
+        z->c = z->l - m4;
+    }
+    return 1;
+}
+
+static int r_M(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'a') goto lab0;
+        z->c--;
+        return 0;
+    lab0:
+        z->c = z->l - m2;
+    }
+    {   int m3 = z->l - z->c; (void)m3;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'c') goto lab1;
+        z->c--;
+        return 0;
+    lab1:
+        z->c = z->l - m3;
+    }
+    {   int m4 = z->l - z->c; (void)m4;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'e') goto lab2;
+        z->c--;
+        return 0;
+    lab2:
+        z->c = z->l - m4;
+    }
+    {   int m5 = z->l - z->c; (void)m5;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'm') goto lab3;
+        z->c--;
+        return 0;
+    lab3:
+        z->c = z->l - m5;
+    }
+    return 1;
+}
+
+static int r_N(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 3);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+        if (ret < 0) return 0;
+        z->c = ret;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        {   int m3 = z->l - z->c; (void)m3;
+            if (z->c <= z->lb || z->p[z->c - 1] != 's') goto lab2;
+            z->c--;
+            goto lab1;
+        lab2:
+            z->c = z->l - m3;
+        }
+        goto lab0;
+    lab1:
+        z->c = z->l - m2;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+    }
+lab0:
+    return 1;
+}
+
+static int r_O(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'l') goto lab1;
+        z->c--;
+        goto lab0;
+    lab1:
+        z->c = z->l - m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'i') return 0;
+        z->c--;
+    }
+lab0:
+    return 1;
+}
+
+static int r_P(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'c') goto lab0;
+        z->c--;
+        return 0;
+    lab0:
+        z->c = z->l - m2;
+    }
+    return 1;
+}
+
+static int r_Q(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m_test2 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 3);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test2;
+    }
+    {   int m3 = z->l - z->c; (void)m3;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'l') goto lab0;
+        z->c--;
+        return 0;
+    lab0:
+        z->c = z->l - m3;
+    }
+    {   int m4 = z->l - z->c; (void)m4;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'n') goto lab1;
+        z->c--;
+        return 0;
+    lab1:
+        z->c = z->l - m4;
+    }
+    return 1;
+}
+
+static int r_R(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'n') goto lab1;
+        z->c--;
+        goto lab0;
+    lab1:
+        z->c = z->l - m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'r') return 0;
+        z->c--;
+    }
+lab0:
+    return 1;
+}
+
+static int r_S(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (!(eq_s_b(z, 2, s_1))) goto lab1;
+        goto lab0;
+    lab1:
+        z->c = z->l - m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 't') return 0;
+        z->c--;
+        {   int m3 = z->l - z->c; (void)m3;
+            if (z->c <= z->lb || z->p[z->c - 1] != 't') goto lab2;
+            z->c--;
+            return 0;
+        lab2:
+            z->c = z->l - m3;
+        }
+    }
+lab0:
+    return 1;
+}
+
+static int r_T(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 's') goto lab1;
+        z->c--;
+        goto lab0;
+    lab1:
+        z->c = z->l - m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 't') return 0;
+        z->c--;
+        {   int m3 = z->l - z->c; (void)m3;
+            if (z->c <= z->lb || z->p[z->c - 1] != 'o') goto lab2;
+            z->c--;
+            return 0;
+        lab2:
+            z->c = z->l - m3;
+        }
+    }
+lab0:
+    return 1;
+}
+
+static int r_U(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'l') goto lab1;
+        z->c--;
+        goto lab0;
+    lab1:
+        z->c = z->l - m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'm') goto lab2;
+        z->c--;
+        goto lab0;
+    lab2:
+        z->c = z->l - m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'n') goto lab3;
+        z->c--;
+        goto lab0;
+    lab3:
+        z->c = z->l - m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'r') return 0;
+        z->c--;
+    }
+lab0:
+    return 1;
+}
+
+static int r_V(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    if (z->c <= z->lb || z->p[z->c - 1] != 'c') return 0;
+    z->c--;
+    return 1;
+}
+
+static int r_W(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 's') goto lab0;
+        z->c--;
+        return 0;
+    lab0:
+        z->c = z->l - m2;
+    }
+    {   int m3 = z->l - z->c; (void)m3;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'u') goto lab1;
+        z->c--;
+        return 0;
+    lab1:
+        z->c = z->l - m3;
+    }
+    return 1;
+}
+
+static int r_X(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'l') goto lab1;
+        z->c--;
+        goto lab0;
+    lab1:
+        z->c = z->l - m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'i') goto lab2;
+        z->c--;
+        goto lab0;
+    lab2:
+        z->c = z->l - m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'e') return 0;
+        z->c--;
+        {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        if (z->c <= z->lb || z->p[z->c - 1] != 'u') return 0;
+        z->c--;
+    }
+lab0:
+    return 1;
+}
+
+static int r_Y(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    if (!(eq_s_b(z, 2, s_2))) return 0;
+    return 1;
+}
+
+static int r_Z(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'f') goto lab0;
+        z->c--;
+        return 0;
+    lab0:
+        z->c = z->l - m2;
+    }
+    return 1;
+}
+
+static int r_AA(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    if (z->c <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1839440 >> (z->p[z->c - 1] & 0x1f)) & 1)) return 0;
+    if (!(find_among_b_0(z))) return 0;
+    return 1;
+}
+
+static int r_BB(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 3);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        if (!(eq_s_b(z, 3, s_3))) goto lab0;
+        return 0;
+    lab0:
+        z->c = z->l - m2;
+    }
+    {   int m3 = z->l - z->c; (void)m3;
+        if (!(eq_s_b(z, 4, s_4))) goto lab1;
+        return 0;
+    lab1:
+        z->c = z->l - m3;
+    }
+    return 1;
+}
+
+static int r_CC(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        {   int ret = hop_b_utf8(z, z->c, z->lb, 2);
+            if (ret < 0) return 0;
+            z->c = ret;
+        }
+        z->c = z->l - m_test1;
+    }
+    if (z->c <= z->lb || z->p[z->c - 1] != 'l') return 0;
+    z->c--;
+    return 1;
+}
+
+extern int lovins_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    z->lb = z->c; z->c = z->l;
+
+    {   int m1 = z->l - z->c; (void)m1;
+        z->ket = z->c;
+        if (z->c <= z->lb || !((a_1_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1)) goto lab0;
+        if (!(find_among_b_1(z))) goto lab0;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab0:
+        z->c = z->l - m1;
+    }
+    {   int m2 = z->l - z->c; (void)m2;
+        {   int m_test3 = z->l - z->c;
+            if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1929364 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((1929364 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab1;
+            if (!(find_among_b_2(z))) goto lab1;
+            z->c = z->l - m_test3;
+        }
+        z->ket = z->c;
+        {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+            if (ret < 0) goto lab1;
+            z->c = ret;
+        }
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab1:
+        z->c = z->l - m2;
+    }
+    {   int m4 = z->l - z->c; (void)m4;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((89919504 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((37048874 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab2;
+        among_var = find_among_b_3(z);
+        if (!(among_var)) goto lab2;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 3, s_5);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 2, s_6);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 2, s_7);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                {   int ret = slice_from_s(z, 2, s_8);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                {   int ret = slice_from_s(z, 2, s_9);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {   int ret = slice_from_s(z, 5, s_10);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                {   int ret = slice_from_s(z, 5, s_11);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 8:
+                {   int ret = slice_from_s(z, 4, s_12);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 9:
+                {   int m5 = z->l - z->c; (void)m5;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'a') goto lab3;
+                    z->c--;
+                    goto lab2;
+                lab3:
+                    z->c = z->l - m5;
+                }
+                {   int m6 = z->l - z->c; (void)m6;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'i') goto lab4;
+                    z->c--;
+                    goto lab2;
+                lab4:
+                    z->c = z->l - m6;
+                }
+                {   int m7 = z->l - z->c; (void)m7;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'o') goto lab5;
+                    z->c--;
+                    goto lab2;
+                lab5:
+                    z->c = z->l - m7;
+                }
+                {   int ret = slice_from_s(z, 1, s_13);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 10:
+                {   int ret = slice_from_s(z, 3, s_14);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 11:
+                {   int ret = slice_from_s(z, 3, s_15);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 12:
+                {   int ret = slice_from_s(z, 3, s_16);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 13:
+                {   int ret = slice_from_s(z, 3, s_17);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 14:
+                {   int ret = slice_from_s(z, 2, s_18);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 15:
+                {   int ret = slice_from_s(z, 2, s_19);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 16:
+                {   int ret = slice_from_s(z, 2, s_20);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 17:
+                {   int ret = slice_from_s(z, 3, s_21);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 18:
+                {   int ret = slice_from_s(z, 3, s_22);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 19:
+                {   int ret = slice_from_s(z, 3, s_23);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 20:
+                {   int ret = slice_from_s(z, 3, s_24);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 21:
+                {   int ret = slice_from_s(z, 3, s_25);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 22:
+                {   int ret = slice_from_s(z, 4, s_26);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 23:
+                {   int ret = slice_from_s(z, 4, s_27);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 24:
+                {   int m8 = z->l - z->c; (void)m8;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 's') goto lab6;
+                    z->c--;
+                    goto lab2;
+                lab6:
+                    z->c = z->l - m8;
+                }
+                {   int ret = slice_from_s(z, 3, s_28);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 25:
+                {   int ret = slice_from_s(z, 3, s_29);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 26:
+                {   int ret = slice_from_s(z, 3, s_30);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 27:
+                {   int ret = slice_from_s(z, 3, s_31);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 28:
+                {   int m9 = z->l - z->c; (void)m9;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'p') goto lab7;
+                    z->c--;
+                    goto lab2;
+                lab7:
+                    z->c = z->l - m9;
+                }
+                {   int m10 = z->l - z->c; (void)m10;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 't') goto lab8;
+                    z->c--;
+                    goto lab2;
+                lab8:
+                    z->c = z->l - m10;
+                }
+                {   int ret = slice_from_s(z, 3, s_32);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 29:
+                {   int ret = slice_from_s(z, 3, s_33);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 30:
+                {   int m11 = z->l - z->c; (void)m11;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'm') goto lab9;
+                    z->c--;
+                    goto lab2;
+                lab9:
+                    z->c = z->l - m11;
+                }
+                {   int ret = slice_from_s(z, 3, s_34);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 31:
+                {   int ret = slice_from_s(z, 3, s_35);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 32:
+                {   int m12 = z->l - z->c; (void)m12;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'n') goto lab10;
+                    z->c--;
+                    goto lab2;
+                lab10:
+                    z->c = z->l - m12;
+                }
+                {   int ret = slice_from_s(z, 2, s_36);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 33:
+                {   int ret = slice_from_s(z, 2, s_37);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab2:
+        z->c = z->l - m4;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * lovins_UTF_8_create_env(void) { return SN_create_env(0, 0); }
+
+extern void lovins_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
@@ -0,0 +1,15 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern struct SN_env * lovins_UTF_8_create_env(void);
+extern void lovins_UTF_8_close_env(struct SN_env * z);
+
+extern int lovins_UTF_8_stem(struct SN_env * z);
+
+#ifdef __cplusplus
+}
+#endif
+
@@ -0,0 +1,1644 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int nepali_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * nepali_UTF_8_create_env(void);
+extern void nepali_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[17] =
+{
+{ 0, 6, -1, 2 },
+{ 0, 9, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 9, -1, 1 },
+{ 0, 6, -1, 2 },
+{ 0, 12, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 2 },
+{ 0, 9, -1, 1 },
+{ 0, 9, -1, 1 },
+{ 0, 18, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 2 },
+{ 0, 6, -1, 1 },
+{ 0, 18, -1, 1 },
+{ 0, 6, -1, 2 },
+{ 0, 9, -1, 1 }
+};
+
+
+static const struct among a_1[3] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_2[3] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 2 }
+};
+
+
+static const struct among a_3[91] =
+{
+{ 0, 9, -1, 1 },
+{ 0, 9, -1, 1 },
+{ 0, 12, 1, 1 },
+{ 0, 12, 1, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 9, 7, 1 },
+{ 0, 12, 8, 1 },
+{ 0, 9, 7, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 9, -1, 1 },
+{ 0, 9, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 9, -1, 1 },
+{ 0, 12, 17, 1 },
+{ 0, 9, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 9, 20, 1 },
+{ 0, 9, 20, 1 },
+{ 0, 9, -1, 1 },
+{ 0, 12, 23, 1 },
+{ 0, 9, -1, 1 },
+{ 0, 12, 25, 1 },
+{ 0, 12, 25, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 9, 28, 1 },
+{ 0, 9, 28, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 9, 31, 1 },
+{ 0, 12, 31, 1 },
+{ 0, 9, 31, 1 },
+{ 0, 9, 31, 1 },
+{ 0, 12, 35, 1 },
+{ 0, 12, 35, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 9, 38, 1 },
+{ 0, 9, 38, 1 },
+{ 0, 12, 40, 1 },
+{ 0, 9, 38, 1 },
+{ 0, 9, 38, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 12, 44, 1 },
+{ 0, 12, 44, 1 },
+{ 0, 12, 44, 1 },
+{ 0, 9, -1, 1 },
+{ 0, 12, 48, 1 },
+{ 0, 12, 48, 1 },
+{ 0, 15, 50, 1 },
+{ 0, 12, 48, 1 },
+{ 0, 12, 48, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 9, -1, 1 },
+{ 0, 9, -1, 1 },
+{ 0, 15, 58, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 9, -1, 1 },
+{ 0, 12, 62, 1 },
+{ 0, 12, 62, 1 },
+{ 0, 15, 64, 1 },
+{ 0, 12, 62, 1 },
+{ 0, 12, 62, 1 },
+{ 0, 9, -1, 1 },
+{ 0, 12, 68, 1 },
+{ 0, 9, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, 71, 1 },
+{ 0, 6, 71, 1 },
+{ 0, 9, 73, 1 },
+{ 0, 15, 74, 1 },
+{ 0, 15, 71, 1 },
+{ 0, 12, 71, 1 },
+{ 0, 12, 71, 1 },
+{ 0, 6, 71, 1 },
+{ 0, 6, 71, 1 },
+{ 0, 9, -1, 1 },
+{ 0, 12, 81, 1 },
+{ 0, 9, -1, 1 },
+{ 0, 12, 83, 1 },
+{ 0, 12, 83, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 9, 86, 1 },
+{ 0, 9, 86, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 12, -1, 1 }
+};
+
+
+static const unsigned char a_0_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x81, 0x9, 0x80, 0x0, 0x10, 0x0, 0x0, 0xC0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xA5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x95) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xA4) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x87:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0xA4:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xE0) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0xBE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB2) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xA4) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        i = 1;
+                        break;
+                    case 0xA5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xE0) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0xB2) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0x88:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0xA4:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xE0) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0xBE) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB2) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xA4) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        i = 3;
+                        break;
+                    case 0xA5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xE0) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x95:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xA4) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                i = 4;
+                                break;
+                            case 0x97:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xA4) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x81) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xB8) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xA4) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xE0) break;
+                                i = 5;
+                                break;
+                            case 0xAE:
+                                if (n <= 4) break;
+                                if (q[-5] != 0xA4) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                i = 6;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x8B:
+                if (n <= 1) break;
+                if (q[-2] != 0xA5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x95) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xA4) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xE0) break;
+                i = 7;
+                break;
+            case 0x97:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x81:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB8) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xA4) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        i = 8;
+                        break;
+                    case 0x82:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB8) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xA4) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        i = 9;
+                        break;
+                }
+                break;
+            case 0xA4:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0xAB:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x8D) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xA5) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xB0) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xA4) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xE0) break;
+                        if (n <= 12) break;
+                        if (q[-13] != 0xBE) break;
+                        if (n <= 13) break;
+                        if (q[-14] != 0xA4) break;
+                        if (n <= 14) break;
+                        if (q[-15] != 0xE0) break;
+                        if (n <= 15) break;
+                        if (q[-16] != 0xAE) break;
+                        if (n <= 16) break;
+                        if (q[-17] != 0xA4) break;
+                        if (n <= 17) break;
+                        if (q[-18] != 0xE0) break;
+                        i = 10;
+                        break;
+                    case 0xB0:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 11;
+                        break;
+                }
+                break;
+            case 0xBE:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x95:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 12;
+                        break;
+                    case 0xAE:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 13;
+                        break;
+                    case 0xB0:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBE) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xA4) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xB5) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xA4) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xE0) break;
+                        if (n <= 12) break;
+                        if (q[-13] != 0x8D) break;
+                        if (n <= 13) break;
+                        if (q[-14] != 0xA5) break;
+                        if (n <= 14) break;
+                        if (q[-15] != 0xE0) break;
+                        if (n <= 15) break;
+                        if (q[-16] != 0xA6) break;
+                        if (n <= 16) break;
+                        if (q[-17] != 0xA4) break;
+                        if (n <= 17) break;
+                        if (q[-18] != 0xE0) break;
+                        i = 14;
+                        break;
+                }
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x95:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 15;
+                        break;
+                    case 0x9B:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xAA) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xA4) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        i = 16;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_0[i].s_size;
+    return a_0[i].result;
+}
+static const symbol s_0[] = { 0xE0, 0xA4, 0x8F };
+static const symbol s_1[] = { 0xE0, 0xA5, 0x87 };
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x82:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0x88:
+                if (n <= 1) break;
+                if (q[-2] != 0xA5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x82:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0x88:
+                if (n <= 1) break;
+                if (q[-2] != 0xA5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_2[] = { 0xE0, 0xA4, 0xAF, 0xE0, 0xA5, 0x8C };
+static const symbol s_3[] = { 0xE0, 0xA4, 0x9B, 0xE0, 0xA5, 0x8C };
+static const symbol s_4[] = { 0xE0, 0xA4, 0xA8, 0xE0, 0xA5, 0x8C };
+static const symbol s_5[] = { 0xE0, 0xA4, 0xA5, 0xE0, 0xA5, 0x87 };
+static const symbol s_6[] = { 0xE0, 0xA4, 0xA4, 0xE0, 0xA5, 0x8D, 0xE0, 0xA4, 0xB0 };
+
+static const unsigned char a_3_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x87, 0xB9, 0x0, 0x8, 0x0, 0x0, 0x0, 0xC0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xA5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x95:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x87:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 0;
+                                break;
+                            case 0x8F:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 1;
+                                if (n <= 9) break;
+                                switch (q[-10]) {
+                                    case 0x87:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 2;
+                                        break;
+                                    case 0xBF:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 3;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x96:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x87) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xA5) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xA6) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xA4) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xE0) break;
+                        i = 4;
+                        break;
+                    case 0xA5:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 5;
+                        break;
+                    case 0xA6:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 6;
+                        break;
+                }
+                break;
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xA5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x9B:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 7;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x87:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 8;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xA8) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xA4) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xE0) break;
+                                i = 9;
+                                break;
+                            case 0x8F:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 10;
+                                break;
+                        }
+                        break;
+                    case 0xA8:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 11;
+                        break;
+                    case 0xB0:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB9) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xA4) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        i = 12;
+                        break;
+                }
+                break;
+            case 0x82:
+                if (n <= 1) break;
+                if (q[-2] != 0xA5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xB0) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xA4) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xE0) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB9) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xA4) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xE0) break;
+                i = 13;
+                break;
+            case 0x87:
+                if (n <= 1) break;
+                if (q[-2] != 0xA5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x9B:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 14;
+                        break;
+                    case 0xA5:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 15;
+                        break;
+                    case 0xA8:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 16;
+                        break;
+                }
+                break;
+            case 0x88:
+                if (n <= 1) break;
+                if (q[-2] != 0xA5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x95:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x87:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 17;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xA8) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xA4) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xE0) break;
+                                i = 18;
+                                break;
+                            case 0x8F:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 19;
+                                break;
+                        }
+                        break;
+                    case 0xA6:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 20;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x87:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 21;
+                                break;
+                            case 0xBF:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 22;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x8B:
+                if (n <= 1) break;
+                if (q[-2] != 0xA5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x95:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x87:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 23;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xA8) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xA4) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xE0) break;
+                                i = 24;
+                                break;
+                            case 0x8F:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 25;
+                                if (n <= 9) break;
+                                switch (q[-10]) {
+                                    case 0x87:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 26;
+                                        break;
+                                    case 0xBF:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 27;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0xA6:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 28;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x87:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 29;
+                                break;
+                            case 0xBF:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 30;
+                                break;
+                        }
+                        break;
+                    case 0xAF:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 31;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x87:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 32;
+                                break;
+                            case 0x8D:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xA5) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xA4) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xE0) break;
+                                i = 33;
+                                break;
+                            case 0xAD:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 34;
+                                break;
+                            case 0xBF:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 35;
+                                if (n <= 9) break;
+                                switch (q[-10]) {
+                                    case 0xA5:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 36;
+                                        break;
+                                    case 0xA6:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 37;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x8C:
+                if (n <= 1) break;
+                if (q[-2] != 0xA5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x9B:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 38;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x87:
+                                if (n <= 7) break;
+                                switch (q[-8]) {
+                                    case 0xA4:
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 39;
+                                        break;
+                                    case 0xA5:
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 40;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xA8) break;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 41;
+                                        break;
+                                }
+                                break;
+                            case 0x8F:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 42;
+                                break;
+                            case 0xBF:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 43;
+                                break;
+                        }
+                        break;
+                    case 0xAF:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 44;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x8D:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                if (n <= 9) break;
+                                switch (q[-10]) {
+                                    case 0x9B:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 45;
+                                        break;
+                                    case 0xA5:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 46;
+                                        break;
+                                }
+                                break;
+                            case 0xBF:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xA5) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xA4) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xE0) break;
+                                i = 47;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x8D:
+                if (n <= 1) break;
+                if (q[-2] != 0xA5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0xA8:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x9B:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 48;
+                                if (n <= 9) break;
+                                switch (q[-10]) {
+                                    case 0x87:
+                                        if (n <= 10) break;
+                                        switch (q[-11]) {
+                                            case 0xA4:
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xE0) break;
+                                                i = 49;
+                                                break;
+                                            case 0xA5:
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xE0) break;
+                                                i = 50;
+                                                if (n <= 12) break;
+                                                if (q[-13] != 0xA8) break;
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 51;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x8F:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 52;
+                                        break;
+                                    case 0xBF:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 53;
+                                        break;
+                                }
+                                break;
+                            case 0xBE:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xB2) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xA4) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xE0) break;
+                                i = 54;
+                                break;
+                            case 0xBF:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                if (n <= 9) break;
+                                switch (q[-10]) {
+                                    case 0x9B:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 55;
+                                        break;
+                                    case 0xA5:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 56;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0xB0:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xAA) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xA4) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        i = 57;
+                        break;
+                    case 0xB8:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x87:
+                                if (n <= 7) break;
+                                switch (q[-8]) {
+                                    case 0xA4:
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        i = 58;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xBF) break;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        if (n <= 12) break;
+                                        if (q[-13] != 0xA5) break;
+                                        if (n <= 13) break;
+                                        if (q[-14] != 0xA4) break;
+                                        if (n <= 14) break;
+                                        if (q[-15] != 0xE0) break;
+                                        i = 59;
+                                        break;
+                                    case 0xA5:
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xE0) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0x9B) break;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 60;
+                                        break;
+                                }
+                                break;
+                            case 0x8B:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xB9) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xA4) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xE0) break;
+                                i = 61;
+                                break;
+                            case 0x9B:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 62;
+                                if (n <= 9) break;
+                                switch (q[-10]) {
+                                    case 0x87:
+                                        if (n <= 10) break;
+                                        switch (q[-11]) {
+                                            case 0xA4:
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xE0) break;
+                                                i = 63;
+                                                break;
+                                            case 0xA5:
+                                                if (n <= 11) break;
+                                                if (q[-12] != 0xE0) break;
+                                                i = 64;
+                                                if (n <= 12) break;
+                                                if (q[-13] != 0xA8) break;
+                                                if (n <= 13) break;
+                                                if (q[-14] != 0xA4) break;
+                                                if (n <= 14) break;
+                                                if (q[-15] != 0xE0) break;
+                                                i = 65;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x8F:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 66;
+                                        break;
+                                    case 0xBF:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 67;
+                                        break;
+                                }
+                                break;
+                            case 0xBF:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 68;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xA5) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xA4) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xE0) break;
+                                i = 69;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x8F:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xBF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xA4) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xE0) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xA5) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xA4) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xE0) break;
+                i = 70;
+                break;
+            case 0x9B:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 71;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x87:
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0xA4:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                i = 72;
+                                break;
+                            case 0xA5:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xE0) break;
+                                i = 73;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xA8) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 74;
+                                if (n <= 9) break;
+                                if (q[-10] != 0x81) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xA5) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xE0) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xB9) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xA4) break;
+                                if (n <= 14) break;
+                                if (q[-15] != 0xE0) break;
+                                i = 75;
+                                break;
+                        }
+                        break;
+                    case 0x8D:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA5) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA8) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xA4) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        if (n <= 9) break;
+                        switch (q[-10]) {
+                            case 0x81:
+                                if (n <= 10) break;
+                                if (q[-11] != 0xA5) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xE0) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xB9) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xA4) break;
+                                if (n <= 14) break;
+                                if (q[-15] != 0xE0) break;
+                                i = 76;
+                                break;
+                            case 0x87:
+                                if (n <= 10) break;
+                                if (q[-11] != 0xA4) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xE0) break;
+                                i = 77;
+                                break;
+                            case 0xBF:
+                                if (n <= 10) break;
+                                if (q[-11] != 0xA4) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xE0) break;
+                                i = 78;
+                                break;
+                        }
+                        break;
+                    case 0x8F:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 79;
+                        break;
+                    case 0xBF:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 80;
+                        break;
+                }
+                break;
+            case 0xBE:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x95:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x87:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 81;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xA8) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xA4) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xE0) break;
+                                i = 82;
+                                break;
+                            case 0x8F:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 83;
+                                if (n <= 9) break;
+                                switch (q[-10]) {
+                                    case 0x87:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 84;
+                                        break;
+                                    case 0xBF:
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA4) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xE0) break;
+                                        i = 85;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0xA6:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 86;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x87:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 87;
+                                break;
+                            case 0xBF:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xA4) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 88;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xA4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x96:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x87) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xA5) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xA6) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xA4) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xE0) break;
+                        i = 89;
+                        break;
+                    case 0xA5:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xBE) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xA4) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xAE) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xA4) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xE0) break;
+                        i = 90;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+
+extern int nepali_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    z->lb = z->c; z->c = z->l;
+
+    {   int m1 = z->l - z->c; (void)m1;
+        z->ket = z->c;
+        if (z->c - 5 <= z->lb || !((a_0_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 164 && z->p[z->c - 2] != 165)) goto lab0;
+        among_var = find_among_b_0(z);
+        if (!(among_var)) goto lab0;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int m2 = z->l - z->c; (void)m2;
+                    {   int m3 = z->l - z->c; (void)m3;
+                        if (!(eq_s_b(z, 3, s_0))) goto lab4;
+                        goto lab3;
+                    lab4:
+                        z->c = z->l - m3;
+                        if (!(eq_s_b(z, 3, s_1))) goto lab2;
+                    }
+                lab3:
+                    goto lab1;
+                lab2:
+                    z->c = z->l - m2;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab1:
+                break;
+        }
+    lab0:
+        z->c = z->l - m1;
+    }
+    {   int m4 = z->l - z->c; (void)m4;
+        while(1) {
+            int m5 = z->l - z->c; (void)m5;
+            {   int m6 = z->l - z->c; (void)m6;
+                {   int m7 = z->l - z->c; (void)m7;
+                    z->ket = z->c;
+                    if (z->c - 2 <= z->lb || z->p[z->c - 1] >> 5 != 4 || !((262 >> (z->p[z->c - 1] & 0x1f)) & 1) || (z->p[z->c - 2] != 164 && z->p[z->c - 2] != 165)) goto lab7;
+                    if (!(find_among_b_1(z))) goto lab7;
+                    z->bra = z->c;
+                    z->c = z->l - m7;
+                    z->ket = z->c;
+                    if (z->c - 2 <= z->lb || z->p[z->c - 1] >> 5 != 4 || !((262 >> (z->p[z->c - 1] & 0x1f)) & 1) || (z->p[z->c - 2] != 164 && z->p[z->c - 2] != 165)) goto lab7;
+                    among_var = find_among_b_2(z);
+                    if (!(among_var)) goto lab7;
+                    z->bra = z->c;
+                    switch (among_var) {
+                        case 1:
+                            {   int m8 = z->l - z->c; (void)m8;
+                                if (!(eq_s_b(z, 6, s_2))) goto lab9;
+                                goto lab8;
+                            lab9:
+                                z->c = z->l - m8;
+                                if (!(eq_s_b(z, 6, s_3))) goto lab10;
+                                goto lab8;
+                            lab10:
+                                z->c = z->l - m8;
+                                if (!(eq_s_b(z, 6, s_4))) goto lab11;
+                                goto lab8;
+                            lab11:
+                                z->c = z->l - m8;
+                                if (!(eq_s_b(z, 6, s_5))) goto lab7;
+                            }
+                        lab8:
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 2:
+                            if (!(eq_s_b(z, 9, s_6))) goto lab7;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                    }
+                }
+            lab7:
+                z->c = z->l - m6;
+            }
+            z->ket = z->c;
+            if (z->c - 2 <= z->lb || !((a_3_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 164 && z->p[z->c - 2] != 165)) goto lab6;
+            if (!(find_among_b_3(z))) goto lab6;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            continue;
+        lab6:
+            z->c = z->l - m5;
+            break;
+        }
+        z->c = z->l - m4;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * nepali_UTF_8_create_env(void) { return SN_create_env(0, 0); }
+
+extern void nepali_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
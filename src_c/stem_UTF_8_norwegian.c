@@ -0,0 +1,507 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int norwegian_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * norwegian_UTF_8_create_env(void);
+extern void norwegian_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[29] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 3, 1, 1 },
+{ 0, 4, 1, 1 },
+{ 0, 4, 1, 1 },
+{ 0, 3, 1, 1 },
+{ 0, 3, 1, 1 },
+{ 0, 6, 6, 1 },
+{ 0, 4, 1, 3 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 9, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 12, 1 },
+{ 0, 1, -1, 2 },
+{ 0, 2, 14, 1 },
+{ 0, 2, 14, 1 },
+{ 0, 4, 16, 1 },
+{ 0, 5, 16, 1 },
+{ 0, 4, 16, 1 },
+{ 0, 7, 19, 1 },
+{ 0, 3, 14, 1 },
+{ 0, 6, 21, 1 },
+{ 0, 3, 14, 1 },
+{ 0, 3, 14, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 25, 1 },
+{ 0, 3, -1, 3 },
+{ 0, 3, -1, 1 }
+};
+
+
+static const struct among a_1[2] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 }
+};
+
+
+static const struct among a_2[11] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 4, 0, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 2, 1 },
+{ 0, 3, 2, 1 },
+{ 0, 4, 4, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 7, 1 },
+{ 0, 4, 7, 1 },
+{ 0, 7, 9, 1 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v[] = { 17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 48, 0, 128 };
+
+static const unsigned char g_s_ending_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 0, 1, 1, 1, 0, 1, 0, 1, 1, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_s_ending[] = { 119, 125, 149, 1 };
+
+static const unsigned char g_v_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 192, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                i = 0;
+                break;
+            case 'e':
+                i = 1;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 2;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 3;
+                                        break;
+                                    case 'e':
+                                        i = 4;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 5;
+                                break;
+                            case 'e':
+                                i = 6;
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'h') break;
+                                i = 7;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 8;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 9;
+                if (n <= 2) break;
+                if (q[-3] != 't') break;
+                if (n <= 3) break;
+                if (q[-4] != 'e') break;
+                if (n <= 4) break;
+                if (q[-5] != 'h') break;
+                i = 10;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 11;
+                        break;
+                    case 'e':
+                        i = 12;
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'h') break;
+                        i = 13;
+                        break;
+                }
+                break;
+            case 's':
+                i = 14;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 15;
+                        break;
+                    case 'e':
+                        i = 16;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'e':
+                                        i = 17;
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 18;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 19;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'e') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'h') break;
+                                i = 20;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 21;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'e') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'h') break;
+                        i = 22;
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 23;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 24;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        i = 25;
+                        if (n <= 2) break;
+                        if (q[-3] != 'h') break;
+                        i = 26;
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 27;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 28;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_0[i].s_size;
+    return a_0[i].result;
+}
+static const symbol s_0[] = { 'e', 'r' };
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 't') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'd':
+                i = 0;
+                break;
+            case 'v':
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'g':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'l') break;
+                        i = 0;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 1;
+                        break;
+                    case 'i':
+                        i = 2;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                i = 3;
+                                break;
+                            case 'l':
+                                i = 4;
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 5;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 'l') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                i = 6;
+                break;
+            case 'v':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                if (n <= 2) break;
+                if (q[-3] != 'l') break;
+                i = 7;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'e':
+                        i = 8;
+                        break;
+                    case 's':
+                        i = 9;
+                        if (n <= 4) break;
+                        if (q[-5] != 't') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'e') break;
+                        if (n <= 6) break;
+                        if (q[-7] != 'h') break;
+                        i = 10;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+
+extern int norwegian_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    {   int c1 = z->c;
+        z->I[1] = z->l;
+        {   int c_test2 = z->c;
+            {   int ret = hop_utf8(z, z->c, z->l, 3);
+                if (ret < 0) goto lab0;
+                z->c = ret;
+            }
+            z->I[0] = z->c;
+            z->c = c_test2;
+        }
+        if (out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 248) < 0) goto lab0;
+        {   
+            int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 248);
+            if (ret < 0) goto lab0;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+        
+        if (!(z->I[1] < z->I[0])) goto lab1;
+        z->I[1] = z->I[0];
+    lab1:
+    lab0:
+        z->c = c1;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m3 = z->l - z->c; (void)m3;
+
+        {   int mlimit4;
+            if (z->c < z->I[1]) goto lab2;
+            mlimit4 = z->lb; z->lb = z->I[1];
+            z->ket = z->c;
+            if (z->c <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((1851426 >> (z->p[z->c - 1] & 0x1f)) & 1)) { z->lb = mlimit4; goto lab2; }
+            among_var = find_among_b_0(z);
+            if (!(among_var)) { z->lb = mlimit4; goto lab2; }
+            z->bra = z->c;
+            z->lb = mlimit4;
+        }
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int m5 = z->l - z->c; (void)m5;
+                    if (in_class_b_U(z, g_s_ending_class, g_s_ending, 98, 122, 0)) goto lab4;
+                    goto lab3;
+                lab4:
+                    z->c = z->l - m5;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'k') goto lab2;
+                    z->c--;
+                    if (out_class_b_U(z, g_v_class, g_v, 97, 248, 0)) goto lab2;
+                }
+            lab3:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 2, s_0);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab2:
+        z->c = z->l - m3;
+    }
+    {   int m6 = z->l - z->c; (void)m6;
+        {   int m_test7 = z->l - z->c;
+
+            {   int mlimit8;
+                if (z->c < z->I[1]) goto lab5;
+                mlimit8 = z->lb; z->lb = z->I[1];
+                z->ket = z->c;
+                if (z->c - 1 <= z->lb || z->p[z->c - 1] != 116 || (z->p[z->c - 2] != 100 && z->p[z->c - 2] != 118)) { z->lb = mlimit8; goto lab5; }
+                if (!(find_among_b_1(z))) { z->lb = mlimit8; goto lab5; }
+                z->bra = z->c;
+                z->lb = mlimit8;
+            }
+            z->c = z->l - m_test7;
+        }
+        {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+            if (ret < 0) goto lab5;
+            z->c = ret;
+        }
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab5:
+        z->c = z->l - m6;
+    }
+    {   int m9 = z->l - z->c; (void)m9;
+
+        {   int mlimit10;
+            if (z->c < z->I[1]) goto lab6;
+            mlimit10 = z->lb; z->lb = z->I[1];
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((4718720 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((37408 >> (z->p[z->c - 2] & 0x1f)) & 1)) { z->lb = mlimit10; goto lab6; }
+            if (!(find_among_b_2(z))) { z->lb = mlimit10; goto lab6; }
+            z->bra = z->c;
+            z->lb = mlimit10;
+        }
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab6:
+        z->c = z->l - m9;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * norwegian_UTF_8_create_env(void) { return SN_create_env(0, 2); }
+
+extern void norwegian_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
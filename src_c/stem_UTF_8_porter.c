@@ -0,0 +1,1123 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int porter_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * porter_UTF_8_create_env(void);
+extern void porter_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[4] =
+{
+{ 0, 1, -1, 3 },
+{ 0, 3, 0, 2 },
+{ 0, 4, 0, 1 },
+{ 0, 2, 0, -1 }
+};
+
+
+static const struct among a_1[13] =
+{
+{ 0, 0, -1, 3 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 1 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 1 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 1 }
+};
+
+
+static const struct among a_2[3] =
+{
+{ 0, 2, -1, 2 },
+{ 0, 3, 0, 1 },
+{ 0, 3, -1, 2 }
+};
+
+
+static const struct among a_3[20] =
+{
+{ 0, 4, -1, 3 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 4 },
+{ 0, 3, -1, 6 },
+{ 0, 4, -1, 9 },
+{ 0, 5, -1, 11 },
+{ 0, 5, -1, 5 },
+{ 0, 5, -1, 9 },
+{ 0, 6, -1, 13 },
+{ 0, 5, -1, 12 },
+{ 0, 6, -1, 1 },
+{ 0, 7, 10, 8 },
+{ 0, 5, -1, 9 },
+{ 0, 5, -1, 8 },
+{ 0, 7, 13, 7 },
+{ 0, 4, -1, 7 },
+{ 0, 4, -1, 8 },
+{ 0, 7, -1, 12 },
+{ 0, 7, -1, 10 },
+{ 0, 7, -1, 11 }
+};
+
+
+static const struct among a_4[7] =
+{
+{ 0, 5, -1, 2 },
+{ 0, 5, -1, 3 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 3, -1, 3 },
+{ 0, 4, -1, 3 }
+};
+
+
+static const struct among a_5[19] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 15, 1 },
+{ 0, 5, 16, 1 },
+{ 0, 2, -1, 1 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v[] = { 17, 65, 16, 1 };
+
+static const unsigned char g_v_WXY_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v_WXY[] = { 1, 17, 65, 208, 1 };
+
+static const symbol s_0[] = { 'Y' };
+static const symbol s_1[] = { 'Y' };
+static const unsigned char g_v_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 192, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 's') break;
+        i = 0;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'e':
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'i':
+                        i = 1;
+                        break;
+                    case 's':
+                        if (n <= 3) break;
+                        if (q[-4] != 's') break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 's':
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_0[i].s_size;
+    return a_0[i].result;
+}
+static const symbol s_2[] = { 's', 's' };
+static const symbol s_3[] = { 'i' };
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 0;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                i = 1;
+                break;
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_4[] = { 'e', 'e' };
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        i = 0;
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'b':
+                if (n <= 1) break;
+                if (q[-2] != 'b') break;
+                i = 1;
+                break;
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'd') break;
+                i = 2;
+                break;
+            case 'f':
+                if (n <= 1) break;
+                if (q[-2] != 'f') break;
+                i = 3;
+                break;
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'g') break;
+                i = 4;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'b') break;
+                i = 5;
+                break;
+            case 'm':
+                if (n <= 1) break;
+                if (q[-2] != 'm') break;
+                i = 6;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                i = 7;
+                break;
+            case 'p':
+                if (n <= 1) break;
+                if (q[-2] != 'p') break;
+                i = 8;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'r') break;
+                i = 9;
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 10;
+                        break;
+                    case 't':
+                        i = 11;
+                        break;
+                }
+                break;
+            case 'z':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 12;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+static const symbol s_5[] = { 'e' };
+static const symbol s_6[] = { 'e' };
+static const symbol s_7[] = { 'i' };
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 0;
+                                break;
+                            case 'e':
+                                i = 1;
+                                break;
+                        }
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'b':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 2;
+                                break;
+                            case 'e':
+                                i = 3;
+                                break;
+                            case 'l':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 4;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'u') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'o') break;
+                                i = 5;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 6;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'l':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 7;
+                                        break;
+                                    case 'i':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'b') break;
+                                        i = 8;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 9;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                if (n <= 3) break;
+                if (q[-4] != 'o') break;
+                if (n <= 4) break;
+                if (q[-5] != 'i') break;
+                if (n <= 5) break;
+                if (q[-6] != 't') break;
+                i = 10;
+                if (n <= 6) break;
+                if (q[-7] != 'a') break;
+                i = 11;
+                break;
+            case 'm':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                if (n <= 3) break;
+                if (q[-4] != 'l') break;
+                if (n <= 4) break;
+                if (q[-5] != 'a') break;
+                i = 12;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                if (n <= 3) break;
+                if (q[-4] != 't') break;
+                if (n <= 4) break;
+                if (q[-5] != 'a') break;
+                i = 13;
+                if (n <= 5) break;
+                if (q[-6] != 'z') break;
+                if (n <= 6) break;
+                if (q[-7] != 'i') break;
+                i = 14;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'z') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 15;
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 16;
+                        break;
+                }
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                if (n <= 3) break;
+                if (q[-4] != 'n') break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 'e':
+                        if (n <= 5) break;
+                        if (q[-6] != 'v') break;
+                        if (n <= 6) break;
+                        if (q[-7] != 'i') break;
+                        i = 17;
+                        break;
+                    case 'l':
+                        if (n <= 5) break;
+                        if (q[-6] != 'u') break;
+                        if (n <= 6) break;
+                        if (q[-7] != 'f') break;
+                        i = 18;
+                        break;
+                    case 's':
+                        if (n <= 5) break;
+                        if (q[-6] != 'u') break;
+                        if (n <= 6) break;
+                        if (q[-7] != 'o') break;
+                        i = 19;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+static const symbol s_8[] = { 't', 'i', 'o', 'n' };
+static const symbol s_9[] = { 'e', 'n', 'c', 'e' };
+static const symbol s_10[] = { 'a', 'n', 'c', 'e' };
+static const symbol s_11[] = { 'a', 'b', 'l', 'e' };
+static const symbol s_12[] = { 'e', 'n', 't' };
+static const symbol s_13[] = { 'e' };
+static const symbol s_14[] = { 'i', 'z', 'e' };
+static const symbol s_15[] = { 'a', 't', 'e' };
+static const symbol s_16[] = { 'a', 'l' };
+static const symbol s_17[] = { 'f', 'u', 'l' };
+static const symbol s_18[] = { 'o', 'u', 's' };
+static const symbol s_19[] = { 'i', 'v', 'e' };
+static const symbol s_20[] = { 'b', 'l', 'e' };
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'c') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 0;
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 1;
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'l') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                if (q[-2] != 't') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                if (n <= 3) break;
+                if (q[-4] != 'c') break;
+                if (n <= 4) break;
+                if (q[-5] != 'i') break;
+                i = 3;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'c') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 4;
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 'f') break;
+                        i = 5;
+                        break;
+                }
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                if (n <= 3) break;
+                if (q[-4] != 'n') break;
+                i = 6;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+static const symbol s_21[] = { 'a', 'l' };
+static const symbol s_22[] = { 'i', 'c' };
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'c':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 0;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 1;
+                                break;
+                            case 'e':
+                                i = 2;
+                                break;
+                        }
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'b') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 3;
+                                break;
+                            case 'i':
+                                i = 4;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 5;
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 6;
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 7;
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                if (q[-2] != 't') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 8;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                i = 9;
+                break;
+            case 'm':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 10;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 11;
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 12;
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 'u') break;
+                if (n <= 2) break;
+                if (q[-3] != 'o') break;
+                i = 13;
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'a':
+                        i = 14;
+                        break;
+                    case 'e':
+                        i = 15;
+                        if (n <= 3) break;
+                        if (q[-4] != 'm') break;
+                        i = 16;
+                        if (n <= 4) break;
+                        if (q[-5] != 'e') break;
+                        i = 17;
+                        break;
+                }
+                break;
+            case 'u':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                i = 18;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+static const symbol s_23[] = { 'y' };
+
+extern int porter_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    z->I[2] = 0;
+    {   int c1 = z->c;
+        z->bra = z->c;
+        if (z->c == z->l || z->p[z->c] != 'y') goto lab0;
+        z->c++;
+        z->ket = z->c;
+        {   int ret = slice_from_s(z, 1, s_0);
+            if (ret < 0) return ret;
+        }
+        z->I[2] = 1;
+    lab0:
+        z->c = c1;
+    }
+    {   int c2 = z->c;
+        while(1) {
+            int c3 = z->c;
+            while(1) {
+                int c4 = z->c;
+                if (in_class_U(z, g_v_class, g_v, 97, 121, 0)) goto lab3;
+                z->bra = z->c;
+                if (z->c == z->l || z->p[z->c] != 'y') goto lab3;
+                z->c++;
+                z->ket = z->c;
+                z->c = c4;
+                break;
+            lab3:
+                z->c = c4;
+                {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                    if (ret < 0) goto lab2;
+                    z->c = ret;
+                }
+            }
+            {   int ret = slice_from_s(z, 1, s_1);
+                if (ret < 0) return ret;
+            }
+            z->I[2] = 1;
+            continue;
+        lab2:
+            z->c = c3;
+            break;
+        }
+        z->c = c2;
+    }
+    z->I[1] = z->l;
+    z->I[0] = z->l;
+    {   int c5 = z->c;
+        {   
+            int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 121);
+            if (ret < 0) goto lab4;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 121);
+            if (ret < 0) goto lab4;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+        {   
+            int ret = out_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 121);
+            if (ret < 0) goto lab4;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_scan_U(z, g_v_class, g_v_scan, g_v, 97, 121);
+            if (ret < 0) goto lab4;
+            z->c += ret;
+        }
+        z->I[0] = z->c;
+    lab4:
+        z->c = c5;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m6 = z->l - z->c; (void)m6;
+        z->ket = z->c;
+        if (z->c <= z->lb || z->p[z->c - 1] != 115) goto lab5;
+        among_var = find_among_b_0(z);
+        if (!(among_var)) goto lab5;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 2, s_2);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 1, s_3);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab5:
+        z->c = z->l - m6;
+    }
+    {   int m7 = z->l - z->c; (void)m7;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 100 && z->p[z->c - 1] != 103) || (z->p[z->c - 2] != 101 && z->p[z->c - 2] != 110)) goto lab6;
+        among_var = find_among_b_2(z);
+        if (!(among_var)) goto lab6;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(z->I[1] <= z->c)) goto lab6;
+                {   int ret = slice_from_s(z, 2, s_4);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int m_test8 = z->l - z->c;
+                    {   
+                        int ret = out_class_b_U(z, g_v_class, g_v, 97, 121, 1);
+                        if (ret < 0) goto lab6;
+                        z->c -= ret;
+                    }
+                    z->c = z->l - m_test8;
+                }
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int m_test9 = z->l - z->c;
+                    if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((68514004 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((1401558 >> (z->p[z->c - 2] & 0x1f)) & 1)) among_var = 3; else
+                    among_var = find_among_b_1(z);
+                    if (!(among_var)) goto lab6;
+                    z->c = z->l - m_test9;
+                }
+                switch (among_var) {
+                    case 1:
+                        {   int ret;
+                            {   int saved_c = z->c;
+                                ret = insert_s(z, z->c, z->c, 1, s_5);
+                                z->c = saved_c;
+                            }
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        z->ket = z->c;
+                        {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+                            if (ret < 0) goto lab6;
+                            z->c = ret;
+                        }
+                        z->bra = z->c;
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 3:
+                        if (z->c != z->I[1]) goto lab6;
+                        {   int m_test10 = z->l - z->c;
+                            if (out_class_b_U(z, g_v_WXY_class, g_v_WXY, 89, 121, 0)) goto lab6;
+                            if (in_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab6;
+                            if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab6;
+                            z->c = z->l - m_test10;
+                        }
+                        {   int ret;
+                            {   int saved_c = z->c;
+                                ret = insert_s(z, z->c, z->c, 1, s_6);
+                                z->c = saved_c;
+                            }
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+                break;
+        }
+    lab6:
+        z->c = z->l - m7;
+    }
+    {   int m11 = z->l - z->c; (void)m11;
+        z->ket = z->c;
+        {   int m12 = z->l - z->c; (void)m12;
+            if (z->c <= z->lb || z->p[z->c - 1] != 'y') goto lab9;
+            z->c--;
+            goto lab8;
+        lab9:
+            z->c = z->l - m12;
+            if (z->c <= z->lb || z->p[z->c - 1] != 'Y') goto lab7;
+            z->c--;
+        }
+    lab8:
+        z->bra = z->c;
+        {   
+            int ret = out_class_b_U(z, g_v_class, g_v, 97, 121, 1);
+            if (ret < 0) goto lab7;
+            z->c -= ret;
+        }
+        {   int ret = slice_from_s(z, 1, s_7);
+            if (ret < 0) return ret;
+        }
+    lab7:
+        z->c = z->l - m11;
+    }
+    {   int m13 = z->l - z->c; (void)m13;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((815616 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((1609770 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab10;
+        among_var = find_among_b_3(z);
+        if (!(among_var)) goto lab10;
+        z->bra = z->c;
+        if (!(z->I[1] <= z->c)) goto lab10;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 4, s_8);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 4, s_9);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 4, s_10);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                {   int ret = slice_from_s(z, 4, s_11);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                {   int ret = slice_from_s(z, 3, s_12);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {   int ret = slice_from_s(z, 1, s_13);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                {   int ret = slice_from_s(z, 3, s_14);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 8:
+                {   int ret = slice_from_s(z, 3, s_15);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 9:
+                {   int ret = slice_from_s(z, 2, s_16);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 10:
+                {   int ret = slice_from_s(z, 3, s_17);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 11:
+                {   int ret = slice_from_s(z, 3, s_18);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 12:
+                {   int ret = slice_from_s(z, 3, s_19);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 13:
+                {   int ret = slice_from_s(z, 3, s_20);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab10:
+        z->c = z->l - m13;
+    }
+    {   int m14 = z->l - z->c; (void)m14;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((528928 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((74973186 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab11;
+        among_var = find_among_b_4(z);
+        if (!(among_var)) goto lab11;
+        z->bra = z->c;
+        if (!(z->I[1] <= z->c)) goto lab11;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 2, s_21);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 2, s_22);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab11:
+        z->c = z->l - m14;
+    }
+    {   int m15 = z->l - z->c; (void)m15;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((3961384 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((75026986 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab12;
+        among_var = find_among_b_5(z);
+        if (!(among_var)) goto lab12;
+        z->bra = z->c;
+        if (!(z->I[0] <= z->c)) goto lab12;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int m16 = z->l - z->c; (void)m16;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 's') goto lab14;
+                    z->c--;
+                    goto lab13;
+                lab14:
+                    z->c = z->l - m16;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 't') goto lab12;
+                    z->c--;
+                }
+            lab13:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab12:
+        z->c = z->l - m15;
+    }
+    {   int m17 = z->l - z->c; (void)m17;
+        z->ket = z->c;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'e') goto lab15;
+        z->c--;
+        z->bra = z->c;
+        {   int m18 = z->l - z->c; (void)m18;
+            if (!(z->I[0] <= z->c)) goto lab17;
+            goto lab16;
+        lab17:
+            z->c = z->l - m18;
+            if (!(z->I[1] <= z->c)) goto lab15;
+            {   int m19 = z->l - z->c; (void)m19;
+                if (out_class_b_U(z, g_v_WXY_class, g_v_WXY, 89, 121, 0)) goto lab18;
+                if (in_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab18;
+                if (out_class_b_U(z, g_v_class, g_v, 97, 121, 0)) goto lab18;
+                goto lab15;
+            lab18:
+                z->c = z->l - m19;
+            }
+        }
+    lab16:
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab15:
+        z->c = z->l - m17;
+    }
+    {   int m20 = z->l - z->c; (void)m20;
+        z->ket = z->c;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'l') goto lab19;
+        z->c--;
+        z->bra = z->c;
+        if (!(z->I[0] <= z->c)) goto lab19;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'l') goto lab19;
+        z->c--;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab19:
+        z->c = z->l - m20;
+    }
+    z->c = z->lb;
+    {   int c21 = z->c;
+        if (!(z->I[2])) goto lab20;
+        while(1) {
+            int c22 = z->c;
+            while(1) {
+                int c23 = z->c;
+                z->bra = z->c;
+                if (z->c == z->l || z->p[z->c] != 'Y') goto lab22;
+                z->c++;
+                z->ket = z->c;
+                z->c = c23;
+                break;
+            lab22:
+                z->c = c23;
+                {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                    if (ret < 0) goto lab21;
+                    z->c = ret;
+                }
+            }
+            {   int ret = slice_from_s(z, 1, s_23);
+                if (ret < 0) return ret;
+            }
+            continue;
+        lab21:
+            z->c = c22;
+            break;
+        }
+    lab20:
+        z->c = c21;
+    }
+    return 1;
+}
+
+extern struct SN_env * porter_UTF_8_create_env(void) { return SN_create_env(0, 3); }
+
+extern void porter_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
@@ -0,0 +1,1590 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int russian_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * russian_UTF_8_create_env(void);
+extern void russian_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[9] =
+{
+{ 0, 10, -1, 1 },
+{ 0, 12, 0, 2 },
+{ 0, 12, 0, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 3, 2 },
+{ 0, 4, 3, 2 },
+{ 0, 6, -1, 1 },
+{ 0, 8, 6, 2 },
+{ 0, 8, 6, 2 }
+};
+
+
+static const struct among a_1[26] =
+{
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 }
+};
+
+
+static const struct among a_2[8] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 6, 0, 2 },
+{ 0, 6, 0, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 3, 1 },
+{ 0, 6, 4, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+
+static const struct among a_3[2] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+
+static const struct among a_4[46] =
+{
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 1, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 4, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 7, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 9, 2 },
+{ 0, 6, 9, 2 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 4, 14, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 16, 2 },
+{ 0, 6, 16, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 19, 2 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 2 },
+{ 0, 6, -1, 1 },
+{ 0, 8, 23, 2 },
+{ 0, 8, 23, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 26, 2 },
+{ 0, 6, 26, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 29, 2 },
+{ 0, 4, 29, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 32, 2 },
+{ 0, 4, 32, 2 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 38, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 40, 2 },
+{ 0, 6, 40, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 43, 2 },
+{ 0, 6, 43, 1 }
+};
+
+
+static const struct among a_5[36] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 6, 1 },
+{ 0, 4, 6, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 9, 1 },
+{ 0, 4, 9, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 15, 1 },
+{ 0, 4, 15, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 18, 1 },
+{ 0, 4, 18, 1 },
+{ 0, 6, 18, 1 },
+{ 0, 8, 21, 1 },
+{ 0, 6, 18, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 24, 1 },
+{ 0, 6, 25, 1 },
+{ 0, 4, 24, 1 },
+{ 0, 4, 24, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 29, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 32, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_6[2] =
+{
+{ 0, 6, -1, 1 },
+{ 0, 8, -1, 1 }
+};
+
+
+static const struct among a_7[4] =
+{
+{ 0, 6, -1, 1 },
+{ 0, 2, -1, 3 },
+{ 0, 8, -1, 1 },
+{ 0, 2, -1, 2 }
+};
+
+static const unsigned char g_v_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_v[] = { 33, 65, 8, 232 };
+
+static const symbol s_0[] = { 0xD1, 0x91 };
+static const symbol s_1[] = { 0xD0, 0xB5 };
+
+static const unsigned char a_0_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x10, 0x0, 0x0, 0x0, 0x0, 0x4, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x8C:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x81) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD1) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB8) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD0) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x88) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xD1) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xB2) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xD0) break;
+                i = 0;
+                if (n <= 10) break;
+                switch (q[-11]) {
+                    case 0x8B:
+                        if (n <= 11) break;
+                        if (q[-12] != 0xD1) break;
+                        i = 1;
+                        break;
+                    case 0xB8:
+                        if (n <= 11) break;
+                        if (q[-12] != 0xD0) break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0xB2:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                i = 3;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x8B:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 4;
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 5;
+                        break;
+                }
+                break;
+            case 0xB8:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x88) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD1) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB2) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD0) break;
+                i = 6;
+                if (n <= 6) break;
+                switch (q[-7]) {
+                    case 0x8B:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD1) break;
+                        i = 7;
+                        break;
+                    case 0xB8:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD0) break;
+                        i = 8;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_0[i].s_size;
+    return a_0[i].result;
+}
+static const symbol s_2[] = { 0xD0, 0xB0 };
+static const symbol s_3[] = { 0xD1, 0x8F };
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x8C:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x81) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD1) break;
+                i = 0;
+                break;
+            case 0x8F:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x81) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD1) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+
+static const unsigned char a_1_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x28, 0xC0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x53, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBC) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD0) break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0xB5:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD0) break;
+                        i = 0;
+                        break;
+                    case 0xBE:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD0) break;
+                        i = 1;
+                        break;
+                }
+                break;
+            case 0x85:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x8B:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 2;
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 3;
+                        break;
+                }
+                break;
+            case 0x8E:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x83:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 4;
+                        break;
+                    case 0x8E:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 5;
+                        break;
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 6;
+                        break;
+                    case 0xBE:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 7;
+                        break;
+                }
+                break;
+            case 0x8F:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x8F:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 8;
+                        break;
+                    case 0xB0:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 9;
+                        break;
+                }
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x8B:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 10;
+                        break;
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 11;
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 12;
+                        break;
+                    case 0xBE:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 13;
+                        break;
+                }
+                break;
+            case 0xB8:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBC) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD0) break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x8B:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD1) break;
+                        i = 14;
+                        break;
+                    case 0xB8:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD0) break;
+                        i = 15;
+                        break;
+                }
+                break;
+            case 0xB9:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x8B:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 16;
+                        break;
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 17;
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 18;
+                        break;
+                    case 0xBE:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 19;
+                        break;
+                }
+                break;
+            case 0xBC:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x8B:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 20;
+                        break;
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 21;
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 22;
+                        break;
+                    case 0xBE:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 23;
+                        break;
+                }
+                break;
+            case 0xBE:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB3) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD0) break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0xB5:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD0) break;
+                        i = 24;
+                        break;
+                    case 0xBE:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD0) break;
+                        i = 25;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+
+static const unsigned char a_2_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x88:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB2) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD0) break;
+                i = 0;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x8B:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD1) break;
+                        i = 1;
+                        break;
+                    case 0xB8:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD0) break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0x89:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                i = 3;
+                if (n <= 2) break;
+                if (q[-3] != 0x8E) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD1) break;
+                i = 4;
+                if (n <= 4) break;
+                if (q[-5] != 0x83) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD1) break;
+                i = 5;
+                break;
+            case 0xBC:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD0) break;
+                i = 6;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBD) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD0) break;
+                i = 7;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_4[] = { 0xD0, 0xB0 };
+static const symbol s_5[] = { 0xD1, 0x8F };
+
+static const unsigned char a_4_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x4, 0x58, 0x0, 0x0, 0x0, 0x0, 0x21, 0x7B, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x82:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x8B:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 0;
+                        break;
+                    case 0x8E:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 1;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x83) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD1) break;
+                        i = 2;
+                        break;
+                    case 0x8F:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 3;
+                        break;
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 4;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x83) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD1) break;
+                        i = 5;
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 6;
+                        break;
+                }
+                break;
+            case 0x8B:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBD) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD0) break;
+                i = 7;
+                if (n <= 4) break;
+                if (q[-5] != 0xB5) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD0) break;
+                i = 8;
+                break;
+            case 0x8C:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x82:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 9;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x8B:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD1) break;
+                                i = 10;
+                                break;
+                            case 0xB8:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD0) break;
+                                i = 11;
+                                break;
+                        }
+                        break;
+                    case 0x88:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0xB5:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD0) break;
+                                i = 12;
+                                break;
+                            case 0xB8:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD0) break;
+                                i = 13;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x8E:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                i = 14;
+                if (n <= 2) break;
+                if (q[-3] != 0x83) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD1) break;
+                i = 15;
+                break;
+            case 0xB0:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xBB:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 16;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x8B:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD1) break;
+                                i = 17;
+                                break;
+                            case 0xB8:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD0) break;
+                                i = 18;
+                                break;
+                        }
+                        break;
+                    case 0xBD:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 19;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB5) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD0) break;
+                        i = 20;
+                        break;
+                }
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x82) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD1) break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0xB5:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD0) break;
+                        i = 21;
+                        break;
+                    case 0xB8:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD0) break;
+                        i = 22;
+                        break;
+                    case 0xB9:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD0) break;
+                        i = 23;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x83:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD1) break;
+                                i = 24;
+                                break;
+                            case 0xB5:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD0) break;
+                                i = 25;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0xB8:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xBB) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD0) break;
+                i = 26;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x8B:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD1) break;
+                        i = 27;
+                        break;
+                    case 0xB8:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD0) break;
+                        i = 28;
+                        break;
+                }
+                break;
+            case 0xB9:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                i = 29;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x83:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 30;
+                        break;
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 31;
+                        break;
+                }
+                break;
+            case 0xBB:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                i = 32;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x8B:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 33;
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 34;
+                        break;
+                }
+                break;
+            case 0xBC:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x8B:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 35;
+                        break;
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 36;
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 37;
+                        break;
+                }
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                i = 38;
+                if (n <= 2) break;
+                if (q[-3] != 0xB5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD0) break;
+                i = 39;
+                break;
+            case 0xBE:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xBB:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 40;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x8B:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD1) break;
+                                i = 41;
+                                break;
+                            case 0xB8:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD0) break;
+                                i = 42;
+                                break;
+                        }
+                        break;
+                    case 0xBD:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 43;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0xB5:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD0) break;
+                                i = 44;
+                                break;
+                            case 0xBD:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD0) break;
+                                i = 45;
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+static const symbol s_6[] = { 0xD0, 0xB0 };
+static const symbol s_7[] = { 0xD1, 0x8F };
+
+static const unsigned char a_5_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x28, 0xD8, 0x0, 0x0, 0x0, 0x0, 0x25, 0x53, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x83:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                i = 0;
+                break;
+            case 0x85:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x8F:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 1;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB8) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD0) break;
+                        i = 2;
+                        break;
+                    case 0xB0:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 3;
+                        break;
+                }
+                break;
+            case 0x8B:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                i = 4;
+                break;
+            case 0x8C:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                i = 5;
+                break;
+            case 0x8E:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                i = 6;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x8C:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 7;
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 8;
+                        break;
+                }
+                break;
+            case 0x8F:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                i = 9;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x8C:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 10;
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 11;
+                        break;
+                }
+                break;
+            case 0xB0:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                i = 12;
+                break;
+            case 0xB2:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 13;
+                        break;
+                    case 0xBE:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 14;
+                        break;
+                }
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                i = 15;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x8C:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 16;
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 17;
+                        break;
+                }
+                break;
+            case 0xB8:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                i = 18;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 19;
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 20;
+                        break;
+                    case 0xBC:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x8F:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD1) break;
+                                i = 21;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB8) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD0) break;
+                                i = 22;
+                                break;
+                            case 0xB0:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD0) break;
+                                i = 23;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0xB9:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                i = 24;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 25;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB8) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD0) break;
+                        i = 26;
+                        break;
+                    case 0xB8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 27;
+                        break;
+                    case 0xBE:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 28;
+                        break;
+                }
+                break;
+            case 0xBC:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x8F:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD1) break;
+                        i = 29;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB8) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD0) break;
+                        i = 30;
+                        break;
+                    case 0xB0:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 31;
+                        break;
+                    case 0xB5:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 32;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB8) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD0) break;
+                        i = 33;
+                        break;
+                    case 0xBE:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD0) break;
+                        i = 34;
+                        break;
+                }
+                break;
+            case 0xBE:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                i = 35;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+static const symbol s_8[] = { 0xD0, 0xB8 };
+
+static int find_among_b_6(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x82:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x81) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD1) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBE) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD0) break;
+                i = 0;
+                break;
+            case 0x8C:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x82) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD1) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x81) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD1) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xBE) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xD0) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_6[i].s_size;
+    return a_6[i].result;
+}
+
+static const unsigned char a_7_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x11, 0x0, 0x0, 0x0, 0x0, 0x20, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_7(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x88:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB9) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD0) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB5) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD0) break;
+                i = 0;
+                break;
+            case 0x8C:
+                if (n <= 1) break;
+                if (q[-2] != 0xD1) break;
+                i = 1;
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x88) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD1) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB9) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD0) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB5) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xD0) break;
+                i = 2;
+                break;
+            case 0xBD:
+                if (n <= 1) break;
+                if (q[-2] != 0xD0) break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_7[i].s_size;
+    return a_7[i].result;
+}
+static const symbol s_9[] = { 0xD0, 0xBD };
+static const symbol s_10[] = { 0xD0, 0xBD };
+static const symbol s_11[] = { 0xD0, 0xBD };
+
+extern int russian_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    {   int c1 = z->c;
+        while(1) {
+            int c2 = z->c;
+            while(1) {
+                int c3 = z->c;
+                z->bra = z->c;
+                if (!(eq_s(z, 2, s_0))) goto lab2;
+                z->ket = z->c;
+                z->c = c3;
+                break;
+            lab2:
+                z->c = c3;
+                {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                    if (ret < 0) goto lab1;
+                    z->c = ret;
+                }
+            }
+            {   int ret = slice_from_s(z, 2, s_1);
+                if (ret < 0) return ret;
+            }
+            continue;
+        lab1:
+            z->c = c2;
+            break;
+        }
+        z->c = c1;
+    }
+    
+    z->I[1] = z->l;
+    z->I[0] = z->l;
+    {   int c4 = z->c;
+        {   
+            int ret = out_class_U(z, g_v_class, g_v, 1072, 1103, 1);
+            if (ret < 0) goto lab4;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+        {   
+            int ret = in_class_U(z, g_v_class, g_v, 1072, 1103, 1);
+            if (ret < 0) goto lab4;
+            z->c += ret;
+        }
+        {   
+            int ret = out_class_U(z, g_v_class, g_v, 1072, 1103, 1);
+            if (ret < 0) goto lab4;
+            z->c += ret;
+        }
+        {   
+            int ret = in_class_U(z, g_v_class, g_v, 1072, 1103, 1);
+            if (ret < 0) goto lab4;
+            z->c += ret;
+        }
+        z->I[0] = z->c;
+    lab4:
+        z->c = c4;
+    }
+    z->lb = z->c; z->c = z->l;
+
+
+    {   int mlimit5;
+        if (z->c < z->I[1]) return 0;
+        mlimit5 = z->lb; z->lb = z->I[1];
+        {   int m6 = z->l - z->c; (void)m6;
+            {   int m7 = z->l - z->c; (void)m7;
+                z->ket = z->c;
+                if (z->c - 1 <= z->lb || !((a_0_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 208 && z->p[z->c - 2] != 209)) goto lab7;
+                among_var = find_among_b_0(z);
+                if (!(among_var)) goto lab7;
+                z->bra = z->c;
+                switch (among_var) {
+                    case 1:
+                        {   int m8 = z->l - z->c; (void)m8;
+                            if (!(eq_s_b(z, 2, s_2))) goto lab9;
+                            goto lab8;
+                        lab9:
+                            z->c = z->l - m8;
+                            if (!(eq_s_b(z, 2, s_3))) goto lab7;
+                        }
+                    lab8:
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+                goto lab6;
+            lab7:
+                z->c = z->l - m7;
+                {   int m9 = z->l - z->c; (void)m9;
+                    z->ket = z->c;
+                    if (z->c - 3 <= z->lb || (z->p[z->c - 1] != 140 && z->p[z->c - 1] != 143) || z->p[z->c - 2] != 209) { z->c = z->l - m9; goto lab10; }
+                    if (!(find_among_b_3(z))) { z->c = z->l - m9; goto lab10; }
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                lab10:
+                    ;
+                }
+                {   int m10 = z->l - z->c; (void)m10;
+                    z->ket = z->c;
+                    if (z->c - 3 <= z->lb || !((a_1_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 208 && z->p[z->c - 2] != 209)) goto lab12;
+                    if (!(find_among_b_1(z))) goto lab12;
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int m11 = z->l - z->c; (void)m11;
+                        z->ket = z->c;
+                        if (z->c - 1 <= z->lb || !((a_2_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 208 && z->p[z->c - 2] != 209)) { z->c = z->l - m11; goto lab13; }
+                        among_var = find_among_b_2(z);
+                        if (!(among_var)) { z->c = z->l - m11; goto lab13; }
+                        z->bra = z->c;
+                        switch (among_var) {
+                            case 1:
+                                {   int m12 = z->l - z->c; (void)m12;
+                                    if (!(eq_s_b(z, 2, s_4))) goto lab15;
+                                    goto lab14;
+                                lab15:
+                                    z->c = z->l - m12;
+                                    if (!(eq_s_b(z, 2, s_5))) { z->c = z->l - m11; goto lab13; }
+                                }
+                            lab14:
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                break;
+                            case 2:
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                break;
+                        }
+                    lab13:
+                        ;
+                    }
+                    goto lab11;
+                lab12:
+                    z->c = z->l - m10;
+                    z->ket = z->c;
+                    if (z->c - 1 <= z->lb || !((a_4_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 208 && z->p[z->c - 2] != 209)) goto lab16;
+                    among_var = find_among_b_4(z);
+                    if (!(among_var)) goto lab16;
+                    z->bra = z->c;
+                    switch (among_var) {
+                        case 1:
+                            {   int m13 = z->l - z->c; (void)m13;
+                                if (!(eq_s_b(z, 2, s_6))) goto lab18;
+                                goto lab17;
+                            lab18:
+                                z->c = z->l - m13;
+                                if (!(eq_s_b(z, 2, s_7))) goto lab16;
+                            }
+                        lab17:
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 2:
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                    }
+                    goto lab11;
+                lab16:
+                    z->c = z->l - m10;
+                    z->ket = z->c;
+                    if (z->c - 1 <= z->lb || !((a_5_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 208 && z->p[z->c - 2] != 209)) goto lab5;
+                    if (!(find_among_b_5(z))) goto lab5;
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab11:
+                ;
+            }
+        lab6:
+        lab5:
+            z->c = z->l - m6;
+        }
+        {   int m14 = z->l - z->c; (void)m14;
+            z->ket = z->c;
+            if (!(eq_s_b(z, 2, s_8))) { z->c = z->l - m14; goto lab19; }
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        lab19:
+            ;
+        }
+        {   int m15 = z->l - z->c; (void)m15;
+            z->ket = z->c;
+            if (z->c - 5 <= z->lb || (z->p[z->c - 1] != 130 && z->p[z->c - 1] != 140) || z->p[z->c - 2] != 209) goto lab20;
+            if (!(find_among_b_6(z))) goto lab20;
+            z->bra = z->c;
+            if (!(z->I[0] <= z->c)) goto lab20;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        lab20:
+            z->c = z->l - m15;
+        }
+        {   int m16 = z->l - z->c; (void)m16;
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb || !((a_7_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 208 && z->p[z->c - 2] != 209)) goto lab21;
+            among_var = find_among_b_7(z);
+            if (!(among_var)) goto lab21;
+            z->bra = z->c;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    z->ket = z->c;
+                    if (!(eq_s_b(z, 2, s_9))) goto lab21;
+                    z->bra = z->c;
+                    if (!(eq_s_b(z, 2, s_10))) goto lab21;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    if (!(eq_s_b(z, 2, s_11))) goto lab21;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 3:
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+        lab21:
+            z->c = z->l - m16;
+        }
+        z->lb = mlimit5;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * russian_UTF_8_create_env(void) { return SN_create_env(0, 2); }
+
+extern void russian_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
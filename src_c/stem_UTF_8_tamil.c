@@ -0,0 +1,3624 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int tamil_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+static int r_fix_endings(struct SN_env * z);
+static int r_fix_ending(struct SN_env * z);
+static int r_fix_va_start(struct SN_env * z);
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * tamil_UTF_8_create_env(void);
+extern void tamil_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[10] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_1[3] =
+{
+{ 0, 12, -1, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 9, -1, -1 }
+};
+
+
+static const struct among a_2[3] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_3[6] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_4[6] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_5[6] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_6[6] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_7[6] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_8[3] =
+{
+{ 0, 6, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_9[8] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_10[8] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_11[3] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_12[10] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_13[6] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_14[3] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_15[2] =
+{
+{ 0, 6, -1, -1 },
+{ 0, 6, -1, -1 }
+};
+
+
+static const struct among a_16[8] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_17[13] =
+{
+{ 0, 15, -1, -1 },
+{ 0, 18, -1, -1 },
+{ 0, 9, -1, -1 },
+{ 0, 12, -1, -1 },
+{ 0, 18, -1, -1 },
+{ 0, 21, -1, -1 },
+{ 0, 12, -1, -1 },
+{ 0, 15, -1, -1 },
+{ 0, 9, -1, -1 },
+{ 0, 18, 8, -1 },
+{ 0, 15, -1, -1 },
+{ 0, 9, -1, -1 },
+{ 0, 15, -1, -1 }
+};
+
+
+static const struct among a_18[6] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_19[6] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_20[8] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_21[8] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_22[2] =
+{
+{ 0, 9, -1, -1 },
+{ 0, 24, -1, -1 }
+};
+
+
+static const struct among a_23[12] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_24[8] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_25[6] =
+{
+{ 0, 18, -1, -1 },
+{ 0, 21, -1, -1 },
+{ 0, 12, -1, -1 },
+{ 0, 15, -1, -1 },
+{ 0, 18, -1, -1 },
+{ 0, 9, -1, -1 }
+};
+
+static const symbol s_0[] = { 0xE0, 0xAE, 0xB5, 0xE0, 0xAF, 0x8B };
+static const symbol s_1[] = { 0xE0, 0xAE, 0xB5, 0xE0, 0xAF, 0x8B };
+static const symbol s_2[] = { 0xE0, 0xAE, 0x93 };
+static const symbol s_3[] = { 0xE0, 0xAE, 0xB5, 0xE0, 0xAF, 0x8A };
+static const symbol s_4[] = { 0xE0, 0xAE, 0xB5, 0xE0, 0xAF, 0x8A };
+static const symbol s_5[] = { 0xE0, 0xAE, 0x92 };
+static const symbol s_6[] = { 0xE0, 0xAE, 0xB5, 0xE0, 0xAF, 0x81 };
+static const symbol s_7[] = { 0xE0, 0xAE, 0xB5, 0xE0, 0xAF, 0x81 };
+static const symbol s_8[] = { 0xE0, 0xAE, 0x89 };
+static const symbol s_9[] = { 0xE0, 0xAE, 0xB5, 0xE0, 0xAF, 0x82 };
+static const symbol s_10[] = { 0xE0, 0xAE, 0xB5, 0xE0, 0xAF, 0x82 };
+static const symbol s_11[] = { 0xE0, 0xAE, 0x8A };
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x8D:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0xA4:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xAE) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x8D) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xAF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xA8) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xAE) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xE0) break;
+                        i = 0;
+                        break;
+                    case 0xA8:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xAE) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        i = 1;
+                        break;
+                }
+                break;
+            case 0xA4:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x8D) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xAF) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xE0) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xA8) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xAE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xE0) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+static const symbol s_12[] = { 0xE0, 0xAE, 0xAF, 0xE0, 0xAF, 0x8D };
+
+static const unsigned char a_2_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x1, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x88:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_13[] = { 0xE0, 0xAE, 0x9F, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0xAA, 0xE0, 0xAF, 0x8D };
+static const symbol s_14[] = { 0xE0, 0xAE, 0x9F, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0x95, 0xE0, 0xAF, 0x8D };
+static const symbol s_15[] = { 0xE0, 0xAE, 0xB3, 0xE0, 0xAF, 0x8D };
+static const symbol s_16[] = { 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0xB1, 0xE0, 0xAF, 0x8D };
+static const symbol s_17[] = { 0xE0, 0xAE, 0xB2, 0xE0, 0xAF, 0x8D };
+static const symbol s_18[] = { 0xE0, 0xAE, 0xB1, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0x95, 0xE0, 0xAF, 0x8D };
+static const symbol s_19[] = { 0xE0, 0xAE, 0xB2, 0xE0, 0xAF, 0x8D };
+static const symbol s_20[] = { 0xE0, 0xAE, 0x9F, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0x9F, 0xE0, 0xAF, 0x8D };
+static const symbol s_21[] = { 0xE0, 0xAE, 0x9F, 0xE0, 0xAF, 0x81 };
+static const symbol s_22[] = { 0xE0, 0xAE, 0xA4, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0xA4, 0xE0, 0xAF, 0x8D };
+static const symbol s_23[] = { 0xE0, 0xAF, 0x88 };
+static const symbol s_24[] = { 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_25[] = { 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0x95, 0xE0, 0xAF, 0x8D };
+static const symbol s_26[] = { 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0x95, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0x95, 0xE0, 0xAF, 0x8D };
+static const symbol s_27[] = { 0xE0, 0xAF, 0x8D };
+static const symbol s_28[] = { 0xE0, 0xAF, 0x8D };
+
+static const unsigned char a_3_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x20, 0x84, 0x10, 0x4, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x95:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x9A:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0x9F:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+            case 0xA4:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 3;
+                break;
+            case 0xAA:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 4;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 5;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+static const symbol s_29[] = { 0xE0, 0xAF, 0x8D };
+
+static const unsigned char a_4_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x20, 0x84, 0x10, 0x4, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x95:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x9A:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0x9F:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+            case 0xA4:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 3;
+                break;
+            case 0xAA:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 4;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 5;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+static const symbol s_30[] = { 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0x95, 0xE0, 0xAF, 0x8D };
+static const symbol s_31[] = { 0xE0, 0xAF, 0x8D };
+static const symbol s_32[] = { 0xE0, 0xAF, 0x8D };
+
+static const unsigned char a_5_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x20, 0x84, 0x10, 0x4, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x95:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x9A:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0x9F:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+            case 0xA4:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 3;
+                break;
+            case 0xAA:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 4;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 5;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+static const symbol s_33[] = { 0xE0, 0xAF, 0x8D };
+
+static int find_among_b_6(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0xAF:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0xB0:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0xB2:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+            case 0xB3:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 3;
+                break;
+            case 0xB4:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 4;
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 5;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_6[i].s_size;
+    return a_6[i].result;
+}
+
+static const unsigned char a_7_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x42, 0x8, 0x43, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_7(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x99:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x9E:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0xA3:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+            case 0xA8:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 3;
+                break;
+            case 0xA9:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 4;
+                break;
+            case 0xAE:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 5;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_7[i].s_size;
+    return a_7[i].result;
+}
+static const symbol s_34[] = { 0xE0, 0xAF, 0x8D };
+static const symbol s_35[] = { 0xE0, 0xAF, 0x8D };
+
+static const unsigned char a_8_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x20, 0x0, 0x0, 0x0, 0x80, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_8(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x8D:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xB5) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xAE) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xE0) break;
+                i = 0;
+                break;
+            case 0xAF:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0xB5:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_8[i].s_size;
+    return a_8[i].result;
+}
+static const symbol s_36[] = { 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x81 };
+
+static const unsigned char a_9_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xC7, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xC0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_9(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0x82:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+            case 0x86:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 3;
+                break;
+            case 0x87:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 4;
+                break;
+            case 0x88:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 5;
+                break;
+            case 0xBE:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 6;
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 7;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_9[i].s_size;
+    return a_9[i].result;
+}
+static const symbol s_37[] = { 0xE0, 0xAE, 0x99, 0xE0, 0xAF, 0x8D };
+static const symbol s_38[] = { 0xE0, 0xAF, 0x88 };
+static const symbol s_39[] = { 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_40[] = { 0xE0, 0xAE, 0x99, 0xE0, 0xAF, 0x8D };
+static const symbol s_41[] = { 0xE0, 0xAF, 0x8D };
+
+static const unsigned char a_10_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xC7, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xC0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_10(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0x82:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+            case 0x86:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 3;
+                break;
+            case 0x87:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 4;
+                break;
+            case 0x88:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 5;
+                break;
+            case 0xBE:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 6;
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 7;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_10[i].s_size;
+    return a_10[i].result;
+}
+static const symbol s_42[] = { 0xE0, 0xAF, 0x8D };
+static const symbol s_43[] = { 0xE0, 0xAE, 0x8E };
+
+static const unsigned char a_0_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x20, 0x46, 0x10, 0xC5, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[0] != 0xE0) break;
+        if (n <= 1) break;
+        if (q[1] != 0xAE) break;
+        if (n <= 2) break;
+        switch (q[2]) {
+            case 0x95:
+                i = 0;
+                break;
+            case 0x99:
+                i = 1;
+                break;
+            case 0x9A:
+                i = 2;
+                break;
+            case 0x9E:
+                i = 3;
+                break;
+            case 0xA4:
+                i = 4;
+                break;
+            case 0xA8:
+                i = 5;
+                break;
+            case 0xAA:
+                i = 6;
+                break;
+            case 0xAE:
+                i = 7;
+                break;
+            case 0xAF:
+                i = 8;
+                break;
+            case 0xB5:
+                i = 9;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_0[i].s_size;
+    return a_0[i].result;
+}
+static const symbol s_44[] = { 0xE0, 0xAF, 0x8D };
+
+static int find_among_11(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[0] != 0xE0) break;
+        if (n <= 1) break;
+        if (q[1] != 0xAE) break;
+        if (n <= 2) break;
+        switch (q[2]) {
+            case 0x85:
+                i = 0;
+                break;
+            case 0x87:
+                i = 1;
+                break;
+            case 0x89:
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_11[i].s_size;
+    return a_11[i].result;
+}
+
+static const unsigned char a_12_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x20, 0x46, 0x10, 0xC5, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_12(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[0] != 0xE0) break;
+        if (n <= 1) break;
+        if (q[1] != 0xAE) break;
+        if (n <= 2) break;
+        switch (q[2]) {
+            case 0x95:
+                i = 0;
+                break;
+            case 0x99:
+                i = 1;
+                break;
+            case 0x9A:
+                i = 2;
+                break;
+            case 0x9E:
+                i = 3;
+                break;
+            case 0xA4:
+                i = 4;
+                break;
+            case 0xA8:
+                i = 5;
+                break;
+            case 0xAA:
+                i = 6;
+                break;
+            case 0xAE:
+                i = 7;
+                break;
+            case 0xAF:
+                i = 8;
+                break;
+            case 0xB5:
+                i = 9;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_12[i].s_size;
+    return a_12[i].result;
+}
+static const symbol s_45[] = { 0xE0, 0xAF, 0x8D };
+
+static const unsigned char a_14_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x80, 0x8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_14(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x87:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x8B:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0xBE:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_14[i].s_size;
+    return a_14[i].result;
+}
+static const symbol s_46[] = { 0xE0, 0xAF, 0x8D };
+static const symbol s_47[] = { 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_48[] = { 0xE0, 0xAF, 0x8D };
+static const symbol s_49[] = { 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0x9F, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D };
+static const symbol s_50[] = { 0xE0, 0xAE, 0xBF, 0xE0, 0xAE, 0xB2, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0xB2, 0xE0, 0xAF, 0x88 };
+static const symbol s_51[] = { 0xE0, 0xAE, 0xBF, 0xE0, 0xAE, 0x9F, 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_52[] = { 0xE0, 0xAE, 0xBF, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0xB1, 0xE0, 0xAE, 0xBF };
+static const symbol s_53[] = { 0xE0, 0xAE, 0xBE, 0xE0, 0xAE, 0x95, 0xE0, 0xAE, 0xBF };
+static const symbol s_54[] = { 0xE0, 0xAE, 0xBE, 0xE0, 0xAE, 0x95, 0xE0, 0xAE, 0xBF, 0xE0, 0xAE, 0xAF };
+static const symbol s_55[] = { 0xE0, 0xAF, 0x86, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0xB1, 0xE0, 0xAF, 0x81 };
+static const symbol s_56[] = { 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0xB3, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0xB3 };
+static const symbol s_57[] = { 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0x9F, 0xE0, 0xAF, 0x88, 0xE0, 0xAE, 0xAF };
+static const symbol s_58[] = { 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0x9F, 0xE0, 0xAF, 0x88 };
+static const symbol s_59[] = { 0xE0, 0xAF, 0x86, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_60[] = { 0xE0, 0xAE, 0xB2, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0xB2 };
+
+static const unsigned char a_16_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xC7, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xC0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_16(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0x82:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+            case 0x86:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 3;
+                break;
+            case 0x87:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 4;
+                break;
+            case 0x88:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 5;
+                break;
+            case 0xBE:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 6;
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 7;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_16[i].s_size;
+    return a_16[i].result;
+}
+static const symbol s_61[] = { 0xE0, 0xAF, 0x86, 0xE0, 0xAE, 0xA9 };
+static const symbol s_62[] = { 0xE0, 0xAE, 0xBE, 0xE0, 0xAE, 0x95, 0xE0, 0xAE, 0xBF };
+static const symbol s_63[] = { 0xE0, 0xAF, 0x8D };
+
+static const unsigned char a_17_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x2, 0x20, 0x0, 0x80, 0x8, 0x82, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_17(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x9F:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xAE) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x8D:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xAF) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0x9F) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xAE) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xE0) break;
+                                if (n <= 12) break;
+                                switch (q[-13]) {
+                                    case 0xAA:
+                                        if (n <= 13) break;
+                                        if (q[-14] != 0xAE) break;
+                                        if (n <= 14) break;
+                                        if (q[-15] != 0xE0) break;
+                                        i = 0;
+                                        break;
+                                    case 0xBF:
+                                        if (n <= 13) break;
+                                        if (q[-14] != 0xAE) break;
+                                        if (n <= 14) break;
+                                        if (q[-15] != 0xE0) break;
+                                        if (n <= 15) break;
+                                        if (q[-16] != 0xB5) break;
+                                        if (n <= 16) break;
+                                        if (q[-17] != 0xAE) break;
+                                        if (n <= 17) break;
+                                        if (q[-18] != 0xE0) break;
+                                        i = 1;
+                                        break;
+                                }
+                                break;
+                            case 0xAA:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xAE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                i = 2;
+                                break;
+                            case 0xBF:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xAE) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xE0) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xB5) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xAE) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xE0) break;
+                                i = 3;
+                                break;
+                        }
+                        break;
+                    case 0xA4:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xAE) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x9F) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xAE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0x8D) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xAF) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xE0) break;
+                        if (n <= 12) break;
+                        if (q[-13] != 0x9F) break;
+                        if (n <= 13) break;
+                        if (q[-14] != 0xAE) break;
+                        if (n <= 14) break;
+                        if (q[-15] != 0xE0) break;
+                        if (n <= 15) break;
+                        if (q[-16] != 0xAA) break;
+                        if (n <= 16) break;
+                        if (q[-17] != 0xAE) break;
+                        if (n <= 17) break;
+                        if (q[-18] != 0xE0) break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 0x8D:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xAE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xAE) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xE0) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xBE) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xAE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xE0) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xB2) break;
+                if (n <= 10) break;
+                if (q[-11] != 0xAE) break;
+                if (n <= 11) break;
+                if (q[-12] != 0xE0) break;
+                if (n <= 12) break;
+                if (q[-13] != 0x8D) break;
+                if (n <= 13) break;
+                if (q[-14] != 0xAF) break;
+                if (n <= 14) break;
+                if (q[-15] != 0xE0) break;
+                if (n <= 15) break;
+                if (q[-16] != 0xB2) break;
+                if (n <= 16) break;
+                if (q[-17] != 0xAE) break;
+                if (n <= 17) break;
+                if (q[-18] != 0xE0) break;
+                if (n <= 18) break;
+                if (q[-19] != 0x86) break;
+                if (n <= 19) break;
+                if (q[-20] != 0xAF) break;
+                if (n <= 20) break;
+                if (q[-21] != 0xE0) break;
+                i = 5;
+                break;
+            case 0x9F:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x8D) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xAF) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xE0) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x9F) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xAE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xE0) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xAA) break;
+                if (n <= 10) break;
+                if (q[-11] != 0xAE) break;
+                if (n <= 11) break;
+                if (q[-12] != 0xE0) break;
+                i = 6;
+                break;
+            case 0xA3:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x9F) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xAE) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xE0) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x8D) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xAF) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xE0) break;
+                if (n <= 9) break;
+                if (q[-10] != 0x9F) break;
+                if (n <= 10) break;
+                if (q[-11] != 0xAE) break;
+                if (n <= 11) break;
+                if (q[-12] != 0xE0) break;
+                if (n <= 12) break;
+                if (q[-13] != 0xAA) break;
+                if (n <= 13) break;
+                if (q[-14] != 0xAE) break;
+                if (n <= 14) break;
+                if (q[-15] != 0xE0) break;
+                i = 7;
+                break;
+            case 0xA9:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xBE) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xAE) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xE0) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xA4) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xAE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xE0) break;
+                i = 8;
+                if (n <= 9) break;
+                if (q[-10] != 0xBF) break;
+                if (n <= 10) break;
+                if (q[-11] != 0xAE) break;
+                if (n <= 11) break;
+                if (q[-12] != 0xE0) break;
+                if (n <= 12) break;
+                if (q[-13] != 0x9F) break;
+                if (n <= 13) break;
+                if (q[-14] != 0xAE) break;
+                if (n <= 14) break;
+                if (q[-15] != 0xE0) break;
+                if (n <= 15) break;
+                if (q[-16] != 0xAA) break;
+                if (n <= 16) break;
+                if (q[-17] != 0xAE) break;
+                if (n <= 17) break;
+                if (q[-18] != 0xE0) break;
+                i = 9;
+                break;
+            case 0xAF:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xBF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xAE) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xE0) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB0) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xAE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xE0) break;
+                if (n <= 9) break;
+                if (q[-10] != 0x81) break;
+                if (n <= 10) break;
+                if (q[-11] != 0xAF) break;
+                if (n <= 11) break;
+                if (q[-12] != 0xE0) break;
+                if (n <= 12) break;
+                if (q[-13] != 0x95) break;
+                if (n <= 13) break;
+                if (q[-14] != 0xAE) break;
+                if (n <= 14) break;
+                if (q[-15] != 0xE0) break;
+                i = 10;
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x9F:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xAE) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xAA) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xAE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        i = 11;
+                        break;
+                    case 0xB1:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xAE) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x8D) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xAF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xB1) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xAE) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xE0) break;
+                        if (n <= 12) break;
+                        if (q[-13] != 0xAA) break;
+                        if (n <= 13) break;
+                        if (q[-14] != 0xAE) break;
+                        if (n <= 14) break;
+                        if (q[-15] != 0xE0) break;
+                        i = 12;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_17[i].s_size;
+    return a_17[i].result;
+}
+static const symbol s_64[] = { 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x88 };
+static const symbol s_65[] = { 0xE0, 0xAE, 0xBF, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x88 };
+static const symbol s_66[] = { 0xE0, 0xAF, 0x88 };
+
+static const unsigned char a_18_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x20, 0x84, 0x10, 0x4, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_18(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x95:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x9A:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0x9F:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+            case 0xA4:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 3;
+                break;
+            case 0xAA:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 4;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 5;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_18[i].s_size;
+    return a_18[i].result;
+}
+static const symbol s_67[] = { 0xE0, 0xAF, 0x88 };
+
+static const unsigned char a_19_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x20, 0x84, 0x10, 0x4, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_19(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x95:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x9A:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0x9F:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+            case 0xA4:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 3;
+                break;
+            case 0xAA:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 4;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 5;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_19[i].s_size;
+    return a_19[i].result;
+}
+static const symbol s_68[] = { 0xE0, 0xAF, 0x8D };
+static const symbol s_69[] = { 0xE0, 0xAF, 0x8D };
+static const symbol s_70[] = { 0xE0, 0xAF, 0x8A, 0xE0, 0xAE, 0x9F, 0xE0, 0xAF, 0x81 };
+static const symbol s_71[] = { 0xE0, 0xAF, 0x8B, 0xE0, 0xAE, 0x9F, 0xE0, 0xAF, 0x81 };
+static const symbol s_72[] = { 0xE0, 0xAE, 0xBF, 0xE0, 0xAE, 0xB2, 0xE0, 0xAF, 0x8D };
+static const symbol s_73[] = { 0xE0, 0xAE, 0xBF, 0xE0, 0xAE, 0xB1, 0xE0, 0xAF, 0x8D };
+static const symbol s_74[] = { 0xE0, 0xAE, 0xBF, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D };
+static const symbol s_75[] = { 0xE0, 0xAE, 0xAE };
+static const symbol s_76[] = { 0xE0, 0xAE, 0xBF, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0xB1, 0xE0, 0xAF, 0x81 };
+static const symbol s_77[] = { 0xE0, 0xAE, 0xBF, 0xE0, 0xAE, 0xB0, 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0xA8, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0xA4, 0xE0, 0xAF, 0x81 };
+static const symbol s_78[] = { 0xE0, 0xAE, 0xB5, 0xE0, 0xAE, 0xBF, 0xE0, 0xAE, 0x9F };
+static const symbol s_79[] = { 0xE0, 0xAE, 0xBF, 0xE0, 0xAE, 0x9F, 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_80[] = { 0xE0, 0xAE, 0xBE, 0xE0, 0xAE, 0xB2, 0xE0, 0xAF, 0x8D };
+static const symbol s_81[] = { 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0x9F, 0xE0, 0xAF, 0x88 };
+static const symbol s_82[] = { 0xE0, 0xAE, 0xBE, 0xE0, 0xAE, 0xAE, 0xE0, 0xAE, 0xB2, 0xE0, 0xAF, 0x8D };
+static const symbol s_83[] = { 0xE0, 0xAE, 0xB2, 0xE0, 0xAF, 0x8D };
+
+static const unsigned char a_20_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xC7, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xC0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_20(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0x82:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+            case 0x86:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 3;
+                break;
+            case 0x87:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 4;
+                break;
+            case 0x88:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 5;
+                break;
+            case 0xBE:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 6;
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 7;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_20[i].s_size;
+    return a_20[i].result;
+}
+static const symbol s_84[] = { 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0xB3, 0xE0, 0xAF, 0x8D };
+static const symbol s_85[] = { 0xE0, 0xAF, 0x8D };
+static const symbol s_86[] = { 0xE0, 0xAE, 0x95, 0xE0, 0xAE, 0xA3, 0xE0, 0xAF, 0x8D };
+static const symbol s_87[] = { 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D };
+static const symbol s_88[] = { 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x87, 0xE0, 0xAE, 0xB2, 0xE0, 0xAF, 0x8D };
+static const symbol s_89[] = { 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x87, 0xE0, 0xAE, 0xB1, 0xE0, 0xAF, 0x8D };
+static const symbol s_90[] = { 0xE0, 0xAE, 0x95, 0xE0, 0xAF, 0x80, 0xE0, 0xAE, 0xB4, 0xE0, 0xAF, 0x8D };
+static const symbol s_91[] = { 0xE0, 0xAE, 0xAA, 0xE0, 0xAE, 0xBF, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D };
+static const symbol s_92[] = { 0xE0, 0xAE, 0xA4, 0xE0, 0xAF, 0x81 };
+
+static const unsigned char a_21_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xC7, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xC0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_21(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0x82:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+            case 0x86:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 3;
+                break;
+            case 0x87:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 4;
+                break;
+            case 0x88:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 5;
+                break;
+            case 0xBE:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 6;
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 7;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_21[i].s_size;
+    return a_21[i].result;
+}
+static const symbol s_93[] = { 0xE0, 0xAF, 0x80 };
+static const symbol s_94[] = { 0xE0, 0xAE, 0xBF };
+static const symbol s_95[] = { 0xE0, 0xAE, 0xBF, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D };
+static const symbol s_96[] = { 0xE0, 0xAF, 0x8D };
+static const symbol s_97[] = { 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0x99, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0x95, 0xE0, 0xAE, 0xB3, 0xE0, 0xAF, 0x8D };
+
+static const unsigned char a_13_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x20, 0x84, 0x10, 0x4, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_13(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x95:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x9A:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0x9F:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+            case 0xA4:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 3;
+                break;
+            case 0xAA:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 4;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 5;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_13[i].s_size;
+    return a_13[i].result;
+}
+static const symbol s_98[] = { 0xE0, 0xAF, 0x8D };
+static const symbol s_99[] = { 0xE0, 0xAE, 0xB1, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0x95, 0xE0, 0xAE, 0xB3, 0xE0, 0xAF, 0x8D };
+static const symbol s_100[] = { 0xE0, 0xAE, 0xB2, 0xE0, 0xAF, 0x8D };
+static const symbol s_101[] = { 0xE0, 0xAE, 0x9F, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0x95, 0xE0, 0xAE, 0xB3, 0xE0, 0xAF, 0x8D };
+static const symbol s_102[] = { 0xE0, 0xAE, 0xB3, 0xE0, 0xAF, 0x8D };
+static const symbol s_103[] = { 0xE0, 0xAE, 0x95, 0xE0, 0xAE, 0xB3, 0xE0, 0xAF, 0x8D };
+
+static int find_among_b_15(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0xBF) break;
+        if (n <= 1) break;
+        if (q[-2] != 0xAE) break;
+        if (n <= 2) break;
+        if (q[-3] != 0xE0) break;
+        if (n <= 3) break;
+        switch (q[-4]) {
+            case 0xAA:
+                if (n <= 4) break;
+                if (q[-5] != 0xAE) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xE0) break;
+                i = 0;
+                break;
+            case 0xB5:
+                if (n <= 4) break;
+                if (q[-5] != 0xAE) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xE0) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_15[i].s_size;
+    return a_15[i].result;
+}
+
+static int find_among_b_22(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x9F) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xAE) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xE0) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xAA) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xAE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x8D:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xB0) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xAE) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xE0) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xBF) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xAE) break;
+                if (n <= 8) break;
+                if (q[-9] != 0xE0) break;
+                if (n <= 9) break;
+                if (q[-10] != 0x9F) break;
+                if (n <= 10) break;
+                if (q[-11] != 0xAE) break;
+                if (n <= 11) break;
+                if (q[-12] != 0xE0) break;
+                if (n <= 12) break;
+                if (q[-13] != 0x8D) break;
+                if (n <= 13) break;
+                if (q[-14] != 0xAF) break;
+                if (n <= 14) break;
+                if (q[-15] != 0xE0) break;
+                if (n <= 15) break;
+                if (q[-16] != 0xA3) break;
+                if (n <= 16) break;
+                if (q[-17] != 0xAE) break;
+                if (n <= 17) break;
+                if (q[-18] != 0xE0) break;
+                if (n <= 18) break;
+                if (q[-19] != 0x8A) break;
+                if (n <= 19) break;
+                if (q[-20] != 0xAF) break;
+                if (n <= 20) break;
+                if (q[-21] != 0xE0) break;
+                if (n <= 21) break;
+                if (q[-22] != 0x95) break;
+                if (n <= 22) break;
+                if (q[-23] != 0xAE) break;
+                if (n <= 23) break;
+                if (q[-24] != 0xE0) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_22[i].s_size;
+    return a_22[i].result;
+}
+static const symbol s_104[] = { 0xE0, 0xAE, 0xAE, 0xE0, 0xAE, 0xBE, 0xE0, 0xAE, 0xB0, 0xE0, 0xAF, 0x8D };
+static const symbol s_105[] = { 0xE0, 0xAE, 0xAE, 0xE0, 0xAE, 0xBF, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D };
+static const symbol s_106[] = { 0xE0, 0xAE, 0xA9, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D };
+static const symbol s_107[] = { 0xE0, 0xAE, 0xA9, 0xE0, 0xAE, 0xBE, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D };
+static const symbol s_108[] = { 0xE0, 0xAE, 0xA9, 0xE0, 0xAE, 0xBE, 0xE0, 0xAE, 0xB3, 0xE0, 0xAF, 0x8D };
+static const symbol s_109[] = { 0xE0, 0xAE, 0xA9, 0xE0, 0xAE, 0xBE, 0xE0, 0xAE, 0xB0, 0xE0, 0xAF, 0x8D };
+static const symbol s_110[] = { 0xE0, 0xAE, 0xB5, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D };
+
+static int find_among_b_23(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x85:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x86:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0x87:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+            case 0x88:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 3;
+                break;
+            case 0x89:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 4;
+                break;
+            case 0x8A:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 5;
+                break;
+            case 0x8E:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 6;
+                break;
+            case 0x8F:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 7;
+                break;
+            case 0x90:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 8;
+                break;
+            case 0x92:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 9;
+                break;
+            case 0x93:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 10;
+                break;
+            case 0x94:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 11;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_23[i].s_size;
+    return a_23[i].result;
+}
+static const symbol s_111[] = { 0xE0, 0xAE, 0xA9, 0xE0, 0xAE, 0xB3, 0xE0, 0xAF, 0x8D };
+static const symbol s_112[] = { 0xE0, 0xAE, 0xB5, 0xE0, 0xAE, 0xB3, 0xE0, 0xAF, 0x8D };
+static const symbol s_113[] = { 0xE0, 0xAE, 0xA9, 0xE0, 0xAE, 0xB0, 0xE0, 0xAF, 0x8D };
+static const symbol s_114[] = { 0xE0, 0xAE, 0xB5, 0xE0, 0xAE, 0xB0, 0xE0, 0xAF, 0x8D };
+static const symbol s_115[] = { 0xE0, 0xAE, 0xA9 };
+static const symbol s_116[] = { 0xE0, 0xAE, 0xAA };
+static const symbol s_117[] = { 0xE0, 0xAE, 0x95 };
+static const symbol s_118[] = { 0xE0, 0xAE, 0xA4 };
+static const symbol s_119[] = { 0xE0, 0xAE, 0xAF };
+static const symbol s_120[] = { 0xE0, 0xAE, 0xAA, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D };
+static const symbol s_121[] = { 0xE0, 0xAE, 0xAA, 0xE0, 0xAE, 0xB3, 0xE0, 0xAF, 0x8D };
+static const symbol s_122[] = { 0xE0, 0xAE, 0xAA, 0xE0, 0xAE, 0xB0, 0xE0, 0xAF, 0x8D };
+static const symbol s_123[] = { 0xE0, 0xAE, 0xA4, 0xE0, 0xAF, 0x81 };
+
+static const unsigned char a_24_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xC7, 0x1, 0x0, 0x0, 0x0, 0x0, 0x0, 0xC0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_24(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x80:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 0;
+                break;
+            case 0x81:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 1;
+                break;
+            case 0x82:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 2;
+                break;
+            case 0x86:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 3;
+                break;
+            case 0x87:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 4;
+                break;
+            case 0x88:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 5;
+                break;
+            case 0xBE:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 6;
+                break;
+            case 0xBF:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                i = 7;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_24[i].s_size;
+    return a_24[i].result;
+}
+static const symbol s_124[] = { 0xE0, 0xAE, 0xBF, 0xE0, 0xAE, 0xB1, 0xE0, 0xAF, 0x8D, 0xE0, 0xAE, 0xB1, 0xE0, 0xAF, 0x81 };
+static const symbol s_125[] = { 0xE0, 0xAE, 0xAA, 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_126[] = { 0xE0, 0xAE, 0xA9, 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_127[] = { 0xE0, 0xAE, 0xA4, 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_128[] = { 0xE0, 0xAE, 0xB1, 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_129[] = { 0xE0, 0xAE, 0x95, 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_130[] = { 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x86, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D };
+static const symbol s_131[] = { 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x88 };
+static const symbol s_132[] = { 0xE0, 0xAE, 0xB5, 0xE0, 0xAF, 0x88 };
+static const symbol s_133[] = { 0xE0, 0xAE, 0xBE, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D };
+static const symbol s_134[] = { 0xE0, 0xAE, 0x9A };
+static const symbol s_135[] = { 0xE0, 0xAE, 0xBE, 0xE0, 0xAE, 0xB3, 0xE0, 0xAF, 0x8D };
+static const symbol s_136[] = { 0xE0, 0xAE, 0xBE, 0xE0, 0xAE, 0xB0, 0xE0, 0xAF, 0x8D };
+static const symbol s_137[] = { 0xE0, 0xAF, 0x87, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D };
+static const symbol s_138[] = { 0xE0, 0xAE, 0xBE };
+static const symbol s_139[] = { 0xE0, 0xAE, 0xBE, 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_140[] = { 0xE0, 0xAF, 0x86, 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_141[] = { 0xE0, 0xAF, 0x87, 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_142[] = { 0xE0, 0xAF, 0x8B, 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_143[] = { 0xE0, 0xAE, 0x95, 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_144[] = { 0xE0, 0xAE, 0xA4, 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_145[] = { 0xE0, 0xAE, 0x9F, 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_146[] = { 0xE0, 0xAE, 0xB1, 0xE0, 0xAF, 0x81, 0xE0, 0xAE, 0xAE, 0xE0, 0xAF, 0x8D };
+static const symbol s_147[] = { 0xE0, 0xAE, 0xBE, 0xE0, 0xAE, 0xAF, 0xE0, 0xAF, 0x8D };
+static const symbol s_148[] = { 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x86, 0xE0, 0xAE, 0xA9, 0xE0, 0xAF, 0x8D };
+static const symbol s_149[] = { 0xE0, 0xAE, 0xA9, 0xE0, 0xAE, 0xBF, 0xE0, 0xAE, 0xB0, 0xE0, 0xAF, 0x8D };
+static const symbol s_150[] = { 0xE0, 0xAF, 0x80, 0xE0, 0xAE, 0xB0, 0xE0, 0xAF, 0x8D };
+static const symbol s_151[] = { 0xE0, 0xAF, 0x80, 0xE0, 0xAE, 0xAF, 0xE0, 0xAE, 0xB0, 0xE0, 0xAF, 0x8D };
+static const symbol s_152[] = { 0xE0, 0xAF, 0x8D };
+static const symbol s_153[] = { 0xE0, 0xAE, 0x95, 0xE0, 0xAF, 0x81 };
+static const symbol s_154[] = { 0xE0, 0xAE, 0xA4, 0xE0, 0xAF, 0x81 };
+static const symbol s_155[] = { 0xE0, 0xAF, 0x8D };
+
+static int find_among_b_25(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x8D:
+                if (n <= 1) break;
+                if (q[-2] != 0xAF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xB1) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xAE) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xE0) break;
+                if (n <= 6) break;
+                switch (q[-7]) {
+                    case 0x8D:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xAF) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xA9) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xAE) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xE0) break;
+                        if (n <= 12) break;
+                        if (q[-13] != 0xBF) break;
+                        if (n <= 13) break;
+                        if (q[-14] != 0xAE) break;
+                        if (n <= 14) break;
+                        if (q[-15] != 0xE0) break;
+                        if (n <= 15) break;
+                        switch (q[-16]) {
+                            case 0x95:
+                                if (n <= 16) break;
+                                if (q[-17] != 0xAE) break;
+                                if (n <= 17) break;
+                                if (q[-18] != 0xE0) break;
+                                i = 0;
+                                break;
+                            case 0xA8:
+                                if (n <= 16) break;
+                                if (q[-17] != 0xAE) break;
+                                if (n <= 17) break;
+                                if (q[-18] != 0xE0) break;
+                                if (n <= 18) break;
+                                if (q[-19] != 0xBE) break;
+                                if (n <= 19) break;
+                                if (q[-20] != 0xAE) break;
+                                if (n <= 20) break;
+                                if (q[-21] != 0xE0) break;
+                                i = 1;
+                                break;
+                        }
+                        break;
+                    case 0xBF:
+                        if (n <= 7) break;
+                        if (q[-8] != 0xAE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0x95) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xAE) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xE0) break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xAE) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xE0) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x8D:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xAF) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA9) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xAE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xBF) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xAE) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xE0) break;
+                        if (n <= 12) break;
+                        switch (q[-13]) {
+                            case 0x95:
+                                if (n <= 13) break;
+                                if (q[-14] != 0xAE) break;
+                                if (n <= 14) break;
+                                if (q[-15] != 0xE0) break;
+                                i = 3;
+                                break;
+                            case 0xA8:
+                                if (n <= 13) break;
+                                if (q[-14] != 0xAE) break;
+                                if (n <= 14) break;
+                                if (q[-15] != 0xE0) break;
+                                if (n <= 15) break;
+                                if (q[-16] != 0xBE) break;
+                                if (n <= 16) break;
+                                if (q[-17] != 0xAE) break;
+                                if (n <= 17) break;
+                                if (q[-18] != 0xE0) break;
+                                i = 4;
+                                break;
+                        }
+                        break;
+                    case 0xBF:
+                        if (n <= 4) break;
+                        if (q[-5] != 0xAE) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xE0) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x95) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xAE) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xE0) break;
+                        i = 5;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_25[i].s_size;
+    return a_25[i].result;
+}
+
+static int r_fix_va_start(struct SN_env * z) {
+    {   int c1 = z->c;
+        {   int c2 = z->c;
+            {   int c3 = z->c;
+                if (!(eq_s(z, 6, s_0))) { z->c = c3; goto lab2; }
+            lab2:
+                ;
+            }
+            z->c = c2;
+            z->bra = z->c;
+        }
+        if (!(eq_s(z, 6, s_1))) goto lab1;
+        z->ket = z->c;
+        {   int ret = slice_from_s(z, 3, s_2);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab1:
+        z->c = c1;
+        {   int c4 = z->c;
+            {   int c5 = z->c;
+                if (!(eq_s(z, 6, s_3))) { z->c = c5; goto lab4; }
+            lab4:
+                ;
+            }
+            z->c = c4;
+            z->bra = z->c;
+        }
+        if (!(eq_s(z, 6, s_4))) goto lab3;
+        z->ket = z->c;
+        {   int ret = slice_from_s(z, 3, s_5);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab3:
+        z->c = c1;
+        {   int c6 = z->c;
+            {   int c7 = z->c;
+                if (!(eq_s(z, 6, s_6))) { z->c = c7; goto lab6; }
+            lab6:
+                ;
+            }
+            z->c = c6;
+            z->bra = z->c;
+        }
+        if (!(eq_s(z, 6, s_7))) goto lab5;
+        z->ket = z->c;
+        {   int ret = slice_from_s(z, 3, s_8);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab5:
+        z->c = c1;
+        {   int c8 = z->c;
+            {   int c9 = z->c;
+                if (!(eq_s(z, 6, s_9))) { z->c = c9; goto lab7; }
+            lab7:
+                ;
+            }
+            z->c = c8;
+            z->bra = z->c;
+        }
+        if (!(eq_s(z, 6, s_10))) return 0;
+        z->ket = z->c;
+        {   int ret = slice_from_s(z, 3, s_11);
+            if (ret < 0) return ret;
+        }
+    }
+lab0:
+    return 1;
+}
+
+static int r_fix_endings(struct SN_env * z) {
+    {   int c1 = z->c;
+        while(1) {
+            int c2 = z->c;
+            {   int ret = r_fix_ending(z);
+                if (ret == 0) goto lab1;
+                if (ret < 0) return ret;
+            }
+            continue;
+        lab1:
+            z->c = c2;
+            break;
+        }
+        z->c = c1;
+    }
+    return 1;
+}
+
+static int r_fix_ending(struct SN_env * z) {
+    if (!(lenof_utf8(z, z->p) > 3)) return 0;
+    z->lb = z->c; z->c = z->l;
+
+    {   int m1 = z->l - z->c; (void)m1;
+        z->ket = z->c;
+        if (z->c - 5 <= z->lb || (z->p[z->c - 1] != 141 && z->p[z->c - 1] != 164) || (z->p[z->c - 2] != 174 && z->p[z->c - 2] != 175)) goto lab1;
+        if (!(find_among_b_1(z))) goto lab1;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab1:
+        z->c = z->l - m1;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 6, s_12))) goto lab2;
+        {   int m_test2 = z->l - z->c;
+            if (z->c - 2 <= z->lb || !((a_2_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 174 && z->p[z->c - 2] != 175)) goto lab2;
+            if (!(find_among_b_2(z))) goto lab2;
+            z->c = z->l - m_test2;
+        }
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab2:
+        z->c = z->l - m1;
+        z->ket = z->c;
+        {   int m3 = z->l - z->c; (void)m3;
+            if (!(eq_s_b(z, 12, s_13))) goto lab5;
+            goto lab4;
+        lab5:
+            z->c = z->l - m3;
+            if (!(eq_s_b(z, 12, s_14))) goto lab3;
+        }
+    lab4:
+        z->bra = z->c;
+        {   int ret = slice_from_s(z, 6, s_15);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab3:
+        z->c = z->l - m1;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 12, s_16))) goto lab6;
+        z->bra = z->c;
+        {   int ret = slice_from_s(z, 6, s_17);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab6:
+        z->c = z->l - m1;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 12, s_18))) goto lab7;
+        z->bra = z->c;
+        {   int ret = slice_from_s(z, 6, s_19);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab7:
+        z->c = z->l - m1;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 12, s_20))) goto lab8;
+        z->bra = z->c;
+        {   int ret = slice_from_s(z, 6, s_21);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab8:
+        z->c = z->l - m1;
+        if (!(z->I[0])) goto lab9;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 12, s_22))) goto lab9;
+        {   int m_test4 = z->l - z->c;
+            {   int m5 = z->l - z->c; (void)m5;
+                if (!(eq_s_b(z, 3, s_23))) goto lab10;
+                goto lab9;
+            lab10:
+                z->c = z->l - m5;
+            }
+            z->c = z->l - m_test4;
+        }
+        z->bra = z->c;
+        {   int ret = slice_from_s(z, 6, s_24);
+            if (ret < 0) return ret;
+        }
+        z->bra = z->c;
+        goto lab0;
+    lab9:
+        z->c = z->l - m1;
+        z->ket = z->c;
+        {   int m6 = z->l - z->c; (void)m6;
+            if (!(eq_s_b(z, 9, s_25))) goto lab13;
+            goto lab12;
+        lab13:
+            z->c = z->l - m6;
+            if (!(eq_s_b(z, 15, s_26))) goto lab11;
+        }
+    lab12:
+        z->bra = z->c;
+        {   int ret = slice_from_s(z, 3, s_27);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab11:
+        z->c = z->l - m1;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 3, s_28))) goto lab14;
+        if (z->c - 2 <= z->lb || !((a_3_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || z->p[z->c - 2] != 174) goto lab14;
+        if (!(find_among_b_3(z))) goto lab14;
+        if (!(eq_s_b(z, 3, s_29))) goto lab14;
+        if (z->c - 2 <= z->lb || !((a_4_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || z->p[z->c - 2] != 174) goto lab14;
+        if (!(find_among_b_4(z))) goto lab14;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab14:
+        z->c = z->l - m1;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 9, s_30))) goto lab15;
+        z->bra = z->c;
+        {   int ret = slice_from_s(z, 3, s_31);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab15:
+        z->c = z->l - m1;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 3, s_32))) goto lab16;
+        if (z->c - 2 <= z->lb || !((a_5_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || z->p[z->c - 2] != 174) goto lab16;
+        if (!(find_among_b_5(z))) goto lab16;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab16:
+        z->c = z->l - m1;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 3, s_33))) goto lab17;
+        {   int m7 = z->l - z->c; (void)m7;
+            if (z->c - 2 <= z->lb || z->p[z->c - 1] >> 5 != 5 || !((4030464 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] != 174) goto lab19;
+            if (!(find_among_b_6(z))) goto lab19;
+            goto lab18;
+        lab19:
+            z->c = z->l - m7;
+            if (z->c - 2 <= z->lb || !((a_7_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || z->p[z->c - 2] != 174) goto lab17;
+            if (!(find_among_b_7(z))) goto lab17;
+        }
+    lab18:
+        if (!(eq_s_b(z, 3, s_34))) goto lab17;
+        z->bra = z->c;
+        {   int ret = slice_from_s(z, 3, s_35);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab17:
+        z->c = z->l - m1;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb || !((a_8_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 174 && z->p[z->c - 2] != 175)) goto lab20;
+        if (!(find_among_b_8(z))) goto lab20;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab20:
+        z->c = z->l - m1;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 6, s_36))) goto lab21;
+        {   int m_test8 = z->l - z->c;
+            {   int m9 = z->l - z->c; (void)m9;
+                if (z->c - 2 <= z->lb || !((a_9_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 174 && z->p[z->c - 2] != 175)) goto lab22;
+                if (!(find_among_b_9(z))) goto lab22;
+                goto lab21;
+            lab22:
+                z->c = z->l - m9;
+            }
+            z->c = z->l - m_test8;
+        }
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab21:
+        z->c = z->l - m1;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 6, s_37))) goto lab23;
+        {   int m_test10 = z->l - z->c;
+            {   int m11 = z->l - z->c; (void)m11;
+                if (!(eq_s_b(z, 3, s_38))) goto lab24;
+                goto lab23;
+            lab24:
+                z->c = z->l - m11;
+            }
+            z->c = z->l - m_test10;
+        }
+        z->bra = z->c;
+        {   int ret = slice_from_s(z, 6, s_39);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab23:
+        z->c = z->l - m1;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 6, s_40))) goto lab25;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        goto lab0;
+    lab25:
+        z->c = z->l - m1;
+        z->ket = z->c;
+        if (!(eq_s_b(z, 3, s_41))) return 0;
+        {   int m_test12 = z->l - z->c;
+            {   int m13 = z->l - z->c; (void)m13;
+                if (z->c - 2 <= z->lb || !((a_10_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 174 && z->p[z->c - 2] != 175)) goto lab27;
+                if (!(find_among_b_10(z))) goto lab27;
+                goto lab26;
+            lab27:
+                z->c = z->l - m13;
+                if (!(eq_s_b(z, 3, s_42))) return 0;
+            }
+        lab26:
+            z->c = z->l - m_test12;
+        }
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    }
+lab0:
+    z->c = z->lb;
+    return 1;
+}
+
+extern int tamil_UTF_8_stem(struct SN_env * z) {
+    z->I[0] = 0;
+    {   int c1 = z->c;
+        {   int ret = r_fix_ending(z);
+            if (ret < 0) return ret;
+        }
+        z->c = c1;
+    }
+    if (!(lenof_utf8(z, z->p) > 4)) return 0;
+    {   int c2 = z->c;
+        z->bra = z->c;
+        if (!(eq_s(z, 3, s_43))) goto lab0;
+        if (z->c + 2 >= z->l || !((a_0_filter0[z->p[z->c + 2] >> 3] >> (z->p[z->c + 2] & 7)) & 1)) goto lab0;
+        if (!(find_among_0(z))) goto lab0;
+        if (!(eq_s(z, 3, s_44))) goto lab0;
+        z->ket = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        {   int c3 = z->c;
+            {   int ret = r_fix_va_start(z);
+                if (ret < 0) return ret;
+            }
+            z->c = c3;
+        }
+    lab0:
+        z->c = c2;
+    }
+    {   int c4 = z->c;
+        z->I[1] = 0;
+        z->bra = z->c;
+        if (z->c + 2 >= z->l || z->p[z->c + 2] >> 5 != 4 || !((672 >> (z->p[z->c + 2] & 0x1f)) & 1)) goto lab1;
+        if (!(find_among_11(z))) goto lab1;
+        if (z->c + 2 >= z->l || !((a_12_filter0[z->p[z->c + 2] >> 3] >> (z->p[z->c + 2] & 7)) & 1)) goto lab1;
+        if (!(find_among_12(z))) goto lab1;
+        if (!(eq_s(z, 3, s_45))) goto lab1;
+        z->ket = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[1] = 1;
+        {   int c5 = z->c;
+            {   int ret = r_fix_va_start(z);
+                if (ret < 0) return ret;
+            }
+            z->c = c5;
+        }
+    lab1:
+        z->c = c4;
+    }
+    {   int c6 = z->c;
+        if (!(lenof_utf8(z, z->p) > 4)) goto lab2;
+        z->I[1] = 0;
+        z->lb = z->c; z->c = z->l;
+
+        {   int m7 = z->l - z->c; (void)m7;
+            z->ket = z->c;
+            if (z->c - 2 <= z->lb || !((a_14_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 174 && z->p[z->c - 2] != 175)) goto lab3;
+            if (!(find_among_b_14(z))) goto lab3;
+            z->bra = z->c;
+            {   int ret = slice_from_s(z, 3, s_46);
+                if (ret < 0) return ret;
+            }
+            z->I[1] = 1;
+        lab3:
+            z->c = z->l - m7;
+        }
+        z->c = z->lb;
+        
+        {   int ret = r_fix_endings(z);
+            if (ret < 0) return ret;
+        }
+    lab2:
+        z->c = c6;
+    }
+    {   int c8 = z->c;
+        z->I[1] = 0;
+        if (!(lenof_utf8(z, z->p) > 4)) goto lab4;
+        z->lb = z->c; z->c = z->l;
+
+        z->ket = z->c;
+        if (!(eq_s_b(z, 9, s_47))) goto lab4;
+        z->bra = z->c;
+        {   int ret = slice_from_s(z, 3, s_48);
+            if (ret < 0) return ret;
+        }
+        z->I[1] = 1;
+        z->c = z->lb;
+        {   int c9 = z->c;
+            {   int ret = r_fix_ending(z);
+                if (ret < 0) return ret;
+            }
+            z->c = c9;
+        }
+    lab4:
+        z->c = c8;
+    }
+    {   int c10 = z->c;
+        z->I[1] = 0;
+        if (!(lenof_utf8(z, z->p) > 4)) goto lab5;
+        z->lb = z->c; z->c = z->l;
+
+        {   int m11 = z->l - z->c; (void)m11;
+            {   int m_test12 = z->l - z->c;
+                z->ket = z->c;
+                {   int m13 = z->l - z->c; (void)m13;
+                    if (!(eq_s_b(z, 12, s_49))) goto lab9;
+                    goto lab8;
+                lab9:
+                    z->c = z->l - m13;
+                    if (!(eq_s_b(z, 15, s_50))) goto lab10;
+                    goto lab8;
+                lab10:
+                    z->c = z->l - m13;
+                    if (!(eq_s_b(z, 12, s_51))) goto lab11;
+                    goto lab8;
+                lab11:
+                    z->c = z->l - m13;
+                    if (!(eq_s_b(z, 15, s_52))) goto lab12;
+                    goto lab8;
+                lab12:
+                    z->c = z->l - m13;
+                    if (!(eq_s_b(z, 9, s_53))) goto lab13;
+                    goto lab8;
+                lab13:
+                    z->c = z->l - m13;
+                    if (!(eq_s_b(z, 12, s_54))) goto lab14;
+                    goto lab8;
+                lab14:
+                    z->c = z->l - m13;
+                    if (!(eq_s_b(z, 15, s_55))) goto lab15;
+                    goto lab8;
+                lab15:
+                    z->c = z->l - m13;
+                    if (!(eq_s_b(z, 12, s_56))) goto lab16;
+                    goto lab8;
+                lab16:
+                    z->c = z->l - m13;
+                    if (!(eq_s_b(z, 12, s_57))) goto lab17;
+                    goto lab8;
+                lab17:
+                    z->c = z->l - m13;
+                    if (!(eq_s_b(z, 9, s_58))) goto lab18;
+                    goto lab8;
+                lab18:
+                    z->c = z->l - m13;
+                    if (!(eq_s_b(z, 15, s_59))) goto lab19;
+                    goto lab8;
+                lab19:
+                    z->c = z->l - m13;
+                    if (!(eq_s_b(z, 9, s_60))) goto lab20;
+                    {   int m_test14 = z->l - z->c;
+                        {   int m15 = z->l - z->c; (void)m15;
+                            if (z->c - 2 <= z->lb || !((a_16_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 174 && z->p[z->c - 2] != 175)) goto lab21;
+                            if (!(find_among_b_16(z))) goto lab21;
+                            goto lab20;
+                        lab21:
+                            z->c = z->l - m15;
+                        }
+                        z->c = z->l - m_test14;
+                    }
+                    goto lab8;
+                lab20:
+                    z->c = z->l - m13;
+                    if (!(eq_s_b(z, 6, s_61))) goto lab22;
+                    goto lab8;
+                lab22:
+                    z->c = z->l - m13;
+                    if (!(eq_s_b(z, 9, s_62))) goto lab7;
+                }
+            lab8:
+                z->bra = z->c;
+                {   int ret = slice_from_s(z, 3, s_63);
+                    if (ret < 0) return ret;
+                }
+                z->I[1] = 1;
+                z->c = z->l - m_test12;
+            }
+            goto lab6;
+        lab7:
+            z->c = z->l - m11;
+            {   int m_test16 = z->l - z->c;
+                z->ket = z->c;
+                if (z->c - 8 <= z->lb || !((a_17_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 174 && z->p[z->c - 2] != 175)) goto lab5;
+                if (!(find_among_b_17(z))) goto lab5;
+                z->bra = z->c;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                z->I[1] = 1;
+                z->c = z->l - m_test16;
+            }
+        }
+    lab6:
+        z->c = z->lb;
+        
+        {   int ret = r_fix_endings(z);
+            if (ret < 0) return ret;
+        }
+    lab5:
+        z->c = c10;
+    }
+    {   int c17 = z->c;
+        z->I[1] = 0;
+        z->I[0] = 0;
+        if (!(lenof_utf8(z, z->p) > 4)) goto lab23;
+        z->lb = z->c; z->c = z->l;
+
+        {   int m18 = z->l - z->c; (void)m18;
+            {   int m_test19 = z->l - z->c;
+                z->ket = z->c;
+                if (!(eq_s_b(z, 6, s_64))) goto lab25;
+                z->bra = z->c;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                z->c = z->l - m_test19;
+            }
+            goto lab24;
+        lab25:
+            z->c = z->l - m18;
+            {   int m_test20 = z->l - z->c;
+                z->ket = z->c;
+                {   int m21 = z->l - z->c; (void)m21;
+                    {   int m22 = z->l - z->c; (void)m22;
+                        if (!(eq_s_b(z, 9, s_65))) goto lab30;
+                        goto lab29;
+                    lab30:
+                        z->c = z->l - m22;
+                        if (!(eq_s_b(z, 3, s_66))) goto lab28;
+                    }
+                lab29:
+                    {   int m_test23 = z->l - z->c;
+                        {   int m24 = z->l - z->c; (void)m24;
+                            if (z->c - 2 <= z->lb || !((a_18_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || z->p[z->c - 2] != 174) goto lab31;
+                            if (!(find_among_b_18(z))) goto lab31;
+                            goto lab28;
+                        lab31:
+                            z->c = z->l - m24;
+                        }
+                        z->c = z->l - m_test23;
+                    }
+                    goto lab27;
+                lab28:
+                    z->c = z->l - m21;
+                    if (!(eq_s_b(z, 3, s_67))) goto lab26;
+                    {   int m_test25 = z->l - z->c;
+                        if (z->c - 2 <= z->lb || !((a_19_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || z->p[z->c - 2] != 174) goto lab26;
+                        if (!(find_among_b_19(z))) goto lab26;
+                        if (!(eq_s_b(z, 3, s_68))) goto lab26;
+                        z->c = z->l - m_test25;
+                    }
+                }
+            lab27:
+                z->bra = z->c;
+                {   int ret = slice_from_s(z, 3, s_69);
+                    if (ret < 0) return ret;
+                }
+                z->c = z->l - m_test20;
+            }
+            goto lab24;
+        lab26:
+            z->c = z->l - m18;
+            {   int m_test26 = z->l - z->c;
+                z->ket = z->c;
+                {   int m27 = z->l - z->c; (void)m27;
+                    if (!(eq_s_b(z, 9, s_70))) goto lab34;
+                    goto lab33;
+                lab34:
+                    z->c = z->l - m27;
+                    if (!(eq_s_b(z, 9, s_71))) goto lab35;
+                    goto lab33;
+                lab35:
+                    z->c = z->l - m27;
+                    if (!(eq_s_b(z, 9, s_72))) goto lab36;
+                    goto lab33;
+                lab36:
+                    z->c = z->l - m27;
+                    if (!(eq_s_b(z, 9, s_73))) goto lab37;
+                    goto lab33;
+                lab37:
+                    z->c = z->l - m27;
+                    if (!(eq_s_b(z, 9, s_74))) goto lab38;
+                    {   int m_test28 = z->l - z->c;
+                        {   int m29 = z->l - z->c; (void)m29;
+                            if (!(eq_s_b(z, 3, s_75))) goto lab39;
+                            goto lab38;
+                        lab39:
+                            z->c = z->l - m29;
+                        }
+                        z->c = z->l - m_test28;
+                    }
+                    goto lab33;
+                lab38:
+                    z->c = z->l - m27;
+                    if (!(eq_s_b(z, 15, s_76))) goto lab40;
+                    goto lab33;
+                lab40:
+                    z->c = z->l - m27;
+                    if (!(eq_s_b(z, 21, s_77))) goto lab41;
+                    goto lab33;
+                lab41:
+                    z->c = z->l - m27;
+                    if (!(eq_s_b(z, 9, s_78))) goto lab42;
+                    goto lab33;
+                lab42:
+                    z->c = z->l - m27;
+                    if (!(lenof_utf8(z, z->p) >= 7)) goto lab43;
+                    if (!(eq_s_b(z, 12, s_79))) goto lab43;
+                    goto lab33;
+                lab43:
+                    z->c = z->l - m27;
+                    if (!(eq_s_b(z, 9, s_80))) goto lab44;
+                    goto lab33;
+                lab44:
+                    z->c = z->l - m27;
+                    if (!(eq_s_b(z, 9, s_81))) goto lab45;
+                    goto lab33;
+                lab45:
+                    z->c = z->l - m27;
+                    if (!(eq_s_b(z, 12, s_82))) goto lab46;
+                    goto lab33;
+                lab46:
+                    z->c = z->l - m27;
+                    if (!(eq_s_b(z, 6, s_83))) goto lab47;
+                    {   int m_test30 = z->l - z->c;
+                        {   int m31 = z->l - z->c; (void)m31;
+                            if (z->c - 2 <= z->lb || !((a_20_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 174 && z->p[z->c - 2] != 175)) goto lab48;
+                            if (!(find_among_b_20(z))) goto lab48;
+                            goto lab47;
+                        lab48:
+                            z->c = z->l - m31;
+                        }
+                        z->c = z->l - m_test30;
+                    }
+                    goto lab33;
+                lab47:
+                    z->c = z->l - m27;
+                    if (!(eq_s_b(z, 9, s_84))) goto lab32;
+                }
+            lab33:
+                z->bra = z->c;
+                {   int ret = slice_from_s(z, 3, s_85);
+                    if (ret < 0) return ret;
+                }
+                z->c = z->l - m_test26;
+            }
+            goto lab24;
+        lab32:
+            z->c = z->l - m18;
+            {   int m_test32 = z->l - z->c;
+                z->ket = z->c;
+                {   int m33 = z->l - z->c; (void)m33;
+                    if (!(eq_s_b(z, 9, s_86))) goto lab51;
+                    goto lab50;
+                lab51:
+                    z->c = z->l - m33;
+                    if (!(eq_s_b(z, 12, s_87))) goto lab52;
+                    goto lab50;
+                lab52:
+                    z->c = z->l - m33;
+                    if (!(eq_s_b(z, 12, s_88))) goto lab53;
+                    goto lab50;
+                lab53:
+                    z->c = z->l - m33;
+                    if (!(eq_s_b(z, 12, s_89))) goto lab54;
+                    goto lab50;
+                lab54:
+                    z->c = z->l - m33;
+                    if (!(eq_s_b(z, 12, s_90))) goto lab55;
+                    goto lab50;
+                lab55:
+                    z->c = z->l - m33;
+                    if (!(eq_s_b(z, 12, s_91))) goto lab56;
+                    goto lab50;
+                lab56:
+                    z->c = z->l - m33;
+                    if (!(eq_s_b(z, 6, s_92))) goto lab49;
+                    {   int m_test34 = z->l - z->c;
+                        {   int m35 = z->l - z->c; (void)m35;
+                            if (z->c - 2 <= z->lb || !((a_21_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 174 && z->p[z->c - 2] != 175)) goto lab57;
+                            if (!(find_among_b_21(z))) goto lab57;
+                            goto lab49;
+                        lab57:
+                            z->c = z->l - m35;
+                        }
+                        z->c = z->l - m_test34;
+                    }
+                }
+            lab50:
+                z->bra = z->c;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                z->c = z->l - m_test32;
+            }
+            goto lab24;
+        lab49:
+            z->c = z->l - m18;
+            {   int m_test36 = z->l - z->c;
+                z->ket = z->c;
+                if (!(eq_s_b(z, 3, s_93))) goto lab23;
+                z->bra = z->c;
+                {   int ret = slice_from_s(z, 3, s_94);
+                    if (ret < 0) return ret;
+                }
+                z->c = z->l - m_test36;
+            }
+        }
+    lab24:
+        z->I[1] = 1;
+        z->I[0] = 1;
+        {   int m37 = z->l - z->c; (void)m37;
+            z->ket = z->c;
+            if (!(eq_s_b(z, 9, s_95))) goto lab58;
+            z->bra = z->c;
+            {   int ret = slice_from_s(z, 3, s_96);
+                if (ret < 0) return ret;
+            }
+        lab58:
+            z->c = z->l - m37;
+        }
+        z->c = z->lb;
+        
+        {   int ret = r_fix_endings(z);
+            if (ret < 0) return ret;
+        }
+    lab23:
+        z->c = c17;
+    }
+    {   int c38 = z->c;
+        z->I[1] = 0;
+        z->lb = z->c; z->c = z->l;
+
+        {   int m39 = z->l - z->c; (void)m39;
+            z->ket = z->c;
+            if (!(eq_s_b(z, 18, s_97))) goto lab61;
+            {   int m_test40 = z->l - z->c;
+                {   int m41 = z->l - z->c; (void)m41;
+                    if (z->c - 2 <= z->lb || !((a_13_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || z->p[z->c - 2] != 174) goto lab62;
+                    if (!(find_among_b_13(z))) goto lab62;
+                    goto lab61;
+                lab62:
+                    z->c = z->l - m41;
+                }
+                z->c = z->l - m_test40;
+            }
+            z->bra = z->c;
+            {   int ret = slice_from_s(z, 3, s_98);
+                if (ret < 0) return ret;
+            }
+            goto lab60;
+        lab61:
+            z->c = z->l - m39;
+            z->ket = z->c;
+            if (!(eq_s_b(z, 15, s_99))) goto lab63;
+            z->bra = z->c;
+            {   int ret = slice_from_s(z, 6, s_100);
+                if (ret < 0) return ret;
+            }
+            goto lab60;
+        lab63:
+            z->c = z->l - m39;
+            z->ket = z->c;
+            if (!(eq_s_b(z, 15, s_101))) goto lab64;
+            z->bra = z->c;
+            {   int ret = slice_from_s(z, 6, s_102);
+                if (ret < 0) return ret;
+            }
+            goto lab60;
+        lab64:
+            z->c = z->l - m39;
+            z->ket = z->c;
+            if (!(eq_s_b(z, 9, s_103))) goto lab59;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        }
+    lab60:
+        z->I[1] = 1;
+        z->c = z->lb;
+    lab59:
+        z->c = c38;
+    }
+    {   int c42 = z->c;
+        if (!(lenof_utf8(z, z->p) > 4)) goto lab65;
+        z->I[1] = 0;
+        z->lb = z->c; z->c = z->l;
+
+        z->ket = z->c;
+        if (z->c - 5 <= z->lb || z->p[z->c - 1] != 191 || z->p[z->c - 2] != 174) goto lab65;
+        if (!(find_among_b_15(z))) goto lab65;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[1] = 1;
+        z->c = z->lb;
+    lab65:
+        z->c = c42;
+    }
+    {   int c43 = z->c;
+        z->I[1] = 1;
+        while(1) {
+            int c44 = z->c;
+            if (!(z->I[1])) goto lab67;
+            {   int c45 = z->c;
+                z->I[1] = 0;
+                if (!(lenof_utf8(z, z->p) > 4)) goto lab68;
+                z->lb = z->c; z->c = z->l;
+
+                {   int m46 = z->l - z->c; (void)m46;
+                    {   int m47 = z->l - z->c; (void)m47;
+                        {   int m_test48 = z->l - z->c;
+                            z->ket = z->c;
+                            if (z->c - 8 <= z->lb || (z->p[z->c - 1] != 129 && z->p[z->c - 1] != 141) || z->p[z->c - 2] != 175) goto lab71;
+                            if (!(find_among_b_22(z))) goto lab71;
+                            z->bra = z->c;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            z->I[1] = 1;
+                            z->c = z->l - m_test48;
+                        }
+                        goto lab70;
+                    lab71:
+                        z->c = z->l - m47;
+                        {   int m_test49 = z->l - z->c;
+                            z->ket = z->c;
+                            {   int m50 = z->l - z->c; (void)m50;
+                                if (!(eq_s_b(z, 12, s_104))) goto lab74;
+                                goto lab73;
+                            lab74:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 12, s_105))) goto lab75;
+                                goto lab73;
+                            lab75:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 9, s_106))) goto lab76;
+                                goto lab73;
+                            lab76:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 12, s_107))) goto lab77;
+                                goto lab73;
+                            lab77:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 12, s_108))) goto lab78;
+                                goto lab73;
+                            lab78:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 12, s_109))) goto lab79;
+                                goto lab73;
+                            lab79:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 9, s_110))) goto lab80;
+                                {   int m_test51 = z->l - z->c;
+                                    {   int m52 = z->l - z->c; (void)m52;
+                                        if (z->c - 2 <= z->lb || z->p[z->c - 1] >> 5 != 4 || !((1951712 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] != 174) goto lab81;
+                                        if (!(find_among_b_23(z))) goto lab81;
+                                        goto lab80;
+                                    lab81:
+                                        z->c = z->l - m52;
+                                    }
+                                    z->c = z->l - m_test51;
+                                }
+                                goto lab73;
+                            lab80:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 9, s_111))) goto lab82;
+                                goto lab73;
+                            lab82:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 9, s_112))) goto lab83;
+                                goto lab73;
+                            lab83:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 9, s_113))) goto lab84;
+                                goto lab73;
+                            lab84:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 9, s_114))) goto lab85;
+                                goto lab73;
+                            lab85:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 3, s_115))) goto lab86;
+                                goto lab73;
+                            lab86:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 3, s_116))) goto lab87;
+                                goto lab73;
+                            lab87:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 3, s_117))) goto lab88;
+                                goto lab73;
+                            lab88:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 3, s_118))) goto lab89;
+                                goto lab73;
+                            lab89:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 3, s_119))) goto lab90;
+                                goto lab73;
+                            lab90:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 9, s_120))) goto lab91;
+                                goto lab73;
+                            lab91:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 9, s_121))) goto lab92;
+                                goto lab73;
+                            lab92:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 9, s_122))) goto lab93;
+                                goto lab73;
+                            lab93:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 6, s_123))) goto lab94;
+                                {   int m_test53 = z->l - z->c;
+                                    {   int m54 = z->l - z->c; (void)m54;
+                                        if (z->c - 2 <= z->lb || !((a_24_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || (z->p[z->c - 2] != 174 && z->p[z->c - 2] != 175)) goto lab95;
+                                        if (!(find_among_b_24(z))) goto lab95;
+                                        goto lab94;
+                                    lab95:
+                                        z->c = z->l - m54;
+                                    }
+                                    z->c = z->l - m_test53;
+                                }
+                                goto lab73;
+                            lab94:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 15, s_124))) goto lab96;
+                                goto lab73;
+                            lab96:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 9, s_125))) goto lab97;
+                                goto lab73;
+                            lab97:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 9, s_126))) goto lab98;
+                                goto lab73;
+                            lab98:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 12, s_127))) goto lab99;
+                                goto lab73;
+                            lab99:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 12, s_128))) goto lab100;
+                                goto lab73;
+                            lab100:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 12, s_129))) goto lab101;
+                                goto lab73;
+                            lab101:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 12, s_130))) goto lab102;
+                                goto lab73;
+                            lab102:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 6, s_131))) goto lab103;
+                                goto lab73;
+                            lab103:
+                                z->c = z->l - m50;
+                                if (!(eq_s_b(z, 6, s_132))) goto lab72;
+                            }
+                        lab73:
+                            z->bra = z->c;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            z->I[1] = 1;
+                            z->c = z->l - m_test49;
+                        }
+                        goto lab70;
+                    lab72:
+                        z->c = z->l - m47;
+                        {   int m_test55 = z->l - z->c;
+                            z->ket = z->c;
+                            {   int m56 = z->l - z->c; (void)m56;
+                                if (!(eq_s_b(z, 9, s_133))) goto lab106;
+                                {   int m_test57 = z->l - z->c;
+                                    {   int m58 = z->l - z->c; (void)m58;
+                                        if (!(eq_s_b(z, 3, s_134))) goto lab107;
+                                        goto lab106;
+                                    lab107:
+                                        z->c = z->l - m58;
+                                    }
+                                    z->c = z->l - m_test57;
+                                }
+                                goto lab105;
+                            lab106:
+                                z->c = z->l - m56;
+                                if (!(eq_s_b(z, 9, s_135))) goto lab108;
+                                goto lab105;
+                            lab108:
+                                z->c = z->l - m56;
+                                if (!(eq_s_b(z, 9, s_136))) goto lab109;
+                                goto lab105;
+                            lab109:
+                                z->c = z->l - m56;
+                                if (!(eq_s_b(z, 9, s_137))) goto lab110;
+                                goto lab105;
+                            lab110:
+                                z->c = z->l - m56;
+                                if (!(eq_s_b(z, 3, s_138))) goto lab111;
+                                goto lab105;
+                            lab111:
+                                z->c = z->l - m56;
+                                if (!(eq_s_b(z, 9, s_139))) goto lab112;
+                                goto lab105;
+                            lab112:
+                                z->c = z->l - m56;
+                                if (!(eq_s_b(z, 9, s_140))) goto lab113;
+                                goto lab105;
+                            lab113:
+                                z->c = z->l - m56;
+                                if (!(eq_s_b(z, 9, s_141))) goto lab114;
+                                goto lab105;
+                            lab114:
+                                z->c = z->l - m56;
+                                if (!(eq_s_b(z, 9, s_142))) goto lab115;
+                                goto lab105;
+                            lab115:
+                                z->c = z->l - m56;
+                                if (!(eq_s_b(z, 12, s_143))) goto lab116;
+                                goto lab105;
+                            lab116:
+                                z->c = z->l - m56;
+                                if (!(eq_s_b(z, 12, s_144))) goto lab117;
+                                goto lab105;
+                            lab117:
+                                z->c = z->l - m56;
+                                if (!(eq_s_b(z, 12, s_145))) goto lab118;
+                                goto lab105;
+                            lab118:
+                                z->c = z->l - m56;
+                                if (!(eq_s_b(z, 12, s_146))) goto lab119;
+                                goto lab105;
+                            lab119:
+                                z->c = z->l - m56;
+                                if (!(eq_s_b(z, 9, s_147))) goto lab120;
+                                goto lab105;
+                            lab120:
+                                z->c = z->l - m56;
+                                if (!(eq_s_b(z, 12, s_148))) goto lab121;
+                                goto lab105;
+                            lab121:
+                                z->c = z->l - m56;
+                                if (!(eq_s_b(z, 12, s_149))) goto lab122;
+                                goto lab105;
+                            lab122:
+                                z->c = z->l - m56;
+                                if (!(eq_s_b(z, 9, s_150))) goto lab123;
+                                goto lab105;
+                            lab123:
+                                z->c = z->l - m56;
+                                if (!(eq_s_b(z, 12, s_151))) goto lab104;
+                            }
+                        lab105:
+                            z->bra = z->c;
+                            {   int ret = slice_from_s(z, 3, s_152);
+                                if (ret < 0) return ret;
+                            }
+                            z->I[1] = 1;
+                            z->c = z->l - m_test55;
+                        }
+                        goto lab70;
+                    lab104:
+                        z->c = z->l - m47;
+                        {   int m_test59 = z->l - z->c;
+                            z->ket = z->c;
+                            {   int m60 = z->l - z->c; (void)m60;
+                                if (!(eq_s_b(z, 6, s_153))) goto lab125;
+                                goto lab124;
+                            lab125:
+                                z->c = z->l - m60;
+                                if (!(eq_s_b(z, 6, s_154))) goto lab69;
+                            }
+                        lab124:
+                            {   int m_test61 = z->l - z->c;
+                                if (!(eq_s_b(z, 3, s_155))) goto lab69;
+                                z->c = z->l - m_test61;
+                            }
+                            z->bra = z->c;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            z->I[1] = 1;
+                            z->c = z->l - m_test59;
+                        }
+                    }
+                lab70:
+                lab69:
+                    z->c = z->l - m46;
+                }
+                {   int m62 = z->l - z->c; (void)m62;
+                    z->ket = z->c;
+                    if (z->c - 8 <= z->lb || (z->p[z->c - 1] != 141 && z->p[z->c - 1] != 177) || (z->p[z->c - 2] != 174 && z->p[z->c - 2] != 175)) goto lab126;
+                    if (!(find_among_b_25(z))) goto lab126;
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    z->I[1] = 1;
+                lab126:
+                    z->c = z->l - m62;
+                }
+                z->c = z->lb;
+                
+                {   int ret = r_fix_endings(z);
+                    if (ret < 0) return ret;
+                }
+            lab68:
+                z->c = c45;
+            }
+            continue;
+        lab67:
+            z->c = c44;
+            break;
+        }
+        z->c = c43;
+    }
+    return 1;
+}
+
+extern struct SN_env * tamil_UTF_8_create_env(void) { return SN_create_env(0, 2); }
+
+extern void tamil_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
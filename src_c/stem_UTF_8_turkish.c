@@ -0,0 +1,3082 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int turkish_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+static int r_stem_suffix_chain_before_ki(struct SN_env * z);
+static int r_mark_suffix_with_optional_n_consonant(struct SN_env * z);
+static int r_mark_suffix_with_optional_y_consonant(struct SN_env * z);
+static int r_mark_ysA(struct SN_env * z);
+static int r_mark_ymUs_(struct SN_env * z);
+static int r_mark_yDU(struct SN_env * z);
+static int r_mark_yUz(struct SN_env * z);
+static int r_mark_yUm(struct SN_env * z);
+static int r_mark_possessives(struct SN_env * z);
+static int r_mark_sUnUz(struct SN_env * z);
+static int r_mark_sUn(struct SN_env * z);
+static int r_mark_sU(struct SN_env * z);
+static int r_mark_nUn(struct SN_env * z);
+static int r_mark_ndA(struct SN_env * z);
+static int r_mark_lArI(struct SN_env * z);
+static int r_mark_lAr(struct SN_env * z);
+static int r_mark_DUr(struct SN_env * z);
+static int r_mark_DA(struct SN_env * z);
+static int r_check_vowel_harmony(struct SN_env * z);
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * turkish_UTF_8_create_env(void);
+extern void turkish_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[10] =
+{
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 }
+};
+
+
+static const struct among a_1[2] =
+{
+{ 0, 4, -1, -1 },
+{ 0, 5, -1, -1 }
+};
+
+
+static const struct among a_2[4] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_3[4] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_4[2] =
+{
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 }
+};
+
+
+static const struct among a_5[2] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 }
+};
+
+
+static const struct among a_6[4] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 }
+};
+
+
+static const struct among a_7[2] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_8[4] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_9[2] =
+{
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 }
+};
+
+
+static const struct among a_10[2] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 }
+};
+
+
+static const struct among a_11[2] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 }
+};
+
+
+static const struct among a_12[4] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_13[4] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 }
+};
+
+
+static const struct among a_14[4] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_15[4] =
+{
+{ 0, 5, -1, -1 },
+{ 0, 5, -1, -1 },
+{ 0, 7, -1, -1 },
+{ 0, 7, -1, -1 }
+};
+
+
+static const struct among a_16[2] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_17[4] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 }
+};
+
+
+static const struct among a_18[8] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 }
+};
+
+
+static const struct among a_19[2] =
+{
+{ 0, 7, -1, -1 },
+{ 0, 6, -1, -1 }
+};
+
+
+static const struct among a_20[32] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_21[8] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_22[4] =
+{
+{ 0, 4, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 5, -1, -1 },
+{ 0, 5, -1, -1 }
+};
+
+
+static const struct among a_23[4] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 2 },
+{ 0, 1, -1, 3 },
+{ 0, 2, -1, 4 }
+};
+
+static const unsigned char g_vowel_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_vowel[] = { 17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 8, 0, 0, 0, 0, 0, 0, 1 };
+
+static const unsigned char g_U_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_U[] = { 1, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 1 };
+
+static const unsigned char g_vowel1_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_vowel1[] = { 1, 64, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 };
+
+static const unsigned char g_vowel2_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_vowel2[] = { 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130 };
+
+static const unsigned char g_vowel3_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_vowel3[] = { 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 };
+
+static const unsigned char g_vowel4_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_vowel4[] = { 17 };
+
+static const unsigned char g_vowel5_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_vowel5[] = { 65 };
+
+static const unsigned char g_vowel6_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_vowel6[] = { 65 };
+
+static const symbol s_0[] = { 0xC4, 0xB1 };
+static const symbol s_1[] = { 0xC3, 0xB6 };
+static const symbol s_2[] = { 0xC3, 0xBC };
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'm':
+                i = 0;
+                break;
+            case 'n':
+                i = 1;
+                break;
+            case 'z':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'm':
+                                i = 2;
+                                break;
+                            case 'n':
+                                i = 3;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'm':
+                                i = 4;
+                                break;
+                            case 'n':
+                                i = 5;
+                                break;
+                        }
+                        break;
+                    case 0xB1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC4) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'm':
+                                i = 6;
+                                break;
+                            case 'n':
+                                i = 7;
+                                break;
+                        }
+                        break;
+                    case 0xBC:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'm':
+                                i = 8;
+                                break;
+                            case 'n':
+                                i = 9;
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_0[i].s_size;
+    return a_0[i].result;
+}
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'i':
+                if (n <= 1) break;
+                if (q[-2] != 'r') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                if (n <= 3) break;
+                if (q[-4] != 'l') break;
+                i = 0;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xC4) break;
+                if (n <= 2) break;
+                if (q[-3] != 'r') break;
+                if (n <= 3) break;
+                if (q[-4] != 'a') break;
+                if (n <= 4) break;
+                if (q[-5] != 'l') break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+
+static const unsigned char a_3_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'n') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'i':
+                i = 0;
+                break;
+            case 'u':
+                i = 1;
+                break;
+            case 0xB1:
+                if (n <= 2) break;
+                if (q[-3] != 0xC4) break;
+                i = 2;
+                break;
+            case 0xBC:
+                if (n <= 2) break;
+                if (q[-3] != 0xC3) break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+
+static int find_among_b_6(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        i = 0;
+                        break;
+                    case 't':
+                        i = 1;
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        i = 2;
+                        break;
+                    case 't':
+                        i = 3;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_6[i].s_size;
+    return a_6[i].result;
+}
+
+static int find_among_b_7(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[-2] != 'd') break;
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                i = 0;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                if (q[-2] != 'd') break;
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_7[i].s_size;
+    return a_7[i].result;
+}
+
+static const unsigned char a_12_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_12(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'm') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'i':
+                i = 0;
+                break;
+            case 'u':
+                i = 1;
+                break;
+            case 0xB1:
+                if (n <= 2) break;
+                if (q[-3] != 0xC4) break;
+                i = 2;
+                break;
+            case 0xBC:
+                if (n <= 2) break;
+                if (q[-3] != 0xC3) break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_12[i].s_size;
+    return a_12[i].result;
+}
+
+static const unsigned char a_13_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_13(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'n') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'i':
+                if (n <= 2) break;
+                if (q[-3] != 's') break;
+                i = 0;
+                break;
+            case 'u':
+                if (n <= 2) break;
+                if (q[-3] != 's') break;
+                i = 1;
+                break;
+            case 0xB1:
+                if (n <= 2) break;
+                if (q[-3] != 0xC4) break;
+                if (n <= 3) break;
+                if (q[-4] != 's') break;
+                i = 2;
+                break;
+            case 0xBC:
+                if (n <= 2) break;
+                if (q[-3] != 0xC3) break;
+                if (n <= 3) break;
+                if (q[-4] != 's') break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_13[i].s_size;
+    return a_13[i].result;
+}
+
+static const unsigned char a_14_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_14(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'z') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'i':
+                i = 0;
+                break;
+            case 'u':
+                i = 1;
+                break;
+            case 0xB1:
+                if (n <= 2) break;
+                if (q[-3] != 0xC4) break;
+                i = 2;
+                break;
+            case 0xBC:
+                if (n <= 2) break;
+                if (q[-3] != 0xC3) break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_14[i].s_size;
+    return a_14[i].result;
+}
+
+static const unsigned char a_15_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_15(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'z') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'i':
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                if (n <= 3) break;
+                if (q[-4] != 'i') break;
+                if (n <= 4) break;
+                if (q[-5] != 's') break;
+                i = 0;
+                break;
+            case 'u':
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                if (n <= 3) break;
+                if (q[-4] != 'u') break;
+                if (n <= 4) break;
+                if (q[-5] != 's') break;
+                i = 1;
+                break;
+            case 0xB1:
+                if (n <= 2) break;
+                if (q[-3] != 0xC4) break;
+                if (n <= 3) break;
+                if (q[-4] != 'n') break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB1) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xC4) break;
+                if (n <= 6) break;
+                if (q[-7] != 's') break;
+                i = 2;
+                break;
+            case 0xBC:
+                if (n <= 2) break;
+                if (q[-3] != 0xC3) break;
+                if (n <= 3) break;
+                if (q[-4] != 'n') break;
+                if (n <= 4) break;
+                if (q[-5] != 0xBC) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xC3) break;
+                if (n <= 6) break;
+                if (q[-7] != 's') break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_15[i].s_size;
+    return a_15[i].result;
+}
+
+static int find_among_b_16(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'r') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'a':
+                if (n <= 2) break;
+                if (q[-3] != 'l') break;
+                i = 0;
+                break;
+            case 'e':
+                if (n <= 2) break;
+                if (q[-3] != 'l') break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_16[i].s_size;
+    return a_16[i].result;
+}
+
+static const unsigned char a_18_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_18(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'r') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'i':
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'd':
+                        i = 0;
+                        break;
+                    case 't':
+                        i = 1;
+                        break;
+                }
+                break;
+            case 'u':
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'd':
+                        i = 2;
+                        break;
+                    case 't':
+                        i = 3;
+                        break;
+                }
+                break;
+            case 0xB1:
+                if (n <= 2) break;
+                if (q[-3] != 0xC4) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'd':
+                        i = 4;
+                        break;
+                    case 't':
+                        i = 5;
+                        break;
+                }
+                break;
+            case 0xBC:
+                if (n <= 2) break;
+                if (q[-3] != 0xC3) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'd':
+                        i = 6;
+                        break;
+                    case 't':
+                        i = 7;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_18[i].s_size;
+    return a_18[i].result;
+}
+
+static const unsigned char a_20_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6A, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static const unsigned char a_20_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x2, 0x30, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x10, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_20(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        i = 0;
+                        break;
+                    case 't':
+                        i = 1;
+                        break;
+                }
+                break;
+            case 'k':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                i = 2;
+                                break;
+                            case 't':
+                                i = 3;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                i = 4;
+                                break;
+                            case 't':
+                                i = 5;
+                                break;
+                        }
+                        break;
+                    case 0xB1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC4) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'd':
+                                i = 6;
+                                break;
+                            case 't':
+                                i = 7;
+                                break;
+                        }
+                        break;
+                    case 0xBC:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'd':
+                                i = 8;
+                                break;
+                            case 't':
+                                i = 9;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'm':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                i = 10;
+                                break;
+                            case 't':
+                                i = 11;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                i = 12;
+                                break;
+                            case 't':
+                                i = 13;
+                                break;
+                        }
+                        break;
+                    case 0xB1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC4) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'd':
+                                i = 14;
+                                break;
+                            case 't':
+                                i = 15;
+                                break;
+                        }
+                        break;
+                    case 0xBC:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'd':
+                                i = 16;
+                                break;
+                            case 't':
+                                i = 17;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                i = 18;
+                                break;
+                            case 't':
+                                i = 19;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                i = 20;
+                                break;
+                            case 't':
+                                i = 21;
+                                break;
+                        }
+                        break;
+                    case 0xB1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC4) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'd':
+                                i = 22;
+                                break;
+                            case 't':
+                                i = 23;
+                                break;
+                        }
+                        break;
+                    case 0xBC:
+                        if (n <= 2) break;
+                        if (q[-3] != 0xC3) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'd':
+                                i = 24;
+                                break;
+                            case 't':
+                                i = 25;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'u':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        i = 26;
+                        break;
+                    case 't':
+                        i = 27;
+                        break;
+                }
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xC4) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'd':
+                        i = 28;
+                        break;
+                    case 't':
+                        i = 29;
+                        break;
+                }
+                break;
+            case 0xBC:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'd':
+                        i = 30;
+                        break;
+                    case 't':
+                        i = 31;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_20[i].s_size;
+    return a_20[i].result;
+}
+
+static int find_among_b_21(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                i = 0;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                i = 1;
+                break;
+            case 'k':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        i = 2;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        i = 3;
+                        break;
+                }
+                break;
+            case 'm':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        i = 4;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        i = 5;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        i = 6;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        i = 7;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_21[i].s_size;
+    return a_21[i].result;
+}
+
+static int find_among_b_22(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x9F) break;
+        if (n <= 1) break;
+        if (q[-2] != 0xC5) break;
+        if (n <= 2) break;
+        switch (q[-3]) {
+            case 'i':
+                if (n <= 3) break;
+                if (q[-4] != 'm') break;
+                i = 0;
+                break;
+            case 'u':
+                if (n <= 3) break;
+                if (q[-4] != 'm') break;
+                i = 1;
+                break;
+            case 0xB1:
+                if (n <= 3) break;
+                if (q[-4] != 0xC4) break;
+                if (n <= 4) break;
+                if (q[-5] != 'm') break;
+                i = 2;
+                break;
+            case 0xBC:
+                if (n <= 3) break;
+                if (q[-4] != 0xC3) break;
+                if (n <= 4) break;
+                if (q[-5] != 'm') break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_22[i].s_size;
+    return a_22[i].result;
+}
+static const symbol s_3[] = { 'k', 'i' };
+static const unsigned char g_vowel_scan[32] = { 0, 64, 0, 0, 0, 192, 0, 0, 0, 64, 0, 0, 0, 0, 0, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+static const symbol s_4[] = { 'k', 'e', 'n' };
+
+static int find_among_b_19(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xC4) break;
+                if (n <= 4) break;
+                if (q[-5] != 's') break;
+                if (n <= 5) break;
+                if (q[-6] != 'a') break;
+                if (n <= 6) break;
+                if (q[-7] != 'c') break;
+                i = 0;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                if (n <= 3) break;
+                if (q[-4] != 's') break;
+                if (n <= 4) break;
+                if (q[-5] != 'e') break;
+                if (n <= 5) break;
+                if (q[-6] != 'c') break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_19[i].s_size;
+    return a_19[i].result;
+}
+
+static const unsigned char a_17_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_17(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'z') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'i':
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                i = 0;
+                break;
+            case 'u':
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                i = 1;
+                break;
+            case 0xB1:
+                if (n <= 2) break;
+                if (q[-3] != 0xC4) break;
+                if (n <= 3) break;
+                if (q[-4] != 'n') break;
+                i = 2;
+                break;
+            case 0xBC:
+                if (n <= 2) break;
+                if (q[-3] != 0xC3) break;
+                if (n <= 3) break;
+                if (q[-4] != 'n') break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_17[i].s_size;
+    return a_17[i].result;
+}
+
+static int find_among_b_11(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[-2] != 'c') break;
+                i = 0;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                if (q[-2] != 'c') break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_11[i].s_size;
+    return a_11[i].result;
+}
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                i = 0;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+
+static int find_among_b_9(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'n') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'a':
+                if (n <= 2) break;
+                if (q[-3] != 'd') break;
+                if (n <= 3) break;
+                if (q[-4] != 'n') break;
+                i = 0;
+                break;
+            case 'e':
+                if (n <= 2) break;
+                if (q[-3] != 'd') break;
+                if (n <= 3) break;
+                if (q[-4] != 'n') break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_9[i].s_size;
+    return a_9[i].result;
+}
+
+static const unsigned char a_2_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static const unsigned char a_2_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x40, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x18, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'i':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                i = 0;
+                break;
+            case 'u':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                i = 1;
+                break;
+            case 0xB1:
+                if (n <= 1) break;
+                if (q[-2] != 0xC4) break;
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                i = 2;
+                break;
+            case 0xBC:
+                if (n <= 1) break;
+                if (q[-2] != 0xC3) break;
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+
+static int find_among_b_8(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'n') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'a':
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'd':
+                        i = 0;
+                        break;
+                    case 't':
+                        i = 1;
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'd':
+                        i = 2;
+                        break;
+                    case 't':
+                        i = 3;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_8[i].s_size;
+    return a_8[i].result;
+}
+
+static int find_among_b_10(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[-2] != 'l') break;
+                i = 0;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                if (q[-2] != 'l') break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_10[i].s_size;
+    return a_10[i].result;
+}
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                i = 0;
+                break;
+            case 'e':
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+static const symbol s_5[] = { 'a', 'd' };
+static const symbol s_6[] = { 's', 'o', 'y' };
+static const symbol s_7[] = { 0xC4, 0xB1 };
+static const symbol s_8[] = { 0xC4, 0xB1 };
+static const symbol s_9[] = { 'i' };
+static const symbol s_10[] = { 'u' };
+static const symbol s_11[] = { 0xC3, 0xB6 };
+static const symbol s_12[] = { 0xC3, 0xBC };
+static const symbol s_13[] = { 0xC3, 0xBC };
+
+static const unsigned char a_23_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1C, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_23(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'b':
+                i = 0;
+                break;
+            case 'c':
+                i = 1;
+                break;
+            case 'd':
+                i = 2;
+                break;
+            case 0x9F:
+                if (n <= 1) break;
+                if (q[-2] != 0xC4) break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_23[i].s_size;
+    return a_23[i].result;
+}
+static const symbol s_14[] = { 'p' };
+static const symbol s_15[] = { 0xC3, 0xA7 };
+static const symbol s_16[] = { 't' };
+static const symbol s_17[] = { 'k' };
+
+static int r_check_vowel_harmony(struct SN_env * z) {
+    {   int m_test1 = z->l - z->c;
+        if (out_class_b_U(z, g_vowel_class, g_vowel, 97, 305, 1) < 0) return 0;
+        {   int m2 = z->l - z->c; (void)m2;
+            if (z->c <= z->lb || z->p[z->c - 1] != 'a') goto lab1;
+            z->c--;
+            if (out_class_b_U(z, g_vowel1_class, g_vowel1, 97, 305, 1) < 0) goto lab1;
+            goto lab0;
+        lab1:
+            z->c = z->l - m2;
+            if (z->c <= z->lb || z->p[z->c - 1] != 'e') goto lab2;
+            z->c--;
+            if (out_class_b_U(z, g_vowel2_class, g_vowel2, 101, 252, 1) < 0) goto lab2;
+            goto lab0;
+        lab2:
+            z->c = z->l - m2;
+            if (!(eq_s_b(z, 2, s_0))) goto lab3;
+            if (out_class_b_U(z, g_vowel3_class, g_vowel3, 97, 305, 1) < 0) goto lab3;
+            goto lab0;
+        lab3:
+            z->c = z->l - m2;
+            if (z->c <= z->lb || z->p[z->c - 1] != 'i') goto lab4;
+            z->c--;
+            if (out_class_b_U(z, g_vowel4_class, g_vowel4, 101, 105, 1) < 0) goto lab4;
+            goto lab0;
+        lab4:
+            z->c = z->l - m2;
+            if (z->c <= z->lb || z->p[z->c - 1] != 'o') goto lab5;
+            z->c--;
+            if (out_class_b_U(z, g_vowel5_class, g_vowel5, 111, 117, 1) < 0) goto lab5;
+            goto lab0;
+        lab5:
+            z->c = z->l - m2;
+            if (!(eq_s_b(z, 2, s_1))) goto lab6;
+            if (out_class_b_U(z, g_vowel6_class, g_vowel6, 246, 252, 1) < 0) goto lab6;
+            goto lab0;
+        lab6:
+            z->c = z->l - m2;
+            if (z->c <= z->lb || z->p[z->c - 1] != 'u') goto lab7;
+            z->c--;
+            if (out_class_b_U(z, g_vowel5_class, g_vowel5, 111, 117, 1) < 0) goto lab7;
+            goto lab0;
+        lab7:
+            z->c = z->l - m2;
+            if (!(eq_s_b(z, 2, s_2))) return 0;
+            if (out_class_b_U(z, g_vowel6_class, g_vowel6, 246, 252, 1) < 0) return 0;
+        }
+    lab0:
+        z->c = z->l - m_test1;
+    }
+    return 1;
+}
+
+static int r_mark_suffix_with_optional_n_consonant(struct SN_env * z) {
+    {   int m1 = z->l - z->c; (void)m1;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'n') goto lab1;
+        z->c--;
+        {   int m_test2 = z->l - z->c;
+            if (in_class_b_U(z, g_vowel_class, g_vowel, 97, 305, 0)) goto lab1;
+            z->c = z->l - m_test2;
+        }
+        goto lab0;
+    lab1:
+        z->c = z->l - m1;
+        {   int m3 = z->l - z->c; (void)m3;
+            {   int m_test4 = z->l - z->c;
+                if (z->c <= z->lb || z->p[z->c - 1] != 'n') goto lab2;
+                z->c--;
+                z->c = z->l - m_test4;
+            }
+            return 0;
+        lab2:
+            z->c = z->l - m3;
+        }
+        {   int m_test5 = z->l - z->c;
+            {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+                if (ret < 0) return 0;
+                z->c = ret;
+            }
+            if (in_class_b_U(z, g_vowel_class, g_vowel, 97, 305, 0)) return 0;
+            z->c = z->l - m_test5;
+        }
+    }
+lab0:
+    return 1;
+}
+
+static int r_mark_suffix_with_optional_y_consonant(struct SN_env * z) {
+    {   int m1 = z->l - z->c; (void)m1;
+        if (z->c <= z->lb || z->p[z->c - 1] != 'y') goto lab1;
+        z->c--;
+        {   int m_test2 = z->l - z->c;
+            if (in_class_b_U(z, g_vowel_class, g_vowel, 97, 305, 0)) goto lab1;
+            z->c = z->l - m_test2;
+        }
+        goto lab0;
+    lab1:
+        z->c = z->l - m1;
+        {   int m3 = z->l - z->c; (void)m3;
+            {   int m_test4 = z->l - z->c;
+                if (z->c <= z->lb || z->p[z->c - 1] != 'y') goto lab2;
+                z->c--;
+                z->c = z->l - m_test4;
+            }
+            return 0;
+        lab2:
+            z->c = z->l - m3;
+        }
+        {   int m_test5 = z->l - z->c;
+            {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+                if (ret < 0) return 0;
+                z->c = ret;
+            }
+            if (in_class_b_U(z, g_vowel_class, g_vowel, 97, 305, 0)) return 0;
+            z->c = z->l - m_test5;
+        }
+    }
+lab0:
+    return 1;
+}
+
+static int r_mark_possessives(struct SN_env * z) {
+    if (z->c <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((67133440 >> (z->p[z->c - 1] & 0x1f)) & 1)) return 0;
+    if (!(find_among_b_0(z))) return 0;
+    {   int m1 = z->l - z->c; (void)m1;
+        if (in_class_b_U(z, g_U_class, g_U, 105, 305, 0)) goto lab1;
+        {   int m_test2 = z->l - z->c;
+            if (out_class_b_U(z, g_vowel_class, g_vowel, 97, 305, 0)) goto lab1;
+            z->c = z->l - m_test2;
+        }
+        goto lab0;
+    lab1:
+        z->c = z->l - m1;
+        {   int m3 = z->l - z->c; (void)m3;
+            {   int m_test4 = z->l - z->c;
+                if (in_class_b_U(z, g_U_class, g_U, 105, 305, 0)) goto lab2;
+                z->c = z->l - m_test4;
+            }
+            return 0;
+        lab2:
+            z->c = z->l - m3;
+        }
+        {   int m_test5 = z->l - z->c;
+            {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+                if (ret < 0) return 0;
+                z->c = ret;
+            }
+            if (out_class_b_U(z, g_vowel_class, g_vowel, 97, 305, 0)) return 0;
+            z->c = z->l - m_test5;
+        }
+    }
+lab0:
+    return 1;
+}
+
+static int r_mark_sU(struct SN_env * z) {
+    {   int ret = r_check_vowel_harmony(z);
+        if (ret <= 0) return ret;
+    }
+    if (in_class_b_U(z, g_U_class, g_U, 105, 305, 0)) return 0;
+    {   int m1 = z->l - z->c; (void)m1;
+        if (z->c <= z->lb || z->p[z->c - 1] != 's') goto lab1;
+        z->c--;
+        {   int m_test2 = z->l - z->c;
+            if (in_class_b_U(z, g_vowel_class, g_vowel, 97, 305, 0)) goto lab1;
+            z->c = z->l - m_test2;
+        }
+        goto lab0;
+    lab1:
+        z->c = z->l - m1;
+        {   int m3 = z->l - z->c; (void)m3;
+            {   int m_test4 = z->l - z->c;
+                if (z->c <= z->lb || z->p[z->c - 1] != 's') goto lab2;
+                z->c--;
+                z->c = z->l - m_test4;
+            }
+            return 0;
+        lab2:
+            z->c = z->l - m3;
+        }
+        {   int m_test5 = z->l - z->c;
+            {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+                if (ret < 0) return 0;
+                z->c = ret;
+            }
+            if (in_class_b_U(z, g_vowel_class, g_vowel, 97, 305, 0)) return 0;
+            z->c = z->l - m_test5;
+        }
+    }
+lab0:
+    return 1;
+}
+
+static int r_mark_lArI(struct SN_env * z) {
+    if (z->c - 3 <= z->lb || (z->p[z->c - 1] != 105 && z->p[z->c - 1] != 177) || (z->p[z->c - 2] != 114 && z->p[z->c - 2] != 196)) return 0;
+    if (!(find_among_b_1(z))) return 0;
+    return 1;
+}
+
+static int r_mark_nUn(struct SN_env * z) {
+    {   int ret = r_check_vowel_harmony(z);
+        if (ret <= 0) return ret;
+    }
+    if (z->c - 1 <= z->lb || z->p[z->c - 1] != 110 || !((a_3_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) return 0;
+    if (!(find_among_b_3(z))) return 0;
+    {   int ret = r_mark_suffix_with_optional_n_consonant(z);
+        if (ret <= 0) return ret;
+    }
+    return 1;
+}
+
+static int r_mark_DA(struct SN_env * z) {
+    {   int ret = r_check_vowel_harmony(z);
+        if (ret <= 0) return ret;
+    }
+    if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 97 && z->p[z->c - 1] != 101) || (z->p[z->c - 2] != 100 && z->p[z->c - 2] != 116)) return 0;
+    if (!(find_among_b_6(z))) return 0;
+    return 1;
+}
+
+static int r_mark_ndA(struct SN_env * z) {
+    {   int ret = r_check_vowel_harmony(z);
+        if (ret <= 0) return ret;
+    }
+    if (z->c - 2 <= z->lb || (z->p[z->c - 1] != 97 && z->p[z->c - 1] != 101) || z->p[z->c - 2] != 100) return 0;
+    if (!(find_among_b_7(z))) return 0;
+    return 1;
+}
+
+static int r_mark_yUm(struct SN_env * z) {
+    {   int ret = r_check_vowel_harmony(z);
+        if (ret <= 0) return ret;
+    }
+    if (z->c - 1 <= z->lb || z->p[z->c - 1] != 109 || !((a_12_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) return 0;
+    if (!(find_among_b_12(z))) return 0;
+    {   int ret = r_mark_suffix_with_optional_y_consonant(z);
+        if (ret <= 0) return ret;
+    }
+    return 1;
+}
+
+static int r_mark_sUn(struct SN_env * z) {
+    {   int ret = r_check_vowel_harmony(z);
+        if (ret <= 0) return ret;
+    }
+    if (z->c - 2 <= z->lb || z->p[z->c - 1] != 110 || !((a_13_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) return 0;
+    if (!(find_among_b_13(z))) return 0;
+    return 1;
+}
+
+static int r_mark_yUz(struct SN_env * z) {
+    {   int ret = r_check_vowel_harmony(z);
+        if (ret <= 0) return ret;
+    }
+    if (z->c - 1 <= z->lb || z->p[z->c - 1] != 122 || !((a_14_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) return 0;
+    if (!(find_among_b_14(z))) return 0;
+    {   int ret = r_mark_suffix_with_optional_y_consonant(z);
+        if (ret <= 0) return ret;
+    }
+    return 1;
+}
+
+static int r_mark_sUnUz(struct SN_env * z) {
+    if (z->c - 4 <= z->lb || z->p[z->c - 1] != 122 || !((a_15_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) return 0;
+    if (!(find_among_b_15(z))) return 0;
+    return 1;
+}
+
+static int r_mark_lAr(struct SN_env * z) {
+    {   int ret = r_check_vowel_harmony(z);
+        if (ret <= 0) return ret;
+    }
+    if (z->c - 2 <= z->lb || z->p[z->c - 1] != 114 || (z->p[z->c - 2] != 97 && z->p[z->c - 2] != 101)) return 0;
+    if (!(find_among_b_16(z))) return 0;
+    return 1;
+}
+
+static int r_mark_DUr(struct SN_env * z) {
+    {   int ret = r_check_vowel_harmony(z);
+        if (ret <= 0) return ret;
+    }
+    if (z->c - 2 <= z->lb || z->p[z->c - 1] != 114 || !((a_18_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) return 0;
+    if (!(find_among_b_18(z))) return 0;
+    return 1;
+}
+
+static int r_mark_yDU(struct SN_env * z) {
+    {   int ret = r_check_vowel_harmony(z);
+        if (ret <= 0) return ret;
+    }
+    if (z->c - 1 <= z->lb || !((a_20_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || !((a_20_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) return 0;
+    if (!(find_among_b_20(z))) return 0;
+    {   int ret = r_mark_suffix_with_optional_y_consonant(z);
+        if (ret <= 0) return ret;
+    }
+    return 1;
+}
+
+static int r_mark_ysA(struct SN_env * z) {
+    if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((26658 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((524322 >> (z->p[z->c - 2] & 0x1f)) & 1)) return 0;
+    if (!(find_among_b_21(z))) return 0;
+    {   int ret = r_mark_suffix_with_optional_y_consonant(z);
+        if (ret <= 0) return ret;
+    }
+    return 1;
+}
+
+static int r_mark_ymUs_(struct SN_env * z) {
+    {   int ret = r_check_vowel_harmony(z);
+        if (ret <= 0) return ret;
+    }
+    if (z->c - 3 <= z->lb || z->p[z->c - 1] != 159 || z->p[z->c - 2] != 197) return 0;
+    if (!(find_among_b_22(z))) return 0;
+    {   int ret = r_mark_suffix_with_optional_y_consonant(z);
+        if (ret <= 0) return ret;
+    }
+    return 1;
+}
+
+static int r_stem_suffix_chain_before_ki(struct SN_env * z) {
+    z->ket = z->c;
+    if (!(eq_s_b(z, 2, s_3))) return 0;
+    {   int m1 = z->l - z->c; (void)m1;
+        {   int ret = r_mark_DA(z);
+            if (ret == 0) goto lab1;
+            if (ret < 0) return ret;
+        }
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        {   int m2 = z->l - z->c; (void)m2;
+            z->ket = z->c;
+            {   int m3 = z->l - z->c; (void)m3;
+                {   int ret = r_mark_lAr(z);
+                    if (ret == 0) goto lab4;
+                    if (ret < 0) return ret;
+                }
+                z->bra = z->c;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int m4 = z->l - z->c; (void)m4;
+                    {   int ret = r_stem_suffix_chain_before_ki(z);
+                        if (ret == 0) { z->c = z->l - m4; goto lab5; }
+                        if (ret < 0) return ret;
+                    }
+                lab5:
+                    ;
+                }
+                goto lab3;
+            lab4:
+                z->c = z->l - m3;
+                {   int ret = r_mark_possessives(z);
+                    if (ret == 0) { z->c = z->l - m2; goto lab2; }
+                    if (ret < 0) return ret;
+                }
+                z->bra = z->c;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int m5 = z->l - z->c; (void)m5;
+                    z->ket = z->c;
+                    {   int ret = r_mark_lAr(z);
+                        if (ret == 0) { z->c = z->l - m5; goto lab6; }
+                        if (ret < 0) return ret;
+                    }
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int ret = r_stem_suffix_chain_before_ki(z);
+                        if (ret == 0) { z->c = z->l - m5; goto lab6; }
+                        if (ret < 0) return ret;
+                    }
+                lab6:
+                    ;
+                }
+            }
+        lab3:
+        lab2:
+            ;
+        }
+        goto lab0;
+    lab1:
+        z->c = z->l - m1;
+        {   int ret = r_mark_nUn(z);
+            if (ret == 0) goto lab7;
+            if (ret < 0) return ret;
+        }
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        {   int m6 = z->l - z->c; (void)m6;
+            z->ket = z->c;
+            {   int m7 = z->l - z->c; (void)m7;
+                {   int ret = r_mark_lArI(z);
+                    if (ret == 0) goto lab10;
+                    if (ret < 0) return ret;
+                }
+                z->bra = z->c;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                goto lab9;
+            lab10:
+                z->c = z->l - m7;
+                z->ket = z->c;
+                {   int m8 = z->l - z->c; (void)m8;
+                    {   int ret = r_mark_possessives(z);
+                        if (ret == 0) goto lab13;
+                        if (ret < 0) return ret;
+                    }
+                    goto lab12;
+                lab13:
+                    z->c = z->l - m8;
+                    {   int ret = r_mark_sU(z);
+                        if (ret == 0) goto lab11;
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab12:
+                z->bra = z->c;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int m9 = z->l - z->c; (void)m9;
+                    z->ket = z->c;
+                    {   int ret = r_mark_lAr(z);
+                        if (ret == 0) { z->c = z->l - m9; goto lab14; }
+                        if (ret < 0) return ret;
+                    }
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int ret = r_stem_suffix_chain_before_ki(z);
+                        if (ret == 0) { z->c = z->l - m9; goto lab14; }
+                        if (ret < 0) return ret;
+                    }
+                lab14:
+                    ;
+                }
+                goto lab9;
+            lab11:
+                z->c = z->l - m7;
+                {   int ret = r_stem_suffix_chain_before_ki(z);
+                    if (ret == 0) { z->c = z->l - m6; goto lab8; }
+                    if (ret < 0) return ret;
+                }
+            }
+        lab9:
+        lab8:
+            ;
+        }
+        goto lab0;
+    lab7:
+        z->c = z->l - m1;
+        {   int ret = r_mark_ndA(z);
+            if (ret <= 0) return ret;
+        }
+        {   int m10 = z->l - z->c; (void)m10;
+            {   int ret = r_mark_lArI(z);
+                if (ret == 0) goto lab16;
+                if (ret < 0) return ret;
+            }
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            goto lab15;
+        lab16:
+            z->c = z->l - m10;
+            {   int ret = r_mark_sU(z);
+                if (ret == 0) goto lab17;
+                if (ret < 0) return ret;
+            }
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            {   int m11 = z->l - z->c; (void)m11;
+                z->ket = z->c;
+                {   int ret = r_mark_lAr(z);
+                    if (ret == 0) { z->c = z->l - m11; goto lab18; }
+                    if (ret < 0) return ret;
+                }
+                z->bra = z->c;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int ret = r_stem_suffix_chain_before_ki(z);
+                    if (ret == 0) { z->c = z->l - m11; goto lab18; }
+                    if (ret < 0) return ret;
+                }
+            lab18:
+                ;
+            }
+            goto lab15;
+        lab17:
+            z->c = z->l - m10;
+            {   int ret = r_stem_suffix_chain_before_ki(z);
+                if (ret <= 0) return ret;
+            }
+        }
+    lab15:
+        ;
+    }
+lab0:
+    return 1;
+}
+
+extern int turkish_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    {   int c_test1 = z->c;
+        {   int i; for (i = 2; i > 0; i--)
+            {                   {   
+                    int ret = out_class_scan_U(z, g_vowel_class, g_vowel_scan, g_vowel, 97, 305);
+                    if (ret < 0) return 0;
+                    z->c += ret;
+                }
+            }
+        }
+        z->c = c_test1;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m2 = z->l - z->c; (void)m2;
+        z->ket = z->c;
+        z->I[0] = 1;
+        {   int m3 = z->l - z->c; (void)m3;
+            {   int m4 = z->l - z->c; (void)m4;
+                {   int ret = r_mark_ymUs_(z);
+                    if (ret == 0) goto lab4;
+                    if (ret < 0) return ret;
+                }
+                goto lab3;
+            lab4:
+                z->c = z->l - m4;
+                {   int ret = r_mark_yDU(z);
+                    if (ret == 0) goto lab5;
+                    if (ret < 0) return ret;
+                }
+                goto lab3;
+            lab5:
+                z->c = z->l - m4;
+                {   int ret = r_mark_ysA(z);
+                    if (ret == 0) goto lab6;
+                    if (ret < 0) return ret;
+                }
+                goto lab3;
+            lab6:
+                z->c = z->l - m4;
+                if (!(eq_s_b(z, 3, s_4))) goto lab2;
+                {   int ret = r_mark_suffix_with_optional_y_consonant(z);
+                    if (ret == 0) goto lab2;
+                    if (ret < 0) return ret;
+                }
+            }
+        lab3:
+            goto lab1;
+        lab2:
+            z->c = z->l - m3;
+            if (z->c - 5 <= z->lb || (z->p[z->c - 1] != 97 && z->p[z->c - 1] != 101) || z->p[z->c - 2] != 110) goto lab7;
+            if (!(find_among_b_19(z))) goto lab7;
+            {   int m5 = z->l - z->c; (void)m5;
+                {   int ret = r_mark_sUnUz(z);
+                    if (ret == 0) goto lab9;
+                    if (ret < 0) return ret;
+                }
+                goto lab8;
+            lab9:
+                z->c = z->l - m5;
+                {   int ret = r_mark_lAr(z);
+                    if (ret == 0) goto lab10;
+                    if (ret < 0) return ret;
+                }
+                goto lab8;
+            lab10:
+                z->c = z->l - m5;
+                {   int ret = r_mark_yUm(z);
+                    if (ret == 0) goto lab11;
+                    if (ret < 0) return ret;
+                }
+                goto lab8;
+            lab11:
+                z->c = z->l - m5;
+                {   int ret = r_mark_sUn(z);
+                    if (ret == 0) goto lab12;
+                    if (ret < 0) return ret;
+                }
+                goto lab8;
+            lab12:
+                z->c = z->l - m5;
+                {   int ret = r_mark_yUz(z);
+                    if (ret == 0) goto lab13;
+                    if (ret < 0) return ret;
+                }
+                goto lab8;
+            lab13:
+                z->c = z->l - m5;
+            }
+        lab8:
+            {   int ret = r_mark_ymUs_(z);
+                if (ret == 0) goto lab7;
+                if (ret < 0) return ret;
+            }
+            goto lab1;
+        lab7:
+            z->c = z->l - m3;
+            {   int ret = r_mark_lAr(z);
+                if (ret == 0) goto lab14;
+                if (ret < 0) return ret;
+            }
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            {   int m6 = z->l - z->c; (void)m6;
+                z->ket = z->c;
+                {   int m7 = z->l - z->c; (void)m7;
+                    {   int ret = r_mark_DUr(z);
+                        if (ret == 0) goto lab17;
+                        if (ret < 0) return ret;
+                    }
+                    goto lab16;
+                lab17:
+                    z->c = z->l - m7;
+                    {   int ret = r_mark_yDU(z);
+                        if (ret == 0) goto lab18;
+                        if (ret < 0) return ret;
+                    }
+                    goto lab16;
+                lab18:
+                    z->c = z->l - m7;
+                    {   int ret = r_mark_ysA(z);
+                        if (ret == 0) goto lab19;
+                        if (ret < 0) return ret;
+                    }
+                    goto lab16;
+                lab19:
+                    z->c = z->l - m7;
+                    {   int ret = r_mark_ymUs_(z);
+                        if (ret == 0) { z->c = z->l - m6; goto lab15; }
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab16:
+            lab15:
+                ;
+            }
+            z->I[0] = 0;
+            goto lab1;
+        lab14:
+            z->c = z->l - m3;
+            {   int ret = r_check_vowel_harmony(z);
+                if (ret == 0) goto lab20;
+                if (ret < 0) return ret;
+            }
+            if (z->c - 2 <= z->lb || z->p[z->c - 1] != 122 || !((a_17_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) goto lab20;
+            if (!(find_among_b_17(z))) goto lab20;
+            {   int m8 = z->l - z->c; (void)m8;
+                {   int ret = r_mark_yDU(z);
+                    if (ret == 0) goto lab22;
+                    if (ret < 0) return ret;
+                }
+                goto lab21;
+            lab22:
+                z->c = z->l - m8;
+                {   int ret = r_mark_ysA(z);
+                    if (ret == 0) goto lab20;
+                    if (ret < 0) return ret;
+                }
+            }
+        lab21:
+            goto lab1;
+        lab20:
+            z->c = z->l - m3;
+            {   int m9 = z->l - z->c; (void)m9;
+                {   int ret = r_mark_sUnUz(z);
+                    if (ret == 0) goto lab25;
+                    if (ret < 0) return ret;
+                }
+                goto lab24;
+            lab25:
+                z->c = z->l - m9;
+                {   int ret = r_mark_yUz(z);
+                    if (ret == 0) goto lab26;
+                    if (ret < 0) return ret;
+                }
+                goto lab24;
+            lab26:
+                z->c = z->l - m9;
+                {   int ret = r_mark_sUn(z);
+                    if (ret == 0) goto lab27;
+                    if (ret < 0) return ret;
+                }
+                goto lab24;
+            lab27:
+                z->c = z->l - m9;
+                {   int ret = r_mark_yUm(z);
+                    if (ret == 0) goto lab23;
+                    if (ret < 0) return ret;
+                }
+            }
+        lab24:
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            {   int m10 = z->l - z->c; (void)m10;
+                z->ket = z->c;
+                {   int ret = r_mark_ymUs_(z);
+                    if (ret == 0) { z->c = z->l - m10; goto lab28; }
+                    if (ret < 0) return ret;
+                }
+            lab28:
+                ;
+            }
+            goto lab1;
+        lab23:
+            z->c = z->l - m3;
+            {   int ret = r_mark_DUr(z);
+                if (ret == 0) goto lab0;
+                if (ret < 0) return ret;
+            }
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            {   int m11 = z->l - z->c; (void)m11;
+                z->ket = z->c;
+                {   int m12 = z->l - z->c; (void)m12;
+                    {   int ret = r_mark_sUnUz(z);
+                        if (ret == 0) goto lab31;
+                        if (ret < 0) return ret;
+                    }
+                    goto lab30;
+                lab31:
+                    z->c = z->l - m12;
+                    {   int ret = r_mark_lAr(z);
+                        if (ret == 0) goto lab32;
+                        if (ret < 0) return ret;
+                    }
+                    goto lab30;
+                lab32:
+                    z->c = z->l - m12;
+                    {   int ret = r_mark_yUm(z);
+                        if (ret == 0) goto lab33;
+                        if (ret < 0) return ret;
+                    }
+                    goto lab30;
+                lab33:
+                    z->c = z->l - m12;
+                    {   int ret = r_mark_sUn(z);
+                        if (ret == 0) goto lab34;
+                        if (ret < 0) return ret;
+                    }
+                    goto lab30;
+                lab34:
+                    z->c = z->l - m12;
+                    {   int ret = r_mark_yUz(z);
+                        if (ret == 0) goto lab35;
+                        if (ret < 0) return ret;
+                    }
+                    goto lab30;
+                lab35:
+                    z->c = z->l - m12;
+                }
+            lab30:
+                {   int ret = r_mark_ymUs_(z);
+                    if (ret == 0) { z->c = z->l - m11; goto lab29; }
+                    if (ret < 0) return ret;
+                }
+            lab29:
+                ;
+            }
+        }
+    lab1:
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab0:
+        z->c = z->l - m2;
+    }
+    if (!(z->I[0])) return 0;
+    {   int m13 = z->l - z->c; (void)m13;
+        {   int m14 = z->l - z->c; (void)m14;
+            z->ket = z->c;
+            {   int ret = r_mark_lAr(z);
+                if (ret == 0) goto lab38;
+                if (ret < 0) return ret;
+            }
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            {   int m15 = z->l - z->c; (void)m15;
+                {   int ret = r_stem_suffix_chain_before_ki(z);
+                    if (ret == 0) { z->c = z->l - m15; goto lab39; }
+                    if (ret < 0) return ret;
+                }
+            lab39:
+                ;
+            }
+            goto lab37;
+        lab38:
+            z->c = z->l - m14;
+            z->ket = z->c;
+            {   int ret = r_check_vowel_harmony(z);
+                if (ret == 0) goto lab40;
+                if (ret < 0) return ret;
+            }
+            if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 97 && z->p[z->c - 1] != 101) || z->p[z->c - 2] != 99) goto lab40;
+            if (!(find_among_b_11(z))) goto lab40;
+            {   int ret = r_mark_suffix_with_optional_n_consonant(z);
+                if (ret == 0) goto lab40;
+                if (ret < 0) return ret;
+            }
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            {   int m16 = z->l - z->c; (void)m16;
+                {   int m17 = z->l - z->c; (void)m17;
+                    z->ket = z->c;
+                    {   int ret = r_mark_lArI(z);
+                        if (ret == 0) goto lab43;
+                        if (ret < 0) return ret;
+                    }
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab42;
+                lab43:
+                    z->c = z->l - m17;
+                    z->ket = z->c;
+                    {   int m18 = z->l - z->c; (void)m18;
+                        {   int ret = r_mark_possessives(z);
+                            if (ret == 0) goto lab46;
+                            if (ret < 0) return ret;
+                        }
+                        goto lab45;
+                    lab46:
+                        z->c = z->l - m18;
+                        {   int ret = r_mark_sU(z);
+                            if (ret == 0) goto lab44;
+                            if (ret < 0) return ret;
+                        }
+                    }
+                lab45:
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int m19 = z->l - z->c; (void)m19;
+                        z->ket = z->c;
+                        {   int ret = r_mark_lAr(z);
+                            if (ret == 0) { z->c = z->l - m19; goto lab47; }
+                            if (ret < 0) return ret;
+                        }
+                        z->bra = z->c;
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        {   int ret = r_stem_suffix_chain_before_ki(z);
+                            if (ret == 0) { z->c = z->l - m19; goto lab47; }
+                            if (ret < 0) return ret;
+                        }
+                    lab47:
+                        ;
+                    }
+                    goto lab42;
+                lab44:
+                    z->c = z->l - m17;
+                    z->ket = z->c;
+                    {   int ret = r_mark_lAr(z);
+                        if (ret == 0) { z->c = z->l - m16; goto lab41; }
+                        if (ret < 0) return ret;
+                    }
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int ret = r_stem_suffix_chain_before_ki(z);
+                        if (ret == 0) { z->c = z->l - m16; goto lab41; }
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab42:
+            lab41:
+                ;
+            }
+            goto lab37;
+        lab40:
+            z->c = z->l - m14;
+            z->ket = z->c;
+            {   int m20 = z->l - z->c; (void)m20;
+                {   int ret = r_mark_ndA(z);
+                    if (ret == 0) goto lab50;
+                    if (ret < 0) return ret;
+                }
+                goto lab49;
+            lab50:
+                z->c = z->l - m20;
+                {   int ret = r_check_vowel_harmony(z);
+                    if (ret == 0) goto lab48;
+                    if (ret < 0) return ret;
+                }
+                if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 97 && z->p[z->c - 1] != 101) || z->p[z->c - 2] != 110) goto lab48;
+                if (!(find_among_b_5(z))) goto lab48;
+            }
+        lab49:
+            {   int m21 = z->l - z->c; (void)m21;
+                {   int ret = r_mark_lArI(z);
+                    if (ret == 0) goto lab52;
+                    if (ret < 0) return ret;
+                }
+                z->bra = z->c;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                goto lab51;
+            lab52:
+                z->c = z->l - m21;
+                {   int ret = r_mark_sU(z);
+                    if (ret == 0) goto lab53;
+                    if (ret < 0) return ret;
+                }
+                z->bra = z->c;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int m22 = z->l - z->c; (void)m22;
+                    z->ket = z->c;
+                    {   int ret = r_mark_lAr(z);
+                        if (ret == 0) { z->c = z->l - m22; goto lab54; }
+                        if (ret < 0) return ret;
+                    }
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int ret = r_stem_suffix_chain_before_ki(z);
+                        if (ret == 0) { z->c = z->l - m22; goto lab54; }
+                        if (ret < 0) return ret;
+                    }
+                lab54:
+                    ;
+                }
+                goto lab51;
+            lab53:
+                z->c = z->l - m21;
+                {   int ret = r_stem_suffix_chain_before_ki(z);
+                    if (ret == 0) goto lab48;
+                    if (ret < 0) return ret;
+                }
+            }
+        lab51:
+            goto lab37;
+        lab48:
+            z->c = z->l - m14;
+            z->ket = z->c;
+            {   int m23 = z->l - z->c; (void)m23;
+                {   int ret = r_check_vowel_harmony(z);
+                    if (ret == 0) goto lab57;
+                    if (ret < 0) return ret;
+                }
+                if (z->c - 3 <= z->lb || z->p[z->c - 1] != 110 || (z->p[z->c - 2] != 97 && z->p[z->c - 2] != 101)) goto lab57;
+                if (!(find_among_b_9(z))) goto lab57;
+                goto lab56;
+            lab57:
+                z->c = z->l - m23;
+                {   int ret = r_check_vowel_harmony(z);
+                    if (ret == 0) goto lab55;
+                    if (ret < 0) return ret;
+                }
+                if (z->c - 1 <= z->lb || !((a_2_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || !((a_2_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) goto lab55;
+                if (!(find_among_b_2(z))) goto lab55;
+            }
+        lab56:
+            {   int m24 = z->l - z->c; (void)m24;
+                {   int ret = r_mark_sU(z);
+                    if (ret == 0) goto lab59;
+                    if (ret < 0) return ret;
+                }
+                z->bra = z->c;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int m25 = z->l - z->c; (void)m25;
+                    z->ket = z->c;
+                    {   int ret = r_mark_lAr(z);
+                        if (ret == 0) { z->c = z->l - m25; goto lab60; }
+                        if (ret < 0) return ret;
+                    }
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int ret = r_stem_suffix_chain_before_ki(z);
+                        if (ret == 0) { z->c = z->l - m25; goto lab60; }
+                        if (ret < 0) return ret;
+                    }
+                lab60:
+                    ;
+                }
+                goto lab58;
+            lab59:
+                z->c = z->l - m24;
+                {   int ret = r_mark_lArI(z);
+                    if (ret == 0) goto lab55;
+                    if (ret < 0) return ret;
+                }
+            }
+        lab58:
+            goto lab37;
+        lab55:
+            z->c = z->l - m14;
+            z->ket = z->c;
+            {   int ret = r_check_vowel_harmony(z);
+                if (ret == 0) goto lab61;
+                if (ret < 0) return ret;
+            }
+            if (z->c - 2 <= z->lb || z->p[z->c - 1] != 110 || (z->p[z->c - 2] != 97 && z->p[z->c - 2] != 101)) goto lab61;
+            if (!(find_among_b_8(z))) goto lab61;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            {   int m26 = z->l - z->c; (void)m26;
+                z->ket = z->c;
+                {   int m27 = z->l - z->c; (void)m27;
+                    {   int ret = r_mark_possessives(z);
+                        if (ret == 0) goto lab64;
+                        if (ret < 0) return ret;
+                    }
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int m28 = z->l - z->c; (void)m28;
+                        z->ket = z->c;
+                        {   int ret = r_mark_lAr(z);
+                            if (ret == 0) { z->c = z->l - m28; goto lab65; }
+                            if (ret < 0) return ret;
+                        }
+                        z->bra = z->c;
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        {   int ret = r_stem_suffix_chain_before_ki(z);
+                            if (ret == 0) { z->c = z->l - m28; goto lab65; }
+                            if (ret < 0) return ret;
+                        }
+                    lab65:
+                        ;
+                    }
+                    goto lab63;
+                lab64:
+                    z->c = z->l - m27;
+                    {   int ret = r_mark_lAr(z);
+                        if (ret == 0) goto lab66;
+                        if (ret < 0) return ret;
+                    }
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int m29 = z->l - z->c; (void)m29;
+                        {   int ret = r_stem_suffix_chain_before_ki(z);
+                            if (ret == 0) { z->c = z->l - m29; goto lab67; }
+                            if (ret < 0) return ret;
+                        }
+                    lab67:
+                        ;
+                    }
+                    goto lab63;
+                lab66:
+                    z->c = z->l - m27;
+                    {   int ret = r_stem_suffix_chain_before_ki(z);
+                        if (ret == 0) { z->c = z->l - m26; goto lab62; }
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab63:
+            lab62:
+                ;
+            }
+            goto lab37;
+        lab61:
+            z->c = z->l - m14;
+            z->ket = z->c;
+            {   int m30 = z->l - z->c; (void)m30;
+                {   int ret = r_mark_nUn(z);
+                    if (ret == 0) goto lab70;
+                    if (ret < 0) return ret;
+                }
+                goto lab69;
+            lab70:
+                z->c = z->l - m30;
+                {   int ret = r_check_vowel_harmony(z);
+                    if (ret == 0) goto lab68;
+                    if (ret < 0) return ret;
+                }
+                if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 97 && z->p[z->c - 1] != 101) || z->p[z->c - 2] != 108) goto lab68;
+                if (!(find_among_b_10(z))) goto lab68;
+                {   int ret = r_mark_suffix_with_optional_y_consonant(z);
+                    if (ret == 0) goto lab68;
+                    if (ret < 0) return ret;
+                }
+            }
+        lab69:
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            {   int m31 = z->l - z->c; (void)m31;
+                {   int m32 = z->l - z->c; (void)m32;
+                    z->ket = z->c;
+                    {   int ret = r_mark_lAr(z);
+                        if (ret == 0) goto lab73;
+                        if (ret < 0) return ret;
+                    }
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int ret = r_stem_suffix_chain_before_ki(z);
+                        if (ret == 0) goto lab73;
+                        if (ret < 0) return ret;
+                    }
+                    goto lab72;
+                lab73:
+                    z->c = z->l - m32;
+                    z->ket = z->c;
+                    {   int m33 = z->l - z->c; (void)m33;
+                        {   int ret = r_mark_possessives(z);
+                            if (ret == 0) goto lab76;
+                            if (ret < 0) return ret;
+                        }
+                        goto lab75;
+                    lab76:
+                        z->c = z->l - m33;
+                        {   int ret = r_mark_sU(z);
+                            if (ret == 0) goto lab74;
+                            if (ret < 0) return ret;
+                        }
+                    }
+                lab75:
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int m34 = z->l - z->c; (void)m34;
+                        z->ket = z->c;
+                        {   int ret = r_mark_lAr(z);
+                            if (ret == 0) { z->c = z->l - m34; goto lab77; }
+                            if (ret < 0) return ret;
+                        }
+                        z->bra = z->c;
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        {   int ret = r_stem_suffix_chain_before_ki(z);
+                            if (ret == 0) { z->c = z->l - m34; goto lab77; }
+                            if (ret < 0) return ret;
+                        }
+                    lab77:
+                        ;
+                    }
+                    goto lab72;
+                lab74:
+                    z->c = z->l - m32;
+                    {   int ret = r_stem_suffix_chain_before_ki(z);
+                        if (ret == 0) { z->c = z->l - m31; goto lab71; }
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab72:
+            lab71:
+                ;
+            }
+            goto lab37;
+        lab68:
+            z->c = z->l - m14;
+            z->ket = z->c;
+            {   int ret = r_mark_lArI(z);
+                if (ret == 0) goto lab78;
+                if (ret < 0) return ret;
+            }
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            goto lab37;
+        lab78:
+            z->c = z->l - m14;
+            {   int ret = r_stem_suffix_chain_before_ki(z);
+                if (ret == 0) goto lab79;
+                if (ret < 0) return ret;
+            }
+            goto lab37;
+        lab79:
+            z->c = z->l - m14;
+            z->ket = z->c;
+            {   int m35 = z->l - z->c; (void)m35;
+                {   int ret = r_mark_DA(z);
+                    if (ret == 0) goto lab82;
+                    if (ret < 0) return ret;
+                }
+                goto lab81;
+            lab82:
+                z->c = z->l - m35;
+                {   int ret = r_check_vowel_harmony(z);
+                    if (ret == 0) goto lab83;
+                    if (ret < 0) return ret;
+                }
+                if (in_class_b_U(z, g_U_class, g_U, 105, 305, 0)) goto lab83;
+                {   int ret = r_mark_suffix_with_optional_y_consonant(z);
+                    if (ret == 0) goto lab83;
+                    if (ret < 0) return ret;
+                }
+                goto lab81;
+            lab83:
+                z->c = z->l - m35;
+                {   int ret = r_check_vowel_harmony(z);
+                    if (ret == 0) goto lab80;
+                    if (ret < 0) return ret;
+                }
+                if (z->c <= z->lb || (z->p[z->c - 1] != 97 && z->p[z->c - 1] != 101)) goto lab80;
+                if (!(find_among_b_4(z))) goto lab80;
+                {   int ret = r_mark_suffix_with_optional_y_consonant(z);
+                    if (ret == 0) goto lab80;
+                    if (ret < 0) return ret;
+                }
+            }
+        lab81:
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            {   int m36 = z->l - z->c; (void)m36;
+                z->ket = z->c;
+                {   int m37 = z->l - z->c; (void)m37;
+                    {   int ret = r_mark_possessives(z);
+                        if (ret == 0) goto lab86;
+                        if (ret < 0) return ret;
+                    }
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int m38 = z->l - z->c; (void)m38;
+                        z->ket = z->c;
+                        {   int ret = r_mark_lAr(z);
+                            if (ret == 0) { z->c = z->l - m38; goto lab87; }
+                            if (ret < 0) return ret;
+                        }
+                    lab87:
+                        ;
+                    }
+                    goto lab85;
+                lab86:
+                    z->c = z->l - m37;
+                    {   int ret = r_mark_lAr(z);
+                        if (ret == 0) { z->c = z->l - m36; goto lab84; }
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab85:
+                z->bra = z->c;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                z->ket = z->c;
+                {   int ret = r_stem_suffix_chain_before_ki(z);
+                    if (ret == 0) { z->c = z->l - m36; goto lab84; }
+                    if (ret < 0) return ret;
+                }
+            lab84:
+                ;
+            }
+            goto lab37;
+        lab80:
+            z->c = z->l - m14;
+            z->ket = z->c;
+            {   int m39 = z->l - z->c; (void)m39;
+                {   int ret = r_mark_possessives(z);
+                    if (ret == 0) goto lab89;
+                    if (ret < 0) return ret;
+                }
+                goto lab88;
+            lab89:
+                z->c = z->l - m39;
+                {   int ret = r_mark_sU(z);
+                    if (ret == 0) goto lab36;
+                    if (ret < 0) return ret;
+                }
+            }
+        lab88:
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            {   int m40 = z->l - z->c; (void)m40;
+                z->ket = z->c;
+                {   int ret = r_mark_lAr(z);
+                    if (ret == 0) { z->c = z->l - m40; goto lab90; }
+                    if (ret < 0) return ret;
+                }
+                z->bra = z->c;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                {   int ret = r_stem_suffix_chain_before_ki(z);
+                    if (ret == 0) { z->c = z->l - m40; goto lab90; }
+                    if (ret < 0) return ret;
+                }
+            lab90:
+                ;
+            }
+        }
+    lab37:
+    lab36:
+        z->c = z->l - m13;
+    }
+    z->c = z->lb;
+    z->lb = z->c; z->c = z->l;
+
+    {   int m41 = z->l - z->c; (void)m41;
+        if (!(eq_s_b(z, 2, s_5))) goto lab91;
+        {   int m42 = z->l - z->c; (void)m42;
+            if (!(eq_s_b(z, 3, s_6))) { z->c = z->l - m42; goto lab92; }
+        lab92:
+            ;
+        }
+        if (z->c > z->lb) goto lab91;
+        return 0;
+    lab91:
+        z->c = z->l - m41;
+    }
+    {   int m43 = z->l - z->c; (void)m43;
+        {   int m_test44 = z->l - z->c;
+            {   int m45 = z->l - z->c; (void)m45;
+                if (z->c <= z->lb || z->p[z->c - 1] != 'd') goto lab95;
+                z->c--;
+                goto lab94;
+            lab95:
+                z->c = z->l - m45;
+                if (z->c <= z->lb || z->p[z->c - 1] != 'g') goto lab93;
+                z->c--;
+            }
+        lab94:
+            z->c = z->l - m_test44;
+        }
+        {   int m46 = z->l - z->c; (void)m46;
+            {   int m_test47 = z->l - z->c;
+                if (out_class_b_U(z, g_vowel_class, g_vowel, 97, 305, 1) < 0) goto lab97;
+                {   int m48 = z->l - z->c; (void)m48;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'a') goto lab99;
+                    z->c--;
+                    goto lab98;
+                lab99:
+                    z->c = z->l - m48;
+                    if (!(eq_s_b(z, 2, s_7))) goto lab97;
+                }
+            lab98:
+                z->c = z->l - m_test47;
+            }
+            {   int ret;
+                {   int saved_c = z->c;
+                    ret = insert_s(z, z->c, z->c, 2, s_8);
+                    z->c = saved_c;
+                }
+                if (ret < 0) return ret;
+            }
+            goto lab96;
+        lab97:
+            z->c = z->l - m46;
+            {   int m_test49 = z->l - z->c;
+                if (out_class_b_U(z, g_vowel_class, g_vowel, 97, 305, 1) < 0) goto lab100;
+                {   int m50 = z->l - z->c; (void)m50;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'e') goto lab102;
+                    z->c--;
+                    goto lab101;
+                lab102:
+                    z->c = z->l - m50;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'i') goto lab100;
+                    z->c--;
+                }
+            lab101:
+                z->c = z->l - m_test49;
+            }
+            {   int ret;
+                {   int saved_c = z->c;
+                    ret = insert_s(z, z->c, z->c, 1, s_9);
+                    z->c = saved_c;
+                }
+                if (ret < 0) return ret;
+            }
+            goto lab96;
+        lab100:
+            z->c = z->l - m46;
+            {   int m_test51 = z->l - z->c;
+                if (out_class_b_U(z, g_vowel_class, g_vowel, 97, 305, 1) < 0) goto lab103;
+                {   int m52 = z->l - z->c; (void)m52;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'o') goto lab105;
+                    z->c--;
+                    goto lab104;
+                lab105:
+                    z->c = z->l - m52;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'u') goto lab103;
+                    z->c--;
+                }
+            lab104:
+                z->c = z->l - m_test51;
+            }
+            {   int ret;
+                {   int saved_c = z->c;
+                    ret = insert_s(z, z->c, z->c, 1, s_10);
+                    z->c = saved_c;
+                }
+                if (ret < 0) return ret;
+            }
+            goto lab96;
+        lab103:
+            z->c = z->l - m46;
+            {   int m_test53 = z->l - z->c;
+                if (out_class_b_U(z, g_vowel_class, g_vowel, 97, 305, 1) < 0) goto lab93;
+                {   int m54 = z->l - z->c; (void)m54;
+                    if (!(eq_s_b(z, 2, s_11))) goto lab107;
+                    goto lab106;
+                lab107:
+                    z->c = z->l - m54;
+                    if (!(eq_s_b(z, 2, s_12))) goto lab93;
+                }
+            lab106:
+                z->c = z->l - m_test53;
+            }
+            {   int ret;
+                {   int saved_c = z->c;
+                    ret = insert_s(z, z->c, z->c, 2, s_13);
+                    z->c = saved_c;
+                }
+                if (ret < 0) return ret;
+            }
+        }
+    lab96:
+    lab93:
+        z->c = z->l - m43;
+    }
+    {   int m55 = z->l - z->c; (void)m55;
+        z->ket = z->c;
+        if (z->c <= z->lb || !((a_23_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1)) goto lab108;
+        among_var = find_among_b_23(z);
+        if (!(among_var)) goto lab108;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 1, s_14);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 2, s_15);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 1, s_16);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                {   int ret = slice_from_s(z, 1, s_17);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab108:
+        z->c = z->l - m55;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * turkish_UTF_8_create_env(void) { return SN_create_env(0, 1); }
+
+extern void turkish_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
@@ -0,0 +1,2895 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int yiddish_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * yiddish_UTF_8_create_env(void);
+extern void yiddish_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[8] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 3 },
+{ 0, 2, -1, 4 },
+{ 0, 2, -1, 5 },
+{ 0, 2, -1, 6 },
+{ 0, 2, -1, 7 },
+{ 0, 2, -1, 8 }
+};
+
+
+static const struct among a_1[40] =
+{
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 7, 1 },
+{ 0, 14, 8, 1 },
+{ 0, 12, 7, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, 11, 1 },
+{ 0, 10, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 14, -1, 1 },
+{ 0, 12, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 10, 31, 1 },
+{ 0, 10, 31, 1 },
+{ 0, 16, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 14, 35, 1 },
+{ 0, 10, 35, 1 },
+{ 0, 10, 35, 1 },
+{ 0, 4, -1, 1 }
+};
+
+
+static const struct among a_2[4] =
+{
+{ 0, 6, -1, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 6, -1, -1 }
+};
+
+
+static const struct among a_3[26] =
+{
+{ 0, 8, -1, 9 },
+{ 0, 6, -1, 10 },
+{ 0, 8, 1, 7 },
+{ 0, 8, 1, 15 },
+{ 0, 6, -1, 23 },
+{ 0, 8, -1, 12 },
+{ 0, 8, -1, 1 },
+{ 0, 8, -1, 18 },
+{ 0, 10, -1, 21 },
+{ 0, 10, -1, 20 },
+{ 0, 6, -1, 22 },
+{ 0, 8, -1, 16 },
+{ 0, 6, -1, 6 },
+{ 0, 6, -1, 4 },
+{ 0, 6, -1, 8 },
+{ 0, 6, -1, 3 },
+{ 0, 8, -1, 14 },
+{ 0, 6, -1, 2 },
+{ 0, 8, -1, 25 },
+{ 0, 6, -1, 5 },
+{ 0, 8, -1, 13 },
+{ 0, 6, -1, 11 },
+{ 0, 10, -1, 19 },
+{ 0, 12, -1, 24 },
+{ 0, 8, -1, 26 },
+{ 0, 8, -1, 17 }
+};
+
+
+static const struct among a_4[79] =
+{
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 10, 2, 31 },
+{ 0, 4, 2, 1 },
+{ 0, 6, 4, 33 },
+{ 0, 4, 2, 1 },
+{ 0, 8, 2, 1 },
+{ 0, 6, 2, 1 },
+{ 0, 6, 2, 1 },
+{ 0, 8, 9, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 8, 11, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 8, 15, 3 },
+{ 0, 10, 16, 4 },
+{ 0, 2, -1, 1 },
+{ 0, 10, 18, 14 },
+{ 0, 8, 18, 15 },
+{ 0, 10, 20, 12 },
+{ 0, 10, 20, 7 },
+{ 0, 8, 18, 27 },
+{ 0, 10, 18, 17 },
+{ 0, 10, 18, 22 },
+{ 0, 12, 18, 25 },
+{ 0, 12, 18, 24 },
+{ 0, 8, 18, 26 },
+{ 0, 10, 18, 20 },
+{ 0, 8, 18, 11 },
+{ 0, 4, 18, 4 },
+{ 0, 10, 31, 9 },
+{ 0, 10, 31, 13 },
+{ 0, 10, 31, 8 },
+{ 0, 10, 31, 19 },
+{ 0, 6, 31, 1 },
+{ 0, 8, 36, 1 },
+{ 0, 6, 31, 1 },
+{ 0, 10, 18, 10 },
+{ 0, 10, 18, 18 },
+{ 0, 10, 18, 16 },
+{ 0, 4, 18, 1 },
+{ 0, 12, 42, 5 },
+{ 0, 8, 42, 1 },
+{ 0, 10, 42, 6 },
+{ 0, 10, 42, 1 },
+{ 0, 12, 42, 29 },
+{ 0, 12, 18, 23 },
+{ 0, 14, 18, 28 },
+{ 0, 10, 18, 30 },
+{ 0, 10, 18, 21 },
+{ 0, 6, 18, 5 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 53, 4 },
+{ 0, 6, 54, 1 },
+{ 0, 4, 53, 1 },
+{ 0, 6, 56, 4 },
+{ 0, 6, 56, 3 },
+{ 0, 4, 53, 1 },
+{ 0, 6, 59, 2 },
+{ 0, 8, 59, 1 },
+{ 0, 6, 53, 1 },
+{ 0, 10, 62, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 64, 4 },
+{ 0, 6, 65, 1 },
+{ 0, 6, 65, 1 },
+{ 0, 4, 64, -1 },
+{ 0, 6, 64, 1 },
+{ 0, 6, 64, 3 },
+{ 0, 8, 70, 4 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 72, 4 },
+{ 0, 8, 73, 1 },
+{ 0, 8, 73, 1 },
+{ 0, 8, 72, 3 },
+{ 0, 10, 76, 4 },
+{ 0, 4, -1, 32 }
+};
+
+
+static const struct among a_5[6] =
+{
+{ 0, 6, -1, 1 },
+{ 0, 8, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 8, 3, 1 },
+{ 0, 2, -1, 2 }
+};
+
+
+static const struct among a_6[9] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 1, 1 },
+{ 0, 8, 2, 1 },
+{ 0, 10, 3, 1 },
+{ 0, 8, 1, -1 },
+{ 0, 8, 1, -1 },
+{ 0, 6, 1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+static const unsigned char g_niked_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_niked[] = { 255, 155, 6 };
+
+static const unsigned char g_vowel_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_vowel[] = { 33, 2, 4, 0, 6 };
+
+static const unsigned char g_consonant_class[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+};
+
+static const unsigned char g_consonant[] = { 239, 254, 253, 131 };
+
+
+static const unsigned char a_0_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x20, 0xA6, 0x28, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[0] != 0xD7) break;
+        if (n <= 1) break;
+        switch (q[1]) {
+            case 0x95:
+                if (n <= 2) break;
+                if (q[2] != 0xD7) break;
+                if (n <= 3) break;
+                switch (q[3]) {
+                    case 0x95:
+                        i = 0;
+                        break;
+                    case 0x99:
+                        i = 1;
+                        break;
+                }
+                break;
+            case 0x99:
+                if (n <= 2) break;
+                if (q[2] != 0xD7) break;
+                if (n <= 3) break;
+                if (q[3] != 0x99) break;
+                i = 2;
+                break;
+            case 0x9A:
+                i = 3;
+                break;
+            case 0x9D:
+                i = 4;
+                break;
+            case 0x9F:
+                i = 5;
+                break;
+            case 0xA3:
+                i = 6;
+                break;
+            case 0xA5:
+                i = 7;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_0[i].s_size;
+    return a_0[i].result;
+}
+static const symbol s_0[] = { 0xD6, 0xBC };
+static const symbol s_1[] = { 0xD7, 0xB0 };
+static const symbol s_2[] = { 0xD6, 0xB4 };
+static const symbol s_3[] = { 0xD7, 0xB1 };
+static const symbol s_4[] = { 0xD6, 0xB4 };
+static const symbol s_5[] = { 0xD7, 0xB2 };
+static const symbol s_6[] = { 0xD7, 0x9B };
+static const symbol s_7[] = { 0xD7, 0x9E };
+static const symbol s_8[] = { 0xD7, 0xA0 };
+static const symbol s_9[] = { 0xD7, 0xA4 };
+static const symbol s_10[] = { 0xD7, 0xA6 };
+static const symbol s_11[] = { 0xD7, 0x92, 0xD7, 0xA2 };
+static const symbol s_12[] = { 0xD7, 0x9C, 0xD7, 0x98 };
+static const symbol s_13[] = { 0xD7, 0x91, 0xD7, 0xA0 };
+static const symbol s_14[] = { 'G', 'E' };
+
+static const unsigned char a_1_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x39, 0x2, 0x95, 0x1, 0x7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[0] != 0xD7) break;
+        if (n <= 1) break;
+        switch (q[1]) {
+            case 0x90:
+                if (n <= 2) break;
+                if (q[2] != 0xD7) break;
+                if (n <= 3) break;
+                switch (q[3]) {
+                    case 0x93:
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        if (q[5] != 0x95) break;
+                        if (n <= 6) break;
+                        if (q[6] != 0xD7) break;
+                        if (n <= 7) break;
+                        if (q[7] != 0xA8) break;
+                        if (n <= 8) break;
+                        if (q[8] != 0xD7) break;
+                        if (n <= 9) break;
+                        if (q[9] != 0x9B) break;
+                        i = 0;
+                        break;
+                    case 0x94:
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        switch (q[5]) {
+                            case 0x99:
+                                if (n <= 6) break;
+                                if (q[6] != 0xD7) break;
+                                if (n <= 7) break;
+                                if (q[7] != 0xA0) break;
+                                i = 1;
+                                break;
+                            case 0xA2:
+                                if (n <= 6) break;
+                                if (q[6] != 0xD7) break;
+                                if (n <= 7) break;
+                                if (q[7] != 0xA8) break;
+                                i = 2;
+                                break;
+                            case 0xB2:
+                                if (n <= 6) break;
+                                if (q[6] != 0xD7) break;
+                                if (n <= 7) break;
+                                if (q[7] != 0x9E) break;
+                                i = 3;
+                                break;
+                        }
+                        break;
+                    case 0x95:
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        switch (q[5]) {
+                            case 0x9E:
+                                i = 4;
+                                break;
+                            case 0xA0:
+                                if (n <= 6) break;
+                                if (q[6] != 0xD7) break;
+                                if (n <= 7) break;
+                                if (q[7] != 0x98) break;
+                                if (n <= 8) break;
+                                if (q[8] != 0xD7) break;
+                                if (n <= 9) break;
+                                if (q[9] != 0xA2) break;
+                                if (n <= 10) break;
+                                if (q[10] != 0xD7) break;
+                                if (n <= 11) break;
+                                if (q[11] != 0xA8) break;
+                                i = 5;
+                                break;
+                        }
+                        break;
+                    case 0x99:
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        if (q[5] != 0x91) break;
+                        if (n <= 6) break;
+                        if (q[6] != 0xD7) break;
+                        if (n <= 7) break;
+                        if (q[7] != 0xA2) break;
+                        if (n <= 8) break;
+                        if (q[8] != 0xD7) break;
+                        if (n <= 9) break;
+                        if (q[9] != 0xA8) break;
+                        i = 6;
+                        break;
+                    case 0xA0:
+                        i = 7;
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        switch (q[5]) {
+                            case 0x98:
+                                i = 8;
+                                if (n <= 6) break;
+                                if (q[6] != 0xD7) break;
+                                if (n <= 7) break;
+                                if (q[7] != 0xA7) break;
+                                if (n <= 8) break;
+                                if (q[8] != 0xD7) break;
+                                if (n <= 9) break;
+                                if (q[9] != 0xA2) break;
+                                if (n <= 10) break;
+                                if (q[10] != 0xD7) break;
+                                if (n <= 11) break;
+                                if (q[11] != 0x92) break;
+                                if (n <= 12) break;
+                                if (q[12] != 0xD7) break;
+                                if (n <= 13) break;
+                                if (q[13] != 0xA0) break;
+                                i = 9;
+                                break;
+                            case 0x99:
+                                if (n <= 6) break;
+                                if (q[6] != 0xD7) break;
+                                if (n <= 7) break;
+                                if (q[7] != 0x93) break;
+                                if (n <= 8) break;
+                                if (q[8] != 0xD7) break;
+                                if (n <= 9) break;
+                                if (q[9] != 0xA2) break;
+                                if (n <= 10) break;
+                                if (q[10] != 0xD7) break;
+                                if (n <= 11) break;
+                                if (q[11] != 0xA8) break;
+                                i = 10;
+                                break;
+                        }
+                        break;
+                    case 0xA4:
+                        i = 11;
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        if (q[5] != 0x99) break;
+                        if (n <= 6) break;
+                        if (q[6] != 0xD7) break;
+                        if (n <= 7) break;
+                        if (q[7] != 0xA8) break;
+                        i = 12;
+                        break;
+                    case 0xA7:
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        if (q[5] != 0xA2) break;
+                        if (n <= 6) break;
+                        if (q[6] != 0xD7) break;
+                        if (n <= 7) break;
+                        if (q[7] != 0x92) break;
+                        if (n <= 8) break;
+                        if (q[8] != 0xD7) break;
+                        if (n <= 9) break;
+                        if (q[9] != 0xA0) break;
+                        i = 13;
+                        break;
+                    case 0xA8:
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        switch (q[5]) {
+                            case 0x90:
+                                if (n <= 6) break;
+                                if (q[6] != 0xD7) break;
+                                if (n <= 7) break;
+                                if (q[7] != 0xA4) break;
+                                i = 14;
+                                break;
+                            case 0x95:
+                                if (n <= 6) break;
+                                if (q[6] != 0xD7) break;
+                                if (n <= 7) break;
+                                switch (q[7]) {
+                                    case 0x9E:
+                                        i = 15;
+                                        break;
+                                    case 0xA0:
+                                        if (n <= 8) break;
+                                        if (q[8] != 0xD7) break;
+                                        if (n <= 9) break;
+                                        if (q[9] != 0x98) break;
+                                        if (n <= 10) break;
+                                        if (q[10] != 0xD7) break;
+                                        if (n <= 11) break;
+                                        if (q[11] != 0xA2) break;
+                                        if (n <= 12) break;
+                                        if (q[12] != 0xD7) break;
+                                        if (n <= 13) break;
+                                        if (q[13] != 0xA8) break;
+                                        i = 16;
+                                        break;
+                                }
+                                break;
+                            case 0x99:
+                                if (n <= 6) break;
+                                if (q[6] != 0xD7) break;
+                                if (n <= 7) break;
+                                if (q[7] != 0x91) break;
+                                if (n <= 8) break;
+                                if (q[8] != 0xD7) break;
+                                if (n <= 9) break;
+                                if (q[9] != 0xA2) break;
+                                if (n <= 10) break;
+                                if (q[10] != 0xD7) break;
+                                if (n <= 11) break;
+                                if (q[11] != 0xA8) break;
+                                i = 17;
+                                break;
+                            case 0xB1:
+                                if (n <= 6) break;
+                                if (q[6] != 0xD7) break;
+                                if (n <= 7) break;
+                                switch (q[7]) {
+                                    case 0xA1:
+                                        i = 18;
+                                        break;
+                                    case 0xA4:
+                                        i = 19;
+                                        break;
+                                }
+                                break;
+                            case 0xB2:
+                                if (n <= 6) break;
+                                if (q[6] != 0xD7) break;
+                                if (n <= 7) break;
+                                if (q[7] != 0xA0) break;
+                                i = 20;
+                                break;
+                        }
+                        break;
+                    case 0xB0:
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        if (q[5] != 0xA2) break;
+                        if (n <= 6) break;
+                        if (q[6] != 0xD7) break;
+                        if (n <= 7) break;
+                        if (q[7] != 0xA7) break;
+                        i = 21;
+                        break;
+                    case 0xB1:
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        switch (q[5]) {
+                            case 0xA1:
+                                i = 22;
+                                break;
+                            case 0xA4:
+                                i = 23;
+                                break;
+                        }
+                        break;
+                    case 0xB2:
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        if (q[5] != 0xA0) break;
+                        i = 24;
+                        break;
+                }
+                break;
+            case 0x91:
+                if (n <= 2) break;
+                if (q[2] != 0xD7) break;
+                if (n <= 3) break;
+                switch (q[3]) {
+                    case 0x90:
+                        i = 25;
+                        break;
+                    case 0xB2:
+                        i = 26;
+                        break;
+                }
+                break;
+            case 0x93:
+                if (n <= 2) break;
+                if (q[2] != 0xD7) break;
+                if (n <= 3) break;
+                switch (q[3]) {
+                    case 0x95:
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        if (q[5] != 0xA8) break;
+                        if (n <= 6) break;
+                        if (q[6] != 0xD7) break;
+                        if (n <= 7) break;
+                        if (q[7] != 0x9B) break;
+                        i = 27;
+                        break;
+                    case 0xA2:
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        if (q[5] != 0xA8) break;
+                        i = 28;
+                        break;
+                }
+                break;
+            case 0x9E:
+                if (n <= 2) break;
+                if (q[2] != 0xD7) break;
+                if (n <= 3) break;
+                if (q[3] != 0x99) break;
+                if (n <= 4) break;
+                if (q[4] != 0xD7) break;
+                if (n <= 5) break;
+                if (q[5] != 0x98) break;
+                i = 29;
+                break;
+            case 0xA0:
+                if (n <= 2) break;
+                if (q[2] != 0xD7) break;
+                if (n <= 3) break;
+                if (q[3] != 0x90) break;
+                if (n <= 4) break;
+                if (q[4] != 0xD7) break;
+                if (n <= 5) break;
+                if (q[5] != 0x9B) break;
+                i = 30;
+                break;
+            case 0xA4:
+                if (n <= 2) break;
+                if (q[2] != 0xD7) break;
+                if (n <= 3) break;
+                switch (q[3]) {
+                    case 0x90:
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        if (q[5] != 0xA8) break;
+                        i = 31;
+                        if (n <= 6) break;
+                        if (q[6] != 0xD7) break;
+                        if (n <= 7) break;
+                        switch (q[7]) {
+                            case 0x91:
+                                if (n <= 8) break;
+                                if (q[8] != 0xD7) break;
+                                if (n <= 9) break;
+                                if (q[9] != 0xB2) break;
+                                i = 32;
+                                break;
+                            case 0xB1:
+                                if (n <= 8) break;
+                                if (q[8] != 0xD7) break;
+                                if (n <= 9) break;
+                                if (q[9] != 0xA1) break;
+                                i = 33;
+                                break;
+                        }
+                        break;
+                    case 0x95:
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        if (q[5] != 0xA0) break;
+                        if (n <= 6) break;
+                        if (q[6] != 0xD7) break;
+                        if (n <= 7) break;
+                        if (q[7] != 0x90) break;
+                        if (n <= 8) break;
+                        if (q[8] != 0xD7) break;
+                        if (n <= 9) break;
+                        if (q[9] != 0xA0) break;
+                        if (n <= 10) break;
+                        if (q[10] != 0xD7) break;
+                        if (n <= 11) break;
+                        if (q[11] != 0x93) break;
+                        if (n <= 12) break;
+                        if (q[12] != 0xD7) break;
+                        if (n <= 13) break;
+                        if (q[13] != 0xA2) break;
+                        if (n <= 14) break;
+                        if (q[14] != 0xD7) break;
+                        if (n <= 15) break;
+                        if (q[15] != 0xA8) break;
+                        i = 34;
+                        break;
+                }
+                break;
+            case 0xA6:
+                if (n <= 2) break;
+                if (q[2] != 0xD7) break;
+                if (n <= 3) break;
+                switch (q[3]) {
+                    case 0x95:
+                        i = 35;
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        switch (q[5]) {
+                            case 0x96:
+                                if (n <= 6) break;
+                                if (q[6] != 0xD7) break;
+                                if (n <= 7) break;
+                                if (q[7] != 0x90) break;
+                                if (n <= 8) break;
+                                if (q[8] != 0xD7) break;
+                                if (n <= 9) break;
+                                if (q[9] != 0x9E) break;
+                                if (n <= 10) break;
+                                if (q[10] != 0xD7) break;
+                                if (n <= 11) break;
+                                if (q[11] != 0xA2) break;
+                                if (n <= 12) break;
+                                if (q[12] != 0xD7) break;
+                                if (n <= 13) break;
+                                if (q[13] != 0xA0) break;
+                                i = 36;
+                                break;
+                            case 0xA0:
+                                if (n <= 6) break;
+                                if (q[6] != 0xD7) break;
+                                if (n <= 7) break;
+                                if (q[7] != 0xB1) break;
+                                if (n <= 8) break;
+                                if (q[8] != 0xD7) break;
+                                if (n <= 9) break;
+                                if (q[9] != 0xA4) break;
+                                i = 37;
+                                break;
+                            case 0xA8:
+                                if (n <= 6) break;
+                                if (q[6] != 0xD7) break;
+                                if (n <= 7) break;
+                                if (q[7] != 0x99) break;
+                                if (n <= 8) break;
+                                if (q[8] != 0xD7) break;
+                                if (n <= 9) break;
+                                if (q[9] != 0xA7) break;
+                                i = 38;
+                                break;
+                        }
+                        break;
+                    case 0xA2:
+                        i = 39;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_1[i].s_size;
+    return a_1[i].result;
+}
+static const symbol s_15[] = { 0xD7, 0xA6, 0xD7, 0x95, 0xD7, 0x92, 0xD7, 0xA0 };
+static const symbol s_16[] = { 0xD7, 0xA6, 0xD7, 0x95, 0xD7, 0xA7, 0xD7, 0x98 };
+static const symbol s_17[] = { 0xD7, 0xA6, 0xD7, 0x95, 0xD7, 0xA7, 0xD7, 0xA0 };
+static const symbol s_18[] = { 0xD7, 0x92, 0xD7, 0xA2, 0xD7, 0x91, 0xD7, 0xA0 };
+static const symbol s_19[] = { 0xD7, 0x92, 0xD7, 0xA2 };
+static const symbol s_20[] = { 'G', 'E' };
+static const symbol s_21[] = { 0xD7, 0xA6, 0xD7, 0x95 };
+static const symbol s_22[] = { 'T', 'S', 'U' };
+
+static int find_among_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[0] != 0xD7) break;
+        if (n <= 1) break;
+        switch (q[1]) {
+            case 0x93:
+                if (n <= 2) break;
+                if (q[2] != 0xD7) break;
+                if (n <= 3) break;
+                if (q[3] != 0x96) break;
+                if (n <= 4) break;
+                if (q[4] != 0xD7) break;
+                if (n <= 5) break;
+                if (q[5] != 0xA9) break;
+                i = 0;
+                break;
+            case 0xA9:
+                if (n <= 2) break;
+                if (q[2] != 0xD7) break;
+                if (n <= 3) break;
+                switch (q[3]) {
+                    case 0x98:
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        switch (q[5]) {
+                            case 0xA8:
+                                i = 1;
+                                break;
+                            case 0xA9:
+                                i = 2;
+                                break;
+                        }
+                        break;
+                    case 0xA4:
+                        if (n <= 4) break;
+                        if (q[4] != 0xD7) break;
+                        if (n <= 5) break;
+                        if (q[5] != 0xA8) break;
+                        i = 3;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_2[i].s_size;
+    return a_2[i].result;
+}
+
+static const unsigned char a_4_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x24, 0x49, 0x7, 0x5, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x92:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xA0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x95) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD7) break;
+                i = 0;
+                break;
+            case 0x95:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x98) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xA1) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD7) break;
+                i = 1;
+                break;
+            case 0x98:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                i = 2;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x9B:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x90) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA8) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD7) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0x91) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xD7) break;
+                        i = 3;
+                        break;
+                    case 0xA1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        i = 4;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x99) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        i = 5;
+                        break;
+                    case 0xA2:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        i = 6;
+                        break;
+                    case 0xA4:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x90) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA9) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD7) break;
+                        i = 7;
+                        break;
+                    case 0xB2:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x94:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                i = 8;
+                                break;
+                            case 0xA7:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                i = 9;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x99) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                i = 10;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x9B:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xA2) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x9C) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD7) break;
+                i = 11;
+                if (n <= 6) break;
+                if (q[-7] != 0xA2) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xD7) break;
+                i = 12;
+                break;
+            case 0x9E:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x96:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x99) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        i = 13;
+                        break;
+                    case 0x99:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        i = 14;
+                        break;
+                    case 0xA2:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        i = 15;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA0) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA2) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD7) break;
+                        i = 16;
+                        if (n <= 8) break;
+                        if (q[-9] != 0x98) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xD7) break;
+                        i = 17;
+                        break;
+                }
+                break;
+            case 0xA0:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                i = 18;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x91:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x99:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x9C:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD7) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xA7) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xD7) break;
+                                        i = 19;
+                                        break;
+                                    case 0xA8:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD7) break;
+                                        i = 20;
+                                        if (n <= 8) break;
+                                        switch (q[-9]) {
+                                            case 0x98:
+                                                if (n <= 9) break;
+                                                if (q[-10] != 0xD7) break;
+                                                i = 21;
+                                                break;
+                                            case 0xA9:
+                                                if (n <= 9) break;
+                                                if (q[-10] != 0xD7) break;
+                                                i = 22;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 0xB1:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x94) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                i = 23;
+                                break;
+                        }
+                        break;
+                    case 0x92:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x99:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xB0) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xA9) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD7) break;
+                                i = 24;
+                                break;
+                            case 0xA0:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x95) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                if (n <= 8) break;
+                                switch (q[-9]) {
+                                    case 0x96:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xD7) break;
+                                        i = 25;
+                                        break;
+                                    case 0x9C:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xD7) break;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA9) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xD7) break;
+                                        i = 26;
+                                        break;
+                                    case 0xB0:
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xD7) break;
+                                        if (n <= 10) break;
+                                        if (q[-11] != 0xA6) break;
+                                        if (n <= 11) break;
+                                        if (q[-12] != 0xD7) break;
+                                        i = 27;
+                                        break;
+                                }
+                                break;
+                            case 0xB1:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x91) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                i = 28;
+                                break;
+                        }
+                        break;
+                    case 0x93:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA0) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x95) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD7) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0x91) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xD7) break;
+                        i = 29;
+                        break;
+                    case 0x96:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x99) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xB0) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD7) break;
+                        i = 30;
+                        break;
+                    case 0x98:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        i = 31;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x99:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x91:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD7) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 'E') break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 'G') break;
+                                        i = 32;
+                                        break;
+                                    case 0x9C:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD7) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 'E') break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 'G') break;
+                                        i = 33;
+                                        break;
+                                    case 0x9E:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD7) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 'E') break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 'G') break;
+                                        i = 34;
+                                        break;
+                                    case 0xA0:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD7) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xA9) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xD7) break;
+                                        i = 35;
+                                        break;
+                                }
+                                break;
+                            case 0xA1:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                i = 36;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x99) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                i = 37;
+                                break;
+                            case 0xA2:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                i = 38;
+                                break;
+                        }
+                        break;
+                    case 0xA1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x99) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x91:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 'E') break;
+                                if (n <= 9) break;
+                                if (q[-10] != 'G') break;
+                                i = 39;
+                                break;
+                            case 0x9E:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xA9) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD7) break;
+                                i = 40;
+                                break;
+                            case 0xA8:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 'E') break;
+                                if (n <= 9) break;
+                                if (q[-10] != 'G') break;
+                                i = 41;
+                                break;
+                        }
+                        break;
+                    case 0xA2:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        i = 42;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x92:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xA0) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0x90) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD7) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0x92) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xD7) break;
+                                i = 43;
+                                break;
+                            case 0x9C:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xA2) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                i = 44;
+                                break;
+                            case 0x9E:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x95:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD7) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xA0) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xD7) break;
+                                        i = 45;
+                                        break;
+                                    case 0x96:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD7) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0x99) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xD7) break;
+                                        i = 46;
+                                        break;
+                                }
+                                break;
+                            case 0xA0:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x90) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0x98) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD7) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0xA9) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xD7) break;
+                                i = 47;
+                                break;
+                        }
+                        break;
+                    case 0xA7:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA0) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x95) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD7) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xA8) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xD7) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0x98) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xD7) break;
+                        i = 48;
+                        break;
+                    case 0xA8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x9C:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xA8) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD7) break;
+                                if (n <= 10) break;
+                                if (q[-11] != 0x90) break;
+                                if (n <= 11) break;
+                                if (q[-12] != 0xD7) break;
+                                if (n <= 12) break;
+                                if (q[-13] != 0xA4) break;
+                                if (n <= 13) break;
+                                if (q[-14] != 0xD7) break;
+                                i = 49;
+                                break;
+                            case 0xB0:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0xA9) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0xD7) break;
+                                i = 50;
+                                break;
+                        }
+                        break;
+                    case 0xA9:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x98) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x95) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD7) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xB0) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xD7) break;
+                        i = 51;
+                        break;
+                    case 0xB2:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x92) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        i = 52;
+                        break;
+                }
+                break;
+            case 0xA1:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                i = 53;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x98:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        i = 54;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA2) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        i = 55;
+                        break;
+                    case 0xA0:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        i = 56;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x98:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                i = 57;
+                                break;
+                            case 0xA2:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                i = 58;
+                                break;
+                        }
+                        break;
+                    case 0xA2:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        i = 59;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x99:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                i = 60;
+                                break;
+                            case 0x9C:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xA2) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                i = 61;
+                                break;
+                        }
+                        break;
+                    case 0xA8:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA2) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        i = 62;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA0) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD7) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xA2) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xD7) break;
+                        i = 63;
+                        break;
+                }
+                break;
+            case 0xA2:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                i = 64;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x98:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        i = 65;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0xA1:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                i = 66;
+                                break;
+                            case 0xA2:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                i = 67;
+                                break;
+                        }
+                        break;
+                    case 0x99:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        i = 68;
+                        break;
+                    case 0x9C:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA2) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        i = 69;
+                        break;
+                    case 0xA0:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xA2) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        i = 70;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x98) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD7) break;
+                        i = 71;
+                        break;
+                }
+                break;
+            case 0xA8:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xA2) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                i = 72;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x98:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        i = 73;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0xA1:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                i = 74;
+                                break;
+                            case 0xA2:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                i = 75;
+                                break;
+                        }
+                        break;
+                    case 0xA0:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA2) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD7) break;
+                        i = 76;
+                        if (n <= 8) break;
+                        if (q[-9] != 0x98) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xD7) break;
+                        i = 77;
+                        break;
+                }
+                break;
+            case 0xAA:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x95) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                i = 78;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+static const symbol s_23[] = { 0xD7, 0x99, 0xD7, 0xA2 };
+
+static const unsigned char a_3_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4E, 0x41, 0x83, 0x3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x91:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x99:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x9C:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0xA7) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                i = 0;
+                                break;
+                            case 0xA8:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                i = 1;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x98:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD7) break;
+                                        i = 2;
+                                        break;
+                                    case 0xA9:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD7) break;
+                                        i = 3;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0xB1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x94) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 0x92:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x99:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0xB0) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA9) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD7) break;
+                        i = 5;
+                        break;
+                    case 0xA0:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x90:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x92) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                i = 6;
+                                break;
+                            case 0x95:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 0x96:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD7) break;
+                                        i = 7;
+                                        break;
+                                    case 0x9C:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD7) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xA9) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xD7) break;
+                                        i = 8;
+                                        break;
+                                    case 0xB0:
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0xD7) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0xA6) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0xD7) break;
+                                        i = 9;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0xB1:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x91) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        i = 10;
+                        break;
+                }
+                break;
+            case 0x93:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xA0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x95) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD7) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x91) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xD7) break;
+                i = 11;
+                break;
+            case 0x96:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x99) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xB0) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD7) break;
+                i = 12;
+                break;
+            case 0x98:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x99) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x91:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        i = 13;
+                        break;
+                    case 0x9C:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        i = 14;
+                        break;
+                    case 0x9E:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        i = 15;
+                        break;
+                    case 0xA0:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA9) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD7) break;
+                        i = 16;
+                        break;
+                }
+                break;
+            case 0x9E:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x95) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                if (n <= 4) break;
+                if (q[-5] != 0xA0) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD7) break;
+                i = 17;
+                break;
+            case 0xA0:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x90) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x98) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD7) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xA9) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xD7) break;
+                i = 18;
+                break;
+            case 0xA1:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x99) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x91:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        i = 19;
+                        break;
+                    case 0x9E:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA9) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD7) break;
+                        i = 20;
+                        break;
+                    case 0xA8:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        i = 21;
+                        break;
+                }
+                break;
+            case 0xA7:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xA0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x95) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD7) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xA8) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xD7) break;
+                if (n <= 8) break;
+                if (q[-9] != 0x98) break;
+                if (n <= 9) break;
+                if (q[-10] != 0xD7) break;
+                i = 22;
+                break;
+            case 0xA8:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xB1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x9C:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA8) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD7) break;
+                        if (n <= 8) break;
+                        if (q[-9] != 0x90) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xD7) break;
+                        if (n <= 10) break;
+                        if (q[-11] != 0xA4) break;
+                        if (n <= 11) break;
+                        if (q[-12] != 0xD7) break;
+                        i = 23;
+                        break;
+                    case 0xB0:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA9) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD7) break;
+                        i = 24;
+                        break;
+                }
+                break;
+            case 0xA9:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x98) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x95) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD7) break;
+                if (n <= 6) break;
+                if (q[-7] != 0xB0) break;
+                if (n <= 7) break;
+                if (q[-8] != 0xD7) break;
+                i = 25;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+static const symbol s_24[] = { 0xD7, 0x92, 0xD7, 0xB2 };
+static const symbol s_25[] = { 0xD7, 0xA0, 0xD7, 0xA2, 0xD7, 0x9E };
+static const symbol s_26[] = { 0xD7, 0x9E, 0xD7, 0xB2, 0xD7, 0x93 };
+static const symbol s_27[] = { 0xD7, 0x91, 0xD7, 0xB2, 0xD7, 0x98 };
+static const symbol s_28[] = { 0xD7, 0x91, 0xD7, 0xB2, 0xD7, 0xA1 };
+static const symbol s_29[] = { 0xD7, 0xB0, 0xD7, 0xB2, 0xD7, 0x96 };
+static const symbol s_30[] = { 0xD7, 0x98, 0xD7, 0xA8, 0xD7, 0xB2, 0xD7, 0x91 };
+static const symbol s_31[] = { 0xD7, 0x9C, 0xD7, 0xB2, 0xD7, 0x98 };
+static const symbol s_32[] = { 0xD7, 0xA7, 0xD7, 0x9C, 0xD7, 0xB2, 0xD7, 0x91 };
+static const symbol s_33[] = { 0xD7, 0xA8, 0xD7, 0xB2, 0xD7, 0x91 };
+static const symbol s_34[] = { 0xD7, 0xA8, 0xD7, 0xB2, 0xD7, 0xA1 };
+static const symbol s_35[] = { 0xD7, 0xA9, 0xD7, 0xB0, 0xD7, 0xB2, 0xD7, 0x92 };
+static const symbol s_36[] = { 0xD7, 0xA9, 0xD7, 0x9E, 0xD7, 0xB2, 0xD7, 0xA1 };
+static const symbol s_37[] = { 0xD7, 0xA9, 0xD7, 0xA0, 0xD7, 0xB2, 0xD7, 0x93 };
+static const symbol s_38[] = { 0xD7, 0xA9, 0xD7, 0xA8, 0xD7, 0xB2, 0xD7, 0x91 };
+static const symbol s_39[] = { 0xD7, 0x91, 0xD7, 0x99, 0xD7, 0xA0, 0xD7, 0x93 };
+static const symbol s_40[] = { 0xD7, 0xB0, 0xD7, 0x99, 0xD7, 0x98, 0xD7, 0xA9 };
+static const symbol s_41[] = { 0xD7, 0x96, 0xD7, 0x99, 0xD7, 0xA0, 0xD7, 0x92 };
+static const symbol s_42[] = { 0xD7, 0x98, 0xD7, 0xA8, 0xD7, 0x99, 0xD7, 0xA0, 0xD7, 0xA7 };
+static const symbol s_43[] = { 0xD7, 0xA6, 0xD7, 0xB0, 0xD7, 0x99, 0xD7, 0xA0, 0xD7, 0x92 };
+static const symbol s_44[] = { 0xD7, 0xA9, 0xD7, 0x9C, 0xD7, 0x99, 0xD7, 0xA0, 0xD7, 0x92 };
+static const symbol s_45[] = { 0xD7, 0x91, 0xD7, 0xB2, 0xD7, 0x92 };
+static const symbol s_46[] = { 0xD7, 0x94, 0xD7, 0xB2, 0xD7, 0x91 };
+static const symbol s_47[] = { 0xD7, 0xA4, 0xD7, 0x90, 0xD7, 0xA8, 0xD7, 0x9C, 0xD7, 0x99, 0xD7, 0xA8 };
+static const symbol s_48[] = { 0xD7, 0xA9, 0xD7, 0x98, 0xD7, 0xB2 };
+static const symbol s_49[] = { 0xD7, 0xA9, 0xD7, 0xB0, 0xD7, 0xA2, 0xD7, 0xA8 };
+static const symbol s_50[] = { 0xD7, 0x98 };
+static const symbol s_51[] = { 0xD7, 0x91, 0xD7, 0xA8, 0xD7, 0x90, 0xD7, 0x9B };
+static const symbol s_52[] = { 0xD7, 0x92, 0xD7, 0xA2 };
+static const symbol s_53[] = { 0xD7, 0x91, 0xD7, 0xA8, 0xD7, 0xA2, 0xD7, 0xA0, 0xD7, 0x92 };
+static const symbol s_54[] = { 0xD7, 0x92, 0xD7, 0xB2 };
+static const symbol s_55[] = { 0xD7, 0xA0, 0xD7, 0xA2, 0xD7, 0x9E };
+static const symbol s_56[] = { 0xD7, 0xA9, 0xD7, 0xA8, 0xD7, 0xB2, 0xD7, 0x91 };
+static const symbol s_57[] = { 0xD7, 0x9E, 0xD7, 0xB2, 0xD7, 0x93 };
+static const symbol s_58[] = { 0xD7, 0x91, 0xD7, 0xB2, 0xD7, 0x98 };
+static const symbol s_59[] = { 0xD7, 0x91, 0xD7, 0xB2, 0xD7, 0xA1 };
+static const symbol s_60[] = { 0xD7, 0xB0, 0xD7, 0xB2, 0xD7, 0x96 };
+static const symbol s_61[] = { 0xD7, 0x98, 0xD7, 0xA8, 0xD7, 0xB2, 0xD7, 0x91 };
+static const symbol s_62[] = { 0xD7, 0x9C, 0xD7, 0xB2, 0xD7, 0x98 };
+static const symbol s_63[] = { 0xD7, 0xA7, 0xD7, 0x9C, 0xD7, 0xB2, 0xD7, 0x91 };
+static const symbol s_64[] = { 0xD7, 0xA8, 0xD7, 0xB2, 0xD7, 0x91 };
+static const symbol s_65[] = { 0xD7, 0xA8, 0xD7, 0xB2, 0xD7, 0xA1 };
+static const symbol s_66[] = { 0xD7, 0xA9, 0xD7, 0xB0, 0xD7, 0xB2, 0xD7, 0x92 };
+static const symbol s_67[] = { 0xD7, 0xA9, 0xD7, 0x9E, 0xD7, 0xB2, 0xD7, 0xA1 };
+static const symbol s_68[] = { 0xD7, 0xA9, 0xD7, 0xA0, 0xD7, 0xB2, 0xD7, 0x93 };
+static const symbol s_69[] = { 0xD7, 0x91, 0xD7, 0x99, 0xD7, 0xA0, 0xD7, 0x93 };
+static const symbol s_70[] = { 0xD7, 0xB0, 0xD7, 0x99, 0xD7, 0x98, 0xD7, 0xA9 };
+static const symbol s_71[] = { 0xD7, 0x96, 0xD7, 0x99, 0xD7, 0xA0, 0xD7, 0x92 };
+static const symbol s_72[] = { 0xD7, 0x98, 0xD7, 0xA8, 0xD7, 0x99, 0xD7, 0xA0, 0xD7, 0xA7 };
+static const symbol s_73[] = { 0xD7, 0xA6, 0xD7, 0xB0, 0xD7, 0x99, 0xD7, 0xA0, 0xD7, 0x92 };
+static const symbol s_74[] = { 0xD7, 0xA9, 0xD7, 0x9C, 0xD7, 0x99, 0xD7, 0xA0, 0xD7, 0x92 };
+static const symbol s_75[] = { 0xD7, 0x91, 0xD7, 0xB2, 0xD7, 0x92 };
+static const symbol s_76[] = { 0xD7, 0x94, 0xD7, 0xB2, 0xD7, 0x91 };
+static const symbol s_77[] = { 0xD7, 0xA4, 0xD7, 0x90, 0xD7, 0xA8, 0xD7, 0x9C, 0xD7, 0x99, 0xD7, 0xA8 };
+static const symbol s_78[] = { 0xD7, 0xA9, 0xD7, 0x98, 0xD7, 0xB2 };
+static const symbol s_79[] = { 0xD7, 0xA9, 0xD7, 0xB0, 0xD7, 0xA2, 0xD7, 0xA8 };
+static const symbol s_80[] = { 0xD7, 0x91, 0xD7, 0xA8, 0xD7, 0xA2, 0xD7, 0xA0, 0xD7, 0x92 };
+static const symbol s_81[] = { 0xD7, 0x94 };
+static const symbol s_82[] = { 0xD7, 0x92 };
+static const symbol s_83[] = { 0xD7, 0xA9 };
+static const symbol s_84[] = { 0xD7, 0x99, 0xD7, 0xA1 };
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x92:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0xA0) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x95) break;
+                if (n <= 5) break;
+                if (q[-6] != 0xD7) break;
+                i = 0;
+                break;
+            case 0x98:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0xA4:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x90) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA9) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD7) break;
+                        i = 1;
+                        break;
+                    case 0xB2:
+                        if (n <= 3) break;
+                        if (q[-4] != 0xD7) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x94:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                i = 2;
+                                break;
+                            case 0xA7:
+                                if (n <= 5) break;
+                                if (q[-6] != 0xD7) break;
+                                i = 3;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x99) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                i = 4;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x9C:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                i = 5;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+
+static const unsigned char a_6_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x4, 0x0, 0x80, 0x2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_6(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x92:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x99) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                i = 0;
+                break;
+            case 0xA7:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x99) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                i = 1;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x93:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        i = 2;
+                        if (n <= 6) break;
+                        if (q[-7] != 0xA0) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0xD7) break;
+                        i = 3;
+                        if (n <= 8) break;
+                        if (q[-9] != 0xA2) break;
+                        if (n <= 9) break;
+                        if (q[-10] != 0xD7) break;
+                        i = 4;
+                        break;
+                    case 0x9C:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 0x91:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                i = 5;
+                                break;
+                            case 0x92:
+                                if (n <= 7) break;
+                                if (q[-8] != 0xD7) break;
+                                i = 6;
+                                break;
+                        }
+                        break;
+                    case 0xA0:
+                        if (n <= 5) break;
+                        if (q[-6] != 0xD7) break;
+                        i = 7;
+                        break;
+                }
+                break;
+            case 0xA9:
+                if (n <= 1) break;
+                if (q[-2] != 0xD7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x99) break;
+                if (n <= 3) break;
+                if (q[-4] != 0xD7) break;
+                i = 8;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_6[i].s_size;
+    return a_6[i].result;
+}
+static const symbol s_85[] = { 'G', 'E' };
+static const symbol s_86[] = { 'T', 'S', 'U' };
+
+extern int yiddish_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    
+    {   int c1 = z->c;
+        while(1) {
+            int c2 = z->c;
+            while(1) {
+                int c3 = z->c;
+                z->bra = z->c;
+                if (z->c + 1 >= z->l || !((a_0_filter0[z->p[z->c + 1] >> 3] >> (z->p[z->c + 1] & 7)) & 1)) goto lab3;
+                among_var = find_among_0(z);
+                if (!(among_var)) goto lab3;
+                z->ket = z->c;
+                switch (among_var) {
+                    case 1:
+                        {   int c4 = z->c;
+                            if (!(eq_s(z, 2, s_0))) goto lab4;
+                            goto lab3;
+                        lab4:
+                            z->c = c4;
+                        }
+                        {   int ret = slice_from_s(z, 2, s_1);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        {   int c5 = z->c;
+                            if (!(eq_s(z, 2, s_2))) goto lab5;
+                            goto lab3;
+                        lab5:
+                            z->c = c5;
+                        }
+                        {   int ret = slice_from_s(z, 2, s_3);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 3:
+                        {   int c6 = z->c;
+                            if (!(eq_s(z, 2, s_4))) goto lab6;
+                            goto lab3;
+                        lab6:
+                            z->c = c6;
+                        }
+                        {   int ret = slice_from_s(z, 2, s_5);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 4:
+                        {   int ret = slice_from_s(z, 2, s_6);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 5:
+                        {   int ret = slice_from_s(z, 2, s_7);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 6:
+                        {   int ret = slice_from_s(z, 2, s_8);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 7:
+                        {   int ret = slice_from_s(z, 2, s_9);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 8:
+                        {   int ret = slice_from_s(z, 2, s_10);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+                z->c = c3;
+                break;
+            lab3:
+                z->c = c3;
+                {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                    if (ret < 0) goto lab2;
+                    z->c = ret;
+                }
+            }
+            continue;
+        lab2:
+            z->c = c2;
+            break;
+        }
+        z->c = c1;
+    }
+    {   int c7 = z->c;
+        while(1) {
+            int c8 = z->c;
+            while(1) {
+                int c9 = z->c;
+                z->bra = z->c;
+                if (in_class_U(z, g_niked_class, g_niked, 1456, 1474, 0)) goto lab9;
+                z->ket = z->c;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                z->c = c9;
+                break;
+            lab9:
+                z->c = c9;
+                {   int ret = skip_utf8(z->p, z->c, z->l, 1);
+                    if (ret < 0) goto lab8;
+                    z->c = ret;
+                }
+            }
+            continue;
+        lab8:
+            z->c = c8;
+            break;
+        }
+        z->c = c7;
+    }
+    {   int c10 = z->c;
+        z->I[1] = z->l;
+        {   int c11 = z->c;
+            z->bra = z->c;
+            if (!(eq_s(z, 4, s_11))) { z->c = c11; goto lab11; }
+            z->ket = z->c;
+            {   int c12 = z->c;
+                {   int c13 = z->c;
+                    if (!(eq_s(z, 4, s_12))) goto lab14;
+                    goto lab13;
+                lab14:
+                    z->c = c13;
+                    if (!(eq_s(z, 4, s_13))) goto lab12;
+                }
+            lab13:
+                { z->c = c11; goto lab11; }
+            lab12:
+                z->c = c12;
+            }
+            {   int ret = slice_from_s(z, 2, s_14);
+                if (ret < 0) return ret;
+            }
+        lab11:
+            ;
+        }
+        {   int c14 = z->c;
+            if (z->c + 3 >= z->l || !((a_1_filter0[z->p[z->c + 3] >> 3] >> (z->p[z->c + 3] & 7)) & 1)) { z->c = c14; goto lab15; }
+            if (!(find_among_1(z))) { z->c = c14; goto lab15; }
+            {   int c15 = z->c;
+                {   int c_test16 = z->c;
+                    {   int c17 = z->c;
+                        if (!(eq_s(z, 8, s_15))) goto lab19;
+                        goto lab18;
+                    lab19:
+                        z->c = c17;
+                        if (!(eq_s(z, 8, s_16))) goto lab20;
+                        goto lab18;
+                    lab20:
+                        z->c = c17;
+                        if (!(eq_s(z, 8, s_17))) goto lab17;
+                    }
+                lab18:
+                    if (z->c < z->l) goto lab17;
+                    z->c = c_test16;
+                }
+                goto lab16;
+            lab17:
+                z->c = c15;
+                {   int c_test18 = z->c;
+                    if (!(eq_s(z, 8, s_18))) goto lab21;
+                    z->c = c_test18;
+                }
+                goto lab16;
+            lab21:
+                z->c = c15;
+                z->bra = z->c;
+                if (!(eq_s(z, 4, s_19))) goto lab22;
+                z->ket = z->c;
+                {   int ret = slice_from_s(z, 2, s_20);
+                    if (ret < 0) return ret;
+                }
+                goto lab16;
+            lab22:
+                z->c = c15;
+                z->bra = z->c;
+                if (!(eq_s(z, 4, s_21))) { z->c = c14; goto lab15; }
+                z->ket = z->c;
+                {   int ret = slice_from_s(z, 3, s_22);
+                    if (ret < 0) return ret;
+                }
+            }
+        lab16:
+        lab15:
+            ;
+        }
+        {   int c_test19 = z->c;
+            {   int ret = hop_utf8(z, z->c, z->l, 3);
+                if (ret < 0) goto lab10;
+                z->c = ret;
+            }
+            z->I[0] = z->c;
+            z->c = c_test19;
+        }
+        {   int c20 = z->c;
+            if (z->c + 5 >= z->l || (z->p[z->c + 5] != 168 && z->p[z->c + 5] != 169)) { z->c = c20; goto lab23; }
+            if (!(find_among_2(z))) { z->c = c20; goto lab23; }
+        lab23:
+            ;
+        }
+        {   int c21 = z->c;
+            if (in_class_U(z, g_consonant_class, g_consonant, 1489, 1520, 0)) goto lab24;
+            if (in_class_U(z, g_consonant_class, g_consonant, 1489, 1520, 0)) goto lab24;
+            if (in_class_U(z, g_consonant_class, g_consonant, 1489, 1520, 0)) goto lab24;
+            z->I[1] = z->c;
+            goto lab10;
+        lab24:
+            z->c = c21;
+        }
+        if (out_class_U(z, g_vowel_class, g_vowel, 1488, 1522, 1) < 0) goto lab10;
+        while(1) {
+            if (in_class_U(z, g_vowel_class, g_vowel, 1488, 1522, 0)) goto lab25;
+            continue;
+        lab25:
+            break;
+        }
+        z->I[1] = z->c;
+        
+        if (!(z->I[1] < z->I[0])) goto lab26;
+        z->I[1] = z->I[0];
+    lab26:
+    lab10:
+        z->c = c10;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    
+    {   int m22 = z->l - z->c; (void)m22;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || !((a_4_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || z->p[z->c - 2] != 215) goto lab28;
+        among_var = find_among_b_4(z);
+        if (!(among_var)) goto lab28;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(z->I[1] <= z->c)) goto lab28;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                if (!(z->I[1] <= z->c)) goto lab28;
+                {   int ret = slice_from_s(z, 4, s_23);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                if (!(z->I[1] <= z->c)) goto lab28;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                z->ket = z->c;
+                if (z->c - 5 <= z->lb || !((a_3_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || z->p[z->c - 2] != 215) goto lab28;
+                among_var = find_among_b_3(z);
+                if (!(among_var)) goto lab28;
+                z->bra = z->c;
+                switch (among_var) {
+                    case 1:
+                        {   int ret = slice_from_s(z, 4, s_24);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        {   int ret = slice_from_s(z, 6, s_25);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 3:
+                        {   int ret = slice_from_s(z, 6, s_26);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 4:
+                        {   int ret = slice_from_s(z, 6, s_27);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 5:
+                        {   int ret = slice_from_s(z, 6, s_28);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 6:
+                        {   int ret = slice_from_s(z, 6, s_29);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 7:
+                        {   int ret = slice_from_s(z, 8, s_30);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 8:
+                        {   int ret = slice_from_s(z, 6, s_31);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 9:
+                        {   int ret = slice_from_s(z, 8, s_32);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 10:
+                        {   int ret = slice_from_s(z, 6, s_33);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 11:
+                        {   int ret = slice_from_s(z, 6, s_34);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 12:
+                        {   int ret = slice_from_s(z, 8, s_35);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 13:
+                        {   int ret = slice_from_s(z, 8, s_36);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 14:
+                        {   int ret = slice_from_s(z, 8, s_37);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 15:
+                        {   int ret = slice_from_s(z, 8, s_38);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 16:
+                        {   int ret = slice_from_s(z, 8, s_39);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 17:
+                        {   int ret = slice_from_s(z, 8, s_40);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 18:
+                        {   int ret = slice_from_s(z, 8, s_41);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 19:
+                        {   int ret = slice_from_s(z, 10, s_42);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 20:
+                        {   int ret = slice_from_s(z, 10, s_43);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 21:
+                        {   int ret = slice_from_s(z, 10, s_44);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 22:
+                        {   int ret = slice_from_s(z, 6, s_45);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 23:
+                        {   int ret = slice_from_s(z, 6, s_46);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 24:
+                        {   int ret = slice_from_s(z, 12, s_47);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 25:
+                        {   int ret = slice_from_s(z, 6, s_48);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 26:
+                        {   int ret = slice_from_s(z, 8, s_49);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+                break;
+            case 4:
+                {   int m23 = z->l - z->c; (void)m23;
+                    if (!(z->I[1] <= z->c)) goto lab30;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab29;
+                lab30:
+                    z->c = z->l - m23;
+                    {   int ret = slice_from_s(z, 2, s_50);
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab29:
+                z->ket = z->c;
+                if (!(eq_s_b(z, 8, s_51))) goto lab28;
+                {   int m24 = z->l - z->c; (void)m24;
+                    if (!(eq_s_b(z, 4, s_52))) { z->c = z->l - m24; goto lab31; }
+                lab31:
+                    ;
+                }
+                z->bra = z->c;
+                {   int ret = slice_from_s(z, 10, s_53);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                {   int ret = slice_from_s(z, 4, s_54);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {   int ret = slice_from_s(z, 6, s_55);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                {   int ret = slice_from_s(z, 8, s_56);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 8:
+                {   int ret = slice_from_s(z, 6, s_57);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 9:
+                {   int ret = slice_from_s(z, 6, s_58);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 10:
+                {   int ret = slice_from_s(z, 6, s_59);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 11:
+                {   int ret = slice_from_s(z, 6, s_60);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 12:
+                {   int ret = slice_from_s(z, 8, s_61);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 13:
+                {   int ret = slice_from_s(z, 6, s_62);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 14:
+                {   int ret = slice_from_s(z, 8, s_63);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 15:
+                {   int ret = slice_from_s(z, 6, s_64);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 16:
+                {   int ret = slice_from_s(z, 6, s_65);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 17:
+                {   int ret = slice_from_s(z, 8, s_66);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 18:
+                {   int ret = slice_from_s(z, 8, s_67);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 19:
+                {   int ret = slice_from_s(z, 8, s_68);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 20:
+                {   int ret = slice_from_s(z, 8, s_69);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 21:
+                {   int ret = slice_from_s(z, 8, s_70);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 22:
+                {   int ret = slice_from_s(z, 8, s_71);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 23:
+                {   int ret = slice_from_s(z, 10, s_72);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 24:
+                {   int ret = slice_from_s(z, 10, s_73);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 25:
+                {   int ret = slice_from_s(z, 10, s_74);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 26:
+                {   int ret = slice_from_s(z, 6, s_75);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 27:
+                {   int ret = slice_from_s(z, 6, s_76);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 28:
+                {   int ret = slice_from_s(z, 12, s_77);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 29:
+                {   int ret = slice_from_s(z, 6, s_78);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 30:
+                {   int ret = slice_from_s(z, 8, s_79);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 31:
+                {   int ret = slice_from_s(z, 10, s_80);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 32:
+                if (!(z->I[1] <= z->c)) goto lab28;
+                {   int ret = slice_from_s(z, 2, s_81);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 33:
+                {   int m25 = z->l - z->c; (void)m25;
+                    {   int m26 = z->l - z->c; (void)m26;
+                        if (!(eq_s_b(z, 2, s_82))) goto lab35;
+                        goto lab34;
+                    lab35:
+                        z->c = z->l - m26;
+                        if (!(eq_s_b(z, 2, s_83))) goto lab33;
+                    }
+                lab34:
+                    {   int m27 = z->l - z->c; (void)m27;
+                        if (!(z->I[1] <= (z->c + 6))) { z->c = z->l - m27; goto lab36; }
+                        {   int ret = slice_from_s(z, 4, s_84);
+                            if (ret < 0) return ret;
+                        }
+                    lab36:
+                        ;
+                    }
+                    goto lab32;
+                lab33:
+                    z->c = z->l - m25;
+                    if (!(z->I[1] <= z->c)) goto lab28;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab32:
+                break;
+        }
+    lab28:
+        z->c = z->l - m22;
+    }
+    {   int m28 = z->l - z->c; (void)m28;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 4 || !((285474816 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] != 215) goto lab37;
+        among_var = find_among_b_5(z);
+        if (!(among_var)) goto lab37;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(z->I[1] <= z->c)) goto lab37;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                if (!(z->I[1] <= z->c)) goto lab37;
+                if (in_class_b_U(z, g_consonant_class, g_consonant, 1489, 1520, 0)) goto lab37;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab37:
+        z->c = z->l - m28;
+    }
+    {   int m29 = z->l - z->c; (void)m29;
+        z->ket = z->c;
+        if (z->c - 3 <= z->lb || !((a_6_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || z->p[z->c - 2] != 215) goto lab38;
+        among_var = find_among_b_6(z);
+        if (!(among_var)) goto lab38;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(z->I[1] <= z->c)) goto lab38;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab38:
+        z->c = z->l - m29;
+    }
+    {   int m30 = z->l - z->c; (void)m30;
+        while(1) {
+            int m31 = z->l - z->c; (void)m31;
+            while(1) {
+                int m32 = z->l - z->c; (void)m32;
+                z->ket = z->c;
+                {   int m33 = z->l - z->c; (void)m33;
+                    if (!(eq_s_b(z, 2, s_85))) goto lab43;
+                    goto lab42;
+                lab43:
+                    z->c = z->l - m33;
+                    if (!(eq_s_b(z, 3, s_86))) goto lab41;
+                }
+            lab42:
+                z->bra = z->c;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                z->c = z->l - m32;
+                break;
+            lab41:
+                z->c = z->l - m32;
+                {   int ret = skip_b_utf8(z->p, z->c, z->lb, 1);
+                    if (ret < 0) goto lab40;
+                    z->c = ret;
+                }
+            }
+            continue;
+        lab40:
+            z->c = z->l - m31;
+            break;
+        }
+        z->c = z->l - m30;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * yiddish_UTF_8_create_env(void) { return SN_create_env(0, 2); }
+
+extern void yiddish_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
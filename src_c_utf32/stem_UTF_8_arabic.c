@@ -0,0 +1,1664 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int arabic_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+static int r_Suffix_Verb_Step2a(struct SN_env * z);
+static int r_Suffix_Noun_Step2c1(struct SN_env * z);
+static int r_Suffix_Noun_Step2b(struct SN_env * z);
+static int r_Suffix_Noun_Step2a(struct SN_env * z);
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * arabic_UTF_8_create_env(void);
+extern void arabic_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+static const symbol a_0_pool[198] = {
+    0x640, 0x64B, 0x64C, 0x64D, 0x64E, 0x64F, 0x650, 0x651, 0x652, 0x660, '0', 0x661, '1', 0x662, '2', 0x663,
+    '3', 0x664, '4', 0x665, '5', 0x666, '6', 0x667, '7', 0x668, '8', 0x669, '9', 0xFE80, 0x621, 0xFE81,
+    0x622, 0xFE82, 0xFE83, 0x623, 0xFE84, 0xFE85, 0x624, 0xFE86, 0xFE87, 0x625, 0xFE88, 0xFE89, 0x626, 0xFE8A, 0xFE8B, 0xFE8C,
+    0xFE8D, 0x627, 0xFE8E, 0xFE8F, 0x628, 0xFE90, 0xFE91, 0xFE92, 0xFE93, 0x629, 0xFE94, 0xFE95, 0x62A, 0xFE96, 0xFE97, 0xFE98,
+    0xFE99, 0x62B, 0xFE9A, 0xFE9B, 0xFE9C, 0xFE9D, 0x62C, 0xFE9E, 0xFE9F, 0xFEA0, 0xFEA1, 0x62D, 0xFEA2, 0xFEA3, 0xFEA4, 0xFEA5,
+    0x62E, 0xFEA6, 0xFEA7, 0xFEA8, 0xFEA9, 0x62F, 0xFEAA, 0xFEAB, 0x630, 0xFEAC, 0xFEAD, 0x631, 0xFEAE, 0xFEAF, 0x632, 0xFEB0,
+    0xFEB1, 0x633, 0xFEB2, 0xFEB3, 0xFEB4, 0xFEB5, 0x634, 0xFEB6, 0xFEB7, 0xFEB8, 0xFEB9, 0x635, 0xFEBA, 0xFEBB, 0xFEBC, 0xFEBD,
+    0x636, 0xFEBE, 0xFEBF, 0xFEC0, 0xFEC1, 0x637, 0xFEC2, 0xFEC3, 0xFEC4, 0xFEC5, 0x638, 0xFEC6, 0xFEC7, 0xFEC8, 0xFEC9, 0x639,
+    0xFECA, 0xFECB, 0xFECC, 0xFECD, 0x63A, 0xFECE, 0xFECF, 0xFED0, 0xFED1, 0x641, 0xFED2, 0xFED3, 0xFED4, 0xFED5, 0x642, 0xFED6,
+    0xFED7, 0xFED8, 0xFED9, 0x643, 0xFEDA, 0xFEDB, 0xFEDC, 0xFEDD, 0x644, 0xFEDE, 0xFEDF, 0xFEE0, 0xFEE1, 0x645, 0xFEE2, 0xFEE3,
+    0xFEE4, 0xFEE5, 0x646, 0xFEE6, 0xFEE7, 0xFEE8, 0xFEE9, 0x647, 0xFEEA, 0xFEEB, 0xFEEC, 0xFEED, 0x648, 0xFEEE, 0xFEEF, 0x649,
+    0xFEF0, 0xFEF1, 0x64A, 0xFEF2, 0xFEF3, 0xFEF4, 0xFEF5, 0x644, 0x622, 0xFEF6, 0xFEF7, 0x644, 0x623, 0xFEF8, 0xFEF9, 0x644,
+    0x625, 0xFEFA, 0xFEFB, 0x644, 0x627, 0xFEFC
+};
+
+static const struct translation_entry a_0_entry[144] = {
+    { 0, 1, 0, 0 },
+    { 1, 1, 0, 0 },
+    { 2, 1, 0, 0 },
+    { 3, 1, 0, 0 },
+    { 4, 1, 0, 0 },
+    { 5, 1, 0, 0 },
+    { 6, 1, 0, 0 },
+    { 7, 1, 0, 0 },
+    { 8, 1, 0, 0 },
+    { 9, 1, 10, 1 },
+    { 11, 1, 12, 1 },
+    { 13, 1, 14, 1 },
+    { 15, 1, 16, 1 },
+    { 17, 1, 18, 1 },
+    { 19, 1, 20, 1 },
+    { 21, 1, 22, 1 },
+    { 23, 1, 24, 1 },
+    { 25, 1, 26, 1 },
+    { 27, 1, 28, 1 },
+    { 29, 1, 30, 1 },
+    { 31, 1, 32, 1 },
+    { 33, 1, 32, 1 },
+    { 34, 1, 35, 1 },
+    { 36, 1, 35, 1 },
+    { 37, 1, 38, 1 },
+    { 39, 1, 38, 1 },
+    { 40, 1, 41, 1 },
+    { 42, 1, 41, 1 },
+    { 43, 1, 44, 1 },
+    { 45, 1, 44, 1 },
+    { 46, 1, 44, 1 },
+    { 47, 1, 44, 1 },
+    { 48, 1, 49, 1 },
+    { 50, 1, 49, 1 },
+    { 51, 1, 52, 1 },
+    { 53, 1, 52, 1 },
+    { 54, 1, 52, 1 },
+    { 55, 1, 52, 1 },
+    { 56, 1, 57, 1 },
+    { 58, 1, 57, 1 },
+    { 59, 1, 60, 1 },
+    { 61, 1, 60, 1 },
+    { 62, 1, 60, 1 },
+    { 63, 1, 60, 1 },
+    { 64, 1, 65, 1 },
+    { 66, 1, 65, 1 },
+    { 67, 1, 65, 1 },
+    { 68, 1, 65, 1 },
+    { 69, 1, 70, 1 },
+    { 71, 1, 70, 1 },
+    { 72, 1, 70, 1 },
+    { 73, 1, 70, 1 },
+    { 74, 1, 75, 1 },
+    { 76, 1, 75, 1 },
+    { 77, 1, 75, 1 },
+    { 78, 1, 75, 1 },
+    { 79, 1, 80, 1 },
+    { 81, 1, 80, 1 },
+    { 82, 1, 80, 1 },
+    { 83, 1, 80, 1 },
+    { 84, 1, 85, 1 },
+    { 86, 1, 85, 1 },
+    { 87, 1, 88, 1 },
+    { 89, 1, 88, 1 },
+    { 90, 1, 91, 1 },
+    { 92, 1, 91, 1 },
+    { 93, 1, 94, 1 },
+    { 95, 1, 94, 1 },
+    { 96, 1, 97, 1 },
+    { 98, 1, 97, 1 },
+    { 99, 1, 97, 1 },
+    { 100, 1, 97, 1 },
+    { 101, 1, 102, 1 },
+    { 103, 1, 102, 1 },
+    { 104, 1, 102, 1 },
+    { 105, 1, 102, 1 },
+    { 106, 1, 107, 1 },
+    { 108, 1, 107, 1 },
+    { 109, 1, 107, 1 },
+    { 110, 1, 107, 1 },
+    { 111, 1, 112, 1 },
+    { 113, 1, 112, 1 },
+    { 114, 1, 112, 1 },
+    { 115, 1, 112, 1 },
+    { 116, 1, 117, 1 },
+    { 118, 1, 117, 1 },
+    { 119, 1, 117, 1 },
+    { 120, 1, 117, 1 },
+    { 121, 1, 122, 1 },
+    { 123, 1, 122, 1 },
+    { 124, 1, 122, 1 },
+    { 125, 1, 122, 1 },
+    { 126, 1, 127, 1 },
+    { 128, 1, 127, 1 },
+    { 129, 1, 127, 1 },
+    { 130, 1, 127, 1 },
+    { 131, 1, 132, 1 },
+    { 133, 1, 132, 1 },
+    { 134, 1, 132, 1 },
+    { 135, 1, 132, 1 },
+    { 136, 1, 137, 1 },
+    { 138, 1, 137, 1 },
+    { 139, 1, 137, 1 },
+    { 140, 1, 137, 1 },
+    { 141, 1, 142, 1 },
+    { 143, 1, 142, 1 },
+    { 144, 1, 142, 1 },
+    { 145, 1, 142, 1 },
+    { 146, 1, 147, 1 },
+    { 148, 1, 147, 1 },
+    { 149, 1, 147, 1 },
+    { 150, 1, 147, 1 },
+    { 151, 1, 152, 1 },
+    { 153, 1, 152, 1 },
+    { 154, 1, 152, 1 },
+    { 155, 1, 152, 1 },
+    { 156, 1, 157, 1 },
+    { 158, 1, 157, 1 },
+    { 159, 1, 157, 1 },
+    { 160, 1, 157, 1 },
+    { 161, 1, 162, 1 },
+    { 163, 1, 162, 1 },
+    { 164, 1, 162, 1 },
+    { 165, 1, 162, 1 },
+    { 166, 1, 167, 1 },
+    { 168, 1, 167, 1 },
+    { 169, 1, 167, 1 },
+    { 170, 1, 167, 1 },
+    { 171, 1, 172, 1 },
+    { 173, 1, 172, 1 },
+    { 174, 1, 175, 1 },
+    { 176, 1, 175, 1 },
+    { 177, 1, 178, 1 },
+    { 179, 1, 178, 1 },
+    { 180, 1, 178, 1 },
+    { 181, 1, 178, 1 },
+    { 182, 1, 183, 2 },
+    { 185, 1, 183, 2 },
+    { 186, 1, 187, 2 },
+    { 189, 1, 187, 2 },
+    { 190, 1, 191, 2 },
+    { 193, 1, 191, 2 },
+    { 194, 1, 195, 2 },
+    { 197, 1, 195, 2 }
+};
+
+static const unsigned short a_0_page[249] = {
+    256, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 512
+};
+
+static const unsigned short a_0_index[768] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 4, 5, 6,
+    7, 8, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+    36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
+    68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+    84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99,
+    100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+    116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+    132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 0, 0, 0
+};
+
+static const struct translation a_0_translation = {
+    6, 254, 0, a_0_page, a_0_index, a_0_entry, a_0_pool
+};
+
+
+static const struct among a_1[5] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 }
+};
+
+static const symbol a_2_pool[8] = {
+    0x622, 0x627, 0x623, 0x624, 0x648, 0x625, 0x626, 0x64A
+};
+
+static const struct translation_entry a_2_entry[5] = {
+    { 0, 1, 1, 1 },
+    { 2, 1, 1, 1 },
+    { 3, 1, 4, 1 },
+    { 5, 1, 1, 1 },
+    { 6, 1, 7, 1 }
+};
+
+static const unsigned short a_2_page[1] = {
+    256
+};
+
+static const unsigned short a_2_index[512] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 2, 3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const struct translation a_2_translation = {
+    6, 6, 0, a_2_page, a_2_index, a_2_entry, a_2_pool
+};
+
+
+static const struct among a_3[4] =
+{
+{ 0, 2, -1, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 2 }
+};
+
+
+static const struct among a_4[5] =
+{
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 4 },
+{ 0, 2, -1, 3 }
+};
+
+
+static const struct among a_5[2] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 }
+};
+
+
+static const struct among a_6[4] =
+{
+{ 0, 2, -1, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 2 }
+};
+
+
+static const struct among a_7[4] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 2, 0, -1 },
+{ 0, 2, 0, 2 },
+{ 0, 2, -1, 3 }
+};
+
+
+static const struct among a_8[4] =
+{
+{ 0, 2, -1, 4 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 3 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_9[3] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 }
+};
+
+
+static const struct among a_10[10] =
+{
+{ 0, 3, -1, 3 },
+{ 0, 3, -1, 3 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 1, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 }
+};
+
+
+static const struct among a_11[1] =
+{
+{ 0, 1, -1, 1 }
+};
+
+
+static const struct among a_12[3] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 }
+};
+
+
+static const struct among a_13[1] =
+{
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_14[1] =
+{
+{ 0, 1, -1, 1 }
+};
+
+
+static const struct among a_15[1] =
+{
+{ 0, 1, -1, 1 }
+};
+
+
+static const struct among a_16[1] =
+{
+{ 0, 1, -1, 1 }
+};
+
+
+static const struct among a_17[12] =
+{
+{ 0, 3, -1, 3 },
+{ 0, 3, -1, 3 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 1, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 1, -1, 1 },
+{ 0, 3, -1, 3 },
+{ 0, 2, -1, 2 }
+};
+
+
+static const struct among a_18[11] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 2, 0, 2 },
+{ 0, 3, 0, 4 },
+{ 0, 2, 0, 2 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 5, 3 },
+{ 0, 2, 5, 2 },
+{ 0, 2, 5, 3 },
+{ 0, 2, 5, 3 },
+{ 0, 1, -1, 1 }
+};
+
+
+static const struct among a_19[2] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_20[2] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 3, 0, 2 }
+};
+
+
+static const struct among a_21[1] =
+{
+{ 0, 1, -1, 1 }
+};
+
+
+static int find_among_b_12(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x627:
+                i = 0;
+                break;
+            case 0x648:
+                i = 1;
+                break;
+            case 0x64A:
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_12[i].s_size;
+    return a_12[i].result;
+}
+
+static int find_among_b_13(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x62A) break;
+        if (n <= 1) break;
+        if (q[-2] != 0x627) break;
+        i = 0;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_13[i].s_size;
+    return a_13[i].result;
+}
+
+static int find_among_b_14(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x62A) break;
+        i = 0;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_14[i].s_size;
+    return a_14[i].result;
+}
+
+static int find_among_b_18(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x627:
+                i = 0;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x62A:
+                        i = 1;
+                        break;
+                    case 0x645:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x62A) break;
+                        i = 2;
+                        break;
+                    case 0x646:
+                        i = 3;
+                        break;
+                }
+                break;
+            case 0x62A:
+                i = 4;
+                break;
+            case 0x646:
+                i = 5;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x627:
+                        i = 6;
+                        break;
+                    case 0x62A:
+                        i = 7;
+                        break;
+                    case 0x648:
+                        i = 8;
+                        break;
+                    case 0x64A:
+                        i = 9;
+                        break;
+                }
+                break;
+            case 0x64A:
+                i = 10;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_18[i].s_size;
+    return a_18[i].result;
+}
+
+static int find_among_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 0x627:
+                if (n <= 1) break;
+                if (q[1] != 0x644) break;
+                i = 0;
+                break;
+            case 0x628:
+                if (n <= 1) break;
+                if (q[1] != 0x627) break;
+                if (n <= 2) break;
+                if (q[2] != 0x644) break;
+                i = 1;
+                break;
+            case 0x643:
+                if (n <= 1) break;
+                if (q[1] != 0x627) break;
+                if (n <= 2) break;
+                if (q[2] != 0x644) break;
+                i = 2;
+                break;
+            case 0x644:
+                if (n <= 1) break;
+                if (q[1] != 0x644) break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_3[i].s_size;
+    return a_3[i].result;
+}
+
+static int find_among_b_17(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x627:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x645:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x643:
+                                i = 0;
+                                break;
+                            case 0x647:
+                                i = 1;
+                                break;
+                        }
+                        break;
+                    case 0x646:
+                        i = 2;
+                        break;
+                    case 0x647:
+                        i = 3;
+                        break;
+                }
+                break;
+            case 0x643:
+                i = 4;
+                break;
+            case 0x645:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x643:
+                        i = 5;
+                        break;
+                    case 0x647:
+                        i = 6;
+                        break;
+                }
+                break;
+            case 0x646:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x643:
+                        i = 7;
+                        break;
+                    case 0x647:
+                        i = 8;
+                        break;
+                }
+                break;
+            case 0x647:
+                i = 9;
+                break;
+            case 0x648:
+                if (n <= 1) break;
+                if (q[-2] != 0x645) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x643) break;
+                i = 10;
+                break;
+            case 0x64A:
+                if (n <= 1) break;
+                if (q[-2] != 0x646) break;
+                i = 11;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_17[i].s_size;
+    return a_17[i].result;
+}
+
+static int find_among_b_20(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x648) break;
+        i = 0;
+        if (n <= 1) break;
+        if (q[-2] != 0x645) break;
+        if (n <= 2) break;
+        if (q[-3] != 0x62A) break;
+        i = 1;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_20[i].s_size;
+    return a_20[i].result;
+}
+
+static int find_among_b_19(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x627:
+                if (n <= 1) break;
+                if (q[-2] != 0x648) break;
+                i = 0;
+                break;
+            case 0x645:
+                if (n <= 1) break;
+                if (q[-2] != 0x62A) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_19[i].s_size;
+    return a_19[i].result;
+}
+
+static int find_among_b_15(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x629) break;
+        i = 0;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_15[i].s_size;
+    return a_15[i].result;
+}
+
+static int find_among_b_10(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x627:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x645:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x643:
+                                i = 0;
+                                break;
+                            case 0x647:
+                                i = 1;
+                                break;
+                        }
+                        break;
+                    case 0x646:
+                        i = 2;
+                        break;
+                    case 0x647:
+                        i = 3;
+                        break;
+                }
+                break;
+            case 0x643:
+                i = 4;
+                break;
+            case 0x645:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x643:
+                        i = 5;
+                        break;
+                    case 0x647:
+                        i = 6;
+                        break;
+                }
+                break;
+            case 0x646:
+                if (n <= 1) break;
+                if (q[-2] != 0x647) break;
+                i = 7;
+                break;
+            case 0x647:
+                i = 8;
+                break;
+            case 0x64A:
+                i = 9;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_10[i].s_size;
+    return a_10[i].result;
+}
+
+static int find_among_b_11(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x646) break;
+        i = 0;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_11[i].s_size;
+    return a_11[i].result;
+}
+
+static int find_among_b_16(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x64A) break;
+        i = 0;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_16[i].s_size;
+    return a_16[i].result;
+}
+
+static int find_among_b_21(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x649) break;
+        i = 0;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_21[i].s_size;
+    return a_21[i].result;
+}
+static const symbol s_0[] = { 0x64A };
+
+static int find_among_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[0] != 0x623) break;
+        if (n <= 1) break;
+        switch (q[1]) {
+            case 0x622:
+                i = 0;
+                break;
+            case 0x623:
+                i = 1;
+                break;
+            case 0x624:
+                i = 2;
+                break;
+            case 0x625:
+                i = 3;
+                break;
+            case 0x627:
+                i = 4;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_4[i].s_size;
+    return a_4[i].result;
+}
+static const symbol s_1[] = { 0x623 };
+static const symbol s_2[] = { 0x622 };
+static const symbol s_3[] = { 0x627 };
+static const symbol s_4[] = { 0x625 };
+
+static int find_among_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 0x641:
+                i = 0;
+                break;
+            case 0x648:
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_5[i].s_size;
+    return a_5[i].result;
+}
+
+static int find_among_6(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 0x627:
+                if (n <= 1) break;
+                if (q[1] != 0x644) break;
+                i = 0;
+                break;
+            case 0x628:
+                if (n <= 1) break;
+                if (q[1] != 0x627) break;
+                if (n <= 2) break;
+                if (q[2] != 0x644) break;
+                i = 1;
+                break;
+            case 0x643:
+                if (n <= 1) break;
+                if (q[1] != 0x627) break;
+                if (n <= 2) break;
+                if (q[2] != 0x644) break;
+                i = 2;
+                break;
+            case 0x644:
+                if (n <= 1) break;
+                if (q[1] != 0x644) break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_6[i].s_size;
+    return a_6[i].result;
+}
+
+static int find_among_7(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 0x628:
+                i = 0;
+                if (n <= 1) break;
+                switch (q[1]) {
+                    case 0x627:
+                        i = 1;
+                        break;
+                    case 0x628:
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0x643:
+                if (n <= 1) break;
+                if (q[1] != 0x643) break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_7[i].s_size;
+    return a_7[i].result;
+}
+static const symbol s_5[] = { 0x628 };
+static const symbol s_6[] = { 0x643 };
+
+static int find_among_8(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[0] != 0x633) break;
+        if (n <= 1) break;
+        switch (q[1]) {
+            case 0x623:
+                i = 0;
+                break;
+            case 0x62A:
+                i = 1;
+                break;
+            case 0x646:
+                i = 2;
+                break;
+            case 0x64A:
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_8[i].s_size;
+    return a_8[i].result;
+}
+static const symbol s_7[] = { 0x64A };
+static const symbol s_8[] = { 0x62A };
+static const symbol s_9[] = { 0x646 };
+static const symbol s_10[] = { 0x623 };
+
+static int find_among_9(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 0x62A:
+                if (n <= 1) break;
+                if (q[1] != 0x633) break;
+                if (n <= 2) break;
+                if (q[2] != 0x62A) break;
+                i = 0;
+                break;
+            case 0x646:
+                if (n <= 1) break;
+                if (q[1] != 0x633) break;
+                if (n <= 2) break;
+                if (q[2] != 0x62A) break;
+                i = 1;
+                break;
+            case 0x64A:
+                if (n <= 1) break;
+                if (q[1] != 0x633) break;
+                if (n <= 2) break;
+                if (q[2] != 0x62A) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_9[i].s_size;
+    return a_9[i].result;
+}
+static const symbol s_11[] = { 0x627, 0x633, 0x62A };
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x622:
+                i = 0;
+                break;
+            case 0x623:
+                i = 1;
+                break;
+            case 0x624:
+                i = 2;
+                break;
+            case 0x625:
+                i = 3;
+                break;
+            case 0x626:
+                i = 4;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+static const symbol s_12[] = { 0x621 };
+
+static int r_Suffix_Noun_Step2a(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c <= z->lb) return 0;
+    if (!(find_among_b_12(z))) return 0;
+    z->bra = z->c;
+    if (!(SIZE(z->p) > 4)) return 0;
+    {   int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_Suffix_Noun_Step2b(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c - 1 <= z->lb || z->p[z->c - 1] != 1578 || z->p[z->c - 2] != 1575) return 0;
+    if (!(find_among_b_13(z))) return 0;
+    z->bra = z->c;
+    if (!(SIZE(z->p) >= 5)) return 0;
+    {   int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_Suffix_Noun_Step2c1(struct SN_env * z) {
+    z->ket = z->c;
+    if (z->c <= z->lb || z->p[z->c - 1] != 1578) return 0;
+    if (!(find_among_b_14(z))) return 0;
+    z->bra = z->c;
+    if (!(SIZE(z->p) >= 4)) return 0;
+    {   int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    return 1;
+}
+
+static int r_Suffix_Verb_Step2a(struct SN_env * z) {
+    int among_var;
+    z->ket = z->c;
+    if (z->c <= z->lb) return 0;
+    among_var = find_among_b_18(z);
+    if (!(among_var)) return 0;
+    z->bra = z->c;
+    switch (among_var) {
+        case 1:
+            if (!(SIZE(z->p) >= 4)) return 0;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 2:
+            if (!(SIZE(z->p) >= 5)) return 0;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 3:
+            if (!(SIZE(z->p) > 5)) return 0;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 4:
+            if (!(SIZE(z->p) >= 6)) return 0;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            break;
+    }
+    return 1;
+}
+
+extern int arabic_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    z->I[2] = 1;
+    z->I[1] = 1;
+    z->I[0] = 0;
+    {   int c1 = z->c;
+        z->bra = z->c;
+        if (z->c + 1 >= z->l || (z->p[z->c + 1] != 1575 && z->p[z->c + 1] != 1604)) goto lab0;
+        among_var = find_among_3(z);
+        if (!(among_var)) goto lab0;
+        z->ket = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(SIZE(z->p) > 4)) goto lab0;
+                z->I[2] = 1;
+                z->I[1] = 0;
+                z->I[0] = 1;
+                break;
+            case 2:
+                if (!(SIZE(z->p) > 3)) goto lab0;
+                z->I[2] = 1;
+                z->I[1] = 0;
+                z->I[0] = 1;
+                break;
+        }
+    lab0:
+        z->c = c1;
+    }
+    
+    {   int c2 = z->c;
+        {   int ret = translate(z, &a_0_translation);
+            if (ret < 0) return ret;
+        }
+        z->c = c2;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m3 = z->l - z->c; (void)m3;
+        {   int m4 = z->l - z->c; (void)m4;
+            if (!(z->I[1])) goto lab5;
+            {   int m5 = z->l - z->c; (void)m5;
+                {   int i = 1;
+                    while(1) {
+                        int m6 = z->l - z->c; (void)m6;
+                        z->ket = z->c;
+                        if (z->c <= z->lb) goto lab8;
+                        among_var = find_among_b_17(z);
+                        if (!(among_var)) goto lab8;
+                        z->bra = z->c;
+                        switch (among_var) {
+                            case 1:
+                                if (!(SIZE(z->p) >= 4)) goto lab8;
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                break;
+                            case 2:
+                                if (!(SIZE(z->p) >= 5)) goto lab8;
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                break;
+                            case 3:
+                                if (!(SIZE(z->p) >= 6)) goto lab8;
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                break;
+                        }
+                        i--;
+                        continue;
+                    lab8:
+                        z->c = z->l - m6;
+                        break;
+                    }
+                    if (i > 0) goto lab7;
+                }
+                {   int m7 = z->l - z->c; (void)m7;
+                    {   int ret = r_Suffix_Verb_Step2a(z);
+                        if (ret == 0) goto lab10;
+                        if (ret < 0) return ret;
+                    }
+                    goto lab9;
+                lab10:
+                    z->c = z->l - m7;
+                    z->ket = z->c;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 1608) goto lab11;
+                    among_var = find_among_b_20(z);
+                    if (!(among_var)) goto lab11;
+                    z->bra = z->c;
+                    switch (among_var) {
+                        case 1:
+                            if (!(SIZE(z->p) >= 4)) goto lab11;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 2:
+                            if (!(SIZE(z->p) >= 6)) goto lab11;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                    }
+                    goto lab9;
+                lab11:
+                    z->c = z->l - m7;
+                    if (z->c <= z->lb) goto lab7;
+                    z->c--;
+                }
+            lab9:
+                goto lab6;
+            lab7:
+                z->c = z->l - m5;
+                z->ket = z->c;
+                if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 1575 && z->p[z->c - 1] != 1605) || (z->p[z->c - 2] != 1578 && z->p[z->c - 2] != 1608)) goto lab12;
+                if (!(find_among_b_19(z))) goto lab12;
+                z->bra = z->c;
+                if (!(SIZE(z->p) >= 5)) goto lab12;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                goto lab6;
+            lab12:
+                z->c = z->l - m5;
+                {   int ret = r_Suffix_Verb_Step2a(z);
+                    if (ret == 0) goto lab5;
+                    if (ret < 0) return ret;
+                }
+            }
+        lab6:
+            goto lab4;
+        lab5:
+            z->c = z->l - m4;
+            if (!(z->I[2])) goto lab13;
+            {   int m8 = z->l - z->c; (void)m8;
+                {   int m9 = z->l - z->c; (void)m9;
+                    z->ket = z->c;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 1577) goto lab16;
+                    if (!(find_among_b_15(z))) goto lab16;
+                    z->bra = z->c;
+                    if (!(SIZE(z->p) >= 4)) goto lab16;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    goto lab15;
+                lab16:
+                    z->c = z->l - m9;
+                    
+                    if (!(z->I[0])) goto lab18;
+                    goto lab17;
+                lab18:
+                    z->ket = z->c;
+                    if (z->c <= z->lb) goto lab17;
+                    among_var = find_among_b_10(z);
+                    if (!(among_var)) goto lab17;
+                    z->bra = z->c;
+                    switch (among_var) {
+                        case 1:
+                            if (!(SIZE(z->p) >= 4)) goto lab17;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 2:
+                            if (!(SIZE(z->p) >= 5)) goto lab17;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 3:
+                            if (!(SIZE(z->p) >= 6)) goto lab17;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                    }
+                    {   int m10 = z->l - z->c; (void)m10;
+                        {   int ret = r_Suffix_Noun_Step2a(z);
+                            if (ret == 0) goto lab20;
+                            if (ret < 0) return ret;
+                        }
+                        goto lab19;
+                    lab20:
+                        z->c = z->l - m10;
+                        {   int ret = r_Suffix_Noun_Step2b(z);
+                            if (ret == 0) goto lab21;
+                            if (ret < 0) return ret;
+                        }
+                        goto lab19;
+                    lab21:
+                        z->c = z->l - m10;
+                        {   int ret = r_Suffix_Noun_Step2c1(z);
+                            if (ret == 0) goto lab22;
+                            if (ret < 0) return ret;
+                        }
+                        goto lab19;
+                    lab22:
+                        z->c = z->l - m10;
+                        if (z->c <= z->lb) goto lab17;
+                        z->c--;
+                    }
+                lab19:
+                    goto lab15;
+                lab17:
+                    z->c = z->l - m9;
+                    z->ket = z->c;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 1606) goto lab23;
+                    if (!(find_among_b_11(z))) goto lab23;
+                    z->bra = z->c;
+                    if (!(SIZE(z->p) > 5)) goto lab23;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int m11 = z->l - z->c; (void)m11;
+                        {   int ret = r_Suffix_Noun_Step2a(z);
+                            if (ret == 0) goto lab25;
+                            if (ret < 0) return ret;
+                        }
+                        goto lab24;
+                    lab25:
+                        z->c = z->l - m11;
+                        {   int ret = r_Suffix_Noun_Step2b(z);
+                            if (ret == 0) goto lab26;
+                            if (ret < 0) return ret;
+                        }
+                        goto lab24;
+                    lab26:
+                        z->c = z->l - m11;
+                        {   int ret = r_Suffix_Noun_Step2c1(z);
+                            if (ret == 0) goto lab23;
+                            if (ret < 0) return ret;
+                        }
+                    }
+                lab24:
+                    goto lab15;
+                lab23:
+                    z->c = z->l - m9;
+                    
+                    if (!(z->I[0])) goto lab28;
+                    goto lab27;
+                lab28:
+                    {   int ret = r_Suffix_Noun_Step2a(z);
+                        if (ret == 0) goto lab27;
+                        if (ret < 0) return ret;
+                    }
+                    goto lab15;
+                lab27:
+                    z->c = z->l - m9;
+                    {   int ret = r_Suffix_Noun_Step2b(z);
+                        if (ret == 0) { z->c = z->l - m8; goto lab14; }
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab15:
+            lab14:
+                ;
+            }
+            z->ket = z->c;
+            if (z->c <= z->lb || z->p[z->c - 1] != 1610) goto lab13;
+            if (!(find_among_b_16(z))) goto lab13;
+            z->bra = z->c;
+            if (!(SIZE(z->p) >= 3)) goto lab13;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            goto lab4;
+        lab13:
+            z->c = z->l - m4;
+            z->ket = z->c;
+            if (z->c <= z->lb || z->p[z->c - 1] != 1609) goto lab3;
+            if (!(find_among_b_21(z))) goto lab3;
+            z->bra = z->c;
+            {   int ret = slice_from_s(z, 1, s_0);
+                if (ret < 0) return ret;
+            }
+        }
+    lab4:
+    lab3:
+        z->c = z->l - m3;
+    }
+    z->c = z->lb;
+    {   int c12 = z->c;
+        {   int c13 = z->c;
+            z->bra = z->c;
+            if (z->c + 1 >= z->l || z->p[z->c + 1] >> 5 != 49 || !((188 >> (z->p[z->c + 1] & 0x1f)) & 1)) { z->c = c13; goto lab30; }
+            among_var = find_among_4(z);
+            if (!(among_var)) { z->c = c13; goto lab30; }
+            z->ket = z->c;
+            switch (among_var) {
+                case 1:
+                    if (!(SIZE(z->p) > 3)) { z->c = c13; goto lab30; }
+                    {   int ret = slice_from_s(z, 1, s_1);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    if (!(SIZE(z->p) > 3)) { z->c = c13; goto lab30; }
+                    {   int ret = slice_from_s(z, 1, s_2);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 3:
+                    if (!(SIZE(z->p) > 3)) { z->c = c13; goto lab30; }
+                    {   int ret = slice_from_s(z, 1, s_3);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 4:
+                    if (!(SIZE(z->p) > 3)) { z->c = c13; goto lab30; }
+                    {   int ret = slice_from_s(z, 1, s_4);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+        lab30:
+            ;
+        }
+        {   int c14 = z->c;
+            z->bra = z->c;
+            if (z->c >= z->l || (z->p[z->c + 0] != 1601 && z->p[z->c + 0] != 1608)) { z->c = c14; goto lab31; }
+            if (!(find_among_5(z))) { z->c = c14; goto lab31; }
+            z->ket = z->c;
+            if (!(SIZE(z->p) > 3)) { z->c = c14; goto lab31; }
+            {   int c15 = z->c;
+                if (z->c == z->l || z->p[z->c] != 0x627) goto lab32;
+                z->c++;
+                { z->c = c14; goto lab31; }
+            lab32:
+                z->c = c15;
+            }
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        lab31:
+            ;
+        }
+        {   int c16 = z->c;
+            z->bra = z->c;
+            if (z->c + 1 >= z->l || (z->p[z->c + 1] != 1575 && z->p[z->c + 1] != 1604)) goto lab34;
+            among_var = find_among_6(z);
+            if (!(among_var)) goto lab34;
+            z->ket = z->c;
+            switch (among_var) {
+                case 1:
+                    if (!(SIZE(z->p) > 5)) goto lab34;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    if (!(SIZE(z->p) > 4)) goto lab34;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+            goto lab33;
+        lab34:
+            z->c = c16;
+            if (!(z->I[2])) goto lab35;
+            z->bra = z->c;
+            if (z->c >= z->l || (z->p[z->c + 0] != 1576 && z->p[z->c + 0] != 1603)) goto lab35;
+            among_var = find_among_7(z);
+            if (!(among_var)) goto lab35;
+            z->ket = z->c;
+            switch (among_var) {
+                case 1:
+                    if (!(SIZE(z->p) > 3)) goto lab35;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    if (!(SIZE(z->p) > 3)) goto lab35;
+                    {   int ret = slice_from_s(z, 1, s_5);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 3:
+                    if (!(SIZE(z->p) > 3)) goto lab35;
+                    {   int ret = slice_from_s(z, 1, s_6);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+            goto lab33;
+        lab35:
+            z->c = c16;
+            if (!(z->I[1])) goto lab29;
+            {   int c17 = z->c;
+                z->bra = z->c;
+                if (z->c + 1 >= z->l) { z->c = c17; goto lab36; }
+                among_var = find_among_8(z);
+                if (!(among_var)) { z->c = c17; goto lab36; }
+                z->ket = z->c;
+                switch (among_var) {
+                    case 1:
+                        if (!(SIZE(z->p) > 4)) { z->c = c17; goto lab36; }
+                        {   int ret = slice_from_s(z, 1, s_7);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        if (!(SIZE(z->p) > 4)) { z->c = c17; goto lab36; }
+                        {   int ret = slice_from_s(z, 1, s_8);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 3:
+                        if (!(SIZE(z->p) > 4)) { z->c = c17; goto lab36; }
+                        {   int ret = slice_from_s(z, 1, s_9);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 4:
+                        if (!(SIZE(z->p) > 4)) { z->c = c17; goto lab36; }
+                        {   int ret = slice_from_s(z, 1, s_10);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+            lab36:
+                ;
+            }
+            z->bra = z->c;
+            if (z->c + 2 >= z->l || z->p[z->c + 2] != 1578) goto lab29;
+            if (!(find_among_9(z))) goto lab29;
+            z->ket = z->c;
+            if (!(SIZE(z->p) > 4)) goto lab29;
+            z->I[1] = 1;
+            z->I[2] = 0;
+            {   int ret = slice_from_s(z, 3, s_11);
+                if (ret < 0) return ret;
+            }
+        }
+    lab33:
+    lab29:
+        z->c = c12;
+    }
+    
+    {   int c18 = z->c;
+        z->lb = z->c; z->c = z->l;
+
+        z->ket = z->c;
+        if (z->c <= z->lb || z->p[z->c - 1] >> 5 != 49 || !((124 >> (z->p[z->c - 1] & 0x1f)) & 1)) goto lab38;
+        if (!(find_among_b_1(z))) goto lab38;
+        z->bra = z->c;
+        {   int ret = slice_from_s(z, 1, s_12);
+            if (ret < 0) return ret;
+        }
+        z->c = z->lb;
+    lab38:
+        z->c = c18;
+    }
+    {   int c19 = z->c;
+        {   int ret = translate(z, &a_2_translation);
+            if (ret < 0) return ret;
+        }
+        z->c = c19;
+    }
+    return 1;
+}
+
+extern struct SN_env * arabic_UTF_8_create_env(void) { return SN_create_env(0, 3); }
+
+extern void arabic_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
@@ -0,0 +1,1498 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int armenian_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * armenian_UTF_8_create_env(void);
+extern void armenian_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[23] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 5, 0, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 8, 1 },
+{ 0, 4, 8, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 12, 1 },
+{ 0, 4, 12, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 }
+};
+
+
+static const struct among a_1[71] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 3, 0, 1 },
+{ 0, 3, 0, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 6, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 8, 1 },
+{ 0, 4, 8, 1 },
+{ 0, 4, 8, 1 },
+{ 0, 5, 8, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 13, 1 },
+{ 0, 3, 13, 1 },
+{ 0, 4, 15, 1 },
+{ 0, 5, 16, 1 },
+{ 0, 3, 13, 1 },
+{ 0, 3, 13, 1 },
+{ 0, 5, 19, 1 },
+{ 0, 5, 19, 1 },
+{ 0, 3, 13, 1 },
+{ 0, 4, 22, 1 },
+{ 0, 4, 22, 1 },
+{ 0, 5, 24, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 27, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 29, 1 },
+{ 0, 4, 30, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 34, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 38, 1 },
+{ 0, 4, 38, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 43, 1 },
+{ 0, 4, 43, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 48, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 51, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 57, 1 },
+{ 0, 4, 58, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, 62, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 64, 1 },
+{ 0, 5, 65, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, 69, 1 }
+};
+
+
+static const struct among a_2[40] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 5, 1 },
+{ 0, 4, 5, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 10, 1 },
+{ 0, 4, 10, 1 },
+{ 0, 4, 10, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 7, 15, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 22, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 3, 27, 1 },
+{ 0, 2, 27, 1 },
+{ 0, 4, 29, 1 },
+{ 0, 4, 29, 1 },
+{ 0, 4, 27, 1 },
+{ 0, 4, 27, 1 },
+{ 0, 3, 27, 1 },
+{ 0, 3, 27, 1 },
+{ 0, 4, 27, 1 },
+{ 0, 5, 36, 1 },
+{ 0, 3, 27, 1 },
+{ 0, 3, 27, 1 }
+};
+
+
+static const struct among a_3[57] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 3, 3, 1 },
+{ 0, 7, 4, 1 },
+{ 0, 4, 4, 1 },
+{ 0, 3, 3, 1 },
+{ 0, 3, 3, 1 },
+{ 0, 4, 8, 1 },
+{ 0, 3, 3, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 3, 11, 1 },
+{ 0, 7, 12, 1 },
+{ 0, 4, 12, 1 },
+{ 0, 3, 11, 1 },
+{ 0, 3, 11, 1 },
+{ 0, 4, 16, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 18, 1 },
+{ 0, 3, 18, 1 },
+{ 0, 4, 20, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, 23, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 25, 1 },
+{ 0, 6, 26, 1 },
+{ 0, 3, 26, 1 },
+{ 0, 2, 25, 1 },
+{ 0, 4, 29, 1 },
+{ 0, 5, 30, 1 },
+{ 0, 7, 25, 1 },
+{ 0, 3, 25, 1 },
+{ 0, 4, 33, 1 },
+{ 0, 3, 25, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 40, 1 },
+{ 0, 3, 40, 1 },
+{ 0, 4, 40, 1 },
+{ 0, 5, 43, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 45, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 47, 1 },
+{ 0, 5, 48, 1 },
+{ 0, 4, 48, 1 },
+{ 0, 3, 48, 1 },
+{ 0, 4, 48, 1 },
+{ 0, 5, 52, 1 },
+{ 0, 3, 48, 1 },
+{ 0, 2, 47, 1 },
+{ 0, 3, 47, 1 }
+};
+
+static const unsigned char g_v[] = { 209, 4, 128, 0, 18 };
+
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x561:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x57D:
+                        i = 0;
+                        break;
+                    case 0x57E:
+                        i = 1;
+                        break;
+                }
+                break;
+            case 0x562:
+                if (n <= 1) break;
+                if (q[-2] != 0x574) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x561) break;
+                i = 2;
+                break;
+            case 0x564:
+                i = 3;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x576:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x561) break;
+                        i = 4;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x575:
+                                if (n <= 4) break;
+                                if (q[-5] != 0x569) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x582) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x578) break;
+                                i = 5;
+                                break;
+                            case 0x57E:
+                                i = 6;
+                                break;
+                        }
+                        break;
+                    case 0x57B:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x578) break;
+                        i = 7;
+                        break;
+                    case 0x580:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x565) break;
+                        i = 8;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x576) break;
+                        i = 9;
+                        break;
+                    case 0x582:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x578) break;
+                        i = 10;
+                        break;
+                }
+                break;
+            case 0x568:
+                i = 11;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x576:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x561) break;
+                        i = 12;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x575:
+                                if (n <= 4) break;
+                                if (q[-5] != 0x569) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x582) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x578) break;
+                                i = 13;
+                                break;
+                            case 0x57E:
+                                i = 14;
+                                break;
+                        }
+                        break;
+                    case 0x57B:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x578) break;
+                        i = 15;
+                        break;
+                    case 0x580:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x565) break;
+                        i = 16;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x576) break;
+                        i = 17;
+                        break;
+                }
+                break;
+            case 0x56B:
+                i = 18;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x57E:
+                        i = 19;
+                        break;
+                    case 0x580:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x565) break;
+                        i = 20;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x576) break;
+                        i = 21;
+                        break;
+                }
+                break;
+            case 0x574:
+                if (n <= 1) break;
+                if (q[-2] != 0x582) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x578) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x576:
+                        if (n <= 4) break;
+                        if (q[-5] != 0x561) break;
+                        i = 22;
+                        break;
+                    case 0x580:
+                        if (n <= 4) break;
+                        if (q[-5] != 0x565) break;
+                        i = 23;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x576) break;
+                        i = 24;
+                        break;
+                }
+                break;
+            case 0x576:
+                i = 25;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x561:
+                        i = 26;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x575:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x569) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x582) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x578) break;
+                                i = 27;
+                                break;
+                            case 0x57E:
+                                i = 28;
+                                break;
+                        }
+                        break;
+                    case 0x56B:
+                        i = 29;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x580) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x565) break;
+                        i = 30;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x576) break;
+                        i = 31;
+                        break;
+                    case 0x576:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x561) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x575) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x569) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x582) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x578) break;
+                        i = 32;
+                        break;
+                    case 0x580:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x565) break;
+                        i = 33;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x576) break;
+                        i = 34;
+                        break;
+                    case 0x582:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x578) break;
+                        i = 35;
+                        break;
+                }
+                break;
+            case 0x57B:
+                if (n <= 1) break;
+                if (q[-2] != 0x578) break;
+                i = 36;
+                break;
+            case 0x57D:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x576:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x561) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x575:
+                                if (n <= 4) break;
+                                if (q[-5] != 0x569) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x582) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x578) break;
+                                i = 37;
+                                break;
+                            case 0x57E:
+                                i = 38;
+                                break;
+                        }
+                        break;
+                    case 0x57B:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x578) break;
+                        i = 39;
+                        break;
+                }
+                break;
+            case 0x57E:
+                if (n <= 1) break;
+                if (q[-2] != 0x578) break;
+                i = 40;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x576:
+                        if (n <= 3) break;
+                        if (q[-4] != 0x561) break;
+                        i = 41;
+                        break;
+                    case 0x57E:
+                        i = 42;
+                        break;
+                    case 0x580:
+                        if (n <= 3) break;
+                        if (q[-4] != 0x565) break;
+                        i = 43;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x576) break;
+                        i = 44;
+                        break;
+                }
+                break;
+            case 0x580:
+                if (n <= 1) break;
+                if (q[-2] != 0x565) break;
+                i = 45;
+                if (n <= 2) break;
+                if (q[-3] != 0x576) break;
+                i = 46;
+                break;
+            case 0x581:
+                i = 47;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x56B:
+                        i = 48;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x576:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x561) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x57E) break;
+                                i = 49;
+                                break;
+                            case 0x57B:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x578) break;
+                                i = 50;
+                                break;
+                            case 0x57E:
+                                i = 51;
+                                break;
+                            case 0x580:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x565) break;
+                                i = 52;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x576) break;
+                                i = 53;
+                                break;
+                            case 0x581:
+                                i = 54;
+                                break;
+                        }
+                        break;
+                    case 0x578:
+                        i = 55;
+                        break;
+                    case 0x582:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x578) break;
+                        i = 56;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x561:
+                i = 0;
+                if (n <= 1) break;
+                if (q[-2] != 0x581) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x561:
+                        i = 1;
+                        break;
+                    case 0x565:
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0x565:
+                if (n <= 1) break;
+                if (q[-2] != 0x57E) break;
+                i = 3;
+                break;
+            case 0x56B:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x580:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x581) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x561) break;
+                        i = 4;
+                        break;
+                    case 0x581:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x561:
+                                i = 5;
+                                break;
+                            case 0x565:
+                                i = 6;
+                                if (n <= 3) break;
+                                if (q[-4] != 0x57E) break;
+                                i = 7;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x56C:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x561:
+                        i = 8;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x568:
+                                i = 9;
+                                break;
+                            case 0x576:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x561:
+                                        i = 10;
+                                        break;
+                                    case 0x565:
+                                        i = 11;
+                                        break;
+                                    case 0x581:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x561) break;
+                                        i = 12;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x565:
+                        i = 13;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x568:
+                                i = 14;
+                                break;
+                            case 0x576:
+                                i = 15;
+                                if (n <= 3) break;
+                                if (q[-4] != 0x581) break;
+                                i = 16;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x565) break;
+                                i = 17;
+                                break;
+                            case 0x579:
+                                i = 18;
+                                break;
+                            case 0x57E:
+                                i = 19;
+                                if (n <= 3) break;
+                                if (q[-4] != 0x581) break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 0x561:
+                                        i = 20;
+                                        break;
+                                    case 0x565:
+                                        i = 21;
+                                        break;
+                                }
+                                break;
+                            case 0x57F:
+                                i = 22;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x561:
+                                        i = 23;
+                                        break;
+                                    case 0x578:
+                                        i = 24;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x56F) break;
+                                        i = 25;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x56E:
+                if (n <= 1) break;
+                if (q[-2] != 0x561) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x57E) break;
+                i = 26;
+                break;
+            case 0x574:
+                if (n <= 1) break;
+                if (q[-2] != 0x582) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x578) break;
+                i = 27;
+                if (n <= 3) break;
+                if (q[-4] != 0x57E) break;
+                i = 28;
+                break;
+            case 0x576:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x561:
+                        i = 29;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x581) break;
+                        i = 30;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x561) break;
+                        i = 31;
+                        break;
+                    case 0x56B:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x580:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x581) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x561) break;
+                                i = 32;
+                                break;
+                            case 0x581:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x561:
+                                        i = 33;
+                                        break;
+                                    case 0x565:
+                                        i = 34;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x57E) break;
+                                        i = 35;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x57D:
+                if (n <= 1) break;
+                if (q[-2] != 0x56B) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x56C) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x561:
+                        i = 36;
+                        break;
+                    case 0x565:
+                        i = 37;
+                        break;
+                }
+                break;
+            case 0x57E:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x561:
+                        i = 38;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x581) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x561:
+                                i = 39;
+                                break;
+                            case 0x565:
+                                i = 40;
+                                break;
+                        }
+                        break;
+                    case 0x578:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x56C) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x561:
+                                i = 41;
+                                break;
+                            case 0x565:
+                                i = 42;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x580:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x561:
+                        i = 43;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x581) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x561:
+                                i = 44;
+                                break;
+                            case 0x565:
+                                i = 45;
+                                break;
+                        }
+                        break;
+                    case 0x56B:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x580:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x581) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x561) break;
+                                i = 46;
+                                break;
+                            case 0x581:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x561:
+                                        i = 47;
+                                        break;
+                                    case 0x565:
+                                        i = 48;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x57E) break;
+                                        i = 49;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x581:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x561:
+                        i = 50;
+                        break;
+                    case 0x565:
+                        i = 51;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x580) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x581) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x561) break;
+                        i = 52;
+                        break;
+                    case 0x582:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x578) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x56C) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x561:
+                                i = 53;
+                                break;
+                            case 0x565:
+                                i = 54;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x582:
+                if (n <= 1) break;
+                if (q[-2] != 0x578) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x56C) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x561:
+                        i = 55;
+                        break;
+                    case 0x565:
+                        i = 56;
+                        break;
+                }
+                break;
+            case 0x584:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x561:
+                        i = 57;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x581) break;
+                        i = 58;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x561) break;
+                        i = 59;
+                        break;
+                    case 0x56B:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x580:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x581) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x561) break;
+                                i = 60;
+                                break;
+                            case 0x581:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x561:
+                                        i = 61;
+                                        break;
+                                    case 0x565:
+                                        i = 62;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x57E) break;
+                                        i = 63;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x576:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x561:
+                                i = 64;
+                                if (n <= 3) break;
+                                if (q[-4] != 0x581) break;
+                                i = 65;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x561) break;
+                                i = 66;
+                                break;
+                            case 0x56B:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x580:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x581) break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0x561) break;
+                                        i = 67;
+                                        break;
+                                    case 0x581:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 0x561:
+                                                i = 68;
+                                                break;
+                                            case 0x565:
+                                                i = 69;
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0x57E) break;
+                                                i = 70;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x564:
+                if (n <= 1) break;
+                if (q[-2] != 0x580) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x578) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x580) break;
+                i = 0;
+                if (n <= 4) break;
+                if (q[-5] != 0x565) break;
+                i = 1;
+                break;
+            case 0x56B:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x56C:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x561) break;
+                        i = 2;
+                        break;
+                    case 0x56F:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x561) break;
+                        i = 3;
+                        break;
+                }
+                break;
+            case 0x56F:
+                if (n <= 1) break;
+                if (q[-2] != 0x561) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x580) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x578) break;
+                i = 4;
+                break;
+            case 0x572:
+                if (n <= 1) break;
+                if (q[-2] != 0x565) break;
+                i = 5;
+                break;
+            case 0x576:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x561:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x56F:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x561) break;
+                                i = 6;
+                                break;
+                            case 0x580:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x561) break;
+                                i = 7;
+                                break;
+                        }
+                        break;
+                    case 0x565:
+                        i = 8;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x56F:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x565) break;
+                                i = 9;
+                                break;
+                            case 0x580:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x565) break;
+                                i = 10;
+                                break;
+                        }
+                        break;
+                    case 0x567:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x580) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x578) break;
+                        i = 11;
+                        break;
+                    case 0x56B:
+                        i = 12;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x563:
+                                i = 13;
+                                break;
+                            case 0x57E:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x578) break;
+                                i = 14;
+                                break;
+                        }
+                        break;
+                    case 0x575:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x561) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x56C) break;
+                        i = 15;
+                        break;
+                    case 0x582:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x578) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x57E) break;
+                        i = 16;
+                        break;
+                }
+                break;
+            case 0x57D:
+                if (n <= 1) break;
+                if (q[-2] != 0x565) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x57A) break;
+                i = 17;
+                break;
+            case 0x57E:
+                if (n <= 1) break;
+                if (q[-2] != 0x56B) break;
+                i = 18;
+                break;
+            case 0x57F:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x561:
+                        i = 19;
+                        break;
+                    case 0x565:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x57E) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x561) break;
+                        i = 20;
+                        break;
+                    case 0x578:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x56F) break;
+                        i = 21;
+                        break;
+                }
+                break;
+            case 0x580:
+                if (n <= 1) break;
+                if (q[-2] != 0x561) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x562) break;
+                i = 22;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_0[i].s_size;
+    return a_0[i].result;
+}
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x564:
+                if (n <= 1) break;
+                if (q[-2] != 0x580) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x578) break;
+                i = 0;
+                break;
+            case 0x569:
+                if (n <= 1) break;
+                if (q[-2] != 0x575) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x582) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x578) break;
+                i = 1;
+                break;
+            case 0x56B:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x570:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x582) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x578) break;
+                        i = 2;
+                        break;
+                    case 0x581:
+                        i = 3;
+                        break;
+                }
+                break;
+            case 0x56C:
+                if (n <= 1) break;
+                if (q[-2] != 0x56B) break;
+                i = 4;
+                break;
+            case 0x56F:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x561:
+                        i = 5;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x575:
+                                i = 6;
+                                break;
+                            case 0x576:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x561) break;
+                                i = 7;
+                                break;
+                        }
+                        break;
+                    case 0x56B:
+                        i = 8;
+                        break;
+                    case 0x582:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x578) break;
+                        i = 9;
+                        break;
+                }
+                break;
+            case 0x576:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x561:
+                        i = 10;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x57A:
+                                i = 11;
+                                break;
+                            case 0x57F:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x57D) break;
+                                i = 12;
+                                break;
+                            case 0x580:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x561) break;
+                                i = 13;
+                                break;
+                        }
+                        break;
+                    case 0x567:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x572) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x565) break;
+                        i = 14;
+                        break;
+                    case 0x582:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x578) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x575) break;
+                        i = 15;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x569) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x582) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x578) break;
+                        i = 16;
+                        break;
+                }
+                break;
+            case 0x578:
+                if (n <= 1) break;
+                if (q[-2] != 0x56E) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x561) break;
+                i = 17;
+                break;
+            case 0x579:
+                if (n <= 1) break;
+                if (q[-2] != 0x56B) break;
+                i = 18;
+                break;
+            case 0x57D:
+                if (n <= 1) break;
+                if (q[-2] != 0x582) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x578) break;
+                i = 19;
+                break;
+            case 0x57F:
+                if (n <= 1) break;
+                if (q[-2] != 0x57D) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x582) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x578) break;
+                i = 20;
+                break;
+            case 0x580:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x561:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x563) break;
+                        i = 21;
+                        break;
+                    case 0x578:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x57E) break;
+                        i = 22;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x561) break;
+                        i = 23;
+                        break;
+                }
+                break;
+            case 0x581:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x578:
+                        i = 24;
+                        break;
+                    case 0x585:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x576) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x561) break;
+                        i = 25;
+                        break;
+                }
+                break;
+            case 0x582:
+                if (n <= 1) break;
+                if (q[-2] != 0x578) break;
+                i = 26;
+                break;
+            case 0x584:
+                i = 27;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x565:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x579) break;
+                        i = 28;
+                        break;
+                    case 0x56B:
+                        i = 29;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x56C:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x561) break;
+                                i = 30;
+                                break;
+                            case 0x576:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x561) break;
+                                i = 31;
+                                break;
+                        }
+                        break;
+                    case 0x56E:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x561) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x57E) break;
+                        i = 32;
+                        break;
+                    case 0x575:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x582) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x578) break;
+                        i = 33;
+                        break;
+                    case 0x576:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x565:
+                                i = 34;
+                                break;
+                            case 0x578:
+                                i = 35;
+                                break;
+                            case 0x582:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x578) break;
+                                i = 36;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x574) break;
+                                i = 37;
+                                break;
+                        }
+                        break;
+                    case 0x579:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x56B) break;
+                        i = 38;
+                        break;
+                    case 0x580:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x561) break;
+                        i = 39;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+
+extern int armenian_UTF_8_stem(struct SN_env * z) {
+    
+    z->I[1] = z->l;
+    z->I[0] = z->l;
+    {   int c1 = z->c;
+        {   
+            int ret = out_grouping(z, g_v, 1377, 1413, 1);
+            if (ret < 0) goto lab1;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+        {   
+            int ret = in_grouping(z, g_v, 1377, 1413, 1);
+            if (ret < 0) goto lab1;
+            z->c += ret;
+        }
+        {   
+            int ret = out_grouping(z, g_v, 1377, 1413, 1);
+            if (ret < 0) goto lab1;
+            z->c += ret;
+        }
+        {   
+            int ret = in_grouping(z, g_v, 1377, 1413, 1);
+            if (ret < 0) goto lab1;
+            z->c += ret;
+        }
+        z->I[0] = z->c;
+    lab1:
+        z->c = c1;
+    }
+    z->lb = z->c; z->c = z->l;
+
+
+    {   int mlimit2;
+        if (z->c < z->I[1]) return 0;
+        mlimit2 = z->lb; z->lb = z->I[1];
+        {   int m3 = z->l - z->c; (void)m3;
+            z->ket = z->c;
+            if (z->c <= z->lb) goto lab2;
+            if (!(find_among_b_3(z))) goto lab2;
+            z->bra = z->c;
+            if (!(z->I[0] <= z->c)) goto lab2;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        lab2:
+            z->c = z->l - m3;
+        }
+        {   int m4 = z->l - z->c; (void)m4;
+            z->ket = z->c;
+            if (z->c <= z->lb) goto lab3;
+            if (!(find_among_b_1(z))) goto lab3;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        lab3:
+            z->c = z->l - m4;
+        }
+        {   int m5 = z->l - z->c; (void)m5;
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb) goto lab4;
+            if (!(find_among_b_0(z))) goto lab4;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        lab4:
+            z->c = z->l - m5;
+        }
+        {   int m6 = z->l - z->c; (void)m6;
+            z->ket = z->c;
+            if (z->c <= z->lb) goto lab5;
+            if (!(find_among_b_2(z))) goto lab5;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        lab5:
+            z->c = z->l - m6;
+        }
+        z->lb = mlimit2;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * armenian_UTF_8_create_env(void) { return SN_create_env(0, 2); }
+
+extern void armenian_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
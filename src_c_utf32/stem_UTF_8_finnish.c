@@ -0,0 +1,1252 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int finnish_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+static int r_VI(struct SN_env * z);
+static int r_LONG(struct SN_env * z);
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * finnish_UTF_8_create_env(void);
+extern void finnish_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[10] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_1[6] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 3, -1 },
+{ 0, 3, 3, -1 }
+};
+
+
+static const struct among a_2[6] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 3, -1 },
+{ 0, 3, 3, -1 }
+};
+
+
+static const struct among a_3[2] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 }
+};
+
+
+static const struct among a_4[9] =
+{
+{ 0, 3, -1, 3 },
+{ 0, 3, -1, 3 },
+{ 0, 3, -1, 3 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 4 },
+{ 0, 2, -1, 6 },
+{ 0, 2, -1, 5 },
+{ 0, 3, -1, 3 }
+};
+
+
+static const struct among a_5[7] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 }
+};
+
+
+static const struct among a_6[30] =
+{
+{ 0, 1, -1, 8 },
+{ 0, 3, 0, -1 },
+{ 0, 2, 0, -1 },
+{ 0, 3, 0, -1 },
+{ 0, 2, 0, -1 },
+{ 0, 3, 4, -1 },
+{ 0, 3, 4, -1 },
+{ 0, 3, 4, 2 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 1, -1, 7 },
+{ 0, 3, 11, 1 },
+{ 0, 3, 11, -1 },
+{ 0, 4, 11, -1 },
+{ 0, 3, 11, 2 },
+{ 0, 4, 11, -1 },
+{ 0, 3, 11, 3 },
+{ 0, 4, 11, -1 },
+{ 0, 3, 11, 4 },
+{ 0, 3, 11, 5 },
+{ 0, 3, 11, 6 },
+{ 0, 1, -1, 8 },
+{ 0, 3, 22, -1 },
+{ 0, 2, 22, -1 },
+{ 0, 3, 22, -1 },
+{ 0, 2, 22, -1 },
+{ 0, 3, 26, -1 },
+{ 0, 3, 26, -1 },
+{ 0, 3, 26, 2 }
+};
+
+static int (* const a_6_functions[30])(struct SN_env *) = {
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    r_VI,
+    r_LONG,
+    0,
+    r_VI,
+    0,
+    r_VI,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0
+};
+
+
+static const struct among a_7[14] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 1, -1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 3, -1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 5, -1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 7, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 10, -1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 12, -1 }
+};
+
+
+static const struct among a_8[2] =
+{
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 }
+};
+
+
+static const struct among a_9[2] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 4, 0, -1 }
+};
+
+static const unsigned char g_AEI[] = { 17, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8 };
+
+static const unsigned char g_C[] = { 119, 223, 119, 1 };
+
+static const unsigned char g_V1[] = { 17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32 };
+
+static const unsigned char g_V2[] = { 17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32 };
+
+static const unsigned char g_particle_end[] = { 17, 97, 24, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 32 };
+
+
+static const unsigned char a_5_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x82, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x40, 0x0
+};
+
+static const unsigned char a_5_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x82, 0x20, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x40, 0x0
+};
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                i = 0;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 1;
+                break;
+            case 'i':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 2;
+                break;
+            case 'o':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                i = 3;
+                break;
+            case 'u':
+                if (n <= 1) break;
+                if (q[-2] != 'u') break;
+                i = 4;
+                break;
+            case 0xE4:
+                if (n <= 1) break;
+                if (q[-2] != 0xE4) break;
+                i = 5;
+                break;
+            case 0xF6:
+                if (n <= 1) break;
+                if (q[-2] != 0xF6) break;
+                i = 6;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+
+static const unsigned char a_0_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xC2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x40, 0x0
+};
+
+static const unsigned char a_0_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xA, 0x11, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[-2] != 'p') break;
+                i = 0;
+                break;
+            case 'i':
+                if (n <= 1) break;
+                if (q[-2] != 't') break;
+                if (n <= 2) break;
+                if (q[-3] != 's') break;
+                i = 1;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 'k') break;
+                                i = 2;
+                                break;
+                            case 'h':
+                                i = 3;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'k') break;
+                        i = 4;
+                        break;
+                    case 0xE4:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'h':
+                                i = 5;
+                                break;
+                            case 0xE4:
+                                if (n <= 3) break;
+                                if (q[-4] != 'k') break;
+                                i = 6;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'o':
+                if (n <= 1) break;
+                if (q[-2] != 'k') break;
+                i = 7;
+                break;
+            case 0xE4:
+                if (n <= 1) break;
+                if (q[-2] != 'p') break;
+                i = 8;
+                break;
+            case 0xF6:
+                if (n <= 1) break;
+                if (q[-2] != 'k') break;
+                i = 9;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_0[i].s_size;
+    return a_0[i].result;
+}
+
+static const unsigned char a_4_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x42, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0
+};
+
+static const unsigned char a_4_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x60, 0x8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                i = 0;
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'm':
+                        if (n <= 2) break;
+                        if (q[-3] != 'm') break;
+                        i = 1;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'n':
+                        i = 3;
+                        break;
+                    case 's':
+                        i = 4;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 5;
+                        break;
+                    case 'e':
+                        i = 6;
+                        break;
+                    case 0xE4:
+                        i = 7;
+                        break;
+                }
+                break;
+            case 0xE4:
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                i = 8;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+static const symbol s_0[] = { 'k', 's', 'e' };
+static const symbol s_1[] = { 'k', 's', 'i' };
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'a') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'l':
+                if (n <= 2) break;
+                if (q[-3] != 'l') break;
+                i = 0;
+                break;
+            case 'n':
+                i = 1;
+                break;
+            case 's':
+                if (n <= 2) break;
+                if (q[-3] != 's') break;
+                i = 2;
+                break;
+            case 't':
+                i = 3;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'l':
+                        i = 4;
+                        break;
+                    case 's':
+                        i = 5;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0xE4) break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'l':
+                if (n <= 2) break;
+                if (q[-3] != 'l') break;
+                i = 0;
+                break;
+            case 'n':
+                i = 1;
+                break;
+            case 's':
+                if (n <= 2) break;
+                if (q[-3] != 's') break;
+                i = 2;
+                break;
+            case 't':
+                i = 3;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'l':
+                        i = 4;
+                        break;
+                    case 's':
+                        i = 5;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'e') break;
+        if (n <= 1) break;
+        switch (q[-2]) {
+            case 'l':
+                if (n <= 2) break;
+                if (q[-3] != 'l') break;
+                i = 0;
+                break;
+            case 'n':
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+
+static const unsigned char a_6_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x42, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_6(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                i = 0;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'l') break;
+                        i = 1;
+                        break;
+                    case 'n':
+                        i = 2;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        i = 3;
+                        break;
+                    case 't':
+                        i = 4;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'l':
+                                i = 5;
+                                break;
+                            case 's':
+                                i = 6;
+                                break;
+                            case 't':
+                                i = 7;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'l') break;
+                        i = 8;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 9;
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                if (q[-3] != 'k') break;
+                i = 10;
+                break;
+            case 'n':
+                i = 11;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'h') break;
+                        i = 12;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                i = 13;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                i = 14;
+                                break;
+                            case 'h':
+                                i = 15;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                i = 16;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'h':
+                                i = 17;
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                i = 18;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        if (q[-3] != 'h') break;
+                        i = 19;
+                        break;
+                    case 0xE4:
+                        if (n <= 2) break;
+                        if (q[-3] != 'h') break;
+                        i = 20;
+                        break;
+                    case 0xF6:
+                        if (n <= 2) break;
+                        if (q[-3] != 'h') break;
+                        i = 21;
+                        break;
+                }
+                break;
+            case 0xE4:
+                i = 22;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'l':
+                        if (n <= 2) break;
+                        if (q[-3] != 'l') break;
+                        i = 23;
+                        break;
+                    case 'n':
+                        i = 24;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        i = 25;
+                        break;
+                    case 't':
+                        i = 26;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'l':
+                                i = 27;
+                                break;
+                            case 's':
+                                i = 28;
+                                break;
+                            case 't':
+                                i = 29;
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    while (i >= 0) {
+        const struct among * w = a_6 + i;
+        z->c = c - w->s_size;
+        if (a_6_functions[i] == 0) return w->result;
+        {   int res = a_6_functions[i](z);
+            z->c = c - w->s_size;
+            if (res) return w->result;
+        }
+        i = w->substring_i;
+    }
+    return 0;
+}
+static const symbol s_2[] = { 'i', 'e' };
+
+static const unsigned char a_7_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x2, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x10, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_7(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'j':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 0;
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        if (q[-3] != 'm') break;
+                        i = 1;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 2;
+                        break;
+                    case 'p':
+                        if (n <= 2) break;
+                        if (q[-3] != 'm') break;
+                        i = 3;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'm':
+                        if (n <= 2) break;
+                        if (q[-3] != 'm') break;
+                        i = 5;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 6;
+                        break;
+                    case 'p':
+                        if (n <= 2) break;
+                        if (q[-3] != 'm') break;
+                        i = 7;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 8;
+                        break;
+                }
+                break;
+            case 0xE4:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'j':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 9;
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        if (q[-3] != 'm') break;
+                        i = 10;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 11;
+                        break;
+                    case 'p':
+                        if (n <= 2) break;
+                        if (q[-3] != 'm') break;
+                        i = 12;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 13;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_7[i].s_size;
+    return a_7[i].result;
+}
+static const symbol s_3[] = { 'p', 'o' };
+
+static int find_among_b_8(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'i':
+                i = 0;
+                break;
+            case 'j':
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_8[i].s_size;
+    return a_8[i].result;
+}
+
+static int find_among_b_9(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'a') break;
+        if (n <= 1) break;
+        if (q[-2] != 'm') break;
+        if (n <= 2) break;
+        if (q[-3] != 'm') break;
+        i = 0;
+        if (n <= 3) break;
+        if (q[-4] != 'i') break;
+        i = 1;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_9[i].s_size;
+    return a_9[i].result;
+}
+static const symbol s_4[] = { 'p', 'o' };
+
+static int r_LONG(struct SN_env * z) {
+    if (z->c - 1 <= z->lb || z->p[z->c - 1] >= 0x100 || !((a_5_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || z->p[z->c - 2] >= 0x100 || !((a_5_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) return 0;
+    if (!(find_among_b_5(z))) return 0;
+    return 1;
+}
+
+static int r_VI(struct SN_env * z) {
+    if (z->c <= z->lb || z->p[z->c - 1] != 'i') return 0;
+    z->c--;
+    if (in_grouping_b(z, g_V2, 97, 246, 0)) return 0;
+    return 1;
+}
+
+extern int finnish_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    {   int c1 = z->c;
+        z->I[1] = z->l;
+        z->I[0] = z->l;
+        if (out_grouping(z, g_V1, 97, 246, 1) < 0) goto lab0;
+        {   
+            int ret = in_grouping(z, g_V1, 97, 246, 1);
+            if (ret < 0) goto lab0;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+        if (out_grouping(z, g_V1, 97, 246, 1) < 0) goto lab0;
+        {   
+            int ret = in_grouping(z, g_V1, 97, 246, 1);
+            if (ret < 0) goto lab0;
+            z->c += ret;
+        }
+        z->I[0] = z->c;
+    lab0:
+        z->c = c1;
+    }
+    z->I[2] = 0;
+    z->lb = z->c; z->c = z->l;
+
+    {   int m2 = z->l - z->c; (void)m2;
+
+        {   int mlimit3;
+            if (z->c < z->I[1]) goto lab1;
+            mlimit3 = z->lb; z->lb = z->I[1];
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb || z->p[z->c - 1] >= 0x100 || !((a_0_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || z->p[z->c - 2] >= 0x100 || !((a_0_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) { z->lb = mlimit3; goto lab1; }
+            among_var = find_among_b_0(z);
+            if (!(among_var)) { z->lb = mlimit3; goto lab1; }
+            z->bra = z->c;
+            z->lb = mlimit3;
+        }
+        switch (among_var) {
+            case 1:
+                if (in_grouping_b(z, g_particle_end, 97, 246, 0)) goto lab1;
+                break;
+            case 2:
+                if (!(z->I[0] <= z->c)) goto lab1;
+                break;
+        }
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab1:
+        z->c = z->l - m2;
+    }
+    {   int m4 = z->l - z->c; (void)m4;
+
+        {   int mlimit5;
+            if (z->c < z->I[1]) goto lab2;
+            mlimit5 = z->lb; z->lb = z->I[1];
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb || z->p[z->c - 1] >= 0x100 || !((a_4_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || z->p[z->c - 2] >= 0x100 || !((a_4_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) { z->lb = mlimit5; goto lab2; }
+            among_var = find_among_b_4(z);
+            if (!(among_var)) { z->lb = mlimit5; goto lab2; }
+            z->bra = z->c;
+            z->lb = mlimit5;
+        }
+        switch (among_var) {
+            case 1:
+                {   int m6 = z->l - z->c; (void)m6;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'k') goto lab3;
+                    z->c--;
+                    goto lab2;
+                lab3:
+                    z->c = z->l - m6;
+                }
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                z->ket = z->c;
+                if (!(eq_s_b(z, 3, s_0))) goto lab2;
+                z->bra = z->c;
+                {   int ret = slice_from_s(z, 3, s_1);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                if (z->c - 1 <= z->lb || z->p[z->c - 1] != 97 || z->p[z->c - 2] >> 5 != 3 || !((1593344 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab2;
+                if (!(find_among_b_1(z))) goto lab2;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                if (z->c - 1 <= z->lb || z->p[z->c - 1] != 228 || z->p[z->c - 2] >> 5 != 3 || !((1593344 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab2;
+                if (!(find_among_b_2(z))) goto lab2;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                if (z->c - 2 <= z->lb || z->p[z->c - 1] != 101 || (z->p[z->c - 2] != 108 && z->p[z->c - 2] != 110)) goto lab2;
+                if (!(find_among_b_3(z))) goto lab2;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab2:
+        z->c = z->l - m4;
+    }
+    {   int m7 = z->l - z->c; (void)m7;
+
+        {   int mlimit8;
+            if (z->c < z->I[1]) goto lab4;
+            mlimit8 = z->lb; z->lb = z->I[1];
+            z->ket = z->c;
+            if (z->c <= z->lb || z->p[z->c - 1] >= 0x100 || !((a_6_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1)) { z->lb = mlimit8; goto lab4; }
+            among_var = find_among_b_6(z);
+            if (!(among_var)) { z->lb = mlimit8; goto lab4; }
+            z->bra = z->c;
+            z->lb = mlimit8;
+        }
+        switch (among_var) {
+            case 1:
+                if (z->c <= z->lb || z->p[z->c - 1] != 'a') goto lab4;
+                z->c--;
+                break;
+            case 2:
+                if (z->c <= z->lb || z->p[z->c - 1] != 'e') goto lab4;
+                z->c--;
+                break;
+            case 3:
+                if (z->c <= z->lb || z->p[z->c - 1] != 'i') goto lab4;
+                z->c--;
+                break;
+            case 4:
+                if (z->c <= z->lb || z->p[z->c - 1] != 'o') goto lab4;
+                z->c--;
+                break;
+            case 5:
+                if (z->c <= z->lb || z->p[z->c - 1] != 0xE4) goto lab4;
+                z->c--;
+                break;
+            case 6:
+                if (z->c <= z->lb || z->p[z->c - 1] != 0xF6) goto lab4;
+                z->c--;
+                break;
+            case 7:
+                {   int m9 = z->l - z->c; (void)m9;
+                    {   int m10 = z->l - z->c; (void)m10;
+                        {   int m11 = z->l - z->c; (void)m11;
+                            {   int ret = r_LONG(z);
+                                if (ret == 0) goto lab7;
+                                if (ret < 0) return ret;
+                            }
+                            goto lab6;
+                        lab7:
+                            z->c = z->l - m11;
+                            if (!(eq_s_b(z, 2, s_2))) { z->c = z->l - m9; goto lab5; }
+                        }
+                    lab6:
+                        z->c = z->l - m10;
+                        if (z->c <= z->lb) { z->c = z->l - m9; goto lab5; }
+                        z->c--;
+                    }
+                    z->bra = z->c;
+                lab5:
+                    ;
+                }
+                break;
+            case 8:
+                if (in_grouping_b(z, g_V1, 97, 246, 0)) goto lab4;
+                if (in_grouping_b(z, g_C, 98, 122, 0)) goto lab4;
+                break;
+        }
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[2] = 1;
+    lab4:
+        z->c = z->l - m7;
+    }
+    {   int m12 = z->l - z->c; (void)m12;
+
+        {   int mlimit13;
+            if (z->c < z->I[0]) goto lab8;
+            mlimit13 = z->lb; z->lb = z->I[0];
+            z->ket = z->c;
+            if (z->c - 2 <= z->lb || z->p[z->c - 1] >= 0x100 || !((a_7_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((74752 >> (z->p[z->c - 2] & 0x1f)) & 1)) { z->lb = mlimit13; goto lab8; }
+            among_var = find_among_b_7(z);
+            if (!(among_var)) { z->lb = mlimit13; goto lab8; }
+            z->bra = z->c;
+            z->lb = mlimit13;
+        }
+        switch (among_var) {
+            case 1:
+                {   int m14 = z->l - z->c; (void)m14;
+                    if (!(eq_s_b(z, 2, s_3))) goto lab9;
+                    goto lab8;
+                lab9:
+                    z->c = z->l - m14;
+                }
+                break;
+        }
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab8:
+        z->c = z->l - m12;
+    }
+    
+    if (!(z->I[2])) goto lab11;
+    {   int m15 = z->l - z->c; (void)m15;
+
+        {   int mlimit16;
+            if (z->c < z->I[1]) goto lab12;
+            mlimit16 = z->lb; z->lb = z->I[1];
+            z->ket = z->c;
+            if (z->c <= z->lb || (z->p[z->c - 1] != 105 && z->p[z->c - 1] != 106)) { z->lb = mlimit16; goto lab12; }
+            if (!(find_among_b_8(z))) { z->lb = mlimit16; goto lab12; }
+            z->bra = z->c;
+            z->lb = mlimit16;
+        }
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab12:
+        z->c = z->l - m15;
+    }
+    goto lab10;
+lab11:
+    {   int m17 = z->l - z->c; (void)m17;
+
+        {   int mlimit18;
+            if (z->c < z->I[1]) goto lab13;
+            mlimit18 = z->lb; z->lb = z->I[1];
+            z->ket = z->c;
+            if (z->c <= z->lb || z->p[z->c - 1] != 't') { z->lb = mlimit18; goto lab13; }
+            z->c--;
+            z->bra = z->c;
+            {   int m_test19 = z->l - z->c;
+                if (in_grouping_b(z, g_V1, 97, 246, 0)) { z->lb = mlimit18; goto lab13; }
+                z->c = z->l - m_test19;
+            }
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            z->lb = mlimit18;
+        }
+
+        {   int mlimit20;
+            if (z->c < z->I[0]) goto lab13;
+            mlimit20 = z->lb; z->lb = z->I[0];
+            z->ket = z->c;
+            if (z->c - 2 <= z->lb || z->p[z->c - 1] != 97 || z->p[z->c - 2] != 109) { z->lb = mlimit20; goto lab13; }
+            among_var = find_among_b_9(z);
+            if (!(among_var)) { z->lb = mlimit20; goto lab13; }
+            z->bra = z->c;
+            z->lb = mlimit20;
+        }
+        switch (among_var) {
+            case 1:
+                {   int m21 = z->l - z->c; (void)m21;
+                    if (!(eq_s_b(z, 2, s_4))) goto lab14;
+                    goto lab13;
+                lab14:
+                    z->c = z->l - m21;
+                }
+                break;
+        }
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab13:
+        z->c = z->l - m17;
+    }
+lab10:
+    {   int m22 = z->l - z->c; (void)m22;
+
+        {   int mlimit23;
+            if (z->c < z->I[1]) goto lab15;
+            mlimit23 = z->lb; z->lb = z->I[1];
+            {   int m24 = z->l - z->c; (void)m24;
+                {   int m25 = z->l - z->c; (void)m25;
+                    {   int ret = r_LONG(z);
+                        if (ret == 0) goto lab16;
+                        if (ret < 0) return ret;
+                    }
+                    z->c = z->l - m25;
+                    z->ket = z->c;
+                    if (z->c <= z->lb) goto lab16;
+                    z->c--;
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab16:
+                z->c = z->l - m24;
+            }
+            {   int m26 = z->l - z->c; (void)m26;
+                z->ket = z->c;
+                if (in_grouping_b(z, g_AEI, 97, 228, 0)) goto lab17;
+                z->bra = z->c;
+                if (in_grouping_b(z, g_C, 98, 122, 0)) goto lab17;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+            lab17:
+                z->c = z->l - m26;
+            }
+            {   int m27 = z->l - z->c; (void)m27;
+                z->ket = z->c;
+                if (z->c <= z->lb || z->p[z->c - 1] != 'j') goto lab18;
+                z->c--;
+                z->bra = z->c;
+                {   int m28 = z->l - z->c; (void)m28;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'o') goto lab20;
+                    z->c--;
+                    goto lab19;
+                lab20:
+                    z->c = z->l - m28;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'u') goto lab18;
+                    z->c--;
+                }
+            lab19:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+            lab18:
+                z->c = z->l - m27;
+            }
+            {   int m29 = z->l - z->c; (void)m29;
+                z->ket = z->c;
+                if (z->c <= z->lb || z->p[z->c - 1] != 'o') goto lab21;
+                z->c--;
+                z->bra = z->c;
+                if (z->c <= z->lb || z->p[z->c - 1] != 'j') goto lab21;
+                z->c--;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+            lab21:
+                z->c = z->l - m29;
+            }
+            z->lb = mlimit23;
+        }
+        if (in_grouping_b(z, g_V1, 97, 246, 1) < 0) goto lab15;
+        z->ket = z->c;
+        if (in_grouping_b(z, g_C, 98, 122, 0)) goto lab15;
+        z->bra = z->c;
+        z->S[0] = slice_to(z, z->S[0]);
+        if (z->S[0] == 0) return -1;
+        if (!(eq_v_b(z, z->S[0]))) goto lab15;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab15:
+        z->c = z->l - m22;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * finnish_UTF_8_create_env(void) { return SN_create_env(1, 3); }
+
+extern void finnish_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 1); }
+
@@ -0,0 +1,6543 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int greek_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * greek_UTF_8_create_env(void);
+extern void greek_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+static const symbol a_0_pool[69] = {
+    0x386, 0x3B1, 0x388, 0x3B5, 0x389, 0x3B7, 0x38A, 0x3B9, 0x38C, 0x3BF, 0x38E, 0x3C5, 0x38F, 0x3C9, 0x390, 0x391,
+    0x392, 0x3B2, 0x393, 0x3B3, 0x394, 0x3B4, 0x395, 0x396, 0x3B6, 0x397, 0x398, 0x3B8, 0x399, 0x39A, 0x3BA, 0x39B,
+    0x3BB, 0x39C, 0x3BC, 0x39D, 0x3BD, 0x39E, 0x3BE, 0x39F, 0x3A0, 0x3C0, 0x3A1, 0x3C1, 0x3A3, 0x3C3, 0x3A4, 0x3C4,
+    0x3A5, 0x3A6, 0x3C6, 0x3A7, 0x3C7, 0x3A8, 0x3C8, 0x3A9, 0x3AA, 0x3AB, 0x3AC, 0x3AD, 0x3AE, 0x3AF, 0x3B0, 0x3C2,
+    0x3CA, 0x3CB, 0x3CC, 0x3CD, 0x3CE
+};
+
+static const struct translation_entry a_0_entry[45] = {
+    { 0, 1, 1, 1 },
+    { 2, 1, 3, 1 },
+    { 4, 1, 5, 1 },
+    { 6, 1, 7, 1 },
+    { 8, 1, 9, 1 },
+    { 10, 1, 11, 1 },
+    { 12, 1, 13, 1 },
+    { 14, 1, 5, 1 },
+    { 15, 1, 1, 1 },
+    { 16, 1, 17, 1 },
+    { 18, 1, 19, 1 },
+    { 20, 1, 21, 1 },
+    { 22, 1, 3, 1 },
+    { 23, 1, 24, 1 },
+    { 25, 1, 5, 1 },
+    { 26, 1, 27, 1 },
+    { 28, 1, 7, 1 },
+    { 29, 1, 30, 1 },
+    { 31, 1, 32, 1 },
+    { 33, 1, 34, 1 },
+    { 35, 1, 36, 1 },
+    { 37, 1, 38, 1 },
+    { 39, 1, 9, 1 },
+    { 40, 1, 41, 1 },
+    { 42, 1, 43, 1 },
+    { 44, 1, 45, 1 },
+    { 46, 1, 47, 1 },
+    { 48, 1, 11, 1 },
+    { 49, 1, 50, 1 },
+    { 51, 1, 52, 1 },
+    { 53, 1, 54, 1 },
+    { 55, 1, 13, 1 },
+    { 56, 1, 7, 1 },
+    { 57, 1, 11, 1 },
+    { 58, 1, 1, 1 },
+    { 59, 1, 3, 1 },
+    { 60, 1, 5, 1 },
+    { 61, 1, 7, 1 },
+    { 62, 1, 11, 1 },
+    { 63, 1, 45, 1 },
+    { 64, 1, 5, 1 },
+    { 65, 1, 11, 1 },
+    { 66, 1, 9, 1 },
+    { 67, 1, 11, 1 },
+    { 68, 1, 13, 1 }
+};
+
+static const unsigned short a_0_page[1] = {
+    256
+};
+
+static const unsigned short a_0_index[512] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 2, 3, 4, 0, 5, 0, 6, 7,
+    8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 0, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38,
+    39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 41, 42, 43, 44, 45, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const struct translation a_0_translation = {
+    3, 3, 1, a_0_page, a_0_index, a_0_entry, a_0_pool
+};
+
+
+static const struct among a_1[40] =
+{
+{ 0, 6, -1, 2 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 3 },
+{ 0, 5, -1, 4 },
+{ 0, 7, -1, 5 },
+{ 0, 6, -1, 6 },
+{ 0, 6, -1, 7 },
+{ 0, 6, -1, 8 },
+{ 0, 8, -1, 11 },
+{ 0, 9, -1, 10 },
+{ 0, 4, -1, 9 },
+{ 0, 6, -1, 7 },
+{ 0, 7, -1, 2 },
+{ 0, 6, -1, 1 },
+{ 0, 7, -1, 3 },
+{ 0, 6, -1, 4 },
+{ 0, 8, -1, 5 },
+{ 0, 7, -1, 6 },
+{ 0, 7, -1, 7 },
+{ 0, 7, -1, 8 },
+{ 0, 9, -1, 11 },
+{ 0, 10, -1, 10 },
+{ 0, 5, -1, 9 },
+{ 0, 5, -1, 6 },
+{ 0, 5, -1, 7 },
+{ 0, 5, -1, 8 },
+{ 0, 7, -1, 11 },
+{ 0, 7, -1, 6 },
+{ 0, 7, -1, 7 },
+{ 0, 7, -1, 8 },
+{ 0, 9, -1, 11 },
+{ 0, 10, -1, 10 },
+{ 0, 5, -1, 9 },
+{ 0, 8, -1, 10 },
+{ 0, 3, -1, 9 },
+{ 0, 7, -1, 2 },
+{ 0, 6, -1, 1 },
+{ 0, 7, -1, 3 },
+{ 0, 6, -1, 4 },
+{ 0, 8, -1, 5 }
+};
+
+static const unsigned short a_2_displacement[] = {
+    0, 1, 2, 2, 2, 1, 1, 1,
+    12, 6, 0, 19, 1, 3, 5, 98
+};
+static const short a_2_slot[] = {
+    22, 29, 12, 17, 16, 13, 27, 3,
+    25, 14, 1, 19, 2, 24, 30, 20,
+    23, 4, 5, 8, 6, 28, 18, 7,
+    11, 26, 9, 21, 15, 0, 10
+};
+static const struct among_hash a_2_hash = {
+    254, 16, a_2_displacement, a_2_slot
+};
+
+static const symbol a_2_pool[102] = {
+    0x3C3, 0x3C5, 0x3BD, 0x3B1, 0x3B8, 0x3C1, 0x3BF, 0x3C0, 0x3B9, 0x3C0, 0x3B5, 0x3C1, 0x3BF, 0x3C1, 0x3BE, 0x3B1,
+    0x3BD, 0x3B1, 0x3C0, 0x3B1, 0x3C0, 0x3B5, 0x3C1, 0x3B9, 0x3C0, 0x3B1, 0x3BD, 0x3B1, 0x3BC, 0x3C0, 0x3B1, 0x3B2,
+    0x3B1, 0x3B8, 0x3C5, 0x3C1, 0x3B9, 0x3B2, 0x3BF, 0x3BB, 0x3B2, 0x3BF, 0x3C1, 0x3B3, 0x3BB, 0x3C5, 0x3BA, 0x3BF,
+    0x3C1, 0x3B3, 0x3BB, 0x3C5, 0x3BA, 0x3C5, 0x3C1, 0x3B1, 0x3BC, 0x3C0, 0x3B1, 0x3C1, 0x3C0, 0x3BF, 0x3BB, 0x3C5,
+    0x3C1, 0x3B5, 0x3BC, 0x3C0, 0x3B1, 0x3B4, 0x3B1, 0x3BD, 0x3B5, 0x3B2, 0x3B1, 0x3C1, 0x3BA, 0x3BC, 0x3B1, 0x3C1,
+    0x3BA, 0x3BF, 0x3C1, 0x3BD, 0x3B5, 0x3C0, 0x3B1, 0x3B9, 0x3BC, 0x3C0, 0x3B3, 0x3BA, 0x3C1, 0x3BC, 0x3C0, 0x3C1,
+    0x3B1, 0x3C1, 0x3C1, 0x3BB, 0x3BF, 0x3C5
+};
+
+static const struct among a_2[31] =
+{
+{ 18, 2, -1, 1 },
+{ 14, 6, 0, 1 },
+{ 84, 3, 0, 1 },
+{ 20, 6, 0, 1 },
+{ 25, 6, 0, 1 },
+{ 65, 4, 0, 1 },
+{ 31, 1, -1, 2 },
+{ 69, 4, -1, 1 },
+{ 31, 6, -1, 2 },
+{ 73, 4, -1, 2 },
+{ 77, 4, -1, 2 },
+{ 39, 1, -1, 2 },
+{ 28, 1, -1, 2 },
+{ 80, 4, -1, 2 },
+{ 3, 4, -1, 1 },
+{ 0, 7, 14, 1 },
+{ 7, 1, -1, 2 },
+{ 87, 3, 16, 2 },
+{ 5, 1, -1, 2 },
+{ 77, 3, 18, 2 },
+{ 55, 5, 18, 2 },
+{ 90, 3, 18, 2 },
+{ 37, 6, 18, 2 },
+{ 43, 6, 18, 2 },
+{ 7, 7, 18, 2 },
+{ 94, 2, 18, 2 },
+{ 93, 3, 25, 2 },
+{ 96, 3, 18, 2 },
+{ 49, 6, 18, 2 },
+{ 60, 5, 18, 2 },
+{ 99, 3, -1, 2 }
+};
+
+static const struct among_table a_2_table = {
+    a_2, 31, a_2_pool, 0
+};
+
+
+static const struct among a_3[14] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 3, -1, 1 }
+};
+
+static const unsigned short a_4_displacement[] = {
+    2, 14, 1, 1, 1
+};
+static const short a_4_slot[] = {
+    7, 4, 3, 1, 5, 2, 6, 0
+};
+static const struct among_hash a_4_hash = {
+    6, 5, a_4_displacement, a_4_slot
+};
+
+static const symbol a_4_pool[14] = {
+    0x3B2, 0x3B9, 0x3BB, 0x3B9, 0x3B1, 0x3BB, 0x3B5, 0x3BD, 0x3C5, 0x3C8, 0x3B6, 0x3C9, 0x3C3, 0x3C7
+};
+
+static const struct among a_4[8] =
+{
+{ 0, 2, -1, 1 },
+{ 2, 2, -1, 1 },
+{ 4, 2, -1, 1 },
+{ 6, 2, -1, 1 },
+{ 12, 1, -1, 1 },
+{ 13, 1, -1, 1 },
+{ 8, 2, -1, 1 },
+{ 10, 2, -1, 1 }
+};
+
+static const struct among_table a_4_table = {
+    a_4, 8, a_4_pool, 0
+};
+
+
+static const struct among a_5[7] =
+{
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 }
+};
+
+static const unsigned short a_6_displacement[] = {
+    2, 2, 2, 0, 0, 19, 3, 0,
+    5, 1, 1, 28, 5, 13, 0, 22,
+    0
+};
+static const short a_6_slot[] = {
+    9, 19, 8, 31, 26, 28, 17, 11,
+    15, 30, 13, 0, 23, 14, 29, 12,
+    5, 2, 18, 25, 1, 24, 6, 4,
+    22, 7, 10, 20, 3, 16, 21, 27
+};
+static const struct among_hash a_6_hash = {
+    990, 17, a_6_displacement, a_6_slot
+};
+
+static const symbol a_6_pool[108] = {
+    0x3B3, 0x3B9, 0x3B3, 0x3B1, 0x3BD, 0x3C4, 0x3BF, 0x3B1, 0x3C6, 0x3B4, 0x3B7, 0x3BC, 0x3BF, 0x3BA, 0x3C1, 0x3B1,
+    0x3C4, 0x3C7, 0x3B1, 0x3C1, 0x3C4, 0x3BF, 0x3C0, 0x3B1, 0x3C3, 0x3C5, 0x3BD, 0x3B1, 0x3B8, 0x3C1, 0x3BF, 0x3BE,
+    0x3B1, 0x3BD, 0x3B1, 0x3C0, 0x3B1, 0x3C0, 0x3B5, 0x3C1, 0x3B9, 0x3C0, 0x3B1, 0x3BD, 0x3B1, 0x3BC, 0x3C0, 0x3B1,
+    0x3B5, 0x3BE, 0x3B1, 0x3C1, 0x3C7, 0x3B1, 0x3C0, 0x3B5, 0x3BA, 0x3BB, 0x3B5, 0x3B1, 0x3C0, 0x3BF, 0x3BA, 0x3BB,
+    0x3B5, 0x3C3, 0x3C9, 0x3BA, 0x3BB, 0x3B5, 0x3BC, 0x3B5, 0x3C4, 0x3B5, 0x3C0, 0x3B5, 0x3C0, 0x3BF, 0x3C5, 0x3BA,
+    0x3B1, 0x3BC, 0x3B5, 0x3BC, 0x3C0, 0x3B1, 0x3B4, 0x3B1, 0x3BD, 0x3B5, 0x3C0, 0x3B1, 0x3B3, 0x3BA, 0x3B5, 0x3C3,
+    0x3B5, 0x3BA, 0x3BF, 0x3BC, 0x3BF, 0x3BB, 0x3BF, 0x3BB, 0x3B1, 0x3C1, 0x3B3, 0x3B5
+};
+
+static const struct among a_6[32] =
+{
+{ 31, 6, -1, 1 },
+{ 89, 3, -1, 1 },
+{ 37, 6, -1, 1 },
+{ 42, 6, -1, 1 },
+{ 82, 4, -1, 1 },
+{ 17, 7, -1, 1 },
+{ 48, 6, -1, 1 },
+{ 106, 2, -1, 2 },
+{ 92, 3, -1, 2 },
+{ 56, 3, -1, 1 },
+{ 55, 4, 9, 1 },
+{ 53, 6, 10, 1 },
+{ 59, 6, 9, 1 },
+{ 64, 6, 9, 1 },
+{ 86, 4, -1, 1 },
+{ 37, 2, -1, 1 },
+{ 73, 3, 15, 1 },
+{ 70, 6, 16, 1 },
+{ 94, 3, -1, 1 },
+{ 92, 2, -1, 2 },
+{ 11, 1, -1, 2 },
+{ 76, 6, 20, 2 },
+{ 97, 3, 20, 2 },
+{ 3, 2, -1, 2 },
+{ 100, 3, -1, 2 },
+{ 27, 4, -1, 1 },
+{ 24, 7, 25, 1 },
+{ 22, 1, -1, 2 },
+{ 103, 3, -1, 2 },
+{ 9, 8, -1, 2 },
+{ 7, 2, -1, 2 },
+{ 0, 9, 30, 2 }
+};
+
+static const struct among_table a_6_table = {
+    a_6, 32, a_6_pool, 0
+};
+
+
+static const struct among a_7[7] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+static const unsigned short a_8_displacement[] = {
+    3, 1, 1, 11, 6, 1, 8, 21,
+    3, 0
+};
+static const short a_8_slot[] = {
+    14, 3, 5, 13, 1, 16, 11, 6,
+    10, 7, 12, 17, 9, 4, 8, 15,
+    0, 18, 2
+};
+static const struct among_hash a_8_hash = {
+    220, 10, a_8_displacement, a_8_slot
+};
+
+static const symbol a_8_pool[71] = {
+    0x3C7, 0x3B1, 0x3C1, 0x3C4, 0x3BF, 0x3C0, 0x3B1, 0x3C3, 0x3C5, 0x3BD, 0x3B1, 0x3B8, 0x3C1, 0x3BF, 0x3BE, 0x3B1,
+    0x3BD, 0x3B1, 0x3C0, 0x3B1, 0x3C0, 0x3B5, 0x3C1, 0x3B9, 0x3C0, 0x3B1, 0x3BD, 0x3B1, 0x3BC, 0x3C0, 0x3B1, 0x3B5,
+    0x3BE, 0x3B1, 0x3C1, 0x3C7, 0x3B1, 0x3C0, 0x3B5, 0x3BA, 0x3BB, 0x3B5, 0x3B1, 0x3C0, 0x3BF, 0x3BA, 0x3BB, 0x3B5,
+    0x3C3, 0x3C9, 0x3BA, 0x3BB, 0x3B5, 0x3BC, 0x3B5, 0x3C4, 0x3B5, 0x3C0, 0x3B5, 0x3BC, 0x3C0, 0x3B1, 0x3B4, 0x3B1,
+    0x3BD, 0x3B5, 0x3C0, 0x3B1, 0x3B5, 0x3C3, 0x3B5
+};
+
+static const struct among a_8[19] =
+{
+{ 14, 6, -1, 1 },
+{ 65, 3, -1, 1 },
+{ 20, 6, -1, 1 },
+{ 25, 6, -1, 1 },
+{ 58, 4, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 31, 6, -1, 1 },
+{ 39, 3, -1, 1 },
+{ 38, 4, 7, 1 },
+{ 36, 6, 8, 1 },
+{ 42, 6, 7, 1 },
+{ 47, 6, 7, 1 },
+{ 62, 4, -1, 1 },
+{ 20, 2, -1, 1 },
+{ 56, 3, 13, 1 },
+{ 53, 6, 14, 1 },
+{ 68, 3, -1, 1 },
+{ 10, 4, -1, 1 },
+{ 7, 7, 17, 1 }
+};
+
+static const struct among_table a_8_table = {
+    a_8, 19, a_8_pool, 0
+};
+
+
+static const struct among a_9[7] =
+{
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 3, -1, 1 }
+};
+
+static const unsigned short a_10_displacement[] = {
+    6, 1, 1, 3, 1, 1, 0, 1,
+    1, 3, 1, 7, 6, 2, 3, 3,
+    17, 12, 1, 31, 50
+};
+static const short a_10_slot[] = {
+    11, 9, 7, 19, 31, 26, 12, 29,
+    27, 8, 2, 38, 24, 37, 15, 10,
+    1, 3, 6, 21, 17, 33, 4, 28,
+    25, 22, 0, 35, 30, 36, 34, 18,
+    39, 32, 13, 23, 16, 20, 14, 5
+};
+static const struct among_hash a_10_hash = {
+    222, 21, a_10_displacement, a_10_slot
+};
+
+static const symbol a_10_pool[95] = {
+    0x3C3, 0x3C5, 0x3BD, 0x3B1, 0x3B8, 0x3C1, 0x3BF, 0x3B5, 0x3C3, 0x3C9, 0x3BA, 0x3BB, 0x3B5, 0x3B4, 0x3B1, 0x3BD,
+    0x3B5, 0x3B1, 0x3C4, 0x3B1, 0x3B7, 0x3C6, 0x3B1, 0x3BC, 0x3B5, 0x3B3, 0x3BB, 0x3C5, 0x3B3, 0x3C0, 0x3BB, 0x3B5,
+    0x3B1, 0x3C3, 0x3B5, 0x3BA, 0x3B1, 0x3B8, 0x3B5, 0x3C7, 0x3B8, 0x3BA, 0x3B1, 0x3BA, 0x3BC, 0x3B1, 0x3BA, 0x3C6,
+    0x3B9, 0x3BB, 0x3BA, 0x3C5, 0x3BB, 0x3B3, 0x3B5, 0x3BC, 0x3B1, 0x3C7, 0x3BD, 0x3B5, 0x3BC, 0x3C0, 0x3B5, 0x3C5,
+    0x3C0, 0x3B1, 0x3BF, 0x3C1, 0x3B3, 0x3C5, 0x3C1, 0x3C7, 0x3C9, 0x3C1, 0x3B1, 0x3BA, 0x3C4, 0x3B1, 0x3C7, 0x3C4,
+    0x3B1, 0x3C3, 0x3C7, 0x3B7, 0x3B4, 0x3C3, 0x3BA, 0x3B1, 0x3C0, 0x3B1, 0x3C1, 0x3C7, 0x3C1, 0x3C5, 0x3C8
+};
+
+static const struct among a_10[40] =
+{
+{ 17, 3, -1, 2 },
+{ 21, 2, -1, 2 },
+{ 20, 3, 1, 2 },
+{ 23, 3, -1, 2 },
+{ 26, 3, -1, 2 },
+{ 83, 2, -1, 2 },
+{ 10, 3, -1, 1 },
+{ 7, 6, 6, 1 },
+{ 29, 3, -1, 1 },
+{ 13, 4, -1, 1 },
+{ 33, 2, -1, 1 },
+{ 32, 3, 10, 1 },
+{ 35, 3, -1, 2 },
+{ 38, 3, -1, 2 },
+{ 41, 3, -1, 2 },
+{ 44, 3, -1, 2 },
+{ 85, 2, -1, 2 },
+{ 47, 3, -1, 2 },
+{ 50, 3, -1, 2 },
+{ 23, 1, -1, 2 },
+{ 53, 3, 19, 2 },
+{ 56, 3, -1, 2 },
+{ 0, 7, -1, 1 },
+{ 29, 1, -1, 2 },
+{ 87, 2, 23, 2 },
+{ 59, 3, 23, 2 },
+{ 62, 3, 23, 2 },
+{ 89, 2, -1, 2 },
+{ 65, 3, -1, 2 },
+{ 68, 3, -1, 2 },
+{ 91, 2, -1, 2 },
+{ 71, 3, -1, 2 },
+{ 75, 2, -1, 2 },
+{ 74, 3, 32, 2 },
+{ 78, 2, -1, 2 },
+{ 77, 3, 34, 2 },
+{ 76, 3, -1, 2 },
+{ 81, 2, -1, 2 },
+{ 80, 3, 37, 2 },
+{ 93, 2, -1, 2 }
+};
+
+static const struct among_table a_10_table = {
+    a_10, 40, a_10_pool, 0
+};
+
+
+static const struct among a_11[11] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 }
+};
+
+static const unsigned short a_12_displacement[] = {
+    1, 5, 6, 13
+};
+static const short a_12_slot[] = {
+    3, 2, 6, 5, 1, 4, 0
+};
+static const struct among_hash a_12_hash = {
+    500, 4, a_12_displacement, a_12_slot
+};
+
+static const symbol a_12_pool[31] = {
+    0x3B1, 0x3BD, 0x3C4, 0x3B9, 0x3B4, 0x3B1, 0x3BD, 0x3B5, 0x3BC, 0x3B9, 0x3BA, 0x3C1, 0x3BF, 0x3C3, 0x3B5, 0x3B1,
+    0x3C0, 0x3BF, 0x3BA, 0x3BB, 0x3B5, 0x3BC, 0x3B5, 0x3C4, 0x3B1, 0x3C3, 0x3B5, 0x3B3, 0x3BA, 0x3BB, 0x3B5
+};
+
+static const struct among a_12[7] =
+{
+{ 26, 5, -1, 1 },
+{ 15, 6, -1, 1 },
+{ 4, 4, -1, 2 },
+{ 0, 8, 2, 2 },
+{ 13, 2, -1, 1 },
+{ 21, 6, 4, 1 },
+{ 8, 7, 4, 1 }
+};
+
+static const struct among_table a_12_table = {
+    a_12, 7, a_12_pool, 0
+};
+
+
+static const struct among a_13[10] =
+{
+{ 0, 6, -1, 2 },
+{ 0, 5, -1, 4 },
+{ 0, 5, -1, 7 },
+{ 0, 8, -1, 5 },
+{ 0, 7, -1, 6 },
+{ 0, 7, -1, 3 },
+{ 0, 8, 5, 1 },
+{ 0, 10, -1, 8 },
+{ 0, 7, -1, 10 },
+{ 0, 8, -1, 9 }
+};
+
+
+static const struct among a_14[6] =
+{
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 }
+};
+
+static const unsigned short a_15_displacement[] = {
+    1, 3
+};
+static const short a_15_slot[] = {
+    0, 1
+};
+static const struct among_hash a_15_hash = {
+    2, 2, a_15_displacement, a_15_slot
+};
+
+static const symbol a_15_pool[2] = {
+    0x3C3, 0x3C7
+};
+
+static const struct among a_15[2] =
+{
+{ 0, 1, -1, 1 },
+{ 1, 1, -1, 1 }
+};
+
+static const struct among_table a_15_table = {
+    a_15, 2, a_15_pool, 0
+};
+
+
+static const struct among a_16[4] =
+{
+{ 0, 7, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 }
+};
+
+static const unsigned short a_17_displacement[] = {
+    1, 1, 5, 2, 6, 2, 2, 0,
+    2, 6, 6, 8, 4, 0, 6, 0,
+    1, 1, 28, 8, 11, 1, 51, 11
+};
+static const short a_17_slot[] = {
+    17, 22, 42, 5, 28, 26, 34, 13,
+    20, 40, 30, 11, 21, 41, 23, 29,
+    10, 25, 3, 37, 16, 45, 6, 2,
+    31, 19, 33, 14, 1, 27, 0, 36,
+    32, 8, 12, 7, 39, 4, 44, 9,
+    35, 15, 43, 38, 24, 18
+};
+static const struct among_hash a_17_hash = {
+    766, 24, a_17_displacement, a_17_slot
+};
+
+static const symbol a_17_pool[137] = {
+    0x3C4, 0x3C3, 0x3B5, 0x3C7, 0x3BF, 0x3C3, 0x3BB, 0x3BF, 0x3B2, 0x3B7, 0x3B3, 0x3BF, 0x3C5, 0x3BC, 0x3B5, 0x3BD,
+    0x3C4, 0x3C1, 0x3B9, 0x3C0, 0x3BF, 0x3BB, 0x3BC, 0x3B1, 0x3BA, 0x3C1, 0x3C5, 0x3BD, 0x3BA, 0x3B1, 0x3C4, 0x3C1,
+    0x3B1, 0x3C0, 0x3BD, 0x3B1, 0x3B3, 0x3BA, 0x3B1, 0x3C3, 0x3BA, 0x3B1, 0x3C0, 0x3B1, 0x3BA, 0x3C0, 0x3B1, 0x3C4,
+    0x3B5, 0x3C1, 0x3BC, 0x3BF, 0x3C5, 0x3C3, 0x3C4, 0x3B1, 0x3BB, 0x3B9, 0x3C3, 0x3C6, 0x3B2, 0x3B1, 0x3BC, 0x3B2,
+    0x3BA, 0x3B1, 0x3C1, 0x3B4, 0x3BB, 0x3BF, 0x3C5, 0x3BB, 0x3BA, 0x3B1, 0x3B9, 0x3BC, 0x3BA, 0x3BB, 0x3B9, 0x3BC,
+    0x3C6, 0x3B1, 0x3C1, 0x3BC, 0x3B3, 0x3B9, 0x3B1, 0x3BD, 0x3C3, 0x3C0, 0x3B1, 0x3BD, 0x3BB, 0x3B1, 0x3B2, 0x3C1,
+    0x3B1, 0x3BC, 0x3B2, 0x3C1, 0x3B1, 0x3BD, 0x3B8, 0x3C1, 0x3C3, 0x3BF, 0x3BA, 0x3B2, 0x3B1, 0x3BB, 0x3BC, 0x3B1,
+    0x3BB, 0x3C6, 0x3C5, 0x3BB, 0x3BA, 0x3BF, 0x3BD, 0x3BC, 0x3B5, 0x3C1, 0x3BA, 0x3BF, 0x3C1, 0x3C4, 0x3BF, 0x3C3,
+    0x3BD, 0x3C5, 0x3C6, 0x3C4, 0x3B6, 0x3B3, 0x3BB, 0x3C0, 0x3BB
+};
+
+static const struct among a_17[46] =
+{
+{ 8, 1, -1, 2 },
+{ 60, 4, 0, 1 },
+{ 5, 4, 0, 1 },
+{ 0, 9, 2, 1 },
+{ 64, 4, -1, 2 },
+{ 132, 1, -1, 2 },
+{ 131, 2, 5, 1 },
+{ 24, 1, -1, 1 },
+{ 40, 5, 7, 1 },
+{ 104, 3, 7, 1 },
+{ 39, 2, 7, 1 },
+{ 107, 3, -1, 2 },
+{ 110, 3, -1, 1 },
+{ 133, 2, -1, 2 },
+{ 16, 6, -1, 2 },
+{ 135, 2, -1, 1 },
+{ 68, 4, -1, 1 },
+{ 113, 3, -1, 1 },
+{ 72, 4, -1, 1 },
+{ 76, 4, -1, 1 },
+{ 80, 4, -1, 1 },
+{ 84, 4, -1, 2 },
+{ 88, 4, -1, 1 },
+{ 9, 7, -1, 2 },
+{ 116, 3, -1, 1 },
+{ 22, 6, -1, 2 },
+{ 19, 1, -1, 2 },
+{ 28, 6, 26, 1 },
+{ 17, 1, -1, 1 },
+{ 94, 2, 28, 1 },
+{ 92, 4, 29, 1 },
+{ 96, 4, 29, 1 },
+{ 119, 3, 28, 1 },
+{ 45, 5, 28, 2 },
+{ 100, 4, 28, 1 },
+{ 122, 3, 28, 1 },
+{ 1, 1, -1, 1 },
+{ 34, 6, 36, 1 },
+{ 125, 3, 36, 2 },
+{ 50, 5, -1, 1 },
+{ 25, 2, -1, 1 },
+{ 59, 1, -1, 1 },
+{ 58, 2, 41, 1 },
+{ 55, 5, 42, 1 },
+{ 128, 3, 41, 2 },
+{ 3, 1, -1, 1 }
+};
+
+static const struct among_table a_17_table = {
+    a_17, 46, a_17_pool, 0
+};
+
+
+static const struct among a_18[8] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 6, 0, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 3, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 }
+};
+
+static const unsigned short a_19_displacement[] = {
+    2, 0, 1
+};
+static const short a_19_slot[] = {
+    1, 2, 3, 0
+};
+static const struct among_hash a_19_hash = {
+    28, 3, a_19_displacement, a_19_slot
+};
+
+static const symbol a_19_pool[12] = {
+    0x3B1, 0x3B9, 0x3C6, 0x3BD, 0x3C8, 0x3B1, 0x3BB, 0x3BF, 0x3BB, 0x3BF, 0x3B9, 0x3C1
+};
+
+static const struct among a_19[4] =
+{
+{ 4, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 7, 3, -1, 1 },
+{ 10, 2, -1, 1 }
+};
+
+static const struct among_table a_19_table = {
+    a_19, 4, a_19_pool, 0
+};
+
+
+static const struct among a_20[2] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 5, -1, 1 }
+};
+
+
+static const struct among a_21[3] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+static const unsigned short a_22_displacement[] = {
+    8, 0, 2, 21
+};
+static const short a_22_slot[] = {
+    2, 6, 0, 5, 1, 3, 4
+};
+static const struct among_hash a_22_hash = {
+    62, 4, a_22_displacement, a_22_slot
+};
+
+static const symbol a_22_pool[17] = {
+    0x3C6, 0x3C1, 0x3B1, 0x3B3, 0x3BA, 0x3BF, 0x3B2, 0x3B5, 0x3BB, 0x3C5, 0x3BA, 0x3BC, 0x3B7, 0x3BD, 0x3B9, 0x3B2,
+    0x3B4
+};
+
+static const struct among a_22[7] =
+{
+{ 14, 2, -1, 1 },
+{ 16, 1, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 8, 3, -1, 1 },
+{ 5, 4, -1, 1 },
+{ 11, 3, -1, 1 },
+{ 1, 1, -1, 1 }
+};
+
+static const struct among_table a_22_table = {
+    a_22, 7, a_22_pool, 0
+};
+
+
+static const struct among a_23[4] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 }
+};
+
+
+static const struct among a_24[2] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+
+static const struct among a_25[10] =
+{
+{ 0, 5, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 5, -1, -1 },
+{ 0, 5, -1, -1 },
+{ 0, 5, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 5, -1, -1 }
+};
+
+
+static const struct among a_26[2] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+
+static const struct among a_27[8] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_28[2] =
+{
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 }
+};
+
+
+static const struct among a_29[15] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 3, -1, 1 }
+};
+
+
+static const struct among a_30[2] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 }
+};
+
+static const unsigned short a_31_displacement[] = {
+    2, 19, 0, 50, 0
+};
+static const short a_31_slot[] = {
+    6, 1, 4, 7, 2, 5, 0, 3
+};
+static const struct among_hash a_31_hash = {
+    14, 5, a_31_displacement, a_31_slot
+};
+
+static const symbol a_31_pool[12] = {
+    0x3B3, 0x3B1, 0x3BB, 0x3C0, 0x3B1, 0x3C1, 0x3B9, 0x3B4, 0x3B5, 0x3BB, 0x3B8, 0x3BD
+};
+
+static const struct among a_31[8] =
+{
+{ 7, 1, -1, 1 },
+{ 6, 2, 0, 1 },
+{ 10, 1, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 8, 2, -1, 1 },
+{ 11, 1, -1, 1 },
+{ 3, 1, -1, 1 },
+{ 3, 3, -1, 1 }
+};
+
+static const struct among_table a_31_table = {
+    a_31, 8, a_31_pool, 0
+};
+
+
+static const struct among a_32[3] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 }
+};
+
+
+static const struct among a_33[4] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+static const unsigned short a_34_displacement[] = {
+    14, 2, 1, 3, 0, 1, 4, 4,
+    34, 1, 11, 4, 1, 0, 1, 13,
+    22, 1, 4
+};
+static const short a_34_slot[] = {
+    22, 4, 17, 9, 14, 12, 26, 25,
+    34, 6, 16, 33, 23, 27, 0, 32,
+    11, 15, 8, 5, 19, 28, 20, 35,
+    3, 21, 1, 29, 18, 30, 13, 2,
+    7, 31, 24, 10
+};
+static const struct among_hash a_34_hash = {
+    252, 19, a_34_displacement, a_34_slot
+};
+
+static const symbol a_34_pool[150] = {
+    0x3B1, 0x3BC, 0x3BC, 0x3BF, 0x3C7, 0x3B1, 0x3BB, 0x3C3, 0x3C5, 0x3BD, 0x3BF, 0x3BC, 0x3B7, 0x3BB, 0x3C0, 0x3BF,
+    0x3C3, 0x3C4, 0x3B5, 0x3BB, 0x3BD, 0x3BC, 0x3C0, 0x3B1, 0x3B3, 0x3B9, 0x3B1, 0x3C4, 0x3C0, 0x3C1, 0x3C9, 0x3C4,
+    0x3BF, 0x3B4, 0x3BA, 0x3B1, 0x3BB, 0x3BB, 0x3B9, 0x3BD, 0x3C0, 0x3BB, 0x3B9, 0x3B1, 0x3C4, 0x3C3, 0x3C0, 0x3B9,
+    0x3BA, 0x3B1, 0x3BD, 0x3C4, 0x3C3, 0x3C5, 0x3BD, 0x3B1, 0x3B4, 0x3BA, 0x3B1, 0x3C4, 0x3B1, 0x3B4, 0x3B1, 0x3BD,
+    0x3C4, 0x3B9, 0x3B4, 0x3C6, 0x3C5, 0x3BB, 0x3BF, 0x3B4, 0x3C6, 0x3B9, 0x3BB, 0x3BF, 0x3BD, 0x3C5, 0x3C0, 0x3BF,
+    0x3B4, 0x3B5, 0x3BE, 0x3C9, 0x3B4, 0x3B1, 0x3BD, 0x3B7, 0x3B8, 0x3BC, 0x3C0, 0x3BF, 0x3BB, 0x3BC, 0x3BF, 0x3C5,
+    0x3BB, 0x3C4, 0x3C3, 0x3B1, 0x3BC, 0x3B2, 0x3C1, 0x3C9, 0x3BC, 0x3B1, 0x3BC, 0x3B1, 0x3BD, 0x3BC, 0x3C0, 0x3B1,
+    0x3BD, 0x3BA, 0x3B1, 0x3BB, 0x3C0, 0x3BC, 0x3C0, 0x3BF, 0x3C3, 0x3C0, 0x3B5, 0x3C4, 0x3C3, 0x3C0, 0x3B9, 0x3C4,
+    0x3C3, 0x3B5, 0x3C1, 0x3C4, 0x3B5, 0x3BD, 0x3B4, 0x3BE, 0x3B9, 0x3BA, 0x3B3, 0x3B5, 0x3C1, 0x3C7, 0x3B1, 0x3C3,
+    0x3C6, 0x3C5, 0x3C3, 0x3BD, 0x3B9, 0x3C4
+};
+
+static const struct among a_34[36] =
+{
+{ 55, 2, -1, 1 },
+{ 52, 5, 0, 1 },
+{ 57, 5, 0, 1 },
+{ 62, 5, -1, 1 },
+{ 132, 3, -1, 1 },
+{ 67, 5, -1, 1 },
+{ 77, 4, -1, 1 },
+{ 28, 6, -1, 1 },
+{ 81, 4, -1, 1 },
+{ 87, 2, -1, 1 },
+{ 85, 4, 9, 1 },
+{ 135, 3, -1, 1 },
+{ 5, 2, -1, 1 },
+{ 0, 7, 12, 1 },
+{ 7, 7, -1, 1 },
+{ 89, 4, -1, 1 },
+{ 93, 4, -1, 1 },
+{ 97, 4, -1, 1 },
+{ 101, 4, -1, 1 },
+{ 105, 4, -1, 1 },
+{ 109, 4, -1, 1 },
+{ 34, 6, -1, 1 },
+{ 14, 7, -1, 1 },
+{ 72, 5, -1, 1 },
+{ 113, 4, -1, 1 },
+{ 138, 3, -1, 1 },
+{ 141, 3, -1, 1 },
+{ 117, 4, -1, 1 },
+{ 40, 6, -1, 1 },
+{ 121, 4, -1, 1 },
+{ 125, 4, -1, 1 },
+{ 144, 3, -1, 1 },
+{ 21, 7, -1, 1 },
+{ 147, 3, -1, 1 },
+{ 46, 6, -1, 1 },
+{ 128, 4, -1, 1 }
+};
+
+static const struct among_table a_34_table = {
+    a_34, 36, a_34_pool, 0
+};
+
+
+static const struct among a_35[5] =
+{
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 7, 1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 }
+};
+
+static const unsigned short a_36_displacement[] = {
+    0, 2, 4, 18, 1, 6, 17
+};
+static const short a_36_slot[] = {
+    11, 5, 7, 2, 0, 4, 6, 1,
+    3, 10, 8, 9
+};
+static const struct among_hash a_36_hash = {
+    58, 7, a_36_displacement, a_36_slot
+};
+
+static const symbol a_36_pool[39] = {
+    0x3B1, 0x3C0, 0x3BF, 0x3C3, 0x3C4, 0x3B2, 0x3BF, 0x3C5, 0x3B2, 0x3B1, 0x3C0, 0x3BF, 0x3B8, 0x3B1, 0x3C0, 0x3BF,
+    0x3BA, 0x3B1, 0x3BD, 0x3B1, 0x3C0, 0x3B9, 0x3BA, 0x3C1, 0x3BE, 0x3B5, 0x3B8, 0x3C0, 0x3B5, 0x3B8, 0x3BF, 0x3C5,
+    0x3BB, 0x3C0, 0x3BF, 0x3C4, 0x3C3, 0x3B9, 0x3C7
+};
+
+static const struct among a_36[12] =
+{
+{ 5, 4, -1, 1 },
+{ 24, 3, -1, 1 },
+{ 27, 3, -1, 1 },
+{ 9, 4, -1, 1 },
+{ 13, 4, -1, 1 },
+{ 30, 3, -1, 1 },
+{ 17, 4, -1, 1 },
+{ 20, 4, -1, 1 },
+{ 33, 3, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 38, 1, -1, 1 },
+{ 36, 3, 10, 1 }
+};
+
+static const struct among_table a_36_table = {
+    a_36, 12, a_36_pool, 0
+};
+
+static const unsigned short a_37_displacement[] = {
+    1, 0
+};
+static const short a_37_slot[] = {
+    0, 1
+};
+static const struct among_hash a_37_hash = {
+    4, 2, a_37_displacement, a_37_slot
+};
+
+static const symbol a_37_pool[4] = {
+    0x3C4, 0x3C1, 0x3C4, 0x3C3
+};
+
+static const struct among a_37[2] =
+{
+{ 0, 2, -1, 1 },
+{ 2, 2, -1, 1 }
+};
+
+static const struct among_table a_37_table = {
+    a_37, 2, a_37_pool, 0
+};
+
+
+static const struct among a_38[11] =
+{
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 7, 1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 7, 5, 1 },
+{ 0, 7, -1, 1 },
+{ 0, 8, 7, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, 9, 1 }
+};
+
+static const unsigned short a_39_displacement[] = {
+    1, 4, 14, 0, 12, 21, 0, 1,
+    0, 2, 51, 13, 3, 1, 2, 1,
+    31, 19, 0, 9, 3, 0, 2, 0,
+    0, 1, 3, 35, 4, 139, 24, 0,
+    0, 12, 1, 47, 20, 7, 40, 0,
+    2, 11, 6, 2, 130, 31, 2, 267
+};
+static const short a_39_slot[] = {
+    63, 18, 15, 64, 74, 38, 47, 39,
+    83, 94, 86, 32, 62, 26, 75, 12,
+    14, 30, 54, 37, 79, 29, 90, 82,
+    2, 50, 65, 7, 8, 21, 55, 35,
+    56, 89, 92, 42, 49, 31, 28, 58,
+    10, 16, 36, 87, 85, 41, 34, 25,
+    66, 91, 19, 53, 67, 72, 52, 68,
+    9, 51, 69, 77, 4, 73, 17, 43,
+    80, 44, 24, 93, 20, 81, 3, 48,
+    40, 5, 71, 70, 84, 61, 57, 6,
+    0, 23, 1, 88, 59, 13, 76, 11,
+    22, 27, 78, 45, 60, 33, 46
+};
+static const struct among_hash a_39_hash = {
+    3070, 48, a_39_displacement, a_39_slot
+};
+
+static const symbol a_39_pool[375] = {
+    0x3BC, 0x3B5, 0x3B3, 0x3BB, 0x3BF, 0x3B2, 0x3B9, 0x3BF, 0x3BC, 0x3B7, 0x3C7, 0x3BA, 0x3B1, 0x3C0, 0x3BD, 0x3BF,
+    0x3B2, 0x3B9, 0x3BF, 0x3BC, 0x3B7, 0x3C7, 0x3BC, 0x3B9, 0x3BA, 0x3C1, 0x3BF, 0x3B2, 0x3B9, 0x3BF, 0x3BC, 0x3B7,
+    0x3C7, 0x3B1, 0x3BC, 0x3B7, 0x3BB, 0x3BF, 0x3B4, 0x3B1, 0x3C0, 0x3BE, 0x3B7, 0x3C1, 0x3BF, 0x3BA, 0x3BB, 0x3B9,
+    0x3B2, 0x3BF, 0x3BB, 0x3B9, 0x3B3, 0x3BF, 0x3B4, 0x3B1, 0x3BC, 0x3BF, 0x3C5, 0x3C3, 0x3BF, 0x3C5, 0x3BB, 0x3BC,
+    0x3B1, 0x3BC, 0x3B5, 0x3C1, 0x3B9, 0x3BA, 0x3B1, 0x3BD, 0x3C3, 0x3B1, 0x3C1, 0x3B1, 0x3BA, 0x3B1, 0x3C4, 0x3C3,
+    0x3C6, 0x3C9, 0x3C4, 0x3BF, 0x3C3, 0x3C4, 0x3B5, 0x3C6, 0x3C8, 0x3B7, 0x3BB, 0x3BF, 0x3C4, 0x3B1, 0x3B2, 0x3BA,
+    0x3B1, 0x3BB, 0x3C0, 0x3BF, 0x3C5, 0x3B6, 0x3BA, 0x3B1, 0x3C4, 0x3B1, 0x3B3, 0x3B1, 0x3BB, 0x3B2, 0x3B1, 0x3B8,
+    0x3C5, 0x3B3, 0x3B1, 0x3BB, 0x3B4, 0x3C1, 0x3B1, 0x3B4, 0x3BF, 0x3C5, 0x3BC, 0x3C0, 0x3BF, 0x3BB, 0x3C5, 0x3B4,
+    0x3B1, 0x3C0, 0x3C4, 0x3C3, 0x3B1, 0x3C1, 0x3BB, 0x3B1, 0x3C4, 0x3BA, 0x3BF, 0x3B9, 0x3BB, 0x3B1, 0x3C1, 0x3C6,
+    0x3C0, 0x3B5, 0x3BD, 0x3C4, 0x3B1, 0x3C1, 0x3C6, 0x3C0, 0x3BF, 0x3BB, 0x3C5, 0x3BC, 0x3B7, 0x3C7, 0x3B1, 0x3C4,
+    0x3C3, 0x3B9, 0x3B3, 0x3B3, 0x3BC, 0x3C9, 0x3B1, 0x3BC, 0x3B5, 0x3B8, 0x3B2, 0x3C1, 0x3B1, 0x3C7, 0x3C5, 0x3BA,
+    0x3BF, 0x3BB, 0x3BF, 0x3B3, 0x3B1, 0x3BB, 0x3BA, 0x3B1, 0x3C3, 0x3C4, 0x3B5, 0x3BB, 0x3C0, 0x3BF, 0x3C1, 0x3C4,
+    0x3BF, 0x3BB, 0x3C8, 0x3C5, 0x3C7, 0x3BF, 0x3C0, 0x3BB, 0x3C5, 0x3C0, 0x3BF, 0x3BA, 0x3BF, 0x3C0, 0x3BB, 0x3BF,
+    0x3C5, 0x3B8, 0x3B7, 0x3C1, 0x3BA, 0x3BF, 0x3C1, 0x3BC, 0x3BF, 0x3C1, 0x3C0, 0x3B5, 0x3C1, 0x3B9, 0x3C4, 0x3C1,
+    0x3C0, 0x3BF, 0x3C5, 0x3C1, 0x3B9, 0x3C4, 0x3C5, 0x3C0, 0x3B5, 0x3C1, 0x3B7, 0x3C6, 0x3B1, 0x3B8, 0x3B9, 0x3B3,
+    0x3B3, 0x3B1, 0x3BD, 0x3BF, 0x3C1, 0x3B3, 0x3B5, 0x3BD, 0x3BF, 0x3C1, 0x3B3, 0x3C0, 0x3B5, 0x3BB, 0x3B5, 0x3BA,
+    0x3B2, 0x3BF, 0x3C5, 0x3BB, 0x3BA, 0x3BB, 0x3B1, 0x3BF, 0x3C0, 0x3BB, 0x3B2, 0x3C1, 0x3B1, 0x3C7, 0x3BC, 0x3B2,
+    0x3B5, 0x3C4, 0x3B5, 0x3C1, 0x3C0, 0x3BF, 0x3BB, 0x3B9, 0x3C3, 0x3BF, 0x3C5, 0x3BB, 0x3C4, 0x3BC, 0x3B1, 0x3B9,
+    0x3BD, 0x3C4, 0x3B1, 0x3B2, 0x3C4, 0x3C1, 0x3B1, 0x3B3, 0x3C4, 0x3C3, 0x3B1, 0x3B3, 0x3C3, 0x3C4, 0x3B5, 0x3B3,
+    0x3B1, 0x3C0, 0x3B7, 0x3B3, 0x3B1, 0x3C0, 0x3B9, 0x3B8, 0x3B1, 0x3BD, 0x3B9, 0x3BA, 0x3B2, 0x3B1, 0x3C3, 0x3BA,
+    0x3B4, 0x3B9, 0x3C0, 0x3BB, 0x3B1, 0x3B4, 0x3B1, 0x3C0, 0x3C4, 0x3C3, 0x3BF, 0x3C0, 0x3B4, 0x3B9, 0x3B1, 0x3C4,
+    0x3C0, 0x3BB, 0x3B1, 0x3C4, 0x3B6, 0x3C9, 0x3BD, 0x3C4, 0x3B4, 0x3B9, 0x3B1, 0x3C6, 0x3B1, 0x3BC, 0x3B7, 0x3C7,
+    0x3B4, 0x3B5, 0x3BA, 0x3BC, 0x3B5, 0x3BB, 0x3B3, 0x3B5, 0x3C1, 0x3B8, 0x3C5, 0x3C3, 0x3C4, 0x3B5, 0x3C4, 0x3BF,
+    0x3C1, 0x3C6, 0x3BB, 0x3B9, 0x3C7, 0x3C3, 0x3C0
+};
+
+static const struct among a_39[95] =
+{
+{ 92, 3, -1, 1 },
+{ 288, 4, 0, 1 },
+{ 88, 7, 0, 1 },
+{ 46, 3, -1, 1 },
+{ 45, 4, 3, 1 },
+{ 41, 8, 4, 1 },
+{ 2, 1, -1, 1 },
+{ 105, 2, 6, 1 },
+{ 292, 4, 7, 1 },
+{ 296, 4, 7, 1 },
+{ 236, 5, 6, 1 },
+{ 159, 5, 6, 1 },
+{ 158, 6, 11, 1 },
+{ 300, 4, 6, 1 },
+{ 304, 4, 6, 1 },
+{ 160, 3, 6, 1 },
+{ 241, 5, 6, 1 },
+{ 246, 5, 6, 1 },
+{ 95, 7, -1, 1 },
+{ 111, 1, -1, 1 },
+{ 164, 6, 19, 1 },
+{ 309, 3, 19, 1 },
+{ 308, 4, 21, 1 },
+{ 352, 3, -1, 1 },
+{ 251, 5, -1, 1 },
+{ 23, 2, -1, 1 },
+{ 312, 4, 25, 1 },
+{ 256, 5, -1, 1 },
+{ 316, 4, -1, 1 },
+{ 170, 6, -1, 1 },
+{ 106, 3, -1, 1 },
+{ 102, 7, 30, 1 },
+{ 176, 6, 30, 1 },
+{ 109, 7, 30, 1 },
+{ 355, 3, -1, 1 },
+{ 182, 6, -1, 1 },
+{ 188, 6, -1, 1 },
+{ 198, 2, -1, 1 },
+{ 320, 4, 37, 1 },
+{ 261, 5, 37, 1 },
+{ 194, 6, 37, 1 },
+{ 60, 3, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 49, 8, 42, 1 },
+{ 56, 8, 42, 1 },
+{ 116, 7, 42, 1 },
+{ 266, 5, 42, 1 },
+{ 14, 1, -1, 1 },
+{ 64, 8, 47, 1 },
+{ 13, 1, -1, 1 },
+{ 324, 4, 49, 1 },
+{ 32, 9, 49, 1 },
+{ 123, 7, 49, 1 },
+{ 203, 3, 49, 1 },
+{ 200, 6, 53, 1 },
+{ 328, 4, 49, 1 },
+{ 373, 2, 49, 1 },
+{ 66, 2, -1, 1 },
+{ 358, 3, 57, 1 },
+{ 271, 5, 57, 1 },
+{ 206, 6, -1, 1 },
+{ 212, 6, -1, 1 },
+{ 218, 6, -1, 1 },
+{ 225, 3, -1, 1 },
+{ 59, 1, -1, 1 },
+{ 316, 3, 64, 1 },
+{ 276, 5, 64, 1 },
+{ 72, 8, 64, 1 },
+{ 361, 3, 64, 1 },
+{ 332, 4, -1, 1 },
+{ 336, 4, -1, 1 },
+{ 130, 7, -1, 1 },
+{ 364, 3, -1, 1 },
+{ 224, 6, -1, 1 },
+{ 280, 5, -1, 1 },
+{ 285, 5, -1, 1 },
+{ 340, 4, -1, 1 },
+{ 182, 4, -1, 1 },
+{ 80, 1, -1, 1 },
+{ 344, 4, 78, 1 },
+{ 84, 4, 78, 1 },
+{ 80, 8, 80, 1 },
+{ 231, 5, 78, 1 },
+{ 230, 6, 82, 1 },
+{ 137, 7, 78, 1 },
+{ 144, 7, 78, 1 },
+{ 367, 3, 78, 1 },
+{ 10, 1, -1, 1 },
+{ 348, 4, 87, 1 },
+{ 5, 6, 87, 1 },
+{ 0, 11, 89, 1 },
+{ 11, 11, 89, 1 },
+{ 22, 11, 89, 1 },
+{ 151, 7, 87, 1 },
+{ 370, 3, 87, 1 }
+};
+
+static const struct among_table a_39_table = {
+    a_39, 95, a_39_pool, 0
+};
+
+
+static const struct among a_40[1] =
+{
+{ 0, 5, -1, 1 }
+};
+
+
+static const struct among a_41[31] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+static const unsigned short a_42_displacement[] = {
+    11, 9, 13, 0, 0, 3, 16, 36,
+    1, 0, 9, 8, 10
+};
+static const short a_42_slot[] = {
+    21, 16, 1, 23, 22, 15, 10, 13,
+    4, 7, 12, 8, 17, 24, 9, 14,
+    20, 19, 2, 3, 18, 0, 6, 11,
+    5
+};
+static const struct among_hash a_42_hash = {
+    190, 13, a_42_displacement, a_42_slot
+};
+
+static const symbol a_42_pool[72] = {
+    0x3C0, 0x3B1, 0x3C1, 0x3B1, 0x3BA, 0x3B1, 0x3BB, 0x3B2, 0x3B1, 0x3C1, 0x3BF, 0x3BD, 0x3C3, 0x3BA, 0x3B5, 0x3BB,
+    0x3C3, 0x3B5, 0x3C1, 0x3C0, 0x3B1, 0x3B2, 0x3B1, 0x3C1, 0x3B5, 0x3BD, 0x3B1, 0x3C1, 0x3BC, 0x3C0, 0x3BF, 0x3C1,
+    0x3B8, 0x3B1, 0x3C1, 0x3C1, 0x3C3, 0x3C5, 0x3C1, 0x3C6, 0x3C0, 0x3B1, 0x3B3, 0x3C4, 0x3BF, 0x3BA, 0x3B1, 0x3C0,
+    0x3BB, 0x3B2, 0x3B5, 0x3BD, 0x3BA, 0x3BF, 0x3C0, 0x3B1, 0x3B2, 0x3C1, 0x3BD, 0x3C4, 0x3C1, 0x3BD, 0x3B9, 0x3C6,
+    0x3B1, 0x3B4, 0x3B1, 0x3B8, 0x3B5, 0x3BC, 0x3B1, 0x3BD
+};
+
+static const struct among a_42[25] =
+{
+{ 40, 3, -1, 1 },
+{ 65, 1, -1, 1 },
+{ 64, 2, 1, 1 },
+{ 32, 1, -1, 1 },
+{ 66, 2, 3, 1 },
+{ 43, 3, -1, 1 },
+{ 12, 2, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 12, 4, -1, 1 },
+{ 46, 3, -1, 1 },
+{ 68, 2, -1, 1 },
+{ 70, 2, -1, 1 },
+{ 49, 3, -1, 1 },
+{ 7, 5, -1, 1 },
+{ 52, 3, -1, 1 },
+{ 16, 4, -1, 1 },
+{ 20, 4, -1, 1 },
+{ 24, 4, -1, 1 },
+{ 55, 3, -1, 1 },
+{ 28, 4, -1, 1 },
+{ 32, 4, -1, 1 },
+{ 58, 3, -1, 1 },
+{ 37, 1, -1, 1 },
+{ 61, 3, -1, 1 },
+{ 36, 4, -1, 1 }
+};
+
+static const struct among_table a_42_table = {
+    a_42, 25, a_42_pool, 0
+};
+
+
+static const struct among a_43[2] =
+{
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 }
+};
+
+
+static const struct among a_44[2] =
+{
+{ 0, 6, -1, 1 },
+{ 0, 7, 0, 1 }
+};
+
+static const unsigned short a_45_displacement[] = {
+    1, 1, 6, 0
+};
+static const short a_45_slot[] = {
+    1, 0, 3, 5, 2, 4
+};
+static const struct among_hash a_45_hash = {
+    246, 4, a_45_displacement, a_45_slot
+};
+
+static const symbol a_45_pool[18] = {
+    0x3B1, 0x3BC, 0x3B5, 0x3C4, 0x3B1, 0x3BC, 0x3C6, 0x3B1, 0x3BA, 0x3B1, 0x3C4, 0x3B1, 0x3C0, 0x3B1, 0x3C3, 0x3C5,
+    0x3BC, 0x3C0
+};
+
+static const struct among a_45[6] =
+{
+{ 12, 1, -1, 1 },
+{ 11, 2, 0, 1 },
+{ 7, 6, 1, 1 },
+{ 14, 4, 0, 1 },
+{ 13, 5, 3, 1 },
+{ 0, 7, -1, 1 }
+};
+
+static const struct among_table a_45_table = {
+    a_45, 6, a_45_pool, 0
+};
+
+static const unsigned short a_46_displacement[] = {
+    1, 1, 6, 3, 1
+};
+static const short a_46_slot[] = {
+    2, 5, 0, 6, 4, 1, 7, 8,
+    3
+};
+static const struct among_hash a_46_hash = {
+    174, 5, a_46_displacement, a_46_slot
+};
+
+static const symbol a_46_pool[21] = {
+    0x3C0, 0x3B1, 0x3C1, 0x3B1, 0x3BA, 0x3B1, 0x3BB, 0x3B5, 0x3BA, 0x3C4, 0x3B5, 0x3BB, 0x3C0, 0x3C1, 0x3BF, 0x3BD,
+    0x3B9, 0x3C3, 0x3B6, 0x3BC, 0x3BE
+};
+
+static const struct among a_46[9] =
+{
+{ 18, 1, -1, 1 },
+{ 5, 2, -1, 1 },
+{ 0, 7, 1, 1 },
+{ 7, 5, -1, 1 },
+{ 19, 1, -1, 1 },
+{ 20, 1, -1, 1 },
+{ 12, 3, -1, 1 },
+{ 1, 2, -1, 1 },
+{ 15, 3, -1, 1 }
+};
+
+static const struct among_table a_46_table = {
+    a_46, 9, a_46_pool, 0
+};
+
+
+static const struct among a_47[3] =
+{
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 }
+};
+
+
+static const struct among a_48[6] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+static const unsigned short a_49_displacement[] = {
+    1, 3, 1
+};
+static const short a_49_slot[] = {
+    0, 1, 2, 3, 4
+};
+static const struct among_hash a_49_hash = {
+    562, 3, a_49_displacement, a_49_slot
+};
+
+static const symbol a_49_pool[22] = {
+    0x3C0, 0x3B1, 0x3C1, 0x3B1, 0x3BA, 0x3B1, 0x3C4, 0x3B1, 0x3B8, 0x3C0, 0x3C1, 0x3BF, 0x3C3, 0x3B8, 0x3B4, 0x3B9,
+    0x3B1, 0x3B8, 0x3C3, 0x3C5, 0x3BD, 0x3B8
+};
+
+static const struct among a_49[5] =
+{
+{ 8, 1, -1, 1 },
+{ 14, 4, 0, 1 },
+{ 0, 9, 0, 1 },
+{ 18, 4, 0, 1 },
+{ 9, 5, 0, 1 }
+};
+
+static const struct among_table a_49_table = {
+    a_49, 5, a_49_pool, 0
+};
+
+
+static const struct among a_50[3] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+
+static const struct among a_51[12] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, -1, 1 }
+};
+
+static const unsigned short a_52_displacement[] = {
+    11, 0, 1, 1, 20, 53, 2, 10,
+    0, 46, 1, 0, 6
+};
+static const short a_52_slot[] = {
+    18, 12, 14, 20, 1, 7, 22, 6,
+    4, 2, 19, 11, 13, 17, 23, 16,
+    21, 0, 10, 15, 8, 9, 3, 5,
+    24
+};
+static const struct among_hash a_52_hash = {
+    510, 13, a_52_displacement, a_52_slot
+};
+
+static const symbol a_52_pool[93] = {
+    0x3B5, 0x3BD, 0x3B4, 0x3B9, 0x3B1, 0x3C6, 0x3B5, 0x3C1, 0x3B4, 0x3B5, 0x3C5, 0x3C4, 0x3B5, 0x3C1, 0x3B5, 0x3C5,
+    0x3C0, 0x3BF, 0x3C4, 0x3B5, 0x3B9, 0x3BD, 0x3BA, 0x3B1, 0x3B8, 0x3B1, 0x3C1, 0x3B5, 0x3C5, 0x3BB, 0x3B1, 0x3BC,
+    0x3C0, 0x3B9, 0x3B4, 0x3B5, 0x3C3, 0x3C0, 0x3BF, 0x3B6, 0x3C6, 0x3B1, 0x3C1, 0x3BC, 0x3B1, 0x3BA, 0x3BC, 0x3B5,
+    0x3C3, 0x3B1, 0x3B6, 0x3B5, 0x3BA, 0x3BB, 0x3B9, 0x3C0, 0x3B1, 0x3BD, 0x3B1, 0x3C1, 0x3C1, 0x3B1, 0x3BD, 0x3B7,
+    0x3BA, 0x3B2, 0x3C1, 0x3BF, 0x3BC, 0x3C4, 0x3C3, 0x3B1, 0x3C7, 0x3B1, 0x3B4, 0x3BC, 0x3B5, 0x3B4, 0x3C0, 0x3BB,
+    0x3B5, 0x3B1, 0x3B9, 0x3B8, 0x3B1, 0x3B3, 0x3BA, 0x3C0, 0x3B1, 0x3C4, 0x3BB, 0x3B5, 0x3C7
+};
+
+static const struct among a_52[25] =
+{
+{ 69, 3, -1, 1 },
+{ 72, 3, -1, 1 },
+{ 75, 3, -1, 1 },
+{ 29, 6, -1, 1 },
+{ 8, 2, -1, 1 },
+{ 78, 3, -1, 1 },
+{ 46, 5, -1, 1 },
+{ 34, 6, -1, 1 },
+{ 81, 3, -1, 1 },
+{ 40, 6, -1, 1 },
+{ 84, 3, -1, 1 },
+{ 61, 4, -1, 1 },
+{ 29, 1, -1, 1 },
+{ 31, 1, -1, 1 },
+{ 30, 2, 13, 1 },
+{ 65, 4, 13, 1 },
+{ 15, 7, -1, 1 },
+{ 51, 5, -1, 1 },
+{ 7, 1, -1, 1 },
+{ 0, 8, 18, 1 },
+{ 56, 5, 18, 1 },
+{ 87, 3, -1, 1 },
+{ 22, 7, -1, 1 },
+{ 8, 8, -1, 1 },
+{ 90, 3, -1, 1 }
+};
+
+static const struct among_table a_52_table = {
+    a_52, 25, a_52_pool, 0
+};
+
+
+static const struct among a_53[3] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 }
+};
+
+
+static const struct among a_54[12] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 7, -1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, 10, -1 }
+};
+
+static const unsigned short a_55_displacement[] = {
+    10, 1, 7, 0, 5, 2, 5, 14,
+    1, 1, 9, 0, 15, 1, 2, 1,
+    27, 2, 58, 7, 4, 22, 52
+};
+static const short a_55_slot[] = {
+    19, 32, 28, 15, 25, 16, 14, 6,
+    21, 11, 22, 17, 24, 30, 13, 40,
+    43, 31, 9, 10, 20, 1, 39, 33,
+    8, 38, 2, 3, 7, 18, 5, 35,
+    12, 34, 23, 29, 37, 41, 27, 36,
+    4, 26, 0, 42
+};
+static const struct among_hash a_55_hash = {
+    510, 23, a_55_displacement, a_55_slot
+};
+
+static const symbol a_55_pool[155] = {
+    0x3BA, 0x3C1, 0x3BF, 0x3BA, 0x3B1, 0x3BB, 0x3BF, 0x3C0, 0x3C1, 0x3BF, 0x3C3, 0x3C9, 0x3C0, 0x3BF, 0x3C0, 0x3C3,
+    0x3B9, 0x3B4, 0x3B7, 0x3C1, 0x3BF, 0x3C0, 0x3B1, 0x3BC, 0x3B1, 0x3BB, 0x3BB, 0x3B9, 0x3B4, 0x3B5, 0x3C1, 0x3B2,
+    0x3B5, 0x3BD, 0x3B4, 0x3C1, 0x3BF, 0x3C3, 0x3BF, 0x3C0, 0x3B1, 0x3B9, 0x3BC, 0x3BF, 0x3C3, 0x3C4, 0x3BF, 0x3C5,
+    0x3BB, 0x3B1, 0x3BC, 0x3B1, 0x3C1, 0x3C4, 0x3B9, 0x3C0, 0x3B1, 0x3C3, 0x3C0, 0x3B1, 0x3C1, 0x3BD, 0x3BF, 0x3BC,
+    0x3BF, 0x3C4, 0x3B1, 0x3B2, 0x3B1, 0x3C3, 0x3C4, 0x3C0, 0x3C1, 0x3BF, 0x3C3, 0x3C4, 0x3B1, 0x3BD, 0x3C5, 0x3C3,
+    0x3C4, 0x3C0, 0x3BF, 0x3BB, 0x3C5, 0x3C6, 0x3B1, 0x3B5, 0x3B9, 0x3C0, 0x3C3, 0x3C5, 0x3BC, 0x3C0, 0x3BD, 0x3B5,
+    0x3BF, 0x3C0, 0x3BF, 0x3BB, 0x3BF, 0x3C0, 0x3B1, 0x3BD, 0x3C5, 0x3C0, 0x3B1, 0x3C7, 0x3B1, 0x3C1, 0x3B1, 0x3C0,
+    0x3B5, 0x3C1, 0x3B4, 0x3B9, 0x3B1, 0x3C4, 0x3B5, 0x3C0, 0x3B9, 0x3C4, 0x3C3, 0x3C5, 0x3BD, 0x3C4, 0x3B1, 0x3C0,
+    0x3BF, 0x3C4, 0x3C5, 0x3C0, 0x3BF, 0x3C4, 0x3B1, 0x3B4, 0x3B7, 0x3C6, 0x3C0, 0x3B1, 0x3BC, 0x3C6, 0x3BF, 0x3C5,
+    0x3C1, 0x3BD, 0x3B1, 0x3C5, 0x3BE, 0x3B5, 0x3C6, 0x3C4, 0x3C1, 0x3B1, 0x3C6
+};
+
+static const struct among a_55[44] =
+{
+{ 22, 6, -1, 1 },
+{ 5, 1, -1, 1 },
+{ 22, 4, 1, 1 },
+{ 23, 1, -1, 1 },
+{ 46, 5, 3, 1 },
+{ 32, 2, -1, 1 },
+{ 28, 6, 5, 1 },
+{ 7, 1, -1, 1 },
+{ 86, 4, 7, 1 },
+{ 51, 5, 7, 1 },
+{ 90, 4, 7, 1 },
+{ 94, 4, 7, 1 },
+{ 0, 8, 7, 1 },
+{ 98, 4, 7, 1 },
+{ 7, 8, 7, 1 },
+{ 15, 7, 7, 1 },
+{ 34, 6, 7, 1 },
+{ 56, 3, 7, 1 },
+{ 102, 4, 7, 1 },
+{ 1, 1, -1, 1 },
+{ 56, 5, 19, 1 },
+{ 107, 3, 19, 1 },
+{ 106, 4, 21, 1 },
+{ 110, 4, 19, 1 },
+{ 151, 2, 19, 1 },
+{ 142, 3, 19, 1 },
+{ 45, 1, -1, 1 },
+{ 114, 4, 26, 1 },
+{ 118, 4, 26, 1 },
+{ 122, 4, 26, 1 },
+{ 62, 4, 26, 1 },
+{ 61, 5, 30, 1 },
+{ 126, 4, 26, 1 },
+{ 130, 4, 26, 1 },
+{ 66, 5, 26, 1 },
+{ 40, 6, 26, 1 },
+{ 71, 5, 26, 1 },
+{ 76, 5, 26, 1 },
+{ 145, 3, -1, 1 },
+{ 153, 2, -1, 1 },
+{ 148, 3, -1, 1 },
+{ 134, 4, -1, 1 },
+{ 138, 4, -1, 1 },
+{ 81, 5, -1, 1 }
+};
+
+static const struct among_table a_55_table = {
+    a_55, 44, a_55_pool, 0
+};
+
+
+static const struct among a_56[3] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+
+static const struct among a_57[3] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+static const unsigned short a_58_displacement[] = {
+    2, 0, 5, 1
+};
+static const short a_58_slot[] = {
+    3, 2, 4, 0, 5, 1
+};
+static const struct among_hash a_58_hash = {
+    226, 4, a_58_displacement, a_58_slot
+};
+
+static const symbol a_58_pool[31] = {
+    0x3B4, 0x3C9, 0x3B4, 0x3B5, 0x3BA, 0x3B1, 0x3BD, 0x3BC, 0x3B5, 0x3B3, 0x3B1, 0x3BB, 0x3BF, 0x3BD, 0x3B5, 0x3C1,
+    0x3B7, 0x3BC, 0x3BF, 0x3BD, 0x3C7, 0x3B5, 0x3C1, 0x3C3, 0x3BF, 0x3BD, 0x3B5, 0x3C0, 0x3C4, 0x3B1, 0x3BD
+};
+
+static const struct among a_58[6] =
+{
+{ 6, 1, -1, 1 },
+{ 0, 7, 0, 1 },
+{ 26, 5, 0, 1 },
+{ 7, 7, 0, 1 },
+{ 14, 6, 0, 1 },
+{ 20, 6, 0, 1 }
+};
+
+static const struct among_table a_58_table = {
+    a_58, 6, a_58_pool, 0
+};
+
+
+static const struct among a_59[1] =
+{
+{ 0, 4, -1, 1 }
+};
+
+static const unsigned short a_60_displacement[] = {
+    0, 1, 0, 1, 26, 11
+};
+static const short a_60_slot[] = {
+    8, 5, 6, 9, 4, 2, 0, 7,
+    3, 1
+};
+static const struct among_hash a_60_hash = {
+    252, 6, a_60_displacement, a_60_slot
+};
+
+static const symbol a_60_pool[36] = {
+    0x3BA, 0x3BF, 0x3B9, 0x3BD, 0x3BF, 0x3C7, 0x3C1, 0x3C0, 0x3B1, 0x3BB, 0x3B9, 0x3BC, 0x3C8, 0x3B1, 0x3B5, 0x3B9,
+    0x3BC, 0x3BD, 0x3B4, 0x3C5, 0x3C3, 0x3C7, 0x3C1, 0x3B5, 0x3C5, 0x3C7, 0x3C1, 0x3B1, 0x3C3, 0x3B2, 0x3B1, 0x3C0,
+    0x3BB, 0x3B1, 0x3C7, 0x3C1
+};
+
+static const struct among a_60[10] =
+{
+{ 28, 2, -1, 1 },
+{ 27, 3, 0, 1 },
+{ 30, 3, -1, 1 },
+{ 13, 5, -1, 1 },
+{ 5, 2, -1, 1 },
+{ 33, 3, 4, 1 },
+{ 0, 7, 4, 1 },
+{ 18, 5, 4, 1 },
+{ 23, 4, 4, 1 },
+{ 7, 6, -1, 1 }
+};
+
+static const struct among_table a_60_table = {
+    a_60, 10, a_60_pool, 0
+};
+
+
+static const struct among a_61[3] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 6, 0, 1 },
+{ 0, 6, 0, 1 }
+};
+
+static const unsigned short a_62_displacement[] = {
+    1, 0, 95, 0
+};
+static const short a_62_slot[] = {
+    3, 1, 4, 5, 2, 0
+};
+static const struct among_hash a_62_hash = {
+    2586, 4, a_62_displacement, a_62_slot
+};
+
+static const symbol a_62_pool[27] = {
+    0x3C3, 0x3C4, 0x3C1, 0x3B1, 0x3B2, 0x3BF, 0x3BC, 0x3BF, 0x3C5, 0x3C4, 0x3C3, 0x3BA, 0x3B1, 0x3BA, 0x3BF, 0x3BC,
+    0x3BF, 0x3C5, 0x3C4, 0x3C3, 0x3B5, 0x3BE, 0x3C9, 0x3BD, 0x3C3, 0x3C0, 0x3B9
+};
+
+static const struct among a_62[6] =
+{
+{ 24, 3, -1, 1 },
+{ 23, 1, -1, 1 },
+{ 20, 4, 1, 1 },
+{ 2, 1, -1, 1 },
+{ 0, 11, -1, 1 },
+{ 11, 9, -1, 1 }
+};
+
+static const struct among_table a_62_table = {
+    a_62, 6, a_62_pool, 0
+};
+
+
+static const struct among a_63[3] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 6, 0, 1 },
+{ 0, 6, 0, 1 }
+};
+
+static const unsigned short a_64_displacement[] = {
+    3, 1, 39, 0
+};
+static const short a_64_slot[] = {
+    6, 1, 2, 5, 0, 3, 4
+};
+static const struct among_hash a_64_hash = {
+    358, 4, a_64_displacement, a_64_slot
+};
+
+static const symbol a_64_pool[26] = {
+    0x3C0, 0x3B1, 0x3C1, 0x3B1, 0x3C3, 0x3BF, 0x3C5, 0x3C3, 0x3B1, 0x3BB, 0x3BB, 0x3BF, 0x3C3, 0x3BF, 0x3C5, 0x3C3,
+    0x3C9, 0x3C1, 0x3B9, 0x3BF, 0x3C0, 0x3BB, 0x3B1, 0x3B6, 0x3C6, 0x3C7
+};
+
+static const struct among a_64[7] =
+{
+{ 22, 2, -1, 1 },
+{ 16, 6, -1, 1 },
+{ 3, 5, -1, 1 },
+{ 0, 8, 2, 1 },
+{ 8, 8, -1, 1 },
+{ 24, 1, -1, 1 },
+{ 25, 1, -1, 1 }
+};
+
+static const struct among_table a_64_table = {
+    a_64, 7, a_64_pool, 0
+};
+
+
+static const struct among a_65[3] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 }
+};
+
+
+static const struct among a_66[84] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 5, 0, 1 },
+{ 0, 6, 0, 1 },
+{ 0, 7, 2, 1 },
+{ 0, 6, 0, 1 },
+{ 0, 7, 4, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 5, 6, 1 },
+{ 0, 5, 6, 1 },
+{ 0, 7, 8, 1 },
+{ 0, 5, 6, 1 },
+{ 0, 6, 6, 1 },
+{ 0, 4, 6, 1 },
+{ 0, 6, 12, 1 },
+{ 0, 7, 6, 1 },
+{ 0, 7, 6, 1 },
+{ 0, 8, 15, 1 },
+{ 0, 7, 6, 1 },
+{ 0, 6, 6, 1 },
+{ 0, 7, 18, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 4, 21, 1 },
+{ 0, 5, 21, 1 },
+{ 0, 4, 21, 1 },
+{ 0, 5, 21, 1 },
+{ 0, 4, 21, 1 },
+{ 0, 4, 21, 1 },
+{ 0, 5, 27, 1 },
+{ 0, 4, 21, 1 },
+{ 0, 4, 21, 1 },
+{ 0, 5, 30, 1 },
+{ 0, 5, 21, 1 },
+{ 0, 6, 21, 1 },
+{ 0, 7, 33, 1 },
+{ 0, 2, 21, 1 },
+{ 0, 3, 35, 1 },
+{ 0, 4, 35, 1 },
+{ 0, 4, 35, 1 },
+{ 0, 2, 21, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 40, 1 },
+{ 0, 4, 40, 1 },
+{ 0, 6, 42, 1 },
+{ 0, 4, 40, 1 },
+{ 0, 5, 40, 1 },
+{ 0, 8, 45, 1 },
+{ 0, 9, 46, 1 },
+{ 0, 5, 40, 1 },
+{ 0, 6, 48, 1 },
+{ 0, 6, 40, 1 },
+{ 0, 7, 50, 1 },
+{ 0, 4, 40, 1 },
+{ 0, 5, 52, 1 },
+{ 0, 7, 40, 1 },
+{ 0, 8, 54, 1 },
+{ 0, 7, 40, 1 },
+{ 0, 8, 56, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 58, 1 },
+{ 0, 5, 58, 1 },
+{ 0, 6, 60, 1 },
+{ 0, 5, 58, 1 },
+{ 0, 5, 58, 1 },
+{ 0, 6, 63, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 65, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 69, 1 },
+{ 0, 4, 69, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 73, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 76, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 78, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 80, 1 },
+{ 0, 3, 80, 1 },
+{ 0, 3, 80, 1 }
+};
+
+
+static const struct among a_67[8] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+static const unsigned char g_v[] = { 81, 65, 16, 1 };
+
+static const unsigned char g_v2[] = { 81, 65, 0, 1 };
+
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B1:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B3) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x3B1:
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 0x3BA:
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0x3C3) break;
+                                        i = 0;
+                                        break;
+                                    case 0x3C6:
+                                        i = 1;
+                                        break;
+                                }
+                                break;
+                            case 0x3BF:
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 0x3BB:
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0x3BF) break;
+                                        i = 2;
+                                        break;
+                                    case 0x3C3:
+                                        i = 3;
+                                        break;
+                                    case 0x3C4:
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0x3B1) break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 0x3C4) break;
+                                        i = 4;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x3C4:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x3B1:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x3B5:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x3C1) break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0x3BA) break;
+                                        i = 5;
+                                        break;
+                                    case 0x3C1:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x3B5) break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 0x3C0:
+                                                i = 6;
+                                                break;
+                                            case 0x3C4:
+                                                i = 7;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 0x3BF:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3BD) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3BF) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x3B3) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x3B5) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0x3B3) break;
+                                i = 8;
+                                break;
+                            case 0x3C9:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x3C4:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x3C3) break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0x3B5) break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 0x3B8) break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0x3B1) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0x3BA) break;
+                                        i = 9;
+                                        break;
+                                    case 0x3C6:
+                                        i = 10;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x3B7:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C1) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B5) break;
+                if (n <= 5) break;
+                if (q[-6] != 0x3C0) break;
+                i = 11;
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C9) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x3B9:
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3B3) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x3B1:
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 0x3BA:
+                                        if (n <= 6) break;
+                                        if (q[-7] != 0x3C3) break;
+                                        i = 12;
+                                        break;
+                                    case 0x3C6:
+                                        i = 13;
+                                        break;
+                                }
+                                break;
+                            case 0x3BF:
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 0x3BB:
+                                        if (n <= 6) break;
+                                        if (q[-7] != 0x3BF) break;
+                                        i = 14;
+                                        break;
+                                    case 0x3C3:
+                                        i = 15;
+                                        break;
+                                    case 0x3C4:
+                                        if (n <= 6) break;
+                                        if (q[-7] != 0x3B1) break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0x3C4) break;
+                                        i = 16;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x3C4:
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x3B1:
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 0x3B5:
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0x3C1) break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 0x3BA) break;
+                                        i = 17;
+                                        break;
+                                    case 0x3C1:
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0x3B5) break;
+                                        if (n <= 6) break;
+                                        switch (q[-7]) {
+                                            case 0x3C0:
+                                                i = 18;
+                                                break;
+                                            case 0x3C4:
+                                                i = 19;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 0x3BF:
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3BD) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x3BF) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x3B3) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0x3B5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0x3B3) break;
+                                i = 20;
+                                break;
+                            case 0x3C9:
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 0x3C4:
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0x3C3) break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 0x3B5) break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0x3B8) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0x3B1) break;
+                                        if (n <= 9) break;
+                                        if (q[-10] != 0x3BA) break;
+                                        i = 21;
+                                        break;
+                                    case 0x3C6:
+                                        i = 22;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B1:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x3B5:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3C1) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3BA) break;
+                                i = 23;
+                                break;
+                            case 0x3C1:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3B5) break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 0x3C0:
+                                        i = 24;
+                                        break;
+                                    case 0x3C4:
+                                        i = 25;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x3BF:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x3BD:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3BF) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3B3) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x3B5) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x3B3) break;
+                                i = 26;
+                                break;
+                            case 0x3C4:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x3B1:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 0x3B5:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0x3C1) break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 0x3BA) break;
+                                                i = 27;
+                                                break;
+                                            case 0x3C1:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0x3B5) break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 0x3C0:
+                                                        i = 28;
+                                                        break;
+                                                    case 0x3C4:
+                                                        i = 29;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 0x3BF:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x3BD) break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0x3BF) break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 0x3B3) break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0x3B5) break;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0x3B3) break;
+                                        i = 30;
+                                        break;
+                                    case 0x3C9:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 0x3C4:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0x3C3) break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 0x3B5) break;
+                                                if (n <= 7) break;
+                                                if (q[-8] != 0x3B8) break;
+                                                if (n <= 8) break;
+                                                if (q[-9] != 0x3B1) break;
+                                                if (n <= 9) break;
+                                                if (q[-10] != 0x3BA) break;
+                                                i = 31;
+                                                break;
+                                            case 0x3C6:
+                                                i = 32;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x3C9:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x3C4:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3C3) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3B5) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x3B8) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x3B1) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0x3BA) break;
+                                i = 33;
+                                break;
+                            case 0x3C6:
+                                i = 34;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x3C5:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B9) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B3) break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x3B1:
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 0x3BA:
+                                if (n <= 6) break;
+                                if (q[-7] != 0x3C3) break;
+                                i = 35;
+                                break;
+                            case 0x3C6:
+                                i = 36;
+                                break;
+                        }
+                        break;
+                    case 0x3BF:
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 0x3BB:
+                                if (n <= 6) break;
+                                if (q[-7] != 0x3BF) break;
+                                i = 37;
+                                break;
+                            case 0x3C3:
+                                i = 38;
+                                break;
+                            case 0x3C4:
+                                if (n <= 6) break;
+                                if (q[-7] != 0x3B1) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0x3C4) break;
+                                i = 39;
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+static const symbol s_0[] = { 0x3C6, 0x3B1 };
+static const symbol s_1[] = { 0x3C3, 0x3BA, 0x3B1 };
+static const symbol s_2[] = { 0x3BF, 0x3BB, 0x3BF };
+static const symbol s_3[] = { 0x3C3, 0x3BF };
+static const symbol s_4[] = { 0x3C4, 0x3B1, 0x3C4, 0x3BF };
+static const symbol s_5[] = { 0x3BA, 0x3C1, 0x3B5 };
+static const symbol s_6[] = { 0x3C0, 0x3B5, 0x3C1 };
+static const symbol s_7[] = { 0x3C4, 0x3B5, 0x3C1 };
+static const symbol s_8[] = { 0x3C6, 0x3C9 };
+static const symbol s_9[] = { 0x3BA, 0x3B1, 0x3B8, 0x3B5, 0x3C3, 0x3C4 };
+static const symbol s_10[] = { 0x3B3, 0x3B5, 0x3B3, 0x3BF, 0x3BD };
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B1:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B6) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B9) break;
+                i = 0;
+                break;
+            case 0x3B5:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B6:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B9) break;
+                        i = 1;
+                        break;
+                    case 0x3BC:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x3B1:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3B6) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3B9) break;
+                                i = 2;
+                                break;
+                            case 0x3C5:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3BF) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3B6) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x3B9) break;
+                                i = 3;
+                                break;
+                        }
+                        break;
+                    case 0x3BD:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x3B1:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3B6) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3B9) break;
+                                i = 4;
+                                break;
+                            case 0x3C5:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3BF) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3B6) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x3B9) break;
+                                i = 5;
+                                break;
+                        }
+                        break;
+                    case 0x3C4:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x3B1:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3B6) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3B9) break;
+                                i = 6;
+                                break;
+                            case 0x3B5:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3B6) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3B9) break;
+                                i = 7;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x3B9:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B6) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B9) break;
+                i = 8;
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B6) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3B9) break;
+                        i = 9;
+                        break;
+                    case 0x3C5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3BF) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3B6) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B9) break;
+                        i = 10;
+                        break;
+                }
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B6) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3B9) break;
+                        i = 11;
+                        break;
+                    case 0x3B9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B5) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3B6) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B9) break;
+                        i = 12;
+                        break;
+                }
+                break;
+            case 0x3C9:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B6) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B9) break;
+                i = 13;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+static const symbol s_11[] = { 0x3B9 };
+static const symbol s_12[] = { 0x3B9, 0x3B6 };
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B1:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BA) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B7) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B8) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3C9) break;
+                i = 0;
+                break;
+            case 0x3B5:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3BA:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B7) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3B8) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3C9) break;
+                        i = 1;
+                        break;
+                    case 0x3BC:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B1) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BA) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B7) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3B8) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x3C9) break;
+                        i = 2;
+                        break;
+                    case 0x3BD:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B1) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BA) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B7) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3B8) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x3C9) break;
+                        i = 3;
+                        break;
+                    case 0x3C4:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B1) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BA) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B7) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3B8) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x3C9) break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B7) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B8) break;
+                if (n <= 5) break;
+                if (q[-6] != 0x3C9) break;
+                i = 5;
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B7) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B8) break;
+                if (n <= 5) break;
+                if (q[-6] != 0x3C9) break;
+                i = 6;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+static const symbol s_13[] = { 0x3C9, 0x3BD };
+
+static int find_among_b_7(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B1:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C3) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B9) break;
+                i = 0;
+                break;
+            case 0x3B5:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3BC:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B1) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3C3) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B9) break;
+                        i = 1;
+                        break;
+                    case 0x3BD:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B1) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3C3) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B9) break;
+                        i = 2;
+                        break;
+                    case 0x3C3:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B9) break;
+                        i = 3;
+                        break;
+                    case 0x3C4:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B1) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3C3) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B9) break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C3) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B9) break;
+                i = 5;
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C3) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B9) break;
+                i = 6;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_7[i].s_size;
+    return a_7[i].result;
+}
+static const symbol s_14[] = { 0x3B9, 0x3C3, 0x3B1 };
+static const symbol s_15[] = { 0x3B9, 0x3C3 };
+static const symbol s_16[] = { 0x3B9 };
+static const symbol s_17[] = { 0x3B9, 0x3C3 };
+
+static int find_among_b_9(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B5:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3BC:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C5) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3C3) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3B9) break;
+                        i = 0;
+                        break;
+                    case 0x3BD:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C5) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3C3) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3B9) break;
+                        i = 1;
+                        break;
+                    case 0x3C4:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B5) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3C3) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B9) break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0x3B9:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C3) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B9) break;
+                i = 3;
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BF) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C3) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B9) break;
+                i = 4;
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C3) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B9) break;
+                i = 5;
+                break;
+            case 0x3C9:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C3) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B9) break;
+                i = 6;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_9[i].s_size;
+    return a_9[i].result;
+}
+static const symbol s_18[] = { 0x3B9 };
+
+static int find_among_b_11(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B1:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C3) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B9) break;
+                i = 0;
+                break;
+            case 0x3B5:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C3) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B9) break;
+                i = 1;
+                break;
+            case 0x3B7:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C3) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B9) break;
+                i = 2;
+                break;
+            case 0x3B9:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C4) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C3) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B9) break;
+                i = 3;
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C4) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C3) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B9) break;
+                i = 4;
+                break;
+            case 0x3BF:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C3) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B9) break;
+                i = 5;
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C4) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3C3) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B9) break;
+                        i = 6;
+                        break;
+                    case 0x3B7:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C4) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3C3) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B9) break;
+                        i = 7;
+                        break;
+                    case 0x3BF:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C4) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3C3) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B9) break;
+                        i = 8;
+                        break;
+                    case 0x3C5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3BF) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3C4) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3C3) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3B9) break;
+                        i = 9;
+                        break;
+                }
+                break;
+            case 0x3C5:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C4) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C3) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B9) break;
+                i = 10;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_11[i].s_size;
+    return a_11[i].result;
+}
+static const symbol s_19[] = { 0x3B9 };
+static const symbol s_20[] = { 0x3B9, 0x3C3, 0x3C4 };
+
+static int find_among_b_14(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B9:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BC) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C3) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B9) break;
+                i = 0;
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BC) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C3) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B9) break;
+                i = 1;
+                break;
+            case 0x3BF:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BC) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C3) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B9) break;
+                i = 2;
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3BF:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3BC) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3C3) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B9) break;
+                        i = 3;
+                        break;
+                    case 0x3C5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3BF) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BC) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3C3) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3B9) break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 0x3C5:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BC) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C3) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B9) break;
+                i = 5;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_14[i].s_size;
+    return a_14[i].result;
+}
+static const symbol s_21[] = { 0x3B9, 0x3C3, 0x3BC };
+static const symbol s_22[] = { 0x3B9 };
+
+static int find_among_b_13(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3BA:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B9) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x3BC:
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3C4) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3B1) break;
+                        i = 0;
+                        break;
+                    case 0x3BD:
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3B8) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B5) break;
+                        i = 1;
+                        break;
+                    case 0x3C0:
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3C4) break;
+                        i = 2;
+                        break;
+                    case 0x3C4:
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x3BA:
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3B5) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x3BB) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x3BA) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0x3B5) break;
+                                i = 3;
+                                break;
+                            case 0x3C0:
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3B5) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x3BA) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x3C3) break;
+                                i = 4;
+                                break;
+                            case 0x3C3:
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3C9) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x3BD) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x3B3) break;
+                                i = 5;
+                                if (n <= 7) break;
+                                if (q[-8] != 0x3B1) break;
+                                i = 6;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B9) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x3C1:
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x3B4:
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3BD) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x3B1) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x3BE) break;
+                                if (n <= 7) break;
+                                if (q[-8] != 0x3B5) break;
+                                if (n <= 8) break;
+                                if (q[-9] != 0x3BB) break;
+                                if (n <= 9) break;
+                                if (q[-10] != 0x3B1) break;
+                                i = 7;
+                                break;
+                            case 0x3C4:
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3B1) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x3B5) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x3B8) break;
+                                i = 8;
+                                break;
+                        }
+                        break;
+                    case 0x3C4:
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BD) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3B6) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x3C5) break;
+                        if (n <= 7) break;
+                        if (q[-8] != 0x3B2) break;
+                        i = 9;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_13[i].s_size;
+    return a_13[i].result;
+}
+static const symbol s_23[] = { 0x3B1, 0x3B3, 0x3BD, 0x3C9, 0x3C3, 0x3C4 };
+static const symbol s_24[] = { 0x3B1, 0x3C4, 0x3BF, 0x3BC };
+static const symbol s_25[] = { 0x3B3, 0x3BD, 0x3C9, 0x3C3, 0x3C4 };
+static const symbol s_26[] = { 0x3B5, 0x3B8, 0x3BD };
+static const symbol s_27[] = { 0x3B5, 0x3BA, 0x3BB, 0x3B5, 0x3BA, 0x3C4 };
+static const symbol s_28[] = { 0x3C3, 0x3BA, 0x3B5, 0x3C0, 0x3C4 };
+static const symbol s_29[] = { 0x3C4, 0x3BF, 0x3C0 };
+static const symbol s_30[] = { 0x3B1, 0x3BB, 0x3B5, 0x3BE, 0x3B1, 0x3BD, 0x3B4, 0x3C1 };
+static const symbol s_31[] = { 0x3B2, 0x3C5, 0x3B6, 0x3B1, 0x3BD, 0x3C4 };
+static const symbol s_32[] = { 0x3B8, 0x3B5, 0x3B1, 0x3C4, 0x3C1 };
+
+static int find_among_b_16(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B1:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B1) break;
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x3B4:
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3C5) break;
+                        if (n <= 6) break;
+                        if (q[-7] != 0x3BF) break;
+                        i = 0;
+                        break;
+                    case 0x3C1:
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3B1) break;
+                        i = 1;
+                        break;
+                }
+                break;
+            case 0x3B9:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BA) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B1) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x3B4:
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3C5) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3BF) break;
+                        i = 2;
+                        break;
+                    case 0x3C1:
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B1) break;
+                        i = 3;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_16[i].s_size;
+    return a_16[i].result;
+}
+static const symbol s_33[] = { 0x3B1, 0x3C1, 0x3B1, 0x3BA };
+
+static int find_among_b_18(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B1:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3BA) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3B1) break;
+                        i = 0;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3C1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3B1) break;
+                        i = 1;
+                        break;
+                    case 0x3C3:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C4) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3B9) break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0x3B9:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BA) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B1) break;
+                i = 3;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C1) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B1) break;
+                i = 4;
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C3) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C4) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B9) break;
+                i = 5;
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C3) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3C4) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B9) break;
+                        i = 6;
+                        break;
+                    case 0x3B5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C3) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3C4) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B9) break;
+                        i = 7;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_18[i].s_size;
+    return a_18[i].result;
+}
+static const symbol s_34[] = { 0x3B1, 0x3BA };
+static const symbol s_35[] = { 0x3B9, 0x3C4, 0x3C3 };
+static const symbol s_36[] = { 0x3BA, 0x3BF, 0x3C1 };
+static const symbol s_37[] = { 0x3B9, 0x3C4, 0x3C3 };
+
+static int find_among_b_21(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B1:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B4) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B9) break;
+                i = 0;
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B9) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B4) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B9) break;
+                i = 1;
+                break;
+            case 0x3BF:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B4) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B9) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_21[i].s_size;
+    return a_21[i].result;
+}
+static const symbol s_38[] = { 0x3B9, 0x3B4 };
+
+static int find_among_b_20(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B5:
+                i = 0;
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B9) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B1) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3C0) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_20[i].s_size;
+    return a_20[i].result;
+}
+static const symbol s_39[] = { 0x3B9, 0x3B4 };
+
+static int find_among_b_23(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B5:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BA) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C3) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B9) break;
+                i = 0;
+                break;
+            case 0x3BF:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BA) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C3) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B9) break;
+                i = 1;
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C3) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B9) break;
+                i = 2;
+                break;
+            case 0x3C5:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C3) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B9) break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_23[i].s_size;
+    return a_23[i].result;
+}
+static const symbol s_40[] = { 0x3B9, 0x3C3, 0x3BA };
+
+static int find_among_b_24(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B4) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B1) break;
+                i = 0;
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B4) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B1) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_24[i].s_size;
+    return a_24[i].result;
+}
+
+static int find_among_b_25(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B9:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B3:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B1) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3B9) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B3) break;
+                        i = 0;
+                        break;
+                    case 0x3B5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B8) break;
+                        i = 1;
+                        break;
+                }
+                break;
+            case 0x3BA:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BF) break;
+                i = 2;
+                break;
+            case 0x3BC:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BC) break;
+                i = 3;
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BC) break;
+                i = 4;
+                break;
+            case 0x3C0:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BC) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C0) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3BC) break;
+                i = 5;
+                break;
+            case 0x3C1:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B5:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x3B8:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3B5) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3C0) break;
+                                i = 6;
+                                break;
+                            case 0x3C4:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3B1) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3C0) break;
+                                i = 7;
+                                break;
+                        }
+                        break;
+                    case 0x3C5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3BA) break;
+                        i = 8;
+                        break;
+                }
+                break;
+            case 0x3C4:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BD) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C4) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3BD) break;
+                i = 9;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_25[i].s_size;
+    return a_25[i].result;
+}
+static const symbol s_41[] = { 0x3B1, 0x3B4 };
+
+static int find_among_b_26(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B4) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B5) break;
+                i = 0;
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B4) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B5) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_26[i].s_size;
+    return a_26[i].result;
+}
+
+static int find_among_b_27(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3BB:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BC) break;
+                i = 0;
+                break;
+            case 0x3C0:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B4) break;
+                        i = 1;
+                        break;
+                    case 0x3B7:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B3) break;
+                        i = 2;
+                        break;
+                    case 0x3B9:
+                        i = 3;
+                        break;
+                    case 0x3BC:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B5) break;
+                        i = 4;
+                        break;
+                    case 0x3BF:
+                        i = 5;
+                        break;
+                    case 0x3C3:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B1) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3C1) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3BA) break;
+                        i = 6;
+                        break;
+                    case 0x3C5:
+                        i = 7;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_27[i].s_size;
+    return a_27[i].result;
+}
+static const symbol s_42[] = { 0x3B5, 0x3B4 };
+
+static int find_among_b_28(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B4) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C5) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3BF) break;
+                i = 0;
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B4) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C5) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3BF) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_28[i].s_size;
+    return a_28[i].result;
+}
+
+static int find_among_b_29(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B3:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C4) break;
+                i = 0;
+                break;
+            case 0x3B5:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C6) break;
+                i = 1;
+                break;
+            case 0x3BA:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B9) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BB) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3BA) break;
+                        i = 2;
+                        break;
+                    case 0x3C1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B1) break;
+                        i = 3;
+                        break;
+                    case 0x3C3:
+                        i = 4;
+                        break;
+                }
+                break;
+            case 0x3BB:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C4) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3B5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3C0) break;
+                        i = 5;
+                        break;
+                    case 0x3B5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B2) break;
+                        i = 6;
+                        break;
+                    case 0x3C5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3BF) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BB) break;
+                        i = 7;
+                        break;
+                    case 0x3C6:
+                        i = 8;
+                        break;
+                }
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C7) break;
+                i = 9;
+                break;
+            case 0x3BE:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BB) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C0) break;
+                i = 10;
+                break;
+            case 0x3C0:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C3) break;
+                i = 11;
+                break;
+            case 0x3C1:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C6) break;
+                i = 12;
+                break;
+            case 0x3C3:
+                i = 13;
+                break;
+            case 0x3C7:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BB) break;
+                i = 14;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_29[i].s_size;
+    return a_29[i].result;
+}
+static const symbol s_43[] = { 0x3BF, 0x3C5, 0x3B4 };
+
+static int find_among_b_30(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B5) break;
+                i = 0;
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B5) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_30[i].s_size;
+    return a_30[i].result;
+}
+static const symbol s_44[] = { 0x3B5 };
+
+static int find_among_b_32(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B1:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B9) break;
+                i = 0;
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B9) break;
+                i = 1;
+                break;
+            case 0x3C5:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B9) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_32[i].s_size;
+    return a_32[i].result;
+}
+static const symbol s_45[] = { 0x3B9 };
+
+static int find_among_b_33(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B1:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BA) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B9) break;
+                i = 0;
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B9) break;
+                i = 1;
+                break;
+            case 0x3BF:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BA) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B9) break;
+                i = 2;
+                break;
+            case 0x3C5:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B9) break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_33[i].s_size;
+    return a_33[i].result;
+}
+static const symbol s_46[] = { 0x3B9, 0x3BA };
+static const symbol s_47[] = { 0x3B9, 0x3BA };
+static const symbol s_48[] = { 0x3B1, 0x3B3, 0x3B1, 0x3BC, 0x3B5 };
+static const symbol s_49[] = { 0x3B1, 0x3B3, 0x3B1, 0x3BC };
+
+static int find_among_b_35(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x3B5) break;
+        if (n <= 1) break;
+        if (q[-2] != 0x3BC) break;
+        if (n <= 2) break;
+        if (q[-3] != 0x3B1) break;
+        if (n <= 3) break;
+        switch (q[-4]) {
+            case 0x3B3:
+                if (n <= 4) break;
+                if (q[-5] != 0x3B1) break;
+                i = 0;
+                break;
+            case 0x3BA:
+                if (n <= 4) break;
+                if (q[-5] != 0x3B7) break;
+                i = 1;
+                if (n <= 5) break;
+                if (q[-6] != 0x3B8) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x3B7) break;
+                i = 2;
+                break;
+            case 0x3C3:
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x3B7:
+                        i = 3;
+                        break;
+                    case 0x3C5:
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3BF) break;
+                        i = 4;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_35[i].s_size;
+    return a_35[i].result;
+}
+static const symbol s_50[] = { 0x3B1, 0x3BC, 0x3B5 };
+static const symbol s_51[] = { 0x3B1, 0x3BC };
+
+static int find_among_b_38(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x3B5) break;
+        if (n <= 1) break;
+        if (q[-2] != 0x3BD) break;
+        if (n <= 2) break;
+        if (q[-3] != 0x3B1) break;
+        if (n <= 3) break;
+        switch (q[-4]) {
+            case 0x3B3:
+                if (n <= 4) break;
+                if (q[-5] != 0x3B1) break;
+                i = 0;
+                break;
+            case 0x3BA:
+                if (n <= 4) break;
+                if (q[-5] != 0x3B7) break;
+                i = 1;
+                if (n <= 5) break;
+                if (q[-6] != 0x3B8) break;
+                if (n <= 6) break;
+                if (q[-7] != 0x3B7) break;
+                i = 2;
+                break;
+            case 0x3C3:
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x3B7:
+                        i = 3;
+                        break;
+                    case 0x3C5:
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3BF) break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 0x3C4:
+                if (n <= 4) break;
+                switch (q[-5]) {
+                    case 0x3BD:
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 0x3BF:
+                                i = 5;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x3B9) break;
+                                i = 6;
+                                break;
+                            case 0x3C5:
+                                if (n <= 6) break;
+                                if (q[-7] != 0x3BF) break;
+                                i = 7;
+                                if (n <= 7) break;
+                                if (q[-8] != 0x3B9) break;
+                                i = 8;
+                                break;
+                        }
+                        break;
+                    case 0x3BF:
+                        i = 9;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3B9) break;
+                        i = 10;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_38[i].s_size;
+    return a_38[i].result;
+}
+static const symbol s_52[] = { 0x3B1, 0x3B3, 0x3B1, 0x3BD };
+static const symbol s_53[] = { 0x3B1, 0x3BD, 0x3B5 };
+static const symbol s_54[] = { 0x3B1, 0x3BD };
+static const symbol s_55[] = { 0x3B1, 0x3BD };
+
+static int find_among_b_40(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x3B5) break;
+        if (n <= 1) break;
+        if (q[-2] != 0x3C4) break;
+        if (n <= 2) break;
+        if (q[-3] != 0x3B5) break;
+        if (n <= 3) break;
+        if (q[-4] != 0x3C3) break;
+        if (n <= 4) break;
+        if (q[-5] != 0x3B7) break;
+        i = 0;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_40[i].s_size;
+    return a_40[i].result;
+}
+static const symbol s_56[] = { 0x3B5, 0x3C4, 0x3B5 };
+static const symbol s_57[] = { 0x3B5, 0x3C4 };
+
+static int find_among_b_41(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B4:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3BD:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x3B5:
+                                i = 0;
+                                break;
+                            case 0x3C5:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3C3) break;
+                                i = 1;
+                                break;
+                        }
+                        break;
+                    case 0x3BF:
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0x3B8:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B1:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x3B9:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3B4) break;
+                                i = 3;
+                                break;
+                            case 0x3BA:
+                                i = 4;
+                                break;
+                            case 0x3C1:
+                                i = 5;
+                                break;
+                            case 0x3C4:
+                                i = 6;
+                                break;
+                        }
+                        break;
+                    case 0x3B9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C4) break;
+                        i = 7;
+                        break;
+                    case 0x3BA:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B5) break;
+                        i = 8;
+                        break;
+                    case 0x3BD:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x3B5:
+                                i = 9;
+                                break;
+                            case 0x3C5:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3C3) break;
+                                i = 10;
+                                break;
+                        }
+                        break;
+                    case 0x3BF:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C1) break;
+                        i = 11;
+                        break;
+                    case 0x3C1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B5) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3C0) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3C5) break;
+                        i = 12;
+                        break;
+                    case 0x3C3:
+                        i = 13;
+                        break;
+                    case 0x3C5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B5) break;
+                        i = 14;
+                        break;
+                }
+                break;
+            case 0x3BA:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B1) break;
+                i = 15;
+                break;
+            case 0x3BB:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C6) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3C9) break;
+                        i = 16;
+                        break;
+                    case 0x3BF:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B2) break;
+                        i = 17;
+                        break;
+                }
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B1) break;
+                        i = 18;
+                        break;
+                    case 0x3BF:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x3C0:
+                                i = 19;
+                                break;
+                            case 0x3C1:
+                                i = 20;
+                                break;
+                        }
+                        break;
+                    case 0x3C5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C3) break;
+                        i = 21;
+                        break;
+                }
+                break;
+            case 0x3C1:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B2) break;
+                        i = 22;
+                        break;
+                    case 0x3B2:
+                        i = 23;
+                        break;
+                    case 0x3B9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B1) break;
+                        i = 24;
+                        break;
+                    case 0x3BF:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C6) break;
+                        i = 25;
+                        break;
+                    case 0x3C5:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x3B5:
+                                i = 26;
+                                break;
+                            case 0x3C0:
+                                i = 27;
+                                break;
+                        }
+                        break;
+                    case 0x3C9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C7) break;
+                        i = 28;
+                        break;
+                }
+                break;
+            case 0x3C4:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BD) break;
+                i = 29;
+                break;
+            case 0x3C7:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C3) break;
+                i = 30;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_41[i].s_size;
+    return a_41[i].result;
+}
+static const symbol s_58[] = { 0x3B5, 0x3C4 };
+static const symbol s_59[] = { 0x3B5, 0x3C4 };
+
+static int find_among_b_43(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x3C3) break;
+        if (n <= 1) break;
+        if (q[-2] != 0x3B1) break;
+        if (n <= 2) break;
+        if (q[-3] != 0x3C4) break;
+        if (n <= 3) break;
+        if (q[-4] != 0x3BD) break;
+        if (n <= 4) break;
+        switch (q[-5]) {
+            case 0x3BF:
+                i = 0;
+                break;
+            case 0x3C9:
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_43[i].s_size;
+    return a_43[i].result;
+}
+static const symbol s_60[] = { 0x3B1, 0x3C1, 0x3C7 };
+static const symbol s_61[] = { 0x3BF, 0x3BD, 0x3C4 };
+static const symbol s_62[] = { 0x3BA, 0x3C1, 0x3B5 };
+static const symbol s_63[] = { 0x3C9, 0x3BD, 0x3C4 };
+
+static int find_among_b_44(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x3B5) break;
+        if (n <= 1) break;
+        if (q[-2] != 0x3C4) break;
+        if (n <= 2) break;
+        if (q[-3] != 0x3C3) break;
+        if (n <= 3) break;
+        if (q[-4] != 0x3B1) break;
+        if (n <= 4) break;
+        if (q[-5] != 0x3BC) break;
+        if (n <= 5) break;
+        if (q[-6] != 0x3BF) break;
+        i = 0;
+        if (n <= 6) break;
+        if (q[-7] != 0x3B9) break;
+        i = 1;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_44[i].s_size;
+    return a_44[i].result;
+}
+static const symbol s_64[] = { 0x3BF, 0x3BD };
+static const symbol s_65[] = { 0x3BF, 0x3BC, 0x3B1, 0x3C3, 0x3C4 };
+static const symbol s_66[] = { 0x3B9, 0x3B5, 0x3C3, 0x3C4, 0x3B5 };
+static const symbol s_67[] = { 0x3B9, 0x3B5, 0x3C3, 0x3C4 };
+static const symbol s_68[] = { 0x3B5, 0x3C3, 0x3C4, 0x3B5 };
+static const symbol s_69[] = { 0x3B9, 0x3B5, 0x3C3, 0x3C4 };
+
+static int find_among_b_47(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B1:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BA) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B7) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B8) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B7) break;
+                i = 0;
+                break;
+            case 0x3B5:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BA) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B7) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B8) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B7) break;
+                i = 1;
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B7) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B8) break;
+                if (n <= 5) break;
+                if (q[-6] != 0x3B7) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_47[i].s_size;
+    return a_47[i].result;
+}
+
+static int find_among_b_50(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B1:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BA) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B7) break;
+                i = 0;
+                break;
+            case 0x3B5:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BA) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B7) break;
+                i = 1;
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BA) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B7) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_50[i].s_size;
+    return a_50[i].result;
+}
+
+static int find_among_b_48(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B8:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C0) break;
+                        i = 0;
+                        break;
+                    case 0x3BF:
+                        i = 1;
+                        break;
+                    case 0x3C1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B1) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BD) break;
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0x3BB:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3C5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3BF) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BA) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3C3) break;
+                        i = 3;
+                        break;
+                    case 0x3C9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3BA) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3C3) break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 0x3C6:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C3) break;
+                i = 5;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_48[i].s_size;
+    return a_48[i].result;
+}
+static const symbol s_70[] = { 0x3B7, 0x3BA };
+static const symbol s_71[] = { 0x3B7, 0x3BA };
+
+static int find_among_b_53(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B1:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C3) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3BF) break;
+                i = 0;
+                break;
+            case 0x3B5:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C3) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C5) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3BF) break;
+                i = 1;
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C3) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C5) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3BF) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_53[i].s_size;
+    return a_53[i].result;
+}
+
+static int find_among_b_51(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B3:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C6) break;
+                        i = 0;
+                        break;
+                    case 0x3B7:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3BB) break;
+                        i = 1;
+                        break;
+                }
+                break;
+            case 0x3B4:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C6) break;
+                i = 2;
+                break;
+            case 0x3BB:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C4) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BD) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3BC) break;
+                        i = 3;
+                        break;
+                    case 0x3BB:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B1) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BC) break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 0x3BC:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BF) break;
+                i = 5;
+                break;
+            case 0x3C0:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BB) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B2) break;
+                i = 6;
+                break;
+            case 0x3C1:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B4) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3BF) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3C0) break;
+                i = 7;
+                break;
+            case 0x3C4:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B1:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3BC) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3C5) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3BA) break;
+                        i = 8;
+                        break;
+                    case 0x3C9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C1) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3C0) break;
+                        i = 9;
+                        break;
+                }
+                break;
+            case 0x3C7:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B1) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x3BB:
+                        i = 10;
+                        break;
+                    case 0x3C4:
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BD) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B1) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3C0) break;
+                        i = 11;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_51[i].s_size;
+    return a_51[i].result;
+}
+static const symbol s_72[] = { 0x3BF, 0x3C5, 0x3C3 };
+static const symbol s_73[] = { 0x3BF, 0x3C5, 0x3C3 };
+
+static int find_among_b_57(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B1:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C3) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B7) break;
+                i = 0;
+                break;
+            case 0x3B5:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C3) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B7) break;
+                i = 1;
+                break;
+            case 0x3C5:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C3) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B7) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_57[i].s_size;
+    return a_57[i].result;
+}
+static const symbol s_74[] = { 0x3B7, 0x3C3 };
+
+static int find_among_b_56(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B1:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B3) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B1) break;
+                i = 0;
+                break;
+            case 0x3B5:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B3) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B1) break;
+                i = 1;
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B3) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B1) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_56[i].s_size;
+    return a_56[i].result;
+}
+static const symbol s_75[] = { 0x3BA, 0x3BF, 0x3BB, 0x3BB };
+static const symbol s_76[] = { 0x3B1, 0x3B3 };
+
+static int find_among_b_54(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3BB:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C0) break;
+                        i = 0;
+                        break;
+                    case 0x3BB:
+                        i = 1;
+                        break;
+                }
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B7) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BC) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C3) break;
+                i = 2;
+                break;
+            case 0x3C0:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C1) break;
+                i = 3;
+                break;
+            case 0x3C1:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3C0:
+                        i = 4;
+                        break;
+                    case 0x3C6:
+                        i = 5;
+                        break;
+                }
+                break;
+            case 0x3C4:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BF) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C7) break;
+                i = 6;
+                break;
+            case 0x3C6:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3BF:
+                        i = 7;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C8) break;
+                        i = 8;
+                        break;
+                    case 0x3C3:
+                        i = 9;
+                        break;
+                }
+                break;
+            case 0x3C7:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3BB) break;
+                i = 10;
+                if (n <= 3) break;
+                if (q[-4] != 0x3C5) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3B1) break;
+                if (n <= 5) break;
+                if (q[-6] != 0x3BD) break;
+                i = 11;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_54[i].s_size;
+    return a_54[i].result;
+}
+static const symbol s_77[] = { 0x3B1, 0x3B3 };
+static const symbol s_78[] = { 0x3B1, 0x3B3 };
+
+static int find_among_b_59(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x3B5) break;
+        if (n <= 1) break;
+        if (q[-2] != 0x3C4) break;
+        if (n <= 2) break;
+        if (q[-3] != 0x3C3) break;
+        if (n <= 3) break;
+        if (q[-4] != 0x3B7) break;
+        i = 0;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_59[i].s_size;
+    return a_59[i].result;
+}
+static const symbol s_79[] = { 0x3B7, 0x3C3, 0x3C4 };
+
+static int find_among_b_61(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x3B5) break;
+        if (n <= 1) break;
+        if (q[-2] != 0x3BD) break;
+        if (n <= 2) break;
+        if (q[-3] != 0x3C5) break;
+        if (n <= 3) break;
+        if (q[-4] != 0x3BF) break;
+        i = 0;
+        if (n <= 4) break;
+        switch (q[-5]) {
+            case 0x3B8:
+                if (n <= 5) break;
+                if (q[-6] != 0x3B7) break;
+                i = 1;
+                break;
+            case 0x3C3:
+                if (n <= 5) break;
+                if (q[-6] != 0x3B7) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_61[i].s_size;
+    return a_61[i].result;
+}
+static const symbol s_80[] = { 0x3BF, 0x3C5, 0x3BD };
+
+static int find_among_b_63(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 0x3B5) break;
+        if (n <= 1) break;
+        if (q[-2] != 0x3BC) break;
+        if (n <= 2) break;
+        if (q[-3] != 0x3C5) break;
+        if (n <= 3) break;
+        if (q[-4] != 0x3BF) break;
+        i = 0;
+        if (n <= 4) break;
+        switch (q[-5]) {
+            case 0x3B8:
+                if (n <= 5) break;
+                if (q[-6] != 0x3B7) break;
+                i = 1;
+                break;
+            case 0x3C3:
+                if (n <= 5) break;
+                if (q[-6] != 0x3B7) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_63[i].s_size;
+    return a_63[i].result;
+}
+static const symbol s_81[] = { 0x3BF, 0x3C5, 0x3BC };
+
+static int find_among_b_65(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B1:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C4) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3B1) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3BC) break;
+                i = 0;
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                if (q[-2] != 0x3C9) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C4) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B1) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3BC) break;
+                i = 1;
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                if (q[-2] != 0x3BF) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C4) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x3B1) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x3BC) break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_65[i].s_size;
+    return a_65[i].result;
+}
+static const symbol s_82[] = { 0x3BC, 0x3B1 };
+
+static int find_among_b_66(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3B1:
+                i = 0;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3BC:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C5) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BF) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B9) break;
+                        i = 1;
+                        break;
+                    case 0x3BD:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3C5) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3BF) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x3BC:
+                                if (n <= 5) break;
+                                if (q[-6] != 0x3BF) break;
+                                i = 2;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x3B9) break;
+                                i = 3;
+                                break;
+                            case 0x3C3:
+                                if (n <= 5) break;
+                                if (q[-6] != 0x3BF) break;
+                                i = 4;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x3B9) break;
+                                i = 5;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x3B5:
+                i = 6;
+                if (n <= 1) break;
+                if (q[-2] != 0x3C4) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x3B1:
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x3B3:
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3B1) break;
+                                i = 7;
+                                break;
+                            case 0x3BA:
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3B7) break;
+                                i = 8;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x3B8) break;
+                                if (n <= 6) break;
+                                if (q[-7] != 0x3B7) break;
+                                i = 9;
+                                break;
+                            case 0x3C3:
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 0x3B7:
+                                        i = 10;
+                                        break;
+                                    case 0x3C5:
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0x3BF) break;
+                                        i = 11;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x3B9:
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3B5) break;
+                        i = 12;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B8) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x3B7) break;
+                        i = 13;
+                        break;
+                    case 0x3C3:
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3B1) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 0x3BC:
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 0x3B5:
+                                        if (n <= 6) break;
+                                        if (q[-7] != 0x3B9) break;
+                                        i = 14;
+                                        break;
+                                    case 0x3C5:
+                                        if (n <= 6) break;
+                                        if (q[-7] != 0x3BF) break;
+                                        i = 15;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0x3B9) break;
+                                        i = 16;
+                                        break;
+                                }
+                                break;
+                            case 0x3C3:
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 0x3B5:
+                                        if (n <= 6) break;
+                                        if (q[-7] != 0x3B9) break;
+                                        i = 17;
+                                        break;
+                                    case 0x3BF:
+                                        i = 18;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 0x3B9) break;
+                                        i = 19;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x3B7:
+                i = 20;
+                break;
+            case 0x3B9:
+                i = 21;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B1:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x3BC:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x3B1:
+                                        i = 22;
+                                        break;
+                                    case 0x3B5:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x3B9) break;
+                                        i = 23;
+                                        break;
+                                    case 0x3BF:
+                                        i = 24;
+                                        break;
+                                    case 0x3C5:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x3BF) break;
+                                        i = 25;
+                                        break;
+                                }
+                                break;
+                            case 0x3C3:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x3B1:
+                                        i = 26;
+                                        break;
+                                    case 0x3B5:
+                                        i = 27;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x3B9) break;
+                                        i = 28;
+                                        break;
+                                }
+                                break;
+                            case 0x3C4:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x3B1:
+                                        i = 29;
+                                        break;
+                                    case 0x3B5:
+                                        i = 30;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x3B9) break;
+                                        i = 31;
+                                        break;
+                                    case 0x3BD:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 0x3BF:
+                                                i = 32;
+                                                break;
+                                            case 0x3C5:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0x3BF) break;
+                                                i = 33;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 0x3B9) break;
+                                                i = 34;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x3B5:
+                        i = 35;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x3B1:
+                                i = 36;
+                                break;
+                            case 0x3B8:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3B7) break;
+                                i = 37;
+                                break;
+                            case 0x3C3:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3B7) break;
+                                i = 38;
+                                break;
+                        }
+                        break;
+                    case 0x3BF:
+                        i = 39;
+                        break;
+                }
+                break;
+            case 0x3BD:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B1:
+                        i = 40;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x3B3:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3B1) break;
+                                i = 41;
+                                break;
+                            case 0x3BA:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3B7) break;
+                                i = 42;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3B8) break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x3B7) break;
+                                i = 43;
+                                break;
+                            case 0x3C3:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x3B7:
+                                        i = 44;
+                                        break;
+                                    case 0x3C5:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x3BF) break;
+                                        i = 45;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0x3C4) break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 0x3BD) break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 0x3BF) break;
+                                        i = 46;
+                                        if (n <= 8) break;
+                                        if (q[-9] != 0x3B9) break;
+                                        i = 47;
+                                        break;
+                                }
+                                break;
+                            case 0x3C4:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x3BD:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 0x3BF:
+                                                i = 48;
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0x3B9) break;
+                                                i = 49;
+                                                break;
+                                            case 0x3C5:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0x3BF) break;
+                                                i = 50;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 0x3B9) break;
+                                                i = 51;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x3BF:
+                                        i = 52;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x3B9) break;
+                                        i = 53;
+                                        break;
+                                    case 0x3C3:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x3B1) break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 0x3BC:
+                                                if (n <= 6) break;
+                                                if (q[-7] != 0x3BF) break;
+                                                i = 54;
+                                                if (n <= 7) break;
+                                                if (q[-8] != 0x3B9) break;
+                                                i = 55;
+                                                break;
+                                            case 0x3C3:
+                                                if (n <= 6) break;
+                                                if (q[-7] != 0x3BF) break;
+                                                i = 56;
+                                                if (n <= 7) break;
+                                                if (q[-8] != 0x3B9) break;
+                                                i = 57;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x3C5:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3BF) break;
+                        i = 58;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x3B8:
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3B7) break;
+                                i = 59;
+                                break;
+                            case 0x3BC:
+                                if (n <= 4) break;
+                                if (q[-5] != 0x3BF) break;
+                                i = 60;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x3B9) break;
+                                i = 61;
+                                break;
+                            case 0x3C3:
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 0x3B7:
+                                        i = 62;
+                                        break;
+                                    case 0x3BF:
+                                        i = 63;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0x3B9) break;
+                                        i = 64;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x3C9:
+                        i = 65;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B4) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3B7) break;
+                        i = 66;
+                        break;
+                }
+                break;
+            case 0x3BF:
+                i = 67;
+                break;
+            case 0x3C3:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B1:
+                        i = 68;
+                        break;
+                    case 0x3B5:
+                        i = 69;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x3B4:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3B7) break;
+                                i = 70;
+                                break;
+                            case 0x3C3:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x3B7) break;
+                                i = 71;
+                                break;
+                        }
+                        break;
+                    case 0x3B7:
+                        i = 72;
+                        break;
+                    case 0x3B9:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B5) break;
+                        i = 73;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x3B8) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B7) break;
+                        i = 74;
+                        break;
+                    case 0x3BF:
+                        i = 75;
+                        break;
+                    case 0x3C5:
+                        i = 76;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3BF) break;
+                        i = 77;
+                        break;
+                }
+                break;
+            case 0x3C5:
+                i = 78;
+                if (n <= 1) break;
+                if (q[-2] != 0x3BF) break;
+                i = 79;
+                break;
+            case 0x3C9:
+                i = 80;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x3B1:
+                        i = 81;
+                        break;
+                    case 0x3B8:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B7) break;
+                        i = 82;
+                        break;
+                    case 0x3C3:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x3B7) break;
+                        i = 83;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_66[i].s_size;
+    return a_66[i].result;
+}
+
+static int find_among_b_67(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x3C1:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B5) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C4) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x3BF:
+                        i = 0;
+                        break;
+                    case 0x3C3:
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B5) break;
+                        i = 1;
+                        break;
+                    case 0x3C5:
+                        i = 2;
+                        break;
+                    case 0x3C9:
+                        i = 3;
+                        break;
+                }
+                break;
+            case 0x3C4:
+                if (n <= 1) break;
+                if (q[-2] != 0x3B1) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x3C4) break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x3BF:
+                        i = 4;
+                        break;
+                    case 0x3C3:
+                        if (n <= 4) break;
+                        if (q[-5] != 0x3B5) break;
+                        i = 5;
+                        break;
+                    case 0x3C5:
+                        i = 6;
+                        break;
+                    case 0x3C9:
+                        i = 7;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_67[i].s_size;
+    return a_67[i].result;
+}
+
+extern int greek_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    z->lb = z->c; z->c = z->l;
+
+    {   int m1 = z->l - z->c; (void)m1;
+        {   int ret = translate_b(z, &a_0_translation);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - m1;
+    }
+    if (!(SIZE(z->p) >= 3)) return 0;
+    z->I[0] = 1;
+    {   int m2 = z->l - z->c; (void)m2;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb) goto lab1;
+        among_var = find_among_b_1(z);
+        if (!(among_var)) goto lab1;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 2, s_0);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 3, s_1);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 3, s_2);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                {   int ret = slice_from_s(z, 2, s_3);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                {   int ret = slice_from_s(z, 4, s_4);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {   int ret = slice_from_s(z, 3, s_5);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                {   int ret = slice_from_s(z, 3, s_6);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 8:
+                {   int ret = slice_from_s(z, 3, s_7);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 9:
+                {   int ret = slice_from_s(z, 2, s_8);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 10:
+                {   int ret = slice_from_s(z, 6, s_9);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 11:
+                {   int ret = slice_from_s(z, 5, s_10);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+        z->I[0] = 0;
+    lab1:
+        z->c = z->l - m2;
+    }
+    {   int m3 = z->l - z->c; (void)m3;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb) goto lab2;
+        if (!(find_among_b_3(z))) goto lab2;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c <= z->lb) goto lab2;
+        among_var = find_among_hash_b(z, &a_2_table, &a_2_hash);
+        if (!(among_var)) goto lab2;
+        if (z->c > z->lb) goto lab2;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 1, s_11);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 2, s_12);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab2:
+        z->c = z->l - m3;
+    }
+    {   int m4 = z->l - z->c; (void)m4;
+        z->ket = z->c;
+        if (z->c - 4 <= z->lb) goto lab3;
+        if (!(find_among_b_5(z))) goto lab3;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c <= z->lb) goto lab3;
+        if (!(find_among_hash_b(z, &a_4_table, &a_4_hash))) goto lab3;
+        if (z->c > z->lb) goto lab3;
+        {   int ret = slice_from_s(z, 2, s_13);
+            if (ret < 0) return ret;
+        }
+    lab3:
+        z->c = z->l - m4;
+    }
+    {   int m5 = z->l - z->c; (void)m5;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb) goto lab4;
+        if (!(find_among_b_7(z))) goto lab4;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m6 = z->l - z->c; (void)m6;
+            if (!(eq_s_b(z, 3, s_14))) goto lab6;
+            if (z->c > z->lb) goto lab6;
+            {   int ret = slice_from_s(z, 2, s_15);
+                if (ret < 0) return ret;
+            }
+            goto lab5;
+        lab6:
+            z->c = z->l - m6;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c <= z->lb) goto lab4;
+            among_var = find_among_hash_b(z, &a_6_table, &a_6_hash);
+            if (!(among_var)) goto lab4;
+            if (z->c > z->lb) goto lab4;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_from_s(z, 1, s_16);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    {   int ret = slice_from_s(z, 2, s_17);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+        }
+    lab5:
+    lab4:
+        z->c = z->l - m5;
+    }
+    {   int m7 = z->l - z->c; (void)m7;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb) goto lab7;
+        if (!(find_among_b_9(z))) goto lab7;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 29 || !((-2145255424 >> (z->p[z->c - 1] & 0x1f)) & 1)) goto lab7;
+        if (!(find_among_hash_b(z, &a_8_table, &a_8_hash))) goto lab7;
+        if (z->c > z->lb) goto lab7;
+        {   int ret = slice_from_s(z, 1, s_18);
+            if (ret < 0) return ret;
+        }
+    lab7:
+        z->c = z->l - m7;
+    }
+    {   int m8 = z->l - z->c; (void)m8;
+        z->ket = z->c;
+        if (z->c - 3 <= z->lb) goto lab8;
+        if (!(find_among_b_11(z))) goto lab8;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c <= z->lb) goto lab8;
+        among_var = find_among_hash_b(z, &a_10_table, &a_10_hash);
+        if (!(among_var)) goto lab8;
+        if (z->c > z->lb) goto lab8;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 1, s_19);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 3, s_20);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab8:
+        z->c = z->l - m8;
+    }
+    {   int m9 = z->l - z->c; (void)m9;
+        z->ket = z->c;
+        if (z->c - 3 <= z->lb) goto lab9;
+        if (!(find_among_b_14(z))) goto lab9;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m10 = z->l - z->c; (void)m10;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 1 <= z->lb || z->p[z->c - 1] != 949) goto lab11;
+            among_var = find_among_hash_b(z, &a_12_table, &a_12_hash);
+            if (!(among_var)) goto lab11;
+            if (z->c > z->lb) goto lab11;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_from_s(z, 3, s_21);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    {   int ret = slice_from_s(z, 1, s_22);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+            goto lab10;
+        lab11:
+            z->c = z->l - m10;
+            z->ket = z->c;
+            if (z->c - 4 <= z->lb || (z->p[z->c - 1] != 954 && z->p[z->c - 1] != 957) || z->p[z->c - 2] != 953) goto lab9;
+            among_var = find_among_b_13(z);
+            if (!(among_var)) goto lab9;
+            z->bra = z->c;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_from_s(z, 6, s_23);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    {   int ret = slice_from_s(z, 4, s_24);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 3:
+                    {   int ret = slice_from_s(z, 5, s_25);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 4:
+                    {   int ret = slice_from_s(z, 3, s_26);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 5:
+                    {   int ret = slice_from_s(z, 6, s_27);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 6:
+                    {   int ret = slice_from_s(z, 5, s_28);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 7:
+                    {   int ret = slice_from_s(z, 3, s_29);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 8:
+                    {   int ret = slice_from_s(z, 8, s_30);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 9:
+                    {   int ret = slice_from_s(z, 6, s_31);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 10:
+                    {   int ret = slice_from_s(z, 5, s_32);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+        }
+    lab10:
+    lab9:
+        z->c = z->l - m9;
+    }
+    {   int m11 = z->l - z->c; (void)m11;
+        z->ket = z->c;
+        if (z->c - 4 <= z->lb || (z->p[z->c - 1] != 945 && z->p[z->c - 1] != 953) || (z->p[z->c - 2] != 953 && z->p[z->c - 2] != 954)) goto lab12;
+        if (!(find_among_b_16(z))) goto lab12;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c <= z->lb || (z->p[z->c - 1] != 963 && z->p[z->c - 1] != 967)) goto lab12;
+        if (!(find_among_hash_b(z, &a_15_table, &a_15_hash))) goto lab12;
+        if (z->c > z->lb) goto lab12;
+        {   int ret = slice_from_s(z, 4, s_33);
+            if (ret < 0) return ret;
+        }
+    lab12:
+        z->c = z->l - m11;
+    }
+    {   int m12 = z->l - z->c; (void)m12;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb) goto lab13;
+        if (!(find_among_b_18(z))) goto lab13;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m13 = z->l - z->c; (void)m13;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c <= z->lb) goto lab15;
+            among_var = find_among_hash_b(z, &a_17_table, &a_17_hash);
+            if (!(among_var)) goto lab15;
+            if (z->c > z->lb) goto lab15;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_from_s(z, 2, s_34);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    {   int ret = slice_from_s(z, 3, s_35);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+            goto lab14;
+        lab15:
+            z->c = z->l - m13;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (!(eq_s_b(z, 3, s_36))) goto lab13;
+            {   int ret = slice_from_s(z, 3, s_37);
+                if (ret < 0) return ret;
+            }
+        }
+    lab14:
+    lab13:
+        z->c = z->l - m12;
+    }
+    {   int m14 = z->l - z->c; (void)m14;
+        z->ket = z->c;
+        if (z->c - 3 <= z->lb || z->p[z->c - 1] >> 5 != 29 || !((-1610481664 >> (z->p[z->c - 1] & 0x1f)) & 1) || (z->p[z->c - 2] != 953 && z->p[z->c - 2] != 969)) goto lab16;
+        if (!(find_among_b_21(z))) goto lab16;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m15 = z->l - z->c; (void)m15;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 1 <= z->lb) goto lab18;
+            if (!(find_among_hash_b(z, &a_19_table, &a_19_hash))) goto lab18;
+            if (z->c > z->lb) goto lab18;
+            {   int ret = slice_from_s(z, 2, s_38);
+                if (ret < 0) return ret;
+            }
+            goto lab17;
+        lab18:
+            z->c = z->l - m15;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c <= z->lb || (z->p[z->c - 1] != 949 && z->p[z->c - 1] != 957)) goto lab16;
+            if (!(find_among_b_20(z))) goto lab16;
+            {   int ret = slice_from_s(z, 2, s_39);
+                if (ret < 0) return ret;
+            }
+        }
+    lab17:
+    lab16:
+        z->c = z->l - m14;
+    }
+    {   int m16 = z->l - z->c; (void)m16;
+        z->ket = z->c;
+        if (z->c - 3 <= z->lb || (z->p[z->c - 2] != 954 && z->p[z->c - 2] != 959)) goto lab19;
+        if (!(find_among_b_23(z))) goto lab19;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c <= z->lb) goto lab19;
+        if (!(find_among_hash_b(z, &a_22_table, &a_22_hash))) goto lab19;
+        if (z->c > z->lb) goto lab19;
+        {   int ret = slice_from_s(z, 3, s_40);
+            if (ret < 0) return ret;
+        }
+    lab19:
+        z->c = z->l - m16;
+    }
+    {   int m17 = z->l - z->c; (void)m17;
+        z->ket = z->c;
+        if (z->c - 3 <= z->lb || (z->p[z->c - 1] != 957 && z->p[z->c - 1] != 963) || (z->p[z->c - 2] != 949 && z->p[z->c - 2] != 969)) goto lab20;
+        if (!(find_among_b_24(z))) goto lab20;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        {   int m18 = z->l - z->c; (void)m18;
+            if (z->c - 1 <= z->lb) goto lab21;
+            if (!(find_among_b_25(z))) goto lab21;
+            goto lab20;
+        lab21:
+            z->c = z->l - m18;
+        }
+        {   int ret;
+            {   int saved_c = z->c;
+                ret = insert_s(z, z->c, z->c, 2, s_41);
+                z->c = saved_c;
+            }
+            if (ret < 0) return ret;
+        }
+    lab20:
+        z->c = z->l - m17;
+    }
+    {   int m19 = z->l - z->c; (void)m19;
+        z->ket = z->c;
+        if (z->c - 3 <= z->lb || (z->p[z->c - 1] != 957 && z->p[z->c - 1] != 963) || (z->p[z->c - 2] != 949 && z->p[z->c - 2] != 969)) goto lab22;
+        if (!(find_among_b_26(z))) goto lab22;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 955 && z->p[z->c - 1] != 960)) goto lab22;
+        if (!(find_among_b_27(z))) goto lab22;
+        {   int ret = slice_from_s(z, 2, s_42);
+            if (ret < 0) return ret;
+        }
+    lab22:
+        z->c = z->l - m19;
+    }
+    {   int m20 = z->l - z->c; (void)m20;
+        z->ket = z->c;
+        if (z->c - 4 <= z->lb || (z->p[z->c - 1] != 957 && z->p[z->c - 1] != 963) || (z->p[z->c - 2] != 949 && z->p[z->c - 2] != 969)) goto lab23;
+        if (!(find_among_b_28(z))) goto lab23;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c <= z->lb) goto lab23;
+        if (!(find_among_b_29(z))) goto lab23;
+        {   int ret = slice_from_s(z, 3, s_43);
+            if (ret < 0) return ret;
+        }
+    lab23:
+        z->c = z->l - m20;
+    }
+    {   int m21 = z->l - z->c; (void)m21;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb || (z->p[z->c - 1] != 957 && z->p[z->c - 1] != 963) || z->p[z->c - 2] != 969) goto lab24;
+        if (!(find_among_b_30(z))) goto lab24;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c <= z->lb) goto lab24;
+        if (!(find_among_hash_b(z, &a_31_table, &a_31_hash))) goto lab24;
+        if (z->c > z->lb) goto lab24;
+        {   int ret = slice_from_s(z, 1, s_44);
+            if (ret < 0) return ret;
+        }
+    lab24:
+        z->c = z->l - m21;
+    }
+    {   int m22 = z->l - z->c; (void)m22;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb) goto lab25;
+        if (!(find_among_b_32(z))) goto lab25;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (in_grouping_b(z, g_v, 945, 969, 0)) goto lab25;
+        {   int ret = slice_from_s(z, 1, s_45);
+            if (ret < 0) return ret;
+        }
+    lab25:
+        z->c = z->l - m22;
+    }
+    {   int m23 = z->l - z->c; (void)m23;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb) goto lab26;
+        if (!(find_among_b_33(z))) goto lab26;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m24 = z->l - z->c; (void)m24;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (in_grouping_b(z, g_v, 945, 969, 0)) goto lab28;
+            {   int ret = slice_from_s(z, 2, s_46);
+                if (ret < 0) return ret;
+            }
+            goto lab27;
+        lab28:
+            z->c = z->l - m24;
+            z->ket = z->c;
+        }
+    lab27:
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb) goto lab26;
+        if (!(find_among_hash_b(z, &a_34_table, &a_34_hash))) goto lab26;
+        if (z->c > z->lb) goto lab26;
+        {   int ret = slice_from_s(z, 2, s_47);
+            if (ret < 0) return ret;
+        }
+    lab26:
+        z->c = z->l - m23;
+    }
+    {   int m25 = z->l - z->c; (void)m25;
+        {   int m26 = z->l - z->c; (void)m26;
+            if (!(eq_s_b(z, 5, s_48))) goto lab30;
+            if (z->c > z->lb) goto lab30;
+            {   int ret = slice_from_s(z, 4, s_49);
+                if (ret < 0) return ret;
+            }
+        lab30:
+            z->c = z->l - m26;
+        }
+        {   int m27 = z->l - z->c; (void)m27;
+            z->ket = z->c;
+            if (z->c - 4 <= z->lb || z->p[z->c - 1] != 949 || z->p[z->c - 2] != 956) goto lab31;
+            if (!(find_among_b_35(z))) goto lab31;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            z->I[0] = 0;
+        lab31:
+            z->c = z->l - m27;
+        }
+        z->ket = z->c;
+        if (!(eq_s_b(z, 3, s_50))) goto lab29;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c <= z->lb) goto lab29;
+        if (!(find_among_hash_b(z, &a_36_table, &a_36_hash))) goto lab29;
+        if (z->c > z->lb) goto lab29;
+        {   int ret = slice_from_s(z, 2, s_51);
+            if (ret < 0) return ret;
+        }
+    lab29:
+        z->c = z->l - m25;
+    }
+    {   int m28 = z->l - z->c; (void)m28;
+        {   int m29 = z->l - z->c; (void)m29;
+            z->ket = z->c;
+            if (z->c - 4 <= z->lb || z->p[z->c - 1] != 949 || z->p[z->c - 2] != 957) goto lab33;
+            if (!(find_among_b_38(z))) goto lab33;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            z->I[0] = 0;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 961 && z->p[z->c - 1] != 963) || z->p[z->c - 2] != 964) goto lab33;
+            if (!(find_among_hash_b(z, &a_37_table, &a_37_hash))) goto lab33;
+            if (z->c > z->lb) goto lab33;
+            {   int ret = slice_from_s(z, 4, s_52);
+                if (ret < 0) return ret;
+            }
+        lab33:
+            z->c = z->l - m29;
+        }
+        z->ket = z->c;
+        if (!(eq_s_b(z, 3, s_53))) goto lab32;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m30 = z->l - z->c; (void)m30;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (in_grouping_b(z, g_v2, 945, 969, 0)) goto lab35;
+            {   int ret = slice_from_s(z, 2, s_54);
+                if (ret < 0) return ret;
+            }
+            goto lab34;
+        lab35:
+            z->c = z->l - m30;
+            z->ket = z->c;
+        }
+    lab34:
+        z->bra = z->c;
+        if (z->c <= z->lb) goto lab32;
+        if (!(find_among_hash_b(z, &a_39_table, &a_39_hash))) goto lab32;
+        if (z->c > z->lb) goto lab32;
+        {   int ret = slice_from_s(z, 2, s_55);
+            if (ret < 0) return ret;
+        }
+    lab32:
+        z->c = z->l - m28;
+    }
+    {   int m31 = z->l - z->c; (void)m31;
+        {   int m32 = z->l - z->c; (void)m32;
+            z->ket = z->c;
+            if (z->c - 4 <= z->lb || z->p[z->c - 1] != 949 || z->p[z->c - 2] != 964) goto lab37;
+            if (!(find_among_b_40(z))) goto lab37;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            z->I[0] = 0;
+        lab37:
+            z->c = z->l - m32;
+        }
+        z->ket = z->c;
+        if (!(eq_s_b(z, 3, s_56))) goto lab36;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m33 = z->l - z->c; (void)m33;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (in_grouping_b(z, g_v2, 945, 969, 0)) goto lab39;
+            {   int ret = slice_from_s(z, 2, s_57);
+                if (ret < 0) return ret;
+            }
+            goto lab38;
+        lab39:
+            z->c = z->l - m33;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 1 <= z->lb) goto lab40;
+            if (!(find_among_b_41(z))) goto lab40;
+            {   int ret = slice_from_s(z, 2, s_58);
+                if (ret < 0) return ret;
+            }
+            goto lab38;
+        lab40:
+            z->c = z->l - m33;
+            z->ket = z->c;
+        }
+    lab38:
+        z->bra = z->c;
+        if (z->c <= z->lb) goto lab36;
+        if (!(find_among_hash_b(z, &a_42_table, &a_42_hash))) goto lab36;
+        if (z->c > z->lb) goto lab36;
+        {   int ret = slice_from_s(z, 2, s_59);
+            if (ret < 0) return ret;
+        }
+    lab36:
+        z->c = z->l - m31;
+    }
+    {   int m34 = z->l - z->c; (void)m34;
+        z->ket = z->c;
+        if (z->c - 4 <= z->lb || z->p[z->c - 1] != 963 || z->p[z->c - 2] != 945) goto lab41;
+        if (!(find_among_b_43(z))) goto lab41;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m35 = z->l - z->c; (void)m35;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (!(eq_s_b(z, 3, s_60))) goto lab43;
+            if (z->c > z->lb) goto lab43;
+            {   int ret = slice_from_s(z, 3, s_61);
+                if (ret < 0) return ret;
+            }
+            goto lab42;
+        lab43:
+            z->c = z->l - m35;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (!(eq_s_b(z, 3, s_62))) goto lab41;
+            {   int ret = slice_from_s(z, 3, s_63);
+                if (ret < 0) return ret;
+            }
+        }
+    lab42:
+    lab41:
+        z->c = z->l - m34;
+    }
+    {   int m36 = z->l - z->c; (void)m36;
+        z->ket = z->c;
+        if (z->c - 5 <= z->lb || z->p[z->c - 1] != 949 || z->p[z->c - 2] != 964) goto lab44;
+        if (!(find_among_b_44(z))) goto lab44;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (!(eq_s_b(z, 2, s_64))) goto lab44;
+        if (z->c > z->lb) goto lab44;
+        {   int ret = slice_from_s(z, 5, s_65);
+            if (ret < 0) return ret;
+        }
+    lab44:
+        z->c = z->l - m36;
+    }
+    {   int m37 = z->l - z->c; (void)m37;
+        {   int m38 = z->l - z->c; (void)m38;
+            z->ket = z->c;
+            if (!(eq_s_b(z, 5, s_66))) goto lab46;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            z->I[0] = 0;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c <= z->lb || (z->p[z->c - 1] != 960 && z->p[z->c - 1] != 966)) goto lab46;
+            if (!(find_among_hash_b(z, &a_45_table, &a_45_hash))) goto lab46;
+            if (z->c > z->lb) goto lab46;
+            {   int ret = slice_from_s(z, 4, s_67);
+                if (ret < 0) return ret;
+            }
+        lab46:
+            z->c = z->l - m38;
+        }
+        z->ket = z->c;
+        if (!(eq_s_b(z, 4, s_68))) goto lab45;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c <= z->lb) goto lab45;
+        if (!(find_among_hash_b(z, &a_46_table, &a_46_hash))) goto lab45;
+        if (z->c > z->lb) goto lab45;
+        {   int ret = slice_from_s(z, 4, s_69);
+            if (ret < 0) return ret;
+        }
+    lab45:
+        z->c = z->l - m37;
+    }
+    {   int m39 = z->l - z->c; (void)m39;
+        {   int m40 = z->l - z->c; (void)m40;
+            z->ket = z->c;
+            if (z->c - 4 <= z->lb || (z->p[z->c - 2] != 949 && z->p[z->c - 2] != 954)) goto lab48;
+            if (!(find_among_b_47(z))) goto lab48;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            z->I[0] = 0;
+        lab48:
+            z->c = z->l - m40;
+        }
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb || (z->p[z->c - 2] != 949 && z->p[z->c - 2] != 954)) goto lab47;
+        if (!(find_among_b_50(z))) goto lab47;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m41 = z->l - z->c; (void)m41;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 1 <= z->lb) goto lab50;
+            if (!(find_among_b_48(z))) goto lab50;
+            {   int ret = slice_from_s(z, 2, s_70);
+                if (ret < 0) return ret;
+            }
+            goto lab49;
+        lab50:
+            z->c = z->l - m41;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c <= z->lb || z->p[z->c - 1] != 952) goto lab47;
+            if (!(find_among_hash_b(z, &a_49_table, &a_49_hash))) goto lab47;
+            if (z->c > z->lb) goto lab47;
+            {   int ret = slice_from_s(z, 2, s_71);
+                if (ret < 0) return ret;
+            }
+        }
+    lab49:
+    lab47:
+        z->c = z->l - m39;
+    }
+    {   int m42 = z->l - z->c; (void)m42;
+        z->ket = z->c;
+        if (z->c - 3 <= z->lb || (z->p[z->c - 2] != 949 && z->p[z->c - 2] != 963)) goto lab51;
+        if (!(find_among_b_53(z))) goto lab51;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m43 = z->l - z->c; (void)m43;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c - 1 <= z->lb) goto lab53;
+            if (!(find_among_b_51(z))) goto lab53;
+            {   int ret = slice_from_s(z, 3, s_72);
+                if (ret < 0) return ret;
+            }
+            goto lab52;
+        lab53:
+            z->c = z->l - m43;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (z->c <= z->lb) goto lab51;
+            if (!(find_among_hash_b(z, &a_52_table, &a_52_hash))) goto lab51;
+            if (z->c > z->lb) goto lab51;
+            {   int ret = slice_from_s(z, 3, s_73);
+                if (ret < 0) return ret;
+            }
+        }
+    lab52:
+    lab51:
+        z->c = z->l - m42;
+    }
+    {   int m44 = z->l - z->c; (void)m44;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb || (z->p[z->c - 2] != 959 && z->p[z->c - 2] != 963)) goto lab54;
+        if (!(find_among_b_57(z))) goto lab54;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c <= z->lb || z->p[z->c - 1] != 957) goto lab54;
+        if (!(find_among_hash_b(z, &a_58_table, &a_58_hash))) goto lab54;
+        if (z->c > z->lb) goto lab54;
+        {   int ret = slice_from_s(z, 2, s_74);
+            if (ret < 0) return ret;
+        }
+    lab54:
+        z->c = z->l - m44;
+    }
+    {   int m45 = z->l - z->c; (void)m45;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb || (z->p[z->c - 2] != 947 && z->p[z->c - 2] != 949)) goto lab55;
+        if (!(find_among_b_56(z))) goto lab55;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        {   int m46 = z->l - z->c; (void)m46;
+            z->ket = z->c;
+            z->bra = z->c;
+            if (!(eq_s_b(z, 4, s_75))) goto lab57;
+            {   int ret = slice_from_s(z, 2, s_76);
+                if (ret < 0) return ret;
+            }
+            goto lab56;
+        lab57:
+            z->c = z->l - m46;
+            {   int m47 = z->l - z->c; (void)m47;
+                z->ket = z->c;
+                z->bra = z->c;
+                if (z->c - 1 <= z->lb) goto lab59;
+                among_var = find_among_b_54(z);
+                if (!(among_var)) goto lab59;
+                switch (among_var) {
+                    case 1:
+                        {   int ret = slice_from_s(z, 2, s_77);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+                goto lab58;
+            lab59:
+                z->c = z->l - m47;
+                z->ket = z->c;
+                z->bra = z->c;
+                if (z->c <= z->lb) goto lab55;
+                if (!(find_among_hash_b(z, &a_55_table, &a_55_hash))) goto lab55;
+                if (z->c > z->lb) goto lab55;
+                {   int ret = slice_from_s(z, 2, s_78);
+                    if (ret < 0) return ret;
+                }
+            }
+        lab58:
+            ;
+        }
+    lab56:
+    lab55:
+        z->c = z->l - m45;
+    }
+    {   int m48 = z->l - z->c; (void)m48;
+        z->ket = z->c;
+        if (z->c - 3 <= z->lb || z->p[z->c - 1] != 949 || z->p[z->c - 2] != 964) goto lab60;
+        if (!(find_among_b_59(z))) goto lab60;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c - 1 <= z->lb) goto lab60;
+        if (!(find_among_hash_b(z, &a_60_table, &a_60_hash))) goto lab60;
+        if (z->c > z->lb) goto lab60;
+        {   int ret = slice_from_s(z, 3, s_79);
+            if (ret < 0) return ret;
+        }
+    lab60:
+        z->c = z->l - m48;
+    }
+    {   int m49 = z->l - z->c; (void)m49;
+        z->ket = z->c;
+        if (z->c - 3 <= z->lb || z->p[z->c - 1] != 949 || z->p[z->c - 2] != 957) goto lab61;
+        if (!(find_among_b_61(z))) goto lab61;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c <= z->lb) goto lab61;
+        if (!(find_among_hash_b(z, &a_62_table, &a_62_hash))) goto lab61;
+        if (z->c > z->lb) goto lab61;
+        {   int ret = slice_from_s(z, 3, s_80);
+            if (ret < 0) return ret;
+        }
+    lab61:
+        z->c = z->l - m49;
+    }
+    {   int m50 = z->l - z->c; (void)m50;
+        z->ket = z->c;
+        if (z->c - 3 <= z->lb || z->p[z->c - 1] != 949 || z->p[z->c - 2] != 956) goto lab62;
+        if (!(find_among_b_63(z))) goto lab62;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+        z->I[0] = 0;
+        z->ket = z->c;
+        z->bra = z->c;
+        if (z->c <= z->lb) goto lab62;
+        if (!(find_among_hash_b(z, &a_64_table, &a_64_hash))) goto lab62;
+        if (z->c > z->lb) goto lab62;
+        {   int ret = slice_from_s(z, 3, s_81);
+            if (ret < 0) return ret;
+        }
+    lab62:
+        z->c = z->l - m50;
+    }
+    {   int m51 = z->l - z->c; (void)m51;
+        {   int m52 = z->l - z->c; (void)m52;
+            z->ket = z->c;
+            if (z->c - 3 <= z->lb) goto lab64;
+            if (!(find_among_b_65(z))) goto lab64;
+            z->bra = z->c;
+            {   int ret = slice_from_s(z, 2, s_82);
+                if (ret < 0) return ret;
+            }
+        lab64:
+            z->c = z->l - m52;
+        }
+        if (!(z->I[0])) goto lab63;
+        z->ket = z->c;
+        if (z->c <= z->lb) goto lab63;
+        if (!(find_among_b_66(z))) goto lab63;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab63:
+        z->c = z->l - m51;
+    }
+    {   int m53 = z->l - z->c; (void)m53;
+        z->ket = z->c;
+        if (z->c - 3 <= z->lb || (z->p[z->c - 1] != 961 && z->p[z->c - 1] != 964) || (z->p[z->c - 2] != 945 && z->p[z->c - 2] != 949)) goto lab65;
+        if (!(find_among_b_67(z))) goto lab65;
+        z->bra = z->c;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab65:
+        z->c = z->l - m53;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * greek_UTF_8_create_env(void) { return SN_create_env(0, 1); }
+
+extern void greek_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
@@ -0,0 +1,898 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+static int r_CONSONANT(struct SN_env * z);
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int hindi_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * hindi_UTF_8_create_env(void);
+extern void hindi_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[132] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 4, 1, -1 },
+{ 0, 5, 2, -1 },
+{ 0, 5, 2, -1 },
+{ 0, 4, 1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 6, -1 },
+{ 0, 3, 6, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 9, -1 },
+{ 0, 3, 9, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 12, -1 },
+{ 0, 3, 12, -1 },
+{ 0, 3, 12, -1 },
+{ 0, 4, 15, -1 },
+{ 0, 5, 16, -1 },
+{ 0, 4, 15, -1 },
+{ 0, 5, 18, -1 },
+{ 0, 3, 12, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 21, -1 },
+{ 0, 3, 21, -1 },
+{ 0, 3, 21, -1 },
+{ 0, 4, 24, -1 },
+{ 0, 5, 25, -1 },
+{ 0, 4, 24, -1 },
+{ 0, 5, 27, -1 },
+{ 0, 3, 21, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 4, 30, -1 },
+{ 0, 5, 31, -1 },
+{ 0, 5, 31, -1 },
+{ 0, 4, 30, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 35, -1 },
+{ 0, 4, 36, -1 },
+{ 0, 4, 36, -1 },
+{ 0, 4, 36, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 4, 41, -1 },
+{ 0, 5, 42, -1 },
+{ 0, 5, 42, -1 },
+{ 0, 4, 41, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 2, 49, -1 },
+{ 0, 2, 49, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 2, 54, -1 },
+{ 0, 2, 54, -1 },
+{ 0, 3, 56, -1 },
+{ 0, 3, 56, -1 },
+{ 0, 2, 54, -1 },
+{ 0, 2, 54, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 2, 61, -1 },
+{ 0, 2, 61, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 64, -1 },
+{ 0, 3, 64, -1 },
+{ 0, 3, 64, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 4, 68, -1 },
+{ 0, 5, 69, -1 },
+{ 0, 5, 69, -1 },
+{ 0, 4, 68, -1 },
+{ 0, 3, 68, -1 },
+{ 0, 4, 73, -1 },
+{ 0, 4, 73, -1 },
+{ 0, 3, 68, -1 },
+{ 0, 2, 68, -1 },
+{ 0, 3, 77, -1 },
+{ 0, 3, 77, -1 },
+{ 0, 3, 77, -1 },
+{ 0, 2, 68, -1 },
+{ 0, 3, 81, -1 },
+{ 0, 3, 81, -1 },
+{ 0, 3, 81, -1 },
+{ 0, 3, 68, -1 },
+{ 0, 3, 68, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 4, 88, -1 },
+{ 0, 5, 89, -1 },
+{ 0, 5, 89, -1 },
+{ 0, 4, 88, -1 },
+{ 0, 5, 92, -1 },
+{ 0, 5, 92, -1 },
+{ 0, 4, 88, -1 },
+{ 0, 4, 88, -1 },
+{ 0, 3, 88, -1 },
+{ 0, 4, 97, -1 },
+{ 0, 4, 97, -1 },
+{ 0, 3, 88, -1 },
+{ 0, 4, 100, -1 },
+{ 0, 4, 100, -1 },
+{ 0, 3, 88, -1 },
+{ 0, 3, 88, -1 },
+{ 0, 2, 88, -1 },
+{ 0, 3, 105, -1 },
+{ 0, 3, 105, -1 },
+{ 0, 3, 105, -1 },
+{ 0, 2, 88, -1 },
+{ 0, 3, 109, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 4, 113, -1 },
+{ 0, 5, 114, -1 },
+{ 0, 5, 114, -1 },
+{ 0, 4, 113, -1 },
+{ 0, 3, 113, -1 },
+{ 0, 4, 118, -1 },
+{ 0, 4, 118, -1 },
+{ 0, 3, 113, -1 },
+{ 0, 2, 113, -1 },
+{ 0, 3, 122, -1 },
+{ 0, 3, 122, -1 },
+{ 0, 3, 122, -1 },
+{ 0, 2, 113, -1 },
+{ 0, 3, 126, -1 },
+{ 0, 3, 126, -1 },
+{ 0, 3, 126, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 }
+};
+
+static int (* const a_0_functions[132])(struct SN_env *) = {
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    r_CONSONANT,
+    0,
+    0,
+    0,
+    0,
+    0
+};
+
+static const unsigned char g_consonant[] = { 255, 255, 255, 255, 159, 0, 0, 0, 248, 7 };
+
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x901:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x906:
+                        i = 0;
+                        break;
+                    case 0x93E:
+                        i = 1;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x92F) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x907:
+                                i = 2;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 0x906:
+                                        i = 3;
+                                        break;
+                                    case 0x93E:
+                                        i = 4;
+                                        break;
+                                }
+                                break;
+                            case 0x93F:
+                                i = 5;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x902:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x906:
+                        i = 6;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x909:
+                                i = 7;
+                                break;
+                            case 0x941:
+                                i = 8;
+                                break;
+                        }
+                        break;
+                    case 0x908:
+                        i = 9;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x906:
+                                i = 10;
+                                break;
+                            case 0x93E:
+                                i = 11;
+                                break;
+                        }
+                        break;
+                    case 0x90F:
+                        i = 12;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x906:
+                                i = 13;
+                                break;
+                            case 0x909:
+                                i = 14;
+                                break;
+                            case 0x93E:
+                                i = 15;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x924:
+                                        i = 16;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x905) break;
+                                        i = 17;
+                                        break;
+                                    case 0x928:
+                                        i = 18;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x905) break;
+                                        i = 19;
+                                        break;
+                                }
+                                break;
+                            case 0x941:
+                                i = 20;
+                                break;
+                        }
+                        break;
+                    case 0x913:
+                        i = 21;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x906:
+                                i = 22;
+                                break;
+                            case 0x909:
+                                i = 23;
+                                break;
+                            case 0x93E:
+                                i = 24;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x924:
+                                        i = 25;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x905) break;
+                                        i = 26;
+                                        break;
+                                    case 0x928:
+                                        i = 27;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x905) break;
+                                        i = 28;
+                                        break;
+                                }
+                                break;
+                            case 0x941:
+                                i = 29;
+                                break;
+                        }
+                        break;
+                    case 0x93E:
+                        i = 30;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x92F) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x907:
+                                i = 31;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 0x906:
+                                        i = 32;
+                                        break;
+                                    case 0x93E:
+                                        i = 33;
+                                        break;
+                                }
+                                break;
+                            case 0x93F:
+                                i = 34;
+                                break;
+                        }
+                        break;
+                    case 0x940:
+                        i = 35;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x924) break;
+                        i = 36;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x905:
+                                i = 37;
+                                break;
+                            case 0x906:
+                                i = 38;
+                                break;
+                            case 0x93E:
+                                i = 39;
+                                break;
+                        }
+                        break;
+                    case 0x947:
+                        i = 40;
+                        break;
+                    case 0x94B:
+                        i = 41;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x92F) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x907:
+                                i = 42;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 0x906:
+                                        i = 43;
+                                        break;
+                                    case 0x93E:
+                                        i = 44;
+                                        break;
+                                }
+                                break;
+                            case 0x93F:
+                                i = 45;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x905:
+                i = 46;
+                break;
+            case 0x906:
+                i = 47;
+                break;
+            case 0x907:
+                i = 48;
+                break;
+            case 0x908:
+                i = 49;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x906:
+                        i = 50;
+                        break;
+                    case 0x93E:
+                        i = 51;
+                        break;
+                }
+                break;
+            case 0x909:
+                i = 52;
+                break;
+            case 0x90A:
+                i = 53;
+                break;
+            case 0x90F:
+                i = 54;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x906:
+                        i = 55;
+                        break;
+                    case 0x907:
+                        i = 56;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x906:
+                                i = 57;
+                                break;
+                            case 0x93E:
+                                i = 58;
+                                break;
+                        }
+                        break;
+                    case 0x93E:
+                        i = 59;
+                        break;
+                    case 0x93F:
+                        i = 60;
+                        break;
+                }
+                break;
+            case 0x913:
+                i = 61;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x906:
+                        i = 62;
+                        break;
+                    case 0x93E:
+                        i = 63;
+                        break;
+                }
+                break;
+            case 0x930:
+                if (n <= 1) break;
+                if (q[-2] != 0x915) break;
+                i = 64;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x905:
+                        i = 65;
+                        break;
+                    case 0x906:
+                        i = 66;
+                        break;
+                    case 0x93E:
+                        i = 67;
+                        break;
+                }
+                break;
+            case 0x93E:
+                i = 68;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x917:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x902:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x90A:
+                                        i = 69;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 0x906:
+                                                i = 70;
+                                                break;
+                                            case 0x93E:
+                                                i = 71;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x942:
+                                        i = 72;
+                                        break;
+                                }
+                                break;
+                            case 0x90F:
+                                i = 73;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x906:
+                                        i = 74;
+                                        break;
+                                    case 0x93E:
+                                        i = 75;
+                                        break;
+                                }
+                                break;
+                            case 0x947:
+                                i = 76;
+                                break;
+                        }
+                        break;
+                    case 0x924:
+                        i = 77;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x905:
+                                i = 78;
+                                break;
+                            case 0x906:
+                                i = 79;
+                                break;
+                            case 0x93E:
+                                i = 80;
+                                break;
+                        }
+                        break;
+                    case 0x928:
+                        i = 81;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x905:
+                                i = 82;
+                                break;
+                            case 0x906:
+                                i = 83;
+                                break;
+                            case 0x93E:
+                                i = 84;
+                                break;
+                        }
+                        break;
+                    case 0x92F:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x906:
+                                i = 85;
+                                break;
+                            case 0x93E:
+                                i = 86;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x93F:
+                i = 87;
+                break;
+            case 0x940:
+                i = 88;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x917:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x902:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x90A:
+                                        i = 89;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 0x906:
+                                                i = 90;
+                                                break;
+                                            case 0x93E:
+                                                i = 91;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x90F:
+                                        i = 92;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 0x906:
+                                                i = 93;
+                                                break;
+                                            case 0x93E:
+                                                i = 94;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x942:
+                                        i = 95;
+                                        break;
+                                    case 0x947:
+                                        i = 96;
+                                        break;
+                                }
+                                break;
+                            case 0x90F:
+                                i = 97;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x906:
+                                        i = 98;
+                                        break;
+                                    case 0x93E:
+                                        i = 99;
+                                        break;
+                                }
+                                break;
+                            case 0x913:
+                                i = 100;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x906:
+                                        i = 101;
+                                        break;
+                                    case 0x93E:
+                                        i = 102;
+                                        break;
+                                }
+                                break;
+                            case 0x947:
+                                i = 103;
+                                break;
+                            case 0x94B:
+                                i = 104;
+                                break;
+                        }
+                        break;
+                    case 0x924:
+                        i = 105;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x905:
+                                i = 106;
+                                break;
+                            case 0x906:
+                                i = 107;
+                                break;
+                            case 0x93E:
+                                i = 108;
+                                break;
+                        }
+                        break;
+                    case 0x928:
+                        i = 109;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x905) break;
+                        i = 110;
+                        break;
+                }
+                break;
+            case 0x941:
+                i = 111;
+                break;
+            case 0x942:
+                i = 112;
+                break;
+            case 0x947:
+                i = 113;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x917:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x902:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x90F:
+                                        i = 114;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 0x906:
+                                                i = 115;
+                                                break;
+                                            case 0x93E:
+                                                i = 116;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x947:
+                                        i = 117;
+                                        break;
+                                }
+                                break;
+                            case 0x913:
+                                i = 118;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x906:
+                                        i = 119;
+                                        break;
+                                    case 0x93E:
+                                        i = 120;
+                                        break;
+                                }
+                                break;
+                            case 0x94B:
+                                i = 121;
+                                break;
+                        }
+                        break;
+                    case 0x924:
+                        i = 122;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x905:
+                                i = 123;
+                                break;
+                            case 0x906:
+                                i = 124;
+                                break;
+                            case 0x93E:
+                                i = 125;
+                                break;
+                        }
+                        break;
+                    case 0x928:
+                        i = 126;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x905:
+                                i = 127;
+                                break;
+                            case 0x906:
+                                i = 128;
+                                break;
+                            case 0x93E:
+                                i = 129;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x94B:
+                i = 130;
+                break;
+            case 0x94D:
+                i = 131;
+                break;
+        }
+    } while (0);
+    while (i >= 0) {
+        const struct among * w = a_0 + i;
+        z->c = c - w->s_size;
+        if (a_0_functions[i] == 0) return w->result;
+        {   int res = a_0_functions[i](z);
+            z->c = c - w->s_size;
+            if (res) return w->result;
+        }
+        i = w->substring_i;
+    }
+    return 0;
+}
+
+static int r_CONSONANT(struct SN_env * z) {
+    if (in_grouping_b(z, g_consonant, 2325, 2399, 0)) return 0;
+    return 1;
+}
+
+extern int hindi_UTF_8_stem(struct SN_env * z) {
+    if (z->c >= z->l) return 0;
+    z->c++;
+    z->lb = z->c; z->c = z->l;
+
+    z->ket = z->c;
+    if (z->c <= z->lb) return 0;
+    if (!(find_among_b_0(z))) return 0;
+    z->bra = z->c;
+    {   int ret = slice_del(z);
+        if (ret < 0) return ret;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * hindi_UTF_8_create_env(void) { return SN_create_env(0, 0); }
+
+extern void hindi_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
@@ -0,0 +1,1898 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+static int r_fix_chdz(struct SN_env * z);
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int lithuanian_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * lithuanian_UTF_8_create_env(void);
+extern void lithuanian_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[204] =
+{
+{ 0, 1, -1, -1 },
+{ 0, 2, 0, -1 },
+{ 0, 4, 1, -1 },
+{ 0, 4, 0, -1 },
+{ 0, 5, 3, -1 },
+{ 0, 5, 3, -1 },
+{ 0, 6, 5, -1 },
+{ 0, 4, 0, -1 },
+{ 0, 4, 0, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 2, 9, -1 },
+{ 0, 4, 10, -1 },
+{ 0, 4, 10, -1 },
+{ 0, 3, 9, -1 },
+{ 0, 4, 13, -1 },
+{ 0, 3, 9, -1 },
+{ 0, 4, 15, -1 },
+{ 0, 3, 9, -1 },
+{ 0, 5, 17, -1 },
+{ 0, 5, 17, -1 },
+{ 0, 3, 9, -1 },
+{ 0, 3, 9, -1 },
+{ 0, 4, 21, -1 },
+{ 0, 4, 9, -1 },
+{ 0, 3, 9, -1 },
+{ 0, 3, 9, -1 },
+{ 0, 6, 25, -1 },
+{ 0, 3, 9, -1 },
+{ 0, 4, 27, -1 },
+{ 0, 4, 27, -1 },
+{ 0, 5, 29, -1 },
+{ 0, 3, 9, -1 },
+{ 0, 5, 31, -1 },
+{ 0, 5, 31, -1 },
+{ 0, 3, 9, -1 },
+{ 0, 3, 9, -1 },
+{ 0, 4, 35, -1 },
+{ 0, 3, 9, -1 },
+{ 0, 4, 37, -1 },
+{ 0, 4, 37, -1 },
+{ 0, 3, 9, -1 },
+{ 0, 4, 9, -1 },
+{ 0, 3, 9, -1 },
+{ 0, 6, 42, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 2, 44, -1 },
+{ 0, 3, 45, -1 },
+{ 0, 5, 46, -1 },
+{ 0, 2, 44, -1 },
+{ 0, 5, 48, -1 },
+{ 0, 2, 44, -1 },
+{ 0, 3, 44, -1 },
+{ 0, 5, 51, -1 },
+{ 0, 3, 44, -1 },
+{ 0, 4, 53, -1 },
+{ 0, 2, 44, -1 },
+{ 0, 3, 55, -1 },
+{ 0, 4, 56, -1 },
+{ 0, 3, 55, -1 },
+{ 0, 4, 58, -1 },
+{ 0, 5, 59, -1 },
+{ 0, 3, 55, -1 },
+{ 0, 4, 61, -1 },
+{ 0, 4, 61, -1 },
+{ 0, 7, 63, -1 },
+{ 0, 4, 61, -1 },
+{ 0, 3, 55, -1 },
+{ 0, 5, 66, -1 },
+{ 0, 4, 66, -1 },
+{ 0, 5, 68, -1 },
+{ 0, 6, 69, -1 },
+{ 0, 3, 55, -1 },
+{ 0, 4, 71, -1 },
+{ 0, 6, 72, -1 },
+{ 0, 3, 55, -1 },
+{ 0, 3, 55, -1 },
+{ 0, 3, 55, -1 },
+{ 0, 4, 76, -1 },
+{ 0, 2, 44, -1 },
+{ 0, 4, 78, -1 },
+{ 0, 4, 78, -1 },
+{ 0, 3, 78, -1 },
+{ 0, 4, 81, -1 },
+{ 0, 4, 81, -1 },
+{ 0, 5, 83, -1 },
+{ 0, 4, 78, -1 },
+{ 0, 5, 85, -1 },
+{ 0, 3, 78, -1 },
+{ 0, 3, 78, -1 },
+{ 0, 6, 88, -1 },
+{ 0, 5, 88, -1 },
+{ 0, 6, 88, -1 },
+{ 0, 2, 44, -1 },
+{ 0, 3, 92, -1 },
+{ 0, 5, 93, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 98, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 101, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 5, 105, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 108, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 110, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 2, 113, -1 },
+{ 0, 4, 114, -1 },
+{ 0, 3, 113, -1 },
+{ 0, 2, 113, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 2, 118, -1 },
+{ 0, 3, 119, -1 },
+{ 0, 2, 118, -1 },
+{ 0, 3, 121, -1 },
+{ 0, 2, 118, -1 },
+{ 0, 3, 123, -1 },
+{ 0, 4, 124, -1 },
+{ 0, 6, 123, -1 },
+{ 0, 4, 123, -1 },
+{ 0, 6, 127, -1 },
+{ 0, 4, 123, -1 },
+{ 0, 5, 129, -1 },
+{ 0, 4, 123, -1 },
+{ 0, 4, 123, -1 },
+{ 0, 4, 123, -1 },
+{ 0, 4, 123, -1 },
+{ 0, 4, 123, -1 },
+{ 0, 3, 118, -1 },
+{ 0, 4, 136, -1 },
+{ 0, 4, 118, -1 },
+{ 0, 3, 118, -1 },
+{ 0, 5, 139, -1 },
+{ 0, 5, 139, -1 },
+{ 0, 3, 118, -1 },
+{ 0, 4, 142, -1 },
+{ 0, 3, 118, -1 },
+{ 0, 3, 118, -1 },
+{ 0, 3, 118, -1 },
+{ 0, 2, 118, -1 },
+{ 0, 3, 147, -1 },
+{ 0, 3, 147, -1 },
+{ 0, 4, 149, -1 },
+{ 0, 3, 118, -1 },
+{ 0, 2, 118, -1 },
+{ 0, 3, 152, -1 },
+{ 0, 4, 153, -1 },
+{ 0, 3, 152, -1 },
+{ 0, 2, 118, -1 },
+{ 0, 4, 156, -1 },
+{ 0, 4, 156, -1 },
+{ 0, 2, 118, -1 },
+{ 0, 3, 159, -1 },
+{ 0, 2, 118, -1 },
+{ 0, 4, 161, -1 },
+{ 0, 5, 162, -1 },
+{ 0, 4, 161, -1 },
+{ 0, 5, 164, -1 },
+{ 0, 5, 164, -1 },
+{ 0, 4, 161, -1 },
+{ 0, 4, 161, -1 },
+{ 0, 7, 168, -1 },
+{ 0, 4, 161, -1 },
+{ 0, 5, 170, -1 },
+{ 0, 5, 161, -1 },
+{ 0, 4, 161, -1 },
+{ 0, 4, 161, -1 },
+{ 0, 7, 174, -1 },
+{ 0, 2, 118, -1 },
+{ 0, 2, 118, -1 },
+{ 0, 3, 118, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 179, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 181, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 5, 184, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 2, 186, -1 },
+{ 0, 3, 187, -1 },
+{ 0, 4, 188, -1 },
+{ 0, 2, 186, -1 },
+{ 0, 4, 190, -1 },
+{ 0, 3, 190, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 2, 194, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 3, 198, -1 },
+{ 0, 3, 198, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 2, 201, -1 },
+{ 0, 3, 201, -1 }
+};
+
+
+static const struct among a_1[62] =
+{
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 4, -1 },
+{ 0, 3, 4, -1 },
+{ 0, 4, 6, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 9, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 12, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 14, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 5, 16, -1 },
+{ 0, 5, 16, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 23, -1 },
+{ 0, 3, 23, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 29, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 4, 33, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 35, -1 },
+{ 0, 3, 35, -1 },
+{ 0, 4, 37, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 4, 39, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 41, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 6, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 4, 45, -1 },
+{ 0, 5, 46, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 3, 49, -1 },
+{ 0, 4, 50, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 3, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 4, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 3, 60, -1 }
+};
+
+
+static const struct among a_2[11] =
+{
+{ 0, 5, -1, 7 },
+{ 0, 5, -1, 3 },
+{ 0, 5, -1, 6 },
+{ 0, 5, -1, 8 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 2 },
+{ 0, 5, -1, 5 },
+{ 0, 6, -1, 8 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 2 },
+{ 0, 4, -1, 4 }
+};
+
+
+static const struct among a_3[2] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 2, -1, 2 }
+};
+
+
+static const struct among a_4[1] =
+{
+{ 0, 2, -1, 1 }
+};
+
+static const unsigned char g_v[] = { 17, 65, 16, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 64, 1, 0, 64, 0, 0, 0, 0, 0, 0, 0, 4, 4 };
+
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x10D:
+                i = 0;
+                break;
+            case 0x17E:
+                if (n <= 1) break;
+                if (q[-2] != 'd') break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+static const symbol s_0[] = { 't' };
+static const symbol s_1[] = { 'd' };
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'm':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'j':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'o':
+                                        i = 0;
+                                        break;
+                                    case 0x117:
+                                        i = 1;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 2;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 'k') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'o') break;
+                                i = 3;
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 4;
+                                break;
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 'u') break;
+                                i = 5;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 's') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'a') break;
+                        i = 6;
+                        break;
+                    case 0x117:
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                if (n <= 4) break;
+                                if (q[-5] != 'k') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'o') break;
+                                i = 7;
+                                break;
+                            case 'i':
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 8;
+                                break;
+                            case 'o':
+                                if (n <= 4) break;
+                                if (q[-5] != 'u') break;
+                                i = 9;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'u':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                if (q[-3] != 's') break;
+                if (n <= 3) break;
+                if (q[-4] != 'e') break;
+                i = 10;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_2[] = { 'a', 'i', 't', 0x117 };
+static const symbol s_3[] = { 'u', 'o', 't', 0x117 };
+static const symbol s_4[] = { 0x117, 'j', 'i', 'm', 'a', 's' };
+static const symbol s_5[] = { 'e', 's', 'y', 's' };
+static const symbol s_6[] = { 'a', 's', 'y', 's' };
+static const symbol s_7[] = { 'a', 'v', 'i', 'm', 'a', 's' };
+static const symbol s_8[] = { 'o', 'j', 'i', 'm', 'a', 's' };
+static const symbol s_9[] = { 'o', 'k', 'a', 't', 0x117 };
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                i = 0;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        i = 1;
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 2;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'o':
+                                i = 3;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'i':
+                                        i = 4;
+                                        break;
+                                    case 'u':
+                                        i = 5;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'i') break;
+                                        i = 6;
+                                        break;
+                                }
+                                break;
+                            case 'y':
+                                i = 7;
+                                break;
+                            case 0x117:
+                                i = 8;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'e':
+                i = 9;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        i = 10;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 11;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 12;
+                                break;
+                        }
+                        break;
+                    case 'j':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'o':
+                                i = 13;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 14;
+                                break;
+                            case 'u':
+                                i = 15;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 16;
+                                break;
+                            case 'y':
+                                i = 17;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 18;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 19;
+                                        break;
+                                }
+                                break;
+                            case 0x117:
+                                i = 20;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 21;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 22;
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                i = 23;
+                                break;
+                            case 'o':
+                                i = 24;
+                                break;
+                            case 0x117:
+                                i = 25;
+                                if (n <= 3) break;
+                                if (q[-4] != 'm') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'u') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 't') break;
+                                i = 26;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'o':
+                                i = 27;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 28;
+                                        break;
+                                    case 'u':
+                                        i = 29;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 30;
+                                        break;
+                                }
+                                break;
+                            case 'y':
+                                i = 31;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 32;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 33;
+                                        break;
+                                }
+                                break;
+                            case 0x117:
+                                i = 34;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 35;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 36;
+                                break;
+                            case 'i':
+                                i = 37;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'k':
+                                        i = 38;
+                                        break;
+                                    case 's':
+                                        i = 39;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                i = 40;
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                i = 41;
+                                break;
+                            case 0x117:
+                                i = 42;
+                                if (n <= 3) break;
+                                if (q[-4] != 'm') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'u') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 't') break;
+                                i = 43;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'i':
+                i = 44;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 45;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 46;
+                        if (n <= 3) break;
+                        if (q[-4] != 'r') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'e') break;
+                        i = 47;
+                        break;
+                    case 'e':
+                        i = 48;
+                        if (n <= 2) break;
+                        if (q[-3] != 'm') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'u') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 't') break;
+                        i = 49;
+                        break;
+                    case 'k':
+                        i = 50;
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                i = 51;
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 52;
+                                break;
+                            case 'u':
+                                i = 53;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 54;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        i = 55;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 56;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 57;
+                                break;
+                            case 'e':
+                                i = 58;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 59;
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                i = 60;
+                                break;
+                            case 'i':
+                                i = 61;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 62;
+                                        break;
+                                    case 'e':
+                                        i = 63;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'm') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'u') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 't') break;
+                                        i = 64;
+                                        break;
+                                    case 'u':
+                                        i = 65;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                i = 66;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x117) break;
+                                        i = 67;
+                                        break;
+                                    case 'u':
+                                        i = 68;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 69;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        i = 70;
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                i = 71;
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 72;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 0x10D) break;
+                                i = 73;
+                                break;
+                            case 0x105:
+                                i = 74;
+                                break;
+                            case 0x117:
+                                i = 75;
+                                break;
+                            case 0x173:
+                                i = 76;
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                i = 77;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        i = 78;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'e':
+                                        i = 79;
+                                        break;
+                                    case 'i':
+                                        i = 80;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                i = 81;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 82;
+                                        break;
+                                    case 'u':
+                                        i = 83;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 84;
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 85;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 86;
+                                break;
+                            case 'y':
+                                i = 87;
+                                break;
+                            case 0x117:
+                                i = 88;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'l':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        i = 89;
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 90;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        i = 91;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        i = 92;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 93;
+                        if (n <= 3) break;
+                        if (q[-4] != 'n') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'e') break;
+                        i = 94;
+                        break;
+                }
+                break;
+            case 'j':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'o':
+                        i = 95;
+                        break;
+                    case 0x117:
+                        i = 96;
+                        break;
+                }
+                break;
+            case 'k':
+                i = 97;
+                break;
+            case 'm':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 98;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 99;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 100;
+                        break;
+                    case 'i':
+                        i = 101;
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        i = 102;
+                        break;
+                    case 'o':
+                        i = 103;
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        i = 104;
+                        break;
+                    case 0x117:
+                        i = 105;
+                        if (n <= 2) break;
+                        if (q[-3] != 'm') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'u') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 't') break;
+                        i = 106;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 107;
+                        break;
+                    case 'o':
+                        i = 108;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 109;
+                        break;
+                    case 'u':
+                        i = 110;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 111;
+                        break;
+                    case 0x117:
+                        i = 112;
+                        break;
+                }
+                break;
+            case 'o':
+                i = 113;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        i = 114;
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 115;
+                        break;
+                    case 'j':
+                        if (n <= 2) break;
+                        if (q[-3] != 0x117) break;
+                        i = 116;
+                        break;
+                    case 'u':
+                        i = 117;
+                        break;
+                }
+                break;
+            case 's':
+                i = 118;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 119;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 120;
+                        break;
+                    case 'e':
+                        i = 121;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 122;
+                        break;
+                    case 'i':
+                        i = 123;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 124;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 125;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 'm') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'u') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 't') break;
+                                i = 126;
+                                break;
+                            case 'm':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 127;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'n') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'e') break;
+                                        i = 128;
+                                        break;
+                                    case 'o':
+                                        i = 129;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 130;
+                                        break;
+                                    case 'u':
+                                        i = 131;
+                                        break;
+                                    case 0x117:
+                                        i = 132;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 133;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 134;
+                                        break;
+                                    case 'y':
+                                        i = 135;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 136;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 137;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 138;
+                                break;
+                            case 'i':
+                                i = 139;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 140;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 141;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                i = 142;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 143;
+                                break;
+                            case 'u':
+                                i = 144;
+                                break;
+                            case 0x117:
+                                i = 145;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 146;
+                        break;
+                    case 'o':
+                        i = 147;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                i = 148;
+                                break;
+                            case 'u':
+                                i = 149;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 150;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 151;
+                        break;
+                    case 'u':
+                        i = 152;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 153;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 154;
+                                break;
+                            case 'i':
+                                i = 155;
+                                break;
+                        }
+                        break;
+                    case 'y':
+                        i = 156;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 157;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 158;
+                                break;
+                        }
+                        break;
+                    case 0x105:
+                        i = 159;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 160;
+                        break;
+                    case 0x117:
+                        i = 161;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'm':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 162;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 163;
+                                        break;
+                                    case 'i':
+                                        i = 164;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'k':
+                                                i = 165;
+                                                break;
+                                            case 's':
+                                                i = 166;
+                                                break;
+                                        }
+                                        break;
+                                    case 'o':
+                                        i = 167;
+                                        break;
+                                    case 0x117:
+                                        i = 168;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'm') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'u') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 't') break;
+                                        i = 169;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 170;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 171;
+                                        break;
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        i = 172;
+                                        break;
+                                    case 'o':
+                                        i = 173;
+                                        break;
+                                    case 0x117:
+                                        i = 174;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'm') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'u') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 't') break;
+                                        i = 175;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x12F:
+                        i = 176;
+                        break;
+                    case 0x16B:
+                        i = 177;
+                        break;
+                    case 0x173:
+                        if (n <= 2) break;
+                        if (q[-3] != 't') break;
+                        i = 178;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 179;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 180;
+                        break;
+                    case 'i':
+                        i = 181;
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        i = 182;
+                        break;
+                    case 'o':
+                        i = 183;
+                        break;
+                    case 0x117:
+                        i = 184;
+                        if (n <= 2) break;
+                        if (q[-3] != 'm') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'u') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 't') break;
+                        i = 185;
+                        break;
+                }
+                break;
+            case 'u':
+                i = 186;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 187;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 188;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x10D) break;
+                        i = 189;
+                        break;
+                    case 'i':
+                        i = 190;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 191;
+                                break;
+                            case 's':
+                                i = 192;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'y':
+                i = 193;
+                break;
+            case 0x105:
+                i = 194;
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 195;
+                break;
+            case 0x117:
+                i = 196;
+                break;
+            case 0x119:
+                i = 197;
+                break;
+            case 0x12F:
+                i = 198;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 199;
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 200;
+                        break;
+                }
+                break;
+            case 0x173:
+                i = 201;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        i = 202;
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 203;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_0[i].s_size;
+    return a_0[i].result;
+}
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 0;
+                break;
+            case 'j':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 1;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 2;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 3;
+                        break;
+                    case 'o':
+                        i = 4;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                i = 5;
+                                break;
+                            case 'u':
+                                i = 6;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 7;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 8;
+                        break;
+                    case 0x105:
+                        i = 9;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 10;
+                        break;
+                    case 0x117:
+                        i = 11;
+                        break;
+                    case 0x173:
+                        i = 12;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 13;
+                        break;
+                }
+                break;
+            case 'k':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'o':
+                        i = 14;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 15;
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 16;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'l':
+                                if (n <= 4) break;
+                                if (q[-5] != 'u') break;
+                                i = 17;
+                                break;
+                            case 0x10D:
+                                if (n <= 4) break;
+                                if (q[-5] != 'u') break;
+                                i = 18;
+                                break;
+                        }
+                        break;
+                    case 0x161:
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 19;
+                        break;
+                }
+                break;
+            case 'l':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 20;
+                        break;
+                    case 'y':
+                        i = 21;
+                        break;
+                    case 0x117:
+                        i = 22;
+                        break;
+                }
+                break;
+            case 'm':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                i = 23;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'd':
+                        i = 24;
+                        break;
+                    case 'j':
+                        i = 25;
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'g') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'z') break;
+                        i = 26;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 27;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 28;
+                        break;
+                }
+                break;
+            case 'p':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                i = 29;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 30;
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 31;
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 32;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 33;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 34;
+                        break;
+                    case 'o':
+                        i = 35;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                i = 36;
+                                break;
+                            case 'u':
+                                i = 37;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 38;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 39;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 40;
+                        break;
+                    case 0x105:
+                        i = 41;
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 42;
+                        break;
+                    case 0x119:
+                        i = 43;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x117) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 't') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'u') break;
+                        i = 44;
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 45;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 46;
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                i = 47;
+                                break;
+                            case 'i':
+                                i = 48;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        i = 49;
+                        if (n <= 2) break;
+                        if (q[-3] != 'u') break;
+                        i = 50;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 51;
+                        break;
+                    case 'y':
+                        i = 52;
+                        break;
+                    case 0x117:
+                        i = 53;
+                        break;
+                    case 0x161:
+                        if (n <= 2) break;
+                        if (q[-3] != 'k') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'y') break;
+                        i = 54;
+                        break;
+                }
+                break;
+            case 'u':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                if (n <= 2) break;
+                if (q[-3] != 'i') break;
+                i = 55;
+                break;
+            case 'v':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'd') break;
+                        i = 56;
+                        break;
+                    case 's':
+                        i = 57;
+                        break;
+                    case 0x161:
+                        i = 58;
+                        break;
+                }
+                break;
+            case 0x10D:
+                if (n <= 1) break;
+                if (q[-2] != 0x161) break;
+                if (n <= 2) break;
+                if (q[-3] != 'k') break;
+                if (n <= 3) break;
+                if (q[-4] != 'y') break;
+                i = 59;
+                break;
+            case 0x119:
+                i = 60;
+                if (n <= 1) break;
+                if (q[-2] != 'j') break;
+                if (n <= 2) break;
+                if (q[-3] != 0x117) break;
+                i = 61;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        if (q[-1] != 'd') break;
+        if (n <= 1) break;
+        if (q[-2] != 'g') break;
+        i = 0;
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+static const symbol s_10[] = { 'g' };
+
+static int r_fix_chdz(struct SN_env * z) {
+    int among_var;
+    z->ket = z->c;
+    if (z->c <= z->lb || (z->p[z->c - 1] != 269 && z->p[z->c - 1] != 382)) return 0;
+    among_var = find_among_b_3(z);
+    if (!(among_var)) return 0;
+    z->bra = z->c;
+    switch (among_var) {
+        case 1:
+            {   int ret = slice_from_s(z, 1, s_0);
+                if (ret < 0) return ret;
+            }
+            break;
+        case 2:
+            {   int ret = slice_from_s(z, 1, s_1);
+                if (ret < 0) return ret;
+            }
+            break;
+    }
+    return 1;
+}
+
+extern int lithuanian_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    z->I[0] = z->l;
+    {   int c1 = z->c;
+        {   int c2 = z->c;
+            {   int c_test3 = z->c;
+                if (z->c == z->l || z->p[z->c] != 'a') { z->c = c2; goto lab1; }
+                z->c++;
+                z->c = c_test3;
+            }
+            if (!(SIZE(z->p) > 6)) { z->c = c2; goto lab1; }
+z->c = z->c + 1;
+            if (z->c > z->l) { z->c = c2; goto lab1; }
+        lab1:
+            ;
+        }
+        {   
+            int ret = out_grouping(z, g_v, 97, 371, 1);
+            if (ret < 0) goto lab0;
+            z->c += ret;
+        }
+        {   
+            int ret = in_grouping(z, g_v, 97, 371, 1);
+            if (ret < 0) goto lab0;
+            z->c += ret;
+        }
+        z->I[0] = z->c;
+    lab0:
+        z->c = c1;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m4 = z->l - z->c; (void)m4;
+        z->ket = z->c;
+        if (z->c - 3 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((2621472 >> (z->p[z->c - 1] & 0x1f)) & 1)) goto lab2;
+        among_var = find_among_b_2(z);
+        if (!(among_var)) goto lab2;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 4, s_2);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 4, s_3);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 6, s_4);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                {   int ret = slice_from_s(z, 4, s_5);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                {   int ret = slice_from_s(z, 4, s_6);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {   int ret = slice_from_s(z, 6, s_7);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                {   int ret = slice_from_s(z, 6, s_8);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 8:
+                {   int ret = slice_from_s(z, 5, s_9);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab2:
+        z->c = z->l - m4;
+    }
+    {   int m5 = z->l - z->c; (void)m5;
+
+        {   int mlimit6;
+            if (z->c < z->I[0]) goto lab3;
+            mlimit6 = z->lb; z->lb = z->I[0];
+            z->ket = z->c;
+            if (z->c <= z->lb) { z->lb = mlimit6; goto lab3; }
+            if (!(find_among_b_0(z))) { z->lb = mlimit6; goto lab3; }
+            z->bra = z->c;
+            z->lb = mlimit6;
+        }
+        if (!(z->I[0] <= z->c)) goto lab3;
+        {   int ret = slice_del(z);
+            if (ret < 0) return ret;
+        }
+    lab3:
+        z->c = z->l - m5;
+    }
+    {   int m7 = z->l - z->c; (void)m7;
+        {   int ret = r_fix_chdz(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - m7;
+    }
+    {   int m8 = z->l - z->c; (void)m8;
+        while(1) {
+            int m9 = z->l - z->c; (void)m9;
+
+            {   int mlimit10;
+                if (z->c < z->I[0]) goto lab5;
+                mlimit10 = z->lb; z->lb = z->I[0];
+                z->ket = z->c;
+                if (z->c <= z->lb) { z->lb = mlimit10; goto lab5; }
+                if (!(find_among_b_1(z))) { z->lb = mlimit10; goto lab5; }
+                z->bra = z->c;
+                z->lb = mlimit10;
+            }
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            continue;
+        lab5:
+            z->c = z->l - m9;
+            break;
+        }
+        z->c = z->l - m8;
+    }
+    {   int m11 = z->l - z->c; (void)m11;
+        {   int ret = r_fix_chdz(z);
+            if (ret < 0) return ret;
+        }
+        z->c = z->l - m11;
+    }
+    {   int m12 = z->l - z->c; (void)m12;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb || z->p[z->c - 1] != 100 || z->p[z->c - 2] != 103) goto lab6;
+        if (!(find_among_b_4(z))) goto lab6;
+        z->bra = z->c;
+        {   int ret = slice_from_s(z, 1, s_10);
+            if (ret < 0) return ret;
+        }
+    lab6:
+        z->c = z->l - m12;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * lithuanian_UTF_8_create_env(void) { return SN_create_env(0, 1); }
+
+extern void lithuanian_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
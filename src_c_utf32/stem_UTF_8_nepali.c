@@ -0,0 +1,915 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int nepali_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * nepali_UTF_8_create_env(void);
+extern void nepali_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[17] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 2 }
+};
+
+
+static const struct among a_1[3] =
+{
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 },
+{ 0, 1, -1, -1 }
+};
+
+
+static const struct among a_2[3] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 2 }
+};
+
+
+static const struct among a_3[91] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 1, 1 },
+{ 0, 2, 1, 1 },
+{ 0, 2, 1, 1 },
+{ 0, 2, 1, 1 },
+{ 0, 3, 5, 1 },
+{ 0, 5, 6, 1 },
+{ 0, 4, 1, 1 },
+{ 0, 4, 1, 1 },
+{ 0, 5, 1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 11, 1 },
+{ 0, 4, 11, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 14, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 16, 1 },
+{ 0, 3, 16, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 21, 1 },
+{ 0, 4, 21, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 28, 1 },
+{ 0, 3, 28, 1 },
+{ 0, 4, 30, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 39, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 41, 1 },
+{ 0, 3, 41, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 44, 1 },
+{ 0, 4, 44, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 47, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 49, 1 },
+{ 0, 3, 49, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 52, 1 },
+{ 0, 3, 52, 1 },
+{ 0, 3, 52, 1 },
+{ 0, 4, 55, 1 },
+{ 0, 4, 55, 1 },
+{ 0, 4, 52, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 59, 1 },
+{ 0, 3, 59, 1 },
+{ 0, 3, 59, 1 },
+{ 0, 3, 59, 1 },
+{ 0, 4, 63, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 65, 1 },
+{ 0, 4, 65, 1 },
+{ 0, 4, 65, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 69, 1 },
+{ 0, 4, 69, 1 },
+{ 0, 4, 69, 1 },
+{ 0, 4, 69, 1 },
+{ 0, 5, 73, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 5, 79, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 81, 1 },
+{ 0, 4, 81, 1 },
+{ 0, 4, 81, 1 },
+{ 0, 4, 81, 1 },
+{ 0, 5, 85, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 87, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x907:
+                if (n <= 1) break;
+                if (q[-2] != 0x93E) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x932) break;
+                i = 0;
+                break;
+            case 0x908:
+                if (n <= 1) break;
+                if (q[-2] != 0x93E) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x932) break;
+                i = 1;
+                break;
+            case 0x917:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x901:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x938) break;
+                        i = 2;
+                        break;
+                    case 0x902:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x938) break;
+                        i = 3;
+                        break;
+                }
+                break;
+            case 0x924:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x92B:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x94D) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x930) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x93E) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x92E) break;
+                        i = 4;
+                        break;
+                    case 0x930:
+                        i = 5;
+                        break;
+                }
+                break;
+            case 0x93E:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x915:
+                        i = 6;
+                        break;
+                    case 0x92E:
+                        i = 7;
+                        break;
+                    case 0x930:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x93E) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x935) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x94D) break;
+                        if (n <= 5) break;
+                        if (q[-6] != 0x926) break;
+                        i = 8;
+                        break;
+                }
+                break;
+            case 0x93F:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x915:
+                        i = 9;
+                        break;
+                    case 0x91B:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x92A) break;
+                        i = 10;
+                        break;
+                }
+                break;
+            case 0x940:
+                if (n <= 1) break;
+                if (q[-2] != 0x915) break;
+                i = 11;
+                break;
+            case 0x947:
+                if (n <= 1) break;
+                if (q[-2] != 0x932) break;
+                i = 12;
+                break;
+            case 0x948:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x915:
+                        i = 13;
+                        break;
+                    case 0x917:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x901) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x938) break;
+                        i = 14;
+                        break;
+                    case 0x92E:
+                        i = 15;
+                        break;
+                }
+                break;
+            case 0x94B:
+                if (n <= 1) break;
+                if (q[-2] != 0x915) break;
+                i = 16;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_0[i].s_size;
+    return a_0[i].result;
+}
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x901:
+                i = 0;
+                break;
+            case 0x902:
+                i = 1;
+                break;
+            case 0x948:
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x901:
+                i = 0;
+                break;
+            case 0x902:
+                i = 1;
+                break;
+            case 0x948:
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_0[] = { 0x92F, 0x94C };
+static const symbol s_1[] = { 0x91B, 0x94C };
+static const symbol s_2[] = { 0x928, 0x94C };
+static const symbol s_3[] = { 0x925, 0x947 };
+static const symbol s_4[] = { 0x924, 0x94D, 0x930 };
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x90F:
+                if (n <= 1) break;
+                if (q[-2] != 0x93F) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x925) break;
+                i = 0;
+                break;
+            case 0x91B:
+                i = 1;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x907:
+                        i = 2;
+                        break;
+                    case 0x90F:
+                        i = 3;
+                        break;
+                    case 0x93F:
+                        i = 4;
+                        break;
+                    case 0x947:
+                        i = 5;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x928) break;
+                        i = 6;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x941) break;
+                        if (n <= 4) break;
+                        if (q[-5] != 0x939) break;
+                        i = 7;
+                        break;
+                    case 0x94D:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x928) break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x907:
+                                i = 8;
+                                break;
+                            case 0x93F:
+                                i = 9;
+                                break;
+                            case 0x941:
+                                if (n <= 4) break;
+                                if (q[-5] != 0x939) break;
+                                i = 10;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x93E:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x915:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x90F:
+                                i = 11;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x907:
+                                        i = 12;
+                                        break;
+                                    case 0x93F:
+                                        i = 13;
+                                        break;
+                                }
+                                break;
+                            case 0x947:
+                                i = 14;
+                                if (n <= 3) break;
+                                if (q[-4] != 0x928) break;
+                                i = 15;
+                                break;
+                        }
+                        break;
+                    case 0x926:
+                        i = 16;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x907:
+                                i = 17;
+                                break;
+                            case 0x93F:
+                                i = 18;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x93F:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x916:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x947) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x926) break;
+                        i = 19;
+                        break;
+                    case 0x925:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x93E) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x92E) break;
+                        i = 20;
+                        break;
+                }
+                break;
+            case 0x940:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x915:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x90F:
+                                i = 21;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x907:
+                                        i = 22;
+                                        break;
+                                    case 0x93F:
+                                        i = 23;
+                                        break;
+                                }
+                                break;
+                            case 0x947:
+                                i = 24;
+                                break;
+                        }
+                        break;
+                    case 0x916:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x947) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0x926) break;
+                        i = 25;
+                        break;
+                    case 0x925:
+                        i = 26;
+                        break;
+                    case 0x926:
+                        i = 27;
+                        break;
+                }
+                break;
+            case 0x941:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x91B:
+                        i = 28;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x90F:
+                                i = 29;
+                                break;
+                            case 0x947:
+                                i = 30;
+                                if (n <= 3) break;
+                                if (q[-4] != 0x928) break;
+                                i = 31;
+                                break;
+                        }
+                        break;
+                    case 0x928:
+                        i = 32;
+                        break;
+                    case 0x930:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x939) break;
+                        i = 33;
+                        break;
+                }
+                break;
+            case 0x942:
+                if (n <= 1) break;
+                if (q[-2] != 0x930) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x939) break;
+                i = 34;
+                break;
+            case 0x947:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x91B:
+                        i = 35;
+                        break;
+                    case 0x925:
+                        i = 36;
+                        break;
+                    case 0x928:
+                        i = 37;
+                        break;
+                }
+                break;
+            case 0x948:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x915:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x90F:
+                                i = 38;
+                                break;
+                            case 0x947:
+                                i = 39;
+                                if (n <= 3) break;
+                                if (q[-4] != 0x928) break;
+                                i = 40;
+                                break;
+                        }
+                        break;
+                    case 0x926:
+                        i = 41;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x907:
+                                i = 42;
+                                break;
+                            case 0x93F:
+                                i = 43;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x94B:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x915:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x90F:
+                                i = 44;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x907:
+                                        i = 45;
+                                        break;
+                                    case 0x93F:
+                                        i = 46;
+                                        break;
+                                }
+                                break;
+                            case 0x947:
+                                i = 47;
+                                if (n <= 3) break;
+                                if (q[-4] != 0x928) break;
+                                i = 48;
+                                break;
+                        }
+                        break;
+                    case 0x926:
+                        i = 49;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x907:
+                                i = 50;
+                                break;
+                            case 0x93F:
+                                i = 51;
+                                break;
+                        }
+                        break;
+                    case 0x92F:
+                        i = 52;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x907:
+                                i = 53;
+                                break;
+                            case 0x92D:
+                                i = 54;
+                                break;
+                            case 0x93F:
+                                i = 55;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x925:
+                                        i = 56;
+                                        break;
+                                    case 0x926:
+                                        i = 57;
+                                        break;
+                                }
+                                break;
+                            case 0x94D:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x925) break;
+                                i = 58;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x94C:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x91B:
+                        i = 59;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x907:
+                                i = 60;
+                                break;
+                            case 0x90F:
+                                i = 61;
+                                break;
+                            case 0x93F:
+                                i = 62;
+                                break;
+                            case 0x947:
+                                i = 63;
+                                if (n <= 3) break;
+                                if (q[-4] != 0x928) break;
+                                i = 64;
+                                break;
+                        }
+                        break;
+                    case 0x92F:
+                        i = 65;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x93F:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x925) break;
+                                i = 66;
+                                break;
+                            case 0x94D:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x91B:
+                                        i = 67;
+                                        break;
+                                    case 0x925:
+                                        i = 68;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x94D:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x928:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x91B:
+                                i = 69;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x907:
+                                        i = 70;
+                                        break;
+                                    case 0x90F:
+                                        i = 71;
+                                        break;
+                                    case 0x93F:
+                                        i = 72;
+                                        break;
+                                    case 0x947:
+                                        i = 73;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x928) break;
+                                        i = 74;
+                                        break;
+                                }
+                                break;
+                            case 0x93E:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x932) break;
+                                i = 75;
+                                break;
+                            case 0x93F:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x91B:
+                                        i = 76;
+                                        break;
+                                    case 0x925:
+                                        i = 77;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x930:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x92A) break;
+                        i = 78;
+                        break;
+                    case 0x938:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x907:
+                                i = 79;
+                                if (n <= 3) break;
+                                if (q[-4] != 0x93F) break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0x925) break;
+                                i = 80;
+                                break;
+                            case 0x91B:
+                                i = 81;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 0x907:
+                                        i = 82;
+                                        break;
+                                    case 0x90F:
+                                        i = 83;
+                                        break;
+                                    case 0x93F:
+                                        i = 84;
+                                        break;
+                                    case 0x947:
+                                        i = 85;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0x928) break;
+                                        i = 86;
+                                        break;
+                                }
+                                break;
+                            case 0x93F:
+                                i = 87;
+                                if (n <= 3) break;
+                                if (q[-4] != 0x925) break;
+                                i = 88;
+                                break;
+                            case 0x947:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x91B) break;
+                                i = 89;
+                                break;
+                            case 0x94B:
+                                if (n <= 3) break;
+                                if (q[-4] != 0x939) break;
+                                i = 90;
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+
+extern int nepali_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    z->lb = z->c; z->c = z->l;
+
+    {   int m1 = z->l - z->c; (void)m1;
+        z->ket = z->c;
+        if (z->c - 1 <= z->lb) goto lab0;
+        among_var = find_among_b_0(z);
+        if (!(among_var)) goto lab0;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int m2 = z->l - z->c; (void)m2;
+                    {   int m3 = z->l - z->c; (void)m3;
+                        if (z->c <= z->lb || z->p[z->c - 1] != 0x90F) goto lab4;
+                        z->c--;
+                        goto lab3;
+                    lab4:
+                        z->c = z->l - m3;
+                        if (z->c <= z->lb || z->p[z->c - 1] != 0x947) goto lab2;
+                        z->c--;
+                    }
+                lab3:
+                    goto lab1;
+                lab2:
+                    z->c = z->l - m2;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab1:
+                break;
+        }
+    lab0:
+        z->c = z->l - m1;
+    }
+    {   int m4 = z->l - z->c; (void)m4;
+        while(1) {
+            int m5 = z->l - z->c; (void)m5;
+            {   int m6 = z->l - z->c; (void)m6;
+                {   int m7 = z->l - z->c; (void)m7;
+                    z->ket = z->c;
+                    if (z->c <= z->lb) goto lab7;
+                    if (!(find_among_b_1(z))) goto lab7;
+                    z->bra = z->c;
+                    z->c = z->l - m7;
+                    z->ket = z->c;
+                    if (z->c <= z->lb) goto lab7;
+                    among_var = find_among_b_2(z);
+                    if (!(among_var)) goto lab7;
+                    z->bra = z->c;
+                    switch (among_var) {
+                        case 1:
+                            {   int m8 = z->l - z->c; (void)m8;
+                                if (!(eq_s_b(z, 2, s_0))) goto lab9;
+                                goto lab8;
+                            lab9:
+                                z->c = z->l - m8;
+                                if (!(eq_s_b(z, 2, s_1))) goto lab10;
+                                goto lab8;
+                            lab10:
+                                z->c = z->l - m8;
+                                if (!(eq_s_b(z, 2, s_2))) goto lab11;
+                                goto lab8;
+                            lab11:
+                                z->c = z->l - m8;
+                                if (!(eq_s_b(z, 2, s_3))) goto lab7;
+                            }
+                        lab8:
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 2:
+                            if (!(eq_s_b(z, 3, s_4))) goto lab7;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                    }
+                }
+            lab7:
+                z->c = z->l - m6;
+            }
+            z->ket = z->c;
+            if (z->c <= z->lb) goto lab6;
+            if (!(find_among_b_3(z))) goto lab6;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+            continue;
+        lab6:
+            z->c = z->l - m5;
+            break;
+        }
+        z->c = z->l - m4;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * nepali_UTF_8_create_env(void) { return SN_create_env(0, 0); }
+
+extern void nepali_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
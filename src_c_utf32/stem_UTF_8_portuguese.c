@@ -0,0 +1,1886 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int portuguese_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * portuguese_UTF_8_create_env(void);
+extern void portuguese_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+static const symbol a_0_pool[6] = {
+    0xE3, 'a', '~', 0xF5, 'o', '~'
+};
+
+static const struct translation_entry a_0_entry[2] = {
+    { 0, 1, 1, 2 },
+    { 3, 1, 4, 2 }
+};
+
+static const unsigned short a_0_page[1] = {
+    256
+};
+
+static const unsigned short a_0_index[512] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+static const struct translation a_0_translation = {
+    0, 0, 1, a_0_page, a_0_index, a_0_entry, a_0_pool
+};
+
+
+static const struct among a_1[3] =
+{
+{ 0, 0, -1, 3 },
+{ 0, 2, 0, 1 },
+{ 0, 2, 0, 2 }
+};
+
+
+static const struct among a_2[4] =
+{
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, -1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_3[3] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+
+static const struct among a_4[3] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_5[45] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 4 },
+{ 0, 5, -1, 2 },
+{ 0, 3, -1, 9 },
+{ 0, 5, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 8 },
+{ 0, 3, -1, 1 },
+{ 0, 5, -1, 7 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 6 },
+{ 0, 6, 12, 5 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 3, -1, 8 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 3 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 4 },
+{ 0, 6, -1, 2 },
+{ 0, 4, -1, 9 },
+{ 0, 6, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 8 },
+{ 0, 4, -1, 1 },
+{ 0, 6, -1, 7 },
+{ 0, 6, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 3 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 0, 7, -1, 1 },
+{ 0, 4, -1, 8 }
+};
+
+
+static const struct among a_6[120] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 2, 1 },
+{ 0, 4, 2, 1 },
+{ 0, 4, 2, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 16, 1 },
+{ 0, 4, 16, 1 },
+{ 0, 4, 16, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 20, 1 },
+{ 0, 5, 21, 1 },
+{ 0, 5, 21, 1 },
+{ 0, 5, 21, 1 },
+{ 0, 4, 20, 1 },
+{ 0, 4, 20, 1 },
+{ 0, 4, 20, 1 },
+{ 0, 4, 20, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 29, 1 },
+{ 0, 4, 29, 1 },
+{ 0, 4, 29, 1 },
+{ 0, 5, 29, 1 },
+{ 0, 5, 29, 1 },
+{ 0, 5, 29, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 47, 1 },
+{ 0, 4, 47, 1 },
+{ 0, 3, 47, 1 },
+{ 0, 5, 50, 1 },
+{ 0, 5, 50, 1 },
+{ 0, 5, 50, 1 },
+{ 0, 4, 47, 1 },
+{ 0, 4, 47, 1 },
+{ 0, 4, 47, 1 },
+{ 0, 4, 47, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 5, 58, 1 },
+{ 0, 5, 58, 1 },
+{ 0, 5, 58, 1 },
+{ 0, 4, 58, 1 },
+{ 0, 4, 58, 1 },
+{ 0, 4, 58, 1 },
+{ 0, 5, 58, 1 },
+{ 0, 5, 58, 1 },
+{ 0, 5, 58, 1 },
+{ 0, 5, 58, 1 },
+{ 0, 5, 58, 1 },
+{ 0, 5, 58, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 71, 1 },
+{ 0, 3, 71, 1 },
+{ 0, 5, 73, 1 },
+{ 0, 5, 73, 1 },
+{ 0, 5, 73, 1 },
+{ 0, 5, 73, 1 },
+{ 0, 5, 73, 1 },
+{ 0, 5, 73, 1 },
+{ 0, 6, 73, 1 },
+{ 0, 6, 73, 1 },
+{ 0, 6, 73, 1 },
+{ 0, 5, 73, 1 },
+{ 0, 4, 73, 1 },
+{ 0, 6, 84, 1 },
+{ 0, 6, 84, 1 },
+{ 0, 6, 84, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 90, 1 },
+{ 0, 6, 90, 1 },
+{ 0, 6, 90, 1 },
+{ 0, 6, 90, 1 },
+{ 0, 5, 90, 1 },
+{ 0, 7, 95, 1 },
+{ 0, 7, 95, 1 },
+{ 0, 7, 95, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 6, 99, 1 },
+{ 0, 6, 99, 1 },
+{ 0, 6, 99, 1 },
+{ 0, 7, 99, 1 },
+{ 0, 7, 99, 1 },
+{ 0, 7, 99, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 5, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 }
+};
+
+
+static const struct among a_7[7] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 }
+};
+
+
+static const struct among a_8[4] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 2 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 }
+};
+
+static const unsigned char g_v[] = { 17, 65, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 19, 12, 2 };
+
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 0;
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 0xE2:
+                                        i = 1;
+                                        break;
+                                    case 0xEA:
+                                        i = 2;
+                                        break;
+                                }
+                                break;
+                            case 'g':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'l') break;
+                                i = 3;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                i = 4;
+                                break;
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 'd') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 5;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        i = 6;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 7;
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 8;
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 9;
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'd') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 10;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 11;
+                                break;
+                            case 'e':
+                                if (n <= 4) break;
+                                if (q[-5] != 'm') break;
+                                i = 12;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                i = 13;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                if (n <= 2) break;
+                if (q[-3] != 'v') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0xE1:
+                        i = 14;
+                        break;
+                    case 0xED:
+                        i = 15;
+                        break;
+                }
+                break;
+            case 'o':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 16;
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        i = 17;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        i = 18;
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'm') break;
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 'a':
+                                i = 19;
+                                break;
+                            case 'i':
+                                i = 20;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'i') break;
+                        i = 21;
+                        break;
+                    case '~':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 0xE7) break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 22;
+                                break;
+                            case 'u':
+                                i = 23;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                if (n <= 2) break;
+                if (q[-3] != 'd') break;
+                if (n <= 3) break;
+                if (q[-4] != 'a') break;
+                i = 24;
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 25;
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'n') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 0xEA) break;
+                                        i = 26;
+                                        break;
+                                    case 'g':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'l') break;
+                                        i = 27;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 28;
+                                        break;
+                                    case 'o':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'd') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'a') break;
+                                        i = 29;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 30;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 31;
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 32;
+                                break;
+                            case 'z':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 33;
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'd') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 34;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'd') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'a') break;
+                                i = 35;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 36;
+                                break;
+                            case '~':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 0xE7) break;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'a':
+                                        i = 37;
+                                        break;
+                                    case 'u':
+                                        i = 38;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 39;
+                                break;
+                            case 'm':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'i') break;
+                                i = 40;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 41;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'm') break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 'a':
+                                        i = 42;
+                                        break;
+                                    case 'i':
+                                        i = 43;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 44;
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+static const symbol s_0[] = { 'l', 'o', 'g' };
+static const symbol s_1[] = { 'u' };
+static const symbol s_2[] = { 'e', 'n', 't', 'e' };
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'c':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 0;
+                break;
+            case 'd':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                i = 1;
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                i = 2;
+                break;
+            case 'v':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_3[] = { 'a', 't' };
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'e':
+                if (n <= 1) break;
+                if (q[-2] != 't') break;
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                if (n <= 3) break;
+                if (q[-4] != 'a') break;
+                i = 0;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                if (n <= 2) break;
+                if (q[-3] != 'v') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'a':
+                        i = 1;
+                        break;
+                    case 0xED:
+                        i = 2;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'c':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 0;
+                break;
+            case 'l':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                if (q[-3] != 'b') break;
+                if (n <= 3) break;
+                if (q[-4] != 'a') break;
+                i = 1;
+                break;
+            case 'v':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+static const symbol s_4[] = { 'a', 't' };
+static const symbol s_5[] = { 'i', 'r' };
+
+static const unsigned char a_6_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0xA2, 0x2C, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0
+};
+
+static const unsigned char a_6_filter1[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x32, 0x82, 0x5C, 0x40,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0, 0x0, 0x0
+};
+
+static int find_among_b_6(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 0;
+                                break;
+                            case 'i':
+                                i = 1;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        i = 2;
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 3;
+                                break;
+                            case 'e':
+                                i = 4;
+                                break;
+                            case 'i':
+                                i = 5;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 6;
+                                break;
+                            case 'e':
+                                i = 7;
+                                break;
+                            case 'i':
+                                i = 8;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 9;
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 10;
+                                break;
+                            case 'e':
+                                i = 11;
+                                break;
+                            case 'i':
+                                i = 12;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 13;
+                                break;
+                            case 'e':
+                                i = 14;
+                                break;
+                            case 'i':
+                                i = 15;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                if (q[-2] != 'e') break;
+                i = 16;
+                if (n <= 2) break;
+                if (q[-3] != 'r') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'a':
+                        i = 17;
+                        break;
+                    case 'e':
+                        i = 18;
+                        break;
+                    case 'i':
+                        i = 19;
+                        break;
+                }
+                break;
+            case 'm':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 20;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                i = 21;
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 22;
+                                        break;
+                                    case 'e':
+                                        i = 23;
+                                        break;
+                                    case 'i':
+                                        i = 24;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 25;
+                                        break;
+                                    case 'e':
+                                        i = 26;
+                                        break;
+                                    case 'i':
+                                        i = 27;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 28;
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        i = 29;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 30;
+                                        break;
+                                    case 'e':
+                                        i = 31;
+                                        break;
+                                    case 'i':
+                                        i = 32;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 33;
+                                        break;
+                                    case 'e':
+                                        i = 34;
+                                        break;
+                                    case 'i':
+                                        i = 35;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'o':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 36;
+                                break;
+                            case 'i':
+                                i = 37;
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 38;
+                                        break;
+                                    case 'e':
+                                        i = 39;
+                                        break;
+                                    case 'i':
+                                        i = 40;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case '~':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'r') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'a':
+                                i = 41;
+                                break;
+                            case 'e':
+                                i = 42;
+                                break;
+                            case 'i':
+                                i = 43;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'r':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 44;
+                        break;
+                    case 'e':
+                        i = 45;
+                        break;
+                    case 'i':
+                        i = 46;
+                        break;
+                }
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 47;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 48;
+                                        break;
+                                    case 'i':
+                                        i = 49;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 50;
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 51;
+                                        break;
+                                    case 'e':
+                                        i = 52;
+                                        break;
+                                    case 'i':
+                                        i = 53;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 54;
+                                        break;
+                                    case 'e':
+                                        i = 55;
+                                        break;
+                                    case 'i':
+                                        i = 56;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 57;
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        i = 58;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 59;
+                                        break;
+                                    case 'e':
+                                        i = 60;
+                                        break;
+                                    case 'i':
+                                        i = 61;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 62;
+                                        break;
+                                    case 'e':
+                                        i = 63;
+                                        break;
+                                    case 'i':
+                                        i = 64;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 65;
+                                        break;
+                                    case 'e':
+                                        i = 66;
+                                        break;
+                                    case 'i':
+                                        i = 67;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 68;
+                                        break;
+                                    case 'e':
+                                        i = 69;
+                                        break;
+                                    case 'i':
+                                        i = 70;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        i = 71;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 72;
+                                break;
+                            case 'e':
+                                i = 73;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 74;
+                                                break;
+                                            case 'e':
+                                                i = 75;
+                                                break;
+                                            case 'i':
+                                                i = 76;
+                                                break;
+                                            case 0xE1:
+                                                i = 77;
+                                                break;
+                                            case 0xE9:
+                                                i = 78;
+                                                break;
+                                            case 0xED:
+                                                i = 79;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 0xE1:
+                                                i = 80;
+                                                break;
+                                            case 0xE9:
+                                                i = 81;
+                                                break;
+                                            case 0xED:
+                                                i = 82;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 0xE1) break;
+                                        i = 83;
+                                        break;
+                                    case 0xED:
+                                        i = 84;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'r') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 85;
+                                                break;
+                                            case 'e':
+                                                i = 86;
+                                                break;
+                                            case 'i':
+                                                i = 87;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 88;
+                                        break;
+                                    case 'i':
+                                        i = 89;
+                                        break;
+                                }
+                                break;
+                            case 'm':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 90;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 0xE1:
+                                                        i = 91;
+                                                        break;
+                                                    case 0xE9:
+                                                        i = 92;
+                                                        break;
+                                                    case 0xED:
+                                                        i = 93;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'v':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 0xE1) break;
+                                                i = 94;
+                                                break;
+                                            case 0xED:
+                                                i = 95;
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'r') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'a':
+                                                        i = 96;
+                                                        break;
+                                                    case 'e':
+                                                        i = 97;
+                                                        break;
+                                                    case 'i':
+                                                        i = 98;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'e':
+                                        i = 99;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 100;
+                                                        break;
+                                                    case 'e':
+                                                        i = 101;
+                                                        break;
+                                                    case 'i':
+                                                        i = 102;
+                                                        break;
+                                                }
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 's') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 0xE1:
+                                                        i = 103;
+                                                        break;
+                                                    case 0xEA:
+                                                        i = 104;
+                                                        break;
+                                                    case 0xED:
+                                                        i = 105;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'i':
+                                        i = 106;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 107;
+                                                break;
+                                            case 'e':
+                                                i = 108;
+                                                break;
+                                            case 'i':
+                                                i = 109;
+                                                break;
+                                        }
+                                        break;
+                                    case 0xE1:
+                                        i = 110;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0xE1:
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 111;
+                                break;
+                            case 'e':
+                                i = 112;
+                                break;
+                            case 'i':
+                                i = 113;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'u':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        i = 114;
+                        break;
+                    case 'i':
+                        i = 115;
+                        break;
+                    case 'o':
+                        i = 116;
+                        break;
+                }
+                break;
+            case 0xE1:
+                if (n <= 1) break;
+                if (q[-2] != 'r') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'a':
+                        i = 117;
+                        break;
+                    case 'e':
+                        i = 118;
+                        break;
+                    case 'i':
+                        i = 119;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_6[i].s_size;
+    return a_6[i].result;
+}
+
+static const unsigned char a_7_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x82, 0x8, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x20, 0x8, 0x0
+};
+
+static int find_among_b_7(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                i = 0;
+                break;
+            case 'i':
+                i = 1;
+                break;
+            case 'o':
+                i = 2;
+                break;
+            case 's':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                i = 3;
+                break;
+            case 0xE1:
+                i = 4;
+                break;
+            case 0xED:
+                i = 5;
+                break;
+            case 0xF3:
+                i = 6;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_7[i].s_size;
+    return a_7[i].result;
+}
+
+static const unsigned char a_8_filter0[32] = {
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x20, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x80, 0x6, 0x0, 0x0
+};
+
+static int find_among_b_8(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'e':
+                i = 0;
+                break;
+            case 0xE7:
+                i = 1;
+                break;
+            case 0xE9:
+                i = 2;
+                break;
+            case 0xEA:
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_8[i].s_size;
+    return a_8[i].result;
+}
+static const symbol s_6[] = { 'c' };
+
+static int find_among_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        i = 0;
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 'a':
+                if (n <= 1) break;
+                if (q[1] != '~') break;
+                i = 1;
+                break;
+            case 'o':
+                if (n <= 1) break;
+                if (q[1] != '~') break;
+                i = 2;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_1[i].s_size;
+    return a_1[i].result;
+}
+static const symbol s_7[] = { 0xE3 };
+static const symbol s_8[] = { 0xF5 };
+
+extern int portuguese_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    {   int c1 = z->c;
+        {   int ret = translate(z, &a_0_translation);
+            if (ret < 0) return ret;
+        }
+        z->c = c1;
+    }
+    
+    z->I[2] = z->l;
+    z->I[1] = z->l;
+    z->I[0] = z->l;
+    {   int c2 = z->c;
+        {   int c3 = z->c;
+            if (in_grouping(z, g_v, 97, 250, 0)) goto lab4;
+            {   int c4 = z->c;
+                if (out_grouping(z, g_v, 97, 250, 0)) goto lab6;
+                {   
+                    int ret = out_grouping(z, g_v, 97, 250, 1);
+                    if (ret < 0) goto lab6;
+                    z->c += ret;
+                }
+                goto lab5;
+            lab6:
+                z->c = c4;
+                if (in_grouping(z, g_v, 97, 250, 0)) goto lab4;
+                {   
+                    int ret = in_grouping(z, g_v, 97, 250, 1);
+                    if (ret < 0) goto lab4;
+                    z->c += ret;
+                }
+            }
+        lab5:
+            goto lab3;
+        lab4:
+            z->c = c3;
+            if (out_grouping(z, g_v, 97, 250, 0)) goto lab2;
+            {   int c5 = z->c;
+                if (out_grouping(z, g_v, 97, 250, 0)) goto lab8;
+                {   
+                    int ret = out_grouping(z, g_v, 97, 250, 1);
+                    if (ret < 0) goto lab8;
+                    z->c += ret;
+                }
+                goto lab7;
+            lab8:
+                z->c = c5;
+                if (in_grouping(z, g_v, 97, 250, 0)) goto lab2;
+                if (z->c >= z->l) goto lab2;
+                z->c++;
+            }
+        lab7:
+            ;
+        }
+    lab3:
+        z->I[2] = z->c;
+    lab2:
+        z->c = c2;
+    }
+    {   int c6 = z->c;
+        {   
+            int ret = out_grouping(z, g_v, 97, 250, 1);
+            if (ret < 0) goto lab9;
+            z->c += ret;
+        }
+        {   
+            int ret = in_grouping(z, g_v, 97, 250, 1);
+            if (ret < 0) goto lab9;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+        {   
+            int ret = out_grouping(z, g_v, 97, 250, 1);
+            if (ret < 0) goto lab9;
+            z->c += ret;
+        }
+        {   
+            int ret = in_grouping(z, g_v, 97, 250, 1);
+            if (ret < 0) goto lab9;
+            z->c += ret;
+        }
+        z->I[0] = z->c;
+    lab9:
+        z->c = c6;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m7 = z->l - z->c; (void)m7;
+        {   int m8 = z->l - z->c; (void)m8;
+            {   int m9 = z->l - z->c; (void)m9;
+                {   int m10 = z->l - z->c; (void)m10;
+                    z->ket = z->c;
+                    if (z->c - 2 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((823330 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((1146921530 >> (z->p[z->c - 2] & 0x1f)) & 1)) goto lab14;
+                    among_var = find_among_b_5(z);
+                    if (!(among_var)) goto lab14;
+                    z->bra = z->c;
+                    switch (among_var) {
+                        case 1:
+                            if (!(z->I[0] <= z->c)) goto lab14;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 2:
+                            if (!(z->I[0] <= z->c)) goto lab14;
+                            {   int ret = slice_from_s(z, 3, s_0);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 3:
+                            if (!(z->I[0] <= z->c)) goto lab14;
+                            {   int ret = slice_from_s(z, 1, s_1);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 4:
+                            if (!(z->I[0] <= z->c)) goto lab14;
+                            {   int ret = slice_from_s(z, 4, s_2);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 5:
+                            if (!(z->I[1] <= z->c)) goto lab14;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            {   int m11 = z->l - z->c; (void)m11;
+                                z->ket = z->c;
+                                if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((4718616 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] >> 5 != 3 || !((33282 >> (z->p[z->c - 2] & 0x1f)) & 1)) { z->c = z->l - m11; goto lab15; }
+                                among_var = find_among_b_2(z);
+                                if (!(among_var)) { z->c = z->l - m11; goto lab15; }
+                                z->bra = z->c;
+                                if (!(z->I[0] <= z->c)) { z->c = z->l - m11; goto lab15; }
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                switch (among_var) {
+                                    case 1:
+                                        z->ket = z->c;
+                                        if (!(eq_s_b(z, 2, s_3))) { z->c = z->l - m11; goto lab15; }
+                                        z->bra = z->c;
+                                        if (!(z->I[0] <= z->c)) { z->c = z->l - m11; goto lab15; }
+                                        {   int ret = slice_del(z);
+                                            if (ret < 0) return ret;
+                                        }
+                                        break;
+                                }
+                            lab15:
+                                ;
+                            }
+                            break;
+                        case 6:
+                            if (!(z->I[0] <= z->c)) goto lab14;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            {   int m12 = z->l - z->c; (void)m12;
+                                z->ket = z->c;
+                                if (z->c - 3 <= z->lb || (z->p[z->c - 1] != 101 && z->p[z->c - 1] != 108) || (z->p[z->c - 2] != 101 && z->p[z->c - 2] != 116)) { z->c = z->l - m12; goto lab16; }
+                                if (!(find_among_b_3(z))) { z->c = z->l - m12; goto lab16; }
+                                z->bra = z->c;
+                                if (!(z->I[0] <= z->c)) { z->c = z->l - m12; goto lab16; }
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                            lab16:
+                                ;
+                            }
+                            break;
+                        case 7:
+                            if (!(z->I[0] <= z->c)) goto lab14;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            {   int m13 = z->l - z->c; (void)m13;
+                                z->ket = z->c;
+                                if (z->c - 1 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((4198408 >> (z->p[z->c - 1] & 0x1f)) & 1) || z->p[z->c - 2] != 105) { z->c = z->l - m13; goto lab17; }
+                                if (!(find_among_b_4(z))) { z->c = z->l - m13; goto lab17; }
+                                z->bra = z->c;
+                                if (!(z->I[0] <= z->c)) { z->c = z->l - m13; goto lab17; }
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                            lab17:
+                                ;
+                            }
+                            break;
+                        case 8:
+                            if (!(z->I[0] <= z->c)) goto lab14;
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            {   int m14 = z->l - z->c; (void)m14;
+                                z->ket = z->c;
+                                if (!(eq_s_b(z, 2, s_4))) { z->c = z->l - m14; goto lab18; }
+                                z->bra = z->c;
+                                if (!(z->I[0] <= z->c)) { z->c = z->l - m14; goto lab18; }
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                            lab18:
+                                ;
+                            }
+                            break;
+                        case 9:
+                            if (!(z->I[2] <= z->c)) goto lab14;
+                            if (z->c <= z->lb || z->p[z->c - 1] != 'e') goto lab14;
+                            z->c--;
+                            {   int ret = slice_from_s(z, 2, s_5);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                    }
+                    goto lab13;
+                lab14:
+                    z->c = z->l - m10;
+
+                    {   int mlimit15;
+                        if (z->c < z->I[2]) goto lab12;
+                        mlimit15 = z->lb; z->lb = z->I[2];
+                        z->ket = z->c;
+                        if (z->c - 1 <= z->lb || z->p[z->c - 1] >= 0x100 || !((a_6_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1) || z->p[z->c - 2] >= 0x100 || !((a_6_filter1[z->p[z->c - 2] >> 3] >> (z->p[z->c - 2] & 7)) & 1)) { z->lb = mlimit15; goto lab12; }
+                        if (!(find_among_b_6(z))) { z->lb = mlimit15; goto lab12; }
+                        z->bra = z->c;
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        z->lb = mlimit15;
+                    }
+                }
+            lab13:
+                z->c = z->l - m9;
+                {   int m16 = z->l - z->c; (void)m16;
+                    z->ket = z->c;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'i') goto lab19;
+                    z->c--;
+                    z->bra = z->c;
+                    {   int m_test17 = z->l - z->c;
+                        if (z->c <= z->lb || z->p[z->c - 1] != 'c') goto lab19;
+                        z->c--;
+                        z->c = z->l - m_test17;
+                    }
+                    if (!(z->I[2] <= z->c)) goto lab19;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                lab19:
+                    z->c = z->l - m16;
+                }
+            }
+            goto lab11;
+        lab12:
+            z->c = z->l - m8;
+            z->ket = z->c;
+            if (z->c <= z->lb || z->p[z->c - 1] >= 0x100 || !((a_7_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1)) goto lab10;
+            if (!(find_among_b_7(z))) goto lab10;
+            z->bra = z->c;
+            if (!(z->I[2] <= z->c)) goto lab10;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        }
+    lab11:
+    lab10:
+        z->c = z->l - m7;
+    }
+    {   int m18 = z->l - z->c; (void)m18;
+        z->ket = z->c;
+        if (z->c <= z->lb || z->p[z->c - 1] >= 0x100 || !((a_8_filter0[z->p[z->c - 1] >> 3] >> (z->p[z->c - 1] & 7)) & 1)) goto lab20;
+        among_var = find_among_b_8(z);
+        if (!(among_var)) goto lab20;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                if (!(z->I[2] <= z->c)) goto lab20;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                z->ket = z->c;
+                {   int m19 = z->l - z->c; (void)m19;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'u') goto lab22;
+                    z->c--;
+                    z->bra = z->c;
+                    {   int m_test20 = z->l - z->c;
+                        if (z->c <= z->lb || z->p[z->c - 1] != 'g') goto lab22;
+                        z->c--;
+                        z->c = z->l - m_test20;
+                    }
+                    goto lab21;
+                lab22:
+                    z->c = z->l - m19;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 'i') goto lab20;
+                    z->c--;
+                    z->bra = z->c;
+                    {   int m_test21 = z->l - z->c;
+                        if (z->c <= z->lb || z->p[z->c - 1] != 'c') goto lab20;
+                        z->c--;
+                        z->c = z->l - m_test21;
+                    }
+                }
+            lab21:
+                if (!(z->I[2] <= z->c)) goto lab20;
+                {   int ret = slice_del(z);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 1, s_6);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab20:
+        z->c = z->l - m18;
+    }
+    z->c = z->lb;
+    {   int c22 = z->c;
+        while(1) {
+            int c23 = z->c;
+            z->bra = z->c;
+            if (z->c + 1 >= z->l || z->p[z->c + 1] != 126) among_var = 3; else
+            among_var = find_among_1(z);
+            if (!(among_var)) goto lab24;
+            z->ket = z->c;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_from_s(z, 1, s_7);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    {   int ret = slice_from_s(z, 1, s_8);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 3:
+                    if (z->c >= z->l) goto lab24;
+                    z->c++;
+                    break;
+            }
+            continue;
+        lab24:
+            z->c = c23;
+            break;
+        }
+        z->c = c22;
+    }
+    return 1;
+}
+
+extern struct SN_env * portuguese_UTF_8_create_env(void) { return SN_create_env(0, 3); }
+
+extern void portuguese_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
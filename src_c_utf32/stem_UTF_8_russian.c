@@ -0,0 +1,1187 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int russian_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * russian_UTF_8_create_env(void);
+extern void russian_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[9] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 2, 0, 2 },
+{ 0, 2, 0, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 3, 2 },
+{ 0, 4, 3, 2 },
+{ 0, 5, -1, 1 },
+{ 0, 6, 6, 2 },
+{ 0, 6, 6, 2 }
+};
+
+
+static const struct among a_1[26] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_2[8] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 2, 2 },
+{ 0, 3, 2, 2 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 5, 1 },
+{ 0, 3, 6, 2 }
+};
+
+
+static const struct among a_3[2] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 }
+};
+
+
+static const struct among a_4[46] =
+{
+{ 0, 2, -1, 1 },
+{ 0, 3, 0, 2 },
+{ 0, 3, 0, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 3, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 4, 7, 2 },
+{ 0, 4, 7, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 10, 2 },
+{ 0, 3, 10, 2 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 13, 2 },
+{ 0, 2, 13, 2 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 16, 2 },
+{ 0, 2, 16, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 22, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 24, 2 },
+{ 0, 3, 24, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 27, 2 },
+{ 0, 3, 27, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 30, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 34, 2 },
+{ 0, 2, -1, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 37, 2 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 39, 2 },
+{ 0, 3, 39, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 3, -1, 2 },
+{ 0, 1, -1, 2 },
+{ 0, 2, 44, 2 }
+};
+
+
+static const struct among a_5[36] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 3, 1 },
+{ 0, 2, 3, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 6, 1 },
+{ 0, 2, 6, 1 },
+{ 0, 3, 6, 1 },
+{ 0, 3, 6, 1 },
+{ 0, 4, 10, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 12, 1 },
+{ 0, 3, 13, 1 },
+{ 0, 2, 12, 1 },
+{ 0, 2, 12, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 18, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 21, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 3, 26, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 30, 1 },
+{ 0, 2, 30, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, 33, 1 },
+{ 0, 2, 33, 1 }
+};
+
+
+static const struct among a_6[2] =
+{
+{ 0, 3, -1, 1 },
+{ 0, 4, -1, 1 }
+};
+
+
+static const struct among a_7[4] =
+{
+{ 0, 4, -1, 1 },
+{ 0, 1, -1, 2 },
+{ 0, 3, -1, 1 },
+{ 0, 1, -1, 3 }
+};
+
+static const unsigned char g_v[] = { 33, 65, 8, 232 };
+
+static const symbol s_0[] = { 0x435 };
+
+static int find_among_b_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x432:
+                i = 0;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x438:
+                        i = 1;
+                        break;
+                    case 0x44B:
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0x438:
+                if (n <= 1) break;
+                if (q[-2] != 0x448) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x432) break;
+                i = 3;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 0x438:
+                        i = 4;
+                        break;
+                    case 0x44B:
+                        i = 5;
+                        break;
+                }
+                break;
+            case 0x44C:
+                if (n <= 1) break;
+                if (q[-2] != 0x441) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x438) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x448) break;
+                if (n <= 4) break;
+                if (q[-5] != 0x432) break;
+                i = 6;
+                if (n <= 5) break;
+                switch (q[-6]) {
+                    case 0x438:
+                        i = 7;
+                        break;
+                    case 0x44B:
+                        i = 8;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_0[i].s_size;
+    return a_0[i].result;
+}
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x44C:
+                if (n <= 1) break;
+                if (q[-2] != 0x441) break;
+                i = 0;
+                break;
+            case 0x44F:
+                if (n <= 1) break;
+                if (q[-2] != 0x441) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x435:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x435:
+                        i = 0;
+                        break;
+                    case 0x438:
+                        i = 1;
+                        break;
+                    case 0x43E:
+                        i = 2;
+                        break;
+                    case 0x44B:
+                        i = 3;
+                        break;
+                }
+                break;
+            case 0x438:
+                if (n <= 1) break;
+                if (q[-2] != 0x43C) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x438:
+                        i = 4;
+                        break;
+                    case 0x44B:
+                        i = 5;
+                        break;
+                }
+                break;
+            case 0x439:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x435:
+                        i = 6;
+                        break;
+                    case 0x438:
+                        i = 7;
+                        break;
+                    case 0x43E:
+                        i = 8;
+                        break;
+                    case 0x44B:
+                        i = 9;
+                        break;
+                }
+                break;
+            case 0x43C:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x435:
+                        i = 10;
+                        break;
+                    case 0x438:
+                        i = 11;
+                        break;
+                    case 0x43E:
+                        i = 12;
+                        break;
+                    case 0x44B:
+                        i = 13;
+                        break;
+                }
+                break;
+            case 0x43E:
+                if (n <= 1) break;
+                if (q[-2] != 0x433) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x435:
+                        i = 14;
+                        break;
+                    case 0x43E:
+                        i = 15;
+                        break;
+                }
+                break;
+            case 0x443:
+                if (n <= 1) break;
+                if (q[-2] != 0x43C) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x435:
+                        i = 16;
+                        break;
+                    case 0x43E:
+                        i = 17;
+                        break;
+                }
+                break;
+            case 0x445:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x438:
+                        i = 18;
+                        break;
+                    case 0x44B:
+                        i = 19;
+                        break;
+                }
+                break;
+            case 0x44E:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x435:
+                        i = 20;
+                        break;
+                    case 0x43E:
+                        i = 21;
+                        break;
+                    case 0x443:
+                        i = 22;
+                        break;
+                    case 0x44E:
+                        i = 23;
+                        break;
+                }
+                break;
+            case 0x44F:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x430:
+                        i = 24;
+                        break;
+                    case 0x44F:
+                        i = 25;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x43C:
+                if (n <= 1) break;
+                if (q[-2] != 0x435) break;
+                i = 0;
+                break;
+            case 0x43D:
+                if (n <= 1) break;
+                if (q[-2] != 0x43D) break;
+                i = 1;
+                break;
+            case 0x448:
+                if (n <= 1) break;
+                if (q[-2] != 0x432) break;
+                i = 2;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x438:
+                        i = 3;
+                        break;
+                    case 0x44B:
+                        i = 4;
+                        break;
+                }
+                break;
+            case 0x449:
+                i = 5;
+                if (n <= 1) break;
+                if (q[-2] != 0x44E) break;
+                i = 6;
+                if (n <= 2) break;
+                if (q[-3] != 0x443) break;
+                i = 7;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+
+static int find_among_b_4(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x430:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x43B:
+                        i = 0;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x438:
+                                i = 1;
+                                break;
+                            case 0x44B:
+                                i = 2;
+                                break;
+                        }
+                        break;
+                    case 0x43D:
+                        i = 3;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x435) break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 0x435:
+                if (n <= 1) break;
+                if (q[-2] != 0x442) break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x435:
+                        i = 5;
+                        break;
+                    case 0x438:
+                        i = 6;
+                        break;
+                    case 0x439:
+                        i = 7;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 0x435:
+                                i = 8;
+                                break;
+                            case 0x443:
+                                i = 9;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x438:
+                if (n <= 1) break;
+                if (q[-2] != 0x43B) break;
+                i = 10;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 0x438:
+                        i = 11;
+                        break;
+                    case 0x44B:
+                        i = 12;
+                        break;
+                }
+                break;
+            case 0x439:
+                i = 13;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x435:
+                        i = 14;
+                        break;
+                    case 0x443:
+                        i = 15;
+                        break;
+                }
+                break;
+            case 0x43B:
+                i = 16;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x438:
+                        i = 17;
+                        break;
+                    case 0x44B:
+                        i = 18;
+                        break;
+                }
+                break;
+            case 0x43C:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x435:
+                        i = 19;
+                        break;
+                    case 0x438:
+                        i = 20;
+                        break;
+                    case 0x44B:
+                        i = 21;
+                        break;
+                }
+                break;
+            case 0x43D:
+                i = 22;
+                if (n <= 1) break;
+                if (q[-2] != 0x435) break;
+                i = 23;
+                break;
+            case 0x43E:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x43B:
+                        i = 24;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x438:
+                                i = 25;
+                                break;
+                            case 0x44B:
+                                i = 26;
+                                break;
+                        }
+                        break;
+                    case 0x43D:
+                        i = 27;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x435:
+                                i = 28;
+                                break;
+                            case 0x43D:
+                                i = 29;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x442:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x435:
+                        i = 30;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x443) break;
+                        i = 31;
+                        break;
+                    case 0x438:
+                        i = 32;
+                        break;
+                    case 0x44B:
+                        i = 33;
+                        break;
+                    case 0x44E:
+                        i = 34;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x443) break;
+                        i = 35;
+                        break;
+                    case 0x44F:
+                        i = 36;
+                        break;
+                }
+                break;
+            case 0x44B:
+                if (n <= 1) break;
+                if (q[-2] != 0x43D) break;
+                i = 37;
+                if (n <= 2) break;
+                if (q[-3] != 0x435) break;
+                i = 38;
+                break;
+            case 0x44C:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x442:
+                        i = 39;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x438:
+                                i = 40;
+                                break;
+                            case 0x44B:
+                                i = 41;
+                                break;
+                        }
+                        break;
+                    case 0x448:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x435:
+                                i = 42;
+                                break;
+                            case 0x438:
+                                i = 43;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x44E:
+                i = 44;
+                if (n <= 1) break;
+                if (q[-2] != 0x443) break;
+                i = 45;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_4[i].s_size;
+    return a_4[i].result;
+}
+
+static int find_among_b_5(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x430:
+                i = 0;
+                break;
+            case 0x432:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x435:
+                        i = 1;
+                        break;
+                    case 0x43E:
+                        i = 2;
+                        break;
+                }
+                break;
+            case 0x435:
+                i = 3;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x438:
+                        i = 4;
+                        break;
+                    case 0x44C:
+                        i = 5;
+                        break;
+                }
+                break;
+            case 0x438:
+                i = 6;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x435:
+                        i = 7;
+                        break;
+                    case 0x438:
+                        i = 8;
+                        break;
+                    case 0x43C:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 0x430:
+                                i = 9;
+                                break;
+                            case 0x44F:
+                                i = 10;
+                                if (n <= 3) break;
+                                if (q[-4] != 0x438) break;
+                                i = 11;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 0x439:
+                i = 12;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x435:
+                        i = 13;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x438) break;
+                        i = 14;
+                        break;
+                    case 0x438:
+                        i = 15;
+                        break;
+                    case 0x43E:
+                        i = 16;
+                        break;
+                }
+                break;
+            case 0x43C:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x430:
+                        i = 17;
+                        break;
+                    case 0x435:
+                        i = 18;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x438) break;
+                        i = 19;
+                        break;
+                    case 0x43E:
+                        i = 20;
+                        break;
+                    case 0x44F:
+                        i = 21;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x438) break;
+                        i = 22;
+                        break;
+                }
+                break;
+            case 0x43E:
+                i = 23;
+                break;
+            case 0x443:
+                i = 24;
+                break;
+            case 0x445:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x430:
+                        i = 25;
+                        break;
+                    case 0x44F:
+                        i = 26;
+                        if (n <= 2) break;
+                        if (q[-3] != 0x438) break;
+                        i = 27;
+                        break;
+                }
+                break;
+            case 0x44B:
+                i = 28;
+                break;
+            case 0x44C:
+                i = 29;
+                break;
+            case 0x44E:
+                i = 30;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x438:
+                        i = 31;
+                        break;
+                    case 0x44C:
+                        i = 32;
+                        break;
+                }
+                break;
+            case 0x44F:
+                i = 33;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 0x438:
+                        i = 34;
+                        break;
+                    case 0x44C:
+                        i = 35;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_5[i].s_size;
+    return a_5[i].result;
+}
+
+static int find_among_b_6(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x442:
+                if (n <= 1) break;
+                if (q[-2] != 0x441) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x43E) break;
+                i = 0;
+                break;
+            case 0x44C:
+                if (n <= 1) break;
+                if (q[-2] != 0x442) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x441) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x43E) break;
+                i = 1;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_6[i].s_size;
+    return a_6[i].result;
+}
+
+static int find_among_b_7(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 0x435:
+                if (n <= 1) break;
+                if (q[-2] != 0x448) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x439) break;
+                if (n <= 3) break;
+                if (q[-4] != 0x435) break;
+                i = 0;
+                break;
+            case 0x43D:
+                i = 1;
+                break;
+            case 0x448:
+                if (n <= 1) break;
+                if (q[-2] != 0x439) break;
+                if (n <= 2) break;
+                if (q[-3] != 0x435) break;
+                i = 2;
+                break;
+            case 0x44C:
+                i = 3;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_7[i].s_size;
+    return a_7[i].result;
+}
+
+extern int russian_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    {   int c1 = z->c;
+        while(1) {
+            int c2 = z->c;
+            while(1) {
+                int c3 = z->c;
+                z->bra = z->c;
+                if (z->c == z->l || z->p[z->c] != 0x451) goto lab2;
+                z->c++;
+                z->ket = z->c;
+                z->c = c3;
+                break;
+            lab2:
+                z->c = c3;
+                if (z->c >= z->l) goto lab1;
+                z->c++;
+            }
+            {   int ret = slice_from_s(z, 1, s_0);
+                if (ret < 0) return ret;
+            }
+            continue;
+        lab1:
+            z->c = c2;
+            break;
+        }
+        z->c = c1;
+    }
+    
+    z->I[1] = z->l;
+    z->I[0] = z->l;
+    {   int c4 = z->c;
+        {   
+            int ret = out_grouping(z, g_v, 1072, 1103, 1);
+            if (ret < 0) goto lab4;
+            z->c += ret;
+        }
+        z->I[1] = z->c;
+        {   
+            int ret = in_grouping(z, g_v, 1072, 1103, 1);
+            if (ret < 0) goto lab4;
+            z->c += ret;
+        }
+        {   
+            int ret = out_grouping(z, g_v, 1072, 1103, 1);
+            if (ret < 0) goto lab4;
+            z->c += ret;
+        }
+        {   
+            int ret = in_grouping(z, g_v, 1072, 1103, 1);
+            if (ret < 0) goto lab4;
+            z->c += ret;
+        }
+        z->I[0] = z->c;
+    lab4:
+        z->c = c4;
+    }
+    z->lb = z->c; z->c = z->l;
+
+
+    {   int mlimit5;
+        if (z->c < z->I[1]) return 0;
+        mlimit5 = z->lb; z->lb = z->I[1];
+        {   int m6 = z->l - z->c; (void)m6;
+            {   int m7 = z->l - z->c; (void)m7;
+                z->ket = z->c;
+                if (z->c <= z->lb) goto lab7;
+                among_var = find_among_b_0(z);
+                if (!(among_var)) goto lab7;
+                z->bra = z->c;
+                switch (among_var) {
+                    case 1:
+                        {   int m8 = z->l - z->c; (void)m8;
+                            if (z->c <= z->lb || z->p[z->c - 1] != 0x430) goto lab9;
+                            z->c--;
+                            goto lab8;
+                        lab9:
+                            z->c = z->l - m8;
+                            if (z->c <= z->lb || z->p[z->c - 1] != 0x44F) goto lab7;
+                            z->c--;
+                        }
+                    lab8:
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        {   int ret = slice_del(z);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+                goto lab6;
+            lab7:
+                z->c = z->l - m7;
+                {   int m9 = z->l - z->c; (void)m9;
+                    z->ket = z->c;
+                    if (z->c - 1 <= z->lb || (z->p[z->c - 1] != 1100 && z->p[z->c - 1] != 1103) || z->p[z->c - 2] != 1089) { z->c = z->l - m9; goto lab10; }
+                    if (!(find_among_b_3(z))) { z->c = z->l - m9; goto lab10; }
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                lab10:
+                    ;
+                }
+                {   int m10 = z->l - z->c; (void)m10;
+                    z->ket = z->c;
+                    if (z->c - 1 <= z->lb) goto lab12;
+                    if (!(find_among_b_1(z))) goto lab12;
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    {   int m11 = z->l - z->c; (void)m11;
+                        z->ket = z->c;
+                        if (z->c <= z->lb) { z->c = z->l - m11; goto lab13; }
+                        among_var = find_among_b_2(z);
+                        if (!(among_var)) { z->c = z->l - m11; goto lab13; }
+                        z->bra = z->c;
+                        switch (among_var) {
+                            case 1:
+                                {   int m12 = z->l - z->c; (void)m12;
+                                    if (z->c <= z->lb || z->p[z->c - 1] != 0x430) goto lab15;
+                                    z->c--;
+                                    goto lab14;
+                                lab15:
+                                    z->c = z->l - m12;
+                                    if (z->c <= z->lb || z->p[z->c - 1] != 0x44F) { z->c = z->l - m11; goto lab13; }
+                                    z->c--;
+                                }
+                            lab14:
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                break;
+                            case 2:
+                                {   int ret = slice_del(z);
+                                    if (ret < 0) return ret;
+                                }
+                                break;
+                        }
+                    lab13:
+                        ;
+                    }
+                    goto lab11;
+                lab12:
+                    z->c = z->l - m10;
+                    z->ket = z->c;
+                    if (z->c <= z->lb) goto lab16;
+                    among_var = find_among_b_4(z);
+                    if (!(among_var)) goto lab16;
+                    z->bra = z->c;
+                    switch (among_var) {
+                        case 1:
+                            {   int m13 = z->l - z->c; (void)m13;
+                                if (z->c <= z->lb || z->p[z->c - 1] != 0x430) goto lab18;
+                                z->c--;
+                                goto lab17;
+                            lab18:
+                                z->c = z->l - m13;
+                                if (z->c <= z->lb || z->p[z->c - 1] != 0x44F) goto lab16;
+                                z->c--;
+                            }
+                        lab17:
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                        case 2:
+                            {   int ret = slice_del(z);
+                                if (ret < 0) return ret;
+                            }
+                            break;
+                    }
+                    goto lab11;
+                lab16:
+                    z->c = z->l - m10;
+                    z->ket = z->c;
+                    if (z->c <= z->lb) goto lab5;
+                    if (!(find_among_b_5(z))) goto lab5;
+                    z->bra = z->c;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                }
+            lab11:
+                ;
+            }
+        lab6:
+        lab5:
+            z->c = z->l - m6;
+        }
+        {   int m14 = z->l - z->c; (void)m14;
+            z->ket = z->c;
+            if (z->c <= z->lb || z->p[z->c - 1] != 0x438) { z->c = z->l - m14; goto lab19; }
+            z->c--;
+            z->bra = z->c;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        lab19:
+            ;
+        }
+        {   int m15 = z->l - z->c; (void)m15;
+            z->ket = z->c;
+            if (z->c - 2 <= z->lb || (z->p[z->c - 1] != 1090 && z->p[z->c - 1] != 1100) || (z->p[z->c - 2] != 1089 && z->p[z->c - 2] != 1090)) goto lab20;
+            if (!(find_among_b_6(z))) goto lab20;
+            z->bra = z->c;
+            if (!(z->I[0] <= z->c)) goto lab20;
+            {   int ret = slice_del(z);
+                if (ret < 0) return ret;
+            }
+        lab20:
+            z->c = z->l - m15;
+        }
+        {   int m16 = z->l - z->c; (void)m16;
+            z->ket = z->c;
+            if (z->c <= z->lb) goto lab21;
+            among_var = find_among_b_7(z);
+            if (!(among_var)) goto lab21;
+            z->bra = z->c;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    z->ket = z->c;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 0x43D) goto lab21;
+                    z->c--;
+                    z->bra = z->c;
+                    if (z->c <= z->lb || z->p[z->c - 1] != 0x43D) goto lab21;
+                    z->c--;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    if (z->c <= z->lb || z->p[z->c - 1] != 0x43D) goto lab21;
+                    z->c--;
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 3:
+                    {   int ret = slice_del(z);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+        lab21:
+            z->c = z->l - m16;
+        }
+        z->lb = mlimit5;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * russian_UTF_8_create_env(void) { return SN_create_env(0, 2); }
+
+extern void russian_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
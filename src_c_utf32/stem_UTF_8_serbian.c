@@ -0,0 +1,15361 @@
+/* Generated by Snowball 2.2.0 - https://snowballstem.org/ */
+
+#include "../runtime/header.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern int serbian_UTF_8_stem(struct SN_env * z);
+#ifdef __cplusplus
+}
+#endif
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+extern struct SN_env * serbian_UTF_8_create_env(void);
+extern void serbian_UTF_8_close_env(struct SN_env * z);
+
+
+#ifdef __cplusplus
+}
+#endif
+
+static const struct among a_0[30] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 1, -1, 2 },
+{ 0, 1, -1, 3 },
+{ 0, 1, -1, 4 },
+{ 0, 1, -1, 5 },
+{ 0, 1, -1, 7 },
+{ 0, 1, -1, 8 },
+{ 0, 1, -1, 9 },
+{ 0, 1, -1, 10 },
+{ 0, 1, -1, 12 },
+{ 0, 1, -1, 13 },
+{ 0, 1, -1, 15 },
+{ 0, 1, -1, 16 },
+{ 0, 1, -1, 18 },
+{ 0, 1, -1, 19 },
+{ 0, 1, -1, 20 },
+{ 0, 1, -1, 21 },
+{ 0, 1, -1, 22 },
+{ 0, 1, -1, 24 },
+{ 0, 1, -1, 25 },
+{ 0, 1, -1, 26 },
+{ 0, 1, -1, 27 },
+{ 0, 1, -1, 28 },
+{ 0, 1, -1, 30 },
+{ 0, 1, -1, 6 },
+{ 0, 1, -1, 11 },
+{ 0, 1, -1, 14 },
+{ 0, 1, -1, 17 },
+{ 0, 1, -1, 23 },
+{ 0, 1, -1, 29 }
+};
+
+
+static const struct among a_1[130] =
+{
+{ 0, 4, -1, 73 },
+{ 0, 5, -1, 12 },
+{ 0, 5, -1, 14 },
+{ 0, 5, -1, 13 },
+{ 0, 5, -1, 85 },
+{ 0, 5, -1, 15 },
+{ 0, 5, -1, 82 },
+{ 0, 5, -1, 83 },
+{ 0, 5, -1, 84 },
+{ 0, 4, -1, 75 },
+{ 0, 4, -1, 76 },
+{ 0, 4, -1, 81 },
+{ 0, 4, -1, 80 },
+{ 0, 4, -1, 79 },
+{ 0, 4, -1, 18 },
+{ 0, 4, -1, 82 },
+{ 0, 5, -1, 55 },
+{ 0, 5, -1, 16 },
+{ 0, 5, -1, 17 },
+{ 0, 5, -1, 78 },
+{ 0, 5, -1, 58 },
+{ 0, 5, -1, 59 },
+{ 0, 5, -1, 60 },
+{ 0, 5, -1, 61 },
+{ 0, 5, -1, 62 },
+{ 0, 5, -1, 54 },
+{ 0, 5, -1, 67 },
+{ 0, 5, -1, 87 },
+{ 0, 6, -1, 5 },
+{ 0, 6, -1, 23 },
+{ 0, 6, -1, 24 },
+{ 0, 8, 30, 21 },
+{ 0, 6, -1, 25 },
+{ 0, 6, -1, 58 },
+{ 0, 6, -1, 62 },
+{ 0, 5, -1, 74 },
+{ 0, 6, -1, 2 },
+{ 0, 6, -1, 19 },
+{ 0, 6, -1, 1 },
+{ 0, 6, -1, 68 },
+{ 0, 7, -1, 69 },
+{ 0, 6, -1, 70 },
+{ 0, 5, -1, 86 },
+{ 0, 5, -1, 53 },
+{ 0, 6, -1, 22 },
+{ 0, 7, -1, 29 },
+{ 0, 4, -1, 12 },
+{ 0, 4, -1, 14 },
+{ 0, 4, -1, 13 },
+{ 0, 4, -1, 85 },
+{ 0, 5, 49, 11 },
+{ 0, 4, -1, 15 },
+{ 0, 4, -1, 82 },
+{ 0, 4, -1, 83 },
+{ 0, 4, -1, 84 },
+{ 0, 3, -1, 75 },
+{ 0, 3, -1, 76 },
+{ 0, 3, -1, 81 },
+{ 0, 3, -1, 80 },
+{ 0, 3, -1, 79 },
+{ 0, 3, -1, 18 },
+{ 0, 4, -1, 88 },
+{ 0, 4, -1, 84 },
+{ 0, 4, -1, 27 },
+{ 0, 4, -1, 42 },
+{ 0, 4, -1, 52 },
+{ 0, 4, -1, 51 },
+{ 0, 4, -1, 89 },
+{ 0, 4, -1, 5 },
+{ 0, 7, -1, 20 },
+{ 0, 5, -1, 26 },
+{ 0, 6, -1, 21 },
+{ 0, 5, -1, 4 },
+{ 0, 5, -1, 3 },
+{ 0, 5, -1, 66 },
+{ 0, 4, -1, 58 },
+{ 0, 4, -1, 60 },
+{ 0, 4, -1, 62 },
+{ 0, 3, -1, 74 },
+{ 0, 4, -1, 2 },
+{ 0, 4, -1, 19 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 55 },
+{ 0, 4, -1, 57 },
+{ 0, 4, -1, 58 },
+{ 0, 4, -1, 59 },
+{ 0, 4, -1, 60 },
+{ 0, 4, -1, 61 },
+{ 0, 4, -1, 62 },
+{ 0, 4, -1, 54 },
+{ 0, 4, -1, 56 },
+{ 0, 4, -1, 87 },
+{ 0, 5, -1, 65 },
+{ 0, 5, -1, 7 },
+{ 0, 5, -1, 6 },
+{ 0, 6, -1, 77 },
+{ 0, 5, -1, 63 },
+{ 0, 4, -1, 40 },
+{ 0, 5, -1, 33 },
+{ 0, 5, -1, 37 },
+{ 0, 5, -1, 39 },
+{ 0, 5, -1, 38 },
+{ 0, 5, -1, 36 },
+{ 0, 5, -1, 34 },
+{ 0, 6, -1, 35 },
+{ 0, 5, -1, 9 },
+{ 0, 4, -1, 8 },
+{ 0, 4, -1, 91 },
+{ 0, 4, -1, 10 },
+{ 0, 5, -1, 31 },
+{ 0, 5, -1, 28 },
+{ 0, 4, -1, 47 },
+{ 0, 6, -1, 50 },
+{ 0, 5, -1, 49 },
+{ 0, 5, -1, 32 },
+{ 0, 6, -1, 44 },
+{ 0, 6, -1, 43 },
+{ 0, 5, -1, 46 },
+{ 0, 5, -1, 45 },
+{ 0, 4, -1, 41 },
+{ 0, 5, -1, 64 },
+{ 0, 4, -1, 90 },
+{ 0, 5, -1, 30 },
+{ 0, 5, -1, 68 },
+{ 0, 6, -1, 69 },
+{ 0, 5, -1, 70 },
+{ 0, 4, -1, 86 },
+{ 0, 4, -1, 48 },
+{ 0, 4, -1, 72 },
+{ 0, 4, -1, 71 }
+};
+
+
+static const struct among a_2[2035] =
+{
+{ 0, 3, -1, 124 },
+{ 0, 3, -1, 125 },
+{ 0, 3, -1, 126 },
+{ 0, 2, -1, 20 },
+{ 0, 5, 3, 124 },
+{ 0, 5, 3, 125 },
+{ 0, 5, 3, 126 },
+{ 0, 8, 3, 84 },
+{ 0, 8, 3, 85 },
+{ 0, 8, 3, 122 },
+{ 0, 8, 3, 86 },
+{ 0, 6, 3, 95 },
+{ 0, 7, 11, 1 },
+{ 0, 7, 11, 2 },
+{ 0, 7, 3, 83 },
+{ 0, 6, 3, 13 },
+{ 0, 7, 3, 123 },
+{ 0, 7, 3, 120 },
+{ 0, 9, 3, 92 },
+{ 0, 9, 3, 93 },
+{ 0, 8, 3, 94 },
+{ 0, 7, 3, 77 },
+{ 0, 7, 3, 78 },
+{ 0, 7, 3, 79 },
+{ 0, 7, 3, 80 },
+{ 0, 7, 3, 91 },
+{ 0, 6, 3, 84 },
+{ 0, 6, 3, 85 },
+{ 0, 6, 3, 122 },
+{ 0, 6, 3, 86 },
+{ 0, 4, 3, 95 },
+{ 0, 5, 30, 1 },
+{ 0, 5, 30, 2 },
+{ 0, 5, 3, 83 },
+{ 0, 4, 3, 13 },
+{ 0, 5, 34, 10 },
+{ 0, 5, 34, 87 },
+{ 0, 5, 34, 159 },
+{ 0, 5, 34, 88 },
+{ 0, 5, 3, 123 },
+{ 0, 5, 3, 120 },
+{ 0, 7, 3, 92 },
+{ 0, 7, 3, 93 },
+{ 0, 6, 3, 94 },
+{ 0, 5, 3, 77 },
+{ 0, 5, 3, 78 },
+{ 0, 5, 3, 79 },
+{ 0, 5, 3, 80 },
+{ 0, 5, 3, 14 },
+{ 0, 5, 3, 15 },
+{ 0, 5, 3, 16 },
+{ 0, 5, 3, 91 },
+{ 0, 5, 3, 124 },
+{ 0, 5, 3, 125 },
+{ 0, 5, 3, 126 },
+{ 0, 6, 3, 84 },
+{ 0, 6, 3, 85 },
+{ 0, 6, 3, 122 },
+{ 0, 6, 3, 86 },
+{ 0, 4, 3, 95 },
+{ 0, 5, 59, 1 },
+{ 0, 5, 59, 2 },
+{ 0, 4, 3, 19 },
+{ 0, 5, 62, 83 },
+{ 0, 4, 3, 13 },
+{ 0, 6, 64, 137 },
+{ 0, 6, 64, 89 },
+{ 0, 5, 3, 123 },
+{ 0, 5, 3, 120 },
+{ 0, 7, 3, 92 },
+{ 0, 7, 3, 93 },
+{ 0, 6, 3, 94 },
+{ 0, 5, 3, 77 },
+{ 0, 5, 3, 78 },
+{ 0, 5, 3, 79 },
+{ 0, 5, 3, 80 },
+{ 0, 5, 3, 14 },
+{ 0, 5, 3, 15 },
+{ 0, 5, 3, 16 },
+{ 0, 5, 3, 91 },
+{ 0, 3, 3, 18 },
+{ 0, 3, -1, 109 },
+{ 0, 4, 81, 26 },
+{ 0, 4, 81, 30 },
+{ 0, 4, 81, 31 },
+{ 0, 4, 81, 28 },
+{ 0, 4, 81, 27 },
+{ 0, 4, 81, 29 },
+{ 0, 4, -1, 32 },
+{ 0, 4, -1, 33 },
+{ 0, 4, -1, 34 },
+{ 0, 4, -1, 40 },
+{ 0, 4, -1, 39 },
+{ 0, 6, -1, 84 },
+{ 0, 6, -1, 85 },
+{ 0, 6, -1, 122 },
+{ 0, 6, -1, 86 },
+{ 0, 4, -1, 95 },
+{ 0, 5, 97, 1 },
+{ 0, 5, 97, 2 },
+{ 0, 4, -1, 24 },
+{ 0, 5, 100, 83 },
+{ 0, 4, -1, 37 },
+{ 0, 4, -1, 13 },
+{ 0, 6, 103, 9 },
+{ 0, 6, 103, 6 },
+{ 0, 6, 103, 7 },
+{ 0, 6, 103, 8 },
+{ 0, 6, 103, 5 },
+{ 0, 4, -1, 41 },
+{ 0, 4, -1, 42 },
+{ 0, 6, 110, 21 },
+{ 0, 4, -1, 23 },
+{ 0, 5, 112, 123 },
+{ 0, 4, -1, 44 },
+{ 0, 5, 114, 120 },
+{ 0, 7, 114, 92 },
+{ 0, 7, 114, 93 },
+{ 0, 5, 114, 22 },
+{ 0, 6, 114, 94 },
+{ 0, 5, -1, 77 },
+{ 0, 5, -1, 78 },
+{ 0, 5, -1, 79 },
+{ 0, 5, -1, 80 },
+{ 0, 4, -1, 45 },
+{ 0, 5, -1, 91 },
+{ 0, 4, -1, 38 },
+{ 0, 4, -1, 84 },
+{ 0, 4, -1, 85 },
+{ 0, 4, -1, 122 },
+{ 0, 4, -1, 86 },
+{ 0, 2, -1, 95 },
+{ 0, 3, 131, 1 },
+{ 0, 3, 131, 2 },
+{ 0, 3, -1, 104 },
+{ 0, 5, 134, 128 },
+{ 0, 8, 134, 106 },
+{ 0, 8, 134, 107 },
+{ 0, 8, 134, 108 },
+{ 0, 5, 134, 47 },
+{ 0, 6, 134, 114 },
+{ 0, 4, 134, 46 },
+{ 0, 5, 134, 100 },
+{ 0, 5, 134, 105 },
+{ 0, 4, 134, 113 },
+{ 0, 6, 144, 110 },
+{ 0, 6, 144, 111 },
+{ 0, 6, 144, 112 },
+{ 0, 5, 134, 97 },
+{ 0, 5, 134, 96 },
+{ 0, 5, 134, 98 },
+{ 0, 5, 134, 76 },
+{ 0, 5, 134, 99 },
+{ 0, 5, 134, 102 },
+{ 0, 3, -1, 83 },
+{ 0, 3, -1, 116 },
+{ 0, 5, 155, 124 },
+{ 0, 6, 155, 121 },
+{ 0, 4, 155, 103 },
+{ 0, 8, 158, 110 },
+{ 0, 8, 158, 111 },
+{ 0, 8, 158, 112 },
+{ 0, 6, 155, 127 },
+{ 0, 6, 155, 118 },
+{ 0, 5, 155, 48 },
+{ 0, 5, 155, 101 },
+{ 0, 6, 155, 117 },
+{ 0, 6, 155, 90 },
+{ 0, 3, -1, 50 },
+{ 0, 4, -1, 115 },
+{ 0, 4, -1, 13 },
+{ 0, 4, -1, 20 },
+{ 0, 6, 171, 19 },
+{ 0, 5, 171, 18 },
+{ 0, 5, -1, 109 },
+{ 0, 6, 174, 26 },
+{ 0, 6, 174, 30 },
+{ 0, 6, 174, 31 },
+{ 0, 6, 174, 28 },
+{ 0, 6, 174, 27 },
+{ 0, 6, 174, 29 },
+{ 0, 6, -1, 32 },
+{ 0, 6, -1, 33 },
+{ 0, 6, -1, 34 },
+{ 0, 6, -1, 40 },
+{ 0, 6, -1, 39 },
+{ 0, 6, -1, 35 },
+{ 0, 6, -1, 37 },
+{ 0, 6, -1, 36 },
+{ 0, 8, 188, 9 },
+{ 0, 8, 188, 6 },
+{ 0, 8, 188, 7 },
+{ 0, 8, 188, 8 },
+{ 0, 8, 188, 5 },
+{ 0, 6, -1, 41 },
+{ 0, 6, -1, 42 },
+{ 0, 6, -1, 43 },
+{ 0, 6, -1, 44 },
+{ 0, 6, -1, 45 },
+{ 0, 6, -1, 38 },
+{ 0, 5, -1, 104 },
+{ 0, 7, 200, 47 },
+{ 0, 6, 200, 46 },
+{ 0, 5, -1, 119 },
+{ 0, 5, -1, 116 },
+{ 0, 6, -1, 52 },
+{ 0, 6, -1, 51 },
+{ 0, 5, -1, 11 },
+{ 0, 6, 207, 137 },
+{ 0, 6, 207, 89 },
+{ 0, 4, -1, 52 },
+{ 0, 5, 210, 53 },
+{ 0, 5, 210, 54 },
+{ 0, 5, 210, 55 },
+{ 0, 5, 210, 56 },
+{ 0, 6, -1, 135 },
+{ 0, 6, -1, 131 },
+{ 0, 6, -1, 129 },
+{ 0, 6, -1, 133 },
+{ 0, 6, -1, 132 },
+{ 0, 6, -1, 130 },
+{ 0, 6, -1, 134 },
+{ 0, 5, -1, 152 },
+{ 0, 5, -1, 154 },
+{ 0, 5, -1, 70 },
+{ 0, 6, -1, 71 },
+{ 0, 6, -1, 72 },
+{ 0, 6, -1, 73 },
+{ 0, 6, -1, 74 },
+{ 0, 5, -1, 77 },
+{ 0, 5, -1, 78 },
+{ 0, 5, -1, 79 },
+{ 0, 6, -1, 63 },
+{ 0, 6, -1, 64 },
+{ 0, 6, -1, 61 },
+{ 0, 6, -1, 62 },
+{ 0, 6, -1, 60 },
+{ 0, 6, -1, 59 },
+{ 0, 6, -1, 65 },
+{ 0, 5, -1, 66 },
+{ 0, 5, -1, 67 },
+{ 0, 4, -1, 51 },
+{ 0, 5, -1, 124 },
+{ 0, 5, -1, 125 },
+{ 0, 5, -1, 126 },
+{ 0, 5, -1, 109 },
+{ 0, 6, 245, 26 },
+{ 0, 6, 245, 30 },
+{ 0, 6, 245, 31 },
+{ 0, 6, 245, 28 },
+{ 0, 6, 245, 27 },
+{ 0, 6, 245, 29 },
+{ 0, 6, -1, 32 },
+{ 0, 6, -1, 33 },
+{ 0, 6, -1, 34 },
+{ 0, 6, -1, 40 },
+{ 0, 6, -1, 39 },
+{ 0, 8, -1, 84 },
+{ 0, 8, -1, 85 },
+{ 0, 8, -1, 122 },
+{ 0, 8, -1, 86 },
+{ 0, 6, -1, 95 },
+{ 0, 7, 261, 1 },
+{ 0, 7, 261, 2 },
+{ 0, 6, -1, 35 },
+{ 0, 7, 264, 83 },
+{ 0, 6, -1, 37 },
+{ 0, 6, -1, 13 },
+{ 0, 8, 267, 9 },
+{ 0, 8, 267, 6 },
+{ 0, 8, 267, 7 },
+{ 0, 8, 267, 8 },
+{ 0, 8, 267, 5 },
+{ 0, 6, -1, 41 },
+{ 0, 6, -1, 42 },
+{ 0, 6, -1, 43 },
+{ 0, 7, 275, 123 },
+{ 0, 6, -1, 44 },
+{ 0, 7, 277, 120 },
+{ 0, 9, 277, 92 },
+{ 0, 9, 277, 93 },
+{ 0, 8, 277, 94 },
+{ 0, 7, -1, 77 },
+{ 0, 7, -1, 78 },
+{ 0, 7, -1, 79 },
+{ 0, 7, -1, 80 },
+{ 0, 6, -1, 45 },
+{ 0, 7, -1, 91 },
+{ 0, 6, -1, 38 },
+{ 0, 6, -1, 84 },
+{ 0, 6, -1, 85 },
+{ 0, 6, -1, 122 },
+{ 0, 6, -1, 86 },
+{ 0, 4, -1, 95 },
+{ 0, 5, 293, 1 },
+{ 0, 5, 293, 2 },
+{ 0, 5, -1, 104 },
+{ 0, 7, 296, 47 },
+{ 0, 6, 296, 46 },
+{ 0, 5, -1, 83 },
+{ 0, 5, -1, 116 },
+{ 0, 7, 300, 48 },
+{ 0, 5, -1, 50 },
+{ 0, 6, -1, 51 },
+{ 0, 4, -1, 13 },
+{ 0, 5, 304, 10 },
+{ 0, 5, 304, 11 },
+{ 0, 6, 306, 137 },
+{ 0, 6, 306, 89 },
+{ 0, 5, 304, 12 },
+{ 0, 5, -1, 53 },
+{ 0, 5, -1, 54 },
+{ 0, 5, -1, 55 },
+{ 0, 5, -1, 56 },
+{ 0, 6, -1, 135 },
+{ 0, 6, -1, 131 },
+{ 0, 6, -1, 129 },
+{ 0, 6, -1, 133 },
+{ 0, 6, -1, 132 },
+{ 0, 6, -1, 130 },
+{ 0, 6, -1, 134 },
+{ 0, 5, -1, 57 },
+{ 0, 5, -1, 58 },
+{ 0, 5, -1, 123 },
+{ 0, 5, -1, 120 },
+{ 0, 7, 324, 68 },
+{ 0, 6, 324, 69 },
+{ 0, 5, -1, 70 },
+{ 0, 7, -1, 92 },
+{ 0, 7, -1, 93 },
+{ 0, 6, -1, 94 },
+{ 0, 6, -1, 71 },
+{ 0, 6, -1, 72 },
+{ 0, 6, -1, 73 },
+{ 0, 6, -1, 74 },
+{ 0, 6, -1, 75 },
+{ 0, 5, -1, 77 },
+{ 0, 5, -1, 78 },
+{ 0, 7, 337, 109 },
+{ 0, 8, 338, 26 },
+{ 0, 8, 338, 30 },
+{ 0, 8, 338, 31 },
+{ 0, 8, 338, 28 },
+{ 0, 8, 338, 27 },
+{ 0, 8, 338, 29 },
+{ 0, 5, -1, 79 },
+{ 0, 5, -1, 80 },
+{ 0, 6, 346, 20 },
+{ 0, 7, 347, 17 },
+{ 0, 6, 346, 82 },
+{ 0, 7, 349, 49 },
+{ 0, 6, 346, 81 },
+{ 0, 7, 346, 12 },
+{ 0, 6, -1, 3 },
+{ 0, 6, -1, 4 },
+{ 0, 5, -1, 14 },
+{ 0, 5, -1, 15 },
+{ 0, 5, -1, 16 },
+{ 0, 6, -1, 63 },
+{ 0, 6, -1, 64 },
+{ 0, 6, -1, 61 },
+{ 0, 6, -1, 62 },
+{ 0, 6, -1, 60 },
+{ 0, 6, -1, 59 },
+{ 0, 6, -1, 65 },
+{ 0, 5, -1, 66 },
+{ 0, 5, -1, 67 },
+{ 0, 5, -1, 91 },
+{ 0, 2, -1, 13 },
+{ 0, 3, 368, 10 },
+{ 0, 5, 369, 128 },
+{ 0, 5, 369, 105 },
+{ 0, 4, 369, 113 },
+{ 0, 5, 369, 97 },
+{ 0, 5, 369, 96 },
+{ 0, 5, 369, 98 },
+{ 0, 5, 369, 99 },
+{ 0, 5, 369, 102 },
+{ 0, 5, 368, 124 },
+{ 0, 6, 368, 121 },
+{ 0, 5, 368, 101 },
+{ 0, 6, 368, 117 },
+{ 0, 3, 368, 11 },
+{ 0, 4, 382, 137 },
+{ 0, 5, 382, 10 },
+{ 0, 4, 382, 89 },
+{ 0, 3, 368, 12 },
+{ 0, 3, -1, 53 },
+{ 0, 3, -1, 54 },
+{ 0, 3, -1, 55 },
+{ 0, 3, -1, 56 },
+{ 0, 4, -1, 135 },
+{ 0, 4, -1, 131 },
+{ 0, 4, -1, 129 },
+{ 0, 4, -1, 133 },
+{ 0, 4, -1, 132 },
+{ 0, 4, -1, 130 },
+{ 0, 4, -1, 134 },
+{ 0, 3, -1, 57 },
+{ 0, 3, -1, 58 },
+{ 0, 3, -1, 123 },
+{ 0, 3, -1, 120 },
+{ 0, 5, 401, 68 },
+{ 0, 4, 401, 69 },
+{ 0, 3, -1, 70 },
+{ 0, 5, -1, 92 },
+{ 0, 5, -1, 93 },
+{ 0, 4, -1, 94 },
+{ 0, 4, -1, 71 },
+{ 0, 4, -1, 72 },
+{ 0, 4, -1, 73 },
+{ 0, 4, -1, 74 },
+{ 0, 4, -1, 13 },
+{ 0, 4, -1, 75 },
+{ 0, 3, -1, 77 },
+{ 0, 3, -1, 78 },
+{ 0, 5, 415, 109 },
+{ 0, 6, 416, 26 },
+{ 0, 6, 416, 30 },
+{ 0, 6, 416, 31 },
+{ 0, 6, 416, 28 },
+{ 0, 6, 416, 27 },
+{ 0, 6, 416, 29 },
+{ 0, 3, -1, 79 },
+{ 0, 3, -1, 80 },
+{ 0, 4, 424, 20 },
+{ 0, 5, 425, 17 },
+{ 0, 4, 424, 82 },
+{ 0, 5, 427, 49 },
+{ 0, 4, 424, 81 },
+{ 0, 5, 424, 12 },
+{ 0, 4, -1, 3 },
+{ 0, 4, -1, 4 },
+{ 0, 3, -1, 14 },
+{ 0, 3, -1, 15 },
+{ 0, 3, -1, 16 },
+{ 0, 4, -1, 63 },
+{ 0, 4, -1, 64 },
+{ 0, 4, -1, 61 },
+{ 0, 4, -1, 62 },
+{ 0, 4, -1, 60 },
+{ 0, 4, -1, 59 },
+{ 0, 4, -1, 65 },
+{ 0, 3, -1, 66 },
+{ 0, 3, -1, 67 },
+{ 0, 3, -1, 91 },
+{ 0, 3, -1, 124 },
+{ 0, 3, -1, 125 },
+{ 0, 3, -1, 126 },
+{ 0, 4, 448, 121 },
+{ 0, 6, -1, 110 },
+{ 0, 6, -1, 111 },
+{ 0, 6, -1, 112 },
+{ 0, 2, -1, 20 },
+{ 0, 4, 453, 19 },
+{ 0, 3, 453, 18 },
+{ 0, 3, -1, 104 },
+{ 0, 4, 456, 26 },
+{ 0, 4, 456, 30 },
+{ 0, 4, 456, 31 },
+{ 0, 6, 456, 106 },
+{ 0, 6, 456, 107 },
+{ 0, 6, 456, 108 },
+{ 0, 4, 456, 28 },
+{ 0, 4, 456, 27 },
+{ 0, 4, 456, 29 },
+{ 0, 3, -1, 116 },
+{ 0, 4, 466, 32 },
+{ 0, 4, 466, 33 },
+{ 0, 4, 466, 34 },
+{ 0, 4, 466, 40 },
+{ 0, 4, 466, 39 },
+{ 0, 6, 466, 84 },
+{ 0, 6, 466, 85 },
+{ 0, 6, 466, 122 },
+{ 0, 6, 466, 86 },
+{ 0, 4, 466, 95 },
+{ 0, 5, 476, 1 },
+{ 0, 5, 476, 2 },
+{ 0, 4, 466, 35 },
+{ 0, 5, 479, 83 },
+{ 0, 4, 466, 37 },
+{ 0, 4, 466, 13 },
+{ 0, 6, 482, 9 },
+{ 0, 6, 482, 6 },
+{ 0, 6, 482, 7 },
+{ 0, 6, 482, 8 },
+{ 0, 6, 482, 5 },
+{ 0, 4, 466, 41 },
+{ 0, 4, 466, 42 },
+{ 0, 4, 466, 43 },
+{ 0, 5, 490, 123 },
+{ 0, 4, 466, 44 },
+{ 0, 5, 492, 120 },
+{ 0, 7, 492, 92 },
+{ 0, 7, 492, 93 },
+{ 0, 6, 492, 94 },
+{ 0, 5, 466, 77 },
+{ 0, 5, 466, 78 },
+{ 0, 5, 466, 79 },
+{ 0, 5, 466, 80 },
+{ 0, 4, 466, 45 },
+{ 0, 5, 466, 91 },
+{ 0, 4, 466, 38 },
+{ 0, 4, -1, 84 },
+{ 0, 4, -1, 85 },
+{ 0, 4, -1, 122 },
+{ 0, 4, -1, 86 },
+{ 0, 3, -1, 25 },
+{ 0, 6, 508, 121 },
+{ 0, 5, 508, 100 },
+{ 0, 6, 508, 117 },
+{ 0, 2, -1, 95 },
+{ 0, 3, 512, 1 },
+{ 0, 3, 512, 2 },
+{ 0, 3, -1, 104 },
+{ 0, 5, 515, 128 },
+{ 0, 8, 515, 106 },
+{ 0, 8, 515, 107 },
+{ 0, 8, 515, 108 },
+{ 0, 5, 515, 47 },
+{ 0, 6, 515, 114 },
+{ 0, 4, 515, 46 },
+{ 0, 5, 515, 100 },
+{ 0, 5, 515, 105 },
+{ 0, 4, 515, 113 },
+{ 0, 6, 525, 110 },
+{ 0, 6, 525, 111 },
+{ 0, 6, 525, 112 },
+{ 0, 5, 515, 97 },
+{ 0, 5, 515, 96 },
+{ 0, 5, 515, 98 },
+{ 0, 5, 515, 76 },
+{ 0, 5, 515, 99 },
+{ 0, 5, 515, 102 },
+{ 0, 3, -1, 83 },
+{ 0, 3, -1, 116 },
+{ 0, 5, 536, 124 },
+{ 0, 6, 536, 121 },
+{ 0, 4, 536, 103 },
+{ 0, 6, 536, 127 },
+{ 0, 6, 536, 118 },
+{ 0, 5, 536, 48 },
+{ 0, 5, 536, 101 },
+{ 0, 6, 536, 117 },
+{ 0, 6, 536, 90 },
+{ 0, 3, -1, 50 },
+{ 0, 4, -1, 115 },
+{ 0, 4, -1, 13 },
+{ 0, 4, -1, 52 },
+{ 0, 4, -1, 51 },
+{ 0, 5, -1, 124 },
+{ 0, 5, -1, 125 },
+{ 0, 5, -1, 126 },
+{ 0, 6, -1, 84 },
+{ 0, 6, -1, 85 },
+{ 0, 6, -1, 122 },
+{ 0, 6, -1, 86 },
+{ 0, 4, -1, 95 },
+{ 0, 5, 558, 1 },
+{ 0, 5, 558, 2 },
+{ 0, 5, -1, 83 },
+{ 0, 4, -1, 13 },
+{ 0, 6, 562, 137 },
+{ 0, 6, 562, 89 },
+{ 0, 5, -1, 123 },
+{ 0, 5, -1, 120 },
+{ 0, 7, -1, 92 },
+{ 0, 7, -1, 93 },
+{ 0, 6, -1, 94 },
+{ 0, 5, -1, 77 },
+{ 0, 5, -1, 78 },
+{ 0, 5, -1, 79 },
+{ 0, 5, -1, 80 },
+{ 0, 5, -1, 14 },
+{ 0, 5, -1, 15 },
+{ 0, 5, -1, 16 },
+{ 0, 5, -1, 91 },
+{ 0, 2, -1, 13 },
+{ 0, 3, 578, 10 },
+{ 0, 5, 579, 128 },
+{ 0, 5, 579, 105 },
+{ 0, 4, 579, 113 },
+{ 0, 6, 582, 110 },
+{ 0, 6, 582, 111 },
+{ 0, 6, 582, 112 },
+{ 0, 5, 579, 97 },
+{ 0, 5, 579, 96 },
+{ 0, 5, 579, 98 },
+{ 0, 5, 579, 99 },
+{ 0, 5, 579, 102 },
+{ 0, 5, 578, 124 },
+{ 0, 6, 578, 121 },
+{ 0, 5, 578, 101 },
+{ 0, 6, 578, 117 },
+{ 0, 3, 578, 11 },
+{ 0, 4, 595, 137 },
+{ 0, 5, 595, 10 },
+{ 0, 4, 595, 89 },
+{ 0, 3, 578, 12 },
+{ 0, 3, -1, 53 },
+{ 0, 3, -1, 54 },
+{ 0, 3, -1, 55 },
+{ 0, 3, -1, 56 },
+{ 0, 3, -1, 161 },
+{ 0, 4, 604, 135 },
+{ 0, 5, 604, 128 },
+{ 0, 4, 604, 131 },
+{ 0, 4, 604, 129 },
+{ 0, 8, 608, 138 },
+{ 0, 8, 608, 139 },
+{ 0, 8, 608, 140 },
+{ 0, 6, 608, 150 },
+{ 0, 4, 604, 133 },
+{ 0, 4, 604, 132 },
+{ 0, 5, 604, 155 },
+{ 0, 5, 604, 156 },
+{ 0, 4, 604, 130 },
+{ 0, 4, 604, 134 },
+{ 0, 5, 618, 144 },
+{ 0, 5, 618, 145 },
+{ 0, 5, 618, 146 },
+{ 0, 5, 618, 148 },
+{ 0, 5, 618, 147 },
+{ 0, 3, -1, 57 },
+{ 0, 3, -1, 58 },
+{ 0, 5, 625, 124 },
+{ 0, 6, 625, 121 },
+{ 0, 6, 625, 127 },
+{ 0, 6, 625, 149 },
+{ 0, 3, -1, 123 },
+{ 0, 8, 630, 141 },
+{ 0, 8, 630, 142 },
+{ 0, 8, 630, 143 },
+{ 0, 3, -1, 104 },
+{ 0, 5, 634, 128 },
+{ 0, 5, 634, 68 },
+{ 0, 4, 634, 69 },
+{ 0, 5, 634, 100 },
+{ 0, 5, 634, 105 },
+{ 0, 4, 634, 113 },
+{ 0, 5, 634, 97 },
+{ 0, 5, 634, 96 },
+{ 0, 5, 634, 98 },
+{ 0, 5, 634, 99 },
+{ 0, 5, 634, 102 },
+{ 0, 3, -1, 70 },
+{ 0, 8, 646, 110 },
+{ 0, 8, 646, 111 },
+{ 0, 8, 646, 112 },
+{ 0, 8, 646, 106 },
+{ 0, 8, 646, 107 },
+{ 0, 8, 646, 108 },
+{ 0, 5, 646, 116 },
+{ 0, 6, 646, 114 },
+{ 0, 5, 646, 25 },
+{ 0, 8, 655, 121 },
+{ 0, 7, 655, 100 },
+{ 0, 8, 655, 117 },
+{ 0, 4, 646, 13 },
+{ 0, 8, 659, 110 },
+{ 0, 8, 659, 111 },
+{ 0, 8, 659, 112 },
+{ 0, 6, 646, 115 },
+{ 0, 3, -1, 116 },
+{ 0, 5, 664, 124 },
+{ 0, 6, 664, 121 },
+{ 0, 4, 664, 13 },
+{ 0, 8, 667, 110 },
+{ 0, 8, 667, 111 },
+{ 0, 8, 667, 112 },
+{ 0, 6, 664, 127 },
+{ 0, 6, 664, 118 },
+{ 0, 6, 664, 115 },
+{ 0, 5, 664, 92 },
+{ 0, 5, 664, 93 },
+{ 0, 5, 664, 101 },
+{ 0, 6, 664, 117 },
+{ 0, 6, 664, 90 },
+{ 0, 4, -1, 104 },
+{ 0, 6, 679, 105 },
+{ 0, 5, 679, 113 },
+{ 0, 7, 681, 106 },
+{ 0, 7, 681, 107 },
+{ 0, 7, 681, 108 },
+{ 0, 6, 679, 97 },
+{ 0, 6, 679, 96 },
+{ 0, 6, 679, 98 },
+{ 0, 6, 679, 99 },
+{ 0, 4, -1, 116 },
+{ 0, 7, -1, 121 },
+{ 0, 6, -1, 100 },
+{ 0, 7, -1, 117 },
+{ 0, 4, -1, 94 },
+{ 0, 6, 693, 128 },
+{ 0, 9, 693, 106 },
+{ 0, 9, 693, 107 },
+{ 0, 9, 693, 108 },
+{ 0, 7, 693, 114 },
+{ 0, 6, 693, 100 },
+{ 0, 6, 693, 105 },
+{ 0, 5, 693, 113 },
+{ 0, 6, 693, 97 },
+{ 0, 6, 693, 96 },
+{ 0, 6, 693, 98 },
+{ 0, 6, 693, 76 },
+{ 0, 6, 693, 99 },
+{ 0, 6, 693, 102 },
+{ 0, 4, -1, 71 },
+{ 0, 4, -1, 72 },
+{ 0, 6, 709, 124 },
+{ 0, 7, 709, 121 },
+{ 0, 5, 709, 103 },
+{ 0, 7, 709, 127 },
+{ 0, 7, 709, 118 },
+{ 0, 6, 709, 101 },
+{ 0, 7, 709, 117 },
+{ 0, 7, 709, 90 },
+{ 0, 4, -1, 73 },
+{ 0, 4, -1, 74 },
+{ 0, 9, 719, 110 },
+{ 0, 9, 719, 111 },
+{ 0, 9, 719, 112 },
+{ 0, 5, -1, 13 },
+{ 0, 4, -1, 75 },
+{ 0, 3, -1, 77 },
+{ 0, 3, -1, 78 },
+{ 0, 5, 726, 109 },
+{ 0, 6, 727, 26 },
+{ 0, 6, 727, 30 },
+{ 0, 6, 727, 31 },
+{ 0, 6, 727, 28 },
+{ 0, 6, 727, 27 },
+{ 0, 6, 727, 29 },
+{ 0, 3, -1, 79 },
+{ 0, 3, -1, 80 },
+{ 0, 4, 735, 20 },
+{ 0, 5, 736, 17 },
+{ 0, 4, 735, 82 },
+{ 0, 5, 738, 49 },
+{ 0, 4, 735, 81 },
+{ 0, 5, 735, 12 },
+{ 0, 3, -1, 14 },
+{ 0, 3, -1, 15 },
+{ 0, 3, -1, 16 },
+{ 0, 3, -1, 101 },
+{ 0, 4, -1, 117 },
+{ 0, 3, -1, 104 },
+{ 0, 4, 747, 63 },
+{ 0, 4, 747, 64 },
+{ 0, 4, 747, 61 },
+{ 0, 8, 750, 106 },
+{ 0, 8, 750, 107 },
+{ 0, 8, 750, 108 },
+{ 0, 6, 750, 114 },
+{ 0, 4, 747, 62 },
+{ 0, 4, 747, 60 },
+{ 0, 5, 747, 100 },
+{ 0, 5, 747, 105 },
+{ 0, 4, 747, 59 },
+{ 0, 4, 747, 65 },
+{ 0, 5, 760, 97 },
+{ 0, 5, 760, 96 },
+{ 0, 5, 760, 98 },
+{ 0, 5, 760, 76 },
+{ 0, 5, 760, 99 },
+{ 0, 5, 747, 102 },
+{ 0, 3, -1, 66 },
+{ 0, 3, -1, 67 },
+{ 0, 6, 768, 118 },
+{ 0, 5, 768, 101 },
+{ 0, 6, 768, 117 },
+{ 0, 6, 768, 90 },
+{ 0, 3, -1, 91 },
+{ 0, 8, 773, 110 },
+{ 0, 8, 773, 111 },
+{ 0, 8, 773, 112 },
+{ 0, 4, -1, 124 },
+{ 0, 4, -1, 125 },
+{ 0, 4, -1, 126 },
+{ 0, 7, -1, 84 },
+{ 0, 7, -1, 85 },
+{ 0, 7, -1, 122 },
+{ 0, 7, -1, 86 },
+{ 0, 5, -1, 95 },
+{ 0, 6, 784, 1 },
+{ 0, 6, 784, 2 },
+{ 0, 6, -1, 83 },
+{ 0, 5, -1, 13 },
+{ 0, 6, -1, 123 },
+{ 0, 6, -1, 120 },
+{ 0, 8, -1, 92 },
+{ 0, 8, -1, 93 },
+{ 0, 7, -1, 94 },
+{ 0, 6, -1, 77 },
+{ 0, 6, -1, 78 },
+{ 0, 6, -1, 79 },
+{ 0, 6, -1, 80 },
+{ 0, 6, -1, 91 },
+{ 0, 5, -1, 84 },
+{ 0, 5, -1, 85 },
+{ 0, 5, -1, 122 },
+{ 0, 5, -1, 86 },
+{ 0, 3, -1, 95 },
+{ 0, 4, -1, 83 },
+{ 0, 3, -1, 13 },
+{ 0, 4, 805, 10 },
+{ 0, 4, 805, 87 },
+{ 0, 4, 805, 159 },
+{ 0, 4, 805, 88 },
+{ 0, 4, -1, 123 },
+{ 0, 4, -1, 120 },
+{ 0, 4, -1, 77 },
+{ 0, 4, -1, 78 },
+{ 0, 4, -1, 79 },
+{ 0, 4, -1, 80 },
+{ 0, 4, -1, 14 },
+{ 0, 4, -1, 15 },
+{ 0, 4, -1, 16 },
+{ 0, 4, -1, 91 },
+{ 0, 4, -1, 124 },
+{ 0, 4, -1, 125 },
+{ 0, 4, -1, 126 },
+{ 0, 5, -1, 84 },
+{ 0, 5, -1, 85 },
+{ 0, 5, -1, 122 },
+{ 0, 5, -1, 86 },
+{ 0, 3, -1, 95 },
+{ 0, 4, 827, 1 },
+{ 0, 4, 827, 2 },
+{ 0, 4, -1, 83 },
+{ 0, 3, -1, 13 },
+{ 0, 5, 831, 137 },
+{ 0, 5, 831, 89 },
+{ 0, 4, -1, 123 },
+{ 0, 4, -1, 120 },
+{ 0, 6, -1, 92 },
+{ 0, 6, -1, 93 },
+{ 0, 5, -1, 94 },
+{ 0, 4, -1, 77 },
+{ 0, 4, -1, 78 },
+{ 0, 4, -1, 79 },
+{ 0, 4, -1, 80 },
+{ 0, 4, -1, 14 },
+{ 0, 4, -1, 15 },
+{ 0, 4, -1, 16 },
+{ 0, 4, -1, 91 },
+{ 0, 2, -1, 104 },
+{ 0, 4, 847, 128 },
+{ 0, 7, 847, 106 },
+{ 0, 7, 847, 107 },
+{ 0, 7, 847, 108 },
+{ 0, 5, 847, 114 },
+{ 0, 4, 847, 100 },
+{ 0, 4, 847, 105 },
+{ 0, 3, 847, 113 },
+{ 0, 4, 847, 97 },
+{ 0, 4, 847, 96 },
+{ 0, 4, 847, 98 },
+{ 0, 4, 847, 76 },
+{ 0, 4, 847, 99 },
+{ 0, 4, 847, 102 },
+{ 0, 2, -1, 116 },
+{ 0, 4, 862, 124 },
+{ 0, 4, 862, 125 },
+{ 0, 4, 862, 126 },
+{ 0, 5, 865, 121 },
+{ 0, 7, 862, 84 },
+{ 0, 7, 862, 85 },
+{ 0, 7, 862, 122 },
+{ 0, 7, 862, 86 },
+{ 0, 5, 862, 95 },
+{ 0, 6, 871, 1 },
+{ 0, 6, 871, 2 },
+{ 0, 6, 862, 83 },
+{ 0, 5, 862, 13 },
+{ 0, 6, 862, 123 },
+{ 0, 6, 862, 120 },
+{ 0, 8, 862, 92 },
+{ 0, 8, 862, 93 },
+{ 0, 7, 862, 94 },
+{ 0, 6, 862, 77 },
+{ 0, 6, 862, 78 },
+{ 0, 6, 862, 79 },
+{ 0, 6, 862, 80 },
+{ 0, 6, 862, 91 },
+{ 0, 5, 862, 84 },
+{ 0, 5, 862, 85 },
+{ 0, 5, 862, 122 },
+{ 0, 5, 862, 86 },
+{ 0, 3, 862, 95 },
+{ 0, 4, 890, 1 },
+{ 0, 4, 890, 2 },
+{ 0, 4, 862, 83 },
+{ 0, 3, 862, 13 },
+{ 0, 5, 894, 137 },
+{ 0, 5, 894, 89 },
+{ 0, 4, 862, 123 },
+{ 0, 5, 897, 127 },
+{ 0, 4, 862, 120 },
+{ 0, 5, 862, 118 },
+{ 0, 6, 862, 92 },
+{ 0, 6, 862, 93 },
+{ 0, 5, 862, 94 },
+{ 0, 4, 862, 77 },
+{ 0, 4, 862, 78 },
+{ 0, 4, 862, 79 },
+{ 0, 4, 862, 80 },
+{ 0, 4, 862, 14 },
+{ 0, 4, 862, 15 },
+{ 0, 4, 862, 16 },
+{ 0, 4, 862, 101 },
+{ 0, 5, 862, 117 },
+{ 0, 4, 862, 91 },
+{ 0, 5, 913, 90 },
+{ 0, 7, -1, 110 },
+{ 0, 7, -1, 111 },
+{ 0, 7, -1, 112 },
+{ 0, 4, -1, 124 },
+{ 0, 4, -1, 125 },
+{ 0, 4, -1, 126 },
+{ 0, 4, -1, 14 },
+{ 0, 4, -1, 15 },
+{ 0, 4, -1, 16 },
+{ 0, 3, -1, 124 },
+{ 0, 5, -1, 124 },
+{ 0, 4, -1, 162 },
+{ 0, 5, -1, 161 },
+{ 0, 7, 927, 155 },
+{ 0, 7, 927, 156 },
+{ 0, 8, 927, 138 },
+{ 0, 8, 927, 139 },
+{ 0, 8, 927, 140 },
+{ 0, 7, 927, 144 },
+{ 0, 7, 927, 145 },
+{ 0, 7, 927, 146 },
+{ 0, 7, 927, 147 },
+{ 0, 5, -1, 157 },
+{ 0, 8, 937, 121 },
+{ 0, 7, 937, 155 },
+{ 0, 4, -1, 121 },
+{ 0, 4, -1, 164 },
+{ 0, 5, -1, 153 },
+{ 0, 6, -1, 136 },
+{ 0, 2, -1, 20 },
+{ 0, 3, 944, 18 },
+{ 0, 3, -1, 109 },
+{ 0, 4, 946, 26 },
+{ 0, 4, 946, 30 },
+{ 0, 4, 946, 31 },
+{ 0, 4, 946, 28 },
+{ 0, 4, 946, 27 },
+{ 0, 4, 946, 29 },
+{ 0, 4, -1, 32 },
+{ 0, 4, -1, 33 },
+{ 0, 4, -1, 34 },
+{ 0, 4, -1, 40 },
+{ 0, 4, -1, 39 },
+{ 0, 6, -1, 84 },
+{ 0, 6, -1, 85 },
+{ 0, 6, -1, 122 },
+{ 0, 6, -1, 86 },
+{ 0, 4, -1, 95 },
+{ 0, 5, 962, 1 },
+{ 0, 5, 962, 2 },
+{ 0, 4, -1, 35 },
+{ 0, 5, 965, 83 },
+{ 0, 4, -1, 37 },
+{ 0, 4, -1, 13 },
+{ 0, 6, 968, 9 },
+{ 0, 6, 968, 6 },
+{ 0, 6, 968, 7 },
+{ 0, 6, 968, 8 },
+{ 0, 6, 968, 5 },
+{ 0, 4, -1, 41 },
+{ 0, 4, -1, 42 },
+{ 0, 4, -1, 43 },
+{ 0, 5, 976, 123 },
+{ 0, 4, -1, 44 },
+{ 0, 5, 978, 120 },
+{ 0, 7, 978, 92 },
+{ 0, 7, 978, 93 },
+{ 0, 6, 978, 94 },
+{ 0, 5, -1, 77 },
+{ 0, 5, -1, 78 },
+{ 0, 5, -1, 79 },
+{ 0, 5, -1, 80 },
+{ 0, 4, -1, 45 },
+{ 0, 5, -1, 91 },
+{ 0, 4, -1, 38 },
+{ 0, 4, -1, 84 },
+{ 0, 4, -1, 85 },
+{ 0, 4, -1, 122 },
+{ 0, 4, -1, 86 },
+{ 0, 2, -1, 95 },
+{ 0, 3, 994, 1 },
+{ 0, 3, 994, 2 },
+{ 0, 3, -1, 104 },
+{ 0, 5, 997, 128 },
+{ 0, 8, 997, 106 },
+{ 0, 8, 997, 107 },
+{ 0, 8, 997, 108 },
+{ 0, 5, 997, 47 },
+{ 0, 6, 997, 114 },
+{ 0, 4, 997, 46 },
+{ 0, 5, 997, 100 },
+{ 0, 5, 997, 105 },
+{ 0, 4, 997, 113 },
+{ 0, 6, 1007, 110 },
+{ 0, 6, 1007, 111 },
+{ 0, 6, 1007, 112 },
+{ 0, 5, 997, 97 },
+{ 0, 5, 997, 96 },
+{ 0, 5, 997, 98 },
+{ 0, 5, 997, 76 },
+{ 0, 5, 997, 99 },
+{ 0, 5, 997, 102 },
+{ 0, 3, -1, 83 },
+{ 0, 3, -1, 116 },
+{ 0, 5, 1018, 124 },
+{ 0, 6, 1018, 121 },
+{ 0, 4, 1018, 103 },
+{ 0, 6, 1018, 127 },
+{ 0, 6, 1018, 118 },
+{ 0, 5, 1018, 48 },
+{ 0, 5, 1018, 101 },
+{ 0, 6, 1018, 117 },
+{ 0, 6, 1018, 90 },
+{ 0, 3, -1, 50 },
+{ 0, 4, -1, 115 },
+{ 0, 4, -1, 13 },
+{ 0, 4, -1, 52 },
+{ 0, 4, -1, 51 },
+{ 0, 2, -1, 13 },
+{ 0, 3, 1033, 10 },
+{ 0, 5, 1034, 128 },
+{ 0, 5, 1034, 105 },
+{ 0, 4, 1034, 113 },
+{ 0, 5, 1034, 97 },
+{ 0, 5, 1034, 96 },
+{ 0, 5, 1034, 98 },
+{ 0, 5, 1034, 99 },
+{ 0, 5, 1034, 102 },
+{ 0, 5, 1033, 124 },
+{ 0, 6, 1033, 121 },
+{ 0, 5, 1033, 101 },
+{ 0, 6, 1033, 117 },
+{ 0, 3, 1033, 11 },
+{ 0, 4, 1047, 137 },
+{ 0, 4, 1047, 89 },
+{ 0, 3, 1033, 12 },
+{ 0, 3, -1, 53 },
+{ 0, 3, -1, 54 },
+{ 0, 3, -1, 55 },
+{ 0, 3, -1, 56 },
+{ 0, 4, -1, 135 },
+{ 0, 4, -1, 131 },
+{ 0, 4, -1, 129 },
+{ 0, 4, -1, 133 },
+{ 0, 4, -1, 132 },
+{ 0, 4, -1, 130 },
+{ 0, 4, -1, 134 },
+{ 0, 3, -1, 152 },
+{ 0, 3, -1, 154 },
+{ 0, 3, -1, 123 },
+{ 0, 4, -1, 161 },
+{ 0, 6, 1065, 128 },
+{ 0, 6, 1065, 155 },
+{ 0, 5, 1065, 160 },
+{ 0, 6, 1068, 153 },
+{ 0, 7, 1068, 141 },
+{ 0, 7, 1068, 142 },
+{ 0, 7, 1068, 143 },
+{ 0, 4, -1, 162 },
+{ 0, 5, 1073, 158 },
+{ 0, 7, 1073, 127 },
+{ 0, 5, -1, 164 },
+{ 0, 3, -1, 104 },
+{ 0, 5, 1077, 128 },
+{ 0, 8, 1077, 106 },
+{ 0, 8, 1077, 107 },
+{ 0, 8, 1077, 108 },
+{ 0, 6, 1077, 114 },
+{ 0, 5, 1077, 68 },
+{ 0, 4, 1077, 69 },
+{ 0, 5, 1077, 100 },
+{ 0, 5, 1077, 105 },
+{ 0, 4, 1077, 113 },
+{ 0, 6, 1087, 110 },
+{ 0, 6, 1087, 111 },
+{ 0, 6, 1087, 112 },
+{ 0, 5, 1077, 97 },
+{ 0, 5, 1077, 96 },
+{ 0, 5, 1077, 98 },
+{ 0, 5, 1077, 76 },
+{ 0, 5, 1077, 99 },
+{ 0, 5, 1077, 102 },
+{ 0, 3, -1, 70 },
+{ 0, 3, -1, 116 },
+{ 0, 5, 1098, 124 },
+{ 0, 6, 1098, 121 },
+{ 0, 4, 1098, 103 },
+{ 0, 6, 1098, 127 },
+{ 0, 6, 1098, 118 },
+{ 0, 5, 1098, 92 },
+{ 0, 5, 1098, 93 },
+{ 0, 5, 1098, 101 },
+{ 0, 6, 1098, 117 },
+{ 0, 6, 1098, 90 },
+{ 0, 4, -1, 94 },
+{ 0, 4, -1, 71 },
+{ 0, 4, -1, 72 },
+{ 0, 4, -1, 73 },
+{ 0, 4, -1, 74 },
+{ 0, 4, -1, 13 },
+{ 0, 3, -1, 77 },
+{ 0, 3, -1, 78 },
+{ 0, 5, 1116, 109 },
+{ 0, 6, 1117, 26 },
+{ 0, 6, 1117, 30 },
+{ 0, 6, 1117, 31 },
+{ 0, 6, 1117, 28 },
+{ 0, 6, 1117, 27 },
+{ 0, 6, 1117, 29 },
+{ 0, 3, -1, 79 },
+{ 0, 3, -1, 80 },
+{ 0, 4, 1125, 20 },
+{ 0, 5, 1126, 17 },
+{ 0, 4, 1125, 82 },
+{ 0, 5, 1128, 49 },
+{ 0, 4, 1125, 81 },
+{ 0, 5, 1125, 12 },
+{ 0, 4, -1, 116 },
+{ 0, 5, -1, 101 },
+{ 0, 5, -1, 104 },
+{ 0, 7, 1134, 100 },
+{ 0, 7, 1134, 105 },
+{ 0, 8, 1134, 106 },
+{ 0, 8, 1134, 107 },
+{ 0, 8, 1134, 108 },
+{ 0, 7, 1134, 97 },
+{ 0, 7, 1134, 96 },
+{ 0, 7, 1134, 98 },
+{ 0, 7, 1134, 99 },
+{ 0, 5, -1, 25 },
+{ 0, 7, 1144, 100 },
+{ 0, 8, 1144, 117 },
+{ 0, 4, -1, 13 },
+{ 0, 5, -1, 70 },
+{ 0, 6, -1, 115 },
+{ 0, 3, -1, 101 },
+{ 0, 4, -1, 117 },
+{ 0, 4, -1, 63 },
+{ 0, 4, -1, 64 },
+{ 0, 4, -1, 61 },
+{ 0, 4, -1, 62 },
+{ 0, 4, -1, 60 },
+{ 0, 4, -1, 59 },
+{ 0, 4, -1, 65 },
+{ 0, 3, -1, 66 },
+{ 0, 3, -1, 67 },
+{ 0, 3, -1, 91 },
+{ 0, 4, -1, 104 },
+{ 0, 6, 1162, 100 },
+{ 0, 5, 1162, 113 },
+{ 0, 6, 1164, 70 },
+{ 0, 7, 1164, 110 },
+{ 0, 7, 1164, 111 },
+{ 0, 7, 1164, 112 },
+{ 0, 6, 1162, 102 },
+{ 0, 4, -1, 116 },
+{ 0, 5, 1170, 103 },
+{ 0, 7, 1170, 90 },
+{ 0, 5, -1, 13 },
+{ 0, 2, -1, 104 },
+{ 0, 4, 1174, 105 },
+{ 0, 3, 1174, 113 },
+{ 0, 4, 1174, 97 },
+{ 0, 4, 1174, 96 },
+{ 0, 4, 1174, 98 },
+{ 0, 4, 1174, 99 },
+{ 0, 2, -1, 116 },
+{ 0, 4, -1, 124 },
+{ 0, 4, -1, 125 },
+{ 0, 4, -1, 126 },
+{ 0, 7, -1, 84 },
+{ 0, 7, -1, 85 },
+{ 0, 7, -1, 122 },
+{ 0, 7, -1, 86 },
+{ 0, 5, -1, 95 },
+{ 0, 6, 1189, 1 },
+{ 0, 6, 1189, 2 },
+{ 0, 6, -1, 83 },
+{ 0, 5, -1, 13 },
+{ 0, 6, -1, 123 },
+{ 0, 8, -1, 92 },
+{ 0, 8, -1, 93 },
+{ 0, 7, -1, 94 },
+{ 0, 6, -1, 77 },
+{ 0, 6, -1, 78 },
+{ 0, 6, -1, 79 },
+{ 0, 6, -1, 80 },
+{ 0, 6, -1, 91 },
+{ 0, 5, -1, 84 },
+{ 0, 5, -1, 85 },
+{ 0, 5, -1, 122 },
+{ 0, 5, -1, 86 },
+{ 0, 3, -1, 95 },
+{ 0, 4, 1207, 1 },
+{ 0, 4, 1207, 2 },
+{ 0, 4, -1, 104 },
+{ 0, 4, -1, 83 },
+{ 0, 3, -1, 13 },
+{ 0, 5, 1212, 137 },
+{ 0, 5, 1212, 89 },
+{ 0, 4, -1, 123 },
+{ 0, 4, -1, 120 },
+{ 0, 6, -1, 92 },
+{ 0, 6, -1, 93 },
+{ 0, 5, -1, 94 },
+{ 0, 4, -1, 77 },
+{ 0, 4, -1, 78 },
+{ 0, 4, -1, 79 },
+{ 0, 4, -1, 80 },
+{ 0, 4, -1, 14 },
+{ 0, 4, -1, 15 },
+{ 0, 4, -1, 16 },
+{ 0, 4, -1, 91 },
+{ 0, 5, -1, 121 },
+{ 0, 4, -1, 100 },
+{ 0, 5, -1, 117 },
+{ 0, 2, -1, 104 },
+{ 0, 4, 1231, 100 },
+{ 0, 4, 1231, 105 },
+{ 0, 2, -1, 119 },
+{ 0, 2, -1, 116 },
+{ 0, 2, -1, 104 },
+{ 0, 4, 1236, 128 },
+{ 0, 4, 1236, 100 },
+{ 0, 4, 1236, 105 },
+{ 0, 3, 1236, 113 },
+{ 0, 4, 1236, 97 },
+{ 0, 4, 1236, 96 },
+{ 0, 4, 1236, 98 },
+{ 0, 4, 1236, 99 },
+{ 0, 4, 1236, 102 },
+{ 0, 2, -1, 119 },
+{ 0, 4, 1246, 124 },
+{ 0, 4, 1246, 125 },
+{ 0, 4, 1246, 126 },
+{ 0, 7, 1246, 110 },
+{ 0, 7, 1246, 111 },
+{ 0, 7, 1246, 112 },
+{ 0, 4, 1246, 104 },
+{ 0, 5, 1253, 26 },
+{ 0, 5, 1253, 30 },
+{ 0, 5, 1253, 31 },
+{ 0, 7, 1253, 106 },
+{ 0, 7, 1253, 107 },
+{ 0, 7, 1253, 108 },
+{ 0, 5, 1253, 28 },
+{ 0, 5, 1253, 27 },
+{ 0, 5, 1253, 29 },
+{ 0, 4, 1246, 116 },
+{ 0, 7, 1263, 84 },
+{ 0, 7, 1263, 85 },
+{ 0, 7, 1263, 123 },
+{ 0, 7, 1263, 86 },
+{ 0, 5, 1263, 95 },
+{ 0, 6, 1268, 1 },
+{ 0, 6, 1268, 2 },
+{ 0, 5, 1263, 24 },
+{ 0, 6, 1271, 83 },
+{ 0, 5, 1263, 13 },
+{ 0, 7, 1263, 21 },
+{ 0, 5, 1263, 23 },
+{ 0, 6, 1275, 123 },
+{ 0, 6, 1263, 120 },
+{ 0, 8, 1263, 92 },
+{ 0, 8, 1263, 93 },
+{ 0, 6, 1263, 22 },
+{ 0, 7, 1263, 94 },
+{ 0, 6, 1263, 77 },
+{ 0, 6, 1263, 78 },
+{ 0, 6, 1263, 79 },
+{ 0, 6, 1263, 80 },
+{ 0, 6, 1263, 91 },
+{ 0, 5, 1246, 84 },
+{ 0, 5, 1246, 85 },
+{ 0, 5, 1246, 114 },
+{ 0, 5, 1246, 122 },
+{ 0, 5, 1246, 86 },
+{ 0, 4, 1246, 25 },
+{ 0, 7, 1292, 121 },
+{ 0, 6, 1292, 100 },
+{ 0, 7, 1292, 117 },
+{ 0, 3, 1246, 95 },
+{ 0, 4, 1296, 1 },
+{ 0, 4, 1296, 2 },
+{ 0, 4, 1246, 83 },
+{ 0, 3, 1246, 13 },
+{ 0, 4, 1300, 10 },
+{ 0, 7, 1301, 110 },
+{ 0, 7, 1301, 111 },
+{ 0, 7, 1301, 112 },
+{ 0, 4, 1300, 87 },
+{ 0, 4, 1300, 159 },
+{ 0, 4, 1300, 88 },
+{ 0, 5, 1246, 135 },
+{ 0, 5, 1246, 131 },
+{ 0, 5, 1246, 129 },
+{ 0, 5, 1246, 133 },
+{ 0, 5, 1246, 132 },
+{ 0, 5, 1246, 130 },
+{ 0, 5, 1246, 134 },
+{ 0, 4, 1246, 152 },
+{ 0, 4, 1246, 154 },
+{ 0, 4, 1246, 123 },
+{ 0, 4, 1246, 120 },
+{ 0, 4, 1246, 70 },
+{ 0, 6, 1246, 92 },
+{ 0, 6, 1246, 93 },
+{ 0, 5, 1246, 94 },
+{ 0, 5, 1246, 151 },
+{ 0, 5, 1246, 75 },
+{ 0, 4, 1246, 77 },
+{ 0, 4, 1246, 78 },
+{ 0, 4, 1246, 79 },
+{ 0, 4, 1246, 14 },
+{ 0, 4, 1246, 15 },
+{ 0, 4, 1246, 16 },
+{ 0, 5, 1246, 63 },
+{ 0, 5, 1246, 64 },
+{ 0, 5, 1246, 61 },
+{ 0, 5, 1246, 62 },
+{ 0, 5, 1246, 60 },
+{ 0, 5, 1246, 59 },
+{ 0, 5, 1246, 65 },
+{ 0, 4, 1246, 66 },
+{ 0, 4, 1246, 67 },
+{ 0, 4, 1246, 91 },
+{ 0, 2, -1, 116 },
+{ 0, 4, 1341, 124 },
+{ 0, 4, 1341, 125 },
+{ 0, 4, 1341, 126 },
+{ 0, 5, 1344, 121 },
+{ 0, 7, 1341, 84 },
+{ 0, 7, 1341, 85 },
+{ 0, 7, 1341, 122 },
+{ 0, 7, 1341, 86 },
+{ 0, 5, 1341, 95 },
+{ 0, 6, 1350, 1 },
+{ 0, 6, 1350, 2 },
+{ 0, 6, 1341, 83 },
+{ 0, 5, 1341, 13 },
+{ 0, 6, 1341, 123 },
+{ 0, 6, 1341, 120 },
+{ 0, 8, 1341, 92 },
+{ 0, 8, 1341, 93 },
+{ 0, 7, 1341, 94 },
+{ 0, 6, 1341, 77 },
+{ 0, 6, 1341, 78 },
+{ 0, 6, 1341, 79 },
+{ 0, 6, 1341, 80 },
+{ 0, 6, 1341, 91 },
+{ 0, 5, 1341, 84 },
+{ 0, 5, 1341, 85 },
+{ 0, 5, 1341, 122 },
+{ 0, 5, 1341, 86 },
+{ 0, 3, 1341, 95 },
+{ 0, 4, 1369, 1 },
+{ 0, 4, 1369, 2 },
+{ 0, 4, 1341, 83 },
+{ 0, 3, 1341, 13 },
+{ 0, 5, 1373, 137 },
+{ 0, 5, 1373, 89 },
+{ 0, 4, 1341, 123 },
+{ 0, 5, 1376, 127 },
+{ 0, 4, 1341, 120 },
+{ 0, 5, 1341, 118 },
+{ 0, 6, 1341, 92 },
+{ 0, 6, 1341, 93 },
+{ 0, 5, 1341, 94 },
+{ 0, 4, 1341, 77 },
+{ 0, 4, 1341, 78 },
+{ 0, 4, 1341, 79 },
+{ 0, 4, 1341, 80 },
+{ 0, 4, 1341, 14 },
+{ 0, 4, 1341, 15 },
+{ 0, 4, 1341, 16 },
+{ 0, 4, 1341, 101 },
+{ 0, 5, 1341, 117 },
+{ 0, 4, 1341, 91 },
+{ 0, 5, 1392, 90 },
+{ 0, 4, -1, 124 },
+{ 0, 4, -1, 125 },
+{ 0, 4, -1, 126 },
+{ 0, 3, -1, 20 },
+{ 0, 5, 1397, 19 },
+{ 0, 4, 1397, 18 },
+{ 0, 5, -1, 32 },
+{ 0, 5, -1, 33 },
+{ 0, 5, -1, 34 },
+{ 0, 5, -1, 40 },
+{ 0, 5, -1, 39 },
+{ 0, 5, -1, 35 },
+{ 0, 5, -1, 37 },
+{ 0, 5, -1, 36 },
+{ 0, 7, 1407, 9 },
+{ 0, 7, 1407, 6 },
+{ 0, 7, 1407, 7 },
+{ 0, 7, 1407, 8 },
+{ 0, 7, 1407, 5 },
+{ 0, 5, -1, 41 },
+{ 0, 5, -1, 42 },
+{ 0, 5, -1, 43 },
+{ 0, 5, -1, 44 },
+{ 0, 5, -1, 45 },
+{ 0, 5, -1, 38 },
+{ 0, 5, -1, 84 },
+{ 0, 5, -1, 85 },
+{ 0, 5, -1, 122 },
+{ 0, 5, -1, 86 },
+{ 0, 3, -1, 95 },
+{ 0, 4, 1423, 1 },
+{ 0, 4, 1423, 2 },
+{ 0, 4, -1, 104 },
+{ 0, 6, 1426, 47 },
+{ 0, 5, 1426, 46 },
+{ 0, 4, -1, 83 },
+{ 0, 4, -1, 116 },
+{ 0, 6, 1430, 48 },
+{ 0, 4, -1, 50 },
+{ 0, 5, -1, 52 },
+{ 0, 5, -1, 51 },
+{ 0, 3, -1, 13 },
+{ 0, 4, 1435, 10 },
+{ 0, 4, 1435, 11 },
+{ 0, 5, 1437, 137 },
+{ 0, 6, 1437, 10 },
+{ 0, 5, 1437, 89 },
+{ 0, 4, 1435, 12 },
+{ 0, 4, -1, 53 },
+{ 0, 4, -1, 54 },
+{ 0, 4, -1, 55 },
+{ 0, 4, -1, 56 },
+{ 0, 5, -1, 135 },
+{ 0, 5, -1, 131 },
+{ 0, 5, -1, 129 },
+{ 0, 5, -1, 133 },
+{ 0, 5, -1, 132 },
+{ 0, 5, -1, 130 },
+{ 0, 5, -1, 134 },
+{ 0, 4, -1, 57 },
+{ 0, 4, -1, 58 },
+{ 0, 4, -1, 123 },
+{ 0, 4, -1, 120 },
+{ 0, 6, 1456, 68 },
+{ 0, 5, 1456, 69 },
+{ 0, 4, -1, 70 },
+{ 0, 6, -1, 92 },
+{ 0, 6, -1, 93 },
+{ 0, 5, -1, 94 },
+{ 0, 5, -1, 71 },
+{ 0, 5, -1, 72 },
+{ 0, 5, -1, 73 },
+{ 0, 5, -1, 74 },
+{ 0, 4, -1, 77 },
+{ 0, 4, -1, 78 },
+{ 0, 4, -1, 79 },
+{ 0, 4, -1, 80 },
+{ 0, 5, 1470, 82 },
+{ 0, 5, 1470, 81 },
+{ 0, 5, -1, 3 },
+{ 0, 5, -1, 4 },
+{ 0, 4, -1, 14 },
+{ 0, 4, -1, 15 },
+{ 0, 4, -1, 16 },
+{ 0, 5, -1, 63 },
+{ 0, 5, -1, 64 },
+{ 0, 5, -1, 61 },
+{ 0, 5, -1, 62 },
+{ 0, 5, -1, 60 },
+{ 0, 5, -1, 59 },
+{ 0, 5, -1, 65 },
+{ 0, 4, -1, 66 },
+{ 0, 4, -1, 67 },
+{ 0, 4, -1, 91 },
+{ 0, 2, -1, 104 },
+{ 0, 4, 1488, 128 },
+{ 0, 4, 1488, 100 },
+{ 0, 4, 1488, 105 },
+{ 0, 3, 1488, 113 },
+{ 0, 4, 1488, 97 },
+{ 0, 4, 1488, 96 },
+{ 0, 4, 1488, 98 },
+{ 0, 4, 1488, 99 },
+{ 0, 4, 1488, 102 },
+{ 0, 4, -1, 124 },
+{ 0, 5, -1, 121 },
+{ 0, 4, -1, 101 },
+{ 0, 5, -1, 117 },
+{ 0, 4, -1, 10 },
+{ 0, 2, -1, 104 },
+{ 0, 4, 1503, 128 },
+{ 0, 7, 1503, 106 },
+{ 0, 7, 1503, 107 },
+{ 0, 7, 1503, 108 },
+{ 0, 5, 1503, 114 },
+{ 0, 4, 1503, 100 },
+{ 0, 4, 1503, 105 },
+{ 0, 3, 1503, 113 },
+{ 0, 5, 1511, 110 },
+{ 0, 5, 1511, 111 },
+{ 0, 5, 1511, 112 },
+{ 0, 4, 1503, 97 },
+{ 0, 4, 1503, 96 },
+{ 0, 4, 1503, 98 },
+{ 0, 4, 1503, 76 },
+{ 0, 4, 1503, 99 },
+{ 0, 4, 1503, 102 },
+{ 0, 2, -1, 20 },
+{ 0, 3, 1521, 18 },
+{ 0, 2, -1, 116 },
+{ 0, 4, 1523, 124 },
+{ 0, 5, 1523, 121 },
+{ 0, 3, 1523, 24 },
+{ 0, 3, 1523, 103 },
+{ 0, 5, 1523, 21 },
+{ 0, 3, 1523, 23 },
+{ 0, 5, 1529, 127 },
+{ 0, 5, 1523, 118 },
+{ 0, 4, 1523, 22 },
+{ 0, 4, 1523, 101 },
+{ 0, 5, 1523, 117 },
+{ 0, 5, 1523, 90 },
+{ 0, 4, -1, 32 },
+{ 0, 4, -1, 33 },
+{ 0, 4, -1, 34 },
+{ 0, 4, -1, 40 },
+{ 0, 4, -1, 39 },
+{ 0, 4, -1, 35 },
+{ 0, 4, -1, 37 },
+{ 0, 4, -1, 36 },
+{ 0, 4, -1, 41 },
+{ 0, 4, -1, 42 },
+{ 0, 4, -1, 43 },
+{ 0, 4, -1, 44 },
+{ 0, 4, -1, 45 },
+{ 0, 4, -1, 38 },
+{ 0, 4, -1, 84 },
+{ 0, 4, -1, 85 },
+{ 0, 4, -1, 122 },
+{ 0, 4, -1, 86 },
+{ 0, 2, -1, 95 },
+{ 0, 3, 1554, 1 },
+{ 0, 3, 1554, 2 },
+{ 0, 3, -1, 104 },
+{ 0, 5, 1557, 128 },
+{ 0, 8, 1557, 106 },
+{ 0, 8, 1557, 107 },
+{ 0, 8, 1557, 108 },
+{ 0, 5, 1557, 47 },
+{ 0, 6, 1557, 114 },
+{ 0, 4, 1557, 46 },
+{ 0, 5, 1557, 100 },
+{ 0, 5, 1557, 105 },
+{ 0, 4, 1557, 113 },
+{ 0, 6, 1567, 110 },
+{ 0, 6, 1567, 111 },
+{ 0, 6, 1567, 112 },
+{ 0, 5, 1557, 97 },
+{ 0, 5, 1557, 96 },
+{ 0, 5, 1557, 98 },
+{ 0, 5, 1557, 76 },
+{ 0, 5, 1557, 99 },
+{ 0, 5, 1557, 102 },
+{ 0, 3, -1, 83 },
+{ 0, 3, -1, 116 },
+{ 0, 5, 1578, 124 },
+{ 0, 6, 1578, 121 },
+{ 0, 4, 1578, 103 },
+{ 0, 6, 1578, 127 },
+{ 0, 6, 1578, 118 },
+{ 0, 5, 1578, 101 },
+{ 0, 6, 1578, 117 },
+{ 0, 6, 1578, 90 },
+{ 0, 4, -1, 115 },
+{ 0, 4, -1, 13 },
+{ 0, 3, -1, 104 },
+{ 0, 5, 1589, 128 },
+{ 0, 4, 1589, 52 },
+{ 0, 5, 1591, 100 },
+{ 0, 5, 1591, 105 },
+{ 0, 4, 1589, 113 },
+{ 0, 5, 1589, 97 },
+{ 0, 5, 1589, 96 },
+{ 0, 5, 1589, 98 },
+{ 0, 5, 1589, 99 },
+{ 0, 5, 1589, 102 },
+{ 0, 3, -1, 119 },
+{ 0, 8, 1600, 110 },
+{ 0, 8, 1600, 111 },
+{ 0, 8, 1600, 112 },
+{ 0, 8, 1600, 106 },
+{ 0, 8, 1600, 107 },
+{ 0, 8, 1600, 108 },
+{ 0, 5, 1600, 116 },
+{ 0, 6, 1600, 114 },
+{ 0, 5, 1600, 25 },
+{ 0, 8, 1609, 121 },
+{ 0, 7, 1609, 100 },
+{ 0, 8, 1609, 117 },
+{ 0, 4, 1600, 51 },
+{ 0, 4, 1600, 13 },
+{ 0, 8, 1614, 110 },
+{ 0, 8, 1614, 111 },
+{ 0, 8, 1614, 112 },
+{ 0, 5, 1600, 70 },
+{ 0, 6, 1600, 115 },
+{ 0, 3, -1, 116 },
+{ 0, 5, 1620, 124 },
+{ 0, 6, 1620, 121 },
+{ 0, 4, 1620, 13 },
+{ 0, 8, 1623, 110 },
+{ 0, 8, 1623, 111 },
+{ 0, 8, 1623, 112 },
+{ 0, 6, 1620, 127 },
+{ 0, 5, 1620, 70 },
+{ 0, 6, 1628, 118 },
+{ 0, 6, 1620, 115 },
+{ 0, 5, 1620, 101 },
+{ 0, 6, 1620, 117 },
+{ 0, 6, 1620, 90 },
+{ 0, 4, -1, 104 },
+{ 0, 6, 1634, 105 },
+{ 0, 5, 1634, 113 },
+{ 0, 7, 1636, 106 },
+{ 0, 7, 1636, 107 },
+{ 0, 7, 1636, 108 },
+{ 0, 6, 1634, 97 },
+{ 0, 6, 1634, 96 },
+{ 0, 6, 1634, 98 },
+{ 0, 6, 1634, 99 },
+{ 0, 4, -1, 116 },
+{ 0, 4, -1, 25 },
+{ 0, 7, 1645, 121 },
+{ 0, 6, 1645, 100 },
+{ 0, 7, 1645, 117 },
+{ 0, 4, -1, 104 },
+{ 0, 6, 1649, 128 },
+{ 0, 9, 1649, 106 },
+{ 0, 9, 1649, 107 },
+{ 0, 9, 1649, 108 },
+{ 0, 7, 1649, 114 },
+{ 0, 6, 1649, 100 },
+{ 0, 6, 1649, 105 },
+{ 0, 5, 1649, 113 },
+{ 0, 6, 1649, 97 },
+{ 0, 6, 1649, 96 },
+{ 0, 6, 1649, 98 },
+{ 0, 6, 1649, 76 },
+{ 0, 6, 1649, 99 },
+{ 0, 6, 1649, 102 },
+{ 0, 4, -1, 116 },
+{ 0, 6, 1664, 124 },
+{ 0, 7, 1664, 121 },
+{ 0, 5, 1664, 103 },
+{ 0, 7, 1664, 127 },
+{ 0, 7, 1664, 118 },
+{ 0, 6, 1664, 101 },
+{ 0, 7, 1664, 117 },
+{ 0, 7, 1664, 90 },
+{ 0, 9, -1, 110 },
+{ 0, 9, -1, 111 },
+{ 0, 9, -1, 112 },
+{ 0, 5, -1, 13 },
+{ 0, 2, -1, 13 },
+{ 0, 3, 1677, 104 },
+{ 0, 5, 1678, 128 },
+{ 0, 5, 1678, 105 },
+{ 0, 4, 1678, 113 },
+{ 0, 5, 1678, 97 },
+{ 0, 5, 1678, 96 },
+{ 0, 5, 1678, 98 },
+{ 0, 5, 1678, 99 },
+{ 0, 5, 1678, 102 },
+{ 0, 5, 1677, 124 },
+{ 0, 6, 1677, 121 },
+{ 0, 5, 1677, 101 },
+{ 0, 6, 1677, 117 },
+{ 0, 3, 1677, 11 },
+{ 0, 4, 1691, 137 },
+{ 0, 4, 1691, 89 },
+{ 0, 3, -1, 120 },
+{ 0, 5, 1694, 68 },
+{ 0, 4, 1694, 69 },
+{ 0, 3, -1, 70 },
+{ 0, 5, -1, 92 },
+{ 0, 5, -1, 93 },
+{ 0, 4, -1, 94 },
+{ 0, 4, -1, 71 },
+{ 0, 4, -1, 72 },
+{ 0, 4, -1, 73 },
+{ 0, 4, -1, 74 },
+{ 0, 4, -1, 13 },
+{ 0, 3, -1, 13 },
+{ 0, 3, -1, 77 },
+{ 0, 3, -1, 78 },
+{ 0, 3, -1, 79 },
+{ 0, 3, -1, 80 },
+{ 0, 4, -1, 3 },
+{ 0, 4, -1, 4 },
+{ 0, 2, -1, 161 },
+{ 0, 4, 1713, 128 },
+{ 0, 4, 1713, 155 },
+{ 0, 4, 1713, 156 },
+{ 0, 3, 1713, 160 },
+{ 0, 4, 1713, 144 },
+{ 0, 4, 1713, 145 },
+{ 0, 4, 1713, 146 },
+{ 0, 4, 1713, 147 },
+{ 0, 2, -1, 163 },
+{ 0, 7, 1722, 141 },
+{ 0, 7, 1722, 142 },
+{ 0, 7, 1722, 143 },
+{ 0, 7, 1722, 138 },
+{ 0, 7, 1722, 139 },
+{ 0, 7, 1722, 140 },
+{ 0, 4, 1722, 162 },
+{ 0, 5, 1722, 150 },
+{ 0, 4, 1722, 157 },
+{ 0, 7, 1731, 121 },
+{ 0, 6, 1731, 155 },
+{ 0, 3, 1722, 164 },
+{ 0, 7, 1734, 141 },
+{ 0, 7, 1734, 142 },
+{ 0, 7, 1734, 143 },
+{ 0, 4, 1722, 153 },
+{ 0, 5, 1722, 136 },
+{ 0, 2, -1, 162 },
+{ 0, 4, 1740, 124 },
+{ 0, 5, 1740, 121 },
+{ 0, 3, 1740, 158 },
+{ 0, 5, 1740, 127 },
+{ 0, 5, 1740, 149 },
+{ 0, 2, -1, 104 },
+{ 0, 4, 1746, 128 },
+{ 0, 7, 1746, 106 },
+{ 0, 7, 1746, 107 },
+{ 0, 7, 1746, 108 },
+{ 0, 5, 1746, 114 },
+{ 0, 4, 1746, 100 },
+{ 0, 4, 1746, 105 },
+{ 0, 3, 1746, 113 },
+{ 0, 5, 1754, 110 },
+{ 0, 5, 1754, 111 },
+{ 0, 5, 1754, 112 },
+{ 0, 4, 1746, 97 },
+{ 0, 4, 1746, 96 },
+{ 0, 4, 1746, 98 },
+{ 0, 6, 1760, 100 },
+{ 0, 4, 1746, 76 },
+{ 0, 4, 1746, 99 },
+{ 0, 4, 1746, 102 },
+{ 0, 2, -1, 116 },
+{ 0, 4, 1765, 124 },
+{ 0, 5, 1765, 121 },
+{ 0, 5, 1765, 127 },
+{ 0, 5, 1765, 118 },
+{ 0, 4, 1765, 101 },
+{ 0, 5, 1765, 117 },
+{ 0, 5, 1765, 90 },
+{ 0, 3, -1, 13 },
+{ 0, 6, -1, 110 },
+{ 0, 6, -1, 111 },
+{ 0, 6, -1, 112 },
+{ 0, 2, -1, 20 },
+{ 0, 4, 1777, 19 },
+{ 0, 3, 1777, 18 },
+{ 0, 3, -1, 104 },
+{ 0, 5, 1780, 128 },
+{ 0, 8, 1780, 106 },
+{ 0, 8, 1780, 107 },
+{ 0, 8, 1780, 108 },
+{ 0, 6, 1780, 114 },
+{ 0, 5, 1780, 100 },
+{ 0, 5, 1780, 105 },
+{ 0, 5, 1780, 97 },
+{ 0, 5, 1780, 96 },
+{ 0, 5, 1780, 98 },
+{ 0, 5, 1780, 76 },
+{ 0, 5, 1780, 99 },
+{ 0, 5, 1780, 102 },
+{ 0, 3, -1, 104 },
+{ 0, 4, 1794, 26 },
+{ 0, 5, 1795, 128 },
+{ 0, 4, 1794, 30 },
+{ 0, 4, 1794, 31 },
+{ 0, 5, 1798, 100 },
+{ 0, 5, 1798, 105 },
+{ 0, 4, 1794, 113 },
+{ 0, 6, 1801, 106 },
+{ 0, 6, 1801, 107 },
+{ 0, 6, 1801, 108 },
+{ 0, 5, 1794, 97 },
+{ 0, 5, 1794, 96 },
+{ 0, 5, 1794, 98 },
+{ 0, 5, 1794, 99 },
+{ 0, 4, 1794, 28 },
+{ 0, 4, 1794, 27 },
+{ 0, 5, 1810, 102 },
+{ 0, 4, 1794, 29 },
+{ 0, 3, -1, 116 },
+{ 0, 4, 1813, 32 },
+{ 0, 4, 1813, 33 },
+{ 0, 4, 1813, 34 },
+{ 0, 4, 1813, 40 },
+{ 0, 4, 1813, 39 },
+{ 0, 6, 1813, 84 },
+{ 0, 6, 1813, 85 },
+{ 0, 6, 1813, 122 },
+{ 0, 6, 1813, 86 },
+{ 0, 4, 1813, 95 },
+{ 0, 4, 1813, 24 },
+{ 0, 5, 1824, 83 },
+{ 0, 4, 1813, 37 },
+{ 0, 4, 1813, 13 },
+{ 0, 6, 1827, 9 },
+{ 0, 6, 1827, 6 },
+{ 0, 6, 1827, 7 },
+{ 0, 6, 1827, 8 },
+{ 0, 6, 1827, 5 },
+{ 0, 4, 1813, 41 },
+{ 0, 4, 1813, 42 },
+{ 0, 6, 1834, 21 },
+{ 0, 4, 1813, 23 },
+{ 0, 5, 1836, 123 },
+{ 0, 4, 1813, 44 },
+{ 0, 5, 1838, 120 },
+{ 0, 5, 1838, 22 },
+{ 0, 5, 1813, 77 },
+{ 0, 5, 1813, 78 },
+{ 0, 5, 1813, 79 },
+{ 0, 5, 1813, 80 },
+{ 0, 4, 1813, 45 },
+{ 0, 5, 1813, 91 },
+{ 0, 4, 1813, 38 },
+{ 0, 4, -1, 84 },
+{ 0, 4, -1, 85 },
+{ 0, 4, -1, 122 },
+{ 0, 4, -1, 86 },
+{ 0, 3, -1, 25 },
+{ 0, 6, 1852, 121 },
+{ 0, 5, 1852, 100 },
+{ 0, 6, 1852, 117 },
+{ 0, 2, -1, 95 },
+{ 0, 3, 1856, 1 },
+{ 0, 3, 1856, 2 },
+{ 0, 3, -1, 104 },
+{ 0, 5, 1859, 47 },
+{ 0, 4, 1859, 46 },
+{ 0, 3, -1, 83 },
+{ 0, 3, -1, 116 },
+{ 0, 5, 1863, 48 },
+{ 0, 3, -1, 50 },
+{ 0, 4, -1, 52 },
+{ 0, 5, -1, 124 },
+{ 0, 5, -1, 125 },
+{ 0, 5, -1, 126 },
+{ 0, 8, -1, 84 },
+{ 0, 8, -1, 85 },
+{ 0, 8, -1, 122 },
+{ 0, 8, -1, 86 },
+{ 0, 6, -1, 95 },
+{ 0, 7, 1874, 1 },
+{ 0, 7, 1874, 2 },
+{ 0, 7, -1, 83 },
+{ 0, 6, -1, 13 },
+{ 0, 7, -1, 123 },
+{ 0, 7, -1, 120 },
+{ 0, 9, -1, 92 },
+{ 0, 9, -1, 93 },
+{ 0, 8, -1, 94 },
+{ 0, 7, -1, 77 },
+{ 0, 7, -1, 78 },
+{ 0, 7, -1, 79 },
+{ 0, 7, -1, 80 },
+{ 0, 7, -1, 91 },
+{ 0, 6, -1, 84 },
+{ 0, 6, -1, 85 },
+{ 0, 6, -1, 122 },
+{ 0, 6, -1, 86 },
+{ 0, 4, -1, 95 },
+{ 0, 5, 1893, 1 },
+{ 0, 5, 1893, 2 },
+{ 0, 4, -1, 51 },
+{ 0, 5, 1896, 83 },
+{ 0, 4, -1, 13 },
+{ 0, 5, 1898, 10 },
+{ 0, 5, 1898, 87 },
+{ 0, 5, 1898, 159 },
+{ 0, 5, 1898, 88 },
+{ 0, 5, -1, 123 },
+{ 0, 5, -1, 120 },
+{ 0, 7, -1, 92 },
+{ 0, 7, -1, 93 },
+{ 0, 6, -1, 94 },
+{ 0, 5, -1, 77 },
+{ 0, 5, -1, 78 },
+{ 0, 5, -1, 79 },
+{ 0, 5, -1, 80 },
+{ 0, 5, -1, 14 },
+{ 0, 5, -1, 15 },
+{ 0, 5, -1, 16 },
+{ 0, 5, -1, 91 },
+{ 0, 5, -1, 124 },
+{ 0, 5, -1, 125 },
+{ 0, 5, -1, 126 },
+{ 0, 6, -1, 84 },
+{ 0, 6, -1, 85 },
+{ 0, 6, -1, 122 },
+{ 0, 6, -1, 86 },
+{ 0, 4, -1, 95 },
+{ 0, 5, 1923, 1 },
+{ 0, 5, 1923, 2 },
+{ 0, 5, -1, 83 },
+{ 0, 4, -1, 13 },
+{ 0, 6, 1927, 137 },
+{ 0, 6, 1927, 89 },
+{ 0, 5, -1, 123 },
+{ 0, 5, -1, 120 },
+{ 0, 7, -1, 92 },
+{ 0, 7, -1, 93 },
+{ 0, 6, -1, 94 },
+{ 0, 5, -1, 77 },
+{ 0, 5, -1, 78 },
+{ 0, 5, -1, 79 },
+{ 0, 5, -1, 80 },
+{ 0, 5, -1, 14 },
+{ 0, 5, -1, 15 },
+{ 0, 5, -1, 16 },
+{ 0, 5, -1, 91 },
+{ 0, 2, -1, 13 },
+{ 0, 3, 1943, 10 },
+{ 0, 6, 1944, 110 },
+{ 0, 6, 1944, 111 },
+{ 0, 6, 1944, 112 },
+{ 0, 3, 1943, 11 },
+{ 0, 4, 1948, 137 },
+{ 0, 5, 1948, 10 },
+{ 0, 4, 1948, 89 },
+{ 0, 3, 1943, 12 },
+{ 0, 3, -1, 53 },
+{ 0, 3, -1, 54 },
+{ 0, 3, -1, 55 },
+{ 0, 3, -1, 56 },
+{ 0, 4, -1, 135 },
+{ 0, 4, -1, 131 },
+{ 0, 4, -1, 129 },
+{ 0, 4, -1, 133 },
+{ 0, 4, -1, 132 },
+{ 0, 4, -1, 130 },
+{ 0, 4, -1, 134 },
+{ 0, 3, -1, 57 },
+{ 0, 3, -1, 58 },
+{ 0, 3, -1, 123 },
+{ 0, 3, -1, 120 },
+{ 0, 5, 1967, 68 },
+{ 0, 4, 1967, 69 },
+{ 0, 3, -1, 70 },
+{ 0, 5, -1, 92 },
+{ 0, 5, -1, 93 },
+{ 0, 4, -1, 94 },
+{ 0, 4, -1, 71 },
+{ 0, 4, -1, 72 },
+{ 0, 4, -1, 73 },
+{ 0, 4, -1, 74 },
+{ 0, 4, -1, 75 },
+{ 0, 3, -1, 77 },
+{ 0, 3, -1, 78 },
+{ 0, 3, -1, 79 },
+{ 0, 3, -1, 80 },
+{ 0, 4, 1982, 82 },
+{ 0, 4, 1982, 81 },
+{ 0, 4, -1, 3 },
+{ 0, 4, -1, 4 },
+{ 0, 4, -1, 63 },
+{ 0, 4, -1, 64 },
+{ 0, 4, -1, 61 },
+{ 0, 4, -1, 62 },
+{ 0, 4, -1, 60 },
+{ 0, 4, -1, 59 },
+{ 0, 4, -1, 65 },
+{ 0, 3, -1, 66 },
+{ 0, 3, -1, 67 },
+{ 0, 3, -1, 91 },
+{ 0, 4, -1, 97 },
+{ 0, 4, -1, 96 },
+{ 0, 4, -1, 98 },
+{ 0, 4, -1, 99 },
+{ 0, 3, -1, 95 },
+{ 0, 2, -1, 104 },
+{ 0, 4, 2002, 100 },
+{ 0, 4, 2002, 105 },
+{ 0, 3, 2002, 113 },
+{ 0, 4, 2002, 97 },
+{ 0, 4, 2002, 96 },
+{ 0, 4, 2002, 98 },
+{ 0, 4, 2002, 99 },
+{ 0, 4, 2002, 102 },
+{ 0, 2, -1, 119 },
+{ 0, 7, 2011, 110 },
+{ 0, 7, 2011, 111 },
+{ 0, 7, 2011, 112 },
+{ 0, 7, 2011, 106 },
+{ 0, 7, 2011, 107 },
+{ 0, 7, 2011, 108 },
+{ 0, 4, 2011, 116 },
+{ 0, 5, 2011, 114 },
+{ 0, 4, 2011, 25 },
+{ 0, 6, 2020, 100 },
+{ 0, 7, 2020, 117 },
+{ 0, 3, 2011, 13 },
+{ 0, 7, 2023, 110 },
+{ 0, 7, 2023, 111 },
+{ 0, 7, 2023, 112 },
+{ 0, 4, 2011, 70 },
+{ 0, 5, 2011, 115 },
+{ 0, 2, -1, 116 },
+{ 0, 3, 2029, 103 },
+{ 0, 5, 2029, 118 },
+{ 0, 4, 2029, 101 },
+{ 0, 5, 2029, 117 },
+{ 0, 5, 2029, 90 }
+};
+
+
+static const struct among a_3[26] =
+{
+{ 0, 1, -1, 1 },
+{ 0, 3, 0, 1 },
+{ 0, 3, 0, 1 },
+{ 0, 3, 0, 1 },
+{ 0, 3, 0, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 6, 1 },
+{ 0, 4, 6, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 3, 11, 1 },
+{ 0, 3, 11, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 4, -1, 1 },
+{ 0, 2, -1, 1 },
+{ 0, 4, 18, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 3, 20, 1 },
+{ 0, 3, 20, 1 },
+{ 0, 3, -1, 1 },
+{ 0, 1, -1, 1 },
+{ 0, 3, 24, 1 }
+};
+
+static const unsigned char g_v[] = { 17, 65, 16 };
+
+static const unsigned char g_sa[] = { 65, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 128 };
+
+static const unsigned char g_ca[] = { 119, 95, 23, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 32, 136, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 0, 0, 0, 16 };
+
+static const unsigned char g_rg[] = { 1 };
+
+
+static int find_among_0(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->l - z->c;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[0]) {
+            case 0x430:
+                i = 0;
+                break;
+            case 0x431:
+                i = 1;
+                break;
+            case 0x432:
+                i = 2;
+                break;
+            case 0x433:
+                i = 3;
+                break;
+            case 0x434:
+                i = 4;
+                break;
+            case 0x435:
+                i = 5;
+                break;
+            case 0x436:
+                i = 6;
+                break;
+            case 0x437:
+                i = 7;
+                break;
+            case 0x438:
+                i = 8;
+                break;
+            case 0x43A:
+                i = 9;
+                break;
+            case 0x43B:
+                i = 10;
+                break;
+            case 0x43C:
+                i = 11;
+                break;
+            case 0x43D:
+                i = 12;
+                break;
+            case 0x43E:
+                i = 13;
+                break;
+            case 0x43F:
+                i = 14;
+                break;
+            case 0x440:
+                i = 15;
+                break;
+            case 0x441:
+                i = 16;
+                break;
+            case 0x442:
+                i = 17;
+                break;
+            case 0x443:
+                i = 18;
+                break;
+            case 0x444:
+                i = 19;
+                break;
+            case 0x445:
+                i = 20;
+                break;
+            case 0x446:
+                i = 21;
+                break;
+            case 0x447:
+                i = 22;
+                break;
+            case 0x448:
+                i = 23;
+                break;
+            case 0x452:
+                i = 24;
+                break;
+            case 0x458:
+                i = 25;
+                break;
+            case 0x459:
+                i = 26;
+                break;
+            case 0x45A:
+                i = 27;
+                break;
+            case 0x45B:
+                i = 28;
+                break;
+            case 0x45F:
+                i = 29;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c + a_0[i].s_size;
+    return a_0[i].result;
+}
+static const symbol s_0[] = { 'a' };
+static const symbol s_1[] = { 'b' };
+static const symbol s_2[] = { 'v' };
+static const symbol s_3[] = { 'g' };
+static const symbol s_4[] = { 'd' };
+static const symbol s_5[] = { 0x111 };
+static const symbol s_6[] = { 'e' };
+static const symbol s_7[] = { 0x17E };
+static const symbol s_8[] = { 'z' };
+static const symbol s_9[] = { 'i' };
+static const symbol s_10[] = { 'j' };
+static const symbol s_11[] = { 'k' };
+static const symbol s_12[] = { 'l' };
+static const symbol s_13[] = { 'l', 'j' };
+static const symbol s_14[] = { 'm' };
+static const symbol s_15[] = { 'n' };
+static const symbol s_16[] = { 'n', 'j' };
+static const symbol s_17[] = { 'o' };
+static const symbol s_18[] = { 'p' };
+static const symbol s_19[] = { 'r' };
+static const symbol s_20[] = { 's' };
+static const symbol s_21[] = { 't' };
+static const symbol s_22[] = { 0x107 };
+static const symbol s_23[] = { 'u' };
+static const symbol s_24[] = { 'f' };
+static const symbol s_25[] = { 'h' };
+static const symbol s_26[] = { 'c' };
+static const symbol s_27[] = { 0x10D };
+static const symbol s_28[] = { 'd', 0x17E };
+static const symbol s_29[] = { 0x161 };
+static const symbol s_30[] = { 'i', 'j', 'e' };
+static const symbol s_31[] = { 'e' };
+static const symbol s_32[] = { 'j', 'e' };
+static const symbol s_33[] = { 'e' };
+static const symbol s_34[] = { 'd', 'j' };
+static const symbol s_35[] = { 0x111 };
+
+static int find_among_b_1(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'b':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'd') break;
+                        i = 0;
+                        break;
+                    case 'c':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1;
+                                                break;
+                                            case 'e':
+                                                i = 2;
+                                                break;
+                                            case 'l':
+                                                i = 3;
+                                                break;
+                                            case 'n':
+                                                i = 4;
+                                                break;
+                                            case 'o':
+                                                i = 5;
+                                                break;
+                                        }
+                                        break;
+                                    case 'l':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 6;
+                                                break;
+                                            case 'e':
+                                                i = 7;
+                                                break;
+                                            case 'o':
+                                                i = 8;
+                                                break;
+                                        }
+                                        break;
+                                    case 'm':
+                                        i = 9;
+                                        break;
+                                    case 'n':
+                                        i = 10;
+                                        break;
+                                    case 'r':
+                                        i = 11;
+                                        break;
+                                    case 's':
+                                        i = 12;
+                                        break;
+                                    case 'v':
+                                        i = 13;
+                                        break;
+                                    case 0x161:
+                                        i = 14;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 15;
+                                break;
+                        }
+                        break;
+                    case 'k':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'c':
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 16;
+                                break;
+                            case 'j':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 17;
+                                        break;
+                                    case 'o':
+                                        i = 18;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 19;
+                                break;
+                            case 't':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 20;
+                                        break;
+                                    case 'e':
+                                        i = 21;
+                                        break;
+                                    case 'i':
+                                        i = 22;
+                                        break;
+                                    case 'o':
+                                        i = 23;
+                                        break;
+                                    case 'u':
+                                        i = 24;
+                                        break;
+                                }
+                                break;
+                            case 0x10D:
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 25;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 26;
+                                        break;
+                                    case 'z':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 27;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'j') break;
+                                                i = 28;
+                                                break;
+                                            case 'i':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'n':
+                                                        i = 29;
+                                                        break;
+                                                    case 't':
+                                                        i = 30;
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'e') break;
+                                                        if (n <= 7) break;
+                                                        if (q[-8] != 't') break;
+                                                        i = 31;
+                                                        break;
+                                                    case 'z':
+                                                        i = 32;
+                                                        break;
+                                                }
+                                                break;
+                                            case 't':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 33;
+                                                        break;
+                                                    case 'u':
+                                                        i = 34;
+                                                        break;
+                                                }
+                                                break;
+                                            case 0x10D:
+                                                i = 35;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'p') break;
+                                        i = 36;
+                                        break;
+                                    case 'z':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 37;
+                                                break;
+                                            case 'o':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 38;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        switch (q[-5]) {
+                            case 'e':
+                                if (n <= 5) break;
+                                if (q[-6] != 'm') break;
+                                i = 39;
+                                break;
+                            case 'n':
+                                if (n <= 5) break;
+                                if (q[-6] != 'e') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 'c') break;
+                                i = 40;
+                                break;
+                            case 's':
+                                if (n <= 5) break;
+                                if (q[-6] != 'i') break;
+                                i = 41;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'k':
+                                if (n <= 4) break;
+                                if (q[-5] != 'e') break;
+                                i = 42;
+                                break;
+                            case 'n':
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 43;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 's') break;
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 'n':
+                                i = 44;
+                                break;
+                            case 'u':
+                                if (n <= 6) break;
+                                if (q[-7] != 'k') break;
+                                i = 45;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'c':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'j':
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 46;
+                                break;
+                            case 'e':
+                                i = 47;
+                                break;
+                            case 'l':
+                                i = 48;
+                                break;
+                            case 'n':
+                                i = 49;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 50;
+                                break;
+                            case 'o':
+                                i = 51;
+                                break;
+                        }
+                        break;
+                    case 'l':
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 52;
+                                break;
+                            case 'e':
+                                i = 53;
+                                break;
+                            case 'o':
+                                i = 54;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        i = 55;
+                        break;
+                    case 'n':
+                        i = 56;
+                        break;
+                    case 'r':
+                        i = 57;
+                        break;
+                    case 's':
+                        i = 58;
+                        break;
+                    case 'v':
+                        i = 59;
+                        break;
+                    case 0x161:
+                        i = 60;
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'b':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'j') break;
+                        i = 61;
+                        break;
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 'l') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'o') break;
+                        i = 62;
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'u') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'k') break;
+                        i = 63;
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'r':
+                                i = 64;
+                                break;
+                            case 's':
+                                i = 65;
+                                break;
+                            case 0x161:
+                                i = 66;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        i = 67;
+                                        break;
+                                    case 'j':
+                                        i = 68;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'e':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'v') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 't') break;
+                                                i = 69;
+                                                break;
+                                            case 's':
+                                                i = 70;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        i = 71;
+                                        break;
+                                }
+                                break;
+                            case 'j':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'b':
+                                        i = 72;
+                                        break;
+                                    case 'v':
+                                        i = 73;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'j') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'o') break;
+                                i = 74;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 75;
+                                        break;
+                                    case 'i':
+                                        i = 76;
+                                        break;
+                                    case 'u':
+                                        i = 77;
+                                        break;
+                                }
+                                break;
+                            case 0x10D:
+                                i = 78;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'p') break;
+                        i = 79;
+                        break;
+                    case 'z':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'n':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 80;
+                                break;
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 'l') break;
+                                i = 81;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'k':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'c':
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 82;
+                        break;
+                    case 's':
+                        if (n <= 3) break;
+                        if (q[-4] != 'u') break;
+                        i = 83;
+                        break;
+                    case 't':
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 84;
+                                break;
+                            case 'e':
+                                i = 85;
+                                break;
+                            case 'i':
+                                i = 86;
+                                break;
+                            case 'o':
+                                i = 87;
+                                break;
+                            case 'u':
+                                i = 88;
+                                break;
+                        }
+                        break;
+                    case 0x10D:
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 89;
+                        break;
+                    case 0x161:
+                        if (n <= 3) break;
+                        if (q[-4] != 'u') break;
+                        i = 90;
+                        break;
+                }
+                break;
+            case 'm':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                if (n <= 2) break;
+                if (q[-3] != 'z') break;
+                if (n <= 3) break;
+                if (q[-4] != 'i') break;
+                i = 91;
+                break;
+            case 'n':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'c':
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 't') break;
+                        i = 92;
+                        break;
+                    case 'j':
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'c':
+                                        i = 93;
+                                        break;
+                                    case 0x10D:
+                                        i = 94;
+                                        break;
+                                }
+                                break;
+                            case 'l':
+                                if (n <= 4) break;
+                                if (q[-5] != 'o') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 'v') break;
+                                i = 95;
+                                break;
+                        }
+                        break;
+                    case 'k':
+                        if (n <= 3) break;
+                        if (q[-4] != 's') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 'e') break;
+                        i = 96;
+                        break;
+                    case 'l':
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 97;
+                                break;
+                            case 'i':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'b':
+                                        i = 98;
+                                        break;
+                                    case 'g':
+                                        i = 99;
+                                        break;
+                                    case 'n':
+                                        i = 100;
+                                        break;
+                                    case 'r':
+                                        i = 101;
+                                        break;
+                                    case 's':
+                                        i = 102;
+                                        break;
+                                    case 't':
+                                        i = 103;
+                                        break;
+                                    case 'v':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'a') break;
+                                        i = 104;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                if (n <= 4) break;
+                                if (q[-5] != 'l') break;
+                                i = 105;
+                                break;
+                            case 'e':
+                                i = 106;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 107;
+                                break;
+                            case 'e':
+                                i = 108;
+                                break;
+                            case 'u':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'd':
+                                        i = 109;
+                                        break;
+                                    case 'k':
+                                        i = 110;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 111;
+                                break;
+                            case 'e':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'l':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'p') break;
+                                        i = 112;
+                                        break;
+                                    case 't':
+                                        i = 113;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 114;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'r':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'p') break;
+                                        i = 115;
+                                        break;
+                                    case 't':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        i = 116;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 's':
+                                        i = 117;
+                                        break;
+                                    case 't':
+                                        i = 118;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'z':
+                        if (n <= 3) break;
+                        if (q[-4] != 'o') break;
+                        i = 119;
+                        break;
+                    case 0x10D:
+                        if (n <= 3) break;
+                        if (q[-4] != 'i') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 't') break;
+                        i = 120;
+                        break;
+                    case 0x161:
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 121;
+                                break;
+                            case 'u':
+                                if (n <= 4) break;
+                                if (q[-5] != 'd') break;
+                                i = 122;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'r':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                if (n <= 2) break;
+                if (q[-3] != 't') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'e':
+                        if (n <= 4) break;
+                        if (q[-5] != 'm') break;
+                        i = 123;
+                        break;
+                    case 'n':
+                        if (n <= 4) break;
+                        if (q[-5] != 'e') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 'c') break;
+                        i = 124;
+                        break;
+                    case 's':
+                        if (n <= 4) break;
+                        if (q[-5] != 'i') break;
+                        i = 125;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 'a') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'k':
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 126;
+                        break;
+                    case 'n':
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 127;
+                        break;
+                }
+                break;
+            case 'u':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        if (q[-3] != 's') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'o') break;
+                        i = 128;
+                        break;
+                    case 0x107:
+                        if (n <= 2) break;
+                        if (q[-3] != 0x161) break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'o') break;
+                        i = 129;
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_1[i].s_size;
+    return a_1[i].result;
+}
+static const symbol s_36[] = { 'l', 'o', 'g', 'a' };
+static const symbol s_37[] = { 'p', 'e', 'h' };
+static const symbol s_38[] = { 'v', 'o', 'j', 'k', 'a' };
+static const symbol s_39[] = { 'b', 'o', 'j', 'k', 'a' };
+static const symbol s_40[] = { 'j', 'a', 'k' };
+static const symbol s_41[] = { 0x10D, 'a', 'j', 'n', 'i' };
+static const symbol s_42[] = { 'c', 'a', 'j', 'n', 'i' };
+static const symbol s_43[] = { 'e', 'r', 'n', 'i' };
+static const symbol s_44[] = { 'l', 'a', 'r', 'n', 'i' };
+static const symbol s_45[] = { 'e', 's', 'n', 'i' };
+static const symbol s_46[] = { 'a', 'n', 'j', 'c', 'a' };
+static const symbol s_47[] = { 'a', 'j', 'c', 'a' };
+static const symbol s_48[] = { 'l', 'j', 'c', 'a' };
+static const symbol s_49[] = { 'e', 'j', 'c', 'a' };
+static const symbol s_50[] = { 'o', 'j', 'c', 'a' };
+static const symbol s_51[] = { 'a', 'j', 'k', 'a' };
+static const symbol s_52[] = { 'o', 'j', 'k', 'a' };
+static const symbol s_53[] = { 0x161, 'c', 'a' };
+static const symbol s_54[] = { 'i', 'n', 'g' };
+static const symbol s_55[] = { 't', 'v', 'e', 'n', 'i', 'k' };
+static const symbol s_56[] = { 't', 'e', 't', 'i', 'k', 'a' };
+static const symbol s_57[] = { 'n', 's', 't', 'v', 'a' };
+static const symbol s_58[] = { 'n', 'i', 'k' };
+static const symbol s_59[] = { 't', 'i', 'k' };
+static const symbol s_60[] = { 'z', 'i', 'k' };
+static const symbol s_61[] = { 's', 'n', 'i', 'k' };
+static const symbol s_62[] = { 'k', 'u', 's', 'i' };
+static const symbol s_63[] = { 'k', 'u', 's', 'n', 'i' };
+static const symbol s_64[] = { 'k', 'u', 's', 't', 'v', 'a' };
+static const symbol s_65[] = { 'd', 'u', 0x161, 'n', 'i' };
+static const symbol s_66[] = { 'd', 'u', 's', 'n', 'i' };
+static const symbol s_67[] = { 'a', 'n', 't', 'n', 'i' };
+static const symbol s_68[] = { 'b', 'i', 'l', 'n', 'i' };
+static const symbol s_69[] = { 't', 'i', 'l', 'n', 'i' };
+static const symbol s_70[] = { 'a', 'v', 'i', 'l', 'n', 'i' };
+static const symbol s_71[] = { 's', 'i', 'l', 'n', 'i' };
+static const symbol s_72[] = { 'g', 'i', 'l', 'n', 'i' };
+static const symbol s_73[] = { 'r', 'i', 'l', 'n', 'i' };
+static const symbol s_74[] = { 'n', 'i', 'l', 'n', 'i' };
+static const symbol s_75[] = { 'a', 'l', 'n', 'i' };
+static const symbol s_76[] = { 'o', 'z', 'n', 'i' };
+static const symbol s_77[] = { 'r', 'a', 'v', 'i' };
+static const symbol s_78[] = { 's', 't', 'a', 'v', 'n', 'i' };
+static const symbol s_79[] = { 'p', 'r', 'a', 'v', 'n', 'i' };
+static const symbol s_80[] = { 't', 'i', 'v', 'n', 'i' };
+static const symbol s_81[] = { 's', 'i', 'v', 'n', 'i' };
+static const symbol s_82[] = { 'a', 't', 'n', 'i' };
+static const symbol s_83[] = { 'e', 'n', 't', 'a' };
+static const symbol s_84[] = { 't', 'e', 't', 'n', 'i' };
+static const symbol s_85[] = { 'p', 'l', 'e', 't', 'n', 'i' };
+static const symbol s_86[] = { 0x161, 'a', 'v', 'i' };
+static const symbol s_87[] = { 's', 'a', 'v', 'i' };
+static const symbol s_88[] = { 'a', 'n', 't', 'a' };
+static const symbol s_89[] = { 'a', 0x10D, 'k', 'a' };
+static const symbol s_90[] = { 'a', 'c', 'k', 'a' };
+static const symbol s_91[] = { 'u', 0x161, 'k', 'a' };
+static const symbol s_92[] = { 'u', 's', 'k', 'a' };
+static const symbol s_93[] = { 'a', 't', 'k', 'a' };
+static const symbol s_94[] = { 'e', 't', 'k', 'a' };
+static const symbol s_95[] = { 'i', 't', 'k', 'a' };
+static const symbol s_96[] = { 'o', 't', 'k', 'a' };
+static const symbol s_97[] = { 'u', 't', 'k', 'a' };
+static const symbol s_98[] = { 'e', 's', 'k', 'n', 'a' };
+static const symbol s_99[] = { 't', 'i', 0x10D, 'n', 'i' };
+static const symbol s_100[] = { 't', 'i', 'c', 'n', 'i' };
+static const symbol s_101[] = { 'o', 'j', 's', 'k', 'a' };
+static const symbol s_102[] = { 'e', 's', 'm', 'a' };
+static const symbol s_103[] = { 'm', 'e', 't', 'r', 'a' };
+static const symbol s_104[] = { 'c', 'e', 'n', 't', 'r', 'a' };
+static const symbol s_105[] = { 'i', 's', 't', 'r', 'a' };
+static const symbol s_106[] = { 'o', 's', 't', 'i' };
+static const symbol s_107[] = { 'o', 's', 't', 'i' };
+static const symbol s_108[] = { 'd', 'b', 'a' };
+static const symbol s_109[] = { 0x10D, 'k', 'a' };
+static const symbol s_110[] = { 'm', 'c', 'a' };
+static const symbol s_111[] = { 'n', 'c', 'a' };
+static const symbol s_112[] = { 'v', 'o', 'l', 'j', 'n', 'i' };
+static const symbol s_113[] = { 'a', 'n', 'k', 'i' };
+static const symbol s_114[] = { 'v', 'c', 'a' };
+static const symbol s_115[] = { 's', 'c', 'a' };
+static const symbol s_116[] = { 'r', 'c', 'a' };
+static const symbol s_117[] = { 'a', 'l', 'c', 'a' };
+static const symbol s_118[] = { 'e', 'l', 'c', 'a' };
+static const symbol s_119[] = { 'o', 'l', 'c', 'a' };
+static const symbol s_120[] = { 'n', 'j', 'c', 'a' };
+static const symbol s_121[] = { 'e', 'k', 't', 'a' };
+static const symbol s_122[] = { 'i', 'z', 'm', 'a' };
+static const symbol s_123[] = { 'j', 'e', 'b', 'i' };
+static const symbol s_124[] = { 'b', 'a', 'c', 'i' };
+static const symbol s_125[] = { 'a', 0x161, 'n', 'i' };
+static const symbol s_126[] = { 'a', 's', 'n', 'i' };
+
+static int find_among_b_2(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 0;
+                                break;
+                            case 'e':
+                                i = 1;
+                                break;
+                            case 'u':
+                                i = 2;
+                                break;
+                        }
+                        break;
+                    case 'g':
+                        i = 3;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 4;
+                                                break;
+                                            case 'e':
+                                                i = 5;
+                                                break;
+                                            case 'u':
+                                                i = 6;
+                                                break;
+                                        }
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'i':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'j':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'n') break;
+                                                        if (n <= 7) break;
+                                                        switch (q[-8]) {
+                                                            case 'a':
+                                                                i = 7;
+                                                                break;
+                                                            case 'e':
+                                                                i = 8;
+                                                                break;
+                                                            case 's':
+                                                                i = 9;
+                                                                break;
+                                                            case 0x161:
+                                                                i = 10;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'k':
+                                                        i = 11;
+                                                        if (n <= 6) break;
+                                                        switch (q[-7]) {
+                                                            case 's':
+                                                                i = 12;
+                                                                break;
+                                                            case 0x161:
+                                                                i = 13;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'l':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'e') break;
+                                                        i = 14;
+                                                        break;
+                                                    case 'n':
+                                                        i = 15;
+                                                        break;
+                                                    case 's':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'o') break;
+                                                        i = 16;
+                                                        break;
+                                                    case 't':
+                                                        if (n <= 6) break;
+                                                        switch (q[-7]) {
+                                                            case 'a':
+                                                                i = 17;
+                                                                break;
+                                                            case 'i':
+                                                                if (n <= 7) break;
+                                                                if (q[-8] != 'v') break;
+                                                                if (n <= 8) break;
+                                                                switch (q[-9]) {
+                                                                    case 'e':
+                                                                        i = 18;
+                                                                        break;
+                                                                    case 'o':
+                                                                        i = 19;
+                                                                        break;
+                                                                }
+                                                                break;
+                                                            case 's':
+                                                                if (n <= 7) break;
+                                                                if (q[-8] != 'a') break;
+                                                                i = 20;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'v':
+                                                        if (n <= 6) break;
+                                                        switch (q[-7]) {
+                                                            case 'a':
+                                                                i = 21;
+                                                                break;
+                                                            case 'e':
+                                                                i = 22;
+                                                                break;
+                                                            case 'i':
+                                                                i = 23;
+                                                                break;
+                                                            case 'o':
+                                                                i = 24;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 0x161:
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'o') break;
+                                                        i = 25;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 26;
+                                                        break;
+                                                    case 'e':
+                                                        i = 27;
+                                                        break;
+                                                    case 's':
+                                                        i = 28;
+                                                        break;
+                                                    case 0x161:
+                                                        i = 29;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'k':
+                                        i = 30;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 's':
+                                                i = 31;
+                                                break;
+                                            case 0x161:
+                                                i = 32;
+                                                break;
+                                        }
+                                        break;
+                                    case 'l':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 33;
+                                        break;
+                                    case 'n':
+                                        i = 34;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 35;
+                                                break;
+                                            case 'e':
+                                                i = 36;
+                                                break;
+                                            case 's':
+                                                i = 37;
+                                                break;
+                                            case 0x161:
+                                                i = 38;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 39;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 40;
+                                                break;
+                                            case 'i':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'v') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'e':
+                                                        i = 41;
+                                                        break;
+                                                    case 'o':
+                                                        i = 42;
+                                                        break;
+                                                }
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 43;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 44;
+                                                break;
+                                            case 'e':
+                                                i = 45;
+                                                break;
+                                            case 'i':
+                                                i = 46;
+                                                break;
+                                            case 'o':
+                                                i = 47;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x107:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 48;
+                                                break;
+                                            case 'e':
+                                                i = 49;
+                                                break;
+                                            case 'u':
+                                                i = 50;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 51;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 52;
+                                                break;
+                                            case 'e':
+                                                i = 53;
+                                                break;
+                                            case 'u':
+                                                i = 54;
+                                                break;
+                                        }
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'n') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 55;
+                                                break;
+                                            case 'e':
+                                                i = 56;
+                                                break;
+                                            case 's':
+                                                i = 57;
+                                                break;
+                                            case 0x161:
+                                                i = 58;
+                                                break;
+                                        }
+                                        break;
+                                    case 'k':
+                                        i = 59;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 's':
+                                                i = 60;
+                                                break;
+                                            case 0x161:
+                                                i = 61;
+                                                break;
+                                        }
+                                        break;
+                                    case 'l':
+                                        i = 62;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 63;
+                                        break;
+                                    case 'n':
+                                        i = 64;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'c':
+                                                i = 65;
+                                                break;
+                                            case 0x10D:
+                                                i = 66;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 67;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 68;
+                                                break;
+                                            case 'i':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'v') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'e':
+                                                        i = 69;
+                                                        break;
+                                                    case 'o':
+                                                        i = 70;
+                                                        break;
+                                                }
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 71;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 72;
+                                                break;
+                                            case 'e':
+                                                i = 73;
+                                                break;
+                                            case 'i':
+                                                i = 74;
+                                                break;
+                                            case 'o':
+                                                i = 75;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x107:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 76;
+                                                break;
+                                            case 'e':
+                                                i = 77;
+                                                break;
+                                            case 'u':
+                                                i = 78;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 79;
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                i = 80;
+                                break;
+                        }
+                        break;
+                    case 'j':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 81;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        i = 82;
+                                        break;
+                                    case 'l':
+                                        i = 83;
+                                        break;
+                                    case 'r':
+                                        i = 84;
+                                        break;
+                                    case 0x107:
+                                        i = 85;
+                                        break;
+                                    case 0x10D:
+                                        i = 86;
+                                        break;
+                                    case 0x111:
+                                        i = 87;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        i = 88;
+                                        break;
+                                    case 'c':
+                                        i = 89;
+                                        break;
+                                    case 'd':
+                                        i = 90;
+                                        break;
+                                    case 'f':
+                                        i = 91;
+                                        break;
+                                    case 'g':
+                                        i = 92;
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'n') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 93;
+                                                break;
+                                            case 'e':
+                                                i = 94;
+                                                break;
+                                            case 's':
+                                                i = 95;
+                                                break;
+                                            case 0x161:
+                                                i = 96;
+                                                break;
+                                        }
+                                        break;
+                                    case 'k':
+                                        i = 97;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 's':
+                                                i = 98;
+                                                break;
+                                            case 0x161:
+                                                i = 99;
+                                                break;
+                                        }
+                                        break;
+                                    case 'l':
+                                        i = 100;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 101;
+                                        break;
+                                    case 'm':
+                                        i = 102;
+                                        break;
+                                    case 'n':
+                                        i = 103;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'g':
+                                                i = 104;
+                                                break;
+                                            case 'm':
+                                                i = 105;
+                                                break;
+                                            case 'p':
+                                                i = 106;
+                                                break;
+                                            case 'r':
+                                                i = 107;
+                                                break;
+                                            case 't':
+                                                i = 108;
+                                                break;
+                                        }
+                                        break;
+                                    case 'p':
+                                        i = 109;
+                                        break;
+                                    case 'r':
+                                        i = 110;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 111;
+                                        break;
+                                    case 's':
+                                        i = 112;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 113;
+                                        break;
+                                    case 't':
+                                        i = 114;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 115;
+                                                break;
+                                            case 'i':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'v') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'e':
+                                                        i = 116;
+                                                        break;
+                                                    case 'o':
+                                                        i = 117;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'o':
+                                                i = 118;
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 119;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 120;
+                                                break;
+                                            case 'e':
+                                                i = 121;
+                                                break;
+                                            case 'i':
+                                                i = 122;
+                                                break;
+                                            case 'o':
+                                                i = 123;
+                                                break;
+                                        }
+                                        break;
+                                    case 'z':
+                                        i = 124;
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 125;
+                                        break;
+                                    case 0x17E:
+                                        i = 126;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 127;
+                                        break;
+                                    case 'e':
+                                        i = 128;
+                                        break;
+                                    case 's':
+                                        i = 129;
+                                        break;
+                                    case 0x161:
+                                        i = 130;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'k':
+                        i = 131;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 's':
+                                i = 132;
+                                break;
+                            case 0x161:
+                                i = 133;
+                                break;
+                        }
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 134;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 135;
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 't') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 's') break;
+                                                if (n <= 7) break;
+                                                switch (q[-8]) {
+                                                    case 'a':
+                                                        i = 136;
+                                                        break;
+                                                    case 'i':
+                                                        i = 137;
+                                                        break;
+                                                    case 'o':
+                                                        i = 138;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'i':
+                                                i = 139;
+                                                break;
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 140;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        i = 141;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'i':
+                                                i = 142;
+                                                break;
+                                            case 'u':
+                                                i = 143;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        i = 144;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 145;
+                                                break;
+                                            case 'i':
+                                                i = 146;
+                                                break;
+                                            case 'o':
+                                                i = 147;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 148;
+                                                break;
+                                            case 'e':
+                                                i = 149;
+                                                break;
+                                            case 'i':
+                                                i = 150;
+                                                break;
+                                            case 'o':
+                                                i = 151;
+                                                break;
+                                            case 'u':
+                                                i = 152;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 153;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 154;
+                                break;
+                            case 'i':
+                                i = 155;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 156;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 157;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        i = 158;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 's') break;
+                                        if (n <= 7) break;
+                                        switch (q[-8]) {
+                                            case 'a':
+                                                i = 159;
+                                                break;
+                                            case 'i':
+                                                i = 160;
+                                                break;
+                                            case 'o':
+                                                i = 161;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 162;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'j') break;
+                                        i = 163;
+                                        break;
+                                    case 'z':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 164;
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 165;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 166;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 167;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                i = 168;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 169;
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                i = 170;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'g':
+                                        i = 171;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'o':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 172;
+                                                break;
+                                            case 'u':
+                                                i = 173;
+                                                break;
+                                        }
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 174;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'c':
+                                                        i = 175;
+                                                        break;
+                                                    case 'l':
+                                                        i = 176;
+                                                        break;
+                                                    case 'r':
+                                                        i = 177;
+                                                        break;
+                                                    case 0x107:
+                                                        i = 178;
+                                                        break;
+                                                    case 0x10D:
+                                                        i = 179;
+                                                        break;
+                                                    case 0x111:
+                                                        i = 180;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'i':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'b':
+                                                        i = 181;
+                                                        break;
+                                                    case 'c':
+                                                        i = 182;
+                                                        break;
+                                                    case 'd':
+                                                        i = 183;
+                                                        break;
+                                                    case 'f':
+                                                        i = 184;
+                                                        break;
+                                                    case 'g':
+                                                        i = 185;
+                                                        break;
+                                                    case 'l':
+                                                        i = 186;
+                                                        break;
+                                                    case 'm':
+                                                        i = 187;
+                                                        break;
+                                                    case 'n':
+                                                        i = 188;
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'a') break;
+                                                        if (n <= 7) break;
+                                                        switch (q[-8]) {
+                                                            case 'g':
+                                                                i = 189;
+                                                                break;
+                                                            case 'm':
+                                                                i = 190;
+                                                                break;
+                                                            case 'p':
+                                                                i = 191;
+                                                                break;
+                                                            case 'r':
+                                                                i = 192;
+                                                                break;
+                                                            case 't':
+                                                                i = 193;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'p':
+                                                        i = 194;
+                                                        break;
+                                                    case 'r':
+                                                        i = 195;
+                                                        break;
+                                                    case 's':
+                                                        i = 196;
+                                                        break;
+                                                    case 't':
+                                                        i = 197;
+                                                        break;
+                                                    case 'z':
+                                                        i = 198;
+                                                        break;
+                                                    case 0x17E:
+                                                        i = 199;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'l':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 200;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'j':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'i') break;
+                                                        i = 201;
+                                                        break;
+                                                    case 'n':
+                                                        i = 202;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'e':
+                                                i = 203;
+                                                break;
+                                            case 'i':
+                                                i = 204;
+                                                break;
+                                        }
+                                        break;
+                                    case 'm':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'r') break;
+                                                i = 205;
+                                                break;
+                                            case 'e':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 206;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 207;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'c':
+                                                i = 208;
+                                                break;
+                                            case 0x10D:
+                                                i = 209;
+                                                break;
+                                        }
+                                        break;
+                                    case 'r':
+                                        i = 210;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 211;
+                                                break;
+                                            case 'd':
+                                                i = 212;
+                                                break;
+                                            case 'e':
+                                                i = 213;
+                                                break;
+                                            case 'o':
+                                                i = 214;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'b':
+                                                        i = 215;
+                                                        break;
+                                                    case 'g':
+                                                        i = 216;
+                                                        break;
+                                                    case 'j':
+                                                        i = 217;
+                                                        break;
+                                                    case 'k':
+                                                        i = 218;
+                                                        break;
+                                                    case 'n':
+                                                        i = 219;
+                                                        break;
+                                                    case 't':
+                                                        i = 220;
+                                                        break;
+                                                    case 'v':
+                                                        i = 221;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'e':
+                                                i = 222;
+                                                break;
+                                            case 'i':
+                                                i = 223;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'e':
+                                                i = 224;
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'e':
+                                                        i = 225;
+                                                        break;
+                                                    case 'i':
+                                                        i = 226;
+                                                        break;
+                                                    case 'k':
+                                                        i = 227;
+                                                        break;
+                                                    case 'o':
+                                                        i = 228;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 229;
+                                                break;
+                                            case 'e':
+                                                i = 230;
+                                                break;
+                                            case 'i':
+                                                i = 231;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'b':
+                                                        i = 232;
+                                                        break;
+                                                    case 'g':
+                                                        i = 233;
+                                                        break;
+                                                    case 'j':
+                                                        i = 234;
+                                                        break;
+                                                    case 'k':
+                                                        i = 235;
+                                                        break;
+                                                    case 'n':
+                                                        i = 236;
+                                                        break;
+                                                    case 't':
+                                                        i = 237;
+                                                        break;
+                                                    case 'v':
+                                                        i = 238;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'e':
+                                                i = 239;
+                                                break;
+                                            case 'i':
+                                                i = 240;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 'l') break;
+                                i = 241;
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 242;
+                                                break;
+                                            case 'e':
+                                                i = 243;
+                                                break;
+                                            case 'u':
+                                                i = 244;
+                                                break;
+                                        }
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 245;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'c':
+                                                        i = 246;
+                                                        break;
+                                                    case 'l':
+                                                        i = 247;
+                                                        break;
+                                                    case 'r':
+                                                        i = 248;
+                                                        break;
+                                                    case 0x107:
+                                                        i = 249;
+                                                        break;
+                                                    case 0x10D:
+                                                        i = 250;
+                                                        break;
+                                                    case 0x111:
+                                                        i = 251;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'i':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'b':
+                                                        i = 252;
+                                                        break;
+                                                    case 'c':
+                                                        i = 253;
+                                                        break;
+                                                    case 'd':
+                                                        i = 254;
+                                                        break;
+                                                    case 'f':
+                                                        i = 255;
+                                                        break;
+                                                    case 'g':
+                                                        i = 256;
+                                                        break;
+                                                    case 'j':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'n') break;
+                                                        if (n <= 7) break;
+                                                        switch (q[-8]) {
+                                                            case 'a':
+                                                                i = 257;
+                                                                break;
+                                                            case 'e':
+                                                                i = 258;
+                                                                break;
+                                                            case 's':
+                                                                i = 259;
+                                                                break;
+                                                            case 0x161:
+                                                                i = 260;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'k':
+                                                        i = 261;
+                                                        if (n <= 6) break;
+                                                        switch (q[-7]) {
+                                                            case 's':
+                                                                i = 262;
+                                                                break;
+                                                            case 0x161:
+                                                                i = 263;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'l':
+                                                        i = 264;
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'e') break;
+                                                        i = 265;
+                                                        break;
+                                                    case 'm':
+                                                        i = 266;
+                                                        break;
+                                                    case 'n':
+                                                        i = 267;
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'a') break;
+                                                        if (n <= 7) break;
+                                                        switch (q[-8]) {
+                                                            case 'g':
+                                                                i = 268;
+                                                                break;
+                                                            case 'm':
+                                                                i = 269;
+                                                                break;
+                                                            case 'p':
+                                                                i = 270;
+                                                                break;
+                                                            case 'r':
+                                                                i = 271;
+                                                                break;
+                                                            case 't':
+                                                                i = 272;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'p':
+                                                        i = 273;
+                                                        break;
+                                                    case 'r':
+                                                        i = 274;
+                                                        break;
+                                                    case 's':
+                                                        i = 275;
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'o') break;
+                                                        i = 276;
+                                                        break;
+                                                    case 't':
+                                                        i = 277;
+                                                        if (n <= 6) break;
+                                                        switch (q[-7]) {
+                                                            case 'a':
+                                                                i = 278;
+                                                                break;
+                                                            case 'i':
+                                                                if (n <= 7) break;
+                                                                if (q[-8] != 'v') break;
+                                                                if (n <= 8) break;
+                                                                switch (q[-9]) {
+                                                                    case 'e':
+                                                                        i = 279;
+                                                                        break;
+                                                                    case 'o':
+                                                                        i = 280;
+                                                                        break;
+                                                                }
+                                                                break;
+                                                            case 's':
+                                                                if (n <= 7) break;
+                                                                if (q[-8] != 'a') break;
+                                                                i = 281;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'v':
+                                                        if (n <= 6) break;
+                                                        switch (q[-7]) {
+                                                            case 'a':
+                                                                i = 282;
+                                                                break;
+                                                            case 'e':
+                                                                i = 283;
+                                                                break;
+                                                            case 'i':
+                                                                i = 284;
+                                                                break;
+                                                            case 'o':
+                                                                i = 285;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'z':
+                                                        i = 286;
+                                                        break;
+                                                    case 0x161:
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'o') break;
+                                                        i = 287;
+                                                        break;
+                                                    case 0x17E:
+                                                        i = 288;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 289;
+                                                        break;
+                                                    case 'e':
+                                                        i = 290;
+                                                        break;
+                                                    case 's':
+                                                        i = 291;
+                                                        break;
+                                                    case 0x161:
+                                                        i = 292;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'k':
+                                        i = 293;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 's':
+                                                i = 294;
+                                                break;
+                                            case 0x161:
+                                                i = 295;
+                                                break;
+                                        }
+                                        break;
+                                    case 'l':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 296;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'j':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'i') break;
+                                                        i = 297;
+                                                        break;
+                                                    case 'n':
+                                                        i = 298;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'e':
+                                                i = 299;
+                                                break;
+                                            case 'i':
+                                                i = 300;
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'z') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'o') break;
+                                                i = 301;
+                                                break;
+                                            case 'o':
+                                                i = 302;
+                                                break;
+                                        }
+                                        break;
+                                    case 'm':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'l') break;
+                                        i = 303;
+                                        break;
+                                    case 'n':
+                                        i = 304;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 305;
+                                                break;
+                                            case 'i':
+                                                i = 306;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'c':
+                                                        i = 307;
+                                                        break;
+                                                    case 0x10D:
+                                                        i = 308;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'o':
+                                                i = 309;
+                                                break;
+                                        }
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 310;
+                                                break;
+                                            case 'd':
+                                                i = 311;
+                                                break;
+                                            case 'e':
+                                                i = 312;
+                                                break;
+                                            case 'o':
+                                                i = 313;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'b':
+                                                        i = 314;
+                                                        break;
+                                                    case 'g':
+                                                        i = 315;
+                                                        break;
+                                                    case 'j':
+                                                        i = 316;
+                                                        break;
+                                                    case 'k':
+                                                        i = 317;
+                                                        break;
+                                                    case 'n':
+                                                        i = 318;
+                                                        break;
+                                                    case 't':
+                                                        i = 319;
+                                                        break;
+                                                    case 'v':
+                                                        i = 320;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'e':
+                                                i = 321;
+                                                break;
+                                            case 'i':
+                                                i = 322;
+                                                break;
+                                            case 'o':
+                                                i = 323;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 324;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'k':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'i') break;
+                                                        i = 325;
+                                                        break;
+                                                    case 'l':
+                                                        i = 326;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'e':
+                                                i = 327;
+                                                break;
+                                            case 'i':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'v') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'e':
+                                                        i = 328;
+                                                        break;
+                                                    case 'o':
+                                                        i = 329;
+                                                        break;
+                                                }
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 330;
+                                                        break;
+                                                    case 'e':
+                                                        i = 331;
+                                                        break;
+                                                    case 'i':
+                                                        i = 332;
+                                                        break;
+                                                    case 'k':
+                                                        i = 333;
+                                                        break;
+                                                    case 'o':
+                                                        i = 334;
+                                                        break;
+                                                }
+                                                break;
+                                            case 0x161:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 335;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 336;
+                                                break;
+                                            case 'e':
+                                                i = 337;
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'j') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'a') break;
+                                                i = 338;
+                                                if (n <= 7) break;
+                                                switch (q[-8]) {
+                                                    case 'c':
+                                                        i = 339;
+                                                        break;
+                                                    case 'l':
+                                                        i = 340;
+                                                        break;
+                                                    case 'r':
+                                                        i = 341;
+                                                        break;
+                                                    case 0x107:
+                                                        i = 342;
+                                                        break;
+                                                    case 0x10D:
+                                                        i = 343;
+                                                        break;
+                                                    case 0x111:
+                                                        i = 344;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'i':
+                                                i = 345;
+                                                break;
+                                            case 'o':
+                                                i = 346;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'g':
+                                                        i = 347;
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'u') break;
+                                                        i = 348;
+                                                        break;
+                                                    case 'l':
+                                                        i = 349;
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'o') break;
+                                                        i = 350;
+                                                        break;
+                                                    case 'm':
+                                                        i = 351;
+                                                        break;
+                                                    case 'n':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'o') break;
+                                                        i = 352;
+                                                        break;
+                                                }
+                                                break;
+                                            case 't':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 's':
+                                                        i = 353;
+                                                        break;
+                                                    case 0x161:
+                                                        i = 354;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 0x107:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 355;
+                                                break;
+                                            case 'e':
+                                                i = 356;
+                                                break;
+                                            case 'u':
+                                                i = 357;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'b':
+                                                        i = 358;
+                                                        break;
+                                                    case 'g':
+                                                        i = 359;
+                                                        break;
+                                                    case 'j':
+                                                        i = 360;
+                                                        break;
+                                                    case 'k':
+                                                        i = 361;
+                                                        break;
+                                                    case 'n':
+                                                        i = 362;
+                                                        break;
+                                                    case 't':
+                                                        i = 363;
+                                                        break;
+                                                    case 'v':
+                                                        i = 364;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'e':
+                                                i = 365;
+                                                break;
+                                            case 'i':
+                                                i = 366;
+                                                break;
+                                            case 'o':
+                                                i = 367;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        i = 368;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 369;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 370;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'u') break;
+                                        i = 371;
+                                        break;
+                                    case 't':
+                                        i = 372;
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 373;
+                                                break;
+                                            case 'e':
+                                                i = 374;
+                                                break;
+                                            case 'i':
+                                                i = 375;
+                                                break;
+                                            case 'u':
+                                                i = 376;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 377;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 378;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 379;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 380;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 381;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 382;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        i = 383;
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 384;
+                                        break;
+                                    case 0x10D:
+                                        i = 385;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                i = 386;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 387;
+                                break;
+                            case 'd':
+                                i = 388;
+                                break;
+                            case 'e':
+                                i = 389;
+                                break;
+                            case 'o':
+                                i = 390;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        i = 391;
+                                        break;
+                                    case 'g':
+                                        i = 392;
+                                        break;
+                                    case 'j':
+                                        i = 393;
+                                        break;
+                                    case 'k':
+                                        i = 394;
+                                        break;
+                                    case 'n':
+                                        i = 395;
+                                        break;
+                                    case 't':
+                                        i = 396;
+                                        break;
+                                    case 'v':
+                                        i = 397;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 398;
+                                break;
+                            case 'i':
+                                i = 399;
+                                break;
+                            case 'o':
+                                i = 400;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 401;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'k':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 402;
+                                        break;
+                                    case 'l':
+                                        i = 403;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 404;
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 'v') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'e':
+                                        i = 405;
+                                        break;
+                                    case 'o':
+                                        i = 406;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 407;
+                                        break;
+                                    case 'e':
+                                        i = 408;
+                                        break;
+                                    case 'i':
+                                        i = 409;
+                                        break;
+                                    case 'k':
+                                        i = 410;
+                                        break;
+                                    case 'o':
+                                        i = 411;
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                i = 412;
+                                break;
+                            case 0x161:
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 413;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 414;
+                                break;
+                            case 'e':
+                                i = 415;
+                                if (n <= 3) break;
+                                if (q[-4] != 'j') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 416;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'c':
+                                        i = 417;
+                                        break;
+                                    case 'l':
+                                        i = 418;
+                                        break;
+                                    case 'r':
+                                        i = 419;
+                                        break;
+                                    case 0x107:
+                                        i = 420;
+                                        break;
+                                    case 0x10D:
+                                        i = 421;
+                                        break;
+                                    case 0x111:
+                                        i = 422;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 423;
+                                break;
+                            case 'o':
+                                i = 424;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'g':
+                                        i = 425;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'u') break;
+                                        i = 426;
+                                        break;
+                                    case 'l':
+                                        i = 427;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 428;
+                                        break;
+                                    case 'm':
+                                        i = 429;
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 430;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 's':
+                                        i = 431;
+                                        break;
+                                    case 0x161:
+                                        i = 432;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x107:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 433;
+                                break;
+                            case 'e':
+                                i = 434;
+                                break;
+                            case 'u':
+                                i = 435;
+                                break;
+                        }
+                        break;
+                    case 0x161:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        i = 436;
+                                        break;
+                                    case 'g':
+                                        i = 437;
+                                        break;
+                                    case 'j':
+                                        i = 438;
+                                        break;
+                                    case 'k':
+                                        i = 439;
+                                        break;
+                                    case 'n':
+                                        i = 440;
+                                        break;
+                                    case 't':
+                                        i = 441;
+                                        break;
+                                    case 'v':
+                                        i = 442;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 443;
+                                break;
+                            case 'i':
+                                i = 444;
+                                break;
+                            case 'o':
+                                i = 445;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'e':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 446;
+                                break;
+                            case 'e':
+                                i = 447;
+                                break;
+                            case 'u':
+                                i = 448;
+                                if (n <= 3) break;
+                                if (q[-4] != 'l') break;
+                                i = 449;
+                                break;
+                        }
+                        break;
+                    case 'd':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 's') break;
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 'a':
+                                i = 450;
+                                break;
+                            case 'i':
+                                i = 451;
+                                break;
+                            case 'o':
+                                i = 452;
+                                break;
+                        }
+                        break;
+                    case 'g':
+                        i = 453;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 'l') break;
+                                i = 454;
+                                break;
+                            case 'u':
+                                i = 455;
+                                break;
+                        }
+                        break;
+                    case 'j':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 456;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        i = 457;
+                                        break;
+                                    case 'l':
+                                        i = 458;
+                                        break;
+                                    case 'r':
+                                        i = 459;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 460;
+                                                break;
+                                            case 'i':
+                                                i = 461;
+                                                break;
+                                            case 'o':
+                                                i = 462;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x107:
+                                        i = 463;
+                                        break;
+                                    case 0x10D:
+                                        i = 464;
+                                        break;
+                                    case 0x111:
+                                        i = 465;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 466;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        i = 467;
+                                        break;
+                                    case 'c':
+                                        i = 468;
+                                        break;
+                                    case 'd':
+                                        i = 469;
+                                        break;
+                                    case 'f':
+                                        i = 470;
+                                        break;
+                                    case 'g':
+                                        i = 471;
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'n') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 472;
+                                                break;
+                                            case 'e':
+                                                i = 473;
+                                                break;
+                                            case 's':
+                                                i = 474;
+                                                break;
+                                            case 0x161:
+                                                i = 475;
+                                                break;
+                                        }
+                                        break;
+                                    case 'k':
+                                        i = 476;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 's':
+                                                i = 477;
+                                                break;
+                                            case 0x161:
+                                                i = 478;
+                                                break;
+                                        }
+                                        break;
+                                    case 'l':
+                                        i = 479;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 480;
+                                        break;
+                                    case 'm':
+                                        i = 481;
+                                        break;
+                                    case 'n':
+                                        i = 482;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'g':
+                                                i = 483;
+                                                break;
+                                            case 'm':
+                                                i = 484;
+                                                break;
+                                            case 'p':
+                                                i = 485;
+                                                break;
+                                            case 'r':
+                                                i = 486;
+                                                break;
+                                            case 't':
+                                                i = 487;
+                                                break;
+                                        }
+                                        break;
+                                    case 'p':
+                                        i = 488;
+                                        break;
+                                    case 'r':
+                                        i = 489;
+                                        break;
+                                    case 's':
+                                        i = 490;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 491;
+                                        break;
+                                    case 't':
+                                        i = 492;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 493;
+                                                break;
+                                            case 'i':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'v') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'e':
+                                                        i = 494;
+                                                        break;
+                                                    case 'o':
+                                                        i = 495;
+                                                        break;
+                                                }
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 496;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 497;
+                                                break;
+                                            case 'e':
+                                                i = 498;
+                                                break;
+                                            case 'i':
+                                                i = 499;
+                                                break;
+                                            case 'o':
+                                                i = 500;
+                                                break;
+                                        }
+                                        break;
+                                    case 'z':
+                                        i = 501;
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 502;
+                                        break;
+                                    case 0x17E:
+                                        i = 503;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 504;
+                                        break;
+                                    case 'e':
+                                        i = 505;
+                                        break;
+                                    case 's':
+                                        i = 506;
+                                        break;
+                                    case 0x161:
+                                        i = 507;
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                i = 508;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'u') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'l') break;
+                                        i = 509;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 510;
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'u') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'l') break;
+                                        i = 511;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'k':
+                        i = 512;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 's':
+                                i = 513;
+                                break;
+                            case 0x161:
+                                i = 514;
+                                break;
+                        }
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 515;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 516;
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 't') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 's') break;
+                                                if (n <= 7) break;
+                                                switch (q[-8]) {
+                                                    case 'a':
+                                                        i = 517;
+                                                        break;
+                                                    case 'i':
+                                                        i = 518;
+                                                        break;
+                                                    case 'o':
+                                                        i = 519;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'i':
+                                                i = 520;
+                                                break;
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 521;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        i = 522;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'i':
+                                                i = 523;
+                                                break;
+                                            case 'u':
+                                                i = 524;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        i = 525;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 526;
+                                                break;
+                                            case 'i':
+                                                i = 527;
+                                                break;
+                                            case 'o':
+                                                i = 528;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 529;
+                                                break;
+                                            case 'e':
+                                                i = 530;
+                                                break;
+                                            case 'i':
+                                                i = 531;
+                                                break;
+                                            case 'o':
+                                                i = 532;
+                                                break;
+                                            case 'u':
+                                                i = 533;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 534;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 535;
+                                break;
+                            case 'i':
+                                i = 536;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 537;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 538;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        i = 539;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 540;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'j') break;
+                                        i = 541;
+                                        break;
+                                    case 'z':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 542;
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 543;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 544;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 545;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                i = 546;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 547;
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                i = 548;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                i = 549;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 'l') break;
+                                i = 550;
+                                break;
+                            case 'o':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 551;
+                                                break;
+                                            case 'e':
+                                                i = 552;
+                                                break;
+                                            case 'u':
+                                                i = 553;
+                                                break;
+                                        }
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'n') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 554;
+                                                break;
+                                            case 'e':
+                                                i = 555;
+                                                break;
+                                            case 's':
+                                                i = 556;
+                                                break;
+                                            case 0x161:
+                                                i = 557;
+                                                break;
+                                        }
+                                        break;
+                                    case 'k':
+                                        i = 558;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 's':
+                                                i = 559;
+                                                break;
+                                            case 0x161:
+                                                i = 560;
+                                                break;
+                                        }
+                                        break;
+                                    case 'l':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 561;
+                                        break;
+                                    case 'n':
+                                        i = 562;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'c':
+                                                i = 563;
+                                                break;
+                                            case 0x10D:
+                                                i = 564;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 565;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 566;
+                                                break;
+                                            case 'i':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'v') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'e':
+                                                        i = 567;
+                                                        break;
+                                                    case 'o':
+                                                        i = 568;
+                                                        break;
+                                                }
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 569;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 570;
+                                                break;
+                                            case 'e':
+                                                i = 571;
+                                                break;
+                                            case 'i':
+                                                i = 572;
+                                                break;
+                                            case 'o':
+                                                i = 573;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x107:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 574;
+                                                break;
+                                            case 'e':
+                                                i = 575;
+                                                break;
+                                            case 'u':
+                                                i = 576;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 577;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        i = 578;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 579;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 580;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'u') break;
+                                        i = 581;
+                                        break;
+                                    case 't':
+                                        i = 582;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 583;
+                                                break;
+                                            case 'i':
+                                                i = 584;
+                                                break;
+                                            case 'o':
+                                                i = 585;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 586;
+                                                break;
+                                            case 'e':
+                                                i = 587;
+                                                break;
+                                            case 'i':
+                                                i = 588;
+                                                break;
+                                            case 'u':
+                                                i = 589;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 590;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 591;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 592;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 593;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 594;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 595;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        i = 596;
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 597;
+                                        break;
+                                    case 0x10D:
+                                        i = 598;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                i = 599;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 600;
+                                break;
+                            case 'd':
+                                i = 601;
+                                break;
+                            case 'e':
+                                i = 602;
+                                break;
+                            case 'o':
+                                i = 603;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 604;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        i = 605;
+                                        break;
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 606;
+                                        break;
+                                    case 'g':
+                                        i = 607;
+                                        break;
+                                    case 'j':
+                                        i = 608;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 't') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 's') break;
+                                                if (n <= 7) break;
+                                                switch (q[-8]) {
+                                                    case 'a':
+                                                        i = 609;
+                                                        break;
+                                                    case 'i':
+                                                        i = 610;
+                                                        break;
+                                                    case 'o':
+                                                        i = 611;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 612;
+                                                break;
+                                        }
+                                        break;
+                                    case 'k':
+                                        i = 613;
+                                        break;
+                                    case 'n':
+                                        i = 614;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'i':
+                                                i = 615;
+                                                break;
+                                            case 'u':
+                                                i = 616;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        i = 617;
+                                        break;
+                                    case 'v':
+                                        i = 618;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 619;
+                                                break;
+                                            case 'e':
+                                                i = 620;
+                                                break;
+                                            case 'i':
+                                                i = 621;
+                                                break;
+                                            case 'o':
+                                                i = 622;
+                                                break;
+                                            case 'u':
+                                                i = 623;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 624;
+                                break;
+                            case 'i':
+                                i = 625;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 626;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 627;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 628;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'j') break;
+                                        i = 629;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                i = 630;
+                                if (n <= 3) break;
+                                if (q[-4] != 'd') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 't') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 's') break;
+                                if (n <= 7) break;
+                                switch (q[-8]) {
+                                    case 'a':
+                                        i = 631;
+                                        break;
+                                    case 'i':
+                                        i = 632;
+                                        break;
+                                    case 'o':
+                                        i = 633;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 634;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 635;
+                                        break;
+                                    case 'k':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 636;
+                                        break;
+                                    case 'l':
+                                        i = 637;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'i':
+                                                i = 638;
+                                                break;
+                                            case 'u':
+                                                i = 639;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        i = 640;
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 641;
+                                                break;
+                                            case 'e':
+                                                i = 642;
+                                                break;
+                                            case 'i':
+                                                i = 643;
+                                                break;
+                                            case 'u':
+                                                i = 644;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 645;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 646;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'd':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 's') break;
+                                        if (n <= 7) break;
+                                        switch (q[-8]) {
+                                            case 'a':
+                                                i = 647;
+                                                break;
+                                            case 'i':
+                                                i = 648;
+                                                break;
+                                            case 'o':
+                                                i = 649;
+                                                break;
+                                        }
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 't') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 's') break;
+                                                if (n <= 7) break;
+                                                switch (q[-8]) {
+                                                    case 'a':
+                                                        i = 650;
+                                                        break;
+                                                    case 'i':
+                                                        i = 651;
+                                                        break;
+                                                    case 'o':
+                                                        i = 652;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'i':
+                                                i = 653;
+                                                break;
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 654;
+                                                break;
+                                            case 'u':
+                                                i = 655;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'c':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'u') break;
+                                                        if (n <= 7) break;
+                                                        if (q[-8] != 'l') break;
+                                                        i = 656;
+                                                        break;
+                                                    case 'r':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'i') break;
+                                                        i = 657;
+                                                        break;
+                                                    case 0x10D:
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'u') break;
+                                                        if (n <= 7) break;
+                                                        if (q[-8] != 'l') break;
+                                                        i = 658;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        i = 659;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 's') break;
+                                        if (n <= 7) break;
+                                        switch (q[-8]) {
+                                            case 'a':
+                                                i = 660;
+                                                break;
+                                            case 'i':
+                                                i = 661;
+                                                break;
+                                            case 'o':
+                                                i = 662;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'a') break;
+                                        i = 663;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 664;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 665;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 666;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        i = 667;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 's') break;
+                                        if (n <= 7) break;
+                                        switch (q[-8]) {
+                                            case 'a':
+                                                i = 668;
+                                                break;
+                                            case 'i':
+                                                i = 669;
+                                                break;
+                                            case 'o':
+                                                i = 670;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 671;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'e':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'j') break;
+                                                i = 672;
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 673;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'e':
+                                                i = 674;
+                                                break;
+                                            case 'o':
+                                                i = 675;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 676;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 677;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 678;
+                                        break;
+                                }
+                                break;
+                            case 'j':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 679;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'u') break;
+                                                i = 680;
+                                                break;
+                                            case 't':
+                                                i = 681;
+                                                if (n <= 5) break;
+                                                if (q[-6] != 's') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'a':
+                                                        i = 682;
+                                                        break;
+                                                    case 'i':
+                                                        i = 683;
+                                                        break;
+                                                    case 'o':
+                                                        i = 684;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'v':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 685;
+                                                        break;
+                                                    case 'e':
+                                                        i = 686;
+                                                        break;
+                                                    case 'i':
+                                                        i = 687;
+                                                        break;
+                                                    case 'u':
+                                                        i = 688;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'i':
+                                        i = 689;
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'c':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'u') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'l') break;
+                                                i = 690;
+                                                break;
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 691;
+                                                break;
+                                            case 0x10D:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'u') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'l') break;
+                                                i = 692;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 693;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'c':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 694;
+                                                break;
+                                            case 'j':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 't') break;
+                                                        if (n <= 7) break;
+                                                        if (q[-8] != 's') break;
+                                                        if (n <= 8) break;
+                                                        switch (q[-9]) {
+                                                            case 'a':
+                                                                i = 695;
+                                                                break;
+                                                            case 'i':
+                                                                i = 696;
+                                                                break;
+                                                            case 'o':
+                                                                i = 697;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'n':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'i') break;
+                                                        i = 698;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'i':
+                                                        i = 699;
+                                                        break;
+                                                    case 'u':
+                                                        i = 700;
+                                                        break;
+                                                }
+                                                break;
+                                            case 't':
+                                                i = 701;
+                                                break;
+                                            case 'v':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 702;
+                                                        break;
+                                                    case 'e':
+                                                        i = 703;
+                                                        break;
+                                                    case 'i':
+                                                        i = 704;
+                                                        break;
+                                                    case 'o':
+                                                        i = 705;
+                                                        break;
+                                                    case 'u':
+                                                        i = 706;
+                                                        break;
+                                                }
+                                                break;
+                                            case 0x10D:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 707;
+                                                break;
+                                        }
+                                        break;
+                                    case 'e':
+                                        i = 708;
+                                        break;
+                                    case 'i':
+                                        i = 709;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'c':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 710;
+                                                        break;
+                                                    case 'u':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'l') break;
+                                                        i = 711;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'n':
+                                                i = 712;
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'o') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'r') break;
+                                                i = 713;
+                                                break;
+                                            case 't':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'e') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'j') break;
+                                                i = 714;
+                                                break;
+                                            case 0x10D:
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 715;
+                                                        break;
+                                                    case 'u':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'l') break;
+                                                        i = 716;
+                                                        break;
+                                                }
+                                                break;
+                                            case 0x161:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'o') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'r') break;
+                                                i = 717;
+                                                break;
+                                        }
+                                        break;
+                                    case 'k':
+                                        i = 718;
+                                        break;
+                                    case 'o':
+                                        i = 719;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'd') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'a') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 't') break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 's') break;
+                                        if (n <= 8) break;
+                                        switch (q[-9]) {
+                                            case 'a':
+                                                i = 720;
+                                                break;
+                                            case 'i':
+                                                i = 721;
+                                                break;
+                                            case 'o':
+                                                i = 722;
+                                                break;
+                                        }
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'n') break;
+                                        i = 723;
+                                        break;
+                                }
+                                break;
+                            case 0x161:
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 724;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 725;
+                                break;
+                            case 'e':
+                                i = 726;
+                                if (n <= 3) break;
+                                if (q[-4] != 'j') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 727;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'c':
+                                        i = 728;
+                                        break;
+                                    case 'l':
+                                        i = 729;
+                                        break;
+                                    case 'r':
+                                        i = 730;
+                                        break;
+                                    case 0x107:
+                                        i = 731;
+                                        break;
+                                    case 0x10D:
+                                        i = 732;
+                                        break;
+                                    case 0x111:
+                                        i = 733;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 734;
+                                break;
+                            case 'o':
+                                i = 735;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'g':
+                                        i = 736;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'u') break;
+                                        i = 737;
+                                        break;
+                                    case 'l':
+                                        i = 738;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 739;
+                                        break;
+                                    case 'm':
+                                        i = 740;
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 741;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x107:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 742;
+                                break;
+                            case 'e':
+                                i = 743;
+                                break;
+                            case 'u':
+                                i = 744;
+                                break;
+                        }
+                        break;
+                    case 0x10D:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 745;
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'l') break;
+                                i = 746;
+                                break;
+                        }
+                        break;
+                    case 0x161:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 747;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        i = 748;
+                                        break;
+                                    case 'g':
+                                        i = 749;
+                                        break;
+                                    case 'j':
+                                        i = 750;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 't') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 's') break;
+                                                if (n <= 7) break;
+                                                switch (q[-8]) {
+                                                    case 'a':
+                                                        i = 751;
+                                                        break;
+                                                    case 'i':
+                                                        i = 752;
+                                                        break;
+                                                    case 'o':
+                                                        i = 753;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 754;
+                                                break;
+                                        }
+                                        break;
+                                    case 'k':
+                                        i = 755;
+                                        break;
+                                    case 'n':
+                                        i = 756;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'i':
+                                                i = 757;
+                                                break;
+                                            case 'u':
+                                                i = 758;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        i = 759;
+                                        break;
+                                    case 'v':
+                                        i = 760;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 761;
+                                                break;
+                                            case 'e':
+                                                i = 762;
+                                                break;
+                                            case 'i':
+                                                i = 763;
+                                                break;
+                                            case 'o':
+                                                i = 764;
+                                                break;
+                                            case 'u':
+                                                i = 765;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 766;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 767;
+                                break;
+                            case 'i':
+                                i = 768;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'j') break;
+                                        i = 769;
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 770;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 771;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 772;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                i = 773;
+                                if (n <= 3) break;
+                                if (q[-4] != 'd') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 't') break;
+                                if (n <= 6) break;
+                                if (q[-7] != 's') break;
+                                if (n <= 7) break;
+                                switch (q[-8]) {
+                                    case 'a':
+                                        i = 774;
+                                        break;
+                                    case 'i':
+                                        i = 775;
+                                        break;
+                                    case 'o':
+                                        i = 776;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'g':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 777;
+                                        break;
+                                    case 'e':
+                                        i = 778;
+                                        break;
+                                    case 'u':
+                                        i = 779;
+                                        break;
+                                }
+                                break;
+                            case 'j':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'j':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'n') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'a':
+                                                        i = 780;
+                                                        break;
+                                                    case 'e':
+                                                        i = 781;
+                                                        break;
+                                                    case 's':
+                                                        i = 782;
+                                                        break;
+                                                    case 0x161:
+                                                        i = 783;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'k':
+                                                i = 784;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 's':
+                                                        i = 785;
+                                                        break;
+                                                    case 0x161:
+                                                        i = 786;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'l':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'e') break;
+                                                i = 787;
+                                                break;
+                                            case 'n':
+                                                i = 788;
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'o') break;
+                                                i = 789;
+                                                break;
+                                            case 't':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 790;
+                                                        break;
+                                                    case 'i':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'v') break;
+                                                        if (n <= 7) break;
+                                                        switch (q[-8]) {
+                                                            case 'e':
+                                                                i = 791;
+                                                                break;
+                                                            case 'o':
+                                                                i = 792;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 's':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'a') break;
+                                                        i = 793;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'v':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 794;
+                                                        break;
+                                                    case 'e':
+                                                        i = 795;
+                                                        break;
+                                                    case 'i':
+                                                        i = 796;
+                                                        break;
+                                                    case 'o':
+                                                        i = 797;
+                                                        break;
+                                                }
+                                                break;
+                                            case 0x161:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'o') break;
+                                                i = 798;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 799;
+                                                break;
+                                            case 'e':
+                                                i = 800;
+                                                break;
+                                            case 's':
+                                                i = 801;
+                                                break;
+                                            case 0x161:
+                                                i = 802;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'k':
+                                i = 803;
+                                break;
+                            case 'l':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 804;
+                                break;
+                            case 'n':
+                                i = 805;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 806;
+                                        break;
+                                    case 'e':
+                                        i = 807;
+                                        break;
+                                    case 's':
+                                        i = 808;
+                                        break;
+                                    case 0x161:
+                                        i = 809;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 810;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 811;
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 812;
+                                        break;
+                                    case 'e':
+                                        i = 813;
+                                        break;
+                                    case 'i':
+                                        i = 814;
+                                        break;
+                                    case 'o':
+                                        i = 815;
+                                        break;
+                                }
+                                break;
+                            case 0x107:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 816;
+                                        break;
+                                    case 'e':
+                                        i = 817;
+                                        break;
+                                    case 'u':
+                                        i = 818;
+                                        break;
+                                }
+                                break;
+                            case 0x161:
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 819;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 820;
+                                        break;
+                                    case 'e':
+                                        i = 821;
+                                        break;
+                                    case 'u':
+                                        i = 822;
+                                        break;
+                                }
+                                break;
+                            case 'j':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 823;
+                                        break;
+                                    case 'e':
+                                        i = 824;
+                                        break;
+                                    case 's':
+                                        i = 825;
+                                        break;
+                                    case 0x161:
+                                        i = 826;
+                                        break;
+                                }
+                                break;
+                            case 'k':
+                                i = 827;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 's':
+                                        i = 828;
+                                        break;
+                                    case 0x161:
+                                        i = 829;
+                                        break;
+                                }
+                                break;
+                            case 'l':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 830;
+                                break;
+                            case 'n':
+                                i = 831;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'c':
+                                        i = 832;
+                                        break;
+                                    case 0x10D:
+                                        i = 833;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 834;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 835;
+                                        break;
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'v') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'e':
+                                                i = 836;
+                                                break;
+                                            case 'o':
+                                                i = 837;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 838;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 839;
+                                        break;
+                                    case 'e':
+                                        i = 840;
+                                        break;
+                                    case 'i':
+                                        i = 841;
+                                        break;
+                                    case 'o':
+                                        i = 842;
+                                        break;
+                                }
+                                break;
+                            case 0x107:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 843;
+                                        break;
+                                    case 'e':
+                                        i = 844;
+                                        break;
+                                    case 'u':
+                                        i = 845;
+                                        break;
+                                }
+                                break;
+                            case 0x161:
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 846;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'h':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 847;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 848;
+                                break;
+                            case 'j':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 't') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        if (n <= 6) break;
+                                        switch (q[-7]) {
+                                            case 'a':
+                                                i = 849;
+                                                break;
+                                            case 'i':
+                                                i = 850;
+                                                break;
+                                            case 'o':
+                                                i = 851;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 852;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 853;
+                                        break;
+                                    case 'u':
+                                        i = 854;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                i = 855;
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 856;
+                                        break;
+                                    case 'e':
+                                        i = 857;
+                                        break;
+                                    case 'i':
+                                        i = 858;
+                                        break;
+                                    case 'o':
+                                        i = 859;
+                                        break;
+                                    case 'u':
+                                        i = 860;
+                                        break;
+                                }
+                                break;
+                            case 0x10D:
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 861;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        i = 862;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 863;
+                                        break;
+                                    case 'e':
+                                        i = 864;
+                                        break;
+                                    case 'u':
+                                        i = 865;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'l') break;
+                                        i = 866;
+                                        break;
+                                }
+                                break;
+                            case 'j':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'j':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'n') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'a':
+                                                        i = 867;
+                                                        break;
+                                                    case 'e':
+                                                        i = 868;
+                                                        break;
+                                                    case 's':
+                                                        i = 869;
+                                                        break;
+                                                    case 0x161:
+                                                        i = 870;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'k':
+                                                i = 871;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 's':
+                                                        i = 872;
+                                                        break;
+                                                    case 0x161:
+                                                        i = 873;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'l':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'e') break;
+                                                i = 874;
+                                                break;
+                                            case 'n':
+                                                i = 875;
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'o') break;
+                                                i = 876;
+                                                break;
+                                            case 't':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 877;
+                                                        break;
+                                                    case 'i':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'v') break;
+                                                        if (n <= 7) break;
+                                                        switch (q[-8]) {
+                                                            case 'e':
+                                                                i = 878;
+                                                                break;
+                                                            case 'o':
+                                                                i = 879;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 's':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'a') break;
+                                                        i = 880;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'v':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 881;
+                                                        break;
+                                                    case 'e':
+                                                        i = 882;
+                                                        break;
+                                                    case 'i':
+                                                        i = 883;
+                                                        break;
+                                                    case 'o':
+                                                        i = 884;
+                                                        break;
+                                                }
+                                                break;
+                                            case 0x161:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'o') break;
+                                                i = 885;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 886;
+                                                break;
+                                            case 'e':
+                                                i = 887;
+                                                break;
+                                            case 's':
+                                                i = 888;
+                                                break;
+                                            case 0x161:
+                                                i = 889;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'k':
+                                i = 890;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 's':
+                                        i = 891;
+                                        break;
+                                    case 0x161:
+                                        i = 892;
+                                        break;
+                                }
+                                break;
+                            case 'l':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 893;
+                                break;
+                            case 'n':
+                                i = 894;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'c':
+                                        i = 895;
+                                        break;
+                                    case 0x10D:
+                                        i = 896;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 897;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                i = 898;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 899;
+                                        break;
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'j') break;
+                                        i = 900;
+                                        break;
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'v') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'e':
+                                                i = 901;
+                                                break;
+                                            case 'o':
+                                                i = 902;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 903;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 904;
+                                        break;
+                                    case 'e':
+                                        i = 905;
+                                        break;
+                                    case 'i':
+                                        i = 906;
+                                        break;
+                                    case 'o':
+                                        i = 907;
+                                        break;
+                                }
+                                break;
+                            case 0x107:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 908;
+                                        break;
+                                    case 'e':
+                                        i = 909;
+                                        break;
+                                    case 'u':
+                                        i = 910;
+                                        break;
+                                }
+                                break;
+                            case 0x10D:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 911;
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'l') break;
+                                        i = 912;
+                                        break;
+                                }
+                                break;
+                            case 0x161:
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 913;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                i = 914;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        if (q[-3] != 'd') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 't') break;
+                        if (n <= 5) break;
+                        if (q[-6] != 's') break;
+                        if (n <= 6) break;
+                        switch (q[-7]) {
+                            case 'a':
+                                i = 915;
+                                break;
+                            case 'i':
+                                i = 916;
+                                break;
+                            case 'o':
+                                i = 917;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 918;
+                                        break;
+                                    case 'e':
+                                        i = 919;
+                                        break;
+                                    case 'u':
+                                        i = 920;
+                                        break;
+                                }
+                                break;
+                            case 0x107:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 921;
+                                        break;
+                                    case 'e':
+                                        i = 922;
+                                        break;
+                                    case 'u':
+                                        i = 923;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'i':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'c':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 924;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 925;
+                                        break;
+                                    case 'i':
+                                        i = 926;
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 927;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'r':
+                                                        if (n <= 6) break;
+                                                        switch (q[-7]) {
+                                                            case 'i':
+                                                                i = 928;
+                                                                break;
+                                                            case 'u':
+                                                                i = 929;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 't':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 's') break;
+                                                        if (n <= 7) break;
+                                                        switch (q[-8]) {
+                                                            case 'a':
+                                                                i = 930;
+                                                                break;
+                                                            case 'i':
+                                                                i = 931;
+                                                                break;
+                                                            case 'o':
+                                                                i = 932;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'v':
+                                                        if (n <= 6) break;
+                                                        switch (q[-7]) {
+                                                            case 'a':
+                                                                i = 933;
+                                                                break;
+                                                            case 'e':
+                                                                i = 934;
+                                                                break;
+                                                            case 'i':
+                                                                i = 935;
+                                                                break;
+                                                            case 'u':
+                                                                i = 936;
+                                                                break;
+                                                        }
+                                                        break;
+                                                }
+                                                break;
+                                            case 'u':
+                                                i = 937;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'c':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'u') break;
+                                                        if (n <= 7) break;
+                                                        if (q[-8] != 'l') break;
+                                                        i = 938;
+                                                        break;
+                                                    case 'r':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'i') break;
+                                                        i = 939;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'l':
+                                        i = 940;
+                                        break;
+                                    case 'n':
+                                        i = 941;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'e':
+                                                i = 942;
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 943;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'g':
+                        i = 944;
+                        if (n <= 2) break;
+                        if (q[-3] != 'u') break;
+                        i = 945;
+                        break;
+                    case 'j':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 946;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        i = 947;
+                                        break;
+                                    case 'l':
+                                        i = 948;
+                                        break;
+                                    case 'r':
+                                        i = 949;
+                                        break;
+                                    case 0x107:
+                                        i = 950;
+                                        break;
+                                    case 0x10D:
+                                        i = 951;
+                                        break;
+                                    case 0x111:
+                                        i = 952;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        i = 953;
+                                        break;
+                                    case 'c':
+                                        i = 954;
+                                        break;
+                                    case 'd':
+                                        i = 955;
+                                        break;
+                                    case 'f':
+                                        i = 956;
+                                        break;
+                                    case 'g':
+                                        i = 957;
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'n') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 958;
+                                                break;
+                                            case 'e':
+                                                i = 959;
+                                                break;
+                                            case 's':
+                                                i = 960;
+                                                break;
+                                            case 0x161:
+                                                i = 961;
+                                                break;
+                                        }
+                                        break;
+                                    case 'k':
+                                        i = 962;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 's':
+                                                i = 963;
+                                                break;
+                                            case 0x161:
+                                                i = 964;
+                                                break;
+                                        }
+                                        break;
+                                    case 'l':
+                                        i = 965;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 966;
+                                        break;
+                                    case 'm':
+                                        i = 967;
+                                        break;
+                                    case 'n':
+                                        i = 968;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'g':
+                                                i = 969;
+                                                break;
+                                            case 'm':
+                                                i = 970;
+                                                break;
+                                            case 'p':
+                                                i = 971;
+                                                break;
+                                            case 'r':
+                                                i = 972;
+                                                break;
+                                            case 't':
+                                                i = 973;
+                                                break;
+                                        }
+                                        break;
+                                    case 'p':
+                                        i = 974;
+                                        break;
+                                    case 'r':
+                                        i = 975;
+                                        break;
+                                    case 's':
+                                        i = 976;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 977;
+                                        break;
+                                    case 't':
+                                        i = 978;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 979;
+                                                break;
+                                            case 'i':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'v') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'e':
+                                                        i = 980;
+                                                        break;
+                                                    case 'o':
+                                                        i = 981;
+                                                        break;
+                                                }
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 982;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 983;
+                                                break;
+                                            case 'e':
+                                                i = 984;
+                                                break;
+                                            case 'i':
+                                                i = 985;
+                                                break;
+                                            case 'o':
+                                                i = 986;
+                                                break;
+                                        }
+                                        break;
+                                    case 'z':
+                                        i = 987;
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 988;
+                                        break;
+                                    case 0x17E:
+                                        i = 989;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 990;
+                                        break;
+                                    case 'e':
+                                        i = 991;
+                                        break;
+                                    case 's':
+                                        i = 992;
+                                        break;
+                                    case 0x161:
+                                        i = 993;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'k':
+                        i = 994;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 's':
+                                i = 995;
+                                break;
+                            case 0x161:
+                                i = 996;
+                                break;
+                        }
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 997;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 998;
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 't') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 's') break;
+                                                if (n <= 7) break;
+                                                switch (q[-8]) {
+                                                    case 'a':
+                                                        i = 999;
+                                                        break;
+                                                    case 'i':
+                                                        i = 1000;
+                                                        break;
+                                                    case 'o':
+                                                        i = 1001;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'i':
+                                                i = 1002;
+                                                break;
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 1003;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        i = 1004;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'i':
+                                                i = 1005;
+                                                break;
+                                            case 'u':
+                                                i = 1006;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        i = 1007;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 1008;
+                                                break;
+                                            case 'i':
+                                                i = 1009;
+                                                break;
+                                            case 'o':
+                                                i = 1010;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1011;
+                                                break;
+                                            case 'e':
+                                                i = 1012;
+                                                break;
+                                            case 'i':
+                                                i = 1013;
+                                                break;
+                                            case 'o':
+                                                i = 1014;
+                                                break;
+                                            case 'u':
+                                                i = 1015;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1016;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 1017;
+                                break;
+                            case 'i':
+                                i = 1018;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1019;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 1020;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        i = 1021;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 1022;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'j') break;
+                                        i = 1023;
+                                        break;
+                                    case 'z':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 1024;
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1025;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 1026;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 1027;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                i = 1028;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 1029;
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                i = 1030;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                i = 1031;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                if (q[-4] != 'l') break;
+                                i = 1032;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        i = 1033;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 1034;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1035;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'u') break;
+                                        i = 1036;
+                                        break;
+                                    case 't':
+                                        i = 1037;
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1038;
+                                                break;
+                                            case 'e':
+                                                i = 1039;
+                                                break;
+                                            case 'i':
+                                                i = 1040;
+                                                break;
+                                            case 'u':
+                                                i = 1041;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1042;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1043;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 1044;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1045;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 1046;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 1047;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        i = 1048;
+                                        break;
+                                    case 0x10D:
+                                        i = 1049;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                i = 1050;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 1051;
+                                break;
+                            case 'd':
+                                i = 1052;
+                                break;
+                            case 'e':
+                                i = 1053;
+                                break;
+                            case 'o':
+                                i = 1054;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        i = 1055;
+                                        break;
+                                    case 'g':
+                                        i = 1056;
+                                        break;
+                                    case 'j':
+                                        i = 1057;
+                                        break;
+                                    case 'k':
+                                        i = 1058;
+                                        break;
+                                    case 'n':
+                                        i = 1059;
+                                        break;
+                                    case 't':
+                                        i = 1060;
+                                        break;
+                                    case 'v':
+                                        i = 1061;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 1062;
+                                break;
+                            case 'i':
+                                i = 1063;
+                                break;
+                            case 'o':
+                                i = 1064;
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1065;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'c':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 1066;
+                                                break;
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 1067;
+                                                break;
+                                            case 't':
+                                                i = 1068;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'e':
+                                                        i = 1069;
+                                                        break;
+                                                    case 's':
+                                                        if (n <= 6) break;
+                                                        switch (q[-7]) {
+                                                            case 'a':
+                                                                i = 1070;
+                                                                break;
+                                                            case 'i':
+                                                                i = 1071;
+                                                                break;
+                                                            case 'o':
+                                                                i = 1072;
+                                                                break;
+                                                        }
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'i':
+                                        i = 1073;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'n':
+                                                i = 1074;
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'o') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'r') break;
+                                                i = 1075;
+                                                break;
+                                        }
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'n') break;
+                                        i = 1076;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 1077;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1078;
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 't') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 's') break;
+                                                if (n <= 7) break;
+                                                switch (q[-8]) {
+                                                    case 'a':
+                                                        i = 1079;
+                                                        break;
+                                                    case 'i':
+                                                        i = 1080;
+                                                        break;
+                                                    case 'o':
+                                                        i = 1081;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 1082;
+                                                break;
+                                        }
+                                        break;
+                                    case 'k':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 1083;
+                                        break;
+                                    case 'l':
+                                        i = 1084;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'i':
+                                                i = 1085;
+                                                break;
+                                            case 'u':
+                                                i = 1086;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        i = 1087;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 1088;
+                                                break;
+                                            case 'i':
+                                                i = 1089;
+                                                break;
+                                            case 'o':
+                                                i = 1090;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1091;
+                                                break;
+                                            case 'e':
+                                                i = 1092;
+                                                break;
+                                            case 'i':
+                                                i = 1093;
+                                                break;
+                                            case 'o':
+                                                i = 1094;
+                                                break;
+                                            case 'u':
+                                                i = 1095;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1096;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 1097;
+                                break;
+                            case 'i':
+                                i = 1098;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1099;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 1100;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        i = 1101;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 1102;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'j') break;
+                                        i = 1103;
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'e':
+                                                i = 1104;
+                                                break;
+                                            case 'o':
+                                                i = 1105;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1106;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 1107;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 1108;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1109;
+                                        break;
+                                    case 'e':
+                                        i = 1110;
+                                        break;
+                                    case 'i':
+                                        i = 1111;
+                                        break;
+                                    case 'k':
+                                        i = 1112;
+                                        break;
+                                    case 'o':
+                                        i = 1113;
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                i = 1114;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 1115;
+                                break;
+                            case 'e':
+                                i = 1116;
+                                if (n <= 3) break;
+                                if (q[-4] != 'j') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 1117;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'c':
+                                        i = 1118;
+                                        break;
+                                    case 'l':
+                                        i = 1119;
+                                        break;
+                                    case 'r':
+                                        i = 1120;
+                                        break;
+                                    case 0x107:
+                                        i = 1121;
+                                        break;
+                                    case 0x10D:
+                                        i = 1122;
+                                        break;
+                                    case 0x111:
+                                        i = 1123;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 1124;
+                                break;
+                            case 'o':
+                                i = 1125;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'g':
+                                        i = 1126;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'u') break;
+                                        i = 1127;
+                                        break;
+                                    case 'l':
+                                        i = 1128;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 1129;
+                                        break;
+                                    case 'm':
+                                        i = 1130;
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 1131;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x107:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'e':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 1132;
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1133;
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1134;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'r':
+                                                        if (n <= 6) break;
+                                                        switch (q[-7]) {
+                                                            case 'i':
+                                                                i = 1135;
+                                                                break;
+                                                            case 'u':
+                                                                i = 1136;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 't':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 's') break;
+                                                        if (n <= 7) break;
+                                                        switch (q[-8]) {
+                                                            case 'a':
+                                                                i = 1137;
+                                                                break;
+                                                            case 'i':
+                                                                i = 1138;
+                                                                break;
+                                                            case 'o':
+                                                                i = 1139;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'v':
+                                                        if (n <= 6) break;
+                                                        switch (q[-7]) {
+                                                            case 'a':
+                                                                i = 1140;
+                                                                break;
+                                                            case 'e':
+                                                                i = 1141;
+                                                                break;
+                                                            case 'i':
+                                                                i = 1142;
+                                                                break;
+                                                            case 'u':
+                                                                i = 1143;
+                                                                break;
+                                                        }
+                                                        break;
+                                                }
+                                                break;
+                                            case 'u':
+                                                i = 1144;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'r':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'i') break;
+                                                        i = 1145;
+                                                        break;
+                                                    case 0x10D:
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'u') break;
+                                                        if (n <= 7) break;
+                                                        if (q[-8] != 'l') break;
+                                                        i = 1146;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        i = 1147;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'e':
+                                                i = 1148;
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 1149;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x10D:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 1150;
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'l') break;
+                                i = 1151;
+                                break;
+                        }
+                        break;
+                    case 0x161:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        i = 1152;
+                                        break;
+                                    case 'g':
+                                        i = 1153;
+                                        break;
+                                    case 'j':
+                                        i = 1154;
+                                        break;
+                                    case 'k':
+                                        i = 1155;
+                                        break;
+                                    case 'n':
+                                        i = 1156;
+                                        break;
+                                    case 't':
+                                        i = 1157;
+                                        break;
+                                    case 'v':
+                                        i = 1158;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 1159;
+                                break;
+                            case 'i':
+                                i = 1160;
+                                break;
+                            case 'o':
+                                i = 1161;
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1162;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 1163;
+                                                break;
+                                            case 't':
+                                                i = 1164;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'e':
+                                                        i = 1165;
+                                                        break;
+                                                    case 's':
+                                                        if (n <= 6) break;
+                                                        switch (q[-7]) {
+                                                            case 'a':
+                                                                i = 1166;
+                                                                break;
+                                                            case 'i':
+                                                                i = 1167;
+                                                                break;
+                                                            case 'o':
+                                                                i = 1168;
+                                                                break;
+                                                        }
+                                                        break;
+                                                }
+                                                break;
+                                            case 0x10D:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 1169;
+                                                break;
+                                        }
+                                        break;
+                                    case 'i':
+                                        i = 1170;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'n':
+                                                i = 1171;
+                                                break;
+                                            case 0x161:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'o') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'r') break;
+                                                i = 1172;
+                                                break;
+                                        }
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'n') break;
+                                        i = 1173;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'j':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 1174;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'u') break;
+                                i = 1175;
+                                break;
+                            case 't':
+                                i = 1176;
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1177;
+                                        break;
+                                    case 'e':
+                                        i = 1178;
+                                        break;
+                                    case 'i':
+                                        i = 1179;
+                                        break;
+                                    case 'u':
+                                        i = 1180;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        i = 1181;
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1182;
+                                        break;
+                                    case 'e':
+                                        i = 1183;
+                                        break;
+                                    case 'u':
+                                        i = 1184;
+                                        break;
+                                }
+                                break;
+                            case 'j':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'j':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'n') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'a':
+                                                        i = 1185;
+                                                        break;
+                                                    case 'e':
+                                                        i = 1186;
+                                                        break;
+                                                    case 's':
+                                                        i = 1187;
+                                                        break;
+                                                    case 0x161:
+                                                        i = 1188;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'k':
+                                                i = 1189;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 's':
+                                                        i = 1190;
+                                                        break;
+                                                    case 0x161:
+                                                        i = 1191;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'l':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'e') break;
+                                                i = 1192;
+                                                break;
+                                            case 'n':
+                                                i = 1193;
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'o') break;
+                                                i = 1194;
+                                                break;
+                                            case 't':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'i':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'v') break;
+                                                        if (n <= 7) break;
+                                                        switch (q[-8]) {
+                                                            case 'e':
+                                                                i = 1195;
+                                                                break;
+                                                            case 'o':
+                                                                i = 1196;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 's':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'a') break;
+                                                        i = 1197;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'v':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 1198;
+                                                        break;
+                                                    case 'e':
+                                                        i = 1199;
+                                                        break;
+                                                    case 'i':
+                                                        i = 1200;
+                                                        break;
+                                                    case 'o':
+                                                        i = 1201;
+                                                        break;
+                                                }
+                                                break;
+                                            case 0x161:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'o') break;
+                                                i = 1202;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1203;
+                                                break;
+                                            case 'e':
+                                                i = 1204;
+                                                break;
+                                            case 's':
+                                                i = 1205;
+                                                break;
+                                            case 0x161:
+                                                i = 1206;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'k':
+                                i = 1207;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 's':
+                                        i = 1208;
+                                        break;
+                                    case 0x161:
+                                        i = 1209;
+                                        break;
+                                }
+                                break;
+                            case 'l':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1210;
+                                        break;
+                                    case 'e':
+                                        i = 1211;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                i = 1212;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'c':
+                                        i = 1213;
+                                        break;
+                                    case 0x10D:
+                                        i = 1214;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 1215;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1216;
+                                        break;
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'v') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'e':
+                                                i = 1217;
+                                                break;
+                                            case 'o':
+                                                i = 1218;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1219;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1220;
+                                        break;
+                                    case 'e':
+                                        i = 1221;
+                                        break;
+                                    case 'i':
+                                        i = 1222;
+                                        break;
+                                    case 'o':
+                                        i = 1223;
+                                        break;
+                                }
+                                break;
+                            case 0x107:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1224;
+                                        break;
+                                    case 'e':
+                                        i = 1225;
+                                        break;
+                                    case 'u':
+                                        i = 1226;
+                                        break;
+                                }
+                                break;
+                            case 0x161:
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 1227;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'u') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'l') break;
+                                i = 1228;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 1229;
+                                break;
+                            case 0x10D:
+                                if (n <= 3) break;
+                                if (q[-4] != 'u') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'l') break;
+                                i = 1230;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'l':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 1231;
+                        if (n <= 2) break;
+                        if (q[-3] != 'r') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'i':
+                                i = 1232;
+                                break;
+                            case 'u':
+                                i = 1233;
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        i = 1234;
+                        break;
+                    case 'i':
+                        i = 1235;
+                        break;
+                }
+                break;
+            case 'm':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 1236;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 1237;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 1238;
+                                        break;
+                                    case 'u':
+                                        i = 1239;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                i = 1240;
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1241;
+                                        break;
+                                    case 'e':
+                                        i = 1242;
+                                        break;
+                                    case 'i':
+                                        i = 1243;
+                                        break;
+                                    case 'u':
+                                        i = 1244;
+                                        break;
+                                }
+                                break;
+                            case 0x10D:
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 1245;
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        i = 1246;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1247;
+                                        break;
+                                    case 'e':
+                                        i = 1248;
+                                        break;
+                                    case 'u':
+                                        i = 1249;
+                                        break;
+                                }
+                                break;
+                            case 'd':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 's') break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 'a':
+                                        i = 1250;
+                                        break;
+                                    case 'i':
+                                        i = 1251;
+                                        break;
+                                    case 'o':
+                                        i = 1252;
+                                        break;
+                                }
+                                break;
+                            case 'j':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1253;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'c':
+                                                i = 1254;
+                                                break;
+                                            case 'l':
+                                                i = 1255;
+                                                break;
+                                            case 'r':
+                                                i = 1256;
+                                                break;
+                                            case 't':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 's') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'a':
+                                                        i = 1257;
+                                                        break;
+                                                    case 'i':
+                                                        i = 1258;
+                                                        break;
+                                                    case 'o':
+                                                        i = 1259;
+                                                        break;
+                                                }
+                                                break;
+                                            case 0x107:
+                                                i = 1260;
+                                                break;
+                                            case 0x10D:
+                                                i = 1261;
+                                                break;
+                                            case 0x111:
+                                                i = 1262;
+                                                break;
+                                        }
+                                        break;
+                                    case 'i':
+                                        i = 1263;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'j':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'n') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'a':
+                                                        i = 1264;
+                                                        break;
+                                                    case 'e':
+                                                        i = 1265;
+                                                        break;
+                                                    case 's':
+                                                        i = 1266;
+                                                        break;
+                                                    case 0x161:
+                                                        i = 1267;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'k':
+                                                i = 1268;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 's':
+                                                        i = 1269;
+                                                        break;
+                                                    case 0x161:
+                                                        i = 1270;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'l':
+                                                i = 1271;
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'e') break;
+                                                i = 1272;
+                                                break;
+                                            case 'n':
+                                                i = 1273;
+                                                break;
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'r') break;
+                                                i = 1274;
+                                                break;
+                                            case 's':
+                                                i = 1275;
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'o') break;
+                                                i = 1276;
+                                                break;
+                                            case 't':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 1277;
+                                                        break;
+                                                    case 'i':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'v') break;
+                                                        if (n <= 7) break;
+                                                        switch (q[-8]) {
+                                                            case 'e':
+                                                                i = 1278;
+                                                                break;
+                                                            case 'o':
+                                                                i = 1279;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'o':
+                                                        i = 1280;
+                                                        break;
+                                                    case 's':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'a') break;
+                                                        i = 1281;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'v':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 1282;
+                                                        break;
+                                                    case 'e':
+                                                        i = 1283;
+                                                        break;
+                                                    case 'i':
+                                                        i = 1284;
+                                                        break;
+                                                    case 'o':
+                                                        i = 1285;
+                                                        break;
+                                                }
+                                                break;
+                                            case 0x161:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'o') break;
+                                                i = 1286;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1287;
+                                                break;
+                                            case 'e':
+                                                i = 1288;
+                                                break;
+                                            case 'i':
+                                                i = 1289;
+                                                break;
+                                            case 's':
+                                                i = 1290;
+                                                break;
+                                            case 0x161:
+                                                i = 1291;
+                                                break;
+                                        }
+                                        break;
+                                    case 'u':
+                                        i = 1292;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'c':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'u') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'l') break;
+                                                i = 1293;
+                                                break;
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 1294;
+                                                break;
+                                            case 0x10D:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'u') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'l') break;
+                                                i = 1295;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'k':
+                                i = 1296;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 's':
+                                        i = 1297;
+                                        break;
+                                    case 0x161:
+                                        i = 1298;
+                                        break;
+                                }
+                                break;
+                            case 'l':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 1299;
+                                break;
+                            case 'n':
+                                i = 1300;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1301;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 't') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        if (n <= 6) break;
+                                        switch (q[-7]) {
+                                            case 'a':
+                                                i = 1302;
+                                                break;
+                                            case 'i':
+                                                i = 1303;
+                                                break;
+                                            case 'o':
+                                                i = 1304;
+                                                break;
+                                        }
+                                        break;
+                                    case 'e':
+                                        i = 1305;
+                                        break;
+                                    case 's':
+                                        i = 1306;
+                                        break;
+                                    case 0x161:
+                                        i = 1307;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'b':
+                                                i = 1308;
+                                                break;
+                                            case 'g':
+                                                i = 1309;
+                                                break;
+                                            case 'j':
+                                                i = 1310;
+                                                break;
+                                            case 'k':
+                                                i = 1311;
+                                                break;
+                                            case 'n':
+                                                i = 1312;
+                                                break;
+                                            case 't':
+                                                i = 1313;
+                                                break;
+                                            case 'v':
+                                                i = 1314;
+                                                break;
+                                        }
+                                        break;
+                                    case 'e':
+                                        i = 1315;
+                                        break;
+                                    case 'i':
+                                        i = 1316;
+                                        break;
+                                    case 'o':
+                                        i = 1317;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1318;
+                                        break;
+                                    case 'e':
+                                        i = 1319;
+                                        break;
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'v') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'e':
+                                                i = 1320;
+                                                break;
+                                            case 'o':
+                                                i = 1321;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1322;
+                                                break;
+                                            case 'i':
+                                                i = 1323;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 1324;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1325;
+                                        break;
+                                    case 'e':
+                                        i = 1326;
+                                        break;
+                                    case 'i':
+                                        i = 1327;
+                                        break;
+                                }
+                                break;
+                            case 0x107:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1328;
+                                        break;
+                                    case 'e':
+                                        i = 1329;
+                                        break;
+                                    case 'u':
+                                        i = 1330;
+                                        break;
+                                }
+                                break;
+                            case 0x161:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'b':
+                                                i = 1331;
+                                                break;
+                                            case 'g':
+                                                i = 1332;
+                                                break;
+                                            case 'j':
+                                                i = 1333;
+                                                break;
+                                            case 'k':
+                                                i = 1334;
+                                                break;
+                                            case 'n':
+                                                i = 1335;
+                                                break;
+                                            case 't':
+                                                i = 1336;
+                                                break;
+                                            case 'v':
+                                                i = 1337;
+                                                break;
+                                        }
+                                        break;
+                                    case 'e':
+                                        i = 1338;
+                                        break;
+                                    case 'i':
+                                        i = 1339;
+                                        break;
+                                    case 'o':
+                                        i = 1340;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        i = 1341;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1342;
+                                        break;
+                                    case 'e':
+                                        i = 1343;
+                                        break;
+                                    case 'u':
+                                        i = 1344;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'l') break;
+                                        i = 1345;
+                                        break;
+                                }
+                                break;
+                            case 'j':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'j':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'n') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'a':
+                                                        i = 1346;
+                                                        break;
+                                                    case 'e':
+                                                        i = 1347;
+                                                        break;
+                                                    case 's':
+                                                        i = 1348;
+                                                        break;
+                                                    case 0x161:
+                                                        i = 1349;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'k':
+                                                i = 1350;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 's':
+                                                        i = 1351;
+                                                        break;
+                                                    case 0x161:
+                                                        i = 1352;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'l':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'e') break;
+                                                i = 1353;
+                                                break;
+                                            case 'n':
+                                                i = 1354;
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'o') break;
+                                                i = 1355;
+                                                break;
+                                            case 't':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 1356;
+                                                        break;
+                                                    case 'i':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'v') break;
+                                                        if (n <= 7) break;
+                                                        switch (q[-8]) {
+                                                            case 'e':
+                                                                i = 1357;
+                                                                break;
+                                                            case 'o':
+                                                                i = 1358;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 's':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'a') break;
+                                                        i = 1359;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'v':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 1360;
+                                                        break;
+                                                    case 'e':
+                                                        i = 1361;
+                                                        break;
+                                                    case 'i':
+                                                        i = 1362;
+                                                        break;
+                                                    case 'o':
+                                                        i = 1363;
+                                                        break;
+                                                }
+                                                break;
+                                            case 0x161:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'o') break;
+                                                i = 1364;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1365;
+                                                break;
+                                            case 'e':
+                                                i = 1366;
+                                                break;
+                                            case 's':
+                                                i = 1367;
+                                                break;
+                                            case 0x161:
+                                                i = 1368;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'k':
+                                i = 1369;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 's':
+                                        i = 1370;
+                                        break;
+                                    case 0x161:
+                                        i = 1371;
+                                        break;
+                                }
+                                break;
+                            case 'l':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                i = 1372;
+                                break;
+                            case 'n':
+                                i = 1373;
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'c':
+                                        i = 1374;
+                                        break;
+                                    case 0x10D:
+                                        i = 1375;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 1376;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                i = 1377;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1378;
+                                        break;
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'j') break;
+                                        i = 1379;
+                                        break;
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'v') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'e':
+                                                i = 1380;
+                                                break;
+                                            case 'o':
+                                                i = 1381;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1382;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1383;
+                                        break;
+                                    case 'e':
+                                        i = 1384;
+                                        break;
+                                    case 'i':
+                                        i = 1385;
+                                        break;
+                                    case 'o':
+                                        i = 1386;
+                                        break;
+                                }
+                                break;
+                            case 0x107:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1387;
+                                        break;
+                                    case 'e':
+                                        i = 1388;
+                                        break;
+                                    case 'u':
+                                        i = 1389;
+                                        break;
+                                }
+                                break;
+                            case 0x10D:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1390;
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'l') break;
+                                        i = 1391;
+                                        break;
+                                }
+                                break;
+                            case 0x161:
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                i = 1392;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                i = 1393;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1394;
+                                        break;
+                                    case 'e':
+                                        i = 1395;
+                                        break;
+                                    case 'u':
+                                        i = 1396;
+                                        break;
+                                }
+                                break;
+                            case 'g':
+                                i = 1397;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'o':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'l') break;
+                                        i = 1398;
+                                        break;
+                                    case 'u':
+                                        i = 1399;
+                                        break;
+                                }
+                                break;
+                            case 'j':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'b':
+                                                i = 1400;
+                                                break;
+                                            case 'c':
+                                                i = 1401;
+                                                break;
+                                            case 'd':
+                                                i = 1402;
+                                                break;
+                                            case 'f':
+                                                i = 1403;
+                                                break;
+                                            case 'g':
+                                                i = 1404;
+                                                break;
+                                            case 'l':
+                                                i = 1405;
+                                                break;
+                                            case 'm':
+                                                i = 1406;
+                                                break;
+                                            case 'n':
+                                                i = 1407;
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'g':
+                                                        i = 1408;
+                                                        break;
+                                                    case 'm':
+                                                        i = 1409;
+                                                        break;
+                                                    case 'p':
+                                                        i = 1410;
+                                                        break;
+                                                    case 'r':
+                                                        i = 1411;
+                                                        break;
+                                                    case 't':
+                                                        i = 1412;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'p':
+                                                i = 1413;
+                                                break;
+                                            case 'r':
+                                                i = 1414;
+                                                break;
+                                            case 's':
+                                                i = 1415;
+                                                break;
+                                            case 't':
+                                                i = 1416;
+                                                break;
+                                            case 'z':
+                                                i = 1417;
+                                                break;
+                                            case 0x17E:
+                                                i = 1418;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1419;
+                                                break;
+                                            case 'e':
+                                                i = 1420;
+                                                break;
+                                            case 's':
+                                                i = 1421;
+                                                break;
+                                            case 0x161:
+                                                i = 1422;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'k':
+                                i = 1423;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 's':
+                                        i = 1424;
+                                        break;
+                                    case 0x161:
+                                        i = 1425;
+                                        break;
+                                }
+                                break;
+                            case 'l':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1426;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'j':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 1427;
+                                                break;
+                                            case 'n':
+                                                i = 1428;
+                                                break;
+                                        }
+                                        break;
+                                    case 'e':
+                                        i = 1429;
+                                        break;
+                                    case 'i':
+                                        i = 1430;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'z') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'o') break;
+                                        i = 1431;
+                                        break;
+                                    case 'o':
+                                        i = 1432;
+                                        break;
+                                }
+                                break;
+                            case 'm':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'r') break;
+                                        i = 1433;
+                                        break;
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'l') break;
+                                        i = 1434;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                i = 1435;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1436;
+                                        break;
+                                    case 'i':
+                                        i = 1437;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'c':
+                                                i = 1438;
+                                                break;
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 1439;
+                                                break;
+                                            case 0x10D:
+                                                i = 1440;
+                                                break;
+                                        }
+                                        break;
+                                    case 'o':
+                                        i = 1441;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1442;
+                                        break;
+                                    case 'd':
+                                        i = 1443;
+                                        break;
+                                    case 'e':
+                                        i = 1444;
+                                        break;
+                                    case 'o':
+                                        i = 1445;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'b':
+                                                i = 1446;
+                                                break;
+                                            case 'g':
+                                                i = 1447;
+                                                break;
+                                            case 'j':
+                                                i = 1448;
+                                                break;
+                                            case 'k':
+                                                i = 1449;
+                                                break;
+                                            case 'n':
+                                                i = 1450;
+                                                break;
+                                            case 't':
+                                                i = 1451;
+                                                break;
+                                            case 'v':
+                                                i = 1452;
+                                                break;
+                                        }
+                                        break;
+                                    case 'e':
+                                        i = 1453;
+                                        break;
+                                    case 'i':
+                                        i = 1454;
+                                        break;
+                                    case 'o':
+                                        i = 1455;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1456;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'k':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 1457;
+                                                break;
+                                            case 'l':
+                                                i = 1458;
+                                                break;
+                                        }
+                                        break;
+                                    case 'e':
+                                        i = 1459;
+                                        break;
+                                    case 'i':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'v') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'e':
+                                                i = 1460;
+                                                break;
+                                            case 'o':
+                                                i = 1461;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1462;
+                                                break;
+                                            case 'e':
+                                                i = 1463;
+                                                break;
+                                            case 'i':
+                                                i = 1464;
+                                                break;
+                                            case 'k':
+                                                i = 1465;
+                                                break;
+                                            case 'o':
+                                                i = 1466;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1467;
+                                        break;
+                                    case 'e':
+                                        i = 1468;
+                                        break;
+                                    case 'i':
+                                        i = 1469;
+                                        break;
+                                    case 'o':
+                                        i = 1470;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'l':
+                                                i = 1471;
+                                                break;
+                                            case 'm':
+                                                i = 1472;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 's':
+                                                i = 1473;
+                                                break;
+                                            case 0x161:
+                                                i = 1474;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 0x107:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1475;
+                                        break;
+                                    case 'e':
+                                        i = 1476;
+                                        break;
+                                    case 'u':
+                                        i = 1477;
+                                        break;
+                                }
+                                break;
+                            case 0x161:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'b':
+                                                i = 1478;
+                                                break;
+                                            case 'g':
+                                                i = 1479;
+                                                break;
+                                            case 'j':
+                                                i = 1480;
+                                                break;
+                                            case 'k':
+                                                i = 1481;
+                                                break;
+                                            case 'n':
+                                                i = 1482;
+                                                break;
+                                            case 't':
+                                                i = 1483;
+                                                break;
+                                            case 'v':
+                                                i = 1484;
+                                                break;
+                                        }
+                                        break;
+                                    case 'e':
+                                        i = 1485;
+                                        break;
+                                    case 'i':
+                                        i = 1486;
+                                        break;
+                                    case 'o':
+                                        i = 1487;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'n':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 1488;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 1489;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 1490;
+                                        break;
+                                    case 'u':
+                                        i = 1491;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                i = 1492;
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1493;
+                                        break;
+                                    case 'e':
+                                        i = 1494;
+                                        break;
+                                    case 'i':
+                                        i = 1495;
+                                        break;
+                                    case 'u':
+                                        i = 1496;
+                                        break;
+                                }
+                                break;
+                            case 0x10D:
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 1497;
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1498;
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'l') break;
+                                        i = 1499;
+                                        break;
+                                }
+                                break;
+                            case 0x10D:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1500;
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'l') break;
+                                        i = 1501;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'a') break;
+                        i = 1502;
+                        break;
+                }
+                break;
+            case 'o':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 1503;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 1504;
+                                break;
+                            case 'j':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 't') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        if (n <= 6) break;
+                                        switch (q[-7]) {
+                                            case 'a':
+                                                i = 1505;
+                                                break;
+                                            case 'i':
+                                                i = 1506;
+                                                break;
+                                            case 'o':
+                                                i = 1507;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 1508;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 1509;
+                                        break;
+                                    case 'u':
+                                        i = 1510;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                i = 1511;
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 1512;
+                                        break;
+                                    case 'i':
+                                        i = 1513;
+                                        break;
+                                    case 'o':
+                                        i = 1514;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1515;
+                                        break;
+                                    case 'e':
+                                        i = 1516;
+                                        break;
+                                    case 'i':
+                                        i = 1517;
+                                        break;
+                                    case 'o':
+                                        i = 1518;
+                                        break;
+                                    case 'u':
+                                        i = 1519;
+                                        break;
+                                }
+                                break;
+                            case 0x10D:
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 1520;
+                                break;
+                        }
+                        break;
+                    case 'g':
+                        i = 1521;
+                        if (n <= 2) break;
+                        if (q[-3] != 'u') break;
+                        i = 1522;
+                        break;
+                    case 'i':
+                        i = 1523;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1524;
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'l') break;
+                                        i = 1525;
+                                        break;
+                                }
+                                break;
+                            case 'l':
+                                i = 1526;
+                                break;
+                            case 'n':
+                                i = 1527;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                i = 1528;
+                                break;
+                            case 's':
+                                i = 1529;
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                i = 1530;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'e':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'j') break;
+                                        i = 1531;
+                                        break;
+                                    case 'o':
+                                        i = 1532;
+                                        break;
+                                }
+                                break;
+                            case 0x10D:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1533;
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'l') break;
+                                        i = 1534;
+                                        break;
+                                }
+                                break;
+                            case 0x161:
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                i = 1535;
+                                break;
+                        }
+                        break;
+                    case 'j':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'i':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        i = 1536;
+                                        break;
+                                    case 'c':
+                                        i = 1537;
+                                        break;
+                                    case 'd':
+                                        i = 1538;
+                                        break;
+                                    case 'f':
+                                        i = 1539;
+                                        break;
+                                    case 'g':
+                                        i = 1540;
+                                        break;
+                                    case 'l':
+                                        i = 1541;
+                                        break;
+                                    case 'm':
+                                        i = 1542;
+                                        break;
+                                    case 'n':
+                                        i = 1543;
+                                        break;
+                                    case 'p':
+                                        i = 1544;
+                                        break;
+                                    case 'r':
+                                        i = 1545;
+                                        break;
+                                    case 's':
+                                        i = 1546;
+                                        break;
+                                    case 't':
+                                        i = 1547;
+                                        break;
+                                    case 'z':
+                                        i = 1548;
+                                        break;
+                                    case 0x17E:
+                                        i = 1549;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1550;
+                                        break;
+                                    case 'e':
+                                        i = 1551;
+                                        break;
+                                    case 's':
+                                        i = 1552;
+                                        break;
+                                    case 0x161:
+                                        i = 1553;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'k':
+                        i = 1554;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 's':
+                                i = 1555;
+                                break;
+                            case 0x161:
+                                i = 1556;
+                                break;
+                        }
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 1557;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1558;
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 't') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 's') break;
+                                                if (n <= 7) break;
+                                                switch (q[-8]) {
+                                                    case 'a':
+                                                        i = 1559;
+                                                        break;
+                                                    case 'i':
+                                                        i = 1560;
+                                                        break;
+                                                    case 'o':
+                                                        i = 1561;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'i':
+                                                i = 1562;
+                                                break;
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 1563;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        i = 1564;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'i':
+                                                i = 1565;
+                                                break;
+                                            case 'u':
+                                                i = 1566;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        i = 1567;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 1568;
+                                                break;
+                                            case 'i':
+                                                i = 1569;
+                                                break;
+                                            case 'o':
+                                                i = 1570;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1571;
+                                                break;
+                                            case 'e':
+                                                i = 1572;
+                                                break;
+                                            case 'i':
+                                                i = 1573;
+                                                break;
+                                            case 'o':
+                                                i = 1574;
+                                                break;
+                                            case 'u':
+                                                i = 1575;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1576;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 1577;
+                                break;
+                            case 'i':
+                                i = 1578;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1579;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 1580;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        i = 1581;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 1582;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'j') break;
+                                        i = 1583;
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1584;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 1585;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 1586;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 1587;
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                i = 1588;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 1589;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1590;
+                                        break;
+                                    case 'r':
+                                        i = 1591;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'i':
+                                                i = 1592;
+                                                break;
+                                            case 'u':
+                                                i = 1593;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        i = 1594;
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1595;
+                                                break;
+                                            case 'e':
+                                                i = 1596;
+                                                break;
+                                            case 'i':
+                                                i = 1597;
+                                                break;
+                                            case 'u':
+                                                i = 1598;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1599;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 1600;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'd':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 's') break;
+                                        if (n <= 7) break;
+                                        switch (q[-8]) {
+                                            case 'a':
+                                                i = 1601;
+                                                break;
+                                            case 'i':
+                                                i = 1602;
+                                                break;
+                                            case 'o':
+                                                i = 1603;
+                                                break;
+                                        }
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 't') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 's') break;
+                                                if (n <= 7) break;
+                                                switch (q[-8]) {
+                                                    case 'a':
+                                                        i = 1604;
+                                                        break;
+                                                    case 'i':
+                                                        i = 1605;
+                                                        break;
+                                                    case 'o':
+                                                        i = 1606;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'i':
+                                                i = 1607;
+                                                break;
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 1608;
+                                                break;
+                                            case 'u':
+                                                i = 1609;
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'c':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'u') break;
+                                                        if (n <= 7) break;
+                                                        if (q[-8] != 'l') break;
+                                                        i = 1610;
+                                                        break;
+                                                    case 'r':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'i') break;
+                                                        i = 1611;
+                                                        break;
+                                                    case 0x10D:
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'u') break;
+                                                        if (n <= 7) break;
+                                                        if (q[-8] != 'l') break;
+                                                        i = 1612;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'l':
+                                        i = 1613;
+                                        break;
+                                    case 'n':
+                                        i = 1614;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 's') break;
+                                        if (n <= 7) break;
+                                        switch (q[-8]) {
+                                            case 'a':
+                                                i = 1615;
+                                                break;
+                                            case 'i':
+                                                i = 1616;
+                                                break;
+                                            case 'o':
+                                                i = 1617;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'e':
+                                                i = 1618;
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 1619;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 1620;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1621;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 1622;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        i = 1623;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 's') break;
+                                        if (n <= 7) break;
+                                        switch (q[-8]) {
+                                            case 'a':
+                                                i = 1624;
+                                                break;
+                                            case 'i':
+                                                i = 1625;
+                                                break;
+                                            case 'o':
+                                                i = 1626;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 1627;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'e':
+                                                i = 1628;
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'j') break;
+                                                i = 1629;
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 1630;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1631;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 1632;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 1633;
+                                        break;
+                                }
+                                break;
+                            case 'j':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1634;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'u') break;
+                                                i = 1635;
+                                                break;
+                                            case 't':
+                                                i = 1636;
+                                                if (n <= 5) break;
+                                                if (q[-6] != 's') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'a':
+                                                        i = 1637;
+                                                        break;
+                                                    case 'i':
+                                                        i = 1638;
+                                                        break;
+                                                    case 'o':
+                                                        i = 1639;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'v':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 1640;
+                                                        break;
+                                                    case 'e':
+                                                        i = 1641;
+                                                        break;
+                                                    case 'i':
+                                                        i = 1642;
+                                                        break;
+                                                    case 'u':
+                                                        i = 1643;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'i':
+                                        i = 1644;
+                                        break;
+                                    case 'u':
+                                        i = 1645;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'c':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'u') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'l') break;
+                                                i = 1646;
+                                                break;
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 1647;
+                                                break;
+                                            case 0x10D:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'u') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'l') break;
+                                                i = 1648;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1649;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'c':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 1650;
+                                                break;
+                                            case 'j':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 't') break;
+                                                        if (n <= 7) break;
+                                                        if (q[-8] != 's') break;
+                                                        if (n <= 8) break;
+                                                        switch (q[-9]) {
+                                                            case 'a':
+                                                                i = 1651;
+                                                                break;
+                                                            case 'i':
+                                                                i = 1652;
+                                                                break;
+                                                            case 'o':
+                                                                i = 1653;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'n':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'i') break;
+                                                        i = 1654;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'i':
+                                                        i = 1655;
+                                                        break;
+                                                    case 'u':
+                                                        i = 1656;
+                                                        break;
+                                                }
+                                                break;
+                                            case 't':
+                                                i = 1657;
+                                                break;
+                                            case 'v':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 1658;
+                                                        break;
+                                                    case 'e':
+                                                        i = 1659;
+                                                        break;
+                                                    case 'i':
+                                                        i = 1660;
+                                                        break;
+                                                    case 'o':
+                                                        i = 1661;
+                                                        break;
+                                                    case 'u':
+                                                        i = 1662;
+                                                        break;
+                                                }
+                                                break;
+                                            case 0x10D:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 1663;
+                                                break;
+                                        }
+                                        break;
+                                    case 'i':
+                                        i = 1664;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'c':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 1665;
+                                                        break;
+                                                    case 'u':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'l') break;
+                                                        i = 1666;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'n':
+                                                i = 1667;
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'o') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'r') break;
+                                                i = 1668;
+                                                break;
+                                            case 't':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'e') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'j') break;
+                                                i = 1669;
+                                                break;
+                                            case 0x10D:
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 1670;
+                                                        break;
+                                                    case 'u':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'l') break;
+                                                        i = 1671;
+                                                        break;
+                                                }
+                                                break;
+                                            case 0x161:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'o') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'r') break;
+                                                i = 1672;
+                                                break;
+                                        }
+                                        break;
+                                    case 'o':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'd') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'a') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 't') break;
+                                        if (n <= 7) break;
+                                        if (q[-8] != 's') break;
+                                        if (n <= 8) break;
+                                        switch (q[-9]) {
+                                            case 'a':
+                                                i = 1673;
+                                                break;
+                                            case 'i':
+                                                i = 1674;
+                                                break;
+                                            case 'o':
+                                                i = 1675;
+                                                break;
+                                        }
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'n') break;
+                                        i = 1676;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        i = 1677;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 1678;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1679;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'u') break;
+                                        i = 1680;
+                                        break;
+                                    case 't':
+                                        i = 1681;
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1682;
+                                                break;
+                                            case 'e':
+                                                i = 1683;
+                                                break;
+                                            case 'i':
+                                                i = 1684;
+                                                break;
+                                            case 'u':
+                                                i = 1685;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1686;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1687;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 1688;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1689;
+                                                break;
+                                            case 'u':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'l') break;
+                                                i = 1690;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 1691;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        i = 1692;
+                                        break;
+                                    case 0x10D:
+                                        i = 1693;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 1694;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'k':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 1695;
+                                        break;
+                                    case 'l':
+                                        i = 1696;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 1697;
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 'v') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'e':
+                                        i = 1698;
+                                        break;
+                                    case 'o':
+                                        i = 1699;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1700;
+                                        break;
+                                    case 'e':
+                                        i = 1701;
+                                        break;
+                                    case 'i':
+                                        i = 1702;
+                                        break;
+                                    case 'k':
+                                        i = 1703;
+                                        break;
+                                    case 'o':
+                                        i = 1704;
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                if (n <= 3) break;
+                                if (q[-4] != 'n') break;
+                                i = 1705;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        i = 1706;
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 1707;
+                                break;
+                            case 'e':
+                                i = 1708;
+                                break;
+                            case 'i':
+                                i = 1709;
+                                break;
+                            case 'o':
+                                i = 1710;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 's':
+                                        i = 1711;
+                                        break;
+                                    case 0x161:
+                                        i = 1712;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 's':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 1713;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 1714;
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 1715;
+                                        break;
+                                    case 'u':
+                                        i = 1716;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                i = 1717;
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1718;
+                                        break;
+                                    case 'e':
+                                        i = 1719;
+                                        break;
+                                    case 'i':
+                                        i = 1720;
+                                        break;
+                                    case 'u':
+                                        i = 1721;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        i = 1722;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 's') break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 'a':
+                                        i = 1723;
+                                        break;
+                                    case 'i':
+                                        i = 1724;
+                                        break;
+                                    case 'o':
+                                        i = 1725;
+                                        break;
+                                }
+                                break;
+                            case 'j':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 't') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        if (n <= 6) break;
+                                        switch (q[-7]) {
+                                            case 'a':
+                                                i = 1726;
+                                                break;
+                                            case 'i':
+                                                i = 1727;
+                                                break;
+                                            case 'o':
+                                                i = 1728;
+                                                break;
+                                        }
+                                        break;
+                                    case 'i':
+                                        i = 1729;
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 1730;
+                                        break;
+                                    case 'u':
+                                        i = 1731;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'c':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'u') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'l') break;
+                                                i = 1732;
+                                                break;
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 1733;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                i = 1734;
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 's') break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 'a':
+                                        i = 1735;
+                                        break;
+                                    case 'i':
+                                        i = 1736;
+                                        break;
+                                    case 'o':
+                                        i = 1737;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'e':
+                                        i = 1738;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1739;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        i = 1740;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1741;
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'l') break;
+                                        i = 1742;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                i = 1743;
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                i = 1744;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'j') break;
+                                i = 1745;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 1746;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 1747;
+                                break;
+                            case 'j':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 't') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        if (n <= 6) break;
+                                        switch (q[-7]) {
+                                            case 'a':
+                                                i = 1748;
+                                                break;
+                                            case 'i':
+                                                i = 1749;
+                                                break;
+                                            case 'o':
+                                                i = 1750;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 1751;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 1752;
+                                        break;
+                                    case 'u':
+                                        i = 1753;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                i = 1754;
+                                if (n <= 3) break;
+                                if (q[-4] != 's') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 1755;
+                                        break;
+                                    case 'i':
+                                        i = 1756;
+                                        break;
+                                    case 'o':
+                                        i = 1757;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1758;
+                                        break;
+                                    case 'e':
+                                        i = 1759;
+                                        break;
+                                    case 'i':
+                                        i = 1760;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'r') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'i') break;
+                                        i = 1761;
+                                        break;
+                                    case 'o':
+                                        i = 1762;
+                                        break;
+                                    case 'u':
+                                        i = 1763;
+                                        break;
+                                }
+                                break;
+                            case 0x10D:
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 1764;
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        i = 1765;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'c':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1766;
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'l') break;
+                                        i = 1767;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                i = 1768;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'j') break;
+                                i = 1769;
+                                break;
+                            case 0x10D:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1770;
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'l') break;
+                                        i = 1771;
+                                        break;
+                                }
+                                break;
+                            case 0x161:
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                i = 1772;
+                                break;
+                        }
+                        break;
+                    case 'u':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        i = 1773;
+                        break;
+                }
+                break;
+            case 'u':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'd':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 't') break;
+                        if (n <= 4) break;
+                        if (q[-5] != 's') break;
+                        if (n <= 5) break;
+                        switch (q[-6]) {
+                            case 'a':
+                                i = 1774;
+                                break;
+                            case 'i':
+                                i = 1775;
+                                break;
+                            case 'o':
+                                i = 1776;
+                                break;
+                        }
+                        break;
+                    case 'g':
+                        i = 1777;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'o':
+                                if (n <= 3) break;
+                                if (q[-4] != 'l') break;
+                                i = 1778;
+                                break;
+                            case 'u':
+                                i = 1779;
+                                break;
+                        }
+                        break;
+                    case 'h':
+                        if (n <= 2) break;
+                        if (q[-3] != 'a') break;
+                        i = 1780;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'c':
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 1781;
+                                break;
+                            case 'j':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 't') break;
+                                        if (n <= 6) break;
+                                        if (q[-7] != 's') break;
+                                        if (n <= 7) break;
+                                        switch (q[-8]) {
+                                            case 'a':
+                                                i = 1782;
+                                                break;
+                                            case 'i':
+                                                i = 1783;
+                                                break;
+                                            case 'o':
+                                                i = 1784;
+                                                break;
+                                        }
+                                        break;
+                                    case 'n':
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'i') break;
+                                        i = 1785;
+                                        break;
+                                }
+                                break;
+                            case 'r':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'i':
+                                        i = 1786;
+                                        break;
+                                    case 'u':
+                                        i = 1787;
+                                        break;
+                                }
+                                break;
+                            case 'v':
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'a':
+                                        i = 1788;
+                                        break;
+                                    case 'e':
+                                        i = 1789;
+                                        break;
+                                    case 'i':
+                                        i = 1790;
+                                        break;
+                                    case 'o':
+                                        i = 1791;
+                                        break;
+                                    case 'u':
+                                        i = 1792;
+                                        break;
+                                }
+                                break;
+                            case 0x10D:
+                                if (n <= 4) break;
+                                if (q[-5] != 'a') break;
+                                i = 1793;
+                                break;
+                        }
+                        break;
+                    case 'j':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 1794;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        i = 1795;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1796;
+                                        break;
+                                    case 'l':
+                                        i = 1797;
+                                        break;
+                                    case 'r':
+                                        i = 1798;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'i':
+                                                i = 1799;
+                                                break;
+                                            case 'u':
+                                                i = 1800;
+                                                break;
+                                        }
+                                        break;
+                                    case 't':
+                                        i = 1801;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 's') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 1802;
+                                                break;
+                                            case 'i':
+                                                i = 1803;
+                                                break;
+                                            case 'o':
+                                                i = 1804;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1805;
+                                                break;
+                                            case 'e':
+                                                i = 1806;
+                                                break;
+                                            case 'i':
+                                                i = 1807;
+                                                break;
+                                            case 'u':
+                                                i = 1808;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x107:
+                                        i = 1809;
+                                        break;
+                                    case 0x10D:
+                                        i = 1810;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1811;
+                                        break;
+                                    case 0x111:
+                                        i = 1812;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 1813;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        i = 1814;
+                                        break;
+                                    case 'c':
+                                        i = 1815;
+                                        break;
+                                    case 'd':
+                                        i = 1816;
+                                        break;
+                                    case 'f':
+                                        i = 1817;
+                                        break;
+                                    case 'g':
+                                        i = 1818;
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'n') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 1819;
+                                                break;
+                                            case 'e':
+                                                i = 1820;
+                                                break;
+                                            case 's':
+                                                i = 1821;
+                                                break;
+                                            case 0x161:
+                                                i = 1822;
+                                                break;
+                                        }
+                                        break;
+                                    case 'k':
+                                        i = 1823;
+                                        break;
+                                    case 'l':
+                                        i = 1824;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 1825;
+                                        break;
+                                    case 'm':
+                                        i = 1826;
+                                        break;
+                                    case 'n':
+                                        i = 1827;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'g':
+                                                i = 1828;
+                                                break;
+                                            case 'm':
+                                                i = 1829;
+                                                break;
+                                            case 'p':
+                                                i = 1830;
+                                                break;
+                                            case 'r':
+                                                i = 1831;
+                                                break;
+                                            case 't':
+                                                i = 1832;
+                                                break;
+                                        }
+                                        break;
+                                    case 'p':
+                                        i = 1833;
+                                        break;
+                                    case 'r':
+                                        i = 1834;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'r') break;
+                                        i = 1835;
+                                        break;
+                                    case 's':
+                                        i = 1836;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 1837;
+                                        break;
+                                    case 't':
+                                        i = 1838;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1839;
+                                                break;
+                                            case 'o':
+                                                i = 1840;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1841;
+                                                break;
+                                            case 'e':
+                                                i = 1842;
+                                                break;
+                                            case 'i':
+                                                i = 1843;
+                                                break;
+                                            case 'o':
+                                                i = 1844;
+                                                break;
+                                        }
+                                        break;
+                                    case 'z':
+                                        i = 1845;
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 1846;
+                                        break;
+                                    case 0x17E:
+                                        i = 1847;
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1848;
+                                        break;
+                                    case 'e':
+                                        i = 1849;
+                                        break;
+                                    case 's':
+                                        i = 1850;
+                                        break;
+                                    case 0x161:
+                                        i = 1851;
+                                        break;
+                                }
+                                break;
+                            case 'u':
+                                i = 1852;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'u') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'l') break;
+                                        i = 1853;
+                                        break;
+                                    case 'r':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 1854;
+                                        break;
+                                    case 0x10D:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'u') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 'l') break;
+                                        i = 1855;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'k':
+                        i = 1856;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 's':
+                                i = 1857;
+                                break;
+                            case 0x161:
+                                i = 1858;
+                                break;
+                        }
+                        break;
+                    case 'l':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 1859;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 1860;
+                                        break;
+                                    case 'n':
+                                        i = 1861;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 1862;
+                                break;
+                            case 'i':
+                                i = 1863;
+                                if (n <= 3) break;
+                                if (q[-4] != 'z') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'o') break;
+                                i = 1864;
+                                break;
+                            case 'o':
+                                i = 1865;
+                                break;
+                        }
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                if (q[-4] != 'r') break;
+                                i = 1866;
+                                break;
+                            case 'e':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1867;
+                                                break;
+                                            case 'e':
+                                                i = 1868;
+                                                break;
+                                            case 'u':
+                                                i = 1869;
+                                                break;
+                                        }
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'i':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'j':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'n') break;
+                                                        if (n <= 7) break;
+                                                        switch (q[-8]) {
+                                                            case 'a':
+                                                                i = 1870;
+                                                                break;
+                                                            case 'e':
+                                                                i = 1871;
+                                                                break;
+                                                            case 's':
+                                                                i = 1872;
+                                                                break;
+                                                            case 0x161:
+                                                                i = 1873;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'k':
+                                                        i = 1874;
+                                                        if (n <= 6) break;
+                                                        switch (q[-7]) {
+                                                            case 's':
+                                                                i = 1875;
+                                                                break;
+                                                            case 0x161:
+                                                                i = 1876;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'l':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'e') break;
+                                                        i = 1877;
+                                                        break;
+                                                    case 'n':
+                                                        i = 1878;
+                                                        break;
+                                                    case 's':
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'o') break;
+                                                        i = 1879;
+                                                        break;
+                                                    case 't':
+                                                        if (n <= 6) break;
+                                                        switch (q[-7]) {
+                                                            case 'a':
+                                                                i = 1880;
+                                                                break;
+                                                            case 'i':
+                                                                if (n <= 7) break;
+                                                                if (q[-8] != 'v') break;
+                                                                if (n <= 8) break;
+                                                                switch (q[-9]) {
+                                                                    case 'e':
+                                                                        i = 1881;
+                                                                        break;
+                                                                    case 'o':
+                                                                        i = 1882;
+                                                                        break;
+                                                                }
+                                                                break;
+                                                            case 's':
+                                                                if (n <= 7) break;
+                                                                if (q[-8] != 'a') break;
+                                                                i = 1883;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 'v':
+                                                        if (n <= 6) break;
+                                                        switch (q[-7]) {
+                                                            case 'a':
+                                                                i = 1884;
+                                                                break;
+                                                            case 'e':
+                                                                i = 1885;
+                                                                break;
+                                                            case 'i':
+                                                                i = 1886;
+                                                                break;
+                                                            case 'o':
+                                                                i = 1887;
+                                                                break;
+                                                        }
+                                                        break;
+                                                    case 0x161:
+                                                        if (n <= 6) break;
+                                                        if (q[-7] != 'o') break;
+                                                        i = 1888;
+                                                        break;
+                                                }
+                                                break;
+                                            case 'n':
+                                                if (n <= 5) break;
+                                                switch (q[-6]) {
+                                                    case 'a':
+                                                        i = 1889;
+                                                        break;
+                                                    case 'e':
+                                                        i = 1890;
+                                                        break;
+                                                    case 's':
+                                                        i = 1891;
+                                                        break;
+                                                    case 0x161:
+                                                        i = 1892;
+                                                        break;
+                                                }
+                                                break;
+                                        }
+                                        break;
+                                    case 'k':
+                                        i = 1893;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 's':
+                                                i = 1894;
+                                                break;
+                                            case 0x161:
+                                                i = 1895;
+                                                break;
+                                        }
+                                        break;
+                                    case 'l':
+                                        i = 1896;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 1897;
+                                        break;
+                                    case 'n':
+                                        i = 1898;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1899;
+                                                break;
+                                            case 'e':
+                                                i = 1900;
+                                                break;
+                                            case 's':
+                                                i = 1901;
+                                                break;
+                                            case 0x161:
+                                                i = 1902;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 1903;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1904;
+                                                break;
+                                            case 'i':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'v') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'e':
+                                                        i = 1905;
+                                                        break;
+                                                    case 'o':
+                                                        i = 1906;
+                                                        break;
+                                                }
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 1907;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1908;
+                                                break;
+                                            case 'e':
+                                                i = 1909;
+                                                break;
+                                            case 'i':
+                                                i = 1910;
+                                                break;
+                                            case 'o':
+                                                i = 1911;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x107:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1912;
+                                                break;
+                                            case 'e':
+                                                i = 1913;
+                                                break;
+                                            case 'u':
+                                                i = 1914;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 1915;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1916;
+                                                break;
+                                            case 'e':
+                                                i = 1917;
+                                                break;
+                                            case 'u':
+                                                i = 1918;
+                                                break;
+                                        }
+                                        break;
+                                    case 'j':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'n') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'a':
+                                                i = 1919;
+                                                break;
+                                            case 'e':
+                                                i = 1920;
+                                                break;
+                                            case 's':
+                                                i = 1921;
+                                                break;
+                                            case 0x161:
+                                                i = 1922;
+                                                break;
+                                        }
+                                        break;
+                                    case 'k':
+                                        i = 1923;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 's':
+                                                i = 1924;
+                                                break;
+                                            case 0x161:
+                                                i = 1925;
+                                                break;
+                                        }
+                                        break;
+                                    case 'l':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'e') break;
+                                        i = 1926;
+                                        break;
+                                    case 'n':
+                                        i = 1927;
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        if (n <= 5) break;
+                                        switch (q[-6]) {
+                                            case 'c':
+                                                i = 1928;
+                                                break;
+                                            case 0x10D:
+                                                i = 1929;
+                                                break;
+                                        }
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 1930;
+                                        break;
+                                    case 't':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1931;
+                                                break;
+                                            case 'i':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'v') break;
+                                                if (n <= 6) break;
+                                                switch (q[-7]) {
+                                                    case 'e':
+                                                        i = 1932;
+                                                        break;
+                                                    case 'o':
+                                                        i = 1933;
+                                                        break;
+                                                }
+                                                break;
+                                            case 's':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'a') break;
+                                                i = 1934;
+                                                break;
+                                        }
+                                        break;
+                                    case 'v':
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1935;
+                                                break;
+                                            case 'e':
+                                                i = 1936;
+                                                break;
+                                            case 'i':
+                                                i = 1937;
+                                                break;
+                                            case 'o':
+                                                i = 1938;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x107:
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'a':
+                                                i = 1939;
+                                                break;
+                                            case 'e':
+                                                i = 1940;
+                                                break;
+                                            case 'u':
+                                                i = 1941;
+                                                break;
+                                        }
+                                        break;
+                                    case 0x161:
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'o') break;
+                                        i = 1942;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        i = 1943;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 1944;
+                                if (n <= 3) break;
+                                if (q[-4] != 't') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 's') break;
+                                if (n <= 5) break;
+                                switch (q[-6]) {
+                                    case 'a':
+                                        i = 1945;
+                                        break;
+                                    case 'i':
+                                        i = 1946;
+                                        break;
+                                    case 'o':
+                                        i = 1947;
+                                        break;
+                                }
+                                break;
+                            case 'i':
+                                i = 1948;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'c':
+                                        i = 1949;
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 1950;
+                                        break;
+                                    case 0x10D:
+                                        i = 1951;
+                                        break;
+                                }
+                                break;
+                            case 'o':
+                                i = 1952;
+                                break;
+                        }
+                        break;
+                    case 'r':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 1953;
+                                break;
+                            case 'd':
+                                i = 1954;
+                                break;
+                            case 'e':
+                                i = 1955;
+                                break;
+                            case 'o':
+                                i = 1956;
+                                break;
+                        }
+                        break;
+                    case 's':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        i = 1957;
+                                        break;
+                                    case 'g':
+                                        i = 1958;
+                                        break;
+                                    case 'j':
+                                        i = 1959;
+                                        break;
+                                    case 'k':
+                                        i = 1960;
+                                        break;
+                                    case 'n':
+                                        i = 1961;
+                                        break;
+                                    case 't':
+                                        i = 1962;
+                                        break;
+                                    case 'v':
+                                        i = 1963;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 1964;
+                                break;
+                            case 'i':
+                                i = 1965;
+                                break;
+                            case 'o':
+                                i = 1966;
+                                break;
+                        }
+                        break;
+                    case 't':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 1967;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'k':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 1968;
+                                        break;
+                                    case 'l':
+                                        i = 1969;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 1970;
+                                break;
+                            case 'i':
+                                if (n <= 3) break;
+                                if (q[-4] != 'v') break;
+                                if (n <= 4) break;
+                                switch (q[-5]) {
+                                    case 'e':
+                                        i = 1971;
+                                        break;
+                                    case 'o':
+                                        i = 1972;
+                                        break;
+                                }
+                                break;
+                            case 's':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 1973;
+                                        break;
+                                    case 'e':
+                                        i = 1974;
+                                        break;
+                                    case 'i':
+                                        i = 1975;
+                                        break;
+                                    case 'k':
+                                        i = 1976;
+                                        break;
+                                    case 'o':
+                                        i = 1977;
+                                        break;
+                                }
+                                break;
+                            case 0x161:
+                                if (n <= 3) break;
+                                if (q[-4] != 'i') break;
+                                i = 1978;
+                                break;
+                        }
+                        break;
+                    case 'v':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 1979;
+                                break;
+                            case 'e':
+                                i = 1980;
+                                break;
+                            case 'i':
+                                i = 1981;
+                                break;
+                            case 'o':
+                                i = 1982;
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'l':
+                                        i = 1983;
+                                        break;
+                                    case 'm':
+                                        i = 1984;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 's':
+                                        i = 1985;
+                                        break;
+                                    case 0x161:
+                                        i = 1986;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 0x161:
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'b':
+                                        i = 1987;
+                                        break;
+                                    case 'g':
+                                        i = 1988;
+                                        break;
+                                    case 'j':
+                                        i = 1989;
+                                        break;
+                                    case 'k':
+                                        i = 1990;
+                                        break;
+                                    case 'n':
+                                        i = 1991;
+                                        break;
+                                    case 't':
+                                        i = 1992;
+                                        break;
+                                    case 'v':
+                                        i = 1993;
+                                        break;
+                                }
+                                break;
+                            case 'e':
+                                i = 1994;
+                                break;
+                            case 'i':
+                                i = 1995;
+                                break;
+                            case 'o':
+                                i = 1996;
+                                break;
+                        }
+                        break;
+                }
+                break;
+            case 'v':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        if (n <= 2) break;
+                        if (q[-3] != 'v') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 1997;
+                                break;
+                            case 'e':
+                                i = 1998;
+                                break;
+                            case 'i':
+                                i = 1999;
+                                break;
+                            case 'u':
+                                i = 2000;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        if (n <= 2) break;
+                        if (q[-3] != 'k') break;
+                        i = 2001;
+                        break;
+                }
+                break;
+            case 0x161:
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'a':
+                        i = 2002;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'r':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'i':
+                                        i = 2003;
+                                        break;
+                                    case 'u':
+                                        i = 2004;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                i = 2005;
+                                break;
+                            case 'v':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 2006;
+                                        break;
+                                    case 'e':
+                                        i = 2007;
+                                        break;
+                                    case 'i':
+                                        i = 2008;
+                                        break;
+                                    case 'u':
+                                        i = 2009;
+                                        break;
+                                }
+                                break;
+                            case 0x10D:
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                i = 2010;
+                                break;
+                        }
+                        break;
+                    case 'e':
+                        i = 2011;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'd':
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 's') break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 'a':
+                                        i = 2012;
+                                        break;
+                                    case 'i':
+                                        i = 2013;
+                                        break;
+                                    case 'o':
+                                        i = 2014;
+                                        break;
+                                }
+                                break;
+                            case 'j':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 't') break;
+                                        if (n <= 5) break;
+                                        if (q[-6] != 's') break;
+                                        if (n <= 6) break;
+                                        switch (q[-7]) {
+                                            case 'a':
+                                                i = 2015;
+                                                break;
+                                            case 'i':
+                                                i = 2016;
+                                                break;
+                                            case 'o':
+                                                i = 2017;
+                                                break;
+                                        }
+                                        break;
+                                    case 'i':
+                                        i = 2018;
+                                        break;
+                                    case 'n':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'i') break;
+                                        i = 2019;
+                                        break;
+                                    case 'u':
+                                        i = 2020;
+                                        if (n <= 4) break;
+                                        switch (q[-5]) {
+                                            case 'r':
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'i') break;
+                                                i = 2021;
+                                                break;
+                                            case 0x10D:
+                                                if (n <= 5) break;
+                                                if (q[-6] != 'u') break;
+                                                if (n <= 6) break;
+                                                if (q[-7] != 'l') break;
+                                                i = 2022;
+                                                break;
+                                        }
+                                        break;
+                                }
+                                break;
+                            case 'n':
+                                i = 2023;
+                                if (n <= 3) break;
+                                if (q[-4] != 'a') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 't') break;
+                                if (n <= 5) break;
+                                if (q[-6] != 's') break;
+                                if (n <= 6) break;
+                                switch (q[-7]) {
+                                    case 'a':
+                                        i = 2024;
+                                        break;
+                                    case 'i':
+                                        i = 2025;
+                                        break;
+                                    case 'o':
+                                        i = 2026;
+                                        break;
+                                }
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'e':
+                                        i = 2027;
+                                        break;
+                                    case 's':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'a') break;
+                                        i = 2028;
+                                        break;
+                                }
+                                break;
+                        }
+                        break;
+                    case 'i':
+                        i = 2029;
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'n':
+                                i = 2030;
+                                break;
+                            case 't':
+                                if (n <= 3) break;
+                                if (q[-4] != 'e') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'j') break;
+                                i = 2031;
+                                break;
+                            case 0x10D:
+                                if (n <= 3) break;
+                                switch (q[-4]) {
+                                    case 'a':
+                                        i = 2032;
+                                        break;
+                                    case 'u':
+                                        if (n <= 4) break;
+                                        if (q[-5] != 'l') break;
+                                        i = 2033;
+                                        break;
+                                }
+                                break;
+                            case 0x161:
+                                if (n <= 3) break;
+                                if (q[-4] != 'o') break;
+                                if (n <= 4) break;
+                                if (q[-5] != 'r') break;
+                                i = 2034;
+                                break;
+                        }
+                        break;
+                }
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_2[i].s_size;
+    return a_2[i].result;
+}
+static const symbol s_127[] = { 's', 'k' };
+static const symbol s_128[] = { 0x161, 'k' };
+static const symbol s_129[] = { 's', 't', 'v' };
+static const symbol s_130[] = { 0x161, 't', 'v' };
+static const symbol s_131[] = { 't', 'a', 'n', 'i', 'j' };
+static const symbol s_132[] = { 'm', 'a', 'n', 'i', 'j' };
+static const symbol s_133[] = { 'p', 'a', 'n', 'i', 'j' };
+static const symbol s_134[] = { 'r', 'a', 'n', 'i', 'j' };
+static const symbol s_135[] = { 'g', 'a', 'n', 'i', 'j' };
+static const symbol s_136[] = { 'a', 'n' };
+static const symbol s_137[] = { 'i', 'n' };
+static const symbol s_138[] = { 'o', 'n' };
+static const symbol s_139[] = { 'n' };
+static const symbol s_140[] = { 'a', 0x107 };
+static const symbol s_141[] = { 'e', 0x107 };
+static const symbol s_142[] = { 'u', 0x107 };
+static const symbol s_143[] = { 'u', 'g', 'o', 'v' };
+static const symbol s_144[] = { 'u', 'g' };
+static const symbol s_145[] = { 'l', 'o', 'g' };
+static const symbol s_146[] = { 'g' };
+static const symbol s_147[] = { 'r', 'a', 'r', 'i' };
+static const symbol s_148[] = { 'o', 't', 'i' };
+static const symbol s_149[] = { 's', 'i' };
+static const symbol s_150[] = { 'l', 'i' };
+static const symbol s_151[] = { 'u', 'j' };
+static const symbol s_152[] = { 'c', 'a', 'j' };
+static const symbol s_153[] = { 0x10D, 'a', 'j' };
+static const symbol s_154[] = { 0x107, 'a', 'j' };
+static const symbol s_155[] = { 0x111, 'a', 'j' };
+static const symbol s_156[] = { 'l', 'a', 'j' };
+static const symbol s_157[] = { 'r', 'a', 'j' };
+static const symbol s_158[] = { 'b', 'i', 'j' };
+static const symbol s_159[] = { 'c', 'i', 'j' };
+static const symbol s_160[] = { 'd', 'i', 'j' };
+static const symbol s_161[] = { 'l', 'i', 'j' };
+static const symbol s_162[] = { 'n', 'i', 'j' };
+static const symbol s_163[] = { 'm', 'i', 'j' };
+static const symbol s_164[] = { 0x17E, 'i', 'j' };
+static const symbol s_165[] = { 'g', 'i', 'j' };
+static const symbol s_166[] = { 'f', 'i', 'j' };
+static const symbol s_167[] = { 'p', 'i', 'j' };
+static const symbol s_168[] = { 'r', 'i', 'j' };
+static const symbol s_169[] = { 's', 'i', 'j' };
+static const symbol s_170[] = { 't', 'i', 'j' };
+static const symbol s_171[] = { 'z', 'i', 'j' };
+static const symbol s_172[] = { 'n', 'a', 'l' };
+static const symbol s_173[] = { 'i', 'j', 'a', 'l' };
+static const symbol s_174[] = { 'o', 'z', 'i', 'l' };
+static const symbol s_175[] = { 'o', 'l', 'o', 'v' };
+static const symbol s_176[] = { 'o', 'l' };
+static const symbol s_177[] = { 'l', 'e', 'm' };
+static const symbol s_178[] = { 'r', 'a', 'm' };
+static const symbol s_179[] = { 'a', 'r' };
+static const symbol s_180[] = { 'd', 'r' };
+static const symbol s_181[] = { 'e', 'r' };
+static const symbol s_182[] = { 'o', 'r' };
+static const symbol s_183[] = { 'e', 's' };
+static const symbol s_184[] = { 'i', 's' };
+static const symbol s_185[] = { 't', 'a', 0x161 };
+static const symbol s_186[] = { 'n', 'a', 0x161 };
+static const symbol s_187[] = { 'j', 'a', 0x161 };
+static const symbol s_188[] = { 'k', 'a', 0x161 };
+static const symbol s_189[] = { 'b', 'a', 0x161 };
+static const symbol s_190[] = { 'g', 'a', 0x161 };
+static const symbol s_191[] = { 'v', 'a', 0x161 };
+static const symbol s_192[] = { 'e', 0x161 };
+static const symbol s_193[] = { 'i', 0x161 };
+static const symbol s_194[] = { 'i', 'k', 'a', 't' };
+static const symbol s_195[] = { 'l', 'a', 't' };
+static const symbol s_196[] = { 'e', 't' };
+static const symbol s_197[] = { 'e', 's', 't' };
+static const symbol s_198[] = { 'i', 's', 't' };
+static const symbol s_199[] = { 'k', 's', 't' };
+static const symbol s_200[] = { 'o', 's', 't' };
+static const symbol s_201[] = { 'i', 0x161, 't' };
+static const symbol s_202[] = { 'o', 'v', 'a' };
+static const symbol s_203[] = { 'a', 'v' };
+static const symbol s_204[] = { 'e', 'v' };
+static const symbol s_205[] = { 'i', 'v' };
+static const symbol s_206[] = { 'o', 'v' };
+static const symbol s_207[] = { 'm', 'o', 'v' };
+static const symbol s_208[] = { 'l', 'o', 'v' };
+static const symbol s_209[] = { 'e', 'l' };
+static const symbol s_210[] = { 'a', 'n', 'j' };
+static const symbol s_211[] = { 'e', 'n', 'j' };
+static const symbol s_212[] = { 0x161, 'n', 'j' };
+static const symbol s_213[] = { 'e', 'n' };
+static const symbol s_214[] = { 0x161, 'n' };
+static const symbol s_215[] = { 0x10D, 'i', 'n' };
+static const symbol s_216[] = { 'r', 'o', 0x161, 'i' };
+static const symbol s_217[] = { 'o', 0x161 };
+static const symbol s_218[] = { 'e', 'v', 'i', 't' };
+static const symbol s_219[] = { 'o', 'v', 'i', 't' };
+static const symbol s_220[] = { 'a', 's', 't' };
+static const symbol s_221[] = { 'k' };
+static const symbol s_222[] = { 'e', 'v', 'a' };
+static const symbol s_223[] = { 'a', 'v', 'a' };
+static const symbol s_224[] = { 'i', 'v', 'a' };
+static const symbol s_225[] = { 'u', 'v', 'a' };
+static const symbol s_226[] = { 'i', 'r' };
+static const symbol s_227[] = { 'a', 0x10D };
+static const symbol s_228[] = { 'a', 0x10D, 'a' };
+static const symbol s_229[] = { 'n', 'i' };
+static const symbol s_230[] = { 'a' };
+static const symbol s_231[] = { 'u', 'r' };
+static const symbol s_232[] = { 'a', 's', 't', 'a', 'j' };
+static const symbol s_233[] = { 'i', 's', 't', 'a', 'j' };
+static const symbol s_234[] = { 'o', 's', 't', 'a', 'j' };
+static const symbol s_235[] = { 'a', 'j' };
+static const symbol s_236[] = { 'a', 's', 't', 'a' };
+static const symbol s_237[] = { 'i', 's', 't', 'a' };
+static const symbol s_238[] = { 'o', 's', 't', 'a' };
+static const symbol s_239[] = { 't', 'a' };
+static const symbol s_240[] = { 'i', 'n', 'j' };
+static const symbol s_241[] = { 'a', 's' };
+static const symbol s_242[] = { 'i' };
+static const symbol s_243[] = { 'l', 'u', 0x10D };
+static const symbol s_244[] = { 'j', 'e', 't', 'i' };
+static const symbol s_245[] = { 'e' };
+static const symbol s_246[] = { 'a', 't' };
+static const symbol s_247[] = { 'l', 'u', 'c' };
+static const symbol s_248[] = { 's', 'n', 'j' };
+static const symbol s_249[] = { 'o', 's' };
+static const symbol s_250[] = { 'a', 'c' };
+static const symbol s_251[] = { 'e', 'c' };
+static const symbol s_252[] = { 'u', 'c' };
+static const symbol s_253[] = { 'r', 'o', 's', 'i' };
+static const symbol s_254[] = { 'a', 'c', 'a' };
+static const symbol s_255[] = { 'j', 'a', 's' };
+static const symbol s_256[] = { 't', 'a', 's' };
+static const symbol s_257[] = { 'g', 'a', 's' };
+static const symbol s_258[] = { 'n', 'a', 's' };
+static const symbol s_259[] = { 'k', 'a', 's' };
+static const symbol s_260[] = { 'v', 'a', 's' };
+static const symbol s_261[] = { 'b', 'a', 's' };
+static const symbol s_262[] = { 'a', 's' };
+static const symbol s_263[] = { 'c', 'i', 'n' };
+static const symbol s_264[] = { 'a', 's', 't', 'a', 'j' };
+static const symbol s_265[] = { 'i', 's', 't', 'a', 'j' };
+static const symbol s_266[] = { 'o', 's', 't', 'a', 'j' };
+static const symbol s_267[] = { 'a', 's', 't', 'a' };
+static const symbol s_268[] = { 'i', 's', 't', 'a' };
+static const symbol s_269[] = { 'o', 's', 't', 'a' };
+static const symbol s_270[] = { 'a', 'v', 'a' };
+static const symbol s_271[] = { 'e', 'v', 'a' };
+static const symbol s_272[] = { 'i', 'v', 'a' };
+static const symbol s_273[] = { 'u', 'v', 'a' };
+static const symbol s_274[] = { 'o', 'v', 'a' };
+static const symbol s_275[] = { 'j', 'e', 't', 'i' };
+static const symbol s_276[] = { 'i', 'n', 'j' };
+static const symbol s_277[] = { 'i', 's', 't' };
+static const symbol s_278[] = { 'e', 's' };
+static const symbol s_279[] = { 'e', 't' };
+static const symbol s_280[] = { 'i', 's' };
+static const symbol s_281[] = { 'i', 'r' };
+static const symbol s_282[] = { 'u', 'r' };
+static const symbol s_283[] = { 'u', 'j' };
+static const symbol s_284[] = { 'n', 'i' };
+static const symbol s_285[] = { 's', 'n' };
+static const symbol s_286[] = { 't', 'a' };
+static const symbol s_287[] = { 'a' };
+static const symbol s_288[] = { 'i' };
+static const symbol s_289[] = { 'e' };
+static const symbol s_290[] = { 'n' };
+
+static int find_among_b_3(struct SN_env * z) {
+    const symbol * q = z->p + z->c;
+    int n = z->c - z->lb;
+    int c = z->c;
+    int i = -1;
+    do {
+        if (n <= 0) break;
+        switch (q[-1]) {
+            case 'a':
+                i = 0;
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'g':
+                        if (n <= 2) break;
+                        if (q[-3] != 'o') break;
+                        i = 1;
+                        break;
+                    case 'm':
+                        if (n <= 2) break;
+                        switch (q[-3]) {
+                            case 'a':
+                                i = 2;
+                                break;
+                            case 'i':
+                                i = 3;
+                                break;
+                        }
+                        break;
+                    case 'n':
+                        if (n <= 2) break;
+                        if (q[-3] != 'e') break;
+                        i = 4;
+                        break;
+                }
+                break;
+            case 'e':
+                i = 5;
+                break;
+            case 'g':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                i = 6;
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'a':
+                        i = 7;
+                        break;
+                    case 'e':
+                        i = 8;
+                        break;
+                }
+                break;
+            case 'h':
+                if (n <= 1) break;
+                if (q[-2] != 'i') break;
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'a':
+                        i = 9;
+                        break;
+                    case 'e':
+                        i = 10;
+                        break;
+                }
+                break;
+            case 'i':
+                i = 11;
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'a':
+                        i = 12;
+                        break;
+                    case 'e':
+                        i = 13;
+                        break;
+                }
+                break;
+            case 'j':
+                if (n <= 1) break;
+                if (q[-2] != 'o') break;
+                if (n <= 2) break;
+                if (q[-3] != 'n') break;
+                if (n <= 3) break;
+                switch (q[-4]) {
+                    case 'a':
+                        i = 14;
+                        break;
+                    case 'e':
+                        i = 15;
+                        break;
+                }
+                break;
+            case 'm':
+                if (n <= 1) break;
+                switch (q[-2]) {
+                    case 'i':
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        switch (q[-4]) {
+                            case 'a':
+                                i = 16;
+                                break;
+                            case 'e':
+                                i = 17;
+                                break;
+                        }
+                        break;
+                    case 'o':
+                        i = 18;
+                        if (n <= 2) break;
+                        if (q[-3] != 'n') break;
+                        if (n <= 3) break;
+                        if (q[-4] != 'e') break;
+                        i = 19;
+                        break;
+                }
+                break;
+            case 'o':
+                i = 20;
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                switch (q[-3]) {
+                    case 'a':
+                        i = 21;
+                        break;
+                    case 'e':
+                        i = 22;
+                        break;
+                }
+                break;
+            case 't':
+                if (n <= 1) break;
+                if (q[-2] != 's') break;
+                if (n <= 2) break;
+                if (q[-3] != 'o') break;
+                i = 23;
+                break;
+            case 'u':
+                i = 24;
+                if (n <= 1) break;
+                if (q[-2] != 'n') break;
+                if (n <= 2) break;
+                if (q[-3] != 'e') break;
+                i = 25;
+                break;
+        }
+    } while (0);
+    if (i < 0) return 0;
+    z->c = c - a_3[i].s_size;
+    return a_3[i].result;
+}
+
+extern int serbian_UTF_8_stem(struct SN_env * z) {
+    int among_var;
+    
+    {   int c1 = z->c;
+        while(1) {
+            int c2 = z->c;
+            while(1) {
+                int c3 = z->c;
+                z->bra = z->c;
+                if (z->c >= z->l) goto lab3;
+                among_var = find_among_0(z);
+                if (!(among_var)) goto lab3;
+                z->ket = z->c;
+                switch (among_var) {
+                    case 1:
+                        {   int ret = slice_from_s(z, 1, s_0);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 2:
+                        {   int ret = slice_from_s(z, 1, s_1);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 3:
+                        {   int ret = slice_from_s(z, 1, s_2);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 4:
+                        {   int ret = slice_from_s(z, 1, s_3);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 5:
+                        {   int ret = slice_from_s(z, 1, s_4);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 6:
+                        {   int ret = slice_from_s(z, 1, s_5);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 7:
+                        {   int ret = slice_from_s(z, 1, s_6);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 8:
+                        {   int ret = slice_from_s(z, 1, s_7);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 9:
+                        {   int ret = slice_from_s(z, 1, s_8);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 10:
+                        {   int ret = slice_from_s(z, 1, s_9);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 11:
+                        {   int ret = slice_from_s(z, 1, s_10);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 12:
+                        {   int ret = slice_from_s(z, 1, s_11);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 13:
+                        {   int ret = slice_from_s(z, 1, s_12);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 14:
+                        {   int ret = slice_from_s(z, 2, s_13);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 15:
+                        {   int ret = slice_from_s(z, 1, s_14);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 16:
+                        {   int ret = slice_from_s(z, 1, s_15);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 17:
+                        {   int ret = slice_from_s(z, 2, s_16);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 18:
+                        {   int ret = slice_from_s(z, 1, s_17);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 19:
+                        {   int ret = slice_from_s(z, 1, s_18);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 20:
+                        {   int ret = slice_from_s(z, 1, s_19);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 21:
+                        {   int ret = slice_from_s(z, 1, s_20);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 22:
+                        {   int ret = slice_from_s(z, 1, s_21);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 23:
+                        {   int ret = slice_from_s(z, 1, s_22);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 24:
+                        {   int ret = slice_from_s(z, 1, s_23);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 25:
+                        {   int ret = slice_from_s(z, 1, s_24);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 26:
+                        {   int ret = slice_from_s(z, 1, s_25);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 27:
+                        {   int ret = slice_from_s(z, 1, s_26);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 28:
+                        {   int ret = slice_from_s(z, 1, s_27);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 29:
+                        {   int ret = slice_from_s(z, 2, s_28);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                    case 30:
+                        {   int ret = slice_from_s(z, 1, s_29);
+                            if (ret < 0) return ret;
+                        }
+                        break;
+                }
+                z->c = c3;
+                break;
+            lab3:
+                z->c = c3;
+                if (z->c >= z->l) goto lab2;
+                z->c++;
+            }
+            continue;
+        lab2:
+            z->c = c2;
+            break;
+        }
+        z->c = c1;
+    }
+    
+    {   int c4 = z->c;
+        while(1) {
+            int c5 = z->c;
+            while(1) {
+                int c6 = z->c;
+                if (in_grouping(z, g_ca, 98, 382, 0)) goto lab7;
+                z->bra = z->c;
+                if (!(eq_s(z, 3, s_30))) goto lab7;
+                z->ket = z->c;
+                if (in_grouping(z, g_ca, 98, 382, 0)) goto lab7;
+                {   int ret = slice_from_s(z, 1, s_31);
+                    if (ret < 0) return ret;
+                }
+                z->c = c6;
+                break;
+            lab7:
+                z->c = c6;
+                if (z->c >= z->l) goto lab6;
+                z->c++;
+            }
+            continue;
+        lab6:
+            z->c = c5;
+            break;
+        }
+        z->c = c4;
+    }
+    {   int c7 = z->c;
+        while(1) {
+            int c8 = z->c;
+            while(1) {
+                int c9 = z->c;
+                if (in_grouping(z, g_ca, 98, 382, 0)) goto lab10;
+                z->bra = z->c;
+                if (!(eq_s(z, 2, s_32))) goto lab10;
+                z->ket = z->c;
+                if (in_grouping(z, g_ca, 98, 382, 0)) goto lab10;
+                {   int ret = slice_from_s(z, 1, s_33);
+                    if (ret < 0) return ret;
+                }
+                z->c = c9;
+                break;
+            lab10:
+                z->c = c9;
+                if (z->c >= z->l) goto lab9;
+                z->c++;
+            }
+            continue;
+        lab9:
+            z->c = c8;
+            break;
+        }
+        z->c = c7;
+    }
+    {   int c10 = z->c;
+        while(1) {
+            int c11 = z->c;
+            while(1) {
+                int c12 = z->c;
+                z->bra = z->c;
+                if (!(eq_s(z, 2, s_34))) goto lab13;
+                z->ket = z->c;
+                {   int ret = slice_from_s(z, 1, s_35);
+                    if (ret < 0) return ret;
+                }
+                z->c = c12;
+                break;
+            lab13:
+                z->c = c12;
+                if (z->c >= z->l) goto lab12;
+                z->c++;
+            }
+            continue;
+        lab12:
+            z->c = c11;
+            break;
+        }
+        z->c = c10;
+    }
+    
+    z->I[1] = 1;
+    {   int c13 = z->c;
+        {   
+            int ret = out_grouping(z, g_sa, 263, 382, 1);
+            if (ret < 0) goto lab15;
+            z->c += ret;
+        }
+        z->I[1] = 0;
+    lab15:
+        z->c = c13;
+    }
+    z->I[0] = z->l;
+    {   int c14 = z->c;
+        {   
+            int ret = out_grouping(z, g_v, 97, 117, 1);
+            if (ret < 0) goto lab16;
+            z->c += ret;
+        }
+        z->I[0] = z->c;
+        if (!(z->I[0] < 2)) goto lab16;
+        {   
+            int ret = in_grouping(z, g_v, 97, 117, 1);
+            if (ret < 0) goto lab16;
+            z->c += ret;
+        }
+        z->I[0] = z->c;
+    lab16:
+        z->c = c14;
+    }
+    {   int c15 = z->c;
+        while(1) {
+            if (z->c == z->l || z->p[z->c] != 'r') goto lab18;
+            z->c++;
+            break;
+        lab18:
+            if (z->c >= z->l) goto lab17;
+            z->c++;
+        }
+        {   int c16 = z->c;
+            if (!(z->c >= 2)) goto lab20;
+            goto lab19;
+        lab20:
+            z->c = c16;
+            {   
+                int ret = in_grouping(z, g_rg, 114, 114, 1);
+                if (ret < 0) goto lab17;
+                z->c += ret;
+            }
+        }
+    lab19:
+        if (!((z->I[0] - z->c) > 1)) goto lab17;
+        z->I[0] = z->c;
+    lab17:
+        z->c = c15;
+    }
+    z->lb = z->c; z->c = z->l;
+
+    {   int m17 = z->l - z->c; (void)m17;
+        z->ket = z->c;
+        if (z->c - 2 <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((3435050 >> (z->p[z->c - 1] & 0x1f)) & 1)) goto lab21;
+        among_var = find_among_b_1(z);
+        if (!(among_var)) goto lab21;
+        z->bra = z->c;
+        switch (among_var) {
+            case 1:
+                {   int ret = slice_from_s(z, 4, s_36);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 2:
+                {   int ret = slice_from_s(z, 3, s_37);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 3:
+                {   int ret = slice_from_s(z, 5, s_38);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 4:
+                {   int ret = slice_from_s(z, 5, s_39);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 5:
+                {   int ret = slice_from_s(z, 3, s_40);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 6:
+                {   int ret = slice_from_s(z, 5, s_41);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 7:
+                if (!(z->I[1])) goto lab21;
+                {   int ret = slice_from_s(z, 5, s_42);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 8:
+                {   int ret = slice_from_s(z, 4, s_43);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 9:
+                {   int ret = slice_from_s(z, 5, s_44);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 10:
+                {   int ret = slice_from_s(z, 4, s_45);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 11:
+                {   int ret = slice_from_s(z, 5, s_46);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 12:
+                {   int ret = slice_from_s(z, 4, s_47);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 13:
+                {   int ret = slice_from_s(z, 4, s_48);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 14:
+                {   int ret = slice_from_s(z, 4, s_49);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 15:
+                {   int ret = slice_from_s(z, 4, s_50);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 16:
+                {   int ret = slice_from_s(z, 4, s_51);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 17:
+                {   int ret = slice_from_s(z, 4, s_52);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 18:
+                {   int ret = slice_from_s(z, 3, s_53);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 19:
+                {   int ret = slice_from_s(z, 3, s_54);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 20:
+                {   int ret = slice_from_s(z, 6, s_55);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 21:
+                {   int ret = slice_from_s(z, 6, s_56);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 22:
+                {   int ret = slice_from_s(z, 5, s_57);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 23:
+                {   int ret = slice_from_s(z, 3, s_58);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 24:
+                {   int ret = slice_from_s(z, 3, s_59);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 25:
+                {   int ret = slice_from_s(z, 3, s_60);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 26:
+                {   int ret = slice_from_s(z, 4, s_61);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 27:
+                {   int ret = slice_from_s(z, 4, s_62);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 28:
+                {   int ret = slice_from_s(z, 5, s_63);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 29:
+                {   int ret = slice_from_s(z, 6, s_64);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 30:
+                {   int ret = slice_from_s(z, 5, s_65);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 31:
+                if (!(z->I[1])) goto lab21;
+                {   int ret = slice_from_s(z, 5, s_66);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 32:
+                {   int ret = slice_from_s(z, 5, s_67);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 33:
+                {   int ret = slice_from_s(z, 5, s_68);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 34:
+                {   int ret = slice_from_s(z, 5, s_69);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 35:
+                {   int ret = slice_from_s(z, 6, s_70);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 36:
+                {   int ret = slice_from_s(z, 5, s_71);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 37:
+                {   int ret = slice_from_s(z, 5, s_72);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 38:
+                {   int ret = slice_from_s(z, 5, s_73);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 39:
+                {   int ret = slice_from_s(z, 5, s_74);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 40:
+                {   int ret = slice_from_s(z, 4, s_75);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 41:
+                {   int ret = slice_from_s(z, 4, s_76);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 42:
+                {   int ret = slice_from_s(z, 4, s_77);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 43:
+                {   int ret = slice_from_s(z, 6, s_78);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 44:
+                {   int ret = slice_from_s(z, 6, s_79);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 45:
+                {   int ret = slice_from_s(z, 5, s_80);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 46:
+                {   int ret = slice_from_s(z, 5, s_81);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 47:
+                {   int ret = slice_from_s(z, 4, s_82);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 48:
+                {   int ret = slice_from_s(z, 4, s_83);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 49:
+                {   int ret = slice_from_s(z, 5, s_84);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 50:
+                {   int ret = slice_from_s(z, 6, s_85);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 51:
+                {   int ret = slice_from_s(z, 4, s_86);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 52:
+                if (!(z->I[1])) goto lab21;
+                {   int ret = slice_from_s(z, 4, s_87);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 53:
+                {   int ret = slice_from_s(z, 4, s_88);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 54:
+                {   int ret = slice_from_s(z, 4, s_89);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 55:
+                if (!(z->I[1])) goto lab21;
+                {   int ret = slice_from_s(z, 4, s_90);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 56:
+                {   int ret = slice_from_s(z, 4, s_91);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 57:
+                if (!(z->I[1])) goto lab21;
+                {   int ret = slice_from_s(z, 4, s_92);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 58:
+                {   int ret = slice_from_s(z, 4, s_93);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 59:
+                {   int ret = slice_from_s(z, 4, s_94);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 60:
+                {   int ret = slice_from_s(z, 4, s_95);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 61:
+                {   int ret = slice_from_s(z, 4, s_96);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 62:
+                {   int ret = slice_from_s(z, 4, s_97);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 63:
+                {   int ret = slice_from_s(z, 5, s_98);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 64:
+                {   int ret = slice_from_s(z, 5, s_99);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 65:
+                if (!(z->I[1])) goto lab21;
+                {   int ret = slice_from_s(z, 5, s_100);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 66:
+                {   int ret = slice_from_s(z, 5, s_101);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 67:
+                {   int ret = slice_from_s(z, 4, s_102);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 68:
+                {   int ret = slice_from_s(z, 5, s_103);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 69:
+                {   int ret = slice_from_s(z, 6, s_104);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 70:
+                {   int ret = slice_from_s(z, 5, s_105);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 71:
+                {   int ret = slice_from_s(z, 4, s_106);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 72:
+                if (!(z->I[1])) goto lab21;
+                {   int ret = slice_from_s(z, 4, s_107);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 73:
+                {   int ret = slice_from_s(z, 3, s_108);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 74:
+                {   int ret = slice_from_s(z, 3, s_109);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 75:
+                {   int ret = slice_from_s(z, 3, s_110);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 76:
+                {   int ret = slice_from_s(z, 3, s_111);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 77:
+                {   int ret = slice_from_s(z, 6, s_112);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 78:
+                {   int ret = slice_from_s(z, 4, s_113);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 79:
+                {   int ret = slice_from_s(z, 3, s_114);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 80:
+                {   int ret = slice_from_s(z, 3, s_115);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 81:
+                {   int ret = slice_from_s(z, 3, s_116);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 82:
+                {   int ret = slice_from_s(z, 4, s_117);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 83:
+                {   int ret = slice_from_s(z, 4, s_118);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 84:
+                {   int ret = slice_from_s(z, 4, s_119);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 85:
+                {   int ret = slice_from_s(z, 4, s_120);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 86:
+                {   int ret = slice_from_s(z, 4, s_121);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 87:
+                {   int ret = slice_from_s(z, 4, s_122);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 88:
+                {   int ret = slice_from_s(z, 4, s_123);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 89:
+                {   int ret = slice_from_s(z, 4, s_124);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 90:
+                {   int ret = slice_from_s(z, 4, s_125);
+                    if (ret < 0) return ret;
+                }
+                break;
+            case 91:
+                if (!(z->I[1])) goto lab21;
+                {   int ret = slice_from_s(z, 4, s_126);
+                    if (ret < 0) return ret;
+                }
+                break;
+        }
+    lab21:
+        z->c = z->l - m17;
+    }
+    {   int m18 = z->l - z->c; (void)m18;
+        {   int m19 = z->l - z->c; (void)m19;
+            z->ket = z->c;
+            if (z->c - 1 <= z->lb) goto lab24;
+            among_var = find_among_b_2(z);
+            if (!(among_var)) goto lab24;
+            z->bra = z->c;
+            if (!(z->I[0] <= z->c)) goto lab24;
+            switch (among_var) {
+                case 1:
+                    {   int ret = slice_from_s(z, 2, s_127);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 2:
+                    {   int ret = slice_from_s(z, 2, s_128);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 3:
+                    {   int ret = slice_from_s(z, 3, s_129);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 4:
+                    {   int ret = slice_from_s(z, 3, s_130);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 5:
+                    {   int ret = slice_from_s(z, 5, s_131);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 6:
+                    {   int ret = slice_from_s(z, 5, s_132);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 7:
+                    {   int ret = slice_from_s(z, 5, s_133);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 8:
+                    {   int ret = slice_from_s(z, 5, s_134);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 9:
+                    {   int ret = slice_from_s(z, 5, s_135);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 10:
+                    {   int ret = slice_from_s(z, 2, s_136);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 11:
+                    {   int ret = slice_from_s(z, 2, s_137);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 12:
+                    {   int ret = slice_from_s(z, 2, s_138);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 13:
+                    {   int ret = slice_from_s(z, 1, s_139);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 14:
+                    {   int ret = slice_from_s(z, 2, s_140);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 15:
+                    {   int ret = slice_from_s(z, 2, s_141);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 16:
+                    {   int ret = slice_from_s(z, 2, s_142);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 17:
+                    {   int ret = slice_from_s(z, 4, s_143);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 18:
+                    {   int ret = slice_from_s(z, 2, s_144);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 19:
+                    {   int ret = slice_from_s(z, 3, s_145);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 20:
+                    {   int ret = slice_from_s(z, 1, s_146);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 21:
+                    {   int ret = slice_from_s(z, 4, s_147);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 22:
+                    {   int ret = slice_from_s(z, 3, s_148);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 23:
+                    {   int ret = slice_from_s(z, 2, s_149);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 24:
+                    {   int ret = slice_from_s(z, 2, s_150);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 25:
+                    {   int ret = slice_from_s(z, 2, s_151);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 26:
+                    {   int ret = slice_from_s(z, 3, s_152);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 27:
+                    {   int ret = slice_from_s(z, 3, s_153);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 28:
+                    {   int ret = slice_from_s(z, 3, s_154);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 29:
+                    {   int ret = slice_from_s(z, 3, s_155);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 30:
+                    {   int ret = slice_from_s(z, 3, s_156);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 31:
+                    {   int ret = slice_from_s(z, 3, s_157);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 32:
+                    {   int ret = slice_from_s(z, 3, s_158);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 33:
+                    {   int ret = slice_from_s(z, 3, s_159);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 34:
+                    {   int ret = slice_from_s(z, 3, s_160);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 35:
+                    {   int ret = slice_from_s(z, 3, s_161);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 36:
+                    {   int ret = slice_from_s(z, 3, s_162);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 37:
+                    {   int ret = slice_from_s(z, 3, s_163);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 38:
+                    {   int ret = slice_from_s(z, 3, s_164);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 39:
+                    {   int ret = slice_from_s(z, 3, s_165);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 40:
+                    {   int ret = slice_from_s(z, 3, s_166);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 41:
+                    {   int ret = slice_from_s(z, 3, s_167);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 42:
+                    {   int ret = slice_from_s(z, 3, s_168);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 43:
+                    {   int ret = slice_from_s(z, 3, s_169);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 44:
+                    {   int ret = slice_from_s(z, 3, s_170);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 45:
+                    {   int ret = slice_from_s(z, 3, s_171);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 46:
+                    {   int ret = slice_from_s(z, 3, s_172);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 47:
+                    {   int ret = slice_from_s(z, 4, s_173);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 48:
+                    {   int ret = slice_from_s(z, 4, s_174);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 49:
+                    {   int ret = slice_from_s(z, 4, s_175);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 50:
+                    {   int ret = slice_from_s(z, 2, s_176);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 51:
+                    {   int ret = slice_from_s(z, 3, s_177);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 52:
+                    {   int ret = slice_from_s(z, 3, s_178);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 53:
+                    {   int ret = slice_from_s(z, 2, s_179);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 54:
+                    {   int ret = slice_from_s(z, 2, s_180);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 55:
+                    {   int ret = slice_from_s(z, 2, s_181);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 56:
+                    {   int ret = slice_from_s(z, 2, s_182);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 57:
+                    {   int ret = slice_from_s(z, 2, s_183);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 58:
+                    {   int ret = slice_from_s(z, 2, s_184);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 59:
+                    {   int ret = slice_from_s(z, 3, s_185);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 60:
+                    {   int ret = slice_from_s(z, 3, s_186);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 61:
+                    {   int ret = slice_from_s(z, 3, s_187);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 62:
+                    {   int ret = slice_from_s(z, 3, s_188);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 63:
+                    {   int ret = slice_from_s(z, 3, s_189);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 64:
+                    {   int ret = slice_from_s(z, 3, s_190);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 65:
+                    {   int ret = slice_from_s(z, 3, s_191);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 66:
+                    {   int ret = slice_from_s(z, 2, s_192);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 67:
+                    {   int ret = slice_from_s(z, 2, s_193);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 68:
+                    {   int ret = slice_from_s(z, 4, s_194);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 69:
+                    {   int ret = slice_from_s(z, 3, s_195);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 70:
+                    {   int ret = slice_from_s(z, 2, s_196);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 71:
+                    {   int ret = slice_from_s(z, 3, s_197);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 72:
+                    {   int ret = slice_from_s(z, 3, s_198);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 73:
+                    {   int ret = slice_from_s(z, 3, s_199);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 74:
+                    {   int ret = slice_from_s(z, 3, s_200);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 75:
+                    {   int ret = slice_from_s(z, 3, s_201);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 76:
+                    {   int ret = slice_from_s(z, 3, s_202);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 77:
+                    {   int ret = slice_from_s(z, 2, s_203);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 78:
+                    {   int ret = slice_from_s(z, 2, s_204);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 79:
+                    {   int ret = slice_from_s(z, 2, s_205);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 80:
+                    {   int ret = slice_from_s(z, 2, s_206);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 81:
+                    {   int ret = slice_from_s(z, 3, s_207);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 82:
+                    {   int ret = slice_from_s(z, 3, s_208);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 83:
+                    {   int ret = slice_from_s(z, 2, s_209);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 84:
+                    {   int ret = slice_from_s(z, 3, s_210);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 85:
+                    {   int ret = slice_from_s(z, 3, s_211);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 86:
+                    {   int ret = slice_from_s(z, 3, s_212);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 87:
+                    {   int ret = slice_from_s(z, 2, s_213);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 88:
+                    {   int ret = slice_from_s(z, 2, s_214);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 89:
+                    {   int ret = slice_from_s(z, 3, s_215);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 90:
+                    {   int ret = slice_from_s(z, 4, s_216);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 91:
+                    {   int ret = slice_from_s(z, 2, s_217);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 92:
+                    {   int ret = slice_from_s(z, 4, s_218);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 93:
+                    {   int ret = slice_from_s(z, 4, s_219);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 94:
+                    {   int ret = slice_from_s(z, 3, s_220);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 95:
+                    {   int ret = slice_from_s(z, 1, s_221);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 96:
+                    {   int ret = slice_from_s(z, 3, s_222);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 97:
+                    {   int ret = slice_from_s(z, 3, s_223);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 98:
+                    {   int ret = slice_from_s(z, 3, s_224);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 99:
+                    {   int ret = slice_from_s(z, 3, s_225);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 100:
+                    {   int ret = slice_from_s(z, 2, s_226);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 101:
+                    {   int ret = slice_from_s(z, 2, s_227);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 102:
+                    {   int ret = slice_from_s(z, 3, s_228);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 103:
+                    {   int ret = slice_from_s(z, 2, s_229);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 104:
+                    {   int ret = slice_from_s(z, 1, s_230);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 105:
+                    {   int ret = slice_from_s(z, 2, s_231);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 106:
+                    {   int ret = slice_from_s(z, 5, s_232);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 107:
+                    {   int ret = slice_from_s(z, 5, s_233);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 108:
+                    {   int ret = slice_from_s(z, 5, s_234);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 109:
+                    {   int ret = slice_from_s(z, 2, s_235);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 110:
+                    {   int ret = slice_from_s(z, 4, s_236);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 111:
+                    {   int ret = slice_from_s(z, 4, s_237);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 112:
+                    {   int ret = slice_from_s(z, 4, s_238);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 113:
+                    {   int ret = slice_from_s(z, 2, s_239);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 114:
+                    {   int ret = slice_from_s(z, 3, s_240);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 115:
+                    {   int ret = slice_from_s(z, 2, s_241);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 116:
+                    {   int ret = slice_from_s(z, 1, s_242);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 117:
+                    {   int ret = slice_from_s(z, 3, s_243);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 118:
+                    {   int ret = slice_from_s(z, 4, s_244);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 119:
+                    {   int ret = slice_from_s(z, 1, s_245);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 120:
+                    {   int ret = slice_from_s(z, 2, s_246);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 121:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_247);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 122:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_248);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 123:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 2, s_249);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 124:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 2, s_250);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 125:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 2, s_251);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 126:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 2, s_252);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 127:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 4, s_253);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 128:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_254);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 129:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_255);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 130:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_256);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 131:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_257);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 132:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_258);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 133:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_259);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 134:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_260);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 135:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_261);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 136:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 2, s_262);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 137:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_263);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 138:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 5, s_264);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 139:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 5, s_265);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 140:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 5, s_266);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 141:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 4, s_267);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 142:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 4, s_268);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 143:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 4, s_269);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 144:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_270);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 145:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_271);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 146:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_272);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 147:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_273);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 148:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_274);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 149:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 4, s_275);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 150:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_276);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 151:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 3, s_277);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 152:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 2, s_278);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 153:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 2, s_279);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 154:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 2, s_280);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 155:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 2, s_281);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 156:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 2, s_282);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 157:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 2, s_283);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 158:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 2, s_284);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 159:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 2, s_285);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 160:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 2, s_286);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 161:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 1, s_287);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 162:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 1, s_288);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 163:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 1, s_289);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+                case 164:
+                    if (!(z->I[1])) goto lab24;
+                    {   int ret = slice_from_s(z, 1, s_290);
+                        if (ret < 0) return ret;
+                    }
+                    break;
+            }
+            goto lab23;
+        lab24:
+            z->c = z->l - m19;
+            z->ket = z->c;
+            if (z->c <= z->lb || z->p[z->c - 1] >> 5 != 3 || !((3188642 >> (z->p[z->c - 1] & 0x1f)) & 1)) goto lab22;
+            if (!(find_among_b_3(z))) goto lab22;
+            z->bra = z->c;
+            if (!(z->I[0] <= z->c)) goto lab22;
+            {   int ret = slice_from_s(z, 0, 0);
+                if (ret < 0) return ret;
+            }
+        }
+    lab23:
+    lab22:
+        z->c = z->l - m18;
+    }
+    z->c = z->lb;
+    return 1;
+}
+
+extern struct SN_env * serbian_UTF_8_create_env(void) { return SN_create_env(0, 2); }
+
+extern void serbian_UTF_8_close_env(struct SN_env * z) { SN_close_env(z, 0); }
+
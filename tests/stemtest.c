@@ -7,6 +7,7 @@
 #include <string.h> /* for strlen, memcmp */
 
 #include "libstemmer.h"
+#include "../runtime/header.h"
 
 #define EMOJI_FACE_THROWING_A_KISS "\xf0\x9f\x98\x98"
 #define U_40079 "\xf1\x80\x81\xb9"
@@ -69,7 +70,593 @@ run_testcase(const char * language, const struct testcase *test)
                         language, input, len, stemmed, expect);
         exit(1);
     }
+
+    {
+        /* Check sb_stemmer_stem_into() with a buffer which is one symbol
+         * too small, and then with one which is just big enough. */
+        sb_symbol out[64];
+        int n = sb_stemmer_stem_into(stemmer, (const sb_symbol *)input,
+                                     strlen(input), out, len - 1);
+        if (n != len) {
+            fprintf(stderr, "%s stemmer needed size for %s was %d not %d\n",
+                            language, input, n, len);
+            exit(1);
+        }
+        n = sb_stemmer_stem_into(stemmer, (const sb_symbol *)input,
+                                 strlen(input), out, len);
+        if (n != len || memcmp(out, expect, len) != 0) {
+            fprintf(stderr, "%s stemmer output into buffer for %s was %.*s not %s\n",
+                            language, input, n, out, expect);
+            exit(1);
+        }
+    }
+    sb_stemmer_delete(stemmer);
+}
+
+static const char * batch_words[] = {
+    "connection", "connections", "connective", "connected", "connecting",
+    "", "a", "generously", "2000", "hal9000", 0
+};
+
+/* Check sb_stemmer_stem_batch() gives the same stems as sb_stemmer_stem(),
+ * including when the output buffer is too small for the whole batch.
+ */
+static void
+run_batch_test(const char * language)
+{
+    struct sb_stemmer * stemmer = sb_stemmer_new(language, NULL);
+    sb_symbol words[256];
+    sb_symbol out[256];
+    int offsets[16];
+    int out_offsets[16];
+    int count = 0;
+    int done = 0;
+    int pos = 0;
+    int i;
+
+    if (stemmer == 0) {
+        fprintf(stderr, "language `%s' not available for stemming\n", language);
+        exit(1);
+    }
+    offsets[0] = 0;
+    for (i = 0; batch_words[i]; ++i) {
+        int len = strlen(batch_words[i]);
+        memcpy(words + pos, batch_words[i], len);
+        pos += len;
+        offsets[++count] = pos;
+    }
+
+    /* Use a deliberately small output buffer to exercise resuming. */
+    while (done < count) {
+        int n = sb_stemmer_stem_batch(stemmer, words, offsets + done,
+                                      count - done, out, 12, out_offsets);
+        if (n < 0) {
+            fprintf(stderr, "Out of memory");
+            exit(1);
+        }
+        if (n == 0) {
+            fprintf(stderr, "%s batch stemmer made no progress\n", language);
+            exit(1);
+        }
+        for (i = 0; i < n; ++i) {
+            const char * word = batch_words[done + i];
+            const sb_symbol * stemmed;
+            int len;
+            sb_symbol stem[12];
+            int stem_len = out_offsets[i + 1] - out_offsets[i];
+            memcpy(stem, out + out_offsets[i], stem_len);
+            stemmed = sb_stemmer_stem(stemmer, (const sb_symbol *)word,
+                                      strlen(word));
+            if (stemmed == NULL) {
+                fprintf(stderr, "Out of memory");
+                exit(1);
+            }
+            len = sb_stemmer_length(stemmer);
+            if (len != stem_len || memcmp(stemmed, stem, len) != 0) {
+                fprintf(stderr, "%s batch stemmer output for %s was %.*s not %.*s\n",
+                                language, word, stem_len, stem, len, stemmed);
+                exit(1);
+            }
+        }
+        done += n;
+    }
+    sb_stemmer_delete(stemmer);
+}
+
+/* Check a stemmer with a small cache gives the same stems as one without,
+ * and that the cache statistics are plausible.
+ */
+static void
+run_cache_test(const char * language)
+{
+    struct sb_stemmer * cached = sb_stemmer_new(language, NULL);
+    struct sb_stemmer * uncached = sb_stemmer_new(language, NULL);
+    struct sb_stemmer_stats stats;
+    int pass, i;
+
+    if (cached == 0 || uncached == 0 || sb_stemmer_set_cache(cached, 8) < 0) {
+        fprintf(stderr, "Out of memory");
+        exit(1);
+    }
+    for (pass = 0; pass < 3; ++pass) {
+        for (i = 0; batch_words[i]; ++i) {
+            const char * word = batch_words[i];
+            const sb_symbol * expect;
+            const sb_symbol * stemmed;
+            int expect_len, len;
+            expect = sb_stemmer_stem(uncached, (const sb_symbol *)word,
+                                     strlen(word));
+            stemmed = sb_stemmer_stem(cached, (const sb_symbol *)word,
+                                      strlen(word));
+            if (expect == NULL || stemmed == NULL) {
+                fprintf(stderr, "Out of memory");
+                exit(1);
+            }
+            expect_len = sb_stemmer_length(uncached);
+            len = sb_stemmer_length(cached);
+            if (len != expect_len || memcmp(stemmed, expect, len) != 0 ||
+                stemmed[len] != 0) {
+                fprintf(stderr, "%s cached stemmer output for %s was %.*s not %.*s\n",
+                                language, word, len, stemmed, expect_len, expect);
+                exit(1);
+            }
+        }
+    }
+    sb_stemmer_get_stats(cached, &stats);
+    if (stats.hits + stats.misses != 3 * (unsigned long)i ||
+        stats.hits == 0 || stats.evictions == 0) {
+        fprintf(stderr, "%s cache statistics implausible: %lu hits, %lu misses, %lu evictions\n",
+                        language, stats.hits, stats.misses, stats.evictions);
+        exit(1);
+    }
+    sb_stemmer_delete(cached);
+    sb_stemmer_delete(uncached);
+}
+
+struct counting_context {
+    long live;
+};
+
+static void *
+counting_malloc(void * context, size_t size)
+{
+    ((struct counting_context *)context)->live++;
+    return malloc(size);
+}
+
+static void *
+counting_realloc(void * context, void * p, size_t size)
+{
+    (void)context;
+    return realloc(p, size);
+}
+
+static void
+counting_free(void * context, void * p)
+{
+    ((struct counting_context *)context)->live--;
+    free(p);
+}
+
+/* Check all allocations go through a custom allocator and are freed, and
+ * that stemming a short word doesn't allocate.
+ */
+static void
+run_allocator_test(void)
+{
+    static const char long_word[] =
+        "antidisestablishmentarianistically-overgeneralisations";
+    struct counting_context context = { 0 };
+    struct sb_allocator allocator;
+    struct sb_allocator_stats before, after;
+    struct sb_stemmer * stemmer;
+
+    allocator.malloc = counting_malloc;
+    allocator.realloc = counting_realloc;
+    allocator.free = counting_free;
+    allocator.context = &context;
+    sb_set_allocator(&allocator);
+
+    stemmer = sb_stemmer_new("english", NULL);
+    if (stemmer == NULL || context.live == 0) {
+        fprintf(stderr, "custom allocator not used\n");
+        exit(1);
+    }
+    sb_get_allocator_stats(&before);
+    if (sb_stemmer_stem(stemmer, (const sb_symbol *)"connected", 9) == NULL) {
+        fprintf(stderr, "Out of memory");
+        exit(1);
+    }
+    sb_get_allocator_stats(&after);
+    if (after.mallocs != before.mallocs || after.reallocs != before.reallocs) {
+        fprintf(stderr, "stemming a short word allocated memory\n");
+        exit(1);
+    }
+    if (sb_stemmer_stem(stemmer, (const sb_symbol *)long_word,
+                        strlen(long_word)) == NULL) {
+        fprintf(stderr, "Out of memory");
+        exit(1);
+    }
     sb_stemmer_delete(stemmer);
+    sb_get_allocator_stats(&after);
+    if (context.live != 0 || after.mallocs != after.frees) {
+        fprintf(stderr, "custom allocator: %ld blocks unfreed\n", context.live);
+        exit(1);
+    }
+    sb_set_allocator(NULL);
+}
+
+/* Check sb_profile_dump() writes well-formed output whatever size of buffer
+ * it's given, and that sb_profile_reset() zeroes the counters.  Unless the
+ * stemmers were generated with -profile there are none to report.
+ */
+static void
+run_profile_test(void)
+{
+    struct sb_stemmer * stemmer = sb_stemmer_new("english", NULL);
+    char small[4] = "xyz";
+    char * out;
+    const char * p;
+    int len;
+
+    sb_profile_reset();
+    if (stemmer == NULL ||
+        sb_stemmer_stem(stemmer, (const sb_symbol *)"connected", 9) == NULL) {
+        fprintf(stderr, "Out of memory");
+        exit(1);
+    }
+    len = sb_profile_dump(NULL, 0);
+    out = malloc(len + 1);
+    if (out == NULL) {
+        fprintf(stderr, "Out of memory");
+        exit(1);
+    }
+    if (sb_profile_dump(out, len + 1) != len || (int)strlen(out) != len ||
+        len < 3 || out[0] != '[' || strcmp(out + len - 2, "]\n") != 0) {
+        fprintf(stderr, "sb_profile_dump() gave '%s'\n", out);
+        exit(1);
+    }
+    if (sb_profile_dump(small, 2) != len || memcmp(small, out, 2) != 0 ||
+        strcmp(small + 2, "z") != 0) {
+        fprintf(stderr, "sb_profile_dump() overran a short buffer\n");
+        exit(1);
+    }
+    if (strstr(out, "\"stemmer\": \"") == NULL) {
+        if (strcmp(out, "[]\n") != 0) {
+            fprintf(stderr, "sb_profile_dump() gave '%s'\n", out);
+            exit(1);
+        }
+    } else {
+        if (strstr(out, "\"calls\": 1,") == NULL) {
+            fprintf(stderr, "sb_profile_dump() didn't count calls\n");
+            exit(1);
+        }
+        sb_profile_reset();
+        sb_profile_dump(out, len + 1);
+        for (p = out; (p = strchr(p, ':')) != NULL; p++) {
+            if (p[2] >= '1' && p[2] <= '9' && strncmp(p - 6, "\"line\"", 6) != 0) {
+                fprintf(stderr, "sb_profile_reset() didn't zero '%.20s'\n", p - 10);
+                exit(1);
+            }
+        }
+    }
+    free(out);
+    sb_stemmer_delete(stemmer);
+}
+
+/* Check case folding, placing non-ASCII characters at each offset in a
+ * long run of ASCII so every path through the SIMD kernels is used.
+ */
+static void
+run_casefold_test(void)
+{
+    static const char * const pairs[][2] = {
+        { "\xc3\x89", "\xc3\xa9" },         /* É -> é */
+        { "\xc3\x9f", "\xc3\x9f" },         /* ß is unchanged */
+        { "\xce\xa3", "\xcf\x83" },         /* Σ -> σ */
+        { "\xd0\x96", "\xd0\xb6" },         /* Ж -> ж */
+        { "\xc8\xba", "\xe2\xb1\xa5" },     /* Ⱥ -> ⱥ */
+        { "\xe2\x84\xaa", "k" },            /* Kelvin sign -> k */
+        { "\xf0\x90\x90\x80", "\xf0\x90\x90\xa8" } /* Deseret Long I */
+    };
+    sb_symbol in[100];
+    sb_symbol expected[100];
+    sb_symbol out[150];
+    int p, i;
+
+    for (p = 0; p < 7; ++p) {
+        for (i = 0; i < 70; ++i) {
+            int in_len = strlen(pairs[p][0]);
+            int out_len = strlen(pairs[p][1]);
+            int j, n;
+            for (j = 0; j < 90; ++j) {
+                in[j] = "AbCdEfGhIjKlMnOpQrStUvWxYz@[`{0"[j % 32];
+            }
+            memcpy(in + i, pairs[p][0], in_len);
+            for (j = 0; j < 90; ++j) {
+                expected[j] = "abcdefghijklmnopqrstuvwxyz@[`{0"[j % 32];
+            }
+            memmove(expected + i + out_len, expected + i + in_len,
+                    90 - i - in_len);
+            memcpy(expected + i, pairs[p][1], out_len);
+            n = sb_casefold_utf8(in, 90, out, sizeof(out));
+            if (n != 90 - in_len + out_len || memcmp(out, expected, n) != 0) {
+                fprintf(stderr, "case folding of %s at offset %d gave %.*s\n",
+                                pairs[p][0], i, n, out);
+                exit(1);
+            }
+        }
+    }
+    if (sb_casefold_utf8((const sb_symbol *)"ABC\xc3", 4, out, sizeof(out)) != -1 ||
+        sb_casefold_utf8((const sb_symbol *)"\xed\xa0\x80", 3, out, sizeof(out)) != -1) {
+        fprintf(stderr, "case folding accepted invalid UTF-8\n");
+        exit(1);
+    }
+    if (sb_casefold_utf8((const sb_symbol *)"ABC\xc8\xba", 5, out, 4) != 6) {
+        fprintf(stderr, "case folding didn't report the size needed\n");
+        exit(1);
+    }
+}
+
+/* Check replacing a slice only moves a cursor inside it back to the start
+ * of the slice if the length changes, both at the end of the string and
+ * elsewhere.
+ */
+static void
+run_replace_test(void)
+{
+    static const symbol abcd[] = { 'a', 'b', 'c', 'd' };
+    static const symbol xyz[] = { 'x', 'y', 'z' };
+    struct SN_env * z = SN_create_env(0, 0);
+    int ket;
+
+    if (z == NULL) {
+        fprintf(stderr, "Out of memory");
+        exit(1);
+    }
+    for (ket = 3; ket <= 4; ++ket) {
+        if (SN_set_current(z, ket, abcd) != 0) {
+            fprintf(stderr, "Out of memory");
+            exit(1);
+        }
+        z->c = 1;
+        if (replace_s(z, 0, 3, 3, xyz, NULL) != 0 || z->c != 1 ||
+            z->l != ket || memcmp(z->p, xyz, sizeof(xyz)) != 0) {
+            fprintf(stderr, "same length replace moved the cursor to %d\n", z->c);
+            exit(1);
+        }
+        if (replace_s(z, 0, 3, 2, xyz, NULL) != 0 || z->c != 0 ||
+            z->l != ket - 1) {
+            fprintf(stderr, "shorter replace left the cursor at %d\n", z->c);
+            exit(1);
+        }
+    }
+    SN_close_env(z, 0);
+}
+
+/* Check bytecode which the interpreter can't run is rejected rather than
+ * loaded.
+ */
+static void
+run_bytecode_test(void)
+{
+    /* A header with no routines, so no "stem" external. */
+    static const unsigned char empty[44] = {
+        'S', 'N', 'B', 'C', 1, 0, 0, 0, 1
+    };
+    unsigned char data[44];
+    memcpy(data, empty, sizeof(data));
+    if (sb_stemmer_new_from_bytecode(data, 0) != NULL ||
+        sb_stemmer_new_from_bytecode(data, 20) != NULL ||
+        sb_stemmer_new_from_bytecode(data, sizeof(data)) != NULL) {
+        fprintf(stderr, "bytecode stemmer loaded from a bad header\n");
+        exit(1);
+    }
+    data[0] = 'X';
+    if (sb_stemmer_new_from_bytecode(data, sizeof(data)) != NULL) {
+        fprintf(stderr, "bytecode stemmer loaded with bad magic\n");
+        exit(1);
+    }
+}
+
+/* Check running text is split into words which are case folded and
+ * stemmed, and that stemming can resume when the output fills up.
+ */
+static void
+run_text_test(void)
+{
+    static const char text[] =
+        "The CONNECTED dog\xe2\x80\x99s, \xc2\xab" "Generously\xc2\xbb "
+        "'\xc3\x89TUDE' \xff ran-KNIGHTS";
+    static const char * const expected[] = {
+        "the", "connect", "dog", "generous", "\xc3\xa9tude", "ran", "knight"
+    };
+    struct sb_stemmer * stemmer = sb_stemmer_new("english", NULL);
+    struct sb_token tokens[10];
+    sb_symbol out[16];
+    int size = (int)strlen(text);
+    int pos = 0;
+    int i = 0;
+
+    if (stemmer == NULL) {
+        fprintf(stderr, "Out of memory");
+        exit(1);
+    }
+    while (pos < size) {
+        int used, n, j;
+        /* Use a small buffer so the call has to be repeated. */
+        n = sb_stemmer_stem_text(stemmer, (const sb_symbol *)text + pos,
+                                 size - pos, &used, tokens, 10, out, 16);
+        if (n <= 0) {
+            fprintf(stderr, "text stemmer failed at offset %d\n", pos);
+            exit(1);
+        }
+        for (j = 0; j < n; ++j, ++i) {
+            int len = tokens[j].stem_end - tokens[j].stem_start;
+            if (i >= 7 || len != (int)strlen(expected[i]) ||
+                memcmp(out + tokens[j].stem_start, expected[i], len) != 0) {
+                fprintf(stderr, "text stemmer output for word %d was %.*s\n",
+                                i, len, out + tokens[j].stem_start);
+                exit(1);
+            }
+        }
+        pos += used;
+    }
+    if (i != 7) {
+        fprintf(stderr, "text stemmer found %d words not 7\n", i);
+        exit(1);
+    }
+    sb_stemmer_delete(stemmer);
+}
+
+/* Check parallel stemming gives the same stems in the same order as
+ * stemming one word at a time.
+ */
+static void
+run_parallel_test(void)
+{
+    enum { COUNT = 5000 };
+    const struct sb_algorithm * algorithm = sb_algorithm_find("english", NULL);
+    struct sb_stemmer * stemmer = sb_stemmer_new_from_algorithm(algorithm);
+    static sb_symbol words[COUNT * 16];
+    static sb_symbol out[COUNT * 16];
+    static int offsets[COUNT + 1];
+    static int out_offsets[COUNT + 1];
+    int pos = 0;
+    int i, n;
+
+    if (stemmer == NULL) {
+        fprintf(stderr, "Out of memory");
+        exit(1);
+    }
+    offsets[0] = 0;
+    for (i = 0; i < COUNT; ++i) {
+        const char * word = batch_words[i % 10];
+        int len = strlen(word);
+        memcpy(words + pos, word, len);
+        pos += len;
+        /* Make most of the words distinct. */
+        pos += sprintf((char *)words + pos, "%d", i / 10);
+        offsets[i + 1] = pos;
+    }
+    for (i = 1; i <= COUNT; ++i) out_offsets[i] = -1;
+    n = sb_stemmer_stem_parallel(algorithm, 4, words, offsets, COUNT,
+                                 out, 10, out_offsets);
+    if (n <= 10) {
+        fprintf(stderr, "parallel stemmer didn't report the size needed\n");
+        exit(1);
+    }
+    for (i = 1; i <= COUNT; ++i) {
+        if (out_offsets[i] != -1) {
+            fprintf(stderr, "parallel stemmer wrote out_offsets[%d] when out was too small\n", i);
+            exit(1);
+        }
+    }
+    if (sb_stemmer_stem_parallel(algorithm, 4, words, offsets, COUNT,
+                                 out, n, out_offsets) != n) {
+        fprintf(stderr, "parallel stemmer failed\n");
+        exit(1);
+    }
+    for (i = 0; i < COUNT; ++i) {
+        int len = out_offsets[i + 1] - out_offsets[i];
+        const sb_symbol * stemmed;
+        stemmed = sb_stemmer_stem(stemmer, words + offsets[i],
+                                  offsets[i + 1] - offsets[i]);
+        if (stemmed == NULL) {
+            fprintf(stderr, "Out of memory");
+            exit(1);
+        }
+        if (len != sb_stemmer_length(stemmer) ||
+            memcmp(out + out_offsets[i], stemmed, len) != 0) {
+            fprintf(stderr, "parallel stemmer output for word %d was %.*s not %s\n",
+                            i, len, out + out_offsets[i], stemmed);
+            exit(1);
+        }
+    }
+    sb_stemmer_delete(stemmer);
+}
+
+/* Check a pool reuses stemmer objects and respects its size limit.
+ */
+static void
+run_pool_test(void)
+{
+    struct sb_stemmer_pool * pool;
+    struct sb_stemmer_pool_stats stats;
+    struct sb_stemmer * s[3];
+    const sb_symbol * stemmed;
+    int i;
+
+    pool = sb_stemmer_pool_new(sb_algorithm_find("english", NULL), 2);
+    if (pool == NULL) {
+        fprintf(stderr, "Out of memory");
+        exit(1);
+    }
+    for (i = 0; i < 3; ++i) {
+        s[i] = sb_stemmer_pool_get(pool);
+        if (s[i] == NULL) {
+            fprintf(stderr, "Out of memory");
+            exit(1);
+        }
+    }
+    for (i = 0; i < 3; ++i) sb_stemmer_pool_put(pool, s[i]);
+    s[0] = sb_stemmer_pool_get(pool);
+    stemmed = sb_stemmer_stem(s[0], (const sb_symbol *)"connected", 9);
+    if (stemmed == NULL ||
+        sb_stemmer_length(s[0]) != 7 || memcmp(stemmed, "connect", 7) != 0) {
+        fprintf(stderr, "pooled stemmer gave wrong output\n");
+        exit(1);
+    }
+    sb_stemmer_pool_put(pool, s[0]);
+    sb_stemmer_pool_get_stats(pool, &stats);
+    if (stats.created != 3 || stats.reused != 1 || stats.discarded != 1) {
+        fprintf(stderr, "pool statistics wrong: %lu created, %lu reused, %lu discarded\n",
+                        stats.created, stats.reused, stats.discarded);
+        exit(1);
+    }
+    sb_stemmer_pool_delete(pool);
+}
+
+/* Check stemmers created from one shared algorithm handle don't interfere
+ * with each other.
+ */
+static void
+run_algorithm_test(void)
+{
+    const struct sb_algorithm * algorithm = sb_algorithm_find("english", NULL);
+    struct sb_stemmer * s1;
+    struct sb_stemmer * s2;
+    const sb_symbol * stemmed;
+
+    if (sb_algorithm_find("e", NULL) != NULL ||
+        sb_algorithm_find("english", "EBCDIC") != NULL ||
+        sb_stemmer_new_from_algorithm(NULL) != NULL) {
+        fprintf(stderr, "unknown algorithm or encoding was accepted\n");
+        exit(1);
+    }
+    if (algorithm == NULL) {
+        fprintf(stderr, "language `english' not available for stemming\n");
+        exit(1);
+    }
+    s1 = sb_stemmer_new_from_algorithm(algorithm);
+    s2 = sb_stemmer_new_from_algorithm(algorithm);
+    if (s1 == NULL || s2 == NULL) {
+        fprintf(stderr, "Out of memory");
+        exit(1);
+    }
+    stemmed = sb_stemmer_stem(s1, (const sb_symbol *)"connected", 9);
+    if (sb_stemmer_stem(s2, (const sb_symbol *)"generously", 10) == NULL ||
+        stemmed == NULL) {
+        fprintf(stderr, "Out of memory");
+        exit(1);
+    }
+    if (sb_stemmer_length(s1) != 7 || memcmp(stemmed, "connect", 7) != 0) {
+        fprintf(stderr, "shared algorithm stemmer output for connected was %.*s\n",
+                        sb_stemmer_length(s1), stemmed);
+        exit(1);
+    }
+    sb_stemmer_delete(s1);
+    sb_stemmer_delete(s2);
 }
 
 int
@@ -91,5 +678,22 @@ main(int argc, char * argv[])
         }
     }
 
+    {
+        const char ** l;
+        for (l = all_languages; *l; ++l) {
+            run_batch_test(*l);
+            run_cache_test(*l);
+        }
+    }
+    run_algorithm_test();
+    run_allocator_test();
+    run_pool_test();
+    run_parallel_test();
+    run_casefold_test();
+    run_profile_test();
+    run_replace_test();
+    run_bytecode_test();
+    run_text_test();
+
     return 0;
 }